@@ -136,6 +136,7 @@ macro(draco_set_build_definitions)
   # compiler flags added to their compile commands to enable intrinsics.
   set(draco_neon_source_file_suffix "neon.cc")
   set(draco_sse4_source_file_suffix "sse4.cc")
+  draco_optimization_detect()
 
   if((${CMAKE_CXX_COMPILER_ID} STREQUAL "GNU" AND ${CMAKE_CXX_COMPILER_VERSION}
                                                   VERSION_LESS 5)
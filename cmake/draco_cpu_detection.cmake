@@ -19,7 +19,8 @@ set(DRACO_CMAKE_DRACO_CPU_DETECTION_CMAKE_ 1)
 
 # Detect optimizations available for the current target CPU.
 macro(draco_optimization_detect)
-  if(DRACO_ENABLE_OPTIMIZATIONS)
+  # The intrinsics are not supported by the Emscripten toolchain.
+  if(DRACO_ENABLE_OPTIMIZATIONS AND NOT EMSCRIPTEN)
     string(TOLOWER "${CMAKE_SYSTEM_PROCESSOR}" cpu_lowercase)
     if(cpu_lowercase MATCHES "^arm|^aarch64")
       set(draco_have_neon ON)
@@ -39,4 +40,12 @@ macro(draco_optimization_detect)
   else()
     list(APPEND draco_defines "DRACO_ENABLE_SSE4_1=0")
   endif()
+
+  # WASM SIMD is enabled for the whole module because WebAssembly does not
+  # support runtime detection. The JavaScript loader picks the module instead.
+  if(EMSCRIPTEN AND DRACO_WASM AND DRACO_WASM_SIMD)
+    list(APPEND draco_defines "DRACO_ENABLE_WASM_SIMD=1")
+  else()
+    list(APPEND draco_defines "DRACO_ENABLE_WASM_SIMD=0")
+  endif()
 endmacro()
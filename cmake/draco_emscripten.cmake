@@ -87,6 +87,36 @@ macro(draco_get_required_emscripten_flags)
       list(APPEND ${em_FLAG_LIST_VAR_COMPILER} "-sWASM=0")
     endif()
 
+    if(DRACO_WASM_SIMD)
+      if(NOT DRACO_WASM)
+        message(FATAL_ERROR "DRACO_WASM_SIMD requires DRACO_WASM.")
+      endif()
+      list(APPEND ${em_FLAG_LIST_VAR_COMPILER} "-msimd128")
+    endif()
+
+    # Threads use a SharedArrayBuffer as the WASM memory, so the heap can be
+    # shared with web workers. ParallelDecoder decodes on the pthread pool.
+    if(DRACO_WASM_THREADS)
+      if(NOT DRACO_WASM)
+        message(FATAL_ERROR "DRACO_WASM_THREADS requires DRACO_WASM.")
+      endif()
+      list(APPEND ${em_FLAG_LIST_VAR_COMPILER} "-pthread")
+      list(APPEND ${em_FLAG_LIST_VAR_COMPILER}
+                  "-sPTHREAD_POOL_SIZE=navigator.hardwareConcurrency")
+    endif()
+
+    # The minimal decoder trades a little speed of the allocator for code size,
+    # and relies on the default streaming instantiation of the .wasm file.
+    if(DRACO_WASM_MINIMAL_DECODER)
+      if(NOT DRACO_WASM)
+        message(FATAL_ERROR "DRACO_WASM_MINIMAL_DECODER requires DRACO_WASM.")
+      endif()
+      list(APPEND ${em_FLAG_LIST_VAR_COMPILER} "-Oz")
+      list(APPEND ${em_FLAG_LIST_VAR_COMPILER} "-sMALLOC=emmalloc")
+      list(APPEND ${em_FLAG_LIST_VAR_COMPILER} "-sASSERTIONS=0")
+      list(APPEND ${em_FLAG_LIST_VAR_COMPILER} "-sWASM_ASYNC_COMPILATION=1")
+    endif()
+
     # The LEGACY_VM_SUPPORT flag is reported as linker only.
     if(DRACO_IE_COMPATIBLE)
       list(APPEND ${em_FLAG_LIST_VAR_COMPILER} "-sLEGACY_VM_SUPPORT=1")
@@ -200,23 +230,22 @@ macro(draco_add_emscripten_executable)
   # passed in with the target.
   list(APPEND emexe_LINK_FLAGS ${DRACO_CXX_FLAGS})
 
+  # Add "_gltf" and "_simd" suffixes to target output name, so that all variants
+  # can be deployed side by side.
+  set(emexe_OUTPUT_NAME ${emexe_NAME})
   if(DRACO_GLTF_BITSTREAM)
-    # Add "_gltf" suffix to target output name.
-    draco_add_executable(
-      NAME ${emexe_NAME}
-      OUTPUT_NAME ${emexe_NAME}_gltf
-      SOURCES ${emexe_SOURCES}
-      DEFINES ${emexe_DEFINES}
-      INCLUDES ${emexe_INCLUDES}
-      LINK_FLAGS ${emexe_LINK_FLAGS})
-  else()
-    draco_add_executable(
-      NAME ${emexe_NAME}
-      SOURCES ${emexe_SOURCES}
-      DEFINES ${emexe_DEFINES}
-      INCLUDES ${emexe_INCLUDES}
-      LINK_FLAGS ${emexe_LINK_FLAGS})
+    set(emexe_OUTPUT_NAME ${emexe_OUTPUT_NAME}_gltf)
+  endif()
+  if(DRACO_WASM_SIMD)
+    set(emexe_OUTPUT_NAME ${emexe_OUTPUT_NAME}_simd)
   endif()
+  draco_add_executable(
+    NAME ${emexe_NAME}
+    OUTPUT_NAME ${emexe_OUTPUT_NAME}
+    SOURCES ${emexe_SOURCES}
+    DEFINES ${emexe_DEFINES}
+    INCLUDES ${emexe_INCLUDES}
+    LINK_FLAGS ${emexe_LINK_FLAGS})
 
   foreach(feature ${emexe_FEATURES})
     draco_enable_feature(FEATURE ${feature} TARGETS ${emexe_NAME})
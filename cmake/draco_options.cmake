@@ -103,10 +103,42 @@ macro(draco_set_default_options)
     NAME DRACO_TESTS
     HELPSTRING "Enables tests."
     VALUE OFF)
+  draco_option(
+    NAME DRACO_ENABLE_OPTIMIZATIONS
+    HELPSTRING "Enables SIMD optimizations for the target CPU."
+    VALUE ON)
+  draco_option(
+    NAME DRACO_ENABLE_SSE4_1
+    HELPSTRING "Enables SSE4.1 optimizations on x86 targets."
+    VALUE ON)
+  draco_option(
+    NAME DRACO_ENABLE_NEON
+    HELPSTRING "Enables NEON optimizations on ARM targets."
+    VALUE ON)
+  draco_option(
+    NAME DRACO_BENCHMARKS
+    HELPSTRING "Enables benchmarks. Requires DRACO_TESTS and Google Benchmark."
+    VALUE OFF)
   draco_option(
     NAME DRACO_WASM
     HELPSTRING "Enables WASM support."
     VALUE OFF)
+  draco_option(
+    NAME DRACO_WASM_SIMD
+    HELPSTRING "Enables 128-bit WASM SIMD. Requires DRACO_WASM."
+    VALUE OFF)
+  draco_option(
+    NAME DRACO_WASM_THREADS
+    HELPSTRING "Enables pthreads in WASM builds. Requires DRACO_WASM."
+    VALUE OFF)
+  draco_option(
+    NAME DRACO_WASM_MINIMAL_DECODER
+    HELPSTRING "Builds only a size optimized WASM decoder. Requires DRACO_WASM."
+    VALUE OFF)
+  draco_option(
+    NAME DRACO_WASM_METADATA_QUERIER
+    HELPSTRING "Keeps MetadataQuerier in DRACO_WASM_MINIMAL_DECODER builds."
+    VALUE OFF)
   draco_option(
     NAME DRACO_UNITY_PLUGIN
     HELPSTRING "Build plugin library for Unity."
@@ -127,6 +159,14 @@ macro(draco_set_default_options)
     NAME DRACO_TRANSCODER_SUPPORTED
     HELPSTRING "Enable the Draco transcoder."
     VALUE OFF)
+  draco_option(
+    NAME DRACO_THREADING
+    HELPSTRING "Enables worker threads. When off, ThreadPool runs tasks serially."
+    VALUE ON)
+  draco_option(
+    NAME DRACO_TRACING
+    HELPSTRING "Enable stage events for CodingTracer."
+    VALUE OFF)
   draco_option(
     NAME DRACO_DEBUG_COMPILER_WARNINGS
     HELPSTRING "Turn on more warnings."
@@ -210,7 +250,8 @@ macro(draco_set_optional_features)
       endif()
     endif()
 
-    if(DRACO_BACKWARDS_COMPATIBILITY)
+    # The minimal WASM decoder supports only the current bitstream versions.
+    if(DRACO_BACKWARDS_COMPATIBILITY AND NOT DRACO_WASM_MINIMAL_DECODER)
       draco_enable_feature(FEATURE "DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED")
     endif()
 
@@ -240,6 +281,14 @@ macro(draco_set_optional_features)
     draco_enable_feature(FEATURE "DRACO_TRANSCODER_SUPPORTED")
   endif()
 
+  if(DRACO_TRACING)
+    draco_enable_feature(FEATURE "DRACO_TRACING_SUPPORTED")
+  endif()
+
+  if(DRACO_THREADING)
+    draco_enable_feature(FEATURE "DRACO_THREADING_SUPPORTED")
+  endif()
+
 
 endmacro()
 
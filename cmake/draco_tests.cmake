@@ -24,6 +24,8 @@ set(draco_factory_test_sources
     "${draco_src_root}/io/file_reader_factory_test.cc"
     "${draco_src_root}/io/file_writer_factory_test.cc")
 
+set(draco_benchmark_sources "${draco_src_root}/tools/draco_benchmarks.cc")
+
 list(
   APPEND draco_test_common_sources
          "${draco_src_root}/core/draco_test_base.h"
@@ -34,43 +36,93 @@ list(
 list(
   APPEND
     draco_test_sources
+    "${draco_src_root}/animation/keyframe_animation_buffer_decoder_test.cc"
     "${draco_src_root}/animation/keyframe_animation_encoding_test.cc"
     "${draco_src_root}/animation/keyframe_animation_test.cc"
+    "${draco_src_root}/attributes/attribute_quantization_transform_test.cc"
     "${draco_src_root}/attributes/point_attribute_test.cc"
+    "${draco_src_root}/compression/attributes/attribute_quantization_selector_test.cc"
+    "${draco_src_root}/compression/attributes/normal_compression_utils_test.cc"
     "${draco_src_root}/compression/attributes/point_d_vector_test.cc"
+    "${draco_src_root}/compression/attributes/prediction_schemes/mesh_prediction_scheme_feature_id_test.cc"
+    "${draco_src_root}/compression/attributes/prediction_schemes/mesh_prediction_scheme_skin_test.cc"
     "${draco_src_root}/compression/attributes/prediction_schemes/prediction_scheme_normal_octahedron_canonicalized_transform_test.cc"
     "${draco_src_root}/compression/attributes/prediction_schemes/prediction_scheme_normal_octahedron_transform_test.cc"
     "${draco_src_root}/compression/attributes/sequential_integer_attribute_encoding_test.cc"
+    "${draco_src_root}/compression/attributes/sequential_lossless_float_attribute_encoding_test.cc"
+    "${draco_src_root}/compression/attributes/sequential_ycocg_attribute_encoding_test.cc"
     "${draco_src_root}/compression/bit_coders/rans_coding_test.cc"
+    "${draco_src_root}/compression/chunked_mesh_encoder_test.cc"
+    "${draco_src_root}/compression/config/encode_plan_test.cc"
     "${draco_src_root}/compression/decode_test.cc"
+    "${draco_src_root}/compression/encode_analysis_test.cc"
     "${draco_src_root}/compression/encode_test.cc"
+    "${draco_src_root}/compression/encoder_auto_tune_test.cc"
     "${draco_src_root}/compression/entropy/shannon_entropy_test.cc"
     "${draco_src_root}/compression/entropy/symbol_coding_test.cc"
+    "${draco_src_root}/compression/geometry_bundle_encoder_test.cc"
+    "${draco_src_root}/compression/geometry_source_test.cc"
+    "${draco_src_root}/compression/lidar_encoding_test.cc"
     "${draco_src_root}/compression/mesh/mesh_edgebreaker_encoding_test.cc"
     "${draco_src_root}/compression/mesh/mesh_encoder_test.cc"
+    "${draco_src_root}/compression/mesh_attributes_reencoder_test.cc"
+    "${draco_src_root}/compression/mesh_buffer_decoder_test.cc"
+    "${draco_src_root}/compression/mesh_sequence_encoder_test.cc"
+    "${draco_src_root}/compression/point_cloud_sequence_encoder_test.cc"
     "${draco_src_root}/compression/point_cloud/point_cloud_kd_tree_encoding_test.cc"
     "${draco_src_root}/compression/point_cloud/point_cloud_sequential_encoding_test.cc"
+    "${draco_src_root}/compression/progressive_mesh_encoder_test.cc"
+    "${draco_src_root}/compression/size_estimation_test.cc"
+    "${draco_src_root}/compression/streaming_decoder_test.cc"
+    "${draco_src_root}/core/bit_vector_test.cc"
     "${draco_src_root}/core/buffer_bit_coding_test.cc"
+    "${draco_src_root}/core/coding_stats_test.cc"
+    "${draco_src_root}/core/cpu_features_test.cc"
+    "${draco_src_root}/core/data_buffer_test.cc"
+    "${draco_src_root}/core/deduplication_utils_test.cc"
+    "${draco_src_root}/core/encoder_buffer_test.cc"
     "${draco_src_root}/core/math_utils_test.cc"
+    "${draco_src_root}/core/memory_arena_test.cc"
+    "${draco_src_root}/core/options_test.cc"
     "${draco_src_root}/core/quantization_utils_test.cc"
     "${draco_src_root}/core/status_test.cc"
+    "${draco_src_root}/core/thread_pool_test.cc"
+    "${draco_src_root}/core/varint_coding_test.cc"
     "${draco_src_root}/core/vector_d_test.cc"
+    "${draco_src_root}/io/async_file_writer_test.cc"
+    "${draco_src_root}/io/draco_mesh_cache_test.cc"
     "${draco_src_root}/io/file_reader_test_common.h"
     "${draco_src_root}/io/file_utils_test.cc"
     "${draco_src_root}/io/file_writer_utils_test.cc"
+    "${draco_src_root}/io/json_reader_test.cc"
+    "${draco_src_root}/io/meshopt_codec_test.cc"
+    "${draco_src_root}/io/mmap_file_reader_test.cc"
     "${draco_src_root}/io/stdio_file_reader_test.cc"
     "${draco_src_root}/io/stdio_file_writer_test.cc"
     "${draco_src_root}/io/obj_decoder_test.cc"
+    "${draco_src_root}/io/las_decoder_test.cc"
     "${draco_src_root}/io/obj_encoder_test.cc"
+    "${draco_src_root}/io/out_of_core_point_cloud_encoder_test.cc"
     "${draco_src_root}/io/ply_decoder_test.cc"
+    "${draco_src_root}/io/ply_encoder_test.cc"
     "${draco_src_root}/io/ply_reader_test.cc"
     "${draco_src_root}/io/stl_decoder_test.cc"
     "${draco_src_root}/io/stl_encoder_test.cc"
     "${draco_src_root}/io/point_cloud_io_test.cc"
     "${draco_src_root}/mesh/corner_table_test.cc"
+    "${draco_src_root}/mesh/indexed_mesh_builder_test.cc"
     "${draco_src_root}/mesh/mesh_are_equivalent_test.cc"
+    "${draco_src_root}/mesh/mesh_bvh_test.cc"
     "${draco_src_root}/mesh/mesh_cleanup_test.cc"
+    "${draco_src_root}/mesh/mesh_edge_collapse_simplifier_test.cc"
+    "${draco_src_root}/mesh/mesh_normal_generator_test.cc"
+    "${draco_src_root}/mesh/mesh_stripifier_test.cc"
+    "${draco_src_root}/mesh/mesh_vertex_cache_optimizer_test.cc"
+    "${draco_src_root}/mesh/mesh_vertex_clustering_test.cc"
+    "${draco_src_root}/mesh/meshlet_builder_test.cc"
+    "${draco_src_root}/mesh/packed_corner_table_test.cc"
     "${draco_src_root}/mesh/triangle_soup_mesh_builder_test.cc"
+    "${draco_src_root}/mesh/vertex_ring_cache_test.cc"
     "${draco_src_root}/metadata/metadata_encoder_test.cc"
     "${draco_src_root}/metadata/metadata_test.cc"
     "${draco_src_root}/point_cloud/point_cloud_builder_test.cc"
@@ -89,7 +141,9 @@ if(DRACO_TRANSCODER_SUPPORTED)
            "${draco_src_root}/io/texture_io_test.cc"
            "${draco_src_root}/material/material_library_test.cc"
            "${draco_src_root}/material/material_test.cc"
+           "${draco_src_root}/mesh/mesh_tangent_generator_test.cc"
            "${draco_src_root}/metadata/property_attribute_test.cc"
+           "${draco_src_root}/metadata/property_table_encoder_test.cc"
            "${draco_src_root}/metadata/property_table_test.cc"
            "${draco_src_root}/metadata/structural_metadata_test.cc"
            "${draco_src_root}/metadata/structural_metadata_schema_test.cc"
@@ -168,6 +222,16 @@ macro(draco_setup_test_targets)
       LIB_DEPS ${draco_dependency} draco_gtest draco_gtest_main
                draco_test_common)
 
+    if(DRACO_BENCHMARKS)
+      find_package(benchmark REQUIRED)
 
+      draco_add_executable(
+        TEST
+        NAME draco_benchmarks
+        SOURCES ${draco_benchmark_sources} ${draco_io_sources}
+        DEFINES ${draco_defines} ${draco_test_defines}
+        INCLUDES ${draco_test_include_paths}
+        LIB_DEPS ${draco_dependency} benchmark::benchmark draco_test_common)
+    endif()
   endif()
 endmacro()
@@ -0,0 +1,87 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the code size and the startup time of Draco decoder builds with
+// node.js. Usage:
+//
+//   node time_draco_startup.js [decoder_dir] [name...]
+//
+// |decoder_dir| defaults to the directory of this script. Each |name| is the
+// base name of a build, e.g. draco_decoder for the output of a DRACO_WASM
+// build, or a pair of base names js_name:wasm_name when the glue script is
+// named differently. |name| defaults to draco_wasm_wrapper:draco_decoder, the
+// published WebAssembly decoder in this directory.
+// For each build the raw, gzip and brotli sizes of the .js and .wasm files are
+// printed, followed by the median time to compile the WebAssembly module and
+// the median time until DracoDecoderModule() resolves.
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+
+const kNumRuns = 10;
+
+function median(values) {
+  const sorted = values.slice().sort(function(a, b) {
+    return a - b;
+  });
+  return sorted[Math.floor(sorted.length / 2)];
+}
+
+function formatSizes(bytes) {
+  const gzip = zlib.gzipSync(bytes, {level: 9}).length;
+  const brotli = zlib.brotliCompressSync(bytes).length;
+  return bytes.length + ' B raw, ' + gzip + ' B gzip, ' + brotli +
+      ' B brotli';
+}
+
+async function timeBuild(dir, name) {
+  const names = name.split(':');
+  const jsPath = path.resolve(dir, names[0] + '.js');
+  const wasmBinary =
+      fs.readFileSync(path.resolve(dir, names[names.length - 1] + '.wasm'));
+  console.log(name);
+  console.log('  js:   ' + formatSizes(fs.readFileSync(jsPath)));
+  console.log('  wasm: ' + formatSizes(wasmBinary));
+
+  const compileTimes = [];
+  const startupTimes = [];
+  for (let i = 0; i < kNumRuns; ++i) {
+    let start = process.hrtime.bigint();
+    await WebAssembly.compile(wasmBinary);
+    compileTimes.push(Number(process.hrtime.bigint() - start) / 1e6);
+
+    // Load the glue code again for every run so that the parsing of the
+    // javascript is measured as well.
+    delete require.cache[jsPath];
+    start = process.hrtime.bigint();
+    const DracoDecoderModule = require(jsPath);
+    await DracoDecoderModule({wasmBinary: wasmBinary});
+    startupTimes.push(Number(process.hrtime.bigint() - start) / 1e6);
+  }
+  console.log('  compile: ' + median(compileTimes).toFixed(2) + ' ms');
+  console.log('  startup: ' + median(startupTimes).toFixed(2) + ' ms');
+}
+
+async function main() {
+  const dir = process.argv[2] || __dirname;
+  const names = process.argv.length > 3 ? process.argv.slice(3) :
+                                          ['draco_wasm_wrapper:draco_decoder'];
+  for (const name of names) {
+    await timeBuild(dir, name);
+  }
+}
+
+main();
@@ -0,0 +1,94 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/animation/keyframe_animation_buffer_decoder.h"
+
+#include "draco/core/thread_pool.h"
+
+namespace draco {
+
+KeyframeAnimationBufferDecoder::KeyframeAnimationBufferDecoder() {}
+
+Status KeyframeAnimationBufferDecoder::Decode(DecoderBuffer *in_buffer) {
+  keyframe_offsets_.clear();
+  DRACO_RETURN_IF_ERROR(decoder_.Decode(in_buffer));
+  const PointCloud *const pc = decoder_.geometry();
+  if (pc->num_attributes() == 0 || decoder_.num_faces() > 0 ||
+      decoder_.GetOutputNumComponents(0) != 1) {
+    return Status(Status::DRACO_ERROR, "Invalid keyframe animation.");
+  }
+  // The first attribute holds the timestamps, animations use the remaining
+  // attribute ids.
+  keyframe_offsets_.resize(pc->num_attributes(), 0);
+  for (int att_id = 1; att_id < pc->num_attributes(); ++att_id) {
+    keyframe_offsets_[att_id] =
+        keyframe_offsets_[att_id - 1] +
+        static_cast<int64_t>(num_frames()) *
+            decoder_.GetOutputNumComponents(att_id);
+  }
+  return OkStatus();
+}
+
+int KeyframeAnimationBufferDecoder::num_components(int animation_id) const {
+  if (animation_id < 1 || animation_id > num_animations()) {
+    return 0;
+  }
+  return decoder_.GetOutputNumComponents(animation_id);
+}
+
+int64_t KeyframeAnimationBufferDecoder::keyframe_offset(
+    int animation_id) const {
+  if (animation_id < 1 || animation_id > num_animations()) {
+    return -1;
+  }
+  return keyframe_offsets_[animation_id - 1];
+}
+
+Status KeyframeAnimationBufferDecoder::WriteTimestamps(
+    float *out_timestamps) const {
+  if (keyframe_offsets_.empty()) {
+    return Status(Status::DRACO_ERROR, "No animation decoded.");
+  }
+  return decoder_.WriteAttribute(0, DT_FLOAT32, out_timestamps,
+                                 sizeof(float));
+}
+
+Status KeyframeAnimationBufferDecoder::WriteKeyframes(int animation_id,
+                                                      float *out_values) const {
+  const int num_animation_components = num_components(animation_id);
+  if (num_animation_components == 0) {
+    return Status(Status::DRACO_ERROR, "Invalid animation id.");
+  }
+  return decoder_.WriteAttribute(animation_id, DT_FLOAT32, out_values,
+                                 sizeof(float) * num_animation_components);
+}
+
+Status KeyframeAnimationBufferDecoder::WriteAllKeyframes(
+    float *out_values) const {
+  if (out_values == nullptr) {
+    return Status(Status::DRACO_ERROR, "Invalid output buffer.");
+  }
+  std::vector<Status> statuses(num_animations());
+  ParallelFor(decoder_.options()->thread_pool(), num_animations(),
+              [&](int i) {
+                statuses[i] =
+                    WriteKeyframes(i + 1, out_values + keyframe_offsets_[i]);
+              });
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status);
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
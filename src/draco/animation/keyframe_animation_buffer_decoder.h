@@ -0,0 +1,96 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_ANIMATION_KEYFRAME_ANIMATION_BUFFER_DECODER_H_
+#define DRACO_ANIMATION_KEYFRAME_ANIMATION_BUFFER_DECODER_H_
+
+#include <vector>
+
+#include "draco/compression/mesh_buffer_decoder.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/status.h"
+
+namespace draco {
+
+// Decoder of keyframe animations encoded by KeyframeAnimationEncoder that
+// writes the timestamps and keyframe values directly into caller-owned float
+// arrays instead of creating a KeyframeAnimation.
+//
+// The keyframes of all animations can be written into a single flat array in
+// a structure-of-arrays layout: the values of animation i (1 to
+// num_animations()) start at keyframe_offset(i) and they are stored frame by
+// frame with num_components(i) floats per frame. Like MeshBufferDecoder, the
+// dequantization is applied when the values are written so the full
+// precision storage of each animation is never allocated.
+//
+// Example:
+//
+//   KeyframeAnimationBufferDecoder decoder;
+//   DRACO_RETURN_IF_ERROR(decoder.Decode(&buffer));
+//   std::vector<float> times(decoder.num_frames());
+//   DRACO_RETURN_IF_ERROR(decoder.WriteTimestamps(times.data()));
+//   std::vector<float> values(decoder.num_keyframe_values());
+//   DRACO_RETURN_IF_ERROR(decoder.WriteAllKeyframes(values.data()));
+//
+class KeyframeAnimationBufferDecoder {
+ public:
+  KeyframeAnimationBufferDecoder();
+
+  // Decodes an animation from |in_buffer|. Any previously decoded animation is
+  // released.
+  Status Decode(DecoderBuffer *in_buffer);
+
+  int num_frames() const { return decoder_.num_points(); }
+  int num_animations() const {
+    return static_cast<int>(keyframe_offsets_.size()) - 1;
+  }
+
+  // Returns the number of components of keyframes of |animation_id| or 0 when
+  // the id is not valid.
+  int num_components(int animation_id) const;
+
+  // Returns the offset of the first value of |animation_id| in the output of
+  // WriteAllKeyframes() or -1 when the id is not valid.
+  int64_t keyframe_offset(int animation_id) const;
+
+  // Returns the number of floats written by WriteAllKeyframes().
+  int64_t num_keyframe_values() const {
+    return keyframe_offsets_.empty() ? 0 : keyframe_offsets_.back();
+  }
+
+  // Writes num_frames() timestamps into |out_timestamps|.
+  Status WriteTimestamps(float *out_timestamps) const;
+
+  // Writes num_frames() * num_components(|animation_id|) keyframe values of a
+  // single animation into |out_values|.
+  Status WriteKeyframes(int animation_id, float *out_values) const;
+
+  // Writes keyframe values of all animations into |out_values| that must have
+  // room for num_keyframe_values() floats. When a thread pool is set in
+  // options(), the animations are written in parallel.
+  Status WriteAllKeyframes(float *out_values) const;
+
+  DecoderOptions *options() { return decoder_.options(); }
+
+ private:
+  MeshBufferDecoder decoder_;
+  // Offsets of the values of each animation in the output of
+  // WriteAllKeyframes() indexed by animation id - 1, with the total number of
+  // values as the last element.
+  std::vector<int64_t> keyframe_offsets_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_ANIMATION_KEYFRAME_ANIMATION_BUFFER_DECODER_H_
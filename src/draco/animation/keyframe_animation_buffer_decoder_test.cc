@@ -0,0 +1,133 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/animation/keyframe_animation_buffer_decoder.h"
+
+#include <memory>
+#include <vector>
+
+#include "draco/animation/keyframe_animation.h"
+#include "draco/animation/keyframe_animation_decoder.h"
+#include "draco/animation/keyframe_animation_encoder.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+
+namespace {
+
+class KeyframeAnimationBufferDecoderTest : public ::testing::Test {
+ protected:
+  // Creates an animation with |num_frames| frames and animations with
+  // |num_components| components each and encodes it with |options|.
+  void EncodeAnimation(int num_frames, const std::vector<int> &num_components,
+                       const draco::EncoderOptions &options) {
+    std::vector<draco::KeyframeAnimation::TimestampType> timestamps(
+        num_frames);
+    for (int i = 0; i < num_frames; ++i) {
+      timestamps[i] = 0.5f * i;
+    }
+    ASSERT_TRUE(animation_.SetTimestamps(timestamps));
+    for (int a = 0; a < num_components.size(); ++a) {
+      std::vector<float> values(num_frames * num_components[a]);
+      for (int i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(a * 1000 + i) / 3.f;
+      }
+      ASSERT_EQ(animation_.AddKeyframes(draco::DT_FLOAT32, num_components[a],
+                                        values),
+                a + 1);
+    }
+    draco::KeyframeAnimationEncoder encoder;
+    DRACO_ASSERT_OK(
+        encoder.EncodeKeyframeAnimation(animation_, options, &buffer_));
+  }
+
+  // Verifies that all values written by |decoder| match the values of the
+  // animation decoded by KeyframeAnimationDecoder.
+  void VerifyDecodedValues(
+      const draco::KeyframeAnimationBufferDecoder &decoder) {
+    draco::DecoderBuffer in_buffer;
+    in_buffer.Init(buffer_.data(), buffer_.size());
+    draco::KeyframeAnimation animation;
+    draco::KeyframeAnimationDecoder animation_decoder;
+    draco::DecoderOptions options;
+    DRACO_ASSERT_OK(animation_decoder.Decode(options, &in_buffer, &animation));
+    ASSERT_EQ(decoder.num_frames(), animation.num_frames());
+    ASSERT_EQ(decoder.num_animations(), animation.num_animations());
+
+    std::vector<float> timestamps(decoder.num_frames());
+    DRACO_ASSERT_OK(decoder.WriteTimestamps(timestamps.data()));
+    for (int i = 0; i < decoder.num_frames(); ++i) {
+      float value;
+      animation.timestamps()->GetValue(draco::AttributeValueIndex(i), &value);
+      ASSERT_EQ(timestamps[i], value);
+    }
+
+    std::vector<float> values(decoder.num_keyframe_values());
+    DRACO_ASSERT_OK(decoder.WriteAllKeyframes(values.data()));
+    for (int a = 1; a <= decoder.num_animations(); ++a) {
+      const draco::PointAttribute *const att = animation.keyframes(a);
+      const int num_components = decoder.num_components(a);
+      ASSERT_EQ(num_components, att->num_components());
+      std::vector<float> animation_values(decoder.num_frames() *
+                                          num_components);
+      DRACO_ASSERT_OK(decoder.WriteKeyframes(a, animation_values.data()));
+      const float *const flat_values = &values[decoder.keyframe_offset(a)];
+      std::vector<float> value(num_components);
+      for (int i = 0; i < decoder.num_frames(); ++i) {
+        att->GetValue(draco::AttributeValueIndex(i), value.data());
+        for (int c = 0; c < num_components; ++c) {
+          ASSERT_EQ(flat_values[i * num_components + c], value[c]);
+          ASSERT_EQ(animation_values[i * num_components + c], value[c]);
+        }
+      }
+    }
+  }
+
+  draco::KeyframeAnimation animation_;
+  draco::EncoderBuffer buffer_;
+};
+
+TEST_F(KeyframeAnimationBufferDecoderTest, WritesFlatArrays) {
+  EncodeAnimation(20, {3, 4, 1}, draco::EncoderOptions::CreateDefaultOptions());
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer_.data(), buffer_.size());
+  draco::KeyframeAnimationBufferDecoder decoder;
+  DRACO_ASSERT_OK(decoder.Decode(&in_buffer));
+  ASSERT_EQ(decoder.num_animations(), 3);
+  ASSERT_EQ(decoder.keyframe_offset(1), 0);
+  ASSERT_EQ(decoder.keyframe_offset(2), 60);
+  ASSERT_EQ(decoder.keyframe_offset(3), 140);
+  ASSERT_EQ(decoder.num_keyframe_values(), 160);
+  ASSERT_EQ(decoder.keyframe_offset(4), -1);
+  ASSERT_EQ(decoder.num_components(0), 0);
+  VerifyDecodedValues(decoder);
+}
+
+TEST_F(KeyframeAnimationBufferDecoderTest, WritesDequantizedValues) {
+  draco::EncoderOptions options = draco::EncoderOptions::CreateDefaultOptions();
+  for (int i = 0; i <= 8; ++i) {
+    options.SetAttributeInt(i, "quantization_bits", 16);
+  }
+  EncodeAnimation(50, std::vector<int>(8, 4), options);
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer_.data(), buffer_.size());
+  draco::KeyframeAnimationBufferDecoder decoder;
+  draco::ThreadPool pool(4);
+  decoder.options()->SetThreadPool(&pool);
+  DRACO_ASSERT_OK(decoder.Decode(&in_buffer));
+  ASSERT_EQ(decoder.num_animations(), 8);
+  VerifyDecodedValues(decoder);
+}
+
+}  // namespace
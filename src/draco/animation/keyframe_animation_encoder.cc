@@ -14,15 +14,159 @@
 //
 #include "draco/animation/keyframe_animation_encoder.h"
 
+#include <cmath>
+#include <utility>
+#include <vector>
+
 namespace draco {
 
+namespace {
+
+// Returns true when all frames between |first_frame| and |last_frame| can be
+// linearly interpolated from the values of these two frames with an error of
+// at most |tolerance|. |channels| holds the values of all attributes stored
+// frame by frame, the first channel being the timestamps.
+bool CanInterpolateFrames(const std::vector<std::vector<float>> &channels,
+                          int first_frame, int last_frame, float tolerance) {
+  const std::vector<float> &times = channels[0];
+  const float duration = times[last_frame] - times[first_frame];
+  for (int frame = first_frame + 1; frame < last_frame; ++frame) {
+    const float t =
+        duration > 0.f ? (times[frame] - times[first_frame]) / duration : 0.f;
+    for (int c = 1; c < static_cast<int>(channels.size()); ++c) {
+      const std::vector<float> &values = channels[c];
+      const int num_components = values.size() / times.size();
+      const float *const first = &values[first_frame * num_components];
+      const float *const last = &values[last_frame * num_components];
+      const float *const value = &values[frame * num_components];
+      for (int i = 0; i < num_components; ++i) {
+        const float interpolated = first[i] + t * (last[i] - first[i]);
+        if (std::abs(interpolated - value[i]) > tolerance) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 KeyframeAnimationEncoder::KeyframeAnimationEncoder() {}
 
 Status KeyframeAnimationEncoder::EncodeKeyframeAnimation(
     const KeyframeAnimation &animation, const EncoderOptions &options,
     EncoderBuffer *out_buffer) {
-  SetPointCloud(animation);
+  bool has_quaternions = false;
+  for (int i = 0; i < animation.num_attributes(); ++i) {
+    if (options.GetAttributeBool(i, "quaternion", false)) {
+      has_quaternions = true;
+    }
+  }
+  if (!has_quaternions &&
+      options.GetGlobalFloat("keyframe_reduction_tolerance", 0.f) <= 0.f) {
+    SetPointCloud(animation);
+    return Encode(options, out_buffer);
+  }
+  DRACO_RETURN_IF_ERROR(ProcessAnimation(animation, options));
+  SetPointCloud(*processed_animation_);
   return Encode(options, out_buffer);
 }
 
+Status KeyframeAnimationEncoder::ProcessAnimation(
+    const KeyframeAnimation &animation, const EncoderOptions &options) {
+  const int num_frames = animation.num_frames();
+  const PointAttribute *const timestamps = animation.timestamps();
+  if (timestamps == nullptr ||
+      static_cast<int>(timestamps->size()) != num_frames) {
+    return Status(Status::DRACO_ERROR, "Animation has no timestamps.");
+  }
+
+  // Read values of all channels as floats.
+  std::vector<std::vector<float>> channels(animation.num_attributes());
+  for (int att_id = 0; att_id < animation.num_attributes(); ++att_id) {
+    const PointAttribute &att = *animation.attribute(att_id);
+    const int num_components = att.num_components();
+    const bool is_quaternion =
+        options.GetAttributeBool(att_id, "quaternion", false);
+    if (is_quaternion && (att_id == 0 || num_components != 4 ||
+                          att.data_type() != DT_FLOAT32)) {
+      return Status(Status::DRACO_ERROR,
+                    "Quaternion keyframes must have four float components.");
+    }
+    std::vector<float> &values = channels[att_id];
+    values.resize(num_frames * num_components);
+    for (PointIndex i(0); i < num_frames; ++i) {
+      float *const value = &values[i.value() * num_components];
+      if (!att.ConvertValue<float>(att.mapped_index(i), num_components,
+                                   value)) {
+        return Status(Status::DRACO_ERROR, "Failed to read keyframe value.");
+      }
+      if (!is_quaternion) {
+        continue;
+      }
+      // Normalize the quaternion and keep it in the hemisphere of the
+      // quaternion of the previous frame. Both q and -q represent the same
+      // rotation.
+      float norm = 0.f;
+      float dot = 0.f;
+      for (int c = 0; c < 4; ++c) {
+        norm += value[c] * value[c];
+        if (i > 0) {
+          dot += value[c] * value[c - 4];
+        }
+      }
+      if (norm == 0.f) {
+        return Status(Status::DRACO_ERROR, "Invalid quaternion keyframe.");
+      }
+      const float scale = (dot < 0.f ? -1.f : 1.f) / std::sqrt(norm);
+      for (int c = 0; c < 4; ++c) {
+        value[c] *= scale;
+      }
+    }
+  }
+
+  // Select frames that cannot be interpolated from their neighbors.
+  std::vector<PointIndex> kept_frames;
+  const float tolerance =
+      options.GetGlobalFloat("keyframe_reduction_tolerance", 0.f);
+  if (tolerance > 0.f && num_frames > 2) {
+    kept_frames.push_back(PointIndex(0));
+    int first_frame = 0;
+    for (int last_frame = 2; last_frame < num_frames; ++last_frame) {
+      if (!CanInterpolateFrames(channels, first_frame, last_frame,
+                                tolerance)) {
+        first_frame = last_frame - 1;
+        kept_frames.push_back(PointIndex(first_frame));
+      }
+    }
+    kept_frames.push_back(PointIndex(num_frames - 1));
+  } else {
+    for (PointIndex i(0); i < num_frames; ++i) {
+      kept_frames.push_back(i);
+    }
+  }
+
+  processed_animation_.reset(new KeyframeAnimation());
+  processed_animation_->set_num_frames(kept_frames.size());
+  for (int att_id = 0; att_id < animation.num_attributes(); ++att_id) {
+    const PointAttribute &att = *animation.attribute(att_id);
+    const bool is_quaternion =
+        options.GetAttributeBool(att_id, "quaternion", false);
+    std::unique_ptr<PointAttribute> new_att(new PointAttribute());
+    new_att->Init(att.attribute_type(), att.num_components(), att.data_type(),
+                  att.normalized(), kept_frames.size());
+    for (AttributeValueIndex i(0); i < kept_frames.size(); ++i) {
+      const PointIndex frame = kept_frames[i.value()];
+      if (is_quaternion) {
+        new_att->SetAttributeValue(i, &channels[att_id][frame.value() * 4]);
+      } else {
+        new_att->SetAttributeValue(i, att.GetAddress(att.mapped_index(frame)));
+      }
+    }
+    processed_animation_->SetAttribute(att_id, std::move(new_att));
+  }
+  return OkStatus();
+}
+
 }  // namespace draco
@@ -15,6 +15,8 @@
 #ifndef DRACO_ANIMATION_KEYFRAME_ANIMATION_ENCODER_H_
 #define DRACO_ANIMATION_KEYFRAME_ANIMATION_ENCODER_H_
 
+#include <memory>
+
 #include "draco/animation/keyframe_animation.h"
 #include "draco/compression/point_cloud/point_cloud_sequential_encoder.h"
 
@@ -24,6 +26,20 @@ namespace draco {
 // PointCloud and compress it. It's mostly a wrapper around PointCloudEncoder so
 // that the animation module could be separated from geometry compression when
 // exposed to developers.
+//
+// Keyframes are encoded in frame order, so quantized channels are predicted
+// from the previous frame. Channels are encoded in parallel when a thread pool
+// is set on the |options|. The following options can be used to exploit the
+// temporal smoothness of the animation before it is encoded:
+//
+//   "keyframe_reduction_tolerance" (global float): when positive, frames that
+//       can be linearly interpolated from the surrounding kept frames with an
+//       error of at most the tolerance in every channel component are removed.
+//       The first and the last frames are always kept.
+//   "quaternion" (attribute bool): marks a four component float channel as a
+//       rotation quaternion. Quaternions are normalized and their signs are
+//       flipped to stay in the hemisphere of the previous frame, which keeps
+//       the values in [-1, 1] and the deltas between frames small.
 class KeyframeAnimationEncoder : private PointCloudSequentialEncoder {
  public:
   KeyframeAnimationEncoder();
@@ -32,6 +48,15 @@ class KeyframeAnimationEncoder : private PointCloudSequentialEncoder {
   Status EncodeKeyframeAnimation(const KeyframeAnimation &animation,
                                  const EncoderOptions &options,
                                  EncoderBuffer *out_buffer);
+
+ private:
+  // Creates |processed_animation_| from |animation| by applying the keyframe
+  // reduction and the quaternion options.
+  Status ProcessAnimation(const KeyframeAnimation &animation,
+                          const EncoderOptions &options);
+
+  // Animation used for encoding when any of the options modified the input.
+  std::unique_ptr<KeyframeAnimation> processed_animation_;
 };
 
 }  // namespace draco
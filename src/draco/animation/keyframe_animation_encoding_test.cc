@@ -12,6 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
 #include "draco/animation/keyframe_animation.h"
 #include "draco/animation/keyframe_animation_decoder.h"
 #include "draco/animation/keyframe_animation_encoder.h"
@@ -131,6 +137,28 @@ class KeyframeAnimationEncodingTest : public ::testing::Test {
                                            *decoded_animation, quantized);
   }
 
+  // Encodes and decodes |keyframe_animation_| using |options|.
+  std::unique_ptr<KeyframeAnimation> EncodeAndDecode(
+      const EncoderOptions &options) {
+    draco::EncoderBuffer buffer;
+    draco::KeyframeAnimationEncoder encoder;
+    if (!encoder.EncodeKeyframeAnimation(keyframe_animation_, options, &buffer)
+             .ok()) {
+      return nullptr;
+    }
+    draco::KeyframeAnimationDecoder decoder;
+    DecoderBuffer dec_buffer;
+    dec_buffer.Init(buffer.data(), buffer.size());
+    std::unique_ptr<KeyframeAnimation> decoded_animation(
+        new KeyframeAnimation());
+    DecoderOptions dec_options;
+    if (!decoder.Decode(dec_options, &dec_buffer, decoded_animation.get())
+             .ok()) {
+      return nullptr;
+    }
+    return decoded_animation;
+  }
+
   draco::KeyframeAnimation keyframe_animation_;
   std::vector<draco::KeyframeAnimation::TimestampType> timestamps_;
   std::vector<float> animation_data_;
@@ -166,4 +194,79 @@ TEST_F(KeyframeAnimationEncodingTest, MultipleAnimations) {
   TestKeyframeAnimationEncoding<3>();
 }
 
+TEST_F(KeyframeAnimationEncodingTest, KeyframeReduction) {
+  // Keyframes are linear up to frame 50 and constant afterwards so only the
+  // first, the middle and the last frames are needed.
+  const int num_frames = 100;
+  ASSERT_TRUE(CreateAndAddTimestamps(num_frames));
+  std::vector<float> data(num_frames * 2);
+  for (int i = 0; i < num_frames; ++i) {
+    data[2 * i] = std::min(i, 50) * 0.5f;
+    data[2 * i + 1] = -std::min(i, 50) * 2.f;
+  }
+  ASSERT_EQ(keyframe_animation_.AddKeyframes(draco::DT_FLOAT32, 2, data), 1);
+
+  EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+  options.SetGlobalFloat("keyframe_reduction_tolerance", 0.001f);
+  const std::unique_ptr<KeyframeAnimation> decoded_animation =
+      EncodeAndDecode(options);
+  ASSERT_NE(decoded_animation, nullptr);
+  ASSERT_EQ(decoded_animation->num_frames(), 3);
+  const float expected_timestamps[3] = {0.f, 50.f, 99.f};
+  const float expected_values[3] = {0.f, 25.f, 25.f};
+  for (int i = 0; i < 3; ++i) {
+    std::array<float, 1> timestamp;
+    std::array<float, 2> value;
+    ASSERT_TRUE((decoded_animation->timestamps()->GetValue<float, 1>(
+        draco::AttributeValueIndex(i), &timestamp)));
+    ASSERT_TRUE((decoded_animation->keyframes(1)->GetValue<float, 2>(
+        draco::AttributeValueIndex(i), &value)));
+    ASSERT_FLOAT_EQ(timestamp[0], expected_timestamps[i]);
+    ASSERT_FLOAT_EQ(value[0], expected_values[i]);
+    ASSERT_FLOAT_EQ(value[1], -4.f * expected_values[i]);
+  }
+
+  // Without the reduction all frames are encoded.
+  const std::unique_ptr<KeyframeAnimation> full_animation =
+      EncodeAndDecode(EncoderOptions::CreateDefaultOptions());
+  ASSERT_NE(full_animation, nullptr);
+  ASSERT_EQ(full_animation->num_frames(), num_frames);
+}
+
+TEST_F(KeyframeAnimationEncodingTest, QuaternionKeyframes) {
+  // Rotation around the z axis with the quaternion sign flipped on every
+  // other frame and a non-unit length.
+  const int num_frames = 10;
+  ASSERT_TRUE(CreateAndAddTimestamps(num_frames));
+  std::vector<float> data(num_frames * 4);
+  for (int i = 0; i < num_frames; ++i) {
+    const float sign = i % 2 ? -2.f : 2.f;
+    data[4 * i + 2] = sign * std::sin(0.05f * i);
+    data[4 * i + 3] = sign * std::cos(0.05f * i);
+  }
+  ASSERT_EQ(keyframe_animation_.AddKeyframes(draco::DT_FLOAT32, 4, data), 1);
+
+  EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+  options.SetAttributeBool(1, "quaternion", true);
+  options.SetAttributeInt(1, "quantization_bits", 16);
+  const std::unique_ptr<KeyframeAnimation> decoded_animation =
+      EncodeAndDecode(options);
+  ASSERT_NE(decoded_animation, nullptr);
+  ASSERT_EQ(decoded_animation->num_frames(), num_frames);
+  for (int i = 0; i < num_frames; ++i) {
+    std::array<float, 4> value;
+    ASSERT_TRUE((decoded_animation->keyframes(1)->GetValue<float, 4>(
+        draco::AttributeValueIndex(i), &value)));
+    ASSERT_NEAR(value[2], std::sin(0.05f * i), 1e-3);
+    ASSERT_NEAR(value[3], std::cos(0.05f * i), 1e-3);
+  }
+
+  // Quaternion keyframes must have four components.
+  std::vector<float> vectors(num_frames * 3, 0.f);
+  ASSERT_EQ(keyframe_animation_.AddKeyframes(draco::DT_FLOAT32, 3, vectors),
+            2);
+  options.SetAttributeBool(2, "quaternion", true);
+  ASSERT_EQ(EncodeAndDecode(options), nullptr);
+}
+
 }  // namespace draco
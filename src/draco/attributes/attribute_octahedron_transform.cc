@@ -15,11 +15,19 @@
 
 #include "draco/attributes/attribute_octahedron_transform.h"
 
+#include <algorithm>
+
 #include "draco/attributes/attribute_transform_type.h"
 #include "draco/compression/attributes/normal_compression_utils.h"
 
 namespace draco {
 
+namespace {
+// Number of vectors converted by a single task of a parallel inverse
+// transform.
+constexpr int64_t kInverseTransformChunkSize = 1 << 15;
+}  // namespace
+
 bool AttributeOctahedronTransform::InitFromAttribute(
     const PointAttribute &attribute) {
   const AttributeTransformData *const transform_data =
@@ -47,34 +55,42 @@ bool AttributeOctahedronTransform::TransformAttribute(
 
 bool AttributeOctahedronTransform::InverseTransformAttribute(
     const PointAttribute &attribute, PointAttribute *target_attribute) {
+  return InverseTransformAttribute(attribute, target_attribute, nullptr);
+}
+
+bool AttributeOctahedronTransform::InverseTransformAttribute(
+    const PointAttribute &attribute, PointAttribute *target_attribute,
+    ThreadPool *pool) {
   if (target_attribute->data_type() != DT_FLOAT32) {
     return false;
   }
 
-  const int num_points = target_attribute->size();
+  const int64_t num_points = target_attribute->size();
   const int num_components = target_attribute->num_components();
   if (num_components != 3) {
     return false;
   }
-  constexpr int kEntrySize = sizeof(float) * 3;
-  float att_val[3];
   const int32_t *source_attribute_data = reinterpret_cast<const int32_t *>(
       attribute.GetAddress(AttributeValueIndex(0)));
-  uint8_t *target_address =
-      target_attribute->GetAddress(AttributeValueIndex(0));
+  float *target_attribute_data = reinterpret_cast<float *>(
+      target_attribute->GetAddress(AttributeValueIndex(0)));
   OctahedronToolBox octahedron_tool_box;
   if (!octahedron_tool_box.SetQuantizationBits(quantization_bits_)) {
     return false;
   }
-  for (uint32_t i = 0; i < num_points; ++i) {
-    const int32_t s = *source_attribute_data++;
-    const int32_t t = *source_attribute_data++;
-    octahedron_tool_box.QuantizedOctahedralCoordsToUnitVector(s, t, att_val);
-
-    // Store the decoded floating point values into the attribute buffer.
-    std::memcpy(target_address, att_val, kEntrySize);
-    target_address += kEntrySize;
-  }
+  const int num_chunks = static_cast<int>(
+      (num_points + kInverseTransformChunkSize - 1) /
+      kInverseTransformChunkSize);
+  // Each chunk writes a disjoint range of the output so the result does not
+  // depend on the number of threads.
+  ParallelFor(pool, num_chunks, [&](int k) {
+    const int64_t begin = k * kInverseTransformChunkSize;
+    const int64_t end =
+        std::min(num_points, begin + kInverseTransformChunkSize);
+    octahedron_tool_box.QuantizedOctahedralCoordsToUnitVectors(
+        source_attribute_data + 2 * begin, end - begin,
+        target_attribute_data + 3 * begin);
+  });
   return true;
 }
 
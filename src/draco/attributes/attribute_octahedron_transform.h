@@ -19,6 +19,7 @@
 #include "draco/attributes/attribute_transform.h"
 #include "draco/attributes/point_attribute.h"
 #include "draco/core/encoder_buffer.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -44,6 +45,12 @@ class AttributeOctahedronTransform : public AttributeTransform {
   bool InverseTransformAttribute(const PointAttribute &attribute,
                                  PointAttribute *target_attribute) override;
 
+  // Same as above but the values are converted in independent chunks that are
+  // processed in parallel on |pool| (can be nullptr).
+  bool InverseTransformAttribute(const PointAttribute &attribute,
+                                 PointAttribute *target_attribute,
+                                 ThreadPool *pool);
+
   // Set number of quantization bits.
   void SetParameters(int quantization_bits);
 
@@ -14,16 +14,62 @@
 //
 #include "draco/attributes/attribute_quantization_transform.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <memory>
 #include <vector>
 
 #include "draco/attributes/attribute_transform_type.h"
+#include "draco/core/bit_utils.h"
 #include "draco/core/quantization_utils.h"
 
 namespace draco {
 
+namespace {
+// Number of values dequantized by a single task of a parallel inverse
+// transform.
+constexpr int64_t kDequantizationChunkSize = 1 << 15;
+
+// Computes the minimum and maximum values of each component over all
+// |attributes|. Returns false when the attributes have different numbers of
+// components or when any of the values is not finite.
+bool ComputeValueRange(const std::vector<const PointAttribute *> &attributes,
+                       ThreadPool *pool, std::vector<float> *min_values,
+                       std::vector<float> *max_values) {
+  if (attributes.empty()) {
+    return false;
+  }
+  std::vector<float> att_min_values;
+  std::vector<float> att_max_values;
+  for (size_t i = 0; i < attributes.size(); ++i) {
+    const PointAttribute &attribute = *attributes[i];
+    if (attribute.num_components() != attributes[0]->num_components()) {
+      return false;
+    }
+    if (!attribute.ComputeValueRange(pool, &att_min_values, &att_max_values)) {
+      return false;
+    }
+    if (i == 0) {
+      *min_values = att_min_values;
+      *max_values = att_max_values;
+      continue;
+    }
+    for (int c = 0; c < attribute.num_components(); ++c) {
+      (*min_values)[c] = std::min((*min_values)[c], att_min_values[c]);
+      (*max_values)[c] = std::max((*max_values)[c], att_max_values[c]);
+    }
+  }
+  for (size_t c = 0; c < min_values->size(); ++c) {
+    if (std::isnan((*min_values)[c]) || std::isinf((*min_values)[c]) ||
+        std::isnan((*max_values)[c]) || std::isinf((*max_values)[c])) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
 bool AttributeQuantizationTransform::InitFromAttribute(
     const PointAttribute &attribute) {
   const AttributeTransformData *const transform_data =
@@ -70,6 +116,12 @@ bool AttributeQuantizationTransform::TransformAttribute(
 
 bool AttributeQuantizationTransform::InverseTransformAttribute(
     const PointAttribute &attribute, PointAttribute *target_attribute) {
+  return InverseTransformAttribute(attribute, target_attribute, nullptr);
+}
+
+bool AttributeQuantizationTransform::InverseTransformAttribute(
+    const PointAttribute &attribute, PointAttribute *target_attribute,
+    ThreadPool *pool) {
   if (target_attribute->data_type() != DT_FLOAT32) {
     return false;
   }
@@ -77,11 +129,6 @@ bool AttributeQuantizationTransform::InverseTransformAttribute(
   // Convert all quantized values back to floats.
   const int32_t max_quantized_value =
       (1u << static_cast<uint32_t>(quantization_bits_)) - 1;
-  const int num_components = target_attribute->num_components();
-  const int entry_size = sizeof(float) * num_components;
-  const std::unique_ptr<float[]> att_val(new float[num_components]);
-  int quant_val_id = 0;
-  int out_byte_pos = 0;
   Dequantizer dequantizer;
   if (!dequantizer.Init(range_, max_quantized_value)) {
     return false;
@@ -89,23 +136,81 @@ bool AttributeQuantizationTransform::InverseTransformAttribute(
   const int32_t *const source_attribute_data =
       reinterpret_cast<const int32_t *>(
           attribute.GetAddress(AttributeValueIndex(0)));
+  float *const target_attribute_data = reinterpret_cast<float *>(
+      target_attribute->GetAddress(AttributeValueIndex(0)));
+  const int64_t num_values = target_attribute->size();
+  const int num_components = target_attribute->num_components();
+  const int num_chunks = static_cast<int>(
+      (num_values + kDequantizationChunkSize - 1) / kDequantizationChunkSize);
+  // Each chunk writes a disjoint range of the output so the result does not
+  // depend on the number of threads.
+  ParallelFor(pool, num_chunks, [&](int k) {
+    const int64_t begin = k * kDequantizationChunkSize;
+    const int64_t end = std::min(num_values, begin + kDequantizationChunkSize);
+    const int64_t offset = begin * num_components;
+    dequantizer.DequantizeValues(source_attribute_data + offset, end - begin,
+                                 num_components, min_values_.data(),
+                                 target_attribute_data + offset);
+  });
+  return true;
+}
 
-  const int num_values = target_attribute->size();
-
-  for (uint32_t i = 0; i < num_values; ++i) {
-    for (int c = 0; c < num_components; ++c) {
-      float value =
-          dequantizer.DequantizeFloat(source_attribute_data[quant_val_id++]);
-      value = value + min_values_[c];
-      att_val[c] = value;
+bool AttributeQuantizationTransform::TransformToCompactAttribute(
+    const PointAttribute &attribute, PointAttribute *target_attribute) const {
+  if (!is_initialized() || quantization_bits_ > 16) {
+    return false;
+  }
+  const DataType data_type = quantization_bits_ <= 8 ? DT_UINT8 : DT_UINT16;
+  const int num_components = attribute.num_components();
+  GeometryAttribute va;
+  va.Init(target_attribute->attribute_type(), nullptr, num_components,
+          data_type, false, num_components * DataTypeLength(data_type), 0);
+  PointAttribute compact_attribute(va);
+  compact_attribute.set_unique_id(target_attribute->unique_id());
+  if (!compact_attribute.Reset(attribute.size())) {
+    return false;
+  }
+  // Quantized values are stored as 32-bit integers in |attribute|.
+  const uint32_t *const src = reinterpret_cast<const uint32_t *>(
+      attribute.GetAddress(AttributeValueIndex(0)));
+  const int64_t num_entries =
+      static_cast<int64_t>(attribute.size()) * num_components;
+  if (data_type == DT_UINT8) {
+    uint8_t *const dst = reinterpret_cast<uint8_t *>(
+        compact_attribute.GetAddress(AttributeValueIndex(0)));
+    for (int64_t i = 0; i < num_entries; ++i) {
+      dst[i] = static_cast<uint8_t>(src[i]);
+    }
+  } else {
+    uint16_t *const dst = reinterpret_cast<uint16_t *>(
+        compact_attribute.GetAddress(AttributeValueIndex(0)));
+    for (int64_t i = 0; i < num_entries; ++i) {
+      dst[i] = static_cast<uint16_t>(src[i]);
+    }
+  }
+  if (attribute.is_mapping_identity()) {
+    compact_attribute.SetIdentityMapping();
+  } else {
+    const int num_points = static_cast<int>(attribute.indices_map_size());
+    compact_attribute.SetExplicitMapping(num_points);
+    for (PointIndex i(0); i < num_points; ++i) {
+      compact_attribute.SetPointMapEntry(i, attribute.mapped_index(i));
     }
-    // Store the floating point value into the attribute buffer.
-    target_attribute->buffer()->Write(out_byte_pos, att_val.get(), entry_size);
-    out_byte_pos += entry_size;
   }
+  if (!TransferToAttribute(&compact_attribute)) {
+    return false;
+  }
+  target_attribute->CopyFrom(compact_attribute);
   return true;
 }
 
+float AttributeQuantizationTransform::ComputeDequantizationScale() const {
+  // Same as the step of the Dequantizer used by InverseTransformAttribute().
+  const int32_t max_quantized_value =
+      (1u << static_cast<uint32_t>(quantization_bits_)) - 1;
+  return range_ / static_cast<float>(max_quantized_value);
+}
+
 bool AttributeQuantizationTransform::IsQuantizationValid(
     int quantization_bits) {
   // Currently we allow only up to 30 bit quantization.
@@ -127,6 +232,19 @@ bool AttributeQuantizationTransform::SetParameters(int quantization_bits,
 
 bool AttributeQuantizationTransform::ComputeParameters(
     const PointAttribute &attribute, const int quantization_bits) {
+  return ComputeParameters(attribute, quantization_bits, nullptr);
+}
+
+bool AttributeQuantizationTransform::ComputeParameters(
+    const PointAttribute &attribute, const int quantization_bits,
+    ThreadPool *pool) {
+  return ComputeParameters(std::vector<const PointAttribute *>{&attribute},
+                           quantization_bits, pool);
+}
+
+bool AttributeQuantizationTransform::ComputeParameters(
+    const std::vector<const PointAttribute *> &attributes,
+    const int quantization_bits, ThreadPool *pool) {
   if (quantization_bits_ != -1) {
     return false;  // already initialized.
   }
@@ -135,36 +253,13 @@ bool AttributeQuantizationTransform::ComputeParameters(
   }
   quantization_bits_ = quantization_bits;
 
-  const int num_components = attribute.num_components();
   range_ = 0.f;
-  min_values_ = std::vector<float>(num_components, 0.f);
-  const std::unique_ptr<float[]> max_values(new float[num_components]);
-  const std::unique_ptr<float[]> att_val(new float[num_components]);
   // Compute minimum values and max value difference.
-  attribute.GetValue(AttributeValueIndex(0), att_val.get());
-  attribute.GetValue(AttributeValueIndex(0), min_values_.data());
-  attribute.GetValue(AttributeValueIndex(0), max_values.get());
-
-  for (AttributeValueIndex i(1); i < static_cast<uint32_t>(attribute.size());
-       ++i) {
-    attribute.GetValue(i, att_val.get());
-    for (int c = 0; c < num_components; ++c) {
-      if (std::isnan(att_val[c])) {
-        return false;
-      }
-      if (min_values_[c] > att_val[c]) {
-        min_values_[c] = att_val[c];
-      }
-      if (max_values[c] < att_val[c]) {
-        max_values[c] = att_val[c];
-      }
-    }
+  std::vector<float> max_values;
+  if (!ComputeValueRange(attributes, pool, &min_values_, &max_values)) {
+    return false;
   }
-  for (int c = 0; c < num_components; ++c) {
-    if (std::isnan(min_values_[c]) || std::isinf(min_values_[c]) ||
-        std::isnan(max_values[c]) || std::isinf(max_values[c])) {
-      return false;
-    }
+  for (size_t c = 0; c < min_values_.size(); ++c) {
     const float dif = max_values[c] - min_values_[c];
     if (dif > range_) {
       range_ = dif;
@@ -180,6 +275,52 @@ bool AttributeQuantizationTransform::ComputeParameters(
   return true;
 }
 
+bool AttributeQuantizationTransform::ComputeGridParameters(
+    const std::vector<const PointAttribute *> &attributes, float spacing,
+    ThreadPool *pool) {
+  if (quantization_bits_ != -1) {
+    return false;  // already initialized.
+  }
+  if (!(spacing > 0.f)) {
+    return false;
+  }
+  std::vector<float> min_values;
+  std::vector<float> max_values;
+  if (!ComputeValueRange(attributes, pool, &min_values, &max_values)) {
+    return false;
+  }
+  // Snap the value range to the grid vertices, see also
+  // ExpertEncoder::SetAttributeGridQuantization().
+  int64_t num_values = 0;  // Number of values that we need to encode.
+  for (size_t c = 0; c < min_values.size(); ++c) {
+    // Min / max values on grid vertices in grid coordinates.
+    const float min_grid_value = floor(min_values[c] / spacing);
+    const float max_grid_value = ceil(max_values[c] / spacing);
+    min_values[c] = min_grid_value * spacing;
+    const int64_t component_num_values = static_cast<int64_t>(max_grid_value) -
+                                         static_cast<int64_t>(min_grid_value) +
+                                         1;
+    num_values = std::max(num_values, component_num_values);
+  }
+  if (num_values > (int64_t{1} << 30)) {
+    return false;  // Too many grid vertices.
+  }
+  // Compute the number of bits needed to encode |num_values|.
+  int bits = MostSignificantBit(static_cast<uint32_t>(num_values));
+  if ((int64_t{1} << bits) < num_values) {
+    ++bits;
+  }
+  bits = std::max(bits, 1);
+  if (!IsQuantizationValid(bits)) {
+    return false;
+  }
+  quantization_bits_ = bits;
+  min_values_ = min_values;
+  // Note there are n-1 intervals between the |n| quantization values.
+  range_ = ((1 << bits) - 1) * spacing;
+  return true;
+}
+
 bool AttributeQuantizationTransform::EncodeParameters(
     EncoderBuffer *encoder_buffer) const {
   if (is_initialized()) {
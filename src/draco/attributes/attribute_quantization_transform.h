@@ -44,12 +44,51 @@ class AttributeQuantizationTransform : public AttributeTransform {
   bool InverseTransformAttribute(const PointAttribute &attribute,
                                  PointAttribute *target_attribute) override;
 
+  // Same as above but the values are dequantized in independent chunks that
+  // are processed in parallel on |pool| (can be nullptr).
+  bool InverseTransformAttribute(const PointAttribute &attribute,
+                                 PointAttribute *target_attribute,
+                                 ThreadPool *pool);
+
+  // Stores the quantized values of |attribute| in |target_attribute| using the
+  // smallest unsigned integer type that can hold quantization_bits() (DT_UINT8
+  // or DT_UINT16). The values are not normalized and they can be converted
+  // back to the original range with ComputeDequantizationScale() and
+  // min_values(). The parameters of the transform are stored in
+  // |target_attribute|. The attribute type and the unique id of
+  // |target_attribute| are preserved. Returns false for more than 16 bits.
+  bool TransformToCompactAttribute(const PointAttribute &attribute,
+                                   PointAttribute *target_attribute) const;
+
+  // Returns the scale of the dequantization, i.e. the original value of a
+  // component c is min_value(c) + quantized_value * scale.
+  float ComputeDequantizationScale() const;
+
   bool SetParameters(int quantization_bits, const float *min_values,
                      int num_components, float range);
 
   bool ComputeParameters(const PointAttribute &attribute,
                          const int quantization_bits);
 
+  // Same as above but the range of the attribute values is computed in
+  // parallel on |pool| (can be nullptr).
+  bool ComputeParameters(const PointAttribute &attribute,
+                         const int quantization_bits, ThreadPool *pool);
+
+  // Same as above but the parameters cover the values of all |attributes|, so
+  // that all of them can be quantized with the same parameters, e.g., to share
+  // one quantization grid between the meshes of a scene. All |attributes| must
+  // have the same number of components.
+  bool ComputeParameters(const std::vector<const PointAttribute *> &attributes,
+                         const int quantization_bits, ThreadPool *pool);
+
+  // Computes the parameters of a quantization grid with vertices at integer
+  // multiples of |spacing| that covers the values of all |attributes|. The
+  // number of quantization bits is the smallest one that covers the values.
+  bool ComputeGridParameters(
+      const std::vector<const PointAttribute *> &attributes, float spacing,
+      ThreadPool *pool);
+
   // Encode relevant parameters into buffer.
   bool EncodeParameters(EncoderBuffer *encoder_buffer) const override;
 
@@ -0,0 +1,84 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/attributes/attribute_quantization_transform.h"
+
+#include <memory>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+// Creates a position attribute with the given |values| (three per point).
+std::unique_ptr<draco::PointAttribute> CreatePositions(
+    const std::vector<float> &values) {
+  const int num_points = static_cast<int>(values.size() / 3);
+  std::unique_ptr<draco::PointAttribute> pa(new draco::PointAttribute());
+  pa->Init(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32, false,
+           num_points);
+  for (int i = 0; i < num_points; ++i) {
+    pa->SetAttributeValue(draco::AttributeValueIndex(i), &values[3 * i]);
+  }
+  return pa;
+}
+
+TEST(AttributeQuantizationTransformTest, TestSharedParameters) {
+  // Tests that parameters computed from multiple attributes cover the values
+  // of all of them.
+  const auto pa0 = CreatePositions({0.f, 1.f, 2.f, 4.f, 1.f, 2.f});
+  const auto pa1 = CreatePositions({-2.f, 3.f, 2.f, 1.f, 5.f, 6.f});
+  draco::AttributeQuantizationTransform transform;
+  ASSERT_TRUE(transform.ComputeParameters({pa0.get(), pa1.get()}, 10,
+                                          /* pool = */ nullptr));
+  ASSERT_EQ(transform.quantization_bits(), 10);
+  ASSERT_EQ(transform.min_values(), std::vector<float>({-2.f, 1.f, 2.f}));
+  ASSERT_EQ(transform.range(), 6.f);
+
+  // The parameters of a single attribute must match the existing method.
+  draco::AttributeQuantizationTransform single_transform;
+  ASSERT_TRUE(single_transform.ComputeParameters(*pa1, 10));
+  draco::AttributeQuantizationTransform shared_transform;
+  ASSERT_TRUE(shared_transform.ComputeParameters({pa1.get()}, 10, nullptr));
+  ASSERT_EQ(shared_transform.min_values(), single_transform.min_values());
+  ASSERT_EQ(shared_transform.range(), single_transform.range());
+
+  // Attributes with different number of components can't share parameters.
+  draco::PointAttribute pa2;
+  pa2.Init(draco::GeometryAttribute::GENERIC, 2, draco::DT_FLOAT32, false, 1);
+  draco::AttributeQuantizationTransform invalid_transform;
+  ASSERT_FALSE(
+      invalid_transform.ComputeParameters({pa0.get(), &pa2}, 10, nullptr));
+}
+
+TEST(AttributeQuantizationTransformTest, TestSharedGridParameters) {
+  // Tests that grid parameters snap the minimum values to the grid and use the
+  // smallest number of bits that covers all values.
+  const auto pa0 = CreatePositions({0.3f, 1.f, 2.f, 4.f, 1.f, 2.f});
+  const auto pa1 = CreatePositions({-2.2f, 3.f, 2.f, 1.f, 5.f, 6.f});
+  draco::AttributeQuantizationTransform transform;
+  ASSERT_TRUE(transform.ComputeGridParameters({pa0.get(), pa1.get()}, 0.5f,
+                                              /* pool = */ nullptr));
+  ASSERT_EQ(transform.min_values(), std::vector<float>({-2.5f, 1.f, 2.f}));
+  // The largest extent is 6.5 = 13 grid steps that need 4 bits.
+  ASSERT_EQ(transform.quantization_bits(), 4);
+  ASSERT_EQ(transform.range(), 15 * 0.5f);
+  ASSERT_EQ(transform.ComputeDequantizationScale(), 0.5f);
+
+  draco::AttributeQuantizationTransform invalid_transform;
+  ASSERT_FALSE(invalid_transform.ComputeGridParameters({pa0.get(), pa1.get()},
+                                                       0.f, nullptr));
+}
+
+}  // namespace
@@ -23,6 +23,7 @@ enum AttributeTransformType {
   ATTRIBUTE_NO_TRANSFORM = 0,
   ATTRIBUTE_QUANTIZATION_TRANSFORM = 1,
   ATTRIBUTE_OCTAHEDRON_TRANSFORM = 2,
+  ATTRIBUTE_YCOCG_TRANSFORM = 3,
 };
 
 }  // namespace draco
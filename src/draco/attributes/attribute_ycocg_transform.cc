@@ -0,0 +1,253 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/attributes/attribute_ycocg_transform.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "draco/attributes/attribute_transform_type.h"
+#include "draco/attributes/attribute_ycocg_transform_simd.h"
+#include "draco/core/cpu_features.h"
+
+namespace draco {
+
+namespace {
+// Number of values converted by a single task of a parallel inverse
+// transform.
+constexpr int64_t kInverseTransformChunkSize = 1 << 15;
+// Number of values converted to the target data type at once.
+constexpr int64_t kInverseTransformBlockSize = 1 << 10;
+
+// Reverts the transform of |num_values| values in |in| and stores them to
+// |out| converted to the data type of the target attribute.
+template <typename T>
+void InverseTransformToType(const int32_t *in, int64_t num_values,
+                            int num_components, T *out) {
+  int32_t block[kInverseTransformBlockSize * 4];
+  std::vector<int32_t> large_block;
+  int32_t *block_data = block;
+  if (num_components > 4) {
+    large_block.resize(kInverseTransformBlockSize * num_components);
+    block_data = large_block.data();
+  }
+  for (int64_t begin = 0; begin < num_values;
+       begin += kInverseTransformBlockSize) {
+    const int64_t num_block_values =
+        std::min(kInverseTransformBlockSize, num_values - begin);
+    const int64_t num_entries = num_block_values * num_components;
+    AttributeYCoCgTransform::InverseTransformValues(
+        in + begin * num_components, num_block_values, num_components,
+        block_data);
+    T *const block_out = out + begin * num_components;
+    for (int64_t i = 0; i < num_entries; ++i) {
+      block_out[i] = static_cast<T>(block_data[i]);
+    }
+  }
+}
+
+}  // namespace
+
+bool AttributeYCoCgTransform::InitFromAttribute(
+    const PointAttribute &attribute) {
+  const AttributeTransformData *const transform_data =
+      attribute.GetAttributeTransformData();
+  if (!transform_data ||
+      transform_data->transform_type() != ATTRIBUTE_YCOCG_TRANSFORM) {
+    return false;  // Wrong transform type.
+  }
+  return true;
+}
+
+void AttributeYCoCgTransform::CopyToAttributeTransformData(
+    AttributeTransformData *out_data) const {
+  out_data->set_transform_type(ATTRIBUTE_YCOCG_TRANSFORM);
+}
+
+bool AttributeYCoCgTransform::TransformAttribute(
+    const PointAttribute &attribute, const std::vector<PointIndex> &point_ids,
+    PointAttribute *target_attribute) {
+  const int num_components = attribute.num_components();
+  if (!IsSupported(attribute.data_type(), num_components) ||
+      target_attribute->data_type() != DT_INT32 ||
+      target_attribute->num_components() != num_components) {
+    return false;
+  }
+  int32_t *const portable_attribute_data = reinterpret_cast<int32_t *>(
+      target_attribute->GetAddress(AttributeValueIndex(0)));
+  const int64_t num_values =
+      point_ids.empty() ? static_cast<int64_t>(target_attribute->size())
+                        : static_cast<int64_t>(point_ids.size());
+  for (int64_t i = 0; i < num_values; ++i) {
+    const PointIndex pi = point_ids.empty() ? PointIndex(i) : point_ids[i];
+    if (!attribute.ConvertValue<int32_t>(
+            attribute.mapped_index(pi), num_components,
+            portable_attribute_data + i * num_components)) {
+      return false;
+    }
+  }
+  TransformValues(portable_attribute_data, num_values, num_components);
+  return true;
+}
+
+bool AttributeYCoCgTransform::InverseTransformAttribute(
+    const PointAttribute &attribute, PointAttribute *target_attribute) {
+  return InverseTransformAttribute(attribute, target_attribute, nullptr);
+}
+
+bool AttributeYCoCgTransform::InverseTransformAttribute(
+    const PointAttribute &attribute, PointAttribute *target_attribute,
+    ThreadPool *pool) {
+  const int num_components = target_attribute->num_components();
+  if (num_components < 3 || attribute.num_components() != num_components ||
+      attribute.data_type() != DT_INT32) {
+    return false;
+  }
+  const int64_t num_values = target_attribute->size();
+  if (attribute.size() < target_attribute->size()) {
+    return false;
+  }
+  if (num_values == 0) {
+    return true;
+  }
+  const int32_t *const source_attribute_data =
+      reinterpret_cast<const int32_t *>(
+          attribute.GetAddress(AttributeValueIndex(0)));
+  uint8_t *const target_attribute_data =
+      target_attribute->GetAddress(AttributeValueIndex(0));
+  const DataType data_type = target_attribute->data_type();
+  switch (data_type) {
+    case DT_INT8:
+    case DT_UINT8:
+    case DT_INT16:
+    case DT_UINT16:
+    case DT_INT32:
+    case DT_UINT32:
+      break;
+    default:
+      return false;
+  }
+  const int num_chunks = static_cast<int>(
+      (num_values + kInverseTransformChunkSize - 1) /
+      kInverseTransformChunkSize);
+  // Each chunk writes a disjoint range of the output so the result does not
+  // depend on the number of threads.
+  ParallelFor(pool, num_chunks, [&](int k) {
+    const int64_t begin = k * kInverseTransformChunkSize;
+    const int64_t end =
+        std::min(num_values, begin + kInverseTransformChunkSize);
+    const int32_t *const in = source_attribute_data + begin * num_components;
+    uint8_t *const out = target_attribute_data +
+                         begin * num_components * DataTypeLength(data_type);
+    switch (data_type) {
+      case DT_INT8:
+        InverseTransformToType(in, end - begin, num_components,
+                               reinterpret_cast<int8_t *>(out));
+        break;
+      case DT_UINT8:
+        InverseTransformToType(in, end - begin, num_components,
+                               reinterpret_cast<uint8_t *>(out));
+        break;
+      case DT_INT16:
+        InverseTransformToType(in, end - begin, num_components,
+                               reinterpret_cast<int16_t *>(out));
+        break;
+      case DT_UINT16:
+        InverseTransformToType(in, end - begin, num_components,
+                               reinterpret_cast<uint16_t *>(out));
+        break;
+      default:
+        // 32-bit values are reverted directly into the target attribute.
+        InverseTransformValues(in, end - begin, num_components,
+                               reinterpret_cast<int32_t *>(out));
+        break;
+    }
+  });
+  return true;
+}
+
+bool AttributeYCoCgTransform::IsSupported(DataType data_type,
+                                          int num_components) {
+  if (num_components < 3) {
+    return false;
+  }
+  switch (data_type) {
+    case DT_INT8:
+    case DT_UINT8:
+    case DT_INT16:
+    case DT_UINT16:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void AttributeYCoCgTransform::TransformValues(int32_t *values,
+                                              int64_t num_values,
+                                              int num_components) {
+  for (int64_t i = 0; i < num_values; ++i) {
+    int32_t *const value = values + i * num_components;
+    const int32_t r = value[0];
+    const int32_t g = value[1];
+    const int32_t b = value[2];
+    const int32_t co = r - b;
+    const int32_t t = b + (co >> 1);
+    const int32_t cg = g - t;
+    value[0] = t + (cg >> 1);
+    value[1] = co;
+    value[2] = cg;
+  }
+}
+
+void AttributeYCoCgTransform::InverseTransformValues(const int32_t *in,
+                                                     int64_t num_values,
+                                                     int num_components,
+                                                     int32_t *out) {
+  int64_t num_processed_values = 0;
+  if (num_components == 3 || num_components == 4) {
+#if DRACO_ENABLE_SSE4_1
+    if (CpuSupportsSse4_1()) {
+      num_processed_values =
+          InverseYCoCgSse4(in, num_values, num_components, out);
+    }
+#elif DRACO_ENABLE_NEON
+    if (CpuSupportsNeon()) {
+      num_processed_values =
+          InverseYCoCgNeon(in, num_values, num_components, out);
+    }
+#elif DRACO_ENABLE_WASM_SIMD
+    if (CpuSupportsWasmSimd()) {
+      num_processed_values =
+          InverseYCoCgWasmSimd(in, num_values, num_components, out);
+    }
+#endif
+  }
+  // Process the remaining values.
+  for (int64_t i = num_processed_values; i < num_values; ++i) {
+    const int32_t *const value = in + i * num_components;
+    int32_t *const out_value = out + i * num_components;
+    const int32_t co = value[1];
+    const int32_t cg = value[2];
+    const int32_t t = value[0] - (cg >> 1);
+    const int32_t b = t - (co >> 1);
+    out_value[0] = b + co;
+    out_value[1] = cg + t;
+    out_value[2] = b;
+    for (int c = 3; c < num_components; ++c) {
+      out_value[c] = value[c];
+    }
+  }
+}
+
+}  // namespace draco
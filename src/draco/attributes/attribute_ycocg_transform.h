@@ -0,0 +1,96 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_ATTRIBUTES_ATTRIBUTE_YCOCG_TRANSFORM_H_
+#define DRACO_ATTRIBUTES_ATTRIBUTE_YCOCG_TRANSFORM_H_
+
+#include "draco/attributes/attribute_transform.h"
+#include "draco/attributes/point_attribute.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/thread_pool.h"
+
+namespace draco {
+
+// Attribute transform that converts integer RGB colors to the YCoCg-R color
+// space (luma Y, orange chroma Co and green chroma Cg) using only integer
+// additions and shifts. The transform is exactly reversible. It decorrelates
+// the color channels of natural images, which makes the values easier to
+// predict and compress than the original channels. The first three components
+// of the attribute are transformed and any other components (e.g. alpha) are
+// kept unchanged. The chroma components need one more bit than the input.
+class AttributeYCoCgTransform : public AttributeTransform {
+ public:
+  AttributeYCoCgTransform() {}
+
+  // Return attribute transform type.
+  AttributeTransformType Type() const override {
+    return ATTRIBUTE_YCOCG_TRANSFORM;
+  }
+  // Try to init transform from attribute.
+  bool InitFromAttribute(const PointAttribute &attribute) override;
+  // Copy parameter values into the provided AttributeTransformData instance.
+  void CopyToAttributeTransformData(
+      AttributeTransformData *out_data) const override;
+
+  bool TransformAttribute(const PointAttribute &attribute,
+                          const std::vector<PointIndex> &point_ids,
+                          PointAttribute *target_attribute) override;
+
+  bool InverseTransformAttribute(const PointAttribute &attribute,
+                                 PointAttribute *target_attribute) override;
+
+  // Same as above but the values are converted in independent chunks that are
+  // processed in parallel on |pool| (can be nullptr).
+  bool InverseTransformAttribute(const PointAttribute &attribute,
+                                 PointAttribute *target_attribute,
+                                 ThreadPool *pool);
+
+  // The transform has no parameters.
+  bool EncodeParameters(EncoderBuffer * /* encoder_buffer */) const override {
+    return true;
+  }
+  bool DecodeParameters(const PointAttribute & /* attribute */,
+                        DecoderBuffer * /* decoder_buffer */) override {
+    return true;
+  }
+
+  // Returns true when attributes with |data_type| and |num_components| can be
+  // transformed. Only integer types of up to 16 bits are supported so that
+  // the transformed values can't overflow.
+  static bool IsSupported(DataType data_type, int num_components);
+
+  // Transforms |num_values| RGB values with |num_components| components
+  // stored in |values| in place.
+  static void TransformValues(int32_t *values, int64_t num_values,
+                              int num_components);
+
+  // Reverts TransformValues() for |num_values| values stored in |in| and
+  // stores the RGB values to |out|.
+  static void InverseTransformValues(const int32_t *in, int64_t num_values,
+                                     int num_components, int32_t *out);
+
+ protected:
+  DataType GetTransformedDataType(
+      const PointAttribute & /* attribute */) const override {
+    return DT_INT32;
+  }
+  int GetTransformedNumComponents(
+      const PointAttribute &attribute) const override {
+    return attribute.num_components();
+  }
+};
+
+}  // namespace draco
+
+#endif  // DRACO_ATTRIBUTES_ATTRIBUTE_YCOCG_TRANSFORM_H_
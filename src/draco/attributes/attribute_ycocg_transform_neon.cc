@@ -0,0 +1,61 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/attributes/attribute_ycocg_transform_simd.h"
+
+#if DRACO_ENABLE_NEON
+#include <arm_neon.h>
+
+namespace draco {
+
+namespace {
+
+// Reverts the transform of four values stored in separate component vectors.
+// The results replace the Y, Co and Cg vectors.
+inline void InverseYCoCg4(int32x4_t *y_r, int32x4_t *co_g, int32x4_t *cg_b) {
+  const int32x4_t co = *co_g;
+  const int32x4_t cg = *cg_b;
+  const int32x4_t t = vsubq_s32(*y_r, vshrq_n_s32(cg, 1));
+  const int32x4_t b = vsubq_s32(t, vshrq_n_s32(co, 1));
+  *y_r = vaddq_s32(b, co);
+  *co_g = vaddq_s32(cg, t);
+  *cg_b = b;
+}
+
+}  // namespace
+
+int64_t InverseYCoCgNeon(const int32_t *in, int64_t num_values,
+                         int num_components, int32_t *out) {
+  const int64_t num_processed_values = num_values & ~int64_t(3);
+  if (num_components == 3) {
+    for (int64_t i = 0; i < num_processed_values; i += 4) {
+      // The structure loads and stores deinterleave and interleave the
+      // components.
+      int32x4x3_t value = vld3q_s32(in + 3 * i);
+      InverseYCoCg4(&value.val[0], &value.val[1], &value.val[2]);
+      vst3q_s32(out + 3 * i, value);
+    }
+  } else {
+    for (int64_t i = 0; i < num_processed_values; i += 4) {
+      int32x4x4_t value = vld4q_s32(in + 4 * i);
+      InverseYCoCg4(&value.val[0], &value.val[1], &value.val[2]);
+      vst4q_s32(out + 4 * i, value);
+    }
+  }
+  return num_processed_values;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_ENABLE_NEON
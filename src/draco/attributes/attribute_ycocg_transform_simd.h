@@ -0,0 +1,39 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Declarations of the SIMD kernels used by AttributeYCoCgTransform. The
+// kernels are implemented in separate source files that are compiled with the
+// flags of the corresponding instruction set and they must be called only when
+// the instruction set is supported (see cpu_features.h).
+#ifndef DRACO_ATTRIBUTES_ATTRIBUTE_YCOCG_TRANSFORM_SIMD_H_
+#define DRACO_ATTRIBUTES_ATTRIBUTE_YCOCG_TRANSFORM_SIMD_H_
+
+#include <stdint.h>
+
+namespace draco {
+
+// Reverts the YCoCg-R transform of all complete blocks of four values in |in|
+// and stores the RGB values to |out|. |num_components| must be 3 or 4, the
+// fourth component is copied unchanged. Returns the number of processed
+// values.
+int64_t InverseYCoCgSse4(const int32_t *in, int64_t num_values,
+                         int num_components, int32_t *out);
+int64_t InverseYCoCgNeon(const int32_t *in, int64_t num_values,
+                         int num_components, int32_t *out);
+int64_t InverseYCoCgWasmSimd(const int32_t *in, int64_t num_values,
+                             int num_components, int32_t *out);
+
+}  // namespace draco
+
+#endif  // DRACO_ATTRIBUTES_ATTRIBUTE_YCOCG_TRANSFORM_SIMD_H_
@@ -0,0 +1,103 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/attributes/attribute_ycocg_transform_simd.h"
+
+#if DRACO_ENABLE_SSE4_1
+#include <smmintrin.h>
+
+namespace draco {
+
+namespace {
+
+// Reverts the transform of four values stored in separate component vectors.
+inline void InverseYCoCg4(__m128i y, __m128i co, __m128i cg, __m128i *r,
+                          __m128i *g, __m128i *b) {
+  const __m128i t = _mm_sub_epi32(y, _mm_srai_epi32(cg, 1));
+  *g = _mm_add_epi32(cg, t);
+  *b = _mm_sub_epi32(t, _mm_srai_epi32(co, 1));
+  *r = _mm_add_epi32(*b, co);
+}
+
+}  // namespace
+
+int64_t InverseYCoCgSse4(const int32_t *in, int64_t num_values,
+                         int num_components, int32_t *out) {
+  const int64_t num_processed_values = num_values & ~int64_t(3);
+  __m128i r, g, b;
+  if (num_components == 3) {
+    for (int64_t i = 0; i < num_processed_values; i += 4) {
+      // Deinterleave |v0| = [y0 co0 cg0 y1], |v1| = [co1 cg1 y2 co2] and
+      // |v2| = [cg2 y3 co3 cg3] with blends and shuffles. The shuffles swap
+      // pairs of lanes so the same shuffles also interleave the results.
+      const __m128i *const src = reinterpret_cast<const __m128i *>(in + 3 * i);
+      const __m128i v0 = _mm_loadu_si128(src);
+      const __m128i v1 = _mm_loadu_si128(src + 1);
+      const __m128i v2 = _mm_loadu_si128(src + 2);
+      const __m128i y = _mm_shuffle_epi32(
+          _mm_blend_epi16(_mm_blend_epi16(v0, v1, 0x30), v2, 0x0c),
+          _MM_SHUFFLE(1, 2, 3, 0));
+      const __m128i co = _mm_shuffle_epi32(
+          _mm_blend_epi16(_mm_blend_epi16(v0, v1, 0xc3), v2, 0x30),
+          _MM_SHUFFLE(2, 3, 0, 1));
+      const __m128i cg = _mm_shuffle_epi32(
+          _mm_blend_epi16(_mm_blend_epi16(v0, v1, 0x0c), v2, 0xc3),
+          _MM_SHUFFLE(3, 0, 1, 2));
+      InverseYCoCg4(y, co, cg, &r, &g, &b);
+      const __m128i pr = _mm_shuffle_epi32(r, _MM_SHUFFLE(1, 2, 3, 0));
+      const __m128i pg = _mm_shuffle_epi32(g, _MM_SHUFFLE(2, 3, 0, 1));
+      const __m128i pb = _mm_shuffle_epi32(b, _MM_SHUFFLE(3, 0, 1, 2));
+      __m128i *const dst = reinterpret_cast<__m128i *>(out + 3 * i);
+      _mm_storeu_si128(
+          dst, _mm_blend_epi16(_mm_blend_epi16(pr, pg, 0x0c), pb, 0x30));
+      _mm_storeu_si128(
+          dst + 1, _mm_blend_epi16(_mm_blend_epi16(pg, pb, 0x0c), pr, 0x30));
+      _mm_storeu_si128(
+          dst + 2, _mm_blend_epi16(_mm_blend_epi16(pb, pr, 0x0c), pg, 0x30));
+    }
+  } else {
+    for (int64_t i = 0; i < num_processed_values; i += 4) {
+      // Transpose four values to component vectors.
+      const __m128i *const src = reinterpret_cast<const __m128i *>(in + 4 * i);
+      const __m128i v0 = _mm_loadu_si128(src);
+      const __m128i v1 = _mm_loadu_si128(src + 1);
+      const __m128i v2 = _mm_loadu_si128(src + 2);
+      const __m128i v3 = _mm_loadu_si128(src + 3);
+      const __m128i t0 = _mm_unpacklo_epi32(v0, v1);
+      const __m128i t1 = _mm_unpacklo_epi32(v2, v3);
+      const __m128i t2 = _mm_unpackhi_epi32(v0, v1);
+      const __m128i t3 = _mm_unpackhi_epi32(v2, v3);
+      const __m128i y = _mm_unpacklo_epi64(t0, t1);
+      const __m128i co = _mm_unpackhi_epi64(t0, t1);
+      const __m128i cg = _mm_unpacklo_epi64(t2, t3);
+      const __m128i a = _mm_unpackhi_epi64(t2, t3);
+      InverseYCoCg4(y, co, cg, &r, &g, &b);
+      // Transpose the results back.
+      const __m128i u0 = _mm_unpacklo_epi32(r, g);
+      const __m128i u1 = _mm_unpacklo_epi32(b, a);
+      const __m128i u2 = _mm_unpackhi_epi32(r, g);
+      const __m128i u3 = _mm_unpackhi_epi32(b, a);
+      __m128i *const dst = reinterpret_cast<__m128i *>(out + 4 * i);
+      _mm_storeu_si128(dst, _mm_unpacklo_epi64(u0, u1));
+      _mm_storeu_si128(dst + 1, _mm_unpackhi_epi64(u0, u1));
+      _mm_storeu_si128(dst + 2, _mm_unpacklo_epi64(u2, u3));
+      _mm_storeu_si128(dst + 3, _mm_unpackhi_epi64(u2, u3));
+    }
+  }
+  return num_processed_values;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_ENABLE_SSE4_1
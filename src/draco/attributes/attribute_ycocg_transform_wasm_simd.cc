@@ -0,0 +1,98 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/attributes/attribute_ycocg_transform_simd.h"
+
+#if DRACO_ENABLE_WASM_SIMD
+#include <wasm_simd128.h>
+
+namespace draco {
+
+namespace {
+
+// Reverts the transform of four values stored in separate component vectors.
+inline void InverseYCoCg4(v128_t y, v128_t co, v128_t cg, v128_t *r, v128_t *g,
+                          v128_t *b) {
+  const v128_t t = wasm_i32x4_sub(y, wasm_i32x4_shr(cg, 1));
+  *g = wasm_i32x4_add(cg, t);
+  *b = wasm_i32x4_sub(t, wasm_i32x4_shr(co, 1));
+  *r = wasm_i32x4_add(*b, co);
+}
+
+}  // namespace
+
+int64_t InverseYCoCgWasmSimd(const int32_t *in, int64_t num_values,
+                             int num_components, int32_t *out) {
+  const int64_t num_processed_values = num_values & ~int64_t(3);
+  v128_t r, g, b;
+  if (num_components == 3) {
+    for (int64_t i = 0; i < num_processed_values; i += 4) {
+      // Deinterleave |v0| = [y0 co0 cg0 y1], |v1| = [co1 cg1 y2 co2] and
+      // |v2| = [cg2 y3 co3 cg3]. Shuffle lanes 0-3 select from the first
+      // input and lanes 4-7 from the second input.
+      const int32_t *const src = in + 3 * i;
+      const v128_t v0 = wasm_v128_load(src);
+      const v128_t v1 = wasm_v128_load(src + 4);
+      const v128_t v2 = wasm_v128_load(src + 8);
+      const v128_t y = wasm_i32x4_shuffle(
+          wasm_i32x4_shuffle(v0, v1, 0, 3, 6, 0), v2, 0, 1, 2, 5);
+      const v128_t co = wasm_i32x4_shuffle(
+          wasm_i32x4_shuffle(v0, v1, 1, 4, 7, 0), v2, 0, 1, 2, 6);
+      const v128_t cg = wasm_i32x4_shuffle(
+          wasm_i32x4_shuffle(v0, v1, 2, 5, 0, 0), v2, 0, 1, 4, 7);
+      InverseYCoCg4(y, co, cg, &r, &g, &b);
+      // Interleave to [r0 g0 b0 r1], [g1 b1 r2 g2] and [b2 r3 g3 b3].
+      const v128_t rg = wasm_i32x4_shuffle(r, g, 0, 4, 1, 5);
+      const v128_t gb = wasm_i32x4_shuffle(g, b, 1, 5, 2, 6);
+      const v128_t br = wasm_i32x4_shuffle(b, r, 2, 7, 3, 0);
+      int32_t *const dst = out + 3 * i;
+      wasm_v128_store(dst, wasm_i32x4_shuffle(rg, b, 0, 1, 4, 2));
+      wasm_v128_store(dst + 4, wasm_i32x4_shuffle(gb, r, 0, 1, 6, 2));
+      wasm_v128_store(dst + 8, wasm_i32x4_shuffle(br, g, 0, 1, 7, 2));
+    }
+  } else {
+    for (int64_t i = 0; i < num_processed_values; i += 4) {
+      // Transpose four values to component vectors.
+      const int32_t *const src = in + 4 * i;
+      const v128_t v0 = wasm_v128_load(src);
+      const v128_t v1 = wasm_v128_load(src + 4);
+      const v128_t v2 = wasm_v128_load(src + 8);
+      const v128_t v3 = wasm_v128_load(src + 12);
+      const v128_t t0 = wasm_i32x4_shuffle(v0, v1, 0, 4, 1, 5);
+      const v128_t t1 = wasm_i32x4_shuffle(v2, v3, 0, 4, 1, 5);
+      const v128_t t2 = wasm_i32x4_shuffle(v0, v1, 2, 6, 3, 7);
+      const v128_t t3 = wasm_i32x4_shuffle(v2, v3, 2, 6, 3, 7);
+      const v128_t y = wasm_i64x2_shuffle(t0, t1, 0, 2);
+      const v128_t co = wasm_i64x2_shuffle(t0, t1, 1, 3);
+      const v128_t cg = wasm_i64x2_shuffle(t2, t3, 0, 2);
+      const v128_t a = wasm_i64x2_shuffle(t2, t3, 1, 3);
+      InverseYCoCg4(y, co, cg, &r, &g, &b);
+      // Transpose the results back.
+      const v128_t u0 = wasm_i32x4_shuffle(r, g, 0, 4, 1, 5);
+      const v128_t u1 = wasm_i32x4_shuffle(b, a, 0, 4, 1, 5);
+      const v128_t u2 = wasm_i32x4_shuffle(r, g, 2, 6, 3, 7);
+      const v128_t u3 = wasm_i32x4_shuffle(b, a, 2, 6, 3, 7);
+      int32_t *const dst = out + 4 * i;
+      wasm_v128_store(dst, wasm_i64x2_shuffle(u0, u1, 0, 2));
+      wasm_v128_store(dst + 4, wasm_i64x2_shuffle(u0, u1, 1, 3));
+      wasm_v128_store(dst + 8, wasm_i64x2_shuffle(u2, u3, 0, 2));
+      wasm_v128_store(dst + 12, wasm_i64x2_shuffle(u2, u3, 1, 3));
+    }
+  }
+  return num_processed_values;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_ENABLE_WASM_SIMD
@@ -57,7 +57,8 @@ bool GeometryAttribute::CopyFrom(const GeometryAttribute &src_att) {
     if (buffer_ == nullptr) {
       return false;
     }
-    buffer_->Update(src_att.buffer_->data(), src_att.buffer_->data_size());
+    // The data is shared until either of the attributes is modified.
+    buffer_->ShareFrom(*src_att.buffer_);
   }
 #ifdef DRACO_TRANSCODER_SUPPORTED
   name_ = src_att.name_;
@@ -18,7 +18,9 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <limits>
+#include <type_traits>
 
 #include "draco/attributes/geometry_indices.h"
 #include "draco/core/data_buffer.h"
@@ -121,14 +123,16 @@ class GeometryAttribute {
 
   inline const uint8_t *GetAddress(AttributeValueIndex att_index) const {
     const int64_t byte_pos = GetBytePos(att_index);
-    return buffer_->data() + byte_pos;
+    // The const buffer is used so that shared buffer data is not copied.
+    return static_cast<const DataBuffer *>(buffer_)->data() + byte_pos;
   }
   inline uint8_t *GetAddress(AttributeValueIndex att_index) {
     const int64_t byte_pos = GetBytePos(att_index);
     return buffer_->data() + byte_pos;
   }
   inline bool IsAddressValid(const uint8_t *address) const {
-    return ((buffer_->data() + buffer_->data_size()) > address);
+    const DataBuffer *const buffer = buffer_;
+    return ((buffer->data() + buffer->data_size()) > address);
   }
 
   // Fills out_data with the raw value of the requested attribute entry.
@@ -230,6 +234,62 @@ class GeometryAttribute {
     return ConvertValue<OutT>(att_index, num_components_, out_value);
   }
 
+  // Converts |num_values| consecutive attribute values starting at |first| to
+  // the output format. Each output entry stores |out_num_components| values of
+  // type OutT and consecutive entries are |out_byte_stride| bytes apart. Unlike
+  // calling ConvertValue() for each value, the data type is resolved once for
+  // all values and values of the same type are copied without conversion.
+  // Returns false when the conversion failed.
+  template <typename OutT>
+  bool ConvertValues(AttributeValueIndex first, int64_t num_values,
+                     int8_t out_num_components, OutT *out_values,
+                     int64_t out_byte_stride) const {
+    if (out_values == nullptr) {
+      return false;
+    }
+    if (num_values <= 0) {
+      return true;
+    }
+    switch (data_type_) {
+      case DT_INT8:
+        return ConvertTypedValues<int8_t, OutT>(
+            first, num_values, out_num_components, out_values, out_byte_stride);
+      case DT_UINT8:
+        return ConvertTypedValues<uint8_t, OutT>(
+            first, num_values, out_num_components, out_values, out_byte_stride);
+      case DT_INT16:
+        return ConvertTypedValues<int16_t, OutT>(
+            first, num_values, out_num_components, out_values, out_byte_stride);
+      case DT_UINT16:
+        return ConvertTypedValues<uint16_t, OutT>(
+            first, num_values, out_num_components, out_values, out_byte_stride);
+      case DT_INT32:
+        return ConvertTypedValues<int32_t, OutT>(
+            first, num_values, out_num_components, out_values, out_byte_stride);
+      case DT_UINT32:
+        return ConvertTypedValues<uint32_t, OutT>(
+            first, num_values, out_num_components, out_values, out_byte_stride);
+      case DT_INT64:
+        return ConvertTypedValues<int64_t, OutT>(
+            first, num_values, out_num_components, out_values, out_byte_stride);
+      case DT_UINT64:
+        return ConvertTypedValues<uint64_t, OutT>(
+            first, num_values, out_num_components, out_values, out_byte_stride);
+      case DT_FLOAT32:
+        return ConvertTypedValues<float, OutT>(
+            first, num_values, out_num_components, out_values, out_byte_stride);
+      case DT_FLOAT64:
+        return ConvertTypedValues<double, OutT>(
+            first, num_values, out_num_components, out_values, out_byte_stride);
+      case DT_BOOL:
+        return ConvertTypedValues<bool, OutT>(
+            first, num_values, out_num_components, out_values, out_byte_stride);
+      default:
+        // Wrong attribute type.
+        return false;
+    }
+  }
+
   // Utility function. Returns |attribute_type| as std::string.
   static std::string TypeToString(Type attribute_type) {
     switch (attribute_type) {
@@ -325,6 +385,92 @@ class GeometryAttribute {
     return true;
   }
 
+  // Bulk version of ConvertTypedValue() used by ConvertValues().
+  template <typename T, typename OutT>
+  bool ConvertTypedValues(AttributeValueIndex first, int64_t num_values,
+                          int8_t out_num_components, OutT *out_values,
+                          int64_t out_byte_stride) const {
+    const int num_converted_components =
+        std::min<int>(num_components_, out_num_components);
+    const uint8_t *const src_address = GetAddress(first);
+    // Check once that the last converted component of the last value is within
+    // the buffer.
+    if (num_converted_components > 0 &&
+        !IsAddressValid(src_address + (num_values - 1) * byte_stride_ +
+                        num_converted_components * sizeof(T) - 1)) {
+      return false;
+    }
+    uint8_t *const out_address = reinterpret_cast<uint8_t *>(out_values);
+    const int64_t entry_size = sizeof(T) * num_converted_components;
+    if (std::is_same<T, OutT>::value && out_num_components == num_components_ &&
+        byte_stride_ == entry_size && out_byte_stride == entry_size) {
+      // Tightly packed values of the same type are copied at once.
+      memcpy(out_address, src_address, num_values * entry_size);
+      return true;
+    }
+    // Loops with a known number of components are unrolled and vectorized by
+    // the compiler for the common conversions.
+    if (out_num_components == num_components_) {
+      switch (num_components_) {
+        case 1:
+          return ConvertTypedEntries<T, OutT, 1>(src_address, num_values,
+                                                 out_address, out_byte_stride);
+        case 2:
+          return ConvertTypedEntries<T, OutT, 2>(src_address, num_values,
+                                                 out_address, out_byte_stride);
+        case 3:
+          return ConvertTypedEntries<T, OutT, 3>(src_address, num_values,
+                                                 out_address, out_byte_stride);
+        case 4:
+          return ConvertTypedEntries<T, OutT, 4>(src_address, num_values,
+                                                 out_address, out_byte_stride);
+        default:
+          break;
+      }
+    }
+    for (int64_t v = 0; v < num_values; ++v) {
+      const uint8_t *const in_entry = src_address + v * byte_stride_;
+      OutT *const out_entry =
+          reinterpret_cast<OutT *>(out_address + v * out_byte_stride);
+      for (int i = 0; i < num_converted_components; ++i) {
+        const T in_value =
+            *reinterpret_cast<const T *>(in_entry + i * sizeof(T));
+        if (!ConvertComponentValue<T, OutT>(in_value, normalized_,
+                                            out_entry + i)) {
+          return false;
+        }
+      }
+      // Fill empty data for unused output components if needed.
+      for (int i = num_components_; i < out_num_components; ++i) {
+        out_entry[i] = static_cast<OutT>(0);
+      }
+    }
+    return true;
+  }
+
+  // Converts |num_values| entries of |num_components_t| components starting
+  // at |in_address| to |out_address|.
+  template <typename T, typename OutT, int num_components_t>
+  bool ConvertTypedEntries(const uint8_t *in_address, int64_t num_values,
+                           uint8_t *out_address,
+                           int64_t out_byte_stride) const {
+    for (int64_t v = 0; v < num_values; ++v) {
+      const T *const in_entry =
+          reinterpret_cast<const T *>(in_address + v * byte_stride_);
+      OutT *const out_entry =
+          reinterpret_cast<OutT *>(out_address + v * out_byte_stride);
+      bool is_valid = true;
+      for (int i = 0; i < num_components_t; ++i) {
+        is_valid &= ConvertComponentValue<T, OutT>(in_entry[i], normalized_,
+                                                   out_entry + i);
+      }
+      if (!is_valid) {
+        return false;
+      }
+    }
+    return true;
+  }
+
 #ifdef DRACO_TRANSCODER_SUPPORTED
   // Function that converts input |value| from type T to the internal attribute
   // representation defined by OutT and |num_components_|.
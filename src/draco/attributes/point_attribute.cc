@@ -14,13 +14,11 @@
 //
 #include "draco/attributes/point_attribute.h"
 
-#include <tuple>
-#include <unordered_map>
-using std::unordered_map;
+#include <cstring>
+#include <vector>
 
-// Shortcut for typed conditionals.
-template <bool B, class T, class F>
-using conditional_t = typename std::conditional<B, T, F>::type;
+#include "draco/core/deduplication_utils.h"
+#include "draco/core/quantization_utils.h"
 
 namespace draco {
 
@@ -64,12 +62,29 @@ void PointAttribute::CopyFrom(const PointAttribute &src_att) {
 }
 
 bool PointAttribute::Reset(size_t num_attribute_values) {
+  return ResetStorage(num_attribute_values, /* initialize_values= */ true);
+}
+
+bool PointAttribute::ResetUninitialized(size_t num_attribute_values) {
+  return ResetStorage(num_attribute_values, /* initialize_values= */ false);
+}
+
+bool PointAttribute::ResetStorage(size_t num_attribute_values,
+                                  bool initialize_values) {
   if (attribute_buffer_ == nullptr) {
     attribute_buffer_ = std::unique_ptr<DataBuffer>(new DataBuffer());
   }
   const int64_t entry_size = DataTypeLength(data_type()) * num_components();
-  if (!attribute_buffer_->Update(nullptr, num_attribute_values * entry_size)) {
-    return false;
+  const int64_t num_bytes = num_attribute_values * entry_size;
+  if (initialize_values) {
+    if (!attribute_buffer_->Update(nullptr, num_bytes)) {
+      return false;
+    }
+  } else {
+    if (num_bytes < 0) {
+      return false;
+    }
+    attribute_buffer_->ResizeUninitialized(num_bytes);
   }
   // Assign the new buffer to the parent attribute.
   ResetBuffer(attribute_buffer_.get(), entry_size, 0);
@@ -77,11 +92,130 @@ bool PointAttribute::Reset(size_t num_attribute_values) {
   return true;
 }
 
+void PointAttribute::ReinitializeKeepingStorage(const GeometryAttribute &att) {
+  GeometryAttribute::operator=(att);
+  if (attribute_buffer_ != nullptr) {
+    attribute_buffer_->Resize(0);
+    ResetBuffer(attribute_buffer_.get(), byte_stride(), 0);
+  }
+  num_unique_entries_ = 0;
+  identity_mapping_ = false;
+  if (indices_map_ != nullptr) {
+    if (indices_map_.use_count() == 1) {
+      indices_map_->clear();
+    } else {
+      indices_map_ = nullptr;
+    }
+  }
+  attribute_transform_data_ = nullptr;
+  std::atomic_store(&value_range_, std::shared_ptr<const ValueRange>());
+}
+
+void PointAttribute::SetMemoryArena(MemoryArena *arena) {
+  attribute_buffer_ = std::unique_ptr<DataBuffer>(new DataBuffer(arena));
+  ResetBuffer(attribute_buffer_.get(), byte_stride(), 0);
+  num_unique_entries_ = 0;
+}
+
+void PointAttribute::SetExternalValues(const void *data,
+                                       size_t num_attribute_values) {
+  if (attribute_buffer_ == nullptr) {
+    attribute_buffer_ = std::unique_ptr<DataBuffer>(new DataBuffer());
+  }
+  const int64_t entry_size = DataTypeLength(data_type()) * num_components();
+  attribute_buffer_->SetExternalData(data, num_attribute_values * entry_size);
+  ResetBuffer(attribute_buffer_.get(), entry_size, 0);
+  num_unique_entries_ = static_cast<uint32_t>(num_attribute_values);
+}
+
 void PointAttribute::Resize(size_t new_num_unique_entries) {
   num_unique_entries_ = static_cast<uint32_t>(new_num_unique_entries);
   attribute_buffer_->Resize(new_num_unique_entries * byte_stride());
 }
 
+void PointAttribute::MakeIndicesMapUnique() {
+  if (indices_map_ == nullptr) {
+    indices_map_ =
+        std::make_shared<IndexTypeVector<PointIndex, AttributeValueIndex>>();
+  } else if (indices_map_.use_count() != 1) {
+    indices_map_ =
+        std::make_shared<IndexTypeVector<PointIndex, AttributeValueIndex>>(
+            *indices_map_);
+  }
+}
+
+MemoryFootprint PointAttribute::MemoryUsage() const {
+  MemoryFootprint usage;
+  if (attribute_buffer_ != nullptr) {
+    usage.attribute_values = attribute_buffer_->memory_usage();
+  }
+  if (indices_map_ != nullptr) {
+    usage.attribute_index_maps =
+        indices_map_->capacity() * sizeof(AttributeValueIndex);
+  }
+  return usage;
+}
+
+void PointAttribute::ShrinkToFit() {
+  if (attribute_buffer_ != nullptr) {
+    attribute_buffer_->ShrinkToFit();
+  }
+  if (indices_map_ != nullptr && indices_map_.use_count() == 1) {
+    indices_map_->shrink_to_fit();
+  }
+}
+
+bool PointAttribute::ComputeValueRange(ThreadPool *pool,
+                                       std::vector<float> *min_values,
+                                       std::vector<float> *max_values) const {
+  std::shared_ptr<const ValueRange> range = std::atomic_load(&value_range_);
+  if (range == nullptr || range->num_values != size() ||
+      range->min_values.size() != num_components() ||
+      attribute_buffer_ == nullptr || attribute_buffer_->IsModified()) {
+    // The flag is cleared before the values are read so that any concurrent
+    // modification invalidates the new range.
+    if (attribute_buffer_ != nullptr) {
+      attribute_buffer_->ClearModified();
+    }
+    std::shared_ptr<ValueRange> new_range(new ValueRange());
+    new_range->num_values = size();
+    new_range->min_values.resize(num_components());
+    new_range->max_values.resize(num_components());
+    if (data_type() == DT_FLOAT32 &&
+        byte_stride() ==
+            static_cast<int64_t>(sizeof(float) * num_components())) {
+      const float *const values =
+          size() == 0 ? nullptr
+                      : reinterpret_cast<const float *>(
+                            GetAddress(AttributeValueIndex(0)));
+      new_range->is_valid = draco::ComputeValueRange(
+          values, size(), num_components(), pool,
+          new_range->min_values.data(), new_range->max_values.data());
+    } else {
+      // Convert the values to floats first.
+      std::vector<float> values(size() * num_components());
+      bool is_valid = true;
+      for (AttributeValueIndex i(0); i < size(); ++i) {
+        is_valid &= ConvertValue<float>(i, num_components(),
+                                        &values[i.value() * num_components()]);
+      }
+      new_range->is_valid =
+          is_valid && draco::ComputeValueRange(
+                          values.data(), size(), num_components(), pool,
+                          new_range->min_values.data(),
+                          new_range->max_values.data());
+    }
+    range = new_range;
+    std::atomic_store(&value_range_, range);
+  }
+  if (!range->is_valid) {
+    return false;
+  }
+  *min_values = range->min_values;
+  *max_values = range->max_values;
+  return true;
+}
+
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
 AttributeValueIndex::ValueType PointAttribute::DeduplicateValues(
     const GeometryAttribute &in_att) {
@@ -90,30 +224,41 @@ AttributeValueIndex::ValueType PointAttribute::DeduplicateValues(
 
 AttributeValueIndex::ValueType PointAttribute::DeduplicateValues(
     const GeometryAttribute &in_att, AttributeValueIndex in_att_offset) {
+  return DeduplicateValues(in_att, in_att_offset, nullptr);
+}
+
+AttributeValueIndex::ValueType PointAttribute::DeduplicateValues(
+    const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+    ThreadPool *pool) {
   AttributeValueIndex::ValueType unique_vals = 0;
   switch (in_att.data_type()) {
     // Currently we support only float, uint8, and uint16 arguments.
     case DT_FLOAT32:
-      unique_vals = DeduplicateTypedValues<float>(in_att, in_att_offset);
+      unique_vals = DeduplicateTypedValues<float>(in_att, in_att_offset, pool);
       break;
     case DT_INT8:
-      unique_vals = DeduplicateTypedValues<int8_t>(in_att, in_att_offset);
+      unique_vals = DeduplicateTypedValues<int8_t>(in_att, in_att_offset, pool);
       break;
     case DT_UINT8:
     case DT_BOOL:
-      unique_vals = DeduplicateTypedValues<uint8_t>(in_att, in_att_offset);
+      unique_vals =
+          DeduplicateTypedValues<uint8_t>(in_att, in_att_offset, pool);
       break;
     case DT_UINT16:
-      unique_vals = DeduplicateTypedValues<uint16_t>(in_att, in_att_offset);
+      unique_vals =
+          DeduplicateTypedValues<uint16_t>(in_att, in_att_offset, pool);
       break;
     case DT_INT16:
-      unique_vals = DeduplicateTypedValues<int16_t>(in_att, in_att_offset);
+      unique_vals =
+          DeduplicateTypedValues<int16_t>(in_att, in_att_offset, pool);
       break;
     case DT_UINT32:
-      unique_vals = DeduplicateTypedValues<uint32_t>(in_att, in_att_offset);
+      unique_vals =
+          DeduplicateTypedValues<uint32_t>(in_att, in_att_offset, pool);
       break;
     case DT_INT32:
-      unique_vals = DeduplicateTypedValues<int32_t>(in_att, in_att_offset);
+      unique_vals =
+          DeduplicateTypedValues<int32_t>(in_att, in_att_offset, pool);
       break;
     default:
       return -1;  // Unsupported data type.
@@ -129,18 +274,19 @@ AttributeValueIndex::ValueType PointAttribute::DeduplicateValues(
 // Returns the number of unique attribute values.
 template <typename T>
 AttributeValueIndex::ValueType PointAttribute::DeduplicateTypedValues(
-    const GeometryAttribute &in_att, AttributeValueIndex in_att_offset) {
+    const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+    ThreadPool *pool) {
   // Select the correct method to call based on the number of attribute
   // components.
   switch (in_att.num_components()) {
     case 1:
-      return DeduplicateFormattedValues<T, 1>(in_att, in_att_offset);
+      return DeduplicateFormattedValues<T, 1>(in_att, in_att_offset, pool);
     case 2:
-      return DeduplicateFormattedValues<T, 2>(in_att, in_att_offset);
+      return DeduplicateFormattedValues<T, 2>(in_att, in_att_offset, pool);
     case 3:
-      return DeduplicateFormattedValues<T, 3>(in_att, in_att_offset);
+      return DeduplicateFormattedValues<T, 3>(in_att, in_att_offset, pool);
     case 4:
-      return DeduplicateFormattedValues<T, 4>(in_att, in_att_offset);
+      return DeduplicateFormattedValues<T, 4>(in_att, in_att_offset, pool);
     default:
       return 0;
   }
@@ -148,53 +294,39 @@ AttributeValueIndex::ValueType PointAttribute::DeduplicateTypedValues(
 
 template <typename T, int num_components_t>
 AttributeValueIndex::ValueType PointAttribute::DeduplicateFormattedValues(
-    const GeometryAttribute &in_att, AttributeValueIndex in_att_offset) {
-  // We want to detect duplicates using a hash map but we cannot hash floating
-  // point numbers directly so bit-copy floats to the same sized integers and
-  // hash them.
-
-  // First we need to determine which int type to use (1, 2, 4 or 8 bytes).
-  // Note, this is done at compile time using std::conditional struct.
-  // Conditional is in form <bool-expression, true, false>. If bool-expression
-  // is true the "true" branch is used and vice versa. All at compile time.
-  typedef conditional_t<sizeof(T) == 1, uint8_t,
-                        conditional_t<sizeof(T) == 2, uint16_t,
-                                      conditional_t<sizeof(T) == 4, uint32_t,
-                                                    /*else*/ uint64_t>>>
-      HashType;
-
-  AttributeValueIndex unique_vals(0);
+    const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+    ThreadPool *pool) {
+  // Floating point values are compared bitwise, the same way they would be
+  // compared if they were bit-copied to integers of the same size.
   typedef std::array<T, num_components_t> AttributeValue;
-  typedef std::array<HashType, num_components_t> AttributeHashableValue;
-  typedef unordered_map<AttributeHashableValue, AttributeValueIndex,
-                        HashArray<AttributeHashableValue>>
-      ValueToIndexMap;
+  const size_t value_size = sizeof(AttributeValue);
+  const auto value_hash = [&](uint32_t i) {
+    return HashBytes(in_att.GetAddress(AttributeValueIndex(i) + in_att_offset),
+                     value_size);
+  };
+  const auto value_equal = [&](uint32_t i, uint32_t j) {
+    return memcmp(in_att.GetAddress(AttributeValueIndex(i) + in_att_offset),
+                  in_att.GetAddress(AttributeValueIndex(j) + in_att_offset),
+                  value_size) == 0;
+  };
+  // Index of the first attribute value equal to each value.
+  std::vector<uint32_t> first_occurrence;
+  FindFirstOccurrences(num_unique_entries_, value_hash, value_equal, pool,
+                       &first_occurrence);
 
-  // Hash map storing index of the first attribute with a given value.
-  ValueToIndexMap value_to_index_map;
+  AttributeValueIndex unique_vals(0);
   AttributeValue att_value;
-  AttributeHashableValue hashable_value;
   IndexTypeVector<AttributeValueIndex, AttributeValueIndex> value_map(
       num_unique_entries_);
   for (AttributeValueIndex i(0); i < num_unique_entries_; ++i) {
-    const AttributeValueIndex att_pos = i + in_att_offset;
-    att_value = in_att.GetValue<T, num_components_t>(att_pos);
-    // Convert the value to hashable type. Bit-copy real attributes to integers.
-    memcpy(&(hashable_value[0]), &(att_value[0]), sizeof(att_value));
-
-    typename ValueToIndexMap::iterator it;
-    bool inserted;
-    std::tie(it, inserted) = value_to_index_map.insert(
-        std::pair<AttributeHashableValue, AttributeValueIndex>(hashable_value,
-                                                               unique_vals));
-
-    // Try to update the hash map with a new entry pointing to the latest unique
-    // vertex index.
-    if (!inserted) {
+    const uint32_t first = first_occurrence[i.value()];
+    if (first != i.value()) {
       // Duplicated value found. Update index mapping.
-      value_map[i] = it->second;
+      value_map[i] = value_map[AttributeValueIndex(first)];
     } else {
-      // New unique value.
+      // New unique value. Values are compacted in place, which is safe even
+      // when |in_att| is |this| because |unique_vals| never exceeds |i|.
+      att_value = in_att.GetValue<T, num_components_t>(i + in_att_offset);
       SetAttributeValue(unique_vals, &att_value);
       // Update index mapping.
       value_map[i] = unique_vals;
@@ -215,8 +347,8 @@ AttributeValueIndex::ValueType PointAttribute::DeduplicateFormattedValues(
     }
   } else {
     // Update point to value map using the mapping between old and new values.
-    for (PointIndex i(0); i < static_cast<uint32_t>(indices_map_.size()); ++i) {
-      SetPointMapEntry(i, value_map[indices_map_[i]]);
+    for (PointIndex i(0); i < static_cast<uint32_t>(indices_map_size()); ++i) {
+      SetPointMapEntry(i, value_map[(*indices_map_)[i]]);
     }
   }
   num_unique_entries_ = unique_vals.value();
@@ -233,8 +365,8 @@ void PointAttribute::RemoveUnusedValues() {
   // If not we can delete the value.
   IndexTypeVector<AttributeValueIndex, bool> is_value_used(size(), false);
   int num_used_values = 0;
-  for (PointIndex pi(0); pi < indices_map_.size(); ++pi) {
-    const AttributeValueIndex avi = indices_map_[pi];
+  for (PointIndex pi(0); pi < indices_map_size(); ++pi) {
+    const AttributeValueIndex avi = (*indices_map_)[pi];
     if (!is_value_used[avi]) {
       is_value_used[avi] = true;
       num_used_values++;
@@ -259,8 +391,9 @@ void PointAttribute::RemoveUnusedValues() {
   }
 
   // Remap all points to the new attribute values.
-  for (PointIndex pi(0); pi < indices_map_.size(); ++pi) {
-    indices_map_[pi] = old_to_new_value_map[indices_map_[pi]];
+  MakeIndicesMapUnique();
+  for (PointIndex pi(0); pi < indices_map_size(); ++pi) {
+    (*indices_map_)[pi] = old_to_new_value_map[(*indices_map_)[pi]];
   }
 
   num_unique_entries_ = num_used_values;
@@ -15,13 +15,18 @@
 #ifndef DRACO_ATTRIBUTES_POINT_ATTRIBUTE_H_
 #define DRACO_ATTRIBUTES_POINT_ATTRIBUTE_H_
 
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "draco/attributes/attribute_transform_data.h"
 #include "draco/attributes/geometry_attribute.h"
 #include "draco/core/draco_index_type_vector.h"
 #include "draco/core/hash_utils.h"
 #include "draco/core/macros.h"
+#include "draco/core/memory_arena.h"
+#include "draco/core/memory_footprint.h"
+#include "draco/core/thread_pool.h"
 #include "draco/draco_features.h"
 
 namespace draco {
@@ -52,20 +57,44 @@ class PointAttribute : public GeometryAttribute {
   // Prepares the attribute storage for the specified number of entries.
   bool Reset(size_t num_attribute_values);
 
+  // Same as Reset() but the values of any new entries are left uninitialized.
+  // Use only when all the entries are written before they are read, e.g. by
+  // attribute decoders.
+  bool ResetUninitialized(size_t num_attribute_values);
+
+  // Reinitializes the attribute with the properties of |att| like a newly
+  // constructed PointAttribute(|att|), but keeps the memory allocated for the
+  // attribute values and for an explicit mapping so that the attribute can be
+  // refilled without heap allocations. All values are discarded.
+  void ReinitializeKeepingStorage(const GeometryAttribute &att);
+
+  // Makes the attribute allocate its storage from |arena| (or from the heap
+  // when |arena| is nullptr). Any existing attribute values are discarded, so
+  // this should be called before the storage is prepared with Reset(). The
+  // attribute must not be used after |arena| is destroyed.
+  void SetMemoryArena(MemoryArena *arena);
+
+  // Makes the attribute read its |num_attribute_values| tightly packed values
+  // directly from |data| owned by the caller, without copying them. The memory
+  // must stay valid and unchanged while the attribute is in use. Any
+  // modification of the values copies them into the attribute's own storage,
+  // see DataBuffer::SetExternalData().
+  void SetExternalValues(const void *data, size_t num_attribute_values);
+
   size_t size() const { return num_unique_entries_; }
   AttributeValueIndex mapped_index(PointIndex point_index) const {
     if (identity_mapping_) {
       return AttributeValueIndex(point_index.value());
     }
-    return indices_map_[point_index];
+    return (*indices_map_)[point_index];
   }
   DataBuffer *buffer() const { return attribute_buffer_.get(); }
   bool is_mapping_identity() const { return identity_mapping_; }
   size_t indices_map_size() const {
-    if (is_mapping_identity()) {
+    if (is_mapping_identity() || indices_map_ == nullptr) {
       return 0;
     }
-    return indices_map_.size();
+    return indices_map_->size();
   }
 
   const uint8_t *GetAddressOfMappedIndex(PointIndex point_index) const {
@@ -87,20 +116,41 @@ class PointAttribute : public GeometryAttribute {
   // to attribute entry indices.
   void SetIdentityMapping() {
     identity_mapping_ = true;
-    indices_map_.clear();
+    indices_map_ = nullptr;
   }
   // This function sets the mapping to be explicitly using the indices_map_
   // array that needs to be initialized by the caller.
   void SetExplicitMapping(size_t num_points) {
     identity_mapping_ = false;
-    indices_map_.resize(num_points, kInvalidAttributeValueIndex);
+    MakeIndicesMapUnique();
+    indices_map_->resize(num_points, kInvalidAttributeValueIndex);
   }
 
   // Set an explicit map entry for a specific point index.
   void SetPointMapEntry(PointIndex point_index,
                         AttributeValueIndex entry_index) {
     DRACO_DCHECK(!identity_mapping_);
-    indices_map_[point_index] = entry_index;
+    if (indices_map_.use_count() != 1) {
+      MakeIndicesMapUnique();
+    }
+    (*indices_map_)[point_index] = entry_index;
+  }
+
+  // Makes |this| attribute use the same mapping between point ids and
+  // attribute values as |src_att|. Explicit mappings are not copied but shared
+  // between the attributes until one of them is modified, which saves one
+  // index per point for every attribute decoded with the same mapping.
+  void ShareMappingFrom(const PointAttribute &src_att) {
+    identity_mapping_ = src_att.identity_mapping_;
+    indices_map_ = src_att.indices_map_;
+  }
+
+  // Returns true when |this| and |att| share the same explicit mapping (see
+  // ShareMappingFrom()). Attributes with equal but separately stored mappings
+  // are not detected.
+  bool SharesMappingWith(const PointAttribute &att) const {
+    return !identity_mapping_ && !att.identity_mapping_ &&
+           indices_map_ != nullptr && indices_map_ == att.indices_map_;
   }
 
   // Same as GeometryAttribute::GetValue(), but using point id as the input.
@@ -109,6 +159,66 @@ class PointAttribute : public GeometryAttribute {
     return GetValue(mapped_index(point_index), out_data);
   }
 
+  // Converts the values of the first |num_points| points to OutT and stores
+  // them into |out_values|. Each output entry stores |out_num_components|
+  // values and consecutive entries are |out_byte_stride| bytes apart. Values of
+  // attributes with identity mapping are converted at once (see
+  // GeometryAttribute::ConvertValues()). Otherwise each attribute value is
+  // converted once and copied to all points that are mapped to it.
+  // Returns false when the conversion failed.
+  template <typename OutT>
+  bool ConvertAllValues(PointIndex::ValueType num_points,
+                        int8_t out_num_components, OutT *out_values,
+                        int64_t out_byte_stride) const {
+    if (is_mapping_identity()) {
+      if (num_points > size()) {
+        return false;
+      }
+      return ConvertValues(AttributeValueIndex(0), num_points,
+                           out_num_components, out_values, out_byte_stride);
+    }
+    if (out_values == nullptr || num_points > indices_map_size()) {
+      return false;
+    }
+    const int64_t entry_size = sizeof(OutT) * out_num_components;
+    std::vector<OutT> converted_values(size() * out_num_components);
+    if (!ConvertValues(AttributeValueIndex(0), size(), out_num_components,
+                       converted_values.data(), entry_size)) {
+      // Some of the values may not be used by any point, so the points are
+      // converted one by one to get the same result as ConvertValue().
+      uint8_t *out_address = reinterpret_cast<uint8_t *>(out_values);
+      for (PointIndex pi(0); pi < num_points; ++pi) {
+        if (!ConvertValues(mapped_index(pi), 1, out_num_components,
+                           reinterpret_cast<OutT *>(out_address),
+                           entry_size)) {
+          return false;
+        }
+        out_address += out_byte_stride;
+      }
+      return true;
+    }
+    const uint8_t *const src_data =
+        reinterpret_cast<const uint8_t *>(converted_values.data());
+    uint8_t *out_address = reinterpret_cast<uint8_t *>(out_values);
+    for (PointIndex pi(0); pi < num_points; ++pi) {
+      const AttributeValueIndex avi = mapped_index(pi);
+      if (avi.value() >= size()) {
+        return false;
+      }
+      memcpy(out_address, src_data + avi.value() * entry_size, entry_size);
+      out_address += out_byte_stride;
+    }
+    return true;
+  }
+
+  // Computes the minimum and maximum of each component over all attribute
+  // values. The values are processed in parallel on |pool| (can be nullptr).
+  // Returns false when any of the values is NaN. The result is cached and
+  // reused until the attribute values are modified (see
+  // DataBuffer::IsModified()).
+  bool ComputeValueRange(ThreadPool *pool, std::vector<float> *min_values,
+                         std::vector<float> *max_values) const;
+
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
   // Deduplicate |in_att| values into |this| attribute. |in_att| can be equal
   // to |this|.
@@ -120,6 +230,12 @@ class PointAttribute : public GeometryAttribute {
   // provided offset |in_att_offset|.
   AttributeValueIndex::ValueType DeduplicateValues(
       const GeometryAttribute &in_att, AttributeValueIndex in_att_offset);
+
+  // Same as above but duplicates are searched for in parallel using |pool|.
+  // The result is the same as when no |pool| is used.
+  AttributeValueIndex::ValueType DeduplicateValues(
+      const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+      ThreadPool *pool);
 #endif
 
   // Set attribute transform data for the attribute. The data is used to store
@@ -133,6 +249,14 @@ class PointAttribute : public GeometryAttribute {
     return attribute_transform_data_.get();
   }
 
+  // Returns the number of bytes allocated for the attribute values and for
+  // the explicit mapping between points and values.
+  MemoryFootprint MemoryUsage() const;
+
+  // Releases unused capacity of the attribute values and of the mapping.
+  // Storage shared with other attributes is left untouched.
+  void ShrinkToFit();
+
 #ifdef DRACO_TRANSCODER_SUPPORTED
   // Removes unused values from the attribute. Value is unused when no point
   // is mapped to the value. Only applicable when the mapping is not identity.
@@ -140,21 +264,33 @@ class PointAttribute : public GeometryAttribute {
 #endif
 
  private:
+  // Shared implementation of Reset() and ResetUninitialized().
+  bool ResetStorage(size_t num_attribute_values, bool initialize_values);
+
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
   template <typename T>
   AttributeValueIndex::ValueType DeduplicateTypedValues(
-      const GeometryAttribute &in_att, AttributeValueIndex in_att_offset);
+      const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+      ThreadPool *pool);
   template <typename T, int COMPONENTS_COUNT>
   AttributeValueIndex::ValueType DeduplicateFormattedValues(
-      const GeometryAttribute &in_att, AttributeValueIndex in_att_offset);
+      const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+      ThreadPool *pool);
 #endif
 
   // Data storage for attribute values. GeometryAttribute itself doesn't own its
   // buffer so we need to allocate it here.
   std::unique_ptr<DataBuffer> attribute_buffer_;
 
-  // Mapping between point ids and attribute value ids.
-  IndexTypeVector<PointIndex, AttributeValueIndex> indices_map_;
+  // Makes sure that |indices_map_| exists and that it is not shared with any
+  // other attribute before it is modified.
+  void MakeIndicesMapUnique();
+
+  // Mapping between point ids and attribute value ids. The mapping may be
+  // shared with other attributes (see ShareMappingFrom()) and it is copied
+  // when it is modified.
+  std::shared_ptr<IndexTypeVector<PointIndex, AttributeValueIndex>>
+      indices_map_;
   AttributeValueIndex::ValueType num_unique_entries_;
   // Flag when the mapping between point ids and attribute values is identity.
   bool identity_mapping_;
@@ -164,6 +300,17 @@ class PointAttribute : public GeometryAttribute {
   // its original format.
   std::unique_ptr<AttributeTransformData> attribute_transform_data_;
 
+  // Result of ComputeValueRange() for the current attribute values.
+  struct ValueRange {
+    size_t num_values;
+    bool is_valid;
+    std::vector<float> min_values;
+    std::vector<float> max_values;
+  };
+  // Accessed atomically because ComputeValueRange() may be called from
+  // multiple threads.
+  mutable std::shared_ptr<const ValueRange> value_range_;
+
   friend struct PointAttributeHasher;
 };
 
@@ -174,17 +321,19 @@ struct PointAttributeHasher {
     size_t hash = base_hasher(attribute);
     hash = HashCombine(attribute.identity_mapping_, hash);
     hash = HashCombine(attribute.num_unique_entries_, hash);
-    hash = HashCombine(attribute.indices_map_.size(), hash);
-    if (!attribute.indices_map_.empty()) {
+    const size_t indices_map_size =
+        attribute.indices_map_ == nullptr ? 0 : attribute.indices_map_->size();
+    hash = HashCombine(indices_map_size, hash);
+    if (indices_map_size > 0) {
       const uint64_t indices_hash = FingerprintString(
-          reinterpret_cast<const char *>(attribute.indices_map_.data()),
-          attribute.indices_map_.size());
+          reinterpret_cast<const char *>(attribute.indices_map_->data()),
+          indices_map_size);
       hash = HashCombine(indices_hash, hash);
     }
     if (attribute.attribute_buffer_ != nullptr) {
+      const DataBuffer &buffer = *attribute.attribute_buffer_;
       const uint64_t buffer_hash = FingerprintString(
-          reinterpret_cast<const char *>(attribute.attribute_buffer_->data()),
-          attribute.attribute_buffer_->data_size());
+          reinterpret_cast<const char *>(buffer.data()), buffer.data_size());
       hash = HashCombine(buffer_hash, hash);
     }
     return hash;
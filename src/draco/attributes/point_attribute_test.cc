@@ -14,6 +14,9 @@
 //
 #include "draco/attributes/point_attribute.h"
 
+#include <limits>
+#include <vector>
+
 #include "draco/core/draco_test_base.h"
 
 namespace {
@@ -51,6 +54,33 @@ TEST_F(PointAttributeTest, TestCopy) {
   }
 }
 
+TEST_F(PointAttributeTest, TestCopyOnWrite) {
+  // This test verifies that copied attributes share their values until one of
+  // them is modified.
+  draco::PointAttribute pa;
+  pa.Init(draco::GeometryAttribute::POSITION, 1, draco::DT_INT32, false, 10);
+  for (int32_t i = 0; i < 10; ++i) {
+    pa.SetAttributeValue(draco::AttributeValueIndex(i), &i);
+  }
+
+  draco::PointAttribute other_pa;
+  other_pa.CopyFrom(pa);
+  const draco::PointAttribute &const_other_pa = other_pa;
+  ASSERT_EQ(const_other_pa.GetAddress(draco::AttributeValueIndex(0)),
+            static_cast<const draco::PointAttribute &>(pa).GetAddress(
+                draco::AttributeValueIndex(0)));
+
+  const int32_t value = 42;
+  other_pa.SetAttributeValue(draco::AttributeValueIndex(3), &value);
+  int32_t data;
+  pa.GetValue(draco::AttributeValueIndex(3), &data);
+  ASSERT_EQ(data, 3);
+  other_pa.GetValue(draco::AttributeValueIndex(3), &data);
+  ASSERT_EQ(data, 42);
+  other_pa.GetValue(draco::AttributeValueIndex(4), &data);
+  ASSERT_EQ(data, 4);
+}
+
 TEST_F(PointAttributeTest, TestGetValueFloat) {
   draco::PointAttribute pa;
   pa.Init(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32, false, 5);
@@ -125,4 +155,123 @@ TEST_F(PointAttributeTest, TestResize) {
   ASSERT_EQ(pa.buffer()->data_size(), 4 * 3 * 10);
 }
 
+TEST_F(PointAttributeTest, TestComputeValueRange) {
+  // Tests that the value range computed in parallel matches the range of the
+  // attribute values and that it is updated when the values are modified.
+  constexpr int kNumValues = 100000;
+  draco::PointAttribute pa;
+  pa.Init(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32, false,
+          kNumValues);
+  for (int i = 0; i < kNumValues; ++i) {
+    const float value[3] = {static_cast<float>(i % 1000),
+                            static_cast<float>(-i), 0.5f * (i % 7)};
+    pa.SetAttributeValue(draco::AttributeValueIndex(i), value);
+  }
+  draco::ThreadPool pool(4);
+  std::vector<float> min_values;
+  std::vector<float> max_values;
+  ASSERT_TRUE(pa.ComputeValueRange(&pool, &min_values, &max_values));
+  ASSERT_EQ(min_values, std::vector<float>({0.f, 1.f - kNumValues, 0.f}));
+  ASSERT_EQ(max_values, std::vector<float>({999.f, 0.f, 3.f}));
+
+  const float new_value[3] = {-1.f, 2.f, 3.f};
+  pa.SetAttributeValue(draco::AttributeValueIndex(kNumValues / 2), new_value);
+  ASSERT_TRUE(pa.ComputeValueRange(nullptr, &min_values, &max_values));
+  ASSERT_EQ(min_values, std::vector<float>({-1.f, 1.f - kNumValues, 0.f}));
+  ASSERT_EQ(max_values, std::vector<float>({999.f, 2.f, 3.f}));
+
+  // Values that are not a number have no range.
+  const float nan_value[3] = {0.f, std::numeric_limits<float>::quiet_NaN(),
+                              0.f};
+  pa.SetAttributeValue(draco::AttributeValueIndex(7), nan_value);
+  ASSERT_FALSE(pa.ComputeValueRange(&pool, &min_values, &max_values));
+}
+
+TEST_F(PointAttributeTest, TestComputeValueRangeConvertedValues) {
+  // Tests the value range of an attribute that is not stored as floats.
+  draco::PointAttribute pa;
+  pa.Init(draco::GeometryAttribute::GENERIC, 2, draco::DT_INT16, false, 10);
+  for (int16_t i = 0; i < 10; ++i) {
+    const int16_t value[2] = {static_cast<int16_t>(i - 5),
+                              static_cast<int16_t>(2 * i)};
+    pa.SetAttributeValue(draco::AttributeValueIndex(i), value);
+  }
+  std::vector<float> min_values;
+  std::vector<float> max_values;
+  ASSERT_TRUE(pa.ComputeValueRange(nullptr, &min_values, &max_values));
+  ASSERT_EQ(min_values, std::vector<float>({-5.f, 0.f}));
+  ASSERT_EQ(max_values, std::vector<float>({4.f, 18.f}));
+}
+
+TEST_F(PointAttributeTest, TestShareMapping) {
+  // Tests that a shared point mapping is copied when one of the attributes
+  // sharing it is modified.
+  draco::PointAttribute pa0;
+  pa0.Init(draco::GeometryAttribute::POSITION, 1, draco::DT_UINT8, false, 2);
+  pa0.SetExplicitMapping(4);
+  for (draco::PointIndex i(0); i < 4; ++i) {
+    pa0.SetPointMapEntry(i, draco::AttributeValueIndex(i.value() / 2));
+  }
+  draco::PointAttribute pa1;
+  pa1.Init(draco::GeometryAttribute::GENERIC, 1, draco::DT_UINT8, false, 2);
+  ASSERT_FALSE(pa1.SharesMappingWith(pa0));
+  pa1.ShareMappingFrom(pa0);
+  ASSERT_TRUE(pa1.SharesMappingWith(pa0));
+  ASSERT_FALSE(pa1.is_mapping_identity());
+  ASSERT_EQ(pa1.indices_map_size(), 4);
+  ASSERT_EQ(pa1.mapped_index(draco::PointIndex(3)),
+            draco::AttributeValueIndex(1));
+
+  pa1.SetPointMapEntry(draco::PointIndex(3), draco::AttributeValueIndex(0));
+  ASSERT_FALSE(pa1.SharesMappingWith(pa0));
+  ASSERT_EQ(pa1.mapped_index(draco::PointIndex(3)),
+            draco::AttributeValueIndex(0));
+  ASSERT_EQ(pa0.mapped_index(draco::PointIndex(3)),
+            draco::AttributeValueIndex(1));
+}
+
+TEST_F(PointAttributeTest, TestConvertAllValues) {
+  // Tests that bulk conversion of mapped values matches ConvertValue().
+  draco::PointAttribute pa;
+  pa.Init(draco::GeometryAttribute::COLOR, 3, draco::DT_UINT8, true, 4);
+  for (uint8_t i = 0; i < 4; ++i) {
+    const uint8_t value[3] = {static_cast<uint8_t>(50 * i), 255, i};
+    pa.SetAttributeValue(draco::AttributeValueIndex(i), value);
+  }
+  constexpr int kNumPoints = 4;
+
+  // Identity mapping with an interleaved output of four components.
+  std::vector<float> interleaved(kNumPoints * 5, -1.f);
+  ASSERT_TRUE(pa.ConvertAllValues<float>(kNumPoints, 4, interleaved.data(),
+                                         5 * sizeof(float)));
+  for (draco::PointIndex pi(0); pi < kNumPoints; ++pi) {
+    float expected[4];
+    ASSERT_TRUE(pa.ConvertValue<float>(pa.mapped_index(pi), 4, expected));
+    for (int c = 0; c < 4; ++c) {
+      ASSERT_EQ(interleaved[5 * pi.value() + c], expected[c]);
+    }
+    ASSERT_EQ(interleaved[5 * pi.value() + 4], -1.f);
+  }
+
+  // Explicit mapping with values of the same type.
+  pa.SetExplicitMapping(kNumPoints);
+  for (draco::PointIndex pi(0); pi < kNumPoints; ++pi) {
+    pa.SetPointMapEntry(pi, draco::AttributeValueIndex(3 - pi.value()));
+  }
+  std::vector<uint8_t> values(kNumPoints * 3);
+  ASSERT_TRUE(pa.ConvertAllValues<uint8_t>(kNumPoints, 3, values.data(), 3));
+  for (draco::PointIndex pi(0); pi < kNumPoints; ++pi) {
+    uint8_t expected[3];
+    pa.GetMappedValue(pi, expected);
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_EQ(values[3 * pi.value() + c], expected[c]);
+    }
+  }
+
+  // Values that cannot be represented by the output type.
+  std::vector<int8_t> int8_values(kNumPoints * 3);
+  ASSERT_FALSE(
+      pa.ConvertAllValues<int8_t>(kNumPoints, 3, int8_values.data(), 3));
+}
+
 }  // namespace
@@ -0,0 +1,238 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/attributes/attribute_quantization_selector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/attributes/normal_compression_utils.h"
+#include "draco/core/quantization_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/vector_d.h"
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include "draco/mesh/mesh_utils.h"
+#endif
+
+namespace draco {
+
+namespace {
+
+constexpr int kMinQuantizationBits = 1;
+constexpr int kMaxQuantizationBits = 30;
+constexpr int kMinNormalQuantizationBits = 2;
+constexpr int kMaxNormalQuantizationBits = 30;
+
+// Returns the smallest number of bits in [|min_bits|, |max_bits|] for which
+// |is_valid| returns true, or 0 when there is no such number. The error of
+// the quantization is expected to decrease with the number of bits.
+template <class IsValidFunctionT>
+int FindLowestValidBits(int min_bits, int max_bits,
+                        const IsValidFunctionT &is_valid) {
+  int lowest_valid_bits = 0;
+  while (min_bits <= max_bits) {
+    const int bits = min_bits + (max_bits - min_bits) / 2;
+    if (is_valid(bits)) {
+      lowest_valid_bits = bits;
+      max_bits = bits - 1;
+    } else {
+      min_bits = bits + 1;
+    }
+  }
+  return lowest_valid_bits;
+}
+
+}  // namespace
+
+StatusOr<int> AttributeQuantizationSelector::SelectQuantizationBits(
+    const PointAttribute &attribute, const float *max_errors) {
+  if (attribute.data_type() != DT_FLOAT32) {
+    return Status(Status::DRACO_ERROR, "Only float attributes are quantized.");
+  }
+  // The minimum values and the range do not depend on the number of bits.
+  AttributeQuantizationTransform transform;
+  if (!transform.ComputeParameters(attribute, kMaxQuantizationBits)) {
+    return Status(Status::DRACO_ERROR,
+                  "Failed computing quantization parameters.");
+  }
+  const int num_components = attribute.num_components();
+  std::vector<float> value(num_components);
+  const auto is_valid = [&](int bits) {
+    const int32_t max_quantized_value = (1u << bits) - 1;
+    // Every value is quantized with an error of at most half of the step.
+    const float half_step = 0.5f * transform.range() / max_quantized_value;
+    for (int c = 0; c < num_components; ++c) {
+      if (half_step > max_errors[c]) {
+        return false;
+      }
+    }
+    // Verify the bound on the actual values to account for rounding.
+    Quantizer quantizer;
+    quantizer.Init(transform.range(), max_quantized_value);
+    Dequantizer dequantizer;
+    if (!dequantizer.Init(transform.range(), max_quantized_value)) {
+      return false;
+    }
+    for (AttributeValueIndex avi(0); avi < attribute.size(); ++avi) {
+      attribute.GetValue(avi, &value[0]);
+      for (int c = 0; c < num_components; ++c) {
+        const float offset = value[c] - transform.min_value(c);
+        const float dequantized_offset =
+            dequantizer.DequantizeFloat(quantizer.QuantizeFloat(offset));
+        if (std::abs(dequantized_offset - offset) > max_errors[c]) {
+          return false;
+        }
+      }
+    }
+    return true;
+  };
+  return FindLowestValidBits(kMinQuantizationBits, kMaxQuantizationBits,
+                             is_valid);
+}
+
+StatusOr<int> AttributeQuantizationSelector::SelectNormalQuantizationBits(
+    const PointAttribute &attribute, float max_angle) {
+  if (attribute.data_type() != DT_FLOAT32 ||
+      attribute.num_components() != 3) {
+    return Status(Status::DRACO_ERROR, "Invalid normal attribute.");
+  }
+  const float min_cos_angle = std::cos(max_angle);
+  const auto is_valid = [&](int bits) {
+    OctahedronToolBox octahedron_tool_box;
+    if (!octahedron_tool_box.SetQuantizationBits(bits)) {
+      return false;
+    }
+    for (AttributeValueIndex avi(0); avi < attribute.size(); ++avi) {
+      Vector3f normal;
+      attribute.GetValue(avi, &normal[0]);
+      const float length = std::sqrt(normal.SquaredNorm());
+      if (length == 0.f) {
+        continue;
+      }
+      int32_t s, t;
+      octahedron_tool_box.FloatVectorToQuantizedOctahedralCoords(&normal[0],
+                                                                 &s, &t);
+      Vector3f dequantized_normal;
+      octahedron_tool_box.QuantizedOctahedralCoordsToUnitVector(
+          s, t, &dequantized_normal[0]);
+      if (normal.Dot(dequantized_normal) / length < min_cos_angle) {
+        return false;
+      }
+    }
+    return true;
+  };
+  return FindLowestValidBits(kMinNormalQuantizationBits,
+                             kMaxNormalQuantizationBits, is_valid);
+}
+
+StatusOr<int> AttributeQuantizationSelector::SelectAttributeBits(
+    const PointAttribute &attribute, int att_id,
+    const EncoderOptions &options) {
+  const EncoderOptionKeys &keys = GetEncoderOptionKeys();
+  const float max_error =
+      options.GetAttributeFloat(att_id, keys.max_quantization_error, 0.f);
+  if (attribute.attribute_type() == GeometryAttribute::NORMAL) {
+    return SelectNormalQuantizationBits(attribute, max_error);
+  }
+  const int num_components = attribute.num_components();
+  std::vector<float> max_errors(num_components, max_error);
+  int texture_size[2] = {0, 0};
+  if (options.GetAttributeVector(att_id,
+                                 keys.max_quantization_error_texture_size, 2,
+                                 texture_size) &&
+      texture_size[0] > 0 && texture_size[1] > 0) {
+    // Convert the error from texels to texture coordinates.
+    for (int c = 0; c < std::min(num_components, 2); ++c) {
+      max_errors[c] = max_error / texture_size[c];
+    }
+  }
+  return SelectQuantizationBits(attribute, max_errors.data());
+}
+
+Status AttributeQuantizationSelector::SelectQuantizationBits(
+    const PointCloud &pc, const Mesh *mesh, EncoderOptions *options) {
+  const EncoderOptionKeys &keys = GetEncoderOptionKeys();
+  std::vector<int> att_ids;
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    if (pc.attribute(i)->data_type() == DT_FLOAT32 &&
+        options->IsAttributeOptionSet(i, keys.max_quantization_error)) {
+      att_ids.push_back(i);
+    }
+  }
+  if (att_ids.empty()) {
+    return OkStatus();
+  }
+
+  // Search the bits of all attributes in parallel.
+  std::vector<int> bits(att_ids.size(), 0);
+  std::vector<Status> statuses(att_ids.size());
+  ParallelFor(options->thread_pool(), static_cast<int>(att_ids.size()),
+              [&](int i) {
+                StatusOr<int> bits_or =
+                    SelectAttributeBits(*pc.attribute(att_ids[i]),
+                                        att_ids[i], *options);
+                if (bits_or.ok()) {
+                  bits[i] = bits_or.value();
+                } else {
+                  statuses[i] = bits_or.status();
+                }
+              });
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status);
+  }
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+  // Texture coordinates must not introduce new degenerate faces.
+  const int pos_att_id =
+      mesh == nullptr ? -1
+                      : mesh->GetNamedAttributeId(GeometryAttribute::POSITION);
+  for (int i = 0; pos_att_id >= 0 && i < static_cast<int>(att_ids.size());
+       ++i) {
+    const PointAttribute &att = *pc.attribute(att_ids[i]);
+    if (att.attribute_type() != GeometryAttribute::TEX_COORD || bits[i] == 0 ||
+        bits[i] >= kMaxQuantizationBits) {
+      continue;
+    }
+    const auto pos_it = std::find(att_ids.begin(), att_ids.end(), pos_att_id);
+    const int pos_bits =
+        pos_it != att_ids.end()
+            ? bits[pos_it - att_ids.begin()]
+            : options->GetAttributeInt(pos_att_id, keys.quantization_bits, 0);
+    if (pos_bits <= 0) {
+      continue;
+    }
+    DRACO_ASSIGN_OR_RETURN(const int tex_bits,
+                           MeshUtils::FindLowestTextureQuantization(
+                               *mesh, *mesh->attribute(pos_att_id), pos_bits,
+                               att, bits[i]));
+    if (tex_bits > 0) {
+      bits[i] = tex_bits;
+    }
+  }
+#else
+  // The mesh is only needed for the texture coordinate check above.
+  (void)mesh;
+#endif  // DRACO_TRANSCODER_SUPPORTED
+
+  for (int i = 0; i < static_cast<int>(att_ids.size()); ++i) {
+    // Attributes are not quantized when no number of bits meets the bounds.
+    options->SetAttributeInt(att_ids[i], keys.quantization_bits,
+                             bits[i] > 0 ? bits[i] : -1);
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
@@ -0,0 +1,74 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_ATTRIBUTE_QUANTIZATION_SELECTOR_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_ATTRIBUTE_QUANTIZATION_SELECTOR_H_
+
+#include "draco/attributes/point_attribute.h"
+#include "draco/compression/config/encoder_options.h"
+#include "draco/core/status.h"
+#include "draco/core/status_or.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Selects the smallest number of quantization bits of attributes that keeps
+// the quantization error within given bounds, so that the bits do not need
+// to be picked by hand.
+//
+// The bounds are set by the "max_quantization_error" attribute option of the
+// encoder. Positions, texture coordinates and generic attributes use the
+// maximum absolute error of each component. When the attribute also has the
+// "max_quantization_error_texture_size" option with the width and the height
+// of a texture, the error of texture coordinates is given in texels instead.
+// Normals use the maximum angle in radians between the original and the
+// quantized normal.
+class AttributeQuantizationSelector {
+ public:
+  // Returns the smallest number of quantization bits for which the difference
+  // between the original and the dequantized values of |attribute| is at most
+  // |max_errors[c]| for each component c. The quantization parameters are the
+  // same as the ones computed by AttributeQuantizationTransform. Returns 0
+  // when no supported number of bits meets the bounds.
+  static StatusOr<int> SelectQuantizationBits(const PointAttribute &attribute,
+                                              const float *max_errors);
+
+  // Returns the smallest number of octahedral quantization bits for which the
+  // angle between the original and the dequantized normals of |attribute| is
+  // at most |max_angle| radians. Returns 0 when no supported number of bits
+  // meets the bound.
+  static StatusOr<int> SelectNormalQuantizationBits(
+      const PointAttribute &attribute, float max_angle);
+
+  // Sets the "quantization_bits" option of all float attributes of |pc| that
+  // have the "max_quantization_error" option in |options|. Attributes are
+  // processed in parallel on the thread pool of |options|. Attributes whose
+  // bounds cannot be met by any number of bits are left unquantized.
+  //
+  // When |mesh| is not nullptr, the bits of texture coordinates are increased
+  // when needed to avoid new degenerate faces in texture space (see
+  // MeshUtils::FindLowestTextureQuantization(), transcoder builds only).
+  static Status SelectQuantizationBits(const PointCloud &pc, const Mesh *mesh,
+                                       EncoderOptions *options);
+
+ private:
+  // Selects the bits of |attribute| with id |att_id| using its options.
+  static StatusOr<int> SelectAttributeBits(const PointAttribute &attribute,
+                                           int att_id,
+                                           const EncoderOptions &options);
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_ATTRIBUTE_QUANTIZATION_SELECTOR_H_
@@ -0,0 +1,129 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/attributes/attribute_quantization_selector.h"
+
+#include <cmath>
+#include <memory>
+
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/vector_d.h"
+
+namespace draco {
+
+class AttributeQuantizationSelectorTest : public ::testing::Test {
+ protected:
+  // Creates a float attribute with |num_values| values evenly spread over
+  // [0, 1] in the first component and over [0, 2] in the second one.
+  std::unique_ptr<PointAttribute> CreateAttribute(int num_values) {
+    std::unique_ptr<PointAttribute> att(new PointAttribute());
+    att->Init(GeometryAttribute::GENERIC, 2, DT_FLOAT32, false, num_values);
+    for (AttributeValueIndex avi(0); avi < num_values; ++avi) {
+      const float x = static_cast<float>(avi.value()) / (num_values - 1);
+      const float value[2] = {x, 2.f * x};
+      att->SetAttributeValue(avi, value);
+    }
+    return att;
+  }
+};
+
+TEST_F(AttributeQuantizationSelectorTest, TestSelectQuantizationBits) {
+  const std::unique_ptr<PointAttribute> att = CreateAttribute(1000);
+  // The range of the quantization is 2, i.e., n bits result in an error of at
+  // most 1 / (2^n - 1).
+  const float max_errors[2] = {0.01f, 0.01f};
+  DRACO_ASSIGN_OR_ASSERT(
+      const int bits,
+      AttributeQuantizationSelector::SelectQuantizationBits(*att, max_errors));
+  ASSERT_EQ(bits, 7);
+
+  // A looser bound for the first component does not change the result.
+  const float mixed_max_errors[2] = {0.1f, 0.01f};
+  DRACO_ASSIGN_OR_ASSERT(const int mixed_bits,
+                         AttributeQuantizationSelector::SelectQuantizationBits(
+                             *att, mixed_max_errors));
+  ASSERT_EQ(mixed_bits, 7);
+
+  // Bounds below the precision of floats cannot be met.
+  const float tiny_max_errors[2] = {1e-12f, 1e-12f};
+  DRACO_ASSIGN_OR_ASSERT(const int tiny_bits,
+                         AttributeQuantizationSelector::SelectQuantizationBits(
+                             *att, tiny_max_errors));
+  ASSERT_EQ(tiny_bits, 0);
+}
+
+TEST_F(AttributeQuantizationSelectorTest, TestSelectNormalQuantizationBits) {
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("test_nm.obj");
+  ASSERT_NE(mesh, nullptr);
+  const PointAttribute *const normal_att =
+      mesh->GetNamedAttribute(GeometryAttribute::NORMAL);
+  ASSERT_NE(normal_att, nullptr);
+  int prev_bits = 0;
+  for (const float max_angle : {0.1f, 0.01f, 0.001f}) {
+    DRACO_ASSIGN_OR_ASSERT(
+        const int bits,
+        AttributeQuantizationSelector::SelectNormalQuantizationBits(
+            *normal_att, max_angle));
+    ASSERT_GT(bits, prev_bits);
+    prev_bits = bits;
+  }
+}
+
+TEST_F(AttributeQuantizationSelectorTest, TestEncodeWithMaxError) {
+  // Tests that the decoded positions are within the requested error.
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("test_nm.obj");
+  ASSERT_NE(mesh, nullptr);
+  const PointAttribute *const pos_att =
+      mesh->GetNamedAttribute(GeometryAttribute::POSITION);
+  for (const float max_error : {0.1f, 0.001f}) {
+    Encoder encoder;
+    encoder.SetEncodingMethod(MESH_SEQUENTIAL_ENCODING);
+    encoder.SetAttributeMaxQuantizationError(GeometryAttribute::POSITION,
+                                             max_error);
+    encoder.SetAttributeMaxQuantizationError(GeometryAttribute::NORMAL,
+                                             0.01f);
+    EncoderBuffer buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &buffer));
+
+    DecoderBuffer dec_buffer;
+    dec_buffer.Init(buffer.data(), buffer.size());
+    Decoder decoder;
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Mesh> decoded_mesh,
+                           decoder.DecodeMeshFromBuffer(&dec_buffer));
+    ASSERT_EQ(decoded_mesh->num_faces(), mesh->num_faces());
+    const PointAttribute *const decoded_pos_att =
+        decoded_mesh->GetNamedAttribute(GeometryAttribute::POSITION);
+    float max_decoded_error = 0.f;
+    for (FaceIndex f(0); f < mesh->num_faces(); ++f) {
+      for (int c = 0; c < 3; ++c) {
+        Vector3f pos, decoded_pos;
+        pos_att->GetMappedValue(mesh->face(f)[c], &pos[0]);
+        decoded_pos_att->GetMappedValue(decoded_mesh->face(f)[c],
+                                        &decoded_pos[0]);
+        for (int i = 0; i < 3; ++i) {
+          max_decoded_error =
+              std::max(max_decoded_error, std::abs(pos[i] - decoded_pos[i]));
+        }
+      }
+    }
+    ASSERT_LE(max_decoded_error, max_error);
+    // The error bound is not met with much higher precision than needed.
+    ASSERT_GT(max_decoded_error, 0.1f * max_error);
+  }
+}
+
+}  // namespace draco
@@ -14,15 +14,27 @@
 //
 #include "draco/compression/attributes/kd_tree_attributes_decoder.h"
 
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
 #include "draco/compression/attributes/kd_tree_attributes_shared.h"
 #include "draco/compression/point_cloud/algorithms/dynamic_integer_points_kd_tree_decoder.h"
 #include "draco/compression/point_cloud/algorithms/float_points_tree_decoder.h"
 #include "draco/compression/point_cloud/point_cloud_decoder.h"
 #include "draco/core/draco_types.h"
+#include "draco/core/thread_pool.h"
 #include "draco/core/varint_decoding.h"
 
 namespace draco {
 
+namespace {
+// Number of values converted by a single task of a parallel transform to the
+// original signed format.
+constexpr int64_t kSignedTransformChunkSize = 1 << 15;
+}  // namespace
+
 // attribute, offset_dimensionality, data_type, data_size, num_components
 using AttributeTuple =
     std::tuple<PointAttribute *, uint32_t, DataType, uint32_t, uint32_t>;
@@ -129,7 +141,133 @@ class PointAttributeVectorOutputIterator {
       PointAttributeVectorOutputIterator const &) = delete;
 };
 
-KdTreeAttributesDecoder::KdTreeAttributesDecoder() {}
+// Copies |num_components| decoded values from |src| to |dst| while narrowing
+// them to |data_size_t| bytes.
+template <int data_size_t>
+inline void ScatterComponents(const uint32_t *src, uint32_t num_components,
+                              uint8_t *dst) {
+  if (data_size_t == 4) {
+    memcpy(dst, src, sizeof(uint32_t) * num_components);
+    return;
+  }
+  typedef typename std::conditional<data_size_t == 1, uint8_t, uint16_t>::type
+      ComponentType;
+  for (uint32_t c = 0; c < num_components; ++c) {
+    const ComponentType value = static_cast<ComponentType>(src[c]);
+    memcpy(dst + c * data_size_t, &value, data_size_t);
+  }
+}
+
+// Output iterator that scatters the decoded points directly into the data
+// buffers of the attributes. All attributes have identity mapping, so the
+// destination of each attribute value is computed from a precomputed base
+// address and stride without any per-point mapping or staging buffer.
+// When |data_size0_t| and |num_components0_t| (and optionally |data_size1_t|
+// and |num_components1_t|) are non-zero, they describe the first (and second)
+// attribute of a common layout such as 3 x uint32 positions followed by
+// 3 x uint8 colors and the scatter is fully resolved at compile time.
+// Otherwise, all attributes are scattered using their runtime layout.
+template <int data_size0_t = 0, int num_components0_t = 0,
+          int data_size1_t = 0, int num_components1_t = 0>
+class PointAttributeScatterOutputIterator {
+  typedef PointAttributeScatterOutputIterator<data_size0_t, num_components0_t,
+                                              data_size1_t, num_components1_t>
+      Self;
+
+ public:
+  PointAttributeScatterOutputIterator(
+      PointAttributeScatterOutputIterator &&that) = default;
+
+  PointAttributeScatterOutputIterator(const std::vector<AttributeTuple> &atts,
+                                      uint32_t num_points)
+      : num_points_(num_points), point_id_(0) {
+    for (const AttributeTuple &att : atts) {
+      PointAttribute *const attribute = std::get<0>(att);
+      outputs_.push_back({attribute->GetAddress(AttributeValueIndex(0)),
+                          attribute->byte_stride(), std::get<1>(att),
+                          std::get<3>(att), std::get<4>(att)});
+    }
+  }
+
+  // Returns true when the first attributes of |atts| match the compile-time
+  // layout of this iterator.
+  static bool IsLayoutSupported(const std::vector<AttributeTuple> &atts) {
+    const size_t num_fixed_atts = data_size1_t > 0 ? 2 : 1;
+    if (atts.size() != num_fixed_atts) {
+      return false;
+    }
+    return std::get<3>(atts[0]) == data_size0_t &&
+           std::get<4>(atts[0]) == num_components0_t &&
+           (data_size1_t == 0 || (std::get<3>(atts[1]) == data_size1_t &&
+                                  std::get<4>(atts[1]) == num_components1_t));
+  }
+
+  const Self &operator++() {
+    ++point_id_;
+    return *this;
+  }
+
+  Self &operator*() { return *this; }
+
+  const Self &operator=(const std::vector<uint32_t> &val) {
+    if (point_id_ >= num_points_) {
+      return *this;
+    }
+    if (data_size0_t > 0) {
+      Scatter<data_size0_t>(val.data(), num_components0_t, outputs_[0]);
+      if (data_size1_t > 0) {
+        Scatter<data_size1_t>(val.data(), num_components1_t, outputs_[1]);
+      }
+      return *this;
+    }
+    for (const AttributeOutput &output : outputs_) {
+      switch (output.data_size) {
+        case 1:
+          Scatter<1>(val.data(), output.num_components, output);
+          break;
+        case 2:
+          Scatter<2>(val.data(), output.num_components, output);
+          break;
+        default:
+          Scatter<4>(val.data(), output.num_components, output);
+          break;
+      }
+    }
+    return *this;
+  }
+
+ private:
+  struct AttributeOutput {
+    // Address of the first attribute value.
+    uint8_t *data;
+    int64_t byte_stride;
+    // Offset of the attribute components in the decoded points.
+    uint32_t offset;
+    uint32_t data_size;
+    uint32_t num_components;
+  };
+
+  template <int data_size_t>
+  void Scatter(const uint32_t *point, uint32_t num_components,
+               const AttributeOutput &output) const {
+    ScatterComponents<data_size_t>(
+        point + output.offset, num_components,
+        output.data + point_id_ * output.byte_stride);
+  }
+
+  std::vector<AttributeOutput> outputs_;
+  uint32_t num_points_;
+  uint32_t point_id_;
+
+  // NO COPY
+  PointAttributeScatterOutputIterator(
+      const PointAttributeScatterOutputIterator &that) = delete;
+  PointAttributeScatterOutputIterator &operator=(
+      PointAttributeScatterOutputIterator const &) = delete;
+};
+
+KdTreeAttributesDecoder::KdTreeAttributesDecoder()
+    : level_order_(false), partitioned_(false), num_decoded_points_(0) {}
 
 bool KdTreeAttributesDecoder::DecodePortableAttributes(
     DecoderBuffer *in_buffer) {
@@ -142,6 +280,9 @@ bool KdTreeAttributesDecoder::DecodePortableAttributes(
   if (!in_buffer->Decode(&compression_level)) {
     return false;
   }
+  level_order_ = (compression_level & kKdTreeLevelOrderFlag) != 0;
+  partitioned_ = (compression_level & kKdTreePartitionedFlag) != 0;
+  compression_level &= ~(kKdTreeLevelOrderFlag | kKdTreePartitionedFlag);
   const int32_t num_points = GetDecoder()->point_cloud()->num_points();
 
   // Decode data using the kd tree decoding into integer (portable) attributes.
@@ -198,63 +339,79 @@ bool KdTreeAttributesDecoder::DecodePortableAttributes(
                               data_size, num_components);
     total_dimensionality += num_components;
   }
-  typedef PointAttributeVectorOutputIterator<uint32_t> OutIt;
-  OutIt out_it(atts);
-
-  switch (compression_level) {
-    case 0: {
-      if (!DecodePoints<0, OutIt>(total_dimensionality, num_points, in_buffer,
-                                  &out_it)) {
-        return false;
-      }
-      break;
-    }
-    case 1: {
-      if (!DecodePoints<1, OutIt>(total_dimensionality, num_points, in_buffer,
-                                  &out_it)) {
-        return false;
-      }
-      break;
-    }
-    case 2: {
-      if (!DecodePoints<2, OutIt>(total_dimensionality, num_points, in_buffer,
-                                  &out_it)) {
-        return false;
-      }
-      break;
-    }
-    case 3: {
-      if (!DecodePoints<3, OutIt>(total_dimensionality, num_points, in_buffer,
-                                  &out_it)) {
-        return false;
-      }
-      break;
-    }
-    case 4: {
-      if (!DecodePoints<4, OutIt>(total_dimensionality, num_points, in_buffer,
-                                  &out_it)) {
-        return false;
-      }
-      break;
-    }
-    case 5: {
-      if (!DecodePoints<5, OutIt>(total_dimensionality, num_points, in_buffer,
-                                  &out_it)) {
-        return false;
-      }
-      break;
+  // Use unrolled scatter kernels for the most common layouts, i.e., quantized
+  // positions optionally followed by 8-bit colors.
+  typedef PointAttributeScatterOutputIterator<4, 3> PositionsOutIt;
+  typedef PointAttributeScatterOutputIterator<4, 3, 1, 3> PositionsRgbOutIt;
+  typedef PointAttributeScatterOutputIterator<4, 3, 1, 4> PositionsRgbaOutIt;
+  typedef PointAttributeScatterOutputIterator<> OutIt;
+  bool decoded = false;
+  if (PositionsOutIt::IsLayoutSupported(atts)) {
+    PositionsOutIt out_it(atts, num_points);
+    decoded = DecodePointsAtLevel(compression_level, total_dimensionality,
+                                  num_points, in_buffer, &out_it);
+  } else if (PositionsRgbOutIt::IsLayoutSupported(atts)) {
+    PositionsRgbOutIt out_it(atts, num_points);
+    decoded = DecodePointsAtLevel(compression_level, total_dimensionality,
+                                  num_points, in_buffer, &out_it);
+  } else if (PositionsRgbaOutIt::IsLayoutSupported(atts)) {
+    PositionsRgbaOutIt out_it(atts, num_points);
+    decoded = DecodePointsAtLevel(compression_level, total_dimensionality,
+                                  num_points, in_buffer, &out_it);
+  } else {
+    OutIt out_it(atts, num_points);
+    decoded = DecodePointsAtLevel(compression_level, total_dimensionality,
+                                  num_points, in_buffer, &out_it);
+  }
+  if (!decoded) {
+    return false;
+  }
+  if (num_decoded_points_ < num_points) {
+    // Only the first levels of the tree were decoded.
+    GetDecoder()->point_cloud()->set_num_points(num_decoded_points_);
+    for (int i = 0; i < GetNumAttributes(); ++i) {
+      const int att_id = GetAttributeId(i);
+      GetDecoder()->point_cloud()->attribute(att_id)->Reset(
+          num_decoded_points_);
     }
-    case 6: {
-      if (!DecodePoints<6, OutIt>(total_dimensionality, num_points, in_buffer,
-                                  &out_it)) {
-        return false;
-      }
-      break;
+    for (const auto &port_att : quantized_portable_attributes_) {
+      port_att->Reset(num_decoded_points_);
     }
+  }
+  return true;
+}
+
+template <typename OutIteratorT>
+bool KdTreeAttributesDecoder::DecodePointsAtLevel(int compression_level,
+                                                  int total_dimensionality,
+                                                  int num_expected_points,
+                                                  DecoderBuffer *in_buffer,
+                                                  OutIteratorT *out_iterator) {
+  switch (compression_level) {
+    case 0:
+      return DecodePoints<0>(total_dimensionality, num_expected_points,
+                             in_buffer, out_iterator);
+    case 1:
+      return DecodePoints<1>(total_dimensionality, num_expected_points,
+                             in_buffer, out_iterator);
+    case 2:
+      return DecodePoints<2>(total_dimensionality, num_expected_points,
+                             in_buffer, out_iterator);
+    case 3:
+      return DecodePoints<3>(total_dimensionality, num_expected_points,
+                             in_buffer, out_iterator);
+    case 4:
+      return DecodePoints<4>(total_dimensionality, num_expected_points,
+                             in_buffer, out_iterator);
+    case 5:
+      return DecodePoints<5>(total_dimensionality, num_expected_points,
+                             in_buffer, out_iterator);
+    case 6:
+      return DecodePoints<6>(total_dimensionality, num_expected_points,
+                             in_buffer, out_iterator);
     default:
       return false;
   }
-  return true;
 }
 
 template <int level_t, typename OutIteratorT>
@@ -263,8 +420,20 @@ bool KdTreeAttributesDecoder::DecodePoints(int total_dimensionality,
                                            DecoderBuffer *in_buffer,
                                            OutIteratorT *out_iterator) {
   DynamicIntegerPointsKdTreeDecoder<level_t> decoder(total_dimensionality);
+  decoder.set_level_order(level_order_);
+  decoder.set_partitioned(partitioned_);
+  const int max_decoded_levels = GetDecoder()->options()->GetGlobalInt(
+      GetDecoderOptionKeys().kd_tree_max_decoded_levels, -1);
+  if (level_order_ && max_decoded_levels >= 0) {
+    decoder.set_max_decoded_levels(max_decoded_levels);
+  }
   if (!decoder.DecodePoints(in_buffer, *out_iterator, num_expected_points) ||
-      decoder.num_decoded_points() != num_expected_points) {
+      decoder.num_points() != num_expected_points) {
+    return false;
+  }
+  num_decoded_points_ = decoder.num_decoded_points();
+  if (num_decoded_points_ > num_expected_points ||
+      (!decoder.level_order() && num_decoded_points_ != num_expected_points)) {
     return false;
   }
   return true;
@@ -368,6 +537,9 @@ bool KdTreeAttributesDecoder::DecodeDataNeededByPortableTransforms(
     att->Reset(num_points);
     FloatPointsTreeDecoder decoder;
     decoder.set_num_points_from_header(num_points);
+    decoder.set_thread_pool(GetDecoder()->options()
+                                ? GetDecoder()->options()->thread_pool()
+                                : nullptr);
     PointAttributeVectorOutputIterator<float> out_it(atts);
     if (!decoder.DecodePointCloud(in_buffer, out_it)) {
       return false;
@@ -466,116 +638,128 @@ bool KdTreeAttributesDecoder::DecodeDataNeededByPortableTransforms(
 
 template <typename SignedDataTypeT>
 bool KdTreeAttributesDecoder::TransformAttributeBackToSignedType(
-    PointAttribute *att, int num_processed_signed_components) {
+    PointAttribute *att, int num_processed_signed_components,
+    ThreadPool *pool) {
   typedef typename std::make_unsigned<SignedDataTypeT>::type UnsignedType;
-  std::vector<UnsignedType> unsigned_val(att->num_components());
-  std::vector<SignedDataTypeT> signed_val(att->num_components());
-
-  for (AttributeValueIndex avi(0); avi < static_cast<uint32_t>(att->size());
-       ++avi) {
-    att->GetValue(avi, &unsigned_val[0]);
-    for (int c = 0; c < att->num_components(); ++c) {
-      // Up-cast |unsigned_val| to int32_t to ensure we don't overflow it for
-      // smaller data types. But first check that the up-casting does not cause
-      // signed integer overflow.
-      if (unsigned_val[c] > std::numeric_limits<int32_t>::max()) {
-        return false;
+  const int num_components = att->num_components();
+  const int32_t *const min_values =
+      min_signed_values_.data() + num_processed_signed_components;
+  const int64_t num_values = att->size();
+  const int num_chunks =
+      static_cast<int>((num_values + kSignedTransformChunkSize - 1) /
+                       kSignedTransformChunkSize);
+  // Each chunk converts a disjoint range of values in place.
+  std::vector<uint8_t> results(num_chunks, 0);
+  ParallelFor(pool, num_chunks, [&](int k) {
+    std::vector<UnsignedType> unsigned_val(num_components);
+    std::vector<SignedDataTypeT> signed_val(num_components);
+    const int64_t begin = k * kSignedTransformChunkSize;
+    const int64_t end = std::min(num_values, begin + kSignedTransformChunkSize);
+    for (AttributeValueIndex avi(static_cast<uint32_t>(begin));
+         avi < static_cast<uint32_t>(end); ++avi) {
+      att->GetValue(avi, &unsigned_val[0]);
+      for (int c = 0; c < num_components; ++c) {
+        // Up-cast |unsigned_val| to int32_t to ensure we don't overflow it for
+        // smaller data types. But first check that the up-casting does not
+        // cause signed integer overflow.
+        if (unsigned_val[c] > std::numeric_limits<int32_t>::max()) {
+          return;
+        }
+        signed_val[c] = static_cast<SignedDataTypeT>(
+            static_cast<int32_t>(unsigned_val[c]) + min_values[c]);
       }
-      signed_val[c] = static_cast<SignedDataTypeT>(
-          static_cast<int32_t>(unsigned_val[c]) +
-          min_signed_values_[num_processed_signed_components + c]);
+      att->SetAttributeValue(avi, &signed_val[0]);
     }
-    att->SetAttributeValue(avi, &signed_val[0]);
-  }
-  return true;
+    results[k] = 1;
+  });
+  return std::find(results.begin(), results.end(), 0) == results.end();
 }
 
 bool KdTreeAttributesDecoder::TransformAttributesToOriginalFormat() {
   if (quantized_portable_attributes_.empty() && min_signed_values_.empty()) {
     return true;
   }
+  ThreadPool *const pool =
+      GetDecoder()->options() ? GetDecoder()->options()->thread_pool()
+                              : nullptr;
+  // Index of the quantization transform or of the first signed component of
+  // each attribute, or -1 for attributes that need no transform.
+  std::vector<int> transform_offsets(GetNumAttributes(), -1);
   int num_processed_quantized_attributes = 0;
   int num_processed_signed_components = 0;
-  // Dequantize attributes that needed it.
   for (int i = 0; i < GetNumAttributes(); ++i) {
     const int att_id = GetAttributeId(i);
     PointAttribute *const att = GetDecoder()->point_cloud()->attribute(att_id);
     if (att->data_type() == DT_INT32 || att->data_type() == DT_INT16 ||
         att->data_type() == DT_INT8) {
-      std::vector<uint32_t> unsigned_val(att->num_components());
-      std::vector<int32_t> signed_val(att->num_components());
-      // Values are stored as unsigned in the attribute, make them signed again.
-      if (att->data_type() == DT_INT32) {
-        if (!TransformAttributeBackToSignedType<int32_t>(
-                att, num_processed_signed_components)) {
-          return false;
-        }
-      } else if (att->data_type() == DT_INT16) {
-        if (!TransformAttributeBackToSignedType<int16_t>(
-                att, num_processed_signed_components)) {
-          return false;
-        }
-      } else if (att->data_type() == DT_INT8) {
-        if (!TransformAttributeBackToSignedType<int8_t>(
-                att, num_processed_signed_components)) {
-          return false;
-        }
-      }
+      transform_offsets[i] = num_processed_signed_components;
       num_processed_signed_components += att->num_components();
     } else if (att->data_type() == DT_FLOAT32) {
-      // TODO(ostava): This code should be probably moved out to attribute
-      // transform and shared with the SequentialQuantizationAttributeDecoder.
-
-      const PointAttribute *const src_att =
-          quantized_portable_attributes_[num_processed_quantized_attributes]
-              .get();
-
-      const AttributeQuantizationTransform &transform =
-          attribute_quantization_transforms_
-              [num_processed_quantized_attributes];
-
-      num_processed_quantized_attributes++;
-
-      if (GetDecoder()->options()->GetAttributeBool(
-              att->attribute_type(), "skip_attribute_transform", false)) {
-        // Attribute transform should not be performed. In this case, we replace
-        // the output geometry attribute with the portable attribute.
-        // TODO(ostava): We can potentially avoid this copy by introducing a new
-        // mechanism that would allow to use the final attributes as portable
-        // attributes for predictors that may need them.
-        att->CopyFrom(*src_att);
-        continue;
-      }
-
-      // Convert all quantized values back to floats.
-      const int32_t max_quantized_value =
-          (1u << static_cast<uint32_t>(transform.quantization_bits())) - 1;
-      const int num_components = att->num_components();
-      const int entry_size = sizeof(float) * num_components;
-      const std::unique_ptr<float[]> att_val(new float[num_components]);
-      int quant_val_id = 0;
-      int out_byte_pos = 0;
-      Dequantizer dequantizer;
-      if (!dequantizer.Init(transform.range(), max_quantized_value)) {
-        return false;
-      }
-      const uint32_t *const portable_attribute_data =
-          reinterpret_cast<const uint32_t *>(
-              src_att->GetAddress(AttributeValueIndex(0)));
-      for (uint32_t i = 0; i < src_att->size(); ++i) {
-        for (int c = 0; c < num_components; ++c) {
-          float value = dequantizer.DequantizeFloat(
-              portable_attribute_data[quant_val_id++]);
-          value = value + transform.min_value(c);
-          att_val[c] = value;
-        }
-        // Store the floating point value into the attribute buffer.
-        att->buffer()->Write(out_byte_pos, att_val.get(), entry_size);
-        out_byte_pos += entry_size;
-      }
+      transform_offsets[i] = num_processed_quantized_attributes++;
     }
   }
-  return true;
+
+  // Transforms of individual attributes are independent of each other, so all
+  // attributes are processed concurrently and large attributes are further
+  // split into chunks on the same |pool|.
+  std::vector<uint8_t> results(GetNumAttributes(), 0);
+  ParallelFor(pool, GetNumAttributes(), [&](int i) {
+    results[i] = transform_offsets[i] < 0 ||
+                 TransformAttributeToOriginalFormat(i, transform_offsets[i],
+                                                    pool);
+  });
+  return std::find(results.begin(), results.end(), 0) == results.end();
+}
+
+bool KdTreeAttributesDecoder::TransformAttributeToOriginalFormat(
+    int i, int transform_offset, ThreadPool *pool) {
+  const int att_id = GetAttributeId(i);
+  PointAttribute *const att = GetDecoder()->point_cloud()->attribute(att_id);
+  // Values are stored as unsigned in the attribute, make them signed again.
+  if (att->data_type() == DT_INT32) {
+    return TransformAttributeBackToSignedType<int32_t>(att, transform_offset,
+                                                       pool);
+  } else if (att->data_type() == DT_INT16) {
+    return TransformAttributeBackToSignedType<int16_t>(att, transform_offset,
+                                                       pool);
+  } else if (att->data_type() == DT_INT8) {
+    return TransformAttributeBackToSignedType<int8_t>(att, transform_offset,
+                                                      pool);
+  }
+
+  // TODO(ostava): This code should be probably moved out to attribute
+  // transform and shared with the SequentialQuantizationAttributeDecoder.
+  const PointAttribute *const src_att =
+      quantized_portable_attributes_[transform_offset].get();
+  AttributeQuantizationTransform &transform =
+      attribute_quantization_transforms_[transform_offset];
+
+  const DecoderOptions *const options = GetDecoder()->options();
+  const DecoderOptionKeys &keys = GetDecoderOptionKeys();
+  if (options->GetGlobalBool(keys.decode_layout_only, false)) {
+    // Only the transform parameters are needed by Decoder::ProbeBuffer().
+    return transform.TransferToAttribute(att);
+  }
+
+  if (options->GetAttributeBool(att->attribute_type(),
+                                keys.decode_to_quantized_attribute, false) &&
+      transform.quantization_bits() <= 16) {
+    return transform.TransformToCompactAttribute(*src_att, att);
+  }
+
+  if (options->GetAttributeBool(att->attribute_type(),
+                                keys.skip_attribute_transform, false)) {
+    // Attribute transform should not be performed. In this case, we replace
+    // the output geometry attribute with the portable attribute.
+    // TODO(ostava): We can potentially avoid this copy by introducing a new
+    // mechanism that would allow to use the final attributes as portable
+    // attributes for predictors that may need them.
+    att->CopyFrom(*src_att);
+    return true;
+  }
+
+  // Convert all quantized values back to floats in parallel chunks.
+  return transform.InverseTransformAttribute(*src_att, att, pool);
 }
 
 }  // namespace draco
@@ -17,10 +17,14 @@
 
 #include "draco/attributes/attribute_quantization_transform.h"
 #include "draco/compression/attributes/attributes_decoder.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
-// Decodes attributes encoded with the KdTreeAttributesEncoder.
+// Decodes attributes encoded with the KdTreeAttributesEncoder. When the
+// attributes were encoded in level order, the global decoder option
+// "kd_tree_max_decoded_levels" can be used to decode only the given number of
+// levels of the kD-tree, resulting in a subsampled point cloud.
 class KdTreeAttributesDecoder : public AttributesDecoder {
  public:
   KdTreeAttributesDecoder();
@@ -31,18 +35,40 @@ class KdTreeAttributesDecoder : public AttributesDecoder {
   bool TransformAttributesToOriginalFormat() override;
 
  private:
+  // Decodes the points with the kD-tree decoder of |compression_level|.
+  template <typename OutIteratorT>
+  bool DecodePointsAtLevel(int compression_level, int total_dimensionality,
+                           int num_expected_points, DecoderBuffer *in_buffer,
+                           OutIteratorT *out_iterator);
+
   template <int level_t, typename OutIteratorT>
   bool DecodePoints(int total_dimensionality, int num_expected_points,
                     DecoderBuffer *in_buffer, OutIteratorT *out_iterator);
 
+  // Transforms the |i|-th attribute to its original format. |transform_offset|
+  // is the index of its quantization transform for float attributes and the
+  // index of its first component in |min_signed_values_| for signed integer
+  // attributes. Large attributes are processed in chunks on |pool| (can be
+  // nullptr).
+  bool TransformAttributeToOriginalFormat(int i, int transform_offset,
+                                          ThreadPool *pool);
+
+  // Converts the values of |att| back to signed values. The values are
+  // processed in independent chunks on |pool| (can be nullptr).
   template <typename SignedDataTypeT>
   bool TransformAttributeBackToSignedType(PointAttribute *att,
-                                          int num_processed_signed_components);
+                                          int num_processed_signed_components,
+                                          ThreadPool *pool);
 
   std::vector<AttributeQuantizationTransform>
       attribute_quantization_transforms_;
   std::vector<int32_t> min_signed_values_;
   std::vector<std::unique_ptr<PointAttribute>> quantized_portable_attributes_;
+  // True when the kD-tree was encoded in level order.
+  bool level_order_;
+  // True when the kD-tree was encoded with independent subtrees.
+  bool partitioned_;
+  int num_decoded_points_;
 };
 
 }  // namespace draco
@@ -49,26 +49,18 @@ bool KdTreeAttributesEncoder::TransformAttributesToPortableFormat() {
     if (att->data_type() == DT_FLOAT32) {
       // Quantization path.
       AttributeQuantizationTransform attribute_quantization_transform;
-      const int quantization_bits = encoder()->options()->GetAttributeInt(
-          att_id, "quantization_bits", -1);
+      const AttributeEncodePlan &att_plan =
+          encoder()->plan()->attribute(att_id);
+      const int quantization_bits = att_plan.quantization_bits;
       if (quantization_bits < 1) {
         return false;
       }
-      if (encoder()->options()->IsAttributeOptionSet(att_id,
-                                                     "quantization_origin") &&
-          encoder()->options()->IsAttributeOptionSet(att_id,
-                                                     "quantization_range")) {
+      if (!att_plan.quantization_origin.empty()) {
         // Quantization settings are explicitly specified in the provided
         // options.
-        std::vector<float> quantization_origin(att->num_components());
-        encoder()->options()->GetAttributeVector(att_id, "quantization_origin",
-                                                 att->num_components(),
-                                                 &quantization_origin[0]);
-        const float range = encoder()->options()->GetAttributeFloat(
-            att_id, "quantization_range", 1.f);
         attribute_quantization_transform.SetParameters(
-            quantization_bits, quantization_origin.data(),
-            att->num_components(), range);
+            quantization_bits, att_plan.quantization_origin.data(),
+            att->num_components(), att_plan.quantization_range);
       } else {
         // Compute quantization settings from the attribute values.
         if (!attribute_quantization_transform.ComputeParameters(
@@ -134,7 +126,7 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
   // We limit the maximum value of compression_level to 6 as we don't currently
   // have viable algorithms for higher compression levels.
   uint8_t compression_level =
-      std::min(10 - encoder()->options()->GetSpeed(), 6);
+      std::min(10 - encoder()->plan()->speed(), 6);
   DRACO_DCHECK_LE(compression_level, 6);
 
   if (compression_level == 6 && num_components_ > 15) {
@@ -143,7 +135,17 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
     compression_level = 5;
   }
 
-  out_buffer->Encode(compression_level);
+  // Level order allows decoders to decode a subsampled point cloud.
+  const bool level_order = encoder()->plan()->kd_tree_level_order();
+  // Partitioning allows the subtrees below the first levels of the tree to be
+  // encoded in parallel.
+  const int partition_levels = encoder()->plan()->kd_tree_partition_levels();
+  if (partition_levels < 0 || partition_levels > kKdTreeMaxPartitionLevels) {
+    return false;
+  }
+  out_buffer->Encode(static_cast<uint8_t>(
+      compression_level | (level_order ? kKdTreeLevelOrderFlag : 0) |
+      (partition_levels > 0 ? kKdTreePartitionedFlag : 0)));
 
   // Init PointDVector. The number of dimensions is equal to the total number
   // of dimensions across all attributes.
@@ -241,6 +243,9 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
   switch (compression_level) {
     case 6: {
       DynamicIntegerPointsKdTreeEncoder<6> points_encoder(num_components_);
+      points_encoder.set_level_order(level_order);
+      points_encoder.set_partition_levels(partition_levels);
+      points_encoder.set_thread_pool(encoder()->options()->thread_pool());
       if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
                                        num_bits, out_buffer)) {
         return false;
@@ -249,6 +254,9 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
     }
     case 5: {
       DynamicIntegerPointsKdTreeEncoder<5> points_encoder(num_components_);
+      points_encoder.set_level_order(level_order);
+      points_encoder.set_partition_levels(partition_levels);
+      points_encoder.set_thread_pool(encoder()->options()->thread_pool());
       if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
                                        num_bits, out_buffer)) {
         return false;
@@ -257,6 +265,9 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
     }
     case 4: {
       DynamicIntegerPointsKdTreeEncoder<4> points_encoder(num_components_);
+      points_encoder.set_level_order(level_order);
+      points_encoder.set_partition_levels(partition_levels);
+      points_encoder.set_thread_pool(encoder()->options()->thread_pool());
       if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
                                        num_bits, out_buffer)) {
         return false;
@@ -265,6 +276,9 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
     }
     case 3: {
       DynamicIntegerPointsKdTreeEncoder<3> points_encoder(num_components_);
+      points_encoder.set_level_order(level_order);
+      points_encoder.set_partition_levels(partition_levels);
+      points_encoder.set_thread_pool(encoder()->options()->thread_pool());
       if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
                                        num_bits, out_buffer)) {
         return false;
@@ -273,6 +287,9 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
     }
     case 2: {
       DynamicIntegerPointsKdTreeEncoder<2> points_encoder(num_components_);
+      points_encoder.set_level_order(level_order);
+      points_encoder.set_partition_levels(partition_levels);
+      points_encoder.set_thread_pool(encoder()->options()->thread_pool());
       if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
                                        num_bits, out_buffer)) {
         return false;
@@ -281,6 +298,9 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
     }
     case 1: {
       DynamicIntegerPointsKdTreeEncoder<1> points_encoder(num_components_);
+      points_encoder.set_level_order(level_order);
+      points_encoder.set_partition_levels(partition_levels);
+      points_encoder.set_thread_pool(encoder()->options()->thread_pool());
       if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
                                        num_bits, out_buffer)) {
         return false;
@@ -289,6 +309,9 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
     }
     case 0: {
       DynamicIntegerPointsKdTreeEncoder<0> points_encoder(num_components_);
+      points_encoder.set_level_order(level_order);
+      points_encoder.set_partition_levels(partition_levels);
+      points_encoder.set_thread_pool(encoder()->options()->thread_pool());
       if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
                                        num_bits, out_buffer)) {
         return false;
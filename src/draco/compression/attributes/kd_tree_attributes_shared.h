@@ -15,6 +15,8 @@
 #ifndef DRACO_COMPRESSION_ATTRIBUTES_KD_TREE_ATTRIBUTES_SHARED_H_
 #define DRACO_COMPRESSION_ATTRIBUTES_KD_TREE_ATTRIBUTES_SHARED_H_
 
+#include <cstdint>
+
 namespace draco {
 
 // Defines types of kD-tree compression
@@ -23,6 +25,17 @@ enum KdTreeAttributesEncodingMethod {
   kKdTreeIntegerEncoding
 };
 
+// Flag stored together with the compression level when the kD-tree is
+// encoded in level order (see DynamicIntegerPointsKdTreeEncoder).
+static constexpr uint8_t kKdTreeLevelOrderFlag = 0x80;
+
+// Flag stored together with the compression level when the kD-tree is
+// encoded with independent subtrees.
+static constexpr uint8_t kKdTreePartitionedFlag = 0x40;
+
+// Maximum number of levels of the kD-tree above the independent subtrees.
+static constexpr int kKdTreeMaxPartitionLevels = 16;
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ATTRIBUTES_KD_TREE_ATTRIBUTES_SHARED_H_
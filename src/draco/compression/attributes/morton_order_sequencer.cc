@@ -0,0 +1,184 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/attributes/morton_order_sequencer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "draco/core/bit_utils.h"
+
+namespace draco {
+
+namespace {
+
+// Number of items processed by a single task of the parallel loops.
+constexpr int kChunkSize = 1 << 16;
+
+// Number of bits of the radix sort digits.
+constexpr int kRadixBits = 11;
+constexpr int kRadixSize = 1 << kRadixBits;
+
+// Number of bits by which the Morton grid is finer than the average spacing of
+// the sorted values along each axis.
+constexpr int kExtraGridBits = 4;
+
+// Sorts |items| by their bits [begin_bit, end_bit) using a least significant
+// digit radix sort. Each pass histograms and scatters chunks of the input in
+// parallel on |pool|. Passes over digits that are the same for all items are
+// skipped.
+void RadixSort(int begin_bit, int end_bit, std::vector<uint64_t> *items,
+               ThreadPool *pool) {
+  const int num_items = static_cast<int>(items->size());
+  const int num_chunks = (num_items + kChunkSize - 1) / kChunkSize;
+  std::vector<uint64_t> sorted_items(num_items);
+  std::vector<uint32_t> offsets(num_chunks * kRadixSize);
+  for (int shift = begin_bit; shift < end_bit; shift += kRadixBits) {
+    const uint64_t *const src = items->data();
+    uint64_t *const dst = sorted_items.data();
+    std::fill(offsets.begin(), offsets.end(), 0);
+    ParallelFor(pool, num_chunks, [&](int c) {
+      uint32_t *const histogram = &offsets[c * kRadixSize];
+      const int end = std::min(num_items, (c + 1) * kChunkSize);
+      for (int i = c * kChunkSize; i < end; ++i) {
+        ++histogram[(src[i] >> shift) & (kRadixSize - 1)];
+      }
+    });
+    // Convert the histograms to the output offsets of each chunk and digit.
+    uint32_t offset = 0;
+    bool is_digit_constant = false;
+    for (int d = 0; d < kRadixSize; ++d) {
+      uint32_t digit_count = 0;
+      for (int c = 0; c < num_chunks; ++c) {
+        const uint32_t count = offsets[c * kRadixSize + d];
+        offsets[c * kRadixSize + d] = offset + digit_count;
+        digit_count += count;
+      }
+      if (digit_count == static_cast<uint32_t>(num_items)) {
+        is_digit_constant = true;
+        break;
+      }
+      offset += digit_count;
+    }
+    if (is_digit_constant) {
+      continue;
+    }
+    ParallelFor(pool, num_chunks, [&](int c) {
+      uint32_t *const chunk_offsets = &offsets[c * kRadixSize];
+      const int end = std::min(num_items, (c + 1) * kChunkSize);
+      for (int i = c * kChunkSize; i < end; ++i) {
+        dst[chunk_offsets[(src[i] >> shift) & (kRadixSize - 1)]++] = src[i];
+      }
+    });
+    items->swap(sorted_items);
+  }
+}
+
+}  // namespace
+
+bool MortonOrderSequencer::GenerateSequenceInternal() {
+  if (num_points_ < 0) {
+    return false;
+  }
+  out_point_ids()->resize(num_points_);
+  const int num_values = attribute_ == nullptr ? 0 : attribute_->size();
+  if (num_values == 0 || num_points_ < 2) {
+    for (int i = 0; i < num_points_; ++i) {
+      out_point_ids()->at(i) = PointIndex(i);
+    }
+    return true;
+  }
+
+  // Convert the attribute values to floats and compute their bounds.
+  const int num_components = std::min<int>(attribute_->num_components(), 3);
+  std::vector<float> values(num_values * num_components);
+  std::vector<float> min_values(num_components,
+                                std::numeric_limits<float>::max());
+  std::vector<float> max_values(num_components,
+                                std::numeric_limits<float>::lowest());
+  for (AttributeValueIndex i(0); i < num_values; ++i) {
+    float *const value = &values[i.value() * num_components];
+    if (!attribute_->ConvertValue<float>(i, num_components, value)) {
+      return false;
+    }
+    for (int c = 0; c < num_components; ++c) {
+      if (!std::isfinite(value[c])) {
+        value[c] = 0.f;
+      }
+      min_values[c] = std::min(min_values[c], value[c]);
+      max_values[c] = std::max(max_values[c], value[c]);
+    }
+  }
+
+  // The sorted items store the Morton codes above the point ids. The number
+  // of grid bits is limited by the size of the items and by the precision of
+  // the float values.
+  const int num_id_bits = MostSignificantBit(num_points_ - 1) + 1;
+  const int max_num_bits = std::min(num_components == 3 ? 21 : 24,
+                                    (64 - num_id_bits) / num_components);
+  const int num_bits = std::min(
+      max_num_bits,
+      (MostSignificantBit(num_values) + 1) / num_components + kExtraGridBits);
+
+  // Quantize the values to a uniform grid over the bounds and interleave the
+  // bits of the grid coordinates into Morton codes.
+  const float max_coordinate = static_cast<float>((1u << num_bits) - 1);
+  std::vector<float> scales(num_components);
+  for (int c = 0; c < num_components; ++c) {
+    const float range = max_values[c] - min_values[c];
+    scales[c] = range > 0 ? max_coordinate / range : 0.f;
+  }
+  std::vector<uint64_t> value_codes(num_values);
+  ParallelFor(pool_, (num_values + kChunkSize - 1) / kChunkSize, [&](int k) {
+    const int end = std::min(num_values, (k + 1) * kChunkSize);
+    for (int i = k * kChunkSize; i < end; ++i) {
+      uint32_t coordinates[3] = {0, 0, 0};
+      for (int c = 0; c < num_components; ++c) {
+        coordinates[c] = static_cast<uint32_t>(std::min(
+            (values[i * num_components + c] - min_values[c]) * scales[c],
+            max_coordinate));
+      }
+      if (num_components == 3) {
+        value_codes[i] = SpreadBitsBy3(coordinates[0]) |
+                         SpreadBitsBy3(coordinates[1]) << 1 |
+                         SpreadBitsBy3(coordinates[2]) << 2;
+      } else if (num_components == 2) {
+        value_codes[i] =
+            SpreadBitsBy2(coordinates[0]) | SpreadBitsBy2(coordinates[1]) << 1;
+      } else {
+        value_codes[i] = coordinates[0];
+      }
+    }
+  });
+
+  // Sort the points by the codes of their values.
+  std::vector<uint64_t> items(num_points_);
+  for (PointIndex i(0); i < num_points_; ++i) {
+    items[i.value()] =
+        value_codes[attribute_->mapped_index(i).value()] << num_id_bits |
+        i.value();
+  }
+  RadixSort(num_id_bits, num_id_bits + num_bits * num_components, &items,
+            pool_);
+  const uint64_t id_mask = (uint64_t(1) << num_id_bits) - 1;
+  for (int i = 0; i < num_points_; ++i) {
+    out_point_ids()->at(i) = 
+        PointIndex(static_cast<uint32_t>(items[i] & id_mask));
+  }
+  return true;
+}
+
+}  // namespace draco
@@ -0,0 +1,50 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_MORTON_ORDER_SEQUENCER_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_MORTON_ORDER_SEQUENCER_H_
+
+#include "draco/attributes/point_attribute.h"
+#include "draco/compression/attributes/points_sequencer.h"
+#include "draco/core/thread_pool.h"
+
+namespace draco {
+
+// Sequencer that orders the points along the Morton (Z-order) curve of the
+// values of a given attribute, typically the positions. Consecutive points are
+// then spatially close, which makes delta coding of the attribute values by
+// the sequential attribute encoders much more efficient than for the input
+// order of unordered point clouds.
+// Only the first three components of the attribute are used for the ordering.
+// The points are sorted with a parallel radix sort on |pool| when it is set.
+// The sequencer can be used only by the attribute encoders, because the
+// decoders assign the decoded values to points in a linear order.
+class MortonOrderSequencer : public PointsSequencer {
+ public:
+  MortonOrderSequencer(const PointAttribute *attribute, int32_t num_points,
+                       ThreadPool *pool)
+      : attribute_(attribute), num_points_(num_points), pool_(pool) {}
+
+ protected:
+  bool GenerateSequenceInternal() override;
+
+ private:
+  const PointAttribute *const attribute_;
+  const int32_t num_points_;
+  ThreadPool *const pool_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_MORTON_ORDER_SEQUENCER_H_
@@ -201,6 +201,54 @@ class OctahedronToolBox {
                                  out_vector);
   }
 
+  // Converts |num_vectors| pairs of quantized octahedral coordinates stored in
+  // |in_coords| into unit vectors stored in |out_vectors| (three floats per
+  // vector). The output is the same as the output of
+  // QuantizedOctahedralCoordsToUnitVector() called for each pair, but the
+  // vectors are processed in blocks stored as separate arrays of components
+  // and without branches, which allows the compiler to vectorize the loops.
+  void QuantizedOctahedralCoordsToUnitVectors(const int32_t *in_coords,
+                                              int64_t num_vectors,
+                                              float *out_vectors) const {
+    constexpr int kBlockSize = 64;
+    float xs[kBlockSize];
+    float ys[kBlockSize];
+    float zs[kBlockSize];
+    for (int64_t start = 0; start < num_vectors; start += kBlockSize) {
+      const int block_size =
+          static_cast<int>(std::min<int64_t>(kBlockSize, num_vectors - start));
+      const int32_t *const coords = in_coords + 2 * start;
+      for (int i = 0; i < block_size; ++i) {
+        ys[i] = coords[2 * i] * dequantization_scale_ - 1.f;
+        zs[i] = coords[2 * i + 1] * dequantization_scale_ - 1.f;
+      }
+      // See OctahedralCoordsToUnitVector() for details about the computation.
+      for (int i = 0; i < block_size; ++i) {
+        float y = ys[i];
+        float z = zs[i];
+        const float x = 1.f - std::abs(y) - std::abs(z);
+        float x_offset = -x;
+        x_offset = x_offset < 0 ? 0 : x_offset;
+        y += y < 0 ? x_offset : -x_offset;
+        z += z < 0 ? x_offset : -x_offset;
+        const float norm_squared = x * x + y * y + z * z;
+        // 1e-6f is the largest float smaller than the double 1e-6 used by
+        // OctahedralCoordsToUnitVector(), so both conditions are equivalent.
+        const bool is_zero = norm_squared <= 1e-6f;
+        const float d = 1.0f / std::sqrt(is_zero ? 1.f : norm_squared);
+        xs[i] = is_zero ? 0.f : x * d;
+        ys[i] = is_zero ? 0.f : y * d;
+        zs[i] = is_zero ? 0.f : z * d;
+      }
+      float *const out = out_vectors + 3 * start;
+      for (int i = 0; i < block_size; ++i) {
+        out[3 * i] = xs[i];
+        out[3 * i + 1] = ys[i];
+        out[3 * i + 2] = zs[i];
+      }
+    }
+  }
+
   // |s| and |t| are expected to be signed values.
   inline bool IsInDiamond(const int32_t &s, const int32_t &t) const {
     // Expect center already at origin.
@@ -0,0 +1,55 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/attributes/normal_compression_utils.h"
+
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+class NormalCompressionUtilsTest : public ::testing::Test {};
+
+TEST_F(NormalCompressionUtilsTest, TestBatchConversionMatchesScalar) {
+  // Tests that QuantizedOctahedralCoordsToUnitVectors() produces the same
+  // vectors as QuantizedOctahedralCoordsToUnitVector() for all valid
+  // coordinates.
+  for (const int quantization_bits : {2, 3, 7, 10}) {
+    draco::OctahedronToolBox tool_box;
+    ASSERT_TRUE(tool_box.SetQuantizationBits(quantization_bits));
+    const int32_t max_quantized_value = (1 << quantization_bits) - 1;
+    std::vector<int32_t> coords;
+    for (int32_t s = 0; s <= max_quantized_value; ++s) {
+      for (int32_t t = 0; t <= max_quantized_value; ++t) {
+        coords.push_back(s);
+        coords.push_back(t);
+      }
+    }
+    const int num_vectors = coords.size() / 2;
+    std::vector<float> vectors(3 * num_vectors);
+    tool_box.QuantizedOctahedralCoordsToUnitVectors(coords.data(), num_vectors,
+                                                    vectors.data());
+    for (int i = 0; i < num_vectors; ++i) {
+      float expected[3];
+      tool_box.QuantizedOctahedralCoordsToUnitVector(
+          coords[2 * i], coords[2 * i + 1], expected);
+      for (int c = 0; c < 3; ++c) {
+        ASSERT_EQ(vectors[3 * i + c], expected[c]);
+      }
+    }
+  }
+}
+
+}  // namespace
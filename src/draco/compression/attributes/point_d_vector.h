@@ -16,6 +16,7 @@
 #ifndef DRACO_COMPRESSION_ATTRIBUTES_POINT_D_VECTOR_H_
 #define DRACO_COMPRESSION_ATTRIBUTES_POINT_D_VECTOR_H_
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <iterator>
@@ -23,6 +24,7 @@
 #include <vector>
 
 #include "draco/core/macros.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -185,6 +187,16 @@ class PointDVector {
       return vec_->data0_ + (item_ + n) * dimensionality_;
     }
 
+    // Overload of the generic PartitionPoints() function used by the kD-tree
+    // encoders that is found by argument-dependent lookup.
+    friend PointDVectorIterator PartitionPoints(PointDVectorIterator begin,
+                                                PointDVectorIterator end,
+                                                uint32_t axis,
+                                                internal_t value,
+                                                ThreadPool *pool) {
+      return begin.vec_->Partition(begin, end, axis, value, pool);
+    }
+
    protected:
     explicit PointDVectorIterator(PointDVector *vec, size_t start_item)
         : item_(start_item), vec_(vec), dimensionality_(vec->dimensionality_) {}
@@ -209,6 +221,40 @@ class PointDVector {
     return data0_ + index * dimensionality_;
   }
 
+  // Reorders the items in [begin, end) so that all items whose |axis|
+  // component is less than |value| precede the remaining items and returns the
+  // first item of the second group. Unlike std::partition, the items are
+  // swapped in place by kernels specialized for the common dimensionalities 3
+  // to 6 instead of through PseudoPointD. Ranges of more than
+  // kPartitionChunkSize items are partitioned in independent chunks whose
+  // misplaced items are exchanged afterwards, both in parallel on |pool|. The
+  // resulting order does not depend on |pool|. Concurrent calls on disjoint
+  // ranges are safe.
+  PointDVectorIterator Partition(PointDVectorIterator begin,
+                                 PointDVectorIterator end, uint32_t axis,
+                                 internal_t value, ThreadPool *pool) {
+    DRACO_DCHECK_LT(axis, dimensionality_);
+    size_t split;
+    switch (dimensionality_) {
+      case 3:
+        split = PartitionItems<3>(begin.item_, end.item_, axis, value, pool);
+        break;
+      case 4:
+        split = PartitionItems<4>(begin.item_, end.item_, axis, value, pool);
+        break;
+      case 5:
+        split = PartitionItems<5>(begin.item_, end.item_, axis, value, pool);
+        break;
+      case 6:
+        split = PartitionItems<6>(begin.item_, end.item_, axis, value, pool);
+        break;
+      default:
+        split = PartitionItems<0>(begin.item_, end.item_, axis, value, pool);
+        break;
+    }
+    return PointDVectorIterator(this, split);
+  }
+
   uint32_t size() const { return n_items_; }
   size_t GetBufferSize() const { return data_.size(); }
 
@@ -274,6 +320,155 @@ class PointDVector {
   }
 
  private:
+  static constexpr size_t kPartitionChunkSize = 1 << 16;
+
+  // Range of items [begin, end).
+  struct ItemRange {
+    size_t begin;
+    size_t end;
+  };
+
+  // Implements Partition() on items [begin, end) with |dimension_t| components
+  // or with |dimensionality_| components when |dimension_t| is zero. Returns
+  // the index of the first item of the second group.
+  template <int dimension_t>
+  size_t PartitionItems(size_t begin, size_t end, uint32_t axis,
+                        internal_t value, ThreadPool *pool) {
+    const size_t num_chunks =
+        (end - begin + kPartitionChunkSize - 1) / kPartitionChunkSize;
+    if (num_chunks <= 1) {
+      return PartitionRange<dimension_t>(begin, end, axis, value);
+    }
+
+    // Partition all chunks independently.
+    std::vector<size_t> chunk_splits(num_chunks);
+    ParallelFor(pool, static_cast<int>(num_chunks), [&](int c) {
+      const size_t chunk_begin = begin + c * kPartitionChunkSize;
+      const size_t chunk_end =
+          std::min(chunk_begin + kPartitionChunkSize, end);
+      chunk_splits[c] =
+          PartitionRange<dimension_t>(chunk_begin, chunk_end, axis, value);
+    });
+
+    // Find the items of the second group that ended up before the final split
+    // and the items of the first group that ended up after it.
+    size_t split = begin;
+    for (size_t c = 0; c < num_chunks; ++c) {
+      split += chunk_splits[c] - (begin + c * kPartitionChunkSize);
+    }
+    std::vector<ItemRange> misplaced_right_items;
+    std::vector<ItemRange> misplaced_left_items;
+    for (size_t c = 0; c < num_chunks; ++c) {
+      const size_t chunk_begin = begin + c * kPartitionChunkSize;
+      const size_t chunk_end =
+          std::min(chunk_begin + kPartitionChunkSize, end);
+      if (chunk_splits[c] < split) {
+        misplaced_right_items.push_back(
+            {chunk_splits[c], std::min(chunk_end, split)});
+      }
+      if (chunk_splits[c] > split) {
+        misplaced_left_items.push_back(
+            {std::max(chunk_begin, split), chunk_splits[c]});
+      }
+    }
+
+    // Swap the misplaced items pairwise, split into |num_chunks| parts.
+    size_t num_misplaced = 0;
+    for (const ItemRange &range : misplaced_right_items) {
+      num_misplaced += range.end - range.begin;
+    }
+    const size_t part_size = (num_misplaced + num_chunks - 1) / num_chunks;
+    ParallelFor(pool, static_cast<int>(num_chunks), [&](int p) {
+      const size_t part_begin = std::min(num_misplaced, p * part_size);
+      const size_t part_end = std::min(num_misplaced, part_begin + part_size);
+      SwapMisplacedItems(misplaced_right_items, misplaced_left_items,
+                         part_begin, part_end);
+    });
+    return split;
+  }
+
+  // Partitions items [begin, end) in place from both ends of the range.
+  template <int dimension_t>
+  size_t PartitionRange(size_t begin, size_t end, uint32_t axis,
+                        internal_t value) {
+    const uint32_t dimension =
+        dimension_t > 0 ? dimension_t : dimensionality_;
+    internal_t *first = data0_ + begin * dimension;
+    internal_t *last = data0_ + end * dimension;
+    while (true) {
+      while (first != last && first[axis] < value) {
+        first += dimension;
+      }
+      if (first == last) {
+        break;
+      }
+      last -= dimension;
+      while (first != last && !(last[axis] < value)) {
+        last -= dimension;
+      }
+      if (first == last) {
+        break;
+      }
+      if (dimension_t > 0) {
+        internal_t tmp[dimension_t > 0 ? dimension_t : 1];
+        std::memcpy(tmp, first, sizeof(tmp));
+        std::memcpy(first, last, sizeof(tmp));
+        std::memcpy(last, tmp, sizeof(tmp));
+      } else {
+        std::swap_ranges(first, first + dimension, last);
+      }
+      first += dimension;
+    }
+    return (first - data0_) / dimension;
+  }
+
+  // Swaps the misplaced items with indices [part_begin, part_end) counted over
+  // all |right_items| with the items at the same indices of |left_items|.
+  void SwapMisplacedItems(const std::vector<ItemRange> &right_items,
+                          const std::vector<ItemRange> &left_items,
+                          size_t part_begin, size_t part_end) {
+    if (part_begin >= part_end) {
+      return;
+    }
+    // Find the first items of the part in both lists of ranges.
+    size_t right_index = 0;
+    size_t right_item = SkipItems(right_items, part_begin, &right_index);
+    size_t left_index = 0;
+    size_t left_item = SkipItems(left_items, part_begin, &left_index);
+    size_t num_remaining = part_end - part_begin;
+    while (num_remaining > 0) {
+      const size_t num_items = std::min(
+          num_remaining, std::min(right_items[right_index].end - right_item,
+                                    left_items[left_index].end - left_item));
+      std::swap_ranges(data0_ + right_item * dimensionality_,
+                       data0_ + (right_item + num_items) * dimensionality_,
+                       data0_ + left_item * dimensionality_);
+      num_remaining -= num_items;
+      right_item += num_items;
+      left_item += num_items;
+      if (right_item == right_items[right_index].end &&
+          ++right_index < right_items.size()) {
+        right_item = right_items[right_index].begin;
+      }
+      if (left_item == left_items[left_index].end &&
+          ++left_index < left_items.size()) {
+        left_item = left_items[left_index].begin;
+      }
+    }
+  }
+
+  // Returns the item at position |num_skipped| counted over all |ranges| and
+  // stores the index of its range in |range_index|.
+  static size_t SkipItems(const std::vector<ItemRange> &ranges,
+                          size_t num_skipped, size_t *range_index) {
+    while (num_skipped >= ranges[*range_index].end -
+                              ranges[*range_index].begin) {
+      num_skipped -= ranges[*range_index].end - ranges[*range_index].begin;
+      ++*range_index;
+    }
+    return ranges[*range_index].begin + num_skipped;
+  }
+
   // internal parameters.
   const uint32_t n_items_;
   const uint32_t dimensionality_;  // The dimension of the points in the buffer
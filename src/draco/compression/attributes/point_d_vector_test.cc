@@ -14,8 +14,12 @@
 //
 #include "draco/compression/attributes/point_d_vector.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "draco/compression/point_cloud/algorithms/point_cloud_types.h"
 #include "draco/core/draco_test_base.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -344,6 +348,61 @@ class PointDVectorTest : public ::testing::Test {
   }
 };
 
+TEST_F(PointDVectorTest, PartitionTest) {
+  // Test that Partition() separates the items for specialized and generic
+  // dimensionalities and that the result does not depend on the thread pool.
+  ThreadPool pool(2);
+  for (uint32_t dimensionality = 1; dimensionality <= 7; ++dimensionality) {
+    for (const uint32_t n_items : {0u, 1u, 5u, 150000u}) {
+      std::vector<std::vector<uint32_t>> input(n_items);
+      for (uint32_t i = 0; i < n_items; ++i) {
+        for (uint32_t d = 0; d < dimensionality; ++d) {
+          input[i].push_back((i * 7919u + d * 104729u) % 1000u);
+        }
+      }
+      const uint32_t axis = dimensionality / 2;
+      // Partition only the items behind the first one.
+      const uint32_t offset = n_items > 0 ? 1 : 0;
+      const uint32_t expected_split =
+          offset + std::count_if(input.begin() + offset, input.end(),
+                                 [axis](const std::vector<uint32_t> &p) {
+                                   return p[axis] < 500;
+                                 });
+      std::vector<std::vector<std::vector<uint32_t>>> results;
+      for (ThreadPool *const partition_pool : {&pool, (ThreadPool *)nullptr}) {
+        PointDVector<uint32_t> var(n_items, dimensionality);
+        for (uint32_t i = 0; i < n_items; ++i) {
+          for (uint32_t d = 0; d < dimensionality; ++d) {
+            var[i][d] = input[i][d];
+          }
+        }
+        const auto split = var.Partition(var.begin() + offset, var.end(),
+                                         axis, 500, partition_pool);
+        ASSERT_EQ(split - var.begin(), expected_split);
+        std::vector<std::vector<uint32_t>> result(n_items);
+        for (uint32_t i = 0; i < n_items; ++i) {
+          for (uint32_t d = 0; d < dimensionality; ++d) {
+            result[i].push_back(var[i][d]);
+          }
+          if (i >= offset) {
+            ASSERT_EQ(result[i][axis] < 500, i < expected_split);
+          }
+        }
+        results.push_back(result);
+        // The partitioned items must be a permutation of the input items.
+        if (offset > 0) {
+          ASSERT_EQ(result[0], input[0]);
+        }
+        std::sort(result.begin(), result.end());
+        std::vector<std::vector<uint32_t>> sorted_input = input;
+        std::sort(sorted_input.begin(), sorted_input.end());
+        ASSERT_EQ(result, sorted_input);
+      }
+      ASSERT_EQ(results[0], results[1]);
+    }
+  }
+}
+
 TEST_F(PointDVectorTest, VectorTest) {
   TestSize<uint32_t>();
   TestContentsDiscrete<uint32_t>();
@@ -111,38 +111,25 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramDecoder<
     const CornerIndex start_corner_id =
         this->mesh_data().data_to_corner_map()->at(p);
 
-    CornerIndex corner_id(start_corner_id);
     int num_parallelograms = 0;
-    bool first_pass = true;
-    while (corner_id != kInvalidCornerIndex) {
-      if (ComputeParallelogramPrediction(
-              p, corner_id, table, *vertex_to_data_map, out_data,
-              num_components, &(pred_vals[num_parallelograms][0]))) {
-        // Parallelogram prediction applied and stored in
-        // |pred_vals[num_parallelograms]|
-        ++num_parallelograms;
-        // Stop processing when we reach the maximum number of allowed
-        // parallelograms.
-        if (num_parallelograms == kMaxNumParallelograms) {
-          break;
-        }
-      }
-
-      // Proceed to the next corner attached to the vertex. First swing left
-      // and if we reach a boundary, swing right from the start corner.
-      if (first_pass) {
-        corner_id = table->SwingLeft(corner_id);
-      } else {
-        corner_id = table->SwingRight(corner_id);
-      }
-      if (corner_id == start_corner_id) {
-        break;
-      }
-      if (corner_id == kInvalidCornerIndex && first_pass) {
-        first_pass = false;
-        corner_id = table->SwingRight(start_corner_id);
-      }
-    }
+    // First swing left and if we reach a boundary, swing right from the start
+    // corner.
+    table->GetVertexRingCache().VisitCorners(
+        start_corner_id, [&](CornerIndex corner_id) {
+          if (ComputeParallelogramPrediction(
+                  p, corner_id, table, *vertex_to_data_map, out_data,
+                  num_components, &(pred_vals[num_parallelograms][0]))) {
+            // Parallelogram prediction applied and stored in
+            // |pred_vals[num_parallelograms]|
+            ++num_parallelograms;
+            // Stop processing when we reach the maximum number of allowed
+            // parallelograms.
+            if (num_parallelograms == kMaxNumParallelograms) {
+              return false;
+            }
+          }
+          return true;
+        });
 
     // Check which of the available parallelograms are actually used and compute
     // the final predicted value.
@@ -73,6 +73,14 @@ class MeshPredictionSchemeConstrainedMultiParallelogramEncoder
   }
 
  private:
+  // Implementation of ComputeCorrectionValues() for attributes with
+  // |kNumComponents| components, or with any number of components when
+  // |kNumComponents| is 0.
+  template <int kNumComponents>
+  bool ComputeCorrectionValuesInternal(const DataTypeT *in_data,
+                                       CorrType *out_corr, int size,
+                                       int num_components);
+
   // Function used to compute number of bits needed to store overhead of the
   // predictor. In this case, we consider overhead to be all bits that mark
   // whether a parallelogram should be used for prediction or not. The input
@@ -153,8 +161,9 @@ class MeshPredictionSchemeConstrainedMultiParallelogramEncoder
   // the edges are processed. For better compression, the flags are stored in
   // in separate contexts based on the number of available parallelograms at a
   // given vertex.
-  // TODO(draco-eng) reconsider std::vector<bool> (performance/space).
-  std::vector<bool> is_crease_edge_[kMaxNumParallelograms];
+  // One byte is used per flag, which is faster to update than
+  // std::vector<bool>.
+  std::vector<uint8_t> is_crease_edge_[kMaxNumParallelograms];
   Mode selected_mode_;
 
   ShannonEntropyTracker entropy_tracker_;
@@ -170,6 +179,38 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
     ComputeCorrectionValues(const DataTypeT *in_data, CorrType *out_corr,
                             int size, int num_components,
                             const PointIndex * /* entry_to_point_id_map */) {
+  // Use fixed size storage for the most common attributes (texture
+  // coordinates, positions and normals).
+  switch (num_components) {
+    case 2:
+      return ComputeCorrectionValuesInternal<2>(in_data, out_corr, size,
+                                                num_components);
+    case 3:
+      return ComputeCorrectionValuesInternal<3>(in_data, out_corr, size,
+                                                num_components);
+    default:
+      return ComputeCorrectionValuesInternal<0>(in_data, out_corr, size,
+                                                num_components);
+  }
+}
+
+template <typename DataTypeT, class TransformT, class MeshDataT>
+template <int kNumComponents>
+bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
+    DataTypeT, TransformT, MeshDataT>::
+    ComputeCorrectionValuesInternal(const DataTypeT *in_data,
+                                    CorrType *out_corr, int size,
+                                    int num_components) {
+  typedef constrained_multi_parallelogram::ComponentArray<DataTypeT,
+                                                          kNumComponents>
+      ValueArray;
+  typedef constrained_multi_parallelogram::ComponentArray<int,
+                                                          kNumComponents>
+      ResidualArray;
+  if (kNumComponents > 0) {
+    // Lets the compiler unroll all loops over the components.
+    num_components = kNumComponents;
+  }
   this->transform().Init(in_data, size, num_components);
   const CornerTable *const table = this->mesh_data().corner_table();
   const std::vector<int32_t> *const vertex_to_data_map =
@@ -177,26 +218,22 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
 
   // Predicted values for all simple parallelograms encountered at any given
   // vertex.
-  std::vector<DataTypeT> pred_vals[kMaxNumParallelograms];
-  for (int i = 0; i < kMaxNumParallelograms; ++i) {
-    pred_vals[i].resize(num_components);
-  }
+  ValueArray pred_vals[kMaxNumParallelograms] = {
+      ValueArray(num_components), ValueArray(num_components),
+      ValueArray(num_components), ValueArray(num_components)};
+  static_assert(kMaxNumParallelograms == 4,
+                "|pred_vals| must be initialized for all parallelograms.");
   // Used to store predicted value for various multi-parallelogram predictions
   // (combinations of simple parallelogram predictions).
-  std::vector<DataTypeT> multi_pred_vals(num_components);
+  ValueArray multi_pred_vals(num_components);
   entropy_symbols_.resize(num_components);
 
-  // Struct for holding data about prediction configuration for different sets
-  // of used parallelograms.
-  struct PredictionConfiguration {
-    PredictionConfiguration()
-        : error(), configuration(0), num_used_parallelograms(0) {}
-    Error error;
-    uint8_t configuration;  // Bitfield, 1 use parallelogram, 0 don't use it.
-    int num_used_parallelograms;
-    std::vector<DataTypeT> predicted_value;
-    std::vector<int32_t> residuals;
-  };
+  // All storage is allocated before the main loop, the best configuration
+  // found for a vertex is tracked by copying the values into
+  // |best_predicted_value| and |best_residuals|.
+  ValueArray best_predicted_value(num_components);
+  ResidualArray best_residuals(num_components);
+  ResidualArray current_residuals(num_components);
 
   // Bit-field used for computing permutations of excluded edges
   // (parallelograms).
@@ -208,8 +245,6 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
   int64_t total_used_parallelograms[kMaxNumParallelograms] = {0};
   int64_t total_parallelograms[kMaxNumParallelograms] = {0};
 
-  std::vector<int> current_residuals(num_components);
-
   // We start processing the vertices from the end because this prediction uses
   // data from previous entries that could be overwritten when an entry is
   // processed.
@@ -221,70 +256,59 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
 
     // Go over all corners attached to the vertex and compute the predicted
     // value from the parallelograms defined by their opposite faces.
-    CornerIndex corner_id(start_corner_id);
     int num_parallelograms = 0;
-    bool first_pass = true;
-    while (corner_id != kInvalidCornerIndex) {
-      if (ComputeParallelogramPrediction(
-              p, corner_id, table, *vertex_to_data_map, in_data, num_components,
-              &(pred_vals[num_parallelograms][0]))) {
-        // Parallelogram prediction applied and stored in
-        // |pred_vals[num_parallelograms]|
-        ++num_parallelograms;
-        // Stop processing when we reach the maximum number of allowed
-        // parallelograms.
-        if (num_parallelograms == kMaxNumParallelograms) {
-          break;
-        }
-      }
-
-      // Proceed to the next corner attached to the vertex. First swing left
-      // and if we reach a boundary, swing right from the start corner.
-      if (first_pass) {
-        corner_id = table->SwingLeft(corner_id);
-      } else {
-        corner_id = table->SwingRight(corner_id);
-      }
-      if (corner_id == start_corner_id) {
-        break;
-      }
-      if (corner_id == kInvalidCornerIndex && first_pass) {
-        first_pass = false;
-        corner_id = table->SwingRight(start_corner_id);
-      }
-    }
+    // First swing left and if we reach a boundary, swing right from the start
+    // corner.
+    table->GetVertexRingCache().VisitCorners(
+        start_corner_id, [&](CornerIndex corner_id) {
+          if (ComputeParallelogramPrediction(
+                  p, corner_id, table, *vertex_to_data_map, in_data,
+                  num_components, pred_vals[num_parallelograms].data())) {
+            // Parallelogram prediction applied and stored in
+            // |pred_vals[num_parallelograms]|
+            ++num_parallelograms;
+            // Stop processing when we reach the maximum number of allowed
+            // parallelograms.
+            if (num_parallelograms == kMaxNumParallelograms) {
+              return false;
+            }
+          }
+          return true;
+        });
 
     // Offset to the target (destination) vertex.
     const int dst_offset = p * num_components;
     Error error;
 
+    // The overhead depends only on the number of used parallelograms, so it is
+    // computed once for each possible number.
+    int64_t overhead_bits[kMaxNumParallelograms + 1] = {0};
+    if (num_parallelograms > 0) {
+      total_parallelograms[num_parallelograms - 1] += num_parallelograms;
+      for (int i = 0; i <= num_parallelograms; ++i) {
+        overhead_bits[i] = ComputeOverheadBits(
+            total_used_parallelograms[num_parallelograms - 1] + i,
+            total_parallelograms[num_parallelograms - 1]);
+      }
+    }
+
     // Compute all prediction errors for all possible configurations of
     // available parallelograms.
 
-    // Variable for holding the best configuration that has been found so far.
-    PredictionConfiguration best_prediction;
-
     // Compute delta coding error (configuration when no parallelogram is
     // selected).
     const int src_offset = (p - 1) * num_components;
     error = ComputeError(in_data + src_offset, in_data + dst_offset,
-                         &current_residuals[0], num_components);
+                         best_residuals.data(), num_components);
 
-    if (num_parallelograms > 0) {
-      total_parallelograms[num_parallelograms - 1] += num_parallelograms;
-      const int64_t new_overhead_bits =
-          ComputeOverheadBits(total_used_parallelograms[num_parallelograms - 1],
-                              total_parallelograms[num_parallelograms - 1]);
-      error.num_bits += new_overhead_bits;
-    }
+    error.num_bits += overhead_bits[0];
 
-    best_prediction.error = error;
-    best_prediction.configuration = 0;
-    best_prediction.num_used_parallelograms = 0;
-    best_prediction.predicted_value.assign(
-        in_data + src_offset, in_data + src_offset + num_components);
-    best_prediction.residuals.assign(current_residuals.begin(),
-                                     current_residuals.end());
+    // The best configuration that has been found so far.
+    Error best_error = error;
+    uint8_t best_configuration = 0;
+    int best_num_used_parallelograms = 0;
+    std::copy(in_data + src_offset, in_data + src_offset + num_components,
+              best_predicted_value.data());
 
     // Compute prediction error for different cases of used parallelograms.
     for (int num_used_parallelograms = 1;
@@ -293,17 +317,15 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
       // Mark all parallelograms as excluded.
       std::fill(excluded_parallelograms,
                 excluded_parallelograms + num_parallelograms, true);
-      // TODO(draco-eng) maybe this should be another std::fill.
       // Mark the first |num_used_parallelograms| as not excluded.
-      for (int j = 0; j < num_used_parallelograms; ++j) {
-        excluded_parallelograms[j] = false;
-      }
+      std::fill(excluded_parallelograms,
+                excluded_parallelograms + num_used_parallelograms, false);
       // Permute over the excluded edges and compute error for each
       // configuration (permutation of excluded parallelograms).
       do {
         // Reset the multi-parallelogram predicted values.
         for (int j = 0; j < num_components; ++j) {
-          multi_pred_vals[j] = 0;
+          multi_pred_vals.data()[j] = 0;
         }
         uint8_t configuration = 0;
         for (int j = 0; j < num_parallelograms; ++j) {
@@ -311,32 +333,29 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
             continue;
           }
           for (int c = 0; c < num_components; ++c) {
-            multi_pred_vals[c] += pred_vals[j][c];
+            multi_pred_vals.data()[c] += pred_vals[j].data()[c];
           }
           // Set jth bit of the configuration.
           configuration |= (1 << j);
         }
 
         for (int j = 0; j < num_components; ++j) {
-          multi_pred_vals[j] /= num_used_parallelograms;
+          multi_pred_vals.data()[j] /= num_used_parallelograms;
         }
         error = ComputeError(multi_pred_vals.data(), in_data + dst_offset,
-                             &current_residuals[0], num_components);
-        const int64_t new_overhead_bits = ComputeOverheadBits(
-            total_used_parallelograms[num_parallelograms - 1] +
-                num_used_parallelograms,
-            total_parallelograms[num_parallelograms - 1]);
-
+                             current_residuals.data(), num_components);
         // Add overhead bits to the total error.
-        error.num_bits += new_overhead_bits;
-        if (error < best_prediction.error) {
-          best_prediction.error = error;
-          best_prediction.configuration = configuration;
-          best_prediction.num_used_parallelograms = num_used_parallelograms;
-          best_prediction.predicted_value.assign(multi_pred_vals.begin(),
-                                                 multi_pred_vals.end());
-          best_prediction.residuals.assign(current_residuals.begin(),
-                                           current_residuals.end());
+        error.num_bits += overhead_bits[num_used_parallelograms];
+        if (error < best_error) {
+          best_error = error;
+          best_configuration = configuration;
+          best_num_used_parallelograms = num_used_parallelograms;
+          std::copy(multi_pred_vals.data(),
+                    multi_pred_vals.data() + num_components,
+                    best_predicted_value.data());
+          std::copy(current_residuals.data(),
+                    current_residuals.data() + num_components,
+                    best_residuals.data());
         }
       } while (
           std::next_permutation(excluded_parallelograms,
@@ -344,34 +363,28 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
     }
     if (num_parallelograms > 0) {
       total_used_parallelograms[num_parallelograms - 1] +=
-          best_prediction.num_used_parallelograms;
+          best_num_used_parallelograms;
     }
 
     // Update the entropy stream by adding selected residuals as symbols to the
     // stream.
     for (int i = 0; i < num_components; ++i) {
-      entropy_symbols_[i] =
-          ConvertSignedIntToSymbol(best_prediction.residuals[i]);
+      entropy_symbols_[i] = ConvertSignedIntToSymbol(best_residuals.data()[i]);
     }
     entropy_tracker_.Push(entropy_symbols_.data(), num_components);
 
     for (int i = 0; i < num_parallelograms; ++i) {
-      if ((best_prediction.configuration & (1 << i)) == 0) {
-        // Parallelogram not used, mark the edge as crease.
-        is_crease_edge_[num_parallelograms - 1].push_back(true);
-      } else {
-        // Parallelogram used. Add it to the predicted value and mark the
-        // edge as not a crease.
-        is_crease_edge_[num_parallelograms - 1].push_back(false);
-      }
+      // Unused parallelograms are marked as crease edges.
+      is_crease_edge_[num_parallelograms - 1].push_back(
+          (best_configuration & (1 << i)) == 0 ? 1 : 0);
     }
     this->transform().ComputeCorrection(in_data + dst_offset,
-                                        best_prediction.predicted_value.data(),
+                                        best_predicted_value.data(),
                                         out_corr + dst_offset);
   }
   // First element is always fixed because it cannot be predicted.
   for (int i = 0; i < num_components; ++i) {
-    pred_vals[0][i] = static_cast<DataTypeT>(0);
+    pred_vals[0].data()[i] = static_cast<DataTypeT>(0);
   }
   this->transform().ComputeCorrection(in_data, pred_vals[0].data(), out_corr);
   return true;
@@ -398,7 +411,7 @@ bool MeshPredictionSchemeConstrainedMultiParallelogramEncoder<
            j >= 0; j -= num_used_parallelograms) {
         // Go over all edges of the current vertex.
         for (int k = 0; k < num_used_parallelograms; ++k) {
-          encoder.EncodeBit(is_crease_edge_[i][j + k]);
+          encoder.EncodeBit(is_crease_edge_[i][j + k] != 0);
         }
       }
       encoder.EndEncoding(buffer);
@@ -15,6 +15,8 @@
 #ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_CONSTRAINED_MULTI_PARALLELOGRAM_SHARED_H_
 #define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_CONSTRAINED_MULTI_PARALLELOGRAM_SHARED_H_
 
+#include <vector>
+
 namespace draco {
 
 // Data shared between constrained multi-parallelogram encoder and decoder.
@@ -28,6 +30,31 @@ enum Mode {
 
 static constexpr int kMaxNumParallelograms = 4;
 
+// Storage for the values of all components of one attribute entry. When the
+// number of components |N| is known at compile time the values are stored on
+// the stack, otherwise (N == 0) they are allocated on the heap.
+template <typename DataTypeT, int N>
+class ComponentArray {
+ public:
+  explicit ComponentArray(int /* num_components */) {}
+  DataTypeT *data() { return values_; }
+  const DataTypeT *data() const { return values_; }
+
+ private:
+  DataTypeT values_[N];
+};
+
+template <typename DataTypeT>
+class ComponentArray<DataTypeT, 0> {
+ public:
+  explicit ComponentArray(int num_components) : values_(num_components) {}
+  DataTypeT *data() { return values_.data(); }
+  const DataTypeT *data() const { return values_.data(); }
+
+ private:
+  std::vector<DataTypeT> values_;
+};
+
 }  // namespace constrained_multi_parallelogram
 }  // namespace draco
 
@@ -0,0 +1,114 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_FEATURE_ID_DECODER_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_FEATURE_ID_DECODER_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_decoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_feature_id_shared.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/core/bit_utils.h"
+
+namespace draco {
+
+// Decoder for feature IDs encoded with the feature ID prediction scheme. See
+// the description of the corresponding encoder for more details.
+template <typename DataTypeT, class TransformT, class MeshDataT>
+class MeshPredictionSchemeFeatureIdDecoder
+    : public MeshPredictionSchemeDecoder<DataTypeT, TransformT, MeshDataT> {
+ public:
+  using CorrType =
+      typename PredictionSchemeDecoder<DataTypeT, TransformT>::CorrType;
+  using CornerTable = typename MeshDataT::CornerTable;
+  MeshPredictionSchemeFeatureIdDecoder(const PointAttribute *attribute,
+                                       const TransformT &transform,
+                                       const MeshDataT &mesh_data)
+      : MeshPredictionSchemeDecoder<DataTypeT, TransformT, MeshDataT>(
+            attribute, transform, mesh_data) {}
+
+  bool ComputeOriginalValues(const CorrType *in_corr, DataTypeT *out_data,
+                             int size, int num_components,
+                             const PointIndex *entry_to_point_id_map) override;
+
+  bool AreCorrectionsPositive() override { return true; }
+
+  PredictionSchemeMethod GetPredictionMethod() const override {
+    return MESH_PREDICTION_FEATURE_ID;
+  }
+
+  bool IsInitialized() const override {
+    return this->mesh_data().IsInitialized();
+  }
+};
+
+template <typename DataTypeT, class TransformT, class MeshDataT>
+bool MeshPredictionSchemeFeatureIdDecoder<DataTypeT, TransformT, MeshDataT>::
+    ComputeOriginalValues(const CorrType *in_corr, DataTypeT *out_data,
+                          int /* size */, int num_components,
+                          const PointIndex * /* entry_to_point_id_map */) {
+  this->transform().Init(num_components);
+  const CornerTable *const table = this->mesh_data().corner_table();
+  const std::vector<int32_t> &vertex_to_data_map =
+      *this->mesh_data().vertex_to_data_map();
+  const std::vector<CornerIndex> &data_to_corner_map =
+      *this->mesh_data().data_to_corner_map();
+  const int num_entries = static_cast<int>(data_to_corner_map.size());
+
+  FeatureIdCandidates<CornerTable, DataTypeT> candidates;
+  std::vector<DataTypeT> pred_vals(num_components);
+  std::vector<CorrType> corr_vals(num_components);
+  for (int p = 0; p < num_entries; ++p) {
+    const int offset = p * num_components;
+    const int num_candidates =
+        p == 0 ? 0
+               : candidates.Compute(p, data_to_corner_map[p], table,
+                                    vertex_to_data_map, out_data,
+                                    num_components);
+    // The corrections may be stored in |out_data| so they are read before
+    // the decoded value is written.
+    const uint32_t symbol = static_cast<uint32_t>(in_corr[offset]);
+    if (symbol < kMaxFeatureIdCandidates) {
+      if (static_cast<int>(symbol) >= num_candidates) {
+        return false;
+      }
+      const DataTypeT *const value =
+          out_data + candidates.entry(symbol) * num_components;
+      std::copy(value, value + num_components, out_data + offset);
+      continue;
+    }
+    corr_vals[0] = ConvertSymbolToSignedInt(symbol - kMaxFeatureIdCandidates);
+    for (int c = 1; c < num_components; ++c) {
+      corr_vals[c] =
+          ConvertSymbolToSignedInt(static_cast<uint32_t>(in_corr[offset + c]));
+    }
+    if (num_candidates > 0) {
+      const DataTypeT *const first =
+          out_data + candidates.entry(0) * num_components;
+      std::copy(first, first + num_components, pred_vals.begin());
+    } else {
+      std::fill(pred_vals.begin(), pred_vals.end(), 0);
+    }
+    this->transform().ComputeOriginalValue(pred_vals.data(), corr_vals.data(),
+                                           out_data + offset);
+  }
+  return true;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_FEATURE_ID_DECODER_H_
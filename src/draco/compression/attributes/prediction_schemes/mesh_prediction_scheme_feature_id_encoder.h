@@ -0,0 +1,137 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_FEATURE_ID_ENCODER_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_FEATURE_ID_ENCODER_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_encoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_feature_id_shared.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/core/bit_utils.h"
+
+namespace draco {
+
+// Prediction scheme for feature IDs, e.g., the feature ID attributes of
+// EXT_mesh_features or classification properties of EXT_structural_metadata.
+// Such values are constant over large regions of the mesh, so each value is
+// coded as the index of one of the candidate values taken from the already
+// encoded neighboring vertices, see FeatureIdCandidates. Values that differ
+// from all candidates are coded as an escape followed by their correction
+// against the first candidate. Inside of the regions nearly all values are
+// coded as the first candidate, so the entropy coding stores the runs of equal
+// values at a small fraction of a bit per value, while values along region
+// boundaries usually refer to one of the other candidates.
+//
+// The corrections are non-negative symbols. The first component of an entry
+// stores either the index of the candidate or kMaxFeatureIdCandidates plus the
+// zigzag coded correction of the first component. The other components store
+// zero for candidates or their zigzag coded corrections for escapes.
+template <typename DataTypeT, class TransformT, class MeshDataT>
+class MeshPredictionSchemeFeatureIdEncoder
+    : public MeshPredictionSchemeEncoder<DataTypeT, TransformT, MeshDataT> {
+ public:
+  using CorrType =
+      typename PredictionSchemeEncoder<DataTypeT, TransformT>::CorrType;
+  using CornerTable = typename MeshDataT::CornerTable;
+  MeshPredictionSchemeFeatureIdEncoder(const PointAttribute *attribute,
+                                       const TransformT &transform,
+                                       const MeshDataT &mesh_data)
+      : MeshPredictionSchemeEncoder<DataTypeT, TransformT, MeshDataT>(
+            attribute, transform, mesh_data) {}
+
+  bool ComputeCorrectionValues(
+      const DataTypeT *in_data, CorrType *out_corr, int size,
+      int num_components, const PointIndex *entry_to_point_id_map) override;
+
+  bool AreCorrectionsPositive() override { return true; }
+
+  PredictionSchemeMethod GetPredictionMethod() const override {
+    return MESH_PREDICTION_FEATURE_ID;
+  }
+
+  bool IsInitialized() const override {
+    return this->mesh_data().IsInitialized();
+  }
+};
+
+template <typename DataTypeT, class TransformT, class MeshDataT>
+bool MeshPredictionSchemeFeatureIdEncoder<DataTypeT, TransformT, MeshDataT>::
+    ComputeCorrectionValues(const DataTypeT *in_data, CorrType *out_corr,
+                            int size, int num_components,
+                            const PointIndex * /* entry_to_point_id_map */) {
+  this->transform().Init(in_data, size, num_components);
+  const CornerTable *const table = this->mesh_data().corner_table();
+  const std::vector<int32_t> &vertex_to_data_map =
+      *this->mesh_data().vertex_to_data_map();
+  const std::vector<CornerIndex> &data_to_corner_map =
+      *this->mesh_data().data_to_corner_map();
+  const int num_entries = static_cast<int>(data_to_corner_map.size());
+
+  FeatureIdCandidates<CornerTable, DataTypeT> candidates;
+  std::vector<DataTypeT> pred_vals(num_components);
+  std::vector<CorrType> corr_vals(num_components);
+  for (int p = 0; p < num_entries; ++p) {
+    const int offset = p * num_components;
+    const DataTypeT *const value = in_data + offset;
+    // The first value has no candidates.
+    const int num_candidates =
+        p == 0 ? 0
+               : candidates.Compute(p, data_to_corner_map[p], table,
+                                    vertex_to_data_map, in_data,
+                                    num_components);
+    int candidate = 0;
+    for (; candidate < num_candidates; ++candidate) {
+      const DataTypeT *const candidate_value =
+          in_data + candidates.entry(candidate) * num_components;
+      if (std::equal(value, value + num_components, candidate_value)) {
+        break;
+      }
+    }
+    if (candidate < num_candidates) {
+      out_corr[offset] = candidate;
+      std::fill(out_corr + offset + 1, out_corr + offset + num_components, 0);
+      continue;
+    }
+    if (num_candidates > 0) {
+      const DataTypeT *const first =
+          in_data + candidates.entry(0) * num_components;
+      std::copy(first, first + num_components, pred_vals.begin());
+    } else {
+      std::fill(pred_vals.begin(), pred_vals.end(), 0);
+    }
+    this->transform().ComputeCorrection(value, pred_vals.data(),
+                                        corr_vals.data());
+    for (int c = 0; c < num_components; ++c) {
+      uint32_t symbol = ConvertSignedIntToSymbol(corr_vals[c]);
+      if (c == 0) {
+        if (symbol > std::numeric_limits<uint32_t>::max() -
+                         kMaxFeatureIdCandidates) {
+          return false;
+        }
+        symbol += kMaxFeatureIdCandidates;
+      }
+      out_corr[offset + c] = static_cast<CorrType>(symbol);
+    }
+  }
+  return true;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_FEATURE_ID_ENCODER_H_
@@ -0,0 +1,138 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Shared functionality for the feature ID prediction scheme.
+
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_FEATURE_ID_SHARED_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_FEATURE_ID_SHARED_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "draco/mesh/corner_table.h"
+#include "draco/mesh/corner_table_iterators.h"
+
+namespace draco {
+
+// Maximum number of candidate values of a feature ID, see
+// FeatureIdCandidates.
+constexpr int kMaxFeatureIdCandidates = 4;
+
+// Computes the candidate values of feature IDs. Feature IDs are constant over
+// large regions of the mesh, so the value of an entry is usually equal to the
+// value of one of its already processed neighbors. The candidates are the
+// distinct values of the processed neighbors of the vertex of an entry. The
+// value of the previous entry in the traversal order comes first when one of
+// the neighbors shares it, because it continues the current run of equal
+// values. The other values are ordered by the number of neighbors sharing them
+// and then by how recently they were processed. When the value of the previous
+// entry is not shared by any neighbor, it is added as the last candidate.
+template <class CornerTableT, typename DataTypeT>
+class FeatureIdCandidates {
+ public:
+  // Computes the candidates of the entry |data_entry_id| > 0 attached to the
+  // corner |ci| from the already processed entries of |data|. Returns the
+  // number of candidates. Their values are accessible via entry().
+  int Compute(int data_entry_id, CornerIndex ci, const CornerTableT *table,
+              const std::vector<int32_t> &vertex_to_data_map,
+              const DataTypeT *data, int num_components) {
+    const auto values_equal = [data, num_components](int a, int b) {
+      return std::equal(data + a * num_components,
+                        data + (a + 1) * num_components,
+                        data + b * num_components);
+    };
+    // Group the processed neighbors by their values. Each group stores the
+    // most recently processed entry with the value and the number of
+    // neighbors sharing it.
+    groups_.clear();
+    for (VertexCornersIterator<CornerTableT> it(table, ci); !it.End();
+         it.Next()) {
+      // Both the next and the previous corners are needed to reach all
+      // neighbors of vertices on open boundaries.
+      const CornerIndex corners[2] = {table->Next(it.Corner()),
+                                      table->Previous(it.Corner())};
+      for (const CornerIndex corner : corners) {
+        const int entry = vertex_to_data_map[table->Vertex(corner).value()];
+        if (entry < 0 || entry >= data_entry_id) {
+          continue;
+        }
+        bool found = false;
+        for (Group &group : groups_) {
+          if (values_equal(group.entry, entry)) {
+            group.entry = std::max(group.entry, entry);
+            ++group.count;
+            found = true;
+            break;
+          }
+        }
+        if (!found) {
+          groups_.push_back({entry, 1, false});
+        }
+      }
+    }
+    const int previous_entry = data_entry_id - 1;
+    bool previous_found = false;
+    for (Group &group : groups_) {
+      if (values_equal(group.entry, previous_entry)) {
+        group.continues_run = true;
+        previous_found = true;
+        break;
+      }
+    }
+    std::sort(groups_.begin(), groups_.end(),
+              [](const Group &a, const Group &b) {
+                if (a.continues_run != b.continues_run) {
+                  return a.continues_run;
+                }
+                if (a.count != b.count) {
+                  return a.count > b.count;
+                }
+                return a.entry > b.entry;
+              });
+    num_candidates_ = 0;
+    for (const Group &group : groups_) {
+      if (num_candidates_ == kMaxFeatureIdCandidates) {
+        break;
+      }
+      candidate_entries_[num_candidates_++] = group.entry;
+    }
+    if (!previous_found) {
+      if (num_candidates_ == kMaxFeatureIdCandidates) {
+        --num_candidates_;
+      }
+      candidate_entries_[num_candidates_++] = previous_entry;
+    }
+    return num_candidates_;
+  }
+
+  int num_candidates() const { return num_candidates_; }
+
+  // Returns the entry holding the value of the candidate |i|.
+  int entry(int i) const { return candidate_entries_[i]; }
+
+ private:
+  struct Group {
+    int entry;
+    int count;
+    bool continues_run;
+  };
+  std::vector<Group> groups_;
+  int candidate_entries_[kMaxFeatureIdCandidates];
+  int num_candidates_ = 0;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_FEATURE_ID_SHARED_H_
@@ -0,0 +1,169 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/decode.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/mesh/mesh.h"
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include "draco/mesh/mesh_features.h"
+#endif
+
+namespace draco {
+
+class MeshPredictionSchemeFeatureIdTest : public ::testing::Test {
+ protected:
+  static constexpr int kGridSize = 4;
+
+  void SetUp() override {
+    mesh_ = ReadMeshFromTestFile("bunny_norm.obj");
+    ASSERT_NE(mesh_, nullptr);
+    // Keep only the positions so that the encoded size depends mostly on the
+    // feature IDs.
+    for (int i = mesh_->num_attributes() - 1; i >= 0; --i) {
+      if (mesh_->attribute(i)->attribute_type() !=
+          GeometryAttribute::POSITION) {
+        mesh_->DeleteAttribute(i);
+      }
+    }
+    AddFeatureIdAttribute();
+  }
+
+  // Adds a feature ID attribute that assigns the same feature ID to all points
+  // in a cell of a |kGridSize|^3 grid over the bounding box of the mesh. As
+  // in typical feature ID data, the IDs are not correlated between cells.
+  void AddFeatureIdAttribute() {
+    const PointAttribute *const pos_att =
+        mesh_->GetNamedAttribute(GeometryAttribute::POSITION);
+    std::array<float, 3> min_pos;
+    std::array<float, 3> max_pos;
+    min_pos.fill(std::numeric_limits<float>::max());
+    max_pos.fill(std::numeric_limits<float>::lowest());
+    for (AttributeValueIndex i(0); i < pos_att->size(); ++i) {
+      std::array<float, 3> pos;
+      pos_att->GetValue(i, &pos);
+      for (int c = 0; c < 3; ++c) {
+        min_pos[c] = std::min(min_pos[c], pos[c]);
+        max_pos[c] = std::max(max_pos[c], pos[c]);
+      }
+    }
+
+    std::unique_ptr<PointAttribute> feature_id_att(new PointAttribute());
+    feature_id_att->Init(GeometryAttribute::GENERIC, 1, DT_UINT16, false,
+                         mesh_->num_points());
+    for (PointIndex i(0); i < mesh_->num_points(); ++i) {
+      std::array<float, 3> pos;
+      pos_att->GetMappedValue(i, &pos);
+      int cell = 0;
+      for (int c = 0; c < 3; ++c) {
+        const float t = (pos[c] - min_pos[c]) / (max_pos[c] - min_pos[c]);
+        cell = cell * kGridSize +
+               std::min(kGridSize - 1, static_cast<int>(t * kGridSize));
+      }
+      const uint16_t feature_id = static_cast<uint16_t>((cell * 7919) % 1000);
+      feature_id_att->SetAttributeValue(AttributeValueIndex(i.value()),
+                                        &feature_id);
+    }
+    feature_id_att_id_ = mesh_->AddAttribute(std::move(feature_id_att));
+  }
+
+  // Encodes the mesh using |prediction_scheme| for the feature IDs. The
+  // positions are not quantized so that they can be used to match the
+  // decoded points with the original points.
+  void Encode(int prediction_scheme, EncoderBuffer *buffer) {
+    ExpertEncoder encoder(*mesh_);
+    DRACO_ASSERT_OK(encoder.SetAttributePredictionScheme(feature_id_att_id_,
+                                                         prediction_scheme));
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(buffer));
+  }
+
+  std::unique_ptr<Mesh> mesh_;
+  int feature_id_att_id_ = -1;
+};
+
+TEST_F(MeshPredictionSchemeFeatureIdTest, EncodeDecode) {
+  EncoderBuffer buffer;
+  Encode(MESH_PREDICTION_FEATURE_ID, &buffer);
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(buffer.data(), buffer.size());
+  Decoder decoder;
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Mesh> decoded_mesh,
+                         decoder.DecodeMeshFromBuffer(&dec_buffer));
+  ASSERT_EQ(decoded_mesh->num_faces(), mesh_->num_faces());
+
+  // The decoded points are in a different order so the feature IDs are
+  // compared using the positions of the points that are unique for the bunny.
+  std::map<std::array<float, 3>, uint16_t> feature_ids;
+  const PointAttribute *const pos_att =
+      mesh_->GetNamedAttribute(GeometryAttribute::POSITION);
+  for (PointIndex i(0); i < mesh_->num_points(); ++i) {
+    std::array<float, 3> pos;
+    pos_att->GetMappedValue(i, &pos);
+    mesh_->attribute(feature_id_att_id_)
+        ->GetMappedValue(i, &feature_ids[pos]);
+  }
+  const PointAttribute *const decoded_pos_att =
+      decoded_mesh->GetNamedAttribute(GeometryAttribute::POSITION);
+  for (PointIndex i(0); i < decoded_mesh->num_points(); ++i) {
+    std::array<float, 3> pos;
+    decoded_pos_att->GetMappedValue(i, &pos);
+    const auto it = feature_ids.find(pos);
+    ASSERT_NE(it, feature_ids.end());
+    uint16_t feature_id;
+    decoded_mesh->attribute(feature_id_att_id_)
+        ->GetMappedValue(i, &feature_id);
+    ASSERT_EQ(feature_id, it->second);
+  }
+}
+
+TEST_F(MeshPredictionSchemeFeatureIdTest, CompressesBetterThanOtherSchemes) {
+  EncoderBuffer feature_id_buffer;
+  Encode(MESH_PREDICTION_FEATURE_ID, &feature_id_buffer);
+  for (const int scheme :
+       {PREDICTION_DIFFERENCE, MESH_PREDICTION_PARALLELOGRAM,
+        MESH_PREDICTION_CONSTRAINED_MULTI_PARALLELOGRAM, MESH_PREDICTION_SKIN}) {
+    EncoderBuffer buffer;
+    Encode(scheme, &buffer);
+    ASSERT_LT(feature_id_buffer.size(), buffer.size()) << scheme;
+  }
+}
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+TEST_F(MeshPredictionSchemeFeatureIdTest, NotSelectedForMeshFeatures) {
+  EncoderBuffer parallelogram_buffer;
+  Encode(MESH_PREDICTION_PARALLELOGRAM, &parallelogram_buffer);
+
+  // The feature ID prediction must be requested explicitly. Attributes
+  // referenced by mesh features use the default prediction.
+  std::unique_ptr<MeshFeatures> mesh_features(new MeshFeatures());
+  mesh_features->SetAttributeIndex(feature_id_att_id_);
+  mesh_->AddMeshFeatures(std::move(mesh_features));
+  ExpertEncoder encoder(*mesh_);
+  EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(&buffer));
+  ASSERT_EQ(buffer.size(), parallelogram_buffer.size());
+}
+#endif  // DRACO_TRANSCODER_SUPPORTED
+
+}  // namespace draco
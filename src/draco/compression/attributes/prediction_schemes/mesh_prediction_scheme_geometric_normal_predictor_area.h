@@ -42,43 +42,54 @@ class MeshPredictionSchemeGeometricNormalPredictorArea
     DRACO_DCHECK(this->IsInitialized());
     typedef typename MeshDataT::CornerTable CornerTable;
     const CornerTable *const corner_table = this->mesh_data_.corner_table();
-    // Going to compute the predicted normal from the surrounding triangles
-    // according to the connectivity of the given corner table.
-    VertexCornersIterator<CornerTable> cit(corner_table, corner_id);
     // Position of central vertex does not change in loop.
     const VectorD<int64_t, 3> pos_cent = this->GetPositionForCorner(corner_id);
     // Computing normals for triangles and adding them up.
 
     VectorD<int64_t, 3> normal;
-    CornerIndex c_next, c_prev;
-    while (!cit.End()) {
-      // Getting corners.
-      if (this->normal_prediction_mode_ == ONE_TRIANGLE) {
-        c_next = corner_table->Next(corner_id);
-        c_prev = corner_table->Previous(corner_id);
-      } else {
-        c_next = corner_table->Next(cit.Corner());
-        c_prev = corner_table->Previous(cit.Corner());
-      }
-      const VectorD<int64_t, 3> pos_next = this->GetPositionForCorner(c_next);
-      const VectorD<int64_t, 3> pos_prev = this->GetPositionForCorner(c_prev);
-
-      // Computing delta vectors to next and prev.
-      const VectorD<int64_t, 3> delta_next = pos_next - pos_cent;
-      const VectorD<int64_t, 3> delta_prev = pos_prev - pos_cent;
+    // Going to compute the predicted normal from the surrounding triangles
+    // according to the connectivity of the given corner table. The position
+    // values of all triangles of a batch are looked up before they are used.
+    VisitVertexCornerBatches(
+        corner_table, corner_id,
+        [&](const CornerIndex *ring_corners, int num_corners) {
+          AttributeValueIndex next_ids[kMaxVertexCornersBatchSize];
+          AttributeValueIndex prev_ids[kMaxVertexCornersBatchSize];
+          for (int i = 0; i < num_corners; ++i) {
+            // Getting corners.
+            CornerIndex c_next, c_prev;
+            if (this->normal_prediction_mode_ == ONE_TRIANGLE) {
+              c_next = corner_table->Next(corner_id);
+              c_prev = corner_table->Previous(corner_id);
+            } else {
+              c_next = corner_table->Next(ring_corners[i]);
+              c_prev = corner_table->Previous(ring_corners[i]);
+            }
+            next_ids[i] = this->GetPositionValueIdForCorner(c_next);
+            prev_ids[i] = this->GetPositionValueIdForCorner(c_prev);
+          }
+          for (int i = 0; i < num_corners; ++i) {
+            const VectorD<int64_t, 3> pos_next =
+                this->GetPositionForValueId(next_ids[i]);
+            const VectorD<int64_t, 3> pos_prev =
+                this->GetPositionForValueId(prev_ids[i]);
 
-      // Computing cross product.
-      const VectorD<int64_t, 3> cross = CrossProduct(delta_next, delta_prev);
+            // Computing delta vectors to next and prev.
+            const VectorD<int64_t, 3> delta_next = pos_next - pos_cent;
+            const VectorD<int64_t, 3> delta_prev = pos_prev - pos_cent;
 
-      // Prevent signed integer overflows by doing math as unsigned.
-      auto normal_data = reinterpret_cast<uint64_t *>(normal.data());
-      auto cross_data = reinterpret_cast<const uint64_t *>(cross.data());
-      normal_data[0] = normal_data[0] + cross_data[0];
-      normal_data[1] = normal_data[1] + cross_data[1];
-      normal_data[2] = normal_data[2] + cross_data[2];
+            // Computing cross product.
+            const VectorD<int64_t, 3> cross =
+                CrossProduct(delta_next, delta_prev);
 
-      cit.Next();
-    }
+            // Prevent signed integer overflows by doing math as unsigned.
+            auto normal_data = reinterpret_cast<uint64_t *>(normal.data());
+            auto cross_data = reinterpret_cast<const uint64_t *>(cross.data());
+            normal_data[0] = normal_data[0] + cross_data[0];
+            normal_data[1] = normal_data[1] + cross_data[1];
+            normal_data[2] = normal_data[2] + cross_data[2];
+          }
+        });
 
     // Convert to int32_t, make sure entries are not too large.
     constexpr int64_t upper_bound = 1 << 29;
@@ -20,6 +20,7 @@
 #include "draco/attributes/point_attribute.h"
 #include "draco/compression/attributes/normal_compression_utils.h"
 #include "draco/compression/config/compression_shared.h"
+#include "draco/core/macros.h"
 #include "draco/core/math_utils.h"
 #include "draco/core/vector_d.h"
 #include "draco/mesh/corner_table.h"
@@ -63,17 +64,30 @@ class MeshPredictionSchemeGeometricNormalPredictorBase {
   VectorD<int64_t, 3> GetPositionForDataId(int data_id) const {
     DRACO_DCHECK(this->IsInitialized());
     const auto point_id = entry_to_point_id_map_[data_id];
-    const auto pos_val_id = pos_attribute_->mapped_index(point_id);
-    VectorD<int64_t, 3> pos;
-    pos_attribute_->ConvertValue(pos_val_id, &pos[0]);
-    return pos;
+    return GetPositionForValueId(pos_attribute_->mapped_index(point_id));
   }
   VectorD<int64_t, 3> GetPositionForCorner(CornerIndex ci) const {
+    return GetPositionForValueId(GetPositionValueIdForCorner(ci));
+  }
+  // Returns the index of the position value of corner |ci| and prefetches the
+  // value, so that it can be loaded while other corners are looked up. The
+  // value is then obtained with GetPositionForValueId().
+  AttributeValueIndex GetPositionValueIdForCorner(CornerIndex ci) const {
     DRACO_DCHECK(this->IsInitialized());
     const auto corner_table = mesh_data_.corner_table();
     const auto vert_id = corner_table->Vertex(ci).value();
     const auto data_id = mesh_data_.vertex_to_data_map()->at(vert_id);
-    return GetPositionForDataId(data_id);
+    const auto point_id = entry_to_point_id_map_[data_id];
+    const AttributeValueIndex pos_val_id =
+        pos_attribute_->mapped_index(point_id);
+    DRACO_PREFETCH(pos_attribute_->GetAddress(pos_val_id));
+    return pos_val_id;
+  }
+  VectorD<int64_t, 3> GetPositionForValueId(
+      AttributeValueIndex pos_val_id) const {
+    VectorD<int64_t, 3> pos;
+    pos_attribute_->ConvertValue(pos_val_id, &pos[0]);
+    return pos;
   }
   VectorD<int32_t, 2> GetOctahedralCoordForDataId(int data_id,
                                                   const DataTypeT *data) const {
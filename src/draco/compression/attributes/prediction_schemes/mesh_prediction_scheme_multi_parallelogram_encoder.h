@@ -17,6 +17,7 @@
 
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_encoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_parallelogram_shared.h"
+#include "draco/mesh/corner_table_iterators.h"
 
 namespace draco {
 
@@ -83,27 +84,28 @@ bool MeshPredictionSchemeMultiParallelogramEncoder<DataTypeT, TransformT,
 
     // Go over all corners attached to the vertex and compute the predicted
     // value from the parallelograms defined by their opposite faces.
-    CornerIndex corner_id(start_corner_id);
     int num_parallelograms = 0;
     for (int i = 0; i < num_components; ++i) {
       pred_vals[i] = static_cast<DataTypeT>(0);
     }
-    while (corner_id != kInvalidCornerIndex) {
-      if (ComputeParallelogramPrediction(
-              p, corner_id, table, *vertex_to_data_map, in_data, num_components,
-              parallelogram_pred_vals.get())) {
-        for (int c = 0; c < num_components; ++c) {
-          pred_vals[c] += parallelogram_pred_vals[c];
-        }
-        ++num_parallelograms;
-      }
-
-      // Proceed to the next corner attached to the vertex.
-      corner_id = table->SwingRight(corner_id);
-      if (corner_id == start_corner_id) {
-        corner_id = kInvalidCornerIndex;
-      }
-    }
+    // Visit the corners attached to the vertex by swinging right. The entries
+    // of all parallelograms of a batch are gathered before their data is used.
+    VisitVertexCornerBatchesSwingRight(
+        table, start_corner_id,
+        [&](const CornerIndex *corners, int num_corners) {
+          ParallelogramEntries entries[kMaxVertexCornersBatchSize];
+          const int num_entries = GatherParallelogramEntries(
+              p, corners, num_corners, table, *vertex_to_data_map, in_data,
+              num_components, entries);
+          for (int i = 0; i < num_entries; ++i) {
+            ComputeParallelogramPrediction(entries[i], in_data, num_components,
+                                           parallelogram_pred_vals.get());
+            for (int c = 0; c < num_components; ++c) {
+              pred_vals[c] += parallelogram_pred_vals[c];
+            }
+          }
+          num_parallelograms += num_entries;
+        });
     const int dst_offset = p * num_components;
     if (num_parallelograms == 0) {
       // No parallelogram was valid.
@@ -15,8 +15,11 @@
 #ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_PARALLELOGRAM_DECODER_H_
 #define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_PARALLELOGRAM_DECODER_H_
 
+#include <type_traits>
+
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_decoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_parallelogram_shared.h"
+#include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_decoding_transform.h"
 
 namespace draco {
 
@@ -50,6 +53,25 @@ class MeshPredictionSchemeParallelogramDecoder
   bool IsInitialized() const override {
     return this->mesh_data().IsInitialized();
   }
+
+ private:
+  // True when the fast path for 3-component values can be used.
+  typedef std::is_same<TransformT,
+                       PredictionSchemeWrapDecodingTransform<int32_t, int32_t>>
+      HasWrapTransform;
+
+  // Generic implementation for any transform and any number of components.
+  void ComputeOriginalValuesGeneric(const CorrType *in_corr,
+                                    DataTypeT *out_data, int num_components);
+
+  // Specialized implementation for three component values (e.g. quantized
+  // positions) decoded with the wrap transform.
+  void ComputeOriginalValues3(const CorrType *in_corr, DataTypeT *out_data,
+                              std::true_type /* has_wrap_transform */);
+  void ComputeOriginalValues3(const CorrType *in_corr, DataTypeT *out_data,
+                              std::false_type /* has_wrap_transform */) {
+    ComputeOriginalValuesGeneric(in_corr, out_data, 3);
+  }
 };
 
 template <typename DataTypeT, class TransformT, class MeshDataT>
@@ -59,7 +81,19 @@ bool MeshPredictionSchemeParallelogramDecoder<DataTypeT, TransformT,
                           int /* size */, int num_components,
                           const PointIndex * /* entry_to_point_id_map */) {
   this->transform().Init(num_components);
+  if (num_components == 3) {
+    ComputeOriginalValues3(in_corr, out_data, HasWrapTransform());
+  } else {
+    ComputeOriginalValuesGeneric(in_corr, out_data, num_components);
+  }
+  return true;
+}
 
+template <typename DataTypeT, class TransformT, class MeshDataT>
+void MeshPredictionSchemeParallelogramDecoder<DataTypeT, TransformT,
+                                              MeshDataT>::
+    ComputeOriginalValuesGeneric(const CorrType *in_corr, DataTypeT *out_data,
+                                 int num_components) {
   const CornerTable *const table = this->mesh_data().corner_table();
   const std::vector<int32_t> *const vertex_to_data_map =
       this->mesh_data().vertex_to_data_map();
@@ -90,7 +124,72 @@ bool MeshPredictionSchemeParallelogramDecoder<DataTypeT, TransformT,
           pred_vals.get(), in_corr + dst_offset, out_data + dst_offset);
     }
   }
-  return true;
+}
+
+template <typename DataTypeT, class TransformT, class MeshDataT>
+void MeshPredictionSchemeParallelogramDecoder<DataTypeT, TransformT,
+                                              MeshDataT>::
+    ComputeOriginalValues3(const CorrType *in_corr, DataTypeT *out_data,
+                           std::true_type /* has_wrap_transform */) {
+  const CornerTable *const table = this->mesh_data().corner_table();
+  const std::vector<int32_t> &vertex_to_data_map =
+      *this->mesh_data().vertex_to_data_map();
+  const std::vector<CornerIndex> &data_to_corner_map =
+      *this->mesh_data().data_to_corner_map();
+  const TransformT &transform = this->transform();
+
+  // Restore the first value.
+  int32_t pred_vals[3] = {0, 0, 0};
+  transform.ComputeOriginalValue3(pred_vals, in_corr, out_data);
+
+  // The entries of the parallelogram used to predict a value depend only on
+  // the connectivity, so they are fetched one value ahead to overlap the
+  // corner table lookups with the decoding of the previous value. Returns
+  // false when the value has no opposite corner.
+  const auto fetch_entries = [&](int p, ParallelogramEntries *entries) {
+    const CornerIndex oci = table->Opposite(data_to_corner_map[p]);
+    if (oci == kInvalidCornerIndex) {
+      return false;
+    }
+    GetParallelogramEntries(oci, table, vertex_to_data_map, &entries->opp,
+                            &entries->next, &entries->prev);
+    return true;
+  };
+
+  const int corner_map_size = static_cast<int>(data_to_corner_map.size());
+  ParallelogramEntries next_entries = {0, 0, 0};
+  bool next_has_opposite = false;
+  if (corner_map_size > 1) {
+    next_has_opposite = fetch_entries(1, &next_entries);
+  }
+  for (int p = 1; p < corner_map_size; ++p) {
+    const ParallelogramEntries entries = next_entries;
+    const bool has_opposite = next_has_opposite;
+    if (p + 1 < corner_map_size) {
+      next_has_opposite = fetch_entries(p + 1, &next_entries);
+    }
+    const int32_t *const corr = in_corr + 3 * p;
+    int32_t *const out = out_data + 3 * p;
+    if (has_opposite && entries.opp < p && entries.next < p &&
+        entries.prev < p) {
+      // Apply the parallelogram prediction. See
+      // ComputeParallelogramPrediction().
+      const int32_t *const opp_val = out_data + 3 * entries.opp;
+      const int32_t *const next_val = out_data + 3 * entries.next;
+      const int32_t *const prev_val = out_data + 3 * entries.prev;
+      for (int c = 0; c < 3; ++c) {
+        pred_vals[c] = static_cast<int32_t>(
+            (static_cast<int64_t>(next_val[c]) +
+             static_cast<int64_t>(prev_val[c])) -
+            static_cast<int64_t>(opp_val[c]));
+      }
+      transform.ComputeOriginalValue3(pred_vals, corr, out);
+    } else {
+      // Parallelogram could not be computed. Use the last decoded value as a
+      // reference (delta coding).
+      transform.ComputeOriginalValue3(out - 3, corr, out);
+    }
+  }
 }
 
 }  // namespace draco
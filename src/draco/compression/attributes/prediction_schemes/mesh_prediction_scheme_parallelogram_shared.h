@@ -17,6 +17,7 @@
 #ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_PARALLELOGRAM_SHARED_H_
 #define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_PARALLELOGRAM_SHARED_H_
 
+#include "draco/core/macros.h"
 #include "draco/mesh/corner_table.h"
 #include "draco/mesh/mesh.h"
 
@@ -37,6 +38,33 @@ inline void GetParallelogramEntries(
   *prev_entry = vertex_to_data_map[table->Vertex(table->Previous(ci)).value()];
 }
 
+// Data entries of the vertices of a parallelogram.
+struct ParallelogramEntries {
+  int opp;
+  int next;
+  int prev;
+};
+
+// Computes the parallelogram prediction from the data of |entries|.
+template <typename DataTypeT>
+inline void ComputeParallelogramPrediction(const ParallelogramEntries &entries,
+                                           const DataTypeT *in_data,
+                                           int num_components,
+                                           DataTypeT *out_prediction) {
+  const int v_opp_off = entries.opp * num_components;
+  const int v_next_off = entries.next * num_components;
+  const int v_prev_off = entries.prev * num_components;
+  for (int c = 0; c < num_components; ++c) {
+    const int64_t in_data_next_off = in_data[v_next_off + c];
+    const int64_t in_data_prev_off = in_data[v_prev_off + c];
+    const int64_t in_data_opp_off = in_data[v_opp_off + c];
+    const int64_t result =
+        (in_data_next_off + in_data_prev_off) - in_data_opp_off;
+
+    out_prediction[c] = static_cast<DataTypeT>(result);
+  }
+}
+
 // Computes parallelogram prediction for a given corner and data entry id.
 // The prediction is stored in |out_prediction|.
 // Function returns false when the prediction couldn't be computed, e.g. because
@@ -50,29 +78,50 @@ inline bool ComputeParallelogramPrediction(
   if (oci == kInvalidCornerIndex) {
     return false;
   }
-  int vert_opp, vert_next, vert_prev;
+  ParallelogramEntries entries;
   GetParallelogramEntries<CornerTableT>(oci, table, vertex_to_data_map,
-                                        &vert_opp, &vert_next, &vert_prev);
-  if (vert_opp < data_entry_id && vert_next < data_entry_id &&
-      vert_prev < data_entry_id) {
-    // Apply the parallelogram prediction.
-    const int v_opp_off = vert_opp * num_components;
-    const int v_next_off = vert_next * num_components;
-    const int v_prev_off = vert_prev * num_components;
-    for (int c = 0; c < num_components; ++c) {
-      const int64_t in_data_next_off = in_data[v_next_off + c];
-      const int64_t in_data_prev_off = in_data[v_prev_off + c];
-      const int64_t in_data_opp_off = in_data[v_opp_off + c];
-      const int64_t result =
-          (in_data_next_off + in_data_prev_off) - in_data_opp_off;
-
-      out_prediction[c] = static_cast<DataTypeT>(result);
-    }
+                                        &entries.opp, &entries.next,
+                                        &entries.prev);
+  if (entries.opp < data_entry_id && entries.next < data_entry_id &&
+      entries.prev < data_entry_id) {
+    ComputeParallelogramPrediction(entries, in_data, num_components,
+                                   out_prediction);
     return true;
   }
   return false;  // Not all data is available for prediction
 }
 
+// Batch version of ComputeParallelogramPrediction() for the parallelograms
+// defined by the opposite faces of |num_corners| |corners|. Stores the entries
+// of the parallelograms that can be used for predicting |data_entry_id| in
+// |entries| and returns their number. The data of the entries is prefetched,
+// so that it can be loaded while the entries of other corners are looked up.
+template <class CornerTableT, typename DataTypeT>
+inline int GatherParallelogramEntries(
+    int data_entry_id, const CornerIndex *corners, int num_corners,
+    const CornerTableT *table, const std::vector<int32_t> &vertex_to_data_map,
+    const DataTypeT *in_data, int num_components,
+    ParallelogramEntries *entries) {
+  int num_entries = 0;
+  for (int i = 0; i < num_corners; ++i) {
+    const CornerIndex oci = table->Opposite(corners[i]);
+    if (oci == kInvalidCornerIndex) {
+      continue;
+    }
+    ParallelogramEntries &e = entries[num_entries];
+    GetParallelogramEntries<CornerTableT>(oci, table, vertex_to_data_map,
+                                          &e.opp, &e.next, &e.prev);
+    if (e.opp < data_entry_id && e.next < data_entry_id &&
+        e.prev < data_entry_id) {
+      DRACO_PREFETCH(in_data + e.opp * num_components);
+      DRACO_PREFETCH(in_data + e.next * num_components);
+      DRACO_PREFETCH(in_data + e.prev * num_components);
+      ++num_entries;
+    }
+  }
+  return num_entries;
+}
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_PARALLELOGRAM_SHARED_H_
@@ -0,0 +1,133 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_SKIN_DECODER_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_SKIN_DECODER_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_decoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_skin_shared.h"
+#include "draco/compression/config/compression_shared.h"
+
+namespace draco {
+
+// Decoder for skinning attributes encoded with the skin prediction scheme. See
+// the description of the corresponding encoder for more details.
+template <typename DataTypeT, class TransformT, class MeshDataT>
+class MeshPredictionSchemeSkinDecoder
+    : public MeshPredictionSchemeDecoder<DataTypeT, TransformT, MeshDataT> {
+ public:
+  using CorrType =
+      typename PredictionSchemeDecoder<DataTypeT, TransformT>::CorrType;
+  using CornerTable = typename MeshDataT::CornerTable;
+  MeshPredictionSchemeSkinDecoder(const PointAttribute *attribute,
+                                  const TransformT &transform,
+                                  const MeshDataT &mesh_data)
+      : MeshPredictionSchemeDecoder<DataTypeT, TransformT, MeshDataT>(
+            attribute, transform, mesh_data),
+        use_parallelogram_(false),
+        use_weight_sum_(false),
+        weight_sum_(0) {}
+
+  bool ComputeOriginalValues(const CorrType *in_corr, DataTypeT *out_data,
+                             int size, int num_components,
+                             const PointIndex *entry_to_point_id_map) override;
+
+  bool DecodePredictionData(DecoderBuffer *buffer) override;
+
+  PredictionSchemeMethod GetPredictionMethod() const override {
+    return MESH_PREDICTION_SKIN;
+  }
+
+  bool IsInitialized() const override {
+    return this->mesh_data().IsInitialized();
+  }
+
+ private:
+  bool use_parallelogram_;
+  bool use_weight_sum_;
+  int64_t weight_sum_;
+};
+
+template <typename DataTypeT, class TransformT, class MeshDataT>
+bool MeshPredictionSchemeSkinDecoder<DataTypeT, TransformT, MeshDataT>::
+    ComputeOriginalValues(const CorrType *in_corr, DataTypeT *out_data,
+                          int /* size */, int num_components,
+                          const PointIndex * /* entry_to_point_id_map */) {
+  if (use_weight_sum_ && num_components < 2) {
+    return false;
+  }
+  this->transform().Init(num_components);
+  const CornerTable *const table = this->mesh_data().corner_table();
+  const std::vector<int32_t> &vertex_to_data_map =
+      *this->mesh_data().vertex_to_data_map();
+  const std::vector<CornerIndex> &data_to_corner_map =
+      *this->mesh_data().data_to_corner_map();
+  const int num_entries = static_cast<int>(data_to_corner_map.size());
+
+  // For storage of prediction values (already initialized to zero).
+  std::unique_ptr<DataTypeT[]> pred_vals(new DataTypeT[num_components]());
+  // The corrections may be stored in |out_data| so they are copied before
+  // they are overwritten by the first of the two decoding passes below.
+  std::unique_ptr<CorrType[]> corr_vals(new CorrType[num_components]());
+  for (int p = 0; p < num_entries; ++p) {
+    const int offset = p * num_components;
+    if (p > 0) {
+      ComputeSkinPrediction(p, data_to_corner_map[p], table,
+                            vertex_to_data_map, out_data, num_components,
+                            use_parallelogram_, pred_vals.get());
+    }
+    std::copy(in_corr + offset, in_corr + offset + num_components,
+              corr_vals.get());
+    this->transform().ComputeOriginalValue(pred_vals.get(), corr_vals.get(),
+                                           out_data + offset);
+    if (use_weight_sum_) {
+      // The other components are already decoded so the last component can be
+      // restored from its weight sum prediction.
+      pred_vals[num_components - 1] = ComputeSkinWeightPrediction(
+          out_data + offset, num_components, weight_sum_);
+      this->transform().ComputeOriginalValue(pred_vals.get(), corr_vals.get(),
+                                             out_data + offset);
+    }
+  }
+  return true;
+}
+
+template <typename DataTypeT, class TransformT, class MeshDataT>
+bool MeshPredictionSchemeSkinDecoder<DataTypeT, TransformT, MeshDataT>::
+    DecodePredictionData(DecoderBuffer *buffer) {
+  uint8_t use_parallelogram;
+  if (!buffer->Decode(&use_parallelogram) || use_parallelogram > 1) {
+    return false;
+  }
+  use_parallelogram_ = use_parallelogram;
+  uint8_t use_weight_sum;
+  if (!buffer->Decode(&use_weight_sum) || use_weight_sum > 1) {
+    return false;
+  }
+  use_weight_sum_ = use_weight_sum;
+  if (use_weight_sum_ && !buffer->Decode(&weight_sum_)) {
+    return false;
+  }
+  return MeshPredictionSchemeDecoder<DataTypeT, TransformT,
+                                     MeshDataT>::DecodePredictionData(buffer);
+}
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_SKIN_DECODER_H_
@@ -0,0 +1,189 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_SKIN_ENCODER_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_SKIN_ENCODER_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_encoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_skin_shared.h"
+#include "draco/compression/config/compression_shared.h"
+
+namespace draco {
+
+// Prediction scheme for skinning attributes such as joint indices and joint
+// weights. Each value is predicted from the value of an already encoded
+// neighboring vertex, which is usually influenced by the same joints. For
+// smoothly changing weights, the encoder may select the parallelogram
+// prediction instead.
+//
+// Joint weights of a vertex typically sum up to the same value. When this
+// predicts the last components better, the last component is predicted from
+// the other components of the same value so that it carries almost no
+// information. The sum is selected by the encoder and stored together with the
+// prediction data.
+template <typename DataTypeT, class TransformT, class MeshDataT>
+class MeshPredictionSchemeSkinEncoder
+    : public MeshPredictionSchemeEncoder<DataTypeT, TransformT, MeshDataT> {
+ public:
+  using CorrType =
+      typename PredictionSchemeEncoder<DataTypeT, TransformT>::CorrType;
+  using CornerTable = typename MeshDataT::CornerTable;
+  MeshPredictionSchemeSkinEncoder(const PointAttribute *attribute,
+                                  const TransformT &transform,
+                                  const MeshDataT &mesh_data)
+      : MeshPredictionSchemeEncoder<DataTypeT, TransformT, MeshDataT>(
+            attribute, transform, mesh_data),
+        use_parallelogram_(false),
+        use_weight_sum_(false),
+        weight_sum_(0) {}
+
+  bool ComputeCorrectionValues(
+      const DataTypeT *in_data, CorrType *out_corr, int size,
+      int num_components, const PointIndex *entry_to_point_id_map) override;
+
+  bool EncodePredictionData(EncoderBuffer *buffer) override;
+
+  PredictionSchemeMethod GetPredictionMethod() const override {
+    return MESH_PREDICTION_SKIN;
+  }
+
+  bool IsInitialized() const override {
+    return this->mesh_data().IsInitialized();
+  }
+
+ private:
+  // Computes predictions of all entries of |in_data|.
+  void ComputePredictions(const DataTypeT *in_data, int num_components,
+                          bool use_parallelogram,
+                          std::vector<DataTypeT> *out_predictions) const;
+
+  bool use_parallelogram_;
+  bool use_weight_sum_;
+  int64_t weight_sum_;
+};
+
+template <typename DataTypeT, class TransformT, class MeshDataT>
+void MeshPredictionSchemeSkinEncoder<DataTypeT, TransformT, MeshDataT>::
+    ComputePredictions(const DataTypeT *in_data, int num_components,
+                       bool use_parallelogram,
+                       std::vector<DataTypeT> *out_predictions) const {
+  const std::vector<CornerIndex> &data_to_corner_map =
+      *this->mesh_data().data_to_corner_map();
+  const int num_entries = static_cast<int>(data_to_corner_map.size());
+  // The first value cannot be predicted.
+  out_predictions->assign(num_entries * num_components, 0);
+  for (int p = 1; p < num_entries; ++p) {
+    ComputeSkinPrediction(p, data_to_corner_map[p],
+                          this->mesh_data().corner_table(),
+                          *this->mesh_data().vertex_to_data_map(), in_data,
+                          num_components, use_parallelogram,
+                          out_predictions->data() + p * num_components);
+  }
+}
+
+template <typename DataTypeT, class TransformT, class MeshDataT>
+bool MeshPredictionSchemeSkinEncoder<DataTypeT, TransformT, MeshDataT>::
+    ComputeCorrectionValues(const DataTypeT *in_data, CorrType *out_corr,
+                            int size, int num_components,
+                            const PointIndex * /* entry_to_point_id_map */) {
+  this->transform().Init(in_data, size, num_components);
+  const int num_entries =
+      static_cast<int>(this->mesh_data().data_to_corner_map()->size());
+
+  // Returns the sum of absolute prediction errors of the |component| or of
+  // all components when |component| is negative.
+  const auto compute_error = [&](const std::vector<DataTypeT> &predictions,
+                                 int component) {
+    int64_t error = 0;
+    for (int i = 0; i < num_entries * num_components; ++i) {
+      if (component < 0 || i % num_components == component) {
+        error += std::abs(static_cast<int64_t>(in_data[i]) - predictions[i]);
+      }
+    }
+    return error;
+  };
+
+  // Select the better of the neighbor and the parallelogram predictions.
+  std::vector<DataTypeT> pred_vals;
+  ComputePredictions(in_data, num_components, false, &pred_vals);
+  std::vector<DataTypeT> parallelogram_pred_vals;
+  ComputePredictions(in_data, num_components, true, &parallelogram_pred_vals);
+  use_parallelogram_ = compute_error(parallelogram_pred_vals, -1) <
+                       compute_error(pred_vals, -1);
+  if (use_parallelogram_) {
+    pred_vals.swap(parallelogram_pred_vals);
+  }
+
+  // Use the most common sum of the components when it predicts the last
+  // components better.
+  use_weight_sum_ = false;
+  if (num_components > 1 && num_entries > 0) {
+    std::map<int64_t, int> sum_counts;
+    for (int p = 0; p < num_entries; ++p) {
+      int64_t sum = 0;
+      for (int c = 0; c < num_components; ++c) {
+        sum += in_data[p * num_components + c];
+      }
+      ++sum_counts[sum];
+    }
+    int max_count = 0;
+    for (const auto &sum_count : sum_counts) {
+      if (sum_count.second > max_count) {
+        max_count = sum_count.second;
+        weight_sum_ = sum_count.first;
+      }
+    }
+    std::vector<DataTypeT> weight_sum_pred_vals = pred_vals;
+    for (int p = 0; p < num_entries; ++p) {
+      weight_sum_pred_vals[(p + 1) * num_components - 1] =
+          ComputeSkinWeightPrediction(in_data + p * num_components,
+                                      num_components, weight_sum_);
+    }
+    const int last_component = num_components - 1;
+    if (compute_error(weight_sum_pred_vals, last_component) <
+        compute_error(pred_vals, last_component)) {
+      use_weight_sum_ = true;
+      pred_vals.swap(weight_sum_pred_vals);
+    }
+  }
+
+  for (int p = 0; p < num_entries; ++p) {
+    const int offset = p * num_components;
+    this->transform().ComputeCorrection(in_data + offset, &pred_vals[offset],
+                                        out_corr + offset);
+  }
+  return true;
+}
+
+template <typename DataTypeT, class TransformT, class MeshDataT>
+bool MeshPredictionSchemeSkinEncoder<DataTypeT, TransformT, MeshDataT>::
+    EncodePredictionData(EncoderBuffer *buffer) {
+  buffer->Encode(static_cast<uint8_t>(use_parallelogram_));
+  buffer->Encode(static_cast<uint8_t>(use_weight_sum_));
+  if (use_weight_sum_) {
+    buffer->Encode(weight_sum_);
+  }
+  return MeshPredictionSchemeEncoder<DataTypeT, TransformT,
+                                     MeshDataT>::EncodePredictionData(buffer);
+}
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_SKIN_ENCODER_H_
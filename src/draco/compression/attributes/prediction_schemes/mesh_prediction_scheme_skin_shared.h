@@ -0,0 +1,100 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Shared functionality for the skin prediction scheme.
+
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_SKIN_SHARED_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_SKIN_SHARED_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_parallelogram_shared.h"
+#include "draco/mesh/corner_table.h"
+#include "draco/mesh/corner_table_iterators.h"
+
+namespace draco {
+
+// Returns the entry of the most recently processed neighbor of the vertex
+// attached to the corner |ci|, or -1 when none of the neighbors has been
+// processed before the entry |data_entry_id|. Neighboring vertices of skinned
+// meshes are usually influenced by the same joints with similar weights.
+template <class CornerTableT>
+inline int GetSkinNeighborEntry(int data_entry_id, CornerIndex ci,
+                                const CornerTableT *table,
+                                const std::vector<int32_t> &vertex_to_data_map) {
+  int best_entry = -1;
+  for (VertexCornersIterator<CornerTableT> it(table, ci); !it.End();
+       it.Next()) {
+    // Both the next and the previous corners are needed to reach all
+    // neighbors of vertices on open boundaries.
+    const CornerIndex corners[2] = {table->Next(it.Corner()),
+                                    table->Previous(it.Corner())};
+    for (const CornerIndex corner : corners) {
+      const int entry = vertex_to_data_map[table->Vertex(corner).value()];
+      if (entry < data_entry_id && entry > best_entry) {
+        best_entry = entry;
+      }
+    }
+  }
+  return best_entry;
+}
+
+// Computes the prediction of the entry |data_entry_id| > 0 attached to the
+// corner |ci| from the already processed entries of |data|. When
+// |use_parallelogram| is set, the parallelogram prediction is used where it is
+// available, which suits smoothly changing weights. Otherwise the value of a
+// processed neighbor is used and, when there is none, the previous entry.
+template <class CornerTableT, typename DataTypeT>
+inline void ComputeSkinPrediction(
+    int data_entry_id, CornerIndex ci, const CornerTableT *table,
+    const std::vector<int32_t> &vertex_to_data_map, const DataTypeT *data,
+    int num_components, bool use_parallelogram, DataTypeT *out_prediction) {
+  if (use_parallelogram &&
+      ComputeParallelogramPrediction(data_entry_id, ci, table,
+                                     vertex_to_data_map, data, num_components,
+                                     out_prediction)) {
+    return;
+  }
+  int entry =
+      GetSkinNeighborEntry(data_entry_id, ci, table, vertex_to_data_map);
+  if (entry < 0) {
+    entry = data_entry_id - 1;
+  }
+  std::copy(data + entry * num_components,
+            data + (entry + 1) * num_components, out_prediction);
+}
+
+// Returns the prediction of the last component of |value| that makes all
+// |num_components| components sum up to |weight_sum|.
+template <typename DataTypeT>
+inline DataTypeT ComputeSkinWeightPrediction(const DataTypeT *value,
+                                             int num_components,
+                                             int64_t weight_sum) {
+  int64_t prediction = weight_sum;
+  for (int c = 0; c < num_components - 1; ++c) {
+    prediction -= value[c];
+  }
+  prediction = std::max<int64_t>(prediction,
+                                 std::numeric_limits<DataTypeT>::lowest());
+  prediction =
+      std::min<int64_t>(prediction, std::numeric_limits<DataTypeT>::max());
+  return static_cast<DataTypeT>(prediction);
+}
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_SKIN_SHARED_H_
@@ -0,0 +1,188 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/decode.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+class MeshPredictionSchemeSkinTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumJoints = 4;
+
+  void SetUp() override {
+    mesh_ = ReadMeshFromTestFile("bunny_norm.obj");
+    ASSERT_NE(mesh_, nullptr);
+    // Keep only the positions so that the encoded size depends mostly on the
+    // skin attributes.
+    for (int i = mesh_->num_attributes() - 1; i >= 0; --i) {
+      if (mesh_->attribute(i)->attribute_type() !=
+          GeometryAttribute::POSITION) {
+        mesh_->DeleteAttribute(i);
+      }
+    }
+    AddSkinAttributes();
+  }
+
+  // Adds joint and weight attributes of a skeleton with |kNumJoints| joints
+  // placed along the y axis of the mesh. As in typical skinned meshes, most
+  // points are influenced by a single joint and the weights change only close
+  // to the joint boundaries. Joints of each point are sorted by their weights.
+  void AddSkinAttributes() {
+    const PointAttribute *const pos_att =
+        mesh_->GetNamedAttribute(GeometryAttribute::POSITION);
+    float min_y = std::numeric_limits<float>::max();
+    float max_y = std::numeric_limits<float>::lowest();
+    for (AttributeValueIndex i(0); i < pos_att->size(); ++i) {
+      std::array<float, 3> pos;
+      pos_att->GetValue(i, &pos);
+      min_y = std::min(min_y, pos[1]);
+      max_y = std::max(max_y, pos[1]);
+    }
+
+    std::unique_ptr<PointAttribute> joints_att(new PointAttribute());
+    joints_att->Init(GeometryAttribute::GENERIC, kNumJoints, DT_UINT8, false,
+                     mesh_->num_points());
+    std::unique_ptr<PointAttribute> weights_att(new PointAttribute());
+    weights_att->Init(GeometryAttribute::GENERIC, kNumJoints, DT_FLOAT32,
+                      false, mesh_->num_points());
+    for (PointIndex i(0); i < mesh_->num_points(); ++i) {
+      std::array<float, 3> pos;
+      pos_att->GetMappedValue(i, &pos);
+      const float t = (pos[1] - min_y) / (max_y - min_y);
+      std::array<float, kNumJoints> weights;
+      float weight_sum = 0.f;
+      for (int j = 0; j < kNumJoints; ++j) {
+        const float center = static_cast<float>(j) / (kNumJoints - 1);
+        weights[j] = std::min(
+            1.f, std::max(0.f, 2.f - 3.f * std::abs(t - center) *
+                                         (kNumJoints - 1)));
+        weight_sum += weights[j];
+      }
+      std::array<uint8_t, kNumJoints> joints;
+      std::iota(joints.begin(), joints.end(), 0);
+      std::sort(joints.begin(), joints.end(), [&weights](uint8_t a, uint8_t b) {
+        return weights[a] > weights[b] || (weights[a] == weights[b] && a < b);
+      });
+      std::array<float, kNumJoints> sorted_weights;
+      for (int j = 0; j < kNumJoints; ++j) {
+        sorted_weights[j] = weights[joints[j]] / weight_sum;
+      }
+      joints_att->SetAttributeValue(AttributeValueIndex(i.value()),
+                                    joints.data());
+      weights_att->SetAttributeValue(AttributeValueIndex(i.value()),
+                                     sorted_weights.data());
+    }
+    joints_att_id_ = mesh_->AddAttribute(std::move(joints_att));
+    weights_att_id_ = mesh_->AddAttribute(std::move(weights_att));
+  }
+
+  // Encodes the mesh using |prediction_scheme| for the skin attributes.
+  void Encode(int prediction_scheme, EncoderBuffer *buffer) {
+    ExpertEncoder encoder(*mesh_);
+    encoder.SetAttributeQuantization(0, 14);
+    encoder.SetAttributeQuantization(weights_att_id_, 8);
+    DRACO_ASSERT_OK(
+        encoder.SetAttributePredictionScheme(joints_att_id_, prediction_scheme));
+    DRACO_ASSERT_OK(encoder.SetAttributePredictionScheme(weights_att_id_,
+                                                         prediction_scheme));
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(buffer));
+  }
+
+  std::unique_ptr<Mesh> mesh_;
+  int joints_att_id_ = -1;
+  int weights_att_id_ = -1;
+};
+
+TEST_F(MeshPredictionSchemeSkinTest, EncodeDecode) {
+  EncoderBuffer buffer;
+  Encode(MESH_PREDICTION_SKIN, &buffer);
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(buffer.data(), buffer.size());
+  Decoder decoder;
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Mesh> decoded_mesh,
+                         decoder.DecodeMeshFromBuffer(&dec_buffer));
+  ASSERT_EQ(decoded_mesh->num_faces(), mesh_->num_faces());
+
+  // The decoded points are in a different order so the skin attributes are
+  // compared using the positions of the points that are unique for the bunny.
+  std::map<std::array<float, 3>,
+           std::pair<std::array<uint8_t, 4>, std::array<float, 4>>>
+      skin_data;
+  const PointAttribute *const pos_att =
+      mesh_->GetNamedAttribute(GeometryAttribute::POSITION);
+  for (PointIndex i(0); i < mesh_->num_points(); ++i) {
+    std::array<float, 3> pos;
+    pos_att->GetMappedValue(i, &pos);
+    auto &data = skin_data[pos];
+    mesh_->attribute(joints_att_id_)->GetMappedValue(i, &data.first);
+    mesh_->attribute(weights_att_id_)->GetMappedValue(i, &data.second);
+  }
+  const PointAttribute *const decoded_pos_att =
+      decoded_mesh->GetNamedAttribute(GeometryAttribute::POSITION);
+  const float pos_tolerance = 1e-3f;
+  for (PointIndex i(0); i < decoded_mesh->num_points(); ++i) {
+    std::array<float, 3> pos;
+    decoded_pos_att->GetMappedValue(i, &pos);
+    // Find the original point closest to the decoded one.
+    auto it = skin_data.lower_bound({pos[0] - pos_tolerance, 0.f, 0.f});
+    float best_dist = std::numeric_limits<float>::max();
+    auto best_it = skin_data.end();
+    for (; it != skin_data.end() && it->first[0] < pos[0] + pos_tolerance;
+         ++it) {
+      const float dist = std::abs(it->first[0] - pos[0]) +
+                         std::abs(it->first[1] - pos[1]) +
+                         std::abs(it->first[2] - pos[2]);
+      if (dist < best_dist) {
+        best_dist = dist;
+        best_it = it;
+      }
+    }
+    ASSERT_NE(best_it, skin_data.end());
+    std::array<uint8_t, 4> joints;
+    std::array<float, 4> weights;
+    decoded_mesh->attribute(joints_att_id_)->GetMappedValue(i, &joints);
+    decoded_mesh->attribute(weights_att_id_)->GetMappedValue(i, &weights);
+    ASSERT_EQ(joints, best_it->second.first);
+    for (int j = 0; j < 4; ++j) {
+      ASSERT_NEAR(weights[j], best_it->second.second[j], 1.f / 255.f);
+    }
+  }
+}
+
+TEST_F(MeshPredictionSchemeSkinTest, CompressesBetterThanDifference) {
+  EncoderBuffer skin_buffer;
+  Encode(MESH_PREDICTION_SKIN, &skin_buffer);
+  EncoderBuffer difference_buffer;
+  Encode(PREDICTION_DIFFERENCE, &difference_buffer);
+  EncoderBuffer parallelogram_buffer;
+  Encode(MESH_PREDICTION_PARALLELOGRAM, &parallelogram_buffer);
+  ASSERT_LT(skin_buffer.size(), difference_buffer.size());
+  ASSERT_LT(skin_buffer.size(), parallelogram_buffer.size());
+}
+
+}  // namespace draco
@@ -77,8 +77,9 @@ class MeshPredictionSchemeTexCoordsPortableDecoder
   }
 
  private:
-  MeshPredictionSchemeTexCoordsPortablePredictor<DataTypeT, MeshDataT>
-      predictor_;
+  typedef MeshPredictionSchemeTexCoordsPortablePredictor<DataTypeT, MeshDataT>
+      Predictor;
+  Predictor predictor_;
 };
 
 template <typename DataTypeT, class TransformT, class MeshDataT>
@@ -97,7 +98,11 @@ bool MeshPredictionSchemeTexCoordsPortableDecoder<
 
   const int corner_map_size =
       static_cast<int>(this->mesh_data().data_to_corner_map()->size());
+  predictor_.CachePositions(corner_map_size);
   for (int p = 0; p < corner_map_size; ++p) {
+    if (p % Predictor::kBatchSize == 0) {
+      predictor_.PrepareBatch(p, corner_map_size - p);
+    }
     const CornerIndex corner_id = this->mesh_data().data_to_corner_map()->at(p);
     if (!predictor_.template ComputePredictedValue<false>(corner_id, out_data,
                                                           p)) {
@@ -80,8 +80,9 @@ class MeshPredictionSchemeTexCoordsPortableEncoder
   }
 
  private:
-  MeshPredictionSchemeTexCoordsPortablePredictor<DataTypeT, MeshDataT>
-      predictor_;
+  typedef MeshPredictionSchemeTexCoordsPortablePredictor<DataTypeT, MeshDataT>
+      Predictor;
+  Predictor predictor_;
 };
 
 template <typename DataTypeT, class TransformT, class MeshDataT>
@@ -92,11 +93,17 @@ bool MeshPredictionSchemeTexCoordsPortableEncoder<DataTypeT, TransformT,
                             const PointIndex *entry_to_point_id_map) {
   predictor_.SetEntryToPointIdMap(entry_to_point_id_map);
   this->transform().Init(in_data, size, num_components);
+  const int corner_map_size =
+      static_cast<int>(this->mesh_data().data_to_corner_map()->size());
+  predictor_.CachePositions(corner_map_size);
   // We start processing from the end because this prediction uses data from
   // previous entries that could be overwritten when an entry is processed.
-  for (int p =
-           static_cast<int>(this->mesh_data().data_to_corner_map()->size() - 1);
-       p >= 0; --p) {
+  for (int p = corner_map_size - 1; p >= 0; --p) {
+    if (p == corner_map_size - 1 || (p + 1) % Predictor::kBatchSize == 0) {
+      // Batches are aligned to kBatchSize entries.
+      const int first_entry = p - p % Predictor::kBatchSize;
+      predictor_.PrepareBatch(first_entry, p - first_entry + 1);
+    }
     const CornerIndex corner_id = this->mesh_data().data_to_corner_map()->at(p);
     if (!predictor_.template ComputePredictedValue<true>(corner_id, in_data,
                                                          p)) {
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "draco/attributes/point_attribute.h"
 #include "draco/core/math_utils.h"
@@ -33,10 +34,14 @@ template <typename DataTypeT, class MeshDataT>
 class MeshPredictionSchemeTexCoordsPortablePredictor {
  public:
   static constexpr int kNumComponents = 2;
+  // Maximum number of entries prepared by a single PrepareBatch() call.
+  static constexpr int kBatchSize = 256;
 
   explicit MeshPredictionSchemeTexCoordsPortablePredictor(const MeshDataT &md)
       : pos_attribute_(nullptr),
         entry_to_point_id_map_(nullptr),
+        batch_begin_(0),
+        batch_end_(0),
         mesh_data_(md) {}
   void SetPositionAttribute(const PointAttribute &position_attribute) {
     pos_attribute_ = &position_attribute;
@@ -66,6 +71,19 @@ class MeshPredictionSchemeTexCoordsPortablePredictor {
   bool ComputePredictedValue(CornerIndex corner_id, const DataTypeT *data,
                              int data_id);
 
+  // Loads the positions of all |num_entries| entries from the position
+  // attribute. Must be called after SetEntryToPointIdMap() and before
+  // PrepareBatch().
+  void CachePositions(int num_entries);
+
+  // Computes the parts of the predictions of up to kBatchSize entries starting
+  // at |first_entry| that depend only on the connectivity and the positions.
+  // Unlike the final predictions, these do not depend on previously decoded
+  // texture coordinates, so they are computed for all entries of the batch
+  // together. Subsequent ComputePredictedValue() calls for entries of the batch
+  // use the precomputed values, producing identical predictions.
+  void PrepareBatch(int first_entry, int num_entries);
+
   const DataTypeT *predicted_value() const { return predicted_value_; }
   bool orientation(int i) const { return orientations_[i]; }
   void set_orientation(int i, bool v) { orientations_[i] = v; }
@@ -75,9 +93,39 @@ class MeshPredictionSchemeTexCoordsPortablePredictor {
   }
 
  private:
+  // Prediction data of an entry that depends only on positions. See
+  // ComputePredictedValue() for the meaning of the values.
+  struct PositionTerms {
+    uint64_t pn_norm2_squared;
+    int64_t cn_dot_pn;
+    // CX.Norm2() * PN.Norm2()
+    uint64_t norm_squared;
+    // Set when the projection of C onto PN would overflow.
+    bool overflow;
+  };
+
+  typedef VectorD<int64_t, 3> Vec3;
+
+  Vec3 GetCachedPosition(int entry_id) const {
+    const int64_t *const pos = &positions_[3 * entry_id];
+    return Vec3(pos[0], pos[1], pos[2]);
+  }
+
+  static void ComputePositionTerms(const Vec3 &tip_pos, const Vec3 &next_pos,
+                                   const Vec3 &prev_pos, PositionTerms *terms);
+
   const PointAttribute *pos_attribute_;
   const PointIndex *entry_to_point_id_map_;
   DataTypeT predicted_value_[kNumComponents];
+  // Positions of all entries, see CachePositions().
+  std::vector<int64_t> positions_;
+  // Range of entries of the batch prepared with PrepareBatch() and the data of
+  // its entries.
+  int batch_begin_;
+  int batch_end_;
+  int batch_next_data_ids_[kBatchSize];
+  int batch_prev_data_ids_[kBatchSize];
+  PositionTerms batch_terms_[kBatchSize];
   // Encoded / decoded array of UV flips.
   // TODO(ostava): We should remove this and replace this with in-place encoding
   // and decoding to avoid unnecessary copy.
@@ -85,6 +133,115 @@ class MeshPredictionSchemeTexCoordsPortablePredictor {
   MeshDataT mesh_data_;
 };
 
+template <typename DataTypeT, class MeshDataT>
+void MeshPredictionSchemeTexCoordsPortablePredictor<
+    DataTypeT, MeshDataT>::CachePositions(int num_entries) {
+  positions_.assign(3 * static_cast<size_t>(num_entries), 0);
+  // Quantized positions are stored as 32-bit integers. Such values are read
+  // directly instead of going through the generic conversion.
+  const bool is_int32 = pos_attribute_->data_type() == DT_INT32 &&
+                        pos_attribute_->num_components() == 3 &&
+                        pos_attribute_->byte_stride() == 3 * sizeof(int32_t);
+  for (int i = 0; i < num_entries; ++i) {
+    const AttributeValueIndex avi =
+        pos_attribute_->mapped_index(entry_to_point_id_map_[i]);
+    int64_t *const pos = &positions_[3 * static_cast<size_t>(i)];
+    if (is_int32 && avi.value() < pos_attribute_->size()) {
+      int32_t value[3];
+      pos_attribute_->GetValue(avi, value);
+      pos[0] = value[0];
+      pos[1] = value[1];
+      pos[2] = value[2];
+    } else {
+      pos_attribute_->ConvertValue(avi, 3, pos);
+    }
+  }
+  batch_begin_ = batch_end_ = 0;
+}
+
+template <typename DataTypeT, class MeshDataT>
+void MeshPredictionSchemeTexCoordsPortablePredictor<
+    DataTypeT, MeshDataT>::PrepareBatch(int first_entry, int num_entries) {
+  num_entries = std::min(num_entries, kBatchSize);
+  const auto *const corner_table = mesh_data_.corner_table();
+  const auto *const data_to_corner_map = mesh_data_.data_to_corner_map();
+  const auto *const vertex_to_data_map = mesh_data_.vertex_to_data_map();
+  // Gather the data ids of the neighboring corners first, so that the
+  // arithmetic below runs in a loop without any dependent table lookups.
+  for (int i = 0; i < num_entries; ++i) {
+    const CornerIndex corner_id = (*data_to_corner_map)[first_entry + i];
+    batch_next_data_ids_[i] = (*vertex_to_data_map)[corner_table
+                                  ->Vertex(corner_table->Next(corner_id))
+                                  .value()];
+    batch_prev_data_ids_[i] = (*vertex_to_data_map)[corner_table
+                                  ->Vertex(corner_table->Previous(corner_id))
+                                  .value()];
+  }
+  for (int i = 0; i < num_entries; ++i) {
+    const int data_id = first_entry + i;
+    const int next_data_id = batch_next_data_ids_[i];
+    const int prev_data_id = batch_prev_data_ids_[i];
+    if (prev_data_id < data_id && next_data_id < data_id) {
+      ComputePositionTerms(GetCachedPosition(data_id),
+                           GetCachedPosition(next_data_id),
+                           GetCachedPosition(prev_data_id), &batch_terms_[i]);
+    }
+  }
+  batch_begin_ = first_entry;
+  batch_end_ = first_entry + num_entries;
+}
+
+template <typename DataTypeT, class MeshDataT>
+void MeshPredictionSchemeTexCoordsPortablePredictor<DataTypeT, MeshDataT>::
+    ComputePositionTerms(const Vec3 &tip_pos, const Vec3 &next_pos,
+                         const Vec3 &prev_pos, PositionTerms *terms) {
+  // We use the positions of the above triangle to predict the texture
+  // coordinate on the tip corner C.
+  // To convert the triangle into the UV coordinate system we first compute
+  // position X on the vector |prev_pos - next_pos| that is the projection of
+  // point C onto vector |prev_pos - next_pos|:
+  //
+  //              C
+  //             /.`-.
+  //            / .   `-.
+  //           /  .      `-.
+  //          N---X---------P
+  //
+  // Where next_pos is point (N), prev_pos is point (P) and tip_pos is the
+  // position of predicted coordinate (C).
+  //
+  const Vec3 pn = prev_pos - next_pos;
+  terms->pn_norm2_squared = pn.SquaredNorm();
+  terms->cn_dot_pn = 0;
+  terms->norm_squared = 0;
+  terms->overflow = false;
+  if (terms->pn_norm2_squared == 0) {
+    return;
+  }
+  // Compute the projection of C onto PN by computing dot product of CN with
+  // PN and normalizing it by length of PN. This gives us a factor |s| where
+  // |s = PN.Dot(CN) / PN.SquaredNorm2()|.
+  const Vec3 cn = tip_pos - next_pos;
+  const int64_t cn_dot_pn = pn.Dot(cn);
+  terms->cn_dot_pn = cn_dot_pn;
+  const int64_t pn_absmax_element =
+      std::max(std::max(std::abs(pn[0]), std::abs(pn[1])), std::abs(pn[2]));
+  if (std::abs(cn_dot_pn) >
+      std::numeric_limits<int64_t>::max() / pn_absmax_element) {
+    // The squared length calculation below would overflow.
+    terms->overflow = true;
+    return;
+  }
+
+  // Compute squared length of vector CX in position coordinate system:
+  const int64_t pn_norm2_squared =
+      static_cast<int64_t>(terms->pn_norm2_squared);
+  const Vec3 x_pos = next_pos + (cn_dot_pn * pn) / pn_norm2_squared;
+  const uint64_t cx_norm2_squared = (tip_pos - x_pos).SquaredNorm();
+  // Compute CX.Norm2() * PN.Norm2()
+  terms->norm_squared = IntSqrt(cx_norm2_squared * terms->pn_norm2_squared);
+}
+
 template <typename DataTypeT, class MeshDataT>
 template <bool is_encoder_t>
 bool MeshPredictionSchemeTexCoordsPortablePredictor<
@@ -94,22 +251,27 @@ bool MeshPredictionSchemeTexCoordsPortablePredictor<
   // Compute the predicted UV coordinate from the positions on all corners
   // of the processed triangle. For the best prediction, the UV coordinates
   // on the next/previous corners need to be already encoded/decoded.
-  const CornerIndex next_corner_id = mesh_data_.corner_table()->Next(corner_id);
-  const CornerIndex prev_corner_id =
-      mesh_data_.corner_table()->Previous(corner_id);
+  const bool in_batch = data_id >= batch_begin_ && data_id < batch_end_;
   // Get the encoded data ids from the next and previous corners.
   // The data id is the encoding order of the UV coordinates.
   int next_data_id, prev_data_id;
-
-  int next_vert_id, prev_vert_id;
-  next_vert_id = mesh_data_.corner_table()->Vertex(next_corner_id).value();
-  prev_vert_id = mesh_data_.corner_table()->Vertex(prev_corner_id).value();
-
-  next_data_id = mesh_data_.vertex_to_data_map()->at(next_vert_id);
-  prev_data_id = mesh_data_.vertex_to_data_map()->at(prev_vert_id);
+  if (in_batch) {
+    next_data_id = batch_next_data_ids_[data_id - batch_begin_];
+    prev_data_id = batch_prev_data_ids_[data_id - batch_begin_];
+  } else {
+    const CornerIndex next_corner_id =
+        mesh_data_.corner_table()->Next(corner_id);
+    const CornerIndex prev_corner_id =
+        mesh_data_.corner_table()->Previous(corner_id);
+    const int next_vert_id =
+        mesh_data_.corner_table()->Vertex(next_corner_id).value();
+    const int prev_vert_id =
+        mesh_data_.corner_table()->Vertex(prev_corner_id).value();
+    next_data_id = mesh_data_.vertex_to_data_map()->at(next_vert_id);
+    prev_data_id = mesh_data_.vertex_to_data_map()->at(prev_vert_id);
+  }
 
   typedef VectorD<int64_t, 2> Vec2;
-  typedef VectorD<int64_t, 3> Vec3;
   typedef VectorD<uint64_t, 2> Vec2u;
 
   if (prev_data_id < data_id && next_data_id < data_id) {
@@ -123,34 +285,19 @@ bool MeshPredictionSchemeTexCoordsPortablePredictor<
       return true;
     }
 
-    // Get positions at all corners.
-    const Vec3 tip_pos = GetPositionForEntryId(data_id);
-    const Vec3 next_pos = GetPositionForEntryId(next_data_id);
-    const Vec3 prev_pos = GetPositionForEntryId(prev_data_id);
-    // We use the positions of the above triangle to predict the texture
-    // coordinate on the tip corner C.
-    // To convert the triangle into the UV coordinate system we first compute
-    // position X on the vector |prev_pos - next_pos| that is the projection of
-    // point C onto vector |prev_pos - next_pos|:
-    //
-    //              C
-    //             /.  \
-    //            / .     \
-    //           /  .        \
-    //          N---X----------P
-    //
-    // Where next_pos is point (N), prev_pos is point (P) and tip_pos is the
-    // position of predicted coordinate (C).
-    //
-    const Vec3 pn = prev_pos - next_pos;
-    const uint64_t pn_norm2_squared = pn.SquaredNorm();
+    PositionTerms terms;
+    if (in_batch) {
+      terms = batch_terms_[data_id - batch_begin_];
+    } else {
+      ComputePositionTerms(GetPositionForEntryId(data_id),
+                           GetPositionForEntryId(next_data_id),
+                           GetPositionForEntryId(prev_data_id), &terms);
+    }
+    const uint64_t pn_norm2_squared = terms.pn_norm2_squared;
     if (pn_norm2_squared != 0) {
-      // Compute the projection of C onto PN by computing dot product of CN with
-      // PN and normalizing it by length of PN. This gives us a factor |s| where
-      // |s = PN.Dot(CN) / PN.SquaredNorm2()|. This factor can be used to
-      // compute X in UV space |X_UV| as |X_UV = N_UV + s * PN_UV|.
-      const Vec3 cn = tip_pos - next_pos;
-      const int64_t cn_dot_pn = pn.Dot(cn);
+      // The factor |s| can be used to compute X in UV space |X_UV| as
+      // |X_UV = N_UV + s * PN_UV|.
+      const int64_t cn_dot_pn = terms.cn_dot_pn;
 
       const Vec2 pn_uv = p_uv - n_uv;
       // Because we perform all computations with integers, we don't explicitly
@@ -175,18 +322,11 @@ bool MeshPredictionSchemeTexCoordsPortablePredictor<
         return false;
       }
       const Vec2 x_uv = n_uv * pn_norm2_squared + (cn_dot_pn * pn_uv);
-      const int64_t pn_absmax_element =
-          std::max(std::max(std::abs(pn[0]), std::abs(pn[1])), std::abs(pn[2]));
-      if (std::abs(cn_dot_pn) >
-          std::numeric_limits<int64_t>::max() / pn_absmax_element) {
+      if (terms.overflow) {
         // Return false if squared length calculation would overflow.
         return false;
       }
 
-      // Compute squared length of vector CX in position coordinate system:
-      const Vec3 x_pos = next_pos + (cn_dot_pn * pn) / pn_norm2_squared;
-      const uint64_t cx_norm2_squared = (tip_pos - x_pos).SquaredNorm();
-
       // Compute vector CX_UV in the uv space by rotating vector PN_UV by 90
       // degrees and scaling it with factor CX.Norm2() / PN.Norm2():
       //
@@ -202,11 +342,8 @@ bool MeshPredictionSchemeTexCoordsPortablePredictor<
       //     cx_uv = CX.Norm2() * PN.Norm2() * Rot(PN_UV)
       //
       Vec2 cx_uv(pn_uv[1], -pn_uv[0]);  // Rotated PN_UV.
-      // Compute CX.Norm2() * PN.Norm2()
-      const uint64_t norm_squared =
-          IntSqrt(cx_norm2_squared * pn_norm2_squared);
       // Final cx_uv in the scaled coordinate space.
-      cx_uv = cx_uv * norm_squared;
+      cx_uv = cx_uv * terms.norm_squared;
 
       // Predicted uv coordinate is then computed by either adding or
       // subtracting CX_UV to/from X_UV.
@@ -19,12 +19,14 @@
 #define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_PREDICTION_SCHEME_DECODER_FACTORY_H_
 
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_constrained_multi_parallelogram_decoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_feature_id_decoder.h"
 #include "draco/draco_features.h"
 #ifdef DRACO_NORMAL_ENCODING_SUPPORTED
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_geometric_normal_decoder.h"
 #endif
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_multi_parallelogram_decoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_parallelogram_decoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_skin_decoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_tex_coords_decoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_tex_coords_portable_decoder.h"
 #include "draco/compression/attributes/prediction_schemes/prediction_scheme_decoder.h"
@@ -83,6 +85,16 @@ struct MeshPredictionSchemeDecoderFactory {
             new MeshPredictionSchemeTexCoordsPortableDecoder<
                 DataTypeT, TransformT, MeshDataT>(attribute, transform,
                                                   mesh_data));
+      } else if (method == MESH_PREDICTION_SKIN) {
+        return std::unique_ptr<PredictionSchemeDecoder<DataTypeT, TransformT>>(
+            new MeshPredictionSchemeSkinDecoder<DataTypeT, TransformT,
+                                                MeshDataT>(attribute, transform,
+                                                           mesh_data));
+      } else if (method == MESH_PREDICTION_FEATURE_ID) {
+        return std::unique_ptr<PredictionSchemeDecoder<DataTypeT, TransformT>>(
+            new MeshPredictionSchemeFeatureIdDecoder<DataTypeT, TransformT,
+                                                     MeshDataT>(
+                attribute, transform, mesh_data));
       }
 #ifdef DRACO_NORMAL_ENCODING_SUPPORTED
       else if (method == MESH_PREDICTION_GEOMETRIC_NORMAL) {
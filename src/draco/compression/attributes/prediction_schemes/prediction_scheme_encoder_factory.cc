@@ -16,22 +16,22 @@
 
 namespace draco {
 
-PredictionSchemeMethod SelectPredictionMethod(
-    int att_id, const PointCloudEncoder *encoder) {
-  return SelectPredictionMethod(att_id, *encoder->options(), encoder);
-}
+namespace {
 
-PredictionSchemeMethod SelectPredictionMethod(
-    int att_id, const EncoderOptions &options,
+// Implements SelectPredictionMethod() for a given |speed|.
+// |get_quantization_bits| returns the number of quantization bits of an
+// attribute or -1 when it is not quantized.
+template <typename GetQuantizationBitsT>
+PredictionSchemeMethod SelectPredictionMethodInternal(
+    int att_id, int speed, const GetQuantizationBitsT &get_quantization_bits,
     const PointCloudEncoder *encoder) {
-  if (options.GetSpeed() >= 10) {
+  if (speed >= 10) {
     // Selected fastest, though still doing some compression.
     return PREDICTION_DIFFERENCE;
   }
   if (encoder->GetGeometryType() == TRIANGULAR_MESH) {
     // Use speed setting to select the best encoding method.
-    const int att_quant =
-        options.GetAttributeInt(att_id, "quantization_bits", -1);
+    const int att_quant = get_quantization_bits(att_id);
     const PointAttribute *const att = encoder->point_cloud()->attribute(att_id);
     if (att_quant != -1 &&
         att->attribute_type() == GeometryAttribute::TEX_COORD &&
@@ -51,8 +51,7 @@ PredictionSchemeMethod SelectPredictionMethod(
           // Check quantization of the position attribute.
           const int pos_att_id = encoder->point_cloud()->GetNamedAttributeId(
               GeometryAttribute::POSITION);
-          const int pos_quant =
-              options.GetAttributeInt(pos_att_id, "quantization_bits", -1);
+          const int pos_quant = get_quantization_bits(pos_att_id);
           // Must be quantized but the quantization is restricted to 21 bits and
           // 2*|pos_quant|+|att_quant| must be smaller than 64 bits.
           if (pos_quant > 0 && pos_quant <= 21 &&
@@ -62,14 +61,14 @@ PredictionSchemeMethod SelectPredictionMethod(
         }
       }
 
-      if (is_pos_att_valid && options.GetSpeed() < 4) {
+      if (is_pos_att_valid && speed < 4) {
         // Use texture coordinate prediction for speeds 0, 1, 2, 3.
         return MESH_PREDICTION_TEX_COORDS_PORTABLE;
       }
     }
     if (att->attribute_type() == GeometryAttribute::NORMAL) {
 #ifdef DRACO_NORMAL_ENCODING_SUPPORTED
-      if (options.GetSpeed() < 4) {
+      if (speed < 4) {
         // Use geometric normal prediction for speeds 0, 1, 2, 3.
         // For this prediction, the position attribute needs to be either
         // integer or quantized as well.
@@ -79,8 +78,7 @@ PredictionSchemeMethod SelectPredictionMethod(
             encoder->point_cloud()->GetNamedAttribute(
                 GeometryAttribute::POSITION);
         if (pos_att && (IsDataTypeIntegral(pos_att->data_type()) ||
-                        options.GetAttributeInt(pos_att_id, "quantization_bits",
-                                                -1) > 0)) {
+                        get_quantization_bits(pos_att_id) > 0)) {
           return MESH_PREDICTION_GEOMETRIC_NORMAL;
         }
       }
@@ -88,10 +86,10 @@ PredictionSchemeMethod SelectPredictionMethod(
       return PREDICTION_DIFFERENCE;  // default
     }
     // Handle other attribute types.
-    if (options.GetSpeed() >= 8) {
+    if (speed >= 8) {
       return PREDICTION_DIFFERENCE;
     }
-    if (options.GetSpeed() >= 2 || encoder->point_cloud()->num_points() < 40) {
+    if (speed >= 2 || encoder->point_cloud()->num_points() < 40) {
       // Parallelogram prediction is used for speeds 2 - 7 or when the overhead
       // of using constrained multi-parallelogram would be too high.
       return MESH_PREDICTION_PARALLELOGRAM;
@@ -103,11 +101,7 @@ PredictionSchemeMethod SelectPredictionMethod(
   return PREDICTION_DIFFERENCE;
 }
 
-// Returns the preferred prediction scheme based on the encoder options.
-PredictionSchemeMethod GetPredictionMethodFromOptions(
-    int att_id, const EncoderOptions &options) {
-  const int pred_type =
-      options.GetAttributeInt(att_id, "prediction_scheme", -1);
+PredictionSchemeMethod PredictionMethodFromInt(int pred_type) {
   if (pred_type == -1) {
     return PREDICTION_UNDEFINED;
   }
@@ -117,4 +111,40 @@ PredictionSchemeMethod GetPredictionMethodFromOptions(
   return static_cast<PredictionSchemeMethod>(pred_type);
 }
 
+}  // namespace
+
+PredictionSchemeMethod SelectPredictionMethod(
+    int att_id, const PointCloudEncoder *encoder) {
+  const EncodePlan *const plan = encoder->plan();
+  return SelectPredictionMethodInternal(
+      att_id, plan->speed(),
+      [plan](int id) { return plan->attribute(id).quantization_bits; },
+      encoder);
+}
+
+PredictionSchemeMethod SelectPredictionMethod(
+    int att_id, const EncoderOptions &options,
+    const PointCloudEncoder *encoder) {
+  return SelectPredictionMethodInternal(
+      att_id, options.GetSpeed(),
+      [&options](int id) {
+        return options.GetAttributeInt(
+            id, GetEncoderOptionKeys().quantization_bits, -1);
+      },
+      encoder);
+}
+
+// Returns the preferred prediction scheme based on the encoder options.
+PredictionSchemeMethod GetPredictionMethodFromOptions(
+    int att_id, const EncoderOptions &options) {
+  return PredictionMethodFromInt(
+      options.GetAttributeInt(att_id, GetEncoderOptionKeys().prediction_scheme,
+                              -1));
+}
+
+PredictionSchemeMethod GetPredictionMethodFromPlan(int att_id,
+                                                   const EncodePlan &plan) {
+  return PredictionMethodFromInt(plan.attribute(att_id).prediction_scheme);
+}
+
 }  // namespace draco
@@ -19,11 +19,13 @@
 #define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_PREDICTION_SCHEME_ENCODER_FACTORY_H_
 
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_constrained_multi_parallelogram_encoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_feature_id_encoder.h"
 #ifdef DRACO_NORMAL_ENCODING_SUPPORTED
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_geometric_normal_encoder.h"
 #endif
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_multi_parallelogram_encoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_parallelogram_encoder.h"
+#include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_skin_encoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_tex_coords_encoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_tex_coords_portable_encoder.h"
 #include "draco/compression/attributes/prediction_schemes/prediction_scheme_delta_encoder.h"
@@ -34,7 +36,8 @@
 namespace draco {
 
 // Selects a prediction method based on the input geometry type and based on the
-// encoder options.
+// encoder options. The first version reads the options from the plan of the
+// running encoding of |encoder|.
 PredictionSchemeMethod SelectPredictionMethod(int att_id,
                                               const PointCloudEncoder *encoder);
 
@@ -65,6 +68,16 @@ struct MeshPredictionSchemeEncoderFactory {
           new MeshPredictionSchemeTexCoordsPortableEncoder<
               DataTypeT, TransformT, MeshDataT>(attribute, transform,
                                                 mesh_data));
+    } else if (method == MESH_PREDICTION_SKIN) {
+      return std::unique_ptr<PredictionSchemeEncoder<DataTypeT, TransformT>>(
+          new MeshPredictionSchemeSkinEncoder<DataTypeT, TransformT,
+                                              MeshDataT>(attribute, transform,
+                                                         mesh_data));
+    } else if (method == MESH_PREDICTION_FEATURE_ID) {
+      return std::unique_ptr<PredictionSchemeEncoder<DataTypeT, TransformT>>(
+          new MeshPredictionSchemeFeatureIdEncoder<DataTypeT, TransformT,
+                                                   MeshDataT>(
+              attribute, transform, mesh_data));
     }
 #ifdef DRACO_NORMAL_ENCODING_SUPPORTED
     else if (method == MESH_PREDICTION_GEOMETRIC_NORMAL) {
@@ -129,6 +142,10 @@ CreatePredictionSchemeForEncoder(PredictionSchemeMethod method, int att_id,
 PredictionSchemeMethod GetPredictionMethodFromOptions(
     int att_id, const EncoderOptions &options);
 
+// Same as above for the options resolved in |plan|.
+PredictionSchemeMethod GetPredictionMethodFromPlan(int att_id,
+                                                   const EncodePlan &plan);
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_PREDICTION_SCHEME_ENCODER_FACTORY_H_
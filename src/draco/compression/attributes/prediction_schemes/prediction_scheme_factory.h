@@ -29,6 +29,28 @@
 
 namespace draco {
 
+// Returns true for prediction methods that repeatedly visit the corners around
+// the predicted vertices.
+inline bool IsVertexRingPredictionMethod(PredictionSchemeMethod method) {
+  return method == MESH_PREDICTION_MULTI_PARALLELOGRAM ||
+         method == MESH_PREDICTION_CONSTRAINED_MULTI_PARALLELOGRAM ||
+         method == MESH_PREDICTION_GEOMETRIC_NORMAL;
+}
+
+// Caches the corners around all vertices of |table| when requested by the
+// "use_vertex_ring_cache" option of |source|. The cache is stored in the table
+// so it is built once and shared by all prediction schemes using the table.
+template <class EncodingDataSourceT, class CornerTableT>
+void MaybeCacheVertexRings(const EncodingDataSourceT *source,
+                           PredictionSchemeMethod method,
+                           const CornerTableT *table) {
+  if (source->options() == nullptr || !IsVertexRingPredictionMethod(method) ||
+      !source->options()->GetGlobalBool("use_vertex_ring_cache", false)) {
+    return;
+  }
+  table->GetVertexRingCache().CacheVertexRings();
+}
+
 template <class EncodingDataSourceT, class PredictionSchemeT,
           class MeshPredictionSchemeFactoryT>
 std::unique_ptr<PredictionSchemeT> CreateMeshPredictionScheme(
@@ -42,6 +64,8 @@ std::unique_ptr<PredictionSchemeT> CreateMeshPredictionScheme(
        method == MESH_PREDICTION_CONSTRAINED_MULTI_PARALLELOGRAM ||
        method == MESH_PREDICTION_TEX_COORDS_PORTABLE ||
        method == MESH_PREDICTION_GEOMETRIC_NORMAL ||
+       method == MESH_PREDICTION_SKIN ||
+       method == MESH_PREDICTION_FEATURE_ID ||
        method == MESH_PREDICTION_TEX_COORDS_DEPRECATED)) {
     const CornerTable *const ct = source->GetCornerTable();
     const MeshAttributeIndicesEncodingData *const encoding_data =
@@ -54,6 +78,7 @@ std::unique_ptr<PredictionSchemeT> CreateMeshPredictionScheme(
     const MeshAttributeCornerTable *const att_ct =
         source->GetAttributeCornerTable(att_id);
     if (att_ct != nullptr) {
+      MaybeCacheVertexRings(source, method, att_ct);
       typedef MeshPredictionSchemeData<MeshAttributeCornerTable> MeshData;
       MeshData md;
       md.Set(source->mesh(), att_ct,
@@ -65,6 +90,7 @@ std::unique_ptr<PredictionSchemeT> CreateMeshPredictionScheme(
         return ret;
       }
     } else {
+      MaybeCacheVertexRings(source, method, ct);
       typedef MeshPredictionSchemeData<CornerTable> MeshData;
       MeshData md;
       md.Set(source->mesh(), ct,
@@ -63,6 +63,17 @@ class PredictionSchemeWrapDecodingTransform
     }
   }
 
+  // Same as ComputeOriginalValue() for values with exactly three components.
+  // The computation is unrolled and it does not use the shared buffer for
+  // clamped predictions.
+  inline void ComputeOriginalValue3(const DataTypeT *predicted_vals,
+                                    const CorrTypeT *corr_vals,
+                                    DataTypeT *out_original_vals) const {
+    out_original_vals[0] = UnwrapValue(predicted_vals[0], corr_vals[0]);
+    out_original_vals[1] = UnwrapValue(predicted_vals[1], corr_vals[1]);
+    out_original_vals[2] = UnwrapValue(predicted_vals[2], corr_vals[2]);
+  }
+
   bool DecodeTransformData(DecoderBuffer *buffer) {
     DataTypeT min_value, max_value;
     if (!buffer->Decode(&min_value)) {
@@ -81,6 +92,26 @@ class PredictionSchemeWrapDecodingTransform
     }
     return true;
   }
+
+ private:
+  // Computes one component of the original value. See ComputeOriginalValue().
+  inline DataTypeT UnwrapValue(DataTypeT predicted_val,
+                               CorrTypeT corr_val) const {
+    if (predicted_val > this->max_value()) {
+      predicted_val = this->max_value();
+    } else if (predicted_val < this->min_value()) {
+      predicted_val = this->min_value();
+    }
+    DataTypeT value =
+        static_cast<DataTypeT>(static_cast<uint32_t>(predicted_val) +
+                               static_cast<uint32_t>(corr_val));
+    if (value > this->max_value()) {
+      value -= this->max_dif();
+    } else if (value < this->min_value()) {
+      value += this->max_dif();
+    }
+    return value;
+  }
 };
 
 }  // namespace draco
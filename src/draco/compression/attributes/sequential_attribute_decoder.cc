@@ -46,6 +46,11 @@ bool SequentialAttributeDecoder::DecodePortableAttribute(
   return true;
 }
 
+bool SequentialAttributeDecoder::SkipPortableAttribute(
+    const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
+  return DecodePortableAttribute(point_ids, in_buffer);
+}
+
 bool SequentialAttributeDecoder::DecodeDataNeededByPortableTransform(
     const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
   // Default implementation does not apply any transform.
@@ -59,15 +64,11 @@ bool SequentialAttributeDecoder::TransformAttributeToOriginalFormat(
 }
 
 const PointAttribute *SequentialAttributeDecoder::GetPortableAttribute() {
-  // If needed, copy point to attribute value index mapping from the final
-  // attribute to the portable attribute.
+  // If needed, share point to attribute value index mapping of the final
+  // attribute with the portable attribute.
   if (!attribute_->is_mapping_identity() && portable_attribute_ &&
       portable_attribute_->is_mapping_identity()) {
-    portable_attribute_->SetExplicitMapping(attribute_->indices_map_size());
-    for (PointIndex i(0);
-         i < static_cast<uint32_t>(attribute_->indices_map_size()); ++i) {
-      portable_attribute_->SetPointMapEntry(i, attribute_->mapped_index(i));
-    }
+    portable_attribute_->ShareMappingFrom(*attribute_);
   }
   return portable_attribute_.get();
 }
@@ -99,19 +100,17 @@ bool SequentialAttributeDecoder::InitPredictionScheme(
 
 bool SequentialAttributeDecoder::DecodeValues(
     const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
-  const int32_t num_values = static_cast<uint32_t>(point_ids.size());
-  const int entry_size = static_cast<int>(attribute_->byte_stride());
-  std::unique_ptr<uint8_t[]> value_data_ptr(new uint8_t[entry_size]);
-  uint8_t *const value_data = value_data_ptr.get();
-  int out_byte_pos = 0;
-  // Decode raw attribute values in their original format.
-  for (int i = 0; i < num_values; ++i) {
-    if (!in_buffer->Decode(value_data, entry_size)) {
-      return false;
-    }
-    attribute_->buffer()->Write(out_byte_pos, value_data, entry_size);
-    out_byte_pos += entry_size;
+  const int64_t num_values = static_cast<int64_t>(point_ids.size());
+  const int64_t entry_size = attribute_->byte_stride();
+  // Decode raw attribute values in their original format. The size of the
+  // whole section is validated once so that all values can be copied at once.
+  // The attribute buffer was already resized in DecodePortableAttribute().
+  const int64_t num_bytes = num_values * entry_size;
+  if (in_buffer->remaining_size() < num_bytes) {
+    return false;
   }
+  attribute_->buffer()->Write(0, in_buffer->data_head(), num_bytes);
+  in_buffer->Advance(num_bytes);
   return true;
 }
 
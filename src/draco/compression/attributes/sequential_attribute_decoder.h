@@ -43,6 +43,19 @@ class SequentialAttributeDecoder {
   virtual bool DecodeDataNeededByPortableTransform(
       const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer);
 
+  // Advances |in_buffer| past the encoded portable attribute data without
+  // storing the decoded values. The default implementation decodes the data.
+  virtual bool SkipPortableAttribute(const std::vector<PointIndex> &point_ids,
+                                     DecoderBuffer *in_buffer);
+
+  // Advances |in_buffer| past the data needed to revert the portable
+  // transform of a skipped attribute. Decoded transform parameters are stored
+  // in the attribute.
+  virtual bool SkipDataNeededByPortableTransform(
+      DecoderBuffer * /* in_buffer */) {
+    return true;
+  }
+
   // Reverts transformation performed by encoder in
   // SequentialAttributeEncoder::TransformAttributeToPortableFormat() method.
   virtual bool TransformAttributeToOriginalFormat(
@@ -55,6 +68,19 @@ class SequentialAttributeDecoder {
   int attribute_id() const { return attribute_id_; }
   PointCloudDecoder *decoder() const { return decoder_; }
 
+  // Returns the collector of coding statistics set in the decoder options, or
+  // nullptr.
+  CodingStats *coding_stats() const {
+    return decoder_ && decoder_->options() ? decoder_->options()->coding_stats()
+                                           : nullptr;
+  }
+
+  // Returns the receiver of stage events set in the decoder options, or nullptr.
+  CodingTracer *coding_tracer() const {
+    return decoder_ && decoder_->options() ? decoder_->options()->coding_tracer()
+                                           : nullptr;
+  }
+
  protected:
   // Should be used to initialize newly created prediction scheme.
   // Returns false when the initialization failed (in which case the scheme
@@ -13,11 +13,18 @@
 // limitations under the License.
 //
 #include "draco/compression/attributes/sequential_attribute_decoders_controller.h"
+
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/attributes/sequential_delta_attribute_decoder.h"
+#include "draco/compression/attributes/sequential_lossless_float_attribute_decoder.h"
 #ifdef DRACO_NORMAL_ENCODING_SUPPORTED
 #include "draco/compression/attributes/sequential_normal_attribute_decoder.h"
 #endif
 #include "draco/compression/attributes/sequential_quantization_attribute_decoder.h"
+#include "draco/compression/attributes/sequential_ycocg_attribute_decoder.h"
 #include "draco/compression/config/compression_shared.h"
+#include "draco/core/coding_stats.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -56,13 +63,24 @@ bool SequentialAttributeDecodersController::DecodeAttributes(
     return false;
   }
   // Initialize point to attribute value mapping for all decoded attributes.
+  // The mapping depends only on the sequencer, so it is computed for the first
+  // attribute and shared by all other attributes of this decoder.
   const int32_t num_attributes = GetNumAttributes();
+  const PointAttribute *mapped_att = nullptr;
   for (int i = 0; i < num_attributes; ++i) {
+    if (GetDecoder()->IsAttributeSkipped(GetAttributeId(i))) {
+      continue;
+    }
     PointAttribute *const pa =
         GetDecoder()->point_cloud()->attribute(GetAttributeId(i));
+    if (mapped_att != nullptr) {
+      pa->ShareMappingFrom(*mapped_att);
+      continue;
+    }
     if (!sequencer_->UpdatePointToAttributeIndexMapping(pa)) {
       return false;
     }
+    mapped_att = pa;
   }
   return AttributesDecoder::DecodeAttributes(buffer);
 }
@@ -71,6 +89,15 @@ bool SequentialAttributeDecodersController::DecodePortableAttributes(
     DecoderBuffer *in_buffer) {
   const int32_t num_attributes = GetNumAttributes();
   for (int i = 0; i < num_attributes; ++i) {
+    if (GetDecoder()->IsAttributeSkipped(GetAttributeId(i))) {
+      // Values of skipped attributes are passed over and the attributes are
+      // removed from the point cloud once all attributes are decoded.
+      if (!sequential_decoders_[i]->SkipPortableAttribute(point_ids_,
+                                                          in_buffer)) {
+        return false;
+      }
+      continue;
+    }
     if (!sequential_decoders_[i]->DecodePortableAttribute(point_ids_,
                                                           in_buffer)) {
       return false;
@@ -83,6 +110,13 @@ bool SequentialAttributeDecodersController::
     DecodeDataNeededByPortableTransforms(DecoderBuffer *in_buffer) {
   const int32_t num_attributes = GetNumAttributes();
   for (int i = 0; i < num_attributes; ++i) {
+    if (GetDecoder()->IsAttributeSkipped(GetAttributeId(i))) {
+      if (!sequential_decoders_[i]->SkipDataNeededByPortableTransform(
+              in_buffer)) {
+        return false;
+      }
+      continue;
+    }
     if (!sequential_decoders_[i]->DecodeDataNeededByPortableTransform(
             point_ids_, in_buffer)) {
       return false;
@@ -94,33 +128,67 @@ bool SequentialAttributeDecodersController::
 bool SequentialAttributeDecodersController::
     TransformAttributesToOriginalFormat() {
   const int32_t num_attributes = GetNumAttributes();
+  // Transforms of individual attributes are independent of each other so they
+  // can be processed concurrently when the decoder has a thread pool.
+  ThreadPool *const pool =
+      GetDecoder()->options() ? GetDecoder()->options()->thread_pool()
+                              : nullptr;
+  std::vector<uint8_t> results(num_attributes, 0);
+  ParallelFor(pool, num_attributes, [this, &results](int i) {
+    const SequentialAttributeDecoder *const att_decoder =
+        sequential_decoders_[i].get();
+    const ScopedCodingStage stage(att_decoder->coding_stats(),
+                                  att_decoder->coding_tracer(), "transform",
+                                  att_decoder->attribute_id());
+    results[i] = TransformAttributeToOriginalFormat(i);
+  });
   for (int i = 0; i < num_attributes; ++i) {
-    // Check whether the attribute transform should be skipped.
-    if (GetDecoder()->options()) {
-      const PointAttribute *const attribute =
-          sequential_decoders_[i]->attribute();
-      const PointAttribute *const portable_attribute =
-          sequential_decoders_[i]->GetPortableAttribute();
-      if (portable_attribute &&
-          GetDecoder()->options()->GetAttributeBool(
-              attribute->attribute_type(), "skip_attribute_transform", false)) {
-        // Attribute transform should not be performed. In this case, we replace
-        // the output geometry attribute with the portable attribute.
-        // TODO(ostava): We can potentially avoid this copy by introducing a new
-        // mechanism that would allow to use the final attributes as portable
-        // attributes for predictors that may need them.
-        sequential_decoders_[i]->attribute()->CopyFrom(*portable_attribute);
-        continue;
-      }
-    }
-    if (!sequential_decoders_[i]->TransformAttributeToOriginalFormat(
-            point_ids_)) {
+    if (!results[i]) {
       return false;
     }
   }
   return true;
 }
 
+bool SequentialAttributeDecodersController::TransformAttributeToOriginalFormat(
+    int i) {
+  if (GetDecoder()->IsAttributeSkipped(GetAttributeId(i))) {
+    return true;
+  }
+  // Check whether the attribute transform should be skipped.
+  if (GetDecoder()->options()) {
+    const PointAttribute *const attribute =
+        sequential_decoders_[i]->attribute();
+    const PointAttribute *const portable_attribute =
+        sequential_decoders_[i]->GetPortableAttribute();
+    AttributeQuantizationTransform quantization_transform;
+    if (portable_attribute &&
+        GetDecoder()->options()->GetAttributeBool(
+            attribute->attribute_type(),
+            GetDecoderOptionKeys().decode_to_quantized_attribute, false) &&
+        quantization_transform.InitFromAttribute(*portable_attribute) &&
+        quantization_transform.quantization_bits() <= 16) {
+      // Output the quantized values directly in a compact integer format.
+      return quantization_transform.TransformToCompactAttribute(
+          *portable_attribute, sequential_decoders_[i]->attribute());
+    }
+    if (portable_attribute &&
+        GetDecoder()->options()->GetAttributeBool(
+            attribute->attribute_type(),
+            GetDecoderOptionKeys().skip_attribute_transform, false)) {
+      // Attribute transform should not be performed. In this case, we replace
+      // the output geometry attribute with the portable attribute.
+      // TODO(ostava): We can potentially avoid this copy by introducing a new
+      // mechanism that would allow to use the final attributes as portable
+      // attributes for predictors that may need them.
+      sequential_decoders_[i]->attribute()->CopyFrom(*portable_attribute);
+      return true;
+    }
+  }
+  return sequential_decoders_[i]->TransformAttributeToOriginalFormat(
+      point_ids_);
+}
+
 std::unique_ptr<SequentialAttributeDecoder>
 SequentialAttributeDecodersController::CreateSequentialDecoder(
     uint8_t decoder_type) {
@@ -139,6 +207,15 @@ SequentialAttributeDecodersController::CreateSequentialDecoder(
       return std::unique_ptr<SequentialNormalAttributeDecoder>(
           new SequentialNormalAttributeDecoder());
 #endif
+    case SEQUENTIAL_ATTRIBUTE_ENCODER_DELTA:
+      return std::unique_ptr<SequentialAttributeDecoder>(
+          new SequentialDeltaAttributeDecoder());
+    case SEQUENTIAL_ATTRIBUTE_ENCODER_LOSSLESS_FLOAT:
+      return std::unique_ptr<SequentialAttributeDecoder>(
+          new SequentialLosslessFloatAttributeDecoder());
+    case SEQUENTIAL_ATTRIBUTE_ENCODER_YCOCG:
+      return std::unique_ptr<SequentialAttributeDecoder>(
+          new SequentialYCoCgAttributeDecoder());
     default:
       break;
   }
@@ -43,6 +43,10 @@ class SequentialAttributeDecodersController : public AttributesDecoder {
     return sequential_decoders_[loc_id]->GetPortableAttribute();
   }
 
+  // Returns the sequence of points in which the attribute values were
+  // decoded. Valid after DecodeAttributes() succeeded.
+  const std::vector<PointIndex> &point_ids() const { return point_ids_; }
+
  protected:
   bool DecodePortableAttributes(DecoderBuffer *in_buffer) override;
   bool DecodeDataNeededByPortableTransforms(DecoderBuffer *in_buffer) override;
@@ -51,6 +55,9 @@ class SequentialAttributeDecodersController : public AttributesDecoder {
       uint8_t decoder_type);
 
  private:
+  // Reverts the portable transform of the attribute with local id |i|.
+  bool TransformAttributeToOriginalFormat(int i);
+
   std::vector<std::unique_ptr<SequentialAttributeDecoder>> sequential_decoders_;
   std::vector<PointIndex> point_ids_;
   std::unique_ptr<PointsSequencer> sequencer_;
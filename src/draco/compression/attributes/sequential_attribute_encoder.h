@@ -82,6 +82,19 @@ class SequentialAttributeEncoder {
   int attribute_id() const { return attribute_id_; }
   PointCloudEncoder *encoder() const { return encoder_; }
 
+  // Returns the collector of coding statistics set in the encoder options, or
+  // nullptr.
+  CodingStats *coding_stats() const {
+    return encoder_ && encoder_->options() ? encoder_->options()->coding_stats()
+                                           : nullptr;
+  }
+
+  // Returns the receiver of stage events set in the encoder options, or nullptr.
+  CodingTracer *coding_tracer() const {
+    return encoder_ && encoder_->options() ? encoder_->options()->coding_tracer()
+                                           : nullptr;
+  }
+
  protected:
   // Should be used to initialize newly created prediction scheme.
   // Returns false when the initialization failed (in which case the scheme
@@ -13,11 +13,17 @@
 // limitations under the License.
 //
 #include "draco/compression/attributes/sequential_attribute_encoders_controller.h"
+#include "draco/attributes/attribute_ycocg_transform.h"
+#include "draco/compression/attributes/sequential_delta_attribute_encoder.h"
+#include "draco/compression/attributes/sequential_lossless_float_attribute_encoder.h"
 #ifdef DRACO_NORMAL_ENCODING_SUPPORTED
 #include "draco/compression/attributes/sequential_normal_attribute_encoder.h"
 #endif
 #include "draco/compression/attributes/sequential_quantization_attribute_encoder.h"
+#include "draco/compression/attributes/sequential_ycocg_attribute_encoder.h"
 #include "draco/compression/point_cloud/point_cloud_encoder.h"
+#include "draco/core/coding_stats.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -69,9 +75,22 @@ bool SequentialAttributeEncodersController::EncodeAttributes(
 
 bool SequentialAttributeEncodersController::
     TransformAttributesToPortableFormat() {
-  for (uint32_t i = 0; i < sequential_encoders_.size(); ++i) {
-    if (!sequential_encoders_[i]->TransformAttributeToPortableFormat(
-            point_ids_)) {
+  // Portable transforms of individual attributes are independent of each other
+  // so they can be computed concurrently when a thread pool is available.
+  const int num_encoders = static_cast<int>(sequential_encoders_.size());
+  std::vector<uint8_t> results(num_encoders, 0);
+  ParallelFor(encoder()->options()->thread_pool(), num_encoders,
+              [this, &results](int i) {
+                SequentialAttributeEncoder *const att_encoder =
+                    sequential_encoders_[i].get();
+                const ScopedCodingStage stage(
+                    att_encoder->coding_stats(), att_encoder->coding_tracer(),
+                    "transform", att_encoder->attribute_id());
+                results[i] =
+                    att_encoder->TransformAttributeToPortableFormat(point_ids_);
+              });
+  for (int i = 0; i < num_encoders; ++i) {
+    if (!results[i]) {
       return false;
     }
   }
@@ -80,9 +99,33 @@ bool SequentialAttributeEncodersController::
 
 bool SequentialAttributeEncodersController::EncodePortableAttributes(
     EncoderBuffer *out_buffer) {
-  for (uint32_t i = 0; i < sequential_encoders_.size(); ++i) {
-    if (!sequential_encoders_[i]->EncodePortableAttribute(point_ids_,
-                                                          out_buffer)) {
+  ThreadPool *const pool = encoder()->options()->thread_pool();
+  const int num_encoders = static_cast<int>(sequential_encoders_.size());
+  if (pool == nullptr || num_encoders < 2) {
+    for (int i = 0; i < num_encoders; ++i) {
+      if (!sequential_encoders_[i]->EncodePortableAttribute(point_ids_,
+                                                            out_buffer)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  // All portable attributes are already computed at this point and the
+  // encoding of one attribute does not depend on the encoded data of any other
+  // attribute. Each attribute is therefore encoded into its own buffer and the
+  // buffers are then joined in the same order as in the serial case, which
+  // results in an identical bitstream.
+  std::vector<EncoderBuffer> buffers(num_encoders);
+  std::vector<uint8_t> results(num_encoders, 0);
+  pool->ParallelFor(num_encoders, [this, &buffers, &results](int i) {
+    results[i] = sequential_encoders_[i]->EncodePortableAttribute(point_ids_,
+                                                                  &buffers[i]);
+  });
+  for (int i = 0; i < num_encoders; ++i) {
+    if (!results[i]) {
+      return false;
+    }
+    if (!out_buffer->Encode(buffers[i].data(), buffers[i].size())) {
       return false;
     }
   }
@@ -128,11 +171,17 @@ SequentialAttributeEncodersController::CreateSequentialEncoder(int i) {
     case DT_INT16:
     case DT_UINT32:
     case DT_INT32:
+      if (encoder()->plan()->attribute(att_id).ycocg_transform &&
+          att->attribute_type() == GeometryAttribute::COLOR &&
+          AttributeYCoCgTransform::IsSupported(att->data_type(),
+                                               att->num_components())) {
+        return std::unique_ptr<SequentialAttributeEncoder>(
+            new SequentialYCoCgAttributeEncoder());
+      }
       return std::unique_ptr<SequentialAttributeEncoder>(
           new SequentialIntegerAttributeEncoder());
     case DT_FLOAT32:
-      if (encoder()->options()->GetAttributeInt(att_id, "quantization_bits",
-                                                -1) > 0) {
+      if (encoder()->plan()->attribute(att_id).quantization_bits > 0) {
 #ifdef DRACO_NORMAL_ENCODING_SUPPORTED
         if (att->attribute_type() == GeometryAttribute::NORMAL) {
           // We currently only support normals with float coordinates
@@ -147,6 +196,18 @@ SequentialAttributeEncodersController::CreateSequentialEncoder(int i) {
         }
 #endif
       }
+      if (encoder()->plan()->attribute(att_id).lossless_float_coding) {
+        return std::unique_ptr<SequentialAttributeEncoder>(
+            new SequentialLosslessFloatAttributeEncoder());
+      }
+      break;
+    case DT_INT64:
+    case DT_UINT64:
+    case DT_FLOAT64:
+      if (encoder()->plan()->attribute(att_id).delta_coding) {
+        return std::unique_ptr<SequentialAttributeEncoder>(
+            new SequentialDeltaAttributeEncoder());
+      }
       break;
     default:
       break;
@@ -0,0 +1,79 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/attributes/sequential_delta_attribute_decoder.h"
+
+#include <cstring>
+
+#include "draco/compression/attributes/sequential_delta_attribute_shared.h"
+#include "draco/compression/entropy/symbol_decoding.h"
+
+namespace draco {
+
+SequentialDeltaAttributeDecoder::SequentialDeltaAttributeDecoder() {}
+
+bool SequentialDeltaAttributeDecoder::Init(PointCloudDecoder *decoder,
+                                           int attribute_id) {
+  if (!SequentialAttributeDecoder::Init(decoder, attribute_id)) {
+    return false;
+  }
+  switch (attribute()->data_type()) {
+    case DT_INT64:
+    case DT_UINT64:
+    case DT_FLOAT64:
+      break;
+    default:
+      return false;
+  }
+  // The values are decoded directly into the attribute buffer.
+  return attribute()->byte_stride() ==
+         static_cast<int64_t>(sizeof(uint64_t)) * attribute()->num_components();
+}
+
+bool SequentialDeltaAttributeDecoder::DecodeValues(
+    const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
+  const int num_components = attribute()->num_components();
+  const size_t num_values = point_ids.size() * num_components;
+  if (num_values == 0) {
+    return true;
+  }
+  std::vector<uint32_t> symbol_parts(kNumDeltaSymbolParts * num_values);
+  for (int p = 0; p < kNumDeltaSymbolParts; ++p) {
+    if (!DecodeSymbols(static_cast<uint32_t>(num_values), num_components,
+                       in_buffer, symbol_parts.data() + p * num_values)) {
+      return false;
+    }
+  }
+  std::vector<uint64_t> values(num_values);
+  for (size_t i = 0; i < num_values; ++i) {
+    uint64_t symbol = 0;
+    for (int p = 0; p < kNumDeltaSymbolParts; ++p) {
+      if (symbol_parts[p * num_values + i] > kDeltaSymbolPartMask) {
+        return false;
+      }
+      symbol |= static_cast<uint64_t>(symbol_parts[p * num_values + i])
+                << (kDeltaSymbolPartBits * p);
+    }
+    const uint64_t delta = (symbol >> 1) ^ (0 - (symbol & 1));
+    values[i] = delta;
+    if (i >= static_cast<size_t>(num_components)) {
+      values[i] += values[i - num_components];
+    }
+  }
+  attribute()->buffer()->Write(0, values.data(),
+                               sizeof(uint64_t) * num_values);
+  return true;
+}
+
+}  // namespace draco
@@ -0,0 +1,85 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/attributes/sequential_delta_attribute_encoder.h"
+
+#include <cstring>
+
+#include "draco/compression/attributes/sequential_delta_attribute_shared.h"
+#include "draco/compression/entropy/symbol_encoding.h"
+
+namespace draco {
+
+SequentialDeltaAttributeEncoder::SequentialDeltaAttributeEncoder() {}
+
+bool SequentialDeltaAttributeEncoder::Init(PointCloudEncoder *encoder,
+                                           int attribute_id) {
+  if (!SequentialAttributeEncoder::Init(encoder, attribute_id)) {
+    return false;
+  }
+  switch (attribute()->data_type()) {
+    case DT_INT64:
+    case DT_UINT64:
+    case DT_FLOAT64:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool SequentialDeltaAttributeEncoder::EncodeValues(
+    const std::vector<PointIndex> &point_ids, EncoderBuffer *out_buffer) {
+  const PointAttribute *const attrib = attribute();
+  const int num_components = attrib->num_components();
+  const int num_values = static_cast<int>(point_ids.size()) * num_components;
+  // The entropy coder supports symbols of up to 31 bits, so each symbol is
+  // split into kNumDeltaSymbolParts parts.
+  std::vector<uint32_t> symbol_parts(kNumDeltaSymbolParts * num_values);
+  std::vector<uint64_t> prev_value(num_components, 0);
+  std::vector<uint64_t> value(num_components);
+  int value_id = 0;
+  for (const PointIndex pi : point_ids) {
+    memcpy(value.data(), attrib->GetAddress(attrib->mapped_index(pi)),
+           sizeof(uint64_t) * num_components);
+    for (int c = 0; c < num_components; ++c) {
+      // The difference of the bit patterns is stored as a zig-zag encoded
+      // symbol so that both small positive and small negative differences
+      // result in small symbols.
+      const uint64_t delta = value[c] - prev_value[c];
+      const uint64_t symbol = (delta << 1) ^ (0 - (delta >> 63));
+      for (int p = 0; p < kNumDeltaSymbolParts; ++p) {
+        symbol_parts[p * num_values + value_id] =
+            static_cast<uint32_t>(symbol >> (kDeltaSymbolPartBits * p)) &
+            kDeltaSymbolPartMask;
+      }
+      prev_value[c] = value[c];
+      ++value_id;
+    }
+  }
+  Options symbol_encoding_options;
+  if (encoder() != nullptr) {
+    SetSymbolEncodingCompressionLevel(&symbol_encoding_options,
+                                      10 - encoder()->plan()->speed());
+  }
+  for (int p = 0; p < kNumDeltaSymbolParts; ++p) {
+    if (!EncodeSymbols(symbol_parts.data() + p * num_values, num_values,
+                       num_components, &symbol_encoding_options,
+                       out_buffer)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace draco
@@ -0,0 +1,45 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_DELTA_ATTRIBUTE_ENCODER_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_DELTA_ATTRIBUTE_ENCODER_H_
+
+#include "draco/compression/attributes/sequential_attribute_encoder.h"
+
+namespace draco {
+
+// Attribute encoder designed for lossless encoding of 64-bit attributes
+// (DT_INT64, DT_UINT64 and DT_FLOAT64) whose values change slowly in the
+// encoding order, such as GPS time stamps of LiDAR points stored in scan
+// order. Each component is predicted from the same component of the previous
+// value. The bit patterns of the differences are split into four 16-bit
+// parts that are compressed separately with the built-in entropy coder, so
+// that the upper parts of small differences cost almost nothing.
+class SequentialDeltaAttributeEncoder : public SequentialAttributeEncoder {
+ public:
+  SequentialDeltaAttributeEncoder();
+  uint8_t GetUniqueId() const override {
+    return SEQUENTIAL_ATTRIBUTE_ENCODER_DELTA;
+  }
+
+  bool Init(PointCloudEncoder *encoder, int attribute_id) override;
+
+ protected:
+  bool EncodeValues(const std::vector<PointIndex> &point_ids,
+                    EncoderBuffer *out_buffer) override;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_DELTA_ATTRIBUTE_ENCODER_H_
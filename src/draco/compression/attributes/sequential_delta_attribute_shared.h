@@ -0,0 +1,30 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_DELTA_ATTRIBUTE_SHARED_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_DELTA_ATTRIBUTE_SHARED_H_
+
+#include <cstdint>
+
+namespace draco {
+
+// Number of parts each 64-bit delta symbol is split into by the
+// SequentialDeltaAttributeEncoder, and the size of a single part.
+static constexpr int kNumDeltaSymbolParts = 4;
+static constexpr int kDeltaSymbolPartBits = 16;
+static constexpr uint32_t kDeltaSymbolPartMask = 0xffff;
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_DELTA_ATTRIBUTE_SHARED_H_
@@ -14,9 +14,13 @@
 //
 #include "draco/compression/attributes/sequential_integer_attribute_decoder.h"
 
+#include <cstring>
+#include <type_traits>
+
 #include "draco/compression/attributes/prediction_schemes/prediction_scheme_decoder_factory.h"
 #include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_decoding_transform.h"
 #include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/core/coding_stats.h"
 
 namespace draco {
 
@@ -91,6 +95,74 @@ bool SequentialIntegerAttributeDecoder::DecodeValues(
   return true;
 }
 
+bool SequentialIntegerAttributeDecoder::SkipPortableAttribute(
+    const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer) {
+#ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
+  if (decoder()->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 0)) {
+    // Older files store the transform data together with the values.
+    return SequentialAttributeDecoder::SkipPortableAttribute(point_ids,
+                                                             in_buffer);
+  }
+#endif
+  int8_t prediction_scheme_method;
+  if (!in_buffer->Decode(&prediction_scheme_method)) {
+    return false;
+  }
+  if (prediction_scheme_method < PREDICTION_NONE ||
+      prediction_scheme_method >= NUM_PREDICTION_SCHEMES) {
+    return false;
+  }
+  std::unique_ptr<PredictionSchemeTypedDecoderInterface<int32_t>>
+      prediction_scheme;
+  if (prediction_scheme_method != PREDICTION_NONE) {
+    int8_t prediction_transform_type;
+    if (!in_buffer->Decode(&prediction_transform_type)) {
+      return false;
+    }
+    if (prediction_transform_type < PREDICTION_TRANSFORM_NONE ||
+        prediction_transform_type >= NUM_PREDICTION_SCHEME_TRANSFORM_TYPES) {
+      return false;
+    }
+    // The prediction scheme is created only to skip its data. Its parent
+    // attributes are not needed for that.
+    prediction_scheme = CreateIntPredictionScheme(
+        static_cast<PredictionSchemeMethod>(prediction_scheme_method),
+        static_cast<PredictionSchemeTransformType>(prediction_transform_type));
+  }
+
+  const int num_components = GetNumValueComponents();
+  if (num_components <= 0) {
+    return false;
+  }
+  const uint64_t num_values =
+      static_cast<uint64_t>(point_ids.size()) * num_components;
+  uint8_t compressed;
+  if (!in_buffer->Decode(&compressed)) {
+    return false;
+  }
+  if (compressed > 0) {
+    if (!SkipSymbols(static_cast<uint32_t>(num_values), num_components,
+                     in_buffer)) {
+      return false;
+    }
+  } else {
+    uint8_t num_bytes;
+    if (!in_buffer->Decode(&num_bytes)) {
+      return false;
+    }
+    const uint64_t num_value_bytes = num_bytes * num_values;
+    if (num_value_bytes > static_cast<uint64_t>(in_buffer->remaining_size())) {
+      return false;
+    }
+    in_buffer->Advance(num_value_bytes);
+  }
+  if (prediction_scheme &&
+      !prediction_scheme->DecodePredictionData(in_buffer)) {
+    return false;
+  }
+  return true;
+}
+
 std::unique_ptr<PredictionSchemeTypedDecoderInterface<int32_t>>
 SequentialIntegerAttributeDecoder::CreateIntPredictionScheme(
     PredictionSchemeMethod method,
@@ -116,50 +188,65 @@ bool SequentialIntegerAttributeDecoder::DecodeIntegerValues(
   if (portable_attribute_data == nullptr) {
     return false;
   }
-  uint8_t compressed;
-  if (!in_buffer->Decode(&compressed)) {
-    return false;
-  }
-  if (compressed > 0) {
-    // Decode compressed values.
-    if (!DecodeSymbols(static_cast<uint32_t>(num_values), num_components,
-                       in_buffer,
-                       reinterpret_cast<uint32_t *>(portable_attribute_data))) {
-      return false;
-    }
-  } else {
-    // Decode the integer data directly.
-    // Get the number of bytes for a given entry.
-    uint8_t num_bytes;
-    if (!in_buffer->Decode(&num_bytes)) {
+  {
+    const ScopedCodingStage stage(coding_stats(), coding_tracer(), "entropy",
+                                  attribute_id(), in_buffer);
+    uint8_t compressed;
+    if (!in_buffer->Decode(&compressed)) {
       return false;
     }
-    if (num_bytes == DataTypeLength(DT_INT32)) {
-      if (portable_attribute()->buffer()->data_size() <
-          sizeof(int32_t) * num_values) {
-        return false;
-      }
-      if (!in_buffer->Decode(portable_attribute_data,
-                             sizeof(int32_t) * num_values)) {
+    if (compressed > 0) {
+      // Decode compressed values.
+      if (!DecodeSymbols(
+              static_cast<uint32_t>(num_values), num_components, in_buffer,
+              reinterpret_cast<uint32_t *>(portable_attribute_data))) {
         return false;
       }
     } else {
-      if (portable_attribute()->buffer()->data_size() <
-          num_bytes * num_values) {
+      // Decode the integer data directly.
+      // Get the number of bytes for a given entry.
+      uint8_t num_bytes;
+      if (!in_buffer->Decode(&num_bytes)) {
         return false;
       }
-      if (in_buffer->remaining_size() <
-          static_cast<int64_t>(num_bytes) * static_cast<int64_t>(num_values)) {
-        return false;
-      }
-      for (size_t i = 0; i < num_values; ++i) {
-        if (!in_buffer->Decode(portable_attribute_data + i, num_bytes)) {
+      if (num_bytes == DataTypeLength(DT_INT32)) {
+        if (portable_attribute()->buffer()->data_size() <
+            sizeof(int32_t) * num_values) {
+          return false;
+        }
+        if (!in_buffer->Decode(portable_attribute_data,
+                               sizeof(int32_t) * num_values)) {
+          return false;
+        }
+      } else {
+        if (num_bytes > DataTypeLength(DT_INT32) ||
+            portable_attribute()->buffer()->data_size() <
+                num_bytes * num_values) {
           return false;
         }
+        const int64_t num_value_bytes =
+            static_cast<int64_t>(num_bytes) * static_cast<int64_t>(num_values);
+        if (in_buffer->remaining_size() < num_value_bytes) {
+          return false;
+        }
+        // All values were validated to fit in the buffer above.
+        const char *const src = in_buffer->data_head();
+        for (size_t i = 0; i < num_values; ++i) {
+          // The values are stored in their lowest |num_bytes| bytes. The
+          // remaining bytes must be cleared, because the portable attribute
+          // is not initialized.
+          int32_t value = 0;
+          memcpy(&value, src + i * num_bytes, num_bytes);
+          portable_attribute_data[i] = value;
+        }
+        in_buffer->Advance(num_value_bytes);
       }
     }
   }
 
+  const ScopedCodingStage stage(coding_stats(), coding_tracer(), "prediction",
+                                attribute_id(), in_buffer);
+
   if (num_values > 0 && (prediction_scheme_ == nullptr ||
                          !prediction_scheme_->AreCorrectionsPositive())) {
     // Convert the values back to the original signed format.
@@ -214,6 +301,33 @@ bool SequentialIntegerAttributeDecoder::StoreValues(uint32_t num_values) {
 template <typename AttributeTypeT>
 void SequentialIntegerAttributeDecoder::StoreTypedValues(uint32_t num_values) {
   const int num_components = attribute()->num_components();
+  if (num_values == 0) {
+    return;
+  }
+  if (std::is_same<AttributeTypeT, int32_t>::value) {
+    // The portable values are already stored in the attribute data type.
+    attribute()->buffer()->Write(0, GetPortableAttributeData(),
+                                 sizeof(int32_t) * num_components * num_values);
+    return;
+  }
+  // Use kernels with a fixed number of components for the common cases so
+  // that the conversion loop can be unrolled by the compiler.
+  switch (num_components) {
+    case 1:
+      StoreTypedValues<AttributeTypeT, 1>(num_values);
+      return;
+    case 2:
+      StoreTypedValues<AttributeTypeT, 2>(num_values);
+      return;
+    case 3:
+      StoreTypedValues<AttributeTypeT, 3>(num_values);
+      return;
+    case 4:
+      StoreTypedValues<AttributeTypeT, 4>(num_values);
+      return;
+    default:
+      break;
+  }
   const int entry_size = sizeof(AttributeTypeT) * num_components;
   const std::unique_ptr<AttributeTypeT[]> att_val(
       new AttributeTypeT[num_components]);
@@ -232,6 +346,22 @@ void SequentialIntegerAttributeDecoder::StoreTypedValues(uint32_t num_values) {
   }
 }
 
+template <typename AttributeTypeT, int num_components_t>
+void SequentialIntegerAttributeDecoder::StoreTypedValues(uint32_t num_values) {
+  const int32_t *const portable_attribute_data = GetPortableAttributeData();
+  // The attribute buffer was already resized in DecodePortableAttribute().
+  AttributeTypeT *const out_data =
+      reinterpret_cast<AttributeTypeT *>(attribute()->buffer()->data());
+  const int64_t num_entries =
+      static_cast<int64_t>(num_values) * num_components_t;
+  for (int64_t i = 0; i < num_entries; i += num_components_t) {
+    for (int c = 0; c < num_components_t; ++c) {
+      out_data[i + c] =
+          static_cast<AttributeTypeT>(portable_attribute_data[i + c]);
+    }
+  }
+}
+
 void SequentialIntegerAttributeDecoder::PreparePortableAttribute(
     int num_entries, int num_components) {
   GeometryAttribute ga;
@@ -239,7 +369,9 @@ void SequentialIntegerAttributeDecoder::PreparePortableAttribute(
           false, num_components * DataTypeLength(DT_INT32), 0);
   std::unique_ptr<PointAttribute> port_att(new PointAttribute(ga));
   port_att->SetIdentityMapping();
-  port_att->Reset(num_entries);
+  // All values are written by DecodeIntegerValues(), so there is no need to
+  // clear the storage first.
+  port_att->ResetUninitialized(num_entries);
   port_att->set_unique_id(attribute()->unique_id());
   SetPortableAttribute(std::move(port_att));
 }
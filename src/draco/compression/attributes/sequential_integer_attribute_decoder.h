@@ -29,6 +29,8 @@ class SequentialIntegerAttributeDecoder : public SequentialAttributeDecoder {
 
   bool TransformAttributeToOriginalFormat(
       const std::vector<PointIndex> &point_ids) override;
+  bool SkipPortableAttribute(const std::vector<PointIndex> &point_ids,
+                             DecoderBuffer *in_buffer) override;
 
  protected:
   bool DecodeValues(const std::vector<PointIndex> &point_ids,
@@ -67,6 +69,10 @@ class SequentialIntegerAttributeDecoder : public SequentialAttributeDecoder {
   template <typename AttributeTypeT>
   void StoreTypedValues(uint32_t num_values);
 
+  // Same as above for attributes with |num_components_t| components.
+  template <typename AttributeTypeT, int num_components_t>
+  void StoreTypedValues(uint32_t num_values);
+
   std::unique_ptr<PredictionSchemeTypedDecoderInterface<int32_t>>
       prediction_scheme_;
 };
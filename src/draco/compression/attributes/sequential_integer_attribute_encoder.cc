@@ -18,6 +18,7 @@
 #include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_encoding_transform.h"
 #include "draco/compression/entropy/symbol_encoding.h"
 #include "draco/core/bit_utils.h"
+#include "draco/core/coding_stats.h"
 
 namespace draco {
 
@@ -45,7 +46,7 @@ bool SequentialIntegerAttributeEncoder::Init(PointCloudEncoder *encoder,
   }
   // Init prediction scheme.
   const PredictionSchemeMethod prediction_scheme_method =
-      GetPredictionMethodFromOptions(attribute_id, *encoder->options());
+      GetPredictionMethodFromPlan(attribute_id, *encoder->plan());
 
   prediction_scheme_ = CreateIntPredictionScheme(prediction_scheme_method);
 
@@ -135,31 +136,45 @@ bool SequentialIntegerAttributeEncoder::EncodeValues(
   // process all encoded data in a separate array.
   std::vector<int32_t> encoded_data(num_values);
 
-  // All integer values are initialized. Process them using the prediction
-  // scheme if we have one.
-  if (prediction_scheme_) {
-    if (!prediction_scheme_->ComputeCorrectionValues(
-            portable_attribute_data, &encoded_data[0], num_values,
-            num_components, point_ids.data())) {
-      return false;
+  {
+    const ScopedCodingStage stage(coding_stats(), coding_tracer(),
+                                  "prediction", attribute_id());
+    // All integer values are initialized. Process them using the prediction
+    // scheme if we have one.
+    if (prediction_scheme_) {
+      if (!prediction_scheme_->ComputeCorrectionValues(
+              portable_attribute_data, &encoded_data[0], num_values,
+              num_components, point_ids.data())) {
+        return false;
+      }
     }
-  }
 
-  if (prediction_scheme_ == nullptr ||
-      !prediction_scheme_->AreCorrectionsPositive()) {
-    const int32_t *const input =
-        prediction_scheme_ ? encoded_data.data() : portable_attribute_data;
-    ConvertSignedIntsToSymbols(input, num_values,
-                               reinterpret_cast<uint32_t *>(&encoded_data[0]));
+    if (prediction_scheme_ == nullptr ||
+        !prediction_scheme_->AreCorrectionsPositive()) {
+      const int32_t *const input =
+          prediction_scheme_ ? encoded_data.data() : portable_attribute_data;
+      ConvertSignedIntsToSymbols(
+          input, num_values, reinterpret_cast<uint32_t *>(&encoded_data[0]));
+    }
   }
 
-  if (encoder() == nullptr || encoder()->options()->GetGlobalBool(
-                                  "use_built_in_attribute_compression", true)) {
+  const ScopedCodingStage stage(coding_stats(), coding_tracer(), "entropy",
+                                attribute_id(), out_buffer);
+  if (encoder() == nullptr ||
+      encoder()->plan()->use_built_in_attribute_compression()) {
     out_buffer->Encode(static_cast<uint8_t>(1));
     Options symbol_encoding_options;
     if (encoder() != nullptr) {
+      const EncodePlan *const plan = encoder()->plan();
       SetSymbolEncodingCompressionLevel(&symbol_encoding_options,
-                                        10 - encoder()->options()->GetSpeed());
+                                        10 - plan->speed());
+      if (plan->interleaved_symbol_coding()) {
+        SetSymbolEncodingInterleaved(&symbol_encoding_options, true);
+      }
+      if (plan->symbol_dictionary_id() != -1) {
+        SetSymbolEncodingDictionary(&symbol_encoding_options,
+                                    plan->symbol_dictionary_id());
+      }
     }
     if (!EncodeSymbols(reinterpret_cast<uint32_t *>(encoded_data.data()),
                        static_cast<int>(point_ids.size()) * num_components,
@@ -0,0 +1,52 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/attributes/sequential_lossless_float_attribute_decoder.h"
+
+#include "draco/compression/attributes/sequential_lossless_float_attribute_shared.h"
+
+namespace draco {
+
+SequentialLosslessFloatAttributeDecoder::
+    SequentialLosslessFloatAttributeDecoder() {}
+
+bool SequentialLosslessFloatAttributeDecoder::Init(PointCloudDecoder *decoder,
+                                                   int attribute_id) {
+  if (!SequentialIntegerAttributeDecoder::Init(decoder, attribute_id)) {
+    return false;
+  }
+  return attribute()->data_type() == DT_FLOAT32;
+}
+
+bool SequentialLosslessFloatAttributeDecoder::StoreValues(
+    uint32_t num_values) {
+  if (num_values == 0) {
+    return true;
+  }
+  const int32_t *const portable_attribute_data = GetPortableAttributeData();
+  const uint64_t num_entries =
+      static_cast<uint64_t>(num_values) * attribute()->num_components();
+  if (attribute()->buffer()->data_size() < sizeof(uint32_t) * num_entries) {
+    return false;
+  }
+  // The attribute buffer was already resized in DecodePortableAttribute().
+  uint32_t *const out_data =
+      reinterpret_cast<uint32_t *>(attribute()->buffer()->data());
+  for (uint64_t i = 0; i < num_entries; ++i) {
+    out_data[i] = OrderedIntToFloatBits(portable_attribute_data[i]);
+  }
+  return true;
+}
+
+}  // namespace draco
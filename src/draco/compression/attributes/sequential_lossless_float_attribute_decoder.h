@@ -0,0 +1,37 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_LOSSLESS_FLOAT_ATTRIBUTE_DECODER_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_LOSSLESS_FLOAT_ATTRIBUTE_DECODER_H_
+
+#include "draco/compression/attributes/sequential_integer_attribute_decoder.h"
+
+namespace draco {
+
+// Decoder for attribute values encoded with the
+// SequentialLosslessFloatAttributeEncoder.
+class SequentialLosslessFloatAttributeDecoder
+    : public SequentialIntegerAttributeDecoder {
+ public:
+  SequentialLosslessFloatAttributeDecoder();
+  bool Init(PointCloudDecoder *decoder, int attribute_id) override;
+
+ protected:
+  // Maps the decoded integers back to the float bit patterns.
+  bool StoreValues(uint32_t num_values) override;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_LOSSLESS_FLOAT_ATTRIBUTE_DECODER_H_
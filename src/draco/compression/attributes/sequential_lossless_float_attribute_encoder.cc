@@ -0,0 +1,89 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/attributes/sequential_lossless_float_attribute_encoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "draco/compression/attributes/sequential_lossless_float_attribute_shared.h"
+
+namespace draco {
+
+SequentialLosslessFloatAttributeEncoder::
+    SequentialLosslessFloatAttributeEncoder() {}
+
+bool SequentialLosslessFloatAttributeEncoder::Init(PointCloudEncoder *encoder,
+                                                   int attribute_id) {
+  // The data type must be checked before the base class creates the
+  // prediction scheme.
+  const PointAttribute *const attribute =
+      encoder->point_cloud()->attribute(attribute_id);
+  if (attribute == nullptr || attribute->data_type() != DT_FLOAT32) {
+    return false;
+  }
+  return SequentialIntegerAttributeEncoder::Init(encoder, attribute_id);
+}
+
+std::unique_ptr<PredictionSchemeTypedEncoderInterface<int32_t>>
+SequentialLosslessFloatAttributeEncoder::CreateIntPredictionScheme(
+    PredictionSchemeMethod method) {
+  if (method == PREDICTION_NONE) {
+    return nullptr;
+  }
+  // The wrap transform used by the integer prediction schemes can't handle
+  // values whose range doesn't fit into int32_t.
+  const PointAttribute *const attrib = attribute();
+  const int num_components = attrib->num_components();
+  int32_t min_value = std::numeric_limits<int32_t>::max();
+  int32_t max_value = std::numeric_limits<int32_t>::min();
+  std::vector<uint32_t> bits(num_components);
+  for (AttributeValueIndex avi(0); avi < static_cast<uint32_t>(attrib->size());
+       ++avi) {
+    memcpy(bits.data(), attrib->GetAddress(avi),
+           sizeof(uint32_t) * num_components);
+    for (int c = 0; c < num_components; ++c) {
+      const int32_t value = FloatBitsToOrderedInt(bits[c]);
+      min_value = std::min(min_value, value);
+      max_value = std::max(max_value, value);
+    }
+  }
+  if (static_cast<int64_t>(max_value) - static_cast<int64_t>(min_value) >=
+      std::numeric_limits<int32_t>::max()) {
+    return nullptr;
+  }
+  return SequentialIntegerAttributeEncoder::CreateIntPredictionScheme(method);
+}
+
+bool SequentialLosslessFloatAttributeEncoder::PrepareValues(
+    const std::vector<PointIndex> &point_ids, int num_points) {
+  const PointAttribute *const attrib = attribute();
+  const int num_components = attrib->num_components();
+  const int num_entries = static_cast<int>(point_ids.size());
+  PreparePortableAttribute(num_entries, num_components, num_points);
+  int32_t *const portable_attribute_data = GetPortableAttributeData();
+  std::vector<uint32_t> bits(num_components);
+  int dst_index = 0;
+  for (const PointIndex pi : point_ids) {
+    memcpy(bits.data(), attrib->GetAddress(attrib->mapped_index(pi)),
+           sizeof(uint32_t) * num_components);
+    for (int c = 0; c < num_components; ++c) {
+      portable_attribute_data[dst_index++] = FloatBitsToOrderedInt(bits[c]);
+    }
+  }
+  return true;
+}
+
+}  // namespace draco
@@ -0,0 +1,51 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_LOSSLESS_FLOAT_ATTRIBUTE_ENCODER_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_LOSSLESS_FLOAT_ATTRIBUTE_ENCODER_H_
+
+#include "draco/compression/attributes/sequential_integer_attribute_encoder.h"
+
+namespace draco {
+
+// Attribute encoder for bit-exact encoding of DT_FLOAT32 attributes. The bit
+// patterns of the floats are mapped to ordered integers (see
+// sequential_lossless_float_attribute_shared.h) that are then processed by the
+// same prediction schemes and entropy coder as integer attributes.
+//
+// The integer prediction schemes require the range of the mapped values to fit
+// into a signed 32-bit integer. This holds for attributes whose values have
+// the same sign or whose magnitudes are below 2. Other attributes are encoded
+// without a prediction scheme.
+class SequentialLosslessFloatAttributeEncoder
+    : public SequentialIntegerAttributeEncoder {
+ public:
+  SequentialLosslessFloatAttributeEncoder();
+  uint8_t GetUniqueId() const override {
+    return SEQUENTIAL_ATTRIBUTE_ENCODER_LOSSLESS_FLOAT;
+  }
+  bool Init(PointCloudEncoder *encoder, int attribute_id) override;
+
+ protected:
+  std::unique_ptr<PredictionSchemeTypedEncoderInterface<int32_t>>
+  CreateIntPredictionScheme(PredictionSchemeMethod method) override;
+
+  // Puts the mapped float bit patterns into the portable attribute.
+  bool PrepareValues(const std::vector<PointIndex> &point_ids,
+                     int num_points) override;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_LOSSLESS_FLOAT_ATTRIBUTE_ENCODER_H_
@@ -0,0 +1,200 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "draco/compression/attributes/sequential_lossless_float_attribute_decoder.h"
+#include "draco/compression/attributes/sequential_lossless_float_attribute_encoder.h"
+#include "draco/compression/attributes/sequential_lossless_float_attribute_shared.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/decode.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace draco {
+
+class SequentialLosslessFloatAttributeEncodingTest : public ::testing::Test {
+ protected:
+  // Encodes |mesh| with the edgebreaker method and parallelogram prediction of
+  // positions, optionally using the lossless float coding of positions.
+  static bool EncodeMesh(const Mesh &mesh, bool lossless_float_coding,
+                         EncoderBuffer *buffer) {
+    ExpertEncoder encoder(mesh);
+    encoder.SetEncodingMethod(MESH_EDGEBREAKER_ENCODING);
+    const int pos_att_id =
+        mesh.GetNamedAttributeId(GeometryAttribute::POSITION);
+    encoder.SetAttributePredictionScheme(pos_att_id,
+                                         MESH_PREDICTION_PARALLELOGRAM);
+    encoder.SetAttributeLosslessFloatCoding(pos_att_id, lossless_float_coding);
+    return encoder.EncodeToBuffer(buffer).ok();
+  }
+
+  // Verifies that the positions of |decoded_mesh| have the same bit patterns
+  // as the positions of |mesh| for all points.
+  static void VerifyPositions(const Mesh &mesh, const Mesh &decoded_mesh) {
+    const PointAttribute *const pos = mesh.GetNamedAttribute(
+        GeometryAttribute::POSITION);
+    const PointAttribute *const decoded_pos =
+        decoded_mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+    ASSERT_NE(decoded_pos, nullptr);
+    ASSERT_EQ(decoded_pos->data_type(), DT_FLOAT32);
+    ASSERT_EQ(decoded_mesh.num_points(), mesh.num_points());
+    // The encoder may reorder points, so the positions are compared as sets.
+    std::vector<std::array<uint32_t, 3>> values, decoded_values;
+    for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+      std::array<uint32_t, 3> value, decoded_value;
+      memcpy(value.data(), pos->GetAddress(pos->mapped_index(pi)),
+             sizeof(value));
+      memcpy(decoded_value.data(),
+             decoded_pos->GetAddress(decoded_pos->mapped_index(pi)),
+             sizeof(decoded_value));
+      values.push_back(value);
+      decoded_values.push_back(decoded_value);
+    }
+    std::sort(values.begin(), values.end());
+    std::sort(decoded_values.begin(), decoded_values.end());
+    ASSERT_EQ(values, decoded_values);
+  }
+};
+
+TEST_F(SequentialLosslessFloatAttributeEncodingTest, TestOrderedIntMapping) {
+  // Tests that the mapping preserves the order of floats and that it can be
+  // reverted for all special values.
+  const float values[] = {-std::numeric_limits<float>::infinity(),
+                          -1.5f,
+                          -std::numeric_limits<float>::denorm_min(),
+                          -0.f,
+                          0.f,
+                          std::numeric_limits<float>::denorm_min(),
+                          1.f,
+                          std::nextafter(1.f, 2.f),
+                          std::numeric_limits<float>::max(),
+                          std::numeric_limits<float>::infinity()};
+  int32_t prev_value = std::numeric_limits<int32_t>::min();
+  for (const float value : values) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    const int32_t mapped_value = FloatBitsToOrderedInt(bits);
+    ASSERT_GT(mapped_value, prev_value);
+    ASSERT_EQ(OrderedIntToFloatBits(mapped_value), bits);
+    prev_value = mapped_value;
+  }
+  // Neighboring floats are mapped to neighboring integers.
+  uint32_t bits;
+  const float one = 1.f;
+  memcpy(&bits, &one, sizeof(bits));
+  const float next_one = std::nextafter(1.f, 2.f);
+  uint32_t next_bits;
+  memcpy(&next_bits, &next_one, sizeof(next_bits));
+  ASSERT_EQ(FloatBitsToOrderedInt(next_bits), FloatBitsToOrderedInt(bits) + 1);
+  ASSERT_EQ(OrderedIntToFloatBits(std::numeric_limits<int32_t>::min()),
+            0xffffffffu);
+}
+
+TEST_F(SequentialLosslessFloatAttributeEncodingTest, TestStandalone) {
+  // Tests that values with the full range of bit patterns, including NaNs,
+  // are decoded bit-exactly.
+  const std::vector<uint32_t> bits{0x00000000, 0x80000000, 0x3f800000,
+                                   0xbf800000, 0x7f800000, 0xff800000,
+                                   0x7fc00001, 0xffffffff, 0x00000001,
+                                   0x4b189680, 0xcb189680, 0x3eaaaaab};
+  PointAttribute pa;
+  pa.Init(GeometryAttribute::GENERIC, 1, DT_FLOAT32, false, bits.size());
+  for (uint32_t i = 0; i < bits.size(); ++i) {
+    pa.SetAttributeValue(AttributeValueIndex(i), &bits[i]);
+  }
+  std::vector<PointIndex> point_ids(bits.size());
+  std::iota(point_ids.begin(), point_ids.end(), 0);
+
+  EncoderBuffer out_buf;
+  SequentialLosslessFloatAttributeEncoder encoder;
+  ASSERT_TRUE(encoder.InitializeStandalone(&pa));
+  ASSERT_TRUE(encoder.TransformAttributeToPortableFormat(point_ids));
+  ASSERT_TRUE(encoder.EncodePortableAttribute(point_ids, &out_buf));
+  ASSERT_TRUE(encoder.EncodeDataNeededByPortableTransform(&out_buf));
+
+  PointAttribute decoded_pa;
+  decoded_pa.Init(GeometryAttribute::GENERIC, 1, DT_FLOAT32, false,
+                  bits.size());
+  DecoderBuffer in_buf;
+  in_buf.Init(out_buf.data(), out_buf.size());
+  in_buf.set_bitstream_version(kDracoMeshBitstreamVersion);
+  SequentialLosslessFloatAttributeDecoder decoder;
+  ASSERT_TRUE(decoder.InitializeStandalone(&decoded_pa));
+  ASSERT_TRUE(decoder.DecodePortableAttribute(point_ids, &in_buf));
+  ASSERT_TRUE(decoder.DecodeDataNeededByPortableTransform(point_ids, &in_buf));
+  ASSERT_TRUE(decoder.TransformAttributeToOriginalFormat(point_ids));
+
+  for (uint32_t i = 0; i < bits.size(); ++i) {
+    uint32_t decoded_bits;
+    decoded_pa.GetValue(AttributeValueIndex(i), &decoded_bits);
+    ASSERT_EQ(decoded_bits, bits[i]);
+  }
+}
+
+TEST_F(SequentialLosslessFloatAttributeEncodingTest, TestMeshPositions) {
+  // Tests that positions of a mesh are decoded bit-exactly and that they are
+  // compressed better than without the lossless float coding.
+  const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+
+  EncoderBuffer raw_buffer;
+  ASSERT_TRUE(EncodeMesh(*mesh, false, &raw_buffer));
+  EncoderBuffer buffer;
+  ASSERT_TRUE(EncodeMesh(*mesh, true, &buffer));
+  ASSERT_LT(buffer.size(), raw_buffer.size());
+
+  DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  Decoder decoder;
+  DRACO_ASSIGN_OR_ASSERT(const std::unique_ptr<Mesh> decoded_mesh,
+                         decoder.DecodeMeshFromBuffer(&in_buffer));
+  VerifyPositions(*mesh, *decoded_mesh);
+}
+
+TEST_F(SequentialLosslessFloatAttributeEncodingTest, TestWideRange) {
+  // Tests that positions whose mapped range doesn't fit into int32_t are
+  // encoded without a prediction scheme and still decoded bit-exactly.
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  PointAttribute *const pos =
+      mesh->attribute(mesh->GetNamedAttributeId(GeometryAttribute::POSITION));
+  for (AttributeValueIndex avi(0); avi < pos->size(); ++avi) {
+    std::array<float, 3> value;
+    pos->GetValue(avi, &value);
+    for (int c = 0; c < 3; ++c) {
+      value[c] = value[c] > 0.5f ? 1e30f : -1e30f;
+    }
+    value[0] = -0.f;
+    pos->SetAttributeValue(avi, value.data());
+  }
+
+  EncoderBuffer buffer;
+  ASSERT_TRUE(EncodeMesh(*mesh, true, &buffer));
+  DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  Decoder decoder;
+  DRACO_ASSIGN_OR_ASSERT(const std::unique_ptr<Mesh> decoded_mesh,
+                         decoder.DecodeMeshFromBuffer(&in_buffer));
+  VerifyPositions(*mesh, *decoded_mesh);
+}
+
+}  // namespace draco
@@ -0,0 +1,45 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_LOSSLESS_FLOAT_ATTRIBUTE_SHARED_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_LOSSLESS_FLOAT_ATTRIBUTE_SHARED_H_
+
+#include <cstdint>
+
+namespace draco {
+
+// Maps the bit pattern of a 32-bit IEEE float to a signed integer so that the
+// integers are ordered in the same way as the floats they represent. The sign
+// and magnitude bits are converted to a two's complement value, i.e., positive
+// floats keep their bit pattern and a negative float with magnitude bits M is
+// mapped to -1 - M. Neighboring float values are therefore mapped to
+// neighboring integers and integer prediction schemes can be applied to them.
+// The mapping is a bijection over all bit patterns, including -0, infinities
+// and NaNs.
+inline int32_t FloatBitsToOrderedInt(uint32_t bits) {
+  const int32_t magnitude = static_cast<int32_t>(bits & 0x7fffffff);
+  return (bits >> 31) ? -1 - magnitude : magnitude;
+}
+
+// Inverse of FloatBitsToOrderedInt().
+inline uint32_t OrderedIntToFloatBits(int32_t value) {
+  if (value >= 0) {
+    return static_cast<uint32_t>(value);
+  }
+  return 0x80000000 | static_cast<uint32_t>(-1 - value);
+}
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_LOSSLESS_FLOAT_ATTRIBUTE_SHARED_H_
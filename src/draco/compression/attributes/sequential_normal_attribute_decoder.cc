@@ -15,6 +15,7 @@
 #include "draco/compression/attributes/sequential_normal_attribute_decoder.h"
 
 #include "draco/compression/attributes/normal_compression_utils.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -67,10 +68,30 @@ bool SequentialNormalAttributeDecoder::DecodeDataNeededByPortableTransform(
   return octahedral_transform_.TransferToAttribute(portable_attribute());
 }
 
+bool SequentialNormalAttributeDecoder::SkipDataNeededByPortableTransform(
+    DecoderBuffer *in_buffer) {
+#ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
+  if (decoder()->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 0)) {
+    // The parameters were decoded together with the skipped values.
+    return octahedral_transform_.TransferToAttribute(attribute());
+  }
+#endif
+  // The octahedral transform does not use any data from the attribute.
+  if (!octahedral_transform_.DecodeParameters(*attribute(), in_buffer)) {
+    return false;
+  }
+  // Keep the parameters with the attribute so that they can be queried even
+  // though the values are not decoded.
+  return octahedral_transform_.TransferToAttribute(attribute());
+}
+
 bool SequentialNormalAttributeDecoder::StoreValues(uint32_t num_points) {
-  // Convert all quantized values back to floats.
+  // Convert all quantized values back to floats. Large attributes are split
+  // into chunks that are converted on the thread pool of the decoder.
+  ThreadPool *const pool =
+      decoder()->options() ? decoder()->options()->thread_pool() : nullptr;
   return octahedral_transform_.InverseTransformAttribute(
-      *GetPortableAttribute(), attribute());
+      *GetPortableAttribute(), attribute(), pool);
 }
 
 }  // namespace draco
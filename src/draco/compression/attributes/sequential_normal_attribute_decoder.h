@@ -40,6 +40,7 @@ class SequentialNormalAttributeDecoder
   bool DecodeDataNeededByPortableTransform(
       const std::vector<PointIndex> &point_ids,
       DecoderBuffer *in_buffer) override;
+  bool SkipDataNeededByPortableTransform(DecoderBuffer *in_buffer) override;
   bool StoreValues(uint32_t num_points) override;
 
  private:
@@ -29,8 +29,8 @@ bool SequentialNormalAttributeEncoder::Init(PointCloudEncoder *encoder,
   }
 
   // Initialize AttributeOctahedronTransform.
-  const int quantization_bits = encoder->options()->GetAttributeInt(
-      attribute_id, "quantization_bits", -1);
+  const int quantization_bits =
+      encoder->plan()->attribute(attribute_id).quantization_bits;
   if (quantization_bits < 1) {
     return false;
   }
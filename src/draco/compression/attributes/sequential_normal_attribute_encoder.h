@@ -51,14 +51,16 @@ class SequentialNormalAttributeEncoder
     typedef PredictionSchemeNormalOctahedronCanonicalizedEncodingTransform<
         int32_t>
         Transform;
-    const int32_t quantization_bits = encoder()->options()->GetAttributeInt(
-        attribute_id(), "quantization_bits", -1);
+    const AttributeEncodePlan &att_plan =
+        encoder()->plan()->attribute(attribute_id());
+    const int32_t quantization_bits = att_plan.quantization_bits;
     const int32_t max_value = (1 << quantization_bits) - 1;
     const Transform transform(max_value);
     const PredictionSchemeMethod default_prediction_method =
         SelectPredictionMethod(attribute_id(), encoder());
-    const int32_t prediction_method = encoder()->options()->GetAttributeInt(
-        attribute_id(), "prediction_scheme", default_prediction_method);
+    const int32_t prediction_method = att_plan.prediction_scheme != -1
+                                          ? att_plan.prediction_scheme
+                                          : default_prediction_method;
 
     if (prediction_method == MESH_PREDICTION_GEOMETRIC_NORMAL) {
       return CreatePredictionSchemeForEncoder<int32_t, Transform>(
@@ -15,6 +15,7 @@
 #include "draco/compression/attributes/sequential_quantization_attribute_decoder.h"
 
 #include "draco/core/quantization_utils.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -61,6 +62,23 @@ bool SequentialQuantizationAttributeDecoder::
   return quantization_transform_.TransferToAttribute(portable_attribute());
 }
 
+bool SequentialQuantizationAttributeDecoder::SkipDataNeededByPortableTransform(
+    DecoderBuffer *in_buffer) {
+#ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
+  if (decoder()->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 0)) {
+    // The parameters were decoded together with the skipped values.
+    return quantization_transform_.TransferToAttribute(attribute());
+  }
+#endif
+  // Only the number of components of the attribute is used by the transform.
+  if (!quantization_transform_.DecodeParameters(*attribute(), in_buffer)) {
+    return false;
+  }
+  // Keep the parameters with the attribute so that they can be queried even
+  // though the values are not decoded.
+  return quantization_transform_.TransferToAttribute(attribute());
+}
+
 bool SequentialQuantizationAttributeDecoder::StoreValues(uint32_t num_points) {
   return DequantizeValues(num_points);
 }
@@ -80,9 +98,12 @@ bool SequentialQuantizationAttributeDecoder::DecodeQuantizedDataInfo() {
 
 bool SequentialQuantizationAttributeDecoder::DequantizeValues(
     uint32_t num_values) {
-  // Convert all quantized values back to floats.
+  // Convert all quantized values back to floats. Large attributes are split
+  // into chunks that are dequantized on the thread pool of the decoder.
+  ThreadPool *const pool =
+      decoder()->options() ? decoder()->options()->thread_pool() : nullptr;
   return quantization_transform_.InverseTransformAttribute(
-      *GetPortableAttribute(), attribute());
+      *GetPortableAttribute(), attribute(), pool);
 }
 
 }  // namespace draco
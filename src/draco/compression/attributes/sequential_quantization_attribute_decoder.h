@@ -35,6 +35,7 @@ class SequentialQuantizationAttributeDecoder
   bool DecodeDataNeededByPortableTransform(
       const std::vector<PointIndex> &point_ids,
       DecoderBuffer *in_buffer) override;
+  bool SkipDataNeededByPortableTransform(DecoderBuffer *in_buffer) override;
   bool StoreValues(uint32_t num_points) override;
 
   // Decodes data necessary for dequantizing the encoded values.
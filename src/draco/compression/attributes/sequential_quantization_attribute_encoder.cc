@@ -34,31 +34,24 @@ bool SequentialQuantizationAttributeEncoder::Init(PointCloudEncoder *encoder,
   }
 
   // Initialize AttributeQuantizationTransform.
-  const int quantization_bits = encoder->options()->GetAttributeInt(
-      attribute_id, "quantization_bits", -1);
+  const AttributeEncodePlan &att_plan =
+      encoder->plan()->attribute(attribute_id);
+  const int quantization_bits = att_plan.quantization_bits;
   if (quantization_bits < 1) {
     return false;
   }
-  if (encoder->options()->IsAttributeOptionSet(attribute_id,
-                                               "quantization_origin") &&
-      encoder->options()->IsAttributeOptionSet(attribute_id,
-                                               "quantization_range")) {
+  if (!att_plan.quantization_origin.empty()) {
     // Quantization settings are explicitly specified in the provided options.
-    std::vector<float> quantization_origin(attribute->num_components());
-    encoder->options()->GetAttributeVector(attribute_id, "quantization_origin",
-                                           attribute->num_components(),
-                                           &quantization_origin[0]);
-    const float range = encoder->options()->GetAttributeFloat(
-        attribute_id, "quantization_range", 1.f);
     if (!attribute_quantization_transform_.SetParameters(
-            quantization_bits, quantization_origin.data(),
-            attribute->num_components(), range)) {
+            quantization_bits, att_plan.quantization_origin.data(),
+            attribute->num_components(), att_plan.quantization_range)) {
       return false;
     }
   } else {
     // Compute quantization settings from the attribute values.
     if (!attribute_quantization_transform_.ComputeParameters(
-            *attribute, quantization_bits)) {
+            *attribute, quantization_bits,
+            encoder->options()->thread_pool())) {
       return false;
     }
   }
@@ -0,0 +1,55 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/attributes/sequential_ycocg_attribute_decoder.h"
+
+#include "draco/core/thread_pool.h"
+
+namespace draco {
+
+SequentialYCoCgAttributeDecoder::SequentialYCoCgAttributeDecoder() {}
+
+bool SequentialYCoCgAttributeDecoder::Init(PointCloudDecoder *decoder,
+                                           int attribute_id) {
+  if (!SequentialIntegerAttributeDecoder::Init(decoder, attribute_id)) {
+    return false;
+  }
+  return AttributeYCoCgTransform::IsSupported(attribute()->data_type(),
+                                              attribute()->num_components());
+}
+
+bool SequentialYCoCgAttributeDecoder::DecodeDataNeededByPortableTransform(
+    const std::vector<PointIndex> & /* point_ids */,
+    DecoderBuffer * /* in_buffer */) {
+  // Store the transform data in the portable attribute so that the transform
+  // can be identified when the output attribute is replaced by the portable
+  // attribute.
+  return ycocg_transform_.TransferToAttribute(portable_attribute());
+}
+
+bool SequentialYCoCgAttributeDecoder::SkipDataNeededByPortableTransform(
+    DecoderBuffer * /* in_buffer */) {
+  return ycocg_transform_.TransferToAttribute(attribute());
+}
+
+bool SequentialYCoCgAttributeDecoder::StoreValues(
+    uint32_t /* num_values */) {
+  ThreadPool *const pool =
+      decoder() && decoder()->options() ? decoder()->options()->thread_pool()
+                                        : nullptr;
+  return ycocg_transform_.InverseTransformAttribute(*GetPortableAttribute(),
+                                                    attribute(), pool);
+}
+
+}  // namespace draco
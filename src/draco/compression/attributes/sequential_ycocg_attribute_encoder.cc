@@ -0,0 +1,53 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/attributes/sequential_ycocg_attribute_encoder.h"
+
+#include "draco/attributes/attribute_ycocg_transform.h"
+
+namespace draco {
+
+SequentialYCoCgAttributeEncoder::SequentialYCoCgAttributeEncoder() {}
+
+bool SequentialYCoCgAttributeEncoder::Init(PointCloudEncoder *encoder,
+                                           int attribute_id) {
+  // The data type must be checked before the base class creates the
+  // prediction scheme.
+  const PointAttribute *const attribute =
+      encoder->point_cloud()->attribute(attribute_id);
+  if (attribute == nullptr ||
+      !AttributeYCoCgTransform::IsSupported(attribute->data_type(),
+                                            attribute->num_components())) {
+    return false;
+  }
+  return SequentialIntegerAttributeEncoder::Init(encoder, attribute_id);
+}
+
+bool SequentialYCoCgAttributeEncoder::PrepareValues(
+    const std::vector<PointIndex> &point_ids, int num_points) {
+  if (!AttributeYCoCgTransform::IsSupported(attribute()->data_type(),
+                                            attribute()->num_components())) {
+    return false;
+  }
+  if (!SequentialIntegerAttributeEncoder::PrepareValues(point_ids,
+                                                        num_points)) {
+    return false;
+  }
+  AttributeYCoCgTransform::TransformValues(GetPortableAttributeData(),
+                                           point_ids.size(),
+                                           attribute()->num_components());
+  return true;
+}
+
+}  // namespace draco
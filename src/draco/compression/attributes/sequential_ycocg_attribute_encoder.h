@@ -0,0 +1,44 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_YCOCG_ATTRIBUTE_ENCODER_H_
+#define DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_YCOCG_ATTRIBUTE_ENCODER_H_
+
+#include "draco/compression/attributes/sequential_integer_attribute_encoder.h"
+
+namespace draco {
+
+// Attribute encoder for integer colors that are converted to the YCoCg-R
+// color space by AttributeYCoCgTransform before they are processed by the
+// prediction schemes and the entropy coder of integer attributes. The encoding
+// is lossless. Supports attributes with 8-bit and 16-bit integer data types
+// and at least three components.
+class SequentialYCoCgAttributeEncoder
+    : public SequentialIntegerAttributeEncoder {
+ public:
+  SequentialYCoCgAttributeEncoder();
+  uint8_t GetUniqueId() const override {
+    return SEQUENTIAL_ATTRIBUTE_ENCODER_YCOCG;
+  }
+  bool Init(PointCloudEncoder *encoder, int attribute_id) override;
+
+ protected:
+  // Puts the transformed colors into the portable attribute.
+  bool PrepareValues(const std::vector<PointIndex> &point_ids,
+                     int num_points) override;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ATTRIBUTES_SEQUENTIAL_YCOCG_ATTRIBUTE_ENCODER_H_
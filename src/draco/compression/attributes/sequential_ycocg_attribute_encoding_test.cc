@@ -0,0 +1,186 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
+
+#include "draco/attributes/attribute_ycocg_transform.h"
+#include "draco/compression/attributes/sequential_ycocg_attribute_decoder.h"
+#include "draco/compression/attributes/sequential_ycocg_attribute_encoder.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/decode.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/cpu_features.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace draco {
+
+class SequentialYCoCgAttributeEncodingTest : public ::testing::Test {
+ protected:
+  // Encodes |values| stored in a COLOR attribute with |num_components|
+  // components of type |DataTypeT| and verifies that they are decoded
+  // exactly.
+  template <typename DataTypeT>
+  static void TestStandalone(const std::vector<DataTypeT> &values,
+                             int num_components, DataType data_type) {
+    const int num_values = values.size() / num_components;
+    PointAttribute pa;
+    pa.Init(GeometryAttribute::COLOR, num_components, data_type, false,
+            num_values);
+    for (int i = 0; i < num_values; ++i) {
+      pa.SetAttributeValue(AttributeValueIndex(i),
+                           &values[i * num_components]);
+    }
+    std::vector<PointIndex> point_ids(num_values);
+    std::iota(point_ids.begin(), point_ids.end(), 0);
+
+    EncoderBuffer out_buf;
+    SequentialYCoCgAttributeEncoder encoder;
+    ASSERT_TRUE(encoder.InitializeStandalone(&pa));
+    ASSERT_TRUE(encoder.TransformAttributeToPortableFormat(point_ids));
+    ASSERT_TRUE(encoder.EncodePortableAttribute(point_ids, &out_buf));
+    ASSERT_TRUE(encoder.EncodeDataNeededByPortableTransform(&out_buf));
+
+    PointAttribute decoded_pa;
+    decoded_pa.Init(GeometryAttribute::COLOR, num_components, data_type,
+                    false, num_values);
+    DecoderBuffer in_buf;
+    in_buf.Init(out_buf.data(), out_buf.size());
+    in_buf.set_bitstream_version(kDracoMeshBitstreamVersion);
+    SequentialYCoCgAttributeDecoder decoder;
+    ASSERT_TRUE(decoder.InitializeStandalone(&decoded_pa));
+    ASSERT_TRUE(decoder.DecodePortableAttribute(point_ids, &in_buf));
+    ASSERT_TRUE(
+        decoder.DecodeDataNeededByPortableTransform(point_ids, &in_buf));
+    ASSERT_TRUE(decoder.TransformAttributeToOriginalFormat(point_ids));
+
+    std::vector<DataTypeT> decoded_value(num_components);
+    for (int i = 0; i < num_values; ++i) {
+      decoded_pa.GetValue(AttributeValueIndex(i), decoded_value.data());
+      for (int c = 0; c < num_components; ++c) {
+        ASSERT_EQ(decoded_value[c], values[i * num_components + c]);
+      }
+    }
+  }
+
+  // Returns the sorted colors of all points of |mesh|.
+  static std::vector<std::array<uint8_t, 4>> GetColors(const Mesh &mesh) {
+    const PointAttribute *const color =
+        mesh.GetNamedAttribute(GeometryAttribute::COLOR);
+    std::vector<std::array<uint8_t, 4>> colors;
+    for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+      std::array<uint8_t, 4> value = {0, 0, 0, 0};
+      color->GetValue(color->mapped_index(pi), value.data());
+      colors.push_back(value);
+    }
+    std::sort(colors.begin(), colors.end());
+    return colors;
+  }
+};
+
+TEST_F(SequentialYCoCgAttributeEncodingTest, TestInverseMatchesScalar) {
+  // Tests that the vectorized inverse transform returns the same values as
+  // the scalar one for all supported numbers of components. The number of
+  // values is not a multiple of the SIMD width.
+  for (const int num_components : {3, 4, 5}) {
+    const int num_values = 37;
+    std::vector<int32_t> values(num_values * num_components);
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = static_cast<int32_t>((i * 7919) % 65536) - 32768;
+    }
+    const std::vector<int32_t> original_values = values;
+    AttributeYCoCgTransform::TransformValues(values.data(), num_values,
+                                             num_components);
+    std::vector<int32_t> simd_values(values.size());
+    AttributeYCoCgTransform::InverseTransformValues(
+        values.data(), num_values, num_components, simd_values.data());
+    ASSERT_EQ(simd_values, original_values);
+
+    ASSERT_TRUE(ForceSimdTarget(SIMD_TARGET_SCALAR));
+    std::vector<int32_t> scalar_values(values.size());
+    AttributeYCoCgTransform::InverseTransformValues(
+        values.data(), num_values, num_components, scalar_values.data());
+    ResetSimdTarget();
+    ASSERT_EQ(scalar_values, original_values);
+  }
+}
+
+TEST_F(SequentialYCoCgAttributeEncodingTest, TestUint8Extremes) {
+  // Tests all combinations of the extreme channel values.
+  std::vector<uint8_t> rgb, rgba;
+  const uint8_t extremes[] = {0, 1, 127, 128, 254, 255};
+  for (const uint8_t r : extremes) {
+    for (const uint8_t g : extremes) {
+      for (const uint8_t b : extremes) {
+        rgb.insert(rgb.end(), {r, g, b});
+        rgba.insert(rgba.end(), {r, g, b, static_cast<uint8_t>(r ^ b)});
+      }
+    }
+  }
+  // Make the number of values not a multiple of four.
+  rgb.insert(rgb.end(), {10, 20, 30});
+  rgba.insert(rgba.end(), {10, 20, 30, 40});
+  TestStandalone(rgb, 3, DT_UINT8);
+  TestStandalone(rgba, 4, DT_UINT8);
+}
+
+TEST_F(SequentialYCoCgAttributeEncodingTest, TestInt16) {
+  const std::vector<uint16_t> values = {0,     65535, 0,     65535, 0, 65535,
+                                        12345, 54321, 33333, 1,     2, 3,
+                                        65535, 65535, 65535};
+  TestStandalone(values, 3, DT_UINT16);
+  const std::vector<int16_t> signed_values = {-32768, 32767, -32768, 32767,
+                                              -1,     0,     1,      -2};
+  TestStandalone(signed_values, 4, DT_INT16);
+}
+
+TEST_F(SequentialYCoCgAttributeEncodingTest, TestUnsupportedDataType) {
+  PointAttribute pa;
+  pa.Init(GeometryAttribute::COLOR, 3, DT_UINT32, false, 1);
+  SequentialYCoCgAttributeEncoder encoder;
+  ASSERT_TRUE(encoder.InitializeStandalone(&pa));
+  ASSERT_FALSE(encoder.TransformAttributeToPortableFormat({PointIndex(0)}));
+  ASSERT_FALSE(AttributeYCoCgTransform::IsSupported(DT_UINT8, 2));
+  ASSERT_FALSE(AttributeYCoCgTransform::IsSupported(DT_FLOAT32, 3));
+}
+
+TEST_F(SequentialYCoCgAttributeEncodingTest, TestMeshColors) {
+  // Tests that the colors of a mesh are decoded exactly with both encoding
+  // methods.
+  const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("test_pos_color.ply");
+  ASSERT_NE(mesh, nullptr);
+  const int color_att_id = mesh->GetNamedAttributeId(GeometryAttribute::COLOR);
+  ASSERT_GE(color_att_id, 0);
+  for (const int method :
+       {MESH_SEQUENTIAL_ENCODING, MESH_EDGEBREAKER_ENCODING}) {
+    ExpertEncoder encoder(*mesh);
+    encoder.SetEncodingMethod(method);
+    encoder.SetAttributeYCoCgTransform(color_att_id, true);
+    EncoderBuffer buffer;
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(&buffer));
+
+    DecoderBuffer in_buffer;
+    in_buffer.Init(buffer.data(), buffer.size());
+    Decoder decoder;
+    DRACO_ASSIGN_OR_ASSERT(const std::unique_ptr<Mesh> decoded_mesh,
+                           decoder.DecodeMeshFromBuffer(&in_buffer));
+    ASSERT_EQ(decoded_mesh->num_points(), mesh->num_points());
+    ASSERT_EQ(GetColors(*decoded_mesh), GetColors(*mesh));
+  }
+}
+
+}  // namespace draco
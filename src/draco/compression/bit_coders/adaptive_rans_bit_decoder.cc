@@ -14,6 +14,8 @@
 //
 #include "draco/compression/bit_coders/adaptive_rans_bit_decoder.h"
 
+#include <algorithm>
+
 #include "draco/compression/bit_coders/adaptive_rans_bit_coding_shared.h"
 
 namespace draco {
@@ -54,14 +56,41 @@ void AdaptiveRAnsBitDecoder::DecodeLeastSignificantBits32(int nbits,
   DRACO_DCHECK_EQ(true, nbits <= 32);
   DRACO_DCHECK_EQ(true, nbits > 0);
 
+  // Work on a local copy of the decoder state so that it can be kept in
+  // registers for all decoded bits.
+  AnsDecoder ans = ans_decoder_;
+  double p0_f = p0_f_;
   uint32_t result = 0;
   while (nbits) {
-    result = (result << 1) + DecodeNextBit();
+    const bool bit =
+        static_cast<bool>(rabs_read(&ans, clamp_probability(p0_f)));
+    p0_f = update_probability(p0_f, bit);
+    result = (result << 1) + bit;
     --nbits;
   }
+  ans_decoder_ = ans;
+  p0_f_ = p0_f;
   *value = result;
 }
 
+void AdaptiveRAnsBitDecoder::DecodeBits(int num_bits, uint32_t *bits) {
+  AnsDecoder ans = ans_decoder_;
+  double p0_f = p0_f_;
+  for (int i = 0; i < num_bits; i += 32) {
+    const int num_word_bits = std::min(32, num_bits - i);
+    uint32_t word = 0;
+    for (int j = 0; j < num_word_bits; ++j) {
+      const bool bit =
+          static_cast<bool>(rabs_read(&ans, clamp_probability(p0_f)));
+      p0_f = update_probability(p0_f, bit);
+      word |= static_cast<uint32_t>(bit) << j;
+    }
+    bits[i / 32] = word;
+  }
+  ans_decoder_ = ans;
+  p0_f_ = p0_f;
+}
+
 void AdaptiveRAnsBitDecoder::Clear() {
   ans_read_end(&ans_decoder_);
   p0_f_ = 0.5;
@@ -14,6 +14,8 @@
 //
 #include "draco/compression/bit_coders/rans_bit_decoder.h"
 
+#include <algorithm>
+
 #include "draco/compression/config/compression_shared.h"
 #include "draco/core/bit_utils.h"
 #include "draco/core/varint_decoding.h"
@@ -69,14 +71,31 @@ void RAnsBitDecoder::DecodeLeastSignificantBits32(int nbits, uint32_t *value) {
   DRACO_DCHECK_EQ(true, nbits <= 32);
   DRACO_DCHECK_EQ(true, nbits > 0);
 
+  // Work on a local copy of the decoder state so that it can be kept in
+  // registers for all decoded bits.
+  AnsDecoder ans = ans_decoder_;
   uint32_t result = 0;
   while (nbits) {
-    result = (result << 1) + DecodeNextBit();
+    result = (result << 1) + rabs_read(&ans, prob_zero_);
     --nbits;
   }
+  ans_decoder_ = ans;
   *value = result;
 }
 
+void RAnsBitDecoder::DecodeBits(int num_bits, uint32_t *bits) {
+  AnsDecoder ans = ans_decoder_;
+  for (int i = 0; i < num_bits; i += 32) {
+    const int num_word_bits = std::min(32, num_bits - i);
+    uint32_t word = 0;
+    for (int j = 0; j < num_word_bits; ++j) {
+      word |= static_cast<uint32_t>(rabs_read(&ans, prob_zero_)) << j;
+    }
+    bits[i / 32] = word;
+  }
+  ans_decoder_ = ans;
+}
+
 void RAnsBitDecoder::Clear() { ans_read_end(&ans_decoder_); }
 
 }  // namespace draco
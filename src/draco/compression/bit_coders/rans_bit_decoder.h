@@ -41,6 +41,12 @@ class RAnsBitDecoder {
   // > 0 and <= 32.
   void DecodeLeastSignificantBits32(int nbits, uint32_t *value);
 
+  // Decodes the next |num_bits| bits into the bitmap |bits|. The i-th decoded
+  // bit is stored in bit (i % 32) of |bits[i / 32]|, so |bits| must have room
+  // for (num_bits + 31) / 32 values. Decoding past the end of the encoded data
+  // does not fail but the returned bits are unspecified.
+  void DecodeBits(int num_bits, uint32_t *bits);
+
   void EndDecoding() {}
 
  private:
@@ -1,9 +1,57 @@
+#include <vector>
+
 #include "draco/compression/bit_coders/adaptive_rans_bit_decoder.h"
 #include "draco/compression/bit_coders/adaptive_rans_bit_encoder.h"
 #include "draco/compression/bit_coders/rans_bit_decoder.h"
 #include "draco/compression/bit_coders/rans_bit_encoder.h"
+#include "draco/compression/config/compression_shared.h"
 #include "draco/core/draco_test_base.h"
 
 // Just including rans_coding.h and adaptive_rans_coding.h gets an asan error
 // when compiling (blaze test :rans_coding_test --config=asan)
 TEST(RansCodingTest, LinkerTest) {}
+
+template <class EncoderT, class DecoderT>
+void TestDecodeBits() {
+  // Tests that bits decoded in batches match bits decoded one by one.
+  std::vector<bool> bits;
+  for (int i = 0; i < 1000; ++i) {
+    bits.push_back((i * 7919) % 13 < 3 || i % 97 == 0);
+  }
+  EncoderT encoder;
+  encoder.StartEncoding();
+  for (const bool bit : bits) {
+    encoder.EncodeBit(bit);
+  }
+  draco::EncoderBuffer buffer;
+  encoder.EndEncoding(&buffer);
+
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  in_buffer.set_bitstream_version(draco::kDracoMeshBitstreamVersion);
+  DecoderT decoder;
+  ASSERT_TRUE(decoder.StartDecoding(&in_buffer));
+  // Decode the bits in batches of various sizes, including sizes that are
+  // not multiples of 32.
+  int num_decoded_bits = 0;
+  for (const int num_bits : {1, 31, 32, 33, 100, 803}) {
+    std::vector<uint32_t> batch((num_bits + 31) / 32);
+    decoder.DecodeBits(num_bits, batch.data());
+    for (int i = 0; i < num_bits; ++i) {
+      ASSERT_EQ(((batch[i / 32] >> (i % 32)) & 1) != 0,
+                bits[num_decoded_bits + i]);
+    }
+    num_decoded_bits += num_bits;
+  }
+  ASSERT_EQ(num_decoded_bits, bits.size());
+  decoder.EndDecoding();
+}
+
+TEST(RansCodingTest, DecodeBits) {
+  TestDecodeBits<draco::RAnsBitEncoder, draco::RAnsBitDecoder>();
+}
+
+TEST(RansCodingTest, AdaptiveDecodeBits) {
+  TestDecodeBits<draco::AdaptiveRAnsBitEncoder,
+                 draco::AdaptiveRAnsBitDecoder>();
+}
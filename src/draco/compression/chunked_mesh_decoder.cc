@@ -0,0 +1,301 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/chunked_mesh_decoder.h"
+
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "draco/compression/decode.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/varint_decoding.h"
+#include "draco/metadata/geometry_metadata.h"
+
+namespace draco {
+
+namespace {
+
+// Returns true when all chunks have the same attributes as the first one.
+bool HaveSameAttributes(const std::vector<std::unique_ptr<Mesh>> &chunks) {
+  const Mesh &first = *chunks[0];
+  for (size_t i = 1; i < chunks.size(); ++i) {
+    const Mesh &chunk = *chunks[i];
+    if (chunk.num_attributes() != first.num_attributes()) {
+      return false;
+    }
+    for (int a = 0; a < first.num_attributes(); ++a) {
+      const PointAttribute *const att = chunk.attribute(a);
+      const PointAttribute *const first_att = first.attribute(a);
+      if (att->attribute_type() != first_att->attribute_type() ||
+          att->num_components() != first_att->num_components() ||
+          att->data_type() != first_att->data_type() ||
+          att->unique_id() != first_att->unique_id()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+ChunkedMeshDecoder::ChunkedMeshDecoder()
+    : chunk_data_(nullptr), data_offset_(0), has_chunk_bounds_(false) {}
+
+bool ChunkedMeshDecoder::IsChunkedMesh(DecoderBuffer *in_buffer) {
+  char magic[5];
+  if (!in_buffer->Peek(magic, sizeof(magic))) {
+    return false;
+  }
+  return memcmp(magic, "DRCHK", 5) == 0;
+}
+
+StatusOr<std::unique_ptr<Mesh>> ChunkedMeshDecoder::DecodeMeshFromBuffer(
+    DecoderBuffer *in_buffer) {
+  std::vector<std::unique_ptr<Mesh>> chunks;
+  DRACO_RETURN_IF_ERROR(DecodeChunksFromBuffer(in_buffer, &chunks));
+  if (chunks.empty()) {
+    return Status(Status::DRACO_ERROR, "No chunks were decoded.");
+  }
+  if (!HaveSameAttributes(chunks)) {
+    return Status(Status::DRACO_ERROR, "Chunks have different attributes.");
+  }
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<uint32_t> point_offsets(num_chunks + 1, 0);
+  std::vector<uint32_t> face_offsets(num_chunks + 1, 0);
+  for (int i = 0; i < num_chunks; ++i) {
+    if (chunks[i]->num_points() >
+            std::numeric_limits<uint32_t>::max() - point_offsets[i] ||
+        chunks[i]->num_faces() >
+            std::numeric_limits<uint32_t>::max() - face_offsets[i]) {
+      return Status(Status::DRACO_ERROR, "Merged mesh is too large.");
+    }
+    point_offsets[i + 1] = point_offsets[i] + chunks[i]->num_points();
+    face_offsets[i + 1] = face_offsets[i] + chunks[i]->num_faces();
+  }
+
+  std::unique_ptr<Mesh> mesh(new Mesh());
+  mesh->set_num_points(point_offsets[num_chunks]);
+  mesh->SetNumFaces(face_offsets[num_chunks]);
+  const Mesh &first = *chunks[0];
+  for (int a = 0; a < first.num_attributes(); ++a) {
+    const PointAttribute *const first_att = first.attribute(a);
+    GeometryAttribute ga;
+    ga.Init(first_att->attribute_type(), nullptr, first_att->num_components(),
+            first_att->data_type(), first_att->normalized(),
+            DataTypeLength(first_att->data_type()) *
+                first_att->num_components(),
+            0);
+    const int att_id =
+        mesh->AddAttribute(ga, true, point_offsets[num_chunks]);
+    mesh->attribute(att_id)->set_unique_id(first_att->unique_id());
+  }
+  if (first.GetMetadata() != nullptr) {
+    mesh->AddMetadata(std::unique_ptr<GeometryMetadata>(
+        new GeometryMetadata(*first.GetMetadata())));
+  }
+
+  // Each chunk writes into its own range of faces and points.
+  ThreadPool *const pool = chunk_decoder_.options()->thread_pool();
+  ParallelFor(pool, num_chunks, [&](int i) {
+    const Mesh &chunk = *chunks[i];
+    const uint32_t point_offset = point_offsets[i];
+    for (FaceIndex fi(0); fi < chunk.num_faces(); ++fi) {
+      Mesh::Face face = chunk.face(fi);
+      for (int c = 0; c < 3; ++c) {
+        face[c] += point_offset;
+      }
+      mesh->SetFace(fi + face_offsets[i], face);
+    }
+    for (int a = 0; a < chunk.num_attributes(); ++a) {
+      const PointAttribute *const src_att = chunk.attribute(a);
+      PointAttribute *const dst_att = mesh->attribute(a);
+      const size_t value_size = dst_att->byte_stride();
+      for (PointIndex pi(0); pi < chunk.num_points(); ++pi) {
+        memcpy(dst_att->GetAddress(AttributeValueIndex(pi.value() +
+                                                       point_offset)),
+               src_att->GetAddress(src_att->mapped_index(pi)), value_size);
+      }
+    }
+  });
+  return std::move(mesh);
+}
+
+Status ChunkedMeshDecoder::DecodeChunksFromBuffer(
+    DecoderBuffer *in_buffer, std::vector<std::unique_ptr<Mesh>> *out_chunks) {
+  DRACO_RETURN_IF_ERROR(DecodeHeader(in_buffer));
+  std::vector<int> chunk_ids(chunks_.size());
+  for (int i = 0; i < num_chunks(); ++i) {
+    chunk_ids[i] = i;
+  }
+  return DecodeChunks(chunk_ids, out_chunks);
+}
+
+Status ChunkedMeshDecoder::DecodeHeader(DecoderBuffer *in_buffer) {
+  const char *const container_start = in_buffer->data_head();
+  DRACO_RETURN_IF_ERROR(DecodeIndex(in_buffer));
+  int64_t data_size = 0;
+  if (!chunks_.empty()) {
+    data_size = chunks_.back().offset + chunks_.back().size;
+  }
+  if (data_size > in_buffer->remaining_size()) {
+    chunks_.clear();
+    return Status(Status::IO_ERROR, "Chunk data is truncated.");
+  }
+  chunk_data_ = container_start + data_offset_;
+  in_buffer->Advance(data_size);
+  return OkStatus();
+}
+
+Status ChunkedMeshDecoder::DecodeIndex(DecoderBuffer *in_buffer) {
+  chunk_data_ = nullptr;
+  chunks_.clear();
+  has_chunk_bounds_ = false;
+  data_offset_ = 0;
+  const int64_t start_size = in_buffer->remaining_size();
+  if (!IsChunkedMesh(in_buffer)) {
+    return Status(Status::DRACO_ERROR, "Not a chunked Draco mesh.");
+  }
+  in_buffer->Advance(5);
+  uint8_t version_major, version_minor;
+  if (!in_buffer->Decode(&version_major) ||
+      !in_buffer->Decode(&version_minor)) {
+    return Status(Status::IO_ERROR, "Failed to parse the container header.");
+  }
+  if (version_major != 1) {
+    return Status(Status::UNKNOWN_VERSION,
+                  "Unknown chunked mesh container version.");
+  }
+  uint32_t num_chunks;
+  if (!DecodeVarint(&num_chunks, in_buffer)) {
+    return Status(Status::IO_ERROR, "Failed to parse the container header.");
+  }
+  // Each chunk size takes at least one byte.
+  if (num_chunks > in_buffer->remaining_size() ||
+      num_chunks > static_cast<uint32_t>(std::numeric_limits<int>::max())) {
+    return Status(Status::DRACO_ERROR, "Invalid number of chunks.");
+  }
+  std::vector<ChunkInfo> chunks(num_chunks);
+  int64_t offset = 0;
+  for (uint32_t i = 0; i < num_chunks; ++i) {
+    uint64_t chunk_size;
+    if (!DecodeVarint(&chunk_size, in_buffer)) {
+      return Status(Status::IO_ERROR, "Failed to parse the container header.");
+    }
+    if (chunk_size >
+        static_cast<uint64_t>(std::numeric_limits<int64_t>::max() - offset)) {
+      return Status(Status::DRACO_ERROR, "Invalid chunk size.");
+    }
+    chunks[i].offset = offset;
+    chunks[i].size = static_cast<int64_t>(chunk_size);
+    offset += chunks[i].size;
+  }
+  const bool has_chunk_bounds = version_minor >= 1;
+  if (has_chunk_bounds) {
+    for (uint32_t i = 0; i < num_chunks; ++i) {
+      Vector3f min_point, max_point;
+      if (!in_buffer->Decode(min_point.data(), 3 * sizeof(float)) ||
+          !in_buffer->Decode(max_point.data(), 3 * sizeof(float))) {
+        return Status(Status::IO_ERROR,
+                      "Failed to parse the container header.");
+      }
+      chunks[i].bounds = BoundingBox(min_point, max_point);
+    }
+  }
+  chunks_ = std::move(chunks);
+  has_chunk_bounds_ = has_chunk_bounds;
+  data_offset_ = start_size - in_buffer->remaining_size();
+  return OkStatus();
+}
+
+std::vector<int> ChunkedMeshDecoder::FindChunksInRegion(
+    const BoundingBox &region) const {
+  std::vector<int> chunk_ids;
+  for (int i = 0; i < num_chunks(); ++i) {
+    if (!has_chunk_bounds_ || chunks_[i].bounds.Intersects(region)) {
+      chunk_ids.push_back(i);
+    }
+  }
+  return chunk_ids;
+}
+
+StatusOr<std::unique_ptr<Mesh>> ChunkedMeshDecoder::DecodeChunk(
+    int chunk_id) {
+  if (chunk_id < 0 || chunk_id >= num_chunks()) {
+    return Status(Status::DRACO_ERROR, "Invalid chunk id.");
+  }
+  if (chunk_data_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "Chunk data is not available.");
+  }
+  DecoderBuffer buffer;
+  buffer.Init(chunk_data_ + chunks_[chunk_id].offset, chunks_[chunk_id].size);
+  return DecodeChunkFromBuffer(&buffer);
+}
+
+StatusOr<std::unique_ptr<Mesh>> ChunkedMeshDecoder::DecodeChunkFromBuffer(
+    DecoderBuffer *chunk_buffer) const {
+  // Decoder would decode nested containers recursively.
+  if (IsChunkedMesh(chunk_buffer)) {
+    return Status(Status::DRACO_ERROR, "Nested chunked meshes are invalid.");
+  }
+  return chunk_decoder_.DecodeMeshFromBuffer(chunk_buffer);
+}
+
+StatusOr<std::unique_ptr<PointCloud>>
+ChunkedMeshDecoder::DecodePointCloudChunk(int chunk_id) {
+  if (chunk_id < 0 || chunk_id >= num_chunks()) {
+    return Status(Status::DRACO_ERROR, "Invalid chunk id.");
+  }
+  if (chunk_data_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "Chunk data is not available.");
+  }
+  DecoderBuffer buffer;
+  buffer.Init(chunk_data_ + chunks_[chunk_id].offset, chunks_[chunk_id].size);
+  return DecodePointCloudChunkFromBuffer(&buffer);
+}
+
+StatusOr<std::unique_ptr<PointCloud>>
+ChunkedMeshDecoder::DecodePointCloudChunkFromBuffer(
+    DecoderBuffer *chunk_buffer) const {
+  if (IsChunkedMesh(chunk_buffer)) {
+    return Status(Status::DRACO_ERROR, "Nested chunked meshes are invalid.");
+  }
+  return chunk_decoder_.DecodePointCloudFromBuffer(chunk_buffer);
+}
+
+Status ChunkedMeshDecoder::DecodeChunks(
+    const std::vector<int> &chunk_ids,
+    std::vector<std::unique_ptr<Mesh>> *out_chunks) {
+  const int num_decoded_chunks = static_cast<int>(chunk_ids.size());
+  std::vector<std::unique_ptr<Mesh>> chunks(num_decoded_chunks);
+  std::vector<Status> chunk_statuses(num_decoded_chunks);
+  ThreadPool *const pool = chunk_decoder_.options()->thread_pool();
+  ParallelFor(pool, num_decoded_chunks, [&](int i) {
+    StatusOr<std::unique_ptr<Mesh>> chunk_or = DecodeChunk(chunk_ids[i]);
+    chunk_statuses[i] = chunk_or.status();
+    if (chunk_or.ok()) {
+      chunks[i] = std::move(chunk_or).value();
+    }
+  });
+  for (int i = 0; i < num_decoded_chunks; ++i) {
+    DRACO_RETURN_IF_ERROR(chunk_statuses[i]);
+  }
+  for (int i = 0; i < num_decoded_chunks; ++i) {
+    out_chunks->push_back(std::move(chunks[i]));
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
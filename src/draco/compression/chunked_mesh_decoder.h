@@ -0,0 +1,152 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_CHUNKED_MESH_DECODER_H_
+#define DRACO_COMPRESSION_CHUNKED_MESH_DECODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "draco/compression/config/decoder_options.h"
+#include "draco/compression/decode.h"
+#include "draco/core/bounding_box.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/core/status_or.h"
+#include "draco/mesh/mesh.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Decoder for meshes encoded with ChunkedMeshEncoder (see
+// chunked_mesh_encoder.h). The chunks are decoded on the thread pool set in
+// options(), if any.
+//
+// Chunks can be decoded either all at once, or selectively using the chunk
+// index stored in the container header:
+//
+//   ChunkedMeshDecoder decoder;
+//   DRACO_RETURN_IF_ERROR(decoder.DecodeHeader(&buffer));
+//   std::vector<std::unique_ptr<Mesh>> visible_chunks;
+//   DRACO_RETURN_IF_ERROR(decoder.DecodeChunks(
+//       decoder.FindChunksInRegion(view_bounds), &visible_chunks));
+//
+// When the container is not fully loaded in memory, DecodeIndex() parses only
+// the header and the chunk data can be fetched separately using chunk_offset()
+// and chunk_size() (see ReadChunkedMeshRegionFromFile() in io/mesh_io.h).
+//
+class ChunkedMeshDecoder {
+ public:
+  ChunkedMeshDecoder();
+
+  // Returns true when |in_buffer| starts with a chunked mesh container. The
+  // buffer position is not changed.
+  static bool IsChunkedMesh(DecoderBuffer *in_buffer);
+
+  // Decodes all chunks and merges them into a single mesh. Faces and points of
+  // the chunks are stored one after another in the order of the chunks.
+  StatusOr<std::unique_ptr<Mesh>> DecodeMeshFromBuffer(
+      DecoderBuffer *in_buffer);
+
+  // Decodes all chunks into separate meshes that are appended to |out_chunks|.
+  Status DecodeChunksFromBuffer(DecoderBuffer *in_buffer,
+                                std::vector<std::unique_ptr<Mesh>> *out_chunks);
+
+  // Decodes the container header with the chunk index from |in_buffer| and
+  // advances the buffer past all chunk data. The chunks themselves are not
+  // decoded. The data of |in_buffer| must stay valid until all chunks of
+  // interest are decoded with DecodeChunk() or DecodeChunks().
+  Status DecodeHeader(DecoderBuffer *in_buffer);
+
+  // Decodes the container header with the chunk index from |in_buffer|
+  // without the chunk data, which does not need to be present in the buffer.
+  // Fails when the buffer does not contain the whole header. DecodeChunk() and
+  // DecodeChunks() cannot be used afterwards; chunks must be decoded with
+  // DecodeChunkFromBuffer() instead.
+  Status DecodeIndex(DecoderBuffer *in_buffer);
+
+  // Functions below can be used after a successful call to DecodeHeader() or
+  // DecodeIndex().
+
+  // Returns the number of chunks in the container.
+  int num_chunks() const { return static_cast<int>(chunks_.size()); }
+
+  // Returns true when the container stores bounding boxes of the chunks. Older
+  // containers (version 1.0) do not have them.
+  bool has_chunk_bounds() const { return has_chunk_bounds_; }
+
+  // Returns the bounding box of the positions of chunk |chunk_id|.
+  const BoundingBox &chunk_bounds(int chunk_id) const {
+    return chunks_[chunk_id].bounds;
+  }
+
+  // Returns ids of all chunks whose bounding boxes intersect |region|. When
+  // the container has no chunk bounds, all chunks are returned.
+  std::vector<int> FindChunksInRegion(const BoundingBox &region) const;
+
+  // Returns the offset of the data of chunk |chunk_id| from the start of the
+  // container.
+  int64_t chunk_offset(int chunk_id) const {
+    return data_offset_ + chunks_[chunk_id].offset;
+  }
+
+  // Returns the size of the data of chunk |chunk_id|.
+  int64_t chunk_size(int chunk_id) const { return chunks_[chunk_id].size; }
+
+  // Decodes a chunk from |chunk_buffer| containing the chunk data, e.g. data
+  // read from a file at chunk_offset() with chunk_size() bytes.
+  StatusOr<std::unique_ptr<Mesh>> DecodeChunkFromBuffer(
+      DecoderBuffer *chunk_buffer) const;
+
+  // Decodes a single chunk. Requires DecodeHeader().
+  StatusOr<std::unique_ptr<Mesh>> DecodeChunk(int chunk_id);
+
+  // Same as DecodeChunkFromBuffer() and DecodeChunk() but for containers of
+  // point clouds created with OutOfCorePointCloudEncoder
+  // (io/out_of_core_point_cloud_encoder.h). Mesh chunks are decoded as point
+  // clouds without faces.
+  StatusOr<std::unique_ptr<PointCloud>> DecodePointCloudChunkFromBuffer(
+      DecoderBuffer *chunk_buffer) const;
+  StatusOr<std::unique_ptr<PointCloud>> DecodePointCloudChunk(int chunk_id);
+
+  // Decodes chunks |chunk_ids| and appends them to |out_chunks| in the same
+  // order.
+  Status DecodeChunks(const std::vector<int> &chunk_ids,
+                      std::vector<std::unique_ptr<Mesh>> *out_chunks);
+
+  // Returns the options used for decoding of each chunk.
+  DecoderOptions *options() { return chunk_decoder_.options(); }
+
+ private:
+  // Location of an encoded chunk in the container.
+  struct ChunkInfo {
+    int64_t offset;
+    int64_t size;
+    BoundingBox bounds;
+  };
+
+  // Decoder shared by all chunks, which holds the options of this decoder.
+  Decoder chunk_decoder_;
+  // Start of the data of all chunks or nullptr when the chunk data is not
+  // available.
+  const char *chunk_data_;
+  // Offset of the data of all chunks from the start of the container.
+  int64_t data_offset_;
+  std::vector<ChunkInfo> chunks_;
+  bool has_chunk_bounds_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_CHUNKED_MESH_DECODER_H_
@@ -0,0 +1,265 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/chunked_mesh_encoder.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/bounding_box.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/varint_encoding.h"
+#include "draco/core/vector_d.h"
+#include "draco/mesh/mesh_connected_components.h"
+#include "draco/mesh/mesh_misc_functions.h"
+#include "draco/metadata/geometry_metadata.h"
+
+namespace draco {
+
+namespace {
+
+// Recursively splits faces in range [|begin|, |end|) into parts of at most
+// |max_faces| faces and appends them to |chunks|. The faces are split at the
+// median of their |centers| along the longest axis of their bounding box.
+void SplitFacesSpatially(const std::vector<Vector3f> &centers,
+                         std::vector<FaceIndex>::iterator begin,
+                         std::vector<FaceIndex>::iterator end, int max_faces,
+                         std::vector<std::vector<FaceIndex>> *chunks) {
+  const int64_t num_faces = end - begin;
+  if (num_faces <= max_faces) {
+    chunks->push_back(std::vector<FaceIndex>(begin, end));
+    return;
+  }
+  Vector3f min_center = centers[begin->value()];
+  Vector3f max_center = min_center;
+  for (auto it = begin; it != end; ++it) {
+    const Vector3f &center = centers[it->value()];
+    for (int c = 0; c < 3; ++c) {
+      min_center[c] = std::min(min_center[c], center[c]);
+      max_center[c] = std::max(max_center[c], center[c]);
+    }
+  }
+  const Vector3f size = max_center - min_center;
+  int axis = 0;
+  for (int c = 1; c < 3; ++c) {
+    if (size[c] > size[axis]) {
+      axis = c;
+    }
+  }
+  const auto mid = begin + num_faces / 2;
+  std::nth_element(begin, mid, end, [&](FaceIndex a, FaceIndex b) {
+    return centers[a.value()][axis] < centers[b.value()][axis];
+  });
+  SplitFacesSpatially(centers, begin, mid, max_faces, chunks);
+  SplitFacesSpatially(centers, mid, end, max_faces, chunks);
+}
+
+// Groups faces of |mesh| into chunks of at most |max_faces| faces. Faces of
+// each chunk are stored in |chunks|. The connected components are taken from
+// |analysis| when it is not null.
+Status SplitMeshIntoChunks(const Mesh &mesh, int max_faces, ThreadPool *pool,
+                           const EncodeAnalysis *analysis,
+                           std::vector<std::vector<FaceIndex>> *chunks) {
+  const PointAttribute *const pos_att =
+      mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (pos_att == nullptr) {
+    return Status(Status::DRACO_ERROR, "Mesh has no position attribute.");
+  }
+  MeshConnectedComponents own_components;
+  const MeshConnectedComponents *components = &own_components;
+  if (analysis != nullptr) {
+    if (analysis->position_corner_table() == nullptr) {
+      return Status(Status::DRACO_ERROR, "Failed to create the corner table.");
+    }
+    components = &analysis->connected_components();
+  } else {
+    const std::unique_ptr<CornerTable> corner_table =
+        CreateCornerTableFromPositionAttribute(&mesh, pool);
+    if (corner_table == nullptr) {
+      return Status(Status::DRACO_ERROR, "Failed to create the corner table.");
+    }
+    own_components.FindConnectedComponents(corner_table.get(), pool);
+  }
+
+  // Face centers are computed only when needed for splitting of a component.
+  std::vector<Vector3f> centers;
+  std::vector<FaceIndex> faces;
+  for (int i = 0; i < components->NumConnectedComponents(); ++i) {
+    const int num_component_faces = components->NumConnectedComponentFaces(i);
+    if (num_component_faces > max_faces) {
+      if (centers.empty()) {
+        centers.resize(mesh.num_faces());
+        for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+          Vector3f center(0.f, 0.f, 0.f);
+          for (int c = 0; c < 3; ++c) {
+            Vector3f pos;
+            pos_att->ConvertValue<float, 3>(
+                pos_att->mapped_index(mesh.face(fi)[c]), &pos[0]);
+            center += pos;
+          }
+          centers[fi.value()] = center / 3.f;
+        }
+      }
+      std::vector<FaceIndex> component_faces(num_component_faces);
+      for (int f = 0; f < num_component_faces; ++f) {
+        component_faces[f] =
+            FaceIndex(components->GetConnectedComponentFace(i, f));
+      }
+      SplitFacesSpatially(centers, component_faces.begin(),
+                          component_faces.end(), max_faces, chunks);
+      continue;
+    }
+    // Small components are packed together.
+    if (faces.size() + num_component_faces > static_cast<size_t>(max_faces)) {
+      chunks->push_back(std::move(faces));
+      faces.clear();
+    }
+    for (int f = 0; f < num_component_faces; ++f) {
+      faces.push_back(FaceIndex(components->GetConnectedComponentFace(i, f)));
+    }
+  }
+  if (!faces.empty()) {
+    chunks->push_back(std::move(faces));
+  }
+  return OkStatus();
+}
+
+// Returns the bounding box of all position values of |mesh|. Unlike
+// PointCloud::ComputeBoundingBox(), positions of any data type are supported.
+BoundingBox ComputePositionBounds(const Mesh &mesh) {
+  const PointAttribute *const pos_att =
+      mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+  BoundingBox bounds;
+  Vector3f pos;
+  for (AttributeValueIndex i(0); i < static_cast<uint32_t>(pos_att->size());
+       ++i) {
+    pos_att->ConvertValue<float, 3>(i, &pos[0]);
+    bounds.Update(pos);
+  }
+  return bounds;
+}
+
+}  // namespace
+
+ChunkedMeshEncoder::ChunkedMeshEncoder()
+    : max_chunk_faces_(1 << 16),
+      num_encoded_chunks_(0),
+      analysis_(nullptr) {}
+
+Status ChunkedMeshEncoder::EncodeMeshToBuffer(const Mesh &mesh,
+                                              const Encoder &encoder,
+                                              EncoderBuffer *out_buffer) {
+  return EncodeMeshToBuffer(mesh, encoder.CreateExpertEncoderOptions(mesh),
+                            out_buffer);
+}
+
+Status ChunkedMeshEncoder::EncodeMeshToBuffer(const Mesh &mesh,
+                                              const EncoderOptions &options,
+                                              EncoderBuffer *out_buffer) {
+  num_encoded_chunks_ = 0;
+  if (max_chunk_faces_ < 1) {
+    return Status(Status::DRACO_ERROR, "Invalid maximum chunk size.");
+  }
+  ThreadPool *const pool = options.thread_pool();
+  std::vector<std::vector<FaceIndex>> chunks;
+  const EncodeAnalysis *const analysis =
+      analysis_ != nullptr && analysis_->mesh() == &mesh ? analysis_ : nullptr;
+  DRACO_RETURN_IF_ERROR(
+      SplitMeshIntoChunks(mesh, max_chunk_faces_, pool, analysis, &chunks));
+  if (chunks.empty()) {
+    return Status(Status::DRACO_ERROR, "Mesh has no valid faces.");
+  }
+
+  // Use the same quantization grid for all chunks.
+  EncoderOptions chunk_options = options;
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    const PointAttribute *const att = mesh.attribute(i);
+    const int quantization_bits =
+        options.GetAttributeInt(i, "quantization_bits", -1);
+    if (quantization_bits < 1 ||
+        att->attribute_type() == GeometryAttribute::NORMAL ||
+        options.IsAttributeOptionSet(i, "quantization_origin")) {
+      continue;
+    }
+    AttributeQuantizationTransform transform;
+    if (!transform.ComputeParameters(*att, quantization_bits)) {
+      return Status(Status::DRACO_ERROR, "Failed to quantize an attribute.");
+    }
+    chunk_options.SetAttributeVector(i, "quantization_origin",
+                                     att->num_components(),
+                                     transform.min_values().data());
+    chunk_options.SetAttributeFloat(i, "quantization_range", transform.range());
+  }
+
+  // Chunk bounds are enlarged by one quantization step so that they contain
+  // all decoded positions.
+  float bounds_margin = 0.f;
+  const int pos_att_id = mesh.GetNamedAttributeId(GeometryAttribute::POSITION);
+  const int pos_quantization_bits =
+      options.GetAttributeInt(pos_att_id, "quantization_bits", -1);
+  if (pos_quantization_bits > 0 &&
+      chunk_options.IsAttributeOptionSet(pos_att_id, "quantization_range")) {
+    bounds_margin =
+        chunk_options.GetAttributeFloat(pos_att_id, "quantization_range", 0.f) /
+        ((1u << pos_quantization_bits) - 1);
+  }
+
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<EncoderBuffer> chunk_buffers(num_chunks);
+  std::vector<BoundingBox> chunk_bounds(num_chunks);
+  std::vector<Status> chunk_statuses(num_chunks);
+  ParallelFor(pool, num_chunks, [&](int i) {
+    const std::unique_ptr<Mesh> chunk = CreateSubmesh(mesh, chunks[i]);
+    const BoundingBox bounds = ComputePositionBounds(*chunk);
+    const Vector3f margin(bounds_margin, bounds_margin, bounds_margin);
+    chunk_bounds[i] = BoundingBox(bounds.GetMinPoint() - margin,
+                                  bounds.GetMaxPoint() + margin);
+    if (i == 0 && mesh.GetMetadata() != nullptr) {
+      // Geometry metadata is stored only once, in the first chunk.
+      chunk->AddMetadata(std::unique_ptr<GeometryMetadata>(
+          new GeometryMetadata(*mesh.GetMetadata())));
+    }
+    ExpertEncoder chunk_encoder(*chunk);
+    chunk_encoder.Reset(chunk_options);
+    chunk_statuses[i] = chunk_encoder.EncodeToBuffer(&chunk_buffers[i]);
+  });
+  for (int i = 0; i < num_chunks; ++i) {
+    DRACO_RETURN_IF_ERROR(chunk_statuses[i]);
+  }
+
+  out_buffer->Encode("DRCHK", 5);
+  const uint8_t version_major = 1;
+  const uint8_t version_minor = 1;
+  out_buffer->Encode(version_major);
+  out_buffer->Encode(version_minor);
+  EncodeVarint(static_cast<uint32_t>(num_chunks), out_buffer);
+  for (int i = 0; i < num_chunks; ++i) {
+    EncodeVarint(static_cast<uint64_t>(chunk_buffers[i].size()), out_buffer);
+  }
+  for (int i = 0; i < num_chunks; ++i) {
+    out_buffer->Encode(chunk_bounds[i].GetMinPoint().data(), 3 * sizeof(float));
+    out_buffer->Encode(chunk_bounds[i].GetMaxPoint().data(), 3 * sizeof(float));
+  }
+  for (int i = 0; i < num_chunks; ++i) {
+    out_buffer->Encode(chunk_buffers[i].data(), chunk_buffers[i].size());
+  }
+  num_encoded_chunks_ = num_chunks;
+  return OkStatus();
+}
+
+}  // namespace draco
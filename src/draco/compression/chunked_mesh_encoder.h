@@ -0,0 +1,98 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_CHUNKED_MESH_ENCODER_H_
+#define DRACO_COMPRESSION_CHUNKED_MESH_ENCODER_H_
+
+#include "draco/compression/config/encoder_options.h"
+#include "draco/compression/encode.h"
+#include "draco/compression/encode_analysis.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Encoder that splits a mesh into chunks that are compressed independently of
+// each other, so that they can be encoded and decoded in parallel (see
+// ChunkedMeshDecoder in chunked_mesh_decoder.h).
+//
+// Connected components of the input mesh are grouped into chunks of up to
+// max_chunk_faces() faces. Components with more faces are split spatially by
+// recursively halving their faces along the longest axis of the bounding box
+// of the face centers. Points on the boundaries of the split parts are
+// encoded in each chunk that uses them, so the decoded mesh may contain more
+// points than the input mesh. Degenerate faces are not encoded.
+//
+// Attributes that are quantized with the generic quantization (all quantized
+// attributes except normals) are quantized in the bounding box of the whole
+// mesh, so that points shared by multiple chunks are decoded to the same
+// values in all of them.
+//
+// The chunks are encoded on the thread pool set in the encoder options, if
+// any.
+//
+// The encoded data is stored in the following container:
+//
+//   "DRCHK"                       Magic string (5 bytes).
+//   uint8_t major_version         Container version (currently 1.1).
+//   uint8_t minor_version
+//   varint num_chunks
+//   varint chunk_size[num_chunks] Size of each encoded chunk in bytes.
+//   float chunk_bounds[num_chunks][6]
+//                                 Minimum and maximum position of each chunk
+//                                 (version 1.1 and newer).
+//   chunk data                    Regular Draco bitstream of each chunk.
+//
+// The chunk index in the header allows decoders to locate and decode only
+// the chunks they need, e.g. the chunks intersecting a region of interest.
+// The chunk bounds contain all decoded positions of the chunk.
+//
+class ChunkedMeshEncoder {
+ public:
+  ChunkedMeshEncoder();
+
+  // Sets the maximum number of faces that are stored in a single chunk.
+  void set_max_chunk_faces(int num_faces) { max_chunk_faces_ = num_faces; }
+  int max_chunk_faces() const { return max_chunk_faces_; }
+
+  // Sets an optional analysis whose connected components are used to group
+  // the faces into chunks when the analysis matches the encoded mesh. The
+  // analysis is not owned.
+  void SetEncodeAnalysis(const EncodeAnalysis *analysis) {
+    analysis_ = analysis;
+  }
+
+  // Encodes |mesh| into |out_buffer| using the options of |encoder| for each
+  // chunk.
+  Status EncodeMeshToBuffer(const Mesh &mesh, const Encoder &encoder,
+                            EncoderBuffer *out_buffer);
+
+  // Encodes |mesh| into |out_buffer| using |options| for each chunk. Attribute
+  // options are specified for attribute ids of |mesh| as in ExpertEncoder.
+  Status EncodeMeshToBuffer(const Mesh &mesh, const EncoderOptions &options,
+                            EncoderBuffer *out_buffer);
+
+  // Returns the number of chunks created by the last successful encoding.
+  int num_encoded_chunks() const { return num_encoded_chunks_; }
+
+ private:
+  int max_chunk_faces_;
+  int num_encoded_chunks_;
+  const EncodeAnalysis *analysis_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_CHUNKED_MESH_ENCODER_H_
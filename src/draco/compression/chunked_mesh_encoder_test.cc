@@ -0,0 +1,358 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/chunked_mesh_encoder.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "draco/compression/chunked_mesh_decoder.h"
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
+#include "draco/core/bounding_box.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/varint_encoding.h"
+#include "draco/io/file_utils.h"
+#include "draco/io/mesh_io.h"
+
+namespace {
+
+typedef std::array<float, 9> FacePositions;
+
+// Returns positions of all faces of |mesh|. Each face starts with its
+// smallest vertex position so that faces can be compared regardless of the
+// first corner chosen by the encoder.
+std::vector<FacePositions> GetSortedFacePositions(const draco::Mesh &mesh) {
+  const draco::PointAttribute *const pos_att =
+      mesh.GetNamedAttribute(draco::GeometryAttribute::POSITION);
+  std::vector<FacePositions> faces;
+  for (draco::FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+    std::array<std::array<float, 3>, 3> corners;
+    for (int c = 0; c < 3; ++c) {
+      pos_att->ConvertValue<float, 3>(
+          pos_att->mapped_index(mesh.face(fi)[c]), &corners[c][0]);
+    }
+    const int first = static_cast<int>(
+        std::min_element(corners.begin(), corners.end()) - corners.begin());
+    FacePositions face;
+    for (int c = 0; c < 3; ++c) {
+      std::copy(corners[(first + c) % 3].begin(),
+                corners[(first + c) % 3].end(), face.begin() + 3 * c);
+    }
+    faces.push_back(face);
+  }
+  std::sort(faces.begin(), faces.end());
+  return faces;
+}
+
+// Returns the number of faces of |mesh| with at least one vertex in |region|.
+int CountFacesInRegion(const draco::Mesh &mesh,
+                       const draco::BoundingBox &region) {
+  int num_faces = 0;
+  for (const FacePositions &face : GetSortedFacePositions(mesh)) {
+    for (int c = 0; c < 3; ++c) {
+      const draco::Vector3f pos(face[3 * c], face[3 * c + 1], face[3 * c + 2]);
+      if (region.Intersects(draco::BoundingBox(pos, pos))) {
+        ++num_faces;
+        break;
+      }
+    }
+  }
+  return num_faces;
+}
+
+class ChunkedMeshEncoderTest : public ::testing::Test {
+ protected:
+  // Encodes |file_name| with and without chunking and checks that both
+  // encodings decode to the same faces.
+  void TestEncodeFile(const std::string &file_name, int max_chunk_faces,
+                      draco::ThreadPool *pool) {
+    const std::unique_ptr<draco::Mesh> mesh =
+        draco::ReadMeshFromTestFile(file_name);
+    ASSERT_NE(mesh, nullptr);
+    draco::Encoder encoder;
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 8);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 10);
+    encoder.options().SetThreadPool(pool);
+
+    draco::EncoderBuffer buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &buffer));
+    draco::DecoderBuffer decoder_buffer;
+    decoder_buffer.Init(buffer.data(), buffer.size());
+    draco::Decoder decoder;
+    const std::unique_ptr<draco::Mesh> expected =
+        decoder.DecodeMeshFromBuffer(&decoder_buffer).value();
+
+    draco::ChunkedMeshEncoder chunked_encoder;
+    chunked_encoder.set_max_chunk_faces(max_chunk_faces);
+    draco::EncoderBuffer chunked_buffer;
+    DRACO_ASSERT_OK(
+        chunked_encoder.EncodeMeshToBuffer(*mesh, encoder, &chunked_buffer));
+    ASSERT_GE(chunked_encoder.num_encoded_chunks(),
+              (expected->num_faces() + max_chunk_faces - 1) / max_chunk_faces);
+
+    decoder_buffer.Init(chunked_buffer.data(), chunked_buffer.size());
+    ASSERT_TRUE(draco::ChunkedMeshDecoder::IsChunkedMesh(&decoder_buffer));
+    draco::ChunkedMeshDecoder chunked_decoder;
+    chunked_decoder.options()->SetThreadPool(pool);
+    const std::unique_ptr<draco::Mesh> decoded =
+        chunked_decoder.DecodeMeshFromBuffer(&decoder_buffer).value();
+    ASSERT_NE(decoded, nullptr);
+    ASSERT_EQ(decoder_buffer.remaining_size(), 0);
+    ASSERT_EQ(decoded->num_attributes(), expected->num_attributes());
+    ASSERT_EQ(decoded->num_faces(), expected->num_faces());
+    ASSERT_GE(decoded->num_points(), expected->num_points());
+    // All chunks use the same quantization grid so the decoded positions must
+    // match exactly.
+    ASSERT_EQ(GetSortedFacePositions(*decoded),
+              GetSortedFacePositions(*expected));
+
+    // Check the individual chunks.
+    decoder_buffer.Init(chunked_buffer.data(), chunked_buffer.size());
+    std::vector<std::unique_ptr<draco::Mesh>> chunks;
+    DRACO_ASSERT_OK(
+        chunked_decoder.DecodeChunksFromBuffer(&decoder_buffer, &chunks));
+    ASSERT_EQ(chunks.size(), chunked_encoder.num_encoded_chunks());
+    for (const auto &chunk : chunks) {
+      ASSERT_LE(chunk->num_faces(), max_chunk_faces);
+    }
+  }
+};
+
+TEST_F(ChunkedMeshEncoderTest, TestSplitComponent) {
+  // The bunny is split spatially into multiple chunks.
+  TestEncodeFile("bunny_norm.obj", 1000, nullptr);
+}
+
+TEST_F(ChunkedMeshEncoderTest, TestSingleChunk) {
+  TestEncodeFile("cube_att.obj", 1000, nullptr);
+}
+
+TEST_F(ChunkedMeshEncoderTest, TestMultipleComponents) {
+  TestEncodeFile("car.drc", 500, nullptr);
+}
+
+TEST_F(ChunkedMeshEncoderTest, TestThreadPool) {
+  draco::ThreadPool pool(3);
+  TestEncodeFile("bunny_norm.obj", 1000, &pool);
+  TestEncodeFile("car.drc", 500, &pool);
+}
+
+TEST_F(ChunkedMeshEncoderTest, TestDeterministicOutput) {
+  // Tests that the output does not depend on the thread pool.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+  draco::ChunkedMeshEncoder chunked_encoder;
+  chunked_encoder.set_max_chunk_faces(2000);
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(chunked_encoder.EncodeMeshToBuffer(*mesh, encoder, &buffer));
+
+  draco::ThreadPool pool(3);
+  encoder.options().SetThreadPool(&pool);
+  draco::EncoderBuffer parallel_buffer;
+  DRACO_ASSERT_OK(
+      chunked_encoder.EncodeMeshToBuffer(*mesh, encoder, &parallel_buffer));
+  ASSERT_EQ(buffer.size(), parallel_buffer.size());
+  ASSERT_TRUE(std::equal(buffer.buffer()->begin(), buffer.buffer()->end(),
+                         parallel_buffer.buffer()->begin()));
+}
+
+TEST_F(ChunkedMeshEncoderTest, TestDecodeRegion) {
+  // Tests that only chunks intersecting a region can be decoded.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 8);
+  draco::ChunkedMeshEncoder chunked_encoder;
+  chunked_encoder.set_max_chunk_faces(1000);
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(chunked_encoder.EncodeMeshToBuffer(*mesh, encoder, &buffer));
+
+  draco::DecoderBuffer decoder_buffer;
+  decoder_buffer.Init(buffer.data(), buffer.size());
+  draco::ChunkedMeshDecoder chunked_decoder;
+  DRACO_ASSERT_OK(chunked_decoder.DecodeHeader(&decoder_buffer));
+  ASSERT_EQ(decoder_buffer.remaining_size(), 0);
+  ASSERT_EQ(chunked_decoder.num_chunks(), chunked_encoder.num_encoded_chunks());
+  ASSERT_TRUE(chunked_decoder.has_chunk_bounds());
+
+  // All decoded positions must be within the bounds of their chunk.
+  std::vector<std::unique_ptr<draco::Mesh>> chunks;
+  for (int i = 0; i < chunked_decoder.num_chunks(); ++i) {
+    std::unique_ptr<draco::Mesh> chunk =
+        chunked_decoder.DecodeChunk(i).value();
+    ASSERT_NE(chunk, nullptr);
+    const draco::BoundingBox &bounds = chunked_decoder.chunk_bounds(i);
+    for (const FacePositions &face : GetSortedFacePositions(*chunk)) {
+      for (int c = 0; c < 9; ++c) {
+        ASSERT_GE(face[c], bounds.GetMinPoint()[c % 3]);
+        ASSERT_LE(face[c], bounds.GetMaxPoint()[c % 3]);
+      }
+    }
+    chunks.push_back(std::move(chunk));
+  }
+  ASSERT_FALSE(chunked_decoder.DecodeChunk(-1).ok());
+  ASSERT_FALSE(chunked_decoder.DecodeChunk(chunked_decoder.num_chunks()).ok());
+
+  // Query the lower corner of the mesh.
+  const draco::BoundingBox mesh_bounds = mesh->ComputeBoundingBox();
+  const draco::BoundingBox region(mesh_bounds.GetMinPoint(),
+                                  mesh_bounds.Center());
+  const std::vector<int> chunk_ids =
+      chunked_decoder.FindChunksInRegion(region);
+  ASSERT_FALSE(chunk_ids.empty());
+  ASSERT_LT(chunk_ids.size(), chunked_decoder.num_chunks());
+  std::vector<std::unique_ptr<draco::Mesh>> region_chunks;
+  DRACO_ASSERT_OK(chunked_decoder.DecodeChunks(chunk_ids, &region_chunks));
+  ASSERT_EQ(region_chunks.size(), chunk_ids.size());
+
+  // The decoded chunks must contain all faces touching the region.
+  int num_region_faces = 0;
+  for (const auto &chunk : region_chunks) {
+    num_region_faces += CountFacesInRegion(*chunk, region);
+  }
+  int num_expected_faces = 0;
+  for (const auto &chunk : chunks) {
+    num_expected_faces += CountFacesInRegion(*chunk, region);
+  }
+  ASSERT_GT(num_region_faces, 0);
+  ASSERT_EQ(num_region_faces, num_expected_faces);
+
+  // The index can be decoded without the chunk data.
+  const int64_t data_offset = chunked_decoder.chunk_offset(0);
+  decoder_buffer.Init(buffer.data(), data_offset);
+  draco::ChunkedMeshDecoder index_decoder;
+  DRACO_ASSERT_OK(index_decoder.DecodeIndex(&decoder_buffer));
+  ASSERT_EQ(index_decoder.num_chunks(), chunked_decoder.num_chunks());
+  ASSERT_FALSE(index_decoder.DecodeChunk(0).ok());
+  decoder_buffer.Init(buffer.data(), data_offset - 1);
+  ASSERT_FALSE(index_decoder.DecodeIndex(&decoder_buffer).ok());
+
+  // Only the chunks in the region are read from a file.
+  const std::string file_name =
+      draco::GetTestTempFileFullPath("chunked_region.drc");
+  ASSERT_TRUE(
+      draco::WriteBufferToFile(buffer.data(), buffer.size(), file_name));
+  std::vector<std::unique_ptr<draco::Mesh>> file_chunks;
+  DRACO_ASSERT_OK(
+      draco::ReadChunkedMeshRegionFromFile(file_name, region, &file_chunks));
+  ASSERT_EQ(file_chunks.size(), region_chunks.size());
+  for (size_t i = 0; i < file_chunks.size(); ++i) {
+    ASSERT_EQ(file_chunks[i]->num_faces(), region_chunks[i]->num_faces());
+  }
+}
+
+TEST_F(ChunkedMeshEncoderTest, TestDecodeWithDecoder) {
+  // Tests that draco::Decoder decodes chunked containers transparently.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("car.drc");
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+  draco::ChunkedMeshEncoder chunked_encoder;
+  chunked_encoder.set_max_chunk_faces(500);
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(chunked_encoder.EncodeMeshToBuffer(*mesh, encoder, &buffer));
+
+  draco::DecoderBuffer decoder_buffer;
+  decoder_buffer.Init(buffer.data(), buffer.size());
+  draco::ChunkedMeshDecoder chunked_decoder;
+  const std::unique_ptr<draco::Mesh> expected =
+      chunked_decoder.DecodeMeshFromBuffer(&decoder_buffer).value();
+  ASSERT_NE(expected, nullptr);
+
+  decoder_buffer.Init(buffer.data(), buffer.size());
+  ASSERT_EQ(draco::Decoder::GetEncodedGeometryType(&decoder_buffer).value(),
+            draco::TRIANGULAR_MESH);
+
+  draco::ThreadPool pool(3);
+  draco::Decoder decoder;
+  decoder.options()->SetThreadPool(&pool);
+  const std::unique_ptr<draco::Mesh> decoded =
+      decoder.DecodeMeshFromBuffer(&decoder_buffer).value();
+  ASSERT_NE(decoded, nullptr);
+  ASSERT_EQ(decoder_buffer.remaining_size(), 0);
+  ASSERT_EQ(GetSortedFacePositions(*decoded),
+            GetSortedFacePositions(*expected));
+
+  decoder_buffer.Init(buffer.data(), buffer.size());
+  const std::unique_ptr<draco::PointCloud> pc =
+      decoder.DecodePointCloudFromBuffer(&decoder_buffer).value();
+  ASSERT_NE(pc, nullptr);
+  ASSERT_EQ(pc->num_points(), expected->num_points());
+}
+
+TEST_F(ChunkedMeshEncoderTest, TestNestedContainer) {
+  // Tests that a chunk containing another chunked container is rejected.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+  draco::ChunkedMeshEncoder chunked_encoder;
+  draco::EncoderBuffer inner_buffer;
+  DRACO_ASSERT_OK(
+      chunked_encoder.EncodeMeshToBuffer(*mesh, encoder, &inner_buffer));
+
+  // Version 1.0 container with a single chunk.
+  draco::EncoderBuffer buffer;
+  buffer.Encode("DRCHK", 5);
+  buffer.Encode(static_cast<uint8_t>(1));
+  buffer.Encode(static_cast<uint8_t>(0));
+  draco::EncodeVarint<uint32_t>(1, &buffer);
+  draco::EncodeVarint<uint64_t>(inner_buffer.size(), &buffer);
+  buffer.Encode(inner_buffer.data(), inner_buffer.size());
+  draco::DecoderBuffer decoder_buffer;
+  decoder_buffer.Init(buffer.data(), buffer.size());
+  draco::Decoder decoder;
+  ASSERT_FALSE(decoder.DecodeMeshFromBuffer(&decoder_buffer).ok());
+}
+
+TEST_F(ChunkedMeshEncoderTest, TestInvalidInput) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+  draco::ChunkedMeshEncoder chunked_encoder;
+  chunked_encoder.set_max_chunk_faces(1000);
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(chunked_encoder.EncodeMeshToBuffer(*mesh, encoder, &buffer));
+
+  draco::ChunkedMeshDecoder chunked_decoder;
+  draco::DecoderBuffer decoder_buffer;
+  // Truncated input.
+  decoder_buffer.Init(buffer.data(), buffer.size() - 10);
+  ASSERT_FALSE(chunked_decoder.DecodeMeshFromBuffer(&decoder_buffer).ok());
+  decoder_buffer.Init(buffer.data(), 8);
+  ASSERT_FALSE(chunked_decoder.DecodeMeshFromBuffer(&decoder_buffer).ok());
+
+  // Regular Draco bitstream.
+  draco::EncoderBuffer regular_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &regular_buffer));
+  decoder_buffer.Init(regular_buffer.data(), regular_buffer.size());
+  ASSERT_FALSE(draco::ChunkedMeshDecoder::IsChunkedMesh(&decoder_buffer));
+  ASSERT_FALSE(chunked_decoder.DecodeMeshFromBuffer(&decoder_buffer).ok());
+}
+
+}  // namespace
@@ -48,7 +48,15 @@ enum EncodedGeometryType {
 // List of encoding methods for point clouds.
 enum PointCloudEncodingMethod {
   POINT_CLOUD_SEQUENTIAL_ENCODING = 0,
-  POINT_CLOUD_KD_TREE_ENCODING
+  POINT_CLOUD_KD_TREE_ENCODING,
+  // Sequential encoding of points sorted along the Morton curve of their
+  // positions. The encoded data uses POINT_CLOUD_SEQUENTIAL_ENCODING, so this
+  // value is used only to select the encoder and never appears in the
+  // bitstream.
+  POINT_CLOUD_MORTON_ORDER_ENCODING,
+  // Sequential encoding of independent blocks of points that are encoded and
+  // decoded in parallel.
+  POINT_CLOUD_CHUNKED_SEQUENTIAL_ENCODING
 };
 
 // List of encoding methods for meshes.
@@ -74,6 +82,9 @@ enum SequentialAttributeEncoderType {
   SEQUENTIAL_ATTRIBUTE_ENCODER_INTEGER,
   SEQUENTIAL_ATTRIBUTE_ENCODER_QUANTIZATION,
   SEQUENTIAL_ATTRIBUTE_ENCODER_NORMALS,
+  SEQUENTIAL_ATTRIBUTE_ENCODER_DELTA,
+  SEQUENTIAL_ATTRIBUTE_ENCODER_LOSSLESS_FLOAT,
+  SEQUENTIAL_ATTRIBUTE_ENCODER_YCOCG,
 };
 
 // List of all prediction methods currently supported by our framework.
@@ -89,6 +100,12 @@ enum PredictionSchemeMethod {
   MESH_PREDICTION_CONSTRAINED_MULTI_PARALLELOGRAM = 4,
   MESH_PREDICTION_TEX_COORDS_PORTABLE = 5,
   MESH_PREDICTION_GEOMETRIC_NORMAL = 6,
+  // Specialized prediction for skinning attributes (joint indices and joint
+  // weights).
+  MESH_PREDICTION_SKIN = 7,
+  // Specialized prediction for feature IDs and other values that are constant
+  // over large regions of the mesh.
+  MESH_PREDICTION_FEATURE_ID = 8,
   NUM_PREDICTION_SCHEMES
 };
 
@@ -144,11 +161,28 @@ enum NormalPredictionMode {
 enum SymbolCodingMethod {
   SYMBOL_CODING_TAGGED = 0,
   SYMBOL_CODING_RAW = 1,
+  // Same as SYMBOL_CODING_RAW but the symbols are split into multiple
+  // interleaved rANS streams that can be decoded in parallel. Must be
+  // requested explicitly, because decoders that predate this method reject
+  // data that uses it.
+  SYMBOL_CODING_RAW_INTERLEAVED = 2,
+  // Same as SYMBOL_CODING_RAW but the probability table is taken from a
+  // registered SymbolDictionary (see symbol_dictionary.h) that is referenced
+  // by its id instead of being stored in the data.
+  SYMBOL_CODING_RAW_DICTIONARY = 3,
   NUM_SYMBOL_CODING_METHODS,
 };
 
 // Mask for setting and getting the bit for metadata in |flags| of header.
 #define METADATA_FLAG_MASK 0x8000
+// Mask of the bit in |flags| of header that is set when the metadata was
+// encoded with interned names (see MetadataEncoder::set_intern_names()).
+#define METADATA_INTERNED_NAMES_FLAG_MASK 0x4000
+
+// Name of the geometry metadata entry storing the crease angle of normals that
+// were removed by the encoder and are generated by the decoder.
+static constexpr char kGeneratedNormalsCreaseAngleMetadataName[] =
+    "draco_generated_normals_crease_angle";
 
 }  // namespace draco
 
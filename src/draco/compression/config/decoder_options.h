@@ -29,6 +29,35 @@ namespace draco {
 // by a unique name stored as an std::string.
 typedef DracoOptions<GeometryAttribute::Type> DecoderOptions;
 
+// Keys of the options that are read in every decoding. The names are interned
+// only once (see OptionKey), so that decoders running on many threads at once
+// do not contend on the process wide table of option names.
+struct DecoderOptionKeys {
+  // Global options.
+  const OptionKey decode_connectivity_only{"decode_connectivity_only"};
+  const OptionKey decode_layout_only{"decode_layout_only"};
+  const OptionKey generate_normals{"generate_normals"};
+  const OptionKey kd_tree_max_decoded_levels{"kd_tree_max_decoded_levels"};
+  const OptionKey lazy_metadata{"lazy_metadata"};
+  const OptionKey memory_limit_mb{"memory_limit_mb"};
+  const OptionKey optimize_vertex_cache{"optimize_vertex_cache"};
+  const OptionKey time_limit_ms{"time_limit_ms"};
+  const OptionKey use_packed_corner_table{"use_packed_corner_table"};
+  const OptionKey use_vertex_ring_cache{"use_vertex_ring_cache"};
+  const OptionKey work_limit_kops{"work_limit_kops"};
+
+  // Attribute options.
+  const OptionKey decode_to_quantized_attribute{
+      "decode_to_quantized_attribute"};
+  const OptionKey skip_attribute_decoding{"skip_attribute_decoding"};
+  const OptionKey skip_attribute_transform{"skip_attribute_transform"};
+};
+
+inline const DecoderOptionKeys &GetDecoderOptionKeys() {
+  static const DecoderOptionKeys keys;
+  return keys;
+}
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_CONFIG_DECODER_OPTIONS_H_
@@ -18,7 +18,12 @@
 #include <map>
 #include <memory>
 
+#include "draco/core/cancellation_token.h"
+#include "draco/core/coding_stats.h"
+#include "draco/core/coding_tracer.h"
+#include "draco/core/memory_arena.h"
 #include "draco/core/options.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -57,61 +62,61 @@ class DracoOptions {
   // an attribute specific storage, the implementation will return a global
   // option of the given name (if available). If the option is not found, the
   // provided default value |default_val| is returned instead.
-  int GetAttributeInt(const AttributeKey &att_key, const std::string &name,
+  int GetAttributeInt(const AttributeKey &att_key, const OptionKey &name,
                       int default_val) const;
 
   // Sets an option for a specific attribute key.
-  void SetAttributeInt(const AttributeKey &att_key, const std::string &name,
+  void SetAttributeInt(const AttributeKey &att_key, const OptionKey &name,
                        int val);
 
-  float GetAttributeFloat(const AttributeKey &att_key, const std::string &name,
+  float GetAttributeFloat(const AttributeKey &att_key, const OptionKey &name,
                           float default_val) const;
-  void SetAttributeFloat(const AttributeKey &att_key, const std::string &name,
+  void SetAttributeFloat(const AttributeKey &att_key, const OptionKey &name,
                          float val);
-  bool GetAttributeBool(const AttributeKey &att_key, const std::string &name,
+  bool GetAttributeBool(const AttributeKey &att_key, const OptionKey &name,
                         bool default_val) const;
-  void SetAttributeBool(const AttributeKey &att_key, const std::string &name,
+  void SetAttributeBool(const AttributeKey &att_key, const OptionKey &name,
                         bool val);
   template <typename DataTypeT>
-  bool GetAttributeVector(const AttributeKey &att_key, const std::string &name,
+  bool GetAttributeVector(const AttributeKey &att_key, const OptionKey &name,
                           int num_dims, DataTypeT *val) const;
   template <typename DataTypeT>
-  void SetAttributeVector(const AttributeKey &att_key, const std::string &name,
+  void SetAttributeVector(const AttributeKey &att_key, const OptionKey &name,
                           int num_dims, const DataTypeT *val);
 
   bool IsAttributeOptionSet(const AttributeKey &att_key,
-                            const std::string &name) const;
+                            const OptionKey &name) const;
 
   // Gets/sets a global option that is not specific to any attribute.
-  int GetGlobalInt(const std::string &name, int default_val) const {
+  int GetGlobalInt(const OptionKey &name, int default_val) const {
     return global_options_.GetInt(name, default_val);
   }
-  void SetGlobalInt(const std::string &name, int val) {
+  void SetGlobalInt(const OptionKey &name, int val) {
     global_options_.SetInt(name, val);
   }
-  float GetGlobalFloat(const std::string &name, float default_val) const {
+  float GetGlobalFloat(const OptionKey &name, float default_val) const {
     return global_options_.GetFloat(name, default_val);
   }
-  void SetGlobalFloat(const std::string &name, float val) {
+  void SetGlobalFloat(const OptionKey &name, float val) {
     global_options_.SetFloat(name, val);
   }
-  bool GetGlobalBool(const std::string &name, bool default_val) const {
+  bool GetGlobalBool(const OptionKey &name, bool default_val) const {
     return global_options_.GetBool(name, default_val);
   }
-  void SetGlobalBool(const std::string &name, bool val) {
+  void SetGlobalBool(const OptionKey &name, bool val) {
     global_options_.SetBool(name, val);
   }
   template <typename DataTypeT>
-  bool GetGlobalVector(const std::string &name, int num_dims,
+  bool GetGlobalVector(const OptionKey &name, int num_dims,
                        DataTypeT *val) const {
     return global_options_.GetVector(name, num_dims, val);
   }
   template <typename DataTypeT>
-  void SetGlobalVector(const std::string &name, int num_dims,
+  void SetGlobalVector(const OptionKey &name, int num_dims,
                        const DataTypeT *val) {
     global_options_.SetVector(name, val, num_dims);
   }
-  bool IsGlobalOptionSet(const std::string &name) const {
+  bool IsGlobalOptionSet(const OptionKey &name) const {
     return global_options_.IsOptionSet(name);
   }
 
@@ -123,11 +128,62 @@ class DracoOptions {
   const Options *FindAttributeOptions(const AttributeKeyT &att_key) const;
   const Options &GetGlobalOptions() const { return global_options_; }
 
+  // Sets an optional thread pool that can be used to speed up parts of the
+  // encoding or decoding that can be executed in parallel. The output is always
+  // the same as when no thread pool is set. The pool is not owned by the
+  // options and it must outlive any encoder or decoder that uses the options.
+  void SetThreadPool(ThreadPool *pool) { thread_pool_ = pool; }
+  ThreadPool *thread_pool() const { return thread_pool_; }
+
+  // Sets an optional memory arena used for allocating the attribute storage
+  // of decoded geometry. The arena is not owned by the options and the decoded
+  // geometry must not be used after the arena is destroyed. Releasing all
+  // memory of a decoded geometry then becomes a single arena reset.
+  void SetMemoryArena(MemoryArena *arena) { memory_arena_ = arena; }
+  MemoryArena *memory_arena() const { return memory_arena_; }
+
+  // Sets an optional collector of per-stage timings and byte counts of the
+  // encoding or decoding (see coding_stats.h). The collector is not owned by
+  // the options.
+  void SetCodingStats(CodingStats *stats) { coding_stats_ = stats; }
+  CodingStats *coding_stats() const { return coding_stats_; }
+
+  // Sets an optional receiver of begin and end events of the encoding or
+  // decoding stages (see coding_tracer.h). The events are emitted only when
+  // Draco is built with DRACO_TRACING. The tracer is not owned by the options.
+  void SetCodingTracer(CodingTracer *tracer) { coding_tracer_ = tracer; }
+  CodingTracer *coding_tracer() const { return coding_tracer_; }
+
+  // Sets an optional token that stops the decoding with an error when it is
+  // cancelled. The token is checked between the decoding stages. It is not
+  // owned by the options.
+  void SetCancellationToken(const CancellationToken *token) {
+    cancellation_token_ = token;
+  }
+  const CancellationToken *cancellation_token() const {
+    return cancellation_token_;
+  }
+
  private:
   Options *GetAttributeOptions(const AttributeKeyT &att_key);
 
   Options global_options_;
 
+  // Optional thread pool used for parallel processing (not owned).
+  ThreadPool *thread_pool_ = nullptr;
+
+  // Optional memory arena used for decoded attribute storage (not owned).
+  MemoryArena *memory_arena_ = nullptr;
+
+  // Optional collector of coding statistics (not owned).
+  CodingStats *coding_stats_ = nullptr;
+
+  // Optional receiver of stage events (not owned).
+  CodingTracer *coding_tracer_ = nullptr;
+
+  // Optional token used to cancel the decoding (not owned).
+  const CancellationToken *cancellation_token_ = nullptr;
+
   // Storage for options related to geometry attributes.
   std::map<AttributeKey, Options> attribute_options_;
 };
@@ -156,7 +212,7 @@ Options *DracoOptions<AttributeKeyT>::GetAttributeOptions(
 
 template <typename AttributeKeyT>
 int DracoOptions<AttributeKeyT>::GetAttributeInt(const AttributeKeyT &att_key,
-                                                 const std::string &name,
+                                                 const OptionKey &name,
                                                  int default_val) const {
   const Options *const att_options = FindAttributeOptions(att_key);
   if (att_options && att_options->IsOptionSet(name)) {
@@ -167,14 +223,14 @@ int DracoOptions<AttributeKeyT>::GetAttributeInt(const AttributeKeyT &att_key,
 
 template <typename AttributeKeyT>
 void DracoOptions<AttributeKeyT>::SetAttributeInt(const AttributeKeyT &att_key,
-                                                  const std::string &name,
+                                                  const OptionKey &name,
                                                   int val) {
   GetAttributeOptions(att_key)->SetInt(name, val);
 }
 
 template <typename AttributeKeyT>
 float DracoOptions<AttributeKeyT>::GetAttributeFloat(
-    const AttributeKeyT &att_key, const std::string &name,
+    const AttributeKeyT &att_key, const OptionKey &name,
     float default_val) const {
   const Options *const att_options = FindAttributeOptions(att_key);
   if (att_options && att_options->IsOptionSet(name)) {
@@ -185,13 +241,13 @@ float DracoOptions<AttributeKeyT>::GetAttributeFloat(
 
 template <typename AttributeKeyT>
 void DracoOptions<AttributeKeyT>::SetAttributeFloat(
-    const AttributeKeyT &att_key, const std::string &name, float val) {
+    const AttributeKeyT &att_key, const OptionKey &name, float val) {
   GetAttributeOptions(att_key)->SetFloat(name, val);
 }
 
 template <typename AttributeKeyT>
 bool DracoOptions<AttributeKeyT>::GetAttributeBool(const AttributeKeyT &att_key,
-                                                   const std::string &name,
+                                                   const OptionKey &name,
                                                    bool default_val) const {
   const Options *const att_options = FindAttributeOptions(att_key);
   if (att_options && att_options->IsOptionSet(name)) {
@@ -202,7 +258,7 @@ bool DracoOptions<AttributeKeyT>::GetAttributeBool(const AttributeKeyT &att_key,
 
 template <typename AttributeKeyT>
 void DracoOptions<AttributeKeyT>::SetAttributeBool(const AttributeKeyT &att_key,
-                                                   const std::string &name,
+                                                   const OptionKey &name,
                                                    bool val) {
   GetAttributeOptions(att_key)->SetBool(name, val);
 }
@@ -210,7 +266,7 @@ void DracoOptions<AttributeKeyT>::SetAttributeBool(const AttributeKeyT &att_key,
 template <typename AttributeKeyT>
 template <typename DataTypeT>
 bool DracoOptions<AttributeKeyT>::GetAttributeVector(
-    const AttributeKey &att_key, const std::string &name, int num_dims,
+    const AttributeKey &att_key, const OptionKey &name, int num_dims,
     DataTypeT *val) const {
   const Options *const att_options = FindAttributeOptions(att_key);
   if (att_options && att_options->IsOptionSet(name)) {
@@ -222,14 +278,14 @@ bool DracoOptions<AttributeKeyT>::GetAttributeVector(
 template <typename AttributeKeyT>
 template <typename DataTypeT>
 void DracoOptions<AttributeKeyT>::SetAttributeVector(
-    const AttributeKey &att_key, const std::string &name, int num_dims,
+    const AttributeKey &att_key, const OptionKey &name, int num_dims,
     const DataTypeT *val) {
   GetAttributeOptions(att_key)->SetVector(name, val, num_dims);
 }
 
 template <typename AttributeKeyT>
 bool DracoOptions<AttributeKeyT>::IsAttributeOptionSet(
-    const AttributeKey &att_key, const std::string &name) const {
+    const AttributeKey &att_key, const OptionKey &name) const {
   const Options *const att_options = FindAttributeOptions(att_key);
   if (att_options) {
     return att_options->IsOptionSet(name);
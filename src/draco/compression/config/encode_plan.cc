@@ -0,0 +1,108 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/config/encode_plan.h"
+
+namespace draco {
+
+EncodePlan::EncodePlan(const EncoderOptions &options, const PointCloud &pc)
+    : EncodePlan(options, pc, GetEncoderOptionKeys()) {}
+
+EncodePlan::EncodePlan(const EncoderOptions &options, const PointCloud &pc,
+                       const EncoderOptionKeys &keys)
+    : encoding_method_(options.GetGlobalInt(keys.encoding_method, -1)),
+      edgebreaker_method_(options.GetGlobalInt(keys.edgebreaker_method, -1)),
+      encoding_speed_(options.GetEncodingSpeed()),
+      decoding_speed_(options.GetDecodingSpeed()),
+      speed_(options.GetSpeed()),
+      is_edgebreaker_supported_(
+          options.IsFeatureSupported(keys.edgebreaker_feature)),
+      is_predictive_edgebreaker_supported_(
+          options.IsFeatureSupported(keys.predictive_edgebreaker_feature)),
+      split_mesh_on_seams_(
+          options.IsGlobalOptionSet(keys.split_mesh_on_seams)
+              ? options.GetGlobalBool(keys.split_mesh_on_seams, false)
+              : speed_ >= 6),
+      vertex_cache_connectivity_(
+          options.GetGlobalBool(keys.vertex_cache_connectivity, false)),
+      low_memory_encoding_(
+          options.GetGlobalBool(keys.low_memory_encoding, false)),
+      spatial_traversal_order_(
+          options.GetGlobalBool(keys.spatial_traversal_order, false)),
+      compress_connectivity_(
+          options.GetGlobalBool(keys.compress_connectivity, false)),
+      store_number_of_encoded_points_(
+          options.GetGlobalBool(keys.store_number_of_encoded_points, false)),
+      store_number_of_encoded_faces_(
+          options.GetGlobalBool(keys.store_number_of_encoded_faces, false)),
+      use_built_in_attribute_compression_(
+          options.GetGlobalBool(keys.use_built_in_attribute_compression,
+                                true)),
+      interleaved_symbol_coding_(
+          options.GetGlobalBool(keys.interleaved_symbol_coding, false)),
+      symbol_dictionary_id_(
+          options.IsGlobalOptionSet(keys.symbol_dictionary_id)
+              ? options.GetGlobalInt(keys.symbol_dictionary_id, 0)
+              : -1),
+      sequential_block_size_(
+          options.GetGlobalInt(keys.sequential_block_size, 1 << 16)),
+      kd_tree_level_order_(
+          options.GetGlobalBool(keys.kd_tree_level_order, false)),
+      kd_tree_partition_levels_(
+          options.GetGlobalInt(keys.kd_tree_partition_levels, 0)),
+      has_geometry_dependent_options_(
+          options.GetGlobalFloat(keys.generated_normals_crease_angle, -1.f) >=
+          0.f) {
+  attributes_.resize(pc.num_attributes());
+  num_components_.resize(pc.num_attributes());
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    AttributeEncodePlan &att = attributes_[i];
+    const int num_components = pc.attribute(i)->num_components();
+    num_components_[i] = num_components;
+    att.quantization_bits =
+        options.GetAttributeInt(i, keys.quantization_bits, -1);
+    if (options.IsAttributeOptionSet(i, keys.quantization_origin) &&
+        options.IsAttributeOptionSet(i, keys.quantization_range)) {
+      att.quantization_origin.resize(num_components, 0.f);
+      options.GetAttributeVector(i, keys.quantization_origin, num_components,
+                                 att.quantization_origin.data());
+      att.quantization_range =
+          options.GetAttributeFloat(i, keys.quantization_range, 1.f);
+    }
+    att.prediction_scheme =
+        options.GetAttributeInt(i, keys.prediction_scheme, -1);
+    att.delta_coding = options.GetAttributeBool(i, keys.delta_coding, false);
+    att.lossless_float_coding =
+        options.GetAttributeBool(i, keys.lossless_float_coding, false);
+    att.ycocg_transform =
+        options.GetAttributeBool(i, keys.ycocg_transform, false);
+    if (options.IsAttributeOptionSet(i, keys.max_quantization_error)) {
+      has_geometry_dependent_options_ = true;
+    }
+  }
+}
+
+bool EncodePlan::IsCompatible(const PointCloud &pc) const {
+  if (pc.num_attributes() != num_attributes()) {
+    return false;
+  }
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    if (pc.attribute(i)->num_components() != num_components_[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace draco
@@ -0,0 +1,148 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_CONFIG_ENCODE_PLAN_H_
+#define DRACO_COMPRESSION_CONFIG_ENCODE_PLAN_H_
+
+#include <vector>
+
+#include "draco/compression/config/encoder_options.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Encoder options of a single attribute resolved by EncodePlan.
+struct AttributeEncodePlan {
+  // Number of quantization bits or -1 when the attribute is not quantized.
+  int quantization_bits = -1;
+  // Origin and range of the quantization box when both were set explicitly.
+  // Otherwise |quantization_origin| is empty and the box is computed from the
+  // attribute values.
+  std::vector<float> quantization_origin;
+  float quantization_range = 1.f;
+  // Requested prediction scheme or -1 when it is selected by the encoder.
+  int prediction_scheme = -1;
+  bool delta_coding = false;
+  bool lossless_float_coding = false;
+  bool ycocg_transform = false;
+};
+
+// Immutable set of encoder options resolved into typed values. The point cloud
+// and mesh encoders read all their settings from a plan instead of looking up
+// the named options of EncoderOptions whenever a setting is needed. When many
+// geometries with the same attributes are encoded with the same options, the
+// plan can be created once and shared by all encoders and threads, see
+// ExpertEncoder::SetEncodePlan().
+class EncodePlan {
+ public:
+  // Resolves |options| for encoding |pc| or any other geometry with the same
+  // number of attributes and attribute components.
+  EncodePlan(const EncoderOptions &options, const PointCloud &pc);
+
+  // Returns true when the plan can be used for encoding |pc|.
+  bool IsCompatible(const PointCloud &pc) const;
+
+  // Encoding method requested by the "encoding_method" option or -1.
+  int encoding_method() const { return encoding_method_; }
+  // Requested edgebreaker method or -1.
+  int edgebreaker_method() const { return edgebreaker_method_; }
+  int encoding_speed() const { return encoding_speed_; }
+  int decoding_speed() const { return decoding_speed_; }
+  // The maximum of the encoding and decoding speed, see
+  // EncoderOptions::GetSpeed().
+  int speed() const { return speed_; }
+
+  bool is_edgebreaker_supported() const { return is_edgebreaker_supported_; }
+  bool is_predictive_edgebreaker_supported() const {
+    return is_predictive_edgebreaker_supported_;
+  }
+  // Returns whether all attributes of a mesh are encoded with the connectivity
+  // of the position attribute. Set explicitly by the "split_mesh_on_seams"
+  // option or derived from the speed.
+  bool split_mesh_on_seams() const { return split_mesh_on_seams_; }
+  bool vertex_cache_connectivity() const { return vertex_cache_connectivity_; }
+  // Returns whether the connectivity encoder should keep its working memory
+  // small at the cost of some encoding speed. Set by the "low_memory_encoding"
+  // option.
+  bool low_memory_encoding() const { return low_memory_encoding_; }
+  // Returns whether the edgebreaker encoder should traverse the connected
+  // components in the Morton order of their start faces, so that decoded
+  // meshes come out in a spatially coherent order. Set by the
+  // "spatial_traversal_order" option.
+  bool spatial_traversal_order() const { return spatial_traversal_order_; }
+  bool compress_connectivity() const { return compress_connectivity_; }
+  bool store_number_of_encoded_points() const {
+    return store_number_of_encoded_points_;
+  }
+  bool store_number_of_encoded_faces() const {
+    return store_number_of_encoded_faces_;
+  }
+
+  bool use_built_in_attribute_compression() const {
+    return use_built_in_attribute_compression_;
+  }
+  bool interleaved_symbol_coding() const { return interleaved_symbol_coding_; }
+  // Symbol dictionary id or -1 when no dictionary is used.
+  int symbol_dictionary_id() const { return symbol_dictionary_id_; }
+  // Number of points in a block of the chunked sequential encoding. Set by
+  // the "sequential_block_size" option.
+  int sequential_block_size() const { return sequential_block_size_; }
+  bool kd_tree_level_order() const { return kd_tree_level_order_; }
+  int kd_tree_partition_levels() const { return kd_tree_partition_levels_; }
+
+  // Returns true when the options contain settings that are resolved from the
+  // values of the encoded geometry, such as the maximum quantization errors or
+  // the crease angle of generated normals.
+  bool has_geometry_dependent_options() const {
+    return has_geometry_dependent_options_;
+  }
+
+  int num_attributes() const { return static_cast<int>(attributes_.size()); }
+  const AttributeEncodePlan &attribute(int att_id) const {
+    return attributes_[att_id];
+  }
+
+ private:
+  EncodePlan(const EncoderOptions &options, const PointCloud &pc,
+             const EncoderOptionKeys &keys);
+
+  int encoding_method_;
+  int edgebreaker_method_;
+  int encoding_speed_;
+  int decoding_speed_;
+  int speed_;
+  bool is_edgebreaker_supported_;
+  bool is_predictive_edgebreaker_supported_;
+  bool split_mesh_on_seams_;
+  bool vertex_cache_connectivity_;
+  bool low_memory_encoding_;
+  bool spatial_traversal_order_;
+  bool compress_connectivity_;
+  bool store_number_of_encoded_points_;
+  bool store_number_of_encoded_faces_;
+  bool use_built_in_attribute_compression_;
+  bool interleaved_symbol_coding_;
+  int symbol_dictionary_id_;
+  int sequential_block_size_;
+  bool kd_tree_level_order_;
+  int kd_tree_partition_levels_;
+  bool has_geometry_dependent_options_;
+  std::vector<AttributeEncodePlan> attributes_;
+  // Number of components of the attributes the plan was created for.
+  std::vector<int> num_components_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_CONFIG_ENCODE_PLAN_H_
@@ -0,0 +1,128 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/config/encode_plan.h"
+
+#include <cstring>
+#include <memory>
+
+#include "draco/compression/expert_encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace {
+
+TEST(EncodePlanTest, TestResolvedOptions) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  const int pos_id =
+      mesh->GetNamedAttributeId(draco::GeometryAttribute::POSITION);
+  const int tex_id =
+      mesh->GetNamedAttributeId(draco::GeometryAttribute::TEX_COORD);
+  draco::EncoderOptions options = draco::EncoderOptions::CreateDefaultOptions();
+  options.SetSpeed(3, 7);
+  options.SetGlobalInt("quantization_bits", 8);
+  options.SetAttributeInt(pos_id, "quantization_bits", 12);
+  const float origin[3] = {-1.f, -2.f, -3.f};
+  options.SetAttributeVector(pos_id, "quantization_origin", 3, origin);
+  options.SetAttributeFloat(pos_id, "quantization_range", 4.f);
+  options.SetAttributeInt(tex_id, "prediction_scheme", draco::PREDICTION_NONE);
+  options.SetGlobalInt("symbol_dictionary_id", 5);
+
+  const draco::EncodePlan plan(options, *mesh);
+  ASSERT_EQ(plan.num_attributes(), mesh->num_attributes());
+  ASSERT_TRUE(plan.IsCompatible(*mesh));
+  ASSERT_EQ(plan.encoding_speed(), 3);
+  ASSERT_EQ(plan.decoding_speed(), 7);
+  ASSERT_EQ(plan.speed(), 7);
+  ASSERT_TRUE(plan.split_mesh_on_seams());
+  ASSERT_EQ(plan.encoding_method(), -1);
+  ASSERT_EQ(plan.symbol_dictionary_id(), 5);
+  ASSERT_FALSE(plan.has_geometry_dependent_options());
+
+  const draco::AttributeEncodePlan &pos = plan.attribute(pos_id);
+  ASSERT_EQ(pos.quantization_bits, 12);
+  ASSERT_EQ(pos.quantization_origin.size(), 3);
+  ASSERT_EQ(pos.quantization_origin[2], -3.f);
+  ASSERT_EQ(pos.quantization_range, 4.f);
+  ASSERT_EQ(pos.prediction_scheme, -1);
+  // Global options apply to attributes without their own value.
+  const draco::AttributeEncodePlan &tex = plan.attribute(tex_id);
+  ASSERT_EQ(tex.quantization_bits, 8);
+  ASSERT_TRUE(tex.quantization_origin.empty());
+  ASSERT_EQ(tex.prediction_scheme, draco::PREDICTION_NONE);
+
+  options.SetAttributeFloat(tex_id, "max_quantization_error", 0.001f);
+  ASSERT_TRUE(
+      draco::EncodePlan(options, *mesh).has_geometry_dependent_options());
+}
+
+TEST(EncodePlanTest, TestSharedPlanMatchesOptions) {
+  // Encoding with a plan shared by several encoders must produce the same
+  // data as encoding with the options alone.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::EncoderOptions options = draco::EncoderOptions::CreateDefaultOptions();
+  options.SetSpeed(5, 5);
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    options.SetAttributeInt(i, "quantization_bits", 11);
+  }
+
+  draco::EncoderBuffer expected;
+  draco::ExpertEncoder reference_encoder(*mesh);
+  reference_encoder.Reset(options);
+  DRACO_ASSERT_OK(reference_encoder.EncodeToBuffer(&expected));
+
+  const draco::EncodePlan plan(options, *mesh);
+  for (int i = 0; i < 2; ++i) {
+    draco::EncoderBuffer buffer;
+    draco::ExpertEncoder encoder(*mesh);
+    encoder.Reset(options);
+    encoder.SetEncodePlan(&plan);
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(&buffer));
+    ASSERT_EQ(buffer.size(), expected.size());
+    ASSERT_EQ(memcmp(buffer.data(), expected.data(), buffer.size()), 0);
+  }
+}
+
+TEST(EncodePlanTest, TestInvalidPlan) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  const std::unique_ptr<draco::Mesh> other_mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  ASSERT_NE(other_mesh, nullptr);
+  draco::EncoderOptions options = draco::EncoderOptions::CreateDefaultOptions();
+
+  // The plan was created for geometry with different attributes.
+  const draco::EncodePlan other_plan(options, *other_mesh);
+  ASSERT_FALSE(other_plan.IsCompatible(*mesh));
+  draco::EncoderBuffer buffer;
+  draco::ExpertEncoder encoder(*mesh);
+  encoder.Reset(options);
+  encoder.SetEncodePlan(&other_plan);
+  ASSERT_FALSE(encoder.EncodeToBuffer(&buffer).ok());
+
+  // Quantization bits selected from the maximum error depend on the values of
+  // the encoded geometry.
+  options.SetAttributeFloat(0, "max_quantization_error", 0.01f);
+  const draco::EncodePlan plan(options, *mesh);
+  encoder.Reset(options);
+  encoder.SetEncodePlan(&plan);
+  ASSERT_FALSE(encoder.EncodeToBuffer(&buffer).ok());
+}
+
+}  // namespace
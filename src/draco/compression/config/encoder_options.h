@@ -22,6 +22,58 @@
 
 namespace draco {
 
+// Keys of the options that are read in every encoding. The names are interned
+// only once (see OptionKey), so that encoders running on many threads at once
+// do not contend on the process wide table of option names.
+struct EncoderOptionKeys {
+  // Global options.
+  const OptionKey compress_connectivity{"compress_connectivity"};
+  const OptionKey decoding_speed{"decoding_speed"};
+  const OptionKey edgebreaker_method{"edgebreaker_method"};
+  const OptionKey encoding_method{"encoding_method"};
+  const OptionKey encoding_speed{"encoding_speed"};
+  const OptionKey generated_normals_crease_angle{
+      "generated_normals_crease_angle"};
+  const OptionKey interleaved_symbol_coding{"interleaved_symbol_coding"};
+  const OptionKey intern_metadata_names{"intern_metadata_names"};
+  const OptionKey kd_tree_level_order{"kd_tree_level_order"};
+  const OptionKey kd_tree_partition_levels{"kd_tree_partition_levels"};
+  const OptionKey low_memory_encoding{"low_memory_encoding"};
+  const OptionKey sequential_block_size{"sequential_block_size"};
+  const OptionKey spatial_traversal_order{"spatial_traversal_order"};
+  const OptionKey split_mesh_on_seams{"split_mesh_on_seams"};
+  const OptionKey store_number_of_encoded_faces{
+      "store_number_of_encoded_faces"};
+  const OptionKey store_number_of_encoded_points{
+      "store_number_of_encoded_points"};
+  const OptionKey symbol_dictionary_id{"symbol_dictionary_id"};
+  const OptionKey use_built_in_attribute_compression{
+      "use_built_in_attribute_compression"};
+  const OptionKey vertex_cache_connectivity{"vertex_cache_connectivity"};
+
+  // Attribute options.
+  const OptionKey delta_coding{"delta_coding"};
+  const OptionKey lossless_float_coding{"lossless_float_coding"};
+  const OptionKey max_quantization_error{"max_quantization_error"};
+  const OptionKey max_quantization_error_texture_size{
+      "max_quantization_error_texture_size"};
+  const OptionKey prediction_scheme{"prediction_scheme"};
+  const OptionKey quantization_bits{"quantization_bits"};
+  const OptionKey quantization_origin{"quantization_origin"};
+  const OptionKey quantization_range{"quantization_range"};
+  const OptionKey ycocg_transform{"ycocg_transform"};
+
+  // Features, see encoding_features.h.
+  const OptionKey edgebreaker_feature{features::kEdgebreaker};
+  const OptionKey predictive_edgebreaker_feature{
+      features::kPredictiveEdgebreaker};
+};
+
+inline const EncoderOptionKeys &GetEncoderOptionKeys() {
+  static const EncoderOptionKeys keys;
+  return keys;
+}
+
 // EncoderOptions allow users to specify so called feature options that are used
 // to inform the encoder which encoding features can be used (i.e. which
 // features are going to be available to the decoder).
@@ -31,10 +83,12 @@ class EncoderOptionsBase : public DracoOptions<AttributeKeyT> {
   static EncoderOptionsBase CreateDefaultOptions() {
     EncoderOptionsBase options;
 #ifdef DRACO_STANDARD_EDGEBREAKER_SUPPORTED
-    options.SetSupportedFeature(features::kEdgebreaker, true);
+    options.SetSupportedFeature(GetEncoderOptionKeys().edgebreaker_feature,
+                                true);
 #endif
 #ifdef DRACO_PREDICTIVE_EDGEBREAKER_SUPPORTED
-    options.SetSupportedFeature(features::kPredictiveEdgebreaker, true);
+    options.SetSupportedFeature(
+        GetEncoderOptionKeys().predictive_edgebreaker_feature, true);
 #endif
     return options;
   }
@@ -44,16 +98,17 @@ class EncoderOptionsBase : public DracoOptions<AttributeKeyT> {
 
   // Returns speed options with default value of 5.
   int GetEncodingSpeed() const {
-    return this->GetGlobalInt("encoding_speed", 5);
+    return this->GetGlobalInt(GetEncoderOptionKeys().encoding_speed, 5);
   }
   int GetDecodingSpeed() const {
-    return this->GetGlobalInt("decoding_speed", 5);
+    return this->GetGlobalInt(GetEncoderOptionKeys().decoding_speed, 5);
   }
 
   // Returns the maximum speed for both encoding/decoding.
   int GetSpeed() const {
-    const int encoding_speed = this->GetGlobalInt("encoding_speed", -1);
-    const int decoding_speed = this->GetGlobalInt("decoding_speed", -1);
+    const EncoderOptionKeys &keys = GetEncoderOptionKeys();
+    const int encoding_speed = this->GetGlobalInt(keys.encoding_speed, -1);
+    const int decoding_speed = this->GetGlobalInt(keys.decoding_speed, -1);
     const int max_speed = std::max(encoding_speed, decoding_speed);
     if (max_speed == -1) {
       return 5;  // Default value.
@@ -62,21 +117,23 @@ class EncoderOptionsBase : public DracoOptions<AttributeKeyT> {
   }
 
   void SetSpeed(int encoding_speed, int decoding_speed) {
-    this->SetGlobalInt("encoding_speed", encoding_speed);
-    this->SetGlobalInt("decoding_speed", decoding_speed);
+    const EncoderOptionKeys &keys = GetEncoderOptionKeys();
+    this->SetGlobalInt(keys.encoding_speed, encoding_speed);
+    this->SetGlobalInt(keys.decoding_speed, decoding_speed);
   }
   bool IsSpeedSet() const {
-    return this->IsGlobalOptionSet("encoding_speed") ||
-           this->IsGlobalOptionSet("decoding_speed");
+    const EncoderOptionKeys &keys = GetEncoderOptionKeys();
+    return this->IsGlobalOptionSet(keys.encoding_speed) ||
+           this->IsGlobalOptionSet(keys.decoding_speed);
   }
 
   // Sets a given feature as supported or unsupported by the target decoder.
   // Encoder will always use only supported features when encoding the input
   // geometry.
-  void SetSupportedFeature(const std::string &name, bool supported) {
+  void SetSupportedFeature(const OptionKey &name, bool supported) {
     feature_options_.SetBool(name, supported);
   }
-  bool IsFeatureSupported(const std::string &name) const {
+  bool IsFeatureSupported(const OptionKey &name) const {
     return feature_options_.GetBool(name);
   }
 
@@ -14,14 +14,28 @@
 //
 #include "draco/compression/decode.h"
 
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "draco/attributes/attribute_octahedron_transform.h"
+#include "draco/attributes/attribute_quantization_transform.h"
 #include "draco/compression/config/compression_shared.h"
+#include "draco/compression/mesh/mesh_decoder.h"
+#include "draco/compression/point_cloud/point_cloud_decoder.h"
 
 #ifdef DRACO_MESH_COMPRESSION_SUPPORTED
+#include "draco/compression/chunked_mesh_decoder.h"
 #include "draco/compression/mesh/mesh_edgebreaker_decoder.h"
 #include "draco/compression/mesh/mesh_sequential_decoder.h"
+#include "draco/mesh/mesh_normal_generator.h"
+#include "draco/mesh/mesh_vertex_cache_optimizer.h"
 #endif
 
 #ifdef DRACO_POINT_CLOUD_COMPRESSION_SUPPORTED
+#include "draco/compression/point_cloud/point_cloud_chunked_sequential_decoder.h"
 #include "draco/compression/point_cloud/point_cloud_kd_tree_decoder.h"
 #include "draco/compression/point_cloud/point_cloud_sequential_decoder.h"
 #endif
@@ -36,11 +50,84 @@ StatusOr<std::unique_ptr<PointCloudDecoder>> CreatePointCloudDecoder(
         new PointCloudSequentialDecoder());
   } else if (method == POINT_CLOUD_KD_TREE_ENCODING) {
     return std::unique_ptr<PointCloudDecoder>(new PointCloudKdTreeDecoder());
+  } else if (method == POINT_CLOUD_CHUNKED_SEQUENTIAL_ENCODING) {
+    return std::unique_ptr<PointCloudDecoder>(
+        new PointCloudChunkedSequentialDecoder());
   }
   return Status(Status::DRACO_ERROR, "Unsupported encoding method.");
 }
 #endif
 
+namespace {
+
+// Decodes scheduled by Decoder::DecodeMeshAsync() that did not start yet.
+// Each pending decode has a corresponding task in its thread pool. When the
+// task runs, it starts the pending decode of the pool with the highest
+// priority, which is not necessarily the decode that scheduled the task.
+class AsyncDecodeQueue {
+ public:
+  void Schedule(ThreadPool *pool, int priority, std::function<void()> job) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.emplace(Key{pool, priority, next_sequence_number_++},
+                    std::move(job));
+    }
+    pool->Schedule([this, pool]() { RunNext(pool); });
+  }
+
+ private:
+  struct Key {
+    const ThreadPool *pool;
+    int priority;
+    uint64_t sequence_number;
+
+    // Orders jobs by pool, from the highest priority and then by sequence.
+    bool operator<(const Key &other) const {
+      if (pool != other.pool) {
+        return std::less<const ThreadPool *>()(pool, other.pool);
+      }
+      if (priority != other.priority) {
+        return priority > other.priority;
+      }
+      return sequence_number < other.sequence_number;
+    }
+  };
+
+  void RunNext(const ThreadPool *pool) {
+    std::function<void()> job;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const auto it = jobs_.lower_bound(
+          Key{pool, std::numeric_limits<int>::max(), 0});
+      // There is always at least one job per scheduled task.
+      job = std::move(it->second);
+      jobs_.erase(it);
+    }
+    job();
+  }
+
+  std::mutex mutex_;
+  std::map<Key, std::function<void()>> jobs_;
+  uint64_t next_sequence_number_ = 0;
+};
+
+AsyncDecodeQueue *GetAsyncDecodeQueue() {
+  // The queue is never destroyed so that it can be used by tasks that run
+  // during static destruction.
+  static AsyncDecodeQueue *const queue = new AsyncDecodeQueue();
+  return queue;
+}
+
+// Moves the faces of |mesh| into |out_indices| when they fit 16-bit indices.
+void ReleaseFacesToCompactIndices(Mesh *mesh,
+                                  std::vector<uint16_t> *out_indices) {
+  if (!mesh->ReleaseFacesToCompactIndices(out_indices)) {
+    out_indices->clear();
+  }
+}
+
+}  // namespace
+
 #ifdef DRACO_MESH_COMPRESSION_SUPPORTED
 StatusOr<std::unique_ptr<MeshDecoder>> CreateMeshDecoder(uint8_t method) {
   if (method == MESH_SEQUENTIAL_ENCODING) {
@@ -54,6 +141,11 @@ StatusOr<std::unique_ptr<MeshDecoder>> CreateMeshDecoder(uint8_t method) {
 
 StatusOr<EncodedGeometryType> Decoder::GetEncodedGeometryType(
     DecoderBuffer *in_buffer) {
+#ifdef DRACO_MESH_COMPRESSION_SUPPORTED
+  if (ChunkedMeshDecoder::IsChunkedMesh(in_buffer)) {
+    return TRIANGULAR_MESH;
+  }
+#endif
   DecoderBuffer temp_buffer(*in_buffer);
   DracoHeader header;
   DRACO_RETURN_IF_ERROR(PointCloudDecoder::DecodeHeader(&temp_buffer, &header));
@@ -64,7 +156,7 @@ StatusOr<EncodedGeometryType> Decoder::GetEncodedGeometryType(
 }
 
 StatusOr<std::unique_ptr<PointCloud>> Decoder::DecodePointCloudFromBuffer(
-    DecoderBuffer *in_buffer) {
+    DecoderBuffer *in_buffer) const {
   DRACO_ASSIGN_OR_RETURN(EncodedGeometryType type,
                          GetEncodedGeometryType(in_buffer))
   if (type == POINT_CLOUD) {
@@ -75,8 +167,8 @@ StatusOr<std::unique_ptr<PointCloud>> Decoder::DecodePointCloudFromBuffer(
 #endif
   } else if (type == TRIANGULAR_MESH) {
 #ifdef DRACO_MESH_COMPRESSION_SUPPORTED
-    std::unique_ptr<Mesh> mesh(new Mesh());
-    DRACO_RETURN_IF_ERROR(DecodeBufferToGeometry(in_buffer, mesh.get()))
+    DRACO_ASSIGN_OR_RETURN(std::unique_ptr<Mesh> mesh,
+                           DecodeMeshFromBuffer(in_buffer))
     return static_cast<std::unique_ptr<PointCloud>>(std::move(mesh));
 #endif
   }
@@ -84,14 +176,52 @@ StatusOr<std::unique_ptr<PointCloud>> Decoder::DecodePointCloudFromBuffer(
 }
 
 StatusOr<std::unique_ptr<Mesh>> Decoder::DecodeMeshFromBuffer(
-    DecoderBuffer *in_buffer) {
+    DecoderBuffer *in_buffer) const {
+#ifdef DRACO_MESH_COMPRESSION_SUPPORTED
+  if (ChunkedMeshDecoder::IsChunkedMesh(in_buffer)) {
+    // The chunks are decoded in parallel on the thread pool of the options.
+    ChunkedMeshDecoder chunked_decoder;
+    *chunked_decoder.options() = options_;
+    return chunked_decoder.DecodeMeshFromBuffer(in_buffer);
+  }
+#endif
   std::unique_ptr<Mesh> mesh(new Mesh());
   DRACO_RETURN_IF_ERROR(DecodeBufferToGeometry(in_buffer, mesh.get()))
   return std::move(mesh);
 }
 
+StatusOr<std::unique_ptr<Mesh>> Decoder::DecodeMeshToCompactIndices(
+    DecoderBuffer *in_buffer, std::vector<uint16_t> *out_indices) const {
+  DRACO_ASSIGN_OR_RETURN(std::unique_ptr<Mesh> mesh,
+                         DecodeMeshFromBuffer(in_buffer));
+  ReleaseFacesToCompactIndices(mesh.get(), out_indices);
+  return mesh;
+}
+
+void Decoder::DecodeMeshAsync(DecoderBuffer *in_buffer, int priority,
+                              DecodeMeshCallback callback) const {
+  // The job owns copies of the decoder and of the buffer object.
+  Decoder decoder = *this;
+  DecoderBuffer buffer = *in_buffer;
+  std::function<void()> job = [decoder, buffer, callback]() mutable {
+    const CancellationToken *const token =
+        decoder.options()->cancellation_token();
+    if (token != nullptr && token->IsCancelled()) {
+      callback(Status(Status::DRACO_ERROR, "Decoding was cancelled."));
+      return;
+    }
+    callback(decoder.DecodeMeshFromBuffer(&buffer));
+  };
+  ThreadPool *const pool = options_.thread_pool();
+  if (pool == nullptr) {
+    job();
+    return;
+  }
+  GetAsyncDecodeQueue()->Schedule(pool, priority, std::move(job));
+}
+
 Status Decoder::DecodeBufferToGeometry(DecoderBuffer *in_buffer,
-                                       PointCloud *out_geometry) {
+                                       PointCloud *out_geometry) const {
 #ifdef DRACO_POINT_CLOUD_COMPRESSION_SUPPORTED
   DecoderBuffer temp_buffer(*in_buffer);
   DracoHeader header;
@@ -110,7 +240,7 @@ Status Decoder::DecodeBufferToGeometry(DecoderBuffer *in_buffer,
 }
 
 Status Decoder::DecodeBufferToGeometry(DecoderBuffer *in_buffer,
-                                       Mesh *out_geometry) {
+                                       Mesh *out_geometry) const {
 #ifdef DRACO_MESH_COMPRESSION_SUPPORTED
   DecoderBuffer temp_buffer(*in_buffer);
   DracoHeader header;
@@ -122,14 +252,232 @@ Status Decoder::DecodeBufferToGeometry(DecoderBuffer *in_buffer,
                          CreateMeshDecoder(header.encoder_method))
 
   DRACO_RETURN_IF_ERROR(decoder->Decode(options_, in_buffer, out_geometry))
+  GeometryMetadata *const metadata = out_geometry->metadata();
+  double normals_crease_angle;
+  if (metadata != nullptr &&
+      metadata->GetEntryDouble(kGeneratedNormalsCreaseAngleMetadataName,
+                               &normals_crease_angle)) {
+    metadata->RemoveEntry(kGeneratedNormalsCreaseAngleMetadataName);
+    if (options_.GetGlobalBool(GetDecoderOptionKeys().generate_normals,
+                               true)) {
+      DRACO_RETURN_IF_ERROR(MeshNormalGenerator::GenerateNormals(
+          out_geometry, static_cast<float>(normals_crease_angle),
+          options_.thread_pool()));
+    }
+  }
+  if (options_.GetGlobalBool(GetDecoderOptionKeys().optimize_vertex_cache,
+                             false)) {
+    MeshVertexCacheOptimizer::Optimize(out_geometry);
+  }
   return OkStatus();
 #else
   return Status(Status::DRACO_ERROR, "Unsupported geometry type.");
 #endif
 }
 
+StatusOr<EncodedGeometryInfo> Decoder::ProbeBuffer(
+    DecoderBuffer *in_buffer) const {
+#ifdef DRACO_MESH_COMPRESSION_SUPPORTED
+  if (ChunkedMeshDecoder::IsChunkedMesh(in_buffer)) {
+    return Status(Status::UNSUPPORTED_FEATURE,
+                  "Probing of chunked meshes is not supported.");
+  }
+#endif
+  DecoderBuffer temp_buffer(*in_buffer);
+  DracoHeader header;
+  DRACO_RETURN_IF_ERROR(PointCloudDecoder::DecodeHeader(&temp_buffer, &header))
+  EncodedGeometryInfo info;
+  info.encoder_method = header.encoder_method;
+  info.version_major = header.version_major;
+  info.version_minor = header.version_minor;
+
+  // Decode only the attribute descriptions and transform parameters.
+  DecoderOptions options = options_;
+  options.SetGlobalBool("decode_layout_only", true);
+  temp_buffer = *in_buffer;
+  std::unique_ptr<PointCloud> geometry;
+  if (header.encoder_type == POINT_CLOUD) {
+#ifdef DRACO_POINT_CLOUD_COMPRESSION_SUPPORTED
+    DRACO_ASSIGN_OR_RETURN(std::unique_ptr<PointCloudDecoder> decoder,
+                           CreatePointCloudDecoder(header.encoder_method))
+    geometry = std::unique_ptr<PointCloud>(new PointCloud());
+    DRACO_RETURN_IF_ERROR(
+        decoder->Decode(options, &temp_buffer, geometry.get()))
+    info.estimated_memory_usage = decoder->estimated_memory_usage();
+#endif
+  } else if (header.encoder_type == TRIANGULAR_MESH) {
+#ifdef DRACO_MESH_COMPRESSION_SUPPORTED
+    DRACO_ASSIGN_OR_RETURN(std::unique_ptr<MeshDecoder> decoder,
+                           CreateMeshDecoder(header.encoder_method))
+    std::unique_ptr<Mesh> mesh(new Mesh());
+    DRACO_RETURN_IF_ERROR(decoder->Decode(options, &temp_buffer, mesh.get()))
+    info.num_faces = mesh->num_faces();
+    info.estimated_memory_usage = decoder->estimated_memory_usage();
+    geometry = std::move(mesh);
+#endif
+  }
+  if (geometry == nullptr) {
+    return Status(Status::DRACO_ERROR, "Unsupported geometry type.");
+  }
+  info.geometry_type = static_cast<EncodedGeometryType>(header.encoder_type);
+  info.num_points = geometry->num_points();
+  for (int i = 0; i < geometry->num_attributes(); ++i) {
+    const PointAttribute &att = *geometry->attribute(i);
+    EncodedAttributeInfo att_info;
+    att_info.attribute_type = att.attribute_type();
+    att_info.data_type = att.data_type();
+    att_info.num_components = att.num_components();
+    att_info.normalized = att.normalized();
+    att_info.unique_id = att.unique_id();
+    AttributeQuantizationTransform quantization_transform;
+    AttributeOctahedronTransform octahedron_transform;
+    if (quantization_transform.InitFromAttribute(att)) {
+      att_info.quantization_bits = quantization_transform.quantization_bits();
+      att_info.min_values = quantization_transform.min_values();
+      att_info.range = quantization_transform.range();
+    } else if (octahedron_transform.InitFromAttribute(att)) {
+      att_info.quantization_bits = octahedron_transform.quantization_bits();
+    }
+    info.attributes.push_back(std::move(att_info));
+  }
+  return info;
+}
+
 void Decoder::SetSkipAttributeTransform(GeometryAttribute::Type att_type) {
   options_.SetAttributeBool(att_type, "skip_attribute_transform", true);
 }
 
+void Decoder::SetSkipAttributeDecoding(GeometryAttribute::Type att_type) {
+  options_.SetAttributeBool(att_type, "skip_attribute_decoding", true);
+}
+
+void Decoder::SetDecodeToQuantizedAttribute(GeometryAttribute::Type att_type) {
+  options_.SetAttributeBool(att_type, "decode_to_quantized_attribute", true);
+}
+
+BatchDecoder::BatchDecoder() {}
+
+BatchDecoder::~BatchDecoder() {}
+
+StatusOr<std::unique_ptr<PointCloud>> BatchDecoder::DecodePointCloudFromBuffer(
+    DecoderBuffer *in_buffer) {
+  DRACO_ASSIGN_OR_RETURN(EncodedGeometryType type,
+                         Decoder::GetEncodedGeometryType(in_buffer))
+  if (type == POINT_CLOUD) {
+#ifdef DRACO_POINT_CLOUD_COMPRESSION_SUPPORTED
+    std::unique_ptr<PointCloud> point_cloud(new PointCloud());
+    DRACO_RETURN_IF_ERROR(DecodeBufferToGeometry(in_buffer, point_cloud.get()))
+    return std::move(point_cloud);
+#endif
+  } else if (type == TRIANGULAR_MESH) {
+#ifdef DRACO_MESH_COMPRESSION_SUPPORTED
+    std::unique_ptr<Mesh> mesh(new Mesh());
+    DRACO_RETURN_IF_ERROR(DecodeBufferToGeometry(in_buffer, mesh.get()))
+    return static_cast<std::unique_ptr<PointCloud>>(std::move(mesh));
+#endif
+  }
+  return Status(Status::DRACO_ERROR, "Unsupported geometry type.");
+}
+
+StatusOr<std::unique_ptr<Mesh>> BatchDecoder::DecodeMeshFromBuffer(
+    DecoderBuffer *in_buffer) {
+  std::unique_ptr<Mesh> mesh(new Mesh());
+  DRACO_RETURN_IF_ERROR(DecodeBufferToGeometry(in_buffer, mesh.get()))
+  return std::move(mesh);
+}
+
+StatusOr<std::unique_ptr<Mesh>> BatchDecoder::DecodeMeshToCompactIndices(
+    DecoderBuffer *in_buffer, std::vector<uint16_t> *out_indices) {
+  DRACO_ASSIGN_OR_RETURN(std::unique_ptr<Mesh> mesh,
+                         DecodeMeshFromBuffer(in_buffer));
+  ReleaseFacesToCompactIndices(mesh.get(), out_indices);
+  return mesh;
+}
+
+Status BatchDecoder::DecodeBufferToGeometry(DecoderBuffer *in_buffer,
+                                            PointCloud *out_geometry) {
+#ifdef DRACO_POINT_CLOUD_COMPRESSION_SUPPORTED
+  DecoderBuffer temp_buffer(*in_buffer);
+  DracoHeader header;
+  DRACO_RETURN_IF_ERROR(PointCloudDecoder::DecodeHeader(&temp_buffer, &header))
+  if (header.encoder_type != POINT_CLOUD) {
+    return Status(Status::DRACO_ERROR, "Input is not a point cloud.");
+  }
+  const uint8_t method = header.encoder_method;
+  if (method >= point_cloud_decoders_.size()) {
+    point_cloud_decoders_.resize(method + 1);
+  }
+  if (point_cloud_decoders_[method] == nullptr) {
+    DRACO_ASSIGN_OR_RETURN(point_cloud_decoders_[method],
+                           CreatePointCloudDecoder(method))
+  }
+  DRACO_RETURN_IF_ERROR(
+      point_cloud_decoders_[method]->Decode(options_, in_buffer, out_geometry))
+  return OkStatus();
+#else
+  return Status(Status::DRACO_ERROR, "Unsupported geometry type.");
+#endif
+}
+
+Status BatchDecoder::DecodeBufferToGeometry(DecoderBuffer *in_buffer,
+                                            Mesh *out_geometry) {
+#ifdef DRACO_MESH_COMPRESSION_SUPPORTED
+  last_mesh_decoder_ = nullptr;
+  DecoderBuffer temp_buffer(*in_buffer);
+  DracoHeader header;
+  DRACO_RETURN_IF_ERROR(PointCloudDecoder::DecodeHeader(&temp_buffer, &header))
+  if (header.encoder_type != TRIANGULAR_MESH) {
+    return Status(Status::DRACO_ERROR, "Input is not a mesh.");
+  }
+  const uint8_t method = header.encoder_method;
+  if (method >= mesh_decoders_.size()) {
+    mesh_decoders_.resize(method + 1);
+  }
+  if (mesh_decoders_[method] == nullptr) {
+    DRACO_ASSIGN_OR_RETURN(mesh_decoders_[method], CreateMeshDecoder(method))
+  }
+  DRACO_RETURN_IF_ERROR(
+      mesh_decoders_[method]->Decode(options_, in_buffer, out_geometry))
+  last_mesh_decoder_ = mesh_decoders_[method].get();
+  return OkStatus();
+#else
+  return Status(Status::DRACO_ERROR, "Unsupported geometry type.");
+#endif
+}
+
+Status BatchDecoder::DecodeMeshesFromBuffers(
+    DecoderBuffer *in_buffers, size_t num_buffers,
+    std::vector<std::unique_ptr<Mesh>> *out_meshes) {
+  out_meshes->reserve(out_meshes->size() + num_buffers);
+  for (size_t i = 0; i < num_buffers; ++i) {
+    DRACO_ASSIGN_OR_RETURN(std::unique_ptr<Mesh> mesh,
+                           DecodeMeshFromBuffer(&in_buffers[i]))
+    out_meshes->push_back(std::move(mesh));
+  }
+  return OkStatus();
+}
+
+const CornerTable *BatchDecoder::GetLastMeshCornerTable() const {
+#ifdef DRACO_MESH_COMPRESSION_SUPPORTED
+  if (last_mesh_decoder_ != nullptr) {
+    return last_mesh_decoder_->GetCornerTable();
+  }
+#endif
+  return nullptr;
+}
+
+void BatchDecoder::SetSkipAttributeTransform(
+    GeometryAttribute::Type att_type) {
+  options_.SetAttributeBool(att_type, "skip_attribute_transform", true);
+}
+
+void BatchDecoder::SetSkipAttributeDecoding(GeometryAttribute::Type att_type) {
+  options_.SetAttributeBool(att_type, "skip_attribute_decoding", true);
+}
+
+void BatchDecoder::SetDecodeToQuantizedAttribute(
+    GeometryAttribute::Type att_type) {
+  options_.SetAttributeBool(att_type, "decode_to_quantized_attribute", true);
+}
+
 }  // namespace draco
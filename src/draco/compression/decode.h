@@ -15,6 +15,10 @@
 #ifndef DRACO_COMPRESSION_DECODE_H_
 #define DRACO_COMPRESSION_DECODE_H_
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/config/decoder_options.h"
 #include "draco/core/decoder_buffer.h"
@@ -24,8 +28,48 @@
 
 namespace draco {
 
+// Description of an encoded attribute returned by Decoder::ProbeBuffer().
+struct EncodedAttributeInfo {
+  GeometryAttribute::Type attribute_type = GeometryAttribute::INVALID;
+  // Data type and number of components of the decoded attribute values.
+  DataType data_type = DT_INVALID;
+  int num_components = 0;
+  bool normalized = false;
+  uint32_t unique_id = 0;
+  // Number of quantization bits, or 0 when the attribute is not quantized or
+  // the quantization parameters are not known without decoding the values.
+  int quantization_bits = 0;
+  // Bounding box of quantized attributes given by the minimum value of each
+  // component and by the range that is common to all components. Set only for
+  // attributes with an AttributeQuantizationTransform.
+  std::vector<float> min_values;
+  float range = 0.f;
+};
+
+// Description of an encoded geometry returned by Decoder::ProbeBuffer().
+struct EncodedGeometryInfo {
+  EncodedGeometryType geometry_type = INVALID_GEOMETRY_TYPE;
+  uint8_t encoder_method = 0;
+  uint8_t version_major = 0;
+  uint8_t version_minor = 0;
+  // Number of faces (zero for point clouds) and points of the decoded geometry.
+  int num_faces = 0;
+  int num_points = 0;
+  std::vector<EncodedAttributeInfo> attributes;
+  // Approximate peak memory in bytes needed to decode the geometry. See the
+  // global "memory_limit_mb" option of Decoder::DecodeBufferToGeometry().
+  uint64_t estimated_memory_usage = 0;
+};
+
 // Class responsible for decoding of meshes and point clouds that were
 // compressed by a Draco encoder.
+//
+// The decoding methods are const and all state of a decoding is local to the
+// call, so a configured decoder can be shared by any number of threads without
+// locking, as long as its options are not modified while it is in use. The
+// objects referenced by the options (thread pool, memory arena and
+// cancellation token) are thread-safe, except for the coding stats and the
+// coding tracer which must not be set on a shared decoder.
 class Decoder {
  public:
   // Returns the geometry type encoded in the input |in_buffer|.
@@ -41,22 +85,81 @@ class Decoder {
   // EncodeMeshToBuffer methods in encode.h. In case the input buffer contains
   // mesh, the returned instance can be down-casted to Mesh.
   StatusOr<std::unique_ptr<PointCloud>> DecodePointCloudFromBuffer(
-      DecoderBuffer *in_buffer);
+      DecoderBuffer *in_buffer) const;
 
   // Decodes a triangular mesh from the provided buffer. The mesh must be filled
   // with data that was encoded using the EncodeMeshToBuffer method in encode.h.
   // The function will return nullptr in case the input is invalid or if it was
   // encoded with the EncodePointCloudToBuffer method.
+  // Chunked mesh containers (see chunked_mesh_encoder.h) are decoded with
+  // ChunkedMeshDecoder, in parallel when a thread pool is set in the options.
   StatusOr<std::unique_ptr<Mesh>> DecodeMeshFromBuffer(
-      DecoderBuffer *in_buffer);
+      DecoderBuffer *in_buffer) const;
+
+  // Decodes a mesh like DecodeMeshFromBuffer(). When the mesh has at most 2^16
+  // points, its faces are moved into |out_indices| as a 16-bit index buffer
+  // and the returned mesh contains only the point attributes (see
+  // Mesh::ReleaseFacesToCompactIndices()). Otherwise |out_indices| is cleared
+  // and the faces are kept in the mesh.
+  StatusOr<std::unique_ptr<Mesh>> DecodeMeshToCompactIndices(
+      DecoderBuffer *in_buffer, std::vector<uint16_t> *out_indices) const;
+
+  typedef std::function<void(StatusOr<std::unique_ptr<Mesh>>)>
+      DecodeMeshCallback;
+
+  // Decodes a mesh like DecodeMeshFromBuffer() on the thread pool of the
+  // options and passes the result to |callback| on the thread that did the
+  // decoding. The method returns immediately; without a thread pool the mesh
+  // is decoded before it returns. The data of |in_buffer| must stay valid
+  // until |callback| is called, the buffer object itself may be destroyed.
+  //
+  // Pending decodes of the same pool start in order of their |priority|,
+  // highest first, and in order of the calls for equal priorities, e.g. to
+  // decode visible tiles before the others. When the cancellation token of
+  // the options is cancelled, a pending decode does not start at all and a
+  // running decode stops at the next stage. In both cases |callback| receives
+  // an error. Current options of the decoder are used, later changes have no
+  // effect on the scheduled decoding.
+  void DecodeMeshAsync(DecoderBuffer *in_buffer, int priority,
+                       DecodeMeshCallback callback) const;
+  void DecodeMeshAsync(DecoderBuffer *in_buffer,
+                       DecodeMeshCallback callback) const {
+    DecodeMeshAsync(in_buffer, 0, std::move(callback));
+  }
 
   // Decodes the buffer into a provided geometry. If the geometry is
   // incompatible with the encoded data. For example, when |out_geometry| is
   // draco::Mesh while the data contains a point cloud, the function will return
   // an error status.
+  // Normals that were removed by the encoder (see
+  // EncoderBase::SetGeneratedNormals()) are generated unless the global
+  // "generate_normals" option is set to false.
+  // When the global "optimize_vertex_cache" option is set, faces and points of
+  // decoded meshes are reordered for GPU vertex cache efficiency (see
+  // mesh_vertex_cache_optimizer.h).
+  // When the global "lazy_metadata" option is set, metadata entries are only
+  // decoded when they are accessed for the first time (see metadata_decoder.h).
+  // When the global "memory_limit_mb" option is set, the decoding fails before
+  // any large allocation if the memory estimated from the decoded sizes exceeds
+  // the limit (see Decoder::ProbeBuffer() and
+  // PointCloudDecoder::ReserveMemory()).
+  // The global "work_limit_kops" and "time_limit_ms" options bound the work
+  // (in thousands of operations, see PointCloudDecoder::ConsumeWork()) and the
+  // time spent on decoding, e.g., of untrusted inputs. The limits are checked
+  // at coarse granularity and the decoding fails with a "Work limit exceeded."
+  // or "Time limit exceeded." error as soon as one of them is exceeded.
   Status DecodeBufferToGeometry(DecoderBuffer *in_buffer,
-                                PointCloud *out_geometry);
-  Status DecodeBufferToGeometry(DecoderBuffer *in_buffer, Mesh *out_geometry);
+                                PointCloud *out_geometry) const;
+  Status DecodeBufferToGeometry(DecoderBuffer *in_buffer,
+                                Mesh *out_geometry) const;
+
+  // Returns the sizes and the attribute layout of the geometry encoded in
+  // |in_buffer| without decoding its attribute values, e.g. to allocate the
+  // output buffers before the decoding. The buffer is not advanced. Face indices
+  // of sequentially encoded meshes are skipped as well, but the connectivity of
+  // Edgebreaker meshes must be decoded to count their points. Chunked mesh
+  // containers are not supported.
+  StatusOr<EncodedGeometryInfo> ProbeBuffer(DecoderBuffer *in_buffer) const;
 
   // When set, the decoder is going to skip attribute transform for a given
   // attribute type. For example for quantized attributes, the decoder would
@@ -67,12 +170,90 @@ class Decoder {
   // transform manually.
   void SetSkipAttributeTransform(GeometryAttribute::Type att_type);
 
+  // When set, quantized attributes of |att_type| with at most 16 quantization
+  // bits are decoded to unnormalized DT_UINT8 or DT_UINT16 values that are
+  // directly usable as GPU vertex data (e.g. with the KHR_mesh_quantization
+  // glTF extension), instead of being dequantized to DT_FLOAT32. The attribute
+  // contains an AttributeTransform describing the quantization, see
+  // AttributeQuantizationTransform::ComputeDequantizationScale(). Other
+  // attributes of |att_type| are decoded normally.
+  void SetDecodeToQuantizedAttribute(GeometryAttribute::Type att_type);
+
+  // Sets the |att_type| attributes to be skipped: their encoded values are
+  // passed over without being decoded and the attributes are removed from the
+  // returned geometry. Positions may be needed to decode other attributes and
+  // they are therefore skipped only when all other attributes are skipped as
+  // well.
+  void SetSkipAttributeDecoding(GeometryAttribute::Type att_type);
+
   // Returns the options instance used by the decoder that can be used by users
   // to control the decoding process.
+  DecoderOptions *options() { return &options_; }
+  const DecoderOptions *options() const { return &options_; }
+
+ private:
+  DecoderOptions options_;
+};
+
+class CornerTable;
+class MeshDecoder;
+class PointCloudDecoder;
+
+// Decoder that is optimized for decoding of many (typically small) geometries
+// one after another. Unlike Decoder, BatchDecoder keeps the internal geometry
+// decoders alive between calls so that their buffers (corner tables, traversal
+// data, etc.) do not need to be reallocated for every decoded geometry.
+//
+// BatchDecoder is not thread-safe. Use one instance per thread.
+class BatchDecoder {
+ public:
+  BatchDecoder();
+  ~BatchDecoder();
+
+  // Same as the corresponding methods of Decoder.
+  StatusOr<std::unique_ptr<PointCloud>> DecodePointCloudFromBuffer(
+      DecoderBuffer *in_buffer);
+  StatusOr<std::unique_ptr<Mesh>> DecodeMeshFromBuffer(
+      DecoderBuffer *in_buffer);
+  StatusOr<std::unique_ptr<Mesh>> DecodeMeshToCompactIndices(
+      DecoderBuffer *in_buffer, std::vector<uint16_t> *out_indices);
+  Status DecodeBufferToGeometry(DecoderBuffer *in_buffer,
+                                PointCloud *out_geometry);
+  Status DecodeBufferToGeometry(DecoderBuffer *in_buffer, Mesh *out_geometry);
+
+  // Decodes |num_buffers| meshes stored in consecutive |in_buffers| and
+  // appends them to |out_meshes|. Decoding stops at the first invalid input,
+  // in which case an error is returned and |out_meshes| contains all meshes
+  // that were decoded before the error.
+  Status DecodeMeshesFromBuffers(DecoderBuffer *in_buffers, size_t num_buffers,
+                                 std::vector<std::unique_ptr<Mesh>> *out_meshes);
+
+  // See Decoder::SetSkipAttributeTransform().
+  void SetSkipAttributeTransform(GeometryAttribute::Type att_type);
+
+  // See Decoder::SetSkipAttributeDecoding().
+  void SetSkipAttributeDecoding(GeometryAttribute::Type att_type);
+
+  // See Decoder::SetDecodeToQuantizedAttribute().
+  void SetDecodeToQuantizedAttribute(GeometryAttribute::Type att_type);
+
   DecoderOptions *options() { return &options_; }
 
+  // Returns the corner table of the last successfully decoded mesh or nullptr
+  // when the decoder of the mesh does not create one. The faces of the table
+  // correspond to the faces of the decoded mesh, e.g. it can be passed to
+  // MeshStripifier::SetCornerTable(). The table is valid until the next call
+  // of any decoding method.
+  const CornerTable *GetLastMeshCornerTable() const;
+
  private:
   DecoderOptions options_;
+  // Decoder of the last successfully decoded mesh.
+  const MeshDecoder *last_mesh_decoder_ = nullptr;
+
+  // Cached decoders indexed by the encoding method.
+  std::vector<std::unique_ptr<MeshDecoder>> mesh_decoders_;
+  std::vector<std::unique_ptr<PointCloudDecoder>> point_cloud_decoders_;
 };
 
 }  // namespace draco
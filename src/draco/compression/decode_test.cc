@@ -14,14 +14,29 @@
 //
 #include "draco/compression/decode.h"
 
+#include <algorithm>
+#include <array>
 #include <cinttypes>
+#include <cmath>
+#include <functional>
+#include <future>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
+#include "draco/attributes/attribute_quantization_transform.h"
 #include "draco/compression/encode.h"
+#include "draco/core/cancellation_token.h"
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/core/memory_arena.h"
+#include "draco/core/thread_pool.h"
 #include "draco/io/file_utils.h"
 #include "draco/io/obj_encoder.h"
+#include "draco/mesh/mesh_are_equivalent.h"
+#include "draco/mesh/mesh_vertex_cache_optimizer.h"
+#include "draco/point_cloud/point_cloud_builder.h"
 
 namespace {
 
@@ -242,4 +257,814 @@ TEST_F(DecodeTest, TestSkipAttributeTransformUniqueId) {
             << std::endl;
 }
 
+// Checks that the attribute of |att_type| is decoded into identical data in
+// |pc| and |other_pc|.
+void CompareDecodedAttribute(const draco::PointCloud &pc,
+                             const draco::PointCloud &other_pc,
+                             draco::GeometryAttribute::Type att_type) {
+  ASSERT_EQ(pc.num_points(), other_pc.num_points());
+  const draco::PointAttribute *const att = pc.GetNamedAttribute(att_type);
+  const draco::PointAttribute *const other_att =
+      other_pc.GetNamedAttribute(att_type);
+  ASSERT_NE(att, nullptr);
+  ASSERT_NE(other_att, nullptr);
+  ASSERT_EQ(att->buffer()->data_size(), other_att->buffer()->data_size());
+  ASSERT_EQ(std::memcmp(att->buffer()->data(), other_att->buffer()->data(),
+                        att->buffer()->data_size()),
+            0);
+  for (draco::PointIndex pi(0); pi < pc.num_points(); ++pi) {
+    ASSERT_EQ(att->mapped_index(pi), other_att->mapped_index(pi));
+  }
+}
+
+// Decodes |data| while skipping the attributes of |skipped_types| and checks
+// that the attributes of |kept_types| match the full decoding of |data|.
+void TestSkipAttributeDecoding(
+    const std::vector<char> &data,
+    const std::vector<draco::GeometryAttribute::Type> &skipped_types,
+    const std::vector<draco::GeometryAttribute::Type> &kept_types) {
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::Decoder decoder;
+  std::unique_ptr<draco::PointCloud> pc =
+      decoder.DecodePointCloudFromBuffer(&buffer).value();
+  ASSERT_NE(pc, nullptr);
+
+  draco::Decoder skipping_decoder;
+  for (const draco::GeometryAttribute::Type att_type : skipped_types) {
+    skipping_decoder.SetSkipAttributeDecoding(att_type);
+  }
+  buffer.Init(data.data(), data.size());
+  std::unique_ptr<draco::PointCloud> skipped_pc =
+      skipping_decoder.DecodePointCloudFromBuffer(&buffer).value();
+  ASSERT_NE(skipped_pc, nullptr);
+  ASSERT_EQ(skipped_pc->num_attributes(), kept_types.size());
+  for (const draco::GeometryAttribute::Type att_type : kept_types) {
+    CompareDecodedAttribute(*pc, *skipped_pc, att_type);
+  }
+}
+
+TEST_F(DecodeTest, TestSkipAttributeDecoding) {
+  // Tests that skipped attributes are removed from the decoded geometry while
+  // the remaining attributes are decoded without changes.
+  auto src_mesh = draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(src_mesh, nullptr);
+  constexpr auto kPos = draco::GeometryAttribute::POSITION;
+  constexpr auto kNormal = draco::GeometryAttribute::NORMAL;
+  constexpr auto kTexCoord = draco::GeometryAttribute::TEX_COORD;
+  for (const int speed : {0, 5, 10}) {
+    draco::Encoder encoder;
+    encoder.SetSpeedOptions(speed, speed);
+    encoder.SetAttributeQuantization(kPos, 11);
+    encoder.SetAttributeQuantization(kNormal, 8);
+    encoder.SetAttributeQuantization(kTexCoord, 10);
+    draco::EncoderBuffer encoder_buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*src_mesh, &encoder_buffer));
+    const std::vector<char> data(
+        encoder_buffer.data(), encoder_buffer.data() + encoder_buffer.size());
+    TestSkipAttributeDecoding(data, {kNormal, kTexCoord}, {kPos});
+    TestSkipAttributeDecoding(data, {kNormal}, {kPos, kTexCoord});
+    TestSkipAttributeDecoding(data, {kTexCoord}, {kPos, kNormal});
+    // Positions are still decoded when other attributes are requested.
+    TestSkipAttributeDecoding(data, {kPos, kNormal}, {kPos, kTexCoord});
+  }
+
+  // Test also files encoded by older versions of the library.
+  for (const std::string file_name :
+       {"test_nm.obj.edgebreaker.cl4.2.2.drc",
+        "test_nm.obj.sequential.1.1.0.drc", "pc_color.drc"}) {
+    std::vector<char> data;
+    ASSERT_TRUE(
+        draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name), &data));
+    TestSkipAttributeDecoding(data, {kNormal, draco::GeometryAttribute::COLOR},
+                              {kPos});
+  }
+}
+
+// Probes |data| and checks the result against the full decoding of |data|.
+void TestProbeBuffer(const std::vector<char> &data) {
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::Decoder decoder;
+  const draco::EncodedGeometryInfo info = decoder.ProbeBuffer(&buffer).value();
+  // The buffer is not advanced.
+  ASSERT_EQ(buffer.decoded_size(), 0);
+
+  std::unique_ptr<draco::PointCloud> pc =
+      decoder.DecodePointCloudFromBuffer(&buffer).value();
+  ASSERT_NE(pc, nullptr);
+
+  // Decode the geometry also without attribute transforms to get the
+  // parameters of the quantized attributes.
+  draco::Decoder portable_decoder;
+  for (int i = 0; i < draco::GeometryAttribute::NAMED_ATTRIBUTES_COUNT; ++i) {
+    portable_decoder.SetSkipAttributeTransform(
+        static_cast<draco::GeometryAttribute::Type>(i));
+  }
+  buffer.Init(data.data(), data.size());
+  std::unique_ptr<draco::PointCloud> portable_pc =
+      portable_decoder.DecodePointCloudFromBuffer(&buffer).value();
+  ASSERT_NE(portable_pc, nullptr);
+  const draco::Mesh *const mesh = dynamic_cast<const draco::Mesh *>(pc.get());
+  ASSERT_EQ(info.geometry_type,
+            mesh ? draco::TRIANGULAR_MESH : draco::POINT_CLOUD);
+  ASSERT_EQ(info.num_faces, mesh ? mesh->num_faces() : 0);
+  ASSERT_EQ(info.num_points, pc->num_points());
+  ASSERT_EQ(info.attributes.size(), pc->num_attributes());
+  for (int i = 0; i < pc->num_attributes(); ++i) {
+    const draco::EncodedAttributeInfo &att_info = info.attributes[i];
+    const draco::PointAttribute *const att = pc->attribute(i);
+    ASSERT_EQ(att_info.attribute_type, att->attribute_type());
+    ASSERT_EQ(att_info.data_type, att->data_type());
+    ASSERT_EQ(att_info.num_components, att->num_components());
+    ASSERT_EQ(att_info.normalized, att->normalized());
+    ASSERT_EQ(att_info.unique_id, att->unique_id());
+    draco::AttributeQuantizationTransform transform;
+    if (transform.InitFromAttribute(*portable_pc->attribute(i))) {
+      ASSERT_EQ(att_info.quantization_bits, transform.quantization_bits());
+      ASSERT_EQ(att_info.min_values, transform.min_values());
+      ASSERT_EQ(att_info.range, transform.range());
+    } else {
+      ASSERT_TRUE(att_info.min_values.empty());
+    }
+  }
+}
+
+TEST_F(DecodeTest, TestProbeBuffer) {
+  // Tests that the probed sizes and attribute layout match the decoded
+  // geometry.
+  auto src_mesh = draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(src_mesh, nullptr);
+  for (const int speed : {0, 10}) {
+    draco::Encoder encoder;
+    encoder.SetSpeedOptions(speed, speed);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 8);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 10);
+    draco::EncoderBuffer encoder_buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*src_mesh, &encoder_buffer));
+    TestProbeBuffer(std::vector<char>(
+        encoder_buffer.data(), encoder_buffer.data() + encoder_buffer.size()));
+
+    // Probe also a mesh with raw face indices and attribute values.
+    draco::Encoder raw_encoder;
+    raw_encoder.SetSpeedOptions(speed, speed);
+    raw_encoder.SetEncodingMethod(draco::MESH_SEQUENTIAL_ENCODING);
+    encoder_buffer.Clear();
+    DRACO_ASSERT_OK(raw_encoder.EncodeMeshToBuffer(*src_mesh, &encoder_buffer));
+    TestProbeBuffer(std::vector<char>(
+        encoder_buffer.data(), encoder_buffer.data() + encoder_buffer.size()));
+  }
+
+  for (const std::string file_name :
+       {"test_nm.obj.edgebreaker.cl4.2.2.drc",
+        "test_nm.obj.sequential.1.1.0.drc", "pc_color.drc", "pc_kd_color.drc",
+        "car.drc"}) {
+    std::vector<char> data;
+    ASSERT_TRUE(
+        draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name), &data));
+    TestProbeBuffer(data);
+  }
+
+  // Probing of invalid data fails.
+  const std::string invalid_data = "DRACO invalid";
+  draco::DecoderBuffer buffer;
+  buffer.Init(invalid_data.data(), invalid_data.size());
+  draco::Decoder decoder;
+  ASSERT_FALSE(decoder.ProbeBuffer(&buffer).ok());
+}
+
+TEST_F(DecodeTest, TestMemoryLimit) {
+  // Tests that decoding fails when the estimated memory exceeds the limit.
+  auto src_mesh = draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(src_mesh, nullptr);
+  for (const int speed : {5, 10}) {
+    draco::Encoder encoder;
+    encoder.SetSpeedOptions(speed, speed);
+    draco::EncoderBuffer encoder_buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*src_mesh, &encoder_buffer));
+
+    draco::DecoderBuffer buffer;
+    buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+    draco::Decoder decoder;
+    const draco::EncodedGeometryInfo info =
+        decoder.ProbeBuffer(&buffer).value();
+    const int estimated_memory_mb =
+        static_cast<int>(info.estimated_memory_usage >> 20);
+    ASSERT_GT(estimated_memory_mb, 0);
+
+    decoder.options()->SetGlobalInt("memory_limit_mb", estimated_memory_mb);
+    const auto status_or = decoder.DecodeMeshFromBuffer(&buffer);
+    ASSERT_FALSE(status_or.ok());
+    ASSERT_EQ(status_or.status().error_msg_string(), "Memory limit exceeded.");
+    // Probing is limited as well.
+    buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+    ASSERT_FALSE(decoder.ProbeBuffer(&buffer).ok());
+
+    decoder.options()->SetGlobalInt("memory_limit_mb",
+                                    estimated_memory_mb + 1);
+    buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+    DRACO_ASSERT_OK(decoder.DecodeMeshFromBuffer(&buffer).status());
+  }
+}
+
+TEST_F(DecodeTest, TestWorkLimit) {
+  // Tests that decoding fails when the work exceeds the limit.
+  auto src_mesh = draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(src_mesh, nullptr);
+  std::vector<draco::EncoderBuffer> encoded(3);
+  for (const int speed : {5, 10}) {
+    draco::Encoder encoder;
+    encoder.SetSpeedOptions(speed, speed);
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(
+        *src_mesh, &encoded[speed == 5 ? 0 : 1]));
+  }
+  // Point cloud encoded with the kd-tree attributes encoder.
+  draco::Encoder encoder;
+  encoder.SetSpeedOptions(0, 0);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 12);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 8);
+  encoder.SetEncodingMethod(draco::POINT_CLOUD_KD_TREE_ENCODING);
+  DRACO_ASSERT_OK(encoder.EncodePointCloudToBuffer(*src_mesh, &encoded[2]));
+
+  for (const draco::EncoderBuffer &encoder_buffer : encoded) {
+    draco::DecoderBuffer buffer;
+    buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+    draco::Decoder decoder;
+    decoder.options()->SetGlobalInt("work_limit_kops", 10);
+    const auto status_or = decoder.DecodePointCloudFromBuffer(&buffer);
+    ASSERT_FALSE(status_or.ok());
+    ASSERT_EQ(status_or.status().error_msg_string(), "Work limit exceeded.");
+
+    // Decoding within the limits succeeds.
+    decoder.options()->SetGlobalInt("work_limit_kops", 10000);
+    decoder.options()->SetGlobalInt("time_limit_ms", 60000);
+    buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+    DRACO_ASSERT_OK(decoder.DecodePointCloudFromBuffer(&buffer).status());
+  }
+}
+
+// Decodes |data| with quantized output of |att_type| and checks that the
+// dequantized values match the regular decoding. |expected_data_type| is the
+// expected data type of the quantized values.
+void TestDecodeToQuantizedAttribute(const std::vector<char> &data,
+                                    draco::GeometryAttribute::Type att_type,
+                                    draco::DataType expected_data_type) {
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::Decoder decoder;
+  std::unique_ptr<draco::PointCloud> pc =
+      decoder.DecodePointCloudFromBuffer(&buffer).value();
+  ASSERT_NE(pc, nullptr);
+
+  draco::Decoder quantized_decoder;
+  quantized_decoder.SetDecodeToQuantizedAttribute(att_type);
+  buffer.Init(data.data(), data.size());
+  std::unique_ptr<draco::PointCloud> quantized_pc =
+      quantized_decoder.DecodePointCloudFromBuffer(&buffer).value();
+  ASSERT_NE(quantized_pc, nullptr);
+
+  const draco::PointAttribute *const att = pc->GetNamedAttribute(att_type);
+  const draco::PointAttribute *const quantized_att =
+      quantized_pc->GetNamedAttribute(att_type);
+  ASSERT_NE(att, nullptr);
+  ASSERT_NE(quantized_att, nullptr);
+  ASSERT_EQ(quantized_att->data_type(), expected_data_type);
+  ASSERT_EQ(quantized_att->unique_id(), att->unique_id());
+  if (expected_data_type == draco::DT_FLOAT32) {
+    return;
+  }
+  draco::AttributeQuantizationTransform transform;
+  ASSERT_TRUE(transform.InitFromAttribute(*quantized_att));
+  const float scale = transform.ComputeDequantizationScale();
+  const int num_components = att->num_components();
+  std::vector<float> value(num_components);
+  std::vector<uint32_t> quantized_value(num_components);
+  for (draco::PointIndex pi(0); pi < pc->num_points(); ++pi) {
+    ASSERT_TRUE(att->ConvertValue<float>(att->mapped_index(pi), num_components,
+                                         value.data()));
+    ASSERT_TRUE(quantized_att->ConvertValue<uint32_t>(
+        quantized_att->mapped_index(pi), num_components,
+        quantized_value.data()));
+    for (int c = 0; c < num_components; ++c) {
+      ASSERT_NEAR(transform.min_value(c) + quantized_value[c] * scale,
+                  value[c], 1e-6f * std::max(1.f, std::fabs(value[c])));
+    }
+  }
+}
+
+TEST_F(DecodeTest, TestDecodeToQuantizedAttribute) {
+  // Tests that quantized attributes can be decoded to compact integer values.
+  auto src_mesh = draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(src_mesh, nullptr);
+  constexpr auto kPos = draco::GeometryAttribute::POSITION;
+  constexpr auto kNormal = draco::GeometryAttribute::NORMAL;
+  constexpr auto kTexCoord = draco::GeometryAttribute::TEX_COORD;
+  for (const int speed : {0, 10}) {
+    draco::Encoder encoder;
+    encoder.SetSpeedOptions(speed, speed);
+    encoder.SetAttributeQuantization(kPos, 14);
+    encoder.SetAttributeQuantization(kNormal, 8);
+    encoder.SetAttributeQuantization(kTexCoord, 7);
+    draco::EncoderBuffer encoder_buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*src_mesh, &encoder_buffer));
+    const std::vector<char> data(
+        encoder_buffer.data(), encoder_buffer.data() + encoder_buffer.size());
+    TestDecodeToQuantizedAttribute(data, kPos, draco::DT_UINT16);
+    TestDecodeToQuantizedAttribute(data, kTexCoord, draco::DT_UINT8);
+    // Normals are not quantized by AttributeQuantizationTransform.
+    TestDecodeToQuantizedAttribute(data, kNormal, draco::DT_FLOAT32);
+
+    // Attributes with more than 16 quantization bits are dequantized.
+    encoder.SetAttributeQuantization(kPos, 20);
+    encoder_buffer.Clear();
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*src_mesh, &encoder_buffer));
+    TestDecodeToQuantizedAttribute(
+        std::vector<char>(encoder_buffer.data(),
+                          encoder_buffer.data() + encoder_buffer.size()),
+        kPos, draco::DT_FLOAT32);
+  }
+
+  // Test also a kd-tree encoded point cloud.
+  auto pc = draco::ReadPointCloudFromTestFile("cube_att.obj");
+  ASSERT_NE(pc, nullptr);
+  draco::Encoder encoder;
+  encoder.SetEncodingMethod(draco::POINT_CLOUD_KD_TREE_ENCODING);
+  encoder.SetAttributeQuantization(kPos, 12);
+  encoder.SetAttributeQuantization(kNormal, 8);
+  encoder.SetAttributeQuantization(kTexCoord, 10);
+  draco::EncoderBuffer encoder_buffer;
+  DRACO_ASSERT_OK(encoder.EncodePointCloudToBuffer(*pc, &encoder_buffer));
+  TestDecodeToQuantizedAttribute(
+      std::vector<char>(encoder_buffer.data(),
+                        encoder_buffer.data() + encoder_buffer.size()),
+      kPos, draco::DT_UINT16);
+}
+
+// Checks that the decoded attribute data of |pc| and |other_pc| are
+// byte-identical.
+void CompareDecodedGeometry(const draco::PointCloud &pc,
+                            const draco::PointCloud &other_pc) {
+  ASSERT_EQ(pc.num_points(), other_pc.num_points());
+  ASSERT_EQ(pc.num_attributes(), other_pc.num_attributes());
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    const draco::PointAttribute *const att = pc.attribute(i);
+    const draco::PointAttribute *const other_att = other_pc.attribute(i);
+    ASSERT_EQ(att->size(), other_att->size());
+    ASSERT_EQ(att->buffer()->data_size(), other_att->buffer()->data_size());
+    ASSERT_EQ(std::memcmp(att->buffer()->data(), other_att->buffer()->data(),
+                          att->buffer()->data_size()),
+              0);
+    for (draco::PointIndex pi(0); pi < pc.num_points(); ++pi) {
+      ASSERT_EQ(att->mapped_index(pi), other_att->mapped_index(pi));
+    }
+  }
+}
+
+// Decodes |data| with and without a thread pool and checks that the decoded
+// attribute data is byte-identical.
+void TestDecodeWithThreadPool(const std::vector<char> &data) {
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::Decoder decoder;
+  std::unique_ptr<draco::PointCloud> pc =
+      decoder.DecodePointCloudFromBuffer(&buffer).value();
+  ASSERT_NE(pc, nullptr);
+
+  draco::ThreadPool pool(3);
+  draco::Decoder parallel_decoder;
+  parallel_decoder.options()->SetThreadPool(&pool);
+  buffer.Init(data.data(), data.size());
+  std::unique_ptr<draco::PointCloud> parallel_pc =
+      parallel_decoder.DecodePointCloudFromBuffer(&buffer).value();
+  ASSERT_NE(parallel_pc, nullptr);
+  CompareDecodedGeometry(*pc, *parallel_pc);
+}
+
+TEST_F(DecodeTest, TestDecodeWithThreadPool) {
+  // Tests that decoding with a thread pool produces the same output as the
+  // serial decoding.
+  for (const std::string file_name : {"pc_color.drc", "pc_kd_color.drc",
+                                      "car.drc", "cube_att.drc"}) {
+    std::vector<char> data;
+    ASSERT_TRUE(
+        draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name), &data));
+    TestDecodeWithThreadPool(data);
+  }
+
+  // Test also a freshly encoded mesh with multiple quantized attributes.
+  auto src_mesh = draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(src_mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 8);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 10);
+  draco::EncoderBuffer encoder_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*src_mesh, &encoder_buffer));
+  TestDecodeWithThreadPool(std::vector<char>(
+      encoder_buffer.data(), encoder_buffer.data() + encoder_buffer.size()));
+
+  // Test a mesh with enough quantized values to be dequantized in multiple
+  // chunks.
+  src_mesh = draco::ReadMeshFromTestFile("bun_zipper.ply");
+  ASSERT_NE(src_mesh, nullptr);
+  encoder_buffer.Clear();
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*src_mesh, &encoder_buffer));
+  TestDecodeWithThreadPool(std::vector<char>(
+      encoder_buffer.data(), encoder_buffer.data() + encoder_buffer.size()));
+
+  // Test a point cloud with enough normals and signed integer values to be
+  // transformed in multiple chunks by both the sequential and the kD-tree
+  // decoders.
+  constexpr int kNumPoints = 70000;
+  draco::PointCloudBuilder builder;
+  builder.Start(kNumPoints);
+  const int pos_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32);
+  const int normal_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::NORMAL, 3, draco::DT_FLOAT32);
+  const int generic_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::GENERIC, 2, draco::DT_INT16);
+  for (draco::PointIndex i(0); i < kNumPoints; ++i) {
+    const float angle = 0.001f * i.value();
+    const std::array<float, 3> pos = {std::cos(angle), std::sin(angle),
+                                      0.0001f * i.value()};
+    const std::array<float, 3> normal = {std::cos(angle), std::sin(angle),
+                                         0.f};
+    const std::array<int16_t, 2> generic = {
+        static_cast<int16_t>(i.value() % 1000 - 500),
+        static_cast<int16_t>(-(i.value() % 77))};
+    builder.SetAttributeValueForPoint(pos_att_id, i, pos.data());
+    builder.SetAttributeValueForPoint(normal_att_id, i, normal.data());
+    builder.SetAttributeValueForPoint(generic_att_id, i, generic.data());
+  }
+  const std::unique_ptr<draco::PointCloud> pc = builder.Finalize(false);
+  ASSERT_NE(pc, nullptr);
+  for (const int method : {draco::POINT_CLOUD_SEQUENTIAL_ENCODING,
+                           draco::POINT_CLOUD_KD_TREE_ENCODING}) {
+    draco::Encoder pc_encoder;
+    pc_encoder.SetEncodingMethod(method);
+    pc_encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION,
+                                        14);
+    pc_encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 10);
+    encoder_buffer.Clear();
+    DRACO_ASSERT_OK(pc_encoder.EncodePointCloudToBuffer(*pc, &encoder_buffer));
+    TestDecodeWithThreadPool(std::vector<char>(
+        encoder_buffer.data(), encoder_buffer.data() + encoder_buffer.size()));
+  }
+}
+
+TEST_F(DecodeTest, TestDecodeMeshAsync) {
+  // Tests that meshes decoded asynchronously on a thread pool are the same as
+  // meshes decoded synchronously.
+  std::vector<char> data;
+  ASSERT_TRUE(
+      draco::ReadFileToBuffer(draco::GetTestFileFullPath("car.drc"), &data));
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::Decoder decoder;
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::Mesh> mesh,
+                         decoder.DecodeMeshFromBuffer(&buffer));
+
+  draco::ThreadPool pool(3);
+  decoder.options()->SetThreadPool(&pool);
+  std::vector<std::promise<std::unique_ptr<draco::Mesh>>> promises(8);
+  for (int i = 0; i < promises.size(); ++i) {
+    buffer.Init(data.data(), data.size());
+    std::promise<std::unique_ptr<draco::Mesh>> *const promise = &promises[i];
+    decoder.DecodeMeshAsync(
+        &buffer, i, [promise](draco::StatusOr<std::unique_ptr<draco::Mesh>> r) {
+          promise->set_value(r.ok() ? std::move(r).value() : nullptr);
+        });
+  }
+  draco::MeshAreEquivalent eq;
+  for (int i = 0; i < promises.size(); ++i) {
+    const std::unique_ptr<draco::Mesh> async_mesh =
+        promises[i].get_future().get();
+    ASSERT_NE(async_mesh, nullptr);
+    ASSERT_TRUE(eq(*mesh, *async_mesh));
+  }
+}
+
+TEST_F(DecodeTest, TestSharedConstDecoder) {
+  // Tests that a single configured decoder can be used by many threads at once
+  // through a const reference.
+  std::vector<char> data;
+  ASSERT_TRUE(
+      draco::ReadFileToBuffer(draco::GetTestFileFullPath("car.drc"), &data));
+  draco::Decoder configured_decoder;
+  configured_decoder.options()->SetGlobalBool("use_packed_corner_table", true);
+  const draco::Decoder &decoder = configured_decoder;
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::Mesh> mesh,
+                         decoder.DecodeMeshFromBuffer(&buffer));
+
+  draco::ThreadPool pool(4);
+  std::vector<std::unique_ptr<draco::Mesh>> meshes(16);
+  pool.ParallelFor(meshes.size(), [&](int i) {
+    draco::DecoderBuffer thread_buffer;
+    thread_buffer.Init(data.data(), data.size());
+    auto status_or_mesh = decoder.DecodeMeshFromBuffer(&thread_buffer);
+    if (status_or_mesh.ok()) {
+      meshes[i] = std::move(status_or_mesh).value();
+    }
+  });
+  draco::MeshAreEquivalent eq;
+  for (const std::unique_ptr<draco::Mesh> &shared_mesh : meshes) {
+    ASSERT_NE(shared_mesh, nullptr);
+    ASSERT_TRUE(eq(*mesh, *shared_mesh));
+  }
+}
+
+// Executor that stores all tasks until they are run by RunTasks().
+class DeferredExecutor : public draco::TaskExecutor {
+ public:
+  int concurrency() const override { return 1; }
+  void Execute(std::function<void()> task) override {
+    tasks_.push_back(std::move(task));
+  }
+  void RunTasks() {
+    // Tasks may schedule more tasks.
+    for (size_t i = 0; i < tasks_.size(); ++i) {
+      std::function<void()> task = std::move(tasks_[i]);
+      task();
+    }
+    tasks_.clear();
+  }
+
+ private:
+  std::vector<std::function<void()>> tasks_;
+};
+
+TEST_F(DecodeTest, TestDecodeMeshAsyncPriorityAndCancellation) {
+  // Tests that pending asynchronous decodes start in order of their priority
+  // and that cancelled decodes do not produce a mesh.
+  std::vector<char> data;
+  ASSERT_TRUE(
+      draco::ReadFileToBuffer(draco::GetTestFileFullPath("car.drc"), &data));
+  DeferredExecutor executor;
+  draco::ThreadPool pool(&executor);
+  draco::CancellationToken token;
+  draco::Decoder decoder;
+  decoder.options()->SetThreadPool(&pool);
+  draco::Decoder cancelled_decoder;
+  cancelled_decoder.options()->SetThreadPool(&pool);
+  cancelled_decoder.options()->SetCancellationToken(&token);
+
+  std::vector<std::string> results;
+  const auto add_result = [&results](const std::string &name) {
+    return [&results, name](draco::StatusOr<std::unique_ptr<draco::Mesh>> r) {
+      results.push_back(name + (r.ok() ? "" : " cancelled"));
+    };
+  };
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  decoder.DecodeMeshAsync(&buffer, add_result("low"));
+  decoder.DecodeMeshAsync(&buffer, 2, add_result("high"));
+  decoder.DecodeMeshAsync(&buffer, 1, add_result("medium"));
+  cancelled_decoder.DecodeMeshAsync(&buffer, 1, add_result("tile"));
+  token.Cancel();
+  executor.RunTasks();
+#ifdef DRACO_THREADING_SUPPORTED
+  ASSERT_EQ(results, std::vector<std::string>(
+                         {"high", "medium", "tile cancelled", "low"}));
+#else
+  // Without threading, all decodes run immediately.
+  ASSERT_EQ(results, std::vector<std::string>(
+                         {"low", "high", "medium", "tile"}));
+#endif
+
+  // Synchronous decoding stops as well.
+  ASSERT_FALSE(cancelled_decoder.DecodeMeshFromBuffer(&buffer).ok());
+}
+
+TEST_F(DecodeTest, TestOptimizeVertexCache) {
+  // Tests that the "optimize_vertex_cache" option reorders the decoded mesh
+  // without changing its geometry.
+  auto src_mesh = draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(src_mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetSpeedOptions(10, 10);
+  draco::EncoderBuffer encoder_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*src_mesh, &encoder_buffer));
+
+  draco::DecoderBuffer buffer;
+  buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+  draco::Decoder decoder;
+  std::unique_ptr<draco::Mesh> mesh =
+      decoder.DecodeMeshFromBuffer(&buffer).value();
+  ASSERT_NE(mesh, nullptr);
+
+  buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+  draco::Decoder optimizing_decoder;
+  optimizing_decoder.options()->SetGlobalBool("optimize_vertex_cache", true);
+  std::unique_ptr<draco::Mesh> optimized_mesh =
+      optimizing_decoder.DecodeMeshFromBuffer(&buffer).value();
+  ASSERT_NE(optimized_mesh, nullptr);
+
+  draco::MeshAreEquivalent equiv;
+  ASSERT_TRUE(equiv(*mesh, *optimized_mesh));
+  const int cache_size = draco::MeshVertexCacheOptimizer::kDefaultCacheSize;
+  ASSERT_LT(draco::MeshVertexCacheOptimizer::ComputeAverageCacheMissRatio(
+                *optimized_mesh, cache_size),
+            draco::MeshVertexCacheOptimizer::ComputeAverageCacheMissRatio(
+                *mesh, cache_size));
+}
+
+TEST_F(DecodeTest, TestBatchDecoder) {
+  // Tests that BatchDecoder produces the same output as Decoder when it is
+  // reused for decoding of many meshes encoded with different methods.
+  const std::vector<std::string> file_names = {
+      "cube_att.drc",
+      "car.drc",
+      "cube_att.obj.edgebreaker.cl10.2.2.drc",
+      "cube_att.obj.edgebreaker.cl4.2.2.drc",
+      "cube_att.obj.sequential.cl3.2.2.drc",
+      "bunny_gltf.drc",
+      "cube_att.drc"};
+  std::vector<std::vector<char>> data(file_names.size());
+  std::vector<draco::DecoderBuffer> buffers(file_names.size());
+  for (int i = 0; i < file_names.size(); ++i) {
+    ASSERT_TRUE(draco::ReadFileToBuffer(
+        draco::GetTestFileFullPath(file_names[i]), &data[i]));
+    buffers[i].Init(data[i].data(), data[i].size());
+  }
+
+  draco::BatchDecoder batch_decoder;
+  std::vector<std::unique_ptr<draco::Mesh>> meshes;
+  DRACO_ASSERT_OK(batch_decoder.DecodeMeshesFromBuffers(
+      buffers.data(), buffers.size(), &meshes));
+  ASSERT_EQ(meshes.size(), file_names.size());
+
+  for (int i = 0; i < file_names.size(); ++i) {
+    draco::DecoderBuffer buffer;
+    buffer.Init(data[i].data(), data[i].size());
+    draco::Decoder decoder;
+    std::unique_ptr<draco::Mesh> mesh =
+        decoder.DecodeMeshFromBuffer(&buffer).value();
+    ASSERT_NE(mesh, nullptr);
+    ASSERT_EQ(mesh->num_faces(), meshes[i]->num_faces());
+    for (draco::FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+      ASSERT_EQ(mesh->face(fi), meshes[i]->face(fi));
+    }
+    CompareDecodedGeometry(*mesh, *meshes[i]);
+  }
+
+  // Point clouds can be decoded with the same instance.
+  for (const std::string file_name : {"pc_kd_color.drc", "pc_color.drc",
+                                      "pc_kd_color.drc"}) {
+    std::vector<char> pc_data;
+    ASSERT_TRUE(draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name),
+                                        &pc_data));
+    draco::DecoderBuffer buffer;
+    buffer.Init(pc_data.data(), pc_data.size());
+    std::unique_ptr<draco::PointCloud> batch_pc =
+        batch_decoder.DecodePointCloudFromBuffer(&buffer).value();
+    ASSERT_NE(batch_pc, nullptr);
+    buffer.Init(pc_data.data(), pc_data.size());
+    draco::Decoder decoder;
+    std::unique_ptr<draco::PointCloud> pc =
+        decoder.DecodePointCloudFromBuffer(&buffer).value();
+    CompareDecodedGeometry(*pc, *batch_pc);
+  }
+}
+
+TEST_F(DecodeTest, TestBatchDecoderPackedCornerTable) {
+  // Tests that a reused BatchDecoder builds the packed corner table of each
+  // decoded mesh instead of reusing the table of the previous mesh.
+  const std::vector<std::string> file_names = {
+      "car.drc", "cube_att.obj.edgebreaker.cl10.2.2.drc", "bunny_gltf.drc",
+      "car.drc"};
+  draco::BatchDecoder batch_decoder;
+  batch_decoder.options()->SetGlobalBool("use_packed_corner_table", true);
+  for (const std::string &file_name : file_names) {
+    std::vector<char> data;
+    ASSERT_TRUE(
+        draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name), &data));
+    draco::DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    draco::Decoder decoder;
+    std::unique_ptr<draco::Mesh> mesh =
+        decoder.DecodeMeshFromBuffer(&buffer).value();
+    ASSERT_NE(mesh, nullptr);
+
+    buffer.Init(data.data(), data.size());
+    std::unique_ptr<draco::Mesh> batch_mesh =
+        batch_decoder.DecodeMeshFromBuffer(&buffer).value();
+    ASSERT_NE(batch_mesh, nullptr);
+    ASSERT_EQ(mesh->num_faces(), batch_mesh->num_faces());
+    for (draco::FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+      ASSERT_EQ(mesh->face(fi), batch_mesh->face(fi));
+    }
+    CompareDecodedGeometry(*mesh, *batch_mesh);
+  }
+}
+
+TEST_F(DecodeTest, TestDecodeMeshToCompactIndices) {
+  // Tests that faces of small meshes are decoded to 16-bit indices.
+  for (const std::string file_name :
+       {"cube_att.obj.edgebreaker.cl10.2.2.drc", "car.drc"}) {
+    std::vector<char> data;
+    ASSERT_TRUE(
+        draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name), &data));
+    draco::DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    draco::Decoder decoder;
+    std::unique_ptr<draco::Mesh> mesh =
+        decoder.DecodeMeshFromBuffer(&buffer).value();
+    ASSERT_NE(mesh, nullptr);
+    ASSERT_LE(mesh->num_points(), 1 << 16);
+
+    buffer.Init(data.data(), data.size());
+    draco::BatchDecoder batch_decoder;
+    std::vector<uint16_t> indices;
+    std::unique_ptr<draco::Mesh> compact_mesh =
+        batch_decoder.DecodeMeshToCompactIndices(&buffer, &indices).value();
+    ASSERT_NE(compact_mesh, nullptr);
+    ASSERT_EQ(compact_mesh->num_faces(), 0);
+    ASSERT_EQ(compact_mesh->num_points(), mesh->num_points());
+    ASSERT_EQ(indices.size(), 3 * mesh->num_faces());
+    for (draco::FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+      for (int c = 0; c < 3; ++c) {
+        ASSERT_EQ(indices[3 * fi.value() + c], mesh->face(fi)[c].value());
+      }
+    }
+    CompareDecodedGeometry(*mesh, *compact_mesh);
+  }
+}
+
+TEST_F(DecodeTest, TestDecodeIntoReusedMesh) {
+  // Tests that decoding into a mesh that was already decoded before reuses
+  // its attributes and their storage when the layout matches, and that the
+  // result is the same as when decoding into a new mesh.
+  std::vector<char> data;
+  ASSERT_TRUE(
+      draco::ReadFileToBuffer(draco::GetTestFileFullPath("car.drc"), &data));
+  draco::Decoder decoder;
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::Mesh> expected_mesh,
+                         decoder.DecodeMeshFromBuffer(&buffer));
+
+  draco::Mesh mesh;
+  buffer.Init(data.data(), data.size());
+  DRACO_ASSERT_OK(decoder.DecodeBufferToGeometry(&buffer, &mesh));
+  std::vector<const draco::PointAttribute *> attributes;
+  std::vector<const uint8_t *> attribute_data;
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    attributes.push_back(mesh.attribute(i));
+    attribute_data.push_back(mesh.attribute(i)->buffer()->data());
+  }
+  buffer.Init(data.data(), data.size());
+  DRACO_ASSERT_OK(decoder.DecodeBufferToGeometry(&buffer, &mesh));
+  ASSERT_EQ(mesh.num_attributes(), attributes.size());
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    ASSERT_EQ(mesh.attribute(i), attributes[i]);
+    ASSERT_EQ(mesh.attribute(i)->buffer()->data(), attribute_data[i]);
+  }
+  draco::MeshAreEquivalent eq;
+  ASSERT_TRUE(eq(*expected_mesh, mesh));
+
+  // Decode a mesh with a different layout into the same mesh.
+  std::vector<char> other_data;
+  ASSERT_TRUE(draco::ReadFileToBuffer(
+      draco::GetTestFileFullPath("cube_att.drc"), &other_data));
+  buffer.Init(other_data.data(), other_data.size());
+  DRACO_ASSIGN_OR_ASSERT(expected_mesh, decoder.DecodeMeshFromBuffer(&buffer));
+  buffer.Init(other_data.data(), other_data.size());
+  DRACO_ASSERT_OK(decoder.DecodeBufferToGeometry(&buffer, &mesh));
+  ASSERT_TRUE(eq(*expected_mesh, mesh));
+}
+
+TEST_F(DecodeTest, TestDecodeWithMemoryArena) {
+  // Tests that attribute storage of decoded geometry can be allocated from a
+  // memory arena and that the decoded data is not affected by it.
+  for (const std::string file_name :
+       {"car.drc", "cube_att.obj.edgebreaker.cl10.2.2.drc", "pc_kd_color.drc"}) {
+    std::vector<char> data;
+    ASSERT_TRUE(
+        draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name), &data));
+    draco::DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    draco::Decoder decoder;
+    std::unique_ptr<draco::PointCloud> pc =
+        decoder.DecodePointCloudFromBuffer(&buffer).value();
+    ASSERT_NE(pc, nullptr);
+
+    draco::MemoryArena arena;
+    buffer.Init(data.data(), data.size());
+    draco::Decoder arena_decoder;
+    arena_decoder.options()->SetMemoryArena(&arena);
+    std::unique_ptr<draco::PointCloud> arena_pc =
+        arena_decoder.DecodePointCloudFromBuffer(&buffer).value();
+    ASSERT_NE(arena_pc, nullptr);
+    CompareDecodedGeometry(*pc, *arena_pc);
+    for (int i = 0; i < arena_pc->num_attributes(); ++i) {
+      ASSERT_EQ(arena_pc->attribute(i)->buffer()->memory_arena(), &arena);
+    }
+    ASSERT_GT(arena.bytes_allocated(), 0);
+  }
+}
+
 }  // namespace
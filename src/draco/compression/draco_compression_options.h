@@ -68,7 +68,6 @@ class SpatialQuantizationOptions {
   float spacing_ = 0.f;
 };
 
-// TODO(fgalligan): Add support for unified_position_quantization.
 // Struct to hold Draco compression options.
 struct DracoCompressionOptions {
   int compression_level = 7;  // compression level [0-10], most=10, least=0.
@@ -81,6 +80,15 @@ struct DracoCompressionOptions {
   int quantization_bits_weight = 8;
   bool find_non_degenerate_texture_quantization = false;
 
+  // When compressing a scene, quantize the positions of all meshes that have
+  // the same compression options and the same transform to the scene with one
+  // shared set of quantization parameters that covers all of the meshes,
+  // instead of parameters computed per mesh. The quantized positions of such
+  // meshes are then directly comparable, e.g., tiles can be merged in the
+  // quantized domain and their shared borders are quantized to the same
+  // values. Applies to both the quantization bits and the grid mode.
+  bool unified_position_quantization = false;
+
   bool operator==(const DracoCompressionOptions &other) const {
     return compression_level == other.compression_level &&
            quantization_position == other.quantization_position &&
@@ -91,7 +99,9 @@ struct DracoCompressionOptions {
            quantization_bits_tangent == other.quantization_bits_tangent &&
            quantization_bits_weight == other.quantization_bits_weight &&
            find_non_degenerate_texture_quantization ==
-               other.find_non_degenerate_texture_quantization;
+               other.find_non_degenerate_texture_quantization &&
+           unified_position_quantization ==
+               other.unified_position_quantization;
   }
 
   bool operator!=(const DracoCompressionOptions &other) const {
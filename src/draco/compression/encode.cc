@@ -36,10 +36,22 @@ Status Encoder::EncodeMeshToBuffer(const Mesh &m, EncoderBuffer *out_buffer) {
   return OkStatus();
 }
 
+Status Encoder::EncodeGeometrySourceToBuffer(const GeometrySource &source,
+                                             EncoderBuffer *out_buffer) {
+  if (source.num_faces() > 0) {
+    DRACO_ASSIGN_OR_RETURN(std::unique_ptr<Mesh> mesh, source.CreateMesh());
+    return EncodeMeshToBuffer(*mesh, out_buffer);
+  }
+  DRACO_ASSIGN_OR_RETURN(std::unique_ptr<PointCloud> pc,
+                         source.CreatePointCloud());
+  return EncodePointCloudToBuffer(*pc, out_buffer);
+}
+
 EncoderOptions Encoder::CreateExpertEncoderOptions(const PointCloud &pc) const {
   EncoderOptions ret_options = EncoderOptions::CreateEmptyOptions();
   ret_options.SetGlobalOptions(options().GetGlobalOptions());
   ret_options.SetFeatureOptions(options().GetFeaturelOptions());
+  ret_options.SetThreadPool(options().thread_pool());
   // Convert type-based attribute options to specific attributes in the provided
   // point cloud.
   for (int i = 0; i < pc.num_attributes(); ++i) {
@@ -78,6 +90,30 @@ void Encoder::SetAttributeExplicitQuantization(GeometryAttribute::Type type,
   options().SetAttributeFloat(type, "quantization_range", range);
 }
 
+void Encoder::SetAttributeMaxQuantizationError(GeometryAttribute::Type type,
+                                               float max_error) {
+  options().SetAttributeFloat(type, "max_quantization_error", max_error);
+}
+
+void Encoder::SetAttributeMaxTexelQuantizationError(
+    GeometryAttribute::Type type, float max_texel_error, int texture_width,
+    int texture_height) {
+  const int texture_size[2] = {texture_width, texture_height};
+  options().SetAttributeFloat(type, "max_quantization_error", max_texel_error);
+  options().SetAttributeVector(type, "max_quantization_error_texture_size", 2,
+                               texture_size);
+}
+
+void Encoder::SetAttributeLosslessFloatCoding(GeometryAttribute::Type type,
+                                              bool enabled) {
+  options().SetAttributeBool(type, "lossless_float_coding", enabled);
+}
+
+void Encoder::SetAttributeYCoCgTransform(GeometryAttribute::Type type,
+                                         bool enabled) {
+  options().SetAttributeBool(type, "ycocg_transform", enabled);
+}
+
 void Encoder::SetEncodingMethod(int encoding_method) {
   Base::SetEncodingMethod(encoding_method);
 }
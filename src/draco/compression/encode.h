@@ -18,6 +18,7 @@
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/config/encoder_options.h"
 #include "draco/compression/encode_base.h"
+#include "draco/compression/geometry_source.h"
 #include "draco/core/encoder_buffer.h"
 #include "draco/core/status.h"
 #include "draco/mesh/mesh.h"
@@ -47,6 +48,12 @@ class Encoder
   // Encodes a mesh to the provided buffer.
   virtual Status EncodeMeshToBuffer(const Mesh &m, EncoderBuffer *out_buffer);
 
+  // Encodes geometry that is read directly from the buffers described by
+  // |source| to the provided buffer. The geometry is encoded as a mesh when
+  // the source has faces and as a point cloud otherwise.
+  Status EncodeGeometrySourceToBuffer(const GeometrySource &source,
+                                      EncoderBuffer *out_buffer);
+
   // Set encoder options used during the geometry encoding. Note that this call
   // overwrites any modifications to the options done with the functions below,
   // i.e., it resets the encoder.
@@ -84,6 +91,31 @@ class Encoder
                                         int quantization_bits, int num_dims,
                                         const float *origin, float range);
 
+  // Sets the maximum quantization error for a named attribute. The smallest
+  // number of quantization bits that keeps the error of all components within
+  // |max_error| is selected for each attribute of the type during encoding.
+  // For normals, |max_error| is the maximum angle in radians. See
+  // attribute_quantization_selector.h.
+  void SetAttributeMaxQuantizationError(GeometryAttribute::Type type,
+                                        float max_error);
+
+  // Same as above for texture coordinates, with the error given in texels of
+  // a texture of size |texture_width| x |texture_height|.
+  void SetAttributeMaxTexelQuantizationError(GeometryAttribute::Type type,
+                                             float max_texel_error,
+                                             int texture_width,
+                                             int texture_height);
+
+  // Enables/disables bit-exact coding of float attributes of a given type
+  // that are not quantized. See
+  // ExpertEncoder::SetAttributeLosslessFloatCoding().
+  void SetAttributeLosslessFloatCoding(GeometryAttribute::Type type,
+                                       bool enabled);
+
+  // Enables/disables the lossless YCoCg-R transform of integer colors. See
+  // ExpertEncoder::SetAttributeYCoCgTransform().
+  void SetAttributeYCoCgTransform(GeometryAttribute::Type type, bool enabled);
+
   // Sets the desired prediction method for a given attribute. By default,
   // prediction scheme is selected automatically by the encoder using other
   // provided options (such as speed) and input geometry type (mesh, point
@@ -103,6 +135,13 @@ class Encoder
   //      - specialized predictor for tex coordinates.
   //   MESH_PREDICTION_GEOMETRIC_NORMAL
   //      - specialized predictor for normal coordinates.
+  //   MESH_PREDICTION_SKIN
+  //      - specialized predictor for joint indices and joint weights. It is
+  //        never selected automatically.
+  //   MESH_PREDICTION_FEATURE_ID
+  //      - specialized predictor for feature IDs and other values that are
+  //        constant over large regions of the mesh. It is never selected
+  //        automatically.
   //
   // Note that in case the desired prediction cannot be used, the default
   // prediction will be automatically used instead.
@@ -120,6 +159,8 @@ class Encoder
   // geometry that is going to be encoded. For point clouds, allowed entries are
   //   POINT_CLOUD_SEQUENTIAL_ENCODING
   //   POINT_CLOUD_KD_TREE_ENCODING
+  //   POINT_CLOUD_MORTON_ORDER_ENCODING
+  //   POINT_CLOUD_CHUNKED_SEQUENTIAL_ENCODING
   //
   // For meshes the input can be
   //   MESH_SEQUENTIAL_ENCODING
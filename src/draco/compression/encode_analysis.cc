@@ -0,0 +1,48 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/encode_analysis.h"
+
+#include "draco/mesh/mesh_misc_functions.h"
+
+namespace draco {
+
+EncodeAnalysis::EncodeAnalysis(const Mesh &mesh, ThreadPool *pool)
+    : mesh_(&mesh), attribute_corner_tables_(mesh.num_attributes()) {
+  position_corner_table_ = CreateCornerTableFromPositionAttribute(&mesh, pool);
+  all_attributes_corner_table_ =
+      CreateCornerTableFromAllAttributes(&mesh, pool);
+  if (position_corner_table_ != nullptr) {
+    connected_components_.FindConnectedComponents(position_corner_table_.get(),
+                                                  pool);
+  }
+
+  // Attributes are analyzed independently of each other.
+  ParallelFor(pool, mesh.num_attributes(), [&](int i) {
+    const PointAttribute *const att = mesh.attribute(i);
+    if (att->data_type() == DT_FLOAT32) {
+      std::vector<float> min_values, max_values;
+      att->ComputeValueRange(pool, &min_values, &max_values);
+    }
+    if (position_corner_table_ == nullptr ||
+        att->attribute_type() == GeometryAttribute::POSITION) {
+      return;
+    }
+    attribute_corner_tables_[i].reset(new MeshAttributeCornerTable());
+    attribute_corner_tables_[i]->InitFromAttribute(
+        &mesh, position_corner_table_.get(), att);
+  });
+}
+
+}  // namespace draco
@@ -0,0 +1,84 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ENCODE_ANALYSIS_H_
+#define DRACO_COMPRESSION_ENCODE_ANALYSIS_H_
+
+#include <memory>
+#include <vector>
+
+#include "draco/core/thread_pool.h"
+#include "draco/mesh/corner_table.h"
+#include "draco/mesh/mesh.h"
+#include "draco/mesh/mesh_attribute_corner_table.h"
+#include "draco/mesh/mesh_connected_components.h"
+
+namespace draco {
+
+// Connectivity data that the mesh encoders derive from a mesh independently of
+// the encoder options: the corner tables of the mesh, the corner tables of its
+// attributes and its connected components. The value ranges of the float
+// attributes are computed as well, which fills the cache of
+// PointAttribute::ComputeValueRange() used by the quantization.
+//
+// When the same mesh is encoded many times with different options, e.g., when
+// the encoder settings are swept for auto-tuning, the analysis can be computed
+// once and passed to each encoding with ExpertEncoder::SetEncodeAnalysis()
+// instead of being recomputed by every encoder. The analysis is immutable and
+// it may be shared by encoders running on multiple threads. The mesh must
+// outlive the analysis and it must not be modified while the analysis is
+// used.
+class EncodeAnalysis {
+ public:
+  // Analyzes |mesh|. The work is done in parallel on the optional |pool|.
+  EncodeAnalysis(const Mesh &mesh, ThreadPool *pool);
+
+  const Mesh *mesh() const { return mesh_; }
+
+  // Returns the corner table of the connectivity defined by the position
+  // attribute or nullptr when it could not be created.
+  const CornerTable *position_corner_table() const {
+    return position_corner_table_.get();
+  }
+
+  // Returns the corner table of the mesh split along the seams of all
+  // attributes, which is used when all attributes are encoded with a single
+  // connectivity, or nullptr when it could not be created.
+  const CornerTable *all_attributes_corner_table() const {
+    return all_attributes_corner_table_.get();
+  }
+
+  // Returns the connectivity of attribute |att_id| defined on top of
+  // position_corner_table() or nullptr for the position attribute.
+  const MeshAttributeCornerTable *attribute_corner_table(int att_id) const {
+    return attribute_corner_tables_[att_id].get();
+  }
+
+  // Returns the connected components of position_corner_table().
+  const MeshConnectedComponents &connected_components() const {
+    return connected_components_;
+  }
+
+ private:
+  const Mesh *mesh_;
+  std::unique_ptr<CornerTable> position_corner_table_;
+  std::unique_ptr<CornerTable> all_attributes_corner_table_;
+  std::vector<std::unique_ptr<MeshAttributeCornerTable>>
+      attribute_corner_tables_;
+  MeshConnectedComponents connected_components_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ENCODE_ANALYSIS_H_
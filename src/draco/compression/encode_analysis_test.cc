@@ -0,0 +1,169 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/encode_analysis.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "draco/compression/chunked_mesh_encoder.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+
+namespace {
+
+class EncodeAnalysisTest : public ::testing::Test {
+ protected:
+  // Returns a set of options that exercise different uses of the analysis.
+  static std::vector<draco::EncoderOptions> GetTestOptions(
+      const draco::Mesh &mesh) {
+    std::vector<draco::EncoderOptions> options_list;
+    draco::EncoderOptions options =
+        draco::EncoderOptions::CreateDefaultOptions();
+    for (int i = 0; i < mesh.num_attributes(); ++i) {
+      options.SetAttributeInt(i, "quantization_bits", 12);
+    }
+    options.SetSpeed(5, 5);
+    options_list.push_back(options);
+    options.SetSpeed(0, 0);
+    options_list.push_back(options);
+    draco::EncoderOptions seams_options = options;
+    seams_options.SetGlobalBool("split_mesh_on_seams", true);
+    options_list.push_back(seams_options);
+    options.SetGlobalInt("encoding_method", draco::MESH_SEQUENTIAL_ENCODING);
+    options_list.push_back(options);
+    return options_list;
+  }
+
+  static std::vector<char> Encode(const draco::Mesh &mesh,
+                                  const draco::EncoderOptions &options,
+                                  const draco::EncodeAnalysis *analysis) {
+    draco::ExpertEncoder encoder(mesh);
+    encoder.Reset(options);
+    encoder.SetEncodeAnalysis(analysis);
+    draco::EncoderBuffer buffer;
+    EXPECT_TRUE(encoder.EncodeToBuffer(&buffer).ok());
+    return std::vector<char>(buffer.data(), buffer.data() + buffer.size());
+  }
+
+  static void TestEncodingMatches(const std::string &file_name) {
+    const std::unique_ptr<draco::Mesh> mesh =
+        draco::ReadMeshFromTestFile(file_name);
+    ASSERT_NE(mesh, nullptr);
+    const draco::EncodeAnalysis analysis(*mesh, nullptr);
+    ASSERT_NE(analysis.position_corner_table(), nullptr);
+    for (const draco::EncoderOptions &options : GetTestOptions(*mesh)) {
+      ASSERT_EQ(Encode(*mesh, options, &analysis),
+                Encode(*mesh, options, nullptr))
+          << file_name;
+    }
+  }
+};
+
+// Tests that the analysis provides the connectivity of the mesh.
+TEST_F(EncodeAnalysisTest, TestAnalysisData) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::ThreadPool pool(4);
+  const draco::EncodeAnalysis analysis(*mesh, &pool);
+  ASSERT_EQ(analysis.mesh(), mesh.get());
+  ASSERT_NE(analysis.position_corner_table(), nullptr);
+  ASSERT_NE(analysis.all_attributes_corner_table(), nullptr);
+  ASSERT_EQ(analysis.position_corner_table()->num_faces(), mesh->num_faces());
+  // Attribute seams split the cube into more vertices than positions.
+  ASSERT_GT(analysis.all_attributes_corner_table()->num_vertices(),
+            analysis.position_corner_table()->num_vertices());
+  ASSERT_EQ(analysis.connected_components().NumConnectedComponents(), 1);
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    if (mesh->attribute(i)->attribute_type() ==
+        draco::GeometryAttribute::POSITION) {
+      ASSERT_EQ(analysis.attribute_corner_table(i), nullptr);
+    } else {
+      ASSERT_NE(analysis.attribute_corner_table(i), nullptr);
+      ASSERT_FALSE(analysis.attribute_corner_table(i)->no_interior_seams());
+    }
+  }
+}
+
+// Tests that meshes are encoded to the same data with and without the
+// analysis.
+TEST_F(EncodeAnalysisTest, TestEncodingMatches) {
+  TestEncodingMatches("cube_att.obj");
+  TestEncodingMatches("octagon.obj");
+  TestEncodingMatches("sphere.obj");
+}
+
+// Tests that one analysis can be shared by encoders running in parallel.
+TEST_F(EncodeAnalysisTest, TestSharedAnalysis) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("sphere.obj");
+  ASSERT_NE(mesh, nullptr);
+  const draco::EncodeAnalysis analysis(*mesh, nullptr);
+  const std::vector<draco::EncoderOptions> options_list =
+      GetTestOptions(*mesh);
+  std::vector<std::vector<char>> expected;
+  for (const draco::EncoderOptions &options : options_list) {
+    expected.push_back(Encode(*mesh, options, nullptr));
+  }
+  const int num_encodings = 4 * static_cast<int>(options_list.size());
+  std::vector<std::vector<char>> results(num_encodings);
+  draco::ThreadPool pool(4);
+  pool.ParallelFor(num_encodings, [&](int i) {
+    results[i] = Encode(*mesh, options_list[i % options_list.size()],
+                        &analysis);
+  });
+  for (int i = 0; i < num_encodings; ++i) {
+    ASSERT_EQ(results[i], expected[i % options_list.size()]);
+  }
+}
+
+// Tests that an analysis of a different mesh is rejected.
+TEST_F(EncodeAnalysisTest, TestMismatchedMesh) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  const std::unique_ptr<draco::Mesh> other_mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  ASSERT_NE(other_mesh, nullptr);
+  const draco::EncodeAnalysis analysis(*other_mesh, nullptr);
+  draco::ExpertEncoder encoder(*mesh);
+  encoder.SetEncodeAnalysis(&analysis);
+  draco::EncoderBuffer buffer;
+  ASSERT_FALSE(encoder.EncodeToBuffer(&buffer).ok());
+}
+
+// Tests that the chunked encoder produces the same data with the analysis.
+TEST_F(EncodeAnalysisTest, TestChunkedEncoding) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("sphere.obj");
+  ASSERT_NE(mesh, nullptr);
+  const draco::EncodeAnalysis analysis(*mesh, nullptr);
+  const draco::EncoderOptions options = GetTestOptions(*mesh)[0];
+  draco::ChunkedMeshEncoder encoder;
+  encoder.set_max_chunk_faces(mesh->num_faces() / 3);
+  draco::EncoderBuffer expected_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, options, &expected_buffer));
+  encoder.SetEncodeAnalysis(&analysis);
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, options, &buffer));
+  ASSERT_EQ(std::vector<char>(buffer.data(), buffer.data() + buffer.size()),
+            std::vector<char>(expected_buffer.data(),
+                              expected_buffer.data() + expected_buffer.size()));
+}
+
+}  // namespace
@@ -43,6 +43,19 @@ class EncoderBase {
   // Note that this can slow down encoding for certain encoders.
   void SetTrackEncodedProperties(bool flag);
 
+  // If set, normals of encoded meshes are not stored. Only the |crease_angle|
+  // in radians is stored and the decoder generates smooth normals from the
+  // positions (see mesh_normal_generator.h). Edges where the angle between
+  // the adjacent faces is larger than |crease_angle| stay sharp.
+  void SetGeneratedNormals(float crease_angle);
+
+  // If set, names of metadata entries and sub-metadata are stored only once
+  // per geometry and referenced by index, which reduces the size of metadata
+  // with many repeated names and speeds up its decoding. Data encoded with
+  // this option can't be decoded by decoders that predate it.
+  // Default: false.
+  void SetInternMetadataNames(bool flag);
+
   // Returns the number of encoded points and faces during the last encoding
   // operation. Returns 0 if SetTrackEncodedProperties() was not set.
   size_t num_encoded_points() const { return num_encoded_points_; }
@@ -126,6 +139,16 @@ void EncoderBase<EncoderOptionsT>::SetTrackEncodedProperties(bool flag) {
   options_.SetGlobalBool("store_number_of_encoded_faces", flag);
 }
 
+template <class EncoderOptionsT>
+void EncoderBase<EncoderOptionsT>::SetGeneratedNormals(float crease_angle) {
+  options_.SetGlobalFloat("generated_normals_crease_angle", crease_angle);
+}
+
+template <class EncoderOptionsT>
+void EncoderBase<EncoderOptionsT>::SetInternMetadataNames(bool flag) {
+  options_.SetGlobalBool("intern_metadata_names", flag);
+}
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ENCODE_BASE_H_
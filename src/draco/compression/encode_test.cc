@@ -16,6 +16,7 @@
 #include "draco/compression/encode.h"
 
 #include <cinttypes>
+#include <cmath>
 #include <fstream>
 #include <sstream>
 
@@ -25,6 +26,7 @@
 #include "draco/compression/expert_encode.h"
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
 #include "draco/core/vector_d.h"
 #include "draco/io/file_utils.h"
 #include "draco/io/obj_decoder.h"
@@ -403,6 +405,175 @@ TEST_F(EncodeTest, TestNoPosQuantizationNormalCoding) {
   ASSERT_NE(decoded_mesh, nullptr);
 }
 
+TEST_F(EncodeTest, TestExpertEncoderWithThreadPool) {
+  // Tests that encoding of attributes on a thread pool produces exactly the
+  // same bitstream as the serial encoding.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::ThreadPool pool(3);
+  for (int method : {draco::MESH_SEQUENTIAL_ENCODING,
+                     draco::MESH_EDGEBREAKER_ENCODING}) {
+    draco::ExpertEncoder encoder(*mesh);
+    encoder.SetEncodingMethod(method);
+    for (int i = 0; i < mesh->num_attributes(); ++i) {
+      encoder.SetAttributeQuantization(i, 10 + i);
+    }
+    draco::EncoderBuffer buffer;
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(&buffer));
+
+    encoder.options().SetThreadPool(&pool);
+    draco::EncoderBuffer parallel_buffer;
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(&parallel_buffer));
+    ASSERT_EQ(buffer.size(), parallel_buffer.size());
+    ASSERT_EQ(std::memcmp(buffer.data(), parallel_buffer.data(), buffer.size()),
+              0);
+  }
+}
+
+TEST_F(EncodeTest, TestInterleavedSymbolCoding) {
+  // Tests that attributes encoded with interleaved rANS streams decode to the
+  // same values as attributes encoded with the default symbol coding.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("test_nm.obj");
+  ASSERT_NE(mesh, nullptr);
+  for (int method : {draco::MESH_SEQUENTIAL_ENCODING,
+                     draco::MESH_EDGEBREAKER_ENCODING}) {
+    draco::ExpertEncoder encoder(*mesh);
+    encoder.SetEncodingMethod(method);
+    for (int i = 0; i < mesh->num_attributes(); ++i) {
+      encoder.SetAttributeQuantization(i, 12);
+    }
+    draco::EncoderBuffer buffer;
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(&buffer));
+
+    encoder.options().SetGlobalBool("interleaved_symbol_coding", true);
+    draco::EncoderBuffer interleaved_buffer;
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(&interleaved_buffer));
+
+    draco::Decoder decoder;
+    draco::DecoderBuffer dec_buffer;
+    dec_buffer.Init(buffer.data(), buffer.size());
+    const std::unique_ptr<draco::Mesh> decoded_mesh =
+        decoder.DecodeMeshFromBuffer(&dec_buffer).value();
+    ASSERT_NE(decoded_mesh, nullptr);
+    dec_buffer.Init(interleaved_buffer.data(), interleaved_buffer.size());
+    const std::unique_ptr<draco::Mesh> interleaved_mesh =
+        decoder.DecodeMeshFromBuffer(&dec_buffer).value();
+    ASSERT_NE(interleaved_mesh, nullptr);
+    ASSERT_EQ(decoded_mesh->num_attributes(),
+              interleaved_mesh->num_attributes());
+    for (int i = 0; i < decoded_mesh->num_attributes(); ++i) {
+      const draco::DataBuffer *const expected =
+          decoded_mesh->attribute(i)->buffer();
+      const draco::DataBuffer *const actual =
+          interleaved_mesh->attribute(i)->buffer();
+      ASSERT_EQ(expected->data_size(), actual->data_size());
+      ASSERT_EQ(
+          std::memcmp(expected->data(), actual->data(), expected->data_size()),
+          0);
+    }
+  }
+}
+
+TEST_F(EncodeTest, TestVertexCacheConnectivity) {
+  // Tests that faces encoded with the vertex cache connectivity coding are
+  // decoded in the same order with the same winding.
+  for (const std::string file_name :
+       {"test_nm.obj", "cube_att.obj", "deg_faces.obj"}) {
+    const std::unique_ptr<draco::Mesh> mesh =
+        draco::ReadMeshFromTestFile(file_name);
+    ASSERT_NE(mesh, nullptr);
+    draco::ExpertEncoder encoder(*mesh);
+    encoder.SetEncodingMethod(draco::MESH_SEQUENTIAL_ENCODING);
+    encoder.options().SetGlobalBool("vertex_cache_connectivity", true);
+    draco::EncoderBuffer buffer;
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(&buffer));
+
+    draco::Decoder decoder;
+    draco::DecoderBuffer dec_buffer;
+    dec_buffer.Init(buffer.data(), buffer.size());
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::Mesh> decoded_mesh,
+                           decoder.DecodeMeshFromBuffer(&dec_buffer));
+    ASSERT_EQ(decoded_mesh->num_points(), mesh->num_points());
+    ASSERT_EQ(decoded_mesh->num_faces(), mesh->num_faces());
+    for (draco::FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+      const draco::Mesh::Face &face = mesh->face(fi);
+      const draco::Mesh::Face &decoded_face = decoded_mesh->face(fi);
+      // The corners of the decoded face may be rotated.
+      int r = 0;
+      while (r < 3 && decoded_face[r] != face[0]) {
+        ++r;
+      }
+      ASSERT_LT(r, 3) << file_name;
+      for (int c = 0; c < 3; ++c) {
+        ASSERT_EQ(decoded_face[(r + c) % 3], face[c]) << file_name;
+      }
+    }
+  }
+}
+
+TEST_F(EncodeTest, TestGeneratedNormals) {
+  // Tests that normals removed by the encoder are generated by the decoder.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 14);
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 10);
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &buffer));
+  encoder.SetGeneratedNormals(0.5f);
+  draco::EncoderBuffer generated_normals_buffer;
+  DRACO_ASSERT_OK(
+      encoder.EncodeMeshToBuffer(*mesh, &generated_normals_buffer));
+  ASSERT_LT(generated_normals_buffer.size(), buffer.size());
+
+  draco::Decoder decoder;
+  draco::DecoderBuffer dec_buffer;
+  dec_buffer.Init(generated_normals_buffer.data(),
+                  generated_normals_buffer.size());
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::Mesh> decoded_mesh,
+                         decoder.DecodeMeshFromBuffer(&dec_buffer));
+  ASSERT_EQ(decoded_mesh->num_faces(), mesh->num_faces());
+  const draco::PointAttribute *const normal_att =
+      decoded_mesh->GetNamedAttribute(draco::GeometryAttribute::NORMAL);
+  ASSERT_NE(normal_att, nullptr);
+  // The cube is flat shaded, each corner has the normal of its face.
+  const draco::PointAttribute *const pos_att =
+      decoded_mesh->GetNamedAttribute(draco::GeometryAttribute::POSITION);
+  for (draco::FaceIndex f(0); f < decoded_mesh->num_faces(); ++f) {
+    const draco::Mesh::Face &face = decoded_mesh->face(f);
+    draco::Vector3f p[3];
+    for (int c = 0; c < 3; ++c) {
+      pos_att->GetMappedValue(face[c], &p[c][0]);
+    }
+    draco::Vector3f face_normal =
+        draco::CrossProduct(p[1] - p[0], p[2] - p[0]);
+    face_normal = face_normal / std::sqrt(face_normal.SquaredNorm());
+    for (int c = 0; c < 3; ++c) {
+      draco::Vector3f n;
+      normal_att->GetMappedValue(face[c], &n[0]);
+      ASSERT_NEAR(n.Dot(face_normal), 1.f, 1e-4f);
+    }
+  }
+  // The crease angle is not exposed as metadata of the decoded mesh.
+  double crease_angle;
+  ASSERT_TRUE(decoded_mesh->GetMetadata() == nullptr ||
+              !decoded_mesh->GetMetadata()->GetEntryDouble(
+                  draco::kGeneratedNormalsCreaseAngleMetadataName,
+                  &crease_angle));
+
+  // Normal generation can be disabled in the decoder.
+  decoder.options()->SetGlobalBool("generate_normals", false);
+  dec_buffer.Init(generated_normals_buffer.data(),
+                  generated_normals_buffer.size());
+  DRACO_ASSIGN_OR_ASSERT(decoded_mesh,
+                         decoder.DecodeMeshFromBuffer(&dec_buffer));
+  ASSERT_EQ(decoded_mesh->NumNamedAttributes(draco::GeometryAttribute::NORMAL),
+            0);
+}
+
 #ifdef DRACO_TRANSCODER_SUPPORTED
 TEST_F(EncodeTest, TestDracoCompressionOptions) {
   // This test verifies that we can set the encoder's compression options via
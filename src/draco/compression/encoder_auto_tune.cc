@@ -0,0 +1,330 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/encoder_auto_tune.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "draco/compression/encode_analysis.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status_or.h"
+#include "draco/core/thread_pool.h"
+#include "draco/mesh/mesh_misc_functions.h"
+
+namespace draco {
+
+namespace {
+
+// Number of runs of consecutive faces or points the sample is made of.
+constexpr int kNumSampleRuns = 4;
+
+// Returns ranges [begin, end) of elements that are included in a sample of at
+// most |max_sample_size| out of |num_elements| elements.
+std::vector<std::pair<int, int>> ComputeSampleRuns(int num_elements,
+                                                   int max_sample_size) {
+  std::vector<std::pair<int, int>> runs;
+  if (num_elements <= max_sample_size) {
+    runs.push_back(std::make_pair(0, num_elements));
+    return runs;
+  }
+  const int num_runs = std::max(1, std::min(kNumSampleRuns, max_sample_size));
+  const int run_size = max_sample_size / num_runs;
+  for (int r = 0; r < num_runs; ++r) {
+    const int begin = static_cast<int>(static_cast<int64_t>(num_elements) * r /
+                                       num_runs);
+    runs.push_back(std::make_pair(begin, begin + run_size));
+  }
+  return runs;
+}
+
+std::unique_ptr<Mesh> CreateSample(const Mesh &mesh, int max_sample_size) {
+  std::vector<FaceIndex> faces;
+  for (const auto &run : ComputeSampleRuns(mesh.num_faces(), max_sample_size)) {
+    for (int f = run.first; f < run.second; ++f) {
+      faces.push_back(FaceIndex(f));
+    }
+  }
+  return CreateSubmesh(mesh, faces);
+}
+
+std::unique_ptr<PointCloud> CreateSample(const PointCloud &pc,
+                                         int max_sample_size) {
+  const std::vector<std::pair<int, int>> runs =
+      ComputeSampleRuns(pc.num_points(), max_sample_size);
+  int num_points = 0;
+  for (const auto &run : runs) {
+    num_points += run.second - run.first;
+  }
+  std::unique_ptr<PointCloud> sample(new PointCloud());
+  sample->set_num_points(num_points);
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    const PointAttribute *const src_att = pc.attribute(i);
+    const int att_id = sample->AddAttribute(*src_att, true, num_points);
+    PointAttribute *const att = sample->attribute(att_id);
+    att->set_unique_id(src_att->unique_id());
+    AttributeValueIndex avi(0);
+    for (const auto &run : runs) {
+      for (int p = run.first; p < run.second; ++p) {
+        att->SetAttributeValue(avi++,
+                               src_att->GetAddress(src_att->mapped_index(
+                                   PointIndex(static_cast<uint32_t>(p)))));
+      }
+    }
+  }
+  return sample;
+}
+
+// Returns prediction schemes that are tried for an attribute of |type|.
+std::vector<int> GetCandidateSchemes(GeometryAttribute::Type type,
+                                     bool is_mesh) {
+  if (!is_mesh) {
+    return {PREDICTION_NONE, PREDICTION_DIFFERENCE};
+  }
+  if (type == GeometryAttribute::NORMAL) {
+    return {PREDICTION_DIFFERENCE, MESH_PREDICTION_GEOMETRIC_NORMAL};
+  }
+  std::vector<int> schemes = {PREDICTION_NONE, PREDICTION_DIFFERENCE,
+                              MESH_PREDICTION_PARALLELOGRAM,
+                              MESH_PREDICTION_CONSTRAINED_MULTI_PARALLELOGRAM};
+  if (type == GeometryAttribute::TEX_COORD) {
+    schemes.push_back(MESH_PREDICTION_TEX_COORDS_PORTABLE);
+  }
+  return schemes;
+}
+
+// Returns the analysis shared by all trial encodings of a mesh sample. Point
+// clouds have no connectivity to analyze.
+std::unique_ptr<EncodeAnalysis> CreateEncodeAnalysis(const Mesh &mesh,
+                                                     ThreadPool *pool) {
+  return std::unique_ptr<EncodeAnalysis>(new EncodeAnalysis(mesh, pool));
+}
+
+std::unique_ptr<EncodeAnalysis> CreateEncodeAnalysis(
+    const PointCloud & /* pc */, ThreadPool * /* pool */) {
+  return nullptr;
+}
+
+template <class GeometryT>
+Status TunePredictionSchemes(const GeometryT &sample, bool is_mesh,
+                             const AutoTuneOptions &options,
+                             ExpertEncoder *encoder) {
+  typedef std::chrono::steady_clock Clock;
+  const Clock::time_point deadline =
+      Clock::now() + std::chrono::milliseconds(options.time_budget_ms);
+
+  struct Trial {
+    int att_id;
+    int prediction_scheme;
+    bool completed;
+    size_t encoded_size;
+  };
+  std::vector<Trial> trials;
+  for (int i = 0; i < sample.num_attributes(); ++i) {
+    if (encoder->options().IsAttributeOptionSet(
+            i, GetEncoderOptionKeys().prediction_scheme)) {
+      continue;
+    }
+    for (const int scheme :
+         GetCandidateSchemes(sample.attribute(i)->attribute_type(), is_mesh)) {
+      trials.push_back({i, scheme, false, 0});
+    }
+  }
+  if (trials.empty() || sample.num_points() == 0 ||
+      options.time_budget_ms <= 0) {
+    return OkStatus();
+  }
+
+  // The connectivity of the sample does not depend on the trial options, so
+  // it is computed only once for all trials.
+  const std::unique_ptr<EncodeAnalysis> analysis =
+      CreateEncodeAnalysis(sample, encoder->options().thread_pool());
+
+  // Encodes the sample with |trial_options| and returns the encoded size.
+  const auto encode_sample =
+      [&sample, &analysis](
+          const EncoderOptions &trial_options) -> StatusOr<size_t> {
+    ExpertEncoder trial_encoder(sample);
+    trial_encoder.Reset(trial_options);
+    trial_encoder.SetEncodeAnalysis(analysis.get());
+    EncoderBuffer buffer;
+    DRACO_RETURN_IF_ERROR(trial_encoder.EncodeToBuffer(&buffer));
+    return buffer.size();
+  };
+
+  // The sizes of the trials are compared to the encoding with the current
+  // options. Each trial changes the scheme of a single attribute only.
+  EncoderOptions current_options = encoder->options();
+  current_options.SetCodingStats(nullptr);
+  DRACO_ASSIGN_OR_RETURN(const size_t current_size,
+                         encode_sample(current_options));
+  ParallelFor(encoder->options().thread_pool(), static_cast<int>(trials.size()),
+              [&](int t) {
+                if (Clock::now() >= deadline) {
+                  return;
+                }
+                Trial &trial = trials[t];
+                ExpertEncoder trial_encoder(sample);
+                trial_encoder.Reset(encoder->options());
+                trial_encoder.options().SetCodingStats(nullptr);
+                if (!trial_encoder
+                         .SetAttributePredictionScheme(trial.att_id,
+                                                       trial.prediction_scheme)
+                         .ok()) {
+                  return;
+                }
+                StatusOr<size_t> size_or =
+                    encode_sample(trial_encoder.options());
+                if (!size_or.ok()) {
+                  return;
+                }
+                trial.encoded_size = size_or.value();
+                trial.completed = true;
+              });
+
+  std::vector<size_t> best_sizes(sample.num_attributes(), current_size);
+  std::vector<int> best_schemes(sample.num_attributes(), PREDICTION_UNDEFINED);
+  for (const Trial &trial : trials) {
+    if (trial.completed && trial.encoded_size < best_sizes[trial.att_id]) {
+      best_sizes[trial.att_id] = trial.encoded_size;
+      best_schemes[trial.att_id] = trial.prediction_scheme;
+    }
+  }
+  for (int i = 0; i < sample.num_attributes(); ++i) {
+    if (best_schemes[i] != PREDICTION_UNDEFINED) {
+      DRACO_RETURN_IF_ERROR(
+          encoder->SetAttributePredictionScheme(i, best_schemes[i]));
+    }
+  }
+  return OkStatus();
+}
+
+// Returns candidate options for SelectEncoderOptionsForTimeBudget() ordered
+// from the best compressing to the fastest one.
+std::vector<EncoderOptions> GetTimeBudgetCandidates(
+    const EncoderOptions &options, int num_attributes, bool is_mesh) {
+  std::vector<EncoderOptions> candidates;
+  candidates.push_back(options);
+  const int speed = options.GetEncodingSpeed();
+  for (const int candidate_speed : {5, 8}) {
+    if (candidate_speed > speed) {
+      EncoderOptions candidate = options;
+      candidate.SetSpeed(candidate_speed, candidate_speed);
+      candidates.push_back(candidate);
+    }
+  }
+  EncoderOptions fastest = options;
+  fastest.SetSpeed(10, 10);
+  const EncoderOptionKeys &keys = GetEncoderOptionKeys();
+  fastest.SetGlobalInt(keys.encoding_method,
+                       is_mesh ? static_cast<int>(MESH_SEQUENTIAL_ENCODING)
+                               : static_cast<int>(
+                                     POINT_CLOUD_SEQUENTIAL_ENCODING));
+  for (int i = 0; i < num_attributes; ++i) {
+    fastest.SetAttributeInt(i, keys.prediction_scheme, PREDICTION_DIFFERENCE);
+  }
+  candidates.push_back(fastest);
+  return candidates;
+}
+
+template <class GeometryT>
+Status SelectOptionsForTimeBudget(const GeometryT &sample,
+                                  int64_t num_sample_elements,
+                                  int64_t num_elements, bool is_mesh,
+                                  const TimeBudgetOptions &options,
+                                  ExpertEncoder *encoder) {
+  typedef std::chrono::steady_clock Clock;
+  const Clock::time_point start = Clock::now();
+  const std::vector<EncoderOptions> candidates = GetTimeBudgetCandidates(
+      encoder->options(), sample.num_attributes(), is_mesh);
+  size_t selected = candidates.size() - 1;
+  for (size_t c = 0; c + 1 < candidates.size(); ++c) {
+    ExpertEncoder sample_encoder(sample);
+    sample_encoder.Reset(candidates[c]);
+    EncoderBuffer buffer;
+    const Clock::time_point sample_start = Clock::now();
+    if (!sample_encoder.EncodeToBuffer(&buffer).ok()) {
+      continue;
+    }
+    const Clock::time_point now = Clock::now();
+    const double sample_ms =
+        std::chrono::duration<double, std::milli>(now - sample_start).count();
+    const double predicted_ms = sample_ms * num_elements /
+                                std::max<int64_t>(num_sample_elements, 1);
+    const double remaining_ms =
+        options.time_budget_ms -
+        std::chrono::duration<double, std::milli>(now - start).count();
+    if (predicted_ms <= remaining_ms * options.budget_fraction) {
+      selected = c;
+      break;
+    }
+  }
+  encoder->Reset(candidates[selected]);
+  return OkStatus();
+}
+
+}  // namespace
+
+Status AutoTunePredictionSchemes(const Mesh &mesh,
+                                 const AutoTuneOptions &options,
+                                 ExpertEncoder *encoder) {
+  if (static_cast<int64_t>(mesh.num_faces()) <= options.max_sample_size) {
+    return TunePredictionSchemes(mesh, true, options, encoder);
+  }
+  const std::unique_ptr<Mesh> sample =
+      CreateSample(mesh, options.max_sample_size);
+  return TunePredictionSchemes(*sample, true, options, encoder);
+}
+
+Status AutoTunePredictionSchemes(const PointCloud &pc,
+                                 const AutoTuneOptions &options,
+                                 ExpertEncoder *encoder) {
+  if (static_cast<int64_t>(pc.num_points()) <= options.max_sample_size) {
+    return TunePredictionSchemes(pc, false, options, encoder);
+  }
+  const std::unique_ptr<PointCloud> sample =
+      CreateSample(pc, options.max_sample_size);
+  return TunePredictionSchemes(*sample, false, options, encoder);
+}
+
+Status SelectEncoderOptionsForTimeBudget(const Mesh &mesh,
+                                         const TimeBudgetOptions &options,
+                                         ExpertEncoder *encoder) {
+  if (static_cast<int64_t>(mesh.num_faces()) <= options.max_sample_size) {
+    return SelectOptionsForTimeBudget(mesh, mesh.num_faces(), mesh.num_faces(),
+                                      true, options, encoder);
+  }
+  const std::unique_ptr<Mesh> sample =
+      CreateSample(mesh, options.max_sample_size);
+  return SelectOptionsForTimeBudget(*sample, sample->num_faces(),
+                                    mesh.num_faces(), true, options, encoder);
+}
+
+Status SelectEncoderOptionsForTimeBudget(const PointCloud &pc,
+                                         const TimeBudgetOptions &options,
+                                         ExpertEncoder *encoder) {
+  if (static_cast<int64_t>(pc.num_points()) <= options.max_sample_size) {
+    return SelectOptionsForTimeBudget(pc, pc.num_points(), pc.num_points(),
+                                      false, options, encoder);
+  }
+  const std::unique_ptr<PointCloud> sample =
+      CreateSample(pc, options.max_sample_size);
+  return SelectOptionsForTimeBudget(*sample, sample->num_points(),
+                                    pc.num_points(), false, options, encoder);
+}
+
+}  // namespace draco
@@ -0,0 +1,104 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ENCODER_AUTO_TUNE_H_
+#define DRACO_COMPRESSION_ENCODER_AUTO_TUNE_H_
+
+#include <cstdint>
+
+#include "draco/compression/expert_encode.h"
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Options of AutoTunePredictionSchemes().
+struct AutoTuneOptions {
+  AutoTuneOptions() : max_sample_size(1 << 14), time_budget_ms(1000) {}
+
+  // Maximum number of faces (meshes) or points (point clouds) of the sample
+  // that is used for the trial encodings.
+  int max_sample_size;
+
+  // No new trial encoding is started after this time elapsed. Trials that are
+  // running at the deadline are finished, so the budget can be exceeded by
+  // the duration of a single trial.
+  int64_t time_budget_ms;
+};
+
+// Selects prediction schemes of |encoder| by trial encoding. For each
+// attribute, a sample of the geometry is encoded with all prediction schemes
+// that are applicable to the attribute and the scheme that results in the
+// smallest encoded size is set on |encoder| with
+// ExpertEncoder::SetAttributePredictionScheme(). All other options, including
+// the quantization, are taken from |encoder|, so the options should be set
+// before this function is called. Attributes with an explicitly set
+// prediction scheme are not changed.
+//
+// The sample consists of a few evenly spaced runs of consecutive faces (or
+// points), which keeps the local neighborhoods the prediction schemes rely
+// on. Trial encodings run in parallel on the thread pool of the encoder
+// options, if any. When the time budget runs out, attributes keep the best
+// scheme among the completed trials.
+//
+// |mesh| and |pc| must be the geometry |encoder| was created for.
+Status AutoTunePredictionSchemes(const Mesh &mesh,
+                                 const AutoTuneOptions &options,
+                                 ExpertEncoder *encoder);
+Status AutoTunePredictionSchemes(const PointCloud &pc,
+                                 const AutoTuneOptions &options,
+                                 ExpertEncoder *encoder);
+
+// Options of SelectEncoderOptionsForTimeBudget().
+struct TimeBudgetOptions {
+  TimeBudgetOptions()
+      : max_sample_size(1 << 12), time_budget_ms(50), budget_fraction(0.8) {}
+
+  // Maximum number of faces (meshes) or points (point clouds) of the sample
+  // that is used to measure the encoding speed.
+  int max_sample_size;
+  // Time budget for both the selection and the final encoding.
+  int64_t time_budget_ms;
+  // Fraction of the remaining budget the predicted encoding time may take.
+  // The rest of the budget absorbs errors of the prediction.
+  double budget_fraction;
+};
+
+// Selects options of |encoder| so that encoding of the geometry is predicted
+// to finish within the time budget. The candidate options are tried from the
+// best compressing to the fastest one:
+//
+//   1. The current options of |encoder|.
+//   2. Encoding speeds 5 and 8 (only speeds faster than the current one).
+//   3. Sequential encoding with delta prediction of all attributes.
+//
+// The encoding time of a candidate is predicted by encoding a sample of the
+// geometry (see AutoTunePredictionSchemes()) and scaling the measured time by
+// the number of faces (or points). The first candidate whose prediction fits
+// into the rest of the budget is set on |encoder|. The last candidate is used
+// without measuring when no other candidate fits, so the budget cannot be
+// guaranteed for geometry that is too large even for the fastest encoding.
+//
+// |mesh| and |pc| must be the geometry |encoder| was created for.
+Status SelectEncoderOptionsForTimeBudget(const Mesh &mesh,
+                                         const TimeBudgetOptions &options,
+                                         ExpertEncoder *encoder);
+Status SelectEncoderOptionsForTimeBudget(const PointCloud &pc,
+                                         const TimeBudgetOptions &options,
+                                         ExpertEncoder *encoder);
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ENCODER_AUTO_TUNE_H_
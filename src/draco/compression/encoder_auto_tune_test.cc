@@ -0,0 +1,186 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/encoder_auto_tune.h"
+
+#include <memory>
+
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+
+namespace draco {
+
+class EncoderAutoTuneTest : public ::testing::Test {
+ protected:
+  // Returns default options for encoding of |pc|.
+  static EncoderOptions CreateOptions(const PointCloud &pc) {
+    Encoder encoder;
+    encoder.SetAttributeQuantization(GeometryAttribute::POSITION, 12);
+    encoder.SetAttributeQuantization(GeometryAttribute::NORMAL, 8);
+    encoder.SetAttributeQuantization(GeometryAttribute::GENERIC, 8);
+    return encoder.CreateExpertEncoderOptions(pc);
+  }
+
+  // Encodes the geometry of |encoder| and checks that it can be decoded.
+  // Returns the encoded size.
+  static size_t EncodeAndDecode(ExpertEncoder *encoder) {
+    EncoderBuffer buffer;
+    EXPECT_TRUE(encoder->EncodeToBuffer(&buffer).ok());
+    DecoderBuffer dec_buffer;
+    dec_buffer.Init(buffer.data(), buffer.size());
+    Decoder decoder;
+    EXPECT_TRUE(decoder.DecodePointCloudFromBuffer(&dec_buffer).ok());
+    return buffer.size();
+  }
+};
+
+TEST_F(EncoderAutoTuneTest, TestTunedMeshIsNotLarger) {
+  // Tests that the tuned encoding of the whole mesh is not larger than the
+  // default encoding when the sample contains the whole mesh.
+  const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  ExpertEncoder default_encoder(*mesh);
+  default_encoder.Reset(CreateOptions(*mesh));
+  const size_t default_size = EncodeAndDecode(&default_encoder);
+
+  ExpertEncoder encoder(*mesh);
+  encoder.Reset(CreateOptions(*mesh));
+  AutoTuneOptions options;
+  options.max_sample_size = mesh->num_faces();
+  options.time_budget_ms = 1000000;
+  DRACO_ASSERT_OK(AutoTunePredictionSchemes(*mesh, options, &encoder));
+  ASSERT_LE(EncodeAndDecode(&encoder), default_size);
+}
+
+TEST_F(EncoderAutoTuneTest, TestMeshSample) {
+  // Tests tuning on a sample of the mesh, with and without a thread pool.
+  const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  AutoTuneOptions options;
+  options.max_sample_size = 2000;
+  options.time_budget_ms = 1000000;
+
+  ExpertEncoder encoder(*mesh);
+  encoder.Reset(CreateOptions(*mesh));
+  DRACO_ASSERT_OK(AutoTunePredictionSchemes(*mesh, options, &encoder));
+  const size_t size = EncodeAndDecode(&encoder);
+
+  ThreadPool pool(3);
+  ExpertEncoder parallel_encoder(*mesh);
+  parallel_encoder.Reset(CreateOptions(*mesh));
+  parallel_encoder.options().SetThreadPool(&pool);
+  DRACO_ASSERT_OK(
+      AutoTunePredictionSchemes(*mesh, options, &parallel_encoder));
+  ASSERT_EQ(EncodeAndDecode(&parallel_encoder), size);
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    ASSERT_EQ(
+        parallel_encoder.options().GetAttributeInt(i, "prediction_scheme", -1),
+        encoder.options().GetAttributeInt(i, "prediction_scheme", -1));
+  }
+}
+
+TEST_F(EncoderAutoTuneTest, TestExplicitSchemeIsKept) {
+  const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  const int pos_att_id =
+      mesh->GetNamedAttributeId(GeometryAttribute::POSITION);
+  ExpertEncoder encoder(*mesh);
+  encoder.Reset(CreateOptions(*mesh));
+  DRACO_ASSERT_OK(
+      encoder.SetAttributePredictionScheme(pos_att_id, PREDICTION_NONE));
+  DRACO_ASSERT_OK(
+      AutoTunePredictionSchemes(*mesh, AutoTuneOptions(), &encoder));
+  ASSERT_EQ(encoder.options().GetAttributeInt(pos_att_id, "prediction_scheme",
+                                              PREDICTION_UNDEFINED),
+            PREDICTION_NONE);
+}
+
+TEST_F(EncoderAutoTuneTest, TestZeroTimeBudget) {
+  // Tests that no options are changed when there is no time for any trial.
+  const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  ExpertEncoder encoder(*mesh);
+  encoder.Reset(CreateOptions(*mesh));
+  AutoTuneOptions options;
+  options.time_budget_ms = 0;
+  DRACO_ASSERT_OK(AutoTunePredictionSchemes(*mesh, options, &encoder));
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    ASSERT_FALSE(
+        encoder.options().IsAttributeOptionSet(i, "prediction_scheme"));
+  }
+}
+
+TEST_F(EncoderAutoTuneTest, TestPointCloud) {
+  const std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("point_cloud_test_pos_norm.ply");
+  ASSERT_NE(pc, nullptr);
+  ExpertEncoder encoder(*pc);
+  encoder.Reset(CreateOptions(*pc));
+  encoder.SetEncodingMethod(POINT_CLOUD_SEQUENTIAL_ENCODING);
+  AutoTuneOptions options;
+  options.max_sample_size = pc->num_points() / 2;
+  options.time_budget_ms = 1000000;
+  DRACO_ASSERT_OK(AutoTunePredictionSchemes(*pc, options, &encoder));
+  EncodeAndDecode(&encoder);
+}
+
+TEST_F(EncoderAutoTuneTest, TestLargeTimeBudgetKeepsOptions) {
+  const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  ExpertEncoder encoder(*mesh);
+  encoder.Reset(CreateOptions(*mesh));
+  const int speed = encoder.options().GetEncodingSpeed();
+  TimeBudgetOptions options;
+  options.time_budget_ms = 1000000;
+  DRACO_ASSERT_OK(SelectEncoderOptionsForTimeBudget(*mesh, options, &encoder));
+  ASSERT_EQ(encoder.options().GetEncodingSpeed(), speed);
+  ASSERT_FALSE(encoder.options().IsGlobalOptionSet("encoding_method"));
+}
+
+TEST_F(EncoderAutoTuneTest, TestZeroTimeBudgetSelectsFastestOptions) {
+  const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  ExpertEncoder encoder(*mesh);
+  encoder.Reset(CreateOptions(*mesh));
+  TimeBudgetOptions options;
+  options.time_budget_ms = 0;
+  DRACO_ASSERT_OK(SelectEncoderOptionsForTimeBudget(*mesh, options, &encoder));
+  ASSERT_EQ(encoder.options().GetEncodingSpeed(), 10);
+  ASSERT_EQ(encoder.options().GetGlobalInt("encoding_method", -1),
+            MESH_SEQUENTIAL_ENCODING);
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    ASSERT_EQ(encoder.options().GetAttributeInt(i, "prediction_scheme", -1),
+              PREDICTION_DIFFERENCE);
+  }
+  EncodeAndDecode(&encoder);
+}
+
+TEST_F(EncoderAutoTuneTest, TestPointCloudTimeBudget) {
+  const std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("point_cloud_test_pos_norm.ply");
+  ASSERT_NE(pc, nullptr);
+  ExpertEncoder encoder(*pc);
+  encoder.Reset(CreateOptions(*pc));
+  TimeBudgetOptions options;
+  options.time_budget_ms = 0;
+  DRACO_ASSERT_OK(SelectEncoderOptionsForTimeBudget(*pc, options, &encoder));
+  ASSERT_EQ(encoder.options().GetGlobalInt("encoding_method", -1),
+            POINT_CLOUD_SEQUENTIAL_ENCODING);
+  EncodeAndDecode(&encoder);
+}
+
+}  // namespace draco
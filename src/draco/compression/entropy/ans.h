@@ -18,6 +18,7 @@
 // See http://arxiv.org/abs/1311.2540v2 for more information on rANS.
 // This file is based off libvpx's ans.h.
 
+#include <algorithm>
 #include <vector>
 
 #define DRACO_ANS_DIVIDE_BY_MULTIPLY 1
@@ -419,35 +420,43 @@ class RAnsDecoder {
   // number of bytes encoded by the encoder. A non zero return value is an
   // error.
   inline int read_init(const uint8_t *const buf, int offset) {
+    return read_init_state(&ans_, buf, offset);
+  }
+
+  // Same as read_init() but initializes an external decoder |state|. Used for
+  // decoding of multiple interleaved streams that share the same probability
+  // table (see rans_read_interleaved_symbols()).
+  static inline int read_init_state(AnsDecoder *const state,
+                                    const uint8_t *const buf, int offset) {
     unsigned x;
     if (offset < 1) {
       return 1;
     }
-    ans_.buf = buf;
+    state->buf = buf;
     x = buf[offset - 1] >> 6;
     if (x == 0) {
-      ans_.buf_offset = offset - 1;
-      ans_.state = buf[offset - 1] & 0x3F;
+      state->buf_offset = offset - 1;
+      state->state = buf[offset - 1] & 0x3F;
     } else if (x == 1) {
       if (offset < 2) {
         return 1;
       }
-      ans_.buf_offset = offset - 2;
-      ans_.state = mem_get_le16(buf + offset - 2) & 0x3FFF;
+      state->buf_offset = offset - 2;
+      state->state = mem_get_le16(buf + offset - 2) & 0x3FFF;
     } else if (x == 2) {
       if (offset < 3) {
         return 1;
       }
-      ans_.buf_offset = offset - 3;
-      ans_.state = mem_get_le24(buf + offset - 3) & 0x3FFFFF;
+      state->buf_offset = offset - 3;
+      state->state = mem_get_le24(buf + offset - 3) & 0x3FFFFF;
     } else if (x == 3) {
-      ans_.buf_offset = offset - 4;
-      ans_.state = mem_get_le32(buf + offset - 4) & 0x3FFFFFFF;
+      state->buf_offset = offset - 4;
+      state->state = mem_get_le32(buf + offset - 4) & 0x3FFFFFFF;
     } else {
       return 1;
     }
-    ans_.state += l_rans_base;
-    if (ans_.state >= l_rans_base * DRACO_ANS_IO_BASE) {
+    state->state += l_rans_base;
+    if (state->state >= l_rans_base * DRACO_ANS_IO_BASE) {
       return 1;
     }
     return 0;
@@ -460,39 +469,82 @@ class RAnsDecoder {
   }
 
   inline int rans_read() {
-    unsigned rem;
-    unsigned quo;
-    struct rans_dec_sym sym;
-    while (ans_.state < l_rans_base && ans_.buf_offset > 0) {
-      ans_.state = ans_.state * DRACO_ANS_IO_BASE + ans_.buf[--ans_.buf_offset];
+    // |rans_precision| is a power of two compile time constant, and the
+    // division and modulo in read_symbol() are going to be optimized by the
+    // compiler.
+    return read_symbol(lut_table_.data(), ans_.buf, &ans_.state,
+                       &ans_.buf_offset);
+  }
+
+  // Decodes |num_values| symbols into |out_values|. Equivalent to calling
+  // rans_read() |num_values| times, but the decoder state is kept in local
+  // variables so that it does not need to be reloaded after each store to
+  // |out_values|.
+  inline void rans_read_symbols(uint32_t *out_values, uint32_t num_values) {
+    const rans_dec_sym *const lut = lut_table_.data();
+    uint32_t state = ans_.state;
+    int buf_offset = ans_.buf_offset;
+    for (uint32_t i = 0; i < num_values; ++i) {
+      out_values[i] = read_symbol(lut, ans_.buf, &state, &buf_offset);
+    }
+    ans_.state = state;
+    ans_.buf_offset = buf_offset;
+  }
+
+  // Decodes |num_values| symbols that were encoded into |num_states_t|
+  // interleaved streams, where the i-th symbol belongs to the stream
+  // i % |num_states_t|. Each stream must be initialized with
+  // read_init_state(). The streams have independent dependency chains, so
+  // their decoding can be overlapped by the CPU.
+  template <int num_states_t>
+  inline void rans_read_interleaved_symbols(AnsDecoder *const states,
+                                            uint32_t *out_values,
+                                            uint32_t num_values) const {
+    const rans_dec_sym *const lut = lut_table_.data();
+    uint32_t state[num_states_t];
+    int buf_offset[num_states_t];
+    for (int s = 0; s < num_states_t; ++s) {
+      state[s] = states[s].state;
+      buf_offset[s] = states[s].buf_offset;
+    }
+    uint32_t i = 0;
+    for (; i + num_states_t <= num_values; i += num_states_t) {
+      for (int s = 0; s < num_states_t; ++s) {
+        out_values[i + s] =
+            read_symbol(lut, states[s].buf, &state[s], &buf_offset[s]);
+      }
+    }
+    for (int s = 0; i < num_values; ++i, ++s) {
+      out_values[i] =
+          read_symbol(lut, states[s].buf, &state[s], &buf_offset[s]);
+    }
+    for (int s = 0; s < num_states_t; ++s) {
+      states[s].state = state[s];
+      states[s].buf_offset = buf_offset[s];
     }
-    // |rans_precision| is a power of two compile time constant, and the below
-    // division and modulo are going to be optimized by the compiler.
-    quo = ans_.state / rans_precision;
-    rem = ans_.state % rans_precision;
-    fetch_sym(&sym, rem);
-    ans_.state = quo * sym.prob + rem - sym.cum_prob;
-    return sym.val;
   }
 
   // Construct a lookup table with |rans_precision| number of entries.
   // Returns false if the table couldn't be built (because of wrong input data).
   inline bool rans_build_look_up_table(const uint32_t token_probs[],
                                        uint32_t num_symbols) {
+    // Each entry of the table stores the symbol together with its probability
+    // so that decoding of a symbol needs only a single table lookup.
     lut_table_.resize(rans_precision);
-    probability_table_.resize(num_symbols);
     uint32_t cum_prob = 0;
     uint32_t act_prob = 0;
     for (uint32_t i = 0; i < num_symbols; ++i) {
-      probability_table_[i].prob = token_probs[i];
-      probability_table_[i].cum_prob = cum_prob;
-      cum_prob += token_probs[i];
+      const uint32_t prob = token_probs[i];
+      cum_prob += prob;
       if (cum_prob > rans_precision) {
         return false;
       }
-      for (uint32_t j = act_prob; j < cum_prob; ++j) {
-        lut_table_[j] = i;
-      }
+      rans_dec_sym sym;
+      sym.val = i;
+      sym.prob = prob;
+      sym.cum_prob = act_prob;
+      std::fill(lut_table_.begin() + act_prob, lut_table_.begin() + cum_prob,
+                sym);
       act_prob = cum_prob;
     }
     if (cum_prob != rans_precision) {
@@ -502,17 +554,24 @@ class RAnsDecoder {
   }
 
  private:
-  inline void fetch_sym(struct rans_dec_sym *out, uint32_t rem) {
-    uint32_t symbol = lut_table_[rem];
-    out->val = symbol;
-    out->prob = probability_table_[symbol].prob;
-    out->cum_prob = probability_table_[symbol].cum_prob;
-  }
-
   static constexpr int rans_precision = 1 << rans_precision_bits_t;
   static constexpr int l_rans_base = rans_precision * 4;
-  std::vector<uint32_t> lut_table_;
-  std::vector<rans_sym> probability_table_;
+
+  static inline uint32_t read_symbol(const rans_dec_sym *const lut,
+                                     const uint8_t *const buf,
+                                     uint32_t *const state,
+                                     int *const buf_offset) {
+    while (*state < l_rans_base && *buf_offset > 0) {
+      *state = *state * DRACO_ANS_IO_BASE + buf[--(*buf_offset)];
+    }
+    const uint32_t quo = *state / rans_precision;
+    const uint32_t rem = *state % rans_precision;
+    const rans_dec_sym &sym = lut[rem];
+    *state = quo * sym.prob + rem - sym.cum_prob;
+    return sym.val;
+  }
+
+  std::vector<rans_dec_sym> lut_table_;
   AnsDecoder ans_;
 };
 
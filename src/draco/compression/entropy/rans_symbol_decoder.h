@@ -35,15 +35,52 @@ class RAnsSymbolDecoder {
   // Initialize the decoder and decode the probability table.
   bool Create(DecoderBuffer *buffer);
 
+  // Advances |buffer| past the probability table without initializing the
+  // decoder. The layout of the table does not depend on
+  // |unique_symbols_bit_length_t|.
+  bool SkipProbabilityTable(DecoderBuffer *buffer) {
+    return DecodeProbabilityTable(buffer);
+  }
+
+  // Advances |buffer| past a single rANS stream without decoding it.
+  static bool SkipStream(DecoderBuffer *buffer);
+
   uint32_t num_symbols() const { return num_symbols_; }
 
   // Starts decoding from the buffer. The buffer will be advanced past the
   // encoded data after this call.
   bool StartDecoding(DecoderBuffer *buffer);
   uint32_t DecodeSymbol() { return ans_.rans_read(); }
+  // Decodes |num_values| symbols into |out_values|. Faster than calling
+  // DecodeSymbol() for each value.
+  void DecodeSymbols(uint32_t *out_values, uint32_t num_values) {
+    ans_.rans_read_symbols(out_values, num_values);
+  }
   void EndDecoding();
 
+  // Decodes |num_values| symbols that were encoded into |num_streams|
+  // interleaved rANS streams stored in |buffer|. The i-th symbol is decoded
+  // from the stream i % |num_streams|. Currently 4 and 8 streams are
+  // supported. The buffer is advanced past all streams.
+  bool DecodeInterleavedSymbols(DecoderBuffer *buffer, int num_streams,
+                                uint32_t *out_values, uint32_t num_values);
+
  private:
+  // Decodes the probability table into |probability_table_|.
+  bool DecodeProbabilityTable(DecoderBuffer *buffer);
+
+  // Decodes the size of the rANS stream stored in |buffer|.
+  static bool DecodeStreamSize(DecoderBuffer *buffer, uint64_t *out_size);
+
+  template <int num_streams_t>
+  bool DecodeInterleavedSymbolsInternal(DecoderBuffer *buffer,
+                                        uint32_t *out_values,
+                                        uint32_t num_values);
+
+  // Initializes |state| from the next rANS stream stored in |buffer| and
+  // advances the buffer past the stream.
+  static bool StartStream(DecoderBuffer *buffer, AnsDecoder *state);
+
   static constexpr int rans_precision_bits_ =
       ComputeRAnsPrecisionFromUniqueSymbolsBitLength(
           unique_symbols_bit_length_t);
@@ -57,6 +94,21 @@ class RAnsSymbolDecoder {
 template <int unique_symbols_bit_length_t>
 bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::Create(
     DecoderBuffer *buffer) {
+  if (!DecodeProbabilityTable(buffer)) {
+    return false;
+  }
+  if (num_symbols_ == 0) {
+    return true;
+  }
+  if (!ans_.rans_build_look_up_table(&probability_table_[0], num_symbols_)) {
+    return false;
+  }
+  return true;
+}
+
+template <int unique_symbols_bit_length_t>
+bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::DecodeProbabilityTable(
+    DecoderBuffer *buffer) {
   // Check that the DecoderBuffer version is set.
   if (buffer->bitstream_version() == 0) {
     return false;
@@ -124,31 +176,45 @@ bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::Create(
       probability_table_[i] = prob;
     }
   }
-  if (!ans_.rans_build_look_up_table(&probability_table_[0], num_symbols_)) {
-    return false;
-  }
   return true;
 }
 
 template <int unique_symbols_bit_length_t>
-bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::StartDecoding(
-    DecoderBuffer *buffer) {
-  uint64_t bytes_encoded;
+bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::DecodeStreamSize(
+    DecoderBuffer *buffer, uint64_t *out_size) {
   // Decode the number of bytes encoded by the encoder.
 #ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
   if (buffer->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 0)) {
-    if (!buffer->Decode(&bytes_encoded)) {
+    if (!buffer->Decode(out_size)) {
       return false;
     }
 
   } else
 #endif
   {
-    if (!DecodeVarint<uint64_t>(&bytes_encoded, buffer)) {
+    if (!DecodeVarint<uint64_t>(out_size, buffer)) {
       return false;
     }
   }
-  if (bytes_encoded > static_cast<uint64_t>(buffer->remaining_size())) {
+  return *out_size <= static_cast<uint64_t>(buffer->remaining_size());
+}
+
+template <int unique_symbols_bit_length_t>
+bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::SkipStream(
+    DecoderBuffer *buffer) {
+  uint64_t bytes_encoded;
+  if (!DecodeStreamSize(buffer, &bytes_encoded)) {
+    return false;
+  }
+  buffer->Advance(bytes_encoded);
+  return true;
+}
+
+template <int unique_symbols_bit_length_t>
+bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::StartDecoding(
+    DecoderBuffer *buffer) {
+  uint64_t bytes_encoded;
+  if (!DecodeStreamSize(buffer, &bytes_encoded)) {
     return false;
   }
   const uint8_t *const data_head =
@@ -166,6 +232,56 @@ void RAnsSymbolDecoder<unique_symbols_bit_length_t>::EndDecoding() {
   ans_.read_end();
 }
 
+template <int unique_symbols_bit_length_t>
+bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::DecodeInterleavedSymbols(
+    DecoderBuffer *buffer, int num_streams, uint32_t *out_values,
+    uint32_t num_values) {
+  switch (num_streams) {
+    case 4:
+      return DecodeInterleavedSymbolsInternal<4>(buffer, out_values,
+                                                 num_values);
+    case 8:
+      return DecodeInterleavedSymbolsInternal<8>(buffer, out_values,
+                                                 num_values);
+    default:
+      return false;
+  }
+}
+
+template <int unique_symbols_bit_length_t>
+template <int num_streams_t>
+bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::
+    DecodeInterleavedSymbolsInternal(DecoderBuffer *buffer,
+                                     uint32_t *out_values,
+                                     uint32_t num_values) {
+  AnsDecoder states[num_streams_t];
+  for (int s = 0; s < num_streams_t; ++s) {
+    if (!StartStream(buffer, &states[s])) {
+      return false;
+    }
+  }
+  ans_.template rans_read_interleaved_symbols<num_streams_t>(states, out_values,
+                                                             num_values);
+  return true;
+}
+
+template <int unique_symbols_bit_length_t>
+bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::StartStream(
+    DecoderBuffer *buffer, AnsDecoder *state) {
+  uint64_t bytes_encoded;
+  if (!DecodeVarint<uint64_t>(&bytes_encoded, buffer)) {
+    return false;
+  }
+  if (bytes_encoded > static_cast<uint64_t>(buffer->remaining_size())) {
+    return false;
+  }
+  const uint8_t *const data_head =
+      reinterpret_cast<const uint8_t *>(buffer->data_head());
+  buffer->Advance(bytes_encoded);
+  return RAnsDecoder<rans_precision_bits_>::read_init_state(
+             state, data_head, static_cast<int>(bytes_encoded)) == 0;
+}
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ENTROPY_RANS_SYMBOL_DECODER_H_
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <vector>
 
 #include "draco/compression/entropy/ans.h"
 #include "draco/compression/entropy/rans_symbol_coding.h"
@@ -81,6 +82,8 @@ class RAnsSymbolEncoder {
   RAnsEncoder<rans_precision_bits_> ans_;
   // Initial offset of the encoder buffer before any ans data was encoded.
   uint64_t buffer_offset_;
+  // Receives the encoded data when the encoder buffer cannot be resized.
+  std::vector<uint8_t> scratch_data_;
 };
 
 template <int unique_symbols_bit_length_t>
@@ -258,16 +261,25 @@ void RAnsSymbolEncoder<unique_symbols_bit_length_t>::StartEncoding(
 
   buffer_offset_ = buffer->size();
   const int64_t required_bytes = (required_bits + 7) / 8;
-  buffer->Resize(buffer_offset_ + required_bytes + sizeof(buffer_offset_));
-  uint8_t *const data =
-      reinterpret_cast<uint8_t *>(const_cast<char *>(buffer->data()));
-  ans_.write_init(data + buffer_offset_);
+  if (!buffer->Resize(buffer_offset_ + required_bytes +
+                      sizeof(buffer_offset_))) {
+    // The external storage of |buffer| is too small and the encoding fails.
+    // Encode the symbols into a scratch buffer instead of past its end.
+    scratch_data_.resize(required_bytes);
+    ans_.write_init(scratch_data_.data());
+    return;
+  }
+  ans_.write_init(reinterpret_cast<uint8_t *>(buffer->data()) +
+                  buffer_offset_);
 }
 
 template <int unique_symbols_bit_length_t>
 void RAnsSymbolEncoder<unique_symbols_bit_length_t>::EndEncoding(
     EncoderBuffer *buffer) {
-  char *const src = const_cast<char *>(buffer->data()) + buffer_offset_;
+  if (buffer->storage_exhausted()) {
+    return;
+  }
+  char *const src = buffer->data() + buffer_offset_;
 
   // TODO(fgalligan): Look into changing this to uint32_t as write_end()
   // returns an int.
@@ -94,7 +94,7 @@ ShannonEntropyTracker::EntropyData ShannonEntropyTracker::UpdateSymbols(
     double old_symbol_entropy_norm = 0;
     int &frequency = frequencies_[symbol];
     if (frequency > 1) {
-      old_symbol_entropy_norm = frequency * std::log2(frequency);
+      old_symbol_entropy_norm = GetSymbolEntropyNorm(frequency);
     } else if (frequency == 0) {
       ret_data.num_unique_symbols++;
       if (symbol > static_cast<uint32_t>(ret_data.max_symbol)) {
@@ -102,7 +102,7 @@ ShannonEntropyTracker::EntropyData ShannonEntropyTracker::UpdateSymbols(
       }
     }
     frequency++;
-    const double new_symbol_entropy_norm = frequency * std::log2(frequency);
+    const double new_symbol_entropy_norm = GetSymbolEntropyNorm(frequency);
 
     // Update the final entropy.
     ret_data.entropy_norm += new_symbol_entropy_norm - old_symbol_entropy_norm;
@@ -17,6 +17,9 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <cmath>
+
 #include <vector>
 
 namespace draco {
@@ -97,10 +100,25 @@ class ShannonEntropyTracker {
   static int64_t GetNumberOfRAnsTableBits(const EntropyData &entropy_data);
 
  private:
+  // Returns |frequency| * log2(|frequency|). The values are cached because
+  // they are needed repeatedly for the same frequencies.
+  double GetSymbolEntropyNorm(int frequency) {
+    if (frequency >= static_cast<int>(entropy_norm_cache_.size())) {
+      const int old_size = static_cast<int>(entropy_norm_cache_.size());
+      entropy_norm_cache_.resize(std::max(2 * old_size, frequency + 1));
+      for (int i = old_size; i < static_cast<int>(entropy_norm_cache_.size());
+           ++i) {
+        entropy_norm_cache_[i] = i > 1 ? i * std::log2(i) : 0.0;
+      }
+    }
+    return entropy_norm_cache_[frequency];
+  }
+
   EntropyData UpdateSymbols(const uint32_t *symbols, int num_symbols,
                             bool push_changes);
 
   std::vector<int32_t> frequencies_;
+  std::vector<double> entropy_norm_cache_;
 
   EntropyData entropy_data_;
 };
@@ -14,6 +14,7 @@
 //
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/compression/entropy/symbol_dictionary.h"
 #include "draco/compression/entropy/symbol_encoding.h"
 #include "draco/core/bit_utils.h"
 #include "draco/core/decoder_buffer.h"
@@ -90,6 +91,76 @@ TEST_F(SymbolCodingTest, TestManyNumbers) {
   }
 }
 
+TEST_F(SymbolCodingTest, TestSmallExternalStorage) {
+  // This test verifies that encoding into external storage that is too small
+  // fails without writing past the end of the storage.
+  std::vector<uint32_t> in_values(5000);
+  for (uint32_t i = 0; i < in_values.size(); ++i) {
+    in_values[i] = (i * 7919) % 50;
+  }
+  for (int method = 0; method < NUM_SYMBOL_CODING_METHODS; ++method) {
+    Options options;
+    SetSymbolEncodingMethod(&options, static_cast<SymbolCodingMethod>(method));
+    EncoderBuffer expected;
+    ASSERT_TRUE(EncodeSymbols(in_values.data(), in_values.size(), 1, &options,
+                              &expected));
+    for (size_t capacity = 1; capacity < expected.size(); ++capacity) {
+      std::vector<char> memory(capacity);
+      EncoderBuffer eb;
+      eb.SetExternalStorage(memory.data(), memory.size());
+      EncodeSymbols(in_values.data(), in_values.size(), 1, &options, &eb);
+      ASSERT_TRUE(eb.storage_exhausted());
+    }
+  }
+}
+
+TEST_F(SymbolCodingTest, TestManyMultiComponentNumbers) {
+  // This test verifies that SymbolCoding successfully encodes a large array of
+  // values with multiple components. The number of tags of the tagged scheme
+  // is not a multiple of the size of the batches used by the decoder.
+  const int num_components = 3;
+  std::vector<uint32_t> in_values;
+  for (int i = 0; i < 1001 * num_components; ++i) {
+    in_values.push_back((i * 7919) % (1 << (i % 17)));
+  }
+  for (int method = 0; method < NUM_SYMBOL_CODING_METHODS; ++method) {
+    Options options;
+    SetSymbolEncodingMethod(&options, static_cast<SymbolCodingMethod>(method));
+    EncoderBuffer eb;
+    ASSERT_TRUE(EncodeSymbols(in_values.data(), in_values.size(),
+                              num_components, &options, &eb));
+    std::vector<uint32_t> out_values(in_values.size());
+    DecoderBuffer db;
+    db.Init(eb.data(), eb.size());
+    db.set_bitstream_version(bitstream_version_);
+    ASSERT_TRUE(DecodeSymbols(in_values.size(), num_components, &db,
+                              out_values.data()));
+    ASSERT_EQ(in_values, out_values);
+  }
+}
+
+TEST_F(SymbolCodingTest, TestInterleavedFewNumbers) {
+  // This test verifies that interleaved rANS streams work when some of the
+  // streams do not contain any symbols.
+  for (int num_values = 1; num_values < 10; ++num_values) {
+    std::vector<uint32_t> in_values;
+    for (int i = 0; i < num_values; ++i) {
+      in_values.push_back(i * 3);
+    }
+    Options options;
+    SetSymbolEncodingMethod(&options, SYMBOL_CODING_RAW_INTERLEAVED);
+    EncoderBuffer eb;
+    ASSERT_TRUE(
+        EncodeSymbols(in_values.data(), num_values, 1, &options, &eb));
+    std::vector<uint32_t> out_values(num_values);
+    DecoderBuffer db;
+    db.Init(eb.data(), eb.size());
+    db.set_bitstream_version(bitstream_version_);
+    ASSERT_TRUE(DecodeSymbols(num_values, 1, &db, out_values.data()));
+    ASSERT_EQ(in_values, out_values);
+  }
+}
+
 TEST_F(SymbolCodingTest, TestEmpty) {
   // This test verifies that SymbolCoding successfully encodes an empty array.
   EncoderBuffer eb;
@@ -158,6 +229,82 @@ TEST_F(SymbolCodingTest, TestLargeNumberCondition) {
   }
 }
 
+TEST_F(SymbolCodingTest, TestDictionary) {
+  // This test verifies that small arrays of symbols are encoded with a shared
+  // dictionary table when it produces smaller data.
+  std::vector<std::vector<uint32_t>> corpus(20);
+  for (size_t i = 0; i < corpus.size(); ++i) {
+    for (int j = 0; j < 50; ++j) {
+      corpus[i].push_back((i + j * j) % 23);
+    }
+  }
+  std::vector<uint64_t> frequencies;
+  for (const auto &symbols : corpus) {
+    SymbolDictionary::AccumulateFrequencies(
+        symbols.data(), static_cast<int>(symbols.size()), &frequencies);
+  }
+  std::unique_ptr<SymbolDictionary> trained(new SymbolDictionary(7));
+  ASSERT_EQ(trained->AddTable(frequencies), 0);
+
+  // Store and load the dictionary.
+  EncoderBuffer dictionary_buffer;
+  ASSERT_TRUE(trained->Encode(&dictionary_buffer));
+  DecoderBuffer dictionary_decoder_buffer;
+  dictionary_decoder_buffer.Init(dictionary_buffer.data(),
+                                 dictionary_buffer.size());
+  std::shared_ptr<SymbolDictionary> dictionary =
+      SymbolDictionary::Decode(&dictionary_decoder_buffer);
+  ASSERT_NE(dictionary, nullptr);
+  ASSERT_EQ(dictionary->id(), 7);
+  ASSERT_EQ(dictionary->num_tables(), 1);
+  ASSERT_TRUE(SymbolDictionary::Register(dictionary));
+  ASSERT_FALSE(SymbolDictionary::Register(dictionary));
+
+  Options options;
+  SetSymbolEncodingDictionary(&options, dictionary->id());
+  for (const auto &symbols : corpus) {
+    EncoderBuffer eb;
+    ASSERT_TRUE(EncodeSymbols(symbols.data(), symbols.size(), 1, &options,
+                              &eb));
+    EncoderBuffer default_eb;
+    ASSERT_TRUE(EncodeSymbols(symbols.data(), symbols.size(), 1, nullptr,
+                              &default_eb));
+    ASSERT_EQ(eb.data()[0], SYMBOL_CODING_RAW_DICTIONARY);
+    ASSERT_LT(eb.size(), default_eb.size());
+
+    std::vector<uint32_t> out(symbols.size());
+    DecoderBuffer db;
+    db.Init(eb.data(), eb.size());
+    db.set_bitstream_version(bitstream_version_);
+    ASSERT_TRUE(DecodeSymbols(symbols.size(), 1, &db, out.data()));
+    ASSERT_EQ(out, symbols);
+    ASSERT_EQ(db.remaining_size(), 0);
+
+    db.Init(eb.data(), eb.size());
+    db.set_bitstream_version(bitstream_version_);
+    ASSERT_TRUE(SkipSymbols(symbols.size(), 1, &db));
+    ASSERT_EQ(db.remaining_size(), 0);
+  }
+
+  // Symbols that are not in the table are encoded without the dictionary.
+  const std::vector<uint32_t> large_symbols = {1, 100, 2, 3};
+  EncoderBuffer eb;
+  ASSERT_TRUE(EncodeSymbols(large_symbols.data(), large_symbols.size(), 1,
+                            &options, &eb));
+  ASSERT_NE(eb.data()[0], SYMBOL_CODING_RAW_DICTIONARY);
+
+  // Decoding fails when the dictionary is not registered.
+  eb.Clear();
+  ASSERT_TRUE(EncodeSymbols(corpus[0].data(), corpus[0].size(), 1, &options,
+                            &eb));
+  SymbolDictionary::Unregister(dictionary->id());
+  std::vector<uint32_t> out(corpus[0].size());
+  DecoderBuffer db;
+  db.Init(eb.data(), eb.size());
+  db.set_bitstream_version(bitstream_version_);
+  ASSERT_FALSE(DecodeSymbols(corpus[0].size(), 1, &db, out.data()));
+}
+
 TEST_F(SymbolCodingTest, TestConversionFullRange) {
   TestConvertToSymbolAndBack(static_cast<int8_t>(-128));
   TestConvertToSymbolAndBack(static_cast<int8_t>(-127));
@@ -18,6 +18,8 @@
 #include <cmath>
 
 #include "draco/compression/entropy/rans_symbol_decoder.h"
+#include "draco/compression/entropy/symbol_dictionary.h"
+#include "draco/core/varint_decoding.h"
 
 namespace draco {
 
@@ -25,10 +27,20 @@ template <template <int> class SymbolDecoderT>
 bool DecodeTaggedSymbols(uint32_t num_values, int num_components,
                          DecoderBuffer *src_buffer, uint32_t *out_values);
 
+// Decodes symbols encoded with the raw scheme. When |interleaved| is true, the
+// symbols are stored in multiple interleaved rANS streams. The bit length and
+// the probability table are read from |table_buffer|, which is the same as
+// |src_buffer| unless the table comes from a SymbolDictionary.
 template <template <int> class SymbolDecoderT>
-bool DecodeRawSymbols(uint32_t num_values, DecoderBuffer *src_buffer,
+bool DecodeRawSymbols(uint32_t num_values, bool interleaved,
+                      DecoderBuffer *table_buffer, DecoderBuffer *src_buffer,
                       uint32_t *out_values);
 
+// Decodes symbols encoded with a table of a registered SymbolDictionary.
+static bool DecodeDictionarySymbols(uint32_t num_values,
+                                    DecoderBuffer *src_buffer,
+                                    uint32_t *out_values);
+
 bool DecodeSymbols(uint32_t num_values, int num_components,
                    DecoderBuffer *src_buffer, uint32_t *out_values) {
   if (num_values == 0) {
@@ -43,12 +55,127 @@ bool DecodeSymbols(uint32_t num_values, int num_components,
     return DecodeTaggedSymbols<RAnsSymbolDecoder>(num_values, num_components,
                                                   src_buffer, out_values);
   } else if (scheme == SYMBOL_CODING_RAW) {
-    return DecodeRawSymbols<RAnsSymbolDecoder>(num_values, src_buffer,
-                                               out_values);
+    return DecodeRawSymbols<RAnsSymbolDecoder>(num_values, false, src_buffer,
+                                               src_buffer, out_values);
+  } else if (scheme == SYMBOL_CODING_RAW_INTERLEAVED) {
+    return DecodeRawSymbols<RAnsSymbolDecoder>(num_values, true, src_buffer,
+                                               src_buffer, out_values);
+  } else if (scheme == SYMBOL_CODING_RAW_DICTIONARY) {
+    return DecodeDictionarySymbols(num_values, src_buffer, out_values);
   }
   return false;
 }
 
+static bool DecodeDictionarySymbols(uint32_t num_values,
+                                    DecoderBuffer *src_buffer,
+                                    uint32_t *out_values) {
+  uint32_t dictionary_id, table_id;
+  if (!DecodeVarint(&dictionary_id, src_buffer) ||
+      !DecodeVarint(&table_id, src_buffer)) {
+    return false;
+  }
+  const std::shared_ptr<const SymbolDictionary> dictionary =
+      SymbolDictionary::Find(dictionary_id);
+  if (dictionary == nullptr ||
+      table_id >= static_cast<uint32_t>(dictionary->num_tables())) {
+    return false;
+  }
+  const std::vector<char> &encoded_table =
+      dictionary->table(table_id).encoded_table;
+  // Dictionary tables are always stored in the current format.
+  DecoderBuffer table_buffer;
+  table_buffer.Init(encoded_table.data(), encoded_table.size(),
+                    kDracoMeshBitstreamVersion);
+  return DecodeRawSymbols<RAnsSymbolDecoder>(num_values, false, &table_buffer,
+                                             src_buffer, out_values);
+}
+
+bool SkipSymbols(uint32_t num_values, int num_components,
+                 DecoderBuffer *src_buffer) {
+  if (num_values == 0) {
+    return true;
+  }
+  uint8_t scheme;
+  if (!src_buffer->Decode(&scheme)) {
+    return false;
+  }
+  if (scheme == SYMBOL_CODING_TAGGED) {
+    // The size of the raw bits is not stored, so it is computed from the
+    // decoded bit lengths of all tags.
+    RAnsSymbolDecoder<5> tag_decoder;
+    if (!tag_decoder.Create(src_buffer) ||
+        !tag_decoder.StartDecoding(src_buffer)) {
+      return false;
+    }
+    if (tag_decoder.num_symbols() == 0) {
+      return false;
+    }
+    constexpr uint32_t kMaxTagBatchSize = 256;
+    uint32_t bit_lengths[kMaxTagBatchSize];
+    const uint32_t num_tags =
+        (num_values + num_components - 1) / num_components;
+    uint64_t num_bits = 0;
+    for (uint32_t tag_id = 0; tag_id < num_tags; tag_id += kMaxTagBatchSize) {
+      const uint32_t batch_size =
+          std::min(kMaxTagBatchSize, num_tags - tag_id);
+      tag_decoder.DecodeSymbols(bit_lengths, batch_size);
+      for (uint32_t i = 0; i < batch_size; ++i) {
+        num_bits += bit_lengths[i];
+      }
+    }
+    tag_decoder.EndDecoding();
+    const uint64_t num_bytes = (num_bits * num_components + 7) / 8;
+    if (num_bytes > static_cast<uint64_t>(src_buffer->remaining_size())) {
+      return false;
+    }
+    src_buffer->Advance(num_bytes);
+    return true;
+  }
+  if (scheme == SYMBOL_CODING_RAW_DICTIONARY) {
+    // The probability table is not stored in the data.
+    uint32_t dictionary_id, table_id;
+    if (!DecodeVarint(&dictionary_id, src_buffer) ||
+        !DecodeVarint(&table_id, src_buffer)) {
+      return false;
+    }
+    return RAnsSymbolDecoder<1>::SkipStream(src_buffer);
+  }
+  if (scheme != SYMBOL_CODING_RAW && scheme != SYMBOL_CODING_RAW_INTERLEAVED) {
+    return false;
+  }
+  uint8_t max_bit_length;
+  if (!src_buffer->Decode(&max_bit_length)) {
+    return false;
+  }
+  if (max_bit_length < 1 || max_bit_length > 18) {
+    return false;
+  }
+  // The layout of the probability table and of the rANS streams does not
+  // depend on the bit length of the symbols.
+  RAnsSymbolDecoder<1> decoder;
+  if (!decoder.SkipProbabilityTable(src_buffer)) {
+    return false;
+  }
+  if (decoder.num_symbols() == 0) {
+    return false;
+  }
+  uint8_t num_streams = 1;
+  if (scheme == SYMBOL_CODING_RAW_INTERLEAVED) {
+    if (!src_buffer->Decode(&num_streams)) {
+      return false;
+    }
+    if (num_streams != 4 && num_streams != 8) {
+      return false;
+    }
+  }
+  for (int i = 0; i < num_streams; ++i) {
+    if (!RAnsSymbolDecoder<1>::SkipStream(src_buffer)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 template <template <int> class SymbolDecoderT>
 bool DecodeTaggedSymbols(uint32_t num_values, int num_components,
                          DecoderBuffer *src_buffer, uint32_t *out_values) {
@@ -69,17 +196,26 @@ bool DecodeTaggedSymbols(uint32_t num_values, int num_components,
   // src_buffer now points behind the encoded tag data (to the place where the
   // values are encoded).
   src_buffer->StartBitDecoding(false, nullptr);
+  // Tags are decoded in batches that are independent of the values read from
+  // |src_buffer|.
+  constexpr uint32_t kMaxTagBatchSize = 256;
+  uint32_t bit_lengths[kMaxTagBatchSize];
+  const uint32_t num_tags = (num_values + num_components - 1) / num_components;
   int value_id = 0;
-  for (uint32_t i = 0; i < num_values; i += num_components) {
-    // Decode the tag.
-    const uint32_t bit_length = tag_decoder.DecodeSymbol();
-    // Decode the actual value.
-    for (int j = 0; j < num_components; ++j) {
-      uint32_t val;
-      if (!src_buffer->DecodeLeastSignificantBits32(bit_length, &val)) {
-        return false;
+  for (uint32_t tag_id = 0; tag_id < num_tags; tag_id += kMaxTagBatchSize) {
+    const uint32_t batch_size =
+        std::min(kMaxTagBatchSize, num_tags - tag_id);
+    tag_decoder.DecodeSymbols(bit_lengths, batch_size);
+    for (uint32_t i = 0; i < batch_size; ++i) {
+      // Decode the actual value.
+      const uint32_t bit_length = bit_lengths[i];
+      for (int j = 0; j < num_components; ++j) {
+        uint32_t val;
+        if (!src_buffer->DecodeLeastSignificantBits32(bit_length, &val)) {
+          return false;
+        }
+        out_values[value_id++] = val;
       }
-      out_values[value_id++] = val;
     }
   }
   tag_decoder.EndDecoding();
@@ -88,10 +224,11 @@ bool DecodeTaggedSymbols(uint32_t num_values, int num_components,
 }
 
 template <class SymbolDecoderT>
-bool DecodeRawSymbolsInternal(uint32_t num_values, DecoderBuffer *src_buffer,
-                              uint32_t *out_values) {
+bool DecodeRawSymbolsInternal(uint32_t num_values, bool interleaved,
+                              DecoderBuffer *table_buffer,
+                              DecoderBuffer *src_buffer, uint32_t *out_values) {
   SymbolDecoderT decoder;
-  if (!decoder.Create(src_buffer)) {
+  if (!decoder.Create(table_buffer)) {
     return false;
   }
 
@@ -99,80 +236,86 @@ bool DecodeRawSymbolsInternal(uint32_t num_values, DecoderBuffer *src_buffer,
     return false;  // Wrong number of symbols.
   }
 
+  if (interleaved) {
+    uint8_t num_streams;
+    if (!src_buffer->Decode(&num_streams)) {
+      return false;
+    }
+    return decoder.DecodeInterleavedSymbols(src_buffer, num_streams,
+                                            out_values, num_values);
+  }
+
   if (!decoder.StartDecoding(src_buffer)) {
     return false;
   }
-  for (uint32_t i = 0; i < num_values; ++i) {
-    // Decode a symbol into the value.
-    const uint32_t value = decoder.DecodeSymbol();
-    out_values[i] = value;
-  }
+  decoder.DecodeSymbols(out_values, num_values);
   decoder.EndDecoding();
   return true;
 }
 
 template <template <int> class SymbolDecoderT>
-bool DecodeRawSymbols(uint32_t num_values, DecoderBuffer *src_buffer,
+bool DecodeRawSymbols(uint32_t num_values, bool interleaved,
+                      DecoderBuffer *table_buffer, DecoderBuffer *src_buffer,
                       uint32_t *out_values) {
   uint8_t max_bit_length;
-  if (!src_buffer->Decode(&max_bit_length)) {
+  if (!table_buffer->Decode(&max_bit_length)) {
     return false;
   }
   switch (max_bit_length) {
     case 1:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<1>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<1>>(
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 2:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<2>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<2>>(
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 3:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<3>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<3>>(
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 4:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<4>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<4>>(
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 5:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<5>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<5>>(
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 6:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<6>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<6>>(
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 7:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<7>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<7>>(
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 8:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<8>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<8>>(
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 9:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<9>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<9>>(
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 10:
       return DecodeRawSymbolsInternal<SymbolDecoderT<10>>(
-          num_values, src_buffer, out_values);
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 11:
       return DecodeRawSymbolsInternal<SymbolDecoderT<11>>(
-          num_values, src_buffer, out_values);
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 12:
       return DecodeRawSymbolsInternal<SymbolDecoderT<12>>(
-          num_values, src_buffer, out_values);
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 13:
       return DecodeRawSymbolsInternal<SymbolDecoderT<13>>(
-          num_values, src_buffer, out_values);
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 14:
       return DecodeRawSymbolsInternal<SymbolDecoderT<14>>(
-          num_values, src_buffer, out_values);
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 15:
       return DecodeRawSymbolsInternal<SymbolDecoderT<15>>(
-          num_values, src_buffer, out_values);
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 16:
       return DecodeRawSymbolsInternal<SymbolDecoderT<16>>(
-          num_values, src_buffer, out_values);
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 17:
       return DecodeRawSymbolsInternal<SymbolDecoderT<17>>(
-          num_values, src_buffer, out_values);
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     case 18:
       return DecodeRawSymbolsInternal<SymbolDecoderT<18>>(
-          num_values, src_buffer, out_values);
+          num_values, interleaved, table_buffer, src_buffer, out_values);
     default:
       return false;
   }
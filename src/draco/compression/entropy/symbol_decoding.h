@@ -24,6 +24,13 @@ namespace draco {
 bool DecodeSymbols(uint32_t num_values, int num_components,
                    DecoderBuffer *src_buffer, uint32_t *out_values);
 
+// Advances |src_buffer| past an array of symbols encoded with DecodeSymbols()
+// compatible entropy code. The symbols are not decoded, except for the bit
+// lengths of the tagged scheme that are needed to locate the end of the data.
+// Returns false on error.
+bool SkipSymbols(uint32_t num_values, int num_components,
+                 DecoderBuffer *src_buffer);
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ENTROPY_SYMBOL_DECODING_H_
@@ -0,0 +1,175 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/entropy/symbol_dictionary.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "draco/compression/entropy/rans_symbol_encoder.h"
+#include "draco/core/bit_utils.h"
+#include "draco/core/varint_decoding.h"
+#include "draco/core/varint_encoding.h"
+
+namespace draco {
+
+namespace {
+
+// Maximum number of symbols of a table. Matches the limit of the raw symbol
+// coding.
+constexpr int kMaxDictionaryTableBitLength = 18;
+
+// Encodes the rANS probability table for |frequencies| with the precision
+// given by |bit_length| into |out_buffer|.
+template <int bit_length_t>
+bool EncodeProbabilityTable(int bit_length,
+                            const std::vector<uint64_t> &frequencies,
+                            EncoderBuffer *out_buffer) {
+  if (bit_length != bit_length_t) {
+    return EncodeProbabilityTable<bit_length_t + 1>(bit_length, frequencies,
+                                                    out_buffer);
+  }
+  RAnsSymbolEncoder<bit_length_t> encoder;
+  return encoder.Create(frequencies.data(),
+                        static_cast<int>(frequencies.size()), out_buffer);
+}
+
+template <>
+bool EncodeProbabilityTable<kMaxDictionaryTableBitLength + 1>(
+    int, const std::vector<uint64_t> &, EncoderBuffer *) {
+  return false;
+}
+
+struct SymbolDictionaryRegistry {
+  std::mutex mutex;
+  std::map<uint32_t, std::shared_ptr<const SymbolDictionary>> dictionaries;
+};
+
+SymbolDictionaryRegistry *GetSymbolDictionaryRegistry() {
+  static auto registry = new SymbolDictionaryRegistry();
+  return registry;
+}
+
+}  // namespace
+
+SymbolDictionary::SymbolDictionary(uint32_t id) : id_(id) {}
+
+void SymbolDictionary::AccumulateFrequencies(
+    const uint32_t *symbols, int num_values,
+    std::vector<uint64_t> *frequencies) {
+  for (int i = 0; i < num_values; ++i) {
+    if (symbols[i] >= frequencies->size()) {
+      frequencies->resize(symbols[i] + 1, 0);
+    }
+    ++(*frequencies)[symbols[i]];
+  }
+}
+
+int SymbolDictionary::AddTable(const std::vector<uint64_t> &frequencies) {
+  if (frequencies.empty() ||
+      frequencies.size() > (1u << kMaxDictionaryTableBitLength)) {
+    return -1;
+  }
+  Table table;
+  table.frequencies = frequencies;
+  for (uint64_t &frequency : table.frequencies) {
+    if (frequency == 0) {
+      frequency = 1;
+    }
+  }
+  const uint32_t num_symbols = static_cast<uint32_t>(frequencies.size());
+  table.unique_symbols_bit_length =
+      std::min(MostSignificantBit(num_symbols) + 1,
+               kMaxDictionaryTableBitLength);
+  EncoderBuffer buffer;
+  buffer.Encode(static_cast<uint8_t>(table.unique_symbols_bit_length));
+  if (!EncodeProbabilityTable<1>(table.unique_symbols_bit_length,
+                                 table.frequencies, &buffer)) {
+    return -1;
+  }
+  table.encoded_table.assign(buffer.data(), buffer.data() + buffer.size());
+  tables_.push_back(std::move(table));
+  return num_tables() - 1;
+}
+
+bool SymbolDictionary::Encode(EncoderBuffer *out_buffer) const {
+  EncodeVarint(id_, out_buffer);
+  EncodeVarint(static_cast<uint32_t>(tables_.size()), out_buffer);
+  for (const Table &table : tables_) {
+    EncodeVarint(static_cast<uint32_t>(table.frequencies.size()), out_buffer);
+    for (const uint64_t frequency : table.frequencies) {
+      EncodeVarint(frequency, out_buffer);
+    }
+  }
+  return true;
+}
+
+std::unique_ptr<SymbolDictionary> SymbolDictionary::Decode(
+    DecoderBuffer *in_buffer) {
+  uint32_t id, num_tables;
+  if (!DecodeVarint(&id, in_buffer) || !DecodeVarint(&num_tables, in_buffer)) {
+    return nullptr;
+  }
+  std::unique_ptr<SymbolDictionary> dictionary(new SymbolDictionary(id));
+  for (uint32_t i = 0; i < num_tables; ++i) {
+    uint32_t num_symbols;
+    if (!DecodeVarint(&num_symbols, in_buffer)) {
+      return nullptr;
+    }
+    // Each frequency takes at least one byte.
+    if (num_symbols > in_buffer->remaining_size()) {
+      return nullptr;
+    }
+    std::vector<uint64_t> frequencies(num_symbols);
+    for (uint32_t s = 0; s < num_symbols; ++s) {
+      if (!DecodeVarint(&frequencies[s], in_buffer)) {
+        return nullptr;
+      }
+    }
+    if (dictionary->AddTable(frequencies) < 0) {
+      return nullptr;
+    }
+  }
+  return dictionary;
+}
+
+bool SymbolDictionary::Register(
+    std::shared_ptr<const SymbolDictionary> dictionary) {
+  if (dictionary == nullptr) {
+    return false;
+  }
+  SymbolDictionaryRegistry *const registry = GetSymbolDictionaryRegistry();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  return registry->dictionaries.emplace(dictionary->id(), dictionary).second;
+}
+
+void SymbolDictionary::Unregister(uint32_t id) {
+  SymbolDictionaryRegistry *const registry = GetSymbolDictionaryRegistry();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  registry->dictionaries.erase(id);
+}
+
+std::shared_ptr<const SymbolDictionary> SymbolDictionary::Find(uint32_t id) {
+  SymbolDictionaryRegistry *const registry = GetSymbolDictionaryRegistry();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  const auto it = registry->dictionaries.find(id);
+  if (it == registry->dictionaries.end()) {
+    return nullptr;
+  }
+  return it->second;
+}
+
+}  // namespace draco
@@ -0,0 +1,102 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_ENTROPY_SYMBOL_DICTIONARY_H_
+#define DRACO_COMPRESSION_ENTROPY_SYMBOL_DICTIONARY_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/encoder_buffer.h"
+
+namespace draco {
+
+// Set of symbol probability tables that are shared by the symbol encoder and
+// decoder instead of being stored in each encoded stream. This is useful for
+// many small streams with similar statistics, e.g. small meshes of a map
+// tile, where the probability tables take a large part of the encoded data.
+//
+// A dictionary is trained on a corpus of symbols, e.g.
+//
+//   std::vector<uint64_t> frequencies;
+//   for (const auto &symbols : corpus) {
+//     SymbolDictionary::AccumulateFrequencies(symbols.data(), symbols.size(),
+//                                             &frequencies);
+//   }
+//   std::shared_ptr<SymbolDictionary> dictionary(new SymbolDictionary(id));
+//   dictionary->AddTable(frequencies);
+//
+// and it must be registered with Register() on both the encoder and the
+// decoder side. Encoders use the dictionary when the "symbol_dictionary_id"
+// option is set (see SetSymbolEncodingDictionary() in symbol_encoding.h) and
+// the dictionary is expected to produce smaller data than a table stored in
+// the stream. Decoders look up the dictionary by the id stored in the stream.
+// The dictionary can be stored and loaded using Encode() and Decode().
+class SymbolDictionary {
+ public:
+  // Probability table of the dictionary.
+  struct Table {
+    // Bit length used to select the rANS precision (see
+    // ComputeRAnsPrecisionFromUniqueSymbolsBitLength()).
+    int unique_symbols_bit_length;
+    // Frequencies of all symbols. All frequencies are non-zero.
+    std::vector<uint64_t> frequencies;
+    // Bit length followed by the probability table in the format of the raw
+    // symbol coding. Used to initialize the rANS decoder.
+    std::vector<char> encoded_table;
+  };
+
+  explicit SymbolDictionary(uint32_t id);
+
+  // Adds frequencies of |num_values| |symbols| to |frequencies|. The vector is
+  // resized as needed.
+  static void AccumulateFrequencies(const uint32_t *symbols, int num_values,
+                                    std::vector<uint64_t> *frequencies);
+
+  // Adds a probability table computed from symbol |frequencies|. Symbols with
+  // zero frequency get the frequency of one so that the table can encode any
+  // symbol smaller than frequencies.size(). Returns the id of the new table or
+  // -1 on error.
+  int AddTable(const std::vector<uint64_t> &frequencies);
+
+  uint32_t id() const { return id_; }
+  int num_tables() const { return static_cast<int>(tables_.size()); }
+  const Table &table(int table_id) const { return tables_[table_id]; }
+
+  // Stores the dictionary into |out_buffer|.
+  bool Encode(EncoderBuffer *out_buffer) const;
+
+  // Loads a dictionary stored with Encode().
+  static std::unique_ptr<SymbolDictionary> Decode(DecoderBuffer *in_buffer);
+
+  // Makes |dictionary| available to all symbol encoders and decoders. Fails
+  // when another dictionary with the same id is registered.
+  static bool Register(std::shared_ptr<const SymbolDictionary> dictionary);
+
+  // Removes the registered dictionary with |id|.
+  static void Unregister(uint32_t id);
+
+  // Returns the registered dictionary with |id| or nullptr.
+  static std::shared_ptr<const SymbolDictionary> Find(uint32_t id);
+
+ private:
+  uint32_t id_;
+  std::vector<Table> tables_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_ENTROPY_SYMBOL_DICTIONARY_H_
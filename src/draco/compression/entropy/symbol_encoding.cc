@@ -16,22 +16,45 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "draco/compression/entropy/rans_symbol_encoder.h"
 #include "draco/compression/entropy/shannon_entropy.h"
+#include "draco/compression/entropy/symbol_dictionary.h"
 #include "draco/core/bit_utils.h"
 #include "draco/core/macros.h"
+#include "draco/core/varint_encoding.h"
 
 namespace draco {
 
 constexpr int32_t kMaxTagSymbolBitLength = 32;
 constexpr int kMaxRawEncodingBitLength = 18;
 constexpr int kDefaultSymbolCodingCompressionLevel = 7;
+// Number of interleaved rANS streams used by SYMBOL_CODING_RAW_INTERLEAVED.
+// Inputs with fewer values use fewer streams to limit the per-stream overhead.
+constexpr int kMaxNumInterleavedStreams = 8;
+constexpr int kMinNumInterleavedStreams = 4;
+constexpr int kMinValuesPerInterleavedStream = 256;
 
-typedef uint64_t TaggedBitLengthFrequencies[kMaxTagSymbolBitLength];
+// Frequencies of bit lengths indexed directly by the bit length [0-32].
+typedef uint64_t TaggedBitLengthFrequencies[kMaxTagSymbolBitLength + 1];
+
+// Keys of the symbol encoding options. The names are interned only once (see
+// OptionKey), because the options are read for every encoded symbol stream.
+struct SymbolEncodingOptionKeys {
+  const OptionKey compression_level{"symbol_encoding_compression_level"};
+  const OptionKey dictionary_id{"symbol_dictionary_id"};
+  const OptionKey interleaved{"symbol_encoding_interleaved"};
+  const OptionKey method{"symbol_encoding_method"};
+};
+
+static const SymbolEncodingOptionKeys &GetSymbolEncodingOptionKeys() {
+  static const SymbolEncodingOptionKeys keys;
+  return keys;
+}
 
 void SetSymbolEncodingMethod(Options *options, SymbolCodingMethod method) {
-  options->SetInt("symbol_encoding_method", method);
+  options->SetInt(GetSymbolEncodingOptionKeys().method, method);
 }
 
 bool SetSymbolEncodingCompressionLevel(Options *options,
@@ -39,10 +62,20 @@ bool SetSymbolEncodingCompressionLevel(Options *options,
   if (compression_level < 0 || compression_level > 10) {
     return false;
   }
-  options->SetInt("symbol_encoding_compression_level", compression_level);
+  options->SetInt(GetSymbolEncodingOptionKeys().compression_level,
+                  compression_level);
   return true;
 }
 
+void SetSymbolEncodingInterleaved(Options *options, bool interleaved) {
+  options->SetBool(GetSymbolEncodingOptionKeys().interleaved, interleaved);
+}
+
+void SetSymbolEncodingDictionary(Options *options, uint32_t dictionary_id) {
+  options->SetInt(GetSymbolEncodingOptionKeys().dictionary_id,
+                  static_cast<int>(dictionary_id));
+}
+
 // Computes bit lengths of the input values. If num_components > 1, the values
 // are processed in "num_components" sized chunks and the bit length is always
 // computed for the largest value from the chunk.
@@ -102,15 +135,56 @@ static int64_t ApproximateRawSchemeBits(const uint32_t *symbols,
   return table_bits + data_bits;
 }
 
+// Finds the table of |dictionary| that encodes |symbols| with the fewest bits.
+// Returns the table id or -1 when no table can encode all symbols.
+static int FindBestDictionaryTable(const uint32_t *symbols, int num_symbols,
+                                   uint32_t max_value,
+                                   const SymbolDictionary &dictionary,
+                                   int64_t *out_num_bits) {
+  std::vector<uint64_t> frequencies;
+  SymbolDictionary::AccumulateFrequencies(symbols, num_symbols, &frequencies);
+  int best_table_id = -1;
+  for (int t = 0; t < dictionary.num_tables(); ++t) {
+    const std::vector<uint64_t> &table_frequencies =
+        dictionary.table(t).frequencies;
+    if (max_value >= table_frequencies.size()) {
+      continue;
+    }
+    uint64_t total_frequency = 0;
+    for (const uint64_t frequency : table_frequencies) {
+      total_frequency += frequency;
+    }
+    double num_bits = 0;
+    for (size_t i = 0; i < frequencies.size(); ++i) {
+      if (frequencies[i] > 0) {
+        num_bits -= frequencies[i] *
+                    std::log2(static_cast<double>(table_frequencies[i]) /
+                              total_frequency);
+      }
+    }
+    const int64_t table_bits = static_cast<int64_t>(std::ceil(num_bits));
+    if (best_table_id == -1 || table_bits < *out_num_bits) {
+      best_table_id = t;
+      *out_num_bits = table_bits;
+    }
+  }
+  return best_table_id;
+}
+
 template <template <int> class SymbolEncoderT>
 bool EncodeTaggedSymbols(const uint32_t *symbols, int num_values,
                          int num_components,
                          const std::vector<uint32_t> &bit_lengths,
                          EncoderBuffer *target_buffer);
 
+// Encodes symbols using the raw scheme. When |num_streams| is greater than
+// zero, the symbols are split into |num_streams| interleaved rANS streams.
+// When |table| is not null, the symbols are encoded using the probabilities
+// of the dictionary table that is not stored in |target_buffer|.
 template <template <int> class SymbolEncoderT>
 bool EncodeRawSymbols(const uint32_t *symbols, int num_values,
                       uint32_t max_entry_value, int32_t num_unique_symbols,
+                      int num_streams, const SymbolDictionary::Table *table,
                       const Options *options, EncoderBuffer *target_buffer);
 
 bool EncodeSymbols(const uint32_t *symbols, int num_values, int num_components,
@@ -134,24 +208,56 @@ bool EncodeSymbols(const uint32_t *symbols, int num_values, int num_components,
   const int64_t tagged_scheme_total_bits =
       ApproximateTaggedSchemeBits(bit_lengths, num_components);
 
-  // Approximate number of bits needed for storing the symbols using the raw
-  // scheme.
-  int num_unique_symbols = 0;
-  const int64_t raw_scheme_total_bits = ApproximateRawSchemeBits(
-      symbols, num_values, max_value, &num_unique_symbols);
-
   // The maximum bit length of a single entry value that we can encode using
   // the raw scheme.
   const int max_value_bit_length =
       MostSignificantBit(std::max(1u, max_value)) + 1;
 
+  // Approximate number of bits needed for storing the symbols using the raw
+  // scheme. The approximation uses a histogram of all values up to
+  // |max_value|, so it is skipped when the raw scheme can't be selected
+  // anyway.
+  const SymbolEncodingOptionKeys &keys = GetSymbolEncodingOptionKeys();
+  int num_unique_symbols = 0;
+  int64_t raw_scheme_total_bits = std::numeric_limits<int64_t>::max();
+  if (max_value_bit_length <= kMaxRawEncodingBitLength ||
+      (options != nullptr && options->IsOptionSet(keys.method))) {
+    raw_scheme_total_bits = ApproximateRawSchemeBits(
+        symbols, num_values, max_value, &num_unique_symbols);
+  }
+
+  // Find the best table of the dictionary, if any.
+  std::shared_ptr<const SymbolDictionary> dictionary;
+  int dictionary_table_id = -1;
+  int64_t dictionary_scheme_total_bits = 0;
+  if (options != nullptr && options->IsOptionSet(keys.dictionary_id)) {
+    dictionary = SymbolDictionary::Find(
+        static_cast<uint32_t>(options->GetInt(keys.dictionary_id)));
+    if (dictionary != nullptr) {
+      dictionary_table_id =
+          FindBestDictionaryTable(symbols, num_values, max_value, *dictionary,
+                                  &dictionary_scheme_total_bits);
+    }
+  }
+
   int method = -1;
-  if (options != nullptr && options->IsOptionSet("symbol_encoding_method")) {
-    method = options->GetInt("symbol_encoding_method");
+  if (options != nullptr && options->IsOptionSet(keys.method)) {
+    method = options->GetInt(keys.method);
+    if (method == SYMBOL_CODING_RAW_DICTIONARY && dictionary_table_id < 0) {
+      // No table of the dictionary can encode the symbols.
+      method = SYMBOL_CODING_RAW;
+    }
   } else {
-    if (tagged_scheme_total_bits < raw_scheme_total_bits ||
-        max_value_bit_length > kMaxRawEncodingBitLength) {
+    if (dictionary_table_id >= 0 &&
+        dictionary_scheme_total_bits <
+            std::min(tagged_scheme_total_bits, raw_scheme_total_bits)) {
+      method = SYMBOL_CODING_RAW_DICTIONARY;
+    } else if (tagged_scheme_total_bits < raw_scheme_total_bits ||
+               max_value_bit_length > kMaxRawEncodingBitLength) {
       method = SYMBOL_CODING_TAGGED;
+    } else if (options != nullptr &&
+               options->GetBool(keys.interleaved, false)) {
+      method = SYMBOL_CODING_RAW_INTERLEAVED;
     } else {
       method = SYMBOL_CODING_RAW;
     }
@@ -163,9 +269,25 @@ bool EncodeSymbols(const uint32_t *symbols, int num_values, int num_components,
         symbols, num_values, num_components, bit_lengths, target_buffer);
   }
   if (method == SYMBOL_CODING_RAW) {
-    return EncodeRawSymbols<RAnsSymbolEncoder>(symbols, num_values, max_value,
-                                               num_unique_symbols, options,
-                                               target_buffer);
+    return EncodeRawSymbols<RAnsSymbolEncoder>(
+        symbols, num_values, max_value, num_unique_symbols, 0, nullptr,
+        options, target_buffer);
+  }
+  if (method == SYMBOL_CODING_RAW_INTERLEAVED) {
+    const int num_streams =
+        num_values >= kMaxNumInterleavedStreams * kMinValuesPerInterleavedStream
+            ? kMaxNumInterleavedStreams
+            : kMinNumInterleavedStreams;
+    return EncodeRawSymbols<RAnsSymbolEncoder>(
+        symbols, num_values, max_value, num_unique_symbols, num_streams,
+        nullptr, options, target_buffer);
+  }
+  if (method == SYMBOL_CODING_RAW_DICTIONARY) {
+    EncodeVarint(dictionary->id(), target_buffer);
+    EncodeVarint(static_cast<uint32_t>(dictionary_table_id), target_buffer);
+    return EncodeRawSymbols<RAnsSymbolEncoder>(
+        symbols, num_values, max_value, num_unique_symbols, 0,
+        &dictionary->table(dictionary_table_id), options, target_buffer);
   }
   // Unknown method selected.
   return false;
@@ -178,9 +300,9 @@ bool EncodeTaggedSymbols(const uint32_t *symbols, int num_values,
                          EncoderBuffer *target_buffer) {
   // Create entries for entropy coding. Each entry corresponds to a different
   // number of bits that are necessary to encode a given value. Every value
-  // has at most 32 bits. Therefore, we need 32 different entries (for
-  // bit_length [1-32]). For each entry we compute the frequency of a given
-  // bit-length in our data set.
+  // has at most 32 bits. Therefore, we need entries for bit_length [1-32],
+  // which are indexed directly by the bit length. For each entry we compute
+  // the frequency of a given bit-length in our data set.
   TaggedBitLengthFrequencies frequencies;
   // Set frequency for each entry to zero.
   memset(frequencies, 0, sizeof(frequencies));
@@ -201,7 +323,7 @@ bool EncodeTaggedSymbols(const uint32_t *symbols, int num_values,
 
   // Create encoder for encoding the bit tags.
   SymbolEncoderT<5> tag_encoder;
-  tag_encoder.Create(frequencies, kMaxTagSymbolBitLength, target_buffer);
+  tag_encoder.Create(frequencies, kMaxTagSymbolBitLength + 1, target_buffer);
 
   // Start encoding bit tags.
   tag_encoder.StartEncoding(target_buffer);
@@ -244,17 +366,50 @@ bool EncodeTaggedSymbols(const uint32_t *symbols, int num_values,
 
 template <class SymbolEncoderT>
 bool EncodeRawSymbolsInternal(const uint32_t *symbols, int num_values,
-                              uint32_t max_entry_value,
+                              uint32_t max_entry_value, int num_streams,
+                              const SymbolDictionary::Table *table,
                               EncoderBuffer *target_buffer) {
-  // Count the frequency of each entry value.
-  std::vector<uint64_t> frequencies(max_entry_value + 1, 0);
-  for (int i = 0; i < num_values; ++i) {
-    ++frequencies[symbols[i]];
-  }
-
   SymbolEncoderT encoder;
-  encoder.Create(frequencies.data(), static_cast<int>(frequencies.size()),
-                 target_buffer);
+  if (table != nullptr) {
+    // The probability table is known to the decoder.
+    EncoderBuffer table_buffer;
+    if (!encoder.Create(table->frequencies.data(),
+                        static_cast<int>(table->frequencies.size()),
+                        &table_buffer)) {
+      return false;
+    }
+  } else {
+    // Count the frequency of each entry value.
+    std::vector<uint64_t> frequencies(max_entry_value + 1, 0);
+    for (int i = 0; i < num_values; ++i) {
+      ++frequencies[symbols[i]];
+    }
+    encoder.Create(frequencies.data(), static_cast<int>(frequencies.size()),
+                   target_buffer);
+  }
+  if (num_streams > 0) {
+    // All streams share the same probability table. The i-th symbol is stored
+    // in the stream i % |num_streams|.
+    target_buffer->Encode(static_cast<uint8_t>(num_streams));
+    for (int s = 0; s < num_streams; ++s) {
+      encoder.StartEncoding(target_buffer);
+      if (s < num_values) {
+        // Index of the last symbol of the stream.
+        const int last = s + (num_values - 1 - s) / num_streams * num_streams;
+        if (SymbolEncoderT::needs_reverse_encoding()) {
+          for (int i = last; i >= 0; i -= num_streams) {
+            encoder.EncodeSymbol(symbols[i]);
+          }
+        } else {
+          for (int i = s; i <= last; i += num_streams) {
+            encoder.EncodeSymbol(symbols[i]);
+          }
+        }
+      }
+      encoder.EndEncoding(target_buffer);
+    }
+    return true;
+  }
   encoder.StartEncoding(target_buffer);
   // Encode all values.
   if (SymbolEncoderT::needs_reverse_encoding()) {
@@ -270,107 +425,145 @@ bool EncodeRawSymbolsInternal(const uint32_t *symbols, int num_values,
   return true;
 }
 
+// Encodes symbols using the raw scheme with a symbol encoder selected by
+// |unique_symbols_bit_length|.
 template <template <int> class SymbolEncoderT>
-bool EncodeRawSymbols(const uint32_t *symbols, int num_values,
-                      uint32_t max_entry_value, int32_t num_unique_symbols,
-                      const Options *options, EncoderBuffer *target_buffer) {
-  int symbol_bits = 0;
-  if (num_unique_symbols > 0) {
-    symbol_bits = MostSignificantBit(num_unique_symbols);
-  }
-  int unique_symbols_bit_length = symbol_bits + 1;
-  // Currently, we don't support encoding of more than 2^18 unique symbols.
-  if (unique_symbols_bit_length > kMaxRawEncodingBitLength) {
-    return false;
-  }
-  int compression_level = kDefaultSymbolCodingCompressionLevel;
-  if (options != nullptr &&
-      options->IsOptionSet("symbol_encoding_compression_level")) {
-    compression_level = options->GetInt("symbol_encoding_compression_level");
-  }
-
-  // Adjust the bit_length based on compression level. Lower compression levels
-  // will use fewer bits while higher compression levels use more bits. Note
-  // that this is going to work for all valid bit_lengths because the actual
-  // number of bits allocated for rANS encoding is hard coded as:
-  // std::max(12, 3 * bit_length / 2) , therefore there will be always a
-  // sufficient number of bits available for all symbols.
-  // See ComputeRAnsPrecisionFromUniqueSymbolsBitLength() for the formula.
-  // This hardcoded equation cannot be changed without changing the bitstream.
-  if (compression_level < 4) {
-    unique_symbols_bit_length -= 2;
-  } else if (compression_level < 6) {
-    unique_symbols_bit_length -= 1;
-  } else if (compression_level > 9) {
-    unique_symbols_bit_length += 2;
-  } else if (compression_level > 7) {
-    unique_symbols_bit_length += 1;
-  }
-  // Clamp the bit_length to a valid range.
-  unique_symbols_bit_length = std::min(std::max(1, unique_symbols_bit_length),
-                                       kMaxRawEncodingBitLength);
-  target_buffer->Encode(static_cast<uint8_t>(unique_symbols_bit_length));
+bool EncodeRawSymbolsWithBitLength(int unique_symbols_bit_length,
+                                   const uint32_t *symbols, int num_values,
+                                   uint32_t max_entry_value, int num_streams,
+                                   const SymbolDictionary::Table *table,
+                                   EncoderBuffer *target_buffer) {
   // Use appropriate symbol encoder based on the maximum symbol bit length.
   switch (unique_symbols_bit_length) {
     case 0:
       FALLTHROUGH_INTENDED;
     case 1:
       return EncodeRawSymbolsInternal<SymbolEncoderT<1>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 2:
       return EncodeRawSymbolsInternal<SymbolEncoderT<2>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 3:
       return EncodeRawSymbolsInternal<SymbolEncoderT<3>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 4:
       return EncodeRawSymbolsInternal<SymbolEncoderT<4>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 5:
       return EncodeRawSymbolsInternal<SymbolEncoderT<5>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 6:
       return EncodeRawSymbolsInternal<SymbolEncoderT<6>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 7:
       return EncodeRawSymbolsInternal<SymbolEncoderT<7>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 8:
       return EncodeRawSymbolsInternal<SymbolEncoderT<8>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 9:
       return EncodeRawSymbolsInternal<SymbolEncoderT<9>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 10:
       return EncodeRawSymbolsInternal<SymbolEncoderT<10>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 11:
       return EncodeRawSymbolsInternal<SymbolEncoderT<11>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 12:
       return EncodeRawSymbolsInternal<SymbolEncoderT<12>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 13:
       return EncodeRawSymbolsInternal<SymbolEncoderT<13>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 14:
       return EncodeRawSymbolsInternal<SymbolEncoderT<14>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 15:
       return EncodeRawSymbolsInternal<SymbolEncoderT<15>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 16:
       return EncodeRawSymbolsInternal<SymbolEncoderT<16>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 17:
       return EncodeRawSymbolsInternal<SymbolEncoderT<17>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     case 18:
       return EncodeRawSymbolsInternal<SymbolEncoderT<18>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_streams, table,
+          target_buffer);
     default:
       return false;
   }
 }
 
+template <template <int> class SymbolEncoderT>
+bool EncodeRawSymbols(const uint32_t *symbols, int num_values,
+                      uint32_t max_entry_value, int32_t num_unique_symbols,
+                      int num_streams, const SymbolDictionary::Table *table,
+                      const Options *options, EncoderBuffer *target_buffer) {
+  if (table != nullptr) {
+    return EncodeRawSymbolsWithBitLength<SymbolEncoderT>(
+        table->unique_symbols_bit_length, symbols, num_values, max_entry_value,
+        num_streams, table, target_buffer);
+  }
+  int symbol_bits = 0;
+  if (num_unique_symbols > 0) {
+    symbol_bits = MostSignificantBit(num_unique_symbols);
+  }
+  int unique_symbols_bit_length = symbol_bits + 1;
+  // Currently, we don't support encoding of more than 2^18 unique symbols.
+  if (unique_symbols_bit_length > kMaxRawEncodingBitLength) {
+    return false;
+  }
+  int compression_level = kDefaultSymbolCodingCompressionLevel;
+  const OptionKey &compression_level_key =
+      GetSymbolEncodingOptionKeys().compression_level;
+  if (options != nullptr && options->IsOptionSet(compression_level_key)) {
+    compression_level = options->GetInt(compression_level_key);
+  }
+
+  // Adjust the bit_length based on compression level. Lower compression levels
+  // will use fewer bits while higher compression levels use more bits. Note
+  // that this is going to work for all valid bit_lengths because the actual
+  // number of bits allocated for rANS encoding is hard coded as:
+  // std::max(12, 3 * bit_length / 2) , therefore there will be always a
+  // sufficient number of bits available for all symbols.
+  // See ComputeRAnsPrecisionFromUniqueSymbolsBitLength() for the formula.
+  // This hardcoded equation cannot be changed without changing the bitstream.
+  if (compression_level < 4) {
+    unique_symbols_bit_length -= 2;
+  } else if (compression_level < 6) {
+    unique_symbols_bit_length -= 1;
+  } else if (compression_level > 9) {
+    unique_symbols_bit_length += 2;
+  } else if (compression_level > 7) {
+    unique_symbols_bit_length += 1;
+  }
+  // Clamp the bit_length to a valid range.
+  unique_symbols_bit_length = std::min(std::max(1, unique_symbols_bit_length),
+                                       kMaxRawEncodingBitLength);
+  target_buffer->Encode(static_cast<uint8_t>(unique_symbols_bit_length));
+  return EncodeRawSymbolsWithBitLength<SymbolEncoderT>(
+      unique_symbols_bit_length, symbols, num_values, max_entry_value,
+      num_streams, nullptr, target_buffer);
+}
+
 }  // namespace draco
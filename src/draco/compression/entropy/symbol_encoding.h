@@ -42,6 +42,19 @@ void SetSymbolEncodingMethod(Options *options, SymbolCodingMethod method);
 // Returns false if an invalid level has been set.
 bool SetSymbolEncodingCompressionLevel(Options *options, int compression_level);
 
+// Sets an option that makes the symbol encoder use interleaved rANS streams
+// (SYMBOL_CODING_RAW_INTERLEAVED) whenever it would otherwise automatically
+// select the SYMBOL_CODING_RAW method. Interleaved streams are faster to decode
+// but they are not supported by older decoders.
+void SetSymbolEncodingInterleaved(Options *options, bool interleaved);
+
+// Sets an option that makes the symbol encoder use the probability tables of
+// the registered SymbolDictionary with |dictionary_id| (see
+// symbol_dictionary.h) whenever they are expected to produce smaller data than
+// the automatically selected method. The dictionary must also be registered
+// when the data is decoded.
+void SetSymbolEncodingDictionary(Options *options, uint32_t dictionary_id);
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ENTROPY_SYMBOL_ENCODING_H_
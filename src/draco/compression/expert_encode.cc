@@ -20,10 +20,13 @@
 #include <string>
 #include <utility>
 
+#include "draco/compression/attributes/attribute_quantization_selector.h"
 #include "draco/compression/mesh/mesh_edgebreaker_encoder.h"
 #include "draco/compression/mesh/mesh_sequential_encoder.h"
 #ifdef DRACO_POINT_CLOUD_COMPRESSION_SUPPORTED
 #include "draco/compression/point_cloud/point_cloud_kd_tree_encoder.h"
+#include "draco/compression/point_cloud/point_cloud_chunked_sequential_encoder.h"
+#include "draco/compression/point_cloud/point_cloud_morton_order_encoder.h"
 #include "draco/compression/point_cloud/point_cloud_sequential_encoder.h"
 #endif
 
@@ -33,15 +36,22 @@
 namespace draco {
 
 ExpertEncoder::ExpertEncoder(const PointCloud &point_cloud)
-    : point_cloud_(&point_cloud), mesh_(nullptr) {}
+    : point_cloud_(&point_cloud),
+      mesh_(nullptr),
+      plan_(nullptr),
+      analysis_(nullptr) {}
 
 ExpertEncoder::ExpertEncoder(const Mesh &mesh)
-    : point_cloud_(&mesh), mesh_(&mesh) {}
+    : point_cloud_(&mesh), mesh_(&mesh), plan_(nullptr), analysis_(nullptr) {}
 
 Status ExpertEncoder::EncodeToBuffer(EncoderBuffer *out_buffer) {
   if (point_cloud_ == nullptr) {
     return Status(Status::DRACO_ERROR, "Invalid input geometry.");
   }
+  if (analysis_ != nullptr && analysis_->mesh() != mesh_) {
+    return Status(Status::DRACO_ERROR,
+                  "Encode analysis does not match the input geometry.");
+  }
   if (mesh_ == nullptr) {
     return EncodePointCloudToBuffer(*point_cloud_, out_buffer);
   }
@@ -51,18 +61,34 @@ Status ExpertEncoder::EncodeToBuffer(EncoderBuffer *out_buffer) {
 Status ExpertEncoder::EncodePointCloudToBuffer(const PointCloud &pc,
                                                EncoderBuffer *out_buffer) {
 #ifdef DRACO_POINT_CLOUD_COMPRESSION_SUPPORTED
+  std::unique_ptr<EncodePlan> own_plan;
+  const EncodePlan *plan = plan_;
+  if (plan != nullptr) {
+    DRACO_RETURN_IF_ERROR(CheckEncodePlan(pc));
+  } else {
 #ifdef DRACO_TRANSCODER_SUPPORTED
-  // Apply DracoCompressionOptions associated with the point cloud.
-  DRACO_RETURN_IF_ERROR(ApplyCompressionOptions(pc));
+    // Apply DracoCompressionOptions associated with the point cloud.
+    DRACO_RETURN_IF_ERROR(ApplyCompressionOptions(pc));
 #endif  // DRACO_TRANSCODER_SUPPORTED
+    DRACO_RETURN_IF_ERROR(AttributeQuantizationSelector::SelectQuantizationBits(
+        pc, nullptr, &options()));
+    own_plan.reset(new EncodePlan(options(), pc));
+    plan = own_plan.get();
+  }
 
   std::unique_ptr<PointCloudEncoder> encoder;
-  const int encoding_method = options().GetGlobalInt("encoding_method", -1);
+  const int encoding_method = plan->encoding_method();
 
   if (encoding_method == POINT_CLOUD_SEQUENTIAL_ENCODING) {
     // Use sequential encoding if requested.
     encoder.reset(new PointCloudSequentialEncoder());
-  } else if (encoding_method == -1 && options().GetSpeed() == 10) {
+  } else if (encoding_method == POINT_CLOUD_MORTON_ORDER_ENCODING) {
+    // Use sequential encoding of spatially sorted points if requested.
+    encoder.reset(new PointCloudMortonOrderEncoder());
+  } else if (encoding_method == POINT_CLOUD_CHUNKED_SEQUENTIAL_ENCODING) {
+    // Use sequential encoding of independent blocks if requested.
+    encoder.reset(new PointCloudChunkedSequentialEncoder());
+  } else if (encoding_method == -1 && plan->speed() == 10) {
     // Use sequential encoding if speed is at max.
     encoder.reset(new PointCloudSequentialEncoder());
   } else {
@@ -81,7 +107,7 @@ Status ExpertEncoder::EncodePointCloudToBuffer(const PointCloud &pc,
         kd_tree_possible = false;
       }
       if (kd_tree_possible && att->data_type() == DT_FLOAT32 &&
-          options().GetAttributeInt(i, "quantization_bits", -1) <= 0) {
+          plan->attribute(i).quantization_bits <= 0) {
         kd_tree_possible = false;  // Quantization not enabled.
       }
       if (!kd_tree_possible) {
@@ -103,6 +129,7 @@ Status ExpertEncoder::EncodePointCloudToBuffer(const PointCloud &pc,
     encoder.reset(new PointCloudSequentialEncoder());
   }
   encoder->SetPointCloud(pc);
+  encoder->SetEncodePlan(plan);
   DRACO_RETURN_IF_ERROR(encoder->Encode(options(), out_buffer));
 
   set_num_encoded_points(encoder->num_encoded_points());
@@ -115,17 +142,35 @@ Status ExpertEncoder::EncodePointCloudToBuffer(const PointCloud &pc,
 
 Status ExpertEncoder::EncodeMeshToBuffer(const Mesh &m,
                                          EncoderBuffer *out_buffer) {
+  std::unique_ptr<EncodePlan> own_plan;
+  const EncodePlan *plan = plan_;
+  if (plan != nullptr) {
+    DRACO_RETURN_IF_ERROR(CheckEncodePlan(m));
+  } else {
 #ifdef DRACO_TRANSCODER_SUPPORTED
-  // Apply DracoCompressionOptions associated with the mesh.
-  DRACO_RETURN_IF_ERROR(ApplyCompressionOptions(m));
+    // Apply DracoCompressionOptions associated with the mesh.
+    DRACO_RETURN_IF_ERROR(ApplyCompressionOptions(m));
 #endif  // DRACO_TRANSCODER_SUPPORTED
 
+    const float normals_crease_angle = options().GetGlobalFloat(
+        GetEncoderOptionKeys().generated_normals_crease_angle, -1.f);
+    if (normals_crease_angle >= 0.f &&
+        m.NumNamedAttributes(GeometryAttribute::NORMAL) > 0) {
+      return EncodeMeshWithGeneratedNormals(m, normals_crease_angle,
+                                            out_buffer);
+    }
+    DRACO_RETURN_IF_ERROR(AttributeQuantizationSelector::SelectQuantizationBits(
+        m, &m, &options()));
+    own_plan.reset(new EncodePlan(options(), m));
+    plan = own_plan.get();
+  }
+
   std::unique_ptr<MeshEncoder> encoder;
   // Select the encoding method only based on the provided options.
-  int encoding_method = options().GetGlobalInt("encoding_method", -1);
+  int encoding_method = plan->encoding_method();
   if (encoding_method == -1) {
     // For now select the edgebreaker for all options expect of speed 10
-    if (options().GetSpeed() == 10) {
+    if (plan->speed() == 10) {
       encoding_method = MESH_SEQUENTIAL_ENCODING;
     } else {
       encoding_method = MESH_EDGEBREAKER_ENCODING;
@@ -137,6 +182,11 @@ Status ExpertEncoder::EncodeMeshToBuffer(const Mesh &m,
     encoder = std::unique_ptr<MeshEncoder>(new MeshSequentialEncoder());
   }
   encoder->SetMesh(m);
+  encoder->SetEncodePlan(plan);
+  // The analysis is not used when a modified copy of the mesh is encoded.
+  if (analysis_ != nullptr && analysis_->mesh() == &m) {
+    encoder->SetEncodeAnalysis(analysis_);
+  }
 
   DRACO_RETURN_IF_ERROR(encoder->Encode(options(), out_buffer));
 
@@ -145,6 +195,69 @@ Status ExpertEncoder::EncodeMeshToBuffer(const Mesh &m,
   return OkStatus();
 }
 
+Status ExpertEncoder::CheckEncodePlan(const PointCloud &pc) const {
+  if (!plan_->IsCompatible(pc)) {
+    return Status(Status::DRACO_ERROR,
+                  "Encode plan does not match the input geometry.");
+  }
+  if (plan_->has_geometry_dependent_options()) {
+    return Status(Status::DRACO_ERROR,
+                  "Encode plan can not resolve geometry dependent options.");
+  }
+#ifdef DRACO_TRANSCODER_SUPPORTED
+  if (pc.IsCompressionEnabled()) {
+    return Status(Status::DRACO_ERROR,
+                  "Encode plan can not be used with compression options stored "
+                  "in the geometry.");
+  }
+#endif  // DRACO_TRANSCODER_SUPPORTED
+  return OkStatus();
+}
+
+Status ExpertEncoder::EncodeMeshWithGeneratedNormals(
+    const Mesh &m, float crease_angle, EncoderBuffer *out_buffer) {
+  // Copy the mesh without normals. Options of the attributes are moved to
+  // their new ids.
+  const EncoderOptions original_options = options();
+  Mesh mesh;
+  mesh.SetNumFaces(m.num_faces());
+  for (FaceIndex f(0); f < m.num_faces(); ++f) {
+    mesh.SetFace(f, m.face(f));
+  }
+  mesh.set_num_points(m.num_points());
+  std::unique_ptr<GeometryMetadata> metadata(
+      m.GetMetadata() != nullptr ? new GeometryMetadata(*m.GetMetadata())
+                                 : new GeometryMetadata());
+  for (int i = 0; i < m.num_attributes(); ++i) {
+    const PointAttribute *const src_att = m.attribute(i);
+    if (src_att->attribute_type() == GeometryAttribute::NORMAL) {
+      metadata->DeleteAttributeMetadataByUniqueId(src_att->unique_id());
+      continue;
+    }
+    std::unique_ptr<PointAttribute> att(new PointAttribute());
+    att->CopyFrom(*src_att);
+    const int att_id = mesh.AddAttribute(std::move(att));
+    mesh.attribute(att_id)->set_unique_id(src_att->unique_id());
+    const Options *const att_options =
+        original_options.FindAttributeOptions(i);
+    options().SetAttributeOptions(
+        att_id, att_options != nullptr ? *att_options : Options());
+  }
+  for (int i = mesh.num_attributes(); i < m.num_attributes(); ++i) {
+    options().SetAttributeOptions(i, Options());
+  }
+#ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
+  // Points that differed only in their normals are merged.
+  mesh.DeduplicatePointIds(options().thread_pool());
+#endif
+  metadata->AddEntryDouble(kGeneratedNormalsCreaseAngleMetadataName,
+                           crease_angle);
+  mesh.AddMetadata(std::move(metadata));
+  const Status status = EncodeMeshToBuffer(mesh, out_buffer);
+  Reset(original_options);
+  return status;
+}
+
 void ExpertEncoder::Reset(const EncoderOptions &options) {
   Base::Reset(options);
 }
@@ -173,10 +286,42 @@ void ExpertEncoder::SetAttributeExplicitQuantization(int32_t attribute_id,
   options().SetAttributeFloat(attribute_id, "quantization_range", range);
 }
 
+void ExpertEncoder::SetAttributeMaxQuantizationError(int32_t attribute_id,
+                                                     float max_error) {
+  options().SetAttributeFloat(attribute_id, "max_quantization_error",
+                              max_error);
+}
+
+void ExpertEncoder::SetAttributeMaxTexelQuantizationError(
+    int32_t attribute_id, float max_texel_error, int texture_width,
+    int texture_height) {
+  const int texture_size[2] = {texture_width, texture_height};
+  options().SetAttributeFloat(attribute_id, "max_quantization_error",
+                              max_texel_error);
+  options().SetAttributeVector(attribute_id,
+                               "max_quantization_error_texture_size", 2,
+                               texture_size);
+}
+
 void ExpertEncoder::SetUseBuiltInAttributeCompression(bool enabled) {
   options().SetGlobalBool("use_built_in_attribute_compression", enabled);
 }
 
+void ExpertEncoder::SetAttributeDeltaCoding(int32_t attribute_id,
+                                            bool enabled) {
+  options().SetAttributeBool(attribute_id, "delta_coding", enabled);
+}
+
+void ExpertEncoder::SetAttributeLosslessFloatCoding(int32_t attribute_id,
+                                                    bool enabled) {
+  options().SetAttributeBool(attribute_id, "lossless_float_coding", enabled);
+}
+
+void ExpertEncoder::SetAttributeYCoCgTransform(int32_t attribute_id,
+                                               bool enabled) {
+  options().SetAttributeBool(attribute_id, "ycocg_transform", enabled);
+}
+
 void ExpertEncoder::SetEncodingMethod(int encoding_method) {
   Base::SetEncodingMethod(encoding_method);
 }
@@ -213,8 +358,10 @@ Status ExpertEncoder::ApplyCompressionOptions(const PointCloud &pc) {
                        10 - compression_options.compression_level);
   }
 
+  const OptionKey &quantization_bits_key =
+      GetEncoderOptionKeys().quantization_bits;
   for (int ai = 0; ai < pc.num_attributes(); ++ai) {
-    if (options().IsAttributeOptionSet(ai, "quantization_bits")) {
+    if (options().IsAttributeOptionSet(ai, quantization_bits_key)) {
       continue;  // Don't override options that have been set.
     }
     int quantization_bits = 0;
@@ -251,7 +398,7 @@ Status ExpertEncoder::ApplyCompressionOptions(const PointCloud &pc) {
         break;
     }
     if (quantization_bits > 0) {
-      options().SetAttributeInt(ai, "quantization_bits", quantization_bits);
+      options().SetAttributeInt(ai, quantization_bits_key, quantization_bits);
     }
   }
   return OkStatus();
@@ -279,7 +426,7 @@ Status ExpertEncoder::SetAttributeGridQuantization(const PointCloud &pc,
         "supported only for 3D positions.");
   }
   // Compute quantization properties based on the grid spacing.
-  const auto &bbox = pc.ComputeBoundingBox();
+  const auto &bbox = pc.ComputeBoundingBox(options().thread_pool());
   // Snap min and max points of the |bbox| to the quantization grid vertices.
   Vector3f min_pos;
   int num_values = 0;  // Number of values that we need to encode.
@@ -16,7 +16,9 @@
 #define DRACO_COMPRESSION_EXPERT_ENCODE_H_
 
 #include "draco/compression/config/compression_shared.h"
+#include "draco/compression/config/encode_plan.h"
 #include "draco/compression/config/encoder_options.h"
+#include "draco/compression/encode_analysis.h"
 #include "draco/compression/encode_base.h"
 #include "draco/core/encoder_buffer.h"
 #include "draco/core/status.h"
@@ -45,6 +47,24 @@ class ExpertEncoder : public EncoderBase<EncoderOptions> {
   void Reset(const EncoderOptions &options);
   void Reset();
 
+  // Sets a plan created with EncodePlan(options, geometry) from the options of
+  // this encoder. The geometry is then encoded with the settings of the plan
+  // instead of resolving the options again, which is useful when many
+  // geometries with the same attributes are encoded with the same options. The
+  // plan can not be used with options that are resolved from the encoded
+  // geometry (see EncodePlan::has_geometry_dependent_options()). The plan is
+  // not owned and it may be shared by encoders running on multiple threads.
+  void SetEncodePlan(const EncodePlan *plan) { plan_ = plan; }
+
+  // Sets an analysis of the mesh provided in the constructor. The connectivity
+  // data of the analysis is then reused instead of being recomputed, which is
+  // useful when the same mesh is encoded many times with different options.
+  // The analysis does not change the encoded data. It is not owned and it may
+  // be shared by encoders running on multiple threads.
+  void SetEncodeAnalysis(const EncodeAnalysis *analysis) {
+    analysis_ = analysis;
+  }
+
   // Sets the desired encoding and decoding speed for the given options.
   //
   //  0 = slowest speed, but the best compression.
@@ -75,11 +95,45 @@ class ExpertEncoder : public EncoderBase<EncoderOptions> {
                                         int quantization_bits, int num_dims,
                                         const float *origin, float range);
 
+  // Sets the maximum quantization error of an attribute. The smallest number
+  // of quantization bits that keeps the error of all components within
+  // |max_error| is selected during encoding. For normals, |max_error| is the
+  // maximum angle in radians. See attribute_quantization_selector.h.
+  void SetAttributeMaxQuantizationError(int32_t attribute_id, float max_error);
+
+  // Same as above for texture coordinates, with the error given in texels of
+  // a texture of size |texture_width| x |texture_height|.
+  void SetAttributeMaxTexelQuantizationError(int32_t attribute_id,
+                                             float max_texel_error,
+                                             int texture_width,
+                                             int texture_height);
+
   // Enables/disables built in entropy coding of attribute values. Disabling
   // this option may be useful to improve the performance when third party
   // compression is used on top of the Draco compression. Default: [true].
   void SetUseBuiltInAttributeCompression(bool enabled);
 
+  // Enables/disables lossless delta coding of a 64-bit attribute (DT_INT64,
+  // DT_UINT64 or DT_FLOAT64). Each value is predicted from the previous value
+  // in the encoding order, which is useful for slowly changing values such as
+  // GPS time stamps of LiDAR points encoded in scan order. Without delta
+  // coding, 64-bit attributes are stored uncompressed. Default: [false].
+  void SetAttributeDeltaCoding(int32_t attribute_id, bool enabled);
+
+  // Enables/disables bit-exact coding of a DT_FLOAT32 attribute that is not
+  // quantized. The float bit patterns are mapped to ordered integers that are
+  // compressed with the integer prediction schemes. Without this option,
+  // non-quantized float attributes are stored uncompressed. Quantization takes
+  // precedence when both options are set. Default: [false].
+  void SetAttributeLosslessFloatCoding(int32_t attribute_id, bool enabled);
+
+  // Enables/disables the lossless YCoCg-R color transform of a COLOR
+  // attribute with 8-bit or 16-bit integer components. The first three
+  // components are converted to luma and chroma before prediction, which
+  // usually reduces the size of natural colors. Other attributes and float
+  // colors are not affected. Default: [false].
+  void SetAttributeYCoCgTransform(int32_t attribute_id, bool enabled);
+
   // Sets the desired encoding method for a given geometry. By default, encoding
   // method is selected based on the properties of the input geometry and based
   // on the other options selected in the used EncoderOptions (such as desired
@@ -91,6 +145,8 @@ class ExpertEncoder : public EncoderBase<EncoderOptions> {
   // geometry that is going to be encoded. For point clouds, allowed entries are
   //   POINT_CLOUD_SEQUENTIAL_ENCODING
   //   POINT_CLOUD_KD_TREE_ENCODING
+  //   POINT_CLOUD_MORTON_ORDER_ENCODING
+  //   POINT_CLOUD_CHUNKED_SEQUENTIAL_ENCODING
   //
   // For meshes the input can be
   //   MESH_SEQUENTIAL_ENCODING
@@ -126,6 +182,13 @@ class ExpertEncoder : public EncoderBase<EncoderOptions> {
   //      - specialized predictor for tex coordinates.
   //   MESH_PREDICTION_GEOMETRIC_NORMAL
   //      - specialized predictor for normal coordinates.
+  //   MESH_PREDICTION_SKIN
+  //      - specialized predictor for joint indices and joint weights. It is
+  //        never selected automatically.
+  //   MESH_PREDICTION_FEATURE_ID
+  //      - specialized predictor for feature IDs and other values that are
+  //        constant over large regions of the mesh. It is never selected
+  //        automatically.
   //
   // Note that in case the desired prediction cannot be used, the default
   // prediction will be automatically used instead.
@@ -145,6 +208,14 @@ class ExpertEncoder : public EncoderBase<EncoderOptions> {
 
   Status EncodeMeshToBuffer(const Mesh &m, EncoderBuffer *out_buffer);
 
+  // Returns an error when |plan_| can not be used for encoding |pc|.
+  Status CheckEncodePlan(const PointCloud &pc) const;
+
+  // Encodes a copy of |m| without normals and with the crease angle of the
+  // normals generated by the decoder stored in the metadata.
+  Status EncodeMeshWithGeneratedNormals(const Mesh &m, float crease_angle,
+                                        EncoderBuffer *out_buffer);
+
 #ifdef DRACO_TRANSCODER_SUPPORTED
   // Applies compression options stored in |pc|.
   Status ApplyCompressionOptions(const PointCloud &pc);
@@ -153,6 +224,8 @@ class ExpertEncoder : public EncoderBase<EncoderOptions> {
 
   const PointCloud *point_cloud_;
   const Mesh *mesh_;
+  const EncodePlan *plan_;
+  const EncodeAnalysis *analysis_;
 };
 
 }  // namespace draco
@@ -0,0 +1,130 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/geometry_bundle_decoder.h"
+
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "draco/compression/decode.h"
+#include "draco/core/varint_decoding.h"
+
+namespace draco {
+
+GeometryBundleDecoder::GeometryBundleDecoder()
+    : member_data_(nullptr), data_offset_(0) {}
+
+bool GeometryBundleDecoder::IsGeometryBundle(DecoderBuffer *in_buffer) {
+  char magic[5];
+  if (!in_buffer->Peek(magic, sizeof(magic))) {
+    return false;
+  }
+  return memcmp(magic, "DRBND", 5) == 0;
+}
+
+Status GeometryBundleDecoder::DecodeHeader(DecoderBuffer *in_buffer) {
+  member_data_ = nullptr;
+  members_.clear();
+  data_offset_ = 0;
+  const char *const bundle_start = in_buffer->data_head();
+  const int64_t start_size = in_buffer->remaining_size();
+  if (!IsGeometryBundle(in_buffer)) {
+    return Status(Status::DRACO_ERROR, "Not a Draco geometry bundle.");
+  }
+  in_buffer->Advance(5);
+  uint8_t version_major, version_minor;
+  if (!in_buffer->Decode(&version_major) ||
+      !in_buffer->Decode(&version_minor)) {
+    return Status(Status::IO_ERROR, "Failed to parse the bundle header.");
+  }
+  if (version_major != 1) {
+    return Status(Status::UNKNOWN_VERSION, "Unknown geometry bundle version.");
+  }
+  uint32_t num_members;
+  if (!DecodeVarint(&num_members, in_buffer)) {
+    return Status(Status::IO_ERROR, "Failed to parse the bundle header.");
+  }
+  // Each member type and size takes at least one byte each.
+  if (num_members > in_buffer->remaining_size() / 2 ||
+      num_members > static_cast<uint32_t>(std::numeric_limits<int>::max())) {
+    return Status(Status::DRACO_ERROR, "Invalid number of bundle members.");
+  }
+  std::vector<MemberInfo> members(num_members);
+  for (uint32_t i = 0; i < num_members; ++i) {
+    uint8_t type;
+    if (!in_buffer->Decode(&type)) {
+      return Status(Status::IO_ERROR, "Failed to parse the bundle header.");
+    }
+    if (type != POINT_CLOUD && type != TRIANGULAR_MESH) {
+      return Status(Status::DRACO_ERROR, "Invalid bundle member type.");
+    }
+    members[i].type = static_cast<EncodedGeometryType>(type);
+  }
+  int64_t offset = 0;
+  for (uint32_t i = 0; i < num_members; ++i) {
+    uint64_t member_size;
+    if (!DecodeVarint(&member_size, in_buffer)) {
+      return Status(Status::IO_ERROR, "Failed to parse the bundle header.");
+    }
+    if (member_size >
+        static_cast<uint64_t>(std::numeric_limits<int64_t>::max() - offset)) {
+      return Status(Status::DRACO_ERROR, "Invalid bundle member size.");
+    }
+    members[i].offset = offset;
+    members[i].size = static_cast<int64_t>(member_size);
+    offset += members[i].size;
+  }
+  if (offset > in_buffer->remaining_size()) {
+    return Status(Status::IO_ERROR, "Bundle data is truncated.");
+  }
+  data_offset_ = start_size - in_buffer->remaining_size();
+  member_data_ = bundle_start + data_offset_;
+  members_ = std::move(members);
+  in_buffer->Advance(offset);
+  return OkStatus();
+}
+
+Status GeometryBundleDecoder::GetMemberBuffer(int member_id,
+                                              DecoderBuffer *out_buffer) const {
+  if (member_id < 0 || member_id >= num_members()) {
+    return Status(Status::DRACO_ERROR, "Invalid bundle member id.");
+  }
+  out_buffer->Init(member_data_ + members_[member_id].offset,
+                   members_[member_id].size);
+  return OkStatus();
+}
+
+StatusOr<std::unique_ptr<Mesh>> GeometryBundleDecoder::DecodeMesh(
+    int member_id) {
+  DecoderBuffer buffer;
+  DRACO_RETURN_IF_ERROR(GetMemberBuffer(member_id, &buffer));
+  if (members_[member_id].type != TRIANGULAR_MESH) {
+    return Status(Status::DRACO_ERROR, "Bundle member is not a mesh.");
+  }
+  Decoder decoder;
+  *decoder.options() = options_;
+  return decoder.DecodeMeshFromBuffer(&buffer);
+}
+
+StatusOr<std::unique_ptr<PointCloud>> GeometryBundleDecoder::DecodePointCloud(
+    int member_id) {
+  DecoderBuffer buffer;
+  DRACO_RETURN_IF_ERROR(GetMemberBuffer(member_id, &buffer));
+  Decoder decoder;
+  *decoder.options() = options_;
+  return decoder.DecodePointCloudFromBuffer(&buffer);
+}
+
+}  // namespace draco
@@ -0,0 +1,104 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_GEOMETRY_BUNDLE_DECODER_H_
+#define DRACO_COMPRESSION_GEOMETRY_BUNDLE_DECODER_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/config/decoder_options.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/core/status_or.h"
+#include "draco/mesh/mesh.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Decoder for bundles of geometries encoded with GeometryBundleEncoder (see
+// geometry_bundle_encoder.h). The bundle is typically loaded into memory with
+// a single read and its members are decoded on demand:
+//
+//   GeometryBundleDecoder decoder;
+//   DRACO_RETURN_IF_ERROR(decoder.DecodeHeader(&buffer));
+//   DRACO_ASSIGN_OR_RETURN(std::unique_ptr<Mesh> mesh, decoder.DecodeMesh(i));
+//
+class GeometryBundleDecoder {
+ public:
+  GeometryBundleDecoder();
+
+  // Returns true when |in_buffer| starts with a geometry bundle. The buffer
+  // position is not changed.
+  static bool IsGeometryBundle(DecoderBuffer *in_buffer);
+
+  // Decodes the bundle header with the member index from |in_buffer| and
+  // advances the buffer past all member data. The members themselves are not
+  // decoded. The data of |in_buffer| must stay valid until all members of
+  // interest are decoded.
+  Status DecodeHeader(DecoderBuffer *in_buffer);
+
+  // Functions below can be used after a successful call to DecodeHeader().
+
+  // Returns the number of members in the bundle.
+  int num_members() const { return static_cast<int>(members_.size()); }
+
+  // Returns the geometry type of member |member_id|.
+  EncodedGeometryType member_geometry_type(int member_id) const {
+    return members_[member_id].type;
+  }
+
+  // Returns the offset of the data of member |member_id| from the start of
+  // the bundle.
+  int64_t member_offset(int member_id) const {
+    return data_offset_ + members_[member_id].offset;
+  }
+
+  // Returns the size of the data of member |member_id|.
+  int64_t member_size(int member_id) const { return members_[member_id].size; }
+
+  // Decodes member |member_id|, which must be a mesh.
+  StatusOr<std::unique_ptr<Mesh>> DecodeMesh(int member_id);
+
+  // Decodes member |member_id|. Meshes are returned as point clouds that can be
+  // down-casted to Mesh.
+  StatusOr<std::unique_ptr<PointCloud>> DecodePointCloud(int member_id);
+
+  // Returns the options used for decoding of each member.
+  DecoderOptions *options() { return &options_; }
+
+ private:
+  // Location and type of an encoded member in the bundle.
+  struct MemberInfo {
+    EncodedGeometryType type;
+    int64_t offset;
+    int64_t size;
+  };
+
+  // Initializes |out_buffer| with the data of member |member_id|.
+  Status GetMemberBuffer(int member_id, DecoderBuffer *out_buffer) const;
+
+  DecoderOptions options_;
+  // Start of the data of all members.
+  const char *member_data_;
+  // Offset of the data of all members from the start of the bundle.
+  int64_t data_offset_;
+  std::vector<MemberInfo> members_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_GEOMETRY_BUNDLE_DECODER_H_
@@ -0,0 +1,89 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/geometry_bundle_encoder.h"
+
+#include <cstring>
+
+#include "draco/core/varint_encoding.h"
+
+namespace draco {
+
+GeometryBundleEncoder::GeometryBundleEncoder() {}
+
+Status GeometryBundleEncoder::AddMesh(const Mesh &mesh, Encoder *encoder) {
+  EncoderBuffer buffer;
+  DRACO_RETURN_IF_ERROR(encoder->EncodeMeshToBuffer(mesh, &buffer));
+  AddMember(TRIANGULAR_MESH, buffer);
+  return OkStatus();
+}
+
+Status GeometryBundleEncoder::AddPointCloud(const PointCloud &pc,
+                                            Encoder *encoder) {
+  EncoderBuffer buffer;
+  DRACO_RETURN_IF_ERROR(encoder->EncodePointCloudToBuffer(pc, &buffer));
+  AddMember(POINT_CLOUD, buffer);
+  return OkStatus();
+}
+
+Status GeometryBundleEncoder::AddEncodedGeometry(const char *data,
+                                                 size_t data_size) {
+  // The geometry type is stored after the "DRACO" magic string and the two
+  // version bytes of the Draco header.
+  if (data_size < 8 || memcmp(data, "DRACO", 5) != 0) {
+    return Status(Status::DRACO_ERROR, "Not a Draco bitstream.");
+  }
+  const int type = static_cast<uint8_t>(data[7]);
+  if (type != POINT_CLOUD && type != TRIANGULAR_MESH) {
+    return Status(Status::DRACO_ERROR, "Unsupported geometry type.");
+  }
+  member_types_.push_back(static_cast<EncodedGeometryType>(type));
+  member_sizes_.push_back(static_cast<int64_t>(data_size));
+  member_data_.Encode(data, data_size);
+  return OkStatus();
+}
+
+void GeometryBundleEncoder::AddMember(EncodedGeometryType type,
+                                      const EncoderBuffer &member_buffer) {
+  member_types_.push_back(type);
+  member_sizes_.push_back(static_cast<int64_t>(member_buffer.size()));
+  member_data_.Encode(member_buffer.data(), member_buffer.size());
+}
+
+Status GeometryBundleEncoder::EncodeToBuffer(EncoderBuffer *out_buffer) const {
+  out_buffer->Encode("DRBND", 5);
+  const uint8_t version_major = 1;
+  const uint8_t version_minor = 0;
+  out_buffer->Encode(version_major);
+  out_buffer->Encode(version_minor);
+  EncodeVarint(static_cast<uint32_t>(num_members()), out_buffer);
+  for (const EncodedGeometryType type : member_types_) {
+    out_buffer->Encode(static_cast<uint8_t>(type));
+  }
+  for (const int64_t size : member_sizes_) {
+    EncodeVarint(static_cast<uint64_t>(size), out_buffer);
+  }
+  if (!out_buffer->Encode(member_data_.data(), member_data_.size())) {
+    return Status(Status::DRACO_ERROR, "Failed to write the bundle data.");
+  }
+  return OkStatus();
+}
+
+void GeometryBundleEncoder::Clear() {
+  member_types_.clear();
+  member_sizes_.clear();
+  member_data_.Clear();
+}
+
+}  // namespace draco
@@ -0,0 +1,86 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_GEOMETRY_BUNDLE_ENCODER_H_
+#define DRACO_COMPRESSION_GEOMETRY_BUNDLE_ENCODER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/encode.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Encoder that stores many independently encoded meshes and point clouds in a
+// single buffer, e.g. all small meshes of a map tile. The whole bundle can be
+// loaded with a single read and any member can be decoded on its own using
+// the index stored in the bundle header (see GeometryBundleDecoder in
+// geometry_bundle_decoder.h).
+//
+// The encoded data is stored in the following container:
+//
+//   "DRBND"                         Magic string (5 bytes).
+//   uint8_t major_version           Container version (currently 1.0).
+//   uint8_t minor_version
+//   varint num_members
+//   uint8_t member_type[num_members]
+//                                   EncodedGeometryType of each member.
+//   varint member_size[num_members] Size of each encoded member in bytes.
+//   member data                     Regular Draco bitstream of each member.
+//
+// Each member is a complete Draco bitstream that can also be decoded with
+// Decoder after it is located using the index.
+//
+class GeometryBundleEncoder {
+ public:
+  GeometryBundleEncoder();
+
+  // Encodes |mesh| using |encoder| and appends it to the bundle.
+  Status AddMesh(const Mesh &mesh, Encoder *encoder);
+
+  // Encodes |pc| using |encoder| and appends it to the bundle.
+  Status AddPointCloud(const PointCloud &pc, Encoder *encoder);
+
+  // Appends geometry that is already encoded into a Draco bitstream.
+  Status AddEncodedGeometry(const char *data, size_t data_size);
+
+  // Returns the number of members added to the bundle.
+  int num_members() const { return static_cast<int>(member_types_.size()); }
+
+  // Writes the bundle header followed by the data of all members into
+  // |out_buffer|.
+  Status EncodeToBuffer(EncoderBuffer *out_buffer) const;
+
+  // Removes all members from the bundle.
+  void Clear();
+
+ private:
+  // Appends the member encoded in |member_buffer|.
+  void AddMember(EncodedGeometryType type, const EncoderBuffer &member_buffer);
+
+  std::vector<EncodedGeometryType> member_types_;
+  std::vector<int64_t> member_sizes_;
+  // Data of all members stored one after another.
+  EncoderBuffer member_data_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_GEOMETRY_BUNDLE_ENCODER_H_
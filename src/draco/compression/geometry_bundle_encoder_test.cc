@@ -0,0 +1,110 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/geometry_bundle_encoder.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
+#include "draco/compression/geometry_bundle_decoder.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace {
+
+TEST(GeometryBundleEncoderTest, TestEncodeDecode) {
+  const std::vector<std::string> mesh_files = {"cube_att.obj", "test_nm.obj",
+                                               "bunny_norm.obj"};
+  std::vector<std::unique_ptr<draco::Mesh>> meshes;
+  for (const std::string &file_name : mesh_files) {
+    meshes.push_back(draco::ReadMeshFromTestFile(file_name));
+    ASSERT_NE(meshes.back(), nullptr);
+  }
+  const std::unique_ptr<draco::PointCloud> pc =
+      draco::ReadPointCloudFromTestFile("test_nm.obj");
+  ASSERT_NE(pc, nullptr);
+
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+  draco::GeometryBundleEncoder bundle_encoder;
+  for (const auto &mesh : meshes) {
+    DRACO_ASSERT_OK(bundle_encoder.AddMesh(*mesh, &encoder));
+  }
+  DRACO_ASSERT_OK(bundle_encoder.AddPointCloud(*pc, &encoder));
+  // Add an already encoded mesh.
+  draco::EncoderBuffer mesh_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*meshes[0], &mesh_buffer));
+  DRACO_ASSERT_OK(bundle_encoder.AddEncodedGeometry(mesh_buffer.data(),
+                                                    mesh_buffer.size()));
+  ASSERT_FALSE(bundle_encoder.AddEncodedGeometry("invalid", 7).ok());
+  ASSERT_EQ(bundle_encoder.num_members(), 5);
+
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(bundle_encoder.EncodeToBuffer(&buffer));
+
+  draco::DecoderBuffer decoder_buffer;
+  decoder_buffer.Init(buffer.data(), buffer.size());
+  ASSERT_TRUE(draco::GeometryBundleDecoder::IsGeometryBundle(&decoder_buffer));
+  draco::GeometryBundleDecoder decoder;
+  DRACO_ASSERT_OK(decoder.DecodeHeader(&decoder_buffer));
+  ASSERT_EQ(decoder_buffer.remaining_size(), 0);
+  ASSERT_EQ(decoder.num_members(), 5);
+  ASSERT_EQ(decoder.member_geometry_type(3), draco::POINT_CLOUD);
+  ASSERT_EQ(decoder.member_geometry_type(4), draco::TRIANGULAR_MESH);
+  ASSERT_EQ(decoder.member_size(4), static_cast<int64_t>(mesh_buffer.size()));
+
+  // Members can be decoded in any order.
+  for (int i : {2, 0, 1, 4}) {
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::Mesh> mesh,
+                           decoder.DecodeMesh(i));
+    const draco::Mesh &expected = *meshes[i == 4 ? 0 : i];
+    ASSERT_EQ(mesh->num_faces(), expected.num_faces());
+    ASSERT_EQ(mesh->num_attributes(), expected.num_attributes());
+  }
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::PointCloud> decoded_pc,
+                         decoder.DecodePointCloud(3));
+  ASSERT_EQ(decoded_pc->num_points(), pc->num_points());
+  ASSERT_FALSE(decoder.DecodeMesh(3).ok());
+  ASSERT_FALSE(decoder.DecodeMesh(5).ok());
+
+  // Members are regular Draco bitstreams.
+  draco::DecoderBuffer member_buffer;
+  member_buffer.Init(buffer.data() + decoder.member_offset(1),
+                     decoder.member_size(1));
+  draco::Decoder member_decoder;
+  ASSERT_TRUE(member_decoder.DecodeMeshFromBuffer(&member_buffer).ok());
+}
+
+TEST(GeometryBundleEncoderTest, TestTruncatedBundle) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  draco::GeometryBundleEncoder bundle_encoder;
+  DRACO_ASSERT_OK(bundle_encoder.AddMesh(*mesh, &encoder));
+  DRACO_ASSERT_OK(bundle_encoder.AddMesh(*mesh, &encoder));
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(bundle_encoder.EncodeToBuffer(&buffer));
+
+  draco::GeometryBundleDecoder decoder;
+  draco::DecoderBuffer decoder_buffer;
+  decoder_buffer.Init(buffer.data(), buffer.size() - 1);
+  ASSERT_FALSE(decoder.DecodeHeader(&decoder_buffer).ok());
+  ASSERT_EQ(decoder.num_members(), 0);
+}
+
+}  // namespace
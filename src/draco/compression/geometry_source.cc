@@ -0,0 +1,142 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/geometry_source.h"
+
+#include <cstring>
+#include <utility>
+
+namespace draco {
+
+GeometrySource::GeometrySource(PointIndex::ValueType num_points)
+    : num_points_(num_points),
+      faces_data_(nullptr),
+      index_type_(DT_INVALID),
+      num_faces_(0),
+      faces_byte_stride_(0) {}
+
+int GeometrySource::AddAttribute(GeometryAttribute::Type type,
+                                 int8_t num_components, DataType data_type,
+                                 bool normalized, const void *data,
+                                 int64_t byte_stride) {
+  attributes_.push_back(
+      {type, num_components, data_type, normalized, data, byte_stride});
+  return static_cast<int>(attributes_.size()) - 1;
+}
+
+void GeometrySource::SetFaces(const void *data, DataType index_type,
+                              FaceIndex::ValueType num_faces,
+                              int64_t byte_stride) {
+  faces_data_ = data;
+  index_type_ = index_type;
+  num_faces_ = num_faces;
+  faces_byte_stride_ = byte_stride;
+}
+
+StatusOr<std::unique_ptr<Mesh>> GeometrySource::CreateMesh() const {
+  std::unique_ptr<Mesh> mesh(new Mesh());
+  DRACO_RETURN_IF_ERROR(AddAttributesTo(mesh.get()));
+  DRACO_RETURN_IF_ERROR(CopyFacesTo(mesh.get()));
+  return std::move(mesh);
+}
+
+StatusOr<std::unique_ptr<PointCloud>> GeometrySource::CreatePointCloud()
+    const {
+  std::unique_ptr<PointCloud> pc(new PointCloud());
+  DRACO_RETURN_IF_ERROR(AddAttributesTo(pc.get()));
+  return std::move(pc);
+}
+
+Status GeometrySource::AddAttributesTo(PointCloud *pc) const {
+  pc->set_num_points(num_points_);
+  for (const AttributeSource &src : attributes_) {
+    if (src.type == GeometryAttribute::INVALID || src.num_components <= 0 ||
+        DataTypeLength(src.data_type) <= 0) {
+      return ErrorStatus("Invalid attribute format.");
+    }
+    if (src.data == nullptr && num_points_ > 0) {
+      return ErrorStatus("Missing attribute data.");
+    }
+    const int64_t value_size =
+        DataTypeLength(src.data_type) * src.num_components;
+    const int64_t stride = src.byte_stride == 0 ? value_size : src.byte_stride;
+    if (stride < value_size) {
+      return ErrorStatus("Invalid attribute stride.");
+    }
+    std::unique_ptr<PointAttribute> att(new PointAttribute());
+    if (stride == value_size) {
+      att->Init(src.type, src.num_components, src.data_type, src.normalized,
+                0);
+      att->SetExternalValues(src.data, num_points_);
+    } else {
+      // Attributes expect tightly packed values, so interleaved values are
+      // copied.
+      att->Init(src.type, src.num_components, src.data_type, src.normalized,
+                num_points_);
+      uint8_t *const dst = att->buffer()->data();
+      const uint8_t *const src_data = static_cast<const uint8_t *>(src.data);
+      for (PointIndex::ValueType i = 0; i < num_points_; ++i) {
+        memcpy(dst + i * value_size, src_data + i * stride, value_size);
+      }
+    }
+    pc->AddAttribute(std::move(att));
+  }
+  return OkStatus();
+}
+
+Status GeometrySource::CopyFacesTo(Mesh *mesh) const {
+  if (num_faces_ == 0) {
+    return OkStatus();
+  }
+  if (faces_data_ == nullptr) {
+    return ErrorStatus("Missing face data.");
+  }
+  switch (index_type_) {
+    case DT_UINT8:
+      return CopyFacesTo<uint8_t>(mesh);
+    case DT_UINT16:
+      return CopyFacesTo<uint16_t>(mesh);
+    case DT_UINT32:
+      return CopyFacesTo<uint32_t>(mesh);
+    default:
+      return ErrorStatus("Unsupported index type.");
+  }
+}
+
+template <typename IndexT>
+Status GeometrySource::CopyFacesTo(Mesh *mesh) const {
+  const int64_t face_size = 3 * sizeof(IndexT);
+  const int64_t stride =
+      faces_byte_stride_ == 0 ? face_size : faces_byte_stride_;
+  if (stride < face_size) {
+    return ErrorStatus("Invalid face stride.");
+  }
+  const uint8_t *const src = static_cast<const uint8_t *>(faces_data_);
+  mesh->SetNumFacesUninitialized(num_faces_);
+  for (FaceIndex f(0); f < num_faces_; ++f) {
+    IndexT indices[3];
+    memcpy(indices, src + f.value() * stride, face_size);
+    Mesh::Face face;
+    for (int c = 0; c < 3; ++c) {
+      if (indices[c] >= num_points_) {
+        return ErrorStatus("Point index out of range.");
+      }
+      face[c] = indices[c];
+    }
+    mesh->SetFace(f, face);
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
@@ -0,0 +1,105 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_GEOMETRY_SOURCE_H_
+#define DRACO_COMPRESSION_GEOMETRY_SOURCE_H_
+
+#include <memory>
+#include <vector>
+
+#include "draco/core/status_or.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Describes geometry stored in buffers owned by the caller, e.g., separate
+// arrays of positions, normals and triangle indices, so that it can be encoded
+// without first copying it into a Mesh with TriangleSoupMeshBuilder or into a
+// PointCloud with PointCloudBuilder. The source stores only pointers to the
+// buffers, which must stay valid and unchanged until the encoding is done.
+//
+// Every attribute has one value per point and the faces reference the points
+// directly, so no attribute values or points are deduplicated.
+//
+// Usage:
+//   GeometrySource source(num_points);
+//   source.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32, false,
+//                       positions, 0);
+//   source.SetFaces(indices, DT_UINT32, num_faces, 0);
+//   Encoder encoder;
+//   encoder.EncodeGeometrySourceToBuffer(source, &buffer);
+class GeometrySource {
+ public:
+  explicit GeometrySource(PointIndex::ValueType num_points);
+
+  // Adds an attribute whose values are read from |data|. The value of point i
+  // starts at byte i * |byte_stride| of |data|. When |byte_stride| is 0 the
+  // values are tightly packed. Tightly packed values are read in place while
+  // interleaved values are copied, because attributes store their values
+  // tightly packed. Returns the id of the new attribute.
+  int AddAttribute(GeometryAttribute::Type type, int8_t num_components,
+                   DataType data_type, bool normalized, const void *data,
+                   int64_t byte_stride);
+
+  // Sets triangular faces whose point indices of type |index_type| are read
+  // from |data|. The three indices of face i start at byte i * |byte_stride|
+  // of |data| and are tightly packed. When |byte_stride| is 0 the faces are
+  // tightly packed as well. |index_type| must be DT_UINT8, DT_UINT16 or
+  // DT_UINT32.
+  void SetFaces(const void *data, DataType index_type,
+                FaceIndex::ValueType num_faces, int64_t byte_stride);
+
+  PointIndex::ValueType num_points() const { return num_points_; }
+  FaceIndex::ValueType num_faces() const { return num_faces_; }
+  int num_attributes() const { return static_cast<int>(attributes_.size()); }
+
+  // Creates a mesh whose attributes read tightly packed values directly from
+  // the source buffers, see PointAttribute::SetExternalValues(). The faces and
+  // interleaved attribute values are copied. The mesh must not be used after
+  // the source buffers are released.
+  StatusOr<std::unique_ptr<Mesh>> CreateMesh() const;
+
+  // Same as CreateMesh() but the faces of the source are ignored.
+  StatusOr<std::unique_ptr<PointCloud>> CreatePointCloud() const;
+
+ private:
+  struct AttributeSource {
+    GeometryAttribute::Type type;
+    int8_t num_components;
+    DataType data_type;
+    bool normalized;
+    const void *data;
+    int64_t byte_stride;
+  };
+
+  // Adds the attributes of the source to |pc|.
+  Status AddAttributesTo(PointCloud *pc) const;
+
+  // Copies the faces of the source to |mesh|.
+  Status CopyFacesTo(Mesh *mesh) const;
+
+  template <typename IndexT>
+  Status CopyFacesTo(Mesh *mesh) const;
+
+  PointIndex::ValueType num_points_;
+  std::vector<AttributeSource> attributes_;
+  const void *faces_data_;
+  DataType index_type_;
+  FaceIndex::ValueType num_faces_;
+  int64_t faces_byte_stride_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_GEOMETRY_SOURCE_H_
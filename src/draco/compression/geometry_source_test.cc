@@ -0,0 +1,182 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/geometry_source.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "draco/compression/encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/encoder_buffer.h"
+
+namespace {
+
+// Face with 16-bit indices padded to 8 bytes.
+struct PaddedFace {
+  uint16_t indices[3];
+  uint16_t padding;
+};
+
+class GeometrySourceTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Two triangles of a unit square in the xy plane.
+    positions_ = {0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 1.f, 0.f, 0.f, 1.f, 0.f};
+    normals_ = {0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f};
+    faces_ = {{{0, 1, 2}, 0}, {{0, 2, 3}, 0}};
+  }
+
+  int num_points() const { return static_cast<int>(positions_.size() / 3); }
+
+  // Sets up |source| with the positions, normals and padded faces.
+  void InitSource(draco::GeometrySource *source) const {
+    source->AddAttribute(draco::GeometryAttribute::POSITION, 3,
+                         draco::DT_FLOAT32, false, positions_.data(), 0);
+    source->AddAttribute(draco::GeometryAttribute::NORMAL, 3,
+                         draco::DT_FLOAT32, false, normals_.data(), 0);
+    source->SetFaces(faces_.data(), draco::DT_UINT16, faces_.size(),
+                     sizeof(PaddedFace));
+  }
+
+  // Returns a mesh with the same geometry as the source created with
+  // InitSource().
+  std::unique_ptr<draco::Mesh> CreateReferenceMesh() const {
+    std::unique_ptr<draco::Mesh> mesh(new draco::Mesh());
+    mesh->set_num_points(num_points());
+    for (const draco::GeometryAttribute::Type type :
+         {draco::GeometryAttribute::POSITION,
+          draco::GeometryAttribute::NORMAL}) {
+      const std::vector<float> &values =
+          type == draco::GeometryAttribute::POSITION ? positions_ : normals_;
+      std::unique_ptr<draco::PointAttribute> att(new draco::PointAttribute());
+      att->Init(type, 3, draco::DT_FLOAT32, false, num_points());
+      for (draco::AttributeValueIndex i(0); i < num_points(); ++i) {
+        att->SetAttributeValue(i, &values[3 * i.value()]);
+      }
+      mesh->AddAttribute(std::move(att));
+    }
+    for (const PaddedFace &padded_face : faces_) {
+      draco::Mesh::Face face;
+      for (int c = 0; c < 3; ++c) {
+        face[c] = padded_face.indices[c];
+      }
+      mesh->AddFace(face);
+    }
+    return mesh;
+  }
+
+  // Checks that |source| is encoded to the same buffer as the reference mesh.
+  void ExpectEncodingMatchesReferenceMesh(
+      const draco::GeometrySource &source) const {
+    draco::Encoder encoder;
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 8);
+    draco::EncoderBuffer source_buffer;
+    DRACO_ASSERT_OK(
+        encoder.EncodeGeometrySourceToBuffer(source, &source_buffer));
+
+    const std::unique_ptr<draco::Mesh> mesh = CreateReferenceMesh();
+    draco::EncoderBuffer mesh_buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &mesh_buffer));
+
+    ASSERT_EQ(source_buffer.size(), mesh_buffer.size());
+    ASSERT_EQ(memcmp(source_buffer.data(), mesh_buffer.data(),
+                     mesh_buffer.size()),
+              0);
+  }
+
+  std::vector<float> positions_;
+  std::vector<float> normals_;
+  std::vector<PaddedFace> faces_;
+};
+
+TEST_F(GeometrySourceTest, CreateMeshReadsSourceBuffers) {
+  draco::GeometrySource source(num_points());
+  InitSource(&source);
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::Mesh> mesh,
+                         source.CreateMesh());
+  ASSERT_EQ(mesh->num_points(), 4);
+  ASSERT_EQ(mesh->num_faces(), 2);
+  ASSERT_EQ(mesh->num_attributes(), 2);
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    ASSERT_TRUE(mesh->attribute(i)->buffer()->HasExternalData());
+  }
+  // The attribute values are not copied.
+  ASSERT_EQ(mesh->MemoryUsage().attribute_values, 0);
+
+  const draco::PointAttribute *const normal_att =
+      mesh->GetNamedAttribute(draco::GeometryAttribute::NORMAL);
+  float normal[3];
+  normal_att->GetMappedValue(draco::PointIndex(2), normal);
+  ASSERT_EQ(normal[2], 1.f);
+  ASSERT_EQ(mesh->face(draco::FaceIndex(1))[2], draco::PointIndex(3));
+}
+
+TEST_F(GeometrySourceTest, EncodeMatchesMesh) {
+  draco::GeometrySource source(num_points());
+  InitSource(&source);
+  ExpectEncodingMatchesReferenceMesh(source);
+}
+
+TEST_F(GeometrySourceTest, EncodeInterleavedAttributes) {
+  // Interleave positions and normals.
+  std::vector<float> vertices;
+  for (int i = 0; i < num_points(); ++i) {
+    vertices.insert(vertices.end(), &positions_[3 * i], &positions_[3 * i + 3]);
+    vertices.insert(vertices.end(), &normals_[3 * i], &normals_[3 * i + 3]);
+  }
+  draco::GeometrySource source(num_points());
+  source.AddAttribute(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32,
+                      false, &vertices[0], 6 * sizeof(float));
+  source.AddAttribute(draco::GeometryAttribute::NORMAL, 3, draco::DT_FLOAT32,
+                      false, &vertices[3], 6 * sizeof(float));
+  source.SetFaces(faces_.data(), draco::DT_UINT16, faces_.size(),
+                  sizeof(PaddedFace));
+  ExpectEncodingMatchesReferenceMesh(source);
+}
+
+TEST_F(GeometrySourceTest, EncodePointCloud) {
+  draco::GeometrySource source(num_points());
+  source.AddAttribute(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32,
+                      false, positions_.data(), 0);
+  draco::Encoder encoder;
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodeGeometrySourceToBuffer(source, &buffer));
+  ASSERT_GT(buffer.size(), 0);
+}
+
+TEST_F(GeometrySourceTest, InvalidSource) {
+  // Out of range point index.
+  faces_[1].indices[2] = 4;
+  draco::GeometrySource source(num_points());
+  InitSource(&source);
+  ASSERT_FALSE(source.CreateMesh().ok());
+
+  // Stride smaller than the size of an attribute value.
+  draco::GeometrySource bad_stride_source(num_points());
+  bad_stride_source.AddAttribute(draco::GeometryAttribute::POSITION, 3,
+                                 draco::DT_FLOAT32, false, positions_.data(),
+                                 4);
+  ASSERT_FALSE(bad_stride_source.CreatePointCloud().ok());
+
+  // Unsupported index type.
+  draco::GeometrySource bad_index_source(num_points());
+  bad_index_source.SetFaces(faces_.data(), draco::DT_FLOAT32, 1, 0);
+  ASSERT_FALSE(bad_index_source.CreateMesh().ok());
+}
+
+}  // namespace
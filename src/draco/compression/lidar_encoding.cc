@@ -0,0 +1,42 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/lidar_encoding.h"
+
+namespace draco {
+
+void SetLidarEncodingOptions(const PointCloud &pc, ExpertEncoder *encoder) {
+  encoder->SetEncodingMethod(POINT_CLOUD_SEQUENTIAL_ENCODING);
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    switch (pc.attribute(i)->data_type()) {
+      case DT_INT8:
+      case DT_UINT8:
+      case DT_INT16:
+      case DT_UINT16:
+      case DT_INT32:
+      case DT_UINT32:
+        encoder->SetAttributePredictionScheme(i, PREDICTION_DIFFERENCE);
+        break;
+      case DT_INT64:
+      case DT_UINT64:
+      case DT_FLOAT64:
+        encoder->SetAttributeDeltaCoding(i, true);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+}  // namespace draco
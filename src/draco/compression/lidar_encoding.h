@@ -0,0 +1,42 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_LIDAR_ENCODING_H_
+#define DRACO_COMPRESSION_LIDAR_ENCODING_H_
+
+#include "draco/compression/expert_encode.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Sets options of |encoder| for compression of LiDAR point clouds, such as
+// the ones decoded by LasDecoder, where consecutive points of the scan order
+// tend to be close to each other. |pc| must be the geometry |encoder| was
+// created for. The points are encoded sequentially in their input order and:
+//
+//   - Integer attributes (positions, intensity, return numbers,
+//     classification, ...) are predicted from the previous point. Runs of
+//     equal values, which are common for classification labels, result in
+//     zero corrections that the entropy coder stores in a small fraction of
+//     a bit per point.
+//   - 64-bit attributes (GPS time) are delta coded with
+//     ExpertEncoder::SetAttributeDeltaCoding().
+//
+// Options of other attributes, e.g. quantization of float positions, are not
+// changed.
+void SetLidarEncodingOptions(const PointCloud &pc, ExpertEncoder *encoder);
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_LIDAR_ENCODING_H_
@@ -0,0 +1,128 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/lidar_encoding.h"
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "draco/compression/decode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/point_cloud/point_cloud_builder.h"
+
+namespace draco {
+
+class LidarEncodingTest : public ::testing::Test {
+ protected:
+  // Creates a point cloud resembling a LiDAR scan with |num_points| points.
+  static std::unique_ptr<PointCloud> CreateLidarPointCloud(int num_points) {
+    PointCloudBuilder builder;
+    builder.Start(num_points);
+    const int pos_att_id =
+        builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_INT32);
+    const int intensity_att_id =
+        builder.AddAttribute(GeometryAttribute::GENERIC, 1, DT_UINT16);
+    const int classification_att_id =
+        builder.AddAttribute(GeometryAttribute::GENERIC, 1, DT_UINT8);
+    const int gps_time_att_id =
+        builder.AddAttribute(GeometryAttribute::GENERIC, 1, DT_FLOAT64);
+    const int random_att_id =
+        builder.AddAttribute(GeometryAttribute::GENERIC, 2, DT_UINT64);
+    std::mt19937_64 generator(3);
+    for (PointIndex i(0); i < num_points; ++i) {
+      const int v = i.value();
+      const int32_t position[3] = {100000 + 3 * v, 20000 - v / 2,
+                                   static_cast<int32_t>(generator() % 50)};
+      builder.SetAttributeValueForPoint(pos_att_id, i, position);
+      const uint16_t intensity = static_cast<uint16_t>(generator() % 4096);
+      builder.SetAttributeValueForPoint(intensity_att_id, i, &intensity);
+      const uint8_t classification = (v / 500) % 2 ? 2 : 6;
+      builder.SetAttributeValueForPoint(classification_att_id, i,
+                                        &classification);
+      const double gps_time = 271234.5 + 2e-5 * v;
+      builder.SetAttributeValueForPoint(gps_time_att_id, i, &gps_time);
+      const uint64_t random[2] = {generator(), generator()};
+      builder.SetAttributeValueForPoint(random_att_id, i, random);
+    }
+    return builder.Finalize(false);
+  }
+
+  static std::unique_ptr<PointCloud> EncodeAndDecode(const PointCloud &pc,
+                                                     bool use_lidar_options,
+                                                     size_t *encoded_size) {
+    ExpertEncoder encoder(pc);
+    if (use_lidar_options) {
+      SetLidarEncodingOptions(pc, &encoder);
+    } else {
+      encoder.SetEncodingMethod(POINT_CLOUD_SEQUENTIAL_ENCODING);
+    }
+    EncoderBuffer buffer;
+    if (!encoder.EncodeToBuffer(&buffer).ok()) {
+      return nullptr;
+    }
+    *encoded_size = buffer.size();
+    DecoderBuffer decoder_buffer;
+    decoder_buffer.Init(buffer.data(), buffer.size());
+    Decoder decoder;
+    auto status_or = decoder.DecodePointCloudFromBuffer(&decoder_buffer);
+    if (!status_or.ok()) {
+      return nullptr;
+    }
+    return std::move(status_or).value();
+  }
+};
+
+TEST_F(LidarEncodingTest, TestLosslessEncoding) {
+  const std::unique_ptr<PointCloud> pc = CreateLidarPointCloud(10000);
+  ASSERT_NE(pc, nullptr);
+  size_t lidar_size = 0;
+  const std::unique_ptr<PointCloud> decoded_pc =
+      EncodeAndDecode(*pc, true, &lidar_size);
+  ASSERT_NE(decoded_pc, nullptr);
+  ASSERT_EQ(decoded_pc->num_points(), pc->num_points());
+  ASSERT_EQ(decoded_pc->num_attributes(), pc->num_attributes());
+  // All attributes must be decoded losslessly and in the original order.
+  for (int i = 0; i < pc->num_attributes(); ++i) {
+    const PointAttribute *const att = pc->attribute(i);
+    const PointAttribute *const decoded_att = decoded_pc->attribute(i);
+    ASSERT_EQ(decoded_att->data_type(), att->data_type());
+    for (PointIndex pi(0); pi < pc->num_points(); ++pi) {
+      ASSERT_EQ(memcmp(att->GetAddress(att->mapped_index(pi)),
+                       decoded_att->GetAddress(decoded_att->mapped_index(pi)),
+                       att->byte_stride()),
+                0);
+    }
+  }
+
+  // Delta coding of the GPS time must be better than storing the raw values.
+  // The random 64-bit attribute is not compressible either way.
+  size_t default_size = 0;
+  ASSERT_NE(EncodeAndDecode(*pc, false, &default_size), nullptr);
+  ASSERT_LT(lidar_size + 4 * pc->num_points(), default_size);
+}
+
+TEST_F(LidarEncodingTest, TestSinglePoint) {
+  const std::unique_ptr<PointCloud> pc = CreateLidarPointCloud(1);
+  ASSERT_NE(pc, nullptr);
+  size_t encoded_size = 0;
+  const std::unique_ptr<PointCloud> decoded_pc =
+      EncodeAndDecode(*pc, true, &encoded_size);
+  ASSERT_NE(decoded_pc, nullptr);
+  ASSERT_EQ(decoded_pc->num_points(), 1);
+}
+
+}  // namespace draco
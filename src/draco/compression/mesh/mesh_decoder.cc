@@ -21,6 +21,8 @@ MeshDecoder::MeshDecoder() : mesh_(nullptr) {}
 Status MeshDecoder::Decode(const DecoderOptions &options,
                            DecoderBuffer *in_buffer, Mesh *out_mesh) {
   mesh_ = out_mesh;
+  // Faces of a reused mesh are removed while keeping their capacity.
+  out_mesh->SetNumFaces(0);
   return PointCloudDecoder::Decode(options, in_buffer, out_mesh);
 }
 
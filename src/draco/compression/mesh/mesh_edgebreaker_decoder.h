@@ -47,6 +47,11 @@ class MeshEdgebreakerDecoder : public MeshDecoder {
   bool OnAttributesDecoded() override;
 
   std::unique_ptr<MeshEdgebreakerDecoderImplInterface> impl_;
+
+ private:
+  // Traversal decoder type of the current |impl_|. Used to reuse the |impl_|
+  // when the decoder is used to decode multiple meshes of the same type.
+  int impl_traversal_decoder_type_;
 };
 
 }  // namespace draco
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <vector>
 
 #include "draco/compression/attributes/sequential_attribute_decoders_controller.h"
 #include "draco/compression/mesh/mesh_edgebreaker_decoder.h"
@@ -57,6 +58,15 @@ template <class TraversalDecoder>
 bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::Init(
     MeshEdgebreakerDecoder *decoder) {
   decoder_ = decoder;
+  // Reset the state in case the decoder is reused for multiple meshes. All
+  // other data is reset at the beginning of DecodeConnectivity().
+  last_symbol_id_ = -1;
+  last_vert_id_ = -1;
+  last_face_id_ = -1;
+  num_new_vertices_ = 0;
+  num_encoded_vertices_ = 0;
+  pos_data_decoder_id_ = -1;
+  attribute_data_.clear();
   return true;
 }
 
@@ -107,24 +117,50 @@ template <class TraversalDecoder>
 template <class TraverserT>
 std::unique_ptr<PointsSequencer>
 MeshEdgebreakerDecoderImpl<TraversalDecoder>::CreateVertexTraversalSequencer(
+    const typename TraverserT::CornerTable *corner_table,
     MeshAttributeIndicesEncodingData *encoding_data) {
   typedef typename TraverserT::TraversalObserver AttObserver;
-  typedef typename TraverserT::CornerTable CornerTable;
 
   const Mesh *mesh = decoder_->mesh();
   std::unique_ptr<MeshTraversalSequencer<TraverserT>> traversal_sequencer(
       new MeshTraversalSequencer<TraverserT>(mesh, encoding_data));
 
-  AttObserver att_observer(corner_table_.get(), mesh, traversal_sequencer.get(),
+  AttObserver att_observer(corner_table, mesh, traversal_sequencer.get(),
                            encoding_data);
 
   TraverserT att_traverser;
-  att_traverser.Init(corner_table_.get(), att_observer);
+  att_traverser.Init(corner_table, att_observer);
 
   traversal_sequencer->SetTraverser(att_traverser);
+  if (attribute_data_.empty() && encoding_data == &pos_encoding_data_) {
+    // All attributes are decoded with this sequencer and the points are equal
+    // to the vertices, so the points can be ordered like the attribute values.
+    traversal_sequencer->SetMeshToRenumber(decoder_->mesh());
+  }
   return std::move(traversal_sequencer);
 }
 
+template <class TraversalDecoder>
+template <class CornerTableT>
+std::unique_ptr<PointsSequencer>
+MeshEdgebreakerDecoderImpl<TraversalDecoder>::CreateVertexTraversalSequencer(
+    MeshTraversalMethod traversal_method, const CornerTableT *corner_table,
+    MeshAttributeIndicesEncodingData *encoding_data) {
+  typedef MeshAttributeIndicesEncodingObserver<CornerTableT> AttObserver;
+  if (traversal_method == MESH_TRAVERSAL_PREDICTION_DEGREE) {
+    typedef MaxPredictionDegreeTraverser<CornerTableT, AttObserver>
+        AttTraverser;
+    return CreateVertexTraversalSequencer<AttTraverser>(corner_table,
+                                                        encoding_data);
+  }
+  if (traversal_method == MESH_TRAVERSAL_DEPTH_FIRST) {
+    typedef DepthFirstTraverser<CornerTableT, AttObserver> AttTraverser;
+    return CreateVertexTraversalSequencer<AttTraverser>(corner_table,
+                                                        encoding_data);
+  }
+  return nullptr;  // Unsupported method.
+}
+
 template <class TraversalDecoder>
 bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::CreateAttributesDecoder(
     int32_t att_decoder_id) {
@@ -187,17 +223,21 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::CreateAttributesDecoder(
       attribute_data_[att_data_id].is_connectivity_used = false;
     }
     // Defining sequencer via a traversal scheme.
-    if (traversal_method == MESH_TRAVERSAL_PREDICTION_DEGREE) {
-      typedef MeshAttributeIndicesEncodingObserver<CornerTable> AttObserver;
-      typedef MaxPredictionDegreeTraverser<CornerTable, AttObserver>
-          AttTraverser;
-      sequencer = CreateVertexTraversalSequencer<AttTraverser>(encoding_data);
-    } else if (traversal_method == MESH_TRAVERSAL_DEPTH_FIRST) {
-      typedef MeshAttributeIndicesEncodingObserver<CornerTable> AttObserver;
-      typedef DepthFirstTraverser<CornerTable, AttObserver> AttTraverser;
-      sequencer = CreateVertexTraversalSequencer<AttTraverser>(encoding_data);
+    if (decoder_->options()->GetGlobalBool(
+            GetDecoderOptionKeys().use_packed_corner_table, false)) {
+      // The packed table produces the same traversal order, it only changes
+      // the memory layout of the connectivity data.
+      if (packed_corner_table_ == nullptr) {
+        packed_corner_table_.reset(new PackedCornerTable());
+        if (!packed_corner_table_->Init(*corner_table_)) {
+          return false;
+        }
+      }
+      sequencer = CreateVertexTraversalSequencer(
+          traversal_method, packed_corner_table_.get(), encoding_data);
     } else {
-      return false;  // Unsupported method
+      sequencer = CreateVertexTraversalSequencer(
+          traversal_method, corner_table_.get(), encoding_data);
     }
   } else {
     if (traversal_method != MESH_TRAVERSAL_DEPTH_FIRST) {
@@ -247,6 +287,9 @@ template <class TraversalDecoder>
 bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity() {
   num_new_vertices_ = 0;
   new_to_parent_vertex_map_.clear();
+  // The packed table describes the connectivity of the previously decoded
+  // mesh when the decoder is reused.
+  packed_corner_table_.reset();
 #ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
   if (decoder_->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 2)) {
     uint32_t num_new_verts;
@@ -370,9 +413,26 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity() {
     return false;  // Split symbols are a sub-set of all symbols.
   }
 
+  // Reserve an approximate amount of memory for the corner table, the decoded
+  // faces and the traversal data (per face), for the vertex data (per vertex)
+  // and for the seams and the encoding data of non-position attributes.
+  const uint64_t num_corners = 3 * static_cast<uint64_t>(num_faces);
+  const uint64_t num_vertices =
+      static_cast<uint64_t>(num_encoded_vertices_) + num_encoded_split_symbols;
+  if (!decoder_->ReserveMemory(44 * static_cast<uint64_t>(num_faces) +
+                               16 * num_vertices +
+                               num_attribute_data *
+                                   (12 * num_corners + 16 * num_vertices))) {
+    return false;
+  }
+
   // Decode topology (connectivity).
   vertex_traversal_length_.clear();
-  corner_table_ = std::unique_ptr<CornerTable>(new CornerTable());
+  // Reuse the corner table (and its allocated memory) from a previous decoding
+  // if possible. The table is fully reset below.
+  if (corner_table_ == nullptr) {
+    corner_table_ = std::unique_ptr<CornerTable>(new CornerTable());
+  }
   if (corner_table_ == nullptr) {
     return false;
   }
@@ -447,6 +507,7 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity() {
   traversal_decoder_.SetNumEncodedVertices(num_encoded_vertices_ +
                                            num_encoded_split_symbols);
   traversal_decoder_.SetNumAttributeData(num_attribute_data);
+  traversal_decoder_.SetNumEncodedSymbols(num_encoded_symbols);
 
   DecoderBuffer traversal_end_buffer;
   if (!traversal_decoder_.Start(&traversal_end_buffer)) {
@@ -494,15 +555,24 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity() {
 
   // Decode attribute connectivity.
   // Prepare data structure for decoding non-position attribute connectivity.
-  for (uint32_t i = 0; i < attribute_data_.size(); ++i) {
-    attribute_data_[i].connectivity_data.InitEmpty(corner_table_.get());
-    // Add all seams.
-    for (int32_t c : attribute_data_[i].attribute_seam_corners) {
-      attribute_data_[i].connectivity_data.AddSeamEdge(CornerIndex(c));
-    }
-    // Recompute vertices from the newly added seam edges.
-    if (!attribute_data_[i].connectivity_data.RecomputeVertices(nullptr,
-                                                                nullptr)) {
+  // The attributes are independent of each other, so their corner tables can
+  // be built in parallel.
+  std::vector<uint8_t> is_attribute_valid(attribute_data_.size(), 0);
+  ParallelFor(decoder_->options()->thread_pool(),
+              static_cast<int>(attribute_data_.size()), [&](int i) {
+                MeshAttributeCornerTable &connectivity_data =
+                    attribute_data_[i].connectivity_data;
+                connectivity_data.InitEmpty(corner_table_.get());
+                // Add all seams.
+                for (int32_t c : attribute_data_[i].attribute_seam_corners) {
+                  connectivity_data.AddSeamEdge(CornerIndex(c));
+                }
+                // Recompute vertices from the newly added seam edges.
+                is_attribute_valid[i] =
+                    connectivity_data.RecomputeVertices(nullptr, nullptr);
+              });
+  for (const uint8_t is_valid : is_attribute_valid) {
+    if (!is_valid) {
       return false;
     }
   }
@@ -534,6 +604,18 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::OnAttributesDecoded() {
 template <class TraversalDecoder>
 int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
     int num_symbols) {
+  // Most meshes do not contain any topology split events, which allows us to
+  // use a simpler decoding loop.
+  if (topology_split_data_.empty()) {
+    return DecodeConnectivityImpl<false>(num_symbols);
+  }
+  return DecodeConnectivityImpl<true>(num_symbols);
+}
+
+template <class TraversalDecoder>
+template <bool kHasTopologySplits>
+int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivityImpl(
+    int num_symbols) {
   // Algorithm does the reverse decoding of the symbols encoded with the
   // edgebreaker method. The reverse decoding always keeps track of the active
   // edge identified by its opposite corner (active corner). New faces are
@@ -557,9 +639,27 @@ int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
   std::vector<VertexIndex> invalid_vertices;
   const bool remove_invalid_vertices = attribute_data_.empty();
 
+  // Operations done since the work was last reported to the decoder. Crafted
+  // inputs can make the vertex merging of TOPOLOGY_S symbols and the topology
+  // split events much more expensive than the number of symbols suggests, so
+  // their steps are counted as well.
+  uint64_t work = 0;
+  const auto report_work = [&]() {
+    if (work < PointCloudDecoder::kWorkCheckInterval) {
+      return true;
+    }
+    const uint64_t num_operations = work;
+    work = 0;
+    return decoder_->ConsumeWork(num_operations);
+  };
+
   int max_num_vertices = static_cast<int>(is_vert_hole_.size());
   int num_faces = 0;
   for (int symbol_id = 0; symbol_id < num_symbols; ++symbol_id) {
+    ++work;
+    if (!report_work()) {
+      return -1;
+    }
     const FaceIndex face(num_faces++);
     // Used to flag cases where we need to look for topology split events.
     bool check_topology_split = false;
@@ -707,10 +807,12 @@ int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
 
       // Corner "a" can correspond either to a normal active edge, or to an edge
       // created from the topology split event.
-      const auto it = topology_split_active_corners.find(symbol_id);
-      if (it != topology_split_active_corners.end()) {
-        // Topology split event. Move the retrieved edge to the stack.
-        active_corner_stack.push_back(it->second);
+      if (kHasTopologySplits) {
+        const auto it = topology_split_active_corners.find(symbol_id);
+        if (it != topology_split_active_corners.end()) {
+          // Topology split event. Move the retrieved edge to the stack.
+          active_corner_stack.push_back(it->second);
+        }
       }
       if (active_corner_stack.empty()) {
         return -1;
@@ -755,6 +857,7 @@ int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
       // connected to it in the CCW direction.
       const CornerIndex first_corner = corner_n;
       while (corner_n != kInvalidCornerIndex) {
+        ++work;
         corner_table_->MapCornerToVertex(corner_n, vertex_p);
         corner_n = corner_table_->SwingLeft(corner_n);
         if (corner_n == first_corner) {
@@ -797,7 +900,7 @@ int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
     // Inform the traversal decoder that a new corner has been reached.
     traversal_decoder_.NewActiveCornerReached(active_corner_stack.back());
 
-    if (check_topology_split) {
+    if (kHasTopologySplits && check_topology_split) {
       // Check for topology splits happens only for TOPOLOGY_L, TOPOLOGY_R and
       // TOPOLOGY_E symbols because those are the symbols that correspond to
       // faces that can be directly connected a TOPOLOGY_S face through the
@@ -815,6 +918,7 @@ int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
         if (encoder_split_symbol_id < 0) {
           return -1;  // Wrong split symbol id.
         }
+        ++work;
         // Symbol was part of a topology split. Now we need to determine which
         // edge should be added to the active edges stack.
         const CornerIndex act_top_corner = active_corner_stack.back();
@@ -938,6 +1042,10 @@ int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
   // If any vertex was marked as isolated, we want to remove it from the corner
   // table to ensure that all vertices in range <0, num_vertices> are valid.
   for (const VertexIndex invalid_vert : invalid_vertices) {
+    ++work;
+    if (!report_work()) {
+      return -1;
+    }
     // Find the last valid vertex and swap it with the isolated vertex.
     VertexIndex src_vert(num_vertices - 1);
     while (corner_table_->LeftMostCorner(src_vert) == kInvalidCornerIndex) {
@@ -951,6 +1059,7 @@ int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
     // Remap all corners mapped to |src_vert| to |invalid_vert|.
     VertexCornersIterator<CornerTable> vcit(corner_table_.get(), src_vert);
     for (; !vcit.End(); ++vcit) {
+      ++work;
       const CornerIndex cid = vcit.Corner();
       if (corner_table_->Vertex(cid) != src_vert) {
         // Vertex mapped to |cid| was not |src_vert|. This indicates corrupted
@@ -970,6 +1079,9 @@ int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
     // The last vertex is now invalid.
     num_vertices--;
   }
+  if (work > 0 && !decoder_->ConsumeWork(work)) {
+    return -1;
+  }
   return num_vertices;
 }
 
@@ -1020,17 +1132,22 @@ MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeHoleAndTopologySplitEvents(
     {
       // Decode source and split symbol ids using delta and varint coding. See
       // description in mesh_edgebreaker_encoder_impl.cc for more details.
+      // The deltas of each event are stored as a pair of varints that use at
+      // least one byte each.
+      if (2 * static_cast<int64_t>(num_topology_splits) >
+          decoder_buffer->remaining_size()) {
+        return -1;
+      }
+      std::vector<uint32_t> deltas(2 * num_topology_splits);
+      if (!DecodeVarintArray<uint32_t>(deltas.size(), deltas.data(),
+                                       decoder_buffer)) {
+        return -1;
+      }
       int last_source_symbol_id = 0;
       for (uint32_t i = 0; i < num_topology_splits; ++i) {
         TopologySplitEventData event_data;
-        uint32_t delta;
-        if (!DecodeVarint<uint32_t>(&delta, decoder_buffer)) {
-          return -1;
-        }
-        event_data.source_symbol_id = delta + last_source_symbol_id;
-        if (!DecodeVarint<uint32_t>(&delta, decoder_buffer)) {
-          return -1;
-        }
+        event_data.source_symbol_id = deltas[2 * i] + last_source_symbol_id;
+        const uint32_t delta = deltas[2 * i + 1];
         if (delta > event_data.source_symbol_id) {
           return -1;
         }
@@ -1081,14 +1198,18 @@ MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeHoleAndTopologySplitEvents(
 #endif
     {
       // Decode hole symbol ids using delta and varint coding.
+      if (num_hole_events > decoder_buffer->remaining_size()) {
+        return -1;
+      }
+      std::vector<uint32_t> deltas(num_hole_events);
+      if (!DecodeVarintArray<uint32_t>(deltas.size(), deltas.data(),
+                                       decoder_buffer)) {
+        return -1;
+      }
       int last_symbol_id = 0;
       for (uint32_t i = 0; i < num_hole_events; ++i) {
         HoleEventData event_data;
-        uint32_t delta;
-        if (!DecodeVarint<uint32_t>(&delta, decoder_buffer)) {
-          return -1;
-        }
-        event_data.symbol_id = delta + last_symbol_id;
+        event_data.symbol_id = deltas[i] + last_symbol_id;
         last_symbol_id = event_data.symbol_id;
         hole_event_data_.push_back(event_data);
       }
@@ -1167,11 +1288,33 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::AssignPointsToCorners(
   // Map between the existing and deduplicated point ids.
   // Note that at this point we have one point id for each corner of the
   // mesh so there is corner_table_->num_corners() point ids.
-  decoder_->mesh()->SetNumFaces(corner_table_->num_faces());
+  decoder_->mesh()->SetNumFacesUninitialized(corner_table_->num_faces());
+
+  // Without attribute seams, every vertex is a single point. Point indices are
+  // then equal to vertex indices, unless there are isolated vertices that are
+  // not assigned to any point.
+  bool is_seam_free = true;
+  for (const AttributeData &data : attribute_data_) {
+    if (!data.connectivity_data.no_interior_seams()) {
+      is_seam_free = false;
+      break;
+    }
+  }
+  if (is_seam_free && !attribute_data_.empty()) {
+    for (VertexIndex v(0); v < corner_table_->num_vertices(); ++v) {
+      if (corner_table_->LeftMostCorner(v) == kInvalidCornerIndex) {
+        is_seam_free = false;
+        break;
+      }
+    }
+    // Isolated vertices were removed from the corner table only when there is
+    // no attribute connectivity.
+    num_connectivity_verts = corner_table_->num_vertices();
+  }
 
-  if (attribute_data_.empty()) {
-    // We have connectivity for position only. In this case all vertex indices
-    // are equal to point indices.
+  if (is_seam_free) {
+    // We have connectivity for position only or no attribute has seams. In
+    // this case all vertex indices are equal to point indices.
     for (FaceIndex f(0); f < decoder_->mesh()->num_faces(); ++f) {
       Mesh::Face face;
       const CornerIndex start_corner(3 * f.value());
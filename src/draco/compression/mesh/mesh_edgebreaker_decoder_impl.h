@@ -19,6 +19,7 @@
 #include <unordered_set>
 
 #include "draco/compression/attributes/mesh_attribute_indices_encoding_data.h"
+#include "draco/compression/config/compression_shared.h"
 #include "draco/compression/mesh/mesh_edgebreaker_decoder_impl_interface.h"
 #include "draco/compression/mesh/mesh_edgebreaker_shared.h"
 #include "draco/compression/mesh/traverser/mesh_traversal_sequencer.h"
@@ -26,6 +27,7 @@
 #include "draco/draco_features.h"
 #include "draco/mesh/corner_table.h"
 #include "draco/mesh/mesh_attribute_corner_table.h"
+#include "draco/mesh/packed_corner_table.h"
 
 namespace draco {
 
@@ -68,15 +70,30 @@ class MeshEdgebreakerDecoderImpl : public MeshEdgebreakerDecoderImplInterface {
   }
 
  private:
-  // Creates a vertex traversal sequencer for the specified |TraverserT| type.
+  // Creates a vertex traversal sequencer for the specified |TraverserT| type
+  // operating on |corner_table|.
   template <class TraverserT>
   std::unique_ptr<PointsSequencer> CreateVertexTraversalSequencer(
+      const typename TraverserT::CornerTable *corner_table,
+      MeshAttributeIndicesEncodingData *encoding_data);
+
+  // Creates a vertex traversal sequencer for the given |traversal_method|.
+  // Returns nullptr if the method is not supported.
+  template <class CornerTableT>
+  std::unique_ptr<PointsSequencer> CreateVertexTraversalSequencer(
+      MeshTraversalMethod traversal_method, const CornerTableT *corner_table,
       MeshAttributeIndicesEncodingData *encoding_data);
 
   // Decodes connectivity between vertices (vertex indices).
   // Returns the number of vertices created by the decoder or -1 on error.
   int DecodeConnectivity(int num_symbols);
 
+  // Implementation of DecodeConnectivity(). When |kHasTopologySplits| is false
+  // the mesh has no topology split events and the decoding loop skips all
+  // split bookkeeping.
+  template <bool kHasTopologySplits>
+  int DecodeConnectivityImpl(int num_symbols);
+
   // Returns true if the current symbol was part of a topology split event. This
   // means that the current face was connected to the left edge of a face
   // encoded with the TOPOLOGY_S symbol. |out_symbol_edge| can be used to
@@ -139,6 +156,11 @@ class MeshEdgebreakerDecoderImpl : public MeshEdgebreakerDecoderImplInterface {
 
   std::unique_ptr<CornerTable> corner_table_;
 
+  // Packed copy of |corner_table_| used for attribute traversals when the
+  // "use_packed_corner_table" decoder option is set. Created on demand for
+  // each decoded mesh.
+  std::unique_ptr<PackedCornerTable> packed_corner_table_;
+
   // Stack used for storing corners that need to be traversed when decoding
   // mesh vertices. New corner is added for each initial face and a split
   // symbol, and one corner is removed when the end symbol is reached.
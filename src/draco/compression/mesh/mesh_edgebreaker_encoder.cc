@@ -24,20 +24,19 @@ MeshEdgebreakerEncoder::MeshEdgebreakerEncoder() {}
 
 bool MeshEdgebreakerEncoder::InitializeEncoder() {
   const bool is_standard_edgebreaker_available =
-      options()->IsFeatureSupported(features::kEdgebreaker);
+      plan()->is_edgebreaker_supported();
   const bool is_predictive_edgebreaker_available =
-      options()->IsFeatureSupported(features::kPredictiveEdgebreaker);
+      plan()->is_predictive_edgebreaker_supported();
 
   impl_ = nullptr;
   // For tiny meshes it's usually better to use the basic edgebreaker as the
   // overhead of the predictive one may turn out to be too big.
   const bool is_tiny_mesh = mesh()->num_faces() < 1000;
 
-  int selected_edgebreaker_method =
-      options()->GetGlobalInt("edgebreaker_method", -1);
+  int selected_edgebreaker_method = plan()->edgebreaker_method();
   if (selected_edgebreaker_method == -1) {
     if (is_standard_edgebreaker_available &&
-        (options()->GetSpeed() >= 5 || !is_predictive_edgebreaker_available ||
+        (plan()->speed() >= 5 || !is_predictive_edgebreaker_available ||
          is_tiny_mesh)) {
       selected_edgebreaker_method = MESH_EDGEBREAKER_STANDARD_ENCODING;
     } else {
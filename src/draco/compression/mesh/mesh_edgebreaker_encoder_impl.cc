@@ -15,6 +15,9 @@
 #include "draco/compression/mesh/mesh_edgebreaker_encoder_impl.h"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
 
 #include "draco/compression/attributes/sequential_attribute_encoders_controller.h"
 #include "draco/compression/mesh/mesh_edgebreaker_encoder.h"
@@ -25,6 +28,7 @@
 #include "draco/compression/mesh/traverser/mesh_attribute_indices_encoding_observer.h"
 #include "draco/compression/mesh/traverser/mesh_traversal_sequencer.h"
 #include "draco/compression/mesh/traverser/traverser_base.h"
+#include "draco/core/bit_utils.h"
 #include "draco/mesh/corner_table_iterators.h"
 #include "draco/mesh/mesh_misc_functions.h"
 
@@ -38,9 +42,11 @@ template <class TraversalEncoder>
 MeshEdgebreakerEncoderImpl<TraversalEncoder>::MeshEdgebreakerEncoderImpl()
     : encoder_(nullptr),
       mesh_(nullptr),
+      corner_table_(nullptr),
       last_encoded_symbol_id_(-1),
       num_split_symbols_(0),
-      use_single_connectivity_(false) {}
+      use_single_connectivity_(false),
+      peak_memory_usage_(0) {}
 
 template <class TraversalEncoder>
 bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::Init(
@@ -49,15 +55,7 @@ bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::Init(
   mesh_ = encoder->mesh();
   attribute_encoder_to_data_id_map_.clear();
 
-  if (encoder_->options()->IsGlobalOptionSet("split_mesh_on_seams")) {
-    use_single_connectivity_ =
-        encoder_->options()->GetGlobalBool("split_mesh_on_seams", false);
-  } else if (encoder_->options()->GetSpeed() >= 6) {
-    // Else use default setting based on speed.
-    use_single_connectivity_ = true;
-  } else {
-    use_single_connectivity_ = false;
-  }
+  use_single_connectivity_ = encoder_->plan()->split_mesh_on_seams();
   return true;
 }
 
@@ -68,7 +66,7 @@ MeshEdgebreakerEncoderImpl<TraversalEncoder>::GetAttributeCornerTable(
   for (uint32_t i = 0; i < attribute_data_.size(); ++i) {
     if (attribute_data_[i].attribute_index == att_id) {
       if (attribute_data_[i].is_connectivity_used) {
-        return &attribute_data_[i].connectivity_data;
+        return attribute_data_[i].connectivity_data;
       }
       return nullptr;
     }
@@ -99,11 +97,11 @@ MeshEdgebreakerEncoderImpl<TraversalEncoder>::CreateVertexTraversalSequencer(
   std::unique_ptr<MeshTraversalSequencer<TraverserT>> traversal_sequencer(
       new MeshTraversalSequencer<TraverserT>(mesh_, encoding_data));
 
-  AttObserver att_observer(corner_table_.get(), mesh_,
+  AttObserver att_observer(corner_table_, mesh_,
                            traversal_sequencer.get(), encoding_data);
 
   TraverserT att_traverser;
-  att_traverser.Init(corner_table_.get(), att_observer);
+  att_traverser.Init(corner_table_, att_observer);
 
   // Set order of corners to simulate the corner order of the decoder.
   traversal_sequencer->SetCornerOrder(processed_connectivity_corners_);
@@ -141,7 +139,7 @@ bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::GenerateAttributesEncoder(
       att->attribute_type() == GeometryAttribute::POSITION ||
       element_type == MESH_VERTEX_ATTRIBUTE ||
       (element_type == MESH_CORNER_ATTRIBUTE &&
-       attribute_data_[att_data_id].connectivity_data.no_interior_seams())) {
+       attribute_data_[att_data_id].connectivity_data->no_interior_seams())) {
     // Per-vertex attribute reached, use the basic corner table to traverse the
     // mesh.
     MeshAttributeIndicesEncodingData *encoding_data;
@@ -160,7 +158,7 @@ bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::GenerateAttributesEncoder(
       attribute_data_[att_data_id].is_connectivity_used = false;
     }
 
-    if (GetEncoder()->options()->GetSpeed() == 0 &&
+    if (GetEncoder()->plan()->speed() == 0 &&
         att->attribute_type() == GeometryAttribute::POSITION) {
       traversal_method = MESH_TRAVERSAL_PREDICTION_DEGREE;
       if (use_single_connectivity_ && mesh_->num_attributes() > 1) {
@@ -192,12 +190,12 @@ bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::GenerateAttributesEncoder(
     MeshAttributeIndicesEncodingData *const encoding_data =
         &attribute_data_[att_data_id].encoding_data;
     const MeshAttributeCornerTable *const corner_table =
-        &attribute_data_[att_data_id].connectivity_data;
+        attribute_data_[att_data_id].connectivity_data;
 
     // Ensure we use the correct number of vertices in the encoding data.
     attribute_data_[att_data_id]
         .encoding_data.vertex_to_encoded_attribute_value_index_map.assign(
-            attribute_data_[att_data_id].connectivity_data.num_vertices(), -1);
+            corner_table->num_vertices(), -1);
 
     std::unique_ptr<MeshTraversalSequencer<AttTraverser>> traversal_sequencer(
         new MeshTraversalSequencer<AttTraverser>(mesh_, encoding_data));
@@ -253,7 +251,7 @@ bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::
   }
   if (element_type == MESH_VERTEX_ATTRIBUTE ||
       (element_type == MESH_CORNER_ATTRIBUTE &&
-       attribute_data_[att_data_id].connectivity_data.no_interior_seams())) {
+       attribute_data_[att_data_id].connectivity_data->no_interior_seams())) {
     // Per-vertex encoder.
     encoder_->buffer()->Encode(static_cast<uint8_t>(MESH_VERTEX_ATTRIBUTE));
   } else {
@@ -273,10 +271,21 @@ Status MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeConnectivity() {
   // together, unless the option |use_single_connectivity_| is set in which case
   // we break the mesh along attribute seams and use the same connectivity for
   // all attributes.
-  if (use_single_connectivity_) {
-    corner_table_ = CreateCornerTableFromAllAttributes(mesh_);
+  // The corner table is taken from the encode analysis when one is available.
+  ThreadPool *const pool = encoder_->options()->thread_pool();
+  const EncodeAnalysis *const analysis = encoder_->analysis();
+  own_corner_table_.reset();
+  if (analysis != nullptr) {
+    corner_table_ = use_single_connectivity_
+                        ? analysis->all_attributes_corner_table()
+                        : analysis->position_corner_table();
   } else {
-    corner_table_ = CreateCornerTableFromPositionAttribute(mesh_);
+    if (use_single_connectivity_) {
+      own_corner_table_ = CreateCornerTableFromAllAttributes(mesh_, pool);
+    } else {
+      own_corner_table_ = CreateCornerTableFromPositionAttribute(mesh_, pool);
+    }
+    corner_table_ = own_corner_table_.get();
   }
   if (corner_table_ == nullptr ||
       corner_table_->num_faces() == corner_table_->NumDegeneratedFaces()) {
@@ -305,15 +314,18 @@ Status MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeConnectivity() {
   pos_encoding_data_.vertex_to_encoded_attribute_value_index_map.assign(
       corner_table_->num_vertices(), -1);
   pos_encoding_data_.encoded_attribute_value_index_to_corner_map.clear();
+  // In the low memory mode, reserve space only for the expected number of
+  // encoded values, which is usually much smaller than the number of corners.
   pos_encoding_data_.encoded_attribute_value_index_to_corner_map.reserve(
-      corner_table_->num_faces() * 3);
+      encoder_->plan()->low_memory_encoding() ? corner_table_->num_vertices()
+                                              : corner_table_->num_faces() * 3);
   visited_vertex_ids_.assign(corner_table_->num_vertices(), false);
   vertex_traversal_length_.clear();
   last_encoded_symbol_id_ = -1;
   num_split_symbols_ = 0;
+  peak_memory_usage_ = 0;
   topology_split_event_data_.clear();
   face_to_split_symbol_map_.clear();
-  visited_holes_.clear();
   vertex_hole_id_.assign(corner_table_->num_vertices(), -1);
   processed_connectivity_corners_.clear();
   processed_connectivity_corners_.reserve(corner_table_->num_faces());
@@ -326,76 +338,37 @@ Status MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeConnectivity() {
   if (!InitAttributeData()) {
     return Status(Status::DRACO_ERROR, "Failed to initialize attribute data.");
   }
+  UpdatePeakMemoryUsage();
 
   const uint8_t num_attribute_data =
       static_cast<uint8_t>(attribute_data_.size());
   encoder_->buffer()->Encode(num_attribute_data);
   traversal_encoder_.SetNumAttributeData(num_attribute_data);
 
-  const int num_corners = corner_table_->num_corners();
-
   traversal_encoder_.Start();
 
   std::vector<CornerIndex> init_face_connectivity_corners;
-  // Traverse the surface starting from each unvisited corner.
-  for (int c_id = 0; c_id < num_corners; ++c_id) {
-    CornerIndex corner_index(c_id);
-    const FaceIndex face_id = corner_table_->Face(corner_index);
-    if (visited_faces_[face_id.value()]) {
-      continue;  // Face has been already processed.
+  if (encoder_->plan()->spatial_traversal_order()) {
+    // Start the traversal of each component at its spatially first face and
+    // traverse the components in the Morton order of their start faces.
+    for (const FaceIndex face_id : FindSpatialStartFaces()) {
+      if (!visited_faces_[face_id.value()] &&
+          !EncodeComponent(face_id, &init_face_connectivity_corners)) {
+        return Status(Status::DRACO_ERROR, "Failed to encode mesh component.");
+      }
     }
+  }
+  // Traverse the surface starting from each unvisited face. Visited faces are
+  // skipped by scanning the bit vector a word at a time.
+  const size_t num_faces_to_scan = visited_faces_.size();
+  for (size_t f = visited_faces_.FindNextUnset(0); f < num_faces_to_scan;
+       f = visited_faces_.FindNextUnset(f + 1)) {
+    const FaceIndex face_id(static_cast<uint32_t>(f));
     if (corner_table_->IsDegenerated(face_id)) {
       continue;  // Ignore degenerated faces.
     }
-
-    CornerIndex start_corner;
-    const bool interior_config =
-        FindInitFaceConfiguration(face_id, &start_corner);
-    traversal_encoder_.EncodeStartFaceConfiguration(interior_config);
-
-    if (interior_config) {
-      // Select the correct vertex on the face as the root.
-      corner_index = start_corner;
-      const VertexIndex vert_id = corner_table_->Vertex(corner_index);
-      // Mark all vertices of a given face as visited.
-      const VertexIndex next_vert_id =
-          corner_table_->Vertex(corner_table_->Next(corner_index));
-      const VertexIndex prev_vert_id =
-          corner_table_->Vertex(corner_table_->Previous(corner_index));
-
-      visited_vertex_ids_[vert_id.value()] = true;
-      visited_vertex_ids_[next_vert_id.value()] = true;
-      visited_vertex_ids_[prev_vert_id.value()] = true;
-      // New traversal started. Initiate it's length with the first vertex.
-      vertex_traversal_length_.push_back(1);
-
-      // Mark the face as visited.
-      visited_faces_[face_id.value()] = true;
-      // Start compressing from the opposite face of the "next" corner. This way
-      // the first encoded corner corresponds to the tip corner of the regular
-      // edgebreaker traversal (essentially the initial face can be then viewed
-      // as a TOPOLOGY_C face).
-      init_face_connectivity_corners.push_back(
-          corner_table_->Next(corner_index));
-      const CornerIndex opp_id =
-          corner_table_->Opposite(corner_table_->Next(corner_index));
-      const FaceIndex opp_face_id = corner_table_->Face(opp_id);
-      if (opp_face_id != kInvalidFaceIndex &&
-          !visited_faces_[opp_face_id.value()]) {
-        if (!EncodeConnectivityFromCorner(opp_id)) {
-          return Status(Status::DRACO_ERROR,
-                        "Failed to encode mesh component.");
-        }
-      }
-    } else {
-      // Boundary configuration. We start on a boundary rather than on a face.
-      // First encode the hole that's opposite to the start_corner.
-      EncodeHole(corner_table_->Next(start_corner), true);
-      // Start processing the face opposite to the boundary edge (the face
-      // containing the start_corner).
-      if (!EncodeConnectivityFromCorner(start_corner)) {
-        return Status(Status::DRACO_ERROR, "Failed to encode mesh component.");
-      }
+    if (!EncodeComponent(face_id, &init_face_connectivity_corners)) {
+      return Status(Status::DRACO_ERROR, "Failed to encode mesh component.");
     }
   }
   // Reverse the order of connectivity corners to match the order in which
@@ -415,6 +388,7 @@ Status MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeConnectivity() {
       EncodeAttributeConnectivitiesOnFace(ci);
     }
   }
+  UpdatePeakMemoryUsage();
   traversal_encoder_.Done();
 
   // Encode the number of symbols.
@@ -432,6 +406,14 @@ Status MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeConnectivity() {
   encoder_->buffer()->Encode(traversal_encoder_.buffer().data(),
                              traversal_encoder_.buffer().size());
 
+  UpdatePeakMemoryUsage();
+  if (encoder_->options()->coding_stats() != nullptr) {
+    encoder_->options()->coding_stats()->RecordPeakMemory(
+        "connectivity", static_cast<int64_t>(peak_memory_usage_));
+  }
+  if (encoder_->plan()->low_memory_encoding()) {
+    ReleaseConnectivityData();
+  }
   return OkStatus();
 }
 
@@ -502,6 +484,158 @@ bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::FindInitFaceConfiguration(
   return true;
 }
 
+template <class TraversalEncoder>
+bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeComponent(
+    FaceIndex face_id,
+    std::vector<CornerIndex> *init_face_connectivity_corners) {
+  CornerIndex start_corner;
+  const bool interior_config =
+      FindInitFaceConfiguration(face_id, &start_corner);
+  traversal_encoder_.EncodeStartFaceConfiguration(interior_config);
+
+  if (interior_config) {
+    // Select the correct vertex on the face as the root.
+    const CornerIndex corner_index = start_corner;
+    const VertexIndex vert_id = corner_table_->Vertex(corner_index);
+    // Mark all vertices of a given face as visited.
+    const VertexIndex next_vert_id =
+        corner_table_->Vertex(corner_table_->Next(corner_index));
+    const VertexIndex prev_vert_id =
+        corner_table_->Vertex(corner_table_->Previous(corner_index));
+
+    visited_vertex_ids_.Set(vert_id.value());
+    visited_vertex_ids_.Set(next_vert_id.value());
+    visited_vertex_ids_.Set(prev_vert_id.value());
+    // New traversal started. Initiate it's length with the first vertex.
+    vertex_traversal_length_.push_back(1);
+
+    // Mark the face as visited.
+    visited_faces_.Set(face_id.value());
+    // Start compressing from the opposite face of the "next" corner. This way
+    // the first encoded corner corresponds to the tip corner of the regular
+    // edgebreaker traversal (essentially the initial face can be then viewed
+    // as a TOPOLOGY_C face).
+    init_face_connectivity_corners->push_back(
+        corner_table_->Next(corner_index));
+    const CornerIndex opp_id =
+        corner_table_->Opposite(corner_table_->Next(corner_index));
+    const FaceIndex opp_face_id = corner_table_->Face(opp_id);
+    if (opp_face_id != kInvalidFaceIndex &&
+        !visited_faces_[opp_face_id.value()]) {
+      return EncodeConnectivityFromCorner(opp_id);
+    }
+    return true;
+  }
+  // Boundary configuration. We start on a boundary rather than on a face.
+  // First encode the hole that's opposite to the start_corner.
+  EncodeHole(corner_table_->Next(start_corner), true);
+  // Start processing the face opposite to the boundary edge (the face
+  // containing the start_corner).
+  return EncodeConnectivityFromCorner(start_corner);
+}
+
+template <class TraversalEncoder>
+std::vector<FaceIndex>
+MeshEdgebreakerEncoderImpl<TraversalEncoder>::FindSpatialStartFaces() const {
+  std::vector<FaceIndex> start_faces;
+  const PointAttribute *const pos_att =
+      mesh_->GetNamedAttribute(GeometryAttribute::POSITION);
+  if (pos_att == nullptr || pos_att->num_components() != 3) {
+    return start_faces;
+  }
+  const int num_values = static_cast<int>(pos_att->size());
+  std::vector<float> positions(num_values * 3);
+  float min_values[3] = {std::numeric_limits<float>::max(),
+                         std::numeric_limits<float>::max(),
+                         std::numeric_limits<float>::max()};
+  float max_values[3] = {std::numeric_limits<float>::lowest(),
+                         std::numeric_limits<float>::lowest(),
+                         std::numeric_limits<float>::lowest()};
+  for (AttributeValueIndex i(0); i < num_values; ++i) {
+    float *const value = &positions[i.value() * 3];
+    if (!pos_att->ConvertValue<float>(i, 3, value)) {
+      return start_faces;
+    }
+    for (int c = 0; c < 3; ++c) {
+      if (!std::isfinite(value[c])) {
+        value[c] = 0.f;
+      }
+      min_values[c] = std::min(min_values[c], value[c]);
+      max_values[c] = std::max(max_values[c], value[c]);
+    }
+  }
+  // Quantize the face centers to a 21-bit grid over the bounds of the
+  // positions. The sum of the three corner positions is quantized so that the
+  // centers do not need to be divided.
+  const float max_coordinate = static_cast<float>((1u << 21) - 1);
+  float scales[3];
+  for (int c = 0; c < 3; ++c) {
+    const float range = max_values[c] - min_values[c];
+    scales[c] = range > 0 ? max_coordinate / (3.f * range) : 0.f;
+  }
+  const auto face_code = [&](FaceIndex f) {
+    const Mesh::Face &face = mesh_->face(f);
+    float sum[3] = {0.f, 0.f, 0.f};
+    for (int k = 0; k < 3; ++k) {
+      const float *const value =
+          &positions[pos_att->mapped_index(face[k]).value() * 3];
+      for (int c = 0; c < 3; ++c) {
+        sum[c] += value[c] - min_values[c];
+      }
+    }
+    uint64_t code = 0;
+    for (int c = 0; c < 3; ++c) {
+      code |= SpreadBitsBy3(static_cast<uint32_t>(
+                  std::min(sum[c] * scales[c], max_coordinate)))
+              << c;
+    }
+    return code;
+  };
+
+  // Flood fill the components over the face adjacency of the corner table and
+  // keep the face with the lowest code of each component.
+  const int num_faces = corner_table_->num_faces();
+  std::vector<std::pair<uint64_t, FaceIndex>> seeds;
+  std::vector<bool> is_face_reached(num_faces, false);
+  std::vector<FaceIndex> face_stack;
+  for (FaceIndex f(0); f < num_faces; ++f) {
+    if (is_face_reached[f.value()] || corner_table_->IsDegenerated(f)) {
+      continue;
+    }
+    std::pair<uint64_t, FaceIndex> seed(std::numeric_limits<uint64_t>::max(),
+                                        f);
+    is_face_reached[f.value()] = true;
+    face_stack.push_back(f);
+    while (!face_stack.empty()) {
+      const FaceIndex face = face_stack.back();
+      face_stack.pop_back();
+      const uint64_t code = face_code(face);
+      if (code < seed.first) {
+        seed = std::make_pair(code, face);
+      }
+      for (int k = 0; k < 3; ++k) {
+        const CornerIndex opp_corner = corner_table_->Opposite(
+            corner_table_->FirstCorner(face) + k);
+        if (opp_corner == kInvalidCornerIndex) {
+          continue;
+        }
+        const FaceIndex opp_face = corner_table_->Face(opp_corner);
+        if (!is_face_reached[opp_face.value()]) {
+          is_face_reached[opp_face.value()] = true;
+          face_stack.push_back(opp_face);
+        }
+      }
+    }
+    seeds.push_back(seed);
+  }
+  std::sort(seeds.begin(), seeds.end());
+  start_faces.reserve(seeds.size());
+  for (const auto &seed : seeds) {
+    start_faces.push_back(seed.second);
+  }
+  return start_faces;
+}
+
 template <class TraversalEncoder>
 bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeConnectivityFromCorner(
     CornerIndex corner_id) {
@@ -525,7 +659,7 @@ bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeConnectivityFromCorner(
       ++last_encoded_symbol_id_;
 
       const FaceIndex face_id = corner_table_->Face(corner_id);
-      visited_faces_[face_id.value()] = true;
+      visited_faces_.Set(face_id.value());
       processed_connectivity_corners_.push_back(corner_id);
       traversal_encoder_.NewCornerReached(corner_id);
       const VertexIndex vert_id = corner_table_->Vertex(corner_id);
@@ -533,7 +667,7 @@ bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeConnectivityFromCorner(
       if (!IsVertexVisited(vert_id)) {
         // A new unvisited vertex has been reached. We need to store its
         // position difference using next, prev, and opposite vertices.
-        visited_vertex_ids_[vert_id.value()] = true;
+        visited_vertex_ids_.Set(vert_id.value());
         if (!on_boundary) {
           // If the vertex is on boundary it must correspond to an unvisited
           // hole and it will be encoded with TOPOLOGY_S symbol later).
@@ -632,13 +766,13 @@ int MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeHole(
 
   int num_encoded_hole_verts = 0;
   if (encode_first_vertex) {
-    visited_vertex_ids_[start_vertex_id.value()] = true;
+    visited_vertex_ids_.Set(start_vertex_id.value());
     ++num_encoded_hole_verts;
   }
 
   // corner_id is now opposite to the boundary edge.
   // Mark the hole as visited.
-  visited_holes_[vertex_hole_id_[start_vertex_id.value()]] = true;
+  visited_holes_.Set(vertex_hole_id_[start_vertex_id.value()]);
   // Get the start vertex of the edge and use it as a reference.
   VertexIndex start_vert_id =
       corner_table_->Vertex(corner_table_->Next(corner_id));
@@ -651,7 +785,7 @@ int MeshEdgebreakerEncoderImpl<TraversalEncoder>::EncodeHole(
     start_vert_id = act_vertex_id;
 
     // Mark the vertex as visited.
-    visited_vertex_ids_[act_vertex_id.value()] = true;
+    visited_vertex_ids_.Set(act_vertex_id.value());
     ++num_encoded_hole_verts;
     corner_id = corner_table_->Next(corner_id);
     // Look for the next attached open boundary edge.
@@ -706,6 +840,7 @@ template <class TraversalEncoder>
 bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::FindHoles() {
   // TODO(ostava): Add more error checking for invalid geometry data.
   const int num_corners = corner_table_->num_corners();
+  int num_holes = 0;
   // Go over all corners and detect non-visited open boundaries
   for (CornerIndex i(0); i < num_corners; ++i) {
     if (corner_table_->IsDegenerated(corner_table_->Face(i))) {
@@ -724,8 +859,7 @@ bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::FindHoles() {
       }
       // Else we found a new open boundary and we are going to traverse along it
       // and mark all visited vertices.
-      const int boundary_id = static_cast<int>(visited_holes_.size());
-      visited_holes_.push_back(false);
+      const int boundary_id = num_holes++;
 
       CornerIndex corner_id = i;
       while (vertex_hole_id_[boundary_vert_id.value()] == -1) {
@@ -743,6 +877,7 @@ bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::FindHoles() {
       }
     }
   }
+  visited_holes_.assign(num_holes, false);
   return true;
 }
 
@@ -801,10 +936,29 @@ bool MeshEdgebreakerEncoderImpl<TraversalEncoder>::InitAttributeData() {
         .encoding_data.encoded_attribute_value_index_to_corner_map.reserve(
             corner_table_->num_corners());
     attribute_data_[data_index].encoding_data.num_values = 0;
-    attribute_data_[data_index].connectivity_data.InitFromAttribute(
-        mesh_, corner_table_.get(), att);
     ++data_index;
   }
+  // Reuse the attribute corner tables of the encode analysis. They were built
+  // on top of its position corner table which is used as |corner_table_|.
+  const EncodeAnalysis *const analysis = encoder_->analysis();
+  if (analysis != nullptr) {
+    for (AttributeData &data : attribute_data_) {
+      data.connectivity_data =
+          analysis->attribute_corner_table(data.attribute_index);
+    }
+    return true;
+  }
+  // Seams of each attribute are detected independently, so the attribute
+  // corner tables can be built in parallel.
+  ParallelFor(encoder_->options()->thread_pool(),
+              static_cast<int>(attribute_data_.size()), [&](int i) {
+                const PointAttribute *const att =
+                    mesh_->attribute(attribute_data_[i].attribute_index);
+                attribute_data_[i].own_connectivity_data.InitFromAttribute(
+                    mesh_, corner_table_, att);
+                attribute_data_[i].connectivity_data =
+                    &attribute_data_[i].own_connectivity_data;
+              });
   return true;
 }
 
@@ -821,7 +975,7 @@ bool MeshEdgebreakerEncoderImpl<
                                   corner_table_->Previous(corner)};
 
   const FaceIndex src_face_id = corner_table_->Face(corner);
-  visited_faces_[src_face_id.value()] = true;
+  visited_faces_.Set(src_face_id.value());
   for (int c = 0; c < 3; ++c) {
     const CornerIndex opp_corner = corner_table_->Opposite(corners[c]);
     if (opp_corner == kInvalidCornerIndex) {
@@ -834,7 +988,7 @@ bool MeshEdgebreakerEncoderImpl<
     }
 
     for (uint32_t i = 0; i < attribute_data_.size(); ++i) {
-      if (attribute_data_[i].connectivity_data.IsCornerOppositeToSeamEdge(
+      if (attribute_data_[i].connectivity_data->IsCornerOppositeToSeamEdge(
               corners[c])) {
         traversal_encoder_.EncodeAttributeSeam(i, true);
       } else {
@@ -845,6 +999,51 @@ bool MeshEdgebreakerEncoderImpl<
   return true;
 }
 
+template <class TraversalEncoder>
+size_t MeshEdgebreakerEncoderImpl<TraversalEncoder>::GetMemoryUsage() const {
+  // Connectivity data shared through the encode analysis is not counted.
+  size_t num_bytes = (own_corner_table_ ? own_corner_table_->memory_usage()
+                                        : 0) +
+                     visited_faces_.memory_usage() +
+                     visited_vertex_ids_.memory_usage() +
+                     visited_holes_.memory_usage() +
+                     traversal_encoder_.memory_usage();
+  num_bytes += processed_connectivity_corners_.capacity() * sizeof(CornerIndex);
+  num_bytes += corner_traversal_stack_.capacity() * sizeof(CornerIndex);
+  num_bytes += vertex_hole_id_.capacity() * sizeof(int);
+  num_bytes += topology_split_event_data_.capacity() *
+               sizeof(TopologySplitEventData);
+  // Approximate size of a node of the hash map.
+  num_bytes += face_to_split_symbol_map_.size() * (2 * sizeof(int) +
+                                                   sizeof(void *));
+  const auto encoding_data_usage =
+      [](const MeshAttributeIndicesEncodingData &data) {
+        return data.encoded_attribute_value_index_to_corner_map.capacity() *
+                   sizeof(CornerIndex) +
+               data.vertex_to_encoded_attribute_value_index_map.capacity() *
+                   sizeof(int32_t);
+      };
+  num_bytes += encoding_data_usage(pos_encoding_data_);
+  for (const AttributeData &data : attribute_data_) {
+    num_bytes += data.own_connectivity_data.memory_usage() +
+                 encoding_data_usage(data.encoding_data);
+  }
+  return num_bytes;
+}
+
+template <class TraversalEncoder>
+void MeshEdgebreakerEncoderImpl<TraversalEncoder>::ReleaseConnectivityData() {
+  // The corner tables, the encoding data and the order of processed corners
+  // are still needed for encoding of the attributes.
+  visited_vertex_ids_ = BitVector();
+  visited_holes_ = BitVector();
+  std::vector<int>().swap(vertex_hole_id_);
+  std::vector<CornerIndex>().swap(corner_traversal_stack_);
+  std::vector<TopologySplitEventData>().swap(topology_split_event_data_);
+  std::unordered_map<int, int>().swap(face_to_split_symbol_map_);
+  traversal_encoder_ = TraversalEncoder();
+}
+
 template class MeshEdgebreakerEncoderImpl<MeshEdgebreakerTraversalEncoder>;
 template class MeshEdgebreakerEncoderImpl<
     MeshEdgebreakerTraversalPredictiveEncoder>;
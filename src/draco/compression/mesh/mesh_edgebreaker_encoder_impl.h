@@ -15,13 +15,16 @@
 #ifndef DRACO_COMPRESSION_MESH_MESH_EDGEBREAKER_ENCODER_IMPL_H_
 #define DRACO_COMPRESSION_MESH_MESH_EDGEBREAKER_ENCODER_IMPL_H_
 
+#include <algorithm>
 #include <unordered_map>
+#include <vector>
 
 #include "draco/compression/attributes/mesh_attribute_indices_encoding_data.h"
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/mesh/mesh_edgebreaker_encoder_impl_interface.h"
 #include "draco/compression/mesh/mesh_edgebreaker_shared.h"
 #include "draco/compression/mesh/traverser/mesh_traversal_sequencer.h"
+#include "draco/core/bit_vector.h"
 #include "draco/core/encoder_buffer.h"
 #include "draco/mesh/mesh_attribute_corner_table.h"
 
@@ -47,9 +50,7 @@ class MeshEdgebreakerEncoderImpl : public MeshEdgebreakerEncoderImplInterface {
   bool EncodeAttributesEncoderIdentifier(int32_t att_encoder_id) override;
   Status EncodeConnectivity() override;
 
-  const CornerTable *GetCornerTable() const override {
-    return corner_table_.get();
-  }
+  const CornerTable *GetCornerTable() const override { return corner_table_; }
   bool IsFaceEncoded(FaceIndex fi) const override {
     return visited_faces_[fi.value()];
   }
@@ -76,6 +77,19 @@ class MeshEdgebreakerEncoderImpl : public MeshEdgebreakerEncoderImplInterface {
   // Encodes the connectivity between vertices.
   bool EncodeConnectivityFromCorner(CornerIndex corner_id);
 
+  // Encodes the connected component of the unvisited, non-degenerate face
+  // |face_id| starting the traversal at that face. The corners of initial
+  // faces are appended to |init_face_connectivity_corners|.
+  bool EncodeComponent(
+      FaceIndex face_id,
+      std::vector<CornerIndex> *init_face_connectivity_corners);
+
+  // Returns one start face for each connected component of the mesh. The start
+  // face of a component is its face with the lowest Morton code of the face
+  // center and the components are sorted by the codes of their start faces.
+  // Used when EncodePlan::spatial_traversal_order() is set.
+  std::vector<FaceIndex> FindSpatialStartFaces() const;
+
   // Encodes all vertices of a hole starting at start_corner_id.
   // The vertex associated with the first corner is encoded only if
   // |encode_first_vertex| is true.
@@ -124,12 +138,27 @@ class MeshEdgebreakerEncoderImpl : public MeshEdgebreakerEncoderImplInterface {
   // Returns false when one or more attributes failed to be processed.
   bool GenerateEncodingOrderForAttributes();
 
+  // Returns the approximate number of bytes of working memory currently
+  // allocated by the encoder, including the corner tables.
+  size_t GetMemoryUsage() const;
+
+  // Updates |peak_memory_usage_| with the current GetMemoryUsage().
+  void UpdatePeakMemoryUsage() {
+    peak_memory_usage_ = std::max(peak_memory_usage_, GetMemoryUsage());
+  }
+
+  // Frees data that is not needed after the connectivity has been encoded.
+  // Used in the low memory mode, see EncodePlan::low_memory_encoding().
+  void ReleaseConnectivityData();
+
   // The main encoder that owns this class.
   MeshEdgebreakerEncoder *encoder_;
   // Mesh that's being encoded.
   const Mesh *mesh_;
-  // Corner table stores the mesh face connectivity data.
-  std::unique_ptr<CornerTable> corner_table_;
+  // Corner table stores the mesh face connectivity data. It is either owned by
+  // this class or taken from the encode analysis of the mesh.
+  const CornerTable *corner_table_;
+  std::unique_ptr<CornerTable> own_corner_table_;
   // Stack used for storing corners that need to be traversed when encoding
   // the connectivity. New corner is added for each initial face and a split
   // symbol, and one corner is removed when the end symbol is reached.
@@ -139,7 +168,7 @@ class MeshEdgebreakerEncoderImpl : public MeshEdgebreakerEncoderImplInterface {
   // memory overflow when compressing huge meshes.
   std::vector<CornerIndex> corner_traversal_stack_;
   // Array for marking visited faces.
-  std::vector<bool> visited_faces_;
+  BitVector visited_faces_;
 
   // Attribute data for position encoding.
   MeshAttributeIndicesEncodingData pos_encoding_data_;
@@ -153,7 +182,7 @@ class MeshEdgebreakerEncoderImpl : public MeshEdgebreakerEncoderImplInterface {
   std::vector<CornerIndex> processed_connectivity_corners_;
 
   // Array for storing visited vertex ids of all input vertices.
-  std::vector<bool> visited_vertex_ids_;
+  BitVector visited_vertex_ids_;
 
   // For each traversal, this array stores the number of visited vertices.
   std::vector<int> vertex_traversal_length_;
@@ -165,7 +194,7 @@ class MeshEdgebreakerEncoderImpl : public MeshEdgebreakerEncoderImplInterface {
   std::unordered_map<int, int> face_to_split_symbol_map_;
 
   // Array for marking holes that has been reached during the traversal.
-  std::vector<bool> visited_holes_;
+  BitVector visited_holes_;
   // Array for mapping vertices to hole ids. If a vertex is not on a hole, the
   // stored value is -1.
   std::vector<int> vertex_hole_id_;
@@ -178,9 +207,15 @@ class MeshEdgebreakerEncoderImpl : public MeshEdgebreakerEncoderImplInterface {
 
   // Struct holding data used for encoding each non-position attribute.
   struct AttributeData {
-    AttributeData() : attribute_index(-1), is_connectivity_used(true) {}
+    AttributeData()
+        : attribute_index(-1),
+          connectivity_data(nullptr),
+          is_connectivity_used(true) {}
     int attribute_index;
-    MeshAttributeCornerTable connectivity_data;
+    // Points either to |own_connectivity_data| or to the attribute corner table
+    // of the encode analysis.
+    const MeshAttributeCornerTable *connectivity_data;
+    MeshAttributeCornerTable own_connectivity_data;
     // Flag that can mark the connectivity_data invalid. In such case the base
     // corner table of the mesh should be used instead.
     bool is_connectivity_used;
@@ -202,6 +237,9 @@ class MeshEdgebreakerEncoderImpl : public MeshEdgebreakerEncoderImplInterface {
   // connectivity separately, but the decoded model may contain higher number of
   // duplicate attribute values which may decrease the compression ratio.
   bool use_single_connectivity_;
+
+  // Largest GetMemoryUsage() observed while encoding the connectivity.
+  size_t peak_memory_usage_;
 };
 
 }  // namespace draco
@@ -12,11 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <cstring>
 #include <sstream>
 
 #include "draco/compression/encode.h"
 #include "draco/compression/mesh/mesh_edgebreaker_decoder.h"
 #include "draco/compression/mesh/mesh_edgebreaker_encoder.h"
+#include "draco/core/coding_stats.h"
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
 #include "draco/io/mesh_io.h"
@@ -111,6 +113,71 @@ TEST_F(MeshEdgebreakerEncodingTest, TestEncoderReuse) {
   }
 }
 
+TEST_F(MeshEdgebreakerEncodingTest, TestLowMemoryEncoding) {
+  // Tests that the low memory mode produces the same data as the default mode
+  // with all edgebreaker methods and that it reports a lower peak memory.
+  const std::string file_names[] = {"bunny_norm.obj", "cube_att.obj",
+                                    "test_nm.obj"};
+  for (const std::string &file_name : file_names) {
+    const std::unique_ptr<Mesh> mesh(ReadMeshFromTestFile(file_name));
+    ASSERT_NE(mesh, nullptr) << "Failed to load test model " << file_name;
+    for (int speed = 0; speed <= 10; speed += 5) {
+      EncoderBuffer buffers[2];
+      CodingStats stats[2];
+      for (int low_memory = 0; low_memory < 2; ++low_memory) {
+        MeshEdgebreakerEncoder encoder;
+        EncoderOptions encoder_options = EncoderOptions::CreateDefaultOptions();
+        encoder_options.SetSpeed(speed, speed);
+        encoder_options.SetGlobalBool("low_memory_encoding", low_memory == 1);
+        encoder_options.SetCodingStats(&stats[low_memory]);
+        encoder.SetMesh(*mesh);
+        DRACO_ASSERT_OK(encoder.Encode(encoder_options, &buffers[low_memory]));
+      }
+      ASSERT_EQ(buffers[0].size(), buffers[1].size()) << file_name;
+      ASSERT_EQ(memcmp(buffers[0].data(), buffers[1].data(),
+                       buffers[0].size()),
+                0)
+          << file_name;
+      ASSERT_GT(stats[1].GetPeakMemory("connectivity"), 0);
+      ASSERT_LT(stats[1].GetPeakMemory("connectivity"),
+                stats[0].GetPeakMemory("connectivity"))
+          << file_name;
+    }
+  }
+}
+
+TEST_F(MeshEdgebreakerEncodingTest, TestSpatialTraversalOrder) {
+  // Tests that meshes encoded with the components traversed in the spatial
+  // order are decoded correctly with all edgebreaker methods.
+  const std::string file_names[] = {"bunny_norm.obj", "cube_att.obj",
+                                    "multiple_tetrahedrons.obj",
+                                    "multiple_isolated_triangles.obj"};
+  for (const std::string &file_name : file_names) {
+    std::unique_ptr<Mesh> mesh(ReadMeshFromTestFile(file_name));
+    ASSERT_NE(mesh, nullptr) << "Failed to load test model " << file_name;
+    for (int speed = 0; speed <= 10; speed += 5) {
+      MeshEdgebreakerEncoder encoder;
+      EncoderOptions encoder_options = EncoderOptions::CreateDefaultOptions();
+      encoder_options.SetSpeed(speed, speed);
+      encoder_options.SetGlobalBool("spatial_traversal_order", true);
+      encoder.SetMesh(*mesh);
+      EncoderBuffer buffer;
+      DRACO_ASSERT_OK(encoder.Encode(encoder_options, &buffer));
+
+      DecoderBuffer dec_buffer;
+      dec_buffer.Init(buffer.data(), buffer.size());
+      MeshEdgebreakerDecoder decoder;
+      std::unique_ptr<Mesh> decoded_mesh(new Mesh());
+      DecoderOptions dec_options;
+      DRACO_ASSERT_OK(
+          decoder.Decode(dec_options, &dec_buffer, decoded_mesh.get()));
+      DRACO_ASSERT_OK(MeshCleanup::Cleanup(mesh.get(), MeshCleanupOptions()));
+      MeshAreEquivalent eq;
+      ASSERT_TRUE(eq(*mesh, *decoded_mesh)) << file_name;
+    }
+  }
+}
+
 TEST_F(MeshEdgebreakerEncodingTest, TestDecoderReuse) {
   // Tests whether the edgebreaker decoder can be reused multiple times to
   // decode a given mesh.
@@ -184,6 +251,36 @@ TEST_F(MeshEdgebreakerEncodingTest, TestSingleConnectivityEncoding) {
   }
 }
 
+TEST_F(MeshEdgebreakerEncodingTest, TestIdentityMappingWithoutSeams) {
+  // Tests that attributes decoded with the position connectivity use identity
+  // mapping between points and attribute values.
+  for (const std::string file_name : {"bun_zipper.ply", "cube_att.obj"}) {
+    const std::unique_ptr<Mesh> mesh(ReadMeshFromTestFile(file_name));
+    ASSERT_NE(mesh, nullptr) << "Failed to load test model " << file_name;
+    EncoderOptionsBase<GeometryAttribute::Type> options =
+        EncoderOptionsBase<GeometryAttribute::Type>::CreateDefaultOptions();
+    options.SetGlobalBool("split_mesh_on_seams", true);
+    draco::Encoder encoder;
+    encoder.Reset(options);
+    encoder.SetEncodingMethod(MESH_EDGEBREAKER_ENCODING);
+    EncoderBuffer buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &buffer));
+
+    DecoderBuffer dec_buffer;
+    dec_buffer.Init(buffer.data(), buffer.size());
+    Decoder decoder;
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Mesh> dec_mesh,
+                           decoder.DecodeMeshFromBuffer(&dec_buffer));
+    ASSERT_EQ(dec_mesh->num_attributes(), mesh->num_attributes());
+    for (int i = 0; i < dec_mesh->num_attributes(); ++i) {
+      const PointAttribute *const att = dec_mesh->attribute(i);
+      ASSERT_TRUE(att->is_mapping_identity()) << file_name;
+      ASSERT_EQ(att->size(), dec_mesh->num_points());
+    }
+    ASSERT_TRUE(MeshAreEquivalent()(*mesh, *dec_mesh)) << file_name;
+  }
+}
+
 TEST_F(MeshEdgebreakerEncodingTest, TestWrongAttributeOrder) {
   // Tests whether the edgebreaker method successfully encodes a mesh where the
   // input attributes are in wrong order (because of their internal
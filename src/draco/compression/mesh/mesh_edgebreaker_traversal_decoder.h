@@ -15,6 +15,9 @@
 #ifndef DRACO_COMPRESSION_MESH_MESH_EDGEBREAKER_TRAVERSAL_DECODER_H_
 #define DRACO_COMPRESSION_MESH_MESH_EDGEBREAKER_TRAVERSAL_DECODER_H_
 
+#include <cstring>
+#include <vector>
+
 #include "draco/compression/bit_coders/rans_bit_decoder.h"
 #include "draco/compression/mesh/mesh_edgebreaker_decoder.h"
 #include "draco/compression/mesh/mesh_edgebreaker_decoder_impl_interface.h"
@@ -32,6 +35,8 @@ class MeshEdgebreakerTraversalDecoder {
   MeshEdgebreakerTraversalDecoder()
       : attribute_connectivity_decoders_(nullptr),
         num_attribute_data_(0),
+        num_symbols_(0),
+        next_symbol_id_(0),
         decoder_impl_(nullptr) {}
   void Init(MeshEdgebreakerDecoderImplInterface *decoder) {
     decoder_impl_ = decoder;
@@ -53,6 +58,12 @@ class MeshEdgebreakerTraversalDecoder {
   // the connectivity.
   void SetNumAttributeData(int num_data) { num_attribute_data_ = num_data; }
 
+  // Sets the number of encoded traversal symbols. Must be called before
+  // Start() because all symbols are decoded there at once.
+  void SetNumEncodedSymbols(uint32_t num_symbols) {
+    num_symbols_ = num_symbols;
+  }
+
   // Called before the traversal decoding is started.
   // Returns a buffer decoder that points to data that was encoded after the
   // traversal.
@@ -91,16 +102,10 @@ class MeshEdgebreakerTraversalDecoder {
 
   // Returns the next edgebreaker symbol that was reached during the traversal.
   inline uint32_t DecodeSymbol() {
-    uint32_t symbol;
-    symbol_buffer_.DecodeLeastSignificantBits32(1, &symbol);
-    if (symbol == TOPOLOGY_C) {
-      return symbol;
+    if (next_symbol_id_ >= num_symbols_) {
+      return TOPOLOGY_INVALID;
     }
-    // Else decode two additional bits.
-    uint32_t symbol_suffix;
-    symbol_buffer_.DecodeLeastSignificantBits32(2, &symbol_suffix);
-    symbol |= (symbol_suffix << 1);
-    return symbol;
+    return symbols_[next_symbol_id_++];
   }
 
   // Called whenever a new active corner is set in the decoder.
@@ -115,7 +120,18 @@ class MeshEdgebreakerTraversalDecoder {
   // |attribute| is used to mark the id of the non-position attribute (in range
   // of <0, num_attributes - 1>).
   inline bool DecodeAttributeSeam(int attribute) {
-    return attribute_connectivity_decoders_[attribute].DecodeNextBit();
+    // The seam flags are decoded in batches of 32 bits. The last batch may
+    // read past the end of the encoded flags, but the extra bits are unused.
+    AttributeSeamBits &seam_bits = attribute_seam_bits_[attribute];
+    if (seam_bits.num_bits == 0) {
+      attribute_connectivity_decoders_[attribute].DecodeBits(32,
+                                                             &seam_bits.bits);
+      seam_bits.num_bits = 32;
+    }
+    const bool is_seam = seam_bits.bits & 1;
+    seam_bits.bits >>= 1;
+    --seam_bits.num_bits;
+    return is_seam;
   }
 
   // Called when the traversal is finished.
@@ -148,6 +164,10 @@ class MeshEdgebreakerTraversalDecoder {
       return false;
     }
     buffer_.Advance(traversal_size);
+    // The bit decoder of |symbol_buffer_| reads from all remaining data.
+    DecodeSymbolBits(
+        reinterpret_cast<const uint8_t *>(symbol_buffer_.data_head()),
+        symbol_buffer_.remaining_size());
     return true;
   }
 
@@ -176,6 +196,8 @@ class MeshEdgebreakerTraversalDecoder {
     if (num_attribute_data_ > 0) {
       attribute_connectivity_decoders_ = std::unique_ptr<BinaryDecoder[]>(
           new BinaryDecoder[num_attribute_data_]);
+      attribute_seam_bits_ = std::unique_ptr<AttributeSeamBits[]>(
+          new AttributeSeamBits[num_attribute_data_]);
       for (int i = 0; i < num_attribute_data_; ++i) {
         if (!attribute_connectivity_decoders_[i].StartDecoding(&buffer_)) {
           return false;
@@ -186,13 +208,94 @@ class MeshEdgebreakerTraversalDecoder {
   }
 
  private:
+  // Attribute seam flags that were decoded but not consumed yet. The next flag
+  // is stored in the least significant bit of |bits|.
+  struct AttributeSeamBits {
+    AttributeSeamBits() : bits(0), num_bits(0) {}
+    uint32_t bits;
+    int num_bits;
+  };
+
+  // Entry of a lookup table that decodes all complete symbols stored in an
+  // 8-bit window of the symbol bit stream. Symbols are stored with their
+  // least significant bit first so each 3-bit symbol can be read directly.
+  struct SymbolWindow {
+    uint8_t symbols[8];
+    uint8_t num_symbols;
+    uint8_t num_bits;
+  };
+
+  class SymbolWindowTable {
+   public:
+    SymbolWindowTable() {
+      for (int w = 0; w < 256; ++w) {
+        SymbolWindow &entry = windows_[w];
+        memset(&entry, 0, sizeof(entry));
+        int bit = 0;
+        while (bit < 8) {
+          if (((w >> bit) & 1) == 0) {
+            // TOPOLOGY_C is encoded with a single zero bit.
+            entry.symbols[entry.num_symbols++] = TOPOLOGY_C;
+            bit += 1;
+          } else if (bit + 3 <= 8) {
+            entry.symbols[entry.num_symbols++] = (w >> bit) & 7;
+            bit += 3;
+          } else {
+            // The symbol continues in the next window.
+            break;
+          }
+        }
+        entry.num_bits = bit;
+      }
+    }
+    const SymbolWindow &operator[](int window) const {
+      return windows_[window];
+    }
+
+   private:
+    SymbolWindow windows_[256];
+  };
+
+  // Decodes all |num_symbols_| symbols from the bit stream |data| into
+  // |symbols_|. Bits past the end of the data are treated as zeros to match
+  // the behavior of DecoderBuffer::BitDecoder.
+  void DecodeSymbolBits(const uint8_t *data, size_t data_size) {
+    static const SymbolWindowTable table;
+    // Each window writes up to 8 symbols.
+    symbols_.resize(static_cast<size_t>(num_symbols_) + 8);
+    next_symbol_id_ = 0;
+    uint64_t bits = 0;
+    int num_bits = 0;
+    size_t byte_pos = 0;
+    uint32_t num_decoded = 0;
+    while (num_decoded < num_symbols_) {
+      if (num_bits < 8) {
+        // Refill the bit buffer with as many whole bytes as fit.
+        for (; num_bits <= 56; num_bits += 8, ++byte_pos) {
+          const uint64_t byte = byte_pos < data_size ? data[byte_pos] : 0;
+          bits |= byte << num_bits;
+        }
+      }
+      const SymbolWindow &window = table[static_cast<int>(bits & 0xff)];
+      memcpy(&symbols_[num_decoded], window.symbols, sizeof(window.symbols));
+      num_decoded += window.num_symbols;
+      bits >>= window.num_bits;
+      num_bits -= window.num_bits;
+    }
+  }
+
   // Buffer that contains the encoded data.
   DecoderBuffer buffer_;
   DecoderBuffer symbol_buffer_;
   BinaryDecoder start_face_decoder_;
   DecoderBuffer start_face_buffer_;
   std::unique_ptr<BinaryDecoder[]> attribute_connectivity_decoders_;
+  std::unique_ptr<AttributeSeamBits[]> attribute_seam_bits_;
   int num_attribute_data_;
+  // Pre-decoded traversal symbols.
+  std::vector<uint8_t> symbols_;
+  uint32_t num_symbols_;
+  uint32_t next_symbol_id_;
   const MeshEdgebreakerDecoderImplInterface *decoder_impl_;
 };
 
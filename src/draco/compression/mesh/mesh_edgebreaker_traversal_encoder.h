@@ -91,6 +91,12 @@ class MeshEdgebreakerTraversalEncoder {
 
   const EncoderBuffer &buffer() const { return traversal_buffer_; }
 
+  // Returns the approximate number of bytes allocated by the traversal data.
+  size_t memory_usage() const {
+    return symbols_.capacity() * sizeof(EdgebreakerTopologyBitPattern) +
+           traversal_buffer_.size();
+  }
+
  protected:
   void EncodeTraversalSymbols() {
     // Bit encode the collected symbols.
@@ -36,6 +36,8 @@ class MeshEdgebreakerTraversalPredictiveDecoder
   void Init(MeshEdgebreakerDecoderImplInterface *decoder) {
     MeshEdgebreakerTraversalDecoder::Init(decoder);
     corner_table_ = decoder->GetCornerTable();
+    last_symbol_ = -1;
+    predicted_symbol_ = -1;
   }
   void SetNumEncodedVertices(int num_vertices) { num_vertices_ = num_vertices; }
 
@@ -50,7 +52,7 @@ class MeshEdgebreakerTraversalPredictiveDecoder
       return false;
     }
     // Set the valences of all initial vertices to 0.
-    vertex_valences_.resize(num_vertices_, 0);
+    vertex_valences_.assign(num_vertices_, 0);
     if (!prediction_decoder_.StartDecoding(out_buffer)) {
       return false;
     }
@@ -40,10 +40,15 @@ class MeshEdgebreakerTraversalPredictiveEncoder
       return false;
     }
     corner_table_ = encoder->GetCornerTable();
-    // Initialize valences of all vertices.
+    // Initialize valences of all vertices from the valence cache shared by
+    // all users of the corner table.
+    const ValenceCache<CornerTable> &valence_cache =
+        corner_table_->GetValenceCache();
+    valence_cache.CacheValences();
     vertex_valences_.resize(corner_table_->num_vertices());
     for (uint32_t i = 0; i < vertex_valences_.size(); ++i) {
-      vertex_valences_[i] = corner_table_->Valence(VertexIndex(i));
+      vertex_valences_[i] =
+          valence_cache.ConfidentValenceFromCache(VertexIndex(i));
     }
     return true;
   }
@@ -154,6 +159,12 @@ class MeshEdgebreakerTraversalPredictiveEncoder
 
   int NumEncodedSymbols() const { return num_symbols_; }
 
+  size_t memory_usage() const {
+    return MeshEdgebreakerTraversalEncoder::memory_usage() +
+           vertex_valences_.capacity() * sizeof(int) +
+           predictions_.capacity() / 8;
+  }
+
  private:
   const CornerTable *corner_table_;
   std::vector<int> vertex_valences_;
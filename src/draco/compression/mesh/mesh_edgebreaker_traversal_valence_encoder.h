@@ -15,6 +15,8 @@
 #ifndef DRACO_COMPRESSION_MESH_MESH_EDGEBREAKER_TRAVERSAL_VALENCE_ENCODER_H_
 #define DRACO_COMPRESSION_MESH_MESH_EDGEBREAKER_TRAVERSAL_VALENCE_ENCODER_H_
 
+#include <unordered_map>
+
 #include "draco/compression/entropy/symbol_encoding.h"
 #include "draco/compression/mesh/mesh_edgebreaker_traversal_encoder.h"
 #include "draco/core/varint_encoding.h"
@@ -36,6 +38,7 @@ class MeshEdgebreakerTraversalValenceEncoder
  public:
   MeshEdgebreakerTraversalValenceEncoder()
       : corner_table_(nullptr),
+        low_memory_(false),
         prev_symbol_(-1),
         last_corner_(kInvalidCornerIndex),
         num_symbols_(0),
@@ -49,20 +52,39 @@ class MeshEdgebreakerTraversalValenceEncoder
     min_valence_ = 2;
     max_valence_ = 7;
     corner_table_ = encoder->GetCornerTable();
+    low_memory_ = encoder->GetEncoder()->plan()->low_memory_encoding();
 
-    // Initialize valences of all vertices.
     vertex_valences_.resize(corner_table_->num_vertices());
-    for (VertexIndex i(0); i < static_cast<uint32_t>(vertex_valences_.size());
-         ++i) {
-      vertex_valences_[i] = corner_table_->Valence(VertexIndex(i));
+    if (low_memory_) {
+      // Compute the valences directly so that the valence cache of the corner
+      // table does not need to be allocated.
+      for (VertexIndex i(0);
+           i < static_cast<uint32_t>(vertex_valences_.size()); ++i) {
+        vertex_valences_[i] = corner_table_->Valence(i);
+      }
+    } else {
+      // Initialize valences of all vertices from the valence cache shared by
+      // all users of the corner table.
+      const ValenceCache<CornerTable> &valence_cache =
+          corner_table_->GetValenceCache();
+      valence_cache.CacheValences();
+      for (VertexIndex i(0);
+           i < static_cast<uint32_t>(vertex_valences_.size()); ++i) {
+        vertex_valences_[i] = valence_cache.ConfidentValenceFromCache(i);
+      }
     }
 
     // Replicate the corner to vertex map from the corner table. We need to do
     // this because the map may get updated during encoding because we add new
-    // vertices when we encounter split symbols.
-    corner_to_vertex_map_.resize(corner_table_->num_corners());
-    for (CornerIndex i(0); i < corner_table_->num_corners(); ++i) {
-      corner_to_vertex_map_[i] = corner_table_->Vertex(i);
+    // vertices when we encounter split symbols. In the low memory mode, only
+    // the updated corners are stored in |split_corner_to_vertex_map_|.
+    corner_to_vertex_map_.clear();
+    split_corner_to_vertex_map_.clear();
+    if (!low_memory_) {
+      corner_to_vertex_map_.resize(corner_table_->num_corners());
+      for (CornerIndex i(0); i < corner_table_->num_corners(); ++i) {
+        corner_to_vertex_map_[i] = corner_table_->Vertex(i);
+      }
     }
     const int32_t num_unique_valences = max_valence_ - min_valence_ + 1;
 
@@ -86,15 +108,15 @@ class MeshEdgebreakerTraversalValenceEncoder
     // Get valence on the tip corner of the active edge (outgoing edge that is
     // going to be used in reverse decoding of the connectivity to predict the
     // next symbol).
-    const int active_valence = vertex_valences_[corner_to_vertex_map_[next]];
+    const int active_valence = vertex_valences_[CornerToVertex(next)];
     switch (symbol) {
       case TOPOLOGY_C:
         // Compute prediction.
         FALLTHROUGH_INTENDED;
       case TOPOLOGY_S:
         // Update valences.
-        vertex_valences_[corner_to_vertex_map_[next]] -= 1;
-        vertex_valences_[corner_to_vertex_map_[prev]] -= 1;
+        vertex_valences_[CornerToVertex(next)] -= 1;
+        vertex_valences_[CornerToVertex(prev)] -= 1;
         if (symbol == TOPOLOGY_S) {
           // Whenever we reach a split symbol, we need to split the vertex into
           // two and attach all corners on the left and right sides of the split
@@ -124,7 +146,7 @@ class MeshEdgebreakerTraversalValenceEncoder
             ++num_left_faces;
             act_c = corner_table_->Opposite(corner_table_->Next(act_c));
           }
-          vertex_valences_[corner_to_vertex_map_[last_corner_]] =
+          vertex_valences_[CornerToVertex(last_corner_)] =
               num_left_faces + 1;
 
           // Create a new vertex for the right side and count the number of
@@ -139,7 +161,12 @@ class MeshEdgebreakerTraversalValenceEncoder
             }
             ++num_right_faces;
             // Map corners on the right side to the newly created vertex.
-            corner_to_vertex_map_[corner_table_->Next(act_c)] = new_vert_id;
+            const CornerIndex right_c = corner_table_->Next(act_c);
+            if (low_memory_) {
+              split_corner_to_vertex_map_[right_c] = VertexIndex(new_vert_id);
+            } else {
+              corner_to_vertex_map_[right_c] = new_vert_id;
+            }
             act_c = corner_table_->Opposite(corner_table_->Previous(act_c));
           }
           vertex_valences_.push_back(num_right_faces + 1);
@@ -147,20 +174,20 @@ class MeshEdgebreakerTraversalValenceEncoder
         break;
       case TOPOLOGY_R:
         // Update valences.
-        vertex_valences_[corner_to_vertex_map_[last_corner_]] -= 1;
-        vertex_valences_[corner_to_vertex_map_[next]] -= 1;
-        vertex_valences_[corner_to_vertex_map_[prev]] -= 2;
+        vertex_valences_[CornerToVertex(last_corner_)] -= 1;
+        vertex_valences_[CornerToVertex(next)] -= 1;
+        vertex_valences_[CornerToVertex(prev)] -= 2;
         break;
       case TOPOLOGY_L:
 
-        vertex_valences_[corner_to_vertex_map_[last_corner_]] -= 1;
-        vertex_valences_[corner_to_vertex_map_[next]] -= 2;
-        vertex_valences_[corner_to_vertex_map_[prev]] -= 1;
+        vertex_valences_[CornerToVertex(last_corner_)] -= 1;
+        vertex_valences_[CornerToVertex(next)] -= 2;
+        vertex_valences_[CornerToVertex(prev)] -= 1;
         break;
       case TOPOLOGY_E:
-        vertex_valences_[corner_to_vertex_map_[last_corner_]] -= 2;
-        vertex_valences_[corner_to_vertex_map_[next]] -= 2;
-        vertex_valences_[corner_to_vertex_map_[prev]] -= 2;
+        vertex_valences_[CornerToVertex(last_corner_)] -= 2;
+        vertex_valences_[CornerToVertex(next)] -= 2;
+        vertex_valences_[CornerToVertex(prev)] -= 2;
         break;
       default:
         break;
@@ -203,12 +230,42 @@ class MeshEdgebreakerTraversalValenceEncoder
 
   int NumEncodedSymbols() const { return num_symbols_; }
 
+  size_t memory_usage() const {
+    size_t num_bytes = MeshEdgebreakerTraversalEncoder::memory_usage() +
+                       corner_to_vertex_map_.capacity() * sizeof(VertexIndex) +
+                       vertex_valences_.capacity() * sizeof(int);
+    // Approximate size of a node of the hash map.
+    num_bytes += split_corner_to_vertex_map_.size() *
+                 (sizeof(CornerIndex) + sizeof(VertexIndex) + sizeof(void *));
+    for (const auto &symbols : context_symbols_) {
+      num_bytes += symbols.capacity() * sizeof(uint32_t);
+    }
+    return num_bytes;
+  }
+
  private:
+  VertexIndex CornerToVertex(CornerIndex corner) const {
+    if (!low_memory_) {
+      return corner_to_vertex_map_[corner];
+    }
+    if (!split_corner_to_vertex_map_.empty()) {
+      const auto it = split_corner_to_vertex_map_.find(corner);
+      if (it != split_corner_to_vertex_map_.end()) {
+        return it->second;
+      }
+    }
+    return corner_table_->Vertex(corner);
+  }
+
   const CornerTable *corner_table_;
   // Explicit map between corners and vertices. We cannot use the one stored
   // in the |corner_table_| because we may need to add additional vertices to
   // handle split symbols.
   IndexTypeVector<CornerIndex, VertexIndex> corner_to_vertex_map_;
+  // Corners mapped to new vertices by split symbols in the low memory mode.
+  // All other corners are mapped by |corner_table_|.
+  std::unordered_map<CornerIndex, VertexIndex> split_corner_to_vertex_map_;
+  bool low_memory_;
   IndexTypeVector<VertexIndex, int> vertex_valences_;
   // Previously encoded symbol.
   int32_t prev_symbol_;
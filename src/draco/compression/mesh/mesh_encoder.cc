@@ -16,7 +16,8 @@
 
 namespace draco {
 
-MeshEncoder::MeshEncoder() : mesh_(nullptr), num_encoded_faces_(0) {}
+MeshEncoder::MeshEncoder()
+    : mesh_(nullptr), analysis_(nullptr), num_encoded_faces_(0) {}
 
 void MeshEncoder::SetMesh(const Mesh &m) {
   mesh_ = &m;
@@ -25,7 +26,7 @@ void MeshEncoder::SetMesh(const Mesh &m) {
 
 Status MeshEncoder::EncodeGeometryData() {
   DRACO_RETURN_IF_ERROR(EncodeConnectivity());
-  if (options()->GetGlobalBool("store_number_of_encoded_faces", false)) {
+  if (plan()->store_number_of_encoded_faces()) {
     ComputeNumberOfEncodedFaces();
   }
   return OkStatus();
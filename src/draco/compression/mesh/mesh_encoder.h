@@ -17,6 +17,7 @@
 
 #include "draco/compression/attributes/mesh_attribute_indices_encoding_data.h"
 #include "draco/compression/point_cloud/point_cloud_encoder.h"
+#include "draco/compression/encode_analysis.h"
 #include "draco/mesh/mesh.h"
 #include "draco/mesh/mesh_attribute_corner_table.h"
 
@@ -32,6 +33,13 @@ class MeshEncoder : public PointCloudEncoder {
   // method.
   void SetMesh(const Mesh &m);
 
+  // Sets an optional analysis of the encoded mesh whose connectivity data is
+  // used instead of being computed by the encoder. The analysis must have been
+  // created for the mesh set by SetMesh() and it is not owned by the encoder.
+  void SetEncodeAnalysis(const EncodeAnalysis *analysis) {
+    analysis_ = analysis;
+  }
+
   EncodedGeometryType GetGeometryType() const override {
     return TRIANGULAR_MESH;
   }
@@ -60,6 +68,9 @@ class MeshEncoder : public PointCloudEncoder {
 
   const Mesh *mesh() const { return mesh_; }
 
+  // Returns the analysis set by SetEncodeAnalysis() or nullptr.
+  const EncodeAnalysis *analysis() const { return analysis_; }
+
  protected:
   Status EncodeGeometryData() override;
 
@@ -76,6 +87,7 @@ class MeshEncoder : public PointCloudEncoder {
 
  private:
   const Mesh *mesh_;
+  const EncodeAnalysis *analysis_;
   size_t num_encoded_faces_;
 };
 
@@ -15,17 +15,44 @@
 #include "draco/compression/mesh/mesh_sequential_decoder.h"
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 
 #include "draco/compression/attributes/linear_sequencer.h"
 #include "draco/compression/attributes/sequential_attribute_decoders_controller.h"
 #include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/compression/mesh/mesh_sequential_shared.h"
+#include "draco/core/bit_utils.h"
 #include "draco/core/varint_decoding.h"
 
 namespace draco {
 
 MeshSequentialDecoder::MeshSequentialDecoder() {}
 
+template <typename IndexTypeT>
+bool MeshSequentialDecoder::DecodeFixedSizeIndices(uint32_t num_faces) {
+  // The size of all indices is validated once so that the faces can be read
+  // without checking each index.
+  const int64_t num_bytes =
+      static_cast<int64_t>(num_faces) * 3 * sizeof(IndexTypeT);
+  if (num_bytes > buffer()->remaining_size()) {
+    return false;
+  }
+  const char *const src = buffer()->data_head();
+  mesh()->SetNumFacesUninitialized(num_faces);
+  for (uint32_t i = 0; i < num_faces; ++i) {
+    IndexTypeT indices[3];
+    memcpy(indices, src + i * sizeof(indices), sizeof(indices));
+    Mesh::Face face;
+    face[0] = indices[0];
+    face[1] = indices[1];
+    face[2] = indices[2];
+    mesh()->SetFace(FaceIndex(i), face);
+  }
+  buffer()->Advance(num_bytes);
+  return true;
+}
+
 bool MeshSequentialDecoder::DecodeConnectivity() {
   uint32_t num_faces;
   uint32_t num_points;
@@ -55,45 +82,51 @@ bool MeshSequentialDecoder::DecodeConnectivity() {
   if (faces_64 > 0xffffffff / 3) {
     return false;
   }
-  if (faces_64 > buffer()->remaining_size() / 3) {
+  uint8_t connectivity_method;
+  if (!buffer()->Decode(&connectivity_method)) {
+    return false;
+  }
+  // Vertex cache coding uses at least one byte per face. The other methods use
+  // at least three bytes per face, including the connectivity method byte.
+  const uint64_t min_bytes_per_face =
+      connectivity_method == SEQUENTIAL_VERTEX_CACHE_INDICES ? 1 : 3;
+  if (faces_64 > (buffer()->remaining_size() + 1) / min_bytes_per_face) {
     // The number of faces is unreasonably high, because face indices do not
     // fit in the remaining size of the buffer.
     return false;
   }
-  uint8_t connectivity_method;
-  if (!buffer()->Decode(&connectivity_method)) {
+  // Reserve memory for the faces and for the entropy decoded indices. Each
+  // face index is decoded once.
+  if (!ReserveMemory(
+          2 * static_cast<uint64_t>(num_faces) * sizeof(Mesh::Face)) ||
+      !ConsumeWork(3 * static_cast<uint64_t>(num_faces))) {
     return false;
   }
-  if (connectivity_method == 0) {
+  if (options()->GetGlobalBool(GetDecoderOptionKeys().decode_layout_only,
+                               false)) {
+    // Only the number of faces is needed.
+    if (!SkipIndices(num_faces, num_points, connectivity_method)) {
+      return false;
+    }
+    mesh()->SetNumFaces(num_faces);
+  } else if (connectivity_method == SEQUENTIAL_COMPRESSED_INDICES) {
     if (!DecodeAndDecompressIndices(num_faces)) {
       return false;
     }
+  } else if (connectivity_method == SEQUENTIAL_VERTEX_CACHE_INDICES) {
+    if (!DecodeVertexCacheIndices(num_faces, num_points)) {
+      return false;
+    }
   } else {
     if (num_points < 256) {
       // Decode indices as uint8_t.
-      for (uint32_t i = 0; i < num_faces; ++i) {
-        Mesh::Face face;
-        for (int j = 0; j < 3; ++j) {
-          uint8_t val;
-          if (!buffer()->Decode(&val)) {
-            return false;
-          }
-          face[j] = val;
-        }
-        mesh()->AddFace(face);
+      if (!DecodeFixedSizeIndices<uint8_t>(num_faces)) {
+        return false;
       }
     } else if (num_points < (1 << 16)) {
       // Decode indices as uint16_t.
-      for (uint32_t i = 0; i < num_faces; ++i) {
-        Mesh::Face face;
-        for (int j = 0; j < 3; ++j) {
-          uint16_t val;
-          if (!buffer()->Decode(&val)) {
-            return false;
-          }
-          face[j] = val;
-        }
-        mesh()->AddFace(face);
+      if (!DecodeFixedSizeIndices<uint16_t>(num_faces)) {
+        return false;
       }
     } else if (num_points < (1 << 21) &&
                bitstream_version() >= DRACO_BITSTREAM_VERSION(2, 2)) {
@@ -111,16 +144,8 @@ bool MeshSequentialDecoder::DecodeConnectivity() {
       }
     } else {
       // Decode faces as uint32_t (default).
-      for (uint32_t i = 0; i < num_faces; ++i) {
-        Mesh::Face face;
-        for (int j = 0; j < 3; ++j) {
-          uint32_t val;
-          if (!buffer()->Decode(&val)) {
-            return false;
-          }
-          face[j] = val;
-        }
-        mesh()->AddFace(face);
+      if (!DecodeFixedSizeIndices<uint32_t>(num_faces)) {
+        return false;
       }
     }
   }
@@ -138,6 +163,47 @@ bool MeshSequentialDecoder::CreateAttributesDecoder(int32_t att_decoder_id) {
                   new LinearSequencer(point_cloud()->num_points())))));
 }
 
+bool MeshSequentialDecoder::SkipIndices(uint32_t num_faces, uint32_t num_points,
+                                        uint8_t connectivity_method) {
+  if (connectivity_method == SEQUENTIAL_COMPRESSED_INDICES) {
+    return SkipSymbols(num_faces * 3, 1, buffer());
+  }
+  if (connectivity_method == SEQUENTIAL_VERTEX_CACHE_INDICES) {
+    uint32_t num_extra_codes;
+    uint32_t num_explicit_bytes;
+    if (!DecodeVertexCacheStreamSizes(num_faces, &num_extra_codes,
+                                      &num_explicit_bytes)) {
+      return false;
+    }
+    buffer()->Advance(static_cast<int64_t>(num_faces) + num_extra_codes +
+                      num_explicit_bytes);
+    return true;
+  }
+  // Raw indices are stored with the same size as in DecodeConnectivity().
+  int index_size = 4;
+  if (num_points < 256) {
+    index_size = 1;
+  } else if (num_points < (1 << 16)) {
+    index_size = 2;
+  } else if (num_points < (1 << 21) &&
+             bitstream_version() >= DRACO_BITSTREAM_VERSION(2, 2)) {
+    // Varint encoded indices.
+    for (uint32_t i = 0; i < num_faces * 3; ++i) {
+      uint32_t val;
+      if (!DecodeVarint(&val, buffer())) {
+        return false;
+      }
+    }
+    return true;
+  }
+  const uint64_t num_bytes = static_cast<uint64_t>(num_faces) * 3 * index_size;
+  if (num_bytes > static_cast<uint64_t>(buffer()->remaining_size())) {
+    return false;
+  }
+  buffer()->Advance(num_bytes);
+  return true;
+}
+
 bool MeshSequentialDecoder::DecodeAndDecompressIndices(uint32_t num_faces) {
   // Get decoded indices differences that were encoded with an entropy code.
   std::vector<uint32_t> indices_buffer(num_faces * 3);
@@ -175,4 +241,116 @@ bool MeshSequentialDecoder::DecodeAndDecompressIndices(uint32_t num_faces) {
   return true;
 }
 
+bool MeshSequentialDecoder::DecodeVertexCacheStreamSizes(
+    uint32_t num_faces, uint32_t *num_extra_codes,
+    uint32_t *num_explicit_bytes) {
+  if (!DecodeVarint(num_extra_codes, buffer()) ||
+      !DecodeVarint(num_explicit_bytes, buffer())) {
+    return false;
+  }
+  if (*num_extra_codes > num_faces) {
+    return false;
+  }
+  const int64_t num_bytes = static_cast<int64_t>(num_faces) +
+                            *num_extra_codes + *num_explicit_bytes;
+  return num_bytes <= buffer()->remaining_size();
+}
+
+bool MeshSequentialDecoder::DecodeVertexCacheIndices(uint32_t num_faces,
+                                                     uint32_t num_points) {
+  // See EncodeVertexCacheIndices() for more details.
+  if (num_faces > 0 && num_points == 0) {
+    return false;
+  }
+  uint32_t num_extra_codes;
+  uint32_t num_explicit_bytes;
+  if (!DecodeVertexCacheStreamSizes(num_faces, &num_extra_codes,
+                                    &num_explicit_bytes)) {
+    return false;
+  }
+  const uint8_t *const codes =
+      reinterpret_cast<const uint8_t *>(buffer()->data_head());
+  const uint8_t *const extra_codes = codes + num_faces;
+  DecoderBuffer explicit_indices;
+  explicit_indices.Init(
+      reinterpret_cast<const char *>(extra_codes + num_extra_codes),
+      num_explicit_bytes);
+  buffer()->Advance(static_cast<int64_t>(num_faces) + num_extra_codes +
+                    num_explicit_bytes);
+
+  VertexCacheIndexCodingState state;
+  uint32_t next_vertex = 0;
+  int64_t last_explicit_vertex = 0;
+
+  // Decodes |code| into |vertex| and updates the vertex cache.
+  const auto decode_vertex = [&](uint8_t code, uint32_t *vertex) -> bool {
+    if (code == kVertexCacheNextVertex) {
+      *vertex = next_vertex++;
+      state.PushVertex(*vertex);
+    } else if (code == kVertexCacheExplicitVertex) {
+      uint32_t symbol;
+      if (!DecodeVarint(&symbol, &explicit_indices)) {
+        return false;
+      }
+      const int64_t value =
+          last_explicit_vertex + ConvertSymbolToSignedInt(symbol);
+      if (value < 0 || value >= num_points) {
+        return false;
+      }
+      *vertex = static_cast<uint32_t>(value);
+      last_explicit_vertex = value;
+      state.PushVertex(*vertex);
+    } else {
+      *vertex = state.GetVertex(code - 1);
+    }
+    return *vertex < num_points;
+  };
+
+  mesh()->SetNumFacesUninitialized(num_faces);
+  uint32_t extra_code_index = 0;
+  for (uint32_t i = 0; i < num_faces; ++i) {
+    const uint8_t code = codes[i];
+    const int edge_code = code >> 4;
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+    if (edge_code == kVertexCacheNewFace) {
+      if (!decode_vertex(kVertexCacheNextVertex, &a) ||
+          !decode_vertex(kVertexCacheNextVertex, &b) ||
+          !decode_vertex(kVertexCacheNextVertex, &c)) {
+        return false;
+      }
+      state.PushEdge(b, a);
+      state.PushEdge(c, b);
+      state.PushEdge(a, c);
+    } else if (edge_code != kVertexCacheNoEdge) {
+      state.GetEdge(edge_code, &a, &b);
+      if (!decode_vertex(code & 15, &c)) {
+        return false;
+      }
+      state.PushEdge(c, b);
+      state.PushEdge(a, c);
+    } else {
+      if (extra_code_index == num_extra_codes) {
+        return false;
+      }
+      const uint8_t extra_code = extra_codes[extra_code_index++];
+      if (!decode_vertex(code & 15, &a) ||
+          !decode_vertex(extra_code >> 4, &b) ||
+          !decode_vertex(extra_code & 15, &c)) {
+        return false;
+      }
+      state.PushEdge(b, a);
+      state.PushEdge(c, b);
+      state.PushEdge(a, c);
+    }
+    Mesh::Face face;
+    face[0] = a;
+    face[1] = b;
+    face[2] = c;
+    mesh()->SetFace(FaceIndex(i), face);
+  }
+  return true;
+}
+
 }  // namespace draco
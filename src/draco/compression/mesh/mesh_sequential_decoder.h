@@ -29,9 +29,29 @@ class MeshSequentialDecoder : public MeshDecoder {
   bool CreateAttributesDecoder(int32_t att_decoder_id) override;
 
  private:
+  // Decodes face indices that were stored directly as |IndexTypeT| values.
+  // Returns false on error.
+  template <typename IndexTypeT>
+  bool DecodeFixedSizeIndices(uint32_t num_faces);
+
   // Decodes face indices that were compressed with an entropy code.
   // Returns false on error.
   bool DecodeAndDecompressIndices(uint32_t num_faces);
+
+  // Decodes face indices that were encoded with the vertex cache coding.
+  // Returns false on error.
+  bool DecodeVertexCacheIndices(uint32_t num_faces, uint32_t num_points);
+
+  // Decodes the sizes of the vertex cache code streams. Returns false when the
+  // streams do not fit in the remaining size of the buffer.
+  bool DecodeVertexCacheStreamSizes(uint32_t num_faces,
+                                    uint32_t *num_extra_codes,
+                                    uint32_t *num_explicit_bytes);
+
+  // Advances the buffer past the encoded indices of |num_faces| faces without
+  // decoding them.
+  bool SkipIndices(uint32_t num_faces, uint32_t num_points,
+                   uint8_t connectivity_method);
 };
 
 }  // namespace draco
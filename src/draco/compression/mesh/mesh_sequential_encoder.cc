@@ -19,6 +19,8 @@
 #include "draco/compression/attributes/linear_sequencer.h"
 #include "draco/compression/attributes/sequential_attribute_encoders_controller.h"
 #include "draco/compression/entropy/symbol_encoding.h"
+#include "draco/compression/mesh/mesh_sequential_shared.h"
+#include "draco/core/bit_utils.h"
 #include "draco/core/varint_encoding.h"
 
 namespace draco {
@@ -32,15 +34,22 @@ Status MeshSequentialEncoder::EncodeConnectivity() {
   EncodeVarint(static_cast<uint32_t>(mesh()->num_points()), buffer());
 
   // We encode all attributes in the original (possibly duplicated) format.
-  if (options()->GetGlobalBool("compress_connectivity", false)) {
+  if (plan()->vertex_cache_connectivity()) {
+    // 2 = Encode indices using vertex and edge caches.
+    buffer()->Encode(
+        static_cast<uint8_t>(SEQUENTIAL_VERTEX_CACHE_INDICES));
+    if (!EncodeVertexCacheIndices(*mesh(), buffer())) {
+      return Status(Status::DRACO_ERROR, "Failed to encode connectivity.");
+    }
+  } else if (plan()->compress_connectivity()) {
     // 0 = Encode compressed indices.
-    buffer()->Encode(static_cast<uint8_t>(0));
+    buffer()->Encode(static_cast<uint8_t>(SEQUENTIAL_COMPRESSED_INDICES));
     if (!CompressAndEncodeIndices()) {
       return Status(Status::DRACO_ERROR, "Failed to compress connectivity.");
     }
   } else {
     // 1 = Encode indices directly.
-    buffer()->Encode(static_cast<uint8_t>(1));
+    buffer()->Encode(static_cast<uint8_t>(SEQUENTIAL_UNCOMPRESSED_INDICES));
     // Store vertex indices using a smallest data type that fits their range.
     if (mesh()->num_points() < 256) {
       // Serialize indices as uint8_t.
@@ -117,6 +126,85 @@ bool MeshSequentialEncoder::CompressAndEncodeIndices() {
   return true;
 }
 
+bool EncodeVertexCacheIndices(const Mesh &mesh, EncoderBuffer *out_buffer) {
+  // See SEQUENTIAL_VERTEX_CACHE_INDICES for the description of the codes.
+  const uint32_t num_faces = mesh.num_faces();
+  std::vector<uint8_t> codes(num_faces);
+  std::vector<uint8_t> extra_codes;
+  EncoderBuffer explicit_indices;
+  VertexCacheIndexCodingState state;
+  uint32_t next_vertex = 0;
+  int32_t last_explicit_vertex = 0;
+
+  // Returns the vertex code of |vertex| and updates the vertex cache.
+  const auto encode_vertex = [&](uint32_t vertex) -> uint8_t {
+    if (vertex == next_vertex) {
+      ++next_vertex;
+      state.PushVertex(vertex);
+      return kVertexCacheNextVertex;
+    }
+    const int age = state.FindVertex(vertex);
+    if (age >= 0) {
+      return static_cast<uint8_t>(age + 1);
+    }
+    const int32_t diff = static_cast<int32_t>(vertex) - last_explicit_vertex;
+    EncodeVarint(ConvertSignedIntToSymbol(diff), &explicit_indices);
+    last_explicit_vertex = static_cast<int32_t>(vertex);
+    state.PushVertex(vertex);
+    return kVertexCacheExplicitVertex;
+  };
+
+  for (FaceIndex fi(0); fi < num_faces; ++fi) {
+    const Mesh::Face &face = mesh.face(fi);
+    const uint32_t a = face[0].value();
+    const uint32_t b = face[1].value();
+    const uint32_t c = face[2].value();
+
+    // Look for an edge shared with a previously encoded face. The face corners
+    // are rotated so that the shared edge comes first.
+    const uint32_t rotations[3][3] = {{a, b, c}, {b, c, a}, {c, a, b}};
+    int edge_age = -1;
+    int r = 0;
+    for (; r < 3; ++r) {
+      edge_age = state.FindEdge(rotations[r][0], rotations[r][1]);
+      if (edge_age >= 0) {
+        break;
+      }
+    }
+    if (edge_age >= 0) {
+      const uint32_t *const v = rotations[r];
+      codes[fi.value()] =
+          static_cast<uint8_t>((edge_age << 4) | encode_vertex(v[2]));
+      state.PushEdge(v[2], v[1]);
+      state.PushEdge(v[0], v[2]);
+    } else if (a == next_vertex && b == a + 1 && c == a + 2) {
+      next_vertex += 3;
+      state.PushVertex(a);
+      state.PushVertex(b);
+      state.PushVertex(c);
+      codes[fi.value()] = kVertexCacheNewFace << 4;
+      state.PushEdge(b, a);
+      state.PushEdge(c, b);
+      state.PushEdge(a, c);
+    } else {
+      const uint8_t code_a = encode_vertex(a);
+      const uint8_t code_b = encode_vertex(b);
+      const uint8_t code_c = encode_vertex(c);
+      codes[fi.value()] = (kVertexCacheNoEdge << 4) | code_a;
+      extra_codes.push_back((code_b << 4) | code_c);
+      state.PushEdge(b, a);
+      state.PushEdge(c, b);
+      state.PushEdge(a, c);
+    }
+  }
+
+  EncodeVarint(static_cast<uint32_t>(extra_codes.size()), out_buffer);
+  EncodeVarint(static_cast<uint32_t>(explicit_indices.size()), out_buffer);
+  return out_buffer->Encode(codes.data(), codes.size()) &&
+         out_buffer->Encode(extra_codes.data(), extra_codes.size()) &&
+         out_buffer->Encode(explicit_indices.data(), explicit_indices.size());
+}
+
 void MeshSequentialEncoder::ComputeNumberOfEncodedPoints() {
   set_num_encoded_points(mesh()->num_points());
 }
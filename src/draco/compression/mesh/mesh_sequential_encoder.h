@@ -23,6 +23,11 @@
 // 2. When "compress_connectivity" == false:
 //      All point ids are encoded directly using either 8, 16, or 32 bits per
 //      value based on the maximum point id value.
+// A third mode is selected with a global encoder options flag called
+// "vertex_cache_connectivity". Faces are then coded by references into caches
+// of recently used edges and vertices (see mesh_sequential_shared.h). It
+// typically needs about one byte per face and it decodes much faster than the
+// entropy coded indices.
 
 #ifndef DRACO_COMPRESSION_MESH_MESH_SEQUENTIAL_ENCODER_H_
 #define DRACO_COMPRESSION_MESH_MESH_SEQUENTIAL_ENCODER_H_
@@ -51,6 +56,10 @@ class MeshSequentialEncoder : public MeshEncoder {
   bool CompressAndEncodeIndices();
 };
 
+// Encodes faces of |mesh| using the SEQUENTIAL_VERTEX_CACHE_INDICES method into
+// |out_buffer|. Returns false on error.
+bool EncodeVertexCacheIndices(const Mesh &mesh, EncoderBuffer *out_buffer);
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_MESH_MESH_SEQUENTIAL_ENCODER_H_
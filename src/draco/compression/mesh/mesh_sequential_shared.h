@@ -0,0 +1,118 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_MESH_MESH_SEQUENTIAL_SHARED_H_
+#define DRACO_COMPRESSION_MESH_MESH_SEQUENTIAL_SHARED_H_
+
+#include <stdint.h>
+
+namespace draco {
+
+// Shared declarations used by both sequential mesh encoder and decoder.
+
+// Methods used to encode the connectivity of sequentially encoded meshes.
+enum SequentialConnectivityMethod {
+  // Delta coded point ids compressed with an entropy coding.
+  SEQUENTIAL_COMPRESSED_INDICES = 0,
+  // Point ids stored with a fixed or variable number of bytes per index.
+  SEQUENTIAL_UNCOMPRESSED_INDICES = 1,
+  // Point ids coded by references into FIFO caches of recently used edges and
+  // vertices. Each face is stored as one code byte, optionally followed by
+  // one extra code byte and varint coded point ids that were not found in any
+  // cache. The corners of the decoded faces may be rotated but the winding
+  // order and the order of faces are preserved.
+  SEQUENTIAL_VERTEX_CACHE_INDICES = 2,
+};
+
+// Codes and FIFO caches of the SEQUENTIAL_VERTEX_CACHE_INDICES method. The
+// encoder and the decoder update the caches in the same way so that a cache
+// entry can be referenced by its age.
+//
+// Each face is described by a code byte. The upper four bits store the age of
+// a cached edge shared with a previous face, or kVertexCacheNoEdge when no such
+// edge was found. With a cached edge, the lower four bits store the vertex
+// code of the remaining corner. Without a cached edge, the lower four bits
+// store the vertex code of the first corner and the vertex codes of the other
+// two corners are stored in an extra code byte. Faces without a cached edge
+// whose corners are all new consecutive point ids are marked by
+// kVertexCacheNewFace in the upper four bits and need no extra code byte.
+//
+// Vertex codes:
+//   kVertexCacheNextVertex - The first point id that was not referenced yet.
+//   1 .. 14                - Age of the point id in the vertex cache + 1.
+//   kVertexCacheExplicitVertex - The point id is stored as a varint coded
+//                                difference from the last explicit point id.
+constexpr int kVertexCacheSize = 16;
+constexpr uint8_t kVertexCacheNoEdge = 15;
+constexpr uint8_t kVertexCacheNewFace = 14;
+constexpr uint8_t kVertexCacheNextVertex = 0;
+constexpr uint8_t kVertexCacheExplicitVertex = 15;
+constexpr int kVertexCacheMaxVertexAge = 13;
+constexpr int kVertexCacheMaxEdgeAge = 13;
+
+class VertexCacheIndexCodingState {
+ public:
+  VertexCacheIndexCodingState()
+      : vertices_(), edges_(), vertex_offset_(0), edge_offset_(0) {}
+
+  // Returns the age of |vertex| in the vertex cache or -1 when the vertex is
+  // not cached.
+  int FindVertex(uint32_t vertex) const {
+    for (int age = 0; age <= kVertexCacheMaxVertexAge; ++age) {
+      if (GetVertex(age) == vertex) {
+        return age;
+      }
+    }
+    return -1;
+  }
+  uint32_t GetVertex(int age) const {
+    return vertices_[(vertex_offset_ - 1 - age) & (kVertexCacheSize - 1)];
+  }
+  void PushVertex(uint32_t vertex) {
+    vertices_[vertex_offset_] = vertex;
+    vertex_offset_ = (vertex_offset_ + 1) & (kVertexCacheSize - 1);
+  }
+
+  // Returns the age of the directed edge |a| -> |b| in the edge cache or -1
+  // when the edge is not cached.
+  int FindEdge(uint32_t a, uint32_t b) const {
+    for (int age = 0; age <= kVertexCacheMaxEdgeAge; ++age) {
+      const int i = (edge_offset_ - 1 - age) & (kVertexCacheSize - 1);
+      if (edges_[i][0] == a && edges_[i][1] == b) {
+        return age;
+      }
+    }
+    return -1;
+  }
+  void GetEdge(int age, uint32_t *a, uint32_t *b) const {
+    const int i = (edge_offset_ - 1 - age) & (kVertexCacheSize - 1);
+    *a = edges_[i][0];
+    *b = edges_[i][1];
+  }
+  void PushEdge(uint32_t a, uint32_t b) {
+    edges_[edge_offset_][0] = a;
+    edges_[edge_offset_][1] = b;
+    edge_offset_ = (edge_offset_ + 1) & (kVertexCacheSize - 1);
+  }
+
+ private:
+  uint32_t vertices_[kVertexCacheSize];
+  uint32_t edges_[kVertexCacheSize][2];
+  int vertex_offset_;
+  int edge_offset_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_MESH_MESH_SEQUENTIAL_SHARED_H_
@@ -31,9 +31,19 @@ class MeshTraversalSequencer : public PointsSequencer {
  public:
   MeshTraversalSequencer(const Mesh *mesh,
                          const MeshAttributeIndicesEncodingData *encoding_data)
-      : mesh_(mesh), encoding_data_(encoding_data), corner_order_(nullptr) {}
+      : mesh_(mesh),
+        encoding_data_(encoding_data),
+        corner_order_(nullptr),
+        mesh_to_renumber_(nullptr) {}
   void SetTraverser(const TraverserT &t) { traverser_ = t; }
 
+  // Makes UpdatePointToAttributeIndexMapping() renumber the points of |mesh|
+  // to the order of the decoded attribute values, so that the attributes can
+  // use identity mapping instead of an explicit one. Can be used only when the
+  // points of |mesh| are equal to the vertices of the traversed corner table
+  // and all attributes of |mesh| are decoded with this sequencer.
+  void SetMeshToRenumber(Mesh *mesh) { mesh_to_renumber_ = mesh; }
+
   // Function that can be used to set an order in which the mesh corners should
   // be processed. This is an optional flag used usually only by the encoder
   // to match the same corner order that is going to be used by the decoder.
@@ -47,6 +57,13 @@ class MeshTraversalSequencer : public PointsSequencer {
 
   bool UpdatePointToAttributeIndexMapping(PointAttribute *attribute) override {
     const auto *corner_table = traverser_.corner_table();
+    if (mesh_to_renumber_ != nullptr && CanRenumberPoints()) {
+      if (!RenumberPoints()) {
+        return false;
+      }
+      attribute->SetIdentityMapping();
+      return true;
+    }
     attribute->SetExplicitMapping(mesh_->num_points());
     const size_t num_faces = mesh_->num_faces();
     const size_t num_points = mesh_->num_points();
@@ -102,10 +119,57 @@ class MeshTraversalSequencer : public PointsSequencer {
     return traverser_.TraverseFromCorner(corner_id);
   }
 
+  // Returns true when every point was visited by the traversal exactly once,
+  // i.e., the attribute values are a permutation of the points. Vertices past
+  // the last point are isolated vertices that are not used by any face.
+  bool CanRenumberPoints() const {
+    const std::vector<int32_t> &vertex_to_value =
+        encoding_data_->vertex_to_encoded_attribute_value_index_map;
+    const size_t num_points = mesh_->num_points();
+    if (out_point_ids()->size() != num_points ||
+        vertex_to_value.size() < num_points) {
+      return false;
+    }
+    for (size_t v = 0; v < num_points; ++v) {
+      if (vertex_to_value[v] < 0 ||
+          vertex_to_value[v] >= static_cast<int64_t>(num_points)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Replaces the point of each corner by the index of its attribute value.
+  bool RenumberPoints() {
+    const auto *corner_table = traverser_.corner_table();
+    const std::vector<int32_t> &vertex_to_value =
+        encoding_data_->vertex_to_encoded_attribute_value_index_map;
+    const size_t num_faces = mesh_to_renumber_->num_faces();
+    for (FaceIndex f(0); f < static_cast<uint32_t>(num_faces); ++f) {
+      Mesh::Face face;
+      for (int p = 0; p < 3; ++p) {
+        const VertexIndex vert_id =
+            corner_table->Vertex(CornerIndex(3 * f.value() + p));
+        if (vert_id.value() >= mesh_to_renumber_->num_points()) {
+          return false;
+        }
+        face[p] = vertex_to_value[vert_id.value()];
+      }
+      mesh_to_renumber_->SetFace(f, face);
+    }
+    // The i-th decoded value now belongs to the i-th point.
+    std::vector<PointIndex> &point_ids = *out_point_ids();
+    for (uint32_t i = 0; i < point_ids.size(); ++i) {
+      point_ids[i] = i;
+    }
+    return true;
+  }
+
   TraverserT traverser_;
   const Mesh *mesh_;
   const MeshAttributeIndicesEncodingData *encoding_data_;
   const std::vector<CornerIndex> *corner_order_;
+  Mesh *mesh_to_renumber_;
 };
 
 }  // namespace draco
@@ -0,0 +1,383 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/mesh_attributes_reencoder.h"
+
+#include <cstring>
+#include <utility>
+
+#include "draco/compression/attributes/points_sequencer.h"
+#include "draco/compression/attributes/sequential_attribute_decoders_controller.h"
+#include "draco/compression/attributes/sequential_attribute_encoders_controller.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/mesh/mesh_edgebreaker_decoder.h"
+#include "draco/compression/mesh/mesh_encoder.h"
+#include "draco/compression/point_cloud/point_cloud_decoder.h"
+
+namespace draco {
+
+// Edgebreaker decoder that records the offsets of the encoded attribute data
+// in the decoded bitstream.
+class AttributesReencodingDecoder : public MeshEdgebreakerDecoder {
+ public:
+  AttributesReencodingDecoder()
+      : stream_begin_(nullptr), attributes_data_offset_(-1) {}
+
+  Status DecodeMesh(const DecoderOptions &options, DecoderBuffer *in_buffer,
+                    Mesh *out_mesh) {
+    stream_begin_ = in_buffer->data_head();
+    return Decode(options, in_buffer, out_mesh);
+  }
+
+  // Returns the offset of the current decoding position in the bitstream. The
+  // offset is computed from the data pointers, because the Edgebreaker decoder
+  // reinitializes the buffer at the end of the connectivity data.
+  int64_t decoded_offset() { return buffer()->data_head() - stream_begin_; }
+
+  // Returns the offset of the data of the first attributes decoder, i.e., the
+  // end of the encoded attributes decoder identifiers.
+  int64_t attributes_data_offset() const {
+    return attributes_data_offset_ < 0 ? values_offsets_[0]
+                                       : attributes_data_offset_;
+  }
+
+  // Returns the offsets of the encoded values of all attributes decoders,
+  // followed by the size of the bitstream.
+  const std::vector<int64_t> &values_offsets() const { return values_offsets_; }
+
+  // Returns the sequence of points in which the values of the attributes
+  // decoder |dec_id| were decoded.
+  const std::vector<PointIndex> &point_ids(int dec_id) {
+    // Edgebreaker always uses sequential attribute decoders.
+    return static_cast<const SequentialAttributeDecodersController *>(
+               attributes_decoder(dec_id))
+        ->point_ids();
+  }
+
+ protected:
+  bool CreateAttributesDecoder(int32_t att_decoder_id) override {
+    if (!MeshEdgebreakerDecoder::CreateAttributesDecoder(att_decoder_id)) {
+      return false;
+    }
+    attributes_data_offset_ = decoded_offset();
+    return true;
+  }
+
+  bool DecodeAllAttributes() override {
+    values_offsets_.clear();
+    for (int i = 0; i < num_attributes_decoders(); ++i) {
+      values_offsets_.push_back(decoded_offset());
+      if (!mutable_attributes_decoder(i)->DecodeAttributes(buffer())) {
+        return false;
+      }
+    }
+    values_offsets_.push_back(decoded_offset());
+    return true;
+  }
+
+ private:
+  const char *stream_begin_;
+  int64_t attributes_data_offset_;
+  std::vector<int64_t> values_offsets_;
+};
+
+namespace {
+
+// Sequencer that returns the sequence of points of an attributes decoder.
+class DecodedPointsSequencer : public PointsSequencer {
+ public:
+  explicit DecodedPointsSequencer(const std::vector<PointIndex> *point_ids)
+      : point_ids_(point_ids) {}
+
+ protected:
+  bool GenerateSequenceInternal() override {
+    *out_point_ids() = *point_ids_;
+    return true;
+  }
+
+ private:
+  const std::vector<PointIndex> *point_ids_;
+};
+
+// Mesh encoder that uses the connectivity and the attribute traversal order
+// of an AttributesReencodingDecoder. The encoded header, metadata and
+// connectivity are written by the base class into a scratch buffer and they
+// are replaced by the original bytes in |out_buffer|.
+class AttributesReencodingEncoder : public MeshEncoder {
+ public:
+  AttributesReencodingEncoder(AttributesReencodingDecoder *decoder,
+                              const std::vector<char> &data,
+                              const std::vector<bool> &is_decoder_replaced,
+                              EncoderBuffer *out_buffer)
+      : decoder_(decoder),
+        data_(data),
+        is_decoder_replaced_(is_decoder_replaced),
+        out_buffer_(out_buffer) {}
+
+  uint8_t GetEncodingMethod() const override {
+    return MESH_EDGEBREAKER_ENCODING;
+  }
+  const CornerTable *GetCornerTable() const override {
+    return decoder_->GetCornerTable();
+  }
+  const MeshAttributeCornerTable *GetAttributeCornerTable(
+      int att_id) const override {
+    return decoder_->GetAttributeCornerTable(att_id);
+  }
+  const MeshAttributeIndicesEncodingData *GetAttributeEncodingData(
+      int att_id) const override {
+    return decoder_->GetAttributeEncodingData(att_id);
+  }
+
+  // Returns the reason why the encoding of the attributes failed.
+  const Status &attributes_status() const { return attributes_status_; }
+
+ protected:
+  Status EncodeConnectivity() override {
+    // The connectivity is copied from the input bitstream.
+    return OkStatus();
+  }
+
+  bool GenerateAttributesEncoders() override {
+    // Create one attributes encoder for each decoder, in the decoding order.
+    for (int i = 0; i < decoder_->num_attributes_decoders(); ++i) {
+      const AttributesDecoderInterface *const att_dec =
+          decoder_->attributes_decoder(i);
+      std::unique_ptr<SequentialAttributeEncodersController> att_enc(
+          new SequentialAttributeEncodersController(
+              std::unique_ptr<PointsSequencer>(
+                  new DecodedPointsSequencer(&decoder_->point_ids(i))),
+              att_dec->GetAttributeId(0)));
+      for (int j = 1; j < att_dec->GetNumAttributes(); ++j) {
+        att_enc->AddAttributeId(att_dec->GetAttributeId(j));
+      }
+      AddAttributesEncoder(std::move(att_enc));
+    }
+    return PointCloudEncoder::GenerateAttributesEncoders();
+  }
+
+  bool GenerateAttributesEncoder(int32_t /* att_id */) override {
+    return true;
+  }
+
+  bool EncodePointAttributes() override;
+
+  void ComputeNumberOfEncodedPoints() override {
+    set_num_encoded_points(mesh()->num_points());
+  }
+  void ComputeNumberOfEncodedFaces() override {
+    set_num_encoded_faces(mesh()->num_faces());
+  }
+
+ private:
+  AttributesReencodingDecoder *const decoder_;
+  const std::vector<char> &data_;
+  const std::vector<bool> &is_decoder_replaced_;
+  EncoderBuffer *const out_buffer_;
+  Status attributes_status_;
+};
+
+bool AttributesReencodingEncoder::EncodePointAttributes() {
+  if (!GenerateAttributesEncoders()) {
+    return false;
+  }
+  for (int i = 0; i < num_attributes_encoders(); ++i) {
+    if (!attributes_encoder(i)->Init(this, point_cloud())) {
+      return false;
+    }
+  }
+
+  // Parent attributes of prediction schemes are always positions. The
+  // encoded values of all attributes may depend on them, so everything is
+  // encoded again when they are replaced or used by a replaced attribute.
+  std::vector<bool> is_reencoded = is_decoder_replaced_;
+  const int pos_att_id =
+      point_cloud()->GetNamedAttributeId(GeometryAttribute::POSITION);
+  bool reencode_all = false;
+  for (int i = 0; i < num_attributes_encoders(); ++i) {
+    if (!is_reencoded[i]) {
+      continue;
+    }
+    const AttributesEncoder *const att_enc = attributes_encoder(i);
+    for (uint32_t j = 0; j < att_enc->num_attributes(); ++j) {
+      const int att_id = att_enc->GetAttributeId(j);
+      if (att_id == pos_att_id || att_enc->NumParentAttributes(att_id) > 0) {
+        reencode_all = true;
+      }
+    }
+  }
+  if (reencode_all) {
+    is_reencoded.assign(is_reencoded.size(), true);
+  }
+
+  // The selected attribute encoders must match the decoders described in the
+  // input bitstream.
+  const std::vector<int64_t> &values_offsets = decoder_->values_offsets();
+  const int64_t data_offset = decoder_->attributes_data_offset();
+  EncoderBuffer encoders_data;
+  for (int i = 0; i < num_attributes_encoders(); ++i) {
+    if (!attributes_encoder(i)->EncodeAttributesEncoderData(&encoders_data)) {
+      return false;
+    }
+  }
+  if (static_cast<int64_t>(encoders_data.size()) !=
+          values_offsets[0] - data_offset ||
+      memcmp(encoders_data.data(), data_.data() + data_offset,
+             encoders_data.size()) != 0) {
+    attributes_status_ =
+        Status(Status::DRACO_ERROR,
+               "Encoder options do not match the encoded attributes.");
+    return false;
+  }
+
+  // Copy everything up to the encoded values and then either copy or encode
+  // the values of each attributes decoder.
+  if (!out_buffer_->Encode(data_.data(), values_offsets[0])) {
+    return false;
+  }
+  for (int i = 0; i < num_attributes_encoders(); ++i) {
+    if (is_reencoded[i]) {
+      if (!attributes_encoder(i)->EncodeAttributes(out_buffer_)) {
+        return false;
+      }
+    } else if (!out_buffer_->Encode(data_.data() + values_offsets[i],
+                                    values_offsets[i + 1] -
+                                        values_offsets[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+MeshAttributesReencoder::MeshAttributesReencoder() = default;
+
+MeshAttributesReencoder::~MeshAttributesReencoder() = default;
+
+Status MeshAttributesReencoder::Decode(const DecoderOptions &options,
+                                       DecoderBuffer *in_buffer) {
+  decoder_ = nullptr;
+  mesh_ = nullptr;
+  DecoderBuffer temp_buffer(*in_buffer);
+  DracoHeader header;
+  DRACO_RETURN_IF_ERROR(PointCloudDecoder::DecodeHeader(&temp_buffer, &header))
+  if (header.encoder_type != TRIANGULAR_MESH ||
+      header.encoder_method != MESH_EDGEBREAKER_ENCODING) {
+    return Status(Status::DRACO_ERROR,
+                  "Only Edgebreaker encoded meshes are supported.");
+  }
+  if (header.version_major != kDracoMeshBitstreamVersionMajor ||
+      header.version_minor != kDracoMeshBitstreamVersionMinor) {
+    return Status(Status::UNKNOWN_VERSION, "Unsupported bitstream version.");
+  }
+  if (options.GetGlobalBool("decode_connectivity_only", false)) {
+    return Status(Status::DRACO_ERROR, "Attributes must be decoded.");
+  }
+
+  std::unique_ptr<AttributesReencodingDecoder> decoder(
+      new AttributesReencodingDecoder());
+  std::unique_ptr<Mesh> mesh(new Mesh());
+  const char *const stream = in_buffer->data_head();
+  DRACO_RETURN_IF_ERROR(decoder->DecodeMesh(options, in_buffer, mesh.get()))
+
+  // Keep a copy of the decoded bitstream.
+  data_.assign(stream, stream + decoder->decoded_offset());
+  is_decoder_replaced_.assign(decoder->num_attributes_decoders(), false);
+  decoder_ = std::move(decoder);
+  mesh_ = std::move(mesh);
+  return OkStatus();
+}
+
+Status MeshAttributesReencoder::ReplaceAttribute(
+    int att_id, const PointAttribute &attribute) {
+  if (mesh_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "No mesh was decoded.");
+  }
+  if (att_id < 0 || att_id >= mesh_->num_attributes()) {
+    return Status(Status::DRACO_ERROR, "Invalid attribute id.");
+  }
+  PointAttribute *const att = mesh_->attribute(att_id);
+  if (attribute.attribute_type() != att->attribute_type() ||
+      attribute.data_type() != att->data_type() ||
+      attribute.num_components() != att->num_components() ||
+      attribute.normalized() != att->normalized()) {
+    return Status(
+        Status::DRACO_ERROR,
+        "Replacement attribute does not match the decoded attribute.");
+  }
+  const int num_points = mesh_->num_points();
+  if (attribute.indices_map_size() < static_cast<size_t>(num_points)) {
+    return Status(Status::DRACO_ERROR,
+                  "Replacement attribute does not cover all points.");
+  }
+
+  // All points mapped to the same decoded value must have the same new value.
+  const int byte_stride = static_cast<int>(attribute.byte_stride());
+  std::vector<PointIndex> value_points(att->size(), kInvalidPointIndex);
+  for (PointIndex p(0); p < num_points; ++p) {
+    if (attribute.mapped_index(p) >= attribute.size()) {
+      return Status(Status::DRACO_ERROR,
+                    "Replacement attribute does not cover all points.");
+    }
+    const AttributeValueIndex value = att->mapped_index(p);
+    const PointIndex value_point = value_points[value.value()];
+    if (value_point == kInvalidPointIndex) {
+      value_points[value.value()] = p;
+    } else if (memcmp(attribute.GetAddressOfMappedIndex(p),
+                      attribute.GetAddressOfMappedIndex(value_point),
+                      byte_stride) != 0) {
+      return Status(
+          Status::DRACO_ERROR,
+          "Replacement attribute does not match the attribute connectivity.");
+    }
+  }
+
+  int dec_id = -1;
+  for (int i = 0; i < decoder_->num_attributes_decoders() && dec_id < 0; ++i) {
+    const AttributesDecoderInterface *const att_dec =
+        decoder_->attributes_decoder(i);
+    for (int j = 0; j < att_dec->GetNumAttributes(); ++j) {
+      if (att_dec->GetAttributeId(j) == att_id) {
+        dec_id = i;
+        break;
+      }
+    }
+  }
+  if (dec_id < 0) {
+    return Status(Status::DRACO_ERROR, "Attribute is not encoded.");
+  }
+
+  const uint32_t unique_id = att->unique_id();
+  att->CopyFrom(attribute);
+  att->set_unique_id(unique_id);
+  is_decoder_replaced_[dec_id] = true;
+  return OkStatus();
+}
+
+Status MeshAttributesReencoder::Encode(const EncoderOptions &options,
+                                       EncoderBuffer *out_buffer) {
+  if (mesh_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "No mesh was decoded.");
+  }
+  AttributesReencodingEncoder encoder(decoder_.get(), data_,
+                                      is_decoder_replaced_, out_buffer);
+  encoder.SetMesh(*mesh_);
+  EncoderBuffer scratch_buffer;
+  const Status status = encoder.Encode(options, &scratch_buffer);
+  DRACO_RETURN_IF_ERROR(encoder.attributes_status())
+  return status;
+}
+
+}  // namespace draco
@@ -0,0 +1,97 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_MESH_ATTRIBUTES_REENCODER_H_
+#define DRACO_COMPRESSION_MESH_ATTRIBUTES_REENCODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "draco/attributes/point_attribute.h"
+#include "draco/compression/config/decoder_options.h"
+#include "draco/compression/config/encoder_options.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+class AttributesReencodingDecoder;
+
+// Re-encodes attributes of an Edgebreaker encoded mesh without re-encoding its
+// connectivity.
+//
+// Decode() decodes the input bitstream and keeps the connectivity and the
+// attribute traversal order of the Edgebreaker decoder. Attributes replaced by
+// ReplaceAttribute() are then encoded by Encode() in the same order in which
+// the decoder traverses them, so that the header, metadata, connectivity and
+// the data of all unchanged attributes are copied from the input bitstream
+// verbatim. Only the values of the attribute decoders that contain replaced
+// attributes are encoded again.
+//
+// Prediction schemes of texture coordinates and normals may use positions as
+// their parent attribute. Therefore, all attributes are encoded again when the
+// positions are replaced or when a replaced attribute is predicted from them.
+//
+// Only bitstreams of the current mesh bitstream version encoded with the
+// MESH_EDGEBREAKER_ENCODING method are supported.
+//
+// Example:
+//
+//   MeshAttributesReencoder reencoder;
+//   DRACO_RETURN_IF_ERROR(reencoder.Decode(DecoderOptions(), &buffer));
+//   DRACO_RETURN_IF_ERROR(reencoder.ReplaceAttribute(att_id, new_colors));
+//   DRACO_RETURN_IF_ERROR(reencoder.Encode(options, &out_buffer));
+//
+class MeshAttributesReencoder {
+ public:
+  MeshAttributesReencoder();
+  ~MeshAttributesReencoder();
+
+  // Decodes the mesh encoded in |in_buffer|.
+  Status Decode(const DecoderOptions &options, DecoderBuffer *in_buffer);
+
+  // Returns the decoded mesh with all replaced attributes. Valid after a
+  // successful Decode().
+  const Mesh *mesh() const { return mesh_.get(); }
+
+  // Replaces values of the attribute |att_id| of mesh() by values of
+  // |attribute|, which are stored for the points of mesh(). The attribute must
+  // have the same type, data type, number of components and normalization as
+  // the decoded attribute. Points that share an attribute value in the decoded
+  // mesh must also share the same value in |attribute|, because the attribute
+  // connectivity is stored in the reused connectivity data.
+  Status ReplaceAttribute(int att_id, const PointAttribute &attribute);
+
+  // Encodes mesh() into |out_buffer|. |options| must select the same attribute
+  // encoders as the options used to encode the input bitstream (for example
+  // the same quantization bits), otherwise an error is returned. Attribute
+  // options are specified for attribute ids of mesh() as in ExpertEncoder.
+  Status Encode(const EncoderOptions &options, EncoderBuffer *out_buffer);
+
+ private:
+  std::unique_ptr<AttributesReencodingDecoder> decoder_;
+  std::unique_ptr<Mesh> mesh_;
+
+  // Copy of the decoded bitstream.
+  std::vector<char> data_;
+
+  // Whether the attributes of each attribute decoder were replaced.
+  std::vector<bool> is_decoder_replaced_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_MESH_ATTRIBUTES_REENCODER_H_
@@ -0,0 +1,209 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/mesh_attributes_reencoder.h"
+
+#include <array>
+#include <cmath>
+#include <memory>
+
+#include "draco/compression/decode.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace {
+
+class MeshAttributesReencoderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mesh_ = draco::ReadMeshFromTestFile("cube_att.obj");
+    ASSERT_NE(mesh_, nullptr);
+    draco::ExpertEncoder encoder(*mesh_);
+    SetOptions(*mesh_, &encoder);
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(&buffer_));
+  }
+
+  // Sets the options used for the encoding of |mesh|.
+  static void SetOptions(const draco::Mesh &mesh,
+                         draco::ExpertEncoder *encoder) {
+    encoder->SetSpeedOptions(5, 5);
+    encoder->SetAttributeQuantization(
+        mesh.GetNamedAttributeId(draco::GeometryAttribute::POSITION), 11);
+    encoder->SetAttributeQuantization(
+        mesh.GetNamedAttributeId(draco::GeometryAttribute::TEX_COORD), 10);
+    encoder->SetAttributeQuantization(
+        mesh.GetNamedAttributeId(draco::GeometryAttribute::NORMAL), 8);
+  }
+
+  // Decodes |buffer_| with |reencoder|.
+  void Decode(draco::MeshAttributesReencoder *reencoder) {
+    draco::DecoderBuffer buffer;
+    buffer.Init(buffer_.data(), buffer_.size());
+    DRACO_ASSERT_OK(reencoder->Decode(draco::DecoderOptions(), &buffer));
+  }
+
+  // Re-encodes the mesh of |reencoder| and decodes the result.
+  std::unique_ptr<draco::Mesh> ReencodeAndDecode(
+      draco::MeshAttributesReencoder *reencoder,
+      draco::EncoderBuffer *out_buffer) {
+    draco::ExpertEncoder encoder(*reencoder->mesh());
+    SetOptions(*reencoder->mesh(), &encoder);
+    const draco::Status status =
+        reencoder->Encode(encoder.options(), out_buffer);
+    EXPECT_TRUE(status.ok()) << status.error_msg_string();
+    if (!status.ok()) {
+      return nullptr;
+    }
+    draco::DecoderBuffer buffer;
+    buffer.Init(out_buffer->data(), out_buffer->size());
+    draco::Decoder decoder;
+    auto statusor = decoder.DecodeMeshFromBuffer(&buffer);
+    EXPECT_TRUE(statusor.ok()) << statusor.status().error_msg_string();
+    return statusor.ok() ? std::move(statusor).value() : nullptr;
+  }
+
+  // Returns a copy of attribute |att_id| of |mesh| with all values transformed
+  // by |scale| and |offset|.
+  static std::unique_ptr<draco::PointAttribute> TransformAttribute(
+      const draco::Mesh &mesh, int att_id, float scale, float offset) {
+    std::unique_ptr<draco::PointAttribute> att(new draco::PointAttribute());
+    att->CopyFrom(*mesh.attribute(att_id));
+    std::array<float, 3> value;
+    for (draco::AttributeValueIndex i(0); i < att->size(); ++i) {
+      att->GetValue(i, value.data());
+      for (int c = 0; c < att->num_components(); ++c) {
+        value[c] = value[c] * scale + offset;
+      }
+      att->SetAttributeValue(i, value.data());
+    }
+    return att;
+  }
+
+  // Checks that attribute |att_id| of |mesh| has the same values as
+  // |expected| with the given |tolerance|.
+  static void CompareAttribute(const draco::Mesh &mesh, int att_id,
+                               const draco::PointAttribute &expected,
+                               float tolerance) {
+    const draco::PointAttribute *const att = mesh.attribute(att_id);
+    ASSERT_EQ(att->num_components(), expected.num_components());
+    std::array<float, 3> value, expected_value;
+    for (draco::PointIndex p(0); p < mesh.num_points(); ++p) {
+      att->GetMappedValue(p, value.data());
+      expected.GetMappedValue(p, expected_value.data());
+      for (int c = 0; c < att->num_components(); ++c) {
+        ASSERT_LE(std::abs(value[c] - expected_value[c]), tolerance);
+      }
+    }
+  }
+
+  std::unique_ptr<draco::Mesh> mesh_;
+  draco::EncoderBuffer buffer_;
+};
+
+TEST_F(MeshAttributesReencoderTest, TestUnchangedMesh) {
+  // Without replaced attributes, the input bitstream is reproduced exactly.
+  draco::MeshAttributesReencoder reencoder;
+  Decode(&reencoder);
+  draco::EncoderBuffer out_buffer;
+  ASSERT_NE(ReencodeAndDecode(&reencoder, &out_buffer), nullptr);
+  ASSERT_EQ(out_buffer.size(), buffer_.size());
+  ASSERT_EQ(memcmp(out_buffer.data(), buffer_.data(), buffer_.size()), 0);
+}
+
+TEST_F(MeshAttributesReencoderTest, TestReplaceTexCoords) {
+  draco::MeshAttributesReencoder reencoder;
+  Decode(&reencoder);
+  draco::DecoderBuffer buffer;
+  buffer.Init(buffer_.data(), buffer_.size());
+  draco::Decoder decoder;
+  const std::unique_ptr<draco::Mesh> decoded_mesh =
+      decoder.DecodeMeshFromBuffer(&buffer).value();
+  ASSERT_NE(decoded_mesh, nullptr);
+  const int tex_att_id = reencoder.mesh()->GetNamedAttributeId(
+      draco::GeometryAttribute::TEX_COORD);
+  const std::unique_ptr<draco::PointAttribute> tex_att =
+      TransformAttribute(*reencoder.mesh(), tex_att_id, 0.5f, 0.25f);
+  DRACO_ASSERT_OK(reencoder.ReplaceAttribute(tex_att_id, *tex_att));
+
+  draco::EncoderBuffer out_buffer;
+  const std::unique_ptr<draco::Mesh> mesh =
+      ReencodeAndDecode(&reencoder, &out_buffer);
+  ASSERT_NE(mesh, nullptr);
+  ASSERT_EQ(mesh->num_faces(), decoded_mesh->num_faces());
+  for (draco::FaceIndex f(0); f < mesh->num_faces(); ++f) {
+    ASSERT_EQ(mesh->face(f), decoded_mesh->face(f));
+  }
+  // All other attributes are decoded from the copied data.
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    if (i != tex_att_id) {
+      CompareAttribute(*mesh, i, *decoded_mesh->attribute(i), 0.f);
+    }
+  }
+  CompareAttribute(*mesh, tex_att_id, *tex_att, 1e-3f);
+}
+
+TEST_F(MeshAttributesReencoderTest, TestReplacePositions) {
+  // Replaced positions are used as parent attributes by prediction schemes of
+  // other attributes, so all attributes are encoded again.
+  draco::MeshAttributesReencoder reencoder;
+  Decode(&reencoder);
+  const int pos_att_id = reencoder.mesh()->GetNamedAttributeId(
+      draco::GeometryAttribute::POSITION);
+  const std::unique_ptr<draco::PointAttribute> pos_att =
+      TransformAttribute(*reencoder.mesh(), pos_att_id, 2.f, 1.f);
+  DRACO_ASSERT_OK(reencoder.ReplaceAttribute(pos_att_id, *pos_att));
+
+  draco::EncoderBuffer out_buffer;
+  const std::unique_ptr<draco::Mesh> mesh =
+      ReencodeAndDecode(&reencoder, &out_buffer);
+  ASSERT_NE(mesh, nullptr);
+  CompareAttribute(*mesh, pos_att_id, *pos_att, 1e-2f);
+}
+
+TEST_F(MeshAttributesReencoderTest, TestInvalidAttributes) {
+  draco::MeshAttributesReencoder reencoder;
+  Decode(&reencoder);
+  const int pos_att_id = reencoder.mesh()->GetNamedAttributeId(
+      draco::GeometryAttribute::POSITION);
+  const int tex_att_id = reencoder.mesh()->GetNamedAttributeId(
+      draco::GeometryAttribute::TEX_COORD);
+
+  // The attribute format must not change.
+  ASSERT_FALSE(reencoder
+                   .ReplaceAttribute(tex_att_id,
+                                     *reencoder.mesh()->attribute(pos_att_id))
+                   .ok());
+
+  // Points sharing a position value must keep sharing it.
+  std::unique_ptr<draco::PointAttribute> pos_att(new draco::PointAttribute());
+  pos_att->CopyFrom(*reencoder.mesh()->attribute(pos_att_id));
+  pos_att->Reset(reencoder.mesh()->num_points());
+  pos_att->SetIdentityMapping();
+  for (draco::AttributeValueIndex i(0); i < pos_att->size(); ++i) {
+    const std::array<float, 3> value = {static_cast<float>(i.value()), 0.f,
+                                        0.f};
+    pos_att->SetAttributeValue(i, value.data());
+  }
+  ASSERT_FALSE(reencoder.ReplaceAttribute(pos_att_id, *pos_att).ok());
+
+  // Different quantization does not match the stored attribute decoders.
+  draco::MeshAttributesReencoder reencoder_2;
+  Decode(&reencoder_2);
+  draco::ExpertEncoder encoder(*reencoder_2.mesh());
+  draco::EncoderBuffer out_buffer;
+  ASSERT_FALSE(reencoder_2.Encode(encoder.options(), &out_buffer).ok());
+}
+
+}  // namespace
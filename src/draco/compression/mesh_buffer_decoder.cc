@@ -0,0 +1,249 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/mesh_buffer_decoder.h"
+
+#include <cstring>
+#include <limits>
+
+#include "draco/attributes/attribute_octahedron_transform.h"
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/attributes/normal_compression_utils.h"
+#include "draco/core/quantization_utils.h"
+#include "draco/core/thread_pool.h"
+
+namespace draco {
+
+namespace {
+
+// Returns true when values of |att| can be read directly as int32_t.
+bool HasInt32Values(const PointAttribute &att) {
+  return att.data_type() == DT_INT32 || att.data_type() == DT_UINT32;
+}
+
+}  // namespace
+
+MeshBufferDecoder::MeshBufferDecoder() : mesh_(nullptr) {
+  // Attribute transforms are applied when the values are written to the
+  // output buffers.
+  for (int i = 0; i < GeometryAttribute::NAMED_ATTRIBUTES_COUNT; ++i) {
+    decoder_.SetSkipAttributeTransform(static_cast<GeometryAttribute::Type>(i));
+  }
+}
+
+Status MeshBufferDecoder::Decode(DecoderBuffer *in_buffer) {
+  geometry_ = nullptr;
+  mesh_ = nullptr;
+  DRACO_ASSIGN_OR_RETURN(const EncodedGeometryType type,
+                         Decoder::GetEncodedGeometryType(in_buffer));
+  if (type == TRIANGULAR_MESH) {
+    std::unique_ptr<Mesh> mesh(new Mesh());
+    DRACO_RETURN_IF_ERROR(decoder_.DecodeBufferToGeometry(in_buffer,
+                                                          mesh.get()));
+    mesh_ = mesh.get();
+    geometry_ = std::move(mesh);
+    return OkStatus();
+  }
+  std::unique_ptr<PointCloud> pc(new PointCloud());
+  DRACO_RETURN_IF_ERROR(decoder_.DecodeBufferToGeometry(in_buffer, pc.get()));
+  geometry_ = std::move(pc);
+  return OkStatus();
+}
+
+int MeshBufferDecoder::GetOutputNumComponents(int att_id) const {
+  if (geometry_ == nullptr || att_id < 0 ||
+      att_id >= geometry_->num_attributes()) {
+    return 0;
+  }
+  const PointAttribute *const att = geometry_->attribute(att_id);
+  const AttributeTransformData *const transform_data =
+      att->GetAttributeTransformData();
+  if (transform_data != nullptr &&
+      transform_data->transform_type() == ATTRIBUTE_OCTAHEDRON_TRANSFORM) {
+    return 3;
+  }
+  return att->num_components();
+}
+
+Status MeshBufferDecoder::WriteIndices(uint32_t *out_indices) const {
+  return WriteIndicesInternal(out_indices);
+}
+
+Status MeshBufferDecoder::WriteIndices(uint16_t *out_indices) const {
+  if (num_points() > std::numeric_limits<uint16_t>::max() + 1) {
+    return Status(Status::DRACO_ERROR,
+                  "Point indices do not fit into 16-bit integers.");
+  }
+  return WriteIndicesInternal(out_indices);
+}
+
+template <typename IndexT>
+Status MeshBufferDecoder::WriteIndicesInternal(IndexT *out_indices) const {
+  if (geometry_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "No geometry decoded.");
+  }
+  if (mesh_ == nullptr) {
+    return OkStatus();
+  }
+  for (FaceIndex fi(0); fi < mesh_->num_faces(); ++fi) {
+    const Mesh::Face &face = mesh_->face(fi);
+    for (int c = 0; c < 3; ++c) {
+      *out_indices++ = static_cast<IndexT>(face[c].value());
+    }
+  }
+  return OkStatus();
+}
+
+Status MeshBufferDecoder::WriteAttribute(int att_id, DataType out_data_type,
+                                         void *out_data,
+                                         int64_t byte_stride) const {
+  const int num_components = GetOutputNumComponents(att_id);
+  if (num_components == 0) {
+    return Status(Status::DRACO_ERROR, "Invalid attribute id.");
+  }
+  if (out_data == nullptr ||
+      byte_stride < DataTypeLength(out_data_type) * num_components) {
+    return Status(Status::DRACO_ERROR, "Invalid output buffer.");
+  }
+  const PointAttribute &att = *geometry_->attribute(att_id);
+  uint8_t *const out_bytes = static_cast<uint8_t *>(out_data);
+  const AttributeTransformData *const transform_data =
+      att.GetAttributeTransformData();
+  if (transform_data != nullptr) {
+    if (out_data_type != DT_FLOAT32) {
+      return Status(Status::DRACO_ERROR,
+                    "Transformed attributes can be written only as floats.");
+    }
+    switch (transform_data->transform_type()) {
+      case ATTRIBUTE_QUANTIZATION_TRANSFORM:
+        return WriteDequantizedAttribute(att, out_bytes, byte_stride);
+      case ATTRIBUTE_OCTAHEDRON_TRANSFORM:
+        return WriteOctahedralAttribute(att, out_bytes, byte_stride);
+      default:
+        return Status(Status::DRACO_ERROR, "Unsupported attribute transform.");
+    }
+  }
+  switch (out_data_type) {
+    case DT_INT8:
+      return WriteConvertedAttribute<int8_t>(att, out_bytes, byte_stride);
+    case DT_UINT8:
+      return WriteConvertedAttribute<uint8_t>(att, out_bytes, byte_stride);
+    case DT_INT16:
+      return WriteConvertedAttribute<int16_t>(att, out_bytes, byte_stride);
+    case DT_UINT16:
+      return WriteConvertedAttribute<uint16_t>(att, out_bytes, byte_stride);
+    case DT_INT32:
+      return WriteConvertedAttribute<int32_t>(att, out_bytes, byte_stride);
+    case DT_UINT32:
+      return WriteConvertedAttribute<uint32_t>(att, out_bytes, byte_stride);
+    case DT_FLOAT32:
+      return WriteConvertedAttribute<float>(att, out_bytes, byte_stride);
+    default:
+      return Status(Status::DRACO_ERROR, "Unsupported output data type.");
+  }
+}
+
+Status MeshBufferDecoder::WriteInterleavedAttributes(
+    const std::vector<AttributeLayout> &layouts, void *out_data,
+    int64_t vertex_byte_stride) const {
+  if (out_data == nullptr) {
+    return Status(Status::DRACO_ERROR, "Invalid output buffer.");
+  }
+  for (const AttributeLayout &layout : layouts) {
+    const int64_t value_size = DataTypeLength(layout.data_type) *
+                               GetOutputNumComponents(layout.att_id);
+    if (layout.byte_offset < 0 ||
+        layout.byte_offset + value_size > vertex_byte_stride) {
+      return Status(Status::DRACO_ERROR,
+                    "Attribute does not fit into the vertex.");
+    }
+  }
+  uint8_t *const out_bytes = static_cast<uint8_t *>(out_data);
+  std::vector<Status> statuses(layouts.size());
+  ParallelFor(decoder_.options()->thread_pool(),
+              static_cast<int>(layouts.size()), [&](int i) {
+                statuses[i] = WriteAttribute(
+                    layouts[i].att_id, layouts[i].data_type,
+                    out_bytes + layouts[i].byte_offset, vertex_byte_stride);
+              });
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status);
+  }
+  return OkStatus();
+}
+
+Status MeshBufferDecoder::WriteDequantizedAttribute(const PointAttribute &att,
+                                                    uint8_t *out_data,
+                                                    int64_t byte_stride) const {
+  AttributeQuantizationTransform transform;
+  if (!HasInt32Values(att) || !transform.InitFromAttribute(att)) {
+    return Status(Status::DRACO_ERROR, "Invalid quantized attribute.");
+  }
+  const int32_t max_quantized_value =
+      (1u << static_cast<uint32_t>(transform.quantization_bits())) - 1;
+  Dequantizer dequantizer;
+  if (!dequantizer.Init(transform.range(), max_quantized_value)) {
+    return Status(Status::DRACO_ERROR, "Invalid quantization parameters.");
+  }
+  const int num_components = att.num_components();
+  const std::vector<float> &min_values = transform.min_values();
+  std::vector<int32_t> quantized_value(num_components);
+  std::vector<float> value(num_components);
+  for (PointIndex pi(0); pi < geometry_->num_points(); ++pi) {
+    att.GetMappedValue(pi, quantized_value.data());
+    for (int c = 0; c < num_components; ++c) {
+      value[c] = dequantizer(quantized_value[c]) + min_values[c];
+    }
+    memcpy(out_data, value.data(), sizeof(float) * num_components);
+    out_data += byte_stride;
+  }
+  return OkStatus();
+}
+
+Status MeshBufferDecoder::WriteOctahedralAttribute(const PointAttribute &att,
+                                                   uint8_t *out_data,
+                                                   int64_t byte_stride) const {
+  AttributeOctahedronTransform transform;
+  if (!HasInt32Values(att) || att.num_components() != 2 ||
+      !transform.InitFromAttribute(att)) {
+    return Status(Status::DRACO_ERROR, "Invalid octahedral attribute.");
+  }
+  OctahedronToolBox octahedron_tool_box;
+  if (!octahedron_tool_box.SetQuantizationBits(transform.quantization_bits())) {
+    return Status(Status::DRACO_ERROR, "Invalid quantization parameters.");
+  }
+  int32_t coords[2];
+  float value[3];
+  for (PointIndex pi(0); pi < geometry_->num_points(); ++pi) {
+    att.GetMappedValue(pi, coords);
+    octahedron_tool_box.QuantizedOctahedralCoordsToUnitVector(coords[0],
+                                                             coords[1], value);
+    memcpy(out_data, value, sizeof(value));
+    out_data += byte_stride;
+  }
+  return OkStatus();
+}
+
+template <typename T>
+Status MeshBufferDecoder::WriteConvertedAttribute(const PointAttribute &att,
+                                                  uint8_t *out_data,
+                                                  int64_t byte_stride) const {
+  if (!att.ConvertAllValues<T>(geometry_->num_points(), att.num_components(),
+                               reinterpret_cast<T *>(out_data), byte_stride)) {
+    return Status(Status::DRACO_ERROR, "Failed to convert attribute value.");
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
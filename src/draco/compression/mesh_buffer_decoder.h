@@ -0,0 +1,142 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_MESH_BUFFER_DECODER_H_
+#define DRACO_COMPRESSION_MESH_BUFFER_DECODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "draco/compression/decode.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Decoder that writes the decoded geometry directly into caller-owned memory,
+// such as GPU staging buffers, using a caller-chosen interleaved or planar
+// layout.
+//
+// Attribute transforms (dequantization and octahedral decoding) are not
+// applied during Decode(). Instead, the compact quantized values are kept and
+// they are transformed directly into the output memory by WriteAttribute() or
+// WriteInterleavedAttributes(). This avoids allocating and filling the full
+// precision attribute storage of a draco::Mesh and the extra copy from it.
+//
+// Example:
+//
+//   MeshBufferDecoder decoder;
+//   DRACO_RETURN_IF_ERROR(decoder.Decode(&buffer));
+//   std::vector<uint32_t> indices(3 * decoder.num_faces());
+//   DRACO_RETURN_IF_ERROR(decoder.WriteIndices(indices.data()));
+//   const int pos_id = decoder.geometry()->GetNamedAttributeId(
+//       GeometryAttribute::POSITION);
+//   std::vector<float> positions(3 * decoder.num_points());
+//   DRACO_RETURN_IF_ERROR(decoder.WriteAttribute(
+//       pos_id, DT_FLOAT32, positions.data(), 3 * sizeof(float)));
+//
+class MeshBufferDecoder {
+ public:
+  // Describes where values of one attribute are stored within an interleaved
+  // vertex.
+  struct AttributeLayout {
+    AttributeLayout() : att_id(-1), data_type(DT_FLOAT32), byte_offset(0) {}
+    AttributeLayout(int id, DataType type, int64_t offset)
+        : att_id(id), data_type(type), byte_offset(offset) {}
+    // Id of the attribute in geometry().
+    int att_id;
+    // Data type of the written attribute components.
+    DataType data_type;
+    // Offset of the attribute value from the start of each vertex.
+    int64_t byte_offset;
+  };
+
+  MeshBufferDecoder();
+
+  // Decodes a mesh or a point cloud from |in_buffer|. Any previously decoded
+  // geometry is released.
+  Status Decode(DecoderBuffer *in_buffer);
+
+  // Returns the decoded geometry. Attributes are stored in their decoded but
+  // not yet transformed form and they should only be used to query attribute
+  // properties such as type, number of components or unique id.
+  const PointCloud *geometry() const { return geometry_.get(); }
+
+  int num_points() const {
+    return geometry_ ? static_cast<int>(geometry_->num_points()) : 0;
+  }
+
+  // Returns the number of triangles. Point clouds have no triangles.
+  int num_faces() const {
+    return mesh_ ? static_cast<int>(mesh_->num_faces()) : 0;
+  }
+
+  // Returns the number of components of values written by WriteAttribute().
+  // Normals encoded with octahedral transform are written as 3 components even
+  // though they are stored as 2 components. Returns 0 for invalid |att_id|.
+  int GetOutputNumComponents(int att_id) const;
+
+  // Writes 3 * num_faces() point indices of all triangles into |out_indices|.
+  Status WriteIndices(uint32_t *out_indices) const;
+
+  // Same as above but fails when the point indices do not fit into 16 bits.
+  Status WriteIndices(uint16_t *out_indices) const;
+
+  // Writes values of attribute |att_id| for all points into |out_data|. The
+  // value of point i is written as GetOutputNumComponents() components of type
+  // |out_data_type| at address |out_data| + i * |byte_stride|. A planar layout
+  // uses a |byte_stride| equal to the size of one value, an interleaved layout
+  // uses the size of the whole vertex. Attributes that were encoded with a
+  // lossy transform can only be written as DT_FLOAT32.
+  Status WriteAttribute(int att_id, DataType out_data_type, void *out_data,
+                        int64_t byte_stride) const;
+
+  // Writes all attributes described by |layouts| into interleaved vertices
+  // of |vertex_byte_stride| bytes starting at |out_data|. When a thread pool
+  // is set in options(), the attributes are written in parallel.
+  Status WriteInterleavedAttributes(const std::vector<AttributeLayout> &layouts,
+                                    void *out_data,
+                                    int64_t vertex_byte_stride) const;
+
+  DecoderOptions *options() { return decoder_.options(); }
+  const DecoderOptions *options() const { return decoder_.options(); }
+
+ private:
+  // Writes values of an attribute encoded with quantization transform.
+  Status WriteDequantizedAttribute(const PointAttribute &att, uint8_t *out_data,
+                                   int64_t byte_stride) const;
+
+  // Writes values of an attribute encoded with octahedron transform.
+  Status WriteOctahedralAttribute(const PointAttribute &att, uint8_t *out_data,
+                                  int64_t byte_stride) const;
+
+  // Writes values of an attribute without any transform converted to |T|.
+  template <typename T>
+  Status WriteConvertedAttribute(const PointAttribute &att, uint8_t *out_data,
+                                 int64_t byte_stride) const;
+
+  template <typename IndexT>
+  Status WriteIndicesInternal(IndexT *out_indices) const;
+
+  Decoder decoder_;
+  std::unique_ptr<PointCloud> geometry_;
+  // Set when |geometry_| is a mesh.
+  const Mesh *mesh_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_MESH_BUFFER_DECODER_H_
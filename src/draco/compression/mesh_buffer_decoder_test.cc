@@ -0,0 +1,153 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/mesh_buffer_decoder.h"
+
+#include <string>
+#include <vector>
+
+#include "draco/compression/decode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/io/file_utils.h"
+
+namespace {
+
+class MeshBufferDecoderTest : public ::testing::Test {
+ protected:
+  // Decodes |file_name| with both draco::Decoder and draco::MeshBufferDecoder
+  // and checks that all attribute values written into a planar and an
+  // interleaved layout match the values of the regularly decoded geometry.
+  void TestDecodeFile(const std::string &file_name) {
+    std::vector<char> data;
+    ASSERT_TRUE(
+        draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name), &data));
+    draco::DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    draco::Decoder decoder;
+    std::unique_ptr<draco::PointCloud> pc =
+        decoder.DecodePointCloudFromBuffer(&buffer).value();
+    ASSERT_NE(pc, nullptr);
+
+    buffer.Init(data.data(), data.size());
+    draco::MeshBufferDecoder buffer_decoder;
+    DRACO_ASSERT_OK(buffer_decoder.Decode(&buffer));
+    ASSERT_EQ(buffer_decoder.num_points(), pc->num_points());
+    ASSERT_EQ(buffer_decoder.geometry()->num_attributes(),
+              pc->num_attributes());
+
+    // Check triangle indices.
+    buffer.Init(data.data(), data.size());
+    const bool is_mesh = draco::Decoder::GetEncodedGeometryType(&buffer)
+                             .value() == draco::TRIANGULAR_MESH;
+    const draco::Mesh *const mesh =
+        is_mesh ? static_cast<draco::Mesh *>(pc.get()) : nullptr;
+    const int num_faces = mesh ? mesh->num_faces() : 0;
+    ASSERT_EQ(buffer_decoder.num_faces(), num_faces);
+    std::vector<uint32_t> indices(3 * num_faces);
+    DRACO_ASSERT_OK(buffer_decoder.WriteIndices(indices.data()));
+    std::vector<uint16_t> indices16(3 * num_faces);
+    DRACO_ASSERT_OK(buffer_decoder.WriteIndices(indices16.data()));
+    for (draco::FaceIndex fi(0); fi < num_faces; ++fi) {
+      for (int c = 0; c < 3; ++c) {
+        ASSERT_EQ(indices[3 * fi.value() + c], mesh->face(fi)[c].value());
+        ASSERT_EQ(indices16[3 * fi.value() + c], mesh->face(fi)[c].value());
+      }
+    }
+
+    // Write all attributes into an interleaved vertex buffer.
+    std::vector<draco::MeshBufferDecoder::AttributeLayout> layouts;
+    int64_t vertex_size = 0;
+    for (int i = 0; i < pc->num_attributes(); ++i) {
+      const int num_components = buffer_decoder.GetOutputNumComponents(i);
+      ASSERT_EQ(num_components, pc->attribute(i)->num_components());
+      layouts.push_back(draco::MeshBufferDecoder::AttributeLayout(
+          i, draco::DT_FLOAT32, vertex_size));
+      vertex_size += sizeof(float) * num_components;
+    }
+    std::vector<uint8_t> interleaved(vertex_size * pc->num_points());
+    DRACO_ASSERT_OK(buffer_decoder.WriteInterleavedAttributes(
+        layouts, interleaved.data(), vertex_size));
+
+    for (int i = 0; i < pc->num_attributes(); ++i) {
+      const draco::PointAttribute *const att = pc->attribute(i);
+      const int num_components = att->num_components();
+      std::vector<float> planar(num_components * pc->num_points());
+      DRACO_ASSERT_OK(buffer_decoder.WriteAttribute(
+          i, draco::DT_FLOAT32, planar.data(), sizeof(float) * num_components));
+      std::vector<float> expected(num_components);
+      std::vector<float> value(num_components);
+      for (draco::PointIndex pi(0); pi < pc->num_points(); ++pi) {
+        ASSERT_TRUE(att->ConvertValue<float>(att->mapped_index(pi),
+                                             num_components, expected.data()));
+        memcpy(value.data(),
+               interleaved.data() + vertex_size * pi.value() +
+                   layouts[i].byte_offset,
+               sizeof(float) * num_components);
+        for (int c = 0; c < num_components; ++c) {
+          ASSERT_EQ(planar[num_components * pi.value() + c], expected[c]);
+          ASSERT_EQ(value[c], expected[c]);
+        }
+      }
+    }
+  }
+};
+
+TEST_F(MeshBufferDecoderTest, TestEdgebreakerMesh) {
+  TestDecodeFile("cube_att.obj.edgebreaker.cl10.2.2.drc");
+}
+
+TEST_F(MeshBufferDecoderTest, TestSequentialMesh) {
+  TestDecodeFile("cube_att.obj.sequential.cl3.2.2.drc");
+}
+
+TEST_F(MeshBufferDecoderTest, TestMeshWithNormals) {
+  TestDecodeFile("car.drc");
+}
+
+TEST_F(MeshBufferDecoderTest, TestPointCloud) {
+  TestDecodeFile("pc_kd_color.drc");
+}
+
+TEST_F(MeshBufferDecoderTest, TestInvalidOutput) {
+  // Tests that invalid output parameters are rejected.
+  std::vector<char> data;
+  ASSERT_TRUE(draco::ReadFileToBuffer(
+      draco::GetTestFileFullPath("cube_att.obj.edgebreaker.cl10.2.2.drc"),
+      &data));
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::MeshBufferDecoder buffer_decoder;
+  DRACO_ASSERT_OK(buffer_decoder.Decode(&buffer));
+  const int pos_id = buffer_decoder.geometry()->GetNamedAttributeId(
+      draco::GeometryAttribute::POSITION);
+  std::vector<float> positions(3 * buffer_decoder.num_points());
+  // Stride is too small.
+  ASSERT_FALSE(buffer_decoder
+                   .WriteAttribute(pos_id, draco::DT_FLOAT32, positions.data(),
+                                   sizeof(float))
+                   .ok());
+  // Quantized positions can be written only as floats.
+  ASSERT_FALSE(buffer_decoder
+                   .WriteAttribute(pos_id, draco::DT_INT32, positions.data(),
+                                   3 * sizeof(int32_t))
+                   .ok());
+  // Invalid attribute id.
+  ASSERT_FALSE(buffer_decoder
+                   .WriteAttribute(-1, draco::DT_FLOAT32, positions.data(),
+                                   3 * sizeof(float))
+                   .ok());
+}
+
+}  // namespace
@@ -0,0 +1,210 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/mesh_sequence_decoder.h"
+
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/decode.h"
+#include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/core/bit_utils.h"
+#include "draco/core/quantization_utils.h"
+#include "draco/core/varint_decoding.h"
+
+namespace draco {
+
+MeshSequenceDecoder::MeshSequenceDecoder()
+    : keyframe_interval_(0),
+      quantization_bits_(0),
+      quantization_origin_{0.f, 0.f, 0.f},
+      quantization_range_(0.f),
+      current_frame_(-1) {}
+
+bool MeshSequenceDecoder::IsMeshSequence(DecoderBuffer *in_buffer) {
+  char magic[5];
+  if (!in_buffer->Peek(magic, sizeof(magic))) {
+    return false;
+  }
+  return memcmp(magic, "DRSEQ", 5) == 0;
+}
+
+Status MeshSequenceDecoder::DecodeHeader(DecoderBuffer *in_buffer) {
+  mesh_.reset();
+  frames_.clear();
+  current_frame_ = -1;
+  if (!IsMeshSequence(in_buffer)) {
+    return Status(Status::DRACO_ERROR, "Not a Draco mesh sequence.");
+  }
+  in_buffer->Advance(5);
+  uint8_t version_major, version_minor;
+  if (!in_buffer->Decode(&version_major) ||
+      !in_buffer->Decode(&version_minor)) {
+    return Status(Status::IO_ERROR, "Failed to parse the sequence header.");
+  }
+  if (version_major != 1) {
+    return Status(Status::UNKNOWN_VERSION,
+                  "Unknown mesh sequence container version.");
+  }
+  uint32_t num_frames, keyframe_interval, num_points;
+  uint8_t quantization_bits;
+  if (!DecodeVarint(&num_frames, in_buffer) ||
+      !DecodeVarint(&keyframe_interval, in_buffer) ||
+      !DecodeVarint(&num_points, in_buffer) ||
+      !in_buffer->Decode(&quantization_bits) ||
+      !in_buffer->Decode(quantization_origin_, 3 * sizeof(float)) ||
+      !in_buffer->Decode(&quantization_range_)) {
+    return Status(Status::IO_ERROR, "Failed to parse the sequence header.");
+  }
+  // Each frame size takes at least one byte.
+  if (num_frames > in_buffer->remaining_size() ||
+      num_frames > static_cast<uint32_t>(std::numeric_limits<int>::max()) ||
+      keyframe_interval < 1 ||
+      keyframe_interval >
+          static_cast<uint32_t>(std::numeric_limits<int>::max()) ||
+      num_points > static_cast<uint32_t>(std::numeric_limits<int>::max() / 3) ||
+      quantization_bits < 1 || quantization_bits > 30) {
+    return Status(Status::DRACO_ERROR, "Invalid sequence header.");
+  }
+  uint64_t base_mesh_size;
+  if (!DecodeVarint(&base_mesh_size, in_buffer)) {
+    return Status(Status::IO_ERROR, "Failed to parse the sequence header.");
+  }
+  std::vector<int64_t> frame_sizes(num_frames);
+  uint64_t data_size = base_mesh_size;
+  for (uint32_t f = 0; f < num_frames; ++f) {
+    uint64_t frame_size;
+    if (!DecodeVarint(&frame_size, in_buffer)) {
+      return Status(Status::IO_ERROR, "Failed to parse the sequence header.");
+    }
+    if (frame_size > static_cast<uint64_t>(in_buffer->remaining_size()) ||
+        data_size > static_cast<uint64_t>(in_buffer->remaining_size())) {
+      return Status(Status::IO_ERROR, "Sequence data is truncated.");
+    }
+    frame_sizes[f] = static_cast<int64_t>(frame_size);
+    data_size += frame_size;
+  }
+  if (data_size > static_cast<uint64_t>(in_buffer->remaining_size())) {
+    return Status(Status::IO_ERROR, "Sequence data is truncated.");
+  }
+
+  DecoderBuffer base_buffer;
+  base_buffer.Init(in_buffer->data_head(), base_mesh_size);
+  Decoder decoder;
+  *decoder.options() = options_;
+  DRACO_ASSIGN_OR_RETURN(std::unique_ptr<Mesh> mesh,
+                         decoder.DecodeMeshFromBuffer(&base_buffer));
+  const int pos_att_id = mesh->GetNamedAttributeId(GeometryAttribute::POSITION);
+  if (mesh->num_points() != num_points || pos_att_id < 0 ||
+      mesh->attribute(pos_att_id)->num_components() != 3) {
+    return Status(Status::DRACO_ERROR, "Invalid first frame.");
+  }
+  // Store a float position for each point so that frames can be written
+  // directly into the attribute buffer.
+  const PointAttribute *const pos_att = mesh->attribute(pos_att_id);
+  GeometryAttribute ga;
+  ga.Init(GeometryAttribute::POSITION, nullptr, 3, DT_FLOAT32, false,
+          3 * sizeof(float), 0);
+  std::unique_ptr<PointAttribute> frame_pos_att(new PointAttribute(ga));
+  frame_pos_att->SetIdentityMapping();
+  frame_pos_att->Reset(num_points);
+  frame_pos_att->set_unique_id(pos_att->unique_id());
+  mesh->SetAttribute(pos_att_id, std::move(frame_pos_att));
+
+  const char *frame_data = in_buffer->data_head() + base_mesh_size;
+  frames_.resize(num_frames);
+  for (uint32_t f = 0; f < num_frames; ++f) {
+    frames_[f].data = frame_data;
+    frames_[f].size = frame_sizes[f];
+    frame_data += frame_sizes[f];
+  }
+  in_buffer->Advance(data_size);
+  mesh_ = std::move(mesh);
+  keyframe_interval_ = static_cast<int>(keyframe_interval);
+  quantization_bits_ = quantization_bits;
+  quantized_values_.assign(3 * num_points, 0);
+  symbols_.resize(3 * num_points);
+  return OkStatus();
+}
+
+Status MeshSequenceDecoder::DecodeFrame(int frame_id) {
+  if (mesh_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "Sequence header was not decoded.");
+  }
+  if (frame_id < 0 || frame_id >= num_frames()) {
+    return Status(Status::DRACO_ERROR, "Invalid frame id.");
+  }
+  if (frame_id == current_frame_) {
+    return OkStatus();
+  }
+  // Continue from the current frame when it is between the keyframe of
+  // |frame_id| and |frame_id|.
+  const int keyframe_id = frame_id - frame_id % keyframe_interval_;
+  int first_frame_id = keyframe_id;
+  if (current_frame_ >= keyframe_id && current_frame_ < frame_id) {
+    first_frame_id = current_frame_ + 1;
+  }
+  current_frame_ = -1;
+  for (int f = first_frame_id; f <= frame_id; ++f) {
+    DRACO_RETURN_IF_ERROR(DecodeFrameResiduals(f));
+  }
+  current_frame_ = frame_id;
+
+  Dequantizer dequantizer;
+  if (!dequantizer.Init(quantization_range_,
+                        (1u << quantization_bits_) - 1)) {
+    return Status(Status::DRACO_ERROR, "Invalid quantization range.");
+  }
+  PointAttribute *const pos_att =
+      mesh_->attribute(mesh_->GetNamedAttributeId(GeometryAttribute::POSITION));
+  dequantizer.DequantizeValues(
+      quantized_values_.data(), mesh_->num_points(), 3, quantization_origin_,
+      reinterpret_cast<float *>(pos_att->GetAddress(AttributeValueIndex(0))));
+  return OkStatus();
+}
+
+Status MeshSequenceDecoder::DecodeFrameResiduals(int frame_id) {
+  const int num_values = static_cast<int>(quantized_values_.size());
+  if (num_values == 0) {
+    return OkStatus();
+  }
+  DecoderBuffer buffer;
+  buffer.Init(frames_[frame_id].data, frames_[frame_id].size);
+  // Residuals are entropy coded with the current version of symbol coding.
+  buffer.set_bitstream_version(kDracoMeshBitstreamVersion);
+  if (!DecodeSymbols(num_values, 3, &buffer, symbols_.data())) {
+    return Status(Status::DRACO_ERROR, "Failed to decode frame positions.");
+  }
+  // The residuals are stored in |symbols_| reinterpreted as signed values.
+  int32_t *const residuals = reinterpret_cast<int32_t *>(symbols_.data());
+  ConvertSymbolsToSignedInts(symbols_.data(), num_values, residuals);
+  // Unsigned arithmetic avoids overflows on invalid input.
+  uint32_t *const values =
+      reinterpret_cast<uint32_t *>(quantized_values_.data());
+  if (frame_id % keyframe_interval_ == 0) {
+    for (int i = 0; i < num_values; ++i) {
+      values[i] = static_cast<uint32_t>(residuals[i]) +
+                  (i < 3 ? 0 : values[i - 3]);
+    }
+  } else {
+    for (int i = 0; i < num_values; ++i) {
+      values[i] += static_cast<uint32_t>(residuals[i]);
+    }
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
@@ -0,0 +1,104 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_MESH_SEQUENCE_DECODER_H_
+#define DRACO_COMPRESSION_MESH_SEQUENCE_DECODER_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "draco/compression/config/decoder_options.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Decoder for mesh sequences encoded with MeshSequenceEncoder (see
+// mesh_sequence_encoder.h). The connectivity and all attributes of the first
+// frame are decoded once by DecodeHeader(). DecodeFrame() then updates only
+// the positions of mesh() in place:
+//
+//   MeshSequenceDecoder decoder;
+//   DRACO_RETURN_IF_ERROR(decoder.DecodeHeader(&buffer));
+//   for (int f = 0; f < decoder.num_frames(); ++f) {
+//     DRACO_RETURN_IF_ERROR(decoder.DecodeFrame(f));
+//     Render(*decoder.mesh());
+//   }
+//
+// Decoding of the next frame only applies its residuals to the current one.
+// Other frames are decoded starting from the closest preceding keyframe.
+//
+class MeshSequenceDecoder {
+ public:
+  MeshSequenceDecoder();
+
+  // Returns true when |in_buffer| starts with a mesh sequence. The buffer
+  // position is not changed.
+  static bool IsMeshSequence(DecoderBuffer *in_buffer);
+
+  // Decodes the container header and the first frame from |in_buffer| and
+  // advances the buffer past all frame data. The data of |in_buffer| must
+  // stay valid while frames are decoded.
+  Status DecodeHeader(DecoderBuffer *in_buffer);
+
+  // Functions below can be used after a successful call to DecodeHeader().
+
+  // Returns the number of frames of the sequence.
+  int num_frames() const { return static_cast<int>(frames_.size()); }
+
+  // Returns the number of frames between two keyframes.
+  int keyframe_interval() const { return keyframe_interval_; }
+
+  // Sets the positions of mesh() to the positions of frame |frame_id|.
+  Status DecodeFrame(int frame_id);
+
+  // Returns the id of the frame stored in mesh() or -1 when no frame was
+  // decoded yet.
+  int current_frame() const { return current_frame_; }
+
+  // Returns the mesh with the positions of current_frame(). Points of the
+  // mesh are in the order of the points of the encoded frames.
+  const Mesh *mesh() const { return mesh_.get(); }
+
+  // Returns the options used for decoding of the first frame.
+  DecoderOptions *options() { return &options_; }
+
+ private:
+  // Location of the data of an encoded frame.
+  struct FrameInfo {
+    const char *data;
+    int64_t size;
+  };
+
+  // Applies the residuals of frame |frame_id| to |quantized_values_|.
+  Status DecodeFrameResiduals(int frame_id);
+
+  DecoderOptions options_;
+  std::unique_ptr<Mesh> mesh_;
+  std::vector<FrameInfo> frames_;
+  int keyframe_interval_;
+  int quantization_bits_;
+  float quantization_origin_[3];
+  float quantization_range_;
+  // Quantized positions of |current_frame_|.
+  std::vector<int32_t> quantized_values_;
+  std::vector<uint32_t> symbols_;
+  int current_frame_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_MESH_SEQUENCE_DECODER_H_
@@ -0,0 +1,220 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/mesh_sequence_encoder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "draco/compression/entropy/symbol_encoding.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/bit_utils.h"
+#include "draco/core/quantization_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/varint_encoding.h"
+
+namespace draco {
+
+namespace {
+
+// Returns true when |frame| has the same faces and number of points as
+// |first_frame|.
+bool HasSameConnectivity(const Mesh &frame, const Mesh &first_frame) {
+  if (frame.num_points() != first_frame.num_points() ||
+      frame.num_faces() != first_frame.num_faces()) {
+    return false;
+  }
+  for (FaceIndex fi(0); fi < frame.num_faces(); ++fi) {
+    if (frame.face(fi) != first_frame.face(fi)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+MeshSequenceEncoder::MeshSequenceEncoder() : keyframe_interval_(30) {}
+
+Status MeshSequenceEncoder::EncodeSequenceToBuffer(
+    const std::vector<const Mesh *> &frames, const Encoder &encoder,
+    EncoderBuffer *out_buffer) {
+  if (frames.empty()) {
+    return Status(Status::DRACO_ERROR, "Sequence has no frames.");
+  }
+  return EncodeSequenceToBuffer(
+      frames, encoder.CreateExpertEncoderOptions(*frames[0]), out_buffer);
+}
+
+Status MeshSequenceEncoder::EncodeSequenceToBuffer(
+    const std::vector<const Mesh *> &frames, const EncoderOptions &options,
+    EncoderBuffer *out_buffer) {
+  if (frames.empty()) {
+    return Status(Status::DRACO_ERROR, "Sequence has no frames.");
+  }
+  if (keyframe_interval_ < 1) {
+    return Status(Status::DRACO_ERROR, "Invalid keyframe interval.");
+  }
+  const Mesh &first_frame = *frames[0];
+  const int pos_att_id =
+      first_frame.GetNamedAttributeId(GeometryAttribute::POSITION);
+  if (pos_att_id < 0 ||
+      first_frame.attribute(pos_att_id)->num_components() != 3) {
+    return Status(Status::DRACO_ERROR, "Missing position attribute.");
+  }
+  const int quantization_bits =
+      options.GetAttributeInt(pos_att_id, "quantization_bits", -1);
+  if (quantization_bits < 1 || quantization_bits > 30) {
+    return Status(Status::DRACO_ERROR, "Positions must be quantized.");
+  }
+  const int num_frames = static_cast<int>(frames.size());
+  const int num_points = first_frame.num_points();
+  const int num_values = 3 * num_points;
+  if (num_points > std::numeric_limits<int>::max() / 3) {
+    return Status(Status::DRACO_ERROR, "Mesh is too large.");
+  }
+  ThreadPool *const pool = options.thread_pool();
+
+  // Convert positions of all points of all frames to floats.
+  std::vector<std::vector<float>> positions(num_frames);
+  std::vector<uint8_t> is_frame_valid(num_frames, 0);
+  ParallelFor(pool, num_frames, [&](int f) {
+    const Mesh &frame = *frames[f];
+    const PointAttribute *const pos_att =
+        frame.GetNamedAttribute(GeometryAttribute::POSITION);
+    if (pos_att == nullptr || pos_att->num_components() != 3 ||
+        !HasSameConnectivity(frame, first_frame)) {
+      return;
+    }
+    positions[f].resize(num_values);
+    for (PointIndex pi(0); pi < num_points; ++pi) {
+      if (!pos_att->ConvertValue<float>(pos_att->mapped_index(pi), 3,
+                                        &positions[f][3 * pi.value()])) {
+        return;
+      }
+    }
+    is_frame_valid[f] = 1;
+  });
+  for (int f = 0; f < num_frames; ++f) {
+    if (!is_frame_valid[f]) {
+      return Status(Status::DRACO_ERROR,
+                    "Frames must have the connectivity of the first frame.");
+    }
+  }
+
+  // Quantize positions of all frames in a common grid.
+  float min_values[3] = {std::numeric_limits<float>::max(),
+                         std::numeric_limits<float>::max(),
+                         std::numeric_limits<float>::max()};
+  float max_values[3] = {std::numeric_limits<float>::lowest(),
+                         std::numeric_limits<float>::lowest(),
+                         std::numeric_limits<float>::lowest()};
+  for (int f = 0; f < num_frames; ++f) {
+    for (int i = 0; i < num_values; ++i) {
+      min_values[i % 3] = std::min(min_values[i % 3], positions[f][i]);
+      max_values[i % 3] = std::max(max_values[i % 3], positions[f][i]);
+    }
+  }
+  float range = 0.f;
+  for (int c = 0; c < 3; ++c) {
+    if (num_points == 0) {
+      min_values[c] = max_values[c] = 0.f;
+    }
+    range = std::max(range, max_values[c] - min_values[c]);
+  }
+  if (!std::isfinite(range)) {
+    return Status(Status::DRACO_ERROR, "Invalid position values.");
+  }
+  if (range == 0.f) {
+    range = 1.f;
+  }
+  const int32_t max_quantized_value = (1u << quantization_bits) - 1;
+  Quantizer quantizer;
+  quantizer.Init(range, max_quantized_value);
+
+  // Encode residuals of each frame. Frames are predicted from the quantized
+  // positions of the previous frame, which are identical to the decoded ones.
+  std::vector<std::vector<int32_t>> quantized(num_frames);
+  ParallelFor(pool, num_frames, [&](int f) {
+    quantized[f].resize(num_values);
+    for (int i = 0; i < num_values; ++i) {
+      const int32_t value =
+          quantizer.QuantizeFloat(positions[f][i] - min_values[i % 3]);
+      quantized[f][i] = std::min(std::max(value, 0), max_quantized_value);
+    }
+    std::vector<float>().swap(positions[f]);
+  });
+  std::vector<EncoderBuffer> frame_buffers(num_frames);
+  std::vector<uint8_t> is_frame_encoded(num_frames, 0);
+  ParallelFor(pool, num_frames, [&](int f) {
+    std::vector<int32_t> residuals(num_values);
+    const std::vector<int32_t> &values = quantized[f];
+    if (f % keyframe_interval_ == 0) {
+      for (int i = 0; i < num_values; ++i) {
+        residuals[i] = i < 3 ? values[i] : values[i] - values[i - 3];
+      }
+    } else {
+      const std::vector<int32_t> &prev_values = quantized[f - 1];
+      for (int i = 0; i < num_values; ++i) {
+        residuals[i] = values[i] - prev_values[i];
+      }
+    }
+    std::vector<uint32_t> symbols(num_values);
+    ConvertSignedIntsToSymbols(residuals.data(), num_values, symbols.data());
+    is_frame_encoded[f] = EncodeSymbols(symbols.data(), num_values, 3,
+                                        nullptr, &frame_buffers[f]);
+  });
+  for (int f = 0; f < num_frames; ++f) {
+    if (!is_frame_encoded[f]) {
+      return Status(Status::DRACO_ERROR, "Failed to encode frame positions.");
+    }
+  }
+
+  // Encode the first frame with sequential connectivity that keeps the order
+  // of points, so that the positions of all frames match the decoded points.
+  EncoderOptions base_options = options;
+  base_options.SetAttributeVector(pos_att_id, "quantization_origin", 3,
+                                  min_values);
+  base_options.SetAttributeFloat(pos_att_id, "quantization_range", range);
+  ExpertEncoder base_encoder(first_frame);
+  base_encoder.Reset(base_options);
+  base_encoder.SetEncodingMethod(MESH_SEQUENTIAL_ENCODING);
+  EncoderBuffer base_buffer;
+  DRACO_RETURN_IF_ERROR(base_encoder.EncodeToBuffer(&base_buffer));
+
+  out_buffer->Encode("DRSEQ", 5);
+  const uint8_t version_major = 1;
+  const uint8_t version_minor = 0;
+  out_buffer->Encode(version_major);
+  out_buffer->Encode(version_minor);
+  EncodeVarint(static_cast<uint32_t>(num_frames), out_buffer);
+  EncodeVarint(static_cast<uint32_t>(keyframe_interval_), out_buffer);
+  EncodeVarint(static_cast<uint32_t>(num_points), out_buffer);
+  out_buffer->Encode(static_cast<uint8_t>(quantization_bits));
+  out_buffer->Encode(min_values, 3 * sizeof(float));
+  out_buffer->Encode(range);
+  EncodeVarint(static_cast<uint64_t>(base_buffer.size()), out_buffer);
+  for (int f = 0; f < num_frames; ++f) {
+    EncodeVarint(static_cast<uint64_t>(frame_buffers[f].size()), out_buffer);
+  }
+  out_buffer->Encode(base_buffer.data(), base_buffer.size());
+  for (int f = 0; f < num_frames; ++f) {
+    out_buffer->Encode(frame_buffers[f].data(), frame_buffers[f].size());
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
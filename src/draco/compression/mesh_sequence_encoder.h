@@ -0,0 +1,85 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_MESH_SEQUENCE_ENCODER_H_
+#define DRACO_COMPRESSION_MESH_SEQUENCE_ENCODER_H_
+
+#include <vector>
+
+#include "draco/compression/config/encoder_options.h"
+#include "draco/compression/encode.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Encoder of sequences of meshes with constant connectivity and changing
+// positions, e.g. frames of an animated or deforming mesh (see
+// MeshSequenceDecoder in mesh_sequence_decoder.h).
+//
+// The first frame is encoded once as a regular Draco mesh with sequential
+// connectivity, which preserves the order of its points. Only positions are
+// stored for each frame. They are quantized in a grid shared by all frames
+// and predicted either from the previous point of the same frame (keyframes)
+// or from the same point of the previous frame (other frames). The
+// prediction residuals are entropy coded. Frames can be decoded at random
+// only at keyframes, which are stored every keyframe_interval() frames.
+//
+// The encoded data is stored in the following container:
+//
+//   "DRSEQ"                       Magic string (5 bytes).
+//   uint8_t major_version         Container version (currently 1.0).
+//   uint8_t minor_version
+//   varint num_frames
+//   varint keyframe_interval
+//   varint num_points
+//   uint8_t quantization_bits     Quantization of positions of all frames.
+//   float quantization_origin[3]
+//   float quantization_range
+//   varint base_mesh_size         Size of the encoded first frame in bytes.
+//   varint frame_size[num_frames] Size of the positions of each frame.
+//   base mesh data                Regular Draco bitstream of the first frame.
+//   frame data                    Entropy coded residuals of each frame.
+//
+class MeshSequenceEncoder {
+ public:
+  MeshSequenceEncoder();
+
+  // Sets the number of frames between two keyframes. 1 makes all frames
+  // keyframes.
+  void set_keyframe_interval(int interval) { keyframe_interval_ = interval; }
+  int keyframe_interval() const { return keyframe_interval_; }
+
+  // Encodes |frames| into |out_buffer| using the options of |encoder| for the
+  // first frame. The quantization of positions must be set.
+  Status EncodeSequenceToBuffer(const std::vector<const Mesh *> &frames,
+                                const Encoder &encoder,
+                                EncoderBuffer *out_buffer);
+
+  // Same as above but with |options|. Attribute options are specified for
+  // attribute ids of the first frame as in ExpertEncoder. All frames must
+  // have the same faces and the same number of points as the first frame.
+  // Attributes other than positions are encoded only for the first frame.
+  Status EncodeSequenceToBuffer(const std::vector<const Mesh *> &frames,
+                                const EncoderOptions &options,
+                                EncoderBuffer *out_buffer);
+
+ private:
+  int keyframe_interval_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_MESH_SEQUENCE_ENCODER_H_
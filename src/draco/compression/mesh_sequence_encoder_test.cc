@@ -0,0 +1,160 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/mesh_sequence_encoder.h"
+
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
+#include "draco/compression/mesh_sequence_decoder.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+
+namespace {
+
+class MeshSequenceEncoderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (int f = 0; f < 10; ++f) {
+      std::unique_ptr<draco::Mesh> frame = CreateFrame(f);
+      ASSERT_NE(frame, nullptr);
+      frames_.push_back(std::move(frame));
+    }
+  }
+
+  // Returns the test mesh with positions deformed by a wave that moves with
+  // |frame_id|.
+  std::unique_ptr<draco::Mesh> CreateFrame(int frame_id) const {
+    std::unique_ptr<draco::Mesh> frame =
+        draco::ReadMeshFromTestFile("bunny_norm.obj");
+    if (frame == nullptr) {
+      return nullptr;
+    }
+    draco::PointAttribute *const pos_att =
+        frame->attribute(frame->GetNamedAttributeId(
+            draco::GeometryAttribute::POSITION));
+    for (draco::AttributeValueIndex avi(0); avi < pos_att->size(); ++avi) {
+      draco::Vector3f pos;
+      pos_att->GetValue(avi, &pos[0]);
+      pos[1] += 0.01f * std::sin(20.f * pos[0] + 0.3f * frame_id);
+      pos_att->SetAttributeValue(avi, &pos[0]);
+    }
+    return frame;
+  }
+
+  std::vector<const draco::Mesh *> GetFrames() const {
+    std::vector<const draco::Mesh *> frames;
+    for (const auto &frame : frames_) {
+      frames.push_back(frame.get());
+    }
+    return frames;
+  }
+
+  // Checks that the positions of |mesh| match the positions of frame
+  // |frame_id| within |tolerance|.
+  void CheckFrame(const draco::Mesh &mesh, int frame_id,
+                  float tolerance) const {
+    const draco::Mesh &frame = *frames_[frame_id];
+    ASSERT_EQ(mesh.num_points(), frame.num_points());
+    ASSERT_EQ(mesh.num_faces(), frame.num_faces());
+    const draco::PointAttribute *const pos_att =
+        mesh.GetNamedAttribute(draco::GeometryAttribute::POSITION);
+    const draco::PointAttribute *const frame_pos_att =
+        frame.GetNamedAttribute(draco::GeometryAttribute::POSITION);
+    for (draco::PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+      draco::Vector3f pos, frame_pos;
+      pos_att->GetMappedValue(pi, &pos[0]);
+      frame_pos_att->GetMappedValue(pi, &frame_pos[0]);
+      for (int c = 0; c < 3; ++c) {
+        ASSERT_NEAR(pos[c], frame_pos[c], tolerance);
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<draco::Mesh>> frames_;
+};
+
+TEST_F(MeshSequenceEncoderTest, TestEncodeDecode) {
+  // Tests that all frames of a sequence can be decoded in order and at
+  // random.
+  draco::ThreadPool pool(3);
+  draco::Encoder encoder;
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 14);
+  encoder.options().SetThreadPool(&pool);
+  draco::MeshSequenceEncoder sequence_encoder;
+  sequence_encoder.set_keyframe_interval(4);
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(
+      sequence_encoder.EncodeSequenceToBuffer(GetFrames(), encoder, &buffer));
+
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  ASSERT_TRUE(draco::MeshSequenceDecoder::IsMeshSequence(&in_buffer));
+  draco::MeshSequenceDecoder decoder;
+  DRACO_ASSERT_OK(decoder.DecodeHeader(&in_buffer));
+  ASSERT_EQ(in_buffer.remaining_size(), 0);
+  ASSERT_EQ(decoder.num_frames(), 10);
+  ASSERT_EQ(decoder.keyframe_interval(), 4);
+  ASSERT_EQ(decoder.current_frame(), -1);
+  ASSERT_NE(decoder.mesh()->GetNamedAttribute(draco::GeometryAttribute::NORMAL),
+            nullptr);
+
+  // The quantization step of the bunny positions is below 1e-5.
+  const float tolerance = 1e-5f;
+  for (int f = 0; f < decoder.num_frames(); ++f) {
+    DRACO_ASSERT_OK(decoder.DecodeFrame(f));
+    ASSERT_EQ(decoder.current_frame(), f);
+    CheckFrame(*decoder.mesh(), f, tolerance);
+  }
+  for (const int f : {7, 2, 3, 9, 0}) {
+    DRACO_ASSERT_OK(decoder.DecodeFrame(f));
+    CheckFrame(*decoder.mesh(), f, tolerance);
+  }
+  ASSERT_FALSE(decoder.DecodeFrame(10).ok());
+
+  // The sequence is smaller than independently encoded frames.
+  size_t frames_size = 0;
+  for (const auto &frame : frames_) {
+    draco::EncoderBuffer frame_buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*frame, &frame_buffer));
+    frames_size += frame_buffer.size();
+  }
+  ASSERT_LT(buffer.size(), frames_size);
+}
+
+TEST_F(MeshSequenceEncoderTest, TestInvalidSequence) {
+  // Tests that frames with different connectivity or without quantized
+  // positions are rejected.
+  draco::Encoder encoder;
+  draco::MeshSequenceEncoder sequence_encoder;
+  draco::EncoderBuffer buffer;
+  ASSERT_FALSE(
+      sequence_encoder.EncodeSequenceToBuffer(GetFrames(), encoder, &buffer)
+          .ok());
+
+  encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 14);
+  draco::Mesh::Face face = frames_[3]->face(draco::FaceIndex(0));
+  std::swap(face[0], face[1]);
+  frames_[3]->SetFace(draco::FaceIndex(0), face);
+  ASSERT_FALSE(
+      sequence_encoder.EncodeSequenceToBuffer(GetFrames(), encoder, &buffer)
+          .ok());
+}
+
+}  // namespace
@@ -20,7 +20,6 @@
 #include <array>
 #include <limits>
 #include <memory>
-#include <stack>
 #include <vector>
 
 #include "draco/compression/bit_coders/adaptive_rans_bit_decoder.h"
@@ -31,6 +30,7 @@
 #include "draco/core/bit_utils.h"
 #include "draco/core/decoder_buffer.h"
 #include "draco/core/math_utils.h"
+#include "draco/core/varint_decoding.h"
 
 namespace draco {
 
@@ -67,6 +67,17 @@ struct DynamicIntegerPointsKdTreeDecoderCompressionPolicy<6>
 };
 
 // Decodes a point cloud encoded by DynamicIntegerPointsKdTreeEncoder.
+//
+// Trees encoded in level order can be decoded only up to a given number of
+// levels (see set_max_decoded_levels()). Each node of the tree that was not
+// fully decoded is then represented by a single point at the minimum corner
+// of the node, which results in a uniformly subsampled point cloud. Unlike
+// the center of the node, the corner never exceeds the coordinates of the
+// points in the node, so it stays within the range of every attribute.
+//
+// Partitioned trees (see set_partitioned()) are decoded one subtree after
+// another. When the first levels of a partitioned tree already provide the
+// requested number of levels, the subtrees are skipped.
 template <int compression_level_t>
 class DynamicIntegerPointsKdTreeDecoder {
   static_assert(compression_level_t >= 0, "Compression level must in [0..6].");
@@ -87,6 +98,9 @@ class DynamicIntegerPointsKdTreeDecoder {
         num_points_(0),
         num_decoded_points_(0),
         dimension_(dimension),
+        level_order_(false),
+        partitioned_(false),
+        max_decoded_levels_(std::numeric_limits<uint32_t>::max()),
         p_(dimension, 0),
         axes_(dimension, 0),
         // Init the stack with the maximum depth of the tree.
@@ -117,12 +131,78 @@ class DynamicIntegerPointsKdTreeDecoder {
   // Returns the number of decoded points. Must be called after DecodePoints().
   uint32_t num_decoded_points() const { return num_decoded_points_; }
 
+  // Returns the number of points of the encoded point cloud. Can be larger
+  // than num_decoded_points() when not all levels were decoded. Must be called
+  // after DecodePoints().
+  uint32_t num_points() const { return num_points_; }
+
+  // Sets whether the tree was encoded in level order (breadth first).
+  void set_level_order(bool level_order) { level_order_ = level_order; }
+  bool level_order() const { return level_order_; }
+
+  // Sets whether the tree was encoded with independent subtrees (see
+  // DynamicIntegerPointsKdTreeEncoder::set_partition_levels()).
+  void set_partitioned(bool partitioned) { partitioned_ = partitioned; }
+
+  // Sets the maximum number of tree levels that are decoded. Used only for
+  // trees encoded in level order.
+  void set_max_decoded_levels(uint32_t num_levels) {
+    max_decoded_levels_ = num_levels;
+  }
+
  private:
   uint32_t GetAxis(uint32_t num_remaining_points, const VectorUint32 &levels,
                    uint32_t last_axis);
 
+  // Subtree of a partitioned tree that is decoded from its own bit streams.
+  struct Subtree {
+    uint32_t num_points;
+    uint32_t last_axis;
+    VectorUint32 base;
+    VectorUint32 levels;
+  };
+
   template <class OutputIteratorT>
-  bool DecodeInternal(uint32_t num_points, OutputIteratorT &oit);
+  bool DecodePartitioned(DecoderBuffer *buffer, uint32_t partition_levels,
+                         OutputIteratorT &oit);
+
+  // Decodes the tree rooted in the node with |num_points|, |base| and
+  // |root_levels| depth first.
+  template <class OutputIteratorT>
+  bool DecodeInternal(uint32_t num_points, const VectorUint32 &base,
+                      const VectorUint32 &root_levels, uint32_t last_axis,
+                      OutputIteratorT &oit);
+  // Decodes the tree rooted in the node with |num_points|, |base| and
+  // |root_levels| breadth first, up to |max_levels| levels. The remaining
+  // nodes are appended to |subtrees| when it is not null. Otherwise their
+  // bases are output.
+  template <class OutputIteratorT>
+  bool DecodeInternalLevelOrder(uint32_t num_points, const VectorUint32 &base,
+                                const VectorUint32 &root_levels,
+                                uint32_t last_axis, uint32_t max_levels,
+                                std::vector<Subtree> *subtrees,
+                                OutputIteratorT &oit);
+
+  bool StartDecoding(DecoderBuffer *buffer) {
+    return numbers_decoder_.StartDecoding(buffer) &&
+           remaining_bits_decoder_.StartDecoding(buffer) &&
+           axis_decoder_.StartDecoding(buffer) &&
+           half_decoder_.StartDecoding(buffer);
+  }
+  void EndDecoding() {
+    numbers_decoder_.EndDecoding();
+    remaining_bits_decoder_.EndDecoding();
+    axis_decoder_.EndDecoding();
+    half_decoder_.EndDecoding();
+  }
+
+  // Decodes |num_remaining_points| (up to two) points whose bits are not
+  // defined by |base| and |levels|, starting with |axis|.
+  template <class OutputIteratorT>
+  bool DecodeRemainingBits(uint32_t num_remaining_points,
+                           const VectorUint32 &base,
+                           const VectorUint32 &levels, uint32_t axis,
+                           OutputIteratorT &oit);
 
   void DecodeNumber(int nbits, uint32_t *value) {
     numbers_decoder_.DecodeLeastSignificantBits32(nbits, value);
@@ -140,10 +220,23 @@ class DynamicIntegerPointsKdTreeDecoder {
     uint32_t stack_pos;  // used to get base and levels
   };
 
+  // Node of the tree used by the level order decoding. Base and levels of the
+  // node are stored separately.
+  struct LevelOrderStatus {
+    LevelOrderStatus(uint32_t num_remaining_points_, uint32_t last_axis_)
+        : num_remaining_points(num_remaining_points_), last_axis(last_axis_) {}
+
+    uint32_t num_remaining_points;
+    uint32_t last_axis;
+  };
+
   uint32_t bit_length_;
   uint32_t num_points_;
   uint32_t num_decoded_points_;
   uint32_t dimension_;
+  bool level_order_;
+  bool partitioned_;
+  uint32_t max_decoded_levels_;
   NumbersDecoder numbers_decoder_;
   RemainingBitsDecoder remaining_bits_decoder_;
   AxisDecoder axis_decoder_;
@@ -192,6 +285,12 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodePoints(
   if (!buffer->Decode(&num_points_)) {
     return false;
   }
+  uint8_t partition_levels = 0;
+  if (partitioned_) {
+    if (!buffer->Decode(&partition_levels) || partition_levels == 0) {
+      return false;
+    }
+  }
   if (num_points_ == 0) {
     return true;
   }
@@ -200,28 +299,69 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodePoints(
   }
   num_decoded_points_ = 0;
 
-  if (!numbers_decoder_.StartDecoding(buffer)) {
+  if (!StartDecoding(buffer)) {
     return false;
   }
-  if (!remaining_bits_decoder_.StartDecoding(buffer)) {
-    return false;
+  if (partitioned_) {
+    return DecodePartitioned(buffer, partition_levels, oit);
   }
-  if (!axis_decoder_.StartDecoding(buffer)) {
+
+  const VectorUint32 root(dimension_, 0);
+  if (level_order_) {
+    if (!DecodeInternalLevelOrder(num_points_, root, root, 0,
+                                  max_decoded_levels_, nullptr, oit)) {
+      return false;
+    }
+  } else if (!DecodeInternal(num_points_, root, root, 0, oit)) {
     return false;
   }
-  if (!half_decoder_.StartDecoding(buffer)) {
+  EndDecoding();
+  return true;
+}
+
+template <int compression_level_t>
+template <class OutputIteratorT>
+bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodePartitioned(
+    DecoderBuffer *buffer, uint32_t partition_levels, OutputIteratorT &oit) {
+  // The top levels of the tree are always encoded in level order.
+  const VectorUint32 root(dimension_, 0);
+  const bool decode_subtrees =
+      !level_order_ || max_decoded_levels_ > partition_levels;
+  std::vector<Subtree> subtrees;
+  if (!DecodeInternalLevelOrder(
+          num_points_, root, root, 0,
+          decode_subtrees ? partition_levels : max_decoded_levels_,
+          decode_subtrees ? &subtrees : nullptr, oit)) {
     return false;
   }
+  EndDecoding();
 
-  if (!DecodeInternal(num_points_, oit)) {
+  uint64_t subtrees_size = 0;
+  if (!DecodeVarint(&subtrees_size, buffer) ||
+      subtrees_size > static_cast<uint64_t>(buffer->remaining_size())) {
     return false;
   }
-
-  numbers_decoder_.EndDecoding();
-  remaining_bits_decoder_.EndDecoding();
-  axis_decoder_.EndDecoding();
-  half_decoder_.EndDecoding();
-
+  if (!decode_subtrees) {
+    buffer->Advance(subtrees_size);
+    return true;
+  }
+  for (const Subtree &subtree : subtrees) {
+    if (!StartDecoding(buffer)) {
+      return false;
+    }
+    if (level_order_) {
+      if (!DecodeInternalLevelOrder(subtree.num_points, subtree.base,
+                                    subtree.levels, subtree.last_axis,
+                                    max_decoded_levels_ - partition_levels,
+                                    nullptr, oit)) {
+        return false;
+      }
+    } else if (!DecodeInternal(subtree.num_points, subtree.base,
+                               subtree.levels, subtree.last_axis, oit)) {
+      return false;
+    }
+    EndDecoding();
+  }
   return true;
 }
 
@@ -250,18 +390,20 @@ uint32_t DynamicIntegerPointsKdTreeDecoder<compression_level_t>::GetAxis(
 template <int compression_level_t>
 template <class OutputIteratorT>
 bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
-    uint32_t num_points, OutputIteratorT &oit) {
+    uint32_t num_points, const VectorUint32 &base,
+    const VectorUint32 &root_levels, uint32_t last_axis, OutputIteratorT &oit) {
   typedef DecodingStatus Status;
-  base_stack_[0] = VectorUint32(dimension_, 0);
-  levels_stack_[0] = VectorUint32(dimension_, 0);
-  DecodingStatus init_status(num_points, 0, 0);
-  std::stack<Status> status_stack;
-  status_stack.push(init_status);
+  base_stack_[0] = base;
+  levels_stack_[0] = root_levels;
+  // The stack never holds more nodes than there are levels in the tree (see
+  // DynamicIntegerPointsKdTreeEncoder::EncodeInternal()).
+  std::vector<Status> status_stack;
+  status_stack.reserve(base_stack_.size() + 1);
+  status_stack.push_back(DecodingStatus(num_points, last_axis, 0));
 
-  // TODO(b/199760123): Use preallocated vector instead of stack.
   while (!status_stack.empty()) {
-    const DecodingStatus status = status_stack.top();
-    status_stack.pop();
+    const DecodingStatus status = status_stack.back();
+    status_stack.pop_back();
 
     const uint32_t num_remaining_points = status.num_remaining_points;
     const uint32_t last_axis = status.last_axis;
@@ -294,27 +436,9 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
 
     // Fast decoding of remaining bits if number of points is 1 or 2.
     if (num_remaining_points <= 2) {
-      // TODO(b/199760123): |axes_| not necessary, remove would change
-      // bitstream!
-      axes_[0] = axis;
-      for (uint32_t i = 1; i < dimension_; i++) {
-        axes_[i] = DRACO_INCREMENT_MOD(axes_[i - 1], dimension_);
-      }
-      for (uint32_t i = 0; i < num_remaining_points; ++i) {
-        for (uint32_t j = 0; j < dimension_; j++) {
-          p_[axes_[j]] = 0;
-          const uint32_t num_remaining_bits = bit_length_ - levels[axes_[j]];
-          if (num_remaining_bits) {
-            if (!remaining_bits_decoder_.DecodeLeastSignificantBits32(
-                    num_remaining_bits, &p_[axes_[j]])) {
-              return false;
-            }
-          }
-          p_[axes_[j]] = old_base[axes_[j]] | p_[axes_[j]];
-        }
-        *oit = p_;
-        ++oit;
-        ++num_decoded_points_;
+      if (!DecodeRemainingBits(num_remaining_points, old_base, levels, axis,
+                               oit)) {
+        return false;
       }
       continue;
     }
@@ -350,11 +474,167 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
     levels_stack_[stack_pos][axis] += 1;
     levels_stack_[stack_pos + 1] = levels_stack_[stack_pos];  // copy
     if (first_half) {
-      status_stack.push(DecodingStatus(first_half, axis, stack_pos));
+      status_stack.push_back(DecodingStatus(first_half, axis, stack_pos));
     }
     if (second_half) {
-      status_stack.push(DecodingStatus(second_half, axis, stack_pos + 1));
+      status_stack.push_back(DecodingStatus(second_half, axis, stack_pos + 1));
+    }
+  }
+  return true;
+}
+
+template <int compression_level_t>
+template <class OutputIteratorT>
+bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::
+    DecodeRemainingBits(uint32_t num_remaining_points,
+                        const VectorUint32 &base, const VectorUint32 &levels,
+                        uint32_t axis, OutputIteratorT &oit) {
+  // TODO(b/199760123): |axes_| not necessary, remove would change
+  // bitstream!
+  axes_[0] = axis;
+  for (uint32_t i = 1; i < dimension_; i++) {
+    axes_[i] = DRACO_INCREMENT_MOD(axes_[i - 1], dimension_);
+  }
+  for (uint32_t i = 0; i < num_remaining_points; ++i) {
+    for (uint32_t j = 0; j < dimension_; j++) {
+      p_[axes_[j]] = 0;
+      const uint32_t num_remaining_bits = bit_length_ - levels[axes_[j]];
+      if (num_remaining_bits) {
+        if (!remaining_bits_decoder_.DecodeLeastSignificantBits32(
+                num_remaining_bits, &p_[axes_[j]])) {
+          return false;
+        }
+      }
+      p_[axes_[j]] = base[axes_[j]] | p_[axes_[j]];
+    }
+    *oit = p_;
+    ++oit;
+    ++num_decoded_points_;
+  }
+  return true;
+}
+
+template <int compression_level_t>
+template <class OutputIteratorT>
+bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::
+    DecodeInternalLevelOrder(uint32_t num_points, const VectorUint32 &base,
+                             const VectorUint32 &root_levels,
+                             uint32_t last_axis, uint32_t max_levels,
+                             std::vector<Subtree> *subtrees,
+                             OutputIteratorT &oit) {
+  typedef LevelOrderStatus Status;
+
+  // Nodes of the current and the next level of the tree. Bases and levels of
+  // all nodes are stored in flat arrays with |dimension_| entries per node.
+  std::vector<Status> nodes(1, Status(num_points, last_axis));
+  VectorUint32 bases = base;
+  VectorUint32 node_levels = root_levels;
+  std::vector<Status> next_nodes;
+  VectorUint32 next_bases;
+  VectorUint32 next_node_levels;
+  VectorUint32 old_base(dimension_);
+  VectorUint32 levels(dimension_);
+
+  for (uint32_t depth = 0; !nodes.empty(); ++depth) {
+    if (depth == max_levels && subtrees != nullptr) {
+      for (size_t n = 0; n < nodes.size(); ++n) {
+        Subtree subtree;
+        subtree.num_points = nodes[n].num_remaining_points;
+        subtree.last_axis = nodes[n].last_axis;
+        subtree.base.assign(bases.begin() + n * dimension_,
+                            bases.begin() + (n + 1) * dimension_);
+        subtree.levels.assign(node_levels.begin() + n * dimension_,
+                              node_levels.begin() + (n + 1) * dimension_);
+        subtrees->push_back(subtree);
+      }
+      return true;
+    }
+    if (depth == max_levels) {
+      // Output the base of each remaining node.
+      for (size_t n = 0; n < nodes.size(); ++n) {
+        std::copy(bases.begin() + n * dimension_,
+                  bases.begin() + (n + 1) * dimension_, p_.begin());
+        *oit = p_;
+        ++oit;
+        ++num_decoded_points_;
+      }
+      return true;
+    }
+    next_nodes.clear();
+    next_bases.clear();
+    next_node_levels.clear();
+    for (size_t n = 0; n < nodes.size(); ++n) {
+      const Status &status = nodes[n];
+      const uint32_t num_remaining_points = status.num_remaining_points;
+      std::copy(bases.begin() + n * dimension_,
+                bases.begin() + (n + 1) * dimension_, old_base.begin());
+      std::copy(node_levels.begin() + n * dimension_,
+                node_levels.begin() + (n + 1) * dimension_, levels.begin());
+
+      const uint32_t axis =
+          GetAxis(num_remaining_points, levels, status.last_axis);
+      if (axis >= dimension_) {
+        return false;
+      }
+      const uint32_t level = levels[axis];
+
+      // All axes have been fully subdivided, just output points.
+      if ((bit_length_ - level) == 0) {
+        for (uint32_t i = 0; i < num_remaining_points; i++) {
+          *oit = old_base;
+          ++oit;
+          ++num_decoded_points_;
+        }
+        continue;
+      }
+
+      if (num_remaining_points <= 2) {
+        if (!DecodeRemainingBits(num_remaining_points, old_base, levels, axis,
+                                 oit)) {
+          return false;
+        }
+        continue;
+      }
+
+      const int num_remaining_bits = bit_length_ - level;
+      const uint32_t modifier = 1 << (num_remaining_bits - 1);
+      const int incoming_bits = MostSignificantBit(num_remaining_points);
+
+      uint32_t number = 0;
+      DecodeNumber(incoming_bits, &number);
+
+      uint32_t first_half = num_remaining_points / 2;
+      if (first_half < number) {
+        // Invalid |number|.
+        return false;
+      }
+      first_half -= number;
+      uint32_t second_half = num_remaining_points - first_half;
+
+      if (first_half != second_half) {
+        if (!half_decoder_.DecodeNextBit()) {
+          std::swap(first_half, second_half);
+        }
+      }
+
+      levels[axis] += 1;
+      if (first_half) {
+        next_nodes.push_back(Status(first_half, axis));
+        next_bases.insert(next_bases.end(), old_base.begin(), old_base.end());
+        next_node_levels.insert(next_node_levels.end(), levels.begin(),
+                                levels.end());
+      }
+      if (second_half) {
+        next_nodes.push_back(Status(second_half, axis));
+        old_base[axis] += modifier;
+        next_bases.insert(next_bases.end(), old_base.begin(), old_base.end());
+        next_node_levels.insert(next_node_levels.end(), levels.begin(),
+                                levels.end());
+      }
     }
+    nodes.swap(next_nodes);
+    bases.swap(next_bases);
+    node_levels.swap(next_node_levels);
   }
   return true;
 }
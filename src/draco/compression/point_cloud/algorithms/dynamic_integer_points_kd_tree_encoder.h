@@ -17,8 +17,8 @@
 
 #include <algorithm>
 #include <array>
+#include <limits>
 #include <memory>
-#include <stack>
 #include <vector>
 
 #include "draco/compression/bit_coders/adaptive_rans_bit_encoder.h"
@@ -29,9 +29,25 @@
 #include "draco/core/bit_utils.h"
 #include "draco/core/encoder_buffer.h"
 #include "draco/core/math_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/varint_encoding.h"
 
 namespace draco {
 
+// Reorders the points in [begin, end) so that all points whose |axis|
+// coordinate is less than |value| precede the remaining points. Returns the
+// first point of the second group. Iterators of containers with specialized
+// partition kernels such as PointDVector provide overloads that are found by
+// argument-dependent lookup and may use |pool|.
+template <class RandomAccessIteratorT>
+RandomAccessIteratorT PartitionPoints(RandomAccessIteratorT begin,
+                                      RandomAccessIteratorT end, uint32_t axis,
+                                      uint32_t value, ThreadPool * /* pool */) {
+  return std::partition(begin, end, [axis, value](const auto &point) {
+    return point[axis] < value;
+  });
+}
+
 // This policy class provides several configurations for the encoder that allow
 // to trade speed vs compression rate. Level 0 is fastest while 6 is the best
 // compression rate. The decoder must select the same level.
@@ -85,6 +101,22 @@ struct DynamicIntegerPointsKdTreeEncoderCompressionPolicy<6>
 // in the smaller half of the two. This results in a better compression rate as
 // there are more leading zeros, which is then compressed better by the
 // arithmetic encoding.
+//
+// By default the tree is encoded depth first. When level order is enabled
+// with set_level_order(), the tree is encoded breadth first so that the
+// decoder can stop after any number of levels and output a uniformly
+// subsampled point cloud (see DynamicIntegerPointsKdTreeDecoder). The decoder
+// must use the same order.
+//
+// When partitioning is enabled with set_partition_levels(), the first levels
+// of the tree are encoded breadth first and each subtree below them is encoded
+// into its own set of bit streams. The subtrees are encoded on the thread pool
+// set with set_thread_pool(), if any, and their streams are stored in a fixed
+// order, so the output does not depend on the number of threads. Each subtree
+// adds the small header of its streams to the encoded data. The subtrees are
+// preceded by their total size, so decoders of a subsampled point cloud that
+// do not need them can skip them. The decoder must
+// be told that the tree is partitioned.
 template <int compression_level_t>
 class DynamicIntegerPointsKdTreeEncoder {
   static_assert(compression_level_t >= 0, "Compression level must in [0..6].");
@@ -102,6 +134,9 @@ class DynamicIntegerPointsKdTreeEncoder {
   explicit DynamicIntegerPointsKdTreeEncoder(uint32_t dimension)
       : bit_length_(0),
         dimension_(dimension),
+        level_order_(false),
+        partition_levels_(0),
+        thread_pool_(nullptr),
         deviations_(dimension, 0),
         num_remaining_bits_(dimension, 0),
         axes_(dimension, 0),
@@ -123,27 +158,80 @@ class DynamicIntegerPointsKdTreeEncoder {
 
   const uint32_t dimension() const { return dimension_; }
 
+  // Sets whether the tree is encoded in level order (breadth first).
+  void set_level_order(bool level_order) { level_order_ = level_order; }
+  bool level_order() const { return level_order_; }
+
+  // Sets the number of levels of the tree above the independently encoded
+  // subtrees. Zero disables partitioning. At most 2^|num_levels| subtrees are
+  // created.
+  void set_partition_levels(uint8_t num_levels) {
+    partition_levels_ = num_levels;
+  }
+  uint8_t partition_levels() const { return partition_levels_; }
+
+  // Sets the thread pool used for encoding of the subtrees.
+  void set_thread_pool(ThreadPool *pool) { thread_pool_ = pool; }
+
  private:
+  // Subtree that is encoded into its own bit streams.
+  template <class RandomAccessIteratorT>
+  struct Subtree {
+    Subtree(RandomAccessIteratorT begin_, RandomAccessIteratorT end_,
+            uint32_t last_axis_)
+        : begin(begin_), end(end_), last_axis(last_axis_) {}
+
+    RandomAccessIteratorT begin;
+    RandomAccessIteratorT end;
+    uint32_t last_axis;
+    VectorUint32 base;
+    VectorUint32 levels;
+  };
+
   template <class RandomAccessIteratorT>
   uint32_t GetAndEncodeAxis(RandomAccessIteratorT begin,
                             RandomAccessIteratorT end,
                             const VectorUint32 &old_base,
                             const VectorUint32 &levels, uint32_t last_axis);
+  // Encodes the tree rooted in the node [begin, end) with |base| and |levels|
+  // depth first.
   template <class RandomAccessIteratorT>
-  void EncodeInternal(RandomAccessIteratorT begin, RandomAccessIteratorT end);
-
-  class Splitter {
-   public:
-    Splitter(uint32_t axis, uint32_t value) : axis_(axis), value_(value) {}
-    template <class PointT>
-    bool operator()(const PointT &a) const {
-      return a[axis_] < value_;
-    }
+  void EncodeInternal(RandomAccessIteratorT begin, RandomAccessIteratorT end,
+                      const VectorUint32 &base, const VectorUint32 &levels,
+                      uint32_t last_axis);
+  // Encodes the tree rooted in the node [begin, end) with |base| and |levels|
+  // breadth first. Nodes below |max_levels| levels are not encoded but
+  // appended to |subtrees|.
+  template <class RandomAccessIteratorT>
+  void EncodeInternalLevelOrder(
+      RandomAccessIteratorT begin, RandomAccessIteratorT end,
+      const VectorUint32 &base, const VectorUint32 &levels,
+      uint32_t last_axis, uint32_t max_levels,
+      std::vector<Subtree<RandomAccessIteratorT>> *subtrees);
+  // Encodes |subtree| into |buffer| using its own bit streams.
+  template <class RandomAccessIteratorT>
+  void EncodeSubtree(const Subtree<RandomAccessIteratorT> &subtree,
+                     EncoderBuffer *buffer);
+
+  void StartEncoding() {
+    numbers_encoder_.StartEncoding();
+    remaining_bits_encoder_.StartEncoding();
+    axis_encoder_.StartEncoding();
+    half_encoder_.StartEncoding();
+  }
+  void EndEncoding(EncoderBuffer *buffer) {
+    numbers_encoder_.EndEncoding(buffer);
+    remaining_bits_encoder_.EndEncoding(buffer);
+    axis_encoder_.EndEncoding(buffer);
+    half_encoder_.EndEncoding(buffer);
+  }
 
-   private:
-    const uint32_t axis_;
-    const uint32_t value_;
-  };
+  // Encodes the remaining bits of up to two points in [begin, end) that are
+  // not defined by |levels|, starting with |axis|.
+  template <class RandomAccessIteratorT>
+  void EncodeRemainingBits(RandomAccessIteratorT begin,
+                           RandomAccessIteratorT end,
+                           const VectorUint32 &levels, uint32_t axis);
 
   void EncodeNumber(int nbits, uint32_t value) {
     numbers_encoder_.EncodeLeastSignificantBits32(nbits, value);
@@ -167,9 +255,25 @@ class DynamicIntegerPointsKdTreeEncoder {
     uint32_t stack_pos;  // used to get base and levels
   };
 
+  // Node of the tree used by the level order encoding. Base and levels of the
+  // node are stored separately.
+  template <class RandomAccessIteratorT>
+  struct LevelOrderStatus {
+    LevelOrderStatus(RandomAccessIteratorT begin_, RandomAccessIteratorT end_,
+                     uint32_t last_axis_)
+        : begin(begin_), end(end_), last_axis(last_axis_) {}
+
+    RandomAccessIteratorT begin;
+    RandomAccessIteratorT end;
+    uint32_t last_axis;
+  };
+
   uint32_t bit_length_;
   uint32_t num_points_;
   uint32_t dimension_;
+  bool level_order_;
+  uint8_t partition_levels_;
+  ThreadPool *thread_pool_;
   NumbersEncoder numbers_encoder_;
   RemainingBitsEncoder remaining_bits_encoder_;
   AxisEncoder axis_encoder_;
@@ -191,24 +295,69 @@ bool DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodePoints(
 
   buffer->Encode(bit_length_);
   buffer->Encode(num_points_);
+  if (partition_levels_ > 0) {
+    buffer->Encode(partition_levels_);
+  }
   if (num_points_ == 0) {
     return true;
   }
 
-  numbers_encoder_.StartEncoding();
-  remaining_bits_encoder_.StartEncoding();
-  axis_encoder_.StartEncoding();
-  half_encoder_.StartEncoding();
-
-  EncodeInternal(begin, end);
-
-  numbers_encoder_.EndEncoding(buffer);
-  remaining_bits_encoder_.EndEncoding(buffer);
-  axis_encoder_.EndEncoding(buffer);
-  half_encoder_.EndEncoding(buffer);
+  StartEncoding();
+  const VectorUint32 root(dimension_, 0);
+  if (partition_levels_ > 0) {
+    std::vector<Subtree<RandomAccessIteratorT>> subtrees;
+    EncodeInternalLevelOrder(begin, end, root, root, 0, partition_levels_,
+                             &subtrees);
+    EndEncoding(buffer);
+
+    const int num_subtrees = static_cast<int>(subtrees.size());
+    std::vector<EncoderBuffer> subtree_buffers(num_subtrees);
+    ParallelFor(thread_pool_, num_subtrees, [&](int i) {
+      EncodeSubtree(subtrees[i], &subtree_buffers[i]);
+    });
+    // The total size lets decoders skip the subtrees.
+    uint64_t subtrees_size = 0;
+    for (int i = 0; i < num_subtrees; ++i) {
+      subtrees_size += subtree_buffers[i].size();
+    }
+    EncodeVarint(subtrees_size, buffer);
+    for (int i = 0; i < num_subtrees; ++i) {
+      buffer->Encode(subtree_buffers[i].data(), subtree_buffers[i].size());
+    }
+    return true;
+  }
 
+  if (level_order_) {
+    EncodeInternalLevelOrder<RandomAccessIteratorT>(
+        begin, end, root, root, 0, std::numeric_limits<uint32_t>::max(),
+        nullptr);
+  } else {
+    EncodeInternal(begin, end, root, root, 0);
+  }
+  EndEncoding(buffer);
   return true;
 }
+
+template <int compression_level_t>
+template <class RandomAccessIteratorT>
+void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodeSubtree(
+    const Subtree<RandomAccessIteratorT> &subtree, EncoderBuffer *buffer) {
+  // Each subtree uses a separate encoder so that subtrees can be encoded in
+  // parallel.
+  DynamicIntegerPointsKdTreeEncoder<compression_level_t> encoder(dimension_);
+  encoder.bit_length_ = bit_length_;
+  encoder.num_points_ = static_cast<uint32_t>(subtree.end - subtree.begin);
+  encoder.StartEncoding();
+  if (level_order_) {
+    encoder.EncodeInternalLevelOrder<RandomAccessIteratorT>(
+        subtree.begin, subtree.end, subtree.base, subtree.levels,
+        subtree.last_axis, std::numeric_limits<uint32_t>::max(), nullptr);
+  } else {
+    encoder.EncodeInternal(subtree.begin, subtree.end, subtree.base,
+                           subtree.levels, subtree.last_axis);
+  }
+  encoder.EndEncoding(buffer);
+}
 template <int compression_level_t>
 template <class RandomAccessIteratorT>
 uint32_t
@@ -271,19 +420,22 @@ DynamicIntegerPointsKdTreeEncoder<compression_level_t>::GetAndEncodeAxis(
 template <int compression_level_t>
 template <class RandomAccessIteratorT>
 void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodeInternal(
-    RandomAccessIteratorT begin, RandomAccessIteratorT end) {
+    RandomAccessIteratorT begin, RandomAccessIteratorT end,
+    const VectorUint32 &base, const VectorUint32 &levels, uint32_t last_axis) {
   typedef EncodingStatus<RandomAccessIteratorT> Status;
 
-  base_stack_[0] = VectorUint32(dimension_, 0);
-  levels_stack_[0] = VectorUint32(dimension_, 0);
-  Status init_status(begin, end, 0, 0);
-  std::stack<Status> status_stack;
-  status_stack.push(init_status);
+  base_stack_[0] = base;
+  levels_stack_[0] = levels;
+  // Each node pushes at most two children and the last one is popped right
+  // away, so the stack never holds more nodes than there are levels in the
+  // tree.
+  std::vector<Status> status_stack;
+  status_stack.reserve(base_stack_.size() + 1);
+  status_stack.push_back(Status(begin, end, last_axis, 0));
 
-  // TODO(b/199760123): Use preallocated vector instead of stack.
   while (!status_stack.empty()) {
-    Status status = status_stack.top();
-    status_stack.pop();
+    const Status status = status_stack.back();
+    status_stack.pop_back();
 
     begin = status.begin;
     end = status.end;
@@ -305,22 +457,7 @@ void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodeInternal(
     // Fast encoding of remaining bits if number of points is 1 or 2.
     // Doing this also for 2 gives a slight additional speed up.
     if (num_remaining_points <= 2) {
-      // TODO(b/199760123): |axes_| not necessary, remove would change
-      // bitstream!
-      axes_[0] = axis;
-      for (uint32_t i = 1; i < dimension_; i++) {
-        axes_[i] = DRACO_INCREMENT_MOD(axes_[i - 1], dimension_);
-      }
-      for (uint32_t i = 0; i < num_remaining_points; ++i) {
-        const auto &p = *(begin + i);
-        for (uint32_t j = 0; j < dimension_; j++) {
-          const uint32_t num_remaining_bits = bit_length_ - levels[axes_[j]];
-          if (num_remaining_bits) {
-            remaining_bits_encoder_.EncodeLeastSignificantBits32(
-                num_remaining_bits, p[axes_[j]]);
-          }
-        }
-      }
+      EncodeRemainingBits(begin, end, levels, axis);
       continue;
     }
 
@@ -330,8 +467,8 @@ void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodeInternal(
     base_stack_[stack_pos + 1][axis] += modifier;
     const VectorUint32 &new_base = base_stack_[stack_pos + 1];
 
-    const RandomAccessIteratorT split =
-        std::partition(begin, end, Splitter(axis, new_base[axis]));
+    const RandomAccessIteratorT split = PartitionPoints(
+        begin, end, axis, new_base[axis], thread_pool_);
 
     DRACO_DCHECK_EQ(true, (end - begin) > 0);
 
@@ -355,13 +492,138 @@ void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodeInternal(
     levels_stack_[stack_pos][axis] += 1;
     levels_stack_[stack_pos + 1] = levels_stack_[stack_pos];  // copy
     if (split != begin) {
-      status_stack.push(Status(begin, split, axis, stack_pos));
+      status_stack.push_back(Status(begin, split, axis, stack_pos));
     }
     if (split != end) {
-      status_stack.push(Status(split, end, axis, stack_pos + 1));
+      status_stack.push_back(Status(split, end, axis, stack_pos + 1));
+    }
+  }
+}
+template <int compression_level_t>
+template <class RandomAccessIteratorT>
+void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::
+    EncodeRemainingBits(RandomAccessIteratorT begin, RandomAccessIteratorT end,
+                        const VectorUint32 &levels, uint32_t axis) {
+  // TODO(b/199760123): |axes_| not necessary, remove would change
+  // bitstream!
+  axes_[0] = axis;
+  for (uint32_t i = 1; i < dimension_; i++) {
+    axes_[i] = DRACO_INCREMENT_MOD(axes_[i - 1], dimension_);
+  }
+  for (auto it = begin; it != end; ++it) {
+    const auto &p = *it;
+    for (uint32_t j = 0; j < dimension_; j++) {
+      const uint32_t num_remaining_bits = bit_length_ - levels[axes_[j]];
+      if (num_remaining_bits) {
+        remaining_bits_encoder_.EncodeLeastSignificantBits32(
+            num_remaining_bits, p[axes_[j]]);
+      }
     }
   }
 }
+
+template <int compression_level_t>
+template <class RandomAccessIteratorT>
+void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::
+    EncodeInternalLevelOrder(
+        RandomAccessIteratorT begin, RandomAccessIteratorT end,
+        const VectorUint32 &base, const VectorUint32 &root_levels,
+        uint32_t last_axis, uint32_t max_levels,
+        std::vector<Subtree<RandomAccessIteratorT>> *subtrees) {
+  typedef LevelOrderStatus<RandomAccessIteratorT> Status;
+
+  // Nodes of the current and the next level of the tree. Bases and levels of
+  // all nodes are stored in flat arrays with |dimension_| entries per node.
+  std::vector<Status> nodes(1, Status(begin, end, last_axis));
+  VectorUint32 bases = base;
+  VectorUint32 node_levels = root_levels;
+  std::vector<Status> next_nodes;
+  VectorUint32 next_bases;
+  VectorUint32 next_node_levels;
+  VectorUint32 old_base(dimension_);
+  VectorUint32 levels(dimension_);
+
+  for (uint32_t depth = 0; !nodes.empty(); ++depth) {
+    if (depth == max_levels) {
+      for (size_t n = 0; n < nodes.size(); ++n) {
+        Subtree<RandomAccessIteratorT> subtree(nodes[n].begin, nodes[n].end,
+                                               nodes[n].last_axis);
+        subtree.base.assign(bases.begin() + n * dimension_,
+                            bases.begin() + (n + 1) * dimension_);
+        subtree.levels.assign(node_levels.begin() + n * dimension_,
+                              node_levels.begin() + (n + 1) * dimension_);
+        subtrees->push_back(subtree);
+      }
+      return;
+    }
+    next_nodes.clear();
+    next_bases.clear();
+    next_node_levels.clear();
+    for (size_t n = 0; n < nodes.size(); ++n) {
+      const Status &status = nodes[n];
+      begin = status.begin;
+      end = status.end;
+      std::copy(bases.begin() + n * dimension_,
+                bases.begin() + (n + 1) * dimension_, old_base.begin());
+      std::copy(node_levels.begin() + n * dimension_,
+                node_levels.begin() + (n + 1) * dimension_, levels.begin());
+
+      const uint32_t axis =
+          GetAndEncodeAxis(begin, end, old_base, levels, status.last_axis);
+      const uint32_t level = levels[axis];
+      const uint32_t num_remaining_points = static_cast<uint32_t>(end - begin);
+
+      // If this happens all axis are subdivided to the end.
+      if ((bit_length_ - level) == 0) {
+        continue;
+      }
+
+      if (num_remaining_points <= 2) {
+        EncodeRemainingBits(begin, end, levels, axis);
+        continue;
+      }
+
+      const uint32_t num_remaining_bits = bit_length_ - level;
+      const uint32_t modifier = 1 << (num_remaining_bits - 1);
+      const uint32_t split_value = old_base[axis] + modifier;
+      const RandomAccessIteratorT split =
+          PartitionPoints(begin, end, axis, split_value, thread_pool_);
+
+      // Encode number of points in first and second half.
+      const int required_bits = MostSignificantBit(num_remaining_points);
+      const uint32_t first_half = static_cast<uint32_t>(split - begin);
+      const uint32_t second_half = static_cast<uint32_t>(end - split);
+      const bool left = first_half < second_half;
+      if (first_half != second_half) {
+        half_encoder_.EncodeBit(left);
+      }
+      if (left) {
+        EncodeNumber(required_bits, num_remaining_points / 2 - first_half);
+      } else {
+        EncodeNumber(required_bits, num_remaining_points / 2 - second_half);
+      }
+
+      levels[axis] += 1;
+      if (split != begin) {
+        next_nodes.push_back(Status(begin, split, axis));
+        next_bases.insert(next_bases.end(), old_base.begin(), old_base.end());
+        next_node_levels.insert(next_node_levels.end(), levels.begin(),
+                                levels.end());
+      }
+      if (split != end) {
+        next_nodes.push_back(Status(split, end, axis));
+        old_base[axis] = split_value;
+        next_bases.insert(next_bases.end(), old_base.begin(), old_base.end());
+        next_node_levels.insert(next_node_levels.end(), levels.begin(),
+                                levels.end());
+      }
+    }
+    nodes.swap(next_nodes);
+    bases.swap(next_bases);
+    node_levels.swap(next_node_levels);
+  }
+}
+
 extern template class DynamicIntegerPointsKdTreeEncoder<0>;
 extern template class DynamicIntegerPointsKdTreeEncoder<2>;
 extern template class DynamicIntegerPointsKdTreeEncoder<4>;
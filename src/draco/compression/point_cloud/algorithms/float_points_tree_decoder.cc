@@ -62,7 +62,10 @@ class ConversionOutputIterator {
 };
 
 FloatPointsTreeDecoder::FloatPointsTreeDecoder()
-    : num_points_(0), compression_level_(0), num_points_from_header_(0) {
+    : num_points_(0),
+      compression_level_(0),
+      num_points_from_header_(0),
+      thread_pool_(nullptr) {
   qinfo_.quantization_bits = 0;
   qinfo_.range = 0;
 }
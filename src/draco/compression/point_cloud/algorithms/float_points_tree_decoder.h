@@ -16,12 +16,14 @@
 #define DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_FLOAT_POINTS_TREE_DECODER_H_
 
 #include <memory>
+#include <vector>
 
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/point_cloud/algorithms/point_cloud_compression_method.h"
 #include "draco/compression/point_cloud/algorithms/point_cloud_types.h"
 #include "draco/compression/point_cloud/algorithms/quantize_points_3.h"
 #include "draco/core/decoder_buffer.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -70,6 +72,9 @@ class FloatPointsTreeDecoder {
     num_points_from_header_ = num_points;
   }
 
+  // Sets the thread pool used for the dequantization of the points.
+  void set_thread_pool(ThreadPool *pool) { thread_pool_ = pool; }
+
  private:
   bool DecodePointCloudKdTreeInternal(DecoderBuffer *buffer,
                                       std::vector<Point3ui> *qpoints);
@@ -84,6 +89,8 @@ class FloatPointsTreeDecoder {
   // matches the number of points in the compression header. If
   // |num_points_from_header_| is 0, do not perform the check. Defaults to 0.
   uint32_t num_points_from_header_;
+
+  ThreadPool *thread_pool_;
 };
 
 #ifndef DRACO_OLD_GCC
@@ -132,7 +139,13 @@ bool FloatPointsTreeDecoder::DecodePointCloud(DecoderBuffer *buffer,
     return false;
   }
 
-  DequantizePoints3(qpoints.begin(), qpoints.end(), qinfo_, out);
+  std::vector<Point3f> points(qpoints.size());
+  DequantizePoints3(qpoints.data(), static_cast<int>(qpoints.size()), qinfo_,
+                    points.data(), thread_pool_);
+  for (const Point3f &point : points) {
+    *out = point;
+    ++out;
+  }
   return true;
 }
 
@@ -26,7 +26,10 @@ const uint32_t FloatPointsTreeEncoder::version_ = 3;
 
 FloatPointsTreeEncoder::FloatPointsTreeEncoder(
     PointCloudCompressionMethod method)
-    : method_(method), num_points_(0), compression_level_(6) {
+    : method_(method),
+      num_points_(0),
+      compression_level_(6),
+      thread_pool_(nullptr) {
   qinfo_.quantization_bits = 16;
   qinfo_.range = 0;
 }
@@ -34,7 +37,10 @@ FloatPointsTreeEncoder::FloatPointsTreeEncoder(
 FloatPointsTreeEncoder::FloatPointsTreeEncoder(
     PointCloudCompressionMethod method, uint32_t quantization_bits,
     uint32_t compression_level)
-    : method_(method), num_points_(0), compression_level_(compression_level) {
+    : method_(method),
+      num_points_(0),
+      compression_level_(compression_level),
+      thread_pool_(nullptr) {
   DRACO_DCHECK_LE(compression_level_, 6);
   qinfo_.quantization_bits = quantization_bits;
   qinfo_.range = 0;
@@ -46,42 +52,49 @@ bool FloatPointsTreeEncoder::EncodePointCloudKdTreeInternal(
   switch (compression_level_) {
     case 0: {
       DynamicIntegerPointsKdTreeEncoder<0> qpoints_encoder(3);
+      qpoints_encoder.set_thread_pool(thread_pool_);
       qpoints_encoder.EncodePoints(qpoints->begin(), qpoints->end(),
                                    qinfo_.quantization_bits + 1, &buffer_);
       break;
     }
     case 1: {
       DynamicIntegerPointsKdTreeEncoder<1> qpoints_encoder(3);
+      qpoints_encoder.set_thread_pool(thread_pool_);
       qpoints_encoder.EncodePoints(qpoints->begin(), qpoints->end(),
                                    qinfo_.quantization_bits + 1, &buffer_);
       break;
     }
     case 2: {
       DynamicIntegerPointsKdTreeEncoder<2> qpoints_encoder(3);
+      qpoints_encoder.set_thread_pool(thread_pool_);
       qpoints_encoder.EncodePoints(qpoints->begin(), qpoints->end(),
                                    qinfo_.quantization_bits + 1, &buffer_);
       break;
     }
     case 3: {
       DynamicIntegerPointsKdTreeEncoder<3> qpoints_encoder(3);
+      qpoints_encoder.set_thread_pool(thread_pool_);
       qpoints_encoder.EncodePoints(qpoints->begin(), qpoints->end(),
                                    qinfo_.quantization_bits + 1, &buffer_);
       break;
     }
     case 4: {
       DynamicIntegerPointsKdTreeEncoder<4> qpoints_encoder(3);
+      qpoints_encoder.set_thread_pool(thread_pool_);
       qpoints_encoder.EncodePoints(qpoints->begin(), qpoints->end(),
                                    qinfo_.quantization_bits + 1, &buffer_);
       break;
     }
     case 5: {
       DynamicIntegerPointsKdTreeEncoder<5> qpoints_encoder(3);
+      qpoints_encoder.set_thread_pool(thread_pool_);
       qpoints_encoder.EncodePoints(qpoints->begin(), qpoints->end(),
                                    qinfo_.quantization_bits + 1, &buffer_);
       break;
     }
     default: {
       DynamicIntegerPointsKdTreeEncoder<6> qpoints_encoder(3);
+      qpoints_encoder.set_thread_pool(thread_pool_);
       qpoints_encoder.EncodePoints(qpoints->begin(), qpoints->end(),
                                    qinfo_.quantization_bits + 1, &buffer_);
       break;
@@ -22,6 +22,7 @@
 #include "draco/compression/point_cloud/algorithms/point_cloud_types.h"
 #include "draco/compression/point_cloud/algorithms/quantize_points_3.h"
 #include "draco/core/encoder_buffer.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -63,6 +64,10 @@ class FloatPointsTreeEncoder {
   uint32_t &compression_level() { return compression_level_; }
   float range() const { return qinfo_.range; }
   uint32_t num_points() const { return num_points_; }
+
+  // Sets the thread pool used for the quantization and encoding of the points.
+  void set_thread_pool(ThreadPool *pool) { thread_pool_ = pool; }
+
   std::string identification_string() const {
     if (method_ == KDTREE) {
       return "FloatPointsTreeEncoder: IntegerPointsKDTreeEncoder";
@@ -81,6 +86,7 @@ class FloatPointsTreeEncoder {
   uint32_t num_points_;
   EncoderBuffer buffer_;
   uint32_t compression_level_;
+  ThreadPool *thread_pool_;
 };
 
 template <class InputIteratorT>
@@ -92,11 +98,16 @@ bool FloatPointsTreeEncoder::EncodePointCloud(InputIteratorT points_begin,
   num_points_ = std::distance(points_begin, points_end);
 
   // TODO(b/199760123): Extend quantization tools to make this more automatic.
-  // Compute range of points for quantization
-  std::vector<Point3ui> qpoints;
-  qpoints.reserve(num_points_);
-  QuantizePoints3(points_begin, points_end, &qinfo_,
-                  std::back_inserter(qpoints));
+  // Gather the points so that their range and quantization can be computed on
+  // contiguous data.
+  std::vector<Point3f> points(num_points_);
+  auto point_it = points.begin();
+  for (auto it = points_begin; it != points_end; ++it, ++point_it) {
+    *point_it = Point3f((*it)[0], (*it)[1], (*it)[2]);
+  }
+  std::vector<Point3ui> qpoints(num_points_);
+  QuantizePoints3(points.data(), num_points_, &qinfo_, qpoints.data(),
+                  thread_pool_);
 
   // Encode header.
   buffer()->Encode(version_);
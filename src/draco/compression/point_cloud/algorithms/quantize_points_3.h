@@ -17,8 +17,13 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "draco/compression/point_cloud/algorithms/point_cloud_types.h"
 #include "draco/core/quantization_utils.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -79,6 +84,85 @@ void DequantizePoints3(const QPointIterator &begin, const QPointIterator &end,
   }
 }
 
+// Number of points processed by a single task of QuantizePoints3() and
+// DequantizePoints3() on contiguous points.
+constexpr int kQuantizePoints3ChunkSize = 1 << 14;
+
+static_assert(sizeof(Point3f) == 3 * sizeof(float) &&
+                  sizeof(Point3ui) == 3 * sizeof(uint32_t),
+              "Contiguous points must be arrays of point components.");
+
+// Same as the iterator version above for |num_points| contiguous points. The
+// range and the quantized values are computed in parallel on |pool| when it
+// is set, and the values are quantized with the SIMD kernels of Quantizer.
+// The output is identical to the output of the iterator version.
+inline void QuantizePoints3(const Point3f *points, int num_points,
+                            QuantizationInfo *info, Point3ui *out,
+                            ThreadPool *pool) {
+  DRACO_DCHECK_GE(info->quantization_bits, 0);
+  const int num_chunks =
+      (num_points + kQuantizePoints3ChunkSize - 1) / kQuantizePoints3ChunkSize;
+
+  std::vector<float> chunk_ranges(num_chunks, 0.f);
+  ParallelFor(pool, num_chunks, [&](int c) {
+    const float *const values = points[c * kQuantizePoints3ChunkSize].data();
+    const int num_values =
+        3 * (std::min(num_points, (c + 1) * kQuantizePoints3ChunkSize) -
+             c * kQuantizePoints3ChunkSize);
+    float max_range = 0;
+    for (int i = 0; i < num_values; ++i) {
+      max_range = std::max(std::fabs(values[i]), max_range);
+    }
+    chunk_ranges[c] = max_range;
+  });
+  float max_range = 0;
+  for (int c = 0; c < num_chunks; ++c) {
+    max_range = std::max(chunk_ranges[c], max_range);
+  }
+
+  const uint32_t max_quantized_value((1u << info->quantization_bits) - 1);
+  Quantizer quantize;
+  quantize.Init(max_range, max_quantized_value);
+  info->range = max_range;
+
+  ParallelFor(pool, num_chunks, [&](int c) {
+    const int begin = c * kQuantizePoints3ChunkSize;
+    const int end = std::min(num_points, begin + kQuantizePoints3ChunkSize);
+    // Quantize and all positive.
+    quantize.QuantizeValues(points[begin].data(), 3 * (end - begin),
+                            max_quantized_value,
+                            reinterpret_cast<int32_t *>(out[begin].data()));
+  });
+}
+
+// Same as the iterator version above for |num_points| contiguous points. The
+// values are dequantized in parallel on |pool| when it is set.
+inline void DequantizePoints3(const Point3ui *qpoints, int num_points,
+                              const QuantizationInfo &info, Point3f *out,
+                              ThreadPool *pool) {
+  DRACO_DCHECK_GE(info.quantization_bits, 0);
+  DRACO_DCHECK_GE(info.range, 0);
+
+  const uint32_t max_quantized_value((1u << info.quantization_bits) - 1);
+  Dequantizer dequantize;
+  dequantize.Init(info.range, max_quantized_value);
+
+  const int num_chunks =
+      (num_points + kQuantizePoints3ChunkSize - 1) / kQuantizePoints3ChunkSize;
+  ParallelFor(pool, num_chunks, [&](int c) {
+    const int begin = c * kQuantizePoints3ChunkSize;
+    const int num_values =
+        3 * (std::min(num_points, begin + kQuantizePoints3ChunkSize) - begin);
+    const uint32_t *const in = qpoints[begin].data();
+    float *const out_values = out[begin].data();
+    // The loop over the flattened components is vectorized by the compiler.
+    for (int i = 0; i < num_values; ++i) {
+      out_values[i] =
+          dequantize(static_cast<int32_t>(in[i] - max_quantized_value));
+    }
+  });
+}
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_POINT_CLOUD_ALGORITHMS_QUANTIZE_POINTS_3_H_
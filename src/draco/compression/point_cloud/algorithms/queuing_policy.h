@@ -20,6 +20,7 @@
 #include <queue>
 #include <stack>
 #include <utility>
+#include <vector>
 
 namespace draco {
 
@@ -38,19 +39,23 @@ class Queue {
   std::queue<T> q_;
 };
 
+// Stack stored in a contiguous vector, which keeps the nodes that are waiting
+// to be processed close to each other in memory.
 template <class T>
 class Stack {
+  typedef std::stack<T, std::vector<T>> SType;
+
  public:
   bool empty() const { return s_.empty(); }
-  typename std::stack<T>::size_type size() const { return s_.size(); }
-  void clear() { return s_.clear(); }
+  typename SType::size_type size() const { return s_.size(); }
+  void clear() { s_ = SType(); }
   void push(const T &value) { s_.push(value); }
   void push(T &&value) { s_.push(std::move(value)); }
   void pop() { s_.pop(); }
-  typename std::stack<T>::const_reference front() const { return s_.top(); }
+  typename SType::const_reference front() const { return s_.top(); }
 
  private:
-  std::stack<T> s_;
+  SType s_;
 };
 
 template <class T, class Compare = std::less<T> >
@@ -0,0 +1,158 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/point_cloud/point_cloud_chunked_sequential_decoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "draco/compression/point_cloud/point_cloud_sequential_decoder.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/varint_decoding.h"
+
+namespace draco {
+
+bool PointCloudChunkedSequentialDecoder::DecodeGeometryData() {
+  int32_t num_points;
+  if (!buffer()->Decode(&num_points) || num_points < 0) {
+    return false;
+  }
+  uint32_t block_size;
+  if (!DecodeVarint(&block_size, buffer()) || block_size == 0 ||
+      block_size > static_cast<uint32_t>(std::numeric_limits<int>::max())) {
+    return false;
+  }
+  point_cloud()->set_num_points(num_points);
+  block_size_ = static_cast<int>(block_size);
+
+  // Each block has at least one byte in the table of block sizes.
+  const int64_t num_blocks = std::max<int64_t>(
+      1, (static_cast<int64_t>(num_points) + block_size - 1) / block_size);
+  if (num_blocks > buffer()->remaining_size()) {
+    return false;
+  }
+  blocks_.resize(num_blocks);
+  for (BlockData &block : blocks_) {
+    uint64_t size;
+    if (!DecodeVarint(&size, buffer())) {
+      return false;
+    }
+    block.size = static_cast<int64_t>(size);
+  }
+  for (BlockData &block : blocks_) {
+    if (block.size < 0 || block.size > buffer()->remaining_size()) {
+      return false;
+    }
+    block.data = buffer()->data_head();
+    buffer()->Advance(block.size);
+  }
+  return true;
+}
+
+bool PointCloudChunkedSequentialDecoder::DecodePointAttributes() {
+  const int num_blocks = static_cast<int>(blocks_.size());
+  const int num_points = point_cloud()->num_points();
+
+  // The blocks are decoded into temporary point clouds that must not share
+  // the collectors and the memory arena of the options.
+  DecoderOptions block_options = *options();
+  block_options.SetCodingStats(nullptr);
+  block_options.SetCodingTracer(nullptr);
+  block_options.SetMemoryArena(nullptr);
+  std::vector<std::unique_ptr<PointCloud>> block_pcs(num_blocks);
+  std::vector<Status> statuses(num_blocks);
+  ParallelFor(options()->thread_pool(), num_blocks, [&](int b) {
+    DecoderBuffer block_buffer;
+    block_buffer.Init(blocks_[b].data, blocks_[b].size);
+    PointCloudSequentialDecoder decoder;
+    block_pcs[b].reset(new PointCloud());
+    statuses[b] =
+        decoder.Decode(block_options, &block_buffer, block_pcs[b].get());
+  });
+
+  // Check that all blocks have the expected points and attributes.
+  const PointCloud &first_block = *block_pcs[0];
+  for (int b = 0; b < num_blocks; ++b) {
+    if (!statuses[b].ok()) {
+      return false;
+    }
+    const PointCloud &block = *block_pcs[b];
+    const int begin = b * block_size_;
+    if (static_cast<int>(block.num_points()) !=
+            std::min(block_size_, num_points - begin) ||
+        block.num_attributes() != first_block.num_attributes()) {
+      return false;
+    }
+    for (int i = 0; i < block.num_attributes(); ++i) {
+      const PointAttribute *const att = block.attribute(i);
+      const PointAttribute *const first_att = first_block.attribute(i);
+      if (att->attribute_type() != first_att->attribute_type() ||
+          att->data_type() != first_att->data_type() ||
+          att->num_components() != first_att->num_components()) {
+        return false;
+      }
+    }
+  }
+
+  // Create the attributes of the decoded point cloud.
+  const bool is_layout_only = options()->GetGlobalBool(
+      GetDecoderOptionKeys().decode_layout_only, false);
+  for (int i = 0; i < first_block.num_attributes(); ++i) {
+    const PointAttribute *const src_att = first_block.attribute(i);
+    const int value_size =
+        src_att->num_components() * DataTypeLength(src_att->data_type());
+    GeometryAttribute ga;
+    ga.Init(src_att->attribute_type(), nullptr, src_att->num_components(),
+            src_att->data_type(), src_att->normalized(), value_size, 0);
+    ga.set_unique_id(src_att->unique_id());
+    std::unique_ptr<PointAttribute> att = CreateAttribute(ga);
+    if (src_att->GetAttributeTransformData() != nullptr) {
+      att->SetAttributeTransformData(std::unique_ptr<AttributeTransformData>(
+          new AttributeTransformData(*src_att->GetAttributeTransformData())));
+    }
+    if (!is_layout_only) {
+      if (!ReserveMemory(static_cast<uint64_t>(num_points) * value_size)) {
+        return false;
+      }
+      att->Reset(num_points);
+      att->SetIdentityMapping();
+    }
+    const int att_id = point_cloud()->AddAttribute(std::move(att));
+    point_cloud()->attribute(att_id)->set_unique_id(src_att->unique_id());
+  }
+  if (is_layout_only) {
+    return true;
+  }
+
+  // Copy the values of the blocks into the attributes.
+  ParallelFor(options()->thread_pool(), num_blocks, [&](int b) {
+    const PointCloud &block = *block_pcs[b];
+    const int begin = b * block_size_;
+    for (int i = 0; i < block.num_attributes(); ++i) {
+      const PointAttribute *const src_att = block.attribute(i);
+      PointAttribute *const dst_att = point_cloud()->attribute(i);
+      const int value_size =
+          src_att->num_components() * DataTypeLength(src_att->data_type());
+      for (PointIndex p(0); p < block.num_points(); ++p) {
+        memcpy(dst_att->GetAddress(AttributeValueIndex(begin + p.value())),
+               src_att->GetAddressOfMappedIndex(p), value_size);
+      }
+    }
+  });
+  return true;
+}
+
+}  // namespace draco
@@ -0,0 +1,48 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_CHUNKED_SEQUENTIAL_DECODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_CHUNKED_SEQUENTIAL_DECODER_H_
+
+#include <vector>
+
+#include "draco/compression/point_cloud/point_cloud_decoder.h"
+
+namespace draco {
+
+// Decoder for point clouds encoded by PointCloudChunkedSequentialEncoder. The
+// blocks are decoded in parallel on the thread pool set in the options and
+// their points are stored one after another in the order of the blocks.
+class PointCloudChunkedSequentialDecoder : public PointCloudDecoder {
+ protected:
+  bool DecodeGeometryData() override;
+  bool DecodePointAttributes() override;
+  bool CreateAttributesDecoder(int32_t /* att_decoder_id */) override {
+    return false;
+  }
+
+ private:
+  // Location of the encoded data of a block in the input buffer.
+  struct BlockData {
+    const char *data;
+    int64_t size;
+  };
+
+  int block_size_ = 0;
+  std::vector<BlockData> blocks_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_CHUNKED_SEQUENTIAL_DECODER_H_
@@ -0,0 +1,129 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/point_cloud/point_cloud_chunked_sequential_encoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/point_cloud/point_cloud_sequential_encoder.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/varint_encoding.h"
+
+namespace draco {
+
+Status PointCloudChunkedSequentialEncoder::EncodeGeometryData() {
+  block_size_ = plan()->sequential_block_size();
+  if (block_size_ <= 0) {
+    return Status(Status::DRACO_ERROR, "Invalid sequential block size.");
+  }
+  const int32_t num_points = point_cloud()->num_points();
+  buffer()->Encode(num_points);
+  EncodeVarint(static_cast<uint32_t>(block_size_), buffer());
+  return OkStatus();
+}
+
+bool PointCloudChunkedSequentialEncoder::EncodePointAttributes() {
+  // There is always at least one block, so that the attribute descriptions
+  // are stored also for empty point clouds.
+  const int num_points = point_cloud()->num_points();
+  const int num_blocks =
+      std::max(1, (num_points + block_size_ - 1) / block_size_);
+
+  // The blocks must not share the collectors of the options, which are not
+  // thread-safe.
+  EncoderOptions block_options = *options();
+  block_options.SetCodingStats(nullptr);
+  block_options.SetCodingTracer(nullptr);
+  // Quantize the attributes of all blocks on the grid of the whole point
+  // cloud.
+  for (int i = 0; i < point_cloud()->num_attributes(); ++i) {
+    const AttributeEncodePlan &att_plan = plan()->attribute(i);
+    const PointAttribute *const att = point_cloud()->attribute(i);
+    if (att_plan.quantization_bits <= 0 ||
+        !att_plan.quantization_origin.empty() ||
+        att->data_type() != DT_FLOAT32 || att->size() == 0) {
+      continue;
+    }
+    AttributeQuantizationTransform transform;
+    if (!transform.ComputeParameters(*att, att_plan.quantization_bits)) {
+      return false;
+    }
+    block_options.SetAttributeVector(i, "quantization_origin",
+                                     att->num_components(),
+                                     transform.min_values().data());
+    block_options.SetAttributeFloat(i, "quantization_range", transform.range());
+  }
+  const EncodePlan block_plan(block_options, *point_cloud());
+
+  std::vector<EncoderBuffer> block_buffers(num_blocks);
+  std::vector<Status> statuses(num_blocks);
+  ParallelFor(options()->thread_pool(), num_blocks, [&](int b) {
+    const std::unique_ptr<PointCloud> block = CreateBlockPointCloud(b);
+    PointCloudSequentialEncoder encoder;
+    encoder.SetPointCloud(*block);
+    encoder.SetEncodePlan(&block_plan);
+    statuses[b] = encoder.Encode(block_options, &block_buffers[b]);
+  });
+  for (const Status &status : statuses) {
+    if (!status.ok()) {
+      return false;
+    }
+  }
+
+  // Encode the table of block sizes followed by the data of the blocks.
+  for (const EncoderBuffer &block_buffer : block_buffers) {
+    EncodeVarint(static_cast<uint64_t>(block_buffer.size()), buffer());
+  }
+  for (const EncoderBuffer &block_buffer : block_buffers) {
+    buffer()->Encode(block_buffer.data(), block_buffer.size());
+  }
+  return true;
+}
+
+void PointCloudChunkedSequentialEncoder::ComputeNumberOfEncodedPoints() {
+  set_num_encoded_points(point_cloud()->num_points());
+}
+
+std::unique_ptr<PointCloud>
+PointCloudChunkedSequentialEncoder::CreateBlockPointCloud(int block_id) const {
+  const PointCloud &pc = *point_cloud();
+  const int begin = block_id * block_size_;
+  const int end =
+      std::min(static_cast<int>(pc.num_points()), begin + block_size_);
+  std::unique_ptr<PointCloud> block(new PointCloud());
+  block->set_num_points(end - begin);
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    const PointAttribute *const src_att = pc.attribute(i);
+    const int value_size =
+        src_att->num_components() * DataTypeLength(src_att->data_type());
+    GeometryAttribute ga;
+    ga.Init(src_att->attribute_type(), nullptr, src_att->num_components(),
+            src_att->data_type(), src_att->normalized(), value_size, 0);
+    std::unique_ptr<PointAttribute> att(new PointAttribute(ga));
+    att->Reset(end - begin);
+    att->SetIdentityMapping();
+    for (PointIndex p(begin); p < end; ++p) {
+      memcpy(att->GetAddress(AttributeValueIndex(p.value() - begin)),
+             src_att->GetAddressOfMappedIndex(p), value_size);
+    }
+    const int att_id = block->AddAttribute(std::move(att));
+    block->attribute(att_id)->set_unique_id(src_att->unique_id());
+  }
+  return block;
+}
+
+}  // namespace draco
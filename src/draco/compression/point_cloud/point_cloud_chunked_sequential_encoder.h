@@ -0,0 +1,63 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_CHUNKED_SEQUENTIAL_ENCODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_CHUNKED_SEQUENTIAL_ENCODER_H_
+
+#include <memory>
+
+#include "draco/compression/point_cloud/point_cloud_encoder.h"
+
+namespace draco {
+
+// Point cloud encoder that splits the points into blocks of a fixed size and
+// encodes each block with the PointCloudSequentialEncoder. The blocks have
+// independent prediction and entropy coding, so both the encoder and the
+// PointCloudChunkedSequentialDecoder process them in parallel on the thread
+// pool set in the options. The number of points in a block is set by the
+// "sequential_block_size" option.
+//
+// Quantized attributes of all blocks share the quantization grid computed for
+// the whole point cloud unless an explicit grid was set, so the decoded values
+// are the same as with the regular sequential encoding. Compared to the
+// regular encoding, each block stores its own header, attribute descriptions
+// and entropy tables, which costs a small amount of compression.
+//
+// The encoded geometry data contains the number of points, the block size and
+// a table with the encoded size of each block followed by the data of all
+// blocks.
+class PointCloudChunkedSequentialEncoder : public PointCloudEncoder {
+ public:
+  uint8_t GetEncodingMethod() const override {
+    return POINT_CLOUD_CHUNKED_SEQUENTIAL_ENCODING;
+  }
+
+ protected:
+  Status EncodeGeometryData() override;
+  bool EncodePointAttributes() override;
+  bool GenerateAttributesEncoder(int32_t /* att_id */) override {
+    return true;
+  }
+  void ComputeNumberOfEncodedPoints() override;
+
+ private:
+  // Returns a point cloud with the points of block |block_id|.
+  std::unique_ptr<PointCloud> CreateBlockPointCloud(int block_id) const;
+
+  int block_size_ = 0;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_CHUNKED_SEQUENTIAL_ENCODER_H_
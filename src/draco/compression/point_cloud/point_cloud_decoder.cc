@@ -14,6 +14,9 @@
 //
 #include "draco/compression/point_cloud/point_cloud_decoder.h"
 
+#include <algorithm>
+
+#include "draco/core/coding_stats.h"
 #include "draco/metadata/metadata_decoder.h"
 
 namespace draco {
@@ -23,39 +26,50 @@ PointCloudDecoder::PointCloudDecoder()
       buffer_(nullptr),
       version_major_(0),
       version_minor_(0),
-      options_(nullptr) {}
+      options_(nullptr),
+      estimated_memory_usage_(0),
+      memory_limit_exceeded_(false),
+      work_done_(0),
+      work_limit_(0),
+      time_limit_ms_(0),
+      work_limit_exceeded_(false),
+      time_limit_exceeded_(false) {}
 
 Status PointCloudDecoder::DecodeHeader(DecoderBuffer *buffer,
                                        DracoHeader *out_header) {
-  constexpr char kIoErrorMsg[] = "Failed to parse Draco header.";
+  static constexpr char kIoErrorMsg[] = "Failed to parse Draco header.";
   if (!buffer->Decode(out_header->draco_string, 5)) {
-    return Status(Status::IO_ERROR, kIoErrorMsg);
+    return Status::Static(Status::IO_ERROR, kIoErrorMsg);
   }
   if (memcmp(out_header->draco_string, "DRACO", 5) != 0) {
     return Status(Status::DRACO_ERROR, "Not a Draco file.");
   }
   if (!buffer->Decode(&(out_header->version_major))) {
-    return Status(Status::IO_ERROR, kIoErrorMsg);
+    return Status::Static(Status::IO_ERROR, kIoErrorMsg);
   }
   if (!buffer->Decode(&(out_header->version_minor))) {
-    return Status(Status::IO_ERROR, kIoErrorMsg);
+    return Status::Static(Status::IO_ERROR, kIoErrorMsg);
   }
   if (!buffer->Decode(&(out_header->encoder_type))) {
-    return Status(Status::IO_ERROR, kIoErrorMsg);
+    return Status::Static(Status::IO_ERROR, kIoErrorMsg);
   }
   if (!buffer->Decode(&(out_header->encoder_method))) {
-    return Status(Status::IO_ERROR, kIoErrorMsg);
+    return Status::Static(Status::IO_ERROR, kIoErrorMsg);
   }
   if (!buffer->Decode(&(out_header->flags))) {
-    return Status(Status::IO_ERROR, kIoErrorMsg);
+    return Status::Static(Status::IO_ERROR, kIoErrorMsg);
   }
   return OkStatus();
 }
 
-Status PointCloudDecoder::DecodeMetadata() {
+Status PointCloudDecoder::DecodeMetadata(uint16_t header_flags) {
   std::unique_ptr<GeometryMetadata> metadata =
       std::unique_ptr<GeometryMetadata>(new GeometryMetadata());
   MetadataDecoder metadata_decoder;
+  metadata_decoder.set_decode_entries_lazily(
+      options_->GetGlobalBool(GetDecoderOptionKeys().lazy_metadata, false));
+  metadata_decoder.set_intern_names(header_flags &
+                                    METADATA_INTERNED_NAMES_FLAG_MASK);
   if (!metadata_decoder.DecodeGeometryMetadata(buffer_, metadata.get())) {
     return Status(Status::DRACO_ERROR, "Failed to decode metadata.");
   }
@@ -69,8 +83,38 @@ Status PointCloudDecoder::Decode(const DecoderOptions &options,
   options_ = &options;
   buffer_ = in_buffer;
   point_cloud_ = out_point_cloud;
+  // Release attribute decoders that may be left over from a previous call so
+  // that the decoder instance can be reused for decoding of multiple inputs.
+  attributes_decoders_.clear();
+  attribute_to_decoder_map_.clear();
+  estimated_memory_usage_ = 0;
+  memory_limit_exceeded_ = false;
+  work_done_ = 0;
+  const DecoderOptionKeys &keys = GetDecoderOptionKeys();
+  const int work_limit_kops = options.GetGlobalInt(keys.work_limit_kops, 0);
+  work_limit_ =
+      work_limit_kops > 0 ? 1000 * static_cast<uint64_t>(work_limit_kops) : 0;
+  time_limit_ms_ = options.GetGlobalInt(keys.time_limit_ms, 0);
+  start_time_ = std::chrono::steady_clock::now();
+  work_limit_exceeded_ = false;
+  time_limit_exceeded_ = false;
+  CollectReusableAttributes();
+  const Status status = DecodeInternal();
+  // Attributes that were not reused are not needed anymore.
+  reusable_attributes_.clear();
+  return status;
+}
+
+Status PointCloudDecoder::DecodeInternal() {
+  const DecoderOptions &options = *options_;
+  const DecoderOptionKeys &keys = GetDecoderOptionKeys();
+  CodingStats *const stats = options.coding_stats();
+  CodingTracer *const tracer = options.coding_tracer();
   DracoHeader header;
-  DRACO_RETURN_IF_ERROR(DecodeHeader(buffer_, &header))
+  {
+    const ScopedCodingStage stage(stats, tracer, "header", -1, buffer_);
+    DRACO_RETURN_IF_ERROR(DecodeHeader(buffer_, &header))
+  }
   // Sanity check that we are really using the right decoder (mostly for cases
   // where the Decode method was called manually outside of our main API.
   if (header.encoder_type != GetGeometryType()) {
@@ -111,16 +155,97 @@ Status PointCloudDecoder::Decode(const DecoderOptions &options,
 
   if (bitstream_version() >= DRACO_BITSTREAM_VERSION(1, 3) &&
       (header.flags & METADATA_FLAG_MASK)) {
-    DRACO_RETURN_IF_ERROR(DecodeMetadata())
+    const ScopedCodingStage stage(stats, tracer, "metadata", -1, buffer_);
+    DRACO_RETURN_IF_ERROR(DecodeMetadata(header.flags))
   }
-  if (!InitializeDecoder()) {
-    return Status(Status::DRACO_ERROR, "Failed to initialize the decoder.");
+  DRACO_RETURN_IF_ERROR(CheckCancellation())
+  {
+    const ScopedCodingStage stage(stats, tracer, "connectivity", -1, buffer_);
+    if (!InitializeDecoder()) {
+      return Status(Status::DRACO_ERROR, "Failed to initialize the decoder.");
+    }
+    if (!DecodeGeometryData()) {
+      return GetStageError("Failed to decode geometry data.");
+    }
   }
-  if (!DecodeGeometryData()) {
-    return Status(Status::DRACO_ERROR, "Failed to decode geometry data.");
+  if (options.GetGlobalBool(keys.decode_connectivity_only, false)) {
+    // Only the header, metadata and connectivity (or the number of points for
+    // point clouds) were requested.
+    return OkStatus();
   }
+  DRACO_RETURN_IF_ERROR(CheckCancellation())
+  const ScopedCodingStage stage(stats, tracer, "attributes", -1, buffer_);
   if (!DecodePointAttributes()) {
-    return Status(Status::DRACO_ERROR, "Failed to decode point attributes.");
+    return GetStageError("Failed to decode point attributes.");
+  }
+  if (!options.GetGlobalBool(keys.decode_layout_only, false)) {
+    DeleteSkippedAttributes();
+  }
+  return OkStatus();
+}
+
+void PointCloudDecoder::CollectReusableAttributes() {
+  reusable_attributes_.clear();
+  point_cloud_->AddMetadata(nullptr);
+  // Attributes sharing an explicit mapping drop their reference, so that the
+  // mapping can be reused by the first attribute without being copied.
+  for (int i = 1; i < point_cloud_->num_attributes(); ++i) {
+    PointAttribute *const att = point_cloud_->attribute(i);
+    for (int j = 0; j < i; ++j) {
+      if (att->SharesMappingWith(*point_cloud_->attribute(j))) {
+        att->SetIdentityMapping();
+        break;
+      }
+    }
+  }
+  for (int i = point_cloud_->num_attributes() - 1; i >= 0; --i) {
+    reusable_attributes_.push_back(point_cloud_->ReleaseAttribute(i));
+  }
+  std::reverse(reusable_attributes_.begin(), reusable_attributes_.end());
+}
+
+std::unique_ptr<PointAttribute> PointCloudDecoder::CreateAttribute(
+    const GeometryAttribute &ga) {
+  MemoryArena *const arena =
+      options_ == nullptr ? nullptr : options_->memory_arena();
+  for (auto it = reusable_attributes_.begin(); it != reusable_attributes_.end();
+       ++it) {
+    const PointAttribute &att = **it;
+    if (att.attribute_type() == ga.attribute_type() &&
+        att.data_type() == ga.data_type() &&
+        att.num_components() == ga.num_components() &&
+        att.normalized() == ga.normalized() && att.buffer() != nullptr &&
+        att.buffer()->memory_arena() == arena) {
+      std::unique_ptr<PointAttribute> pa = std::move(*it);
+      reusable_attributes_.erase(it);
+      pa->ReinitializeKeepingStorage(ga);
+      return pa;
+    }
+  }
+  std::unique_ptr<PointAttribute> pa(new PointAttribute(ga));
+  if (arena != nullptr) {
+    pa->SetMemoryArena(arena);
+  }
+  return pa;
+}
+
+Status PointCloudDecoder::GetStageError(const char *message) const {
+  if (memory_limit_exceeded_) {
+    return Status(Status::DRACO_ERROR, "Memory limit exceeded.");
+  }
+  if (work_limit_exceeded_) {
+    return Status(Status::DRACO_ERROR, "Work limit exceeded.");
+  }
+  if (time_limit_exceeded_) {
+    return Status(Status::DRACO_ERROR, "Time limit exceeded.");
+  }
+  return Status(Status::DRACO_ERROR, message);
+}
+
+Status PointCloudDecoder::CheckCancellation() const {
+  const CancellationToken *const token = options_->cancellation_token();
+  if (token != nullptr && token->IsCancelled()) {
+    return Status(Status::DRACO_ERROR, "Decoding was cancelled.");
   }
   return OkStatus();
 }
@@ -153,6 +278,31 @@ bool PointCloudDecoder::DecodePointAttributes() {
     }
   }
 
+  // Reserve memory for the decoded values, the portable values and the point
+  // to value mapping of all attributes. The number of attribute values is not
+  // known yet so the number of points is used as the upper bound.
+  const bool is_layout_only =
+      options_->GetGlobalBool(GetDecoderOptionKeys().decode_layout_only, false);
+  const uint64_t num_points = point_cloud_->num_points();
+  for (int32_t i = 0; i < point_cloud_->num_attributes(); ++i) {
+    if (!is_layout_only && IsAttributeSkipped(i)) {
+      continue;
+    }
+    const PointAttribute *const att = point_cloud_->attribute(i);
+    const uint64_t num_components = att->num_components();
+    const uint64_t value_size =
+        num_components * DataTypeLength(att->data_type());
+    if (!ReserveMemory(num_points *
+                       (value_size + num_components * sizeof(int32_t) +
+                        sizeof(AttributeValueIndex)))) {
+      return false;
+    }
+    // The values are decoded and transformed once per component.
+    if (!is_layout_only && !ConsumeWork(num_points * num_components)) {
+      return false;
+    }
+  }
+
   // Create map between attribute and decoder ids.
   for (int i = 0; i < num_attributes_decoders; ++i) {
     const int32_t num_attributes = attributes_decoders_[i]->GetNumAttributes();
@@ -185,6 +335,75 @@ bool PointCloudDecoder::DecodeAllAttributes() {
   return true;
 }
 
+bool PointCloudDecoder::IsAttributeSkipped(int32_t att_id) const {
+  if (options_ == nullptr) {
+    return false;
+  }
+  const DecoderOptionKeys &keys = GetDecoderOptionKeys();
+  if (options_->GetGlobalBool(keys.decode_layout_only, false)) {
+    return true;
+  }
+  const auto is_skipped_type = [this, &keys](int32_t id) {
+    return options_->GetAttributeBool(
+        point_cloud_->attribute(id)->attribute_type(),
+        keys.skip_attribute_decoding, false);
+  };
+  if (!is_skipped_type(att_id)) {
+    return false;
+  }
+  if (point_cloud_->attribute(att_id)->attribute_type() !=
+      GeometryAttribute::POSITION) {
+    return true;
+  }
+  for (int32_t i = 0; i < point_cloud_->num_attributes(); ++i) {
+    if (!is_skipped_type(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PointCloudDecoder::ReserveMemory(uint64_t num_bytes) {
+  estimated_memory_usage_ += num_bytes;
+  const int memory_limit_mb =
+      options_->GetGlobalInt(GetDecoderOptionKeys().memory_limit_mb, 0);
+  if (memory_limit_mb > 0 &&
+      estimated_memory_usage_ > static_cast<uint64_t>(memory_limit_mb) << 20) {
+    memory_limit_exceeded_ = true;
+    return false;
+  }
+  return true;
+}
+
+bool PointCloudDecoder::ConsumeWork(uint64_t num_operations) {
+  work_done_ += num_operations;
+  if (work_limit_ > 0 && work_done_ > work_limit_) {
+    work_limit_exceeded_ = true;
+    return false;
+  }
+  if (time_limit_ms_ > 0 &&
+      std::chrono::steady_clock::now() - start_time_ >
+          std::chrono::milliseconds(time_limit_ms_)) {
+    time_limit_exceeded_ = true;
+    return false;
+  }
+  return true;
+}
+
+void PointCloudDecoder::DeleteSkippedAttributes() {
+  std::vector<int32_t> skipped_att_ids;
+  for (int32_t i = 0; i < point_cloud_->num_attributes(); ++i) {
+    if (IsAttributeSkipped(i)) {
+      skipped_att_ids.push_back(i);
+    }
+  }
+  // Delete the attributes in the reverse order so that the ids of the
+  // remaining skipped attributes are not changed.
+  for (auto it = skipped_att_ids.rbegin(); it != skipped_att_ids.rend(); ++it) {
+    point_cloud_->DeleteAttribute(*it);
+  }
+}
+
 const PointAttribute *PointCloudDecoder::GetPortableAttribute(
     int32_t parent_att_id) {
   if (parent_att_id < 0 || parent_att_id >= point_cloud_->num_attributes()) {
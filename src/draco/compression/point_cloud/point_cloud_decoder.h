@@ -15,6 +15,8 @@
 #ifndef DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_DECODER_H_
 #define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_DECODER_H_
 
+#include <chrono>
+
 #include "draco/compression/attributes/attributes_decoder_interface.h"
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/config/decoder_options.h"
@@ -79,6 +81,45 @@ class PointCloudDecoder {
   DecoderBuffer *buffer() { return buffer_; }
   const DecoderOptions *options() const { return options_; }
 
+  // Returns true when the values of the attribute |att_id| are not decoded, as
+  // requested by the "skip_attribute_decoding" option of its type. Positions
+  // can be parent attributes of other attributes, so they are skipped only
+  // when all other attributes are skipped as well. Valid after all attribute
+  // decoders decoded their attribute descriptions.
+  // All attributes are skipped when the global "decode_layout_only" option is
+  // set. In that case the attributes are kept in the point cloud with their
+  // transform parameters but without any values (see Decoder::ProbeBuffer()).
+  bool IsAttributeSkipped(int32_t att_id) const;
+
+  // Adds |num_bytes| to the estimated peak memory usage of the decoding.
+  // Decoders call this function with an approximate size of the data they are
+  // going to allocate based on the counts decoded from the input. Returns
+  // false when the estimate exceeds the limit set by the global
+  // "memory_limit_mb" option, in which case the decoding must fail before
+  // anything is allocated.
+  bool ReserveMemory(uint64_t num_bytes);
+
+  // Adds |num_operations| to the work done by the decoding. An operation is
+  // roughly one decoded connectivity symbol, one step of a traversal of the
+  // decoded connectivity or one decoded attribute value component. Decoders
+  // call this function at coarse granularity, either with the work estimated
+  // from the counts decoded from the input before it is done, or from their
+  // decoding loops after every kWorkCheckInterval operations. Returns false
+  // when the work exceeds the limit set by the global "work_limit_kops" option
+  // (in thousands of operations) or when the decoding runs longer than the
+  // global "time_limit_ms" option, in which case the decoding must fail.
+  bool ConsumeWork(uint64_t num_operations);
+  static constexpr uint64_t kWorkCheckInterval = 1 << 12;
+
+  // Returns a new attribute with the properties of |ga| for the decoded point
+  // cloud. Attributes of the same layout that were in the output point cloud
+  // before the decoding started are reused, so that decoding into the same
+  // point cloud again does not need to allocate new attribute storage.
+  std::unique_ptr<PointAttribute> CreateAttribute(const GeometryAttribute &ga);
+
+  // Returns the memory usage estimated from all data decoded so far.
+  uint64_t estimated_memory_usage() const { return estimated_memory_usage_; }
+
  protected:
   // Can be implemented by derived classes to perform any custom initialization
   // of the decoder. Called in the Decode() method.
@@ -92,7 +133,29 @@ class PointCloudDecoder {
   virtual bool DecodeAllAttributes();
   virtual bool OnAttributesDecoded() { return true; }
 
-  Status DecodeMetadata();
+  // Decodes the metadata. |header_flags| are the flags of the Draco header.
+  Status DecodeMetadata(uint16_t header_flags);
+
+  // Decodes the point cloud after Decode() initialized the decoder.
+  Status DecodeInternal();
+
+  // Moves all attributes of the output point cloud to |reusable_attributes_|
+  // and clears its metadata.
+  void CollectReusableAttributes();
+
+  // Returns an error when the cancellation token of the options is cancelled.
+  Status CheckCancellation() const;
+
+  // Returns the error of a failed decoding stage. |message| is used unless the
+  // stage failed because one of the decoding limits was exceeded.
+  Status GetStageError(const char *message) const;
+
+  // Removes all skipped attributes from the decoded point cloud.
+  void DeleteSkippedAttributes();
+
+  AttributesDecoderInterface *mutable_attributes_decoder(int dec_id) {
+    return attributes_decoders_[dec_id].get();
+  }
 
  private:
   // Point cloud that is being filled in by the decoder.
@@ -111,6 +174,22 @@ class PointCloudDecoder {
   uint8_t version_minor_;
 
   const DecoderOptions *options_;
+
+  uint64_t estimated_memory_usage_;
+  bool memory_limit_exceeded_;
+
+  // Work done so far and the limits of ConsumeWork(). Zero limits are not
+  // checked.
+  uint64_t work_done_;
+  uint64_t work_limit_;
+  int time_limit_ms_;
+  std::chrono::steady_clock::time_point start_time_;
+  bool work_limit_exceeded_;
+  bool time_limit_exceeded_;
+
+  // Attributes of the output point cloud that can be reused by
+  // CreateAttribute().
+  std::vector<std::unique_ptr<PointAttribute>> reusable_attributes_;
 };
 
 }  // namespace draco
@@ -14,12 +14,18 @@
 //
 #include "draco/compression/point_cloud/point_cloud_encoder.h"
 
+#include "draco/core/coding_stats.h"
 #include "draco/metadata/metadata_encoder.h"
 
 namespace draco {
 
 PointCloudEncoder::PointCloudEncoder()
-    : point_cloud_(nullptr), buffer_(nullptr), num_encoded_points_(0) {}
+    : point_cloud_(nullptr),
+      buffer_(nullptr),
+      options_(nullptr),
+      external_plan_(nullptr),
+      plan_(nullptr),
+      num_encoded_points_(0) {}
 
 void PointCloudEncoder::SetPointCloud(const PointCloud &pc) {
   point_cloud_ = &pc;
@@ -38,19 +44,47 @@ Status PointCloudEncoder::Encode(const EncoderOptions &options,
   if (!point_cloud_) {
     return Status(Status::DRACO_ERROR, "Invalid input geometry.");
   }
-  DRACO_RETURN_IF_ERROR(EncodeHeader())
-  DRACO_RETURN_IF_ERROR(EncodeMetadata())
-  if (!InitializeEncoder()) {
-    return Status(Status::DRACO_ERROR, "Failed to initialize encoder.");
+  if (external_plan_ != nullptr) {
+    if (!external_plan_->IsCompatible(*point_cloud_)) {
+      return Status(Status::DRACO_ERROR,
+                    "Encode plan does not match the input geometry.");
+    }
+    plan_ = external_plan_;
+  } else {
+    own_plan_.reset(new EncodePlan(options, *point_cloud_));
+    plan_ = own_plan_.get();
+  }
+  CodingStats *const stats = options.coding_stats();
+  CodingTracer *const tracer = options.coding_tracer();
+  {
+    const ScopedCodingStage stage(stats, tracer, "header", -1, buffer_);
+    DRACO_RETURN_IF_ERROR(EncodeHeader())
+  }
+  {
+    const ScopedCodingStage stage(stats, tracer, "metadata", -1, buffer_);
+    DRACO_RETURN_IF_ERROR(EncodeMetadata())
+  }
+  {
+    const ScopedCodingStage stage(stats, tracer, "connectivity", -1, buffer_);
+    if (!InitializeEncoder()) {
+      return Status(Status::DRACO_ERROR, "Failed to initialize encoder.");
+    }
+    if (!EncodeEncoderData()) {
+      return Status(Status::DRACO_ERROR, "Failed to encode internal data.");
+    }
+    DRACO_RETURN_IF_ERROR(EncodeGeometryData());
   }
-  if (!EncodeEncoderData()) {
-    return Status(Status::DRACO_ERROR, "Failed to encode internal data.");
+  {
+    const ScopedCodingStage stage(stats, tracer, "attributes", -1, buffer_);
+    if (!EncodePointAttributes()) {
+      return Status(Status::DRACO_ERROR, "Failed to encode point attributes.");
+    }
   }
-  DRACO_RETURN_IF_ERROR(EncodeGeometryData());
-  if (!EncodePointAttributes()) {
-    return Status(Status::DRACO_ERROR, "Failed to encode point attributes.");
+  if (buffer_->storage_exhausted()) {
+    return Status(Status::DRACO_ERROR,
+                  "Encoded data does not fit into the output buffer.");
   }
-  if (options.GetGlobalBool("store_number_of_encoded_points", false)) {
+  if (plan_->store_number_of_encoded_points()) {
     ComputeNumberOfEncodedPoints();
   }
   return OkStatus();
@@ -81,6 +115,10 @@ Status PointCloudEncoder::EncodeHeader() {
   // First bit of |flags| is reserved for metadata.
   if (point_cloud_->GetMetadata()) {
     flags |= METADATA_FLAG_MASK;
+    if (options_->GetGlobalBool(GetEncoderOptionKeys().intern_metadata_names,
+                                false)) {
+      flags |= METADATA_INTERNED_NAMES_FLAG_MASK;
+    }
   }
   buffer_->Encode(flags);
   return OkStatus();
@@ -91,6 +129,9 @@ Status PointCloudEncoder::EncodeMetadata() {
     return OkStatus();
   }
   MetadataEncoder metadata_encoder;
+  metadata_encoder.set_intern_names(
+      options_->GetGlobalBool(GetEncoderOptionKeys().intern_metadata_names,
+                              false));
   if (!metadata_encoder.EncodeGeometryMetadata(buffer_,
                                                point_cloud_->GetMetadata())) {
     return Status(Status::DRACO_ERROR, "Failed to encode metadata.");
@@ -17,6 +17,7 @@
 
 #include "draco/compression/attributes/attributes_encoder.h"
 #include "draco/compression/config/compression_shared.h"
+#include "draco/compression/config/encode_plan.h"
 #include "draco/compression/config/encoder_options.h"
 #include "draco/core/encoder_buffer.h"
 #include "draco/core/status.h"
@@ -35,6 +36,13 @@ class PointCloudEncoder {
   // Encode() method.
   void SetPointCloud(const PointCloud &pc);
 
+  // Sets an optional plan with the settings of the encoding resolved in
+  // advance. The plan must be created from the options passed to Encode() and
+  // it must be compatible with the encoded point cloud. When no plan is set,
+  // a new one is created from the options in each Encode() call. The plan is
+  // not owned by the encoder.
+  void SetEncodePlan(const EncodePlan *plan) { external_plan_ = plan; }
+
   // The main entry point that encodes provided point cloud.
   Status Encode(const EncoderOptions &options, EncoderBuffer *out_buffer);
 
@@ -74,6 +82,8 @@ class PointCloudEncoder {
 
   EncoderBuffer *buffer() { return buffer_; }
   const EncoderOptions *options() const { return options_; }
+  // Returns the settings of the running encoding. Valid only during Encode().
+  const EncodePlan *plan() const { return plan_; }
   const PointCloud *point_cloud() const { return point_cloud_; }
 
  protected:
@@ -150,6 +160,12 @@ class PointCloudEncoder {
 
   const EncoderOptions *options_;
 
+  // Plan set by SetEncodePlan(), plan created by Encode() when no plan was set
+  // and the plan used by the running encoding.
+  const EncodePlan *external_plan_;
+  std::unique_ptr<EncodePlan> own_plan_;
+  const EncodePlan *plan_;
+
   size_t num_encoded_points_;
 };
 
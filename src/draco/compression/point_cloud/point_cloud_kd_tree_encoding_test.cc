@@ -12,10 +12,18 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+#include "draco/compression/point_cloud/algorithms/float_points_tree_decoder.h"
+#include "draco/compression/point_cloud/algorithms/float_points_tree_encoder.h"
 #include "draco/compression/point_cloud/point_cloud_kd_tree_decoder.h"
 #include "draco/compression/point_cloud/point_cloud_kd_tree_encoder.h"
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
 #include "draco/core/vector_d.h"
 #include "draco/io/obj_decoder.h"
 #include "draco/point_cloud/point_cloud_builder.h"
@@ -60,26 +68,108 @@ class PointCloudKdTreeEncodingTest : public ::testing::Test {
   }
 
   void TestKdTreeEncoding(const PointCloud &pc) {
+    for (const bool level_order : {false, true}) {
+      for (const int partition_levels : {0, 3}) {
+        EncoderBuffer buffer;
+        PointCloudKdTreeEncoder encoder;
+        EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+        options.SetGlobalInt("quantization_bits", 16);
+        options.SetGlobalBool("kd_tree_level_order", level_order);
+        options.SetGlobalInt("kd_tree_partition_levels", partition_levels);
+        for (int compression_level = 0; compression_level <= 6;
+             ++compression_level) {
+          options.SetSpeed(10 - compression_level, 10 - compression_level);
+          encoder.SetPointCloud(pc);
+          buffer.Clear();
+          DRACO_ASSERT_OK(encoder.Encode(options, &buffer));
+
+          DecoderBuffer dec_buffer;
+          dec_buffer.Init(buffer.data(), buffer.size());
+          PointCloudKdTreeDecoder decoder;
+
+          std::unique_ptr<PointCloud> out_pc(new PointCloud());
+          DecoderOptions dec_options;
+          DRACO_ASSERT_OK(
+              decoder.Decode(dec_options, &dec_buffer, out_pc.get()));
+
+          ComparePointClouds(pc, *out_pc);
+        }
+      }
+    }
+  }
+
+  // Generates |num_points| points with a float position and an integer
+  // attribute.
+  std::unique_ptr<PointCloud> GeneratePointCloud(int num_points) const {
+    PointCloudBuilder builder;
+    builder.Start(num_points);
+    const int pos_att_id =
+        builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+    const int generic_att_id =
+        builder.AddAttribute(GeometryAttribute::GENERIC, 1, DT_UINT16);
+    for (PointIndex i(0); i < num_points; ++i) {
+      const uint32_t v = i.value();
+      const float pos[3] = {static_cast<float>((v * 7) % 101) / 10.f,
+                            static_cast<float>((v * 13) % 97) / 5.f,
+                            static_cast<float>((v * 29) % 89) / 2.f};
+      const uint16_t generic = static_cast<uint16_t>(v % 256);
+      builder.SetAttributeValueForPoint(pos_att_id, i, pos);
+      builder.SetAttributeValueForPoint(generic_att_id, i, &generic);
+    }
+    return builder.Finalize(false);
+  }
+
+  // Encodes |pc| in level order with |partition_levels| and decodes it with
+  // increasing number of decoded levels of the kD-tree.
+  void TestLevelOrderSubsampling(const PointCloud &pc, int partition_levels) {
     EncoderBuffer buffer;
     PointCloudKdTreeEncoder encoder;
     EncoderOptions options = EncoderOptions::CreateDefaultOptions();
-    options.SetGlobalInt("quantization_bits", 16);
-    for (int compression_level = 0; compression_level <= 6;
-         ++compression_level) {
-      options.SetSpeed(10 - compression_level, 10 - compression_level);
-      encoder.SetPointCloud(pc);
-      DRACO_ASSERT_OK(encoder.Encode(options, &buffer));
-
+    options.SetGlobalInt("quantization_bits", 12);
+    options.SetGlobalBool("kd_tree_level_order", true);
+    options.SetGlobalInt("kd_tree_partition_levels", partition_levels);
+    encoder.SetPointCloud(pc);
+    DRACO_ASSERT_OK(encoder.Encode(options, &buffer));
+
+    const PointAttribute *const pos_att =
+        pc.GetNamedAttribute(GeometryAttribute::POSITION);
+    const BoundingBox bounds = pc.ComputeBoundingBox();
+    // Tolerance of the quantization.
+    const float tolerance = bounds.Size().MaxCoeff() / 1000.f;
+    uint32_t last_num_points = 0;
+    for (int num_levels = 0; num_levels <= 64; num_levels += 4) {
       DecoderBuffer dec_buffer;
       dec_buffer.Init(buffer.data(), buffer.size());
       PointCloudKdTreeDecoder decoder;
-
       std::unique_ptr<PointCloud> out_pc(new PointCloud());
       DecoderOptions dec_options;
+      dec_options.SetGlobalInt("kd_tree_max_decoded_levels", num_levels);
       DRACO_ASSERT_OK(decoder.Decode(dec_options, &dec_buffer, out_pc.get()));
 
-      ComparePointClouds(pc, *out_pc);
+      // Coarser levels have fewer points.
+      ASSERT_GE(out_pc->num_points(), last_num_points);
+      ASSERT_LE(out_pc->num_points(), pc.num_points());
+      if (num_levels == 0) {
+        ASSERT_EQ(out_pc->num_points(), 1);
+      }
+      last_num_points = out_pc->num_points();
+      const PointAttribute *const out_pos_att =
+          out_pc->GetNamedAttribute(GeometryAttribute::POSITION);
+      ASSERT_NE(out_pos_att, nullptr);
+      ASSERT_EQ(out_pos_att->size(), out_pc->num_points());
+      ASSERT_EQ(out_pos_att->num_components(), pos_att->num_components());
+      for (PointIndex i(0); i < out_pc->num_points(); ++i) {
+        Vector3f pos;
+        out_pos_att->ConvertValue<float, 3>(out_pos_att->mapped_index(i),
+                                           &pos[0]);
+        for (int c = 0; c < 3; ++c) {
+          ASSERT_GE(pos[c], bounds.GetMinPoint()[c] - tolerance);
+          ASSERT_LE(pos[c], bounds.GetMaxPoint()[c] + tolerance);
+        }
+      }
     }
+    // All levels were decoded.
+    ASSERT_EQ(last_num_points, pc.num_points());
   }
 
   void TestFloatEncoding(const std::string &file_name) {
@@ -94,6 +184,74 @@ TEST_F(PointCloudKdTreeEncodingTest, TestFloatKdTreeEncoding) {
   TestFloatEncoding("cube_subd.obj");
 }
 
+TEST_F(PointCloudKdTreeEncodingTest, TestLevelOrderSubsampling) {
+  // The integer attribute must be subsampled together with the positions.
+  constexpr int num_points = 5000;
+  std::unique_ptr<PointCloud> pc = GeneratePointCloud(num_points);
+  ASSERT_NE(pc, nullptr);
+  TestLevelOrderSubsampling(*pc, 0);
+  // Subsampling stops either above or below the independent subtrees.
+  TestLevelOrderSubsampling(*pc, 6);
+
+  // Level order is ignored by decoders of depth first encoded trees.
+  EncoderBuffer buffer;
+  PointCloudKdTreeEncoder encoder;
+  EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+  options.SetGlobalInt("quantization_bits", 12);
+  encoder.SetPointCloud(*pc);
+  DRACO_ASSERT_OK(encoder.Encode(options, &buffer));
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(buffer.data(), buffer.size());
+  PointCloudKdTreeDecoder decoder;
+  std::unique_ptr<PointCloud> out_pc(new PointCloud());
+  DecoderOptions dec_options;
+  dec_options.SetGlobalInt("kd_tree_max_decoded_levels", 4);
+  DRACO_ASSERT_OK(decoder.Decode(dec_options, &dec_buffer, out_pc.get()));
+  ASSERT_EQ(out_pc->num_points(), num_points);
+}
+
+TEST_F(PointCloudKdTreeEncodingTest, TestPartitionedEncoding) {
+  // Tests that the subtrees encoded on a thread pool result in the same data
+  // as the subtrees encoded on the calling thread.
+  std::unique_ptr<PointCloud> pc = GeneratePointCloud(5000);
+  ASSERT_NE(pc, nullptr);
+  ThreadPool pool(3);
+  for (const bool level_order : {false, true}) {
+    EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+    options.SetGlobalInt("quantization_bits", 14);
+    options.SetGlobalBool("kd_tree_level_order", level_order);
+    options.SetGlobalInt("kd_tree_partition_levels", 5);
+    EncoderBuffer buffer;
+    PointCloudKdTreeEncoder encoder;
+    encoder.SetPointCloud(*pc);
+    DRACO_ASSERT_OK(encoder.Encode(options, &buffer));
+
+    options.SetThreadPool(&pool);
+    EncoderBuffer pool_buffer;
+    PointCloudKdTreeEncoder pool_encoder;
+    pool_encoder.SetPointCloud(*pc);
+    DRACO_ASSERT_OK(pool_encoder.Encode(options, &pool_buffer));
+    ASSERT_EQ(buffer.size(), pool_buffer.size());
+    ASSERT_EQ(memcmp(buffer.data(), pool_buffer.data(), buffer.size()), 0);
+
+    DecoderBuffer dec_buffer;
+    dec_buffer.Init(pool_buffer.data(), pool_buffer.size());
+    PointCloudKdTreeDecoder decoder;
+    std::unique_ptr<PointCloud> out_pc(new PointCloud());
+    DecoderOptions dec_options;
+    DRACO_ASSERT_OK(decoder.Decode(dec_options, &dec_buffer, out_pc.get()));
+    ASSERT_EQ(out_pc->num_points(), pc->num_points());
+  }
+
+  // Invalid number of partition levels.
+  EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+  options.SetGlobalInt("kd_tree_partition_levels", 100);
+  EncoderBuffer buffer;
+  PointCloudKdTreeEncoder encoder;
+  encoder.SetPointCloud(*pc);
+  ASSERT_FALSE(encoder.Encode(options, &buffer).ok());
+}
+
 TEST_F(PointCloudKdTreeEncodingTest, TestIntKdTreeEncoding) {
   constexpr int num_points = 120;
   std::vector<std::array<uint32_t, 3>> points(num_points);
@@ -120,6 +278,35 @@ TEST_F(PointCloudKdTreeEncodingTest, TestIntKdTreeEncoding) {
   TestKdTreeEncoding(*pc);
 }
 
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeEncodingPositionsAndColors) {
+  // Test the layouts of quantized positions followed by RGB or RGBA colors
+  // that are decoded with dedicated output iterators.
+  constexpr int num_points = 200;
+  for (const int num_color_components : {3, 4}) {
+    PointCloudBuilder builder;
+    builder.Start(num_points);
+    const int pos_att_id =
+        builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+    const int color_att_id = builder.AddAttribute(
+        GeometryAttribute::COLOR, num_color_components, DT_UINT8);
+    for (PointIndex i(0); i < num_points; ++i) {
+      const uint32_t v = i.value();
+      const float pos[3] = {static_cast<float>((v * 7) % 101) / 10.f,
+                            static_cast<float>((v * 13) % 97) / 5.f,
+                            static_cast<float>((v * 29) % 89) / 2.f};
+      const uint8_t color[4] = {static_cast<uint8_t>(v % 256),
+                                static_cast<uint8_t>((v * 3) % 256),
+                                static_cast<uint8_t>((v * 11) % 256), 255};
+      builder.SetAttributeValueForPoint(pos_att_id, i, pos);
+      builder.SetAttributeValueForPoint(color_att_id, i, color);
+    }
+    std::unique_ptr<PointCloud> pc = builder.Finalize(false);
+    ASSERT_NE(pc, nullptr);
+
+    TestKdTreeEncoding(*pc);
+  }
+}
+
 // test higher dimensions with more attributes
 TEST_F(PointCloudKdTreeEncodingTest, TestIntKdTreeEncodingHigherDimension) {
   constexpr int num_points = 120;
@@ -455,4 +642,48 @@ TEST_F(PointCloudKdTreeEncodingTest, TestIntKdTreeEncodingHighDimensional) {
   TestKdTreeEncoding(*pc);
 }
 
+TEST_F(PointCloudKdTreeEncodingTest, TestFloatPointsTreeEncoding) {
+  // Test that points quantized and dequantized by the parallel SIMD code of
+  // FloatPointsTreeEncoder/Decoder match the points processed by the generic
+  // QuantizePoints3() and DequantizePoints3() functions.
+  std::vector<Point3f> points;
+  for (int i = 0; i < 40001; ++i) {
+    points.push_back(Point3f(std::sin(0.37f * i) * 15.f,
+                             std::cos(0.11f * i) * 3.f - 1.f,
+                             0.001f * (i % 1001) - 0.5f));
+  }
+  QuantizationInfo qinfo;
+  qinfo.quantization_bits = 14;
+  std::vector<Point3ui> qpoints;
+  QuantizePoints3(points.begin(), points.end(), &qinfo,
+                  std::back_inserter(qpoints));
+  std::vector<Point3f> expected_points;
+  auto expected_it = std::back_inserter(expected_points);
+  DequantizePoints3(qpoints.begin(), qpoints.end(), qinfo, expected_it);
+
+  ThreadPool pool(2);
+  FloatPointsTreeEncoder encoder(KDTREE, qinfo.quantization_bits, 6);
+  encoder.set_thread_pool(&pool);
+  ASSERT_TRUE(encoder.EncodePointCloud(points.begin(), points.end()));
+  ASSERT_EQ(encoder.range(), qinfo.range);
+
+  DecoderBuffer buffer;
+  buffer.Init(encoder.buffer()->data(), encoder.buffer()->size());
+  buffer.set_bitstream_version(kDracoPointCloudBitstreamVersion);
+  FloatPointsTreeDecoder decoder;
+  decoder.set_thread_pool(&pool);
+  std::vector<Point3f> decoded_points;
+  ASSERT_TRUE(
+      decoder.DecodePointCloud(&buffer, std::back_inserter(decoded_points)));
+
+  // The kD-tree coding does not preserve the order of the points.
+  const auto less = [](const Point3f &a, const Point3f &b) {
+    return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                        b.data() + 3);
+  };
+  std::sort(expected_points.begin(), expected_points.end(), less);
+  std::sort(decoded_points.begin(), decoded_points.end(), less);
+  ASSERT_EQ(decoded_points, expected_points);
+}
+
 }  // namespace draco
@@ -0,0 +1,36 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_MORTON_ORDER_ENCODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_MORTON_ORDER_ENCODER_H_
+
+#include "draco/compression/point_cloud/point_cloud_sequential_encoder.h"
+
+namespace draco {
+
+// Point cloud encoder that encodes the points in the order of the Morton codes
+// of their positions using the same attribute encoders as the
+// PointCloudSequentialEncoder. Delta coding of the attribute values along
+// the space-filling curve compresses unordered point clouds much better than
+// the input order while it is considerably faster than the kD-tree encoding.
+// The encoded data is a regular sequential point cloud that is decoded by
+// PointCloudSequentialDecoder. The order of the points is not preserved.
+class PointCloudMortonOrderEncoder : public PointCloudSequentialEncoder {
+ protected:
+  bool GenerateAttributesEncoder(int32_t att_id) override;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_MORTON_ORDER_ENCODER_H_
@@ -12,11 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "draco/compression/decode.h"
+#include "draco/compression/point_cloud/point_cloud_chunked_sequential_encoder.h"
+#include "draco/compression/point_cloud/point_cloud_morton_order_encoder.h"
 #include "draco/compression/point_cloud/point_cloud_sequential_decoder.h"
 #include "draco/compression/point_cloud/point_cloud_sequential_encoder.h"
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
 #include "draco/io/obj_decoder.h"
+#include "draco/point_cloud/point_cloud_builder.h"
 
 namespace draco {
 
@@ -86,6 +97,140 @@ TEST_F(PointCloudSequentialEncodingTest, EncodingPointCloudWithMetadata) {
             pc->attribute(pos_att_id)->unique_id());
 }
 
+TEST_F(PointCloudSequentialEncodingTest, MortonOrderEncoding) {
+  // Test that points encoded in the Morton order of their positions are
+  // decoded by the sequential decoder and that the ordering improves the
+  // compression of an unordered point cloud.
+  constexpr int kGridSize = 32;
+  constexpr int kNumPoints = kGridSize * kGridSize * kGridSize;
+  std::vector<int> cells(kNumPoints);
+  for (int i = 0; i < kNumPoints; ++i) {
+    cells[i] = i;
+  }
+  std::shuffle(cells.begin(), cells.end(), std::mt19937(1));
+  PointCloudBuilder builder;
+  builder.Start(kNumPoints);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_UINT16);
+  for (PointIndex i(0); i < kNumPoints; ++i) {
+    const int cell = cells[i.value()];
+    const int row = cell / kGridSize;
+    const uint16_t pos[3] = {static_cast<uint16_t>(cell % kGridSize),
+                             static_cast<uint16_t>(row % kGridSize),
+                             static_cast<uint16_t>(row / kGridSize)};
+    builder.SetAttributeValueForPoint(pos_att_id, i, pos);
+  }
+  std::unique_ptr<PointCloud> pc = builder.Finalize(false);
+  ASSERT_NE(pc, nullptr);
+
+  const EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+  EncoderBuffer sequential_buffer;
+  PointCloudSequentialEncoder sequential_encoder;
+  sequential_encoder.SetPointCloud(*pc);
+  DRACO_ASSERT_OK(sequential_encoder.Encode(options, &sequential_buffer));
+
+  EncoderBuffer morton_buffer;
+  PointCloudMortonOrderEncoder morton_encoder;
+  morton_encoder.SetPointCloud(*pc);
+  DRACO_ASSERT_OK(morton_encoder.Encode(options, &morton_buffer));
+  ASSERT_LT(morton_buffer.size(), sequential_buffer.size());
+
+  // The encoded data must not depend on the thread pool.
+  ThreadPool pool(2);
+  EncoderOptions pool_options = options;
+  pool_options.SetThreadPool(&pool);
+  EncoderBuffer pool_buffer;
+  PointCloudMortonOrderEncoder pool_encoder;
+  pool_encoder.SetPointCloud(*pc);
+  DRACO_ASSERT_OK(pool_encoder.Encode(pool_options, &pool_buffer));
+  ASSERT_EQ(std::vector<char>(pool_buffer.data(),
+                              pool_buffer.data() + pool_buffer.size()),
+            std::vector<char>(morton_buffer.data(),
+                              morton_buffer.data() + morton_buffer.size()));
+
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(morton_buffer.data(), morton_buffer.size());
+  PointCloudSequentialDecoder decoder;
+  PointCloud decoded_pc;
+  DecoderOptions dec_options;
+  DRACO_ASSERT_OK(decoder.Decode(dec_options, &dec_buffer, &decoded_pc));
+  ASSERT_EQ(decoded_pc.num_points(), kNumPoints);
+
+  // The decoded points are a permutation of the input points.
+  std::vector<std::array<uint16_t, 3>> input_positions(kNumPoints);
+  std::vector<std::array<uint16_t, 3>> decoded_positions(kNumPoints);
+  const PointAttribute *const decoded_att =
+      decoded_pc.GetNamedAttribute(GeometryAttribute::POSITION);
+  ASSERT_NE(decoded_att, nullptr);
+  for (PointIndex i(0); i < kNumPoints; ++i) {
+    pc->attribute(pos_att_id)
+        ->GetMappedValue(i, input_positions[i.value()].data());
+    decoded_att->GetMappedValue(i, decoded_positions[i.value()].data());
+  }
+  ASSERT_NE(decoded_positions, input_positions);
+  std::sort(input_positions.begin(), input_positions.end());
+  std::sort(decoded_positions.begin(), decoded_positions.end());
+  ASSERT_EQ(decoded_positions, input_positions);
+}
+
+TEST_F(PointCloudSequentialEncodingTest, ChunkedSequentialEncoding) {
+  // Test that points encoded in independent blocks are decoded in the input
+  // order with the same values as the regular sequential encoding.
+  std::unique_ptr<PointCloud> pc = ReadPointCloudFromTestFile("test_nm.obj");
+  ASSERT_NE(pc, nullptr);
+  EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+  options.SetAttributeInt(0, "quantization_bits", 11);
+  options.SetGlobalInt("sequential_block_size", 16);
+
+  EncoderBuffer sequential_buffer;
+  PointCloudSequentialEncoder sequential_encoder;
+  sequential_encoder.SetPointCloud(*pc);
+  DRACO_ASSERT_OK(sequential_encoder.Encode(options, &sequential_buffer));
+
+  EncoderBuffer chunked_buffer;
+  PointCloudChunkedSequentialEncoder chunked_encoder;
+  chunked_encoder.SetPointCloud(*pc);
+  DRACO_ASSERT_OK(chunked_encoder.Encode(options, &chunked_buffer));
+
+  // The encoded data must not depend on the thread pool.
+  ThreadPool pool(2);
+  EncoderOptions pool_options = options;
+  pool_options.SetThreadPool(&pool);
+  EncoderBuffer pool_buffer;
+  PointCloudChunkedSequentialEncoder pool_encoder;
+  pool_encoder.SetPointCloud(*pc);
+  DRACO_ASSERT_OK(pool_encoder.Encode(pool_options, &pool_buffer));
+  ASSERT_EQ(std::vector<char>(pool_buffer.data(),
+                              pool_buffer.data() + pool_buffer.size()),
+            std::vector<char>(chunked_buffer.data(),
+                              chunked_buffer.data() + chunked_buffer.size()));
+
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(sequential_buffer.data(), sequential_buffer.size());
+  Decoder decoder;
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<PointCloud> sequential_pc,
+                         decoder.DecodePointCloudFromBuffer(&dec_buffer));
+  dec_buffer.Init(chunked_buffer.data(), chunked_buffer.size());
+  decoder.options()->SetThreadPool(&pool);
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<PointCloud> chunked_pc,
+                         decoder.DecodePointCloudFromBuffer(&dec_buffer));
+
+  ASSERT_EQ(chunked_pc->num_points(), pc->num_points());
+  ASSERT_EQ(chunked_pc->num_attributes(), sequential_pc->num_attributes());
+  for (int i = 0; i < chunked_pc->num_attributes(); ++i) {
+    const PointAttribute *const chunked_att = chunked_pc->attribute(i);
+    const PointAttribute *const sequential_att = sequential_pc->attribute(i);
+    ASSERT_EQ(chunked_att->attribute_type(), sequential_att->attribute_type());
+    ASSERT_EQ(chunked_att->unique_id(), sequential_att->unique_id());
+    const int value_size = chunked_att->byte_stride();
+    for (PointIndex p(0); p < pc->num_points(); ++p) {
+      ASSERT_EQ(memcmp(chunked_att->GetAddressOfMappedIndex(p),
+                       sequential_att->GetAddressOfMappedIndex(p), value_size),
+                0);
+    }
+  }
+}
+
 // TODO(ostava): Test the reusability of a single instance of the encoder and
 // decoder class.
 
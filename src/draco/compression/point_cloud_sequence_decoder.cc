@@ -0,0 +1,274 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/point_cloud_sequence_decoder.h"
+
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "draco/compression/bit_coders/rans_bit_decoder.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/core/bit_utils.h"
+#include "draco/core/varint_decoding.h"
+
+namespace draco {
+
+PointCloudSequenceDecoder::PointCloudSequenceDecoder()
+    : is_header_decoded_(false),
+      has_reference_frame_(false),
+      origin_{0.f, 0.f, 0.f},
+      cell_size_(0.f),
+      pos_unique_id_(0) {}
+
+Status PointCloudSequenceDecoder::DecodeHeader(DecoderBuffer *in_buffer) {
+  is_header_decoded_ = false;
+  has_reference_frame_ = false;
+  attributes_.clear();
+  previous_frame_ = PointCloudSequenceFrame();
+  char magic[5];
+  if (!in_buffer->Decode(magic, sizeof(magic)) ||
+      memcmp(magic, "DRPCS", 5) != 0) {
+    return Status(Status::DRACO_ERROR, "Not a Draco point cloud sequence.");
+  }
+  uint8_t version_major, version_minor;
+  if (!in_buffer->Decode(&version_major) ||
+      !in_buffer->Decode(&version_minor)) {
+    return Status(Status::IO_ERROR, "Failed to parse the sequence header.");
+  }
+  if (version_major != 1) {
+    return Status(Status::UNKNOWN_VERSION,
+                  "Unknown point cloud sequence version.");
+  }
+  uint32_t num_attributes;
+  if (!in_buffer->Decode(origin_, 3 * sizeof(float)) ||
+      !in_buffer->Decode(&cell_size_) || !in_buffer->Decode(&pos_unique_id_) ||
+      !DecodeVarint(&num_attributes, in_buffer)) {
+    return Status(Status::IO_ERROR, "Failed to parse the sequence header.");
+  }
+  // Each attribute takes eight bytes.
+  if (!(cell_size_ > 0.f) ||
+      num_attributes > in_buffer->remaining_size() / 8) {
+    return Status(Status::DRACO_ERROR, "Invalid sequence header.");
+  }
+  attributes_.resize(num_attributes);
+  for (AttributeLayout &att : attributes_) {
+    uint8_t type, data_type, num_components, normalized;
+    if (!in_buffer->Decode(&type) || !in_buffer->Decode(&data_type) ||
+        !in_buffer->Decode(&num_components) ||
+        !in_buffer->Decode(&normalized) || !in_buffer->Decode(&att.unique_id)) {
+      return Status(Status::IO_ERROR, "Failed to parse the sequence header.");
+    }
+    if (type >= GeometryAttribute::NAMED_ATTRIBUTES_COUNT ||
+        data_type == DT_INVALID || data_type >= DT_TYPES_COUNT ||
+        DataTypeLength(static_cast<DataType>(data_type)) > 4 ||
+        num_components == 0) {
+      return Status(Status::DRACO_ERROR, "Invalid attribute layout.");
+    }
+    att.type = static_cast<GeometryAttribute::Type>(type);
+    att.data_type = static_cast<DataType>(data_type);
+    att.num_components = num_components;
+    att.normalized = normalized != 0;
+  }
+  is_header_decoded_ = true;
+  return OkStatus();
+}
+
+StatusOr<std::unique_ptr<PointCloud>> PointCloudSequenceDecoder::DecodeFrame(
+    DecoderBuffer *in_buffer) {
+  if (!is_header_decoded_) {
+    return Status(Status::DRACO_ERROR, "Sequence header was not decoded.");
+  }
+  uint8_t is_keyframe;
+  if (!in_buffer->Decode(&is_keyframe)) {
+    return Status(Status::IO_ERROR, "Failed to parse the frame.");
+  }
+  if (!is_keyframe && !has_reference_frame_) {
+    return Status(Status::DRACO_ERROR, "Frame requires a reference frame.");
+  }
+  // Symbol and bit decoders depend on the bitstream version of the buffer.
+  DecoderBuffer frame_buffer;
+  frame_buffer.Init(in_buffer->data_head(), in_buffer->remaining_size(),
+                    kDracoMeshBitstreamVersion);
+  PointCloudSequenceFrame frame;
+  const Status status =
+      DecodeFrameInternal(&frame_buffer, is_keyframe != 0, &frame);
+  if (!status.ok()) {
+    // Following frames cannot be decoded until the next keyframe.
+    has_reference_frame_ = false;
+    previous_frame_ = PointCloudSequenceFrame();
+    return status;
+  }
+  in_buffer->Advance(frame_buffer.decoded_size());
+
+  const int num_points = static_cast<int>(frame.cells.size());
+  std::unique_ptr<PointCloud> pc(new PointCloud());
+  pc->set_num_points(num_points);
+  GeometryAttribute pos_ga;
+  pos_ga.Init(GeometryAttribute::POSITION, nullptr, 3, DT_FLOAT32, false,
+              3 * sizeof(float), 0);
+  const int pos_att_id = pc->AddAttribute(pos_ga, true, num_points);
+  PointAttribute *const pos_att = pc->attribute(pos_att_id);
+  pos_att->set_unique_id(pos_unique_id_);
+  for (int i = 0; i < num_points; ++i) {
+    uint32_t cell[3];
+    DecodePointCloudSequenceCell(frame.cells[i], cell);
+    float position[3];
+    for (int c = 0; c < 3; ++c) {
+      position[c] = origin_[c] + cell[c] * cell_size_;
+    }
+    pos_att->SetAttributeValue(AttributeValueIndex(i), position);
+  }
+  for (size_t a = 0; a < attributes_.size(); ++a) {
+    const AttributeLayout &layout = attributes_[a];
+    const int component_size = DataTypeLength(layout.data_type);
+    GeometryAttribute ga;
+    ga.Init(layout.type, nullptr, layout.num_components, layout.data_type,
+            layout.normalized, layout.num_components * component_size, 0);
+    const int att_id = pc->AddAttribute(ga, true, num_points);
+    PointAttribute *const att = pc->attribute(att_id);
+    att->set_unique_id(layout.unique_id);
+    const std::vector<uint32_t> &values = frame.values[a];
+    for (int i = 0; i < num_points; ++i) {
+      uint8_t *const value = att->GetAddress(AttributeValueIndex(i));
+      for (int c = 0; c < layout.num_components; ++c) {
+        memcpy(value + c * component_size,
+               &values[i * layout.num_components + c], component_size);
+      }
+    }
+  }
+  previous_frame_ = std::move(frame);
+  has_reference_frame_ = true;
+  return std::move(pc);
+}
+
+Status PointCloudSequenceDecoder::DecodeFrameInternal(
+    DecoderBuffer *in_buffer, bool is_keyframe,
+    PointCloudSequenceFrame *out_frame) {
+  uint32_t num_points;
+  if (!DecodeVarint(&num_points, in_buffer)) {
+    return Status(Status::IO_ERROR, "Failed to parse the frame.");
+  }
+  if (num_points > static_cast<uint32_t>(std::numeric_limits<int>::max())) {
+    return Status(Status::DRACO_ERROR, "Invalid number of points.");
+  }
+  const PointCloudSequenceFrame empty_frame;
+  const PointCloudSequenceFrame &prev =
+      is_keyframe ? empty_frame : previous_frame_;
+
+  // Indices of points of the previous frame that occupy the same cells in
+  // the current frame.
+  std::vector<int> kept_points;
+  if (!is_keyframe) {
+    RAnsBitDecoder match_decoder;
+    if (!match_decoder.StartDecoding(in_buffer)) {
+      return Status(Status::IO_ERROR, "Failed to parse the frame.");
+    }
+    for (size_t p = 0; p < prev.cells.size(); ++p) {
+      if (match_decoder.DecodeNextBit()) {
+        kept_points.push_back(static_cast<int>(p));
+      }
+    }
+    match_decoder.EndDecoding();
+  }
+  uint32_t num_added;
+  if (!DecodeVarint(&num_added, in_buffer)) {
+    return Status(Status::IO_ERROR, "Failed to parse the frame.");
+  }
+  if (num_added > num_points ||
+      kept_points.size() != static_cast<size_t>(num_points - num_added)) {
+    return Status(Status::DRACO_ERROR, "Invalid number of points.");
+  }
+  std::vector<uint64_t> added_cells(num_added);
+  if (num_added > 0) {
+    std::vector<uint32_t> delta_symbols(2 * num_added);
+    if (!DecodeSymbols(2 * num_added, 2, in_buffer, delta_symbols.data())) {
+      return Status(Status::IO_ERROR, "Failed to decode cells.");
+    }
+    uint64_t cell = 0;
+    for (uint32_t i = 0; i < num_added; ++i) {
+      if (delta_symbols[2 * i] > 0xffffff ||
+          delta_symbols[2 * i + 1] > 0xffffff) {
+        return Status(Status::DRACO_ERROR, "Invalid cell.");
+      }
+      cell += delta_symbols[2 * i] |
+              (static_cast<uint64_t>(delta_symbols[2 * i + 1]) << 24);
+      if (cell >> (3 * kPointCloudSequenceCellBits)) {
+        return Status(Status::DRACO_ERROR, "Invalid cell.");
+      }
+      added_cells[i] = cell;
+    }
+  }
+
+  // Merge kept and added cells. Kept points precede added points in the
+  // same cell.
+  out_frame->cells.resize(num_points);
+  std::vector<int> matches(num_points, -1);
+  size_t k = 0, n = 0;
+  for (uint32_t i = 0; i < num_points; ++i) {
+    if (k < kept_points.size() &&
+        (n == added_cells.size() ||
+         prev.cells[kept_points[k]] <= added_cells[n])) {
+      matches[i] = kept_points[k];
+      out_frame->cells[i] = prev.cells[kept_points[k++]];
+    } else {
+      out_frame->cells[i] = added_cells[n++];
+    }
+  }
+
+  out_frame->values.resize(attributes_.size());
+  for (size_t a = 0; a < attributes_.size(); ++a) {
+    const int num_components = attributes_[a].num_components;
+    const int component_size = DataTypeLength(attributes_[a].data_type);
+    const uint32_t mask =
+        component_size == 4 ? 0xffffffff : (1u << (8 * component_size)) - 1;
+    const size_t num_values = static_cast<size_t>(num_points) * num_components;
+    if (num_values > static_cast<size_t>(std::numeric_limits<int>::max())) {
+      return Status(Status::DRACO_ERROR, "Invalid number of points.");
+    }
+    std::vector<uint32_t> &values = out_frame->values[a];
+    values.resize(num_values);
+    if (num_values == 0) {
+      continue;
+    }
+    std::vector<uint32_t> symbols(num_values);
+    if (!DecodeSymbols(static_cast<uint32_t>(num_values), num_components,
+                       in_buffer, symbols.data())) {
+      return Status(Status::IO_ERROR, "Failed to decode attributes.");
+    }
+    std::vector<int32_t> residuals(num_values);
+    ConvertSymbolsToSignedInts(symbols.data(), static_cast<int>(num_values),
+                               residuals.data());
+    const std::vector<uint32_t> *const prev_values =
+        is_keyframe ? nullptr : &prev.values[a];
+    for (uint32_t i = 0; i < num_points; ++i) {
+      for (int c = 0; c < num_components; ++c) {
+        uint32_t prediction = 0;
+        if (matches[i] >= 0) {
+          prediction = (*prev_values)[matches[i] * num_components + c];
+        } else if (i > 0) {
+          prediction = values[(i - 1) * num_components + c];
+        }
+        values[i * num_components + c] =
+            (prediction + static_cast<uint32_t>(
+                              residuals[i * num_components + c])) &
+            mask;
+      }
+    }
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
@@ -0,0 +1,86 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_SEQUENCE_DECODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_SEQUENCE_DECODER_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "draco/compression/point_cloud_sequence_shared.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/core/status_or.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Streaming decoder of point cloud sequences encoded with
+// PointCloudSequenceEncoder (see point_cloud_sequence_encoder.h):
+//
+//   PointCloudSequenceDecoder decoder;
+//   DRACO_RETURN_IF_ERROR(decoder.DecodeHeader(&header_buffer));
+//   while (ReceivePacket(&packet)) {
+//     DRACO_ASSIGN_OR_RETURN(std::unique_ptr<PointCloud> frame,
+//                            decoder.DecodeFrame(&packet));
+//     Render(*frame);
+//   }
+//
+// Frames must be decoded in the order in which they were encoded, starting
+// with a keyframe.
+//
+class PointCloudSequenceDecoder {
+ public:
+  PointCloudSequenceDecoder();
+
+  // Decodes the sequence header from |in_buffer|.
+  Status DecodeHeader(DecoderBuffer *in_buffer);
+
+  // Decodes the next frame from |in_buffer|. The returned point cloud has a
+  // float position attribute followed by the other attributes in the order
+  // of the encoded layout. Points are sorted along the Morton curve of their
+  // cells, so their order generally differs from the encoded frame.
+  StatusOr<std::unique_ptr<PointCloud>> DecodeFrame(DecoderBuffer *in_buffer);
+
+  // Returns true when the next frame can be decoded, i.e., after a keyframe
+  // was decoded successfully.
+  bool has_reference_frame() const { return has_reference_frame_; }
+
+ private:
+  // Description of an encoded attribute.
+  struct AttributeLayout {
+    GeometryAttribute::Type type;
+    DataType data_type;
+    int num_components;
+    bool normalized;
+    uint32_t unique_id;
+  };
+
+  Status DecodeFrameInternal(DecoderBuffer *in_buffer, bool is_keyframe,
+                             PointCloudSequenceFrame *out_frame);
+
+  bool is_header_decoded_;
+  bool has_reference_frame_;
+  float origin_[3];
+  float cell_size_;
+  uint32_t pos_unique_id_;
+  std::vector<AttributeLayout> attributes_;
+  // State of the last decoded frame.
+  PointCloudSequenceFrame previous_frame_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_SEQUENCE_DECODER_H_
@@ -0,0 +1,257 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/point_cloud_sequence_encoder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#include "draco/compression/bit_coders/rans_bit_encoder.h"
+#include "draco/compression/entropy/symbol_encoding.h"
+#include "draco/core/bit_utils.h"
+#include "draco/core/varint_encoding.h"
+
+namespace draco {
+
+namespace {
+
+// Encodes signed |residuals| with |num_components| components.
+bool EncodeResiduals(const std::vector<int32_t> &residuals, int num_components,
+                     EncoderBuffer *out_buffer) {
+  if (residuals.empty()) {
+    return true;
+  }
+  std::vector<uint32_t> symbols(residuals.size());
+  ConvertSignedIntsToSymbols(residuals.data(),
+                             static_cast<int>(residuals.size()),
+                             symbols.data());
+  return EncodeSymbols(symbols.data(), static_cast<int>(symbols.size()),
+                       num_components, nullptr, out_buffer);
+}
+
+}  // namespace
+
+PointCloudSequenceEncoder::PointCloudSequenceEncoder()
+    : keyframe_interval_(10),
+      pos_att_id_(-1),
+      cell_size_(0.f),
+      num_encoded_frames_(0),
+      is_keyframe_requested_(false) {}
+
+Status PointCloudSequenceEncoder::EncodeHeader(const PointCloud &layout,
+                                               const Vector3f &origin,
+                                               float cell_size,
+                                               EncoderBuffer *out_buffer) {
+  pos_att_id_ = -1;
+  att_ids_.clear();
+  if (!(cell_size > 0.f) || !std::isfinite(cell_size)) {
+    return Status(Status::DRACO_ERROR, "Invalid cell size.");
+  }
+  const int pos_att_id =
+      layout.GetNamedAttributeId(GeometryAttribute::POSITION);
+  if (pos_att_id < 0 || layout.attribute(pos_att_id)->num_components() != 3) {
+    return Status(Status::DRACO_ERROR, "Missing position attribute.");
+  }
+  std::vector<int> att_ids;
+  for (int i = 0; i < layout.num_attributes(); ++i) {
+    if (i == pos_att_id) {
+      continue;
+    }
+    if (DataTypeLength(layout.attribute(i)->data_type()) > 4) {
+      return Status(Status::DRACO_ERROR, "Unsupported attribute data type.");
+    }
+    att_ids.push_back(i);
+  }
+
+  out_buffer->Encode("DRPCS", 5);
+  const uint8_t version_major = 1;
+  const uint8_t version_minor = 0;
+  out_buffer->Encode(version_major);
+  out_buffer->Encode(version_minor);
+  out_buffer->Encode(origin.data(), 3 * sizeof(float));
+  out_buffer->Encode(cell_size);
+  out_buffer->Encode(layout.attribute(pos_att_id)->unique_id());
+  EncodeVarint(static_cast<uint32_t>(att_ids.size()), out_buffer);
+  for (const int att_id : att_ids) {
+    const PointAttribute *const att = layout.attribute(att_id);
+    out_buffer->Encode(static_cast<uint8_t>(att->attribute_type()));
+    out_buffer->Encode(static_cast<uint8_t>(att->data_type()));
+    out_buffer->Encode(static_cast<uint8_t>(att->num_components()));
+    out_buffer->Encode(static_cast<uint8_t>(att->normalized()));
+    out_buffer->Encode(att->unique_id());
+  }
+  pos_att_id_ = pos_att_id;
+  att_ids_ = std::move(att_ids);
+  origin_ = origin;
+  cell_size_ = cell_size;
+  num_encoded_frames_ = 0;
+  is_keyframe_requested_ = false;
+  previous_frame_ = PointCloudSequenceFrame();
+  return OkStatus();
+}
+
+Status PointCloudSequenceEncoder::EncodeFrame(const PointCloud &frame,
+                                              EncoderBuffer *out_buffer) {
+  if (pos_att_id_ < 0) {
+    return Status(Status::DRACO_ERROR, "Sequence header was not encoded.");
+  }
+  if (keyframe_interval_ < 1) {
+    return Status(Status::DRACO_ERROR, "Invalid keyframe interval.");
+  }
+  const PointAttribute *const pos_att = frame.attribute(pos_att_id_);
+  if (frame.num_attributes() != static_cast<int>(att_ids_.size()) + 1 ||
+      pos_att == nullptr ||
+      pos_att->attribute_type() != GeometryAttribute::POSITION ||
+      pos_att->num_components() != 3) {
+    return Status(Status::DRACO_ERROR, "Frame has different attributes.");
+  }
+  const int num_attributes = static_cast<int>(att_ids_.size());
+  for (int a = 0; a < num_attributes; ++a) {
+    if (DataTypeLength(frame.attribute(att_ids_[a])->data_type()) > 4) {
+      return Status(Status::DRACO_ERROR, "Frame has different attributes.");
+    }
+  }
+
+  // Sort the points along the Morton curve of their cells.
+  const int num_points = frame.num_points();
+  std::vector<std::pair<uint64_t, uint32_t>> sorted_points(num_points);
+  const float max_cell = (1 << kPointCloudSequenceCellBits) - 1;
+  for (PointIndex pi(0); pi < num_points; ++pi) {
+    float position[3];
+    if (!pos_att->ConvertValue<float>(pos_att->mapped_index(pi), 3,
+                                      position)) {
+      return Status(Status::DRACO_ERROR, "Invalid position value.");
+    }
+    uint32_t cell[3];
+    for (int c = 0; c < 3; ++c) {
+      const float value =
+          std::floor((position[c] - origin_[c]) / cell_size_ + 0.5f);
+      // NaNs are moved to the first cell.
+      cell[c] = value > 0.f ? static_cast<uint32_t>(std::min(value, max_cell))
+                            : 0;
+    }
+    sorted_points[pi.value()] = {EncodePointCloudSequenceCell(cell),
+                                 pi.value()};
+  }
+  std::sort(sorted_points.begin(), sorted_points.end());
+
+  PointCloudSequenceFrame current_frame;
+  current_frame.cells.resize(num_points);
+  current_frame.values.resize(num_attributes);
+  for (int i = 0; i < num_points; ++i) {
+    current_frame.cells[i] = sorted_points[i].first;
+  }
+  for (int a = 0; a < num_attributes; ++a) {
+    const PointAttribute *const att = frame.attribute(att_ids_[a]);
+    const int num_components = att->num_components();
+    const int component_size = DataTypeLength(att->data_type());
+    std::vector<uint32_t> &values = current_frame.values[a];
+    values.resize(static_cast<size_t>(num_points) * num_components, 0);
+    for (int i = 0; i < num_points; ++i) {
+      const uint8_t *const value = att->GetAddress(
+          att->mapped_index(PointIndex(sorted_points[i].second)));
+      for (int c = 0; c < num_components; ++c) {
+        memcpy(&values[i * num_components + c], value + c * component_size,
+               component_size);
+      }
+    }
+  }
+
+  const bool is_keyframe = is_keyframe_requested_ ||
+                           num_encoded_frames_ % keyframe_interval_ == 0;
+  if (is_keyframe) {
+    previous_frame_ = PointCloudSequenceFrame();
+    previous_frame_.values.resize(num_attributes);
+  }
+
+  // Match points occupying the same cells in the previous and the current
+  // frame. Points of the current frame within a cell are matched first.
+  const PointCloudSequenceFrame &prev = previous_frame_;
+  const int num_prev_points = static_cast<int>(prev.cells.size());
+  std::vector<int> matches(num_points, -1);
+  std::vector<uint64_t> added_cells;
+  RAnsBitEncoder match_encoder;
+  match_encoder.StartEncoding();
+  int p = 0;
+  for (int i = 0; i < num_points; ++i) {
+    const uint64_t cell = current_frame.cells[i];
+    while (p < num_prev_points && prev.cells[p] < cell) {
+      match_encoder.EncodeBit(false);
+      ++p;
+    }
+    if (p < num_prev_points && prev.cells[p] == cell) {
+      match_encoder.EncodeBit(true);
+      matches[i] = p++;
+    } else {
+      added_cells.push_back(cell);
+    }
+  }
+  for (; p < num_prev_points; ++p) {
+    match_encoder.EncodeBit(false);
+  }
+
+  out_buffer->Encode(static_cast<uint8_t>(is_keyframe));
+  EncodeVarint(static_cast<uint32_t>(num_points), out_buffer);
+  if (!is_keyframe) {
+    match_encoder.EndEncoding(out_buffer);
+  }
+  EncodeVarint(static_cast<uint32_t>(added_cells.size()), out_buffer);
+  // Cell deltas have up to 48 bits. They are split into two components.
+  std::vector<uint32_t> delta_symbols(2 * added_cells.size());
+  uint64_t last_cell = 0;
+  for (size_t i = 0; i < added_cells.size(); ++i) {
+    const uint64_t delta = added_cells[i] - last_cell;
+    delta_symbols[2 * i] = static_cast<uint32_t>(delta & 0xffffff);
+    delta_symbols[2 * i + 1] = static_cast<uint32_t>(delta >> 24);
+    last_cell = added_cells[i];
+  }
+  if (!delta_symbols.empty() &&
+      !EncodeSymbols(delta_symbols.data(),
+                     static_cast<int>(delta_symbols.size()), 2, nullptr,
+                     out_buffer)) {
+    return Status(Status::DRACO_ERROR, "Failed to encode cells.");
+  }
+
+  // Encode attribute residuals.
+  for (int a = 0; a < num_attributes; ++a) {
+    const int num_components = frame.attribute(att_ids_[a])->num_components();
+    const std::vector<uint32_t> &values = current_frame.values[a];
+    const std::vector<uint32_t> &prev_values = prev.values[a];
+    std::vector<int32_t> residuals(values.size());
+    for (int i = 0; i < num_points; ++i) {
+      for (int c = 0; c < num_components; ++c) {
+        uint32_t prediction = 0;
+        if (matches[i] >= 0) {
+          prediction = prev_values[matches[i] * num_components + c];
+        } else if (i > 0) {
+          prediction = values[(i - 1) * num_components + c];
+        }
+        residuals[i * num_components + c] = static_cast<int32_t>(
+            values[i * num_components + c] - prediction);
+      }
+    }
+    if (!EncodeResiduals(residuals, num_components, out_buffer)) {
+      return Status(Status::DRACO_ERROR, "Failed to encode attributes.");
+    }
+  }
+
+  previous_frame_ = std::move(current_frame);
+  is_keyframe_requested_ = false;
+  ++num_encoded_frames_;
+  return OkStatus();
+}
+
+}  // namespace draco
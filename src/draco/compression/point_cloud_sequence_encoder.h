@@ -0,0 +1,100 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_SEQUENCE_ENCODER_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_SEQUENCE_ENCODER_H_
+
+#include <vector>
+
+#include "draco/compression/point_cloud_sequence_shared.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/core/vector_d.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Streaming encoder of point cloud sequences such as frames of a LiDAR sensor
+// (see PointCloudSequenceDecoder in point_cloud_sequence_decoder.h). Each
+// frame is encoded into a separate packet as soon as it is available, so the
+// encoding adds no latency.
+//
+// Positions are quantized into cells of a regular grid with 2^16 cells along
+// each axis and points are ordered along the Morton curve of their cells.
+// Frames other than keyframes are coded relative to the previous frame:
+//
+//   - For each point of the previous frame, a single entropy coded bit
+//     signals whether a point of the current frame occupies the same cell.
+//   - Cells of the remaining points are delta coded along the Morton curve.
+//   - Attribute values of points occupying a cell of the previous frame are
+//     predicted from the values of the previous frame, other values from the
+//     previous point. The residuals are entropy coded.
+//
+// Keyframes are coded without any reference, so that decoding can start at
+// them. Positions are decoded to the centers of their cells, all other
+// attributes are lossless. Attributes with 64-bit components are not
+// supported.
+//
+// Example:
+//
+//   PointCloudSequenceEncoder encoder;
+//   DRACO_RETURN_IF_ERROR(
+//       encoder.EncodeHeader(first_frame, origin, 0.01f, &header_buffer));
+//   for (each frame) {
+//     EncoderBuffer packet;
+//     DRACO_RETURN_IF_ERROR(encoder.EncodeFrame(frame, &packet));
+//     Send(packet);
+//   }
+//
+class PointCloudSequenceEncoder {
+ public:
+  PointCloudSequenceEncoder();
+
+  // Sets the number of frames between two keyframes.
+  void set_keyframe_interval(int interval) { keyframe_interval_ = interval; }
+  int keyframe_interval() const { return keyframe_interval_; }
+
+  // Starts a new sequence of frames with the attributes of |layout|. The
+  // values of |layout| are not used. Positions are quantized into cubic cells
+  // of size |cell_size| starting at |origin|. The header of the sequence,
+  // which must be passed to the decoder before any frame, is appended to
+  // |out_buffer|.
+  Status EncodeHeader(const PointCloud &layout, const Vector3f &origin,
+                      float cell_size, EncoderBuffer *out_buffer);
+
+  // Encodes |frame| and appends the packet to |out_buffer|. The frame must
+  // have the same attributes as the layout passed to EncodeHeader(). Points
+  // outside of the grid are moved to the closest cell.
+  Status EncodeFrame(const PointCloud &frame, EncoderBuffer *out_buffer);
+
+  // Makes the next encoded frame a keyframe, e.g. when a new receiver joins
+  // the stream.
+  void RequestKeyframe() { is_keyframe_requested_ = true; }
+
+ private:
+  int keyframe_interval_;
+  // Attribute ids of the layout in the order in which they are encoded.
+  int pos_att_id_;
+  std::vector<int> att_ids_;
+  Vector3f origin_;
+  float cell_size_;
+  int num_encoded_frames_;
+  bool is_keyframe_requested_;
+  // State of the last encoded frame, identical to the decoded state.
+  PointCloudSequenceFrame previous_frame_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_SEQUENCE_ENCODER_H_
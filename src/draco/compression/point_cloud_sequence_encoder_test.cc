@@ -0,0 +1,150 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/point_cloud_sequence_encoder.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "draco/compression/point_cloud_sequence_decoder.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace {
+
+constexpr float kCellSize = 0.01f;
+
+// Quantized point with its intensity.
+typedef std::array<int, 4> QuantizedPoint;
+
+// Returns a frame of a scene with static points and points moving with
+// |frame_id|.
+std::unique_ptr<draco::PointCloud> CreateFrame(int frame_id) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> coord(0.f, 5.f);
+  std::uniform_int_distribution<int> intensity(0, 4000);
+  const int num_static_points = 2000;
+  const int num_moving_points = 200;
+  std::unique_ptr<draco::PointCloud> pc(new draco::PointCloud());
+  pc->set_num_points(num_static_points + num_moving_points);
+  draco::GeometryAttribute pos_ga;
+  pos_ga.Init(draco::GeometryAttribute::POSITION, nullptr, 3,
+              draco::DT_FLOAT32, false, 3 * sizeof(float), 0);
+  draco::PointAttribute *const pos_att =
+      pc->attribute(pc->AddAttribute(pos_ga, true, pc->num_points()));
+  draco::GeometryAttribute intensity_ga;
+  intensity_ga.Init(draco::GeometryAttribute::GENERIC, nullptr, 1,
+                    draco::DT_UINT16, false, sizeof(uint16_t), 0);
+  draco::PointAttribute *const intensity_att =
+      pc->attribute(pc->AddAttribute(intensity_ga, true, pc->num_points()));
+  for (int i = 0; i < pc->num_points(); ++i) {
+    float pos[3] = {coord(rng), coord(rng), coord(rng)};
+    uint16_t value = static_cast<uint16_t>(intensity(rng));
+    if (i >= num_static_points) {
+      pos[0] += 0.05f * frame_id;
+      value = static_cast<uint16_t>(value + frame_id);
+    }
+    pos_att->SetAttributeValue(draco::AttributeValueIndex(i), pos);
+    intensity_att->SetAttributeValue(draco::AttributeValueIndex(i), &value);
+  }
+  return pc;
+}
+
+// Returns sorted quantized points of |pc|.
+std::vector<QuantizedPoint> GetQuantizedPoints(const draco::PointCloud &pc) {
+  const draco::PointAttribute *const pos_att =
+      pc.GetNamedAttribute(draco::GeometryAttribute::POSITION);
+  const draco::PointAttribute *const intensity_att =
+      pc.GetNamedAttribute(draco::GeometryAttribute::GENERIC);
+  std::vector<QuantizedPoint> points;
+  for (draco::PointIndex pi(0); pi < pc.num_points(); ++pi) {
+    float pos[3];
+    pos_att->GetMappedValue(pi, pos);
+    uint16_t value;
+    intensity_att->GetMappedValue(pi, &value);
+    QuantizedPoint point;
+    for (int c = 0; c < 3; ++c) {
+      point[c] = static_cast<int>(std::floor(pos[c] / kCellSize + 0.5f));
+    }
+    point[3] = value;
+    points.push_back(point);
+  }
+  std::sort(points.begin(), points.end());
+  return points;
+}
+
+TEST(PointCloudSequenceEncoderTest, TestRoundTrip) {
+  draco::PointCloudSequenceEncoder encoder;
+  encoder.set_keyframe_interval(5);
+  std::unique_ptr<draco::PointCloud> first_frame = CreateFrame(0);
+  draco::EncoderBuffer header;
+  DRACO_ASSERT_OK(encoder.EncodeHeader(
+      *first_frame, draco::Vector3f(0.f, 0.f, 0.f), kCellSize, &header));
+  draco::PointCloudSequenceDecoder decoder;
+  draco::DecoderBuffer header_buffer;
+  header_buffer.Init(header.data(), header.size());
+  DRACO_ASSERT_OK(decoder.DecodeHeader(&header_buffer));
+
+  std::vector<size_t> frame_sizes;
+  for (int f = 0; f < 10; ++f) {
+    std::unique_ptr<draco::PointCloud> frame = CreateFrame(f);
+    draco::EncoderBuffer packet;
+    DRACO_ASSERT_OK(encoder.EncodeFrame(*frame, &packet));
+    frame_sizes.push_back(packet.size());
+    draco::DecoderBuffer packet_buffer;
+    packet_buffer.Init(packet.data(), packet.size());
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::PointCloud> decoded,
+                           decoder.DecodeFrame(&packet_buffer));
+    ASSERT_EQ(packet_buffer.remaining_size(), 0);
+    ASSERT_EQ(decoded->num_points(), frame->num_points());
+    ASSERT_EQ(decoded->num_attributes(), 2);
+    ASSERT_EQ(GetQuantizedPoints(*decoded), GetQuantizedPoints(*frame));
+  }
+  // Frames predicted from static points are much smaller than keyframes.
+  for (int f = 1; f < 5; ++f) {
+    ASSERT_LT(2 * frame_sizes[f], frame_sizes[0]);
+    ASSERT_LT(2 * frame_sizes[f + 5], frame_sizes[5]);
+  }
+}
+
+TEST(PointCloudSequenceEncoderTest, TestMissingReferenceFrame) {
+  draco::PointCloudSequenceEncoder encoder;
+  std::unique_ptr<draco::PointCloud> frame = CreateFrame(0);
+  draco::EncoderBuffer header, keyframe, frame_packet;
+  DRACO_ASSERT_OK(encoder.EncodeHeader(
+      *frame, draco::Vector3f(0.f, 0.f, 0.f), kCellSize, &header));
+  DRACO_ASSERT_OK(encoder.EncodeFrame(*frame, &keyframe));
+  DRACO_ASSERT_OK(encoder.EncodeFrame(*CreateFrame(1), &frame_packet));
+
+  // A receiver joining the stream can't decode frames until a keyframe.
+  draco::PointCloudSequenceDecoder decoder;
+  draco::DecoderBuffer buffer;
+  buffer.Init(header.data(), header.size());
+  DRACO_ASSERT_OK(decoder.DecodeHeader(&buffer));
+  buffer.Init(frame_packet.data(), frame_packet.size());
+  ASSERT_FALSE(decoder.DecodeFrame(&buffer).ok());
+
+  encoder.RequestKeyframe();
+  draco::EncoderBuffer requested_keyframe;
+  DRACO_ASSERT_OK(encoder.EncodeFrame(*CreateFrame(2), &requested_keyframe));
+  buffer.Init(requested_keyframe.data(), requested_keyframe.size());
+  DRACO_ASSERT_OK(decoder.DecodeFrame(&buffer).status());
+  ASSERT_TRUE(decoder.has_reference_frame());
+}
+
+}  // namespace
@@ -0,0 +1,63 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_POINT_CLOUD_SEQUENCE_SHARED_H_
+#define DRACO_COMPRESSION_POINT_CLOUD_SEQUENCE_SHARED_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace draco {
+
+// Shared declarations used by both PointCloudSequenceEncoder and
+// PointCloudSequenceDecoder.
+
+// Number of bits of the cell coordinates of quantized positions along each
+// axis.
+constexpr int kPointCloudSequenceCellBits = 16;
+
+// Returns the Morton code of a cell with coordinates |cell|.
+inline uint64_t EncodePointCloudSequenceCell(const uint32_t cell[3]) {
+  uint64_t code = 0;
+  for (int b = kPointCloudSequenceCellBits - 1; b >= 0; --b) {
+    for (int c = 0; c < 3; ++c) {
+      code = (code << 1) | ((cell[c] >> b) & 1);
+    }
+  }
+  return code;
+}
+
+// Inverse of EncodePointCloudSequenceCell().
+inline void DecodePointCloudSequenceCell(uint64_t code, uint32_t cell[3]) {
+  cell[0] = cell[1] = cell[2] = 0;
+  for (int b = 0; b < kPointCloudSequenceCellBits; ++b) {
+    for (int c = 2; c >= 0; --c) {
+      cell[c] |= static_cast<uint32_t>(code & 1) << b;
+      code >>= 1;
+    }
+  }
+}
+
+// Decoded state of a frame that is used for prediction of the next frame.
+// Points are sorted by their cell codes. Attribute values are stored as raw
+// bits of each component extended to 32 bits.
+struct PointCloudSequenceFrame {
+  std::vector<uint64_t> cells;
+  // Values of each attribute except positions.
+  std::vector<std::vector<uint32_t>> values;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_POINT_CLOUD_SEQUENCE_SHARED_H_
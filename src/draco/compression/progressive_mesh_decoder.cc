@@ -0,0 +1,144 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/progressive_mesh_decoder.h"
+
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "draco/compression/decode.h"
+#include "draco/core/varint_decoding.h"
+
+namespace draco {
+
+ProgressiveMeshDecoder::ProgressiveMeshDecoder()
+    : finished_(false), header_size_(0), num_received_levels_(0) {}
+
+bool ProgressiveMeshDecoder::IsProgressiveMesh(DecoderBuffer *in_buffer) {
+  char magic[5];
+  if (!in_buffer->Peek(magic, sizeof(magic))) {
+    return false;
+  }
+  return memcmp(magic, "DRPRG", 5) == 0;
+}
+
+StatusOr<std::unique_ptr<Mesh>> ProgressiveMeshDecoder::DecodeMeshFromBuffer(
+    DecoderBuffer *in_buffer) {
+  DRACO_ASSIGN_OR_RETURN(const bool header_decoded, DecodeHeader(in_buffer));
+  if (!header_decoded) {
+    return Status(Status::IO_ERROR, "Failed to parse the container header.");
+  }
+  if (level_offsets_.back() > in_buffer->remaining_size()) {
+    return Status(Status::IO_ERROR, "Level data is truncated.");
+  }
+  DRACO_ASSIGN_OR_RETURN(
+      std::unique_ptr<Mesh> mesh,
+      DecodeLevel(in_buffer->data_head(), num_levels() - 1));
+  in_buffer->Advance(level_offsets_.back());
+  return std::move(mesh);
+}
+
+Status ProgressiveMeshDecoder::AppendData(const char *data, size_t data_size) {
+  if (finished_) {
+    return Status(Status::DRACO_ERROR, "Input was already finished.");
+  }
+  data_.insert(data_.end(), data, data + data_size);
+  if (num_levels() < 0) {
+    DecoderBuffer buffer;
+    buffer.Init(data_.data(), data_.size());
+    DRACO_ASSIGN_OR_RETURN(const bool header_decoded, DecodeHeader(&buffer));
+    if (!header_decoded) {
+      return OkStatus();
+    }
+    header_size_ = buffer.decoded_size();
+  }
+  // Find the finest level whose data was fully received.
+  const int64_t received_size =
+      static_cast<int64_t>(data_.size() - header_size_);
+  int num_received_levels = num_received_levels_;
+  while (num_received_levels < num_levels() &&
+         level_offsets_[num_received_levels + 1] <= received_size) {
+    ++num_received_levels;
+  }
+  if (num_received_levels == num_received_levels_) {
+    return OkStatus();
+  }
+  DRACO_ASSIGN_OR_RETURN(mesh_, DecodeLevel(data_.data() + header_size_,
+                                            num_received_levels - 1));
+  num_received_levels_ = num_received_levels;
+  return OkStatus();
+}
+
+Status ProgressiveMeshDecoder::Finish() {
+  finished_ = true;
+  if (num_levels() < 0 || num_received_levels_ < num_levels()) {
+    return Status(Status::IO_ERROR, "Incomplete input data.");
+  }
+  return OkStatus();
+}
+
+StatusOr<bool> ProgressiveMeshDecoder::DecodeHeader(DecoderBuffer *in_buffer) {
+  char magic[5];
+  if (!in_buffer->Decode(magic, sizeof(magic))) {
+    return false;
+  }
+  if (memcmp(magic, "DRPRG", 5) != 0) {
+    return Status(Status::DRACO_ERROR, "Not a progressive Draco mesh.");
+  }
+  uint8_t version_major, version_minor;
+  if (!in_buffer->Decode(&version_major) ||
+      !in_buffer->Decode(&version_minor)) {
+    return false;
+  }
+  if (version_major != 1) {
+    return Status(Status::UNKNOWN_VERSION,
+                  "Unknown progressive mesh container version.");
+  }
+  uint32_t num_levels;
+  if (!DecodeVarint(&num_levels, in_buffer)) {
+    return false;
+  }
+  // The maximum grid size of MeshVertexClustering limits the number of
+  // levels.
+  if (num_levels < 1 || num_levels > 32) {
+    return Status(Status::DRACO_ERROR, "Invalid number of levels.");
+  }
+  std::vector<int64_t> level_offsets(num_levels + 1, 0);
+  for (uint32_t i = 0; i < num_levels; ++i) {
+    uint64_t level_size;
+    if (!DecodeVarint(&level_size, in_buffer)) {
+      return false;
+    }
+    if (level_size > static_cast<uint64_t>(std::numeric_limits<int64_t>::max() -
+                                           level_offsets[i])) {
+      return Status(Status::DRACO_ERROR, "Invalid level size.");
+    }
+    level_offsets[i + 1] = level_offsets[i] + static_cast<int64_t>(level_size);
+  }
+  level_offsets_ = std::move(level_offsets);
+  return true;
+}
+
+StatusOr<std::unique_ptr<Mesh>> ProgressiveMeshDecoder::DecodeLevel(
+    const char *data, int level) {
+  DecoderBuffer buffer;
+  buffer.Init(data + level_offsets_[level],
+              level_offsets_[level + 1] - level_offsets_[level]);
+  Decoder decoder;
+  *decoder.options() = options_;
+  return decoder.DecodeMeshFromBuffer(&buffer);
+}
+
+}  // namespace draco
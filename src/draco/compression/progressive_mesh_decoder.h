@@ -0,0 +1,108 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_PROGRESSIVE_MESH_DECODER_H_
+#define DRACO_COMPRESSION_PROGRESSIVE_MESH_DECODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "draco/compression/config/decoder_options.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/core/status_or.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Decoder for meshes encoded with ProgressiveMeshEncoder (see
+// progressive_mesh_encoder.h). The encoded data can be provided in chunks as
+// it arrives, and each level of detail is decoded as soon as all of its data
+// has been received:
+//
+//   ProgressiveMeshDecoder decoder;
+//   while (ReceiveChunk(&chunk)) {
+//     DRACO_RETURN_IF_ERROR(decoder.AppendData(chunk.data(), chunk.size()));
+//     if (decoder.mesh()) {
+//       ShowPreview(*decoder.mesh());
+//     }
+//   }
+//   DRACO_RETURN_IF_ERROR(decoder.Finish());
+//   std::unique_ptr<Mesh> mesh = decoder.ReleaseMesh();
+//
+// When a single chunk of data completes multiple levels, only the finest of
+// them is decoded.
+class ProgressiveMeshDecoder {
+ public:
+  ProgressiveMeshDecoder();
+
+  // Returns true when |in_buffer| starts with a progressive mesh container.
+  // The buffer position is not changed.
+  static bool IsProgressiveMesh(DecoderBuffer *in_buffer);
+
+  // Decodes only the full resolution level from |in_buffer|, skipping over
+  // all coarse levels.
+  StatusOr<std::unique_ptr<Mesh>> DecodeMeshFromBuffer(
+      DecoderBuffer *in_buffer);
+
+  // Appends a chunk of encoded data and decodes the finest level of detail
+  // that can be decoded from the data received so far. Returns an error only
+  // when the received data is known to be invalid. The data is copied.
+  Status AppendData(const char *data, size_t data_size);
+
+  // Signals that all data was received. Returns an error if the full
+  // resolution level was not decoded.
+  Status Finish();
+
+  // Returns the number of levels in the container, or -1 when the container
+  // header was not received yet.
+  int num_levels() const { return static_cast<int>(level_offsets_.size()) - 1; }
+
+  // Returns the number of levels whose data was received so far. The finest
+  // of them is available as mesh().
+  int num_received_levels() const { return num_received_levels_; }
+
+  // Returns the finest decoded level of detail or nullptr if no level was
+  // decoded yet.
+  const Mesh *mesh() const { return mesh_.get(); }
+
+  // Transfers ownership of the decoded mesh to the caller.
+  std::unique_ptr<Mesh> ReleaseMesh() { return std::move(mesh_); }
+
+  // Returns the options used for decoding of each level.
+  DecoderOptions *options() { return &options_; }
+
+ private:
+  // Decodes the container header from |in_buffer| and stores offsets of all
+  // levels relative to the end of the header in |level_offsets_|. Returns
+  // false when more data is needed.
+  StatusOr<bool> DecodeHeader(DecoderBuffer *in_buffer);
+
+  // Decodes level |level| from |data|.
+  StatusOr<std::unique_ptr<Mesh>> DecodeLevel(const char *data, int level);
+
+  DecoderOptions options_;
+  std::vector<char> data_;
+  bool finished_;
+  // Size of the container header, valid once the header was decoded.
+  size_t header_size_;
+  // Offsets of all levels followed by the end of the last level.
+  std::vector<int64_t> level_offsets_;
+  int num_received_levels_;
+  std::unique_ptr<Mesh> mesh_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_PROGRESSIVE_MESH_DECODER_H_
@@ -0,0 +1,102 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/progressive_mesh_encoder.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "draco/compression/expert_encode.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/varint_encoding.h"
+#include "draco/mesh/mesh_vertex_clustering.h"
+
+namespace draco {
+
+ProgressiveMeshEncoder::ProgressiveMeshEncoder()
+    : num_levels_(3), base_grid_size_(32), num_encoded_levels_(0) {}
+
+Status ProgressiveMeshEncoder::EncodeMeshToBuffer(const Mesh &mesh,
+                                                  const Encoder &encoder,
+                                                  EncoderBuffer *out_buffer) {
+  return EncodeMeshToBuffer(mesh, encoder.CreateExpertEncoderOptions(mesh),
+                            out_buffer);
+}
+
+Status ProgressiveMeshEncoder::EncodeMeshToBuffer(
+    const Mesh &mesh, const EncoderOptions &options,
+    EncoderBuffer *out_buffer) {
+  num_encoded_levels_ = 0;
+  if (num_levels_ < 1 || base_grid_size_ < 1 ||
+      (num_levels_ > 1 &&
+       static_cast<int64_t>(base_grid_size_) << (num_levels_ - 2) >
+           (1 << 20))) {
+    return Status(Status::DRACO_ERROR, "Invalid level of detail settings.");
+  }
+  ThreadPool *const pool = options.thread_pool();
+
+  // Generate the coarse levels.
+  const int num_coarse_levels = num_levels_ - 1;
+  std::vector<std::unique_ptr<Mesh>> coarse_levels(num_coarse_levels);
+  std::vector<Status> level_statuses(num_levels_);
+  ParallelFor(pool, num_coarse_levels, [&](int i) {
+    StatusOr<std::unique_ptr<Mesh>> level_or =
+        MeshVertexClustering::Simplify(mesh, base_grid_size_ << i);
+    level_statuses[i] = level_or.status();
+    if (level_or.ok()) {
+      coarse_levels[i] = std::move(level_or).value();
+    }
+  });
+  for (int i = 0; i < num_coarse_levels; ++i) {
+    DRACO_RETURN_IF_ERROR(level_statuses[i]);
+  }
+  std::vector<const Mesh *> levels;
+  for (int i = 0; i < num_coarse_levels; ++i) {
+    if (coarse_levels[i]->num_faces() > 0) {
+      levels.push_back(coarse_levels[i].get());
+    }
+  }
+  levels.push_back(&mesh);
+
+  const int num_encoded_levels = static_cast<int>(levels.size());
+  std::vector<EncoderBuffer> level_buffers(num_encoded_levels);
+  ParallelFor(pool, num_encoded_levels, [&](int i) {
+    // The attributes of all levels match the attributes of |mesh| so the same
+    // attribute options can be used for all of them.
+    ExpertEncoder level_encoder(*levels[i]);
+    level_encoder.Reset(options);
+    level_statuses[i] = level_encoder.EncodeToBuffer(&level_buffers[i]);
+  });
+  for (int i = 0; i < num_encoded_levels; ++i) {
+    DRACO_RETURN_IF_ERROR(level_statuses[i]);
+  }
+
+  out_buffer->Encode("DRPRG", 5);
+  const uint8_t version_major = 1;
+  const uint8_t version_minor = 0;
+  out_buffer->Encode(version_major);
+  out_buffer->Encode(version_minor);
+  EncodeVarint(static_cast<uint32_t>(num_encoded_levels), out_buffer);
+  for (int i = 0; i < num_encoded_levels; ++i) {
+    EncodeVarint(static_cast<uint64_t>(level_buffers[i].size()), out_buffer);
+  }
+  for (int i = 0; i < num_encoded_levels; ++i) {
+    out_buffer->Encode(level_buffers[i].data(), level_buffers[i].size());
+  }
+  num_encoded_levels_ = num_encoded_levels;
+  return OkStatus();
+}
+
+}  // namespace draco
@@ -0,0 +1,86 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_PROGRESSIVE_MESH_ENCODER_H_
+#define DRACO_COMPRESSION_PROGRESSIVE_MESH_ENCODER_H_
+
+#include "draco/compression/config/encoder_options.h"
+#include "draco/compression/encode.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Encoder that stores a mesh as a sequence of levels of detail, starting with
+// a coarse approximation of the mesh and ending with the full resolution mesh.
+// A client receiving the data can display the coarse levels while the rest of
+// the data is still being downloaded (see ProgressiveMeshDecoder in
+// progressive_mesh_decoder.h).
+//
+// The coarse levels are generated with MeshVertexClustering. The coarsest
+// level uses a grid with base_grid_size() cells along the longest axis of the
+// mesh and the grid size is doubled for each following level. Levels that
+// would have no faces are skipped. Because each coarse level has roughly a
+// quarter of the faces of the next one, all coarse levels together typically
+// add less than a third to the size of the full resolution mesh.
+//
+// Each level is encoded as a regular Draco bitstream with the same options.
+// The levels are encoded on the thread pool set in the encoder options, if
+// any. Geometry metadata is stored only with the last level.
+//
+// The encoded data is stored in the following container:
+//
+//   "DRPRG"                       Magic string (5 bytes).
+//   uint8_t major_version         Container version (currently 1.0).
+//   uint8_t minor_version
+//   varint num_levels
+//   varint level_size[num_levels] Size of each encoded level in bytes.
+//   level data                    Draco bitstream of each level, ordered from
+//                                 the coarsest to the full resolution mesh.
+//
+class ProgressiveMeshEncoder {
+ public:
+  ProgressiveMeshEncoder();
+
+  // Sets the total number of levels including the full resolution mesh.
+  void set_num_levels(int num_levels) { num_levels_ = num_levels; }
+  int num_levels() const { return num_levels_; }
+
+  // Sets the grid size used for the coarsest level.
+  void set_base_grid_size(int grid_size) { base_grid_size_ = grid_size; }
+  int base_grid_size() const { return base_grid_size_; }
+
+  // Encodes |mesh| into |out_buffer| using the options of |encoder| for each
+  // level.
+  Status EncodeMeshToBuffer(const Mesh &mesh, const Encoder &encoder,
+                            EncoderBuffer *out_buffer);
+
+  // Encodes |mesh| into |out_buffer| using |options| for each level. Attribute
+  // options are specified for attribute ids of |mesh| as in ExpertEncoder.
+  Status EncodeMeshToBuffer(const Mesh &mesh, const EncoderOptions &options,
+                            EncoderBuffer *out_buffer);
+
+  // Returns the number of levels created by the last successful encoding.
+  int num_encoded_levels() const { return num_encoded_levels_; }
+
+ private:
+  int num_levels_;
+  int base_grid_size_;
+  int num_encoded_levels_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_PROGRESSIVE_MESH_ENCODER_H_
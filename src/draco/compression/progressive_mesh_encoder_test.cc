@@ -0,0 +1,182 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/progressive_mesh_encoder.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "draco/compression/decode.h"
+#include "draco/compression/progressive_mesh_decoder.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+
+namespace {
+
+class ProgressiveMeshEncoderTest : public ::testing::Test {
+ protected:
+  ProgressiveMeshEncoderTest() {
+    encoder_.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 11);
+    encoder_.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 8);
+    encoder_.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD,
+                                      10);
+  }
+
+  // Encodes |mesh| progressively and returns the encoded data.
+  std::vector<char> EncodeMesh(const draco::Mesh &mesh, int num_levels) {
+    draco::ProgressiveMeshEncoder progressive_encoder;
+    progressive_encoder.set_num_levels(num_levels);
+    progressive_encoder.set_base_grid_size(8);
+    draco::EncoderBuffer buffer;
+    EXPECT_TRUE(
+        progressive_encoder.EncodeMeshToBuffer(mesh, encoder_, &buffer).ok());
+    EXPECT_GE(progressive_encoder.num_encoded_levels(), 1);
+    EXPECT_LE(progressive_encoder.num_encoded_levels(), num_levels);
+    return *buffer.buffer();
+  }
+
+  // Returns the mesh decoded from a regular encoding of |mesh|.
+  std::unique_ptr<draco::Mesh> EncodeAndDecodeMesh(const draco::Mesh &mesh) {
+    draco::EncoderBuffer buffer;
+    EXPECT_TRUE(encoder_.EncodeMeshToBuffer(mesh, &buffer).ok());
+    draco::DecoderBuffer decoder_buffer;
+    decoder_buffer.Init(buffer.data(), buffer.size());
+    draco::Decoder decoder;
+    return decoder.DecodeMeshFromBuffer(&decoder_buffer).value();
+  }
+
+  // Streams |data| into a progressive decoder in chunks of |chunk_size| bytes
+  // and checks that the levels of detail get finer as data arrives.
+  void TestStream(const std::vector<char> &data, size_t chunk_size,
+                  const draco::Mesh &expected) {
+    draco::ProgressiveMeshDecoder decoder;
+    int last_num_received_levels = 0;
+    int last_num_faces = 0;
+    for (size_t pos = 0; pos < data.size(); pos += chunk_size) {
+      const size_t size = std::min(chunk_size, data.size() - pos);
+      DRACO_ASSERT_OK(decoder.AppendData(data.data() + pos, size));
+      ASSERT_GE(decoder.num_received_levels(), last_num_received_levels);
+      if (decoder.num_received_levels() > last_num_received_levels) {
+        ASSERT_NE(decoder.mesh(), nullptr);
+        ASSERT_GT(decoder.mesh()->num_faces(), last_num_faces);
+        ASSERT_EQ(decoder.mesh()->num_attributes(), expected.num_attributes());
+        last_num_faces = decoder.mesh()->num_faces();
+      }
+      last_num_received_levels = decoder.num_received_levels();
+    }
+    DRACO_ASSERT_OK(decoder.Finish());
+    ASSERT_EQ(decoder.num_received_levels(), decoder.num_levels());
+    std::unique_ptr<draco::Mesh> mesh = decoder.ReleaseMesh();
+    ASSERT_NE(mesh, nullptr);
+    ASSERT_EQ(mesh->num_faces(), expected.num_faces());
+    ASSERT_EQ(mesh->num_points(), expected.num_points());
+  }
+
+  draco::Encoder encoder_;
+};
+
+TEST_F(ProgressiveMeshEncoderTest, TestStreamLevels) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  const std::vector<char> data = EncodeMesh(*mesh, 3);
+  const std::unique_ptr<draco::Mesh> expected = EncodeAndDecodeMesh(*mesh);
+  for (const size_t chunk_size : {1000, 16384, 1 << 20}) {
+    TestStream(data, chunk_size, *expected);
+  }
+}
+
+TEST_F(ProgressiveMeshEncoderTest, TestLevelSizes) {
+  // Tests that coarse levels are received first and that they add only
+  // a fraction to the size of the full resolution mesh.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  const std::vector<char> data = EncodeMesh(*mesh, 4);
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder_.EncodeMeshToBuffer(*mesh, &buffer));
+  ASSERT_LT(data.size(), buffer.size() * 3 / 2);
+
+  draco::ProgressiveMeshDecoder decoder;
+  DRACO_ASSERT_OK(decoder.AppendData(data.data(), data.size() / 4));
+  ASSERT_EQ(decoder.num_levels(), 4);
+  ASSERT_GE(decoder.num_received_levels(), 1);
+  ASSERT_LT(decoder.num_received_levels(), decoder.num_levels());
+  ASSERT_NE(decoder.mesh(), nullptr);
+  ASSERT_LT(decoder.mesh()->num_faces(), mesh->num_faces());
+}
+
+TEST_F(ProgressiveMeshEncoderTest, TestDecodeFullResolution) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("car.drc");
+  ASSERT_NE(mesh, nullptr);
+  draco::ThreadPool pool(2);
+  encoder_.options().SetThreadPool(&pool);
+  const std::vector<char> data = EncodeMesh(*mesh, 3);
+  const std::unique_ptr<draco::Mesh> expected = EncodeAndDecodeMesh(*mesh);
+
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  ASSERT_TRUE(draco::ProgressiveMeshDecoder::IsProgressiveMesh(&buffer));
+  draco::ProgressiveMeshDecoder decoder;
+  std::unique_ptr<draco::Mesh> decoded =
+      decoder.DecodeMeshFromBuffer(&buffer).value();
+  ASSERT_NE(decoded, nullptr);
+  ASSERT_EQ(buffer.remaining_size(), 0);
+  ASSERT_EQ(decoded->num_faces(), expected->num_faces());
+  ASSERT_EQ(decoded->num_points(), expected->num_points());
+}
+
+TEST_F(ProgressiveMeshEncoderTest, TestSingleLevel) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  const std::vector<char> data = EncodeMesh(*mesh, 1);
+  const std::unique_ptr<draco::Mesh> expected = EncodeAndDecodeMesh(*mesh);
+  TestStream(data, 7, *expected);
+}
+
+TEST_F(ProgressiveMeshEncoderTest, TestInvalidInput) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::ProgressiveMeshEncoder progressive_encoder;
+  progressive_encoder.set_num_levels(0);
+  draco::EncoderBuffer buffer;
+  ASSERT_FALSE(
+      progressive_encoder.EncodeMeshToBuffer(*mesh, encoder_, &buffer).ok());
+
+  // Truncated input.
+  const std::vector<char> data = EncodeMesh(*mesh, 3);
+  draco::ProgressiveMeshDecoder decoder;
+  DRACO_ASSERT_OK(decoder.AppendData(data.data(), data.size() - 1));
+  ASSERT_NE(decoder.mesh(), nullptr);
+  ASSERT_FALSE(decoder.Finish().ok());
+  draco::DecoderBuffer decoder_buffer;
+  decoder_buffer.Init(data.data(), data.size() - 1);
+  draco::ProgressiveMeshDecoder full_decoder;
+  ASSERT_FALSE(full_decoder.DecodeMeshFromBuffer(&decoder_buffer).ok());
+
+  // Regular Draco bitstream.
+  DRACO_ASSERT_OK(encoder_.EncodeMeshToBuffer(*mesh, &buffer));
+  decoder_buffer.Init(buffer.data(), buffer.size());
+  ASSERT_FALSE(
+      draco::ProgressiveMeshDecoder::IsProgressiveMesh(&decoder_buffer));
+  draco::ProgressiveMeshDecoder regular_decoder;
+  ASSERT_FALSE(regular_decoder.AppendData(buffer.data(), buffer.size()).ok());
+}
+
+}  // namespace
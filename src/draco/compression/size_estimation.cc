@@ -0,0 +1,523 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/size_estimation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/attributes/normal_compression_utils.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/entropy/rans_symbol_coding.h"
+#include "draco/compression/entropy/shannon_entropy.h"
+#include "draco/compression/mesh/mesh_sequential_encoder.h"
+#include "draco/core/bit_utils.h"
+#include "draco/core/quantization_utils.h"
+#include "draco/mesh/corner_table.h"
+#include "draco/mesh/mesh_misc_functions.h"
+
+namespace draco {
+
+namespace {
+
+// Size of the Draco header in bytes.
+constexpr int64_t kDracoHeaderBytes = 11;
+
+// Approximate size of the description of an attribute, its decoder and its
+// prediction scheme in bytes.
+constexpr int64_t kAttributeHeaderBytes = 8;
+
+// Typical number of bits per face of the Edgebreaker connectivity coding,
+// including the traversal data, for meshes with few topological handles.
+constexpr double kEdgebreakerBitsPerFace = 1.7;
+
+// Symbols up to this value are estimated directly. Larger symbols are split
+// into their bit length and raw bits like in the tagged symbol coding.
+constexpr uint32_t kMaxDirectSymbol = (1 << 16) - 1;
+
+// Returns the estimated number of bits of |symbols| coded with
+// EncodeSymbols().
+int64_t EstimateSymbolBits(const std::vector<uint32_t> &symbols) {
+  if (symbols.empty()) {
+    return 0;
+  }
+  const int num_symbols = static_cast<int>(symbols.size());
+  const uint32_t max_symbol = *std::max_element(symbols.begin(), symbols.end());
+  int num_unique_symbols = 0;
+  if (max_symbol <= kMaxDirectSymbol) {
+    const int64_t bits = ComputeShannonEntropy(
+        symbols.data(), num_symbols, max_symbol, &num_unique_symbols);
+    return bits + ApproximateRAnsFrequencyTableBits(max_symbol + 1,
+                                                    num_unique_symbols);
+  }
+  std::vector<uint32_t> bit_lengths(symbols.size());
+  int64_t raw_bits = 0;
+  for (int i = 0; i < num_symbols; ++i) {
+    bit_lengths[i] =
+        symbols[i] == 0 ? 0 : MostSignificantBit(symbols[i]) + 1;
+    raw_bits += bit_lengths[i];
+  }
+  const int64_t bits = ComputeShannonEntropy(bit_lengths.data(), num_symbols,
+                                             32, &num_unique_symbols);
+  return bits + ApproximateRAnsFrequencyTableBits(33, num_unique_symbols) +
+         raw_bits;
+}
+
+// Returns the encoding method ExpertEncoder would use for |pc| with
+// |options|.
+StatusOr<int> GetEncodingMethod(const PointCloud &pc, bool is_mesh,
+                                const EncoderOptions &options) {
+  const int encoding_method =
+      options.GetGlobalInt(GetEncoderOptionKeys().encoding_method, -1);
+  if (is_mesh) {
+    if (encoding_method == -1) {
+      return options.GetSpeed() == 10 ? MESH_SEQUENTIAL_ENCODING
+                                      : MESH_EDGEBREAKER_ENCODING;
+    }
+    return encoding_method == MESH_EDGEBREAKER_ENCODING
+               ? MESH_EDGEBREAKER_ENCODING
+               : MESH_SEQUENTIAL_ENCODING;
+  }
+  if (encoding_method == POINT_CLOUD_MORTON_ORDER_ENCODING) {
+    return POINT_CLOUD_MORTON_ORDER_ENCODING;
+  }
+  // The chunked sequential encoding is estimated without the small overhead
+  // of the blocks.
+  if (encoding_method == POINT_CLOUD_SEQUENTIAL_ENCODING ||
+      encoding_method == POINT_CLOUD_CHUNKED_SEQUENTIAL_ENCODING ||
+      (encoding_method == -1 && options.GetSpeed() == 10)) {
+    return POINT_CLOUD_SEQUENTIAL_ENCODING;
+  }
+  // Same conditions as in ExpertEncoder::EncodePointCloudToBuffer().
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    const DataType data_type = pc.attribute(i)->data_type();
+    const bool kd_tree_possible =
+        data_type == DT_FLOAT32
+            ? options.GetAttributeInt(
+                  i, GetEncoderOptionKeys().quantization_bits, -1) > 0
+            : (data_type == DT_UINT32 || data_type == DT_UINT16 ||
+               data_type == DT_UINT8 || data_type == DT_INT32 ||
+               data_type == DT_INT16 || data_type == DT_INT8);
+    if (!kd_tree_possible) {
+      if (encoding_method == POINT_CLOUD_KD_TREE_ENCODING) {
+        return Status(Status::DRACO_ERROR, "Invalid encoding method.");
+      }
+      return POINT_CLOUD_SEQUENTIAL_ENCODING;
+    }
+  }
+  return POINT_CLOUD_KD_TREE_ENCODING;
+}
+
+// Converts all values of |att| into the integers that are passed to the
+// prediction, i.e. quantized values of floating point attributes and
+// octahedral coordinates of normals. Returns false when the values are
+// encoded without integer coding.
+bool GetIntegerValues(const PointAttribute &att, int quantization_bits,
+                      std::vector<int32_t> *values, int *num_components) {
+  const int num_values = static_cast<int>(att.size());
+  if (att.data_type() == DT_FLOAT32 || att.data_type() == DT_FLOAT64) {
+    if (quantization_bits <= 0) {
+      return false;
+    }
+    if (att.attribute_type() == GeometryAttribute::NORMAL &&
+        att.num_components() == 3) {
+      OctahedronToolBox octahedron_tool_box;
+      if (!octahedron_tool_box.SetQuantizationBits(quantization_bits)) {
+        return false;
+      }
+      *num_components = 2;
+      values->resize(2 * num_values);
+      float normal[3];
+      for (AttributeValueIndex i(0); i < num_values; ++i) {
+        att.ConvertValue<float, 3>(i, normal);
+        octahedron_tool_box.FloatVectorToQuantizedOctahedralCoords(
+            normal, &(*values)[2 * i.value()], &(*values)[2 * i.value() + 1]);
+      }
+      return true;
+    }
+    AttributeQuantizationTransform transform;
+    if (!transform.ComputeParameters(att, quantization_bits)) {
+      return false;
+    }
+    Quantizer quantizer;
+    quantizer.Init(transform.range(), (1 << quantization_bits) - 1);
+    *num_components = att.num_components();
+    values->resize(att.num_components() * num_values);
+    std::vector<float> value(att.num_components());
+    for (AttributeValueIndex i(0); i < num_values; ++i) {
+      att.ConvertValue<float>(i, att.num_components(), value.data());
+      for (int c = 0; c < att.num_components(); ++c) {
+        (*values)[att.num_components() * i.value() + c] =
+            quantizer.QuantizeFloat(value[c] - transform.min_value(c));
+      }
+    }
+    return true;
+  }
+  if (DataTypeLength(att.data_type()) > 4) {
+    return false;
+  }
+  *num_components = att.num_components();
+  values->resize(att.num_components() * num_values);
+  for (AttributeValueIndex i(0); i < num_values; ++i) {
+    if (!att.ConvertValue<int32_t>(i, att.num_components(),
+                                   &(*values)[att.num_components() *
+                                              i.value()])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Appends the symbols of the residuals |value| - |prediction| for all
+// components to |symbols|.
+void AppendResiduals(const int32_t *value, const int32_t *prediction,
+                     int num_components, std::vector<uint32_t> *symbols) {
+  for (int c = 0; c < num_components; ++c) {
+    const int32_t residual = static_cast<int32_t>(
+        static_cast<uint32_t>(value[c]) -
+        static_cast<uint32_t>(prediction ? prediction[c] : 0));
+    symbols->push_back(ConvertSignedIntToSymbol(residual));
+  }
+}
+
+// Returns the residual symbols of values |sequence| predicted from the
+// previous value in the sequence, or not predicted at all.
+std::vector<uint32_t> ComputeSequenceResiduals(
+    const std::vector<int32_t> &values, int num_components,
+    const std::vector<AttributeValueIndex> &sequence, bool use_prediction) {
+  std::vector<uint32_t> symbols;
+  symbols.reserve(num_components * sequence.size());
+  const std::vector<int32_t> zero(num_components, 0);
+  const int32_t *prev = zero.data();
+  for (const AttributeValueIndex avi : sequence) {
+    const int32_t *const value = &values[num_components * avi.value()];
+    AppendResiduals(value, use_prediction ? prev : nullptr, num_components,
+                    &symbols);
+    prev = value;
+  }
+  return symbols;
+}
+
+// Returns the faces of |mesh| in a depth-first order over face adjacency,
+// which approximates the Edgebreaker traversal.
+std::vector<FaceIndex> ComputeFaceTraversal(const Mesh &mesh) {
+  std::vector<FaceIndex> order;
+  order.reserve(mesh.num_faces());
+  const std::unique_ptr<CornerTable> corner_table =
+      CreateCornerTableFromPositionAttribute(&mesh);
+  if (corner_table == nullptr) {
+    for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+      order.push_back(fi);
+    }
+    return order;
+  }
+  std::vector<bool> visited(mesh.num_faces(), false);
+  std::vector<FaceIndex> stack;
+  for (FaceIndex start(0); start < mesh.num_faces(); ++start) {
+    stack.push_back(start);
+    while (!stack.empty()) {
+      const FaceIndex fi = stack.back();
+      stack.pop_back();
+      if (visited[fi.value()]) {
+        continue;
+      }
+      visited[fi.value()] = true;
+      order.push_back(fi);
+      for (int c = 2; c >= 0; --c) {
+        const CornerIndex opp =
+            corner_table->Opposite(corner_table->FirstCorner(fi) + c);
+        if (opp != kInvalidCornerIndex &&
+            !visited[corner_table->Face(opp).value()]) {
+          stack.push_back(corner_table->Face(opp));
+        }
+      }
+    }
+  }
+  return order;
+}
+
+// Returns the residual symbols of the values of |att| visited in the order of
+// |faces| of |mesh|. A new value is predicted with the parallelogram rule
+// from a previous face sharing the edge opposite to the value, when there is
+// one, and from the previously visited value otherwise.
+std::vector<uint32_t> ComputeParallelogramResiduals(
+    const Mesh &mesh, const std::vector<FaceIndex> &faces,
+    const PointAttribute &att, const std::vector<int32_t> &values,
+    int num_components) {
+  std::vector<uint32_t> symbols;
+  symbols.reserve(num_components * att.size());
+  std::vector<bool> visited(att.size(), false);
+  // Maps edges to the value opposite to the edge in the first face using it.
+  std::unordered_map<uint64_t, uint32_t> opposite_values;
+  opposite_values.reserve(3 * mesh.num_faces());
+  const auto edge_key = [](uint32_t a, uint32_t b) {
+    return a < b ? (static_cast<uint64_t>(a) << 32) | b
+                 : (static_cast<uint64_t>(b) << 32) | a;
+  };
+  std::vector<int32_t> prediction(num_components);
+  const std::vector<int32_t> zero(num_components, 0);
+  const int32_t *prev = zero.data();
+  for (const FaceIndex fi : faces) {
+    const Mesh::Face &face = mesh.face(fi);
+    uint32_t face_values[3];
+    for (int c = 0; c < 3; ++c) {
+      face_values[c] = att.mapped_index(face[c]).value();
+    }
+    for (int c = 0; c < 3; ++c) {
+      const uint32_t v = face_values[c];
+      if (visited[v]) {
+        continue;
+      }
+      visited[v] = true;
+      const uint32_t next = face_values[(c + 1) % 3];
+      const uint32_t prev_corner = face_values[(c + 2) % 3];
+      const int32_t *const value = &values[num_components * v];
+      const auto it = opposite_values.find(edge_key(next, prev_corner));
+      if (it != opposite_values.end() && visited[next] &&
+          visited[prev_corner]) {
+        for (int i = 0; i < num_components; ++i) {
+          prediction[i] = static_cast<int32_t>(
+              static_cast<uint32_t>(values[num_components * next + i]) +
+              static_cast<uint32_t>(values[num_components * prev_corner + i]) -
+              static_cast<uint32_t>(values[num_components * it->second + i]));
+        }
+        AppendResiduals(value, prediction.data(), num_components, &symbols);
+      } else {
+        AppendResiduals(value, prev, num_components, &symbols);
+      }
+      prev = value;
+    }
+    for (int c = 0; c < 3; ++c) {
+      opposite_values.insert(std::make_pair(
+          edge_key(face_values[(c + 1) % 3], face_values[(c + 2) % 3]),
+          face_values[c]));
+    }
+  }
+  return symbols;
+}
+
+// Returns the order in which the kd-tree encoder approximately visits the
+// points of |pc|: the Morton order of the integer |positions|.
+std::vector<PointIndex> ComputeMortonOrder(
+    const PointCloud &pc, const PointAttribute &pos_att,
+    const std::vector<int32_t> &positions, int num_components) {
+  std::vector<int32_t> min_values(num_components,
+                                  std::numeric_limits<int32_t>::max());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    min_values[i % num_components] =
+        std::min(min_values[i % num_components], positions[i]);
+  }
+  uint32_t max_coord = 0;
+  for (size_t i = 0; i < positions.size(); ++i) {
+    max_coord = std::max(max_coord, static_cast<uint32_t>(positions[i]) -
+                                        static_cast<uint32_t>(
+                                            min_values[i % num_components]));
+  }
+  // Use the 21 most significant bits of the coordinates.
+  const int shift =
+      max_coord == 0 ? 0 : std::max(0, MostSignificantBit(max_coord) - 20);
+  std::vector<std::pair<uint64_t, uint32_t>> keys(pc.num_points());
+  for (PointIndex pi(0); pi < pc.num_points(); ++pi) {
+    const int32_t *const pos =
+        &positions[num_components * pos_att.mapped_index(pi).value()];
+    uint64_t key = 0;
+    for (int c = 0; c < std::min(num_components, 3); ++c) {
+      const uint32_t coord = (static_cast<uint32_t>(pos[c]) -
+                              static_cast<uint32_t>(min_values[c])) >>
+                             shift;
+      for (int b = 0; b < 21; ++b) {
+        key |= static_cast<uint64_t>((coord >> b) & 1) << (3 * b + c);
+      }
+    }
+    keys[pi.value()] = std::make_pair(key, pi.value());
+  }
+  std::sort(keys.begin(), keys.end());
+  std::vector<PointIndex> order(pc.num_points());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    order[i] = PointIndex(keys[i].second);
+  }
+  return order;
+}
+
+// Returns the estimated size of the connectivity of |mesh| in bytes.
+int64_t EstimateConnectivityBytes(const Mesh &mesh, int encoding_method,
+                                  const EncoderOptions &options) {
+  const int64_t num_faces = mesh.num_faces();
+  if (encoding_method == MESH_EDGEBREAKER_ENCODING) {
+    return static_cast<int64_t>(
+        std::ceil(kEdgebreakerBitsPerFace * num_faces / 8));
+  }
+  // Number of faces, number of points and the index coding method.
+  int64_t bytes = 9;
+  if (options.GetGlobalBool(GetEncoderOptionKeys().vertex_cache_connectivity,
+                            false)) {
+    EncoderBuffer buffer;
+    if (EncodeVertexCacheIndices(mesh, &buffer)) {
+      return bytes + static_cast<int64_t>(buffer.size());
+    }
+  }
+  if (options.GetGlobalBool(GetEncoderOptionKeys().compress_connectivity,
+                            false)) {
+    std::vector<uint32_t> symbols;
+    symbols.reserve(3 * num_faces);
+    int32_t last_index = 0;
+    for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+      for (int c = 0; c < 3; ++c) {
+        const int32_t index = mesh.face(fi)[c].value();
+        symbols.push_back(ConvertSignedIntToSymbol(index - last_index));
+        last_index = index;
+      }
+    }
+    return bytes + (EstimateSymbolBits(symbols) + 7) / 8;
+  }
+  const uint32_t num_points = mesh.num_points();
+  if (num_points < 256) {
+    return bytes + 3 * num_faces;
+  }
+  if (num_points < (1 << 16)) {
+    return bytes + 6 * num_faces;
+  }
+  if (num_points >= (1 << 21)) {
+    return bytes + 12 * num_faces;
+  }
+  for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+    for (int c = 0; c < 3; ++c) {
+      const uint32_t index = mesh.face(fi)[c].value();
+      bytes += index < (1 << 7) ? 1 : index < (1 << 14) ? 2 : 3;
+    }
+  }
+  return bytes;
+}
+
+StatusOr<EncodedSizeEstimate> EstimateGeometrySize(
+    const PointCloud &pc, const Mesh *mesh, const EncoderOptions &options) {
+  DRACO_ASSIGN_OR_RETURN(const int encoding_method,
+                         GetEncodingMethod(pc, mesh != nullptr, options));
+  // Note that point cloud and mesh encoding methods share the same values.
+  const bool is_edgebreaker =
+      mesh != nullptr && encoding_method == MESH_EDGEBREAKER_ENCODING;
+  const bool is_kd_tree =
+      mesh == nullptr && encoding_method == POINT_CLOUD_KD_TREE_ENCODING;
+  const bool is_morton_order =
+      mesh == nullptr && encoding_method == POINT_CLOUD_MORTON_ORDER_ENCODING;
+  EncodedSizeEstimate estimate;
+  estimate.header_bytes = kDracoHeaderBytes;
+  if (mesh) {
+    estimate.connectivity_bytes =
+        EstimateConnectivityBytes(*mesh, encoding_method, options);
+  }
+
+  std::vector<FaceIndex> face_order;
+  if (is_edgebreaker) {
+    face_order = ComputeFaceTraversal(*mesh);
+  }
+  std::vector<PointIndex> point_order;
+  const PointAttribute *const pos_att =
+      pc.GetNamedAttribute(GeometryAttribute::POSITION);
+  std::vector<int32_t> values;
+  int num_components = 0;
+  if ((is_kd_tree || is_morton_order) && pos_att &&
+      GetIntegerValues(*pos_att,
+                       options.GetAttributeInt(
+                           pc.GetNamedAttributeId(GeometryAttribute::POSITION),
+                           GetEncoderOptionKeys().quantization_bits, -1),
+                       &values, &num_components)) {
+    point_order = ComputeMortonOrder(pc, *pos_att, values, num_components);
+  }
+
+  estimate.attribute_bytes.resize(pc.num_attributes(), 0);
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    const PointAttribute &att = *pc.attribute(i);
+    const int quantization_bits = options.GetAttributeInt(
+        i, GetEncoderOptionKeys().quantization_bits, -1);
+    estimate.header_bytes += kAttributeHeaderBytes;
+    if (!GetIntegerValues(att, quantization_bits, &values, &num_components)) {
+      estimate.attribute_bytes[i] =
+          static_cast<int64_t>(att.size()) * att.byte_stride();
+      continue;
+    }
+    if (quantization_bits > 0) {
+      // Minimum values and range of the quantization.
+      estimate.header_bytes += 4 * att.num_components() + 5;
+    }
+    const int prediction_scheme =
+        options.GetAttributeInt(i, GetEncoderOptionKeys().prediction_scheme,
+                                PREDICTION_UNDEFINED);
+    const bool use_prediction = prediction_scheme != PREDICTION_NONE;
+    std::vector<uint32_t> symbols;
+    if (is_edgebreaker && use_prediction &&
+        prediction_scheme != PREDICTION_DIFFERENCE &&
+        att.attribute_type() != GeometryAttribute::NORMAL) {
+      symbols = ComputeParallelogramResiduals(*mesh, face_order, att, values,
+                                              num_components);
+    } else {
+      std::vector<AttributeValueIndex> sequence;
+      if (is_edgebreaker) {
+        // Values are encoded once, in the order of the face traversal.
+        std::vector<bool> visited(att.size(), false);
+        for (const FaceIndex fi : face_order) {
+          for (int c = 0; c < 3; ++c) {
+            const AttributeValueIndex avi = att.mapped_index(mesh->face(fi)[c]);
+            if (!visited[avi.value()]) {
+              visited[avi.value()] = true;
+              sequence.push_back(avi);
+            }
+          }
+        }
+      } else if (!point_order.empty()) {
+        for (const PointIndex pi : point_order) {
+          sequence.push_back(att.mapped_index(pi));
+        }
+      } else {
+        // Sequential encoders encode a value for each point.
+        for (PointIndex pi(0); pi < pc.num_points(); ++pi) {
+          sequence.push_back(att.mapped_index(pi));
+        }
+      }
+      symbols = ComputeSequenceResiduals(values, num_components, sequence,
+                                         use_prediction);
+    }
+    estimate.attribute_bytes[i] = (EstimateSymbolBits(symbols) + 7) / 8;
+  }
+  return estimate;
+}
+
+}  // namespace
+
+StatusOr<EncodedSizeEstimate> EstimateEncodedSize(
+    const Mesh &mesh, const EncoderOptions &options) {
+  return EstimateGeometrySize(mesh, &mesh, options);
+}
+
+StatusOr<EncodedSizeEstimate> EstimateEncodedSize(
+    const PointCloud &pc, const EncoderOptions &options) {
+  return EstimateGeometrySize(pc, nullptr, options);
+}
+
+StatusOr<EncodedSizeEstimate> EstimateEncodedSize(const Mesh &mesh,
+                                                  const Encoder &encoder) {
+  return EstimateEncodedSize(mesh, encoder.CreateExpertEncoderOptions(mesh));
+}
+
+StatusOr<EncodedSizeEstimate> EstimateEncodedSize(const PointCloud &pc,
+                                                  const Encoder &encoder) {
+  return EstimateEncodedSize(pc, encoder.CreateExpertEncoderOptions(pc));
+}
+
+}  // namespace draco
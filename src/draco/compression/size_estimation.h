@@ -0,0 +1,82 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_SIZE_ESTIMATION_H_
+#define DRACO_COMPRESSION_SIZE_ESTIMATION_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "draco/compression/config/encoder_options.h"
+#include "draco/compression/encode.h"
+#include "draco/core/status_or.h"
+#include "draco/mesh/mesh.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Estimated size of encoded geometry, see EstimateEncodedSize().
+struct EncodedSizeEstimate {
+  EncodedSizeEstimate() : header_bytes(0), connectivity_bytes(0) {}
+
+  int64_t total_bytes() const {
+    int64_t total = header_bytes + connectivity_bytes;
+    for (const int64_t bytes : attribute_bytes) {
+      total += bytes;
+    }
+    return total;
+  }
+
+  // Draco header and per-attribute parameters.
+  int64_t header_bytes;
+  // Encoded faces. Zero for point clouds.
+  int64_t connectivity_bytes;
+  // Encoded values of each attribute, indexed by attribute id.
+  std::vector<int64_t> attribute_bytes;
+};
+
+// Estimates the size of |mesh| or |pc| encoded with |options| (attribute
+// options are specified for attribute ids as in ExpertEncoder) without
+// running the encoder. The estimate is meant for planning, e.g. selecting
+// quantization bits for many assets, and is typically within about 10% of
+// the actual size.
+//
+// Each attribute is quantized as the encoder would do it, the values are
+// predicted in the order in which faces (or points) reference them, and the
+// Shannon entropy of the prediction residuals (see shannon_entropy.h) is used
+// as the size of the entropy coded corrections. For the Edgebreaker method,
+// faces are visited depth-first and values are predicted with the
+// parallelogram rule where possible, points of the kd-tree method are visited
+// in Morton order of the positions, and all other values are predicted from
+// the previous value. Unquantized floating point and
+// 64-bit attributes are counted with their raw size. Edgebreaker connectivity
+// is estimated from the number of faces using a typical rate of the
+// Edgebreaker symbol coding.
+//
+// No prediction schemes or entropy coders are run, so the estimate is
+// considerably faster than encoding.
+StatusOr<EncodedSizeEstimate> EstimateEncodedSize(
+    const Mesh &mesh, const EncoderOptions &options);
+StatusOr<EncodedSizeEstimate> EstimateEncodedSize(
+    const PointCloud &pc, const EncoderOptions &options);
+
+// Same as above but using the options of |encoder|.
+StatusOr<EncodedSizeEstimate> EstimateEncodedSize(const Mesh &mesh,
+                                                  const Encoder &encoder);
+StatusOr<EncodedSizeEstimate> EstimateEncodedSize(const PointCloud &pc,
+                                                  const Encoder &encoder);
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_SIZE_ESTIMATION_H_
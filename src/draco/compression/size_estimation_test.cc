@@ -0,0 +1,116 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/size_estimation.h"
+
+#include <memory>
+#include <string>
+
+#include "draco/compression/expert_encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace draco {
+
+class SizeEstimationTest : public ::testing::Test {
+ protected:
+  // Returns default options for encoding of |pc|.
+  static EncoderOptions CreateOptions(const PointCloud &pc, int speed) {
+    Encoder encoder;
+    encoder.SetAttributeQuantization(GeometryAttribute::POSITION, 11);
+    encoder.SetAttributeQuantization(GeometryAttribute::TEX_COORD, 10);
+    encoder.SetAttributeQuantization(GeometryAttribute::NORMAL, 8);
+    encoder.SetAttributeQuantization(GeometryAttribute::GENERIC, 8);
+    encoder.SetSpeedOptions(speed, speed);
+    return encoder.CreateExpertEncoderOptions(pc);
+  }
+
+  // Checks that the estimated size of |geometry| is within |max_error|
+  // (relative) of the actual encoded size.
+  template <class GeometryT>
+  static void CheckEstimate(const GeometryT &geometry,
+                            const EncoderOptions &options, double max_error) {
+    ExpertEncoder encoder(geometry);
+    encoder.Reset(options);
+    EncoderBuffer buffer;
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(&buffer));
+    DRACO_ASSIGN_OR_ASSERT(const EncodedSizeEstimate estimate,
+                           EstimateEncodedSize(geometry, options));
+    ASSERT_EQ(estimate.attribute_bytes.size(), geometry.num_attributes());
+    const double actual = static_cast<double>(buffer.size());
+    ASSERT_GT(estimate.total_bytes(), (1.0 - max_error) * actual);
+    ASSERT_LT(estimate.total_bytes(), (1.0 + max_error) * actual);
+  }
+};
+
+TEST_F(SizeEstimationTest, TestEdgebreakerMeshes) {
+  for (const std::string file_name :
+       {"bunny_norm.obj", "car.drc", "cube_att.obj", "test_nm.obj"}) {
+    const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile(file_name);
+    ASSERT_NE(mesh, nullptr) << file_name;
+    CheckEstimate(*mesh, CreateOptions(*mesh, 5), 0.2);
+  }
+}
+
+TEST_F(SizeEstimationTest, TestSequentialMeshes) {
+  for (const std::string file_name : {"bunny_norm.obj", "car.drc"}) {
+    const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile(file_name);
+    ASSERT_NE(mesh, nullptr) << file_name;
+    CheckEstimate(*mesh, CreateOptions(*mesh, 10), 0.2);
+  }
+}
+
+TEST_F(SizeEstimationTest, TestPointClouds) {
+  for (const int speed : {5, 10}) {
+    const std::unique_ptr<PointCloud> pc =
+        ReadPointCloudFromTestFile("bun_zipper.ply");
+    ASSERT_NE(pc, nullptr);
+    CheckEstimate(*pc, CreateOptions(*pc, speed), 0.2);
+  }
+}
+
+TEST_F(SizeEstimationTest, TestQuantization) {
+  // Tests that attribute estimates grow with the number of quantization bits.
+  const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  const int pos_att_id =
+      mesh->GetNamedAttributeId(GeometryAttribute::POSITION);
+  EncoderOptions options = CreateOptions(*mesh, 5);
+  DRACO_ASSIGN_OR_ASSERT(const EncodedSizeEstimate estimate,
+                         EstimateEncodedSize(*mesh, options));
+  options.SetAttributeInt(pos_att_id, "quantization_bits", 14);
+  DRACO_ASSIGN_OR_ASSERT(const EncodedSizeEstimate fine_estimate,
+                         EstimateEncodedSize(*mesh, options));
+  ASSERT_GT(fine_estimate.attribute_bytes[pos_att_id],
+            estimate.attribute_bytes[pos_att_id]);
+  ASSERT_EQ(fine_estimate.connectivity_bytes, estimate.connectivity_bytes);
+}
+
+TEST_F(SizeEstimationTest, TestInvalidEncodingMethod) {
+  // Tests that unquantized floats cannot be estimated with the kd-tree method
+  // as they cannot be encoded with it.
+  const std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("bun_zipper.ply");
+  ASSERT_NE(pc, nullptr);
+  EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+  options.SetGlobalInt("encoding_method", POINT_CLOUD_KD_TREE_ENCODING);
+  ASSERT_FALSE(EstimateEncodedSize(*pc, options).ok());
+  options.SetGlobalInt("encoding_method", POINT_CLOUD_SEQUENTIAL_ENCODING);
+  DRACO_ASSIGN_OR_ASSERT(const EncodedSizeEstimate estimate,
+                         EstimateEncodedSize(*pc, options));
+  // Raw float positions.
+  ASSERT_EQ(estimate.attribute_bytes[0], 12 * pc->num_points());
+}
+
+}  // namespace draco
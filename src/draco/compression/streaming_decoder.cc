@@ -0,0 +1,178 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/streaming_decoder.h"
+
+#include <utility>
+
+#include "draco/compression/point_cloud/point_cloud_decoder.h"
+#include "draco/mesh/mesh.h"
+#include "draco/metadata/metadata_decoder.h"
+
+namespace draco {
+
+StreamingDecoder::StreamingDecoder()
+    : finished_(false),
+      stage_(STAGE_HEADER),
+      next_attempt_size_(0),
+      header_(),
+      header_size_(0) {}
+
+Status StreamingDecoder::AppendData(const char *data, size_t data_size) {
+  if (finished_) {
+    return Status(Status::DRACO_ERROR, "Input was already finished.");
+  }
+  data_.insert(data_.end(), data, data + data_size);
+  return DecodeAvailableStages();
+}
+
+Status StreamingDecoder::Finish() {
+  finished_ = true;
+  DRACO_RETURN_IF_ERROR(DecodeAvailableStages());
+  if (stage_ != STAGE_DONE) {
+    return Status(Status::IO_ERROR, "Incomplete input data.");
+  }
+  return OkStatus();
+}
+
+Status StreamingDecoder::DecodeAvailableStages() {
+  while (stage_ != STAGE_DONE) {
+    DRACO_ASSIGN_OR_RETURN(const bool stage_decoded, DecodeStage(stage_));
+    if (!stage_decoded) {
+      // More data is needed.
+      return OkStatus();
+    }
+    stage_ = static_cast<Stage>(stage_ + 1);
+    // The next stage can be attempted right away.
+    next_attempt_size_ = 0;
+  }
+  return OkStatus();
+}
+
+StatusOr<bool> StreamingDecoder::DecodeStage(Stage stage) {
+  switch (stage) {
+    case STAGE_HEADER:
+      return DecodeHeader();
+    case STAGE_METADATA:
+      return DecodeMetadata();
+    case STAGE_CONNECTIVITY:
+      return DecodeConnectivity();
+    case STAGE_GEOMETRY:
+      return DecodeGeometry();
+    default:
+      return Status(Status::DRACO_ERROR, "Invalid decoding stage.");
+  }
+}
+
+StatusOr<bool> StreamingDecoder::DecodeHeader() {
+  // The header has a fixed size so it can be parsed with every new chunk.
+  DecoderBuffer buffer;
+  buffer.Init(data_.data(), data_.size());
+  const Status status = PointCloudDecoder::DecodeHeader(&buffer, &header_);
+  if (!status.ok()) {
+    if (status.code() == Status::IO_ERROR && !finished_) {
+      return false;
+    }
+    return status;
+  }
+  if (header_.encoder_type != POINT_CLOUD &&
+      header_.encoder_type != TRIANGULAR_MESH) {
+    return Status(Status::DRACO_ERROR, "Unsupported geometry type.");
+  }
+  header_size_ = buffer.decoded_size();
+  return true;
+}
+
+StatusOr<bool> StreamingDecoder::DecodeMetadata() {
+  const uint16_t bitstream_version =
+      DRACO_BITSTREAM_VERSION(header_.version_major, header_.version_minor);
+  if (bitstream_version < DRACO_BITSTREAM_VERSION(1, 3) ||
+      !(header_.flags & METADATA_FLAG_MASK)) {
+    // There is no metadata.
+    return true;
+  }
+  if (!ShouldRetry()) {
+    return false;
+  }
+  DecoderBuffer buffer;
+  buffer.Init(data_.data() + header_size_, data_.size() - header_size_,
+              bitstream_version);
+  std::unique_ptr<GeometryMetadata> metadata(new GeometryMetadata());
+  MetadataDecoder metadata_decoder;
+  metadata_decoder.set_intern_names(header_.flags &
+                                    METADATA_INTERNED_NAMES_FLAG_MASK);
+  if (!metadata_decoder.DecodeGeometryMetadata(&buffer, metadata.get())) {
+    if (finished_) {
+      return Status(Status::DRACO_ERROR, "Failed to decode metadata.");
+    }
+    OnMoreDataNeeded();
+    return false;
+  }
+  metadata_ = std::move(metadata);
+  return true;
+}
+
+StatusOr<bool> StreamingDecoder::DecodeConnectivity() {
+  if (!ShouldRetry()) {
+    return false;
+  }
+  Decoder connectivity_decoder;
+  *connectivity_decoder.options() = *decoder_.options();
+  connectivity_decoder.options()->SetGlobalBool("decode_connectivity_only",
+                                                true);
+  StatusOr<std::unique_ptr<PointCloud>> connectivity_or =
+      DecodeReceivedGeometry(&connectivity_decoder);
+  if (!connectivity_or.ok()) {
+    if (finished_) {
+      return connectivity_or.status();
+    }
+    OnMoreDataNeeded();
+    return false;
+  }
+  connectivity_ = std::move(connectivity_or).value();
+  return true;
+}
+
+StatusOr<bool> StreamingDecoder::DecodeGeometry() {
+  if (!ShouldRetry()) {
+    return false;
+  }
+  StatusOr<std::unique_ptr<PointCloud>> geometry_or =
+      DecodeReceivedGeometry(&decoder_);
+  if (!geometry_or.ok()) {
+    if (finished_) {
+      return geometry_or.status();
+    }
+    OnMoreDataNeeded();
+    return false;
+  }
+  geometry_ = std::move(geometry_or).value();
+  return true;
+}
+
+StatusOr<std::unique_ptr<PointCloud>> StreamingDecoder::DecodeReceivedGeometry(
+    Decoder *decoder) {
+  DecoderBuffer buffer;
+  buffer.Init(data_.data(), data_.size());
+  if (header_.encoder_type == TRIANGULAR_MESH) {
+    std::unique_ptr<Mesh> mesh(new Mesh());
+    DRACO_RETURN_IF_ERROR(decoder->DecodeBufferToGeometry(&buffer, mesh.get()));
+    return std::unique_ptr<PointCloud>(std::move(mesh));
+  }
+  std::unique_ptr<PointCloud> pc(new PointCloud());
+  DRACO_RETURN_IF_ERROR(decoder->DecodeBufferToGeometry(&buffer, pc.get()));
+  return std::move(pc);
+}
+
+}  // namespace draco
@@ -0,0 +1,148 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_STREAMING_DECODER_H_
+#define DRACO_COMPRESSION_STREAMING_DECODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/decode.h"
+#include "draco/core/status.h"
+#include "draco/metadata/geometry_metadata.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Decoder that accepts the encoded data in chunks, for example as they arrive
+// over a network connection. Parts of the encoded geometry are made available
+// as soon as all of their data has been received:
+//
+//   1. Draco header (geometry type, encoding method, version).
+//   2. Geometry metadata (if present).
+//   3. Connectivity, i.e. a mesh with all faces and points but without any
+//      attributes, or the number of points for point clouds.
+//   4. The complete geometry.
+//
+// The bitstream does not store the size of the individual parts, so a stage
+// is detected as complete when it can be decoded from the data received so
+// far. To keep the total decoding cost linear in the input size, a failed
+// attempt is retried only after the amount of received data has doubled, or
+// when Finish() is called.
+//
+// Example:
+//
+//   StreamingDecoder decoder;
+//   while (ReceiveChunk(&chunk)) {
+//     DRACO_RETURN_IF_ERROR(decoder.AppendData(chunk.data(), chunk.size()));
+//     if (decoder.connectivity()) {
+//       ShowPreview(*decoder.connectivity());
+//     }
+//   }
+//   DRACO_RETURN_IF_ERROR(decoder.Finish());
+//   std::unique_ptr<PointCloud> geometry = decoder.ReleaseGeometry();
+//
+class StreamingDecoder {
+ public:
+  enum Stage {
+    STAGE_HEADER = 0,
+    STAGE_METADATA,
+    STAGE_CONNECTIVITY,
+    STAGE_GEOMETRY,
+    STAGE_DONE,
+  };
+
+  StreamingDecoder();
+
+  // Appends a chunk of encoded data and decodes all stages that can be decoded
+  // from the data received so far. Returns an error only when the received
+  // data is known to be invalid. The data is copied.
+  Status AppendData(const char *data, size_t data_size);
+
+  // Signals that all data was received and decodes all remaining stages.
+  // Returns an error if the geometry cannot be decoded.
+  Status Finish();
+
+  // Returns the next stage the decoder is waiting for.
+  Stage stage() const { return stage_; }
+
+  // Returns the decoded header or nullptr if it is not available yet.
+  const DracoHeader *header() const {
+    return stage_ > STAGE_HEADER ? &header_ : nullptr;
+  }
+
+  // Returns the decoded geometry metadata or nullptr if it is not available
+  // yet or if the encoded geometry has no metadata.
+  const GeometryMetadata *metadata() const { return metadata_.get(); }
+
+  // Returns geometry with decoded connectivity but without any attributes, or
+  // nullptr if it is not available yet. For meshes, the returned instance can
+  // be down-casted to Mesh.
+  const PointCloud *connectivity() const { return connectivity_.get(); }
+
+  // Returns the fully decoded geometry or nullptr if it is not available yet.
+  const PointCloud *geometry() const { return geometry_.get(); }
+
+  // Transfers ownership of the fully decoded geometry to the caller.
+  std::unique_ptr<PointCloud> ReleaseGeometry() { return std::move(geometry_); }
+
+  // Returns the number of bytes received so far.
+  size_t num_received_bytes() const { return data_.size(); }
+
+  // Returns the options used for decoding of the geometry.
+  DecoderOptions *options() { return decoder_.options(); }
+
+ private:
+  // Decodes as many stages as possible.
+  Status DecodeAvailableStages();
+
+  // Each function returns true when the stage was decoded, false when more
+  // data is needed, or an error when the data is invalid.
+  StatusOr<bool> DecodeStage(Stage stage);
+  StatusOr<bool> DecodeHeader();
+  StatusOr<bool> DecodeMetadata();
+  StatusOr<bool> DecodeConnectivity();
+  StatusOr<bool> DecodeGeometry();
+
+  // Decodes the geometry from all received data into a new geometry instance
+  // using |decoder|.
+  StatusOr<std::unique_ptr<PointCloud>> DecodeReceivedGeometry(
+      Decoder *decoder);
+
+  // Returns true when a stage that previously failed should be retried.
+  bool ShouldRetry() const {
+    return finished_ || data_.size() >= next_attempt_size_;
+  }
+
+  // Called when a stage failed because of insufficient data.
+  void OnMoreDataNeeded() { next_attempt_size_ = 2 * data_.size(); }
+
+  std::vector<char> data_;
+  bool finished_;
+  Stage stage_;
+  // Minimum size of received data before the current stage is retried.
+  size_t next_attempt_size_;
+  DracoHeader header_;
+  // Number of bytes of the encoded header.
+  size_t header_size_;
+  std::unique_ptr<GeometryMetadata> metadata_;
+  std::unique_ptr<PointCloud> connectivity_;
+  std::unique_ptr<PointCloud> geometry_;
+  Decoder decoder_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_STREAMING_DECODER_H_
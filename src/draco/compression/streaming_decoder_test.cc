@@ -0,0 +1,143 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/streaming_decoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/io/file_utils.h"
+#include "draco/mesh/mesh.h"
+
+namespace {
+
+class StreamingDecoderTest : public ::testing::Test {
+ protected:
+  // Feeds |file_name| into the streaming decoder in chunks of |chunk_size|
+  // bytes and verifies that the decoded geometry matches the output of the
+  // regular decoder.
+  void TestStreamFile(const std::string &file_name, size_t chunk_size) {
+    std::vector<char> data;
+    ASSERT_TRUE(
+        draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name), &data));
+    draco::DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    draco::Decoder decoder;
+    std::unique_ptr<draco::PointCloud> expected =
+        decoder.DecodePointCloudFromBuffer(&buffer).value();
+    ASSERT_NE(expected, nullptr);
+
+    draco::StreamingDecoder streaming_decoder;
+    draco::StreamingDecoder::Stage last_stage = streaming_decoder.stage();
+    for (size_t pos = 0; pos < data.size(); pos += chunk_size) {
+      const size_t size = std::min(chunk_size, data.size() - pos);
+      DRACO_ASSERT_OK(streaming_decoder.AppendData(data.data() + pos, size));
+      // Stages can only advance.
+      ASSERT_GE(streaming_decoder.stage(), last_stage);
+      last_stage = streaming_decoder.stage();
+      if (streaming_decoder.connectivity() != nullptr) {
+        ASSERT_EQ(streaming_decoder.connectivity()->num_points(),
+                  expected->num_points());
+        ASSERT_EQ(streaming_decoder.connectivity()->num_attributes(), 0);
+      }
+    }
+    DRACO_ASSERT_OK(streaming_decoder.Finish());
+    ASSERT_EQ(streaming_decoder.stage(), draco::StreamingDecoder::STAGE_DONE);
+    ASSERT_NE(streaming_decoder.header(), nullptr);
+    ASSERT_EQ(streaming_decoder.metadata() != nullptr,
+              expected->GetMetadata() != nullptr);
+    ASSERT_NE(streaming_decoder.connectivity(), nullptr);
+
+    std::unique_ptr<draco::PointCloud> pc = streaming_decoder.ReleaseGeometry();
+    ASSERT_NE(pc, nullptr);
+    ASSERT_EQ(pc->num_points(), expected->num_points());
+    ASSERT_EQ(pc->num_attributes(), expected->num_attributes());
+    for (int i = 0; i < pc->num_attributes(); ++i) {
+      const draco::DataBuffer *const att_buffer = pc->attribute(i)->buffer();
+      const draco::DataBuffer *const expected_buffer =
+          expected->attribute(i)->buffer();
+      ASSERT_EQ(att_buffer->data_size(), expected_buffer->data_size());
+      ASSERT_EQ(memcmp(att_buffer->data(), expected_buffer->data(),
+                       att_buffer->data_size()),
+                0);
+    }
+    if (streaming_decoder.header()->encoder_type == draco::TRIANGULAR_MESH) {
+      const draco::Mesh *const mesh = static_cast<draco::Mesh *>(pc.get());
+      const draco::Mesh *const connectivity =
+          static_cast<const draco::Mesh *>(streaming_decoder.connectivity());
+      const draco::Mesh *const expected_mesh =
+          static_cast<draco::Mesh *>(expected.get());
+      ASSERT_EQ(mesh->num_faces(), expected_mesh->num_faces());
+      ASSERT_EQ(connectivity->num_faces(), expected_mesh->num_faces());
+      for (draco::FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+        ASSERT_EQ(mesh->face(fi), expected_mesh->face(fi));
+        ASSERT_EQ(connectivity->face(fi), expected_mesh->face(fi));
+      }
+    }
+  }
+};
+
+TEST_F(StreamingDecoderTest, TestStreamMeshes) {
+  for (const size_t chunk_size : {1, 7, 64, 1024}) {
+    TestStreamFile("car.drc", chunk_size);
+    TestStreamFile("cube_att.obj.edgebreaker.cl10.2.2.drc", chunk_size);
+    TestStreamFile("cube_att.obj.sequential.cl3.2.2.drc", chunk_size);
+    TestStreamFile("cube_att_sub_o_2.drc", chunk_size);
+  }
+}
+
+TEST_F(StreamingDecoderTest, TestStreamPointClouds) {
+  for (const size_t chunk_size : {3, 100, 4096}) {
+    TestStreamFile("pc_kd_color.drc", chunk_size);
+    TestStreamFile("pc_color.drc", chunk_size);
+  }
+}
+
+TEST_F(StreamingDecoderTest, TestHeaderIsDecodedFirst) {
+  // Tests that the header is available as soon as its bytes are received.
+  std::vector<char> data;
+  ASSERT_TRUE(draco::ReadFileToBuffer(draco::GetTestFileFullPath("car.drc"),
+                                      &data));
+  draco::StreamingDecoder streaming_decoder;
+  DRACO_ASSERT_OK(streaming_decoder.AppendData(data.data(), 5));
+  ASSERT_EQ(streaming_decoder.header(), nullptr);
+  DRACO_ASSERT_OK(streaming_decoder.AppendData(data.data() + 5, 6));
+  ASSERT_NE(streaming_decoder.header(), nullptr);
+  ASSERT_EQ(streaming_decoder.header()->encoder_type, draco::TRIANGULAR_MESH);
+  ASSERT_EQ(streaming_decoder.geometry(), nullptr);
+}
+
+TEST_F(StreamingDecoderTest, TestIncompleteInput) {
+  // Tests that truncated input is reported once the input is finished.
+  std::vector<char> data;
+  ASSERT_TRUE(draco::ReadFileToBuffer(draco::GetTestFileFullPath("car.drc"),
+                                      &data));
+  draco::StreamingDecoder streaming_decoder;
+  DRACO_ASSERT_OK(streaming_decoder.AppendData(data.data(), data.size() / 2));
+  ASSERT_EQ(streaming_decoder.geometry(), nullptr);
+  ASSERT_FALSE(streaming_decoder.Finish().ok());
+}
+
+TEST_F(StreamingDecoderTest, TestInvalidInput) {
+  // Tests that input that is not a Draco file is rejected immediately.
+  const std::string data = "NOT A DRACO FILE";
+  draco::StreamingDecoder streaming_decoder;
+  ASSERT_FALSE(streaming_decoder.AppendData(data.data(), data.size()).ok());
+}
+
+}  // namespace
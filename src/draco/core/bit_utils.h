@@ -74,6 +74,50 @@ inline int MostSignificantBit(uint32_t n) {
 #endif
 }
 
+// Returns the location of the least significant bit in the input integer |n|.
+// The functionality is not defined for |n == 0|.
+inline int LeastSignificantBit64(uint64_t n) {
+#if defined(__GNUC__)
+  return __builtin_ctzll(n);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  unsigned long where;
+  _BitScanForward64(&where, n);
+  return (int)where;
+#else
+  int lsb = 0;
+  while ((n & 1) == 0) {
+    lsb++;
+    n >>= 1;
+  }
+  return lsb;
+#endif
+}
+
+// Spreads the lower 21 bits of |value| so that there are two zero bits between
+// each pair of consecutive bits. Used for interleaving the bits of three
+// coordinates into a Morton code.
+inline uint64_t SpreadBitsBy3(uint64_t value) {
+  value &= 0x1fffff;
+  value = (value | value << 32) & 0x1f00000000ffffull;
+  value = (value | value << 16) & 0x1f0000ff0000ffull;
+  value = (value | value << 8) & 0x100f00f00f00f00full;
+  value = (value | value << 4) & 0x10c30c30c30c30c3ull;
+  value = (value | value << 2) & 0x1249249249249249ull;
+  return value;
+}
+
+// Spreads the lower 32 bits of |value| so that there is a zero bit between
+// each pair of consecutive bits.
+inline uint64_t SpreadBitsBy2(uint64_t value) {
+  value &= 0xffffffff;
+  value = (value | value << 16) & 0x0000ffff0000ffffull;
+  value = (value | value << 8) & 0x00ff00ff00ff00ffull;
+  value = (value | value << 4) & 0x0f0f0f0f0f0f0f0full;
+  value = (value | value << 2) & 0x3333333333333333ull;
+  value = (value | value << 1) & 0x5555555555555555ull;
+  return value;
+}
+
 // Helper function that converts signed integer values into unsigned integer
 // symbols that can be encoded using an entropy encoder.
 void ConvertSignedIntsToSymbols(const int32_t *in, int in_values,
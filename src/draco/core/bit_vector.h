@@ -0,0 +1,73 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_BIT_VECTOR_H_
+#define DRACO_CORE_BIT_VECTOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "draco/core/bit_utils.h"
+
+namespace draco {
+
+// Fixed size vector of bits packed into 64-bit words. Unlike std::vector<bool>,
+// the bits are read and written with plain word operations without any proxy
+// objects. Writes to different bits of the same word are not thread-safe.
+class BitVector {
+ public:
+  BitVector() : num_bits_(0) {}
+
+  // Resizes the vector to |num_bits| bits and sets all of them to |value|.
+  void assign(size_t num_bits, bool value) {
+    num_bits_ = num_bits;
+    words_.assign((num_bits + 63) / 64, value ? ~uint64_t(0) : uint64_t(0));
+  }
+
+  size_t size() const { return num_bits_; }
+
+  bool operator[](size_t i) const { return (words_[i >> 6] >> (i & 63)) & 1; }
+
+  void Set(size_t i) { words_[i >> 6] |= uint64_t(1) << (i & 63); }
+
+  // Returns the index of the first unset bit at or after |from|, or size()
+  // when all remaining bits are set. Fully set words are skipped at once.
+  size_t FindNextUnset(size_t from) const {
+    if (from >= num_bits_) {
+      return num_bits_;
+    }
+    size_t w = from >> 6;
+    uint64_t unset = ~words_[w] & (~uint64_t(0) << (from & 63));
+    while (unset == 0) {
+      if (++w == words_.size()) {
+        return num_bits_;
+      }
+      unset = ~words_[w];
+    }
+    const size_t i = (w << 6) + LeastSignificantBit64(unset);
+    return i < num_bits_ ? i : num_bits_;
+  }
+
+  // Returns the number of bytes allocated by the vector.
+  size_t memory_usage() const { return words_.capacity() * sizeof(uint64_t); }
+
+ private:
+  std::vector<uint64_t> words_;
+  size_t num_bits_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_BIT_VECTOR_H_
@@ -0,0 +1,65 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/bit_vector.h"
+
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+TEST(BitVectorTest, TestSetBits) {
+  draco::BitVector bits;
+  bits.assign(130, false);
+  ASSERT_EQ(bits.size(), 130);
+  bits.Set(0);
+  bits.Set(63);
+  bits.Set(64);
+  bits.Set(129);
+  for (size_t i = 0; i < bits.size(); ++i) {
+    const bool expected = i == 0 || i == 63 || i == 64 || i == 129;
+    ASSERT_EQ(bits[i], expected) << "bit " << i;
+  }
+
+  // Reassigning the vector resets all bits.
+  bits.assign(70, true);
+  ASSERT_EQ(bits.size(), 70);
+  for (size_t i = 0; i < bits.size(); ++i) {
+    ASSERT_TRUE(bits[i]);
+  }
+}
+
+TEST(BitVectorTest, TestFindNextUnset) {
+  draco::BitVector bits;
+  bits.assign(200, false);
+  ASSERT_EQ(bits.FindNextUnset(0), 0);
+  ASSERT_EQ(bits.FindNextUnset(199), 199);
+  ASSERT_EQ(bits.FindNextUnset(200), 200);
+
+  // Set all bits except 70 and 150.
+  for (size_t i = 0; i < bits.size(); ++i) {
+    if (i != 70 && i != 150) {
+      bits.Set(i);
+    }
+  }
+  ASSERT_EQ(bits.FindNextUnset(0), 70);
+  ASSERT_EQ(bits.FindNextUnset(70), 70);
+  ASSERT_EQ(bits.FindNextUnset(71), 150);
+  ASSERT_EQ(bits.FindNextUnset(151), 200);
+
+  // Unused bits of the last word must not be reported.
+  bits.assign(70, true);
+  ASSERT_EQ(bits.FindNextUnset(0), 70);
+}
+
+}  // namespace
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <algorithm>
+
 #include "draco/core/decoder_buffer.h"
 #include "draco/core/draco_test_base.h"
 #include "draco/core/encoder_buffer.h"
@@ -112,4 +114,37 @@ TEST_F(BufferBitCodingTest, TestMultipleBits) {
   }
 }
 
+TEST_F(BufferBitCodingTest, TestBitsAcrossWordsAndPastEnd) {
+  // Tests reading of values of all bit lengths at all bit offsets, including
+  // reads that reach past the end of the buffer. Bits past the end are
+  // decoded as zeros and they are not counted as decoded bits.
+  uint8_t data[13];
+  for (size_t i = 0; i < sizeof(data); ++i) {
+    data[i] = static_cast<uint8_t>(0x9d * (i + 1));
+  }
+  const uint64_t total_bits = sizeof(data) * 8;
+  for (uint32_t start = 0; start <= total_bits; ++start) {
+    for (uint32_t nbits = 0; nbits <= 32; ++nbits) {
+      BitDecoder decoder;
+      decoder.reset(static_cast<const void *>(data), sizeof(data));
+      uint32_t x = 0;
+      for (uint32_t skipped = start; skipped > 0;) {
+        const uint32_t n = std::min(skipped, 32u);
+        ASSERT_TRUE(decoder.GetBits(n, &x));
+        skipped -= n;
+      }
+      ASSERT_TRUE(decoder.GetBits(nbits, &x));
+      uint32_t expected = 0;
+      for (uint32_t b = 0; b < nbits && start + b < total_bits; ++b) {
+        const uint32_t pos = start + b;
+        expected |= static_cast<uint32_t>((data[pos / 8] >> (pos % 8)) & 1)
+                    << b;
+      }
+      ASSERT_EQ(x, expected);
+      ASSERT_EQ(decoder.BitsDecoded(), std::min<uint64_t>(start + nbits,
+                                                          total_bits));
+    }
+  }
+}
+
 }  // namespace draco
@@ -0,0 +1,46 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_CANCELLATION_TOKEN_H_
+#define DRACO_CORE_CANCELLATION_TOKEN_H_
+
+#include <atomic>
+
+#include "draco/core/macros.h"
+
+namespace draco {
+
+// Flag that can be set from any thread to request an early stop of a
+// long-running operation, e.g. of a decoding that is no longer needed (see
+// DracoOptions::SetCancellationToken()). The operation checks the flag at
+// certain points and fails when the flag is set, so it may still run for a
+// while after Cancel() is called.
+class CancellationToken {
+ public:
+  CancellationToken() : cancelled_(false) {}
+
+  void Cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+  bool IsCancelled() const {
+    return cancelled_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<bool> cancelled_;
+
+  DISALLOW_COPY_AND_ASSIGN(CancellationToken);
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_CANCELLATION_TOKEN_H_
@@ -0,0 +1,246 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/coding_stats.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+namespace draco {
+
+void CodingStats::RecordStage(const std::string &name, int attribute_id,
+                              int64_t time_us, int64_t num_bytes) {
+  Stage stage;
+  stage.name = name;
+  stage.attribute_id = attribute_id;
+  stage.time_us = time_us;
+  stage.num_bytes = num_bytes;
+  RecordStage(stage);
+}
+
+void CodingStats::RecordStage(const Stage &stage) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stages_.push_back(stage);
+}
+
+std::vector<CodingStats::Stage> CodingStats::stages() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stages_;
+}
+
+int64_t CodingStats::GetTotalTimeUs(const std::string &name,
+                                    int attribute_id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  int64_t total = 0;
+  for (const Stage &stage : stages_) {
+    if (stage.name == name &&
+        (attribute_id == -2 || stage.attribute_id == attribute_id)) {
+      total += stage.time_us;
+    }
+  }
+  return total;
+}
+
+int64_t CodingStats::GetTotalBytes(const std::string &name,
+                                   int attribute_id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  int64_t total = 0;
+  for (const Stage &stage : stages_) {
+    if (stage.name == name &&
+        (attribute_id == -2 || stage.attribute_id == attribute_id)) {
+      total += stage.num_bytes;
+    }
+  }
+  return total;
+}
+
+int64_t CodingStats::GetTotalHardwareCounter(
+    const std::string &name, int attribute_id,
+    HardwareCounters::Event event) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  int64_t total = -1;
+  for (const Stage &stage : stages_) {
+    if (stage.name == name &&
+        (attribute_id == -2 || stage.attribute_id == attribute_id) &&
+        stage.hardware_counters[event] >= 0) {
+      total = std::max<int64_t>(total, 0) + stage.hardware_counters[event];
+    }
+  }
+  return total;
+}
+
+void CodingStats::RecordPeakMemory(const std::string &name,
+                                   int64_t num_bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &entry : peak_memory_) {
+    if (entry.first == name) {
+      entry.second = std::max(entry.second, num_bytes);
+      return;
+    }
+  }
+  peak_memory_.push_back(std::make_pair(name, num_bytes));
+}
+
+int64_t CodingStats::GetPeakMemory(const std::string &name) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &entry : peak_memory_) {
+    if (entry.first == name) {
+      return entry.second;
+    }
+  }
+  return 0;
+}
+
+void CodingStats::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stages_.clear();
+  peak_memory_.clear();
+}
+
+std::string CodingStats::ToString() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Hardware counter columns are printed only when any stage has them.
+  bool has_hardware_counters = false;
+  for (const Stage &stage : stages_) {
+    for (int i = 0; i < HardwareCounters::NUM_EVENTS; ++i) {
+      has_hardware_counters |= stage.hardware_counters[i] >= 0;
+    }
+  }
+  std::string out = "Stage          Attribute   Time [ms]       Bytes";
+  if (has_hardware_counters) {
+    out += "       Cycles    IPC  Cache misses Branch misses";
+  }
+  out += "\n";
+  char line[192];
+  for (const Stage &stage : stages_) {
+    char attribute[16] = "-";
+    if (stage.attribute_id >= 0) {
+      snprintf(attribute, sizeof(attribute), "%d", stage.attribute_id);
+    }
+    snprintf(line, sizeof(line), "%-14s %9s %11.3f %11" PRId64,
+             stage.name.c_str(), attribute, stage.time_us / 1000.0,
+             stage.num_bytes);
+    out += line;
+    if (has_hardware_counters) {
+      const int64_t *const counters = stage.hardware_counters;
+      char ipc[16] = "-";
+      if (counters[HardwareCounters::CYCLES] > 0 &&
+          counters[HardwareCounters::INSTRUCTIONS] >= 0) {
+        snprintf(ipc, sizeof(ipc), "%.2f",
+                 static_cast<double>(counters[HardwareCounters::INSTRUCTIONS]) /
+                     counters[HardwareCounters::CYCLES]);
+      }
+      snprintf(line, sizeof(line), " %12" PRId64 " %6s %13" PRId64 " %13" PRId64,
+               counters[HardwareCounters::CYCLES], ipc,
+               counters[HardwareCounters::CACHE_MISSES],
+               counters[HardwareCounters::BRANCH_MISSES]);
+      out += line;
+    }
+    out += "\n";
+  }
+  for (const auto &entry : peak_memory_) {
+    snprintf(line, sizeof(line), "Peak memory of %s: %" PRId64 " bytes\n",
+             entry.first.c_str(), entry.second);
+    out += line;
+  }
+  return out;
+}
+
+ScopedCodingStage::ScopedCodingStage(CodingStats *stats, CodingTracer *tracer,
+                                     const char *name, int attribute_id)
+    : ScopedCodingStage(stats, tracer, name, attribute_id,
+                        static_cast<const EncoderBuffer *>(nullptr)) {}
+
+ScopedCodingStage::ScopedCodingStage(CodingStats *stats, CodingTracer *tracer,
+                                     const char *name, int attribute_id,
+                                     const EncoderBuffer *buffer)
+    : stats_(stats),
+      tracer_(tracer),
+      name_(name),
+      attribute_id_(attribute_id),
+      encoder_buffer_(buffer),
+      decoder_buffer_(nullptr),
+      start_position_(0),
+      hardware_counters_started_(false) {
+  Begin();
+}
+
+ScopedCodingStage::ScopedCodingStage(CodingStats *stats, CodingTracer *tracer,
+                                     const char *name, int attribute_id,
+                                     const DecoderBuffer *buffer)
+    : stats_(stats),
+      tracer_(tracer),
+      name_(name),
+      attribute_id_(attribute_id),
+      encoder_buffer_(nullptr),
+      decoder_buffer_(buffer),
+      start_position_(0),
+      hardware_counters_started_(false) {
+  Begin();
+}
+
+void ScopedCodingStage::Begin() {
+#ifdef DRACO_TRACING_SUPPORTED
+  if (tracer_) {
+    tracer_->BeginStage(name_, attribute_id_);
+  }
+#endif
+  if (stats_) {
+    start_position_ = GetBufferPosition();
+    if (stats_->hardware_counters_enabled()) {
+      hardware_counters_started_ = hardware_counters_.Start();
+    }
+    timer_.Start();
+  }
+}
+
+ScopedCodingStage::~ScopedCodingStage() {
+  if (stats_) {
+    timer_.Stop();
+    CodingStats::Stage stage;
+    if (hardware_counters_started_) {
+      hardware_counters_.Stop();
+      for (int i = 0; i < HardwareCounters::NUM_EVENTS; ++i) {
+        stage.hardware_counters[i] =
+            hardware_counters_.value(static_cast<HardwareCounters::Event>(i));
+      }
+    }
+    stage.name = name_;
+    stage.attribute_id = attribute_id_;
+    stage.time_us = timer_.GetInUs();
+    stage.num_bytes = GetBufferPosition() - start_position_;
+    stats_->RecordStage(stage);
+  }
+#ifdef DRACO_TRACING_SUPPORTED
+  if (tracer_) {
+    tracer_->EndStage(name_, attribute_id_);
+  }
+#endif
+}
+
+int64_t ScopedCodingStage::GetBufferPosition() const {
+  if (encoder_buffer_) {
+    return static_cast<int64_t>(encoder_buffer_->size());
+  }
+  if (decoder_buffer_) {
+    // Some decoders re-initialize the buffer with the remaining data, which
+    // resets decoded_size(), so the position of the data head is used instead.
+    return static_cast<int64_t>(
+        reinterpret_cast<intptr_t>(decoder_buffer_->data_head()));
+  }
+  return 0;
+}
+
+}  // namespace draco
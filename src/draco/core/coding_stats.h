@@ -0,0 +1,156 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_CODING_STATS_H_
+#define DRACO_CORE_CODING_STATS_H_
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "draco/core/coding_tracer.h"
+#include "draco/core/cycle_timer.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/hardware_counters.h"
+#include "draco/core/macros.h"
+#include "draco/draco_features.h"
+
+namespace draco {
+
+// Collects wall time and the number of encoded bytes of individual stages of
+// the encoding or decoding pipeline. The collection is enabled by setting an
+// instance on the encoder or decoder options with SetCodingStats(); stages
+// are then recorded in the order in which they finish:
+//
+//   "header"        Draco header.
+//   "metadata"      Geometry metadata.
+//   "connectivity"  Encoder initialization and geometry data, e.g. the
+//                   Edgebreaker connectivity of meshes.
+//   "attributes"    All attribute data, including the stages below.
+//   "transform"     Portable transform of an attribute, e.g. quantization.
+//   "prediction"    Prediction scheme of an attribute.
+//   "entropy"       Entropy coding of an attribute.
+//
+// The per-attribute stages are recorded for attributes encoded with the
+// sequential attribute coders. Stages that run in parallel on a thread pool
+// overlap in time. Recording is thread safe.
+//
+// When enabled with SetHardwareCountersEnabled(), the hardware performance
+// counters of the thread running each stage are recorded as well (see
+// hardware_counters.h).
+class CodingStats {
+ public:
+  struct Stage {
+    Stage() : attribute_id(-1), time_us(0), num_bytes(0) {
+      for (int i = 0; i < HardwareCounters::NUM_EVENTS; ++i) {
+        hardware_counters[i] = -1;
+      }
+    }
+    std::string name;
+    // Point attribute id or -1 for stages that are not attribute specific.
+    int attribute_id;
+    int64_t time_us;
+    // Encoded size of the data written or read by the stage.
+    int64_t num_bytes;
+    // Values indexed by HardwareCounters::Event, -1 when not recorded.
+    int64_t hardware_counters[HardwareCounters::NUM_EVENTS];
+  };
+
+  CodingStats() : hardware_counters_enabled_(false) {}
+
+  void RecordStage(const std::string &name, int attribute_id,
+                   int64_t time_us, int64_t num_bytes);
+  void RecordStage(const Stage &stage);
+
+  void SetHardwareCountersEnabled(bool enabled) {
+    hardware_counters_enabled_ = enabled;
+  }
+  bool hardware_counters_enabled() const { return hardware_counters_enabled_; }
+
+  // Returns all stages recorded so far.
+  std::vector<Stage> stages() const;
+
+  // Returns the total time and number of bytes of all recorded stages with
+  // |name|. |attribute_id| = -2 matches stages of any attribute.
+  int64_t GetTotalTimeUs(const std::string &name, int attribute_id) const;
+  int64_t GetTotalBytes(const std::string &name, int attribute_id) const;
+
+  // Returns the total value of hardware counter |event| of all recorded stages
+  // with |name|, or -1 when the event was not recorded for any such stage.
+  int64_t GetTotalHardwareCounter(const std::string &name, int attribute_id,
+                                  HardwareCounters::Event event) const;
+
+  // Records the estimated peak working memory of stage |name| in bytes. Only
+  // the largest value recorded for each stage is kept, e.g. the peak over all
+  // meshes encoded with the same stats.
+  void RecordPeakMemory(const std::string &name, int64_t num_bytes);
+
+  // Returns the peak working memory recorded for stage |name| or 0 when none
+  // was recorded.
+  int64_t GetPeakMemory(const std::string &name) const;
+
+  void Clear();
+
+  // Returns a human readable table of all recorded stages.
+  std::string ToString() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<Stage> stages_;
+  std::vector<std::pair<std::string, int64_t>> peak_memory_;
+  bool hardware_counters_enabled_;
+
+  DISALLOW_COPY_AND_ASSIGN(CodingStats);
+};
+
+// Records the wall time of the enclosing scope as a stage of |stats|, along
+// with the number of bytes written to or read from |buffer| within the scope
+// and the hardware counters when they are enabled on |stats|. The scope is
+// also reported to |tracer| when tracing is compiled in. Both |stats| and
+// |tracer| can be nullptr.
+class ScopedCodingStage {
+ public:
+  ScopedCodingStage(CodingStats *stats, CodingTracer *tracer, const char *name,
+                    int attribute_id);
+  ScopedCodingStage(CodingStats *stats, CodingTracer *tracer, const char *name,
+                    int attribute_id, const EncoderBuffer *buffer);
+  ScopedCodingStage(CodingStats *stats, CodingTracer *tracer, const char *name,
+                    int attribute_id, const DecoderBuffer *buffer);
+  ~ScopedCodingStage();
+
+ private:
+  void Begin();
+  int64_t GetBufferPosition() const;
+
+  CodingStats *const stats_;
+  // Used only when DRACO_TRACING_SUPPORTED is defined.
+  CodingTracer *const tracer_;
+  const char *const name_;
+  const int attribute_id_;
+  const EncoderBuffer *const encoder_buffer_;
+  const DecoderBuffer *const decoder_buffer_;
+  int64_t start_position_;
+  DracoTimer timer_;
+  HardwareCounters hardware_counters_;
+  bool hardware_counters_started_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedCodingStage);
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_CODING_STATS_H_
@@ -0,0 +1,203 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/coding_stats.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "draco/compression/decode.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace {
+
+class CodingStatsTest : public ::testing::Test {
+ protected:
+  CodingStatsTest() {}
+};
+
+// Tracer that stores all received events as strings.
+class RecordingTracer : public draco::CodingTracer {
+ public:
+  void BeginStage(const char *name, int attribute_id) override {
+    AddEvent("begin", name, attribute_id);
+  }
+  void EndStage(const char *name, int attribute_id) override {
+    AddEvent("end", name, attribute_id);
+  }
+  std::vector<std::string> events() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_;
+  }
+
+ private:
+  void AddEvent(const char *type, const char *name, int attribute_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.push_back(std::string(type) + " " + name + " " +
+                      std::to_string(attribute_id));
+  }
+
+  mutable std::mutex mutex_;
+  std::vector<std::string> events_;
+};
+
+TEST_F(CodingStatsTest, TestRecordStages) {
+  // Tests that recorded stages are accumulated per name and attribute.
+  draco::CodingStats stats;
+  stats.RecordStage("entropy", 0, 10, 100);
+  stats.RecordStage("entropy", 1, 20, 200);
+  stats.RecordStage("entropy", 1, 5, 50);
+  stats.RecordStage("header", -1, 1, 11);
+  ASSERT_EQ(stats.stages().size(), 4);
+  ASSERT_EQ(stats.GetTotalBytes("entropy", 1), 250);
+  ASSERT_EQ(stats.GetTotalTimeUs("entropy", 1), 25);
+  ASSERT_EQ(stats.GetTotalBytes("entropy", -2), 350);
+  ASSERT_EQ(stats.GetTotalBytes("header", -1), 11);
+  ASSERT_EQ(stats.GetTotalBytes("prediction", -2), 0);
+  ASSERT_NE(stats.ToString().find("entropy"), std::string::npos);
+
+  // Only the largest peak memory of each stage is kept.
+  stats.RecordPeakMemory("connectivity", 1000);
+  stats.RecordPeakMemory("connectivity", 400);
+  ASSERT_EQ(stats.GetPeakMemory("connectivity"), 1000);
+  ASSERT_EQ(stats.GetPeakMemory("attributes"), 0);
+  ASSERT_NE(stats.ToString().find("Peak memory"), std::string::npos);
+  stats.Clear();
+  ASSERT_TRUE(stats.stages().empty());
+  ASSERT_EQ(stats.GetPeakMemory("connectivity"), 0);
+}
+
+TEST_F(CodingStatsTest, TestHardwareCounters) {
+  // Tests that hardware counters are accumulated per stage and reported only
+  // for stages that recorded them.
+  draco::CodingStats stats;
+  stats.RecordStage("entropy", 0, 10, 100);
+  ASSERT_EQ(stats.GetTotalHardwareCounter("entropy", 0,
+                                          draco::HardwareCounters::CYCLES),
+            -1);
+  ASSERT_EQ(stats.ToString().find("IPC"), std::string::npos);
+  draco::CodingStats::Stage stage;
+  stage.name = "entropy";
+  stage.attribute_id = 0;
+  stage.hardware_counters[draco::HardwareCounters::CYCLES] = 1000;
+  stage.hardware_counters[draco::HardwareCounters::INSTRUCTIONS] = 2000;
+  stats.RecordStage(stage);
+  stats.RecordStage(stage);
+  ASSERT_EQ(stats.GetTotalHardwareCounter("entropy", 0,
+                                          draco::HardwareCounters::CYCLES),
+            2000);
+  ASSERT_EQ(stats.GetTotalHardwareCounter(
+                "entropy", 0, draco::HardwareCounters::BRANCH_MISSES),
+            -1);
+  ASSERT_NE(stats.ToString().find("2.00"), std::string::npos);
+
+  // Counters may be unavailable, e.g. in containers, but enabling them must
+  // not affect decoding.
+  draco::HardwareCounters counters;
+  if (counters.Start()) {
+    counters.Stop();
+    ASSERT_GE(counters.value(draco::HardwareCounters::CYCLES), -1);
+  }
+}
+
+TEST_F(CodingStatsTest, TestEncodeDecodeStats) {
+  // Tests that encoding and decoding of a mesh reports all stages and that
+  // the byte counts add up to the size of the encoded data.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::ExpertEncoder encoder(*mesh);
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    encoder.SetAttributeQuantization(i, 10);
+  }
+  draco::CodingStats encoder_stats;
+  encoder.options().SetCodingStats(&encoder_stats);
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(&buffer));
+
+  const int64_t total_bytes = encoder_stats.GetTotalBytes("header", -1) +
+                              encoder_stats.GetTotalBytes("metadata", -1) +
+                              encoder_stats.GetTotalBytes("connectivity", -1) +
+                              encoder_stats.GetTotalBytes("attributes", -1);
+  ASSERT_EQ(total_bytes, static_cast<int64_t>(buffer.size()));
+  int64_t attribute_bytes = 0;
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    ASSERT_GT(encoder_stats.GetTotalBytes("entropy", i), 0);
+    attribute_bytes += encoder_stats.GetTotalBytes("entropy", i) +
+                       encoder_stats.GetTotalBytes("prediction", i) +
+                       encoder_stats.GetTotalBytes("transform", i);
+  }
+  ASSERT_LE(attribute_bytes, encoder_stats.GetTotalBytes("attributes", -1));
+
+  draco::CodingStats decoder_stats;
+  draco::Decoder decoder;
+  decoder.options()->SetCodingStats(&decoder_stats);
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  DRACO_ASSERT_OK(decoder.DecodeMeshFromBuffer(&in_buffer).status());
+  ASSERT_EQ(decoder_stats.GetTotalBytes("header", -1),
+            encoder_stats.GetTotalBytes("header", -1));
+  ASSERT_EQ(decoder_stats.GetTotalBytes("connectivity", -1),
+            encoder_stats.GetTotalBytes("connectivity", -1));
+  ASSERT_EQ(decoder_stats.GetTotalBytes("attributes", -1),
+            encoder_stats.GetTotalBytes("attributes", -1));
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    ASSERT_GT(decoder_stats.GetTotalBytes("entropy", i), 0);
+  }
+}
+
+TEST_F(CodingStatsTest, TestTracer) {
+  // Tests that the tracer receives matching begin and end events when tracing
+  // is compiled in, and no events otherwise.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::ExpertEncoder encoder(*mesh);
+  RecordingTracer encoder_tracer;
+  encoder.options().SetCodingTracer(&encoder_tracer);
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(&buffer));
+
+  RecordingTracer decoder_tracer;
+  draco::Decoder decoder;
+  decoder.options()->SetCodingTracer(&decoder_tracer);
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  DRACO_ASSERT_OK(decoder.DecodeMeshFromBuffer(&in_buffer).status());
+
+#ifdef DRACO_TRACING_SUPPORTED
+  for (const RecordingTracer *tracer : {&encoder_tracer, &decoder_tracer}) {
+    const std::vector<std::string> events = tracer->events();
+    ASSERT_FALSE(events.empty());
+    ASSERT_EQ(events.front(), "begin header -1");
+    ASSERT_EQ(events.back(), "end attributes -1");
+    int num_attribute_events = 0;
+    for (const std::string &event : events) {
+      if (event.find("transform 0") != std::string::npos) {
+        ++num_attribute_events;
+      }
+    }
+    ASSERT_EQ(num_attribute_events, 2);
+  }
+#else
+  ASSERT_TRUE(encoder_tracer.events().empty());
+  ASSERT_TRUE(decoder_tracer.events().empty());
+#endif
+}
+
+}  // namespace
@@ -0,0 +1,43 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_CODING_TRACER_H_
+#define DRACO_CORE_CODING_TRACER_H_
+
+namespace draco {
+
+// Interface for receiving begin and end events of the encoding and decoding
+// stages listed in coding_stats.h, e.g. for forwarding them as spans to an
+// external tracing system. A tracer is set on the encoder or decoder options
+// with SetCodingTracer().
+//
+// Events are emitted only when Draco is built with the DRACO_TRACING cmake
+// option. Otherwise all tracing code is compiled out and a set tracer is never
+// called.
+//
+// |attribute_id| is the point attribute id of per-attribute stages, or -1.
+// Stages of different attributes may run concurrently on the threads of a
+// thread pool set on the options, so implementations must be thread safe when
+// a thread pool is used. Begin and end events of one stage are always emitted
+// on the same thread.
+class CodingTracer {
+ public:
+  virtual ~CodingTracer() = default;
+  virtual void BeginStage(const char *name, int attribute_id) = 0;
+  virtual void EndStage(const char *name, int attribute_id) = 0;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_CODING_TRACER_H_
@@ -0,0 +1,195 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/cpu_features.h"
+
+#include <atomic>
+#include <cstdlib>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define DRACO_CPU_X86 1
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+#else
+#define DRACO_CPU_X86 0
+#endif
+
+namespace draco {
+
+namespace {
+
+// Forced target or -1 when the detected target is used.
+std::atomic<int> forced_simd_target(-1);
+
+bool IsX86SimdTarget(SimdTarget target) {
+  return target == SIMD_TARGET_SSE4_1 || target == SIMD_TARGET_AVX2 ||
+         target == SIMD_TARGET_AVX512;
+}
+
+// Returns true when |target| can be forced on a CPU supporting
+// |detected_target|.
+bool CanForceSimdTarget(SimdTarget target, SimdTarget detected_target) {
+  if (target == SIMD_TARGET_SCALAR || target == detected_target) {
+    return true;
+  }
+  return IsX86SimdTarget(target) && IsX86SimdTarget(detected_target) &&
+         target < detected_target;
+}
+
+SimdTarget DetectSimdTarget() {
+#if DRACO_CPU_X86
+#if defined(_MSC_VER)
+  int cpu_info[4];
+  __cpuid(cpu_info, 0);
+  const int max_leaf = cpu_info[0];
+  __cpuid(cpu_info, 1);
+  // SSE4.1 support is indicated by bit 19 of ECX.
+  const bool has_sse4_1 = (cpu_info[2] & (1 << 19)) != 0;
+  // AVX registers can be used only when the OS saves them (OSXSAVE, bit 27).
+  const bool has_osxsave = (cpu_info[2] & (1 << 27)) != 0;
+  const unsigned long long xcr0 = has_osxsave ? _xgetbv(0) : 0;
+  bool has_avx2 = false;
+  bool has_avx512 = false;
+  if (max_leaf >= 7) {
+    __cpuidex(cpu_info, 7, 0);
+    // AVX2 is bit 5 and AVX-512F is bit 16 of EBX. The OS must save the YMM
+    // state, plus the opmask and ZMM states for AVX-512.
+    has_avx2 = (cpu_info[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+    has_avx512 = (cpu_info[1] & (1 << 16)) != 0 && (xcr0 & 0xe6) == 0xe6;
+  }
+#else
+  __builtin_cpu_init();
+  const bool has_sse4_1 = __builtin_cpu_supports("sse4.1");
+  const bool has_avx2 = __builtin_cpu_supports("avx2");
+  const bool has_avx512 = __builtin_cpu_supports("avx512f");
+#endif
+  if (has_avx512 && has_avx2 && has_sse4_1) {
+    return SIMD_TARGET_AVX512;
+  }
+  if (has_avx2 && has_sse4_1) {
+    return SIMD_TARGET_AVX2;
+  }
+  if (has_sse4_1) {
+    return SIMD_TARGET_SSE4_1;
+  }
+#elif DRACO_ENABLE_NEON
+  // NEON support is determined when the library is configured.
+  return SIMD_TARGET_NEON;
+#elif DRACO_ENABLE_WASM_SIMD
+  // Determined when the module is built (see cpu_features.h).
+  return SIMD_TARGET_WASM_SIMD;
+#endif
+  return SIMD_TARGET_SCALAR;
+}
+
+// Detects the target and applies DRACO_SIMD_TARGET on the first call.
+SimdTarget DetectedSimdTarget() {
+  static const SimdTarget detected_target = [] {
+    const SimdTarget target = DetectSimdTarget();
+    const char *const env_target = std::getenv("DRACO_SIMD_TARGET");
+    SimdTarget forced_target;
+    if (env_target != nullptr && ParseSimdTarget(env_target, &forced_target) &&
+        CanForceSimdTarget(forced_target, target)) {
+      forced_simd_target = forced_target;
+    }
+    return target;
+  }();
+  return detected_target;
+}
+
+}  // namespace
+
+SimdTarget GetDetectedSimdTarget() { return DetectedSimdTarget(); }
+
+SimdTarget GetSimdTarget() {
+  const SimdTarget detected_target = DetectedSimdTarget();
+  const int forced_target = forced_simd_target;
+  if (forced_target >= 0) {
+    return static_cast<SimdTarget>(forced_target);
+  }
+  return detected_target;
+}
+
+bool ForceSimdTarget(SimdTarget target) {
+  if (!CanForceSimdTarget(target, DetectedSimdTarget())) {
+    return false;
+  }
+  forced_simd_target = target;
+  return true;
+}
+
+void ResetSimdTarget() {
+  DetectedSimdTarget();
+  forced_simd_target = -1;
+}
+
+const char *SimdTargetName(SimdTarget target) {
+  switch (target) {
+    case SIMD_TARGET_SCALAR:
+      return "scalar";
+    case SIMD_TARGET_SSE4_1:
+      return "sse4.1";
+    case SIMD_TARGET_AVX2:
+      return "avx2";
+    case SIMD_TARGET_AVX512:
+      return "avx512";
+    case SIMD_TARGET_NEON:
+      return "neon";
+    case SIMD_TARGET_WASM_SIMD:
+      return "wasm_simd";
+  }
+  return "unknown";
+}
+
+bool ParseSimdTarget(const std::string &name, SimdTarget *out_target) {
+  for (int i = SIMD_TARGET_SCALAR; i <= SIMD_TARGET_WASM_SIMD; ++i) {
+    const SimdTarget target = static_cast<SimdTarget>(i);
+    if (name == SimdTargetName(target)) {
+      *out_target = target;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool CpuSupportsSse4_1() {
+#if DRACO_ENABLE_SSE4_1
+  // SSE4.1 kernels are also used on CPUs with higher x86 targets.
+  const SimdTarget target = GetSimdTarget();
+  return IsX86SimdTarget(target) && target >= SIMD_TARGET_SSE4_1;
+#else
+  return false;
+#endif
+}
+
+bool CpuSupportsNeon() {
+#if DRACO_ENABLE_NEON
+  return GetSimdTarget() == SIMD_TARGET_NEON;
+#else
+  return false;
+#endif
+}
+
+bool CpuSupportsWasmSimd() {
+#if DRACO_ENABLE_WASM_SIMD
+  return GetSimdTarget() == SIMD_TARGET_WASM_SIMD;
+#else
+  return false;
+#endif
+}
+
+}  // namespace draco
@@ -0,0 +1,86 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_CPU_FEATURES_H_
+#define DRACO_CORE_CPU_FEATURES_H_
+
+#include <string>
+
+namespace draco {
+
+// Instruction sets that vectorized kernels can target. The x86 targets are
+// ordered so that each of them includes the instruction sets of all
+// preceding x86 targets.
+enum SimdTarget {
+  SIMD_TARGET_SCALAR = 0,
+  SIMD_TARGET_SSE4_1,
+  SIMD_TARGET_AVX2,
+  SIMD_TARGET_AVX512,
+  SIMD_TARGET_NEON,
+  SIMD_TARGET_WASM_SIMD,
+};
+
+// Runtime CPU dispatch used by all vectorized kernels of the library. The best
+// target supported by the CPU is detected once on the first call. Kernels
+// query GetSimdTarget(), or one of the CpuSupports*() functions below, and use
+// the best implementation that was built for a target not above it. All
+// functions are thread-safe.
+//
+// The target can be lowered for benchmarking and testing, either with
+// ForceSimdTarget() or with the DRACO_SIMD_TARGET environment variable that
+// is read on the first call and accepts the names returned by
+// SimdTargetName(), e.g., DRACO_SIMD_TARGET=sse4.1.
+
+// Returns the best target supported by the CPU, regardless of any forced
+// target. On x86, the result doesn't depend on the build configuration.
+SimdTarget GetDetectedSimdTarget();
+
+// Returns the target that vectorized kernels may use.
+SimdTarget GetSimdTarget();
+
+// Forces vectorized kernels to use |target|. Returns false and keeps the
+// current target when |target| is not supported by the CPU. Forcing an x86
+// target also disables kernels of higher x86 targets.
+bool ForceSimdTarget(SimdTarget target);
+
+// Reverts the effect of ForceSimdTarget() and DRACO_SIMD_TARGET.
+void ResetSimdTarget();
+
+// Returns the name of |target|, e.g., "avx2".
+const char *SimdTargetName(SimdTarget target);
+
+// Parses a target |name| returned by SimdTargetName(). Returns false when the
+// name is not known.
+bool ParseSimdTarget(const std::string &name, SimdTarget *out_target);
+
+// Functions used to select SIMD implementations at runtime. Each function
+// returns true only when the corresponding instruction set is supported by
+// both the build configuration and the CPU running the code, and when it is
+// not disabled by a forced target.
+
+// Returns true when SSE4.1 code paths can be used.
+bool CpuSupportsSse4_1();
+
+// Returns true when NEON code paths can be used.
+bool CpuSupportsNeon();
+
+// Returns true when 128-bit WebAssembly SIMD code paths can be used.
+// WebAssembly modules cannot detect SIMD support at runtime, a module built
+// with SIMD fails to load on engines without it. The selection between SIMD
+// and scalar builds is done by the JavaScript loader instead.
+bool CpuSupportsWasmSimd();
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_CPU_FEATURES_H_
@@ -0,0 +1,88 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/cpu_features.h"
+
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/quantization_utils.h"
+
+namespace draco {
+
+class CpuFeaturesTest : public ::testing::Test {
+ protected:
+  ~CpuFeaturesTest() override { ResetSimdTarget(); }
+};
+
+TEST_F(CpuFeaturesTest, TestForceScalarTarget) {
+  // Tests that forcing the scalar target disables all vectorized kernels and
+  // that the kernels produce the same results as the scalar code.
+  std::vector<float> values(1003);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = 0.37f * i - 100.f;
+  }
+  Quantizer quantizer;
+  quantizer.Init(1000.f, (1 << 16) - 1);
+  std::vector<int32_t> quantized(values.size());
+  quantizer.QuantizeValues(values.data(), values.size(), 7, quantized.data());
+
+  ASSERT_TRUE(ForceSimdTarget(SIMD_TARGET_SCALAR));
+  ASSERT_EQ(GetSimdTarget(), SIMD_TARGET_SCALAR);
+  ASSERT_FALSE(CpuSupportsSse4_1());
+  ASSERT_FALSE(CpuSupportsNeon());
+  ASSERT_FALSE(CpuSupportsWasmSimd());
+  std::vector<int32_t> scalar_quantized(values.size());
+  quantizer.QuantizeValues(values.data(), values.size(), 7,
+                           scalar_quantized.data());
+  ASSERT_EQ(quantized, scalar_quantized);
+
+  ResetSimdTarget();
+  ASSERT_EQ(GetSimdTarget(), GetDetectedSimdTarget());
+}
+
+TEST_F(CpuFeaturesTest, TestForceLowerX86Target) {
+  // Tests that an x86 target can be lowered but not raised above the target
+  // detected for the CPU.
+  const SimdTarget detected_target = GetDetectedSimdTarget();
+  ASSERT_TRUE(ForceSimdTarget(detected_target));
+  ASSERT_EQ(GetSimdTarget(), detected_target);
+  if (detected_target == SIMD_TARGET_AVX2 ||
+      detected_target == SIMD_TARGET_AVX512) {
+    ASSERT_TRUE(ForceSimdTarget(SIMD_TARGET_SSE4_1));
+    ASSERT_EQ(GetSimdTarget(), SIMD_TARGET_SSE4_1);
+  }
+  if (detected_target != SIMD_TARGET_AVX512) {
+    ASSERT_FALSE(ForceSimdTarget(SIMD_TARGET_AVX512));
+  }
+  if (detected_target != SIMD_TARGET_NEON) {
+    // The forced target is not changed by an unsupported target.
+    const SimdTarget target = GetSimdTarget();
+    ASSERT_FALSE(ForceSimdTarget(SIMD_TARGET_NEON));
+    ASSERT_EQ(GetSimdTarget(), target);
+  }
+}
+
+TEST_F(CpuFeaturesTest, TestTargetNames) {
+  for (int i = SIMD_TARGET_SCALAR; i <= SIMD_TARGET_WASM_SIMD; ++i) {
+    const SimdTarget target = static_cast<SimdTarget>(i);
+    SimdTarget parsed_target;
+    ASSERT_TRUE(ParseSimdTarget(SimdTargetName(target), &parsed_target));
+    ASSERT_EQ(parsed_target, target);
+  }
+  SimdTarget parsed_target;
+  ASSERT_FALSE(ParseSimdTarget("mmx", &parsed_target));
+}
+
+}  // namespace draco
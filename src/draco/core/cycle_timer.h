@@ -38,6 +38,7 @@ class DracoTimer {
   void Start();
   void Stop();
   int64_t GetInMs();
+  int64_t GetInUs();
 
  private:
   DracoTimeVal tv_start_;
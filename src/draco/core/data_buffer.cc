@@ -18,7 +18,68 @@
 
 namespace draco {
 
-DataBuffer::DataBuffer() {}
+DataBuffer::DataBuffer()
+    : data_(std::make_shared<Storage>()),
+      external_data_(nullptr),
+      external_size_(0),
+      is_modified_(true) {}
+
+DataBuffer::DataBuffer(MemoryArena *arena)
+    : data_(std::make_shared<Storage>(ArenaAllocator<uint8_t>(arena))),
+      external_data_(nullptr),
+      external_size_(0),
+      is_modified_(true) {}
+
+DataBuffer::DataBuffer(const DataBuffer &src)
+    : external_data_(src.external_data_),
+      external_size_(src.external_size_),
+      descriptor_(src.descriptor_),
+      is_modified_(true) {
+  if (src.memory_arena() == nullptr) {
+    data_ = src.data_;
+  } else {
+    data_ = std::make_shared<Storage>(*src.data_);
+  }
+}
+
+DataBuffer &DataBuffer::operator=(const DataBuffer &src) {
+  if (this != &src) {
+    const DataBuffer copy(src);
+    descriptor_ = src.descriptor_;
+    data_ = copy.data_;
+    external_data_ = copy.external_data_;
+    external_size_ = copy.external_size_;
+    MarkModified();
+  }
+  return *this;
+}
+
+void DataBuffer::ShareFrom(const DataBuffer &src) {
+  if (src.data_ != data_ || src.external_data_ != external_data_ ||
+      src.external_size_ != external_size_) {
+    if (memory_arena() == nullptr && src.memory_arena() == nullptr) {
+      data_ = src.data_;
+      external_data_ = src.external_data_;
+      external_size_ = src.external_size_;
+    } else {
+      Update(src.data(), src.data_size());
+      return;
+    }
+  }
+  descriptor_.buffer_update_count++;
+  MarkModified();
+}
+
+void DataBuffer::SetExternalData(const void *data, int64_t size) {
+  if (!data_->empty()) {
+    // Release the storage, it is not used while the data is external.
+    data_ = std::make_shared<Storage>(data_->get_allocator());
+  }
+  external_data_ = static_cast<const uint8_t *>(data);
+  external_size_ = external_data_ == nullptr ? 0 : size;
+  descriptor_.buffer_update_count++;
+  MarkModified();
+}
 
 bool DataBuffer::Update(const void *data, int64_t size) {
   const int64_t offset = 0;
@@ -31,31 +92,59 @@ bool DataBuffer::Update(const void *data, int64_t size, int64_t offset) {
       return false;
     }
     // If no data is provided, just resize the buffer.
-    data_.resize(size + offset);
+    DetachData();
+    data_->resize(size + offset, 0);
   } else {
     if (size < 0) {
       return false;
     }
-    if (size + offset > static_cast<int64_t>(data_.size())) {
-      data_.resize(size + offset);
+    if (offset == 0 && size >= static_cast<int64_t>(data_size()) &&
+        (data_.use_count() > 1 || HasExternalData())) {
+      // All shared or external data is overwritten so there is no need to
+      // copy it.
+      data_ = std::make_shared<Storage>(data_->get_allocator());
+      external_data_ = nullptr;
+      external_size_ = 0;
+    }
+    DetachData();
+    const int64_t old_size = static_cast<int64_t>(data_->size());
+    if (size + offset > old_size) {
+      // Only the gap between the old end of the buffer and |offset| needs to
+      // be cleared, the rest is overwritten below.
+      data_->resize(size + offset);
+      if (offset > old_size) {
+        std::fill(data_->begin() + old_size, data_->begin() + offset, 0);
+      }
     }
     const uint8_t *const byte_data = static_cast<const uint8_t *>(data);
-    std::copy(byte_data, byte_data + size, data_.data() + offset);
+    std::copy(byte_data, byte_data + size, data_->data() + offset);
   }
   descriptor_.buffer_update_count++;
+  MarkModified();
   return true;
 }
 
 void DataBuffer::Resize(int64_t size) {
-  data_.resize(size);
+  DetachData();
+  data_->resize(size, 0);
+  descriptor_.buffer_update_count++;
+  MarkModified();
+}
+
+void DataBuffer::ResizeUninitialized(int64_t size) {
+  DetachData();
+  data_->resize(size);
   descriptor_.buffer_update_count++;
+  MarkModified();
 }
 
 void DataBuffer::WriteDataToStream(std::ostream &stream) {
-  if (data_.empty()) {
+  const DataBuffer &buffer = *this;
+  if (buffer.data_size() == 0) {
     return;
   }
-  stream.write(reinterpret_cast<char *>(data_.data()), data_.size());
+  stream.write(reinterpret_cast<const char *>(buffer.data()),
+               buffer.data_size());
 }
 
 }  // namespace draco
@@ -15,11 +15,15 @@
 #ifndef DRACO_CORE_DATA_BUFFER_H_
 #define DRACO_CORE_DATA_BUFFER_H_
 
+#include <atomic>
 #include <cstring>
+#include <memory>
 #include <ostream>
 #include <vector>
 
+#include "draco/core/default_init_allocator.h"
 #include "draco/core/draco_types.h"
+#include "draco/core/memory_arena.h"
 
 namespace draco {
 
@@ -33,14 +37,52 @@ struct DataBufferDescriptor {
 };
 
 // Class used for storing raw buffer data.
+//
+// Copies of a buffer share its data until either of them is modified, at which
+// point the modified buffer gets its own copy of the data (copy-on-write). All
+// mutable accessors, including the non-const data(), detach the buffer from
+// the shared data, so read-only code should access the buffer through a const
+// reference. Buffers allocated from a MemoryArena never share their data,
+// because the copies could outlive the arena.
+//
+// A buffer can also refer to external memory owned by the caller, see
+// SetExternalData(). External data is treated like shared data: it is never
+// written to and mutable accessors copy it into the buffer's own storage.
 class DataBuffer {
  public:
   DataBuffer();
+  // Creates a buffer whose storage is allocated from |arena|. The buffer must
+  // not outlive the arena. |arena| can be nullptr in which case the default
+  // heap allocator is used.
+  explicit DataBuffer(MemoryArena *arena);
+  DataBuffer(const DataBuffer &src);
+  DataBuffer &operator=(const DataBuffer &src);
+
+  // Replaces the data of this buffer with the data of |src|. The data is
+  // shared instead of copied when neither buffer uses a MemoryArena. Like
+  // Update(), the function increments the update count of this buffer.
+  void ShareFrom(const DataBuffer &src);
+
+  // Returns true when the data is currently shared with another buffer.
+  bool IsDataShared() const { return data_.use_count() > 1; }
+
+  // Makes the buffer refer to |size| bytes at |data| instead of storing its
+  // own copy. The memory must stay valid and unchanged for as long as this
+  // buffer, or any copy of it, reads the data. Like Update(), the function
+  // increments the update count of this buffer.
+  void SetExternalData(const void *data, int64_t size);
+
+  // Returns true when the data is stored in external memory.
+  bool HasExternalData() const { return external_data_ != nullptr; }
   bool Update(const void *data, int64_t size);
   bool Update(const void *data, int64_t size, int64_t offset);
 
   // Reallocate the buffer storage to a new size keeping the data unchanged.
+  // Newly added bytes are set to zero.
   void Resize(int64_t new_size);
+  // Same as Resize() but newly added bytes are left uninitialized. Use only
+  // when the caller overwrites all the new bytes before they are read.
+  void ResizeUninitialized(int64_t new_size);
   void WriteDataToStream(std::ostream &stream);
   // Reads data from the buffer. Potentially unsafe, called needs to ensure
   // the accessed memory is valid.
@@ -51,30 +93,91 @@ class DataBuffer {
   // Writes data to the buffer. Unsafe, caller must ensure the accessed memory
   // is valid.
   void Write(int64_t byte_pos, const void *in_data, size_t data_size) {
-    memcpy(const_cast<uint8_t *>(data()) + byte_pos, in_data, data_size);
+    memcpy(data() + byte_pos, in_data, data_size);
   }
 
   // Copies data from another buffer to this buffer.
   void Copy(int64_t dst_offset, const DataBuffer *src_buf, int64_t src_offset,
             int64_t size) {
-    memcpy(const_cast<uint8_t *>(data()) + dst_offset,
-           src_buf->data() + src_offset, size);
+    uint8_t *const dst = data();
+    memcpy(dst + dst_offset, src_buf->data() + src_offset, size);
   }
 
   void set_update_count(int64_t buffer_update_count) {
     descriptor_.buffer_update_count = buffer_update_count;
   }
   int64_t update_count() const { return descriptor_.buffer_update_count; }
-  size_t data_size() const { return data_.size(); }
-  const uint8_t *data() const { return data_.data(); }
-  uint8_t *data() { return data_.data(); }
+
+  // Returns true when the data may have been modified since the last call of
+  // ClearModified(). The flag is set by all mutable accessors, including the
+  // non-const data(), so it can be used to detect that values computed from
+  // the data are out of date. Note that writes through pointers obtained
+  // before ClearModified() was called are not detected.
+  bool IsModified() const {
+    return is_modified_.load(std::memory_order_relaxed);
+  }
+  void ClearModified() { is_modified_.store(false, std::memory_order_relaxed); }
+  size_t data_size() const {
+    return HasExternalData() ? external_size_ : data_->size();
+  }
+  // Returns the number of bytes allocated for the data, including unused
+  // capacity. Shared data is included in full, external data is not included.
+  size_t memory_usage() const { return data_->capacity(); }
+  // Releases unused capacity of the data. Does nothing when the data is
+  // shared with another buffer or allocated from a MemoryArena.
+  void ShrinkToFit() {
+    if (!IsDataShared() && memory_arena() == nullptr) {
+      data_->shrink_to_fit();
+    }
+  }
+  const uint8_t *data() const {
+    return HasExternalData() ? external_data_ : data_->data();
+  }
+  uint8_t *data() {
+    DetachData();
+    MarkModified();
+    return data_->data();
+  }
   int64_t buffer_id() const { return descriptor_.buffer_id; }
   void set_buffer_id(int64_t buffer_id) { descriptor_.buffer_id = buffer_id; }
+  MemoryArena *memory_arena() const { return data_->get_allocator().arena(); }
 
  private:
-  std::vector<uint8_t> data_;
+  typedef std::vector<uint8_t,
+                      DefaultInitAllocator<uint8_t, ArenaAllocator<uint8_t>>>
+      Storage;
+
+  // Makes sure that the data is not shared with any other buffer and that it
+  // is not stored in external memory.
+  void DetachData() {
+    if (HasExternalData()) {
+      auto storage = std::make_shared<Storage>(external_data_,
+                                               external_data_ + external_size_,
+                                               data_->get_allocator());
+      data_ = std::move(storage);
+      external_data_ = nullptr;
+      external_size_ = 0;
+    } else if (data_.use_count() > 1) {
+      data_ = std::make_shared<Storage>(*data_);
+    }
+  }
+
+  void MarkModified() {
+    // The flag is read first so that threads writing concurrently to an
+    // already modified buffer do not contend for the flag.
+    if (!is_modified_.load(std::memory_order_relaxed)) {
+      is_modified_.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  std::shared_ptr<Storage> data_;
+  // External memory holding the data, see SetExternalData(). |data_| is not
+  // used while |external_data_| is set.
+  const uint8_t *external_data_;
+  size_t external_size_;
   // Counter incremented by Update() calls.
   DataBufferDescriptor descriptor_;
+  std::atomic<bool> is_modified_;
 };
 
 }  // namespace draco
@@ -0,0 +1,158 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/data_buffer.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/memory_arena.h"
+
+namespace {
+
+TEST(DataBufferTest, CopiesShareDataUntilModified) {
+  const std::vector<uint8_t> values = {1, 2, 3, 4};
+  draco::DataBuffer buffer;
+  ASSERT_TRUE(buffer.Update(values.data(), values.size()));
+
+  draco::DataBuffer copy(buffer);
+  const draco::DataBuffer &const_copy = copy;
+  ASSERT_TRUE(buffer.IsDataShared());
+  ASSERT_EQ(const_copy.data(),
+            static_cast<const draco::DataBuffer &>(buffer).data());
+
+  // Writing to the copy must not change the source.
+  const uint8_t value = 9;
+  copy.Write(1, &value, 1);
+  ASSERT_FALSE(buffer.IsDataShared());
+  ASSERT_FALSE(copy.IsDataShared());
+  ASSERT_EQ(buffer.data()[1], 2);
+  ASSERT_EQ(copy.data()[1], 9);
+  ASSERT_EQ(copy.data()[3], 4);
+}
+
+TEST(DataBufferTest, ShareFrom) {
+  const std::vector<uint8_t> values = {1, 2, 3, 4};
+  draco::DataBuffer buffer;
+  ASSERT_TRUE(buffer.Update(values.data(), values.size()));
+
+  draco::DataBuffer shared;
+  const int64_t update_count = shared.update_count();
+  shared.ShareFrom(buffer);
+  ASSERT_TRUE(shared.IsDataShared());
+  ASSERT_EQ(shared.data_size(), 4);
+  ASSERT_EQ(shared.update_count(), update_count + 1);
+
+  // Resizing the source detaches it from the shared data.
+  buffer.Resize(2);
+  ASSERT_EQ(buffer.data_size(), 2);
+  ASSERT_EQ(shared.data_size(), 4);
+  ASSERT_FALSE(shared.IsDataShared());
+
+  // Overwriting all shared data does not need to copy it first.
+  shared.ShareFrom(buffer);
+  const std::vector<uint8_t> new_values = {5, 6, 7};
+  ASSERT_TRUE(shared.Update(new_values.data(), new_values.size()));
+  ASSERT_EQ(shared.data_size(), 3);
+  ASSERT_EQ(shared.data()[0], 5);
+  ASSERT_EQ(buffer.data_size(), 2);
+  ASSERT_EQ(buffer.data()[0], 1);
+}
+
+TEST(DataBufferTest, ArenaBuffersAreNotShared) {
+  const std::vector<uint8_t> values = {1, 2, 3, 4};
+  draco::MemoryArena arena;
+  draco::DataBuffer buffer(&arena);
+  ASSERT_TRUE(buffer.Update(values.data(), values.size()));
+
+  draco::DataBuffer shared;
+  shared.ShareFrom(buffer);
+  ASSERT_FALSE(shared.IsDataShared());
+  ASSERT_EQ(shared.memory_arena(), nullptr);
+  ASSERT_EQ(shared.data()[3], 4);
+
+  const draco::DataBuffer copy(buffer);
+  ASSERT_FALSE(copy.IsDataShared());
+  ASSERT_EQ(copy.memory_arena(), nullptr);
+}
+
+TEST(DataBufferTest, ResizeClearsNewBytes) {
+  const std::vector<uint8_t> values = {1, 2, 3, 4};
+  draco::DataBuffer buffer;
+  ASSERT_TRUE(buffer.Update(values.data(), values.size()));
+
+  // Bytes added by Resize() are zero even when the storage is reused.
+  buffer.Resize(2);
+  buffer.Resize(4);
+  ASSERT_EQ(buffer.data()[1], 2);
+  ASSERT_EQ(buffer.data()[2], 0);
+  ASSERT_EQ(buffer.data()[3], 0);
+
+  // The gap in front of data written past the end of the buffer is cleared.
+  buffer.ResizeUninitialized(2);
+  const uint8_t value = 9;
+  ASSERT_TRUE(buffer.Update(&value, 1, 5));
+  ASSERT_EQ(buffer.data_size(), 6);
+  ASSERT_EQ(buffer.data()[1], 2);
+  ASSERT_EQ(buffer.data()[2], 0);
+  ASSERT_EQ(buffer.data()[4], 0);
+  ASSERT_EQ(buffer.data()[5], 9);
+
+  // ResizeUninitialized() keeps the existing data.
+  const int64_t update_count = buffer.update_count();
+  buffer.ResizeUninitialized(16);
+  ASSERT_EQ(buffer.data_size(), 16);
+  ASSERT_EQ(buffer.data()[0], 1);
+  ASSERT_EQ(buffer.data()[5], 9);
+  ASSERT_EQ(buffer.update_count(), update_count + 1);
+}
+
+TEST(DataBufferTest, ExternalDataIsCopiedOnWrite) {
+  const std::vector<uint8_t> values = {1, 2, 3, 4};
+  draco::DataBuffer buffer;
+  buffer.SetExternalData(values.data(), values.size());
+  const draco::DataBuffer &const_buffer = buffer;
+  ASSERT_TRUE(buffer.HasExternalData());
+  ASSERT_EQ(const_buffer.data(), values.data());
+  ASSERT_EQ(buffer.data_size(), 4);
+  ASSERT_EQ(buffer.memory_usage(), 0);
+
+  // Copies refer to the same external memory.
+  draco::DataBuffer copy(buffer);
+  ASSERT_TRUE(copy.HasExternalData());
+  ASSERT_EQ(static_cast<const draco::DataBuffer &>(copy).data(),
+            values.data());
+
+  // Writing to the buffer copies the data and leaves the external memory and
+  // the copy untouched.
+  const uint8_t value = 9;
+  buffer.Write(1, &value, 1);
+  ASSERT_FALSE(buffer.HasExternalData());
+  ASSERT_EQ(buffer.data_size(), 4);
+  ASSERT_EQ(buffer.data()[1], 9);
+  ASSERT_EQ(buffer.data()[3], 4);
+  ASSERT_EQ(values[1], 2);
+  ASSERT_EQ(static_cast<const draco::DataBuffer &>(copy).data()[1], 2);
+
+  // Overwriting all the data does not need to read the external memory.
+  const std::vector<uint8_t> new_values = {5, 6, 7, 8};
+  ASSERT_TRUE(copy.Update(new_values.data(), new_values.size()));
+  ASSERT_FALSE(copy.HasExternalData());
+  ASSERT_EQ(copy.data_size(), 4);
+  ASSERT_EQ(copy.data()[0], 5);
+  ASSERT_EQ(values[0], 1);
+}
+
+}  // namespace
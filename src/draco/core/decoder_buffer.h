@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 
@@ -146,12 +147,7 @@ class DecoderBuffer {
     inline uint32_t EnsureBits(int k) {
       DRACO_DCHECK_LE(k, 24);
       DRACO_DCHECK_LE(static_cast<uint64_t>(k), AvailBits());
-
-      uint32_t buf = 0;
-      for (int i = 0; i < k; ++i) {
-        buf |= PeekBit(i) << i;
-      }
-      return buf;  // Okay to return extra bits
+      return static_cast<uint32_t>(PeekBits(k));
     }
 
     inline void ConsumeBits(int k) { bit_offset_ += k; }
@@ -161,38 +157,40 @@ class DecoderBuffer {
       if (nbits > 32) {
         return false;
       }
-      uint32_t value = 0;
-      for (uint32_t bit = 0; bit < nbits; ++bit) {
-        value |= GetBit() << bit;
-      }
-      *x = value;
+      *x = static_cast<uint32_t>(PeekBits(nbits));
+      // Bits past the end of the buffer are not consumed.
+      const size_t total_bits = (bit_buffer_end_ - bit_buffer_) * 8;
+      bit_offset_ = std::min(bit_offset_ + nbits, total_bits);
       return true;
     }
 
    private:
     // TODO(fgalligan): Add support for error reporting on range check.
-    // Returns one bit from the bit buffer.
-    inline int GetBit() {
-      const size_t off = bit_offset_;
-      const size_t byte_offset = off >> 3;
-      const int bit_shift = static_cast<int>(off & 0x7);
-      if (bit_buffer_ + byte_offset < bit_buffer_end_) {
-        const int bit = (bit_buffer_[byte_offset] >> bit_shift) & 1;
-        bit_offset_ = off + 1;
-        return bit;
+    // Returns the next |nbits| bits (at most 32) without consuming them. Bits
+    // past the end of the buffer are returned as zeros.
+    inline uint64_t PeekBits(uint32_t nbits) const {
+      if (nbits == 0) {
+        return 0;
       }
-      return 0;
-    }
-
-    inline int PeekBit(int offset) {
-      const size_t off = bit_offset_ + offset;
-      const size_t byte_offset = off >> 3;
-      const int bit_shift = static_cast<int>(off & 0x7);
-      if (bit_buffer_ + byte_offset < bit_buffer_end_) {
-        const int bit = (bit_buffer_[byte_offset] >> bit_shift) & 1;
-        return bit;
+      const size_t byte_offset = bit_offset_ >> 3;
+      const int bit_shift = static_cast<int>(bit_offset_ & 0x7);
+      const size_t buffer_size = bit_buffer_end_ - bit_buffer_;
+      if (byte_offset >= buffer_size) {
+        return 0;
+      }
+      // Load up to 8 bytes (at least 32 + 7 bits are needed) into a 64-bit
+      // little-endian register.
+      uint64_t word = 0;
+      const size_t bytes_left = buffer_size - byte_offset;
+      if (bytes_left >= sizeof(word)) {
+        memcpy(&word, bit_buffer_ + byte_offset, sizeof(word));
+      } else {
+        for (size_t i = 0; i < bytes_left; ++i) {
+          word |= static_cast<uint64_t>(bit_buffer_[byte_offset + i])
+                  << (8 * i);
+        }
       }
-      return 0;
+      return (word >> bit_shift) & ((uint64_t(1) << nbits) - 1);
     }
 
     const uint8_t *bit_buffer_;
@@ -0,0 +1,239 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_DEDUPLICATION_UTILS_H_
+#define DRACO_CORE_DEDUPLICATION_UTILS_H_
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "draco/core/hash_utils.h"
+#include "draco/core/thread_pool.h"
+
+namespace draco {
+
+namespace internal {
+
+// Minimum number of items per partition for the partitioned mode of
+// FindFirstOccurrences(). Smaller inputs are processed on a single thread.
+constexpr uint32_t kMinItemsPerDeduplicationPartition = 1 << 15;
+
+// Marks unused slots of FirstOccurrenceTable.
+constexpr uint32_t kEmptyDeduplicationSlot = 0xffffffff;
+
+// Open-addressing hash table with linear probing that stores item indices.
+// Inserted items must be processed in increasing order of their indices so
+// that the stored index of each distinct item is its first occurrence.
+template <class EqualFunctionT>
+class FirstOccurrenceTable {
+ public:
+  FirstOccurrenceTable(uint32_t num_items, const std::vector<uint64_t> &hashes,
+                       const EqualFunctionT &equal)
+      : hashes_(hashes), equal_(equal) {
+    // Keep the load factor at or below 0.5.
+    uint32_t capacity = 16;
+    while (capacity < 2 * static_cast<uint64_t>(num_items)) {
+      capacity *= 2;
+    }
+    slots_.resize(capacity, kEmptyDeduplicationSlot);
+    mask_ = capacity - 1;
+  }
+
+  // Returns the index of the first item equal to |item|, inserting |item| when
+  // no such item exists yet.
+  uint32_t FindOrInsert(uint32_t item) {
+    const uint64_t hash = hashes_[item];
+    uint32_t slot = static_cast<uint32_t>(hash) & mask_;
+    while (true) {
+      const uint32_t other = slots_[slot];
+      if (other == kEmptyDeduplicationSlot) {
+        slots_[slot] = item;
+        return item;
+      }
+      if (hashes_[other] == hash && equal_(other, item)) {
+        return other;
+      }
+      slot = (slot + 1) & mask_;
+    }
+  }
+
+ private:
+  const std::vector<uint64_t> &hashes_;
+  const EqualFunctionT &equal_;
+  std::vector<uint32_t> slots_;
+  uint32_t mask_;
+};
+
+}  // namespace internal
+
+// Finds duplicates among |num_items| items. |hash| returns a uint64_t hash of
+// an item given its index and |equal| returns true when two items given by
+// their indices are equal. For every item, |first_occurrence| is set to the
+// index of the first item that is equal to it, i.e. unique items point to
+// themselves. Both functions must be thread-safe when |pool| is not nullptr.
+//
+// When a |pool| is provided, the items are split into partitions by the high
+// bits of their hashes and each partition is deduplicated independently in
+// parallel. Equal items always end up in the same partition, so the result is
+// identical to the single-threaded one.
+template <class HashFunctionT, class EqualFunctionT>
+void FindFirstOccurrences(uint32_t num_items, const HashFunctionT &hash,
+                          const EqualFunctionT &equal, ThreadPool *pool,
+                          std::vector<uint32_t> *first_occurrence) {
+  first_occurrence->resize(num_items);
+  int num_partitions = 1;
+  if (pool != nullptr) {
+    const int max_partitions = static_cast<int>(std::max<uint32_t>(
+        num_items / internal::kMinItemsPerDeduplicationPartition, 1));
+    // Use a power of two partitions, a few per thread for load balancing.
+    const int target_partitions =
+        std::min(4 * std::max(pool->num_threads(), 1), max_partitions);
+    while (2 * num_partitions <= target_partitions) {
+      num_partitions *= 2;
+    }
+  }
+
+  // Compute hashes of all items. Block size is large enough to make the
+  // scheduling overhead negligible.
+  constexpr uint32_t kHashBlockSize = 1 << 14;
+  std::vector<uint64_t> hashes(num_items);
+  const int num_hash_blocks =
+      static_cast<int>((num_items + kHashBlockSize - 1) / kHashBlockSize);
+  ParallelFor(num_partitions > 1 ? pool : nullptr, num_hash_blocks,
+              [&](int block) {
+                const uint32_t begin = block * kHashBlockSize;
+                const uint32_t end =
+                    std::min(begin + kHashBlockSize, num_items);
+                for (uint32_t i = begin; i < end; ++i) {
+                  hashes[i] = hash(i);
+                }
+              });
+
+  if (num_partitions == 1) {
+    internal::FirstOccurrenceTable<EqualFunctionT> table(num_items, hashes,
+                                                         equal);
+    for (uint32_t i = 0; i < num_items; ++i) {
+      (*first_occurrence)[i] = table.FindOrInsert(i);
+    }
+    return;
+  }
+
+  // Sort items into partitions by the high bits of their hashes. The table
+  // slots are selected by the low bits so both are independent. Items within
+  // each partition stay in increasing order.
+  int partition_bits = 0;
+  while ((1 << partition_bits) < num_partitions) {
+    ++partition_bits;
+  }
+  const int partition_shift = 64 - partition_bits;
+  std::vector<uint32_t> partition_offsets(num_partitions + 1, 0);
+  for (uint32_t i = 0; i < num_items; ++i) {
+    ++partition_offsets[(hashes[i] >> partition_shift) + 1];
+  }
+  for (int p = 0; p < num_partitions; ++p) {
+    partition_offsets[p + 1] += partition_offsets[p];
+  }
+  std::vector<uint32_t> partition_items(num_items);
+  std::vector<uint32_t> next_position(partition_offsets.begin(),
+                                      partition_offsets.end() - 1);
+  for (uint32_t i = 0; i < num_items; ++i) {
+    partition_items[next_position[hashes[i] >> partition_shift]++] = i;
+  }
+
+  ParallelFor(pool, num_partitions, [&](int p) {
+    const uint32_t begin = partition_offsets[p];
+    const uint32_t end = partition_offsets[p + 1];
+    internal::FirstOccurrenceTable<EqualFunctionT> table(end - begin, hashes,
+                                                         equal);
+    for (uint32_t i = begin; i < end; ++i) {
+      const uint32_t item = partition_items[i];
+      (*first_occurrence)[item] = table.FindOrInsert(item);
+    }
+  });
+}
+
+// Open-addressing hash table that assigns consecutive ids to distinct values
+// in the order of their first insertion. Values are compared bitwise, so
+// ValueT must be a trivially copyable type without padding, such as
+// std::array<float, 3>. The table grows automatically but it can be sized
+// for the expected number of distinct values up front.
+template <class ValueT>
+class UniqueValueTable {
+ public:
+  UniqueValueTable() : UniqueValueTable(0) {}
+  explicit UniqueValueTable(uint32_t expected_num_values) {
+    values_.reserve(expected_num_values);
+    Rehash(expected_num_values);
+  }
+
+  // Returns the id of |value|. New values get the next unused id.
+  uint32_t FindOrInsert(const ValueT &value) {
+    const uint64_t hash = HashBytes(&value, sizeof(ValueT));
+    uint32_t slot = static_cast<uint32_t>(hash) & mask_;
+    while (true) {
+      const uint32_t id = slots_[slot];
+      if (id == internal::kEmptyDeduplicationSlot) {
+        break;
+      }
+      if (memcmp(&values_[id], &value, sizeof(ValueT)) == 0) {
+        return id;
+      }
+      slot = (slot + 1) & mask_;
+    }
+    const uint32_t id = static_cast<uint32_t>(values_.size());
+    slots_[slot] = id;
+    values_.push_back(value);
+    // Keep the load factor at or below 0.5.
+    if (2 * static_cast<uint64_t>(values_.size()) > slots_.size()) {
+      Rehash(static_cast<uint32_t>(values_.size()));
+    }
+    return id;
+  }
+
+  // Returns the number of distinct values.
+  uint32_t size() const { return static_cast<uint32_t>(values_.size()); }
+
+  // Returns all distinct values ordered by their ids.
+  const std::vector<ValueT> &values() const { return values_; }
+
+ private:
+  void Rehash(uint32_t num_values) {
+    uint32_t capacity = 16;
+    while (capacity <= 2 * static_cast<uint64_t>(num_values)) {
+      capacity *= 2;
+    }
+    slots_.assign(capacity, internal::kEmptyDeduplicationSlot);
+    mask_ = capacity - 1;
+    for (uint32_t id = 0; id < values_.size(); ++id) {
+      uint32_t slot =
+          static_cast<uint32_t>(HashBytes(&values_[id], sizeof(ValueT))) &
+          mask_;
+      while (slots_[slot] != internal::kEmptyDeduplicationSlot) {
+        slot = (slot + 1) & mask_;
+      }
+      slots_[slot] = id;
+    }
+  }
+
+  std::vector<ValueT> values_;
+  std::vector<uint32_t> slots_;
+  uint32_t mask_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_DEDUPLICATION_UTILS_H_
@@ -0,0 +1,108 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/deduplication_utils.h"
+
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/hash_utils.h"
+#include "draco/core/thread_pool.h"
+
+namespace {
+
+// Generates |num_items| values with many duplicates.
+std::vector<uint32_t> GenerateValues(uint32_t num_items, uint32_t num_unique) {
+  std::vector<uint32_t> values(num_items);
+  uint32_t state = 12345;
+  for (uint32_t i = 0; i < num_items; ++i) {
+    state = state * 1664525 + 1013904223;
+    values[i] = (state >> 8) % num_unique;
+  }
+  return values;
+}
+
+// Reference implementation that finds the first occurrences of |values| using
+// a lookup table indexed by the values.
+std::vector<uint32_t> ReferenceFirstOccurrences(
+    const std::vector<uint32_t> &values, uint32_t num_unique) {
+  std::vector<uint32_t> first_index(num_unique, 0xffffffff);
+  std::vector<uint32_t> result(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i) {
+    if (first_index[values[i]] == 0xffffffff) {
+      first_index[values[i]] = i;
+    }
+    result[i] = first_index[values[i]];
+  }
+  return result;
+}
+
+void TestFindFirstOccurrences(uint32_t num_items, uint32_t num_unique,
+                              draco::ThreadPool *pool) {
+  const std::vector<uint32_t> values = GenerateValues(num_items, num_unique);
+  const auto hash = [&](uint32_t i) {
+    return draco::HashBytes(&values[i], sizeof(values[i]));
+  };
+  const auto equal = [&](uint32_t i, uint32_t j) {
+    return values[i] == values[j];
+  };
+  std::vector<uint32_t> first_occurrence;
+  draco::FindFirstOccurrences(num_items, hash, equal, pool, &first_occurrence);
+  ASSERT_EQ(first_occurrence, ReferenceFirstOccurrences(values, num_unique));
+}
+
+TEST(DeduplicationUtilsTest, TestSerial) {
+  TestFindFirstOccurrences(0, 1, nullptr);
+  TestFindFirstOccurrences(1, 1, nullptr);
+  TestFindFirstOccurrences(1000, 10, nullptr);
+  TestFindFirstOccurrences(1000, 100000, nullptr);
+}
+
+TEST(DeduplicationUtilsTest, TestPartitioned) {
+  // Tests that the partitioned mode produces the same results as the serial
+  // one. The inputs are large enough to be split into multiple partitions.
+  draco::ThreadPool pool(4);
+  TestFindFirstOccurrences(1000, 10, &pool);
+  TestFindFirstOccurrences(500000, 1000, &pool);
+  TestFindFirstOccurrences(500000, 400000, &pool);
+}
+
+TEST(DeduplicationUtilsTest, TestCollidingHashes) {
+  // Tests that items with equal hashes but different values are not merged.
+  const std::vector<uint32_t> values = GenerateValues(100000, 5000);
+  const auto hash = [&](uint32_t i) {
+    return static_cast<uint64_t>(values[i] % 7);
+  };
+  const auto equal = [&](uint32_t i, uint32_t j) {
+    return values[i] == values[j];
+  };
+  std::vector<uint32_t> first_occurrence;
+  draco::FindFirstOccurrences(static_cast<uint32_t>(values.size()), hash,
+                              equal, nullptr, &first_occurrence);
+  ASSERT_EQ(first_occurrence, ReferenceFirstOccurrences(values, 5000));
+}
+
+TEST(DeduplicationUtilsTest, TestHashBytes) {
+  // Tests that the hash depends on the contents and the size of the data.
+  const uint8_t data[20] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+                            11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+  const uint8_t zeros[20] = {0};
+  ASSERT_EQ(draco::HashBytes(data, 20), draco::HashBytes(data, 20));
+  ASSERT_NE(draco::HashBytes(data, 20), draco::HashBytes(data, 19));
+  ASSERT_NE(draco::HashBytes(data, 20), draco::HashBytes(data + 1, 19));
+  ASSERT_NE(draco::HashBytes(zeros, 3), draco::HashBytes(zeros, 4));
+  ASSERT_NE(draco::HashBytes(data, 20, 1), draco::HashBytes(data, 20, 2));
+}
+
+}  // namespace
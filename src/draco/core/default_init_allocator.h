@@ -0,0 +1,75 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_DEFAULT_INIT_ALLOCATOR_H_
+#define DRACO_CORE_DEFAULT_INIT_ALLOCATOR_H_
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace draco {
+
+// Allocator adaptor that makes std::vector::resize(n) leave the new elements
+// of trivially copyable types uninitialized instead of value-initializing
+// (zeroing) them. All other constructions, including resize(n, value), are
+// forwarded to the wrapped allocator |A|.
+//
+// The adaptor is meant for large buffers that are fully overwritten right
+// after they are resized, e.g. when decoding attribute values or faces.
+// Containers using it must fill new elements explicitly whenever the content
+// is not written immediately.
+template <typename T, typename A = std::allocator<T>>
+class DefaultInitAllocator : public A {
+  typedef std::allocator_traits<A> Traits;
+
+ public:
+  template <typename U>
+  struct rebind {
+    typedef DefaultInitAllocator<U,
+                                 typename Traits::template rebind_alloc<U>>
+        other;
+  };
+
+  using A::A;
+  DefaultInitAllocator() = default;
+  DefaultInitAllocator(const A &alloc) : A(alloc) {}
+  template <typename U, typename B>
+  DefaultInitAllocator(const DefaultInitAllocator<U, B> &other)
+      : A(static_cast<const B &>(other)) {}
+
+  DefaultInitAllocator select_on_container_copy_construction() const {
+    return DefaultInitAllocator(
+        Traits::select_on_container_copy_construction(*this));
+  }
+
+  template <typename U>
+  void construct(U *p) noexcept(
+      std::is_nothrow_default_constructible<U>::value) {
+    if constexpr (!std::is_trivially_copyable<U>::value) {
+      ::new (static_cast<void *>(p)) U();
+    }
+    // Trivially copyable values are left as they are in memory.
+  }
+  template <typename U, typename... ArgsT>
+  void construct(U *p, ArgsT &&...args) {
+    Traits::construct(static_cast<A &>(*this), p,
+                      std::forward<ArgsT>(args)...);
+  }
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_DEFAULT_INIT_ALLOCATOR_H_
@@ -147,10 +147,7 @@ class IndexType {
     value_ -= val;
     return *this;
   }
-  inline ThisIndexType &operator=(const ThisIndexType &i) {
-    value_ = i.value_;
-    return *this;
-  }
+  ThisIndexType &operator=(const ThisIndexType &i) = default;
   inline ThisIndexType &operator=(const ValueTypeT &val) {
     value_ = val;
     return *this;
@@ -15,10 +15,13 @@
 #ifndef DRACO_CORE_DRACO_INDEX_TYPE_VECTOR_H_
 #define DRACO_CORE_DRACO_INDEX_TYPE_VECTOR_H_
 
+#include <algorithm>
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "draco/core/default_init_allocator.h"
 #include "draco/core/draco_index_type.h"
 
 namespace draco {
@@ -30,14 +33,19 @@ namespace draco {
 // features.
 template <class IndexTypeT, class ValueTypeT>
 class IndexTypeVector {
+  // The storage does not initialize new entries on its own so that they can
+  // be left uninitialized with resize_uninitialized(). All other functions
+  // value-initialize the new entries explicitly.
+  typedef std::vector<ValueTypeT, DefaultInitAllocator<ValueTypeT>> Storage;
+
  public:
-  typedef typename std::vector<ValueTypeT>::const_reference const_reference;
-  typedef typename std::vector<ValueTypeT>::reference reference;
-  typedef typename std::vector<ValueTypeT>::iterator iterator;
-  typedef typename std::vector<ValueTypeT>::const_iterator const_iterator;
+  typedef typename Storage::const_reference const_reference;
+  typedef typename Storage::reference reference;
+  typedef typename Storage::iterator iterator;
+  typedef typename Storage::const_iterator const_iterator;
 
   IndexTypeVector() {}
-  explicit IndexTypeVector(size_t size) : vector_(size) {}
+  explicit IndexTypeVector(size_t size) { resize(size); }
   IndexTypeVector(size_t size, const ValueTypeT &val) : vector_(size, val) {}
 
   iterator begin() { return vector_.begin(); }
@@ -47,8 +55,19 @@ class IndexTypeVector {
 
   void clear() { vector_.clear(); }
   void reserve(size_t size) { vector_.reserve(size); }
-  void resize(size_t size) { vector_.resize(size); }
+  void resize(size_t size) {
+    const size_t old_size = vector_.size();
+    vector_.resize(size);
+    if constexpr (std::is_trivially_copyable<ValueTypeT>::value) {
+      if (size > old_size) {
+        std::fill(vector_.begin() + old_size, vector_.end(), ValueTypeT());
+      }
+    }
+  }
   void resize(size_t size, const ValueTypeT &val) { vector_.resize(size, val); }
+  // Resizes the vector without initializing new entries of trivially copyable
+  // types. All new entries must be written before they are read.
+  void resize_uninitialized(size_t size) { vector_.resize(size); }
   void assign(size_t size, const ValueTypeT &val) { vector_.assign(size, val); }
   iterator erase(iterator position) { return vector_.erase(position); }
 
@@ -57,6 +76,8 @@ class IndexTypeVector {
   }
 
   size_t size() const { return vector_.size(); }
+  size_t capacity() const { return vector_.capacity(); }
+  void shrink_to_fit() { vector_.shrink_to_fit(); }
   bool empty() const { return vector_.empty(); }
 
   void push_back(const ValueTypeT &val) { vector_.push_back(val); }
@@ -64,7 +85,12 @@ class IndexTypeVector {
 
   template <typename... Args>
   void emplace_back(Args &&...args) {
-    vector_.emplace_back(std::forward<Args>(args)...);
+    if constexpr (sizeof...(Args) == 0 &&
+                  std::is_trivially_copyable<ValueTypeT>::value) {
+      vector_.emplace_back(ValueTypeT());
+    } else {
+      vector_.emplace_back(std::forward<Args>(args)...);
+    }
   }
 
   inline reference operator[](const IndexTypeT &index) {
@@ -82,7 +108,7 @@ class IndexTypeVector {
   const ValueTypeT *data() const { return vector_.data(); }
 
  private:
-  std::vector<ValueTypeT> vector_;
+  Storage vector_;
 };
 
 }  // namespace draco
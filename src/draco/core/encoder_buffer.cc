@@ -16,19 +16,53 @@
 
 #include <cstring>  // for memcpy
 
-#include "draco/core/varint_encoding.h"
-
 namespace draco {
 
 EncoderBuffer::EncoderBuffer()
-    : bit_encoder_reserved_bytes_(false), encode_bit_sequence_size_(false) {}
+    : external_data_(nullptr),
+      external_capacity_(0),
+      external_size_(0),
+      storage_exhausted_(false),
+      bit_encoder_reserved_bytes_(false),
+      encode_bit_sequence_size_(false) {}
 
 void EncoderBuffer::Clear() {
   buffer_.clear();
+  external_size_ = 0;
+  storage_exhausted_ = false;
   bit_encoder_reserved_bytes_ = 0;
 }
 
-void EncoderBuffer::Resize(int64_t nbytes) { buffer_.resize(nbytes); }
+bool EncoderBuffer::Resize(int64_t nbytes) { return ResizeStorage(nbytes); }
+
+void EncoderBuffer::Reserve(int64_t nbytes) {
+  if (external_data_ == nullptr) {
+    buffer_.reserve(nbytes);
+  }
+}
+
+void EncoderBuffer::SetExternalStorage(char *data, size_t capacity) {
+  external_data_ = data;
+  external_capacity_ = data ? capacity : 0;
+  Clear();
+}
+
+bool EncoderBuffer::ResizeStorage(size_t nbytes) {
+  if (external_data_ == nullptr) {
+    buffer_.resize(nbytes);
+    return true;
+  }
+  if (nbytes > external_capacity_) {
+    storage_exhausted_ = true;
+    return false;
+  }
+  if (nbytes > external_size_) {
+    // Match the zero initialization of the internal storage.
+    memset(external_data_ + external_size_, 0, nbytes - external_size_);
+  }
+  external_size_ = nbytes;
+  return true;
+}
 
 bool EncoderBuffer::StartBitEncoding(int64_t required_bits, bool encode_size) {
   if (bit_encoder_active()) {
@@ -37,21 +71,21 @@ bool EncoderBuffer::StartBitEncoding(int64_t required_bits, bool encode_size) {
   if (required_bits <= 0) {
     return false;  // Invalid size.
   }
-  encode_bit_sequence_size_ = encode_size;
   const int64_t required_bytes = (required_bits + 7) / 8;
-  bit_encoder_reserved_bytes_ = required_bytes;
-  uint64_t buffer_start_size = buffer_.size();
+  uint64_t buffer_start_size = size();
   if (encode_size) {
     // Reserve memory for storing the encoded bit sequence size. It will be
     // filled once the bit encoding ends.
     buffer_start_size += sizeof(uint64_t);
   }
   // Resize buffer to fit the maximum size of encoded bit data.
-  buffer_.resize(buffer_start_size + required_bytes);
+  if (!ResizeStorage(buffer_start_size + required_bytes)) {
+    return false;
+  }
+  encode_bit_sequence_size_ = encode_size;
+  bit_encoder_reserved_bytes_ = required_bytes;
   // Get the buffer data pointer for the bit encoder.
-  const char *const data = buffer_.data() + buffer_start_size;
-  bit_encoder_ =
-      std::unique_ptr<BitEncoder>(new BitEncoder(const_cast<char *>(data)));
+  bit_encoder_.Reset(data() + buffer_start_size);
   return true;
 }
 
@@ -60,25 +94,35 @@ void EncoderBuffer::EndBitEncoding() {
     return;
   }
   // Get the number of encoded bits and bytes (rounded up).
-  const uint64_t encoded_bits = bit_encoder_->Bits();
+  const uint64_t encoded_bits = bit_encoder_.Bits();
   const uint64_t encoded_bytes = (encoded_bits + 7) / 8;
   // Flush all cached bits that are not in the bit encoder's main buffer.
-  bit_encoder_->Flush(0);
+  bit_encoder_.Flush(0);
   // Encode size if needed.
   if (encode_bit_sequence_size_) {
     char *out_mem = const_cast<char *>(data() + size());
     // Make the out_mem point to the memory reserved for storing the size.
     out_mem = out_mem - (bit_encoder_reserved_bytes_ + sizeof(uint64_t));
 
-    EncoderBuffer var_size_buffer;
-    EncodeVarint(encoded_bytes, &var_size_buffer);
-    const uint32_t size_len = static_cast<uint32_t>(var_size_buffer.size());
+    // Varint coding of the size (see EncodeVarint()). This avoids allocation
+    // of a temporary buffer.
+    uint8_t var_size[(sizeof(uint64_t) * 8 + 6) / 7];
+    uint32_t size_len = 0;
+    uint64_t remaining_size = encoded_bytes;
+    do {
+      var_size[size_len] = remaining_size & ((1 << 7) - 1);
+      remaining_size >>= 7;
+      if (remaining_size > 0) {
+        var_size[size_len] |= (1 << 7);
+      }
+      ++size_len;
+    } while (remaining_size > 0);
     char *const dst = out_mem + size_len;
     const char *const src = out_mem + sizeof(uint64_t);
     memmove(dst, src, encoded_bytes);
 
     // Store the size of the encoded data.
-    memcpy(out_mem, var_size_buffer.data(), size_len);
+    memcpy(out_mem, var_size, size_len);
 
     // We need to account for the difference between the preallocated and actual
     // storage needed for storing the encoded length. This will be used later to
@@ -86,7 +130,7 @@ void EncoderBuffer::EndBitEncoding() {
     bit_encoder_reserved_bytes_ += sizeof(uint64_t) - size_len;
   }
   // Resize the underlying buffer to match the number of encoded bits.
-  buffer_.resize(buffer_.size() - bit_encoder_reserved_bytes_ + encoded_bytes);
+  ResizeStorage(size() - bit_encoder_reserved_bytes_ + encoded_bytes);
   bit_encoder_reserved_bytes_ = 0;
 }
 
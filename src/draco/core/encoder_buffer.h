@@ -15,6 +15,7 @@
 #ifndef DRACO_CORE_ENCODER_BUFFER_H_
 #define DRACO_CORE_ENCODER_BUFFER_H_
 
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -26,11 +27,37 @@ namespace draco {
 // Class representing a buffer that can be used for either for byte-aligned
 // encoding of arbitrary data structures or for encoding of variable-length
 // bit data.
+//
+// By default the data is stored in an internal vector. Clear() keeps the
+// allocated memory, so a single buffer can be reused for encoding of many
+// geometries without reallocations. Alternatively, the buffer can write
+// directly into caller provided memory, see SetExternalStorage().
 class EncoderBuffer {
  public:
   EncoderBuffer();
+  // Removes all data from the buffer. The allocated capacity is retained.
   void Clear();
-  void Resize(int64_t nbytes);
+  // Resizes the buffer to |nbytes|. New bytes are zero initialized. Returns
+  // false when the capacity of the external storage would be exceeded.
+  bool Resize(int64_t nbytes);
+  // Preallocates internal storage for at least |nbytes| bytes.
+  void Reserve(int64_t nbytes);
+
+  // Makes the buffer write all data directly into |data| that can hold up to
+  // |capacity| bytes, e.g. a pre-allocated shared memory region, instead of
+  // into the internal storage. The memory must be contiguous, it is not owned
+  // by the buffer and it must outlive any use of the buffer. The buffer is
+  // cleared. Passing nullptr switches the buffer back to internal storage.
+  //
+  // Writes that would exceed |capacity| fail and mark the buffer as
+  // exhausted, see storage_exhausted(). Note that bit encoding reserves its
+  // maximum size upfront, so the capacity needs to account for it.
+  void SetExternalStorage(char *data, size_t capacity);
+  bool has_external_storage() const { return external_data_ != nullptr; }
+
+  // Returns true when some data could not be written because the capacity of
+  // the external storage was exceeded. The flag is reset by Clear().
+  bool storage_exhausted() const { return storage_exhausted_; }
 
   // Start encoding a bit sequence. A maximum size of the sequence needs to
   // be known upfront.
@@ -50,7 +77,7 @@ class EncoderBuffer {
     if (!bit_encoder_active()) {
       return false;
     }
-    bit_encoder_->PutBits(value, nbits);
+    bit_encoder_.PutBits(value, nbits);
     return true;
   }
   // Encode an arbitrary data type.
@@ -61,31 +88,62 @@ class EncoderBuffer {
     if (bit_encoder_active()) {
       return false;
     }
-    const uint8_t *src_data = reinterpret_cast<const uint8_t *>(&data);
-    buffer_.insert(buffer_.end(), src_data, src_data + sizeof(T));
-    return true;
+    return Append(&data, sizeof(T));
   }
   bool Encode(const void *data, size_t data_size) {
     if (bit_encoder_active()) {
       return false;
     }
-    const uint8_t *src_data = reinterpret_cast<const uint8_t *>(data);
-    buffer_.insert(buffer_.end(), src_data, src_data + data_size);
-    return true;
+    return Append(data, data_size);
   }
 
   bool bit_encoder_active() const { return bit_encoder_reserved_bytes_ > 0; }
-  const char *data() const { return buffer_.data(); }
-  size_t size() const { return buffer_.size(); }
+  const char *data() const {
+    return external_data_ ? external_data_ : buffer_.data();
+  }
+  char *data() { return external_data_ ? external_data_ : buffer_.data(); }
+  size_t size() const {
+    return external_data_ ? external_size_ : buffer_.size();
+  }
+  size_t capacity() const {
+    return external_data_ ? external_capacity_ : buffer_.capacity();
+  }
+  // Returns the internal storage. Must not be used with external storage.
   std::vector<char> *buffer() { return &buffer_; }
 
  private:
+  bool Append(const void *data, size_t data_size) {
+    if (external_data_) {
+      if (data_size > external_capacity_ - external_size_) {
+        storage_exhausted_ = true;
+        return false;
+      }
+      memcpy(external_data_ + external_size_, data, data_size);
+      external_size_ += data_size;
+      return true;
+    }
+    const char *const src_data = static_cast<const char *>(data);
+    buffer_.insert(buffer_.end(), src_data, src_data + data_size);
+    return true;
+  }
+
+  // Resizes the storage to |nbytes|. Returns false when the external storage
+  // is too small.
+  bool ResizeStorage(size_t nbytes);
+
   // Internal helper class to encode bits to a bit buffer.
   class BitEncoder {
    public:
+    BitEncoder() : bit_buffer_(nullptr), bit_offset_(0) {}
     // |data| is the buffer to write the bits into.
     explicit BitEncoder(char *data) : bit_buffer_(data), bit_offset_(0) {}
 
+    // Starts encoding into |data|.
+    void Reset(char *data) {
+      bit_buffer_ = data;
+      bit_offset_ = 0;
+    }
+
     // Write |nbits| of |data| into the bit buffer.
     void PutBits(uint32_t data, int32_t nbits) {
       DRACO_DCHECK_GE(nbits, 0);
@@ -128,15 +186,18 @@ class EncoderBuffer {
     size_t bit_offset_;
   };
   friend class BufferBitCodingTest;
-  // All data is stored in this vector.
+  // All data is stored in this vector unless external storage is set.
   std::vector<char> buffer_;
 
-  // Bit encoder is used when encoding variable-length bit data.
-  // TODO(ostava): Currently encoder needs to be recreated each time
-  // StartBitEncoding method is called. This is not necessary if BitEncoder
-  // supported reset function which can easily added but let's leave that for
-  // later.
-  std::unique_ptr<BitEncoder> bit_encoder_;
+  // Optional caller provided storage (not owned).
+  char *external_data_;
+  size_t external_capacity_;
+  size_t external_size_;
+  bool storage_exhausted_;
+
+  // Bit encoder is used when encoding variable-length bit data. It is reset
+  // each time StartBitEncoding method is called.
+  BitEncoder bit_encoder_;
 
   // The number of bytes reserved for bit encoder.
   // Values > 0 indicate we are in the bit encoding mode.
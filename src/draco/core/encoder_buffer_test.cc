@@ -0,0 +1,105 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/encoder_buffer.h"
+
+#include <memory>
+#include <vector>
+
+#include "draco/compression/encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace {
+
+class EncoderBufferTest : public ::testing::Test {
+ protected:
+  EncoderBufferTest() {}
+};
+
+TEST_F(EncoderBufferTest, TestClearRetainsCapacity) {
+  // Tests that a cleared buffer keeps its allocated memory.
+  draco::EncoderBuffer buffer;
+  buffer.Reserve(1000);
+  const size_t capacity = buffer.capacity();
+  ASSERT_GE(capacity, 1000);
+  for (int i = 0; i < 250; ++i) {
+    ASSERT_TRUE(buffer.Encode(i));
+  }
+  const char *const data = buffer.data();
+  buffer.Clear();
+  ASSERT_EQ(buffer.size(), 0);
+  ASSERT_EQ(buffer.capacity(), capacity);
+  ASSERT_TRUE(buffer.Encode(1));
+  ASSERT_EQ(buffer.data(), data);
+}
+
+TEST_F(EncoderBufferTest, TestExternalStorage) {
+  // Tests that byte and bit data are written directly into external memory.
+  std::vector<char> memory(64, 0x55);
+  draco::EncoderBuffer buffer;
+  buffer.SetExternalStorage(memory.data(), memory.size());
+  ASSERT_TRUE(buffer.has_external_storage());
+  ASSERT_EQ(buffer.data(), memory.data());
+  ASSERT_TRUE(buffer.Encode(static_cast<uint32_t>(0x12345678)));
+  ASSERT_TRUE(buffer.StartBitEncoding(16, true));
+  ASSERT_TRUE(buffer.EncodeLeastSignificantBits32(16, 0xabcd));
+  buffer.EndBitEncoding();
+  // 4 bytes of the integer, 1 byte of the bit sequence size and 2 bytes of
+  // the bit data.
+  ASSERT_EQ(buffer.size(), 7);
+
+  draco::EncoderBuffer internal_buffer;
+  ASSERT_TRUE(internal_buffer.Encode(static_cast<uint32_t>(0x12345678)));
+  ASSERT_TRUE(internal_buffer.StartBitEncoding(16, true));
+  ASSERT_TRUE(internal_buffer.EncodeLeastSignificantBits32(16, 0xabcd));
+  internal_buffer.EndBitEncoding();
+  ASSERT_EQ(std::vector<char>(memory.begin(), memory.begin() + 7),
+            *internal_buffer.buffer());
+
+  // Writes beyond the capacity fail.
+  ASSERT_FALSE(buffer.Encode(memory.data(), memory.size()));
+  ASSERT_TRUE(buffer.storage_exhausted());
+  ASSERT_EQ(buffer.size(), 7);
+  buffer.Clear();
+  ASSERT_FALSE(buffer.storage_exhausted());
+
+  buffer.SetExternalStorage(nullptr, 0);
+  ASSERT_FALSE(buffer.has_external_storage());
+  ASSERT_EQ(buffer.size(), 0);
+}
+
+TEST_F(EncoderBufferTest, TestEncodeMeshToExternalStorage) {
+  // Tests that a mesh encoded into external memory matches the regular
+  // output, and that insufficient memory is reported as an error.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  draco::EncoderBuffer expected;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &expected));
+
+  std::vector<char> memory(expected.size() + 1024);
+  draco::EncoderBuffer buffer;
+  buffer.SetExternalStorage(memory.data(), memory.size());
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &buffer));
+  ASSERT_EQ(buffer.size(), expected.size());
+  ASSERT_EQ(std::vector<char>(memory.begin(), memory.begin() + buffer.size()),
+            *expected.buffer());
+
+  buffer.SetExternalStorage(memory.data(), expected.size() / 2);
+  ASSERT_FALSE(encoder.EncodeMeshToBuffer(*mesh, &buffer).ok());
+}
+
+}  // namespace
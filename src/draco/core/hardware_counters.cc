@@ -0,0 +1,139 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/hardware_counters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace draco {
+
+#ifdef __linux__
+namespace {
+
+// Opens |config| of the generic hardware events for the calling thread as a
+// member of the group |group_fd|, or as a new group leader when |group_fd| is
+// -1. Returns the file descriptor or -1 on failure.
+int OpenHardwareEvent(uint64_t config, int group_fd) {
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = group_fd == -1 ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+  return static_cast<int>(
+      syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+}  // namespace
+#endif
+
+HardwareCounters::HardwareCounters() : group_fd_(-1) {
+  for (int i = 0; i < NUM_EVENTS; ++i) {
+    fds_[i] = -1;
+    values_[i] = -1;
+  }
+}
+
+HardwareCounters::~HardwareCounters() { Close(); }
+
+bool HardwareCounters::Start() {
+#ifdef __linux__
+  if (group_fd_ == -1) {
+    static const uint64_t kConfigs[NUM_EVENTS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+      fds_[i] = OpenHardwareEvent(kConfigs[i], group_fd_);
+      if (fds_[i] != -1 && group_fd_ == -1) {
+        group_fd_ = fds_[i];
+      }
+    }
+    if (group_fd_ == -1) {
+      return false;
+    }
+  }
+  ioctl(group_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(group_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void HardwareCounters::Stop() {
+#ifdef __linux__
+  if (group_fd_ == -1) {
+    return;
+  }
+  ioctl(group_fd_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  // With PERF_FORMAT_GROUP, the number of events is followed by the values of
+  // all opened events in the order in which they were added to the group.
+  uint64_t data[1 + NUM_EVENTS];
+  const ssize_t size = read(group_fd_, data, sizeof(data));
+  if (size < static_cast<ssize_t>(sizeof(uint64_t))) {
+    return;
+  }
+  uint64_t index = 0;
+  for (int i = 0; i < NUM_EVENTS; ++i) {
+    if (fds_[i] == -1) {
+      continue;
+    }
+    ++index;
+    if (index <= data[0] &&
+        size >= static_cast<ssize_t>((index + 1) * sizeof(uint64_t))) {
+      values_[i] = static_cast<int64_t>(data[index]);
+    }
+  }
+#endif
+}
+
+const char *HardwareCounters::EventName(Event event) {
+  switch (event) {
+    case CYCLES:
+      return "cycles";
+    case INSTRUCTIONS:
+      return "instructions";
+    case CACHE_MISSES:
+      return "cache_misses";
+    case BRANCH_MISSES:
+      return "branch_misses";
+    default:
+      return "";
+  }
+}
+
+void HardwareCounters::Close() {
+#ifdef __linux__
+  // Group members are closed before the leader.
+  for (int i = NUM_EVENTS - 1; i >= 0; --i) {
+    if (fds_[i] != -1) {
+      close(fds_[i]);
+      fds_[i] = -1;
+    }
+  }
+  group_fd_ = -1;
+#endif
+}
+
+}  // namespace draco
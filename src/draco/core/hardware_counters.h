@@ -0,0 +1,73 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_HARDWARE_COUNTERS_H_
+#define DRACO_CORE_HARDWARE_COUNTERS_H_
+
+#include <cstdint>
+
+#include "draco/core/macros.h"
+
+namespace draco {
+
+// Hardware performance counters of the calling thread. The counters are read
+// through perf_event_open() and are available only on Linux when the kernel
+// permits user space counting (see /proc/sys/kernel/perf_event_paranoid). On
+// other platforms, or when the counters cannot be opened, Start() returns
+// false and all values are reported as -1.
+//
+// Only events of the thread that called Start() are counted, e.g. work done by
+// a thread pool within the measured scope is not included.
+class HardwareCounters {
+ public:
+  enum Event {
+    CYCLES = 0,
+    INSTRUCTIONS,
+    CACHE_MISSES,
+    BRANCH_MISSES,
+    NUM_EVENTS
+  };
+
+  HardwareCounters();
+  ~HardwareCounters();
+
+  // Opens the counters if needed and starts counting from zero. Returns false
+  // when no counter is available.
+  bool Start();
+
+  // Stops counting and reads the counter values.
+  void Stop();
+
+  // Returns the value of |event| read by the last Stop() or -1 when the event
+  // is not available.
+  int64_t value(Event event) const { return values_[event]; }
+
+  // Returns the name of |event|, e.g. "cycles".
+  static const char *EventName(Event event);
+
+ private:
+  void Close();
+
+  // File descriptors of the opened events or -1. The first opened event is the
+  // leader of the event group.
+  int fds_[NUM_EVENTS];
+  int group_fd_;
+  int64_t values_[NUM_EVENTS];
+
+  DISALLOW_COPY_AND_ASSIGN(HardwareCounters);
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_HARDWARE_COUNTERS_H_
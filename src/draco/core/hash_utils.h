@@ -18,6 +18,7 @@
 #include <stdint.h>
 
 #include <cstddef>
+#include <cstring>
 #include <functional>
 
 namespace draco {
@@ -59,6 +60,79 @@ struct HashArray {
   }
 };
 
+// Multiplies |a| and |b| into a 128-bit product and folds both halves into a
+// 64-bit value. This is the mixing primitive of the wyhash family of hashes.
+inline uint64_t HashMum(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  const __uint128_t r = static_cast<__uint128_t>(a) * b;
+  return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+#else
+  const uint64_t a_lo = a & 0xffffffff;
+  const uint64_t a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xffffffff;
+  const uint64_t b_hi = b >> 32;
+  const uint64_t lo_lo = a_lo * b_lo;
+  const uint64_t hi_lo = a_hi * b_lo;
+  const uint64_t lo_hi = a_lo * b_hi;
+  const uint64_t hi_hi = a_hi * b_hi;
+  const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+  const uint64_t hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+  const uint64_t lo = (cross << 32) | (lo_lo & 0xffffffff);
+  return lo ^ hi;
+#endif
+}
+
+// Combines |value| into |hash|. Unlike HashCombine(), all bits of the result
+// depend on all bits of both inputs.
+inline uint64_t HashMix(uint64_t hash, uint64_t value) {
+  return HashMum(hash ^ 0xa0761d6478bd642full, value ^ 0xe7037ed1a0b428dbull);
+}
+
+// Returns a wyhash-style hash of |size| bytes starting at |data|. The hash is
+// fast for the short keys that are typical for attribute values.
+inline uint64_t HashBytes(const void *data, size_t size, uint64_t seed = 0) {
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  uint64_t hash = seed ^ 0x8ebc6af09c88c6e3ull;
+  size_t pos = 0;
+  uint64_t words[2];
+  for (; pos + sizeof(words) <= size; pos += sizeof(words)) {
+    memcpy(words, bytes + pos, sizeof(words));
+    hash = HashMum(words[0] ^ 0xe7037ed1a0b428dbull, words[1] ^ hash);
+  }
+  if (pos < size) {
+    words[0] = words[1] = 0;
+    memcpy(words, bytes + pos, size - pos);
+    hash = HashMum(words[0] ^ 0xe7037ed1a0b428dbull, words[1] ^ hash);
+  }
+  return HashMum(hash ^ 0x589965cc75374cc3ull,
+                 static_cast<uint64_t>(size) ^ 0xe7037ed1a0b428dbull);
+}
+
+// Returns a hash of |size| bytes starting at |data| for large inputs such as
+// encoded images. The data is processed in 64 byte blocks by four independent
+// lanes, so that the multiplications of the lanes overlap on the CPU and do not
+// form a single dependency chain as in HashBytes().
+inline uint64_t HashLargeBytes(const void *data, size_t size,
+                               uint64_t seed = 0) {
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  uint64_t lanes[4] = {
+      seed ^ 0x8ebc6af09c88c6e3ull, seed ^ 0x589965cc75374cc3ull,
+      seed ^ 0x1d8e4e27c47d124full, seed ^ 0xa0761d6478bd642full};
+  size_t pos = 0;
+  uint64_t words[8];
+  for (; pos + sizeof(words) <= size; pos += sizeof(words)) {
+    memcpy(words, bytes + pos, sizeof(words));
+    for (int i = 0; i < 4; ++i) {
+      lanes[i] = HashMum(words[2 * i] ^ 0xe7037ed1a0b428dbull,
+                         words[2 * i + 1] ^ lanes[i]);
+    }
+  }
+  uint64_t hash = HashMix(HashMix(lanes[0], lanes[1]),
+                          HashMix(lanes[2], lanes[3]));
+  // The remaining bytes are hashed like short keys.
+  return HashBytes(bytes + pos, size - pos, hash ^ static_cast<uint64_t>(size));
+}
+
 }  // namespace draco
 
 #endif  // DRACO_CORE_HASH_UTILS_H_
@@ -51,6 +51,16 @@ namespace draco {
 #endif
 #endif  // FALLTHROUGH_INTENDED
 
+// Hints the processor to load the cache line at |addr| for reading. Expands
+// to nothing useful on compilers without prefetch support.
+#ifndef DRACO_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define DRACO_PREFETCH(addr) __builtin_prefetch((addr), 0, 3)
+#else
+#define DRACO_PREFETCH(addr) static_cast<void>(addr)
+#endif
+#endif
+
 #ifndef LOG
 #define LOG(...) std::cout
 #endif
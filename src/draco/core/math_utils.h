@@ -17,6 +17,8 @@
 
 #include <inttypes.h>
 
+#include <cmath>
+
 #include "draco/core/vector_d.h"
 
 namespace draco {
@@ -32,6 +34,21 @@ inline uint64_t IntSqrt(uint64_t number) {
   if (number == 0) {
     return 0;
   }
+  if (number < (1ull << 62)) {
+    // Start from the floating point square root and correct it to the exact
+    // result, which avoids the divisions of the iterative method below. The
+    // estimate is off by at most one, so the result does not depend on the
+    // precision of std::sqrt().
+    uint64_t square_root =
+        static_cast<uint64_t>(std::sqrt(static_cast<double>(number)));
+    while (square_root * square_root > number) {
+      --square_root;
+    }
+    while ((square_root + 1) * (square_root + 1) <= number) {
+      ++square_root;
+    }
+    return square_root;
+  }
   // First estimate good initial value of the square root as log2(number).
   uint64_t act_number = number;
   uint64_t square_root = 1;
@@ -19,6 +19,15 @@ TEST(MathUtils, IntSqrt) {
     const uint64_t number = distribution(generator);
     ASSERT_EQ(IntSqrt(number), static_cast<uint64_t>(floor(std::sqrt(number))));
   }
+  // Perfect squares and their neighbors.
+  for (uint64_t root = 1; root < (1ull << 31); root = root * 3 + 1) {
+    const uint64_t square = root * root;
+    ASSERT_EQ(IntSqrt(square - 1), root - 1);
+    ASSERT_EQ(IntSqrt(square), root);
+    ASSERT_EQ(IntSqrt(square + 1), root);
+  }
+  ASSERT_EQ(IntSqrt((1ull << 62) - 1), (1ull << 31) - 1);
+  ASSERT_EQ(IntSqrt(1ull << 62), 1ull << 31);
 }
 
 }  // namespace draco
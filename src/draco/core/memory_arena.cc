@@ -0,0 +1,167 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/memory_arena.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define DRACO_ARENA_MMAP_SUPPORTED
+#endif
+
+namespace draco {
+
+namespace {
+
+#ifdef DRACO_ARENA_MMAP_SUPPORTED
+// Memory policy that allocates pages on the node of the CPU that triggers the
+// allocation (MPOL_LOCAL from <linux/mempolicy.h>).
+constexpr int kMemoryPolicyLocal = 4;
+#endif
+
+// All allocations are aligned to the maximum fundamental alignment. Block
+// memory returned by new[] is aligned to this value as well.
+constexpr size_t kAlignment = alignof(std::max_align_t);
+
+size_t AlignSize(size_t size) {
+  return (size + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+}  // namespace
+
+constexpr size_t MemoryArena::kDefaultBlockSize;
+constexpr size_t MemoryArena::kHugePageSize;
+
+MemoryArena::MemoryArena(size_t block_size)
+    : block_size_(std::max<size_t>(block_size, kAlignment)),
+      use_huge_pages_(false),
+      bind_to_local_node_(false),
+      block_pos_(0),
+      bytes_allocated_(0) {}
+
+MemoryArena::MemoryArena(const Options &options)
+    : block_size_(std::max<size_t>(options.block_size, kAlignment)),
+      use_huge_pages_(options.use_huge_pages),
+      bind_to_local_node_(options.bind_to_local_node),
+      block_pos_(0),
+      bytes_allocated_(0) {}
+
+void MemoryArena::BlockDeleter::operator()(uint8_t *data) const {
+#ifdef DRACO_ARENA_MMAP_SUPPORTED
+  if (mapped_size > 0) {
+    munmap(data, mapped_size);
+    return;
+  }
+#endif
+  delete[] data;
+}
+
+MemoryArena::Block MemoryArena::AllocateBlock(size_t size) const {
+  Block block;
+  block.size = size;
+#ifdef DRACO_ARENA_MMAP_SUPPORTED
+  if ((use_huge_pages_ || bind_to_local_node_) && size >= kHugePageSize) {
+    // Map the block at a huge page boundary so that all of its full huge
+    // pages can be backed by transparent huge pages. The pages are not
+    // touched here so they are placed when the block is first written.
+    const size_t mapped_size =
+        (size + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+    void *const mapping =
+        mmap(nullptr, mapped_size + kHugePageSize, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping != MAP_FAILED) {
+      uint8_t *const begin = static_cast<uint8_t *>(mapping);
+      const uintptr_t address = reinterpret_cast<uintptr_t>(begin);
+      uint8_t *const data =
+          begin + ((kHugePageSize - address % kHugePageSize) % kHugePageSize);
+      // Release the unaligned parts of the mapping.
+      if (data > begin) {
+        munmap(begin, data - begin);
+      }
+      uint8_t *const end = begin + mapped_size + kHugePageSize;
+      if (end > data + mapped_size) {
+        munmap(data + mapped_size, end - (data + mapped_size));
+      }
+      // The hints are best effort and failures are ignored.
+#ifdef MADV_HUGEPAGE
+      if (use_huge_pages_) {
+        madvise(data, mapped_size, MADV_HUGEPAGE);
+      }
+#endif
+#ifdef SYS_mbind
+      if (bind_to_local_node_) {
+        syscall(SYS_mbind, data, mapped_size, kMemoryPolicyLocal, nullptr, 0,
+                0);
+      }
+#endif
+      block.data = std::unique_ptr<uint8_t[], BlockDeleter>(
+          data, BlockDeleter{mapped_size});
+      return block;
+    }
+  }
+#endif
+  block.data = std::unique_ptr<uint8_t[], BlockDeleter>(new uint8_t[size],
+                                                        BlockDeleter{0});
+  return block;
+}
+
+void *MemoryArena::Allocate(size_t size) {
+  size = AlignSize(std::max<size_t>(size, 1));
+  std::lock_guard<std::mutex> lock(mutex_);
+  bytes_allocated_ += size;
+  if (!blocks_.empty() && blocks_.back().size - block_pos_ >= size) {
+    void *const ptr = blocks_.back().data.get() + block_pos_;
+    block_pos_ += size;
+    return ptr;
+  }
+  if (size > block_size_ / 2) {
+    // Large allocations get their own block so that the remaining space of
+    // the current block is not wasted. The block is inserted before the
+    // current one to keep bumping from the current block.
+    Block block = AllocateBlock(size);
+    void *const ptr = block.data.get();
+    if (blocks_.empty()) {
+      blocks_.push_back(std::move(block));
+      block_pos_ = size;
+    } else {
+      blocks_.insert(blocks_.end() - 1, std::move(block));
+    }
+    return ptr;
+  }
+  blocks_.push_back(AllocateBlock(block_size_));
+  block_pos_ = size;
+  return blocks_.back().data.get();
+}
+
+void MemoryArena::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  blocks_.clear();
+  block_pos_ = 0;
+  bytes_allocated_ = 0;
+}
+
+size_t MemoryArena::bytes_allocated() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_allocated_;
+}
+
+size_t MemoryArena::num_blocks() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return blocks_.size();
+}
+
+}  // namespace draco
@@ -0,0 +1,167 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_MEMORY_ARENA_H_
+#define DRACO_CORE_MEMORY_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "draco/core/macros.h"
+
+namespace draco {
+
+// Simple bump-pointer memory arena. Memory is handed out from large blocks
+// and individual allocations are never released. All memory is released at
+// once when the arena is destroyed (or when Reset() is called), which makes it
+// possible to free all data of a decoded geometry in O(1) allocator calls.
+//
+// Any data allocated from the arena (e.g. attribute buffers of a decoded mesh)
+// must not be used after the arena is destroyed.
+//
+// The arena is thread-safe.
+class MemoryArena {
+ public:
+  // Options of the memory blocks allocated by the arena.
+  struct Options {
+    Options()
+        : block_size(kDefaultBlockSize),
+          use_huge_pages(false),
+          bind_to_local_node(false) {}
+
+    // Minimum size of the allocated blocks.
+    size_t block_size;
+
+    // Requests transparent huge pages for blocks of at least kHugePageSize
+    // bytes, which reduces TLB misses when large attribute buffers are
+    // accessed. Blocks of this size are usually allocated only for large
+    // buffers unless |block_size| is set to at least kHugePageSize.
+    bool use_huge_pages;
+
+    // Allocates the pages of blocks of at least kHugePageSize bytes on the
+    // NUMA node of the thread that first writes to them (typically the
+    // decoding thread), regardless of the memory policy of the process.
+    bool bind_to_local_node;
+  };
+
+  // Creates an arena that allocates memory in blocks of at least |block_size|
+  // bytes.
+  explicit MemoryArena(size_t block_size = kDefaultBlockSize);
+
+  // Creates an arena with the given |options|. Huge pages and NUMA binding
+  // are supported only on Linux and the options are ignored elsewhere.
+  explicit MemoryArena(const Options &options);
+
+  // Returns |size| bytes of memory aligned to |alignof(std::max_align_t)|.
+  void *Allocate(size_t size);
+
+  // Releases all memory owned by the arena. All pointers returned from the
+  // arena become invalid.
+  void Reset();
+
+  // Returns the total number of bytes handed out by the arena since it was
+  // created or last reset.
+  size_t bytes_allocated() const;
+
+  // Returns the number of memory blocks currently owned by the arena.
+  size_t num_blocks() const;
+
+  static constexpr size_t kDefaultBlockSize = 64 * 1024;
+  static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+ private:
+  struct BlockDeleter {
+    // Size of the memory mapping of the block or 0 when the block was
+    // allocated with new[].
+    size_t mapped_size;
+    void operator()(uint8_t *data) const;
+  };
+  struct Block {
+    std::unique_ptr<uint8_t[], BlockDeleter> data;
+    size_t size;
+  };
+
+  // Allocates a new block of |size| bytes.
+  Block AllocateBlock(size_t size) const;
+
+  const size_t block_size_;
+  const bool use_huge_pages_;
+  const bool bind_to_local_node_;
+  std::vector<Block> blocks_;
+  // Position of the first free byte in the last block.
+  size_t block_pos_;
+  size_t bytes_allocated_;
+  mutable std::mutex mutex_;
+
+  DISALLOW_COPY_AND_ASSIGN(MemoryArena);
+};
+
+// STL compatible allocator that takes memory from a MemoryArena. When no arena
+// is set, the allocator uses the global operator new and delete.
+template <typename T>
+class ArenaAllocator {
+ public:
+  typedef T value_type;
+
+  // Copies of a container should not inherit the arena of the source, because
+  // the lifetime of the copy is not tied to the arena.
+  typedef std::false_type propagate_on_container_copy_assignment;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+
+  ArenaAllocator() : arena_(nullptr) {}
+  explicit ArenaAllocator(MemoryArena *arena) : arena_(arena) {}
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &other) : arena_(other.arena()) {}
+
+  T *allocate(size_t n) {
+    if (arena_) {
+      return static_cast<T *>(arena_->Allocate(n * sizeof(T)));
+    }
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+  void deallocate(T *p, size_t) {
+    if (arena_ == nullptr) {
+      ::operator delete(p);
+    }
+    // Memory allocated from the arena is released with the arena.
+  }
+
+  ArenaAllocator select_on_container_copy_construction() const {
+    return ArenaAllocator();
+  }
+
+  MemoryArena *arena() const { return arena_; }
+
+ private:
+  MemoryArena *arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+  return a.arena() == b.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+  return !(a == b);
+}
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_MEMORY_ARENA_H_
@@ -0,0 +1,112 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/memory_arena.h"
+
+#include <cstring>
+#include <vector>
+
+#include "draco/core/data_buffer.h"
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+class MemoryArenaTest : public ::testing::Test {
+ protected:
+  MemoryArenaTest() {}
+};
+
+TEST_F(MemoryArenaTest, TestAllocate) {
+  // Tests that allocations are aligned, do not overlap and that large
+  // allocations get their own blocks.
+  draco::MemoryArena arena(1024);
+  std::vector<uint8_t *> ptrs;
+  for (int i = 0; i < 100; ++i) {
+    uint8_t *const ptr = static_cast<uint8_t *>(arena.Allocate(i + 1));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignof(std::max_align_t),
+              0);
+    memset(ptr, i, i + 1);
+    ptrs.push_back(ptr);
+  }
+  uint8_t *const large = static_cast<uint8_t *>(arena.Allocate(4096));
+  memset(large, 0xff, 4096);
+  for (int i = 0; i < 100; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      ASSERT_EQ(ptrs[i][j], i);
+    }
+  }
+  ASSERT_GE(arena.bytes_allocated(), 4096 + 100 * 101 / 2);
+  const size_t num_blocks = arena.num_blocks();
+  ASSERT_GT(num_blocks, 1);
+
+  // Small allocations continue in the block used before the large one.
+  arena.Allocate(1);
+  ASSERT_EQ(arena.num_blocks(), num_blocks);
+
+  arena.Reset();
+  ASSERT_EQ(arena.bytes_allocated(), 0);
+  ASSERT_EQ(arena.num_blocks(), 0);
+}
+
+TEST_F(MemoryArenaTest, TestHugePageBlocks) {
+  // Tests that blocks allocated with huge page and NUMA hints are usable and
+  // aligned like any other block.
+  draco::MemoryArena::Options options;
+  options.block_size = draco::MemoryArena::kHugePageSize;
+  options.use_huge_pages = true;
+  options.bind_to_local_node = true;
+  draco::MemoryArena arena(options);
+  const size_t large_size = 3 * draco::MemoryArena::kHugePageSize + 100;
+  uint8_t *const large = static_cast<uint8_t *>(arena.Allocate(large_size));
+  uint8_t *const small = static_cast<uint8_t *>(arena.Allocate(100));
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(large) % alignof(std::max_align_t), 0);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(small) % alignof(std::max_align_t), 0);
+  memset(large, 0xab, large_size);
+  memset(small, 0xcd, 100);
+  ASSERT_EQ(large[0], 0xab);
+  ASSERT_EQ(large[large_size - 1], 0xab);
+  ASSERT_EQ(small[99], 0xcd);
+  ASSERT_EQ(arena.num_blocks(), 2);
+
+  // Attribute data can be stored in the blocks.
+  draco::DataBuffer buffer(&arena);
+  buffer.Resize(draco::MemoryArena::kHugePageSize);
+  memset(buffer.data(), 1, buffer.data_size());
+  ASSERT_EQ(buffer.data()[buffer.data_size() - 1], 1);
+
+  arena.Reset();
+  ASSERT_EQ(arena.num_blocks(), 0);
+}
+
+TEST_F(MemoryArenaTest, TestDataBufferWithArena) {
+  // Tests that DataBuffer storage can be allocated from an arena and that
+  // copies of the buffer do not use the arena.
+  draco::MemoryArena arena;
+  draco::DataBuffer buffer(&arena);
+  ASSERT_EQ(buffer.memory_arena(), &arena);
+  const std::vector<uint8_t> values = {1, 2, 3, 4, 5, 6, 7, 8};
+  ASSERT_TRUE(buffer.Update(values.data(), values.size()));
+  ASSERT_GE(arena.bytes_allocated(), values.size());
+  ASSERT_EQ(memcmp(buffer.data(), values.data(), values.size()), 0);
+
+  buffer.Resize(1000);
+  ASSERT_EQ(memcmp(buffer.data(), values.data(), values.size()), 0);
+
+  const draco::DataBuffer copy = buffer;
+  ASSERT_EQ(copy.memory_arena(), nullptr);
+  ASSERT_EQ(copy.data_size(), 1000);
+  ASSERT_EQ(memcmp(copy.data(), values.data(), values.size()), 0);
+}
+
+}  // namespace
@@ -0,0 +1,56 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_MEMORY_FOOTPRINT_H_
+#define DRACO_CORE_MEMORY_FOOTPRINT_H_
+
+#include <cstdint>
+
+namespace draco {
+
+// Number of bytes allocated by a geometry, split by the kind of data, as
+// reported by PointCloud::MemoryUsage() and Scene::MemoryUsage(). The numbers
+// are based on the capacity of the containers, so they include memory that
+// can be released with ShrinkToFit(). Storage shared by several objects, e.g.
+// attribute buffers shared with ShareFrom(), is charged to each of them.
+struct MemoryFootprint {
+  // Attribute values.
+  int64_t attribute_values = 0;
+  // Explicit mappings between points and attribute values.
+  int64_t attribute_index_maps = 0;
+  // Faces of meshes.
+  int64_t faces = 0;
+  // Metadata entries.
+  int64_t metadata = 0;
+  // Encoded texture images.
+  int64_t textures = 0;
+
+  int64_t total() const {
+    return attribute_values + attribute_index_maps + faces + metadata +
+           textures;
+  }
+
+  MemoryFootprint &operator+=(const MemoryFootprint &other) {
+    attribute_values += other.attribute_values;
+    attribute_index_maps += other.attribute_index_maps;
+    faces += other.faces;
+    metadata += other.metadata;
+    textures += other.textures;
+    return *this;
+  }
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_MEMORY_FOOTPRINT_H_
@@ -14,62 +14,144 @@
 //
 #include "draco/core/options.h"
 
+#include <algorithm>
 #include <cstdlib>
-#include <set>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 namespace draco {
 
+OptionKey::OptionKey(const char *name) : id_(Intern(name)) {}
+
+OptionKey::OptionKey(const std::string &name) : id_(Intern(name)) {}
+
+int OptionKey::Intern(const std::string &name) {
+  // The table is intentionally leaked so that keys can be used during static
+  // destruction.
+  static std::mutex *const mutex = new std::mutex();
+  static std::unordered_map<std::string, int> *const ids =
+      new std::unordered_map<std::string, int>();
+  std::lock_guard<std::mutex> lock(*mutex);
+  const auto it = ids->find(name);
+  if (it != ids->end()) {
+    return it->second;
+  }
+  const int id = static_cast<int>(ids->size());
+  ids->insert(std::make_pair(name, id));
+  return id;
+}
+
+const Options::Entry *Options::FindEntry(const OptionKey &name) const {
+  const auto it = std::lower_bound(
+      entries_.begin(), entries_.end(), name.id(),
+      [](const Entry &entry, int id) { return entry.key < id; });
+  if (it == entries_.end() || it->key != name.id()) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+Options::Entry *Options::GetOrAddEntry(const OptionKey &name) {
+  return GetOrAddEntry(name.id());
+}
+
+Options::Entry *Options::GetOrAddEntry(int key) {
+  auto it = std::lower_bound(
+      entries_.begin(), entries_.end(), key,
+      [](const Entry &entry, int id) { return entry.key < id; });
+  if (it == entries_.end() || it->key != key) {
+    Entry entry;
+    entry.key = key;
+    entry.type = TYPE_INT;
+    entry.int_value = 0;
+    entry.float_value = 0.f;
+    it = entries_.insert(it, entry);
+  }
+  return &*it;
+}
+
+std::string Options::ToString(const Entry &entry) {
+  switch (entry.type) {
+    case TYPE_INT:
+      return std::to_string(entry.int_value);
+    case TYPE_FLOAT:
+      return std::to_string(entry.float_value);
+    default:
+      return entry.string_value;
+  }
+}
+
 void Options::MergeAndReplace(const Options &other_options) {
-  for (const auto &item : other_options.options_) {
-    options_[item.first] = item.second;
+  for (const Entry &other_entry : other_options.entries_) {
+    *GetOrAddEntry(other_entry.key) = other_entry;
   }
 }
 
-void Options::SetInt(const std::string &name, int val) {
-  options_[name] = std::to_string(val);
+void Options::SetInt(const OptionKey &name, int val) {
+  Entry *const entry = GetOrAddEntry(name);
+  entry->type = TYPE_INT;
+  entry->int_value = val;
 }
 
-void Options::SetFloat(const std::string &name, float val) {
-  options_[name] = std::to_string(val);
+void Options::SetFloat(const OptionKey &name, float val) {
+  Entry *const entry = GetOrAddEntry(name);
+  entry->type = TYPE_FLOAT;
+  entry->float_value = val;
 }
 
-void Options::SetBool(const std::string &name, bool val) {
-  options_[name] = std::to_string(val ? 1 : 0);
+void Options::SetBool(const OptionKey &name, bool val) {
+  SetInt(name, val ? 1 : 0);
 }
 
-void Options::SetString(const std::string &name, const std::string &val) {
-  options_[name] = val;
+void Options::SetString(const OptionKey &name, const std::string &val) {
+  Entry *const entry = GetOrAddEntry(name);
+  entry->type = TYPE_STRING;
+  entry->string_value = val;
 }
 
-int Options::GetInt(const std::string &name) const { return GetInt(name, -1); }
+int Options::GetInt(const OptionKey &name) const { return GetInt(name, -1); }
 
-int Options::GetInt(const std::string &name, int default_val) const {
-  const auto it = options_.find(name);
-  if (it == options_.end()) {
+int Options::GetInt(const OptionKey &name, int default_val) const {
+  const Entry *const entry = FindEntry(name);
+  if (entry == nullptr) {
     return default_val;
   }
-  return std::atoi(it->second.c_str());
+  switch (entry->type) {
+    case TYPE_INT:
+      return entry->int_value;
+    case TYPE_FLOAT:
+      return static_cast<int>(entry->float_value);
+    default:
+      return std::atoi(entry->string_value.c_str());
+  }
 }
 
-float Options::GetFloat(const std::string &name) const {
+float Options::GetFloat(const OptionKey &name) const {
   return GetFloat(name, -1);
 }
 
-float Options::GetFloat(const std::string &name, float default_val) const {
-  const auto it = options_.find(name);
-  if (it == options_.end()) {
+float Options::GetFloat(const OptionKey &name, float default_val) const {
+  const Entry *const entry = FindEntry(name);
+  if (entry == nullptr) {
     return default_val;
   }
-  return static_cast<float>(std::atof(it->second.c_str()));
+  switch (entry->type) {
+    case TYPE_INT:
+      return static_cast<float>(entry->int_value);
+    case TYPE_FLOAT:
+      return entry->float_value;
+    default:
+      return static_cast<float>(std::atof(entry->string_value.c_str()));
+  }
 }
 
-bool Options::GetBool(const std::string &name) const {
+bool Options::GetBool(const OptionKey &name) const {
   return GetBool(name, false);
 }
 
-bool Options::GetBool(const std::string &name, bool default_val) const {
+bool Options::GetBool(const OptionKey &name, bool default_val) const {
   const int ret = GetInt(name, -1);
   if (ret == -1) {
     return default_val;
@@ -77,17 +159,17 @@ bool Options::GetBool(const std::string &name, bool default_val) const {
   return static_cast<bool>(ret);
 }
 
-std::string Options::GetString(const std::string &name) const {
+std::string Options::GetString(const OptionKey &name) const {
   return GetString(name, "");
 }
 
-std::string Options::GetString(const std::string &name,
+std::string Options::GetString(const OptionKey &name,
                                const std::string &default_val) const {
-  const auto it = options_.find(name);
-  if (it == options_.end()) {
+  const Entry *const entry = FindEntry(name);
+  if (entry == nullptr) {
     return default_val;
   }
-  return it->second;
+  return ToString(*entry);
 }
 
 }  // namespace draco
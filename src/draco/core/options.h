@@ -16,17 +16,39 @@
 #define DRACO_CORE_OPTIONS_H_
 
 #include <cstdlib>
-#include <map>
 #include <string>
+#include <vector>
 
 #include "draco/draco_features.h"
 
 namespace draco {
 
-// Class for storing generic options as a <name, value> pair in a string map.
-// The API provides helper methods for directly storing values of various types
-// such as ints and bools. One named option should be set with only a single
-// data type.
+// Name of an option interned into a process wide table, so that options can
+// be stored and looked up by a small integer id instead of by comparing
+// strings. The key is implicitly constructible from a string so that all
+// Options methods can still be called with plain option names. Code that
+// queries the same option frequently can intern the name once, e.g.:
+//
+//   static const OptionKey kQuantizationBits("quantization_bits");
+//   options.GetInt(kQuantizationBits, -1);
+//
+class OptionKey {
+ public:
+  OptionKey(const char *name);         // NOLINT(runtime/explicit)
+  OptionKey(const std::string &name);  // NOLINT(runtime/explicit)
+
+  int id() const { return id_; }
+
+ private:
+  // Returns the id of |name|, adding it to the table if needed.
+  static int Intern(const std::string &name);
+
+  int id_;
+};
+
+// Class for storing generic options as <name, value> pairs. The API provides
+// helper methods for directly storing values of various types such as ints
+// and bools. One named option should be set with only a single data type.
 class Options {
  public:
   Options() = default;
@@ -36,49 +58,67 @@ class Options {
   // replacing all entries that are present in both options instances.
   void MergeAndReplace(const Options &other_options);
 
-  void SetInt(const std::string &name, int val);
-  void SetFloat(const std::string &name, float val);
-  void SetBool(const std::string &name, bool val);
-  void SetString(const std::string &name, const std::string &val);
+  void SetInt(const OptionKey &name, int val);
+  void SetFloat(const OptionKey &name, float val);
+  void SetBool(const OptionKey &name, bool val);
+  void SetString(const OptionKey &name, const std::string &val);
   template <class VectorT>
-  void SetVector(const std::string &name, const VectorT &vec) {
+  void SetVector(const OptionKey &name, const VectorT &vec) {
     SetVector(name, &vec[0], VectorT::dimension);
   }
   template <typename DataTypeT>
-  void SetVector(const std::string &name, const DataTypeT *vec, int num_dims);
+  void SetVector(const OptionKey &name, const DataTypeT *vec, int num_dims);
 
   // Getters will return a default value if the entry is not found. The default
   // value can be specified in the overloaded version of each function.
-  int GetInt(const std::string &name) const;
-  int GetInt(const std::string &name, int default_val) const;
-  float GetFloat(const std::string &name) const;
-  float GetFloat(const std::string &name, float default_val) const;
-  bool GetBool(const std::string &name) const;
-  bool GetBool(const std::string &name, bool default_val) const;
-  std::string GetString(const std::string &name) const;
-  std::string GetString(const std::string &name,
+  int GetInt(const OptionKey &name) const;
+  int GetInt(const OptionKey &name, int default_val) const;
+  float GetFloat(const OptionKey &name) const;
+  float GetFloat(const OptionKey &name, float default_val) const;
+  bool GetBool(const OptionKey &name) const;
+  bool GetBool(const OptionKey &name, bool default_val) const;
+  std::string GetString(const OptionKey &name) const;
+  std::string GetString(const OptionKey &name,
                         const std::string &default_val) const;
   template <class VectorT>
-  VectorT GetVector(const std::string &name, const VectorT &default_val) const;
+  VectorT GetVector(const OptionKey &name, const VectorT &default_val) const;
   // Unlike other Get functions, this function returns false if the option does
   // not exist, otherwise it fills |out_val| with the vector values. If a
   // default value is needed, it can be set in |out_val|.
   template <typename DataTypeT>
-  bool GetVector(const std::string &name, int num_dims,
+  bool GetVector(const OptionKey &name, int num_dims,
                  DataTypeT *out_val) const;
 
-  bool IsOptionSet(const std::string &name) const {
-    return options_.count(name) > 0;
+  bool IsOptionSet(const OptionKey &name) const {
+    return FindEntry(name) != nullptr;
   }
 
  private:
-  // All entries are internally stored as strings and converted to the desired
-  // return type based on the used Get* method.
-  std::map<std::string, std::string> options_;
+  // Values are stored in the type they were set with, so the typed getters do
+  // not need to parse strings. Values are converted only when an option is
+  // read with a different type than it was set with.
+  enum ValueType { TYPE_INT, TYPE_FLOAT, TYPE_STRING };
+  struct Entry {
+    int key;
+    ValueType type;
+    int int_value;
+    float float_value;
+    std::string string_value;
+  };
+
+  const Entry *FindEntry(const OptionKey &name) const;
+  // Returns the entry for |name|, adding an empty one if needed.
+  Entry *GetOrAddEntry(const OptionKey &name);
+  Entry *GetOrAddEntry(int key);
+  static std::string ToString(const Entry &entry);
+
+  // Entries sorted by their key id. Options instances typically hold only a
+  // few entries so a sorted vector is faster than any map.
+  std::vector<Entry> entries_;
 };
 
 template <typename DataTypeT>
-void Options::SetVector(const std::string &name, const DataTypeT *vec,
+void Options::SetVector(const OptionKey &name, const DataTypeT *vec,
                         int num_dims) {
   std::string out;
   for (int i = 0; i < num_dims; ++i) {
@@ -94,11 +134,11 @@ void Options::SetVector(const std::string &name, const DataTypeT *vec,
     out += std::to_string(vec[i]);
 #endif
   }
-  options_[name] = out;
+  SetString(name, out);
 }
 
 template <class VectorT>
-VectorT Options::GetVector(const std::string &name,
+VectorT Options::GetVector(const OptionKey &name,
                            const VectorT &default_val) const {
   VectorT ret = default_val;
   GetVector(name, VectorT::dimension, &ret[0]);
@@ -106,13 +146,13 @@ VectorT Options::GetVector(const std::string &name,
 }
 
 template <typename DataTypeT>
-bool Options::GetVector(const std::string &name, int num_dims,
+bool Options::GetVector(const OptionKey &name, int num_dims,
                         DataTypeT *out_val) const {
-  const auto it = options_.find(name);
-  if (it == options_.end()) {
+  const Entry *const entry = FindEntry(name);
+  if (entry == nullptr) {
     return false;
   }
-  const std::string value = it->second;
+  const std::string value = ToString(*entry);
   if (value.length() == 0) {
     return true;  // Option set but no data is present
   }
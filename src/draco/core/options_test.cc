@@ -0,0 +1,109 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/options.h"
+
+#include <string>
+
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+class OptionsTest : public ::testing::Test {
+ protected:
+  OptionsTest() {}
+};
+
+TEST_F(OptionsTest, TestOptionKey) {
+  // Tests that equal names are interned to equal ids.
+  const draco::OptionKey key0("options_test_key");
+  const draco::OptionKey key1(std::string("options_test_key"));
+  const draco::OptionKey key2("options_test_other_key");
+  ASSERT_EQ(key0.id(), key1.id());
+  ASSERT_NE(key0.id(), key2.id());
+
+  draco::Options options;
+  options.SetInt(key0, 7);
+  ASSERT_EQ(options.GetInt("options_test_key"), 7);
+  ASSERT_TRUE(options.IsOptionSet(key1));
+  ASSERT_FALSE(options.IsOptionSet(key2));
+}
+
+TEST_F(OptionsTest, TestTypeConversions) {
+  // Tests that values can be read with a different type than they were set
+  // with, matching the behavior of the original string based storage.
+  draco::Options options;
+  options.SetInt("int", 12);
+  options.SetFloat("float", 2.5f);
+  options.SetBool("bool", true);
+  options.SetString("string", "42");
+  ASSERT_EQ(options.GetInt("int"), 12);
+  ASSERT_EQ(options.GetFloat("int"), 12.f);
+  ASSERT_EQ(options.GetString("int"), "12");
+  ASSERT_EQ(options.GetFloat("float"), 2.5f);
+  ASSERT_EQ(options.GetInt("float"), 2);
+  ASSERT_EQ(options.GetString("float"), std::to_string(2.5f));
+  ASSERT_TRUE(options.GetBool("bool"));
+  ASSERT_EQ(options.GetInt("bool"), 1);
+  ASSERT_EQ(options.GetString("bool"), "1");
+  ASSERT_EQ(options.GetInt("string"), 42);
+  ASSERT_EQ(options.GetFloat("string"), 42.f);
+  ASSERT_EQ(options.GetString("string"), "42");
+
+  // Missing options return the default values.
+  ASSERT_EQ(options.GetInt("missing"), -1);
+  ASSERT_EQ(options.GetInt("missing", 3), 3);
+  ASSERT_FALSE(options.GetBool("missing"));
+  ASSERT_EQ(options.GetString("missing", "default"), "default");
+
+  // Setting an option with a different type replaces the value.
+  options.SetString("int", "abc");
+  ASSERT_EQ(options.GetString("int"), "abc");
+  options.SetInt("int", 5);
+  ASSERT_EQ(options.GetString("int"), "5");
+}
+
+TEST_F(OptionsTest, TestVectors) {
+  // Tests that vectors can be stored and read back.
+  draco::Options options;
+  const float values[3] = {1.5f, -2.f, 3.25f};
+  options.SetVector("vector", values, 3);
+  float out_values[3] = {0.f, 0.f, 0.f};
+  ASSERT_TRUE(options.GetVector("vector", 3, out_values));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(out_values[i], values[i]);
+  }
+  // Scalar options can be read as vectors of size one.
+  options.SetInt("scalar", 4);
+  int out_int = 0;
+  ASSERT_TRUE(options.GetVector("scalar", 1, &out_int));
+  ASSERT_EQ(out_int, 4);
+  ASSERT_FALSE(options.GetVector("missing", 1, &out_int));
+}
+
+TEST_F(OptionsTest, TestMergeAndReplace) {
+  // Tests that merged options replace existing entries and keep the others.
+  draco::Options options;
+  options.SetInt("a", 1);
+  options.SetInt("b", 2);
+  draco::Options other_options;
+  other_options.SetFloat("b", 3.5f);
+  other_options.SetString("c", "c");
+  options.MergeAndReplace(other_options);
+  ASSERT_EQ(options.GetInt("a"), 1);
+  ASSERT_EQ(options.GetFloat("b"), 3.5f);
+  ASSERT_EQ(options.GetString("c"), "c");
+}
+
+}  // namespace
@@ -14,8 +14,80 @@
 //
 #include "draco/core/quantization_utils.h"
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "draco/core/cpu_features.h"
+#include "draco/core/quantization_utils_simd.h"
+
 namespace draco {
 
+namespace {
+
+#if DRACO_ENABLE_SSE4_1 || DRACO_ENABLE_NEON || DRACO_ENABLE_WASM_SIMD
+// Maximum number of components that are processed by the SIMD kernels.
+constexpr int kMaxSimdComponents = 16;
+#endif
+
+// Number of values processed by a single task of ComputeValueRange().
+constexpr int64_t kValueRangeChunkSize = 1 << 16;
+
+// Updates |min_values| and |max_values| with |num_values| values stored in
+// |in|. Returns false when any of the values is NaN.
+bool UpdateValueRange(const float *in, int64_t num_values, int num_components,
+                      float *min_values, float *max_values) {
+  int64_t num_processed_entries = 0;
+#if DRACO_ENABLE_SSE4_1 || DRACO_ENABLE_NEON || DRACO_ENABLE_WASM_SIMD
+  if (num_components <= kMaxSimdComponents &&
+      (CpuSupportsSse4_1() || CpuSupportsNeon() || CpuSupportsWasmSimd())) {
+    // The kernels process four entries at a time, so the ranges are repeated
+    // four times to make the pattern of components align with the vectors.
+    float min_pattern[4 * kMaxSimdComponents];
+    float max_pattern[4 * kMaxSimdComponents];
+    const int num_offsets = 4 * num_components;
+    for (int i = 0; i < num_offsets; ++i) {
+      min_pattern[i] = min_values[i % num_components];
+      max_pattern[i] = max_values[i % num_components];
+    }
+    const int64_t num_entries = num_values * num_components;
+#if DRACO_ENABLE_SSE4_1
+    num_processed_entries = UpdateValueRangeSse4(
+        in, num_entries, num_offsets, min_pattern, max_pattern);
+#elif DRACO_ENABLE_NEON
+    num_processed_entries = UpdateValueRangeNeon(
+        in, num_entries, num_offsets, min_pattern, max_pattern);
+#else
+    num_processed_entries = UpdateValueRangeWasmSimd(
+        in, num_entries, num_offsets, min_pattern, max_pattern);
+#endif
+    if (num_processed_entries < 0) {
+      return false;
+    }
+    for (int i = 0; i < num_offsets; ++i) {
+      const int c = i % num_components;
+      min_values[c] = std::min(min_values[c], min_pattern[i]);
+      max_values[c] = std::max(max_values[c], max_pattern[i]);
+    }
+  }
+#endif
+  // Process the remaining values.
+  for (int64_t i = num_processed_entries / num_components; i < num_values;
+       ++i) {
+    for (int c = 0; c < num_components; ++c) {
+      const float value = in[i * num_components + c];
+      if (std::isnan(value)) {
+        return false;
+      }
+      min_values[c] = std::min(min_values[c], value);
+      max_values[c] = std::max(max_values[c], value);
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 Quantizer::Quantizer() : inverse_delta_(1.f) {}
 
 void Quantizer::Init(float range, int32_t max_quantized_value) {
@@ -24,6 +96,31 @@ void Quantizer::Init(float range, int32_t max_quantized_value) {
 
 void Quantizer::Init(float delta) { inverse_delta_ = 1.f / delta; }
 
+void Quantizer::QuantizeValues(const float *in, int64_t num_entries,
+                               int32_t offset, int32_t *out) const {
+  int64_t num_processed_entries = 0;
+#if DRACO_ENABLE_SSE4_1
+  if (CpuSupportsSse4_1()) {
+    num_processed_entries =
+        QuantizeValuesSse4(in, num_entries, inverse_delta_, offset, out);
+  }
+#elif DRACO_ENABLE_NEON
+  if (CpuSupportsNeon()) {
+    num_processed_entries =
+        QuantizeValuesNeon(in, num_entries, inverse_delta_, offset, out);
+  }
+#elif DRACO_ENABLE_WASM_SIMD
+  if (CpuSupportsWasmSimd()) {
+    num_processed_entries =
+        QuantizeValuesWasmSimd(in, num_entries, inverse_delta_, offset, out);
+  }
+#endif
+  // Process the remaining values.
+  for (int64_t i = num_processed_entries; i < num_entries; ++i) {
+    out[i] = QuantizeFloat(in[i]) + offset;
+  }
+}
+
 Dequantizer::Dequantizer() : delta_(1.f) {}
 
 bool Dequantizer::Init(float range, int32_t max_quantized_value) {
@@ -39,4 +136,85 @@ bool Dequantizer::Init(float delta) {
   return true;
 }
 
+void Dequantizer::DequantizeValues(const int32_t *in, int64_t num_values,
+                                   int num_components, const float *offsets,
+                                   float *out) const {
+  if (num_components <= 0) {
+    return;
+  }
+  int64_t num_processed_entries = 0;
+#if DRACO_ENABLE_SSE4_1 || DRACO_ENABLE_NEON || DRACO_ENABLE_WASM_SIMD
+  if (num_components <= kMaxSimdComponents &&
+      (CpuSupportsSse4_1() || CpuSupportsNeon() || CpuSupportsWasmSimd())) {
+    // The kernels process four entries at a time, so the offsets are repeated
+    // four times to make the pattern of offsets align with the vectors.
+    float offsets_pattern[4 * kMaxSimdComponents];
+    const int num_offsets = 4 * num_components;
+    for (int i = 0; i < num_offsets; ++i) {
+      offsets_pattern[i] = offsets[i % num_components];
+    }
+    const int64_t num_entries = num_values * num_components;
+#if DRACO_ENABLE_SSE4_1
+    num_processed_entries = DequantizeValuesSse4(
+        in, num_entries, delta_, offsets_pattern, num_offsets, out);
+#elif DRACO_ENABLE_NEON
+    num_processed_entries = DequantizeValuesNeon(
+        in, num_entries, delta_, offsets_pattern, num_offsets, out);
+#else
+    num_processed_entries = DequantizeValuesWasmSimd(
+        in, num_entries, delta_, offsets_pattern, num_offsets, out);
+#endif
+  }
+#endif
+  // Process the remaining values.
+  for (int64_t i = num_processed_entries / num_components; i < num_values;
+       ++i) {
+    for (int c = 0; c < num_components; ++c) {
+      const int64_t entry = i * num_components + c;
+      out[entry] = DequantizeFloat(in[entry]) + offsets[c];
+    }
+  }
+}
+
+bool ComputeValueRange(const float *in, int64_t num_values, int num_components,
+                       ThreadPool *pool, float *min_values, float *max_values) {
+  if (num_components <= 0) {
+    return true;
+  }
+  const int num_chunks = static_cast<int>(
+      (num_values + kValueRangeChunkSize - 1) / kValueRangeChunkSize);
+  // Minimum and maximum values of each chunk stored one after another.
+  std::vector<float> chunk_ranges(2 * num_chunks * num_components);
+  std::vector<uint8_t> is_chunk_valid(num_chunks);
+  ParallelFor(pool, num_chunks, [&](int k) {
+    float *const chunk_min_values = &chunk_ranges[2 * k * num_components];
+    float *const chunk_max_values = chunk_min_values + num_components;
+    std::fill(chunk_min_values, chunk_max_values,
+              std::numeric_limits<float>::infinity());
+    std::fill(chunk_max_values, chunk_max_values + num_components,
+              -std::numeric_limits<float>::infinity());
+    const int64_t begin = k * kValueRangeChunkSize;
+    const int64_t end = std::min(num_values, begin + kValueRangeChunkSize);
+    is_chunk_valid[k] =
+        UpdateValueRange(in + begin * num_components, end - begin,
+                         num_components, chunk_min_values, chunk_max_values);
+  });
+  std::fill(min_values, min_values + num_components,
+            std::numeric_limits<float>::infinity());
+  std::fill(max_values, max_values + num_components,
+            -std::numeric_limits<float>::infinity());
+  for (int k = 0; k < num_chunks; ++k) {
+    if (!is_chunk_valid[k]) {
+      return false;
+    }
+    const float *const chunk_min_values = &chunk_ranges[2 * k * num_components];
+    const float *const chunk_max_values = chunk_min_values + num_components;
+    for (int c = 0; c < num_components; ++c) {
+      min_values[c] = std::min(min_values[c], chunk_min_values[c]);
+      max_values[c] = std::max(max_values[c], chunk_max_values[c]);
+    }
+  }
+  return true;
+}
+
 }  // namespace draco
@@ -26,6 +26,7 @@
 #include <cmath>
 
 #include "draco/core/macros.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -50,6 +51,16 @@ class Quantizer {
   }
   inline int32_t operator()(float val) const { return QuantizeFloat(val); }
 
+  // Quantizes |num_entries| values from |in| and adds |offset| to the
+  // quantized values:
+  //
+  //   out[i] = QuantizeFloat(in[i]) + offset
+  //
+  // A SIMD implementation is used when it is supported by the CPU. The output
+  // is identical to the output of the scalar code.
+  void QuantizeValues(const float *in, int64_t num_entries, int32_t offset,
+                      int32_t *out) const;
+
  private:
   float inverse_delta_;
 };
@@ -73,10 +84,31 @@ class Dequantizer {
   }
   inline float operator()(int32_t val) const { return DequantizeFloat(val); }
 
+  // Dequantizes |num_values| entries with |num_components| components each
+  // from |in| and adds the per-component |offsets| to the dequantized values:
+  //
+  //   out[i * num_components + c] =
+  //       DequantizeFloat(in[i * num_components + c]) + offsets[c]
+  //
+  // A SIMD implementation is used when it is supported by the CPU. The output
+  // is identical to the output of the scalar code.
+  void DequantizeValues(const int32_t *in, int64_t num_values,
+                        int num_components, const float *offsets,
+                        float *out) const;
+
  private:
   float delta_;
 };
 
+// Computes the minimum and maximum of each of the |num_components| components
+// over |num_values| values stored in |in|. The values are processed in
+// parallel on |pool| (can be nullptr) and with a SIMD implementation when it
+// is supported by the CPU. Returns false when any of the values is NaN. When
+// |num_values| is zero, the minimum values are set to +infinity and the
+// maximum values to -infinity.
+bool ComputeValueRange(const float *in, int64_t num_values, int num_components,
+                       ThreadPool *pool, float *min_values, float *max_values);
+
 }  // namespace draco
 
 #endif  // DRACO_CORE_QUANTIZATION_UTILS_H_
@@ -0,0 +1,98 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/quantization_utils_simd.h"
+
+#if DRACO_ENABLE_NEON
+#include <arm_neon.h>
+
+namespace draco {
+
+int64_t QuantizeValuesNeon(const float *in, int64_t num_entries,
+                           float inverse_delta, int32_t offset, int32_t *out) {
+  const float32x4_t inverse_delta4 = vdupq_n_f32(inverse_delta);
+  const float32x4_t half4 = vdupq_n_f32(0.5f);
+  const int32x4_t offset4 = vdupq_n_s32(offset);
+  const int64_t num_processed_entries = num_entries & ~int64_t(3);
+  for (int64_t i = 0; i < num_processed_entries; i += 4) {
+    const float32x4_t value =
+        vaddq_f32(vmulq_f32(vld1q_f32(in + i), inverse_delta4), half4);
+    // Round towards negative infinity by decrementing the truncated values
+    // that are larger than the input (the comparison mask is -1). This does
+    // not require the ARMv8 rounding instructions.
+    const int32x4_t truncated = vcvtq_s32_f32(value);
+    const int32x4_t floored = vaddq_s32(
+        truncated, vreinterpretq_s32_u32(
+                       vcgtq_f32(vcvtq_f32_s32(truncated), value)));
+    vst1q_s32(out + i, vaddq_s32(floored, offset4));
+  }
+  return num_processed_entries;
+}
+
+int64_t DequantizeValuesNeon(const int32_t *in, int64_t num_entries,
+                             float delta, const float *offsets,
+                             int num_offsets, float *out) {
+  const float32x4_t delta4 = vdupq_n_f32(delta);
+  const int64_t num_blocks = num_entries / num_offsets;
+  for (int64_t b = 0; b < num_blocks; ++b) {
+    for (int i = 0; i < num_offsets; i += 4) {
+      const float32x4_t value =
+          vaddq_f32(vmulq_f32(vcvtq_f32_s32(vld1q_s32(in + i)), delta4),
+                    vld1q_f32(offsets + i));
+      vst1q_f32(out + i, value);
+    }
+    in += num_offsets;
+    out += num_offsets;
+  }
+  return num_blocks * num_offsets;
+}
+
+int64_t UpdateValueRangeNeon(const float *in, int64_t num_entries,
+                             int num_offsets, float *min_pattern,
+                             float *max_pattern) {
+  const int num_vectors = num_offsets / 4;
+  float32x4_t min4[16];
+  float32x4_t max4[16];
+  for (int i = 0; i < num_vectors; ++i) {
+    min4[i] = vld1q_f32(min_pattern + 4 * i);
+    max4[i] = vld1q_f32(max_pattern + 4 * i);
+  }
+  // Lanes of |not_nan4| are cleared by NaN values, which are not equal to
+  // themselves.
+  uint32x4_t not_nan4 = vdupq_n_u32(0xffffffff);
+  const int64_t num_blocks = num_entries / num_offsets;
+  for (int64_t b = 0; b < num_blocks; ++b) {
+    for (int i = 0; i < num_vectors; ++i) {
+      const float32x4_t value = vld1q_f32(in + 4 * i);
+      not_nan4 = vandq_u32(not_nan4, vceqq_f32(value, value));
+      min4[i] = vminq_f32(min4[i], value);
+      max4[i] = vmaxq_f32(max4[i], value);
+    }
+    in += num_offsets;
+  }
+  uint32_t not_nan[4];
+  vst1q_u32(not_nan, not_nan4);
+  if ((not_nan[0] & not_nan[1] & not_nan[2] & not_nan[3]) == 0) {
+    return -1;
+  }
+  for (int i = 0; i < num_vectors; ++i) {
+    vst1q_f32(min_pattern + 4 * i, min4[i]);
+    vst1q_f32(max_pattern + 4 * i, max4[i]);
+  }
+  return num_blocks * num_offsets;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_ENABLE_NEON
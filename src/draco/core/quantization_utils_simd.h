@@ -0,0 +1,67 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Declarations of the SIMD kernels used by the Quantizer and Dequantizer
+// classes and by ComputeValueRange(). The kernels
+// are implemented in separate source files that are compiled with the flags
+// of the corresponding instruction set and they must be called only when the
+// instruction set is supported (see cpu_features.h).
+#ifndef DRACO_CORE_QUANTIZATION_UTILS_SIMD_H_
+#define DRACO_CORE_QUANTIZATION_UTILS_SIMD_H_
+
+#include <stdint.h>
+
+namespace draco {
+
+// Computes out[i] = floor(in[i] * inverse_delta + 0.5f) + offset for all
+// complete blocks of four entries in |in|. Returns the number of processed
+// entries.
+int64_t QuantizeValuesSse4(const float *in, int64_t num_entries,
+                           float inverse_delta, int32_t offset, int32_t *out);
+int64_t QuantizeValuesNeon(const float *in, int64_t num_entries,
+                           float inverse_delta, int32_t offset, int32_t *out);
+int64_t QuantizeValuesWasmSimd(const float *in, int64_t num_entries,
+                               float inverse_delta, int32_t offset,
+                               int32_t *out);
+
+// Computes out[i] = in[i] * delta + offsets[i % num_offsets] for all complete
+// blocks of |num_offsets| entries in |in|. |num_offsets| must be a multiple of
+// four. Returns the number of processed entries.
+int64_t DequantizeValuesSse4(const int32_t *in, int64_t num_entries,
+                             float delta, const float *offsets,
+                             int num_offsets, float *out);
+int64_t DequantizeValuesNeon(const int32_t *in, int64_t num_entries,
+                             float delta, const float *offsets,
+                             int num_offsets, float *out);
+int64_t DequantizeValuesWasmSimd(const int32_t *in, int64_t num_entries,
+                                 float delta, const float *offsets,
+                                 int num_offsets, float *out);
+
+// Updates min_pattern[i % num_offsets] and max_pattern[i % num_offsets] with
+// in[i] for all complete blocks of |num_offsets| entries in |in|.
+// |num_offsets| must be a multiple of four and at most 64. Returns the number
+// of processed entries or -1 when any of the processed entries is NaN.
+int64_t UpdateValueRangeSse4(const float *in, int64_t num_entries,
+                             int num_offsets, float *min_pattern,
+                             float *max_pattern);
+int64_t UpdateValueRangeNeon(const float *in, int64_t num_entries,
+                             int num_offsets, float *min_pattern,
+                             float *max_pattern);
+int64_t UpdateValueRangeWasmSimd(const float *in, int64_t num_entries,
+                                 int num_offsets, float *min_pattern,
+                                 float *max_pattern);
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_QUANTIZATION_UTILS_SIMD_H_
@@ -0,0 +1,90 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/quantization_utils_simd.h"
+
+#if DRACO_ENABLE_SSE4_1
+#include <smmintrin.h>
+
+namespace draco {
+
+int64_t QuantizeValuesSse4(const float *in, int64_t num_entries,
+                           float inverse_delta, int32_t offset, int32_t *out) {
+  const __m128 inverse_delta4 = _mm_set1_ps(inverse_delta);
+  const __m128 half4 = _mm_set1_ps(0.5f);
+  const __m128i offset4 = _mm_set1_epi32(offset);
+  const int64_t num_processed_entries = num_entries & ~int64_t(3);
+  for (int64_t i = 0; i < num_processed_entries; i += 4) {
+    const __m128 value = _mm_floor_ps(
+        _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(in + i), inverse_delta4), half4));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                     _mm_add_epi32(_mm_cvttps_epi32(value), offset4));
+  }
+  return num_processed_entries;
+}
+
+int64_t DequantizeValuesSse4(const int32_t *in, int64_t num_entries,
+                             float delta, const float *offsets,
+                             int num_offsets, float *out) {
+  const __m128 delta4 = _mm_set1_ps(delta);
+  const int64_t num_blocks = num_entries / num_offsets;
+  for (int64_t b = 0; b < num_blocks; ++b) {
+    for (int i = 0; i < num_offsets; i += 4) {
+      const __m128i quantized =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+      const __m128 value =
+          _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(quantized), delta4),
+                     _mm_loadu_ps(offsets + i));
+      _mm_storeu_ps(out + i, value);
+    }
+    in += num_offsets;
+    out += num_offsets;
+  }
+  return num_blocks * num_offsets;
+}
+
+int64_t UpdateValueRangeSse4(const float *in, int64_t num_entries,
+                             int num_offsets, float *min_pattern,
+                             float *max_pattern) {
+  const int num_vectors = num_offsets / 4;
+  __m128 min4[16];
+  __m128 max4[16];
+  for (int i = 0; i < num_vectors; ++i) {
+    min4[i] = _mm_loadu_ps(min_pattern + 4 * i);
+    max4[i] = _mm_loadu_ps(max_pattern + 4 * i);
+  }
+  __m128 nan4 = _mm_setzero_ps();
+  const int64_t num_blocks = num_entries / num_offsets;
+  for (int64_t b = 0; b < num_blocks; ++b) {
+    for (int i = 0; i < num_vectors; ++i) {
+      const __m128 value = _mm_loadu_ps(in + 4 * i);
+      nan4 = _mm_or_ps(nan4, _mm_cmpunord_ps(value, value));
+      min4[i] = _mm_min_ps(min4[i], value);
+      max4[i] = _mm_max_ps(max4[i], value);
+    }
+    in += num_offsets;
+  }
+  if (_mm_movemask_ps(nan4) != 0) {
+    return -1;
+  }
+  for (int i = 0; i < num_vectors; ++i) {
+    _mm_storeu_ps(min_pattern + 4 * i, min4[i]);
+    _mm_storeu_ps(max_pattern + 4 * i, max4[i]);
+  }
+  return num_blocks * num_offsets;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_ENABLE_SSE4_1
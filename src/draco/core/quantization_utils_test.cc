@@ -14,6 +14,8 @@
 //
 #include "draco/core/quantization_utils.h"
 
+#include <vector>
+
 #include "draco/core/draco_test_base.h"
 
 namespace draco {
@@ -88,4 +90,54 @@ TEST_F(QuantizationUtilsTest, TestDeltaQuantization) {
             dequantizer_range.DequantizeFloat(0));
 }
 
+TEST_F(QuantizationUtilsTest, TestQuantizeValues) {
+  // Test verifies that quantization of arrays of values produces the same
+  // results as the quantization of individual values, including values that
+  // lie exactly between two quantized states and sizes that are not handled
+  // by the SIMD implementations.
+  Quantizer quantizer;
+  quantizer.Init(1.f);
+  for (int num_entries = 0; num_entries <= 37; ++num_entries) {
+    std::vector<float> values(num_entries);
+    for (int i = 0; i < num_entries; ++i) {
+      values[i] = (i % 2 == 0 ? 0.5f : -0.25f) * (i - 18);
+    }
+    std::vector<int32_t> quantized(num_entries);
+    quantizer.QuantizeValues(values.data(), num_entries, 7, quantized.data());
+    for (int i = 0; i < num_entries; ++i) {
+      ASSERT_EQ(quantized[i], quantizer.QuantizeFloat(values[i]) + 7);
+    }
+  }
+}
+
+TEST_F(QuantizationUtilsTest, TestDequantizeValues) {
+  // Test verifies that dequantization of arrays of values produces the same
+  // results as the dequantization of individual values for various numbers of
+  // components and values, including sizes that are not handled by the SIMD
+  // implementations.
+  Dequantizer dequantizer;
+  ASSERT_TRUE(dequantizer.Init(13.7f, 2047));
+  for (int num_components = 1; num_components <= 18; ++num_components) {
+    std::vector<float> offsets(num_components);
+    for (int c = 0; c < num_components; ++c) {
+      offsets[c] = -3.3f + 0.7f * c;
+    }
+    for (int num_values = 0; num_values <= 37; ++num_values) {
+      const int num_entries = num_values * num_components;
+      std::vector<int32_t> quantized(num_entries);
+      for (int i = 0; i < num_entries; ++i) {
+        quantized[i] = (i * 1811) % 2048 - (i % 3 == 0 ? 1024 : 0);
+      }
+      std::vector<float> values(num_entries);
+      dequantizer.DequantizeValues(quantized.data(), num_values,
+                                   num_components, offsets.data(),
+                                   values.data());
+      for (int i = 0; i < num_entries; ++i) {
+        ASSERT_EQ(values[i], dequantizer.DequantizeFloat(quantized[i]) +
+                                 offsets[i % num_components]);
+      }
+    }
+  }
+}
+
 }  // namespace draco
@@ -0,0 +1,90 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/quantization_utils_simd.h"
+
+#if DRACO_ENABLE_WASM_SIMD
+#include <wasm_simd128.h>
+
+namespace draco {
+
+int64_t QuantizeValuesWasmSimd(const float *in, int64_t num_entries,
+                               float inverse_delta, int32_t offset,
+                               int32_t *out) {
+  const v128_t inverse_delta4 = wasm_f32x4_splat(inverse_delta);
+  const v128_t half4 = wasm_f32x4_splat(0.5f);
+  const v128_t offset4 = wasm_i32x4_splat(offset);
+  const int64_t num_processed_entries = num_entries & ~int64_t(3);
+  for (int64_t i = 0; i < num_processed_entries; i += 4) {
+    const v128_t value = wasm_f32x4_floor(wasm_f32x4_add(
+        wasm_f32x4_mul(wasm_v128_load(in + i), inverse_delta4), half4));
+    wasm_v128_store(out + i,
+                    wasm_i32x4_add(wasm_i32x4_trunc_sat_f32x4(value), offset4));
+  }
+  return num_processed_entries;
+}
+
+int64_t DequantizeValuesWasmSimd(const int32_t *in, int64_t num_entries,
+                                 float delta, const float *offsets,
+                                 int num_offsets, float *out) {
+  const v128_t delta4 = wasm_f32x4_splat(delta);
+  const int64_t num_blocks = num_entries / num_offsets;
+  for (int64_t b = 0; b < num_blocks; ++b) {
+    for (int i = 0; i < num_offsets; i += 4) {
+      const v128_t value = wasm_f32x4_add(
+          wasm_f32x4_mul(wasm_f32x4_convert_i32x4(wasm_v128_load(in + i)),
+                         delta4),
+          wasm_v128_load(offsets + i));
+      wasm_v128_store(out + i, value);
+    }
+    in += num_offsets;
+    out += num_offsets;
+  }
+  return num_blocks * num_offsets;
+}
+
+int64_t UpdateValueRangeWasmSimd(const float *in, int64_t num_entries,
+                                 int num_offsets, float *min_pattern,
+                                 float *max_pattern) {
+  const int num_vectors = num_offsets / 4;
+  v128_t min4[16];
+  v128_t max4[16];
+  for (int i = 0; i < num_vectors; ++i) {
+    min4[i] = wasm_v128_load(min_pattern + 4 * i);
+    max4[i] = wasm_v128_load(max_pattern + 4 * i);
+  }
+  v128_t nan4 = wasm_i32x4_splat(0);
+  const int64_t num_blocks = num_entries / num_offsets;
+  for (int64_t b = 0; b < num_blocks; ++b) {
+    for (int i = 0; i < num_vectors; ++i) {
+      const v128_t value = wasm_v128_load(in + 4 * i);
+      nan4 = wasm_v128_or(nan4, wasm_f32x4_ne(value, value));
+      min4[i] = wasm_f32x4_pmin(min4[i], value);
+      max4[i] = wasm_f32x4_pmax(max4[i], value);
+    }
+    in += num_offsets;
+  }
+  if (wasm_v128_any_true(nan4)) {
+    return -1;
+  }
+  for (int i = 0; i < num_vectors; ++i) {
+    wasm_v128_store(min_pattern + 4 * i, min4[i]);
+    wasm_v128_store(max_pattern + 4 * i, max4[i]);
+  }
+  return num_blocks * num_offsets;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_ENABLE_WASM_SIMD
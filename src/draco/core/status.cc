@@ -38,7 +38,7 @@ std::string Status::code_string() const {
 }
 
 std::string Status::code_and_error_string() const {
-  return code_string() + ": " + error_msg_string();
+  return code_string() + ": " + error_msg_;
 }
 
 }  // namespace draco
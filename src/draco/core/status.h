@@ -15,13 +15,19 @@
 #ifndef DRACO_CORE_STATUS_H_
 #define DRACO_CORE_STATUS_H_
 
+#include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
 
 namespace draco {
 
 // Class encapsulating a return status of an operation with an optional error
 // message. Intended to be used as a return type for functions instead of bool.
+//
+// Messages are copied once into a shared immutable string, so copying a
+// Status never allocates. Status::Static() refers to a message with static
+// storage duration without copying it. An OK status holds no message at all.
 class Status {
  public:
   enum Code {
@@ -35,16 +41,31 @@ class Status {
     UNSUPPORTED_FEATURE = -6,  // Input contains feature that is not supported.
   };
 
-  Status() : code_(OK) {}
+  Status() : code_(OK), error_msg_("") {}
   Status(const Status &status) = default;
   Status(Status &&status) = default;
-  explicit Status(Code code) : code_(code) {}
+  explicit Status(Code code) : code_(code), error_msg_("") {}
   Status(Code code, const std::string &error_msg)
-      : code_(code), error_msg_(error_msg) {}
+      : code_(code),
+        dynamic_error_msg_(std::make_shared<const std::string>(error_msg)),
+        error_msg_(dynamic_error_msg_->c_str()) {}
+  Status(Code code, std::string &&error_msg)
+      : code_(code),
+        dynamic_error_msg_(
+            std::make_shared<const std::string>(std::move(error_msg))),
+        error_msg_(dynamic_error_msg_->c_str()) {}
+
+  // Returns a status that stores a pointer to |error_msg| without copying it.
+  // |error_msg| must have static storage duration, e.g. a string literal.
+  static Status Static(Code code, const char *error_msg) {
+    Status status(code);
+    status.error_msg_ = error_msg;
+    return status;
+  }
 
   Code code() const { return code_; }
-  const std::string &error_msg_string() const { return error_msg_; }
-  const char *error_msg() const { return error_msg_.c_str(); }
+  std::string error_msg_string() const { return error_msg_; }
+  const char *error_msg() const { return error_msg_; }
   std::string code_string() const;
   std::string code_and_error_string() const;
 
@@ -52,21 +73,27 @@ class Status {
   bool ok() const { return code_ == OK; }
 
   Status &operator=(const Status &) = default;
+  Status &operator=(Status &&) = default;
 
  private:
   Code code_;
-  std::string error_msg_;
+  // Owns the message when it was not given as a string literal.
+  std::shared_ptr<const std::string> dynamic_error_msg_;
+  const char *error_msg_;
 };
 
 inline std::ostream &operator<<(std::ostream &os, const Status &status) {
-  os << status.error_msg_string();
+  os << status.error_msg();
   return os;
 }
 
-inline Status OkStatus() { return Status(Status::OK); }
+inline Status OkStatus() { return Status(); }
 inline Status ErrorStatus(const std::string &msg) {
   return Status(Status::DRACO_ERROR, msg);
 }
+inline Status ErrorStatus(std::string &&msg) {
+  return Status(Status::DRACO_ERROR, std::move(msg));
+}
 
 // Evaluates an expression that returns draco::Status. If the status is not OK,
 // the macro returns the status object.
@@ -34,7 +34,10 @@ class StatusOr {
   // Status or the return value directly from functions.
   StatusOr(const StatusOr &) = default;
   StatusOr(StatusOr &&) = default;
+  StatusOr &operator=(const StatusOr &) = default;
+  StatusOr &operator=(StatusOr &&) = default;
   StatusOr(const Status &status) : status_(status) {}
+  StatusOr(Status &&status) : status_(std::move(status)) {}
   StatusOr(const T &value) : status_(OkStatus()), value_(value) {}
   StatusOr(T &&value) : status_(OkStatus()), value_(std::move(value)) {}
   StatusOr(const Status &status, const T &value)
@@ -42,4 +42,33 @@ TEST_F(StatusTest, TestStatusOutput) {
   ASSERT_EQ(status2.code_and_error_string(), "DRACO_ERROR: Error msg2.");
 }
 
+TEST_F(StatusTest, TestStatusMessages) {
+  // Tests that both literal and dynamic messages survive copies and moves.
+  std::string dynamic_msg = "Dynamic ";
+  dynamic_msg += "msg.";
+  draco::Status status(draco::Status::IO_ERROR, dynamic_msg);
+  dynamic_msg.clear();
+  const draco::Status copy = status;
+  ASSERT_STREQ(copy.error_msg(), "Dynamic msg.");
+  const draco::Status moved = std::move(status);
+  ASSERT_STREQ(moved.error_msg(), "Dynamic msg.");
+  ASSERT_EQ(moved.code(), draco::Status::IO_ERROR);
+
+  // Literal messages are copied unless Status::Static() is used.
+  static constexpr char kLiteral[] = "Literal msg.";
+  const draco::Status literal_status(draco::Status::DRACO_ERROR, kLiteral);
+  ASSERT_STREQ(literal_status.error_msg(), kLiteral);
+  ASSERT_NE(literal_status.error_msg(), kLiteral);
+  ASSERT_EQ(draco::ErrorStatus(kLiteral).error_msg_string(), kLiteral);
+  const draco::Status static_status =
+      draco::Status::Static(draco::Status::DRACO_ERROR, kLiteral);
+  const draco::Status static_copy = static_status;
+  ASSERT_EQ(static_copy.error_msg(), kLiteral);
+  ASSERT_EQ(static_copy.code(), draco::Status::DRACO_ERROR);
+
+  const draco::Status ok = draco::OkStatus();
+  ASSERT_TRUE(ok.ok());
+  ASSERT_STREQ(ok.error_msg(), "");
+}
+
 }  // namespace
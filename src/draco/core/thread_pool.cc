@@ -0,0 +1,214 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace draco {
+
+#ifdef DRACO_THREADING_SUPPORTED
+
+namespace {
+
+// State shared between all participants of a single ParallelFor() call. The
+// state is reference counted because helper tasks may start running after the
+// call has already returned (when all items were processed by other threads).
+struct ParallelForState {
+  ParallelForState(int n, const std::function<void(int)> *f)
+      : next_item(0), num_items(n), num_done(0), func(f) {}
+
+  // Processes items until there are none left.
+  void Run() {
+    int num_processed = 0;
+    while (true) {
+      const int item = next_item.fetch_add(1);
+      if (item >= num_items) {
+        break;
+      }
+      (*func)(item);
+      ++num_processed;
+    }
+    if (num_processed == 0) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    num_done += num_processed;
+    if (num_done == num_items) {
+      done_condition.notify_all();
+    }
+  }
+
+  std::atomic<int> next_item;
+  const int num_items;
+  int num_done;
+  // Valid only until all items are processed.
+  const std::function<void(int)> *const func;
+  std::mutex mutex;
+  std::condition_variable done_condition;
+};
+
+// Pool and id of the worker running on the current thread.
+thread_local const ThreadPool *current_pool = nullptr;
+thread_local int current_worker_id = -1;
+
+}  // namespace
+
+ThreadPool::ThreadPool(int num_threads)
+    : executor_(nullptr), num_queued_tasks_(0), stop_(false) {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  // Threads are not available. All work is done on the calling thread.
+  num_threads = 0;
+#endif
+  num_threads_ = std::max(num_threads, 0);
+  for (int i = 0; i < num_threads_; ++i) {
+    worker_queues_.emplace_back(new TaskQueue());
+  }
+  for (int i = 0; i < num_threads_; ++i) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+  }
+}
+
+ThreadPool::ThreadPool(TaskExecutor *executor)
+    : executor_(executor),
+      num_queued_tasks_(0),
+      stop_(false),
+      num_threads_(std::max(executor->concurrency(), 0)) {}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  condition_.notify_all();
+  for (std::thread &worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::Schedule(std::function<void()> task) {
+  if (num_threads_ == 0) {
+    task();
+    return;
+  }
+  if (executor_ != nullptr) {
+    executor_->Execute(std::move(task));
+    return;
+  }
+  TaskQueue *const queue = current_pool == this
+                               ? worker_queues_[current_worker_id].get()
+                               : &shared_queue_;
+  {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->tasks.push_back(std::move(task));
+  }
+  {
+    // The counter is incremented under |mutex_| so that a worker can't miss
+    // the notification between checking the counter and going to sleep.
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++num_queued_tasks_;
+  }
+  condition_.notify_one();
+}
+
+void ThreadPool::ParallelFor(int num_items,
+                             const std::function<void(int)> &func) {
+  if (num_items <= 0) {
+    return;
+  }
+  const std::shared_ptr<ParallelForState> state =
+      std::make_shared<ParallelForState>(num_items, &func);
+  // The calling thread processes items as well so we need at most
+  // |num_items| - 1 helpers.
+  const int num_helpers = std::min(num_threads(), num_items - 1);
+  for (int i = 0; i < num_helpers; ++i) {
+    Schedule([state]() { state->Run(); });
+  }
+  state->Run();
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->done_condition.wait(
+      lock, [&state]() { return state->num_done == state->num_items; });
+}
+
+bool ThreadPool::TakeTask(int worker_id, std::function<void()> *task) {
+  // The own queue is used as a stack, other queues as FIFOs.
+  for (int i = 0; i <= num_threads_; ++i) {
+    TaskQueue *queue;
+    if (i == 0) {
+      queue = worker_queues_[worker_id].get();
+    } else if (i == 1) {
+      queue = &shared_queue_;
+    } else {
+      queue = worker_queues_[(worker_id + i - 1) % num_threads_].get();
+    }
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (queue->tasks.empty()) {
+      continue;
+    }
+    if (i == 0) {
+      *task = std::move(queue->tasks.back());
+      queue->tasks.pop_back();
+    } else {
+      *task = std::move(queue->tasks.front());
+      queue->tasks.pop_front();
+    }
+    --num_queued_tasks_;
+    return true;
+  }
+  return false;
+}
+
+void ThreadPool::WorkerLoop(int worker_id) {
+  current_pool = this;
+  current_worker_id = worker_id;
+  while (true) {
+    std::function<void()> task;
+    if (TakeTask(worker_id, &task)) {
+      task();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock,
+                    [this]() { return stop_ || num_queued_tasks_ > 0; });
+    if (num_queued_tasks_ == 0) {
+      // |stop_| must be set.
+      return;
+    }
+  }
+}
+
+#else  // DRACO_THREADING_SUPPORTED
+
+// Without threading support all tasks are executed on the calling thread.
+
+ThreadPool::ThreadPool(int /* num_threads */) : num_threads_(0) {}
+
+ThreadPool::ThreadPool(TaskExecutor * /* executor */) : num_threads_(0) {}
+
+ThreadPool::~ThreadPool() {}
+
+void ThreadPool::Schedule(std::function<void()> task) { task(); }
+
+void ThreadPool::ParallelFor(int num_items,
+                             const std::function<void(int)> &func) {
+  for (int i = 0; i < num_items; ++i) {
+    func(i);
+  }
+}
+
+#endif  // DRACO_THREADING_SUPPORTED
+
+}  // namespace draco
@@ -0,0 +1,142 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_THREAD_POOL_H_
+#define DRACO_CORE_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "draco/core/macros.h"
+#include "draco/draco_features.h"
+
+namespace draco {
+
+// Interface of executors that run the tasks of a ThreadPool on threads owned
+// by the embedding application, e.g. a TBB task arena or a fiber scheduler.
+class TaskExecutor {
+ public:
+  virtual ~TaskExecutor() = default;
+
+  // Returns the number of tasks that the executor can run concurrently with
+  // the thread that schedules them.
+  virtual int concurrency() const = 0;
+
+  // Runs |task| asynchronously. The method must not wait for |task| to
+  // finish.
+  virtual void Execute(std::function<void()> task) = 0;
+};
+
+// Pool of worker threads that can be shared between multiple encoding and
+// decoding operations. The pool does not take ownership of any data processed
+// by the scheduled tasks.
+//
+// Each worker thread has its own queue of tasks. Tasks scheduled by a worker
+// are added to its queue and executed in LIFO order, which keeps the data of
+// nested parallel loops in cache. Idle workers steal the oldest tasks from
+// the queues of other workers. Tasks scheduled by other threads are added to
+// a shared queue.
+//
+// A pool created with zero threads executes all work synchronously on the
+// calling thread, which makes it possible to use the same code path
+// regardless of whether threading is enabled or not. The same is true for
+// all pools when Draco is built without DRACO_THREADING or for WASM without
+// pthreads.
+//
+// Example:
+//
+//   ThreadPool pool(4);
+//   pool.ParallelFor(num_items, [&](int i) { ProcessItem(i); });
+//
+class ThreadPool {
+ public:
+  // Creates a pool with |num_threads| worker threads.
+  explicit ThreadPool(int num_threads);
+
+  // Creates a pool that runs all tasks on |executor| instead of its own
+  // threads. The executor is not owned by the pool and it must outlive it.
+  explicit ThreadPool(TaskExecutor *executor);
+
+  ~ThreadPool();
+
+  // Returns the number of threads that execute tasks of the pool in addition
+  // to the calling thread.
+  int num_threads() const { return num_threads_; }
+
+  // Schedules |task| for asynchronous execution on one of the worker threads.
+  // When the pool has no worker threads, |task| is executed immediately.
+  void Schedule(std::function<void()> task);
+
+  // Calls |func| for each index in range [0, |num_items|) and blocks until all
+  // calls are finished. The calling thread participates in the work, so the
+  // method can be safely used from within tasks executed by the same pool.
+  // There are no guarantees about the order in which the indices are
+  // processed.
+  void ParallelFor(int num_items, const std::function<void(int)> &func);
+
+ private:
+#ifdef DRACO_THREADING_SUPPORTED
+  // Queue of tasks guarded by its own mutex.
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void WorkerLoop(int worker_id);
+
+  // Takes the next task for worker |worker_id| from its own queue, the shared
+  // queue or the queue of another worker. Returns false when all queues are
+  // empty.
+  bool TakeTask(int worker_id, std::function<void()> *task);
+
+  TaskExecutor *executor_;
+  std::vector<std::thread> workers_;
+  // Queues of the worker threads.
+  std::vector<std::unique_ptr<TaskQueue>> worker_queues_;
+  // Queue of tasks scheduled by threads that do not belong to the pool.
+  TaskQueue shared_queue_;
+  // Number of tasks in all queues.
+  std::atomic<int> num_queued_tasks_;
+  // Guards |stop_| and is used with |condition_| to wake idle workers.
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stop_;
+#endif
+  int num_threads_;
+
+  DISALLOW_COPY_AND_ASSIGN(ThreadPool);
+};
+
+// Helper that runs |func| for all items in range [0, |num_items|) either
+// using the |pool| or serially on the calling thread when |pool| is nullptr.
+inline void ParallelFor(ThreadPool *pool, int num_items,
+                        const std::function<void(int)> &func) {
+  if (pool == nullptr || num_items < 2) {
+    for (int i = 0; i < num_items; ++i) {
+      func(i);
+    }
+    return;
+  }
+  pool->ParallelFor(num_items, func);
+}
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_THREAD_POOL_H_
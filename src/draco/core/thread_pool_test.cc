@@ -0,0 +1,131 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/thread_pool.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+class ThreadPoolTest : public ::testing::Test {
+ protected:
+  ThreadPoolTest() {}
+};
+
+TEST_F(ThreadPoolTest, TestParallelForVisitsAllItems) {
+  // Tests that ParallelFor() processes every item exactly once for pools of
+  // various sizes, including a pool without any worker threads.
+  for (int num_threads = 0; num_threads < 5; ++num_threads) {
+    draco::ThreadPool pool(num_threads);
+#ifdef DRACO_THREADING_SUPPORTED
+    ASSERT_EQ(pool.num_threads(), num_threads);
+#else
+    ASSERT_EQ(pool.num_threads(), 0);
+#endif
+    std::vector<int> counts(1000, 0);
+    pool.ParallelFor(static_cast<int>(counts.size()),
+                     [&counts](int i) { counts[i]++; });
+    for (int i = 0; i < counts.size(); ++i) {
+      ASSERT_EQ(counts[i], 1);
+    }
+  }
+}
+
+TEST_F(ThreadPoolTest, TestNestedParallelFor) {
+  // Tests that ParallelFor() can be called from within tasks running on the
+  // same pool without dead-locking.
+  draco::ThreadPool pool(2);
+  std::atomic<int> sum(0);
+  pool.ParallelFor(8, [&pool, &sum](int) {
+    pool.ParallelFor(16, [&sum](int j) { sum += j; });
+  });
+  ASSERT_EQ(sum.load(), 8 * (15 * 16 / 2));
+}
+
+TEST_F(ThreadPoolTest, TestParallelForWithoutPool) {
+  // Tests that the ParallelFor() helper falls back to serial processing when
+  // no pool is provided.
+  std::vector<int> order;
+  draco::ParallelFor(nullptr, 4, [&order](int i) { order.push_back(i); });
+  ASSERT_EQ(order, std::vector<int>({0, 1, 2, 3}));
+}
+
+TEST_F(ThreadPoolTest, TestTasksScheduledFromWorkers) {
+  // Tests that tasks scheduled by worker threads into their own queues are
+  // executed, including tasks stolen by other workers.
+  draco::ThreadPool pool(4);
+  std::atomic<int> num_done(0);
+  pool.ParallelFor(4, [&pool, &num_done](int) {
+    for (int i = 0; i < 100; ++i) {
+      pool.Schedule([&num_done]() { ++num_done; });
+    }
+  });
+  // Scheduled tasks are not awaited by ParallelFor().
+  while (num_done.load() < 400) {
+    std::this_thread::yield();
+  }
+  ASSERT_EQ(num_done.load(), 400);
+}
+
+// Executor that runs every task on a new detached thread and counts the
+// tasks.
+class CountingExecutor : public draco::TaskExecutor {
+ public:
+  CountingExecutor() : num_tasks_(0) {}
+  int concurrency() const override { return 3; }
+  void Execute(std::function<void()> task) override {
+    ++num_tasks_;
+    threads_.emplace_back(std::move(task));
+  }
+  int num_tasks() const { return num_tasks_; }
+  void Join() {
+    for (std::thread &thread : threads_) {
+      thread.join();
+    }
+    threads_.clear();
+  }
+
+ private:
+  int num_tasks_;
+  std::vector<std::thread> threads_;
+};
+
+TEST_F(ThreadPoolTest, TestCustomExecutor) {
+  // Tests that a pool with a custom executor runs helper tasks of
+  // ParallelFor() on the executor.
+  CountingExecutor executor;
+  std::vector<int> counts(100, 0);
+  {
+    draco::ThreadPool pool(&executor);
+    pool.ParallelFor(static_cast<int>(counts.size()),
+                     [&counts](int i) { counts[i]++; });
+  }
+  executor.Join();
+  for (int i = 0; i < counts.size(); ++i) {
+    ASSERT_EQ(counts[i], 1);
+  }
+#ifdef DRACO_THREADING_SUPPORTED
+  ASSERT_EQ(executor.num_tasks(), 3);
+#else
+  ASSERT_EQ(executor.num_tasks(), 0);
+#endif
+}
+
+}  // namespace
@@ -0,0 +1,70 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <cstdint>
+#include <vector>
+
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/varint_decoding.h"
+#include "draco/core/varint_encoding.h"
+
+namespace {
+
+TEST(VarintCodingTest, TestDecodeVarintArray) {
+  // Tests that bulk decoded varints match values decoded one by one, both for
+  // runs of single byte values and for values of all encoded lengths.
+  std::vector<uint32_t> values;
+  for (uint32_t i = 0; i < 20; ++i) {
+    values.push_back(i);
+  }
+  for (uint32_t i = 0; i < 100; ++i) {
+    values.push_back((i * 2654435761u) >> (i % 32));
+  }
+  values.push_back(0xffffffff);
+  draco::EncoderBuffer encoder_buffer;
+  for (const uint32_t value : values) {
+    draco::EncodeVarint(value, &encoder_buffer);
+  }
+
+  draco::DecoderBuffer buffer;
+  buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+  std::vector<uint32_t> decoded_values(values.size());
+  ASSERT_TRUE(draco::DecodeVarintArray<uint32_t>(
+      decoded_values.size(), decoded_values.data(), &buffer));
+  ASSERT_EQ(decoded_values, values);
+  ASSERT_EQ(buffer.remaining_size(), 0);
+
+  // Decoding more values than available must fail without advancing.
+  buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+  decoded_values.resize(values.size() + 1);
+  ASSERT_FALSE(draco::DecodeVarintArray<uint32_t>(
+      decoded_values.size(), decoded_values.data(), &buffer));
+  ASSERT_EQ(buffer.remaining_size(), encoder_buffer.size());
+}
+
+TEST(VarintCodingTest, TestDecodeVarintArrayTooLong) {
+  // Tests that values encoded with more bytes than the type allows are
+  // rejected in the same way as by DecodeVarint().
+  const uint8_t data[] = {0x80, 0x80, 0x80, 0x80, 0x80, 0x01};
+  draco::DecoderBuffer buffer;
+  buffer.Init(reinterpret_cast<const char *>(data), sizeof(data));
+  uint32_t value;
+  ASSERT_FALSE(draco::DecodeVarint(&value, &buffer));
+  buffer.Init(reinterpret_cast<const char *>(data), sizeof(data));
+  ASSERT_FALSE(draco::DecodeVarintArray<uint32_t>(1, &value, &buffer));
+}
+
+}  // namespace
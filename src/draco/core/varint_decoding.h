@@ -15,6 +15,7 @@
 #ifndef DRACO_CORE_VARINT_DECODING_H_
 #define DRACO_CORE_VARINT_DECODING_H_
 
+#include <cstring>
 #include <type_traits>
 
 #include "draco/core/bit_utils.h"
@@ -76,6 +77,56 @@ bool DecodeVarint(IntTypeT *out_val, DecoderBuffer *buffer) {
   return true;
 }
 
+// Decodes |num_values| unsigned integers that were encoded with EncodeVarint()
+// into |out_values|. The result is the same as calling DecodeVarint() for each
+// value, but the values are read directly from the buffer data and runs of
+// single byte values are copied eight at a time. The buffer is not advanced if
+// this returns false.
+template <typename IntTypeT>
+bool DecodeVarintArray(int64_t num_values, IntTypeT *out_values,
+                       DecoderBuffer *buffer) {
+  static_assert(std::is_unsigned<IntTypeT>::value,
+                "Only unsigned varints can be decoded in bulk.");
+  constexpr int max_bytes = sizeof(IntTypeT) + 1 + (sizeof(IntTypeT) >> 3);
+  const uint8_t *const data =
+      reinterpret_cast<const uint8_t *>(buffer->data_head());
+  const int64_t size = buffer->remaining_size();
+  int64_t pos = 0;
+  int64_t i = 0;
+  while (i < num_values) {
+    if (i + 8 <= num_values && pos + 8 <= size) {
+      uint64_t word;
+      memcpy(&word, data + pos, sizeof(word));
+      if ((word & 0x8080808080808080ull) == 0) {
+        // None of the next eight bytes has a continuation bit.
+        for (int j = 0; j < 8; ++j) {
+          out_values[i + j] = data[pos + j];
+        }
+        i += 8;
+        pos += 8;
+        continue;
+      }
+    }
+    if (pos >= size) {
+      return false;
+    }
+    uint8_t in = data[pos++];
+    IntTypeT value = in & ((1 << 7) - 1);
+    int num_bytes = 1;
+    while (in & (1 << 7)) {
+      if (num_bytes == max_bytes || pos >= size) {
+        return false;
+      }
+      in = data[pos++];
+      value |= static_cast<IntTypeT>(in & ((1 << 7) - 1)) << (7 * num_bytes);
+      ++num_bytes;
+    }
+    out_values[i++] = value;
+  }
+  buffer->Advance(pos);
+  return true;
+}
+
 }  // namespace draco
 
 #endif  // DRACO_CORE_VARINT_DECODING_H_
@@ -0,0 +1,156 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/async_file_writer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "draco/core/thread_pool.h"
+#include "draco/io/file_writer_utils.h"
+
+namespace draco {
+
+namespace {
+
+// Maximum number of bytes that are waiting to be written before Write()
+// blocks.
+constexpr size_t kMaxPendingBytes = 64 << 20;
+
+// Queue of the writes of all AsyncFileWriters. The writes are executed in
+// order on a single background thread. On platforms without thread support
+// the pool executes the writes immediately on the calling thread.
+class WriteQueue {
+ public:
+  WriteQueue()
+      : pool_(1), num_pending_tasks_(0), num_pending_bytes_(0), failed_(false) {}
+
+  // Schedules |task| that writes |num_bytes| bytes. |task| returns false on
+  // failure.
+  void Schedule(size_t num_bytes, std::function<bool()> task) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      // Always accept a task when nothing is pending, otherwise a single large
+      // write would block forever.
+      done_condition_.wait(lock, [&] {
+        return num_pending_tasks_ == 0 ||
+               num_pending_bytes_ + num_bytes <= kMaxPendingBytes;
+      });
+      ++num_pending_tasks_;
+      num_pending_bytes_ += num_bytes;
+    }
+    pool_.Schedule([this, num_bytes, task]() {
+      const bool ok = task();
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!ok) {
+        failed_ = true;
+      }
+      --num_pending_tasks_;
+      num_pending_bytes_ -= num_bytes;
+      done_condition_.notify_all();
+    });
+  }
+
+  bool WaitForPendingTasks() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_condition_.wait(lock, [&] { return num_pending_tasks_ == 0; });
+    const bool ok = !failed_;
+    failed_ = false;
+    return ok;
+  }
+
+ private:
+  ThreadPool pool_;
+  std::mutex mutex_;
+  std::condition_variable done_condition_;
+  int num_pending_tasks_;
+  size_t num_pending_bytes_;
+  bool failed_;
+};
+
+WriteQueue *GetWriteQueue() {
+  // The queue is never destroyed so that it can be used by writers destroyed
+  // during static destruction.
+  static WriteQueue *const queue = new WriteQueue();
+  return queue;
+}
+
+}  // namespace
+
+// Output file shared by the writer and its pending writes.
+struct AsyncFileWriter::File {
+  explicit File(FILE *f) : file(f), failed(false) {}
+  ~File() {
+    if (file != nullptr) {
+      fclose(file);
+    }
+  }
+
+  FILE *file;
+  // Set on the background thread when a write fails.
+  std::atomic<bool> failed;
+};
+
+std::unique_ptr<FileWriterInterface> AsyncFileWriter::Open(
+    const std::string &file_name) {
+  if (file_name.empty()) {
+    return nullptr;
+  }
+  if (!CheckAndCreatePathForFile(file_name)) {
+    return nullptr;
+  }
+  FILE *raw_file_ptr = fopen(file_name.c_str(), "wb");
+  if (raw_file_ptr == nullptr) {
+    return nullptr;
+  }
+  return std::unique_ptr<FileWriterInterface>(
+      new AsyncFileWriter(std::make_shared<File>(raw_file_ptr)));
+}
+
+bool AsyncFileWriter::WaitForPendingWrites() {
+  return GetWriteQueue()->WaitForPendingTasks();
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+  std::shared_ptr<File> file = std::move(file_);
+  GetWriteQueue()->Schedule(0, [file]() {
+    FILE *const raw_file_ptr = file->file;
+    file->file = nullptr;
+    return fclose(raw_file_ptr) == 0;
+  });
+}
+
+bool AsyncFileWriter::Write(const char *buffer, size_t size) {
+  if (file_->failed) {
+    return false;
+  }
+  std::shared_ptr<std::vector<char>> data =
+      std::make_shared<std::vector<char>>(buffer, buffer + size);
+  std::shared_ptr<File> file = file_;
+  GetWriteQueue()->Schedule(size, [file, data]() {
+    if (fwrite(data->data(), 1, data->size(), file->file) != data->size()) {
+      file->failed = true;
+      return false;
+    }
+    return true;
+  });
+  return true;
+}
+
+}  // namespace draco
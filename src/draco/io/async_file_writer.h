@@ -0,0 +1,81 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_ASYNC_FILE_WRITER_H_
+#define DRACO_IO_ASYNC_FILE_WRITER_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "draco/io/file_writer_interface.h"
+
+namespace draco {
+
+// File writer that writes the data on a background thread, so that the caller
+// can continue with other work, e.g. encoding of the next mesh, while the
+// previous output is being written to disk. Write() copies the data and
+// returns without waiting for the write. The file is closed on the background
+// thread after the writer is destroyed. The writes of all AsyncFileWriters are
+// executed one after another in the order they were issued. The amount of
+// data waiting to be written is limited, so Write() blocks when the disk
+// cannot keep up.
+//
+// Because a file is not complete when its writer is destroyed, the writer is
+// not registered in FileWriterFactory by default. It can be used for all
+// files written through the factory with:
+//
+//   FileWriterFactory::RegisterPreferredWriter(AsyncFileWriter::Open);
+//   ...  // Write files, e.g. with GltfEncoder.
+//   if (!AsyncFileWriter::WaitForPendingWrites()) {
+//     // Handle the error.
+//   }
+//
+// WaitForPendingWrites() must be called before the written files are used and
+// before the process exits.
+class AsyncFileWriter : public FileWriterInterface {
+ public:
+  // Creates and returns an AsyncFileWriter that writes to |file_name|. The file
+  // is opened immediately. Returns nullptr when |file_name| cannot be opened
+  // for writing.
+  static std::unique_ptr<FileWriterInterface> Open(
+      const std::string &file_name);
+
+  // Blocks until all pending writes of all AsyncFileWriters are finished and
+  // their files are closed. Returns false when any write or close failed since
+  // the previous call.
+  static bool WaitForPendingWrites();
+
+  AsyncFileWriter() = delete;
+  AsyncFileWriter(const AsyncFileWriter &) = delete;
+  AsyncFileWriter &operator=(const AsyncFileWriter &) = delete;
+
+  // Schedules closing of the file after all pending writes.
+  ~AsyncFileWriter() override;
+
+  // Schedules writing of |size| bytes from |buffer|. The data is copied.
+  // Returns false when a previous write to this file already failed.
+  bool Write(const char *buffer, size_t size) override;
+
+ private:
+  struct File;
+
+  explicit AsyncFileWriter(std::shared_ptr<File> file) : file_(file) {}
+
+  std::shared_ptr<File> file_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_ASYNC_FILE_WRITER_H_
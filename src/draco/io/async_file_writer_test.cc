@@ -0,0 +1,58 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/async_file_writer.h"
+
+#include <string>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/io/file_utils.h"
+
+namespace draco {
+namespace {
+
+TEST(AsyncFileWriterTest, FailOpen) {
+  EXPECT_EQ(AsyncFileWriter::Open(""), nullptr);
+}
+
+TEST(AsyncFileWriterTest, WriteFiles) {
+  // Tests that files written in the background are complete after all
+  // pending writes are finished.
+  constexpr int kNumFiles = 4;
+  std::vector<std::string> contents(kNumFiles);
+  for (int i = 0; i < kNumFiles; ++i) {
+    auto writer = AsyncFileWriter::Open(
+        GetTestTempFileFullPath("async_" + std::to_string(i)));
+    ASSERT_NE(writer, nullptr);
+    for (int j = 0; j <= i * 1000; ++j) {
+      const std::string data = std::to_string(j) + ",";
+      ASSERT_TRUE(writer->Write(data.data(), data.size()));
+      contents[i] += data;
+    }
+  }
+  ASSERT_TRUE(AsyncFileWriter::WaitForPendingWrites());
+  for (int i = 0; i < kNumFiles; ++i) {
+    std::string read_contents;
+    ASSERT_TRUE(ReadFileToString(
+        GetTestTempFileFullPath("async_" + std::to_string(i)), &read_contents));
+    ASSERT_EQ(read_contents, contents[i]);
+  }
+  // There is nothing left to wait for.
+  ASSERT_TRUE(AsyncFileWriter::WaitForPendingWrites());
+}
+
+}  // namespace
+}  // namespace draco
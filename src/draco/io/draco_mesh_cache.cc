@@ -0,0 +1,206 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/draco_mesh_cache.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "draco/core/draco_types.h"
+#include "draco/core/draco_version.h"
+#include "draco/core/hash_utils.h"
+#include "draco/io/file_utils.h"
+#include "draco/io/file_writer_utils.h"
+
+namespace draco {
+
+namespace {
+
+// Identifies cache entries and the version of their layout.
+constexpr char kEntryMagic[8] = {'D', 'R', 'C', 'C', 'A', 'C', 'H', '1'};
+constexpr size_t kEntryHeaderSize = sizeof(kEntryMagic) + 2 * sizeof(int64_t);
+
+// Incremental 128-bit hash computed with two independently seeded lanes.
+class KeyHasher {
+ public:
+  KeyHasher() {
+    lanes_[0] = 0x243f6a8885a308d3ull;
+    lanes_[1] = 0x13198a2e03707344ull;
+  }
+
+  void Add(const void *data, size_t size) {
+    for (int i = 0; i < 2; ++i) {
+      lanes_[i] = HashMix(lanes_[i], HashBytes(data, size, lanes_[i]));
+    }
+  }
+  void AddInt(int64_t value) { Add(&value, sizeof(value)); }
+  void AddString(const std::string &value) {
+    AddInt(static_cast<int64_t>(value.size()));
+    Add(value.data(), value.size());
+  }
+
+  void AddMetadata(const Metadata *metadata) {
+    if (metadata == nullptr) {
+      AddInt(-1);
+      return;
+    }
+    AddInt(metadata->num_entries());
+    for (const auto &entry : metadata->entries()) {
+      AddString(entry.first);
+      AddInt(static_cast<int64_t>(entry.second.data().size()));
+      Add(entry.second.data().data(), entry.second.data().size());
+    }
+    AddInt(static_cast<int64_t>(metadata->sub_metadatas().size()));
+    for (const auto &sub_metadata : metadata->sub_metadatas()) {
+      AddString(sub_metadata.first);
+      AddMetadata(sub_metadata.second.get());
+    }
+  }
+
+  std::string ToString() const {
+    char key[33];
+    snprintf(key, sizeof(key), "%016" PRIx64 "%016" PRIx64, lanes_[0],
+             lanes_[1]);
+    return key;
+  }
+
+ private:
+  uint64_t lanes_[2];
+};
+
+void AddAttribute(const PointAttribute &att, int num_points,
+                  KeyHasher *hasher) {
+  hasher->AddInt(att.attribute_type());
+  hasher->AddInt(att.data_type());
+  hasher->AddInt(att.num_components());
+  hasher->AddInt(att.normalized());
+  hasher->AddInt(att.unique_id());
+  hasher->AddInt(static_cast<int64_t>(att.size()));
+  const int64_t value_size = DataTypeLength(att.data_type()) *
+                             static_cast<int64_t>(att.num_components());
+  if (att.size() > 0 && att.byte_stride() == value_size) {
+    hasher->Add(att.GetAddress(AttributeValueIndex(0)),
+                att.size() * value_size);
+  } else {
+    for (AttributeValueIndex i(0); i < static_cast<uint32_t>(att.size());
+         ++i) {
+      hasher->Add(att.GetAddress(i), value_size);
+    }
+  }
+  hasher->AddInt(att.is_mapping_identity());
+  if (!att.is_mapping_identity()) {
+    // Hash the mapping in blocks to limit the per-call overhead.
+    std::vector<uint32_t> block;
+    block.reserve(1024);
+    for (PointIndex i(0); i < num_points; ++i) {
+      block.push_back(att.mapped_index(i).value());
+      if (block.size() == 1024 || i + 1 == num_points) {
+        hasher->Add(block.data(), block.size() * sizeof(uint32_t));
+        block.clear();
+      }
+    }
+  }
+}
+
+}  // namespace
+
+std::string DracoMeshCache::ComputeKey(const Mesh &mesh,
+                                       const std::string &settings) {
+  KeyHasher hasher;
+  // Entries of other library versions are not reused, as the encoder output
+  // may have changed.
+  hasher.AddString(kDracoVersion);
+  hasher.AddString(settings);
+  hasher.AddInt(mesh.num_points());
+  hasher.AddInt(mesh.num_faces());
+  if (mesh.num_faces() > 0) {
+    static_assert(sizeof(Mesh::Face) == 3 * sizeof(uint32_t),
+                  "Faces are expected to be stored without padding.");
+    hasher.Add(&mesh.face(FaceIndex(0)), mesh.num_faces() * sizeof(Mesh::Face));
+  }
+  hasher.AddInt(mesh.num_attributes());
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    AddAttribute(*mesh.attribute(i), mesh.num_points(), &hasher);
+  }
+  const GeometryMetadata *const metadata = mesh.GetMetadata();
+  hasher.AddMetadata(metadata);
+  if (metadata != nullptr) {
+    for (const auto &att_metadata : metadata->attribute_metadatas()) {
+      hasher.AddInt(att_metadata->att_unique_id());
+      hasher.AddMetadata(att_metadata.get());
+    }
+  }
+  return hasher.ToString();
+}
+
+bool DracoMeshCache::Lookup(const std::string &key, Entry *entry) const {
+  std::vector<char> data;
+  if (!ReadFileToBuffer(GetEntryPath(key), &data) ||
+      data.size() < kEntryHeaderSize ||
+      memcmp(data.data(), kEntryMagic, sizeof(kEntryMagic)) != 0) {
+    return false;
+  }
+  memcpy(&entry->num_encoded_points, data.data() + sizeof(kEntryMagic),
+         sizeof(int64_t));
+  memcpy(&entry->num_encoded_faces,
+         data.data() + sizeof(kEntryMagic) + sizeof(int64_t), sizeof(int64_t));
+  entry->buffer.Clear();
+  return entry->buffer.Encode(data.data() + kEntryHeaderSize,
+                              data.size() - kEntryHeaderSize);
+}
+
+Status DracoMeshCache::Store(const std::string &key, const Entry &entry) const {
+  const std::string path = GetEntryPath(key);
+  if (!CheckAndCreatePathForFile(path)) {
+    return Status(Status::IO_ERROR, "Unable to create " + directory_ + ".");
+  }
+  // Write a uniquely named temporary file and rename it, so that readers never
+  // see partially written entries. The file is written directly instead of
+  // through FileWriterFactory, whose writers may complete asynchronously.
+  char suffix[24];
+  snprintf(suffix, sizeof(suffix), ".%08x.tmp",
+           static_cast<unsigned int>(std::random_device()()));
+  const std::string temp_path = path + suffix;
+  FILE *const file = fopen(temp_path.c_str(), "wb");
+  if (file == nullptr) {
+    return Status(Status::IO_ERROR, "Unable to open " + temp_path + ".");
+  }
+  bool success = fwrite(kEntryMagic, sizeof(kEntryMagic), 1, file) == 1 &&
+                 fwrite(&entry.num_encoded_points, sizeof(int64_t), 1, file) ==
+                     1 &&
+                 fwrite(&entry.num_encoded_faces, sizeof(int64_t), 1, file) ==
+                     1 &&
+                 fwrite(entry.buffer.data(), 1, entry.buffer.size(), file) ==
+                     entry.buffer.size();
+  success = fclose(file) == 0 && success;
+  if (success && std::rename(temp_path.c_str(), path.c_str()) != 0) {
+    // Renaming fails on some platforms when another writer already stored the
+    // same entry.
+    success = GetFileSize(path) > 0;
+  }
+  std::remove(temp_path.c_str());
+  if (!success) {
+    return Status(Status::IO_ERROR, "Unable to write " + path + ".");
+  }
+  return OkStatus();
+}
+
+std::string DracoMeshCache::GetEntryPath(const std::string &key) const {
+  return directory_ + "/" + key + ".drc";
+}
+
+}  // namespace draco
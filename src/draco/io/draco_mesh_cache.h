@@ -0,0 +1,77 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_DRACO_MESH_CACHE_H_
+#define DRACO_IO_DRACO_MESH_CACHE_H_
+
+#include <cstdint>
+#include <string>
+
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// On-disk content-addressed cache of Draco encoded meshes. Entries are keyed by
+// a 128-bit hash of the mesh content and of a string describing the encoder
+// settings, so a mesh that was already encoded with the same settings, e.g. by
+// an earlier run of a tool, does not need to be encoded again. Entries are
+// written to a temporary file that is then renamed, so the cache directory can
+// be shared by concurrent threads and processes.
+//
+// Example:
+//
+//   DracoMeshCache cache("/path/to/cache");
+//   const std::string key = DracoMeshCache::ComputeKey(mesh, settings);
+//   DracoMeshCache::Entry entry;
+//   if (!cache.Lookup(key, &entry)) {
+//     ...  // Encode |mesh| into |entry|.
+//     cache.Store(key, entry);
+//   }
+class DracoMeshCache {
+ public:
+  // Encoded mesh stored in the cache.
+  struct Entry {
+    Entry() : num_encoded_points(0), num_encoded_faces(0) {}
+    EncoderBuffer buffer;
+    int64_t num_encoded_points;
+    int64_t num_encoded_faces;
+  };
+
+  explicit DracoMeshCache(const std::string &directory)
+      : directory_(directory) {}
+
+  const std::string &directory() const { return directory_; }
+
+  // Returns the key of |mesh| encoded with |settings|. The key covers the
+  // faces, the attribute values and mappings, and the metadata of |mesh|.
+  // |settings| must describe all encoder options that affect the output.
+  static std::string ComputeKey(const Mesh &mesh, const std::string &settings);
+
+  // Returns true and the cached entry in |entry| when |key| is in the cache.
+  bool Lookup(const std::string &key, Entry *entry) const;
+
+  // Stores |entry| under |key|.
+  Status Store(const std::string &key, const Entry &entry) const;
+
+ private:
+  std::string GetEntryPath(const std::string &key) const;
+
+  std::string directory_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_DRACO_MESH_CACHE_H_
@@ -0,0 +1,85 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/draco_mesh_cache.h"
+
+#include <string>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/io/file_utils.h"
+
+namespace {
+
+TEST(DracoMeshCacheTest, KeyDependsOnContentAndSettings) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  const std::string key = draco::DracoMeshCache::ComputeKey(*mesh, "a");
+  ASSERT_EQ(key.size(), 32);
+
+  // The key is deterministic.
+  const std::unique_ptr<draco::Mesh> copy =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_EQ(draco::DracoMeshCache::ComputeKey(*copy, "a"), key);
+
+  // Other settings result in another key.
+  ASSERT_NE(draco::DracoMeshCache::ComputeKey(*mesh, "b"), key);
+
+  // Modified attribute values result in another key.
+  draco::PointAttribute *const pos = copy->attribute(
+      copy->GetNamedAttributeId(draco::GeometryAttribute::POSITION));
+  float value[3];
+  pos->GetValue(draco::AttributeValueIndex(0), value);
+  value[0] += 1.f;
+  pos->SetAttributeValue(draco::AttributeValueIndex(0), value);
+  ASSERT_NE(draco::DracoMeshCache::ComputeKey(*copy, "a"), key);
+
+  // Modified faces result in another key.
+  const std::unique_ptr<draco::Mesh> flipped =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  draco::Mesh::Face face = flipped->face(draco::FaceIndex(0));
+  std::swap(face[0], face[1]);
+  flipped->SetFace(draco::FaceIndex(0), face);
+  ASSERT_NE(draco::DracoMeshCache::ComputeKey(*flipped, "a"), key);
+}
+
+TEST(DracoMeshCacheTest, StoresAndLooksUpEntries) {
+  // The temporary test directory always exists, while creating directories
+  // is not supported in all configurations.
+  std::string temp_dir, file_name;
+  draco::SplitPath(draco::GetTestTempFileFullPath("entry"), &temp_dir,
+                   &file_name);
+  const draco::DracoMeshCache cache(temp_dir);
+  const std::string key = "0123456789abcdef0123456789abcdef";
+  draco::DracoMeshCache::Entry entry;
+  const std::string data = "encoded mesh";
+  entry.buffer.Encode(data.data(), data.size());
+  entry.num_encoded_points = 7;
+  entry.num_encoded_faces = 11;
+  DRACO_ASSERT_OK(cache.Store(key, entry));
+
+  draco::DracoMeshCache::Entry cached;
+  ASSERT_TRUE(cache.Lookup(key, &cached));
+  ASSERT_EQ(std::string(cached.buffer.data(), cached.buffer.size()), data);
+  ASSERT_EQ(cached.num_encoded_points, 7);
+  ASSERT_EQ(cached.num_encoded_faces, 11);
+
+  // Storing an existing entry again succeeds.
+  DRACO_ASSERT_OK(cache.Store(key, entry));
+
+  ASSERT_FALSE(cache.Lookup("fedcba9876543210fedcba9876543210", &cached));
+}
+
+}  // namespace
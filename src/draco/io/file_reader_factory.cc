@@ -3,6 +3,9 @@
 #include <string>
 #include <vector>
 
+#include "draco/io/mmap_file_reader.h"
+#include "draco/io/stdio_file_reader.h"
+
 namespace draco {
 namespace {
 
@@ -13,8 +16,12 @@ namespace {
   } while (false)
 
 std::vector<FileReaderFactory::OpenFunction> *GetFileReaderOpenFunctions() {
+  // The built-in readers come first in the order of preference. Files are
+  // memory mapped where possible and read with stdio otherwise. Readers added
+  // with RegisterReader() are tried after them.
   static auto open_functions =
-      new (std::nothrow) std::vector<FileReaderFactory::OpenFunction>();
+      new (std::nothrow) std::vector<FileReaderFactory::OpenFunction>(
+          {MmapFileReader::Open, StdioFileReader::Open});
   return open_functions;
 }
 
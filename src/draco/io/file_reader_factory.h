@@ -19,7 +19,8 @@ class FileReaderFactory {
   ~FileReaderFactory() = default;
 
   // Registers the OpenFunction for a FileReaderInterface and returns true when
-  // registration succeeds.
+  // registration succeeds. Registered readers are tried after the built-in
+  // MmapFileReader and StdioFileReader.
   static bool RegisterReader(OpenFunction open_function);
 
   // Passes |file_name| to each OpenFunction until one succeeds. Returns nullptr
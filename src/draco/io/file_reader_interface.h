@@ -25,6 +25,38 @@ class FileReaderInterface {
 
   // Returns the size of the file.
   virtual size_t GetFileSize() = 0;
+
+  // Returns a pointer to the entire contents of the file that stays valid for
+  // the lifetime of the reader, or nullptr when the reader does not provide
+  // direct access to the contents. In that case ReadFileToBuffer() must be
+  // used instead.
+  virtual const char *GetFileData() { return nullptr; }
+
+  // Reads |size| bytes starting at byte |offset| of the input file into
+  // |buffer| and returns true. Returns false when the range is not within the
+  // file. The default implementation reads the entire file, so readers that
+  // can access parts of the file directly should override it.
+  virtual bool ReadRange(size_t offset, size_t size,
+                         std::vector<char> *buffer) {
+    if (buffer == nullptr) {
+      return false;
+    }
+    std::vector<char> contents;
+    const char *data = GetFileData();
+    size_t file_size = GetFileSize();
+    if (data == nullptr) {
+      if (!ReadFileToBuffer(&contents)) {
+        return false;
+      }
+      data = contents.data();
+      file_size = contents.size();
+    }
+    if (offset > file_size || size > file_size - offset) {
+      return false;
+    }
+    buffer->assign(data + offset, data + offset + size);
+    return true;
+  }
 };
 
 }  // namespace draco
@@ -94,6 +94,27 @@ bool ReadFileToBuffer(const std::string &file_name,
   return file_reader->ReadFileToBuffer(buffer);
 }
 
+bool FileContents::Open(const std::string &file_name) {
+  data_ = nullptr;
+  size_ = 0;
+  buffer_.clear();
+  reader_ = FileReaderFactory::OpenReader(file_name);
+  if (reader_ == nullptr) {
+    return false;
+  }
+  data_ = reader_->GetFileData();
+  if (data_ != nullptr) {
+    size_ = reader_->GetFileSize();
+    return true;
+  }
+  if (!reader_->ReadFileToBuffer(&buffer_)) {
+    return false;
+  }
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+  return true;
+}
+
 bool ReadFileToString(const std::string &file_name, std::string *contents) {
   if (!contents) {
     return false;
@@ -16,9 +16,12 @@
 #define DRACO_IO_FILE_UTILS_H_
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "draco/io/file_reader_interface.h"
+
 namespace draco {
 
 // Splits full path to a file into a folder path + file name.
@@ -61,6 +64,29 @@ bool ReadFileToBuffer(const std::string &file_name, std::vector<char> *buffer);
 bool ReadFileToBuffer(const std::string &file_name,
                       std::vector<uint8_t> *buffer);
 
+// Provides read-only access to the entire contents of a file. Uses
+// draco::FileReaderFactory internally. When the opened reader provides direct
+// access to the contents (see FileReaderInterface::GetFileData()), e.g. by
+// mapping the file into memory, the contents are not copied. Otherwise they
+// are read into an internal buffer.
+class FileContents {
+ public:
+  FileContents() : data_(nullptr), size_(0) {}
+
+  // Opens the file referenced by |file_name| and returns true upon success.
+  bool Open(const std::string &file_name);
+
+  // Contents of the file. Valid until the instance is destroyed or reopened.
+  const char *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  std::unique_ptr<FileReaderInterface> reader_;
+  std::vector<char> buffer_;
+  const char *data_;
+  size_t size_;
+};
+
 // Convenience method for reading a file into a std::string. Reads contents
 // of file referenced by |file_name| into |contents| and returns true upon
 // success.
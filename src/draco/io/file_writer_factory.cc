@@ -30,6 +30,16 @@ bool FileWriterFactory::RegisterWriter(OpenFunction open_function) {
   return open_functions->size() == num_writers + 1;
 }
 
+bool FileWriterFactory::RegisterPreferredWriter(OpenFunction open_function) {
+  if (open_function == nullptr) {
+    return false;
+  }
+  auto open_functions = GetFileWriterOpenFunctions();
+  const size_t num_writers = open_functions->size();
+  open_functions->insert(open_functions->begin(), open_function);
+  return open_functions->size() == num_writers + 1;
+}
+
 std::unique_ptr<FileWriterInterface> FileWriterFactory::OpenWriter(
     const std::string &file_name) {
   for (auto open_function : *GetFileWriterOpenFunctions()) {
@@ -22,6 +22,11 @@ class FileWriterFactory {
   // registration succeeds.
   static bool RegisterWriter(OpenFunction open_function);
 
+  // Registers the OpenFunction for a FileWriterInterface in front of all
+  // previously registered functions, so that it is tried first by
+  // OpenWriter(). Returns true when registration succeeds.
+  static bool RegisterPreferredWriter(OpenFunction open_function);
+
   // Passes |file_name| to each OpenFunction until one succeeds. Returns nullptr
   // when no writer is found for |file_name|. Otherwise a FileWriterInterface is
   // returned.
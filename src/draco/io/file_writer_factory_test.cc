@@ -58,6 +58,7 @@ bool AlwaysOkFileWriter::is_registered_ =
 
 TEST(FileWriterFactoryTest, RegistrationFail) {
   EXPECT_FALSE(FileWriterFactory::RegisterWriter(nullptr));
+  EXPECT_FALSE(FileWriterFactory::RegisterPreferredWriter(nullptr));
 }
 
 TEST(FileWriterFactoryTest, OpenWriter) {
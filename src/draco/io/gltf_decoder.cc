@@ -17,6 +17,8 @@
 #ifdef DRACO_TRANSCODER_SUPPORTED
 #include <array>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <set>
@@ -26,14 +28,19 @@
 #include <utility>
 #include <vector>
 
+#include "draco/compression/decode.h"
 #include "draco/core/draco_types.h"
 #include "draco/core/hash_utils.h"
 #include "draco/core/status.h"
 #include "draco/core/status_or.h"
+#include "draco/core/thread_pool.h"
+#include "draco/io/draco_mesh_cache.h"
 #include "draco/io/file_utils.h"
+#include "draco/io/gltf_json_parser.h"
 #include "draco/io/texture_io.h"
 #include "draco/io/tiny_gltf_utils.h"
 #include "draco/material/material_library.h"
+#include "draco/mesh/indexed_mesh_builder.h"
 #include "draco/mesh/mesh.h"
 #include "draco/mesh/mesh_features.h"
 #include "draco/mesh/triangle_soup_mesh_builder.h"
@@ -171,19 +178,9 @@ StatusOr<std::vector<uint32_t>> CopyDataAsUint32(
 
   std::vector<uint32_t> output;
   output.resize(num_elements);
-
-  int out_index = 0;
-  const uint8_t *data = data_start;
-  for (int i = 0; i < accessor.count; ++i) {
-    for (int c = 0; c < num_components; ++c) {
-      uint32_t value = 0;
-      memcpy(&value, data + (c * component_size), component_size);
-      output[out_index++] = value;
-    }
-
-    data += byte_stride;
-  }
-
+  TinyGltfUtils::CopyComponents<uint32_t>(data_start, byte_stride,
+                                          component_size, num_components,
+                                          accessor.count, output.data());
   return output;
 }
 
@@ -231,20 +228,14 @@ StatusOr<std::vector<TypeT>> CopyDataAs(const tinygltf::Model &model,
   const int component_size =
       tinygltf::GetComponentSizeInBytes(accessor.componentType);
 
-  std::vector<TypeT> output;
-  output.resize(accessor.count);
-
   const int num_components =
       TinyGltfUtils::GetNumComponentsForType(accessor.type);
-  int out_index = 0;
-  const uint8_t *data = data_start;
-  for (int i = 0; i < accessor.count; ++i) {
-    for (int c = 0; c < num_components; ++c) {
-      TypeT value = 0;
-      memcpy(&value, data + (c * component_size), component_size);
-      output[out_index++] = value;
-    }
-    data += byte_stride;
+  std::vector<TypeT> output;
+  output.resize(accessor.count * num_components);
+  if (!TinyGltfUtils::CopyComponents<TypeT>(data_start, byte_stride,
+                                            component_size, num_components,
+                                            accessor.count, output.data())) {
+    return ErrorStatus("Accessor component type is too large.");
   }
   return output;
 }
@@ -279,17 +270,17 @@ StatusOr<std::vector<TypeT>> CopyDataAs(const tinygltf::Model &model,
   const int component_size =
       tinygltf::GetComponentSizeInBytes(accessor.componentType);
 
+  // VectorD stores its components contiguously so the values can be copied
+  // directly into |output|.
+  typedef typename TypeT::Scalar ScalarT;
+  static_assert(sizeof(TypeT) == TypeT::dimension * sizeof(ScalarT),
+                "VectorD components must be tightly packed.");
   std::vector<TypeT> output;
   output.resize(accessor.count);
-
-  const uint8_t *data = data_start;
-  for (int i = 0; i < accessor.count; ++i) {
-    TypeT values;
-    for (int c = 0; c < num_components; ++c) {
-      memcpy(&values[c], data + (c * component_size), component_size);
-    }
-    output[i] = values;
-    data += byte_stride;
+  if (!TinyGltfUtils::CopyComponents<ScalarT>(
+          data_start, byte_stride, component_size, num_components,
+          accessor.count, reinterpret_cast<ScalarT *>(output.data()))) {
+    return ErrorStatus("Accessor component type is too large.");
   }
   return output;
 }
@@ -432,12 +423,123 @@ bool ReadWholeFile(std::vector<unsigned char> *out, std::string *err,
   return true;
 }
 
+// Same as ReadWholeFile() but refuses to read image files. TinyGLTF treats
+// external images as optional so they are skipped without an error.
+bool ReadWholeFileExceptImages(std::vector<unsigned char> *out,
+                               std::string *err, const std::string &filepath,
+                               void *user_data) {
+  const std::string extension = LowercaseFileExtension(filepath);
+  if (extension == "png" || extension == "jpg" || extension == "jpeg" ||
+      extension == "webp" || extension == "ktx2" || extension == "basis") {
+    return false;
+  }
+  return ReadWholeFile(out, err, filepath, user_data);
+}
+
+// Image loader that keeps the glTF images undecoded. Used when textures are
+// skipped so that TinyGLTF does not spend time decoding the pixel data.
+bool SkipImageData(tinygltf::Image * /*image*/, const int /*image_idx*/,
+                   std::string * /*err*/, std::string * /*warn*/,
+                   int /*req_width*/, int /*req_height*/,
+                   const unsigned char * /*bytes*/, int /*size*/,
+                   void * /*user_data*/) {
+  return true;
+}
+
 bool WriteWholeFile(std::string * /*err*/, const std::string &filepath,
                     const std::vector<unsigned char> &contents,
                     void * /*user_data*/) {
   return WriteBufferToFile(contents.data(), contents.size(), filepath);
 }
 
+// Copies values of |attribute| for all points of |mesh| to |data| converted to
+// type T.
+template <typename T>
+bool CopyDracoAttributeValues(const Mesh &mesh, const PointAttribute &attribute,
+                              std::vector<unsigned char> *data) {
+  const int num_components = attribute.num_components();
+  const size_t value_size = num_components * sizeof(T);
+  data->resize(mesh.num_points() * value_size);
+  std::vector<T> value(num_components);
+  for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+    if (!attribute.ConvertValue<T>(attribute.mapped_index(pi), num_components,
+                                   value.data())) {
+      return false;
+    }
+    memcpy(data->data() + pi.value() * value_size, value.data(), value_size);
+  }
+  return true;
+}
+
+// Copies values of |attribute| for all points of |mesh| to |data| converted to
+// glTF |component_type|.
+bool CopyDracoAttributeValues(const Mesh &mesh, const PointAttribute &attribute,
+                              int component_type,
+                              std::vector<unsigned char> *data) {
+  switch (component_type) {
+    case TINYGLTF_COMPONENT_TYPE_BYTE:
+      return CopyDracoAttributeValues<int8_t>(mesh, attribute, data);
+    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+      return CopyDracoAttributeValues<uint8_t>(mesh, attribute, data);
+    case TINYGLTF_COMPONENT_TYPE_SHORT:
+      return CopyDracoAttributeValues<int16_t>(mesh, attribute, data);
+    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+      return CopyDracoAttributeValues<uint16_t>(mesh, attribute, data);
+    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+      return CopyDracoAttributeValues<uint32_t>(mesh, attribute, data);
+    case TINYGLTF_COMPONENT_TYPE_FLOAT:
+      return CopyDracoAttributeValues<float>(mesh, attribute, data);
+    default:
+      return false;
+  }
+}
+
+// Copies face indices of |mesh| to |data| as unsigned integers of
+// |component_size| bytes.
+bool CopyDracoIndices(const Mesh &mesh, int component_size,
+                      std::vector<unsigned char> *data) {
+  if (component_size != 1 && component_size != 2 && component_size != 4) {
+    return false;
+  }
+  data->resize(3 * mesh.num_faces() * component_size);
+  unsigned char *out = data->data();
+  for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+    for (int c = 0; c < 3; ++c) {
+      const uint32_t index = mesh.face(fi)[c].value();
+      if (component_size == 1) {
+        *out = static_cast<uint8_t>(index);
+      } else if (component_size == 2) {
+        const uint16_t index16 = static_cast<uint16_t>(index);
+        memcpy(out, &index16, sizeof(index16));
+      } else {
+        memcpy(out, &index, sizeof(index));
+      }
+      out += component_size;
+    }
+  }
+  return true;
+}
+
+// Moves |data| to a new buffer and buffer view of |model| and makes
+// |accessor_index| reference the buffer view.
+void AddDecodedDataToModel(int accessor_index, size_t count,
+                           std::vector<unsigned char> *data,
+                           tinygltf::Model *model) {
+  tinygltf::Buffer buffer;
+  buffer.data.swap(*data);
+  tinygltf::BufferView buffer_view;
+  buffer_view.buffer = static_cast<int>(model->buffers.size());
+  buffer_view.byteOffset = 0;
+  buffer_view.byteLength = buffer.data.size();
+  buffer_view.byteStride = 0;
+  model->buffers.push_back(std::move(buffer));
+  model->bufferViews.push_back(buffer_view);
+  tinygltf::Accessor &accessor = model->accessors[accessor_index];
+  accessor.bufferView = static_cast<int>(model->bufferViews.size() - 1);
+  accessor.byteOffset = 0;
+  accessor.count = count;
+}
+
 }  // namespace
 
 GltfDecoder::GltfDecoder()
@@ -496,24 +598,71 @@ Status GltfDecoder::LoadFile(const std::string &file_name,
       &FileExists,
       // TinyGLTF's ExpandFilePath does not do filesystem i/o, so it's safe to
       // use in all environments.
-      &tinygltf::ExpandFilePath, &ReadWholeFile, &WriteWholeFile,
-      reinterpret_cast<void *>(input_files)};
+      &tinygltf::ExpandFilePath,
+      skip_textures_ ? &ReadWholeFileExceptImages : &ReadWholeFile,
+      &WriteWholeFile, reinterpret_cast<void *>(input_files)};
 
   loader.SetFsCallbacks(fs_callbacks);
+  if (skip_textures_) {
+    loader.SetImageLoader(&SkipImageData, nullptr);
+  }
+  GltfJsonParser json_parser;
+  json_parser.SetSkipImages(skip_textures_);
 
   if (extension == "glb") {
-    if (!loader.LoadBinaryFromFile(&gltf_model_, &err, &warn, file_name)) {
+    // The glb file is parsed directly from the file contents, which avoids an
+    // extra copy when the file can be mapped into memory.
+    FileContents file_contents;
+    if (!file_contents.Open(file_name)) {
+      return Status(Status::DRACO_ERROR, "Unable to read: " + file_name);
+    }
+    if (file_contents.size() > std::numeric_limits<uint32_t>::max()) {
+      return Status(Status::DRACO_ERROR, "The glb file is too large.");
+    }
+    if (input_files) {
+      input_files->push_back(file_name);
+    }
+    std::string folder_path;
+    std::string glb_file_name;
+    SplitPath(file_name, &folder_path, &glb_file_name);
+    const bool parsed =
+        fast_json_parsing_ &&
+        json_parser.ParseGlb(file_contents.data(), file_contents.size(),
+                             file_name, input_files, &gltf_model_);
+    if (!parsed &&
+        !loader.LoadBinaryFromMemory(
+            &gltf_model_, &err, &warn,
+            reinterpret_cast<const unsigned char *>(file_contents.data()),
+            static_cast<unsigned int>(file_contents.size()), folder_path)) {
       return Status(Status::DRACO_ERROR,
                     "TinyGLTF failed to load glb file: " + err);
     }
   } else if (extension == "gltf") {
-    if (!loader.LoadASCIIFromFile(&gltf_model_, &err, &warn, file_name)) {
+    bool parsed = false;
+    if (fast_json_parsing_) {
+      // Paths of the external buffers are appended after the glTF file itself
+      // to keep the order used by TinyGLTF.
+      FileContents file_contents;
+      std::vector<std::string> buffer_files;
+      parsed = file_contents.Open(file_name) &&
+               json_parser.ParseGltf(file_contents.data(),
+                                     file_contents.size(), file_name,
+                                     &buffer_files, &gltf_model_);
+      if (parsed && input_files) {
+        input_files->push_back(file_name);
+        input_files->insert(input_files->end(), buffer_files.begin(),
+                            buffer_files.end());
+      }
+    }
+    if (!parsed &&
+        !loader.LoadASCIIFromFile(&gltf_model_, &err, &warn, file_name)) {
       return Status(Status::DRACO_ERROR,
                     "TinyGLTF failed to load glTF file: " + err);
     }
   } else {
     return Status(Status::DRACO_ERROR, "Unknown input file extension.");
   }
+  DRACO_RETURN_IF_ERROR(DecodeDracoPrimitives());
   DRACO_RETURN_IF_ERROR(CheckUnsupportedFeatures());
   input_file_name_ = file_name;
   return OkStatus();
@@ -523,19 +672,239 @@ Status GltfDecoder::LoadBuffer(const DecoderBuffer &buffer) {
   tinygltf::TinyGLTF loader;
   std::string err;
   std::string warn;
-
-  if (!loader.LoadBinaryFromMemory(
+  if (skip_textures_) {
+    loader.SetImageLoader(&SkipImageData, nullptr);
+  }
+
+  GltfJsonParser json_parser;
+  json_parser.SetSkipImages(skip_textures_);
+  const bool parsed =
+      fast_json_parsing_ &&
+      json_parser.ParseGlb(buffer.data_head(), buffer.remaining_size(), "",
+                           nullptr, &gltf_model_);
+  if (!parsed &&
+      !loader.LoadBinaryFromMemory(
           &gltf_model_, &err, &warn,
           reinterpret_cast<const unsigned char *>(buffer.data_head()),
           buffer.remaining_size())) {
     return Status(Status::DRACO_ERROR,
                   "TinyGLTF failed to load glb buffer: " + err);
   }
+  DRACO_RETURN_IF_ERROR(DecodeDracoPrimitives());
   DRACO_RETURN_IF_ERROR(CheckUnsupportedFeatures());
   input_file_name_.clear();
   return OkStatus();
 }
 
+Status GltfDecoder::DecodeDracoPrimitives() {
+  const std::string kDracoExtension = "KHR_draco_mesh_compression";
+
+  // Gather all compressed primitives and the buffer views with their Draco
+  // payloads. Primitives may share the same payload.
+  std::vector<tinygltf::Primitive *> primitives;
+  std::vector<int> primitive_payloads;
+  std::vector<int> payload_buffer_views;
+  std::map<int, int> buffer_view_to_payload;
+  for (tinygltf::Mesh &mesh : gltf_model_.meshes) {
+    for (tinygltf::Primitive &primitive : mesh.primitives) {
+      const auto it = primitive.extensions.find(kDracoExtension);
+      if (it == primitive.extensions.end()) {
+        continue;
+      }
+      const tinygltf::Value &buffer_view = it->second.Get("bufferView");
+      if (!buffer_view.IsInt() || !it->second.Get("attributes").IsObject()) {
+        return Status(Status::DRACO_ERROR,
+                      "Invalid " + kDracoExtension + " extension.");
+      }
+      const int buffer_view_index = buffer_view.Get<int>();
+      if (buffer_view_index < 0 ||
+          buffer_view_index >=
+              static_cast<int>(gltf_model_.bufferViews.size())) {
+        return Status(Status::DRACO_ERROR, "Invalid Draco buffer view.");
+      }
+      const auto payload_it = buffer_view_to_payload.insert(std::make_pair(
+          buffer_view_index, static_cast<int>(payload_buffer_views.size())));
+      if (payload_it.second) {
+        payload_buffer_views.push_back(buffer_view_index);
+      }
+      primitives.push_back(&primitive);
+      primitive_payloads.push_back(payload_it.first->second);
+    }
+  }
+  if (primitives.empty()) {
+    return OkStatus();
+  }
+
+  // Decode the Draco payloads. Each payload is decoded independently so the
+  // decoded meshes do not depend on the number of threads.
+  const int num_payloads = static_cast<int>(payload_buffer_views.size());
+  std::vector<std::unique_ptr<Mesh>> meshes(num_payloads);
+  std::vector<std::shared_ptr<DracoPrimitivePayload>> payloads(num_payloads);
+  std::vector<Status> statuses(num_payloads);
+  ParallelFor(thread_pool_, num_payloads, [&](int i) {
+    const tinygltf::BufferView &buffer_view =
+        gltf_model_.bufferViews[payload_buffer_views[i]];
+    if (buffer_view.buffer < 0 ||
+        buffer_view.buffer >= static_cast<int>(gltf_model_.buffers.size()) ||
+        buffer_view.byteOffset + buffer_view.byteLength >
+            gltf_model_.buffers[buffer_view.buffer].data.size()) {
+      statuses[i] = Status(Status::DRACO_ERROR, "Invalid Draco buffer view.");
+      return;
+    }
+    const tinygltf::Buffer &buffer = gltf_model_.buffers[buffer_view.buffer];
+    DecoderBuffer decoder_buffer;
+    decoder_buffer.Init(
+        reinterpret_cast<const char *>(buffer.data.data()) +
+            buffer_view.byteOffset,
+        buffer_view.byteLength);
+    Decoder decoder;
+    StatusOr<std::unique_ptr<Mesh>> mesh_or =
+        decoder.DecodeMeshFromBuffer(&decoder_buffer);
+    if (!mesh_or.ok()) {
+      statuses[i] = mesh_or.status();
+      return;
+    }
+    meshes[i] = std::move(mesh_or).value();
+    if (keep_draco_payloads_) {
+      payloads[i] = CreateDracoPrimitivePayload(
+          reinterpret_cast<const char *>(buffer.data.data()) +
+              buffer_view.byteOffset,
+          buffer_view.byteLength, *meshes[i]);
+    }
+  });
+  for (int i = 0; i < num_payloads; ++i) {
+    DRACO_RETURN_IF_ERROR(statuses[i]);
+  }
+  const int num_primitives = static_cast<int>(primitives.size());
+  for (int i = 0; i < num_primitives; ++i) {
+    if (payloads[primitive_payloads[i]] != nullptr) {
+      draco_primitive_payloads_[primitives[i]] =
+          payloads[primitive_payloads[i]];
+    }
+  }
+
+  // Replace the accessor data of all compressed primitives with the decoded
+  // values. This is done in the order of the primitives so the layout of
+  // |gltf_model_| is deterministic.
+  std::set<int> decoded_accessors;
+  std::vector<unsigned char> data;
+  for (int i = 0; i < num_primitives; ++i) {
+    const tinygltf::Primitive &primitive = *primitives[i];
+    const Mesh &mesh = *meshes[primitive_payloads[i]];
+    if (primitive.indices >= 0 &&
+        decoded_accessors.insert(primitive.indices).second) {
+      if (primitive.indices >=
+          static_cast<int>(gltf_model_.accessors.size())) {
+        return Status(Status::DRACO_ERROR, "Invalid indices accessor.");
+      }
+      const int component_size = tinygltf::GetComponentSizeInBytes(
+          gltf_model_.accessors[primitive.indices].componentType);
+      if (!CopyDracoIndices(mesh, component_size, &data)) {
+        return Status(Status::DRACO_ERROR, "Failed to copy Draco indices.");
+      }
+      AddDecodedDataToModel(primitive.indices, 3 * mesh.num_faces(), &data,
+                            &gltf_model_);
+    }
+    const tinygltf::Value::Object &attributes =
+        primitive.extensions.at(kDracoExtension)
+            .Get("attributes")
+            .Get<tinygltf::Value::Object>();
+    for (const auto &attribute : attributes) {
+      const auto it = primitive.attributes.find(attribute.first);
+      if (!attribute.second.IsInt() || it == primitive.attributes.end() ||
+          it->second < 0 ||
+          it->second >= static_cast<int>(gltf_model_.accessors.size())) {
+        return Status(Status::DRACO_ERROR,
+                      "Invalid Draco attribute " + attribute.first + ".");
+      }
+      if (!decoded_accessors.insert(it->second).second) {
+        continue;
+      }
+      const PointAttribute *const att =
+          mesh.GetAttributeByUniqueId(attribute.second.Get<int>());
+      if (att == nullptr) {
+        return Status(Status::DRACO_ERROR,
+                      "Missing Draco attribute " + attribute.first + ".");
+      }
+      if (!CopyDracoAttributeValues(
+              mesh, *att, gltf_model_.accessors[it->second].componentType,
+              &data)) {
+        return Status(Status::DRACO_ERROR,
+                      "Failed to copy Draco attribute " + attribute.first +
+                          ".");
+      }
+      AddDecodedDataToModel(it->second, mesh.num_points(), &data,
+                            &gltf_model_);
+    }
+  }
+  return OkStatus();
+}
+
+std::shared_ptr<GltfDecoder::DracoPrimitivePayload>
+GltfDecoder::CreateDracoPrimitivePayload(const char *data, size_t size,
+                                         const Mesh &mesh) {
+  DecoderBuffer buffer;
+  buffer.Init(data, size);
+  Decoder decoder;
+  StatusOr<EncodedGeometryInfo> info_or = decoder.ProbeBuffer(&buffer);
+  // Quantization parameters of older bitstreams are not known without
+  // decoding the values.
+  if (!info_or.ok() || info_or.value().version_major < 2) {
+    return nullptr;
+  }
+  std::shared_ptr<DracoPrimitivePayload> payload(new DracoPrimitivePayload());
+  payload->data = std::make_shared<const std::vector<char>>(data, data + size);
+  payload->num_encoded_points = mesh.num_points();
+  payload->num_encoded_faces = mesh.num_faces();
+  for (const EncodedAttributeInfo &att_info : info_or.value().attributes) {
+    payload->quantization_bits[att_info.unique_id] = att_info.quantization_bits;
+    if (att_info.attribute_type == GeometryAttribute::POSITION) {
+      payload->position_range = att_info.range;
+    }
+  }
+  return payload;
+}
+
+std::unique_ptr<Mesh::DracoPayload> GltfDecoder::CreateMeshDracoPayload(
+    const tinygltf::Primitive &primitive, const Mesh &mesh,
+    const std::map<std::string, int> &attribute_ids) const {
+  const auto it = draco_primitive_payloads_.find(&primitive);
+  if (it == draco_primitive_payloads_.end() ||
+      primitive.mode != TINYGLTF_MODE_TRIANGLES) {
+    return nullptr;
+  }
+  const DracoPrimitivePayload &source = *it->second;
+  const tinygltf::Value::Object &attributes =
+      primitive.extensions.at("KHR_draco_mesh_compression")
+          .Get("attributes")
+          .Get<tinygltf::Value::Object>();
+
+  // The payload can replace the mesh only when it contains all attributes of
+  // the mesh.
+  if (attributes.size() != attribute_ids.size() ||
+      static_cast<int>(attribute_ids.size()) != mesh.num_attributes()) {
+    return nullptr;
+  }
+  std::unique_ptr<Mesh::DracoPayload> payload(new Mesh::DracoPayload());
+  payload->data = source.data;
+  payload->num_encoded_points = source.num_encoded_points;
+  payload->num_encoded_faces = source.num_encoded_faces;
+  payload->position_range = source.position_range;
+  payload->quantization_bits.resize(mesh.num_attributes(), 0);
+  for (const auto &attribute : attributes) {
+    const auto att_it = attribute_ids.find(attribute.first);
+    const auto bits_it =
+        source.quantization_bits.find(attribute.second.Get<int>());
+    if (att_it == attribute_ids.end() ||
+        bits_it == source.quantization_bits.end()) {
+      return nullptr;
+    }
+    payload->attribute_ids[attribute.first] = bits_it->first;
+    payload->quantization_bits[att_it->second] = bits_it->second;
+  }
+  return payload;
+}
+
 StatusOr<std::unique_ptr<Mesh>> GltfDecoder::BuildMesh() {
   DRACO_RETURN_IF_ERROR(GatherAttributeAndMaterialStats());
   if (total_face_indices_count_ > 0 && total_point_indices_count_ > 0) {
@@ -1110,6 +1479,19 @@ void GltfDecoder::SetValuesForBuilder(const std::vector<uint32_t> &indices_data,
   }
 }
 
+template <typename T>
+void GltfDecoder::SetValuesForBuilder(const std::vector<uint32_t> &indices_data,
+                                      int att_id, int number_of_elements,
+                                      const std::vector<T> &data,
+                                      bool reverse_winding,
+                                      IndexedMeshBuilder *builder) {
+  // |data| holds one value for each point of the indexed mesh.
+  if (number_of_elements > 0) {
+    builder->SetAttributeValuesForAllPoints(
+        att_id, GetDataContentAddress(data[0]), sizeof(T));
+  }
+}
+
 template <typename T>
 void GltfDecoder::SetValuesPerFace(const std::vector<uint32_t> &indices_data,
                                    int att_id, int number_of_faces,
@@ -1293,6 +1675,9 @@ Status GltfDecoder::AddAttributeDataByTypes(
 
 template <typename T>
 Status GltfDecoder::CopyTextures(T *owner) {
+  if (skip_textures_) {
+    return OkStatus();
+  }
   for (int i = 0; i < gltf_model_.images.size(); ++i) {
     const tinygltf::Image &image = gltf_model_.images[i];
     if (image.width == -1 || image.height == -1 || image.component == -1) {
@@ -1485,6 +1870,13 @@ Status GltfDecoder::DecodeGltfToScene() {
   MoveNonMaterialTextures(scene_.get());
   DRACO_RETURN_IF_ERROR(AddAssetMetadata(scene_.get()));
 
+  // The keys of the Draco payloads are computed from the complete meshes.
+  for (auto &mesh_payload : scene_mesh_payloads_) {
+    Mesh &mesh = scene_->GetMesh(mesh_payload.first);
+    mesh_payload.second->mesh_key = DracoMeshCache::ComputeKey(mesh, "");
+    mesh.SetDracoPayload(std::move(mesh_payload.second));
+  }
+  scene_mesh_payloads_.clear();
   return OkStatus();
 }
 
@@ -1995,10 +2387,34 @@ Status GltfDecoder::DecodePrimitiveForScene(
   const int number_of_faces = indices_data.size() / 3;
   const int number_of_points = indices_data.size();
 
+  // Triangles are added either as a soup of per-corner values or, in the
+  // indexed mode, with the original vertices referenced by the faces.
+  const bool use_indexed_builder =
+      indexed_meshes_ && primitive.mode == TINYGLTF_MODE_TRIANGLES;
+  int number_of_vertices = 0;
+  std::vector<uint32_t> vertex_ids;
+  if (use_indexed_builder) {
+    DRACO_ASSIGN_OR_RETURN(number_of_vertices,
+                           DecodePrimitiveAttributeCount(primitive));
+    vertex_ids.resize(number_of_vertices);
+    for (int i = 0; i < number_of_vertices; ++i) {
+      vertex_ids[i] = i;
+    }
+  }
+
   // Note that glTF mesh |primitive| has no name; no name is set to Draco mesh.
   TriangleSoupMeshBuilder mb;
   PointCloudBuilder pb;
-  if (primitive.mode == TINYGLTF_MODE_TRIANGLES) {
+  IndexedMeshBuilder imb;
+  if (use_indexed_builder) {
+    imb.Start(number_of_faces, number_of_vertices);
+    for (FaceIndex fi(0); fi < number_of_faces; ++fi) {
+      const int base_corner = 3 * fi.value();
+      imb.SetFace(fi, {{PointIndex(indices_data[base_corner]),
+                        PointIndex(indices_data[base_corner + 1]),
+                        PointIndex(indices_data[base_corner + 2])}});
+    }
+  } else if (primitive.mode == TINYGLTF_MODE_TRIANGLES) {
     mb.Start(number_of_faces);
   } else {
     pb.Start(number_of_points);
@@ -2008,6 +2424,7 @@ Status GltfDecoder::DecodePrimitiveForScene(
   feature_id_attribute_indices_.clear();
 
   std::set<int32_t> normalized_attributes;
+  std::map<std::string, int> attribute_ids;
   for (const auto &attribute : primitive.attributes) {
     if (attribute.second >= gltf_model_.accessors.size()) {
       return ErrorStatus("Invalid accessor.");
@@ -2018,7 +2435,13 @@ Status GltfDecoder::DecodePrimitiveForScene(
     const int type = accessor.type;
     const bool normalized = accessor.normalized;
     int att_id = -1;
-    if (primitive.mode == TINYGLTF_MODE_TRIANGLES) {
+    if (use_indexed_builder) {
+      if (static_cast<int>(accessor.count) != number_of_vertices) {
+        return ErrorStatus("Primitive attributes have different sizes.");
+      }
+      DRACO_ASSIGN_OR_RETURN(
+          att_id, AddAttribute(attribute.first, component_type, type, &imb));
+    } else if (primitive.mode == TINYGLTF_MODE_TRIANGLES) {
       DRACO_ASSIGN_OR_RETURN(
           att_id, AddAttribute(attribute.first, component_type, type, &mb));
     } else {
@@ -2028,11 +2451,16 @@ Status GltfDecoder::DecodePrimitiveForScene(
     if (att_id == -1) {
       continue;
     }
+    attribute_ids[attribute.first] = att_id;
     if (normalized) {
       normalized_attributes.insert(att_id);
     }
 
-    if (primitive.mode == TINYGLTF_MODE_TRIANGLES) {
+    if (use_indexed_builder) {
+      DRACO_RETURN_IF_ERROR(AddAttributeValuesToBuilder(
+          attribute.first, accessor, vertex_ids, att_id, number_of_vertices,
+          Eigen::Matrix4d::Identity(), &imb));
+    } else if (primitive.mode == TINYGLTF_MODE_TRIANGLES) {
       DRACO_RETURN_IF_ERROR(AddAttributeValuesToBuilder(
           attribute.first, accessor, indices_data, att_id, number_of_faces,
           Eigen::Matrix4d::Identity(), &mb));
@@ -2045,10 +2473,17 @@ Status GltfDecoder::DecodePrimitiveForScene(
 
   int material_index = primitive.material;
 
-  DRACO_ASSIGN_OR_RETURN(
-      std::unique_ptr<Mesh> mesh,
-      BuildMeshFromBuilder(primitive.mode == TINYGLTF_MODE_TRIANGLES, &mb, &pb,
-                           deduplicate_vertices_));
+  std::unique_ptr<Mesh> mesh;
+  if (use_indexed_builder) {
+    mesh = imb.Finalize(deduplicate_vertices_);
+    if (!mesh) {
+      return ErrorStatus("Failed to build Draco mesh from glTF data.");
+    }
+  } else {
+    DRACO_ASSIGN_OR_RETURN(
+        mesh, BuildMeshFromBuilder(primitive.mode == TINYGLTF_MODE_TRIANGLES,
+                                   &mb, &pb, deduplicate_vertices_));
+  }
 
   // Set all normalized flags for appropriate attributes.
   for (const int32_t att_id : normalized_attributes) {
@@ -2060,10 +2495,16 @@ Status GltfDecoder::DecodePrimitiveForScene(
       primitive, &scene_->GetMaterialLibrary().MutableTextureLibrary(),
       mesh.get()));
 
+  std::unique_ptr<Mesh::DracoPayload> draco_payload =
+      CreateMeshDracoPayload(primitive, *mesh, attribute_ids);
   const MeshIndex mesh_index = scene_->AddMesh(std::move(mesh));
   if (mesh_index == kInvalidMeshIndex) {
     return Status(Status::DRACO_ERROR, "Could not add Draco mesh to scene.");
   }
+  if (draco_payload != nullptr) {
+    scene_mesh_payloads_.push_back(
+        std::make_pair(mesh_index, std::move(draco_payload)));
+  }
   mesh_group->AddMeshInstance({mesh_index, material_index, mappings});
 
   gltf_primitive_to_draco_mesh_index_[signature] = mesh_index;
@@ -2282,8 +2723,11 @@ Status GltfDecoder::DecodeMeshFeatures(
         const auto &container_object = object.Get<tinygltf::Value::Object>();
         DRACO_RETURN_IF_ERROR(DecodeTexture(kName, TextureMap::GENERIC,
                                             container_object, &material));
-        features.SetTextureMap(
-            *material.GetTextureMapByType(TextureMap::GENERIC));
+        const TextureMap *const texture_map =
+            material.GetTextureMapByType(TextureMap::GENERIC);
+        if (texture_map != nullptr) {
+          features.SetTextureMap(*texture_map);
+        }
 
         // Decode array of texture channel indices.
         std::vector<int> channels;
@@ -2434,6 +2878,17 @@ void GltfDecoder::SetWhiteVertexColorOfType(int color_att_id,
   }
 }
 
+template <typename ComponentT>
+void GltfDecoder::SetWhiteVertexColorOfType(int color_att_id,
+                                            IndexedMeshBuilder *builder) {
+  // The alpha component will not be copied for the RGB vertex colors.
+  std::array<ComponentT, 4> white{1, 1, 1, 1};
+  const PointIndex::ValueType num_points = builder->num_points();
+  for (PointIndex pi(0); pi < num_points; pi++) {
+    builder->SetAttributeValueForPoint(color_att_id, pi, white.data());
+  }
+}
+
 StatusOr<bool> GltfDecoder::CheckKhrTextureTransform(
     const tinygltf::ExtensionMap &extension, TextureTransform *transform) {
   bool transform_set = false;
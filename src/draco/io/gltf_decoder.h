@@ -28,7 +28,9 @@
 #include "draco/core/decoder_buffer.h"
 #include "draco/core/status.h"
 #include "draco/core/status_or.h"
+#include "draco/core/thread_pool.h"
 #include "draco/io/tiny_gltf_utils.h"
+#include "draco/mesh/indexed_mesh_builder.h"
 #include "draco/mesh/mesh.h"
 #include "draco/mesh/triangle_soup_mesh_builder.h"
 #include "draco/point_cloud/point_cloud_builder.h"
@@ -78,11 +80,54 @@ class GltfDecoder {
   // deduplication with |SetDeduplicateVertices(false)|.
   //
   // Note that at this moment, disabling deduplication works ONLY for point
-  // clouds.
+  // clouds and for meshes decoded in the indexed mode.
   void SetDeduplicateVertices(bool deduplicate_vertices) {
     deduplicate_vertices_ = deduplicate_vertices;
   }
 
+  // By default, triangles of scene meshes are first expanded into a triangle
+  // soup with separate points for each face corner that are deduplicated
+  // afterwards. In the indexed mode, the meshes reuse the vertices and the
+  // index buffers of the glTF primitives, which lowers peak memory usage and
+  // decoding time of large indexed meshes. Vertices not referenced by any face
+  // are removed. Currently used only by DecodeFromFileToScene() and
+  // DecodeFromBufferToScene().
+  void SetIndexedMeshes(bool indexed_meshes) {
+    indexed_meshes_ = indexed_meshes;
+  }
+
+  // Sets an optional thread pool used to decode the KHR_draco_mesh_compression
+  // payloads of all primitives in parallel before the mesh or the scene is
+  // built. The pool is not owned and must outlive the decoding.
+  void SetThreadPool(ThreadPool *thread_pool) { thread_pool_ = thread_pool; }
+
+  // By default, all images referenced by the glTF are loaded and stored in the
+  // texture library of the decoded geometry. When only the geometry is needed,
+  // |SetSkipTextures(true)| avoids reading and decoding of the images. External
+  // image files are not read at all and the decoded materials contain no
+  // texture maps.
+  void SetSkipTextures(bool skip_textures) { skip_textures_ = skip_textures; }
+
+  // By default, the glTF JSON is parsed by TinyGLTF, which builds a complete
+  // JSON document tree before filling the glTF model. With
+  // |SetFastJsonParsing(true)|, assets that use only the core glTF schema are
+  // parsed directly into the glTF model (see GltfJsonParser), which lowers the
+  // loading time and memory usage of assets with many accessors, nodes or
+  // animations. Assets using extensions, extras or other unsupported features
+  // are still parsed by TinyGLTF.
+  void SetFastJsonParsing(bool fast_json_parsing) {
+    fast_json_parsing_ = fast_json_parsing;
+  }
+
+  // When set, meshes of the decoded scene that were built from primitives
+  // compressed with KHR_draco_mesh_compression keep the compressed data and
+  // its properties (see Mesh::DracoPayload), so that GltfEncoder can write the
+  // data again without compressing the meshes. Off by default, as the data
+  // stays in memory with the scene.
+  void SetKeepDracoPayloads(bool keep_draco_payloads) {
+    keep_draco_payloads_ = keep_draco_payloads;
+  }
+
  private:
   // Loads |file_name| into |gltf_model_|. Fills |input_files| with paths to all
   // input files when non-null.
@@ -92,6 +137,34 @@ class GltfDecoder {
   // Loads |gltf_model_| from |buffer| in GLB format.
   Status LoadBuffer(const DecoderBuffer &buffer);
 
+  // Decodes all primitives compressed with KHR_draco_mesh_compression and
+  // replaces the data of their accessors in |gltf_model_| with the decoded
+  // values.
+  Status DecodeDracoPrimitives();
+
+  // Draco compressed data of a KHR_draco_mesh_compression primitive and the
+  // properties of the encoded mesh, used when |keep_draco_payloads_| is set.
+  struct DracoPrimitivePayload {
+    std::shared_ptr<const std::vector<char>> data;
+    int64_t num_encoded_points = 0;
+    int64_t num_encoded_faces = 0;
+    // Number of quantization bits of the encoded attributes by unique id.
+    std::map<int, int> quantization_bits;
+    float position_range = 0.f;
+  };
+
+  // Returns the payload of |size| bytes at |data| that was decoded into
+  // |mesh|, or nullptr when the quantization of its attributes is unknown.
+  static std::shared_ptr<DracoPrimitivePayload> CreateDracoPrimitivePayload(
+      const char *data, size_t size, const Mesh &mesh);
+
+  // Returns the Draco payload of a scene mesh built from |primitive| with
+  // attributes |attribute_ids| by glTF attribute name, or nullptr when the
+  // primitive was not compressed or its payload cannot be reused.
+  std::unique_ptr<Mesh::DracoPayload> CreateMeshDracoPayload(
+      const tinygltf::Primitive &primitive, const Mesh &mesh,
+      const std::map<std::string, int> &attribute_ids) const;
+
   // Builds mesh from |gltf_model_|.
   StatusOr<std::unique_ptr<Mesh>> BuildMesh();
 
@@ -243,6 +316,11 @@ class GltfDecoder {
                            int att_id, int number_of_elements,
                            const std::vector<T> &data, bool reverse_winding,
                            PointCloudBuilder *builder);
+  template <typename T>
+  void SetValuesForBuilder(const std::vector<uint32_t> &indices_data,
+                           int att_id, int number_of_elements,
+                           const std::vector<T> &data, bool reverse_winding,
+                           IndexedMeshBuilder *builder);
 
   // Sets colors of for all vertices to white.
   template <typename BuilderT>
@@ -253,6 +331,8 @@ class GltfDecoder {
                                  TriangleSoupMeshBuilder *builder);
   template <typename ComponentT>
   void SetWhiteVertexColorOfType(int color_att_id, PointCloudBuilder *builder);
+  template <typename ComponentT>
+  void SetWhiteVertexColorOfType(int color_att_id, IndexedMeshBuilder *builder);
 
   // Sets values in |data| into the mesh builder |mb| for |att_id|.
   // |reverse_winding| if set will change the orientation of the data.
@@ -577,6 +657,29 @@ class GltfDecoder {
   // Whether vertices should be deduplicated after loading.
   bool deduplicate_vertices_ = true;
 
+  // Whether scene meshes are built directly from indexed glTF geometry.
+  bool indexed_meshes_ = false;
+
+  // Optional thread pool used for decoding of Draco compressed primitives.
+  ThreadPool *thread_pool_ = nullptr;
+
+  // Whether images and textures should be ignored during loading.
+  bool skip_textures_ = false;
+
+  // Whether GltfJsonParser is tried before TinyGLTF.
+  bool fast_json_parsing_ = false;
+
+  // Whether scene meshes keep the Draco compressed data they were built from.
+  bool keep_draco_payloads_ = false;
+
+  std::map<const tinygltf::Primitive *, std::shared_ptr<DracoPrimitivePayload>>
+      draco_primitive_payloads_;
+
+  // Payloads of scene meshes, assigned to the meshes once the scene is
+  // complete.
+  std::vector<std::pair<MeshIndex, std::unique_ptr<Mesh::DracoPayload>>>
+      scene_mesh_payloads_;
+
   // Functionality for deduping primitives on decode.
   struct PrimitiveSignature {
     const tinygltf::Primitive &primitive;
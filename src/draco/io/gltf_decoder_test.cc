@@ -32,6 +32,8 @@
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
 #include "draco/core/draco_types.h"
+#include "draco/core/thread_pool.h"
+#include "draco/io/file_utils.h"
 #include "draco/io/gltf_test_helper.h"
 #include "draco/io/texture_io.h"
 #include "draco/mesh/mesh_are_equivalent.h"
@@ -815,6 +817,80 @@ TEST(GltfDecoderTest, GltfTextureSource) {
   EXPECT_EQ(source_image.mime_type(), "");
 }
 
+TEST(GltfDecoderTest, SkipTextures) {
+  // Tests that geometry is decoded without any textures when the textures are
+  // skipped, both for embedded and for external images.
+  for (const std::string file_name :
+       {"KhronosSampleModels/Duck/glTF_Binary/Duck.glb",
+        "KhronosSampleModels/Duck/glTF/Duck.gltf"}) {
+    const std::string path = GetTestFileFullPath(file_name);
+    GltfDecoder decoder;
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Scene> scene,
+                           decoder.DecodeFromFileToScene(path));
+    GltfDecoder geometry_decoder;
+    geometry_decoder.SetSkipTextures(true);
+    std::vector<std::string> scene_files;
+    DRACO_ASSIGN_OR_ASSERT(
+        std::unique_ptr<Scene> geometry_scene,
+        geometry_decoder.DecodeFromFileToScene(path, &scene_files));
+    ASSERT_EQ(scene->NumMeshes(), geometry_scene->NumMeshes());
+    EXPECT_EQ(geometry_scene->GetMesh(MeshIndex(0)).num_faces(),
+              scene->GetMesh(MeshIndex(0)).num_faces());
+    EXPECT_EQ(geometry_scene->GetMaterialLibrary().NumMaterials(), 1);
+    EXPECT_EQ(
+        geometry_scene->GetMaterialLibrary().GetMaterial(0)->NumTextureMaps(),
+        0);
+    EXPECT_EQ(
+        geometry_scene->GetMaterialLibrary().GetTextureLibrary().NumTextures(),
+        0);
+    for (const std::string &scene_file : scene_files) {
+      EXPECT_NE(LowercaseFileExtension(scene_file), "png") << scene_file;
+    }
+  }
+}
+
+TEST(GltfDecoderTest, FastJsonParsing) {
+  // Tests that scenes decoded with the fast JSON parser match the scenes
+  // decoded with TinyGLTF. Textures are skipped so that the fast parser is
+  // used also for the assets with images.
+  for (const std::string file_name :
+       {"Box/glTF/Box.gltf", "Box/glTF_Binary/Box.glb",
+        "CesiumMan/glTF_Binary/CesiumMan.glb", "Fox/glTF/Fox.gltf",
+        "KhronosSampleModels/AnimatedMorphCube/glTF/AnimatedMorphCube.gltf",
+        "BoxMeta/glTF/BoxMeta.gltf"}) {
+    const std::string path = GetTestFileFullPath(file_name);
+    GltfDecoder decoder;
+    decoder.SetSkipTextures(true);
+    std::vector<std::string> scene_files;
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Scene> scene,
+                           decoder.DecodeFromFileToScene(path, &scene_files));
+    GltfDecoder fast_decoder;
+    fast_decoder.SetSkipTextures(true);
+    fast_decoder.SetFastJsonParsing(true);
+    std::vector<std::string> fast_scene_files;
+    DRACO_ASSIGN_OR_ASSERT(
+        std::unique_ptr<Scene> fast_scene,
+        fast_decoder.DecodeFromFileToScene(path, &fast_scene_files));
+    EXPECT_EQ(scene_files, fast_scene_files) << file_name;
+    ASSERT_EQ(scene->NumMeshes(), fast_scene->NumMeshes()) << file_name;
+    for (MeshIndex i(0); i < scene->NumMeshes(); ++i) {
+      EXPECT_EQ(scene->GetMesh(i).num_faces(),
+                fast_scene->GetMesh(i).num_faces());
+      EXPECT_EQ(scene->GetMesh(i).num_points(),
+                fast_scene->GetMesh(i).num_points());
+      EXPECT_EQ(scene->GetMesh(i).num_attributes(),
+                fast_scene->GetMesh(i).num_attributes());
+    }
+    EXPECT_EQ(scene->NumMeshGroups(), fast_scene->NumMeshGroups());
+    EXPECT_EQ(scene->NumNodes(), fast_scene->NumNodes());
+    EXPECT_EQ(scene->NumRootNodes(), fast_scene->NumRootNodes());
+    EXPECT_EQ(scene->GetMaterialLibrary().NumMaterials(),
+              fast_scene->GetMaterialLibrary().NumMaterials());
+    EXPECT_EQ(scene->NumAnimations(), fast_scene->NumAnimations());
+    EXPECT_EQ(scene->NumSkins(), fast_scene->NumSkins());
+  }
+}
+
 TEST(GltfDecoderTest, GltfDecodeWithDraco) {
   // Tests that we can decode a glTF containing Draco compressed geometry.
   const std::string file_name = "Box/glTF_Binary/Box.glb";
@@ -838,6 +914,52 @@ TEST(GltfDecoderTest, GltfDecodeWithDraco) {
             scene_draco->GetMesh(draco::MeshIndex(0)).num_faces());
 }
 
+TEST(GltfDecoderTest, GltfDecodeWithDracoOnThreadPool) {
+  // Tests that Draco compressed primitives decoded on a thread pool result in
+  // the same meshes as the serial decoding.
+  const std::string path =
+      GetTestFileFullPath("BoxMetaDraco/glTF/BoxMetaDraco.gltf");
+  GltfDecoder decoder;
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Scene> scene,
+                         decoder.DecodeFromFileToScene(path));
+  ThreadPool thread_pool(4);
+  GltfDecoder parallel_decoder;
+  parallel_decoder.SetThreadPool(&thread_pool);
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Scene> parallel_scene,
+                         parallel_decoder.DecodeFromFileToScene(path));
+  ASSERT_EQ(scene->NumMeshes(), parallel_scene->NumMeshes());
+  MeshAreEquivalent eq;
+  for (MeshIndex i(0); i < scene->NumMeshes(); ++i) {
+    ASSERT_TRUE(eq(scene->GetMesh(i), parallel_scene->GetMesh(i)));
+  }
+}
+
+TEST(GltfDecoderTest, DecodeIndexedMeshes) {
+  // Tests that scene meshes decoded in the indexed mode are equivalent to the
+  // meshes decoded from triangle soups.
+  for (const std::string file_name :
+       {"Box/glTF/Box.gltf", "Lantern/glTF/Lantern.gltf",
+        "CesiumMan/glTF/CesiumMan.gltf"}) {
+    const std::string path = GetTestFileFullPath(file_name);
+    GltfDecoder decoder;
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Scene> scene,
+                           decoder.DecodeFromFileToScene(path));
+    GltfDecoder indexed_decoder;
+    indexed_decoder.SetIndexedMeshes(true);
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Scene> indexed_scene,
+                           indexed_decoder.DecodeFromFileToScene(path));
+    ASSERT_EQ(scene->NumMeshes(), indexed_scene->NumMeshes());
+    MeshAreEquivalent eq;
+    for (MeshIndex i(0); i < scene->NumMeshes(); ++i) {
+      const Mesh &mesh = scene->GetMesh(i);
+      const Mesh &indexed_mesh = indexed_scene->GetMesh(i);
+      ASSERT_EQ(mesh.num_faces(), indexed_mesh.num_faces());
+      ASSERT_EQ(mesh.num_points(), indexed_mesh.num_points());
+      ASSERT_TRUE(eq(mesh, indexed_mesh)) << file_name;
+    }
+  }
+}
+
 TEST(GltfDecoderTest, TestAnimationNames) {
   const std::string file_name = "InterpolationTest/glTF/InterpolationTest.gltf";
   const std::unique_ptr<Scene> scene(DecodeGltfFileToScene(file_name));
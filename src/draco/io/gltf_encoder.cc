@@ -20,27 +20,34 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <set>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "draco/attributes/attribute_quantization_transform.h"
 #include "draco/attributes/geometry_attribute.h"
 #include "draco/attributes/point_attribute.h"
 #include "draco/compression/draco_compression_options.h"
 #include "draco/compression/expert_encode.h"
 #include "draco/core/draco_types.h"
+#include "draco/core/thread_pool.h"
 #include "draco/core/vector_d.h"
+#include "draco/io/draco_mesh_cache.h"
 #include "draco/io/file_utils.h"
 #include "draco/io/file_writer_utils.h"
 #include "draco/io/gltf_utils.h"
+#include "draco/io/meshopt_codec.h"
 #include "draco/io/texture_io.h"
 #include "draco/mesh/mesh_features.h"
 #include "draco/mesh/mesh_splitter.h"
@@ -103,6 +110,104 @@ bool IsFeatureIdAttribute(int att_index, const Mesh &mesh) {
   return false;
 }
 
+// Returns true when the Draco data that |mesh| was decoded from can be written
+// instead of compressing |mesh| with |options| and |transform|. The mesh must
+// not have been changed since it was decoded and none of its attributes may be
+// quantized more coarsely than requested. The compression level is ignored as
+// it does not affect the decoded values.
+bool CanReuseDracoPayload(const Mesh &mesh,
+                          const DracoCompressionOptions &options,
+                          const Eigen::Matrix4d &transform) {
+  const Mesh::DracoPayload *const payload = mesh.GetDracoPayload();
+  if (payload == nullptr ||
+      static_cast<int>(payload->quantization_bits.size()) !=
+          mesh.num_attributes()) {
+    return false;
+  }
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    const int encoded_bits = payload->quantization_bits[i];
+    if (encoded_bits == 0) {
+      // The values are not quantized.
+      continue;
+    }
+    const GeometryAttribute::Type type = mesh.attribute(i)->attribute_type();
+    if (type == GeometryAttribute::POSITION &&
+        !options.quantization_position.AreQuantizationBitsDefined()) {
+      // Compare the grid spacing in the local coordinate system of the mesh,
+      // see GltfAsset::EncodeMeshWithDraco().
+      const Vector3f scale_vec(transform.col(0).norm(), transform.col(1).norm(),
+                               transform.col(2).norm());
+      const float local_spacing =
+          options.quantization_position.spacing() / scale_vec.MaxCoeff();
+      const float encoded_spacing =
+          payload->position_range / ((1 << encoded_bits) - 1);
+      if (encoded_spacing > local_spacing) {
+        return false;
+      }
+      continue;
+    }
+    int requested_bits = 0;
+    switch (type) {
+      case GeometryAttribute::POSITION:
+        requested_bits = options.quantization_position.quantization_bits();
+        break;
+      case GeometryAttribute::NORMAL:
+        requested_bits = options.quantization_bits_normal;
+        break;
+      case GeometryAttribute::TEX_COORD:
+        requested_bits = options.quantization_bits_tex_coord;
+        break;
+      case GeometryAttribute::TANGENT:
+        requested_bits = options.quantization_bits_tangent;
+        break;
+      case GeometryAttribute::WEIGHTS:
+        requested_bits = options.quantization_bits_weight;
+        break;
+      case GeometryAttribute::GENERIC:
+        if (!IsFeatureIdAttribute(i, mesh)) {
+          requested_bits = options.quantization_bits_generic;
+        }
+        break;
+      default:
+        break;
+    }
+    // Attributes requested without quantization or with more quantization
+    // bits than encoded must be compressed again.
+    if (requested_bits <= 0 || requested_bits > encoded_bits) {
+      return false;
+    }
+  }
+  return DracoMeshCache::ComputeKey(mesh, "") == payload->mesh_key;
+}
+
+// Returns a string that describes all fields of |options|. It is used as a part
+// of the keys of cached Draco encoded meshes.
+std::string DracoCompressionOptionsToString(
+    const DracoCompressionOptions &options) {
+  std::ostringstream stream;
+  stream << "level=" << options.compression_level << ";";
+  if (options.quantization_position.AreQuantizationBitsDefined()) {
+    stream << "position="
+           << options.quantization_position.quantization_bits() << ";";
+  } else {
+    // Hexadecimal notation preserves the exact grid spacing.
+    stream << "spacing=" << std::hexfloat
+           << options.quantization_position.spacing() << std::defaultfloat
+           << ";";
+  }
+  stream << "normal=" << options.quantization_bits_normal << ";"
+         << "tex_coord=" << options.quantization_bits_tex_coord << ";"
+         << "color=" << options.quantization_bits_color << ";"
+         << "generic=" << options.quantization_bits_generic << ";"
+         << "tangent=" << options.quantization_bits_tangent << ";"
+         << "weight=" << options.quantization_bits_weight << ";"
+         << "non_degenerate_tex_coord="
+         << options.find_non_degenerate_texture_quantization << ";"
+         << "unified_position=" << options.unified_position_quantization
+         << ";";
+  return stream.str();
+}
+
 // Returns a boolean indicating whether |mesh| attribute at |att_index| is a
 // property attribute referred to by the |mesh| and its |structural_metadata|.
 bool IsPropertyAttribute(int att_index, const Mesh &mesh,
@@ -227,7 +332,21 @@ struct GltfAccessor {
 struct GltfBufferView {
   int64_t buffer_byte_offset = -1;
   int64_t byte_length = 0;
+  int byte_stride = 0;
   int target = 0;
+
+  // Properties of the EXT_meshopt_compression extension of the view, used
+  // when |mode| is not empty. The compressed data is stored in the main buffer
+  // and the offset and length above then refer to the fallback buffer.
+  struct MeshoptCompression {
+    std::string mode;
+    MeshoptCodec::Filter filter = MeshoptCodec::FILTER_NONE;
+    int64_t byte_offset = -1;
+    int64_t byte_length = 0;
+    int byte_stride = 0;
+    int64_t count = 0;
+  };
+  MeshoptCompression meshopt;
 };
 
 // Struct to hold information about a Draco compressed mesh.
@@ -259,6 +378,24 @@ struct GltfMesh {
   std::vector<GltfPrimitive> primitives;
 };
 
+// Data of the previous save of a scene that is reused by the next incremental
+// save, see GltfEncoder::set_incremental_save().
+class GltfIncrementalSaveState {
+ public:
+  // Draco compressed data of a base mesh and the settings it was encoded with.
+  struct EncodedMesh {
+    std::string settings;
+    DracoMeshCache::Entry data;
+    std::map<std::string, int> attribute_ids;
+  };
+
+  // Encoded meshes by mesh revision, see Scene::GetMeshRevision().
+  std::unordered_map<uint64_t, EncodedMesh> meshes;
+
+  // Revisions of the textures written to image files by file name.
+  std::unordered_map<std::string, uint64_t> image_revisions;
+};
+
 // Class to hold and output glTF data.
 class GltfAsset {
  public:
@@ -286,6 +423,7 @@ class GltfAsset {
   std::string buffer_name() const { return buffer_name_; }
   void buffer_name(const std::string &name) { buffer_name_ = name; }
   const EncoderBuffer *Buffer() const { return &buffer_; }
+  EncoderBuffer *MutableBuffer() { return &buffer_; }
 
   // Convert a Draco Mesh to glTF data.
   bool AddDracoMesh(const Mesh &mesh);
@@ -309,6 +447,20 @@ class GltfAsset {
   void set_output_type(GltfEncoder::OutputType type) { output_type_ = type; }
   GltfEncoder::OutputType output_type() const { return output_type_; }
   void set_json_output_mode(JsonWriter::Mode mode) { gltf_json_.SetMode(mode); }
+  void set_thread_pool(ThreadPool *thread_pool) { thread_pool_ = thread_pool; }
+  void set_draco_mesh_cache(const DracoMeshCache *cache) {
+    draco_mesh_cache_ = cache;
+  }
+  void set_reuse_draco_payloads(bool flag) { reuse_draco_payloads_ = flag; }
+  void set_compression_codec(GltfEncoder::CompressionCodec codec) {
+    compression_codec_ = codec;
+  }
+  void set_meshopt_max_size_ratio(float ratio) {
+    meshopt_max_size_ratio_ = ratio;
+  }
+  void set_incremental_save_state(GltfIncrementalSaveState *state) {
+    incremental_save_state_ = state;
+  }
 
  private:
   // Pad |buffer_| to 4 byte boundary.
@@ -322,6 +474,61 @@ class GltfAsset {
       const Mesh &mesh, GeometryAttribute::Type type, int index,
       const std::string &name, GltfDracoCompressedMesh *compressed_mesh_info);
 
+  // Draco compressed data of a single mesh.
+  struct DracoEncodedMesh {
+    DracoEncodedMesh() : num_encoded_points(0), num_encoded_faces(0) {}
+    EncoderBuffer buffer;
+    int64_t num_encoded_points;
+    int64_t num_encoded_faces;
+    // Unique ids of the encoded attributes by glTF attribute name when the
+    // data was taken from the Draco payload of the mesh. Empty otherwise, the
+    // ids are then the unique ids of the mesh attributes.
+    std::map<std::string, int> attribute_ids;
+  };
+
+  // Encodes |mesh| using Draco into |encoded_mesh|. The function does not
+  // modify the asset so it can be called concurrently for different meshes.
+  // When |cache| is not null, previously encoded data of the same mesh and
+  // settings is taken from |cache| and new results are stored in it. When
+  // |reuse_draco_payload| is set, the Draco data the mesh was decoded from is
+  // used if it satisfies the compression options of the mesh. When
+  // |position_quantization| is not null, the positions are quantized with its
+  // parameters instead of the position quantization options of the mesh.
+  static Status EncodeMeshWithDraco(
+      const Mesh &mesh, const Eigen::Matrix4d &transform,
+      const AttributeQuantizationTransform *position_quantization,
+      const DracoMeshCache *cache, bool reuse_draco_payload,
+      DracoEncodedMesh *encoded_mesh);
+
+  // Returns the Draco compressed meshes referenced by the nodes of |scene| in
+  // the order in which they are added to the asset. Each base mesh is listed
+  // only once.
+  std::vector<MeshIndex> FindDracoCompressedMeshes(const Scene &scene) const;
+
+  // Encodes the Draco compressed meshes |mesh_indices| of |scene| on
+  // |thread_pool_| and stores the results in |draco_encoded_meshes_|. Meshes
+  // that did not change since the previous incremental save are taken from
+  // |incremental_save_state_|, which is then updated with the current meshes.
+  Status EncodeSceneMeshesWithDraco(const Scene &scene,
+                                    const std::vector<MeshIndex> &mesh_indices);
+
+  // Returns a string describing all settings other than the mesh content that
+  // affect the Draco compressed data of |mesh|.
+  std::string GetIncrementalSaveSettings(
+      const Mesh &mesh, const Eigen::Matrix4d &transform) const;
+
+  // Computes the shared position quantization of the Draco compressed meshes
+  // |mesh_indices| of |scene| that have unified position quantization
+  // enabled and stores it in |shared_position_quantizations_|. Meshes share
+  // the quantization when they have the same compression options and base
+  // mesh transform.
+  Status ComputeSharedPositionQuantizations(
+      const Scene &scene, const std::vector<MeshIndex> &mesh_indices);
+
+  // Returns the shared position quantization of |mesh| or nullptr.
+  const AttributeQuantizationTransform *GetSharedPositionQuantization(
+      const Mesh &mesh) const;
+
   // Compresses |mesh| using Draco. On success returns the buffer_view in
   // |primitive| and number of encoded points and faces.
   Status CompressMeshWithDraco(const Mesh &mesh,
@@ -330,6 +537,56 @@ class GltfAsset {
                                int64_t *num_encoded_points,
                                int64_t *num_encoded_faces);
 
+  // Returns true when |mesh| should be compressed with EXT_meshopt_compression
+  // instead of Draco according to |compression_codec_|. Draco data encoded to
+  // make the decision is kept in |draco_encoded_meshes_|.
+  StatusOr<bool> UseMeshoptForMesh(const Mesh &mesh,
+                                   const Eigen::Matrix4d &transform);
+
+  // Returns the size of the buffer views of |mesh| compressed with
+  // EXT_meshopt_compression. Attributes that are not written to glTF are
+  // included, so the size is an estimate.
+  static StatusOr<int64_t> EstimateMeshoptSize(const Mesh &mesh);
+
+  // Returns the number of bits of the EXPONENTIAL filter applied to the
+  // float values of |att| of |mesh| before meshopt compression, derived from
+  // the compression options of |mesh|. Returns 0 when the values are stored
+  // without filter.
+  static int GetMeshoptFilterBits(const Mesh &mesh, const PointAttribute &att);
+
+  // Encodes |count| elements of |element_size| bytes in |data| with the
+  // meshopt vertex codec into |out_buffer|. The elements are padded to a
+  // multiple of 4 bytes. When |filter_bits| is positive, the elements are
+  // float vectors that are encoded with the EXPONENTIAL filter first and the
+  // filtered values are stored back in |data|.
+  static Status EncodeMeshoptVertexData(uint8_t *data, int64_t count,
+                                        int element_size, int filter_bits,
+                                        EncoderBuffer *out_buffer);
+
+  // Adds a buffer view of vertex attribute data compressed with
+  // EXT_meshopt_compression. See EncodeMeshoptVertexData() for the
+  // parameters. Returns the index of the buffer view or -1 on error.
+  int AddMeshoptVertexBufferView(uint8_t *data, int64_t count,
+                                 int element_size, int filter_bits);
+
+  // Adds a buffer view of triangle |indices| compressed with
+  // EXT_meshopt_compression and stored with |component_size| bytes per index.
+  // Returns the index of the buffer view or -1 on error.
+  int AddMeshoptIndexBufferView(const std::vector<uint32_t> &indices,
+                                int component_size);
+
+  // Writes |compressed| data of |buffer_view| to |buffer_| and allocates
+  // |byte_length| bytes for the view in the fallback buffer. Returns the index
+  // of the added buffer view or -1 on error.
+  int AddMeshoptBufferView(const EncoderBuffer &compressed, int64_t byte_length,
+                           GltfBufferView *buffer_view);
+
+  // Returns true when the data of |mesh| is stored in Draco compressed form
+  // rather than in buffer views.
+  bool IsDracoCompressed(const Mesh &mesh) const {
+    return mesh.IsCompressionEnabled() && meshopt_mesh_ != &mesh;
+  }
+
   // Adds a Draco mesh associated with a material id and material variants.
   bool AddDracoMesh(const Mesh &mesh, int material_id,
                     const std::vector<MeshGroup::MaterialsVariantsMapping>
@@ -414,8 +671,9 @@ class GltfAsset {
                          std::unique_ptr<Texture> owned_texture,
                          int num_components);
 
-  // Saves an image with a given |image_index| into a buffer.
-  Status SaveImageToBuffer(int image_index);
+  // Saves the encoded data |buffer| of an image with a given |image_index|
+  // into the buffer of the asset.
+  Status SaveImageToBuffer(int image_index, const std::vector<uint8_t> &buffer);
 
   // Adds |sampler| to vector of samplers and returns the index. If |sampler| is
   // equal to default values then |sampler| is not added to the vector and
@@ -633,6 +891,15 @@ class GltfAsset {
   std::map<MeshIndex, std::pair<int, int>> mesh_index_to_gltf_mesh_primitive_;
   IndexTypeVector<MeshIndex, Eigen::Matrix4d> base_mesh_transforms_;
 
+  // Draco compressed meshes that were encoded before being added to the asset.
+  std::unordered_map<const Mesh *, DracoEncodedMesh> draco_encoded_meshes_;
+
+  // Position quantization shared by the meshes of a scene, see
+  // DracoCompressionOptions::unified_position_quantization.
+  std::unordered_map<const Mesh *,
+                     std::shared_ptr<const AttributeQuantizationTransform>>
+      shared_position_quantizations_;
+
   struct EncoderAnimation {
     std::string name;
     std::vector<std::unique_ptr<AnimationSampler>> samplers;
@@ -664,6 +931,10 @@ class GltfAsset {
   // Indicates whether Draco compression is used for any of the asset meshes.
   bool draco_compression_used_;
 
+  // Indicates whether the mesh positions are stored as quantized integers
+  // (KHR_mesh_quantization).
+  bool mesh_quantization_used_;
+
   // Indicates whether mesh features are used.
   bool mesh_features_used_;
 
@@ -683,6 +954,34 @@ class GltfAsset {
 
   std::vector<TextureSampler> texture_samplers_;
 
+  // Optional thread pool used for Draco compression of scene meshes.
+  ThreadPool *thread_pool_;
+
+  // Optional cache of Draco encoded meshes.
+  const DracoMeshCache *draco_mesh_cache_;
+
+  // Whether Draco payloads of decoded meshes are written when possible.
+  bool reuse_draco_payloads_;
+
+  // Codec of meshes with compression enabled and the size/decode-time
+  // tradeoff of GltfEncoder::AUTO.
+  GltfEncoder::CompressionCodec compression_codec_;
+  float meshopt_max_size_ratio_;
+
+  // Optional data of the previous save of the scene.
+  GltfIncrementalSaveState *incremental_save_state_;
+
+  // Mesh whose buffer views are being added with EXT_meshopt_compression, or
+  // nullptr.
+  const Mesh *meshopt_mesh_;
+
+  // Indicates whether EXT_meshopt_compression is used for any buffer view.
+  bool meshopt_compression_used_;
+
+  // Size of the fallback buffer referenced by the uncompressed properties of
+  // the meshopt compressed buffer views. The buffer has no data.
+  int64_t meshopt_fallback_buffer_size_;
+
   GltfEncoder::OutputType output_type_;
 
   // Temporary storage for meshes created during the runtime of the GltfEncoder.
@@ -721,10 +1020,20 @@ GltfAsset::GltfAsset()
       buffer_name_("buffer0.bin"),
       structural_metadata_(nullptr),
       draco_compression_used_(false),
+      mesh_quantization_used_(false),
       mesh_features_used_(false),
       structural_metadata_used_(false),
       mesh_features_texture_index_(0),
       add_images_to_buffer_(false),
+      thread_pool_(nullptr),
+      draco_mesh_cache_(nullptr),
+      reuse_draco_payloads_(false),
+      compression_codec_(GltfEncoder::DRACO),
+      meshopt_max_size_ratio_(1.5f),
+      incremental_save_state_(nullptr),
+      meshopt_mesh_(nullptr),
+      meshopt_compression_used_(false),
+      meshopt_fallback_buffer_size_(0),
       output_type_(GltfEncoder::COMPACT) {}
 
 bool GltfAsset::AddDracoMesh(const Mesh &mesh) {
@@ -734,6 +1043,20 @@ bool GltfAsset::AddDracoMesh(const Mesh &mesh) {
   }
   AddMaterials(mesh);
 
+  // Positions that were decoded as quantized integers (see
+  // Decoder::SetDecodeToQuantizedAttribute()) are written as they are and the
+  // dequantization is applied by the mesh node.
+  AttributeQuantizationTransform position_transform;
+  const PointAttribute *const pos_att =
+      mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+  mesh_quantization_used_ = pos_att != nullptr &&
+                            pos_att->data_type() != DT_FLOAT32 &&
+                            position_transform.InitFromAttribute(*pos_att);
+  if (mesh_quantization_used_ && mesh.IsCompressionEnabled()) {
+    // Draco compression of glTF meshes requires floating point positions.
+    return false;
+  }
+
   GltfMesh gltf_mesh;
   meshes_.push_back(gltf_mesh);
 
@@ -753,6 +1076,7 @@ bool GltfAsset::AddDracoMesh(const Mesh &mesh) {
 
     // Split mesh using the material attribute.
     MeshSplitter splitter;
+    splitter.SetThreadPool(thread_pool_);
     auto split_maybe = splitter.SplitMesh(mesh, material_att_id);
     if (!split_maybe.ok()) {
       return false;
@@ -790,6 +1114,14 @@ bool GltfAsset::AddDracoMesh(const Mesh &mesh) {
   // Currently output only one mesh.
   GltfNode mesh_node;
   mesh_node.mesh_index = 0;
+  if (mesh_quantization_used_) {
+    const double scale = position_transform.ComputeDequantizationScale();
+    mesh_node.trs_matrix
+        .SetTranslation(Eigen::Vector3d(position_transform.min_value(0),
+                                        position_transform.min_value(1),
+                                        position_transform.min_value(2)))
+        .SetScale(Eigen::Vector3d(scale, scale, scale));
+  }
   nodes_.push_back(mesh_node);
   nodes_.back().root_node = true;
   return true;
@@ -868,7 +1200,7 @@ bool GltfAsset::PadBuffer() {
 void GltfAsset::AddAttributeToDracoExtension(
     const Mesh &mesh, GeometryAttribute::Type type, int index,
     const std::string &name, GltfDracoCompressedMesh *compressed_mesh_info) {
-  if (mesh.IsCompressionEnabled()) {
+  if (IsDracoCompressed(mesh)) {
     const PointAttribute *const att = mesh.GetNamedAttribute(type, index);
     if (att) {
       compressed_mesh_info->attributes.insert(
@@ -877,15 +1209,30 @@ void GltfAsset::AddAttributeToDracoExtension(
   }
 }
 
-Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
-                                        const Eigen::Matrix4d &transform,
-                                        GltfPrimitive *primitive,
-                                        int64_t *num_encoded_points,
-                                        int64_t *num_encoded_faces) {
+Status GltfAsset::EncodeMeshWithDraco(
+    const Mesh &mesh, const Eigen::Matrix4d &transform,
+    const AttributeQuantizationTransform *position_quantization,
+    const DracoMeshCache *cache, bool reuse_draco_payload,
+    DracoEncodedMesh *encoded_mesh) {
   // Check that geometry comression options are valid.
   DracoCompressionOptions compression_options = mesh.GetCompressionOptions();
   DRACO_RETURN_IF_ERROR(compression_options.Check());
 
+  // Payloads are quantized with their own parameters, so they can't be used
+  // with a shared position quantization.
+  if (reuse_draco_payload && position_quantization == nullptr &&
+      CanReuseDracoPayload(mesh, compression_options, transform)) {
+    const Mesh::DracoPayload &payload = *mesh.GetDracoPayload();
+    if (!encoded_mesh->buffer.Encode(payload.data->data(),
+                                     payload.data->size())) {
+      return Status(Status::DRACO_ERROR, "Could not copy Draco payload.");
+    }
+    encoded_mesh->num_encoded_points = payload.num_encoded_points;
+    encoded_mesh->num_encoded_faces = payload.num_encoded_faces;
+    encoded_mesh->attribute_ids = payload.attribute_ids;
+    return OkStatus();
+  }
+
   // Make a copy of the mesh. It will be modified and compressed.
   std::unique_ptr<Mesh> mesh_copy(new Mesh());
   mesh_copy->Copy(mesh);
@@ -905,7 +1252,6 @@ Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
   }
 
   // Create Draco encoder.
-  EncoderBuffer buffer;
   std::unique_ptr<ExpertEncoder> encoder;
   if (mesh_copy->num_faces() > 0) {
     // Encode mesh.
@@ -920,12 +1266,32 @@ Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
   const int speed = 10 - compression_options.compression_level;
   encoder->SetSpeedOptions(speed, speed);
 
+  // Encoder settings that are not covered by |compression_options|.
+  std::ostringstream settings;
+  settings << "speed=" << speed << ";";
+
   // Configure attribute quantization.
   for (int i = 0; i < mesh_copy->num_attributes(); ++i) {
     const PointAttribute *const att = mesh_copy->attribute(i);
     if (att->attribute_type() == GeometryAttribute::POSITION &&
-        !compression_options.quantization_position
-             .AreQuantizationBitsDefined()) {
+        position_quantization != nullptr) {
+      // Use the quantization shared by the meshes of the scene.
+      const std::vector<float> &min_values =
+          position_quantization->min_values();
+      encoder->SetAttributeExplicitQuantization(
+          i, position_quantization->quantization_bits(),
+          static_cast<int>(min_values.size()), min_values.data(),
+          position_quantization->range());
+      settings << "attribute" << i << "="
+               << position_quantization->quantization_bits() << std::hexfloat;
+      for (const float min_value : min_values) {
+        settings << "," << min_value;
+      }
+      settings << "," << position_quantization->range() << std::defaultfloat
+               << ";";
+    } else if (att->attribute_type() == GeometryAttribute::POSITION &&
+               !compression_options.quantization_position
+                    .AreQuantizationBitsDefined()) {
       // Desired spacing in the "global" coordinate system.
       const float global_spacing =
           compression_options.quantization_position.spacing();
@@ -976,6 +1342,7 @@ Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
           } else {
             // Quantization is explicitly disabled for feature ID attributes.
             encoder->SetAttributeQuantization(i, -1);
+            settings << "attribute" << i << "=-1;";
           }
           break;
         default:
@@ -983,6 +1350,7 @@ Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
       }
       if (num_quantization_bits > 0) {
         encoder->SetAttributeQuantization(i, num_quantization_bits);
+        settings << "attribute" << i << "=" << num_quantization_bits << ";";
       }
     }
   }
@@ -1013,13 +1381,253 @@ Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
   // |compression_options| may have been modified and we need to update them
   // before we start the encoding.
   mesh_copy->SetCompressionOptions(compression_options);
-  DRACO_RETURN_IF_ERROR(encoder->EncodeToBuffer(&buffer));
-  *num_encoded_points = encoder->num_encoded_points();
+
+  // The key is computed from the modified mesh, which is exactly the input of
+  // the encoder.
+  std::string cache_key;
+  if (cache != nullptr) {
+    settings << DracoCompressionOptionsToString(compression_options);
+    cache_key = DracoMeshCache::ComputeKey(*mesh_copy, settings.str());
+    DracoMeshCache::Entry entry;
+    if (cache->Lookup(cache_key, &entry)) {
+      std::swap(encoded_mesh->buffer, entry.buffer);
+      encoded_mesh->num_encoded_points = entry.num_encoded_points;
+      encoded_mesh->num_encoded_faces = entry.num_encoded_faces;
+      return OkStatus();
+    }
+  }
+
+  DRACO_RETURN_IF_ERROR(encoder->EncodeToBuffer(&encoded_mesh->buffer));
+  encoded_mesh->num_encoded_points = encoder->num_encoded_points();
   if (mesh_copy->num_faces() > 0) {
-    *num_encoded_faces = encoder->num_encoded_faces();
+    encoded_mesh->num_encoded_faces = encoder->num_encoded_faces();
   } else {
-    *num_encoded_faces = 0;
+    encoded_mesh->num_encoded_faces = 0;
+  }
+  if (cache != nullptr) {
+    DracoMeshCache::Entry entry;
+    std::swap(entry.buffer, encoded_mesh->buffer);
+    entry.num_encoded_points = encoded_mesh->num_encoded_points;
+    entry.num_encoded_faces = encoded_mesh->num_encoded_faces;
+    const Status status = cache->Store(cache_key, entry);
+    std::swap(entry.buffer, encoded_mesh->buffer);
+    DRACO_RETURN_IF_ERROR(status);
+  }
+  return OkStatus();
+}
+
+std::vector<MeshIndex> GltfAsset::FindDracoCompressedMeshes(
+    const Scene &scene) const {
+  std::vector<MeshIndex> mesh_indices;
+  std::unordered_set<int> visited_meshes;
+  for (SceneNodeIndex i(0); i < scene.NumNodes(); ++i) {
+    const MeshGroupIndex mesh_group_index =
+        scene.GetNode(i)->GetMeshGroupIndex();
+    if (mesh_group_index == kInvalidMeshGroupIndex) {
+      continue;
+    }
+    const MeshGroup *const mesh_group = scene.GetMeshGroup(mesh_group_index);
+    for (int j = 0; j < mesh_group->NumMeshInstances(); ++j) {
+      const MeshIndex mesh_index = mesh_group->GetMeshInstance(j).mesh_index;
+      const Mesh &mesh = scene.GetMesh(mesh_index);
+      if (mesh.num_faces() > 0 && mesh.IsCompressionEnabled() &&
+          visited_meshes.insert(mesh_index.value()).second) {
+        mesh_indices.push_back(mesh_index);
+      }
+    }
+  }
+  return mesh_indices;
+}
+
+Status GltfAsset::EncodeSceneMeshesWithDraco(
+    const Scene &scene, const std::vector<MeshIndex> &mesh_indices) {
+  const int num_meshes = static_cast<int>(mesh_indices.size());
+
+  // Take the meshes that did not change since the previous save from
+  // |incremental_save_state_|.
+  std::vector<DracoEncodedMesh> encoded_meshes(num_meshes);
+  std::vector<std::string> settings(num_meshes);
+  std::vector<int> meshes_to_encode;
+  for (int i = 0; i < num_meshes; ++i) {
+    if (incremental_save_state_ == nullptr) {
+      meshes_to_encode.push_back(i);
+      continue;
+    }
+    const MeshIndex mesh_index = mesh_indices[i];
+    settings[i] = GetIncrementalSaveSettings(
+        scene.GetMesh(mesh_index), base_mesh_transforms_[mesh_index]);
+    const auto it = incremental_save_state_->meshes.find(
+        scene.GetMeshRevision(mesh_index));
+    if (it == incremental_save_state_->meshes.end() ||
+        it->second.settings != settings[i]) {
+      meshes_to_encode.push_back(i);
+      continue;
+    }
+    const DracoMeshCache::Entry &data = it->second.data;
+    if (!encoded_meshes[i].buffer.Encode(data.buffer.data(),
+                                         data.buffer.size())) {
+      return Status(Status::DRACO_ERROR, "Could not copy Draco data.");
+    }
+    encoded_meshes[i].num_encoded_points = data.num_encoded_points;
+    encoded_meshes[i].num_encoded_faces = data.num_encoded_faces;
+    encoded_meshes[i].attribute_ids = it->second.attribute_ids;
+  }
+
+  // The meshes are encoded independently so the result does not depend on
+  // the order in which the tasks are executed.
+  std::vector<Status> statuses(meshes_to_encode.size());
+  ParallelFor(thread_pool_, static_cast<int>(meshes_to_encode.size()),
+              [&](int i) {
+                const int j = meshes_to_encode[i];
+                const Mesh &mesh = scene.GetMesh(mesh_indices[j]);
+                statuses[i] = EncodeMeshWithDraco(
+                    mesh, base_mesh_transforms_[mesh_indices[j]],
+                    GetSharedPositionQuantization(mesh), draco_mesh_cache_,
+                    reuse_draco_payloads_, &encoded_meshes[j]);
+              });
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status);
+  }
+
+  // Replace the state of the previous save, so that it only holds the meshes
+  // of the current save.
+  if (incremental_save_state_ != nullptr) {
+    incremental_save_state_->meshes.clear();
+    for (int i = 0; i < num_meshes; ++i) {
+      GltfIncrementalSaveState::EncodedMesh &state_mesh =
+          incremental_save_state_
+              ->meshes[scene.GetMeshRevision(mesh_indices[i])];
+      std::swap(state_mesh.settings, settings[i]);
+      state_mesh.data.buffer.Clear();
+      if (!state_mesh.data.buffer.Encode(encoded_meshes[i].buffer.data(),
+                                         encoded_meshes[i].buffer.size())) {
+        return Status(Status::DRACO_ERROR, "Could not copy Draco data.");
+      }
+      state_mesh.data.num_encoded_points = encoded_meshes[i].num_encoded_points;
+      state_mesh.data.num_encoded_faces = encoded_meshes[i].num_encoded_faces;
+      state_mesh.attribute_ids = encoded_meshes[i].attribute_ids;
+    }
+  }
+
+  for (int i = 0; i < num_meshes; ++i) {
+    std::swap(draco_encoded_meshes_[&scene.GetMesh(mesh_indices[i])],
+              encoded_meshes[i]);
+  }
+  return OkStatus();
+}
+
+std::string GltfAsset::GetIncrementalSaveSettings(
+    const Mesh &mesh, const Eigen::Matrix4d &transform) const {
+  std::ostringstream settings;
+  settings << DracoCompressionOptionsToString(mesh.GetCompressionOptions());
+  settings << "reuse_draco_payloads=" << reuse_draco_payloads_ << ";";
+  settings << "transform=";
+  settings.write(reinterpret_cast<const char *>(transform.data()),
+                 sizeof(double) * transform.size());
+  const AttributeQuantizationTransform *const position_quantization =
+      GetSharedPositionQuantization(mesh);
+  if (position_quantization != nullptr) {
+    settings << ";shared_position="
+             << position_quantization->quantization_bits() << std::hexfloat;
+    for (const float min_value : position_quantization->min_values()) {
+      settings << "," << min_value;
+    }
+    settings << "," << position_quantization->range() << std::defaultfloat;
+  }
+  return settings.str();
+}
+
+Status GltfAsset::ComputeSharedPositionQuantizations(
+    const Scene &scene, const std::vector<MeshIndex> &mesh_indices) {
+  shared_position_quantizations_.clear();
+
+  // Group the meshes by everything that affects their position quantization.
+  std::map<std::string, std::vector<MeshIndex>> groups;
+  for (const MeshIndex mesh_index : mesh_indices) {
+    const Mesh &mesh = scene.GetMesh(mesh_index);
+    const DracoCompressionOptions &options = mesh.GetCompressionOptions();
+    if (!options.unified_position_quantization ||
+        mesh.GetNamedAttribute(GeometryAttribute::POSITION) == nullptr) {
+      continue;
+    }
+    const Eigen::Matrix4d &transform = base_mesh_transforms_[mesh_index];
+    std::string key = DracoCompressionOptionsToString(options);
+    key.append(reinterpret_cast<const char *>(transform.data()),
+               sizeof(double) * transform.size());
+    groups[key].push_back(mesh_index);
+  }
+
+  for (const auto &group : groups) {
+    const MeshIndex first_mesh_index = group.second[0];
+    const DracoCompressionOptions &options =
+        scene.GetMesh(first_mesh_index).GetCompressionOptions();
+    DRACO_RETURN_IF_ERROR(options.Check());
+    std::vector<const PointAttribute *> attributes;
+    for (const MeshIndex mesh_index : group.second) {
+      attributes.push_back(scene.GetMesh(mesh_index).GetNamedAttribute(
+          GeometryAttribute::POSITION));
+    }
+    auto quantization = std::make_shared<AttributeQuantizationTransform>();
+    bool computed = false;
+    if (options.quantization_position.AreQuantizationBitsDefined()) {
+      computed = quantization->ComputeParameters(
+          attributes, options.quantization_position.quantization_bits(),
+          thread_pool_);
+    } else {
+      // Transform the global spacing to the local coordinate system of the
+      // meshes, see EncodeMeshWithDraco().
+      const Eigen::Matrix4d &transform =
+          base_mesh_transforms_[first_mesh_index];
+      const Vector3f scale_vec(transform.col(0).norm(), transform.col(1).norm(),
+                               transform.col(2).norm());
+      computed = quantization->ComputeGridParameters(
+          attributes,
+          options.quantization_position.spacing() / scale_vec.MaxCoeff(),
+          thread_pool_);
+    }
+    if (!computed) {
+      return Status(Status::DRACO_ERROR,
+                    "Could not compute shared position quantization.");
+    }
+    for (const MeshIndex mesh_index : group.second) {
+      shared_position_quantizations_[&scene.GetMesh(mesh_index)] =
+          quantization;
+    }
+  }
+  return OkStatus();
+}
+
+const AttributeQuantizationTransform *GltfAsset::GetSharedPositionQuantization(
+    const Mesh &mesh) const {
+  const auto it = shared_position_quantizations_.find(&mesh);
+  if (it == shared_position_quantizations_.end()) {
+    return nullptr;
   }
+  return it->second.get();
+}
+
+Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
+                                        const Eigen::Matrix4d &transform,
+                                        GltfPrimitive *primitive,
+                                        int64_t *num_encoded_points,
+                                        int64_t *num_encoded_faces) {
+  // Use the data encoded in advance if available.
+  DracoEncodedMesh encoded_mesh;
+  const auto it = draco_encoded_meshes_.find(&mesh);
+  if (it != draco_encoded_meshes_.end()) {
+    std::swap(encoded_mesh, it->second);
+    draco_encoded_meshes_.erase(it);
+  } else {
+    DRACO_RETURN_IF_ERROR(EncodeMeshWithDraco(
+        mesh, transform, GetSharedPositionQuantization(mesh), draco_mesh_cache_,
+        reuse_draco_payloads_, &encoded_mesh));
+  }
+  *num_encoded_points = encoded_mesh.num_encoded_points;
+  *num_encoded_faces = encoded_mesh.num_encoded_faces;
+  // The ids of reused payloads take precedence over the ids of the mesh
+  // attributes added by AddAttributeToDracoExtension().
+  primitive->compressed_mesh_info.attributes = encoded_mesh.attribute_ids;
+  const EncoderBuffer &buffer = encoded_mesh.buffer;
   const size_t buffer_start_offset = buffer_.size();
   if (!buffer_.Encode(buffer.data(), buffer.size())) {
     return Status(Status::DRACO_ERROR, "Could not copy Draco compressed data.");
@@ -1037,6 +1645,186 @@ Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
   return OkStatus();
 }
 
+StatusOr<bool> GltfAsset::UseMeshoptForMesh(
+    const Mesh &mesh, const Eigen::Matrix4d &transform) {
+  if (compression_codec_ == GltfEncoder::DRACO) {
+    return false;
+  }
+  if (compression_codec_ == GltfEncoder::MESHOPT) {
+    return true;
+  }
+  auto it = draco_encoded_meshes_.find(&mesh);
+  if (it == draco_encoded_meshes_.end()) {
+    DracoEncodedMesh encoded_mesh;
+    DRACO_RETURN_IF_ERROR(EncodeMeshWithDraco(
+        mesh, transform, GetSharedPositionQuantization(mesh), draco_mesh_cache_,
+        reuse_draco_payloads_, &encoded_mesh));
+    std::swap(draco_encoded_meshes_[&mesh], encoded_mesh);
+    it = draco_encoded_meshes_.find(&mesh);
+  }
+  DRACO_ASSIGN_OR_RETURN(const int64_t meshopt_size, EstimateMeshoptSize(mesh));
+  const bool use_meshopt =
+      meshopt_size <= meshopt_max_size_ratio_ * it->second.buffer.size();
+  if (use_meshopt) {
+    draco_encoded_meshes_.erase(it);
+  }
+  return use_meshopt;
+}
+
+StatusOr<int64_t> GltfAsset::EstimateMeshoptSize(const Mesh &mesh) {
+  EncoderBuffer buffer;
+  std::vector<uint32_t> indices;
+  indices.reserve(mesh.num_faces() * 3);
+  for (FaceIndex i(0); i < mesh.num_faces(); ++i) {
+    for (int j = 0; j < 3; ++j) {
+      indices.push_back(mesh.face(i)[j].value());
+    }
+  }
+  DRACO_RETURN_IF_ERROR(MeshoptCodec::EncodeIndexBuffer(
+      indices.data(), indices.size(), &buffer));
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    const PointAttribute &att = *mesh.attribute(i);
+    if (att.attribute_type() == GeometryAttribute::MATERIAL) {
+      continue;
+    }
+    const int element_size =
+        DataTypeLength(att.data_type()) * att.num_components();
+    if (element_size == 0 || element_size > 256) {
+      continue;
+    }
+    std::vector<uint8_t> data(mesh.num_points() * element_size);
+    for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+      memcpy(&data[pi.value() * element_size], att.GetAddressOfMappedIndex(pi),
+             element_size);
+    }
+    const int filter_bits =
+        att.data_type() == DT_FLOAT32 ? GetMeshoptFilterBits(mesh, att) : 0;
+    DRACO_RETURN_IF_ERROR(EncodeMeshoptVertexData(
+        data.data(), mesh.num_points(), element_size, filter_bits, &buffer));
+  }
+  return static_cast<int64_t>(buffer.size());
+}
+
+int GltfAsset::GetMeshoptFilterBits(const Mesh &mesh,
+                                    const PointAttribute &att) {
+  const DracoCompressionOptions &options = mesh.GetCompressionOptions();
+  int bits = 0;
+  switch (att.attribute_type()) {
+    case GeometryAttribute::POSITION:
+      // Positions snapped to a grid are stored without filter.
+      if (options.quantization_position.AreQuantizationBitsDefined()) {
+        bits = options.quantization_position.quantization_bits();
+      }
+      break;
+    case GeometryAttribute::NORMAL:
+      bits = options.quantization_bits_normal;
+      break;
+    case GeometryAttribute::TEX_COORD:
+      bits = options.quantization_bits_tex_coord;
+      break;
+    case GeometryAttribute::COLOR:
+      bits = options.quantization_bits_color;
+      break;
+    case GeometryAttribute::TANGENT:
+      bits = options.quantization_bits_tangent;
+      break;
+    case GeometryAttribute::WEIGHTS:
+      bits = options.quantization_bits_weight;
+      break;
+    default:
+      // Generic attributes may hold feature IDs that must be stored exactly.
+      break;
+  }
+  // The filter keeps at most 23 bits of precision, more bits are stored
+  // losslessly without filter.
+  return bits < 24 ? std::max(bits, 0) : 0;
+}
+
+Status GltfAsset::EncodeMeshoptVertexData(uint8_t *data, int64_t count,
+                                          int element_size, int filter_bits,
+                                          EncoderBuffer *out_buffer) {
+  if (filter_bits > 0) {
+    // The filter output has the size of the input, one 32-bit value per float
+    // component.
+    std::vector<uint32_t> filtered(count * element_size / 4);
+    MeshoptCodec::EncodeExponentialFilter(reinterpret_cast<const float *>(data),
+                                          count, element_size / 4,
+                                          filter_bits, filtered.data());
+    DRACO_RETURN_IF_ERROR(MeshoptCodec::EncodeVertexBuffer(
+        reinterpret_cast<const uint8_t *>(filtered.data()), count,
+        element_size, out_buffer));
+    MeshoptCodec::DecodeExponentialFilter(filtered.data(), filtered.size(),
+                                          reinterpret_cast<float *>(data));
+    return OkStatus();
+  }
+  // Elements of EXT_meshopt_compression views are aligned to 4 bytes.
+  const int byte_stride = (element_size + 3) & ~3;
+  if (byte_stride == element_size) {
+    return MeshoptCodec::EncodeVertexBuffer(data, count, byte_stride,
+                                            out_buffer);
+  }
+  std::vector<uint8_t> elements(count * byte_stride, 0);
+  for (int64_t i = 0; i < count; ++i) {
+    memcpy(&elements[i * byte_stride], data + i * element_size, element_size);
+  }
+  return MeshoptCodec::EncodeVertexBuffer(elements.data(), count, byte_stride,
+                                          out_buffer);
+}
+
+int GltfAsset::AddMeshoptVertexBufferView(uint8_t *data, int64_t count,
+                                          int element_size, int filter_bits) {
+  EncoderBuffer compressed;
+  if (!EncodeMeshoptVertexData(data, count, element_size, filter_bits,
+                               &compressed)
+           .ok()) {
+    return -1;
+  }
+  const int byte_stride = (element_size + 3) & ~3;
+  GltfBufferView buffer_view;
+  if (byte_stride != element_size) {
+    buffer_view.byte_stride = byte_stride;
+  }
+  buffer_view.meshopt.mode = "ATTRIBUTES";
+  if (filter_bits > 0) {
+    buffer_view.meshopt.filter = MeshoptCodec::FILTER_EXPONENTIAL;
+  }
+  buffer_view.meshopt.byte_stride = byte_stride;
+  buffer_view.meshopt.count = count;
+  return AddMeshoptBufferView(compressed, count * byte_stride, &buffer_view);
+}
+
+int GltfAsset::AddMeshoptIndexBufferView(const std::vector<uint32_t> &indices,
+                                         int component_size) {
+  EncoderBuffer compressed;
+  if (!MeshoptCodec::EncodeIndexBuffer(indices.data(), indices.size(),
+                                       &compressed)
+           .ok()) {
+    return -1;
+  }
+  GltfBufferView buffer_view;
+  buffer_view.meshopt.mode = "TRIANGLES";
+  buffer_view.meshopt.byte_stride = component_size;
+  buffer_view.meshopt.count = indices.size();
+  return AddMeshoptBufferView(compressed, indices.size() * component_size,
+                              &buffer_view);
+}
+
+int GltfAsset::AddMeshoptBufferView(const EncoderBuffer &compressed,
+                                    int64_t byte_length,
+                                    GltfBufferView *buffer_view) {
+  const size_t buffer_start_offset = buffer_.size();
+  if (!buffer_.Encode(compressed.data(), compressed.size()) || !PadBuffer()) {
+    return -1;
+  }
+  buffer_view->meshopt.byte_offset = buffer_start_offset;
+  buffer_view->meshopt.byte_length = compressed.size();
+  buffer_view->buffer_byte_offset = meshopt_fallback_buffer_size_;
+  buffer_view->byte_length = byte_length;
+  meshopt_fallback_buffer_size_ += (byte_length + 3) & ~int64_t{3};
+  buffer_views_.push_back(*buffer_view);
+  return static_cast<int>(buffer_views_.size() - 1);
+}
+
 bool CheckAndGetTexCoordAttributeOrder(const Mesh &mesh,
                                        std::vector<int> *tex_coord_order) {
   // We will only consider at most two texture coordinate attributes.
@@ -1093,12 +1881,21 @@ bool GltfAsset::AddDracoMesh(
   int64_t num_encoded_points = mesh.num_points();
   int64_t num_encoded_faces = mesh.num_faces();
   if (num_encoded_faces > 0 && mesh.IsCompressionEnabled()) {
-    const Status status = CompressMeshWithDraco(
-        mesh, transform, &primitive, &num_encoded_points, &num_encoded_faces);
-    if (!status.ok()) {
+    const StatusOr<bool> use_meshopt = UseMeshoptForMesh(mesh, transform);
+    if (!use_meshopt.ok()) {
       return false;
     }
-    draco_compression_used_ = true;
+    if (use_meshopt.value()) {
+      meshopt_mesh_ = &mesh;
+      meshopt_compression_used_ = true;
+    } else {
+      const Status status = CompressMeshWithDraco(
+          mesh, transform, &primitive, &num_encoded_points, &num_encoded_faces);
+      if (!status.ok()) {
+        return false;
+      }
+      draco_compression_used_ = true;
+    }
   }
   int indices_index = -1;
   if (num_encoded_faces > 0) {
@@ -1198,8 +1995,19 @@ bool GltfAsset::AddDracoMesh(
                                    &primitive.compressed_mesh_info);
     }
   }
+  // A reused Draco payload may contain attributes that were not written.
+  std::map<std::string, int> &draco_attributes =
+      primitive.compressed_mesh_info.attributes;
+  for (auto it = draco_attributes.begin(); it != draco_attributes.end();) {
+    if (primitive.attributes.count(it->first) == 0) {
+      it = draco_attributes.erase(it);
+    } else {
+      ++it;
+    }
+  }
 
   meshes_.back().primitives.push_back(primitive);
+  meshopt_mesh_ = nullptr;
   return true;
 }
 
@@ -1220,10 +2028,30 @@ int GltfAsset::AddDracoIndices(const Mesh &mesh, int64_t num_encoded_faces) {
     }
   }
 
-  const int component_size = GltfAsset::UnsignedIntComponentSize(max_index);
+  int component_size = GltfAsset::UnsignedIntComponentSize(max_index);
+  ComponentType component_type = UnsignedIntComponentType(max_index);
 
   GltfAccessor accessor;
-  if (!mesh.IsCompressionEnabled()) {
+  if (meshopt_mesh_ == &mesh) {
+    // EXT_meshopt_compression supports only 16-bit and 32-bit indices.
+    if (component_size == 1) {
+      component_size = 2;
+      component_type = UNSIGNED_SHORT;
+    }
+    std::vector<uint32_t> indices;
+    indices.reserve(mesh.num_faces() * 3);
+    for (FaceIndex i(0); i < mesh.num_faces(); ++i) {
+      const auto &f = mesh.face(i);
+      for (int j = 0; j < 3; ++j) {
+        indices.push_back(f[j].value());
+      }
+    }
+    accessor.buffer_view_index =
+        AddMeshoptIndexBufferView(indices, component_size);
+    if (accessor.buffer_view_index < 0) {
+      return -1;
+    }
+  } else if (!IsDracoCompressed(mesh)) {
     const size_t buffer_start_offset = buffer_.size();
     for (FaceIndex i(0); i < mesh.num_faces(); ++i) {
       const auto &f = mesh.face(i);
@@ -1246,7 +2074,7 @@ int GltfAsset::AddDracoIndices(const Mesh &mesh, int64_t num_encoded_faces) {
     accessor.buffer_view_index = static_cast<int>(buffer_views_.size() - 1);
   }
 
-  accessor.component_type = UnsignedIntComponentType(max_index);
+  accessor.component_type = component_type;
   accessor.count = num_encoded_faces * 3;
   if (output_type_ == GltfEncoder::VERBOSE) {
     accessor.max.push_back(GltfValue(max_index));
@@ -1260,11 +2088,22 @@ int GltfAsset::AddDracoIndices(const Mesh &mesh, int64_t num_encoded_faces) {
 int GltfAsset::AddDracoPositions(const Mesh &mesh, int num_encoded_points) {
   const PointAttribute *const att =
       mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (mesh_quantization_used_) {
+    if (!CheckDracoAttribute(att, {DT_UINT8, DT_UINT16}, {3})) {
+      return -1;
+    }
+    if (att->data_type() == DT_UINT8) {
+      return AddAttribute<uint8_t>(*att, mesh.num_points(), num_encoded_points,
+                                   IsDracoCompressed(mesh));
+    }
+    return AddAttribute<uint16_t>(*att, mesh.num_points(), num_encoded_points,
+                                  IsDracoCompressed(mesh));
+  }
   if (!CheckDracoAttribute(att, {DT_FLOAT32}, {3})) {
     return -1;
   }
   return AddAttribute<float>(*att, mesh.num_points(), num_encoded_points,
-                             mesh.IsCompressionEnabled());
+                             IsDracoCompressed(mesh));
 }
 
 int GltfAsset::AddDracoNormals(const Mesh &mesh, int num_encoded_points) {
@@ -1274,7 +2113,7 @@ int GltfAsset::AddDracoNormals(const Mesh &mesh, int num_encoded_points) {
     return -1;
   }
   return AddAttribute<float>(*att, mesh.num_points(), num_encoded_points,
-                             mesh.IsCompressionEnabled());
+                             IsDracoCompressed(mesh));
 }
 
 int GltfAsset::AddDracoColors(const Mesh &mesh, int num_encoded_points) {
@@ -1285,14 +2124,14 @@ int GltfAsset::AddDracoColors(const Mesh &mesh, int num_encoded_points) {
   }
   if (att->data_type() == DT_UINT16) {
     return AddAttribute<uint16_t>(*att, mesh.num_points(), num_encoded_points,
-                                  mesh.IsCompressionEnabled());
+                                  IsDracoCompressed(mesh));
   }
   if (att->data_type() == DT_FLOAT32) {
     return AddAttribute<float>(*att, mesh.num_points(), num_encoded_points,
-                               mesh.IsCompressionEnabled());
+                               IsDracoCompressed(mesh));
   }
   return AddAttribute<uint8_t>(*att, mesh.num_points(), num_encoded_points,
-                               mesh.IsCompressionEnabled());
+                               IsDracoCompressed(mesh));
 }
 
 int GltfAsset::AddDracoTexture(const Mesh &mesh, int tex_coord_index,
@@ -1324,7 +2163,7 @@ int GltfAsset::AddDracoTexture(const Mesh &mesh, int tex_coord_index,
     ta.SetAttributeValue(AttributeValueIndex(v.value()), texture_coord.data());
   }
   return AddAttribute<float>(ta, mesh.num_points(), num_encoded_points,
-                             mesh.IsCompressionEnabled());
+                             IsDracoCompressed(mesh));
 }
 
 int GltfAsset::AddDracoTangents(const Mesh &mesh, int num_encoded_points) {
@@ -1340,7 +2179,7 @@ int GltfAsset::AddDracoTangents(const Mesh &mesh, int num_encoded_points) {
 
   if (att->num_components() == 4) {
     return AddAttribute<float>(*att, mesh.num_points(), num_encoded_points,
-                               mesh.IsCompressionEnabled());
+                               IsDracoCompressed(mesh));
   }
 
   // glTF mesh needs the w component.
@@ -1362,7 +2201,7 @@ int GltfAsset::AddDracoTangents(const Mesh &mesh, int num_encoded_points) {
     ta.SetAttributeValue(AttributeValueIndex(v.value()), tangent.data());
   }
   return AddAttribute<float>(ta, mesh.num_points(), num_encoded_points,
-                             mesh.IsCompressionEnabled());
+                             IsDracoCompressed(mesh));
 }
 
 int GltfAsset::AddDracoJoints(const Mesh &mesh, int num_encoded_points) {
@@ -1373,10 +2212,10 @@ int GltfAsset::AddDracoJoints(const Mesh &mesh, int num_encoded_points) {
   }
   if (att->data_type() == DT_UINT16) {
     return AddAttribute<uint16_t>(*att, mesh.num_points(), num_encoded_points,
-                                  mesh.IsCompressionEnabled());
+                                  IsDracoCompressed(mesh));
   }
   return AddAttribute<uint8_t>(*att, mesh.num_points(), num_encoded_points,
-                               mesh.IsCompressionEnabled());
+                               IsDracoCompressed(mesh));
 }
 
 int GltfAsset::AddDracoWeights(const Mesh &mesh, int num_encoded_points) {
@@ -1387,7 +2226,7 @@ int GltfAsset::AddDracoWeights(const Mesh &mesh, int num_encoded_points) {
     return -1;
   }
   return AddAttribute<float>(*att, mesh.num_points(), num_encoded_points,
-                             mesh.IsCompressionEnabled());
+                             IsDracoCompressed(mesh));
 }
 
 // Adds generic attributes that have metadata describing the attribute name,
@@ -1421,7 +2260,7 @@ std::vector<std::pair<std::string, int>> GltfAsset::AddDracoGenerics(
         if (att->data_type() == DT_FLOAT32) {
           accessor =
               AddAttribute<float>(*att, mesh.num_points(), num_encoded_points,
-                                  mesh.IsCompressionEnabled());
+                                  IsDracoCompressed(mesh));
         }
       }
     } else {
@@ -1430,7 +2269,7 @@ std::vector<std::pair<std::string, int>> GltfAsset::AddDracoGenerics(
         // as defined by the EXT_mesh_features glTF extension.
         // TODO(vytyaz): Report an error if the number of components is not one.
         accessor = AddAttribute(*att, mesh.num_points(), num_encoded_points,
-                                mesh.IsCompressionEnabled());
+                                IsDracoCompressed(mesh));
 
         // Generate attribute name like _FEATURE_ID_N where N starts at 0 for
         // the first feature ID vertex attribute and continues with consecutive
@@ -1446,7 +2285,7 @@ std::vector<std::pair<std::string, int>> GltfAsset::AddDracoGenerics(
         // This is a property attribute as defined by the
         // EXT_structural_metadata glTF extension.
         accessor = AddAttribute(*att, mesh.num_points(), num_encoded_points,
-                                mesh.IsCompressionEnabled());
+                                IsDracoCompressed(mesh));
         attr_name = att->name();
       }
     }
@@ -1533,12 +2372,9 @@ StatusOr<int> GltfAsset::AddImage(const std::string &image_stem,
   return images_.size() - 1;
 }
 
-Status GltfAsset::SaveImageToBuffer(int image_index) {
+Status GltfAsset::SaveImageToBuffer(int image_index,
+                                    const std::vector<uint8_t> &buffer) {
   GltfImage &image = images_[image_index];
-  const Texture *const texture = image.texture;
-  const int num_components = image.num_components;
-  std::vector<uint8_t> buffer;
-  DRACO_RETURN_IF_ERROR(WriteTextureToBuffer(*texture, &buffer));
 
   // Add the image data to the buffer.
   const size_t buffer_start_offset = buffer_.size();
@@ -1590,9 +2426,21 @@ Status GltfAsset::AddScene(const Scene &scene) {
   // Initialize base mesh transforms that may be needed when the base meshes are
   // compressed with Draco.
   base_mesh_transforms_ = SceneUtils::FindLargestBaseMeshTransforms(scene);
+  if (compression_codec_ != GltfEncoder::MESHOPT) {
+    const std::vector<MeshIndex> mesh_indices =
+        FindDracoCompressedMeshes(scene);
+    DRACO_RETURN_IF_ERROR(
+        ComputeSharedPositionQuantizations(scene, mesh_indices));
+    // Incremental saves take the unchanged meshes from the previous save, so
+    // the meshes are always encoded in advance in that case.
+    if (thread_pool_ != nullptr || incremental_save_state_ != nullptr) {
+      DRACO_RETURN_IF_ERROR(EncodeSceneMeshesWithDraco(scene, mesh_indices));
+    }
+  }
   for (SceneNodeIndex i(0); i < scene.NumNodes(); ++i) {
     DRACO_RETURN_IF_ERROR(AddSceneNode(scene, i));
   }
+  draco_encoded_meshes_.clear();
   // There is 1:1 mapping between draco::Scene node indices and |nodes_|.
   for (int i = 0; i < scene.NumRootNodes(); ++i) {
     nodes_[scene.GetRootNodeIndex(i).value()].root_node = true;
@@ -2731,11 +3579,19 @@ Status GltfAsset::EncodeMaterialsProperty(EncoderBuffer *buf_out) {
   }
 
   if (!images_.empty()) {
+    if (add_images_to_buffer_) {
+      std::vector<const Texture *> textures;
+      for (const GltfImage &image : images_) {
+        textures.push_back(image.texture);
+      }
+      DRACO_RETURN_IF_ERROR(ProcessTexturesInOrder(
+          textures, thread_pool_,
+          [this](int i, const std::vector<uint8_t> &data) {
+            return SaveImageToBuffer(i, data);
+          }));
+    }
     gltf_json_.BeginArray("images");
     for (int i = 0; i < images_.size(); ++i) {
-      if (add_images_to_buffer_) {
-        DRACO_RETURN_IF_ERROR(SaveImageToBuffer(i));
-      }
       gltf_json_.BeginObject();
       if (images_[i].buffer_view >= 0) {
         gltf_json_.OutputValue("bufferView", images_[i].buffer_view);
@@ -3311,17 +4167,39 @@ bool GltfAsset::EncodeAccessorsProperty(EncoderBuffer *buf_out) {
 }
 
 bool GltfAsset::EncodeBufferViewsProperty(EncoderBuffer *buf_out) {
-  // We currently only support one buffer.
+  // All data is stored in the first buffer. Views compressed with
+  // EXT_meshopt_compression refer to the fallback buffer that has no data.
   gltf_json_.BeginArray("bufferViews");
 
   for (int i = 0; i < buffer_views_.size(); ++i) {
+    const GltfBufferView::MeshoptCompression &meshopt =
+        buffer_views_[i].meshopt;
     gltf_json_.BeginObject();
-    gltf_json_.OutputValue("buffer", 0);
+    gltf_json_.OutputValue("buffer", meshopt.mode.empty() ? 0 : 1);
     gltf_json_.OutputValue("byteOffset", buffer_views_[i].buffer_byte_offset);
     gltf_json_.OutputValue("byteLength", buffer_views_[i].byte_length);
+    if (buffer_views_[i].byte_stride != 0) {
+      gltf_json_.OutputValue("byteStride", buffer_views_[i].byte_stride);
+    }
     if (buffer_views_[i].target != 0) {
       gltf_json_.OutputValue("target", buffer_views_[i].target);
     }
+    if (!meshopt.mode.empty()) {
+      gltf_json_.BeginObject("extensions");
+      gltf_json_.BeginObject("EXT_meshopt_compression");
+      gltf_json_.OutputValue("buffer", 0);
+      gltf_json_.OutputValue("byteOffset", meshopt.byte_offset);
+      gltf_json_.OutputValue("byteLength", meshopt.byte_length);
+      gltf_json_.OutputValue("byteStride", meshopt.byte_stride);
+      gltf_json_.OutputValue("count", meshopt.count);
+      gltf_json_.OutputValue("mode", meshopt.mode);
+      if (meshopt.filter != MeshoptCodec::FILTER_NONE) {
+        gltf_json_.OutputValue("filter",
+                               MeshoptCodec::FilterName(meshopt.filter));
+      }
+      gltf_json_.EndObject();  // EXT_meshopt_compression entry.
+      gltf_json_.EndObject();  // extensions entry.
+    }
     gltf_json_.EndObject();
   }
 
@@ -3335,7 +4213,6 @@ bool GltfAsset::EncodeBuffersProperty(EncoderBuffer *buf_out) {
   if (buffer_.size() == 0) {
     return true;
   }
-  // We currently only support one buffer.
   gltf_json_.BeginArray("buffers");
   gltf_json_.BeginObject();
   gltf_json_.OutputValue("byteLength", buffer_.size());
@@ -3343,6 +4220,18 @@ bool GltfAsset::EncodeBuffersProperty(EncoderBuffer *buf_out) {
     gltf_json_.OutputValue("uri", buffer_name_);
   }
   gltf_json_.EndObject();
+  if (meshopt_compression_used_) {
+    // Fallback buffer of the EXT_meshopt_compression views. Decoders that
+    // support the extension allocate it and decompress the views into it.
+    gltf_json_.BeginObject();
+    gltf_json_.OutputValue("byteLength", meshopt_fallback_buffer_size_);
+    gltf_json_.BeginObject("extensions");
+    gltf_json_.BeginObject("EXT_meshopt_compression");
+    gltf_json_.OutputValue("fallback", true);
+    gltf_json_.EndObject();  // EXT_meshopt_compression entry.
+    gltf_json_.EndObject();  // extensions entry.
+    gltf_json_.EndObject();
+  }
   gltf_json_.EndArray();
 
   const std::string asset_str = gltf_json_.MoveData();
@@ -3355,6 +4244,15 @@ Status GltfAsset::EncodeExtensionsProperties(EncoderBuffer *buf_out) {
     extensions_used_.insert(draco_tag);
     extensions_required_.insert(draco_tag);
   }
+  if (meshopt_compression_used_) {
+    // The fallback buffer has no data so the extension is required.
+    extensions_used_.insert("EXT_meshopt_compression");
+    extensions_required_.insert("EXT_meshopt_compression");
+  }
+  if (mesh_quantization_used_) {
+    extensions_used_.insert("KHR_mesh_quantization");
+    extensions_required_.insert("KHR_mesh_quantization");
+  }
   if (!lights_.empty()) {
     extensions_used_.insert("KHR_lights_punctual");
   }
@@ -3434,7 +4332,6 @@ int GltfAsset::AddAttribute(const PointAttribute &att, int num_points,
     return -1;  // Attribute size must be greater than 0.
   }
 
-  std::array<att_data_t, att_components_t> value;
   std::array<att_data_t, att_components_t> min_values;
   std::array<att_data_t, att_components_t> max_values;
 
@@ -3445,48 +4342,71 @@ int GltfAsset::AddAttribute(const PointAttribute &att, int num_points,
   }
   max_values = min_values;
 
-  if (output_type_ == GltfEncoder::VERBOSE ||
-      att.attribute_type() == GeometryAttribute::POSITION) {
-    for (AttributeValueIndex i(1); i < static_cast<uint32_t>(att.size()); ++i) {
-      if (!att.ConvertValue<att_data_t, att_components_t>(i, &value[0])) {
-        return -1;
-      }
-      for (int j = 0; j < att_components_t; ++j) {
-        if (value[j] < min_values[j]) {
-          min_values[j] = value[j];
-        }
-        if (value[j] > max_values[j]) {
-          max_values[j] = value[j];
-        }
-      }
-    }
-  }
-
   const int kComponentSize = sizeof(att_data_t);
+  const int kEntrySize = kComponentSize * att_components_t;
 
   GltfAccessor accessor;
+  std::vector<att_data_t> point_values;
   if (!compress) {
-    const size_t buffer_start_offset = buffer_.size();
-    for (PointIndex v(0); v < num_points; ++v) {
-      if (!att.ConvertValue<att_data_t, att_components_t>(att.mapped_index(v),
-                                                          &value[0])) {
+    point_values.resize(num_points * att_components_t);
+    if (!att.ConvertAllValues(num_points, att_components_t, point_values.data(),
+                              kEntrySize)) {
+      return -1;
+    }
+    if (meshopt_mesh_ != nullptr) {
+      // The filtered values are stored back to |point_values| so that the
+      // bounds computed below match the decoded data.
+      const int filter_bits = std::is_same<att_data_t, float>::value
+                                  ? GetMeshoptFilterBits(*meshopt_mesh_, att)
+                                  : 0;
+      accessor.buffer_view_index = AddMeshoptVertexBufferView(
+          reinterpret_cast<uint8_t *>(point_values.data()), num_points,
+          kEntrySize, filter_bits);
+      if (accessor.buffer_view_index < 0) {
         return -1;
       }
+    } else {
+      const size_t buffer_start_offset = buffer_.size();
+      buffer_.Encode(point_values.data(), point_values.size() * kComponentSize);
 
-      for (int j = 0; j < att_components_t; ++j) {
-        buffer_.Encode(&value[j], kComponentSize);
+      if (!PadBuffer()) {
+        return -1;
       }
-    }
 
-    if (!PadBuffer()) {
-      return -1;
+      GltfBufferView buffer_view;
+      buffer_view.buffer_byte_offset = buffer_start_offset;
+      buffer_view.byte_length = buffer_.size() - buffer_start_offset;
+      buffer_views_.push_back(buffer_view);
+      accessor.buffer_view_index = static_cast<int>(buffer_views_.size() - 1);
     }
+  }
 
-    GltfBufferView buffer_view;
-    buffer_view.buffer_byte_offset = buffer_start_offset;
-    buffer_view.byte_length = buffer_.size() - buffer_start_offset;
-    buffer_views_.push_back(buffer_view);
-    accessor.buffer_view_index = static_cast<int>(buffer_views_.size() - 1);
+  if (output_type_ == GltfEncoder::VERBOSE ||
+      att.attribute_type() == GeometryAttribute::POSITION) {
+    std::vector<att_data_t> values;
+    if (meshopt_mesh_ != nullptr && !compress) {
+      values = point_values;
+    } else {
+      values.resize(att.size() * att_components_t);
+      if (!att.ConvertValues(AttributeValueIndex(0), att.size(),
+                             att_components_t, values.data(), kEntrySize)) {
+        return -1;
+      }
+    }
+    if (!values.empty()) {
+      std::copy(values.begin(), values.begin() + att_components_t,
+                min_values.begin());
+      max_values = min_values;
+    }
+    for (size_t i = att_components_t; i < values.size(); ++i) {
+      const int j = i % att_components_t;
+      if (values[i] < min_values[j]) {
+        min_values[j] = values[i];
+      }
+      if (values[i] > max_values[j]) {
+        max_values[j] = values[i];
+      }
+    }
   }
 
   accessor.component_type = GetComponentType<att_data_t>();
@@ -3522,7 +4442,24 @@ void GltfAsset::SetCopyrightFromMesh(const Mesh &mesh) {
 const char GltfEncoder::kDracoMetadataGltfAttributeName[] =
     "//GLTF/ApplicationSpecificAttributeName";
 
-GltfEncoder::GltfEncoder() : out_buffer_(nullptr), output_type_(COMPACT) {}
+GltfEncoder::GltfEncoder()
+    : out_buffer_(nullptr),
+      output_type_(COMPACT),
+      thread_pool_(nullptr),
+      draco_mesh_cache_(nullptr),
+      reuse_draco_payloads_(false),
+      compression_codec_(DRACO),
+      meshopt_max_size_ratio_(1.5f) {}
+
+GltfEncoder::~GltfEncoder() = default;
+
+void GltfEncoder::set_incremental_save(bool flag) {
+  if (!flag) {
+    incremental_save_state_.reset();
+  } else if (incremental_save_state_ == nullptr) {
+    incremental_save_state_.reset(new GltfIncrementalSaveState());
+  }
+}
 
 template <typename T>
 bool GltfEncoder::EncodeToFile(const T &geometry, const std::string &file_name,
@@ -3574,6 +4511,12 @@ Status GltfEncoder::EncodeFile(const T &geometry, const std::string &filename,
   GltfAsset gltf_asset;
   gltf_asset.set_copyright(copyright_);
   gltf_asset.set_output_type(output_type_);
+  gltf_asset.set_thread_pool(thread_pool_);
+  gltf_asset.set_draco_mesh_cache(draco_mesh_cache_);
+  gltf_asset.set_reuse_draco_payloads(reuse_draco_payloads_);
+  gltf_asset.set_compression_codec(compression_codec_);
+  gltf_asset.set_meshopt_max_size_ratio(meshopt_max_size_ratio_);
+  gltf_asset.set_incremental_save_state(incremental_save_state_.get());
 
   if (extension == "gltf") {
     std::string bin_path;
@@ -3600,6 +4543,12 @@ Status GltfEncoder::EncodeToBuffer(const T &geometry,
                                    EncoderBuffer *out_buffer) {
   GltfAsset gltf_asset;
   gltf_asset.set_output_type(output_type_);
+  gltf_asset.set_thread_pool(thread_pool_);
+  gltf_asset.set_draco_mesh_cache(draco_mesh_cache_);
+  gltf_asset.set_reuse_draco_payloads(reuse_draco_payloads_);
+  gltf_asset.set_compression_codec(compression_codec_);
+  gltf_asset.set_meshopt_max_size_ratio(meshopt_max_size_ratio_);
+  gltf_asset.set_incremental_save_state(incremental_save_state_.get());
   gltf_asset.buffer_name("");
   gltf_asset.set_add_images_to_buffer(true);
   gltf_asset.set_copyright(copyright_);
@@ -3608,17 +4557,50 @@ Status GltfEncoder::EncodeToBuffer(const T &geometry,
   EncoderBuffer buffer;
   DRACO_RETURN_IF_ERROR(EncodeToBuffer(geometry, &gltf_asset, &buffer));
 
-  // Define a function for concatenating GLB file chunks into a single buffer.
-  const auto encode_chunk_to_buffer =
-      [&out_buffer](const EncoderBuffer &chunk) -> Status {
-    if (!out_buffer->Encode(chunk.data(), chunk.size())) {
+  // Define a function for concatenating all GLB file chunks preceding the
+  // binary chunk data into a single buffer. The binary data itself is not
+  // copied.
+  EncoderBuffer glb_prefix;
+  const EncoderBuffer *const bin_data = gltf_asset.Buffer();
+  const auto encode_chunk_to_prefix =
+      [&glb_prefix, bin_data](const EncoderBuffer &chunk) -> Status {
+    if (&chunk == bin_data) {
+      return OkStatus();
+    }
+    if (!glb_prefix.Encode(chunk.data(), chunk.size())) {
       return Status(Status::DRACO_ERROR, "Error writing to buffer.");
     }
     return OkStatus();
   };
+  DRACO_RETURN_IF_ERROR(
+      ProcessGlbFileChunks(gltf_asset, buffer, encode_chunk_to_prefix));
+
+  // External storage of the output must receive a copy of the binary data.
+  if (out_buffer->has_external_storage()) {
+    if (!out_buffer->Encode(glb_prefix.data(), glb_prefix.size()) ||
+        !out_buffer->Encode(bin_data->data(), bin_data->size())) {
+      return Status(Status::DRACO_ERROR, "Error writing to buffer.");
+    }
+    return OkStatus();
+  }
 
-  // Create GLB file chunks and concatenate them to a single buffer.
-  return ProcessGlbFileChunks(gltf_asset, buffer, encode_chunk_to_buffer);
+  // The binary data is the last chunk of the GLB file. The output is built in
+  // place by inserting the existing output data and the GLB prefix in front of
+  // the binary data, and the result is moved into the output buffer. This
+  // avoids holding two copies of the binary data in memory.
+  EncoderBuffer *const glb_data = gltf_asset.MutableBuffer();
+  const size_t head_size = out_buffer->size() + glb_prefix.size();
+  const size_t bin_size = glb_data->size();
+  glb_data->Reserve(head_size + bin_size);
+  if (!glb_data->Resize(head_size + bin_size)) {
+    return Status(Status::DRACO_ERROR, "Error writing to buffer.");
+  }
+  char *const data = glb_data->data();
+  memmove(data + head_size, data, bin_size);
+  memcpy(data, out_buffer->data(), out_buffer->size());
+  memcpy(data + out_buffer->size(), glb_prefix.data(), glb_prefix.size());
+  *out_buffer = std::move(*glb_data);
+  return OkStatus();
 }
 
 // Explicit instantiation for Mesh and Scene.
@@ -3706,13 +4688,31 @@ Status GltfEncoder::WriteGltfFiles(const GltfAsset &gltf_asset,
     return Status(Status::DRACO_ERROR, "Error writing to glTF bin file.");
   }
 
+  std::vector<const Texture *> textures;
+  std::vector<std::string> names;
+  std::unordered_map<std::string, uint64_t> image_revisions;
   for (int i = 0; i < gltf_asset.NumImages(); ++i) {
-    const std::string name = resource_dir + "/" + gltf_asset.image_name(i);
     const GltfImage *const image = gltf_asset.GetImage(i);
     if (!image) {
       return Status(Status::DRACO_ERROR, "Error getting glTF image.");
     }
-    DRACO_RETURN_IF_ERROR(WriteTextureToFile(name, *image->texture));
+    const std::string name = resource_dir + "/" + gltf_asset.image_name(i);
+    if (incremental_save_state_ != nullptr) {
+      // Skip image files that were written by the previous save.
+      image_revisions[name] = image->texture->revision();
+      const auto it = incremental_save_state_->image_revisions.find(name);
+      if (it != incremental_save_state_->image_revisions.end() &&
+          it->second == image->texture->revision() &&
+          GetFileSize(name) > 0) {
+        continue;
+      }
+    }
+    textures.push_back(image->texture);
+    names.push_back(name);
+  }
+  DRACO_RETURN_IF_ERROR(WriteTexturesToFiles(textures, names, thread_pool_));
+  if (incremental_save_state_ != nullptr) {
+    std::swap(incremental_save_state_->image_revisions, image_revisions);
   }
   return OkStatus();
 }
@@ -3726,11 +4726,17 @@ Status GltfEncoder::WriteGlbFile(const GltfAsset &gltf_asset,
     return Status(Status::DRACO_ERROR, "Output glb file could not be opened.");
   }
 
-  // Define a function for writing GLB file chunks to |file|.
+  // Define a function for writing GLB file chunks to |file|. Large chunks are
+  // written in slices, so that writers that copy the data (such as
+  // AsyncFileWriter) never hold a copy of the whole binary chunk.
   const auto write_chunk_to_file =
       [&file](const EncoderBuffer &chunk) -> Status {
-    if (!file->Write(chunk.data(), chunk.size())) {
-      return Status(Status::DRACO_ERROR, "Error writing to glb file.");
+    constexpr size_t kMaxSliceSize = 4 << 20;
+    for (size_t offset = 0; offset < chunk.size(); offset += kMaxSliceSize) {
+      const size_t slice_size = std::min(kMaxSliceSize, chunk.size() - offset);
+      if (!file->Write(chunk.data() + offset, slice_size)) {
+        return Status(Status::DRACO_ERROR, "Error writing to glb file.");
+      }
     }
     return OkStatus();
   };
@@ -3745,9 +4751,13 @@ Status GltfEncoder::ProcessGlbFileChunks(
   // The json data must be padded so the next chunk starts on a 4-byte boundary.
   const uint32_t json_pad_length =
       (json_data.size() % 4) ? 4 - json_data.size() % 4 : 0;
-  const uint32_t json_length = json_data.size() + json_pad_length;
-  const uint32_t total_length =
+  const uint64_t json_length = json_data.size() + json_pad_length;
+  const uint64_t total_length =
       12 + 8 + json_length + 8 + gltf_asset.Buffer()->size();
+  // All lengths are stored as 32-bit values.
+  if (total_length > std::numeric_limits<uint32_t>::max()) {
+    return Status(Status::DRACO_ERROR, "Output is too large for a glb file.");
+  }
 
   EncoderBuffer header;
   // Write the glb file header.
@@ -3758,13 +4768,13 @@ Status GltfEncoder::ProcessGlbFileChunks(
   if (!header.Encode(gltf_version)) {
     return Status(Status::DRACO_ERROR, "Error writing to glb file.");
   }
-  if (!header.Encode(total_length)) {
+  if (!header.Encode(static_cast<uint32_t>(total_length))) {
     return Status(Status::DRACO_ERROR, "Error writing to glb file.");
   }
 
   // Write the JSON chunk.
   const uint32_t json_chunk_type = 0x4E4F534A;
-  if (!header.Encode(json_length)) {
+  if (!header.Encode(static_cast<uint32_t>(json_length))) {
     return Status(Status::DRACO_ERROR, "Error writing to glb file.");
   }
   if (!header.Encode(json_chunk_type)) {
@@ -21,11 +21,14 @@
 #include <functional>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "draco/core/encoder_buffer.h"
+#include "draco/core/thread_pool.h"
+#include "draco/io/draco_mesh_cache.h"
 #include "draco/io/file_writer_factory.h"
 #include "draco/io/file_writer_interface.h"
 #include "draco/io/texture_io.h"
@@ -43,7 +46,15 @@ class GltfEncoder {
   // a glTF-Binary file.
   enum OutputType { COMPACT, VERBOSE };
 
+  // Codecs for meshes with compression enabled. |DRACO| writes the meshes
+  // with KHR_draco_mesh_compression. |MESHOPT| writes the buffer views of the
+  // meshes with EXT_meshopt_compression, which is larger but decodes several
+  // times faster. |AUTO| picks one of the two for each primitive, see
+  // set_meshopt_max_size_ratio().
+  enum CompressionCodec { DRACO, MESHOPT, AUTO };
+
   GltfEncoder();
+  ~GltfEncoder();
 
   // Encodes the geometry and saves it into a file. Returns false when either
   // the encoding failed or when the file couldn't be opened.
@@ -87,6 +98,54 @@ class GltfEncoder {
   void set_copyright(const std::string &copyright) { copyright_ = copyright; }
   std::string copyright() const { return copyright_; }
 
+  // Sets an optional thread pool that is used to compress the meshes of a
+  // scene with Draco concurrently. The output does not depend on the number
+  // of threads. The pool is not owned and must outlive the encoding.
+  void set_thread_pool(ThreadPool *thread_pool) { thread_pool_ = thread_pool; }
+  ThreadPool *thread_pool() const { return thread_pool_; }
+
+  // Sets an optional cache of Draco encoded meshes. Meshes found in the cache
+  // are not encoded again and newly encoded meshes are added to it. The cache
+  // is not owned and must outlive the encoding.
+  void set_draco_mesh_cache(const DracoMeshCache *cache) {
+    draco_mesh_cache_ = cache;
+  }
+  const DracoMeshCache *draco_mesh_cache() const { return draco_mesh_cache_; }
+
+  // When set, meshes that keep the Draco data they were decoded from (see
+  // GltfDecoder::SetKeepDracoPayloads()) are written with that data instead of
+  // being compressed again, provided that the mesh was not modified and that
+  // the data is quantized at least as finely as the compression options of
+  // the mesh request. Off by default.
+  void set_reuse_draco_payloads(bool flag) { reuse_draco_payloads_ = flag; }
+  bool reuse_draco_payloads() const { return reuse_draco_payloads_; }
+
+  // Enables incremental saving of scenes, e.g., for editors that save the same
+  // scene repeatedly. The encoder then keeps the Draco compressed data of the
+  // scene meshes between calls and reuses it for meshes whose revision (see
+  // Scene::GetMeshRevision()), compression options and transform did not
+  // change since the previous save. Image files of glTF (non-binary) output
+  // are only written again when the texture revision or the file name changed
+  // or the file is missing. The JSON and the binary buffer are always rebuilt,
+  // which is cheap compared to compression. Off by default.
+  void set_incremental_save(bool flag);
+  bool incremental_save() const { return incremental_save_state_ != nullptr; }
+
+  // Sets the codec of meshes with compression enabled. Defaults to |DRACO|.
+  void set_compression_codec(CompressionCodec codec) {
+    compression_codec_ = codec;
+  }
+  CompressionCodec compression_codec() const { return compression_codec_; }
+
+  // Sets the size/decode-time tradeoff of the |AUTO| codec: a primitive is
+  // compressed with EXT_meshopt_compression when its estimated meshopt size
+  // is at most |ratio| times the size of its Draco data, and with Draco
+  // otherwise. Larger ratios favor decoding speed. Defaults to 1.5.
+  void set_meshopt_max_size_ratio(float ratio) {
+    meshopt_max_size_ratio_ = ratio;
+  }
+  float meshopt_max_size_ratio() const { return meshopt_max_size_ratio_; }
+
   // The name of the attribute metadata that contains the glTF attribute
   // name. For application-specific generic attributes, if the metadata for
   // an attribute contains this key, then the value will be used as the
@@ -122,7 +181,8 @@ class GltfEncoder {
 
   // Creates GLB file chunks and passes them to |process_chunk| function for
   // processing. |gltf_asset| holds the glTF data. |json_data| is the encoded
-  // glTF json data.
+  // glTF json data. The last chunk is the binary buffer of |gltf_asset|
+  // itself, all lengths are computed before the first chunk is processed.
   Status ProcessGlbFileChunks(
       const class GltfAsset &gltf_asset, const EncoderBuffer &json_data,
       const std::function<Status(const EncoderBuffer &)> &process_chunk) const;
@@ -130,6 +190,15 @@ class GltfEncoder {
   EncoderBuffer *out_buffer_;
   OutputType output_type_;
   std::string copyright_;
+  ThreadPool *thread_pool_;
+  const DracoMeshCache *draco_mesh_cache_;
+  bool reuse_draco_payloads_;
+  CompressionCodec compression_codec_;
+  float meshopt_max_size_ratio_;
+
+  // Data of the previous save that is reused by incremental saves. Null when
+  // incremental saving is disabled.
+  std::unique_ptr<class GltfIncrementalSaveState> incremental_save_state_;
 };
 
 }  // namespace draco
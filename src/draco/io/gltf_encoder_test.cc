@@ -15,7 +15,10 @@
 #include "draco/io/gltf_encoder.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <algorithm>
 #include <array>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -25,6 +28,8 @@
 #include <utility>
 #include <vector>
 
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/decode.h"
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
 #include "draco/io/file_reader_factory.h"
@@ -652,6 +657,280 @@ TEST_F(GltfEncoderTest, EncodeTangentsWithDracoCompression) {
   EncodeSceneToGltfAndCompare(scene.get());
 }
 
+// Tests that Draco compression of scene meshes on a thread pool produces the
+// same output as the serial compression.
+TEST_F(GltfEncoderTest, EncodeWithDracoCompressionOnThreadPool) {
+  const std::string file_name = "Lantern/glTF/Lantern.gltf";
+  const std::unique_ptr<Scene> scene(DecodeTestGltfFileToScene(file_name));
+  ASSERT_NE(scene, nullptr);
+  const DracoCompressionOptions options;
+  SceneUtils::SetDracoCompressionOptions(&options, scene.get());
+
+  GltfEncoder encoder;
+  EncoderBuffer expected_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &expected_buffer));
+
+  ThreadPool thread_pool(4);
+  encoder.set_thread_pool(&thread_pool);
+  EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &buffer));
+  ASSERT_EQ(buffer.size(), expected_buffer.size());
+  ASSERT_EQ(memcmp(buffer.data(), expected_buffer.data(), buffer.size()), 0);
+}
+
+// Returns true when |buffer| contains the Draco payload of |mesh|.
+bool ContainsDracoPayload(const EncoderBuffer &buffer, const Mesh &mesh) {
+  const std::vector<char> &data = *mesh.GetDracoPayload()->data;
+  return std::search(buffer.data(), buffer.data() + buffer.size(),
+                     data.begin(), data.end()) != buffer.data() + buffer.size();
+}
+
+// Tests that Draco compressed meshes of a decoded scene are written with their
+// original Draco data when the compression options allow it.
+TEST_F(GltfEncoderTest, ReuseDracoPayloads) {
+  const std::string file_name = "Lantern/glTF/Lantern.gltf";
+  const std::unique_ptr<Scene> input(DecodeTestGltfFileToScene(file_name));
+  ASSERT_NE(input, nullptr);
+  const DracoCompressionOptions options;
+  SceneUtils::SetDracoCompressionOptions(&options, input.get());
+  GltfEncoder encoder;
+  EncoderBuffer compressed_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*input, &compressed_buffer));
+
+  GltfDecoder decoder;
+  decoder.SetKeepDracoPayloads(true);
+  DecoderBuffer decoder_buffer;
+  decoder_buffer.Init(compressed_buffer.data(), compressed_buffer.size());
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Scene> scene,
+                         decoder.DecodeFromBufferToScene(&decoder_buffer));
+  ASSERT_EQ(scene->NumMeshes(), input->NumMeshes());
+  for (MeshIndex i(0); i < scene->NumMeshes(); ++i) {
+    ASSERT_NE(scene->GetMesh(i).GetDracoPayload(), nullptr);
+  }
+  SceneUtils::SetDracoCompressionOptions(&options, scene.get());
+
+  // Payloads are reused for the same options.
+  encoder.set_reuse_draco_payloads(true);
+  EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &buffer));
+  for (MeshIndex i(0); i < scene->NumMeshes(); ++i) {
+    ASSERT_TRUE(ContainsDracoPayload(buffer, scene->GetMesh(i)));
+  }
+
+  // The output decodes to the same geometry as the input.
+  GltfDecoder output_decoder;
+  decoder_buffer.Init(buffer.data(), buffer.size());
+  DRACO_ASSIGN_OR_ASSERT(
+      std::unique_ptr<Scene> output,
+      output_decoder.DecodeFromBufferToScene(&decoder_buffer));
+  ASSERT_EQ(output->NumMeshes(), scene->NumMeshes());
+  for (MeshIndex i(0); i < scene->NumMeshes(); ++i) {
+    ASSERT_EQ(output->GetMesh(i).num_faces(), scene->GetMesh(i).num_faces());
+    ASSERT_EQ(output->GetMesh(i).num_points(), scene->GetMesh(i).num_points());
+  }
+
+  // Payloads are reused for coarser quantization, but not for finer.
+  DracoCompressionOptions coarse_options;
+  coarse_options.quantization_position.SetQuantizationBits(8);
+  SceneUtils::SetDracoCompressionOptions(&coarse_options, scene.get());
+  buffer.Clear();
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &buffer));
+  ASSERT_TRUE(ContainsDracoPayload(buffer, scene->GetMesh(MeshIndex(0))));
+  DracoCompressionOptions fine_options;
+  fine_options.quantization_position.SetQuantizationBits(14);
+  SceneUtils::SetDracoCompressionOptions(&fine_options, scene.get());
+  buffer.Clear();
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &buffer));
+  ASSERT_FALSE(ContainsDracoPayload(buffer, scene->GetMesh(MeshIndex(0))));
+
+  // Payloads of modified meshes are not reused.
+  SceneUtils::SetDracoCompressionOptions(&options, scene.get());
+  Mesh &mesh = scene->GetMesh(MeshIndex(0));
+  PointAttribute *const pos_att =
+      mesh.attribute(mesh.GetNamedAttributeId(GeometryAttribute::POSITION));
+  Vector3f value;
+  pos_att->GetValue(AttributeValueIndex(0), &value[0]);
+  value[0] += 1.f;
+  pos_att->SetAttributeValue(AttributeValueIndex(0), &value[0]);
+  buffer.Clear();
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &buffer));
+  ASSERT_FALSE(ContainsDracoPayload(buffer, mesh));
+}
+
+// Tests that incremental saves reuse the Draco data of unchanged meshes.
+TEST_F(GltfEncoderTest, IncrementalSave) {
+  const std::string file_name = "Lantern/glTF/Lantern.gltf";
+  const std::unique_ptr<Scene> scene(DecodeTestGltfFileToScene(file_name));
+  ASSERT_NE(scene, nullptr);
+  const DracoCompressionOptions options;
+  SceneUtils::SetDracoCompressionOptions(&options, scene.get());
+  Mesh &mesh = scene->GetMesh(MeshIndex(0));
+
+  GltfEncoder encoder;
+  EncoderBuffer expected_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &expected_buffer));
+
+  // The output of incremental saves does not differ from regular saves.
+  GltfEncoder incremental_encoder;
+  incremental_encoder.set_incremental_save(true);
+  ASSERT_TRUE(incremental_encoder.incremental_save());
+  for (int i = 0; i < 2; ++i) {
+    EncoderBuffer buffer;
+    DRACO_ASSERT_OK(incremental_encoder.EncodeToBuffer(*scene, &buffer));
+    ASSERT_EQ(buffer.size(), expected_buffer.size());
+    ASSERT_EQ(memcmp(buffer.data(), expected_buffer.data(), buffer.size()), 0);
+  }
+
+  // Modify a mesh over a reference obtained before the saves. The change is
+  // not picked up until the mesh is marked as modified. The new position lies
+  // within the bounds of the mesh, so that the position accessor of the glTF
+  // does not change either.
+  PointAttribute *const pos_att =
+      mesh.attribute(mesh.GetNamedAttributeId(GeometryAttribute::POSITION));
+  Vector3f value;
+  pos_att->GetValue(AttributeValueIndex(1), &value[0]);
+  pos_att->SetAttributeValue(AttributeValueIndex(0), &value[0]);
+  EncoderBuffer buffer;
+  DRACO_ASSERT_OK(incremental_encoder.EncodeToBuffer(*scene, &buffer));
+  ASSERT_EQ(buffer.size(), expected_buffer.size());
+  ASSERT_EQ(memcmp(buffer.data(), expected_buffer.data(), buffer.size()), 0);
+
+  scene->MarkMeshModified(MeshIndex(0));
+  expected_buffer.Clear();
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &expected_buffer));
+  buffer.Clear();
+  DRACO_ASSERT_OK(incremental_encoder.EncodeToBuffer(*scene, &buffer));
+  ASSERT_EQ(buffer.size(), expected_buffer.size());
+  ASSERT_EQ(memcmp(buffer.data(), expected_buffer.data(), buffer.size()), 0);
+
+  // Changed compression options are picked up without marking the mesh.
+  DracoCompressionOptions coarse_options;
+  coarse_options.quantization_position.SetQuantizationBits(8);
+  mesh.SetCompressionOptions(coarse_options);
+  expected_buffer.Clear();
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &expected_buffer));
+  buffer.Clear();
+  DRACO_ASSERT_OK(incremental_encoder.EncodeToBuffer(*scene, &buffer));
+  ASSERT_EQ(buffer.size(), expected_buffer.size());
+  ASSERT_EQ(memcmp(buffer.data(), expected_buffer.data(), buffer.size()), 0);
+
+  // Image files of glTF output are written again when they are missing.
+  const std::string gltf_path = GetTestTempFileFullPath("incremental.gltf");
+  DRACO_ASSERT_OK(incremental_encoder.EncodeFile(*scene, gltf_path));
+  const std::string image_path =
+      GetTestTempFileFullPath("Lantern_baseColor.png");
+  const size_t image_size = GetFileSize(image_path);
+  ASSERT_GT(image_size, 0);
+  ASSERT_EQ(std::remove(image_path.c_str()), 0);
+  DRACO_ASSERT_OK(incremental_encoder.EncodeFile(*scene, gltf_path));
+  ASSERT_EQ(GetFileSize(image_path), image_size);
+}
+
+// Tests that meshes are written with EXT_meshopt_compression when selected by
+// the compression codec of the encoder.
+TEST_F(GltfEncoderTest, MeshoptCompression) {
+  const std::string file_name = "Lantern/glTF/Lantern.gltf";
+  const std::unique_ptr<Scene> scene(DecodeTestGltfFileToScene(file_name));
+  ASSERT_NE(scene, nullptr);
+  const DracoCompressionOptions options;
+  SceneUtils::SetDracoCompressionOptions(&options, scene.get());
+  const auto contains = [](const EncoderBuffer &buffer,
+                           const std::string &text) {
+    return std::string(buffer.data(), buffer.size()).find(text) !=
+           std::string::npos;
+  };
+
+  GltfEncoder encoder;
+  EncoderBuffer draco_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &draco_buffer));
+  ASSERT_TRUE(contains(draco_buffer, "KHR_draco_mesh_compression"));
+  ASSERT_FALSE(contains(draco_buffer, "EXT_meshopt_compression"));
+
+  encoder.set_compression_codec(GltfEncoder::MESHOPT);
+  EncoderBuffer meshopt_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &meshopt_buffer));
+  ASSERT_FALSE(contains(meshopt_buffer, "KHR_draco_mesh_compression"));
+  ASSERT_TRUE(contains(meshopt_buffer, "EXT_meshopt_compression"));
+  ASSERT_TRUE(contains(meshopt_buffer, "\"TRIANGLES\""));
+  ASSERT_TRUE(contains(meshopt_buffer, "\"ATTRIBUTES\""));
+  ASSERT_TRUE(contains(meshopt_buffer, "\"EXPONENTIAL\""));
+  ASSERT_TRUE(contains(meshopt_buffer, "\"fallback\""));
+
+  // The automatic codec picks Draco unless meshopt is accepted at any size.
+  encoder.set_compression_codec(GltfEncoder::AUTO);
+  encoder.set_meshopt_max_size_ratio(0.f);
+  EncoderBuffer auto_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &auto_buffer));
+  ASSERT_EQ(auto_buffer.size(), draco_buffer.size());
+  encoder.set_meshopt_max_size_ratio(1000.f);
+  auto_buffer.Clear();
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &auto_buffer));
+  ASSERT_EQ(auto_buffer.size(), meshopt_buffer.size());
+}
+
+TEST_F(GltfEncoderTest, UnifiedPositionQuantization) {
+  // Tests that meshes with unified position quantization share one position
+  // quantization grid, both with and without a thread pool.
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("sphere.obj");
+  ASSERT_NE(mesh, nullptr);
+  std::unique_ptr<Mesh> shifted_mesh(new Mesh());
+  shifted_mesh->Copy(*mesh);
+  PointAttribute *const pos_att = shifted_mesh->attribute(
+      shifted_mesh->GetNamedAttributeId(GeometryAttribute::POSITION));
+  for (AttributeValueIndex i(0); i < pos_att->size(); ++i) {
+    Vector3f value;
+    pos_att->GetValue(i, &value[0]);
+    value[0] += 3.7f;
+    pos_att->SetAttributeValue(i, &value[0]);
+  }
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Scene> scene,
+                         SceneUtils::MeshToScene(std::move(mesh)));
+  const MeshIndex shifted_mesh_index = scene->AddMesh(std::move(shifted_mesh));
+  MeshGroup *const mesh_group = scene->GetMeshGroup(MeshGroupIndex(0));
+  MeshGroup::MeshInstance instance = mesh_group->GetMeshInstance(0);
+  instance.mesh_index = shifted_mesh_index;
+  mesh_group->AddMeshInstance(instance);
+
+  ThreadPool pool(2);
+  ThreadPool *const thread_pools[] = {&pool, nullptr};
+  for (const bool use_grid : {false, true}) {
+    for (ThreadPool *const thread_pool : thread_pools) {
+      DracoCompressionOptions options;
+      options.unified_position_quantization = true;
+      if (use_grid) {
+        options.quantization_position.SetGrid(0.01f);
+      }
+      SceneUtils::SetDracoCompressionOptions(&options, scene.get());
+      GltfEncoder encoder;
+      encoder.set_thread_pool(thread_pool);
+      EncoderBuffer buffer;
+      DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &buffer));
+
+      // Decode the quantization parameters of all Draco payloads.
+      std::vector<AttributeQuantizationTransform> transforms;
+      for (size_t offset = 0; offset + 5 < buffer.size(); ++offset) {
+        if (std::memcmp(buffer.data() + offset, "DRACO", 5) != 0) {
+          continue;
+        }
+        DecoderBuffer decoder_buffer;
+        decoder_buffer.Init(buffer.data() + offset, buffer.size() - offset);
+        Decoder decoder;
+        decoder.SetSkipAttributeTransform(GeometryAttribute::POSITION);
+        DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Mesh> decoded_mesh,
+                               decoder.DecodeMeshFromBuffer(&decoder_buffer));
+        transforms.emplace_back();
+        ASSERT_TRUE(transforms.back().InitFromAttribute(
+            *decoded_mesh->GetNamedAttribute(GeometryAttribute::POSITION)));
+      }
+      ASSERT_EQ(transforms.size(), 2);
+      ASSERT_EQ(transforms[0].quantization_bits(),
+                transforms[1].quantization_bits());
+      ASSERT_EQ(transforms[0].min_values(), transforms[1].min_values());
+      ASSERT_EQ(transforms[0].range(), transforms[1].range());
+    }
+  }
+}
+
 TEST_F(GltfEncoderTest, TestDracoCompressionWithGeneratedPoints) {
   const std::string basename = "test_nm.obj";
   std::unique_ptr<draco::Mesh> mesh = draco::ReadMeshFromTestFile(basename);
@@ -1488,6 +1767,58 @@ TEST_F(GltfEncoderTest, EncodeToBuffer) {
   ASSERT_EQ(std::memcmp(file_data.data(), buffer.data(), buffer.size()), 0);
 }
 
+TEST_F(GltfEncoderTest, EncodeToBufferGlbRoundTrip) {
+  // Tests that the GLB data produced by EncodeToBuffer() is valid, that it
+  // decodes to the encoded scene and that it is appended to existing data.
+  const std::string file_name = "CesiumMilkTruck/glTF/CesiumMilkTruck.gltf";
+  const std::unique_ptr<Scene> scene = ReadSceneFromTestFile(file_name);
+  ASSERT_NE(scene, nullptr);
+
+  GltfEncoder encoder;
+  EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &buffer));
+
+  // Check the GLB header.
+  ASSERT_GT(buffer.size(), 12);
+  ASSERT_EQ(std::memcmp(buffer.data(), "glTF", 4), 0);
+  uint32_t total_length = 0;
+  std::memcpy(&total_length, buffer.data() + 8, sizeof(total_length));
+  ASSERT_EQ(total_length, buffer.size());
+
+  GltfDecoder decoder;
+  DecoderBuffer decoder_buffer;
+  decoder_buffer.Init(buffer.data(), buffer.size());
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Scene> decoded_scene,
+                         decoder.DecodeFromBufferToScene(&decoder_buffer));
+  CompareScenes(scene.get(), decoded_scene.get());
+  for (MeshIndex i(0); i < scene->NumMeshes(); ++i) {
+    ASSERT_EQ(decoded_scene->GetMesh(i).num_faces(),
+              scene->GetMesh(i).num_faces());
+    ASSERT_EQ(decoded_scene->GetMesh(i).num_points(),
+              scene->GetMesh(i).num_points());
+  }
+
+  // The GLB data is appended to the existing content of the output buffer.
+  EncoderBuffer appended_buffer;
+  const std::string prefix = "prefix";
+  ASSERT_TRUE(appended_buffer.Encode(prefix.data(), prefix.size()));
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &appended_buffer));
+  ASSERT_EQ(appended_buffer.size(), prefix.size() + buffer.size());
+  ASSERT_EQ(std::memcmp(appended_buffer.data(), prefix.data(), prefix.size()),
+            0);
+  ASSERT_EQ(std::memcmp(appended_buffer.data() + prefix.size(), buffer.data(),
+                        buffer.size()),
+            0);
+
+  // The GLB data is written directly into external storage of the output.
+  std::vector<char> memory(buffer.size());
+  EncoderBuffer external_buffer;
+  external_buffer.SetExternalStorage(memory.data(), memory.size());
+  DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &external_buffer));
+  ASSERT_EQ(external_buffer.data(), memory.data());
+  ASSERT_EQ(std::memcmp(memory.data(), buffer.data(), buffer.size()), 0);
+}
+
 TEST_F(GltfEncoderTest, CopyrightAssetIsEncoded) {
   // Load scene from file.
   const std::string file_name = "CesiumMilkTruck/glTF/CesiumMilkTruck.gltf";
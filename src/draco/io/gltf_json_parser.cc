@@ -0,0 +1,828 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/gltf_json_parser.h"
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "draco/io/file_utils.h"
+#include "draco/io/json_reader.h"
+
+namespace draco {
+
+namespace {
+
+// Magic number and chunk types of the binary glTF container.
+constexpr uint32_t kGlbMagic = 0x46546C67;      // "glTF"
+constexpr uint32_t kGlbJsonChunk = 0x4E4F534A;  // "JSON"
+constexpr uint32_t kGlbBinChunk = 0x004E4942;   // "BIN\0"
+
+uint32_t ReadUint32(const char *data) {
+  uint32_t value;
+  memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+bool ReadSize(JsonReader *reader, size_t *value) {
+  uint64_t number;
+  if (!reader->ReadUint64(&number)) {
+    return false;
+  }
+  *value = static_cast<size_t>(number);
+  return true;
+}
+
+// Returns true when |index| references one of |num_elements| elements or when
+// |index| is -1 and |optional| is true.
+bool IsValidIndex(int index, size_t num_elements, bool optional) {
+  if (index == -1) {
+    return optional;
+  }
+  return index >= 0 && static_cast<size_t>(index) < num_elements;
+}
+
+// Reads an array of objects into |values|. The keys of each object are read by
+// |parse_object|, which returns false on unsupported keys.
+template <typename T, typename ParseFunctionT>
+bool ParseObjectArray(JsonReader *reader, std::vector<T> *values,
+                      const ParseFunctionT &parse_object) {
+  if (!reader->BeginArray()) {
+    return false;
+  }
+  while (reader->NextElement()) {
+    values->emplace_back();
+    if (!reader->BeginObject() || !parse_object(reader, &values->back())) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+// Reads an object mapping attribute names to accessor indices.
+bool ParseAttributes(JsonReader *reader, std::map<std::string, int> *values) {
+  if (!reader->BeginObject()) {
+    return false;
+  }
+  std::string key;
+  while (reader->NextKey(&key)) {
+    if (!reader->ReadInt(&(*values)[key])) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseAccessorType(JsonReader *reader, int *type) {
+  std::string name;
+  if (!reader->ReadString(&name)) {
+    return false;
+  }
+  if (name == "SCALAR") {
+    *type = TINYGLTF_TYPE_SCALAR;
+  } else if (name == "VEC2") {
+    *type = TINYGLTF_TYPE_VEC2;
+  } else if (name == "VEC3") {
+    *type = TINYGLTF_TYPE_VEC3;
+  } else if (name == "VEC4") {
+    *type = TINYGLTF_TYPE_VEC4;
+  } else if (name == "MAT2") {
+    *type = TINYGLTF_TYPE_MAT2;
+  } else if (name == "MAT3") {
+    *type = TINYGLTF_TYPE_MAT3;
+  } else if (name == "MAT4") {
+    *type = TINYGLTF_TYPE_MAT4;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool ParseAsset(JsonReader *reader, tinygltf::Asset *asset) {
+  if (!reader->BeginObject()) {
+    return false;
+  }
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "version") {
+      parsed = reader->ReadString(&asset->version);
+    } else if (key == "generator") {
+      parsed = reader->ReadString(&asset->generator);
+    } else if (key == "minVersion") {
+      parsed = reader->ReadString(&asset->minVersion);
+    } else if (key == "copyright") {
+      parsed = reader->ReadString(&asset->copyright);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseAccessor(JsonReader *reader, tinygltf::Accessor *accessor) {
+  std::string key;
+  bool has_count = false;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "bufferView") {
+      parsed = reader->ReadInt(&accessor->bufferView);
+    } else if (key == "byteOffset") {
+      parsed = ReadSize(reader, &accessor->byteOffset);
+    } else if (key == "componentType") {
+      parsed = reader->ReadInt(&accessor->componentType);
+    } else if (key == "normalized") {
+      parsed = reader->ReadBool(&accessor->normalized);
+    } else if (key == "count") {
+      parsed = ReadSize(reader, &accessor->count);
+      has_count = true;
+    } else if (key == "type") {
+      parsed = ParseAccessorType(reader, &accessor->type);
+    } else if (key == "min") {
+      parsed = reader->ReadNumberArray(&accessor->minValues);
+    } else if (key == "max") {
+      parsed = reader->ReadNumberArray(&accessor->maxValues);
+    } else if (key == "name") {
+      parsed = reader->ReadString(&accessor->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok() && has_count && accessor->type != -1;
+}
+
+bool ParseBufferView(JsonReader *reader, tinygltf::BufferView *buffer_view) {
+  std::string key;
+  bool has_byte_length = false;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "buffer") {
+      parsed = reader->ReadInt(&buffer_view->buffer);
+    } else if (key == "byteOffset") {
+      parsed = ReadSize(reader, &buffer_view->byteOffset);
+    } else if (key == "byteLength") {
+      parsed = ReadSize(reader, &buffer_view->byteLength);
+      has_byte_length = true;
+    } else if (key == "byteStride") {
+      parsed = ReadSize(reader, &buffer_view->byteStride);
+    } else if (key == "target") {
+      parsed = reader->ReadInt(&buffer_view->target);
+    } else if (key == "name") {
+      parsed = reader->ReadString(&buffer_view->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok() && has_byte_length;
+}
+
+bool ParseBuffer(JsonReader *reader, tinygltf::Buffer *buffer,
+                 size_t *byte_length) {
+  std::string key;
+  bool has_byte_length = false;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "uri") {
+      parsed = reader->ReadString(&buffer->uri);
+    } else if (key == "byteLength") {
+      parsed = ReadSize(reader, byte_length);
+      has_byte_length = true;
+    } else if (key == "name") {
+      parsed = reader->ReadString(&buffer->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok() && has_byte_length;
+}
+
+bool ParsePrimitive(JsonReader *reader, tinygltf::Primitive *primitive) {
+  std::string key;
+  // Triangles are the default mode of glTF primitives.
+  primitive->mode = TINYGLTF_MODE_TRIANGLES;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "attributes") {
+      parsed = ParseAttributes(reader, &primitive->attributes);
+    } else if (key == "indices") {
+      parsed = reader->ReadInt(&primitive->indices);
+    } else if (key == "material") {
+      parsed = reader->ReadInt(&primitive->material);
+    } else if (key == "mode") {
+      parsed = reader->ReadInt(&primitive->mode);
+    } else if (key == "targets") {
+      parsed = reader->BeginArray();
+      while (parsed && reader->NextElement()) {
+        primitive->targets.emplace_back();
+        parsed = ParseAttributes(reader, &primitive->targets.back());
+      }
+      parsed = parsed && reader->ok();
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseMesh(JsonReader *reader, tinygltf::Mesh *mesh) {
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "primitives") {
+      parsed = ParseObjectArray(reader, &mesh->primitives, &ParsePrimitive);
+    } else if (key == "weights") {
+      parsed = reader->ReadNumberArray(&mesh->weights);
+    } else if (key == "name") {
+      parsed = reader->ReadString(&mesh->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseNode(JsonReader *reader, tinygltf::Node *node) {
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "children") {
+      parsed = reader->ReadIntArray(&node->children);
+    } else if (key == "camera") {
+      parsed = reader->ReadInt(&node->camera);
+    } else if (key == "mesh") {
+      parsed = reader->ReadInt(&node->mesh);
+    } else if (key == "skin") {
+      parsed = reader->ReadInt(&node->skin);
+    } else if (key == "matrix") {
+      parsed = reader->ReadNumberArray(&node->matrix);
+    } else if (key == "rotation") {
+      parsed = reader->ReadNumberArray(&node->rotation);
+    } else if (key == "scale") {
+      parsed = reader->ReadNumberArray(&node->scale);
+    } else if (key == "translation") {
+      parsed = reader->ReadNumberArray(&node->translation);
+    } else if (key == "weights") {
+      parsed = reader->ReadNumberArray(&node->weights);
+    } else if (key == "name") {
+      parsed = reader->ReadString(&node->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseScene(JsonReader *reader, tinygltf::Scene *scene) {
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "nodes") {
+      parsed = reader->ReadIntArray(&scene->nodes);
+    } else if (key == "name") {
+      parsed = reader->ReadString(&scene->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseSkin(JsonReader *reader, tinygltf::Skin *skin) {
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "inverseBindMatrices") {
+      parsed = reader->ReadInt(&skin->inverseBindMatrices);
+    } else if (key == "skeleton") {
+      parsed = reader->ReadInt(&skin->skeleton);
+    } else if (key == "joints") {
+      parsed = reader->ReadIntArray(&skin->joints);
+    } else if (key == "name") {
+      parsed = reader->ReadString(&skin->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseAnimationChannel(JsonReader *reader,
+                           tinygltf::AnimationChannel *channel) {
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "sampler") {
+      parsed = reader->ReadInt(&channel->sampler);
+    } else if (key == "target") {
+      parsed = reader->BeginObject();
+      while (parsed && reader->NextKey(&key)) {
+        if (key == "node") {
+          parsed = reader->ReadInt(&channel->target_node);
+        } else if (key == "path") {
+          parsed = reader->ReadString(&channel->target_path);
+        } else {
+          parsed = false;
+        }
+      }
+      parsed = parsed && reader->ok();
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseAnimationSampler(JsonReader *reader,
+                           tinygltf::AnimationSampler *sampler) {
+  std::string key;
+  sampler->interpolation = "LINEAR";
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "input") {
+      parsed = reader->ReadInt(&sampler->input);
+    } else if (key == "output") {
+      parsed = reader->ReadInt(&sampler->output);
+    } else if (key == "interpolation") {
+      parsed = reader->ReadString(&sampler->interpolation);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseAnimation(JsonReader *reader, tinygltf::Animation *animation) {
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "channels") {
+      parsed = ParseObjectArray(reader, &animation->channels,
+                                &ParseAnimationChannel);
+    } else if (key == "samplers") {
+      parsed = ParseObjectArray(reader, &animation->samplers,
+                                &ParseAnimationSampler);
+    } else if (key == "name") {
+      parsed = reader->ReadString(&animation->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+// Parses the common properties of texture info objects. |property_name| and
+// |property| are used for the additional "scale" or "strength" property of
+// normal and occlusion textures.
+bool ParseTextureInfo(JsonReader *reader, int *index, int *tex_coord,
+                      const char *property_name, double *property) {
+  if (!reader->BeginObject()) {
+    return false;
+  }
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "index") {
+      parsed = reader->ReadInt(index);
+    } else if (key == "texCoord") {
+      parsed = reader->ReadInt(tex_coord);
+    } else if (property_name != nullptr && key == property_name) {
+      parsed = reader->ReadNumber(property);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseTextureInfo(JsonReader *reader, tinygltf::TextureInfo *info) {
+  return ParseTextureInfo(reader, &info->index, &info->texCoord, nullptr,
+                          nullptr);
+}
+
+bool ParsePbrMetallicRoughness(JsonReader *reader,
+                               tinygltf::PbrMetallicRoughness *pbr) {
+  if (!reader->BeginObject()) {
+    return false;
+  }
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "baseColorFactor") {
+      parsed = reader->ReadNumberArray(&pbr->baseColorFactor);
+    } else if (key == "baseColorTexture") {
+      parsed = ParseTextureInfo(reader, &pbr->baseColorTexture);
+    } else if (key == "metallicFactor") {
+      parsed = reader->ReadNumber(&pbr->metallicFactor);
+    } else if (key == "roughnessFactor") {
+      parsed = reader->ReadNumber(&pbr->roughnessFactor);
+    } else if (key == "metallicRoughnessTexture") {
+      parsed = ParseTextureInfo(reader, &pbr->metallicRoughnessTexture);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseMaterial(JsonReader *reader, tinygltf::Material *material) {
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "pbrMetallicRoughness") {
+      parsed = ParsePbrMetallicRoughness(reader,
+                                         &material->pbrMetallicRoughness);
+    } else if (key == "normalTexture") {
+      tinygltf::NormalTextureInfo &info = material->normalTexture;
+      parsed = ParseTextureInfo(reader, &info.index, &info.texCoord, "scale",
+                                &info.scale);
+    } else if (key == "occlusionTexture") {
+      tinygltf::OcclusionTextureInfo &info = material->occlusionTexture;
+      parsed = ParseTextureInfo(reader, &info.index, &info.texCoord,
+                                "strength", &info.strength);
+    } else if (key == "emissiveTexture") {
+      parsed = ParseTextureInfo(reader, &material->emissiveTexture);
+    } else if (key == "emissiveFactor") {
+      parsed = reader->ReadNumberArray(&material->emissiveFactor);
+    } else if (key == "alphaMode") {
+      parsed = reader->ReadString(&material->alphaMode);
+    } else if (key == "alphaCutoff") {
+      parsed = reader->ReadNumber(&material->alphaCutoff);
+    } else if (key == "doubleSided") {
+      parsed = reader->ReadBool(&material->doubleSided);
+    } else if (key == "name") {
+      parsed = reader->ReadString(&material->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseTexture(JsonReader *reader, tinygltf::Texture *texture) {
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "sampler") {
+      parsed = reader->ReadInt(&texture->sampler);
+    } else if (key == "source") {
+      parsed = reader->ReadInt(&texture->source);
+    } else if (key == "name") {
+      parsed = reader->ReadString(&texture->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseSampler(JsonReader *reader, tinygltf::Sampler *sampler) {
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "magFilter") {
+      parsed = reader->ReadInt(&sampler->magFilter);
+    } else if (key == "minFilter") {
+      parsed = reader->ReadInt(&sampler->minFilter);
+    } else if (key == "wrapS") {
+      parsed = reader->ReadInt(&sampler->wrapS);
+    } else if (key == "wrapT") {
+      parsed = reader->ReadInt(&sampler->wrapT);
+    } else if (key == "name") {
+      parsed = reader->ReadString(&sampler->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  return reader->ok();
+}
+
+bool ParseImage(JsonReader *reader, tinygltf::Image *image) {
+  std::string key;
+  while (reader->NextKey(&key)) {
+    bool parsed = false;
+    if (key == "uri") {
+      parsed = reader->ReadString(&image->uri);
+    } else if (key == "mimeType") {
+      parsed = reader->ReadString(&image->mimeType);
+    } else if (key == "bufferView") {
+      parsed = reader->ReadInt(&image->bufferView);
+    } else if (key == "name") {
+      parsed = reader->ReadString(&image->name);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  // Data URIs and percent-encoded URIs are decoded only by TinyGLTF.
+  return reader->ok() && image->uri.compare(0, 5, "data:") != 0 &&
+         image->uri.find('%') == std::string::npos;
+}
+
+// Checks that the extension arrays are empty.
+bool ParseExtensionNames(JsonReader *reader) {
+  if (!reader->BeginArray()) {
+    return false;
+  }
+  return !reader->NextElement() && reader->ok();
+}
+
+// Checks that all indices of |model| reference existing elements so that
+// GltfDecoder can use them the same way as the indices validated by TinyGLTF.
+bool ValidateModel(const tinygltf::Model &model) {
+  for (const tinygltf::BufferView &buffer_view : model.bufferViews) {
+    if (!IsValidIndex(buffer_view.buffer, model.buffers.size(), false)) {
+      return false;
+    }
+    const size_t buffer_size = model.buffers[buffer_view.buffer].data.size();
+    if (buffer_view.byteOffset > buffer_size ||
+        buffer_view.byteLength > buffer_size - buffer_view.byteOffset) {
+      return false;
+    }
+    if (buffer_view.byteStride != 0 &&
+        (buffer_view.byteStride < 4 || buffer_view.byteStride > 252)) {
+      return false;
+    }
+  }
+  for (const tinygltf::Accessor &accessor : model.accessors) {
+    // Accessors without buffer views are handled only by TinyGLTF.
+    if (!IsValidIndex(accessor.bufferView, model.bufferViews.size(), false) ||
+        tinygltf::GetComponentSizeInBytes(accessor.componentType) <= 0) {
+      return false;
+    }
+  }
+  const size_t num_accessors = model.accessors.size();
+  for (const tinygltf::Mesh &mesh : model.meshes) {
+    for (const tinygltf::Primitive &primitive : mesh.primitives) {
+      if (!IsValidIndex(primitive.indices, num_accessors, true) ||
+          !IsValidIndex(primitive.material, model.materials.size(), true)) {
+        return false;
+      }
+      for (const auto &attribute : primitive.attributes) {
+        if (!IsValidIndex(attribute.second, num_accessors, false)) {
+          return false;
+        }
+      }
+      for (const auto &target : primitive.targets) {
+        for (const auto &attribute : target) {
+          if (!IsValidIndex(attribute.second, num_accessors, false)) {
+            return false;
+          }
+        }
+      }
+    }
+  }
+  for (const tinygltf::Node &node : model.nodes) {
+    if (!IsValidIndex(node.mesh, model.meshes.size(), true) ||
+        !IsValidIndex(node.skin, model.skins.size(), true)) {
+      return false;
+    }
+    for (const int child : node.children) {
+      if (!IsValidIndex(child, model.nodes.size(), false)) {
+        return false;
+      }
+    }
+  }
+  for (const tinygltf::Scene &scene : model.scenes) {
+    for (const int node : scene.nodes) {
+      if (!IsValidIndex(node, model.nodes.size(), false)) {
+        return false;
+      }
+    }
+  }
+  if (!IsValidIndex(model.defaultScene, model.scenes.size(), true)) {
+    return false;
+  }
+  for (const tinygltf::Skin &skin : model.skins) {
+    if (!IsValidIndex(skin.inverseBindMatrices, num_accessors, true) ||
+        !IsValidIndex(skin.skeleton, model.nodes.size(), true)) {
+      return false;
+    }
+    for (const int joint : skin.joints) {
+      if (!IsValidIndex(joint, model.nodes.size(), false)) {
+        return false;
+      }
+    }
+  }
+  for (const tinygltf::Animation &animation : model.animations) {
+    for (const tinygltf::AnimationChannel &channel : animation.channels) {
+      if (!IsValidIndex(channel.sampler, animation.samplers.size(), false) ||
+          !IsValidIndex(channel.target_node, model.nodes.size(), false)) {
+        return false;
+      }
+    }
+    for (const tinygltf::AnimationSampler &sampler : animation.samplers) {
+      if (!IsValidIndex(sampler.input, num_accessors, false) ||
+          !IsValidIndex(sampler.output, num_accessors, false)) {
+        return false;
+      }
+    }
+  }
+  const size_t num_textures = model.textures.size();
+  for (const tinygltf::Material &material : model.materials) {
+    const tinygltf::PbrMetallicRoughness &pbr = material.pbrMetallicRoughness;
+    if (!IsValidIndex(pbr.baseColorTexture.index, num_textures, true) ||
+        !IsValidIndex(pbr.metallicRoughnessTexture.index, num_textures,
+                      true) ||
+        !IsValidIndex(material.normalTexture.index, num_textures, true) ||
+        !IsValidIndex(material.occlusionTexture.index, num_textures, true) ||
+        !IsValidIndex(material.emissiveTexture.index, num_textures, true)) {
+      return false;
+    }
+  }
+  for (const tinygltf::Texture &texture : model.textures) {
+    if (!IsValidIndex(texture.sampler, model.samplers.size(), true) ||
+        !IsValidIndex(texture.source, model.images.size(), true)) {
+      return false;
+    }
+  }
+  for (const tinygltf::Image &image : model.images) {
+    if (!IsValidIndex(image.bufferView, model.bufferViews.size(), true)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+bool GltfJsonParser::ParseGltf(const char *data, size_t size,
+                               const std::string &file_name,
+                               std::vector<std::string> *input_files,
+                               tinygltf::Model *model) const {
+  return Parse(data, size, nullptr, 0, file_name, input_files, model);
+}
+
+bool GltfJsonParser::ParseGlb(const char *data, size_t size,
+                              const std::string &file_name,
+                              std::vector<std::string> *input_files,
+                              tinygltf::Model *model) const {
+  // The header is followed by the JSON chunk and an optional binary chunk.
+  // Each chunk starts with its length and type.
+  if (size < 20 || ReadUint32(data) != kGlbMagic || ReadUint32(data + 4) != 2) {
+    return false;
+  }
+  const size_t length = ReadUint32(data + 8);
+  if (length > size) {
+    return false;
+  }
+  const size_t json_size = ReadUint32(data + 12);
+  if (ReadUint32(data + 16) != kGlbJsonChunk || json_size > length - 20) {
+    return false;
+  }
+  const char *const json = data + 20;
+  const char *bin_chunk = nullptr;
+  size_t bin_chunk_size = 0;
+  const size_t bin_header_offset = 20 + json_size;
+  if (length - bin_header_offset >= 8) {
+    bin_chunk_size = ReadUint32(data + bin_header_offset);
+    if (ReadUint32(data + bin_header_offset + 4) != kGlbBinChunk ||
+        bin_chunk_size > length - bin_header_offset - 8) {
+      return false;
+    }
+    bin_chunk = data + bin_header_offset + 8;
+  }
+  return Parse(json, json_size, bin_chunk, bin_chunk_size, file_name,
+               input_files, model);
+}
+
+bool GltfJsonParser::Parse(const char *json, size_t json_size,
+                           const char *bin_chunk, size_t bin_chunk_size,
+                           const std::string &file_name,
+                           std::vector<std::string> *input_files,
+                           tinygltf::Model *model) const {
+  tinygltf::Model parsed_model;
+  std::vector<size_t> buffer_lengths;
+  bool has_asset = false;
+  JsonReader reader(json, json_size);
+  if (!reader.BeginObject()) {
+    return false;
+  }
+  std::string key;
+  while (reader.NextKey(&key)) {
+    bool parsed = false;
+    if (key == "asset") {
+      parsed = ParseAsset(&reader, &parsed_model.asset);
+      has_asset = true;
+    } else if (key == "scene") {
+      parsed = reader.ReadInt(&parsed_model.defaultScene);
+    } else if (key == "scenes") {
+      parsed = ParseObjectArray(&reader, &parsed_model.scenes, &ParseScene);
+    } else if (key == "nodes") {
+      parsed = ParseObjectArray(&reader, &parsed_model.nodes, &ParseNode);
+    } else if (key == "meshes") {
+      parsed = ParseObjectArray(&reader, &parsed_model.meshes, &ParseMesh);
+    } else if (key == "accessors") {
+      parsed =
+          ParseObjectArray(&reader, &parsed_model.accessors, &ParseAccessor);
+    } else if (key == "bufferViews") {
+      parsed = ParseObjectArray(&reader, &parsed_model.bufferViews,
+                                &ParseBufferView);
+    } else if (key == "buffers") {
+      parsed = ParseObjectArray(
+          &reader, &parsed_model.buffers,
+          [&buffer_lengths](JsonReader *buffer_reader,
+                            tinygltf::Buffer *buffer) {
+            buffer_lengths.push_back(0);
+            return ParseBuffer(buffer_reader, buffer, &buffer_lengths.back());
+          });
+    } else if (key == "materials") {
+      parsed =
+          ParseObjectArray(&reader, &parsed_model.materials, &ParseMaterial);
+    } else if (key == "textures") {
+      parsed = ParseObjectArray(&reader, &parsed_model.textures, &ParseTexture);
+    } else if (key == "samplers") {
+      parsed = ParseObjectArray(&reader, &parsed_model.samplers, &ParseSampler);
+    } else if (key == "images") {
+      // Image data is decoded only by TinyGLTF.
+      parsed = ParseObjectArray(&reader, &parsed_model.images, &ParseImage) &&
+               (skip_images_ || parsed_model.images.empty());
+    } else if (key == "skins") {
+      parsed = ParseObjectArray(&reader, &parsed_model.skins, &ParseSkin);
+    } else if (key == "animations") {
+      parsed =
+          ParseObjectArray(&reader, &parsed_model.animations, &ParseAnimation);
+    } else if (key == "cameras") {
+      // Cameras are not used by GltfDecoder.
+      parsed = reader.SkipValue();
+    } else if (key == "extensionsUsed" || key == "extensionsRequired") {
+      parsed = ParseExtensionNames(&reader);
+    }
+    if (!parsed) {
+      return false;
+    }
+  }
+  if (!reader.AtEnd() || !has_asset) {
+    return false;
+  }
+
+  // Load the binary data of all buffers.
+  std::vector<std::string> buffer_files;
+  for (size_t i = 0; i < parsed_model.buffers.size(); ++i) {
+    tinygltf::Buffer &buffer = parsed_model.buffers[i];
+    const size_t byte_length = buffer_lengths[i];
+    if (buffer.uri.empty()) {
+      // Only the first buffer of a .glb asset may reference the binary chunk.
+      if (i != 0 || bin_chunk == nullptr || byte_length > bin_chunk_size) {
+        return false;
+      }
+      buffer.data.assign(bin_chunk, bin_chunk + byte_length);
+      continue;
+    }
+    if (buffer.uri.compare(0, 5, "data:") == 0 ||
+        buffer.uri.find('%') != std::string::npos) {
+      return false;
+    }
+    const std::string path = GetFullPath(buffer.uri, file_name);
+    if (!ReadFileToBuffer(path, &buffer.data) ||
+        buffer.data.size() != byte_length) {
+      return false;
+    }
+    buffer_files.push_back(path);
+  }
+  if (!ValidateModel(parsed_model)) {
+    return false;
+  }
+  *model = std::move(parsed_model);
+  if (input_files) {
+    input_files->insert(input_files->end(), buffer_files.begin(),
+                        buffer_files.end());
+  }
+  return true;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_TRANSCODER_SUPPORTED
@@ -0,0 +1,74 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_GLTF_JSON_PARSER_H_
+#define DRACO_IO_GLTF_JSON_PARSER_H_
+
+#include "draco/draco_features.h"
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "draco/io/tiny_gltf_utils.h"
+
+namespace draco {
+
+// Parses glTF 2.0 assets directly into tinygltf::Model. The JSON is read with
+// JsonReader in a single pass, without building the JSON document tree that
+// TinyGLTF creates before filling the model.
+//
+// Only the core glTF schema is supported and cameras are ignored. Assets that
+// use extensions, extras, sparse accessors, data URIs, percent-encoded URIs or
+// images (unless images are skipped) are rejected, as well as any malformed
+// asset. The caller
+// is expected to fall back to TinyGLTF in that case, which handles all of the
+// features and reports errors of the malformed assets.
+class GltfJsonParser {
+ public:
+  GltfJsonParser() : skip_images_(false) {}
+
+  // When set, images are parsed without reading or decoding the image data,
+  // which mirrors GltfDecoder::SetSkipTextures().
+  void SetSkipImages(bool skip_images) { skip_images_ = skip_images; }
+
+  // Parses a .gltf asset stored in |data|. External buffers are read relative
+  // to the directory of |file_name|, which may be empty for assets that are
+  // not stored in a file. Paths of the external buffers are appended to
+  // |input_files| when it is not null. Returns false when the asset is not
+  // supported. |model| and |input_files| are modified only on success.
+  bool ParseGltf(const char *data, size_t size, const std::string &file_name,
+                 std::vector<std::string> *input_files,
+                 tinygltf::Model *model) const;
+
+  // Same as ParseGltf() for a .glb asset. The first buffer without an URI
+  // references the binary chunk of the asset.
+  bool ParseGlb(const char *data, size_t size, const std::string &file_name,
+                std::vector<std::string> *input_files,
+                tinygltf::Model *model) const;
+
+ private:
+  bool Parse(const char *json, size_t json_size, const char *bin_chunk,
+             size_t bin_chunk_size, const std::string &file_name,
+             std::vector<std::string> *input_files,
+             tinygltf::Model *model) const;
+
+  bool skip_images_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_TRANSCODER_SUPPORTED
+#endif  // DRACO_IO_GLTF_JSON_PARSER_H_
@@ -14,6 +14,7 @@
 //
 #include "draco/io/gltf_utils.h"
 
+#include <charconv>
 #include <ostream>
 #include <string>
 
@@ -39,62 +40,50 @@ std::ostream &operator<<(std::ostream &os, const Indent &indent) {
   return os << indent.indent_;
 }
 
-std::ostream &operator<<(std::ostream &os,
-                         const JsonWriter::IndentWrapper &indent) {
-  if (indent.writer.mode_ == JsonWriter::READABLE) {
-    os << indent.writer.indent_writer_;
-  }
-  return os;
-}
-
-std::ostream &operator<<(std::ostream &os,
-                         const JsonWriter::Separator &separator) {
-  if (separator.writer.mode_ == JsonWriter::READABLE) {
-    os << " ";
-  }
-  return os;
-}
-
 void JsonWriter::Reset() {
   last_type_ = START;
   o_.clear();
-  o_.str("");
 }
 
 void JsonWriter::BeginObject() { BeginObject(""); }
 
 void JsonWriter::BeginObject(const std::string &name) {
   FinishPreviousLine(BEGIN);
-  o_ << indent_;
+  AppendIndent();
   if (!name.empty()) {
-    o_ << "\"" << name << "\":" << separator_;
+    AppendName(name);
   }
-  o_ << "{";
+  o_ += '{';
   indent_writer_.Increase();
 }
 
 void JsonWriter::EndObject() {
   FinishPreviousLine(END);
   indent_writer_.Decrease();
-  o_ << indent_ << "}";
+  AppendIndent();
+  o_ += '}';
 }
 
 void JsonWriter::BeginArray() {
   FinishPreviousLine(BEGIN);
-  o_ << indent_ << "[";
+  AppendIndent();
+  o_ += '[';
   indent_writer_.Increase();
 }
 
 void JsonWriter::BeginArray(const std::string &name) {
   FinishPreviousLine(BEGIN);
-  o_ << indent_ << "\"" << name << "\":" << separator_ << "[";
+  AppendIndent();
+  AppendName(name);
+  o_ += '[';
   indent_writer_.Increase();
 }
 
 void JsonWriter::EndArray() {
   FinishPreviousLine(END);
   indent_writer_.Decrease();
-  o_ << indent_ << "]";
+  AppendIndent();
+  o_ += ']';
 }
 
 void JsonWriter::FinishPreviousLine(OutputType curr_type) {
@@ -103,56 +92,80 @@ void JsonWriter::FinishPreviousLine(OutputType curr_type) {
         (last_type_ == VALUE && curr_type == BEGIN) ||
         (last_type_ == END && curr_type == BEGIN) ||
         (last_type_ == END && curr_type == VALUE)) {
-      o_ << ",";
+      o_ += ',';
     }
     if (mode_ == READABLE) {
-      o_ << std::endl;
+      o_ += '\n';
     }
   }
   last_type_ = curr_type;
 }
 
 std::string JsonWriter::MoveData() {
-  const std::string str = o_.str();
-  o_.str("");
+  std::string str = std::move(o_);
+  o_.clear();
+  o_.reserve(kInitialCapacity);
   return str;
 }
 
-std::string JsonWriter::EscapeCharacter(const std::string &str,
-                                        const char character) {
-  size_t start = 0;
-  if ((start = str.find(character, start)) != std::string::npos) {
-    std::string s = str;
-    std::string escaped_character = "\\";
-    escaped_character += character;
-    do {
-      s.replace(start, 1, escaped_character);
-      start += escaped_character.length();
-    } while ((start = s.find(character, start)) != std::string::npos);
-    return s;
+void JsonWriter::AppendString(const std::string &str) {
+  o_ += '"';
+  size_t begin = 0;
+  for (size_t i = 0; i < str.size(); ++i) {
+    char escaped;
+    switch (str[i]) {
+      case '\\':
+        escaped = '\\';
+        break;
+      case '\b':
+        escaped = '\b';
+        break;
+      case '\f':
+        escaped = '\f';
+        break;
+      case '\n':
+        escaped = '\n';
+        break;
+      case '\r':
+        escaped = '\r';
+        break;
+      case '\t':
+        escaped = '\t';
+        break;
+      case '"':
+        escaped = '"';
+        break;
+      default:
+        continue;
+    }
+    o_.append(str, begin, i - begin);
+    o_ += '\\';
+    o_ += escaped;
+    begin = i + 1;
   }
-  return str;
+  o_.append(str, begin, std::string::npos);
+  o_ += '"';
+}
+
+void JsonWriter::AppendInteger(int64_t value) {
+  char buffer[24];
+  const std::to_chars_result result =
+      std::to_chars(buffer, buffer + sizeof(buffer), value);
+  o_.append(buffer, result.ptr);
+}
+
+void JsonWriter::AppendInteger(uint64_t value) {
+  char buffer[24];
+  const std::to_chars_result result =
+      std::to_chars(buffer, buffer + sizeof(buffer), value);
+  o_.append(buffer, result.ptr);
 }
 
-std::string JsonWriter::EscapeJsonSpecialCharacters(const std::string &str) {
-  std::string s = str;
-  const char backspace = '\b';
-  const char form_feed = '\f';
-  const char newline = '\n';
-  const char carriage_return = '\r';
-  const char tab = '\t';
-  const char double_quote = '\"';
-  const char backslash = '\\';
-
-  // Backslash must come first.
-  s = EscapeCharacter(s, backslash);
-  s = EscapeCharacter(s, backspace);
-  s = EscapeCharacter(s, form_feed);
-  s = EscapeCharacter(s, newline);
-  s = EscapeCharacter(s, carriage_return);
-  s = EscapeCharacter(s, tab);
-  s = EscapeCharacter(s, double_quote);
-  return s;
+void JsonWriter::AppendDouble(double value) {
+  char buffer[32];
+  const std::to_chars_result result =
+      std::to_chars(buffer, buffer + sizeof(buffer), value);
+  o_.append(buffer, result.ptr);
 }
 
 }  // namespace draco
@@ -18,9 +18,10 @@
 #include "draco/draco_features.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
-#include <iomanip>
-#include <sstream>
+#include <cstdint>
+#include <ostream>
 #include <string>
+#include <type_traits>
 
 namespace draco {
 
@@ -48,6 +49,7 @@ class GltfValue {
       : type_(DOUBLE), value_int_(-1), value_double_(value) {}
 
   friend std::ostream &operator<<(std::ostream &os, const GltfValue &value);
+  friend class JsonWriter;
 
  private:
   ValueType type_;
@@ -65,23 +67,29 @@ class Indent {
 
   friend std::ostream &operator<<(std::ostream &os, const Indent &indent);
 
+  const std::string &str() const { return indent_; }
+
  private:
   // Variables used for spacing of the glTF file.
   std::string indent_;
   const int indent_space_count_;
 };
 
-// Class used to keep track of the json state.
+// Class used to keep track of the json state. The output is appended to a
+// preallocated string. Integers and floating point values are formatted
+// directly into the string without going through a stream. Floating point
+// values are written with the shortest representation that round-trips.
 class JsonWriter {
  public:
   enum OutputType { START, BEGIN, END, VALUE };
   enum Mode { READABLE, COMPACT };
 
-  JsonWriter()
-      : last_type_(START), mode_(READABLE), indent_(*this), separator_(*this) {}
+  JsonWriter() : last_type_(START), mode_(READABLE) {
+    o_.reserve(kInitialCapacity);
+  }
   void SetMode(Mode mode) { mode_ = mode; }
 
-  // Clear the stringstream and set last type to START.
+  // Clear the output and set last type to START.
   void Reset();
 
   // Every call to BeginObject should have a matching call to EndObject.
@@ -97,88 +105,120 @@ class JsonWriter {
   template <typename T>
   void OutputValue(const T &value) {
     FinishPreviousLine(VALUE);
-    o_ << indent_ << std::setprecision(17) << value;
+    AppendIndent();
+    Append(value);
   }
 
   void OutputValue(const bool &value) {
     FinishPreviousLine(VALUE);
-    o_ << indent_ << ToString(value);
+    AppendIndent();
+    o_ += ToString(value);
   }
 
   void OutputValue(const std::string &name) {
-    const std::string escaped_name = EscapeJsonSpecialCharacters(name);
     FinishPreviousLine(VALUE);
-    o_ << indent_ << "\"" << escaped_name << "\"";
+    AppendIndent();
+    AppendString(name);
   }
 
   void OutputValue(const std::string &name, const std::string &value) {
-    const std::string escaped_name = EscapeJsonSpecialCharacters(name);
-    const std::string escaped_value = EscapeJsonSpecialCharacters(value);
     FinishPreviousLine(VALUE);
-    o_ << indent_ << "\"" << escaped_name << "\":" << separator_ << "\""
-       << escaped_value << "\"";
+    AppendIndent();
+    AppendName(name);
+    AppendString(value);
   }
 
   void OutputValue(const std::string &name, const char *value) {
-    const std::string escaped_name = EscapeJsonSpecialCharacters(name);
-    const std::string escaped_value = EscapeJsonSpecialCharacters(value);
     FinishPreviousLine(VALUE);
-    o_ << indent_ << "\"" << escaped_name << "\":" << separator_ << "\""
-       << escaped_value << "\"";
+    AppendIndent();
+    AppendName(name);
+    AppendString(value);
   }
 
   template <typename T>
   void OutputValue(const std::string &name, const T &value) {
-    const std::string escaped_name = EscapeJsonSpecialCharacters(name);
     FinishPreviousLine(VALUE);
-    o_ << indent_ << "\"" << escaped_name << "\":" << separator_ << value;
+    AppendIndent();
+    AppendName(name);
+    Append(value);
   }
 
   void OutputValue(const std::string &name, const bool &value) {
-    const std::string escaped_name = EscapeJsonSpecialCharacters(name);
     FinishPreviousLine(VALUE);
-    o_ << indent_ << "\"" << escaped_name << "\":" << separator_
-       << ToString(value);
+    AppendIndent();
+    AppendName(name);
+    o_ += ToString(value);
   }
 
-  // Return the current output and then clear the stringstream.
+  // Return the current output and then clear the output.
   std::string MoveData();
 
  private:
+  // Initial capacity of the output. Large scenes grow the output
+  // geometrically from here.
+  static constexpr size_t kInitialCapacity = 1 << 16;
+
   // Check if a comma needs to be added to the output and then add a new line.
   void FinishPreviousLine(OutputType curr_type);
 
-  // Returns a string escaping all instances of |character| in |str|.
-  std::string EscapeCharacter(const std::string &str, const char character);
+  // Appends the indentation of the current line in READABLE mode.
+  void AppendIndent() {
+    if (mode_ == READABLE) {
+      o_ += indent_writer_.str();
+    }
+  }
+
+  // Appends the separator between a name and a value in READABLE mode.
+  void AppendSeparator() {
+    if (mode_ == READABLE) {
+      o_ += ' ';
+    }
+  }
+
+  // Appends the escaped and quoted |name| followed by a colon.
+  void AppendName(const std::string &name) {
+    AppendString(name);
+    o_ += ':';
+    AppendSeparator();
+  }
 
-  // Returns a string escaping all of the Json special characters in |str|.
-  // Carriage return is not handled.
-  std::string EscapeJsonSpecialCharacters(const std::string &str);
+  // Appends the escaped and quoted |str|. Characters escaped are backslash,
+  // backspace, form feed, newline, carriage return, tab and double quote.
+  void AppendString(const std::string &str);
+
+  void AppendInteger(int64_t value);
+  void AppendInteger(uint64_t value);
+  void AppendDouble(double value);
+
+  void Append(const GltfValue &value) {
+    if (value.type_ == GltfValue::INT) {
+      AppendInteger(value.value_int_);
+    } else {
+      AppendDouble(value.value_double_);
+    }
+  }
+
+  template <typename T>
+  void Append(const T &value) {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Unsupported json value type.");
+    if constexpr (std::is_floating_point<T>::value) {
+      AppendDouble(value);
+    } else if constexpr (std::is_enum<T>::value ||
+                         std::is_signed<T>::value) {
+      AppendInteger(static_cast<int64_t>(value));
+    } else {
+      AppendInteger(static_cast<uint64_t>(value));
+    }
+  }
 
   // Returns string representation of a Boolean |value|.
-  static std::string ToString(bool value) { return value ? "true" : "false"; }
-
-  // Helper struct used for conditional indent writing to the output stream.
-  struct IndentWrapper {
-    explicit IndentWrapper(const JsonWriter &writer) : writer(writer) {}
-    const JsonWriter &writer;
-  };
-  friend std::ostream &operator<<(std::ostream &os,
-                                  const IndentWrapper &indent);
-
-  // Helper struct used for conditional separator writing to the output stream.
-  struct Separator {
-    explicit Separator(const JsonWriter &writer) : writer(writer) {}
-    const JsonWriter &writer;
-  };
-  friend std::ostream &operator<<(std::ostream &os, const Separator &separator);
-
-  std::stringstream o_;
+  static const char *ToString(bool value) { return value ? "true" : "false"; }
+
+  std::string o_;
   Indent indent_writer_;
   OutputType last_type_;
   Mode mode_;
-  IndentWrapper indent_;
-  Separator separator_;
 };
 
 }  // namespace draco
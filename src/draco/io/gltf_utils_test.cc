@@ -289,6 +289,26 @@ TEST_F(GltfUtilsTest, TestGltfValues) {
   CompareGolden(&json_writer, "0.10000000149011612,\n1");
 }
 
+TEST_F(GltfUtilsTest, TestNumberFormatting) {
+  // Tests that doubles are written with the shortest representation that
+  // round-trips and that integers of all widths are written in full.
+  JsonWriter json_writer;
+  json_writer.SetMode(JsonWriter::COMPACT);
+  json_writer.OutputValue(0.1);
+  json_writer.OutputValue(1e21);
+  json_writer.OutputValue(-2.5e-7);
+  json_writer.OutputValue(std::numeric_limits<int64_t>::min());
+  json_writer.OutputValue(std::numeric_limits<uint64_t>::max());
+  CompareGolden(&json_writer,
+                "0.1,1e+21,-2.5e-07,-9223372036854775808,"
+                "18446744073709551615");
+
+  json_writer.Reset();
+  const double value = 0.123456789012345678;
+  json_writer.OutputValue(value);
+  ASSERT_EQ(std::stod(json_writer.MoveData()), value);
+}
+
 TEST_F(GltfUtilsTest, TestObjectsCompact) {
   JsonWriter json_writer;
   json_writer.SetMode(JsonWriter::COMPACT);
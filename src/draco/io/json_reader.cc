@@ -0,0 +1,461 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/json_reader.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace draco {
+
+JsonReader::JsonReader(const char *data, size_t size)
+    : data_(data), size_(size), pos_(0), ok_(true), first_(true) {}
+
+bool JsonReader::BeginObject() {
+  if (!ok_) {
+    return false;
+  }
+  SkipWhitespace();
+  if (closers_.size() >= kMaxDepth || !Consume('{')) {
+    return Fail();
+  }
+  closers_.push_back('}');
+  first_ = true;
+  return true;
+}
+
+bool JsonReader::NextKey(std::string *key) {
+  if (!ok_ || closers_.empty() || closers_.back() != '}') {
+    return Fail();
+  }
+  SkipWhitespace();
+  if (Consume('}')) {
+    closers_.pop_back();
+    first_ = false;
+    return false;
+  }
+  if (!first_) {
+    if (!Consume(',')) {
+      return Fail();
+    }
+    SkipWhitespace();
+  }
+  first_ = false;
+  if (!ParseString(key)) {
+    return Fail();
+  }
+  SkipWhitespace();
+  if (!Consume(':')) {
+    return Fail();
+  }
+  return true;
+}
+
+bool JsonReader::BeginArray() {
+  if (!ok_) {
+    return false;
+  }
+  SkipWhitespace();
+  if (closers_.size() >= kMaxDepth || !Consume('[')) {
+    return Fail();
+  }
+  closers_.push_back(']');
+  first_ = true;
+  return true;
+}
+
+bool JsonReader::NextElement() {
+  if (!ok_ || closers_.empty() || closers_.back() != ']') {
+    return Fail();
+  }
+  SkipWhitespace();
+  if (Consume(']')) {
+    closers_.pop_back();
+    first_ = false;
+    return false;
+  }
+  if (!first_ && !Consume(',')) {
+    return Fail();
+  }
+  first_ = false;
+  return true;
+}
+
+bool JsonReader::ReadString(std::string *value) {
+  if (!ok_) {
+    return false;
+  }
+  SkipWhitespace();
+  return ParseString(value) || Fail();
+}
+
+bool JsonReader::ReadNumber(double *value) {
+  if (!ok_) {
+    return false;
+  }
+  SkipWhitespace();
+  return ParseNumber(value) || Fail();
+}
+
+bool JsonReader::ReadInt(int *value) {
+  double number;
+  if (!ReadNumber(&number)) {
+    return false;
+  }
+  if (number != std::floor(number) ||
+      number < std::numeric_limits<int>::min() ||
+      number > std::numeric_limits<int>::max()) {
+    return Fail();
+  }
+  *value = static_cast<int>(number);
+  return true;
+}
+
+bool JsonReader::ReadUint64(uint64_t *value) {
+  double number;
+  if (!ReadNumber(&number)) {
+    return false;
+  }
+  // Integers above 2^53 cannot be represented exactly by doubles.
+  if (number != std::floor(number) || number < 0 ||
+      number > 9007199254740992.0) {
+    return Fail();
+  }
+  *value = static_cast<uint64_t>(number);
+  return true;
+}
+
+bool JsonReader::ReadBool(bool *value) {
+  if (!ok_) {
+    return false;
+  }
+  SkipWhitespace();
+  if (ParseLiteral("true")) {
+    *value = true;
+    return true;
+  }
+  if (ParseLiteral("false")) {
+    *value = false;
+    return true;
+  }
+  return Fail();
+}
+
+bool JsonReader::ReadNumberArray(std::vector<double> *values) {
+  values->clear();
+  if (!BeginArray()) {
+    return false;
+  }
+  while (NextElement()) {
+    double value;
+    if (!ReadNumber(&value)) {
+      return false;
+    }
+    values->push_back(value);
+  }
+  return ok_;
+}
+
+bool JsonReader::ReadIntArray(std::vector<int> *values) {
+  values->clear();
+  if (!BeginArray()) {
+    return false;
+  }
+  while (NextElement()) {
+    int value;
+    if (!ReadInt(&value)) {
+      return false;
+    }
+    values->push_back(value);
+  }
+  return ok_;
+}
+
+bool JsonReader::SkipValue() {
+  switch (PeekValueType()) {
+    case OBJECT: {
+      if (!BeginObject()) {
+        return false;
+      }
+      std::string key;
+      while (NextKey(&key)) {
+        if (!SkipValue()) {
+          return false;
+        }
+      }
+      return ok_;
+    }
+    case ARRAY: {
+      if (!BeginArray()) {
+        return false;
+      }
+      while (NextElement()) {
+        if (!SkipValue()) {
+          return false;
+        }
+      }
+      return ok_;
+    }
+    case STRING: {
+      std::string value;
+      return ReadString(&value);
+    }
+    case NUMBER: {
+      double value;
+      return ReadNumber(&value);
+    }
+    case BOOLEAN: {
+      bool value;
+      return ReadBool(&value);
+    }
+    case NULL_VALUE:
+      return ParseLiteral("null") || Fail();
+    default:
+      return Fail();
+  }
+}
+
+JsonReader::ValueType JsonReader::PeekValueType() {
+  if (!ok_) {
+    return INVALID;
+  }
+  SkipWhitespace();
+  if (pos_ >= size_) {
+    return INVALID;
+  }
+  const char c = data_[pos_];
+  switch (c) {
+    case '{':
+      return OBJECT;
+    case '[':
+      return ARRAY;
+    case '"':
+      return STRING;
+    case 't':
+    case 'f':
+      return BOOLEAN;
+    case 'n':
+      return NULL_VALUE;
+    default:
+      if (c == '-' || (c >= '0' && c <= '9')) {
+        return NUMBER;
+      }
+      return INVALID;
+  }
+}
+
+bool JsonReader::AtEnd() {
+  SkipWhitespace();
+  return ok_ && closers_.empty() && pos_ == size_;
+}
+
+void JsonReader::SkipWhitespace() {
+  while (pos_ < size_) {
+    const char c = data_[pos_];
+    if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+      return;
+    }
+    ++pos_;
+  }
+}
+
+bool JsonReader::Consume(char c) {
+  if (pos_ < size_ && data_[pos_] == c) {
+    ++pos_;
+    return true;
+  }
+  return false;
+}
+
+bool JsonReader::ParseString(std::string *value) {
+  if (!Consume('"')) {
+    return false;
+  }
+  value->clear();
+  while (true) {
+    // Copy the run of characters up to the next quote or escape at once.
+    size_t end = pos_;
+    while (end < size_ && data_[end] != '"' && data_[end] != '\\' &&
+           static_cast<unsigned char>(data_[end]) >= 0x20) {
+      ++end;
+    }
+    value->append(data_ + pos_, end - pos_);
+    pos_ = end;
+    if (pos_ >= size_) {
+      return false;
+    }
+    const char c = data_[pos_++];
+    if (c == '"') {
+      return true;
+    }
+    if (c != '\\' || pos_ >= size_) {
+      // Unescaped control character or a truncated escape sequence.
+      return false;
+    }
+    switch (data_[pos_++]) {
+      case '"':
+        value->push_back('"');
+        break;
+      case '\\':
+        value->push_back('\\');
+        break;
+      case '/':
+        value->push_back('/');
+        break;
+      case 'b':
+        value->push_back('\b');
+        break;
+      case 'f':
+        value->push_back('\f');
+        break;
+      case 'n':
+        value->push_back('\n');
+        break;
+      case 'r':
+        value->push_back('\r');
+        break;
+      case 't':
+        value->push_back('\t');
+        break;
+      case 'u':
+        if (!ParseUnicodeEscape(value)) {
+          return false;
+        }
+        break;
+      default:
+        return false;
+    }
+  }
+}
+
+bool JsonReader::ParseUnicodeEscape(std::string *value) {
+  uint32_t code_point;
+  if (!ParseHex4(&code_point)) {
+    return false;
+  }
+  if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+    // High surrogate must be followed by an escaped low surrogate.
+    uint32_t low;
+    if (!Consume('\\') || !Consume('u') || !ParseHex4(&low) || low < 0xDC00 ||
+        low > 0xDFFF) {
+      return false;
+    }
+    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+  } else if (code_point >= 0xDC00 && code_point <= 0xDFFF) {
+    return false;
+  }
+  // Encode |code_point| as UTF-8.
+  if (code_point < 0x80) {
+    value->push_back(static_cast<char>(code_point));
+  } else if (code_point < 0x800) {
+    value->push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+    value->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else if (code_point < 0x10000) {
+    value->push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+    value->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    value->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else {
+    value->push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+    value->push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+    value->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    value->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+  return true;
+}
+
+bool JsonReader::ParseHex4(uint32_t *value) {
+  if (size_ - pos_ < 4) {
+    return false;
+  }
+  *value = 0;
+  for (int i = 0; i < 4; ++i) {
+    const char c = data_[pos_++];
+    uint32_t digit;
+    if (c >= '0' && c <= '9') {
+      digit = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      digit = c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      digit = c - 'A' + 10;
+    } else {
+      return false;
+    }
+    *value = (*value << 4) | digit;
+  }
+  return true;
+}
+
+bool JsonReader::ParseNumber(double *value) {
+  // Validate the JSON number grammar first because std::from_chars() accepts
+  // a superset of it (e.g. leading zeros, "inf" and "nan").
+  const size_t start = pos_;
+  size_t p = pos_;
+  const auto is_digit = [this](size_t i) {
+    return i < size_ && data_[i] >= '0' && data_[i] <= '9';
+  };
+  if (p < size_ && data_[p] == '-') {
+    ++p;
+  }
+  if (!is_digit(p)) {
+    return false;
+  }
+  if (data_[p] == '0') {
+    ++p;
+  } else {
+    while (is_digit(p)) {
+      ++p;
+    }
+  }
+  if (p < size_ && data_[p] == '.') {
+    ++p;
+    if (!is_digit(p)) {
+      return false;
+    }
+    while (is_digit(p)) {
+      ++p;
+    }
+  }
+  if (p < size_ && (data_[p] == 'e' || data_[p] == 'E')) {
+    ++p;
+    if (p < size_ && (data_[p] == '+' || data_[p] == '-')) {
+      ++p;
+    }
+    if (!is_digit(p)) {
+      return false;
+    }
+    while (is_digit(p)) {
+      ++p;
+    }
+  }
+  const std::from_chars_result result =
+      std::from_chars(data_ + start, data_ + p, *value);
+  if (result.ec != std::errc() || result.ptr != data_ + p) {
+    return false;
+  }
+  pos_ = p;
+  return true;
+}
+
+bool JsonReader::ParseLiteral(const char *literal) {
+  const size_t length = strlen(literal);
+  if (size_ - pos_ < length || memcmp(data_ + pos_, literal, length) != 0) {
+    return false;
+  }
+  pos_ += length;
+  return true;
+}
+
+}  // namespace draco
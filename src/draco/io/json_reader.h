@@ -0,0 +1,127 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_JSON_READER_H_
+#define DRACO_IO_JSON_READER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace draco {
+
+// Pull parser for JSON documents stored in a contiguous buffer. Values are
+// read in document order directly into the caller's data structures, so no
+// document tree is built. The caller drives the parsing:
+//
+//   JsonReader reader(data, size);
+//   std::string key;
+//   if (reader.BeginObject()) {
+//     while (reader.NextKey(&key)) {
+//       if (key == "count") {
+//         reader.ReadInt(&count);
+//       } else {
+//         reader.SkipValue();
+//       }
+//     }
+//   }
+//   if (!reader.ok() || !reader.AtEnd()) { ... }
+//
+// Any syntax error or a value of an unexpected type puts the reader into an
+// error state in which all methods return false.
+class JsonReader {
+ public:
+  enum ValueType {
+    OBJECT,
+    ARRAY,
+    STRING,
+    NUMBER,
+    BOOLEAN,
+    NULL_VALUE,
+    INVALID,
+  };
+
+  JsonReader(const char *data, size_t size);
+
+  // Starts reading of an object. Keys of the object are then read with
+  // NextKey() until it returns false.
+  bool BeginObject();
+
+  // Reads the next key of the current object into |key|. Returns false after
+  // the last key, when the object has been closed, or on error. The value of
+  // the key must be read or skipped before the next call.
+  bool NextKey(std::string *key);
+
+  // Starts reading of an array. Each element of the array must be read or
+  // skipped after NextElement() returns true.
+  bool BeginArray();
+
+  // Returns true when the current array has another element. Returns false
+  // after the last element, when the array has been closed, or on error.
+  bool NextElement();
+
+  bool ReadString(std::string *value);
+  bool ReadNumber(double *value);
+  // Reads a number that must be integral and representable by |value|.
+  bool ReadInt(int *value);
+  bool ReadUint64(uint64_t *value);
+  bool ReadBool(bool *value);
+
+  // Reads an array of numbers into |values|.
+  bool ReadNumberArray(std::vector<double> *values);
+  // Reads an array of integers into |values|.
+  bool ReadIntArray(std::vector<int> *values);
+
+  // Skips the next value including all of its nested values.
+  bool SkipValue();
+
+  // Returns the type of the next value without consuming it.
+  ValueType PeekValueType();
+
+  // Returns true when all of the input has been read, ignoring trailing
+  // whitespace.
+  bool AtEnd();
+
+  bool ok() const { return ok_; }
+
+  // Maximum nesting depth of objects and arrays.
+  static constexpr int kMaxDepth = 512;
+
+ private:
+  void SkipWhitespace();
+  bool Consume(char c);
+  bool ParseString(std::string *value);
+  bool ParseUnicodeEscape(std::string *value);
+  bool ParseHex4(uint32_t *value);
+  bool ParseNumber(double *value);
+  bool ParseLiteral(const char *literal);
+  bool Fail() {
+    ok_ = false;
+    return false;
+  }
+
+  const char *const data_;
+  const size_t size_;
+  size_t pos_;
+  bool ok_;
+  // True when no element or key has been read from the innermost container.
+  bool first_;
+  // Closing characters of the open containers.
+  std::vector<char> closers_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_JSON_READER_H_
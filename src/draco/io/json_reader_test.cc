@@ -0,0 +1,120 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/json_reader.h"
+
+#include <string>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+draco::JsonReader CreateReader(const std::string &json) {
+  return draco::JsonReader(json.data(), json.size());
+}
+
+TEST(JsonReaderTest, TestObject) {
+  const std::string json =
+      "{ \"name\": \"te\\\"st\\u00e9\\ud83d\\ude00\", \"count\": 42,\n"
+      "  \"values\": [1, -2.5, 3e2], \"flag\": true,\n"
+      "  \"ignored\": {\"a\": [null, {}, []], \"b\": false} }";
+  draco::JsonReader reader = CreateReader(json);
+  std::string name;
+  int count = 0;
+  std::vector<double> values;
+  bool flag = false;
+  std::string key;
+  ASSERT_TRUE(reader.BeginObject());
+  while (reader.NextKey(&key)) {
+    if (key == "name") {
+      ASSERT_TRUE(reader.ReadString(&name));
+    } else if (key == "count") {
+      ASSERT_TRUE(reader.ReadInt(&count));
+    } else if (key == "values") {
+      ASSERT_TRUE(reader.ReadNumberArray(&values));
+    } else if (key == "flag") {
+      ASSERT_TRUE(reader.ReadBool(&flag));
+    } else {
+      ASSERT_EQ(reader.PeekValueType(), draco::JsonReader::OBJECT);
+      ASSERT_TRUE(reader.SkipValue());
+    }
+  }
+  ASSERT_TRUE(reader.ok());
+  ASSERT_TRUE(reader.AtEnd());
+  ASSERT_EQ(name, "te\"st\xc3\xa9\xf0\x9f\x98\x80");
+  ASSERT_EQ(count, 42);
+  ASSERT_EQ(values, std::vector<double>({1.0, -2.5, 300.0}));
+  ASSERT_TRUE(flag);
+}
+
+TEST(JsonReaderTest, TestEmptyContainers) {
+  draco::JsonReader reader = CreateReader(" [ {}, [] ] ");
+  std::string key;
+  ASSERT_TRUE(reader.BeginArray());
+  ASSERT_TRUE(reader.NextElement());
+  ASSERT_TRUE(reader.BeginObject());
+  ASSERT_FALSE(reader.NextKey(&key));
+  ASSERT_TRUE(reader.NextElement());
+  ASSERT_TRUE(reader.BeginArray());
+  ASSERT_FALSE(reader.NextElement());
+  ASSERT_FALSE(reader.NextElement());
+  ASSERT_TRUE(reader.ok());
+  ASSERT_TRUE(reader.AtEnd());
+}
+
+TEST(JsonReaderTest, TestInvalidDocuments) {
+  // Each of the documents must be rejected when skipped as a whole.
+  const std::vector<std::string> documents = {
+      "[1,]",         "[1 2]",     "{\"a\" 1}",     "{\"a\":1,}",
+      "[01]",         "[1.]",      "[-]",           "[.5]",
+      "[\"a\nb\"]",   "[\"\\x\"]", "[\"\\ud800\"]", "[tru]",
+      "[1e999]",      "[",         "{\"a\":1",      "[nan]",
+  };
+  for (const std::string &document : documents) {
+    draco::JsonReader reader = CreateReader(document);
+    ASSERT_FALSE(reader.SkipValue() && reader.AtEnd()) << document;
+  }
+}
+
+TEST(JsonReaderTest, TestIntegerRange) {
+  int value;
+  ASSERT_FALSE(CreateReader("1.5").ReadInt(&value));
+  ASSERT_FALSE(CreateReader("3000000000").ReadInt(&value));
+  uint64_t size;
+  draco::JsonReader reader = CreateReader("3000000000");
+  ASSERT_TRUE(reader.ReadUint64(&size));
+  ASSERT_EQ(size, 3000000000ull);
+  ASSERT_FALSE(CreateReader("-1").ReadUint64(&size));
+}
+
+TEST(JsonReaderTest, TestTypeMismatch) {
+  // Reading a value of a wrong type puts the reader into the error state.
+  draco::JsonReader reader = CreateReader("{\"a\": \"1\"}");
+  std::string key;
+  int value;
+  ASSERT_TRUE(reader.BeginObject());
+  ASSERT_TRUE(reader.NextKey(&key));
+  ASSERT_FALSE(reader.ReadInt(&value));
+  ASSERT_FALSE(reader.ok());
+  ASSERT_FALSE(reader.NextKey(&key));
+}
+
+TEST(JsonReaderTest, TestMaxDepth) {
+  const std::string json(draco::JsonReader::kMaxDepth + 1, '[');
+  draco::JsonReader reader = CreateReader(json);
+  ASSERT_FALSE(reader.SkipValue());
+}
+
+}  // namespace
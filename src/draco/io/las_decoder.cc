@@ -0,0 +1,231 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/las_decoder.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "draco/io/file_utils.h"
+#include "draco/metadata/geometry_metadata.h"
+
+namespace draco {
+
+namespace {
+
+// Size of the part of the public header block that is shared by all LAS
+// versions.
+constexpr size_t kLasMinHeaderSize = 227;
+// Offset of the 64-bit number of point records added in LAS 1.4.
+constexpr size_t kLasNumPointRecordsOffset = 247;
+
+// Offsets of the fields of a point data record that depend on the point data
+// record format. Negative offsets denote fields that are not present.
+struct LasPointFormat {
+  int min_record_length;
+  int gps_time_offset;
+  int color_offset;
+  // Formats 6 to 10 use a different layout of the return numbers and of the
+  // classification.
+  bool is_extended;
+};
+
+bool GetLasPointFormat(int format, LasPointFormat *out_format) {
+  static const LasPointFormat kFormats[] = {
+      {20, -1, -1, false}, {28, 20, -1, false}, {26, -1, 20, false},
+      {34, 20, 28, false}, {57, 20, -1, false}, {63, 20, 28, false},
+      {30, 22, -1, true},  {36, 22, 30, true},  {38, 22, 30, true},
+      {59, 22, -1, true},  {67, 22, 30, true}};
+  if (format < 0 || format >= static_cast<int>(sizeof(kFormats) /
+                                               sizeof(kFormats[0]))) {
+    return false;
+  }
+  *out_format = kFormats[format];
+  return true;
+}
+
+template <typename T>
+T ReadValue(const uint8_t *data) {
+  T value;
+  memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+// Copies a field of |field_size| bytes at |field_offset| of every point
+// record into consecutive entries of |attribute|.
+void CopyRecordField(const uint8_t *records, int record_length,
+                     int field_offset, int field_size, int num_points,
+                     PointAttribute *attribute) {
+  uint8_t *dst = attribute->buffer()->data();
+  const uint8_t *src = records + field_offset;
+  for (int i = 0; i < num_points; ++i) {
+    memcpy(dst, src, field_size);
+    dst += field_size;
+    src += record_length;
+  }
+}
+
+}  // namespace
+
+LasDecoder::LasDecoder() : out_point_cloud_(nullptr) {}
+
+Status LasDecoder::DecodeFromFile(const std::string &file_name,
+                                  PointCloud *out_point_cloud) {
+  std::vector<char> data;
+  if (!ReadFileToBuffer(file_name, &data)) {
+    return Status(Status::DRACO_ERROR, "Unable to read input file.");
+  }
+  DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  return DecodeFromBuffer(&buffer, out_point_cloud);
+}
+
+Status LasDecoder::DecodeFromBuffer(DecoderBuffer *buffer,
+                                    PointCloud *out_point_cloud) {
+  out_point_cloud_ = out_point_cloud;
+  return DecodeInternal(reinterpret_cast<const uint8_t *>(buffer->data_head()),
+                        buffer->remaining_size());
+}
+
+Status LasDecoder::DecodeInternal(const uint8_t *data, size_t data_size) {
+  if (data_size < kLasMinHeaderSize || memcmp(data, "LASF", 4) != 0) {
+    return Status(Status::DRACO_ERROR, "Not a valid LAS file.");
+  }
+  const uint8_t version_major = data[24];
+  const uint8_t version_minor = data[25];
+  if (version_major != 1) {
+    return Status(Status::UNSUPPORTED_VERSION, "Unsupported LAS version.");
+  }
+  const uint16_t header_size = ReadValue<uint16_t>(data + 94);
+  const uint32_t point_data_offset = ReadValue<uint32_t>(data + 96);
+  const uint8_t point_format_id = data[104];
+  const uint16_t record_length = ReadValue<uint16_t>(data + 105);
+  uint64_t num_points = ReadValue<uint32_t>(data + 107);
+  if (version_minor >= 4 && header_size >= kLasNumPointRecordsOffset + 8 &&
+      data_size >= kLasNumPointRecordsOffset + 8) {
+    // LAS 1.4 stores the number of points in a new 64-bit field. The legacy
+    // field is zero for files with more points or with point formats 6 and
+    // above.
+    const uint64_t num_points_64 =
+        ReadValue<uint64_t>(data + kLasNumPointRecordsOffset);
+    if (num_points_64 != 0) {
+      num_points = num_points_64;
+    }
+  }
+
+  // Bits 6 and 7 of the point data record format are used by LAZ to denote
+  // compressed point data.
+  if (point_format_id & 0xc0) {
+    return Status(Status::UNSUPPORTED_FEATURE,
+                  "Compressed LAZ point data is not supported.");
+  }
+  LasPointFormat format;
+  if (!GetLasPointFormat(point_format_id, &format)) {
+    return Status(Status::UNSUPPORTED_FEATURE,
+                  "Unsupported LAS point data record format.");
+  }
+  if (record_length < format.min_record_length) {
+    return Status(Status::DRACO_ERROR, "Invalid LAS point record length.");
+  }
+  if (num_points > static_cast<uint64_t>(std::numeric_limits<int>::max())) {
+    return Status(Status::UNSUPPORTED_FEATURE, "Too many LAS points.");
+  }
+  if (point_data_offset > data_size ||
+      (data_size - point_data_offset) / record_length < num_points) {
+    return Status(Status::IO_ERROR, "Truncated LAS point data.");
+  }
+  const int num_points_int = static_cast<int>(num_points);
+  const uint8_t *const records = data + point_data_offset;
+
+  std::unique_ptr<GeometryMetadata> metadata(new GeometryMetadata());
+  std::vector<double> scale(3);
+  std::vector<double> offset(3);
+  for (int c = 0; c < 3; ++c) {
+    scale[c] = ReadValue<double>(data + 131 + 8 * c);
+    offset[c] = ReadValue<double>(data + 155 + 8 * c);
+  }
+  metadata->AddEntryDoubleArray("las_scale", scale);
+  metadata->AddEntryDoubleArray("las_offset", offset);
+  metadata->AddEntryInt("las_point_format", point_format_id);
+  out_point_cloud_->AddMetadata(std::move(metadata));
+  out_point_cloud_->set_num_points(num_points_int);
+
+  // Fields that are stored at the same offsets in all point formats.
+  CopyRecordField(records, record_length, 0, 12, num_points_int,
+                  AddAttribute(GeometryAttribute::POSITION, 3, DT_INT32,
+                               nullptr));
+  CopyRecordField(
+      records, record_length, 12, 2, num_points_int,
+      AddAttribute(GeometryAttribute::GENERIC, 1, DT_UINT16, "intensity"));
+
+  PointAttribute *const return_number_att = AddAttribute(
+      GeometryAttribute::GENERIC, 1, DT_UINT8, "return_number");
+  PointAttribute *const num_returns_att = AddAttribute(
+      GeometryAttribute::GENERIC, 1, DT_UINT8, "number_of_returns");
+  PointAttribute *const classification_att = AddAttribute(
+      GeometryAttribute::GENERIC, 1, DT_UINT8, "classification");
+  uint8_t *const return_numbers = return_number_att->buffer()->data();
+  uint8_t *const num_returns = num_returns_att->buffer()->data();
+  uint8_t *const classifications = classification_att->buffer()->data();
+  const uint8_t *record = records;
+  for (int i = 0; i < num_points_int; ++i, record += record_length) {
+    const uint8_t returns = record[14];
+    if (format.is_extended) {
+      return_numbers[i] = returns & 0xf;
+      num_returns[i] = returns >> 4;
+      classifications[i] = record[16];
+    } else {
+      return_numbers[i] = returns & 0x7;
+      num_returns[i] = (returns >> 3) & 0x7;
+      // The upper three bits are the synthetic, key-point and withheld flags.
+      classifications[i] = record[15] & 0x1f;
+    }
+  }
+  CopyRecordField(records, record_length, format.is_extended ? 20 : 18, 2,
+                  num_points_int,
+                  AddAttribute(GeometryAttribute::GENERIC, 1, DT_UINT16,
+                               "point_source_id"));
+  if (format.gps_time_offset >= 0) {
+    CopyRecordField(
+        records, record_length, format.gps_time_offset, 8, num_points_int,
+        AddAttribute(GeometryAttribute::GENERIC, 1, DT_FLOAT64, "gps_time"));
+  }
+  if (format.color_offset >= 0) {
+    CopyRecordField(
+        records, record_length, format.color_offset, 6, num_points_int,
+        AddAttribute(GeometryAttribute::COLOR, 3, DT_UINT16, nullptr));
+  }
+  return OkStatus();
+}
+
+PointAttribute *LasDecoder::AddAttribute(GeometryAttribute::Type type,
+                                         int num_components,
+                                         DataType data_type,
+                                         const char *name) {
+  GeometryAttribute va;
+  va.Init(type, nullptr, num_components, data_type, false,
+          DataTypeLength(data_type) * num_components, 0);
+  const int att_id = out_point_cloud_->AddAttribute(
+      va, true, out_point_cloud_->num_points());
+  if (name != nullptr) {
+    std::unique_ptr<AttributeMetadata> metadata(new AttributeMetadata());
+    metadata->AddEntryString("name", name);
+    out_point_cloud_->AddAttributeMetadata(att_id, std::move(metadata));
+  }
+  return out_point_cloud_->attribute(att_id);
+}
+
+}  // namespace draco
@@ -0,0 +1,71 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_LAS_DECODER_H_
+#define DRACO_IO_LAS_DECODER_H_
+
+#include <string>
+
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Decodes uncompressed LAS files (versions 1.0 to 1.4, point data record
+// formats 0 to 10) into draco::PointCloud. Points are stored in the order of
+// the file, which for most LiDAR data is the scan order. The decoder creates
+// the following attributes:
+//
+//   POSITION (3 x DT_INT32): Unscaled coordinates of the point records. The
+//       scale and offset of the file are stored in geometry metadata entries
+//       "las_scale" and "las_offset", i.e. the actual x coordinate is
+//       x * las_scale[0] + las_offset[0].
+//   GENERIC "intensity" (DT_UINT16).
+//   GENERIC "return_number" (DT_UINT8).
+//   GENERIC "number_of_returns" (DT_UINT8).
+//   GENERIC "classification" (DT_UINT8).
+//   GENERIC "point_source_id" (DT_UINT16).
+//   GENERIC "gps_time" (DT_FLOAT64): Formats 1 and 3 to 10 only.
+//   COLOR (3 x DT_UINT16): Formats 2, 3, 5, 7, 8 and 10 only.
+//
+// Names of the generic attributes are stored in the attribute metadata entry
+// "name" and the point data record format in the geometry metadata entry
+// "las_point_format". Other fields of the point records are ignored. LAZ
+// compressed files are not supported.
+class LasDecoder {
+ public:
+  LasDecoder();
+
+  // Decodes a LAS file stored in the input file.
+  Status DecodeFromFile(const std::string &file_name,
+                        PointCloud *out_point_cloud);
+
+  Status DecodeFromBuffer(DecoderBuffer *buffer, PointCloud *out_point_cloud);
+
+ private:
+  Status DecodeInternal(const uint8_t *data, size_t data_size);
+
+  // Adds a new attribute with one value per point to the decoded point
+  // cloud. When |name| is not null, it is stored in the attribute metadata.
+  PointAttribute *AddAttribute(GeometryAttribute::Type type,
+                               int num_components, DataType data_type,
+                               const char *name);
+
+  PointCloud *out_point_cloud_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_LAS_DECODER_H_
@@ -0,0 +1,235 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/las_decoder.h"
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/metadata/geometry_metadata.h"
+
+namespace draco {
+
+class LasDecoderTest : public ::testing::Test {
+ protected:
+  template <typename T>
+  static void WriteValue(const T &value, size_t offset,
+                         std::vector<char> *data) {
+    memcpy(data->data() + offset, &value, sizeof(T));
+  }
+
+  // Returns a LAS file with |num_points| generated point records of the given
+  // |format|. Records are padded to |record_length| bytes.
+  static std::vector<char> CreateLasFile(int version_minor, int format,
+                                         int record_length, int num_points) {
+    const bool is_extended = format >= 6;
+    const uint16_t header_size = version_minor >= 4 ? 375 : 227;
+    std::vector<char> data(header_size + record_length * num_points, 0);
+    memcpy(data.data(), "LASF", 4);
+    data[24] = 1;
+    data[25] = static_cast<char>(version_minor);
+    WriteValue(header_size, 94, &data);
+    WriteValue(static_cast<uint32_t>(header_size), 96, &data);
+    data[104] = static_cast<char>(format);
+    WriteValue(static_cast<uint16_t>(record_length), 105, &data);
+    if (is_extended) {
+      // The legacy number of points must be zero for the new point formats.
+      WriteValue(static_cast<uint64_t>(num_points), 247, &data);
+    } else {
+      WriteValue(static_cast<uint32_t>(num_points), 107, &data);
+    }
+    for (int c = 0; c < 3; ++c) {
+      WriteValue(0.01 * (c + 1), 131 + 8 * c, &data);
+      WriteValue(1000.0 * c, 155 + 8 * c, &data);
+    }
+    const int gps_time_offset = is_extended ? 22 : 20;
+    const int color_offset = is_extended ? 30 : (format == 2 ? 20 : 28);
+    const bool has_gps_time = format != 0 && format != 2;
+    const bool has_color = format == 2 || format == 3 || format == 5 ||
+                           format == 7 || format == 8 || format == 10;
+    for (int i = 0; i < num_points; ++i) {
+      const size_t record = header_size + record_length * i;
+      const int32_t position[3] = {1000 + i, -3 * i, i % 7};
+      memcpy(data.data() + record, position, sizeof(position));
+      WriteValue(static_cast<uint16_t>(11 * i), record + 12, &data);
+      const int return_number = 1 + i % 3;
+      const int classification = (i / 10) % 5;
+      if (is_extended) {
+        data[record + 14] = static_cast<char>(return_number | (3 << 4));
+        data[record + 16] = static_cast<char>(classification);
+        WriteValue(static_cast<uint16_t>(42), record + 20, &data);
+      } else {
+        data[record + 14] = static_cast<char>(return_number | (3 << 3));
+        // Set the withheld flag that must not be part of the classification.
+        data[record + 15] = static_cast<char>(classification | 0x80);
+        WriteValue(static_cast<uint16_t>(42), record + 18, &data);
+      }
+      if (has_gps_time) {
+        WriteValue(1000.5 + 1e-5 * i, record + gps_time_offset, &data);
+      }
+      if (has_color) {
+        const uint16_t color[3] = {static_cast<uint16_t>(i),
+                                   static_cast<uint16_t>(2 * i),
+                                   static_cast<uint16_t>(3 * i)};
+        memcpy(data.data() + record + color_offset, color, sizeof(color));
+      }
+    }
+    return data;
+  }
+
+  static const PointAttribute *GetAttributeByName(const PointCloud &pc,
+                                                  const char *name) {
+    const AttributeMetadata *const metadata =
+        pc.GetMetadata()->GetAttributeMetadataByStringEntry("name", name);
+    if (metadata == nullptr) {
+      return nullptr;
+    }
+    return pc.GetAttributeByUniqueId(metadata->att_unique_id());
+  }
+
+  // Decodes a generated LAS file and checks all decoded attribute values.
+  static void TestDecoding(int version_minor, int format, int record_length) {
+    const int kNumPoints = 100;
+    const std::vector<char> data =
+        CreateLasFile(version_minor, format, record_length, kNumPoints);
+    DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    PointCloud pc;
+    LasDecoder decoder;
+    DRACO_ASSERT_OK(decoder.DecodeFromBuffer(&buffer, &pc));
+    ASSERT_EQ(pc.num_points(), kNumPoints);
+    ASSERT_NE(pc.GetMetadata(), nullptr);
+    std::vector<double> scale, offset;
+    ASSERT_TRUE(pc.GetMetadata()->GetEntryDoubleArray("las_scale", &scale));
+    ASSERT_TRUE(pc.GetMetadata()->GetEntryDoubleArray("las_offset", &offset));
+    ASSERT_EQ(scale.size(), 3);
+    ASSERT_EQ(offset.size(), 3);
+    ASSERT_EQ(scale[1], 0.02);
+    ASSERT_EQ(offset[2], 2000.0);
+    int32_t point_format = -1;
+    ASSERT_TRUE(pc.GetMetadata()->GetEntryInt("las_point_format",
+                                              &point_format));
+    ASSERT_EQ(point_format, format);
+
+    const PointAttribute *const pos_att =
+        pc.GetNamedAttribute(GeometryAttribute::POSITION);
+    const PointAttribute *const intensity_att =
+        GetAttributeByName(pc, "intensity");
+    const PointAttribute *const return_number_att =
+        GetAttributeByName(pc, "return_number");
+    const PointAttribute *const num_returns_att =
+        GetAttributeByName(pc, "number_of_returns");
+    const PointAttribute *const classification_att =
+        GetAttributeByName(pc, "classification");
+    const PointAttribute *const point_source_att =
+        GetAttributeByName(pc, "point_source_id");
+    const PointAttribute *const gps_time_att =
+        GetAttributeByName(pc, "gps_time");
+    const PointAttribute *const color_att =
+        pc.GetNamedAttribute(GeometryAttribute::COLOR);
+    ASSERT_NE(pos_att, nullptr);
+    ASSERT_EQ(pos_att->data_type(), DT_INT32);
+    ASSERT_NE(intensity_att, nullptr);
+    ASSERT_NE(return_number_att, nullptr);
+    ASSERT_NE(num_returns_att, nullptr);
+    ASSERT_NE(classification_att, nullptr);
+    ASSERT_NE(point_source_att, nullptr);
+    ASSERT_EQ(gps_time_att != nullptr, format != 0 && format != 2);
+    ASSERT_EQ(color_att != nullptr, format == 2 || format == 3 ||
+                                        format == 5 || format == 7 ||
+                                        format == 8 || format == 10);
+    for (PointIndex i(0); i < kNumPoints; ++i) {
+      const int v = i.value();
+      std::array<int32_t, 3> position;
+      pos_att->GetMappedValue(i, &position[0]);
+      ASSERT_EQ(position[0], 1000 + v);
+      ASSERT_EQ(position[1], -3 * v);
+      ASSERT_EQ(position[2], v % 7);
+      uint16_t value16;
+      uint8_t value8;
+      intensity_att->GetMappedValue(i, &value16);
+      ASSERT_EQ(value16, 11 * v);
+      point_source_att->GetMappedValue(i, &value16);
+      ASSERT_EQ(value16, 42);
+      return_number_att->GetMappedValue(i, &value8);
+      ASSERT_EQ(value8, 1 + v % 3);
+      num_returns_att->GetMappedValue(i, &value8);
+      ASSERT_EQ(value8, 3);
+      classification_att->GetMappedValue(i, &value8);
+      ASSERT_EQ(value8, (v / 10) % 5);
+      if (gps_time_att) {
+        double gps_time;
+        gps_time_att->GetMappedValue(i, &gps_time);
+        ASSERT_EQ(gps_time, 1000.5 + 1e-5 * v);
+      }
+      if (color_att) {
+        std::array<uint16_t, 3> color;
+        color_att->GetMappedValue(i, &color[0]);
+        ASSERT_EQ(color[0], v);
+        ASSERT_EQ(color[1], 2 * v);
+        ASSERT_EQ(color[2], 3 * v);
+      }
+    }
+  }
+};
+
+TEST_F(LasDecoderTest, TestLegacyPointFormats) {
+  TestDecoding(2, 0, 20);
+  TestDecoding(2, 1, 28);
+  TestDecoding(2, 2, 26);
+  TestDecoding(2, 3, 34);
+  // Records with extra bytes.
+  TestDecoding(3, 3, 41);
+}
+
+TEST_F(LasDecoderTest, TestExtendedPointFormats) {
+  TestDecoding(4, 6, 30);
+  TestDecoding(4, 7, 36);
+  TestDecoding(4, 8, 45);
+}
+
+TEST_F(LasDecoderTest, TestInvalidInput) {
+  std::vector<char> data = CreateLasFile(2, 1, 28, 10);
+  PointCloud pc;
+  LasDecoder decoder;
+  DecoderBuffer buffer;
+
+  // Truncated point data.
+  buffer.Init(data.data(), data.size() - 1);
+  ASSERT_FALSE(decoder.DecodeFromBuffer(&buffer, &pc).ok());
+
+  // Record length is too small for the point format.
+  std::vector<char> invalid_data = data;
+  WriteValue(static_cast<uint16_t>(27), 105, &invalid_data);
+  buffer.Init(invalid_data.data(), invalid_data.size());
+  ASSERT_FALSE(decoder.DecodeFromBuffer(&buffer, &pc).ok());
+
+  // LAZ compressed point data.
+  invalid_data = data;
+  invalid_data[104] |= 0x80;
+  buffer.Init(invalid_data.data(), invalid_data.size());
+  const Status status = decoder.DecodeFromBuffer(&buffer, &pc);
+  ASSERT_EQ(status.code(), Status::UNSUPPORTED_FEATURE);
+
+  // Not a LAS file.
+  invalid_data = data;
+  invalid_data[0] = 'X';
+  buffer.Init(invalid_data.data(), invalid_data.size());
+  ASSERT_FALSE(decoder.DecodeFromBuffer(&buffer, &pc).ok());
+}
+
+}  // namespace draco
@@ -14,13 +14,18 @@
 //
 #include "draco/io/mesh_io.h"
 
+#include <algorithm>
 #include <fstream>
 #include <string>
+#include <utility>
 
+#include "draco/compression/chunked_mesh_decoder.h"
+#include "draco/io/file_reader_factory.h"
 #include "draco/io/file_utils.h"
 #include "draco/io/file_writer_interface.h"
 #include "draco/io/obj_decoder.h"
 #include "draco/io/ply_decoder.h"
+#include "draco/io/point_cloud_io.h"
 #include "draco/io/stl_decoder.h"
 #ifdef DRACO_TRANSCODER_SUPPORTED
 #include "draco/compression/draco_compression_options.h"
@@ -93,12 +98,12 @@ StatusOr<std::unique_ptr<Mesh>> ReadMeshFromFile(
 
   // Otherwise not an obj file. Assume the file was encoded with one of the
   // draco encoding methods.
-  std::vector<char> file_data;
-  if (!ReadFileToBuffer(file_name, &file_data)) {
+  FileContents file_contents;
+  if (!file_contents.Open(file_name)) {
     return Status(Status::DRACO_ERROR, "Unable to read input file.");
   }
   DecoderBuffer buffer;
-  buffer.Init(file_data.data(), file_data.size());
+  buffer.Init(file_contents.data(), file_contents.size());
   Decoder decoder;
   auto statusor = decoder.DecodeMeshFromBuffer(&buffer);
   if (!statusor.ok() || statusor.value() == nullptr) {
@@ -107,4 +112,31 @@ StatusOr<std::unique_ptr<Mesh>> ReadMeshFromFile(
   return std::move(statusor).value();
 }
 
+Status ReadChunkedMeshRegionFromFile(
+    const std::string &file_name, const BoundingBox &region,
+    std::vector<std::unique_ptr<Mesh>> *out_chunks) {
+  std::unique_ptr<FileReaderInterface> reader =
+      FileReaderFactory::OpenReader(file_name);
+  if (reader == nullptr) {
+    return Status(Status::DRACO_ERROR, "Unable to open input file.");
+  }
+  ChunkedMeshDecoder decoder;
+  DRACO_RETURN_IF_ERROR(ReadChunkedContainerIndex(reader.get(), &decoder));
+
+  std::vector<char> chunk_data;
+  for (const int chunk_id : decoder.FindChunksInRegion(region)) {
+    if (!reader->ReadRange(static_cast<size_t>(decoder.chunk_offset(chunk_id)),
+                           static_cast<size_t>(decoder.chunk_size(chunk_id)),
+                           &chunk_data)) {
+      return Status(Status::IO_ERROR, "Chunk data is truncated.");
+    }
+    DecoderBuffer chunk_buffer;
+    chunk_buffer.Init(chunk_data.data(), chunk_data.size());
+    DRACO_ASSIGN_OR_RETURN(std::unique_ptr<Mesh> chunk,
+                           decoder.DecodeChunkFromBuffer(&chunk_buffer));
+    out_chunks->push_back(std::move(chunk));
+  }
+  return OkStatus();
+}
+
 }  // namespace draco
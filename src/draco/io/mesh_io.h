@@ -15,9 +15,14 @@
 #ifndef DRACO_IO_MESH_IO_H_
 #define DRACO_IO_MESH_IO_H_
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/decode.h"
 #include "draco/compression/expert_encode.h"
+#include "draco/core/bounding_box.h"
 #include "draco/core/options.h"
 
 namespace draco {
@@ -102,6 +107,15 @@ StatusOr<std::unique_ptr<Mesh>> ReadMeshFromFile(
     const std::string &file_name, const Options &options,
     std::vector<std::string> *mesh_files);
 
+// Reads chunks of a chunked mesh container (see ChunkedMeshEncoder) from a
+// file. Only chunks whose bounds intersect |region| are decoded and appended to
+// |out_chunks|. Only the container header and the data of the selected chunks
+// are read, using FileReaderInterface::ReadRange(), so the function can be
+// used with readers that fetch parts of the file on demand.
+Status ReadChunkedMeshRegionFromFile(
+    const std::string &file_name, const BoundingBox &region,
+    std::vector<std::unique_ptr<Mesh>> *out_chunks);
+
 }  // namespace draco
 
 #endif  // DRACO_IO_MESH_IO_H_
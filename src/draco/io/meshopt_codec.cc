@@ -0,0 +1,636 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/meshopt_codec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace draco {
+
+namespace {
+
+// Vertex codec constants. Vertices are encoded in blocks; each byte of the
+// vertex is delta coded over the block and stored in groups of 16 deltas.
+constexpr uint8_t kVertexHeader = 0xa0;
+constexpr int kVertexBlockSizeBytes = 8192;
+constexpr int kVertexBlockMaxSize = 256;
+constexpr int kByteGroupSize = 16;
+constexpr int kTailMaxSize = 32;
+
+// Index codec constants.
+constexpr uint8_t kIndexHeader = 0xe0;
+constexpr int kIndexVersion = 1;
+
+// Table of the most frequent combinations of vertex FIFO references of
+// triangles that start a new strip. The table is stored at the end of the
+// encoded data where it also serves as padding for the decoder.
+constexpr uint8_t kCodeAuxEncodingTable[16] = {
+    0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xa9, 0x86,
+    0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00, 0x00};
+
+// Rotations of a triangle that keep its orientation.
+constexpr int kTriangleIndexOrder[3][3] = {{0, 1, 2}, {1, 2, 0}, {2, 0, 1}};
+
+int GetVertexBlockSize(int byte_stride) {
+  const int size =
+      (kVertexBlockSizeBytes / byte_stride) & ~(kByteGroupSize - 1);
+  return std::min(size, kVertexBlockMaxSize);
+}
+
+uint8_t ZigZag8(uint8_t value) {
+  return static_cast<uint8_t>((static_cast<int8_t>(value) >> 7) ^ (value << 1));
+}
+
+uint8_t UnZigZag8(uint8_t value) {
+  return static_cast<uint8_t>(-(value & 1) ^ (value >> 1));
+}
+
+// Returns the encoded size of a group of 16 bytes with |bits| bits per value,
+// or -1 when the group can't be encoded with |bits| bits.
+int MeasureByteGroup(const uint8_t *group, int bits) {
+  if (bits == 0) {
+    for (int i = 0; i < kByteGroupSize; ++i) {
+      if (group[i] != 0) {
+        return -1;
+      }
+    }
+    return 0;
+  }
+  if (bits == 8) {
+    return kByteGroupSize;
+  }
+  // Values that don't fit in |bits| bits are stored in full after the packed
+  // values. The largest packed value is used as their sentinel.
+  const int sentinel = (1 << bits) - 1;
+  int size = kByteGroupSize * bits / 8;
+  for (int i = 0; i < kByteGroupSize; ++i) {
+    size += group[i] >= sentinel;
+  }
+  return size;
+}
+
+void EncodeByteGroup(const uint8_t *group, int bits,
+                     std::vector<uint8_t> *out) {
+  if (bits == 0) {
+    return;
+  }
+  if (bits == 8) {
+    out->insert(out->end(), group, group + kByteGroupSize);
+    return;
+  }
+  const int values_per_byte = 8 / bits;
+  const int sentinel = (1 << bits) - 1;
+  for (int i = 0; i < kByteGroupSize; i += values_per_byte) {
+    uint8_t byte = 0;
+    for (int k = 0; k < values_per_byte; ++k) {
+      const uint8_t value = std::min<int>(group[i + k], sentinel);
+      byte = static_cast<uint8_t>((byte << bits) | value);
+    }
+    out->push_back(byte);
+  }
+  for (int i = 0; i < kByteGroupSize; ++i) {
+    if (group[i] >= sentinel) {
+      out->push_back(group[i]);
+    }
+  }
+}
+
+// Encodes |size| bytes, a multiple of 16, of |data|. A header with two bits per
+// group selects 0, 2, 4 or 8 bits per value for each group.
+void EncodeBytes(const uint8_t *data, int size, std::vector<uint8_t> *out) {
+  const int num_groups = size / kByteGroupSize;
+  const size_t header_offset = out->size();
+  out->resize(out->size() + (num_groups + 3) / 4, 0);
+  for (int i = 0; i < num_groups; ++i) {
+    const uint8_t *const group = data + i * kByteGroupSize;
+    int best_bits_log2 = 3;
+    int best_size = MeasureByteGroup(group, 8);
+    for (int bits_log2 = 0; bits_log2 < 3; ++bits_log2) {
+      const int bits = bits_log2 == 0 ? 0 : 1 << bits_log2;
+      const int group_size = MeasureByteGroup(group, bits);
+      if (group_size >= 0 && group_size < best_size) {
+        best_bits_log2 = bits_log2;
+        best_size = group_size;
+      }
+    }
+    (*out)[header_offset + i / 4] |=
+        static_cast<uint8_t>(best_bits_log2 << ((i % 4) * 2));
+    EncodeByteGroup(group, best_bits_log2 == 0 ? 0 : 1 << best_bits_log2,
+                    out);
+  }
+}
+
+// Decodes |size| bytes encoded by EncodeBytes() from |*data| to |out|.
+// Returns false when the data ends before |data_end|.
+bool DecodeBytes(const uint8_t **data, const uint8_t *data_end, int size,
+                 uint8_t *out) {
+  const int num_groups = size / kByteGroupSize;
+  const uint8_t *const header = *data;
+  const int header_size = (num_groups + 3) / 4;
+  if (data_end - *data < header_size) {
+    return false;
+  }
+  const uint8_t *ptr = *data + header_size;
+  for (int i = 0; i < num_groups; ++i) {
+    uint8_t *const group = out + i * kByteGroupSize;
+    const int bits_log2 = (header[i / 4] >> ((i % 4) * 2)) & 3;
+    if (bits_log2 == 0) {
+      memset(group, 0, kByteGroupSize);
+      continue;
+    }
+    if (bits_log2 == 3) {
+      if (data_end - ptr < kByteGroupSize) {
+        return false;
+      }
+      memcpy(group, ptr, kByteGroupSize);
+      ptr += kByteGroupSize;
+      continue;
+    }
+    const int bits = 1 << bits_log2;
+    const int values_per_byte = 8 / bits;
+    const int sentinel = (1 << bits) - 1;
+    const int packed_size = kByteGroupSize / values_per_byte;
+    if (data_end - ptr < packed_size) {
+      return false;
+    }
+    const uint8_t *extra = ptr + packed_size;
+    for (int j = 0; j < kByteGroupSize; ++j) {
+      const int shift = 8 - bits * (j % values_per_byte + 1);
+      const int value = (ptr[j / values_per_byte] >> shift) & sentinel;
+      if (value == sentinel) {
+        if (extra >= data_end) {
+          return false;
+        }
+        group[j] = *extra++;
+      } else {
+        group[j] = static_cast<uint8_t>(value);
+      }
+    }
+    ptr = extra;
+  }
+  *data = ptr;
+  return true;
+}
+
+// Index FIFOs of the triangle codec. Edges are stored as pairs of indices.
+struct IndexFifos {
+  IndexFifos() : edge_offset(0), vertex_offset(0) {
+    memset(edges, 0xff, sizeof(edges));
+    memset(vertices, 0xff, sizeof(vertices));
+  }
+
+  // Returns the position of one of the edges of triangle |a|, |b|, |c| in the
+  // edge FIFO times 4 plus the index of the edge, or -1.
+  int FindEdge(uint32_t a, uint32_t b, uint32_t c) const {
+    for (int i = 0; i < 16; ++i) {
+      const int index = (edge_offset - 1 - i) & 15;
+      const uint32_t e0 = edges[index][0];
+      const uint32_t e1 = edges[index][1];
+      if (e0 == a && e1 == b) {
+        return (i << 2) | 0;
+      }
+      if (e0 == b && e1 == c) {
+        return (i << 2) | 1;
+      }
+      if (e0 == c && e1 == a) {
+        return (i << 2) | 2;
+      }
+    }
+    return -1;
+  }
+
+  void PushEdge(uint32_t a, uint32_t b) {
+    edges[edge_offset][0] = a;
+    edges[edge_offset][1] = b;
+    edge_offset = (edge_offset + 1) & 15;
+  }
+
+  // Returns the position of |v| in the vertex FIFO or -1.
+  int FindVertex(uint32_t v) const {
+    for (int i = 0; i < 16; ++i) {
+      if (vertices[(vertex_offset - 1 - i) & 15] == v) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  void PushVertex(uint32_t v, bool advance = true) {
+    vertices[vertex_offset] = v;
+    vertex_offset = (vertex_offset + (advance ? 1 : 0)) & 15;
+  }
+
+  uint32_t edges[16][2];
+  uint32_t vertices[16];
+  int edge_offset;
+  int vertex_offset;
+};
+
+// Appends |index| delta coded against |last| as a zigzag varint.
+void EncodeIndex(uint32_t index, uint32_t last, std::vector<uint8_t> *out) {
+  const uint32_t delta = index - last;
+  uint32_t value = (delta << 1) ^ (0 - (delta >> 31));
+  do {
+    out->push_back(
+        static_cast<uint8_t>((value & 127) | (value > 127 ? 128 : 0)));
+    value >>= 7;
+  } while (value);
+}
+
+bool DecodeIndex(const uint8_t **data, const uint8_t *data_end, uint32_t last,
+                 uint32_t *index) {
+  uint32_t value = 0;
+  for (int shift = 0; shift < 35; shift += 7) {
+    if (*data >= data_end) {
+      return false;
+    }
+    const uint8_t byte = *(*data)++;
+    value |= static_cast<uint32_t>(byte & 127) << shift;
+    if (byte < 128) {
+      const uint32_t delta = (value >> 1) ^ (0 - (value & 1));
+      *index = last + delta;
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+Status MeshoptCodec::EncodeVertexBuffer(const uint8_t *data, int64_t count,
+                                        int byte_stride,
+                                        EncoderBuffer *out_buffer) {
+  if (byte_stride <= 0 || byte_stride > 256 || byte_stride % 4 != 0) {
+    return Status(Status::DRACO_ERROR, "Invalid meshopt vertex byte stride.");
+  }
+  std::vector<uint8_t> out;
+  out.push_back(kVertexHeader);
+  uint8_t first_vertex[256] = {};
+  if (count > 0) {
+    memcpy(first_vertex, data, byte_stride);
+  }
+  uint8_t last_vertex[256];
+  memcpy(last_vertex, first_vertex, byte_stride);
+  const int block_size = GetVertexBlockSize(byte_stride);
+  uint8_t deltas[kVertexBlockMaxSize];
+  for (int64_t offset = 0; offset < count; offset += block_size) {
+    const int num_vertices =
+        static_cast<int>(std::min<int64_t>(block_size, count - offset));
+    const int aligned_size =
+        (num_vertices + kByteGroupSize - 1) & ~(kByteGroupSize - 1);
+    const uint8_t *const block = data + offset * byte_stride;
+    memset(deltas, 0, sizeof(deltas));
+    for (int k = 0; k < byte_stride; ++k) {
+      uint8_t prev = last_vertex[k];
+      for (int i = 0; i < num_vertices; ++i) {
+        const uint8_t value = block[i * byte_stride + k];
+        deltas[i] = ZigZag8(static_cast<uint8_t>(value - prev));
+        prev = value;
+      }
+      EncodeBytes(deltas, aligned_size, &out);
+    }
+    memcpy(last_vertex, block + (num_vertices - 1) * byte_stride, byte_stride);
+  }
+  // The first vertex is stored at the end, padded to at least 32 bytes so the
+  // decoder can read the tail without bounds checks.
+  if (byte_stride < kTailMaxSize) {
+    out.resize(out.size() + kTailMaxSize - byte_stride, 0);
+  }
+  out.insert(out.end(), first_vertex, first_vertex + byte_stride);
+  if (!out_buffer->Encode(out.data(), out.size())) {
+    return Status(Status::DRACO_ERROR, "Failed to write meshopt vertex data.");
+  }
+  return OkStatus();
+}
+
+Status MeshoptCodec::DecodeVertexBuffer(const uint8_t *data, int64_t size,
+                                        int64_t count, int byte_stride,
+                                        std::vector<uint8_t> *out_data) {
+  if (byte_stride <= 0 || byte_stride > 256 || byte_stride % 4 != 0) {
+    return Status(Status::DRACO_ERROR, "Invalid meshopt vertex byte stride.");
+  }
+  const int tail_size = std::max(byte_stride, kTailMaxSize);
+  if (size < 1 + tail_size || data[0] != kVertexHeader) {
+    return Status(Status::DRACO_ERROR, "Invalid meshopt vertex data.");
+  }
+  const uint8_t *const data_end = data + size - tail_size;
+  uint8_t last_vertex[256];
+  memcpy(last_vertex, data + size - byte_stride, byte_stride);
+  out_data->resize(count * byte_stride);
+  const uint8_t *ptr = data + 1;
+  const int block_size = GetVertexBlockSize(byte_stride);
+  uint8_t deltas[kVertexBlockMaxSize];
+  for (int64_t offset = 0; offset < count; offset += block_size) {
+    const int num_vertices =
+        static_cast<int>(std::min<int64_t>(block_size, count - offset));
+    const int aligned_size =
+        (num_vertices + kByteGroupSize - 1) & ~(kByteGroupSize - 1);
+    uint8_t *const block = out_data->data() + offset * byte_stride;
+    for (int k = 0; k < byte_stride; ++k) {
+      if (!DecodeBytes(&ptr, data_end, aligned_size, deltas)) {
+        return Status(Status::DRACO_ERROR, "Truncated meshopt vertex data.");
+      }
+      uint8_t prev = last_vertex[k];
+      for (int i = 0; i < num_vertices; ++i) {
+        prev = static_cast<uint8_t>(prev + UnZigZag8(deltas[i]));
+        block[i * byte_stride + k] = prev;
+      }
+    }
+    memcpy(last_vertex, block + (num_vertices - 1) * byte_stride, byte_stride);
+  }
+  if (ptr != data_end) {
+    return Status(Status::DRACO_ERROR, "Invalid meshopt vertex data size.");
+  }
+  return OkStatus();
+}
+
+Status MeshoptCodec::EncodeIndexBuffer(const uint32_t *indices, int64_t count,
+                                       EncoderBuffer *out_buffer) {
+  if (count % 3 != 0) {
+    return Status(Status::DRACO_ERROR,
+                  "Meshopt index count must be a multiple of 3.");
+  }
+  const int64_t num_triangles = count / 3;
+  // One code byte per triangle followed by the auxiliary data.
+  std::vector<uint8_t> codes;
+  codes.reserve(num_triangles);
+  std::vector<uint8_t> aux;
+  IndexFifos fifos;
+  uint32_t next = 0;
+  uint32_t last = 0;
+  const int fec_max = 13;
+  for (int64_t i = 0; i < count; i += 3) {
+    const uint32_t *const tri = indices + i;
+    const int fer = fifos.FindEdge(tri[0], tri[1], tri[2]);
+    if (fer >= 0 && (fer >> 2) < 15) {
+      // The triangle shares an edge with a recent triangle; only the third
+      // vertex is coded.
+      const int *const order = kTriangleIndexOrder[fer & 3];
+      const uint32_t a = tri[order[0]];
+      const uint32_t b = tri[order[1]];
+      const uint32_t c = tri[order[2]];
+      const int fe = fer >> 2;
+      const int fc = fifos.FindVertex(c);
+      int fec;
+      if (fc >= 1 && fc < fec_max) {
+        fec = fc;
+      } else if (c == next) {
+        fec = 0;
+        ++next;
+      } else if (c + 1 == last) {
+        fec = 13;
+        last = c;
+      } else if (c == last + 1) {
+        fec = 14;
+        last = c;
+      } else {
+        fec = 15;
+      }
+      codes.push_back(static_cast<uint8_t>((fe << 4) | fec));
+      if (fec == 15) {
+        EncodeIndex(c, last, &aux);
+        last = c;
+      }
+      if (fec == 0 || fec >= fec_max) {
+        fifos.PushVertex(c);
+      }
+      fifos.PushEdge(c, b);
+      fifos.PushEdge(a, c);
+    } else {
+      // Rotate the triangle so that the next new vertex comes first.
+      const int rotation = tri[1] == next ? 1 : tri[2] == next ? 2 : 0;
+      const int *const order = kTriangleIndexOrder[rotation];
+      const uint32_t a = tri[order[0]];
+      const uint32_t b = tri[order[1]];
+      const uint32_t c = tri[order[2]];
+      // Triangle 0, 1, 2 restarts the numbering of new vertices.
+      bool reset = false;
+      if (a == 0 && b == 1 && c == 2 && next > 0) {
+        reset = true;
+        next = 0;
+        memset(fifos.vertices, 0xff, sizeof(fifos.vertices));
+      }
+      const int fb = fifos.FindVertex(b);
+      const int fc = fifos.FindVertex(c);
+      int fea = 15;
+      if (a == next) {
+        fea = 0;
+        ++next;
+      }
+      int feb = 15;
+      if (fb >= 0 && fb < 14) {
+        feb = fb + 1;
+      } else if (b == next) {
+        feb = 0;
+        ++next;
+      }
+      int fec = 15;
+      if (fc >= 0 && fc < 14) {
+        fec = fc + 1;
+      } else if (c == next) {
+        fec = 0;
+        ++next;
+      }
+      const uint8_t code_aux = static_cast<uint8_t>((feb << 4) | fec);
+      int code_aux_index = -1;
+      for (int j = 0; j < 14; ++j) {
+        if (kCodeAuxEncodingTable[j] == code_aux) {
+          code_aux_index = j;
+          break;
+        }
+      }
+      if (fea == 0 && code_aux_index >= 0 && !reset) {
+        codes.push_back(static_cast<uint8_t>(0xf0 | code_aux_index));
+      } else {
+        codes.push_back(static_cast<uint8_t>(0xf0 | 14 | fea));
+        aux.push_back(code_aux);
+      }
+      if (fea == 15) {
+        EncodeIndex(a, last, &aux);
+        last = a;
+      }
+      if (feb == 15) {
+        EncodeIndex(b, last, &aux);
+        last = b;
+      }
+      if (fec == 15) {
+        EncodeIndex(c, last, &aux);
+        last = c;
+      }
+      fifos.PushVertex(a);
+      if (feb == 0 || feb == 15) {
+        fifos.PushVertex(b);
+      }
+      if (fec == 0 || fec == 15) {
+        fifos.PushVertex(c);
+      }
+      fifos.PushEdge(b, a);
+      fifos.PushEdge(c, b);
+      fifos.PushEdge(a, c);
+    }
+  }
+  const uint8_t header = kIndexHeader | kIndexVersion;
+  if (!out_buffer->Encode(header) ||
+      !out_buffer->Encode(codes.data(), codes.size()) ||
+      !out_buffer->Encode(aux.data(), aux.size()) ||
+      !out_buffer->Encode(kCodeAuxEncodingTable,
+                          sizeof(kCodeAuxEncodingTable))) {
+    return Status(Status::DRACO_ERROR, "Failed to write meshopt index data.");
+  }
+  return OkStatus();
+}
+
+Status MeshoptCodec::DecodeIndexBuffer(const uint8_t *data, int64_t size,
+                                       int64_t count,
+                                       std::vector<uint32_t> *out_indices) {
+  if (count % 3 != 0 || size < 1 + count / 3 + 16 ||
+      (data[0] & 0xf0) != kIndexHeader || (data[0] & 0x0f) > kIndexVersion) {
+    return Status(Status::DRACO_ERROR, "Invalid meshopt index data.");
+  }
+  const int version = data[0] & 0x0f;
+  const int fec_max = version >= 1 ? 13 : 15;
+  const uint8_t *code = data + 1;
+  const uint8_t *ptr = code + count / 3;
+  const uint8_t *const data_end = data + size - 16;
+  const uint8_t *const code_aux_table = data_end;
+  IndexFifos fifos;
+  uint32_t next = 0;
+  uint32_t last = 0;
+  out_indices->resize(count);
+  for (int64_t i = 0; i < count; i += 3) {
+    const uint8_t code_tri = *code++;
+    uint32_t a, b, c;
+    if (code_tri < 0xf0) {
+      const int fe = code_tri >> 4;
+      a = fifos.edges[(fifos.edge_offset - 1 - fe) & 15][0];
+      b = fifos.edges[(fifos.edge_offset - 1 - fe) & 15][1];
+      const int fec = code_tri & 15;
+      if (fec < fec_max) {
+        c = fec == 0 ? next
+                     : fifos.vertices[(fifos.vertex_offset - 1 - fec) & 15];
+        next += fec == 0;
+        fifos.PushVertex(c, fec == 0);
+      } else {
+        if (fec == 15) {
+          if (!DecodeIndex(&ptr, data_end, last, &c)) {
+            return Status(Status::DRACO_ERROR, "Truncated meshopt index data.");
+          }
+        } else {
+          c = fec == 13 ? last - 1 : last + 1;
+        }
+        last = c;
+        fifos.PushVertex(c);
+      }
+      fifos.PushEdge(c, b);
+      fifos.PushEdge(a, c);
+    } else {
+      int fea, feb, fec;
+      if (code_tri < 0xfe) {
+        const uint8_t code_aux = code_aux_table[code_tri & 15];
+        fea = 0;
+        feb = code_aux >> 4;
+        fec = code_aux & 15;
+      } else {
+        if (ptr >= data_end) {
+          return Status(Status::DRACO_ERROR, "Truncated meshopt index data.");
+        }
+        const uint8_t code_aux = *ptr++;
+        fea = code_tri == 0xfe ? 0 : 15;
+        feb = code_aux >> 4;
+        fec = code_aux & 15;
+        if (code_aux == 0 && fea == 0 && version >= 1) {
+          next = 0;
+        }
+      }
+      a = fea == 0 ? next++ : 0;
+      b = feb == 0 ? next++
+                   : fifos.vertices[(fifos.vertex_offset - feb) & 15];
+      c = fec == 0 ? next++
+                   : fifos.vertices[(fifos.vertex_offset - fec) & 15];
+      // Indices that are not in the FIFO follow in the order a, b, c.
+      uint32_t *const free_indices[3] = {&a, &b, &c};
+      const int fifo_codes[3] = {fea, feb, fec};
+      for (int j = 0; j < 3; ++j) {
+        if (fifo_codes[j] != 15) {
+          continue;
+        }
+        if (!DecodeIndex(&ptr, data_end, last, free_indices[j])) {
+          return Status(Status::DRACO_ERROR, "Truncated meshopt index data.");
+        }
+        last = *free_indices[j];
+      }
+      fifos.PushVertex(a);
+      fifos.PushVertex(b, feb == 0 || feb == 15);
+      fifos.PushVertex(c, fec == 0 || fec == 15);
+      fifos.PushEdge(b, a);
+      fifos.PushEdge(c, b);
+      fifos.PushEdge(a, c);
+    }
+    (*out_indices)[i] = a;
+    (*out_indices)[i + 1] = b;
+    (*out_indices)[i + 2] = c;
+  }
+  if (ptr != data_end) {
+    return Status(Status::DRACO_ERROR, "Invalid meshopt index data size.");
+  }
+  return OkStatus();
+}
+
+void MeshoptCodec::EncodeExponentialFilter(const float *values, int64_t count,
+                                           int num_components, int bits,
+                                           uint32_t *out_data) {
+  for (int64_t i = 0; i < count; ++i) {
+    const float *const v = values + i * num_components;
+    uint32_t *const d = out_data + i * num_components;
+    // The largest exponent of the components keeps the mantissas in [-1, 1],
+    // the mantissas are then scaled to |bits|-bit signed integers.
+    int exponent = -100;
+    for (int j = 0; j < num_components; ++j) {
+      int e;
+      std::frexp(v[j], &e);
+      exponent = std::max(exponent, e);
+    }
+    exponent = std::min(std::max(exponent - (bits - 1), -100), 100);
+    for (int j = 0; j < num_components; ++j) {
+      const int mantissa = static_cast<int>(
+          std::ldexp(v[j], -exponent) + (v[j] >= 0 ? 0.5f : -0.5f));
+      d[j] = (static_cast<uint32_t>(mantissa) & 0xffffff) |
+             (static_cast<uint32_t>(exponent) << 24);
+    }
+  }
+}
+
+void MeshoptCodec::DecodeExponentialFilter(const uint32_t *data,
+                                           int64_t num_values,
+                                           float *out_values) {
+  for (int64_t i = 0; i < num_values; ++i) {
+    // Sign extend the 24-bit mantissa and the 8-bit exponent.
+    const int32_t mantissa = static_cast<int32_t>(data[i] << 8) >> 8;
+    const int32_t exponent = static_cast<int32_t>(data[i]) >> 24;
+    out_values[i] = std::ldexp(static_cast<float>(mantissa), exponent);
+  }
+}
+
+const char *MeshoptCodec::FilterName(Filter filter) {
+  switch (filter) {
+    case FILTER_EXPONENTIAL:
+      return "EXPONENTIAL";
+    default:
+      return "NONE";
+  }
+}
+
+}  // namespace draco
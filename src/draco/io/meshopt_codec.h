@@ -0,0 +1,85 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_MESHOPT_CODEC_H_
+#define DRACO_IO_MESHOPT_CODEC_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+
+namespace draco {
+
+// Codecs of the buffer view data of the glTF extension
+// EXT_meshopt_compression. The data is encoded in a byte oriented format that
+// decodes several times faster than Draco compressed meshes, at the cost of a
+// lower compression ratio. Only the "ATTRIBUTES" mode with the bitstream
+// version 0 and the "TRIANGLES" mode with the bitstream version 1 are
+// supported.
+//
+// The decoders are provided mainly for testing; they reject malformed data but
+// are not optimized for speed.
+class MeshoptCodec {
+ public:
+  // Filters applied to the attribute values before they are encoded. The
+  // names correspond to the "filter" property of the extension.
+  enum Filter { FILTER_NONE, FILTER_EXPONENTIAL };
+
+  // Encodes |count| elements of |byte_stride| bytes stored in |data| in the
+  // "ATTRIBUTES" mode and appends the result to |out_buffer|. |byte_stride|
+  // must be a multiple of 4 and at most 256.
+  static Status EncodeVertexBuffer(const uint8_t *data, int64_t count,
+                                   int byte_stride, EncoderBuffer *out_buffer);
+
+  // Decodes |count| elements of |byte_stride| bytes from |size| bytes of
+  // "ATTRIBUTES" mode |data| into |out_data|.
+  static Status DecodeVertexBuffer(const uint8_t *data, int64_t size,
+                                   int64_t count, int byte_stride,
+                                   std::vector<uint8_t> *out_data);
+
+  // Encodes |count| triangle vertex indices in the "TRIANGLES" mode and
+  // appends the result to |out_buffer|. |count| must be a multiple of 3. The
+  // encoding works best when the triangles are ordered for vertex cache
+  // locality and the vertices are ordered by their first use.
+  static Status EncodeIndexBuffer(const uint32_t *indices, int64_t count,
+                                  EncoderBuffer *out_buffer);
+
+  // Decodes |count| triangle vertex indices from |size| bytes of "TRIANGLES"
+  // mode |data| into |out_indices|.
+  static Status DecodeIndexBuffer(const uint8_t *data, int64_t size,
+                                  int64_t count,
+                                  std::vector<uint32_t> *out_indices);
+
+  // Encodes |count| vectors of |num_components| float values with the
+  // "EXPONENTIAL" filter. The components of each vector share an exponent and
+  // keep |bits| bits of precision relative to the largest component. |bits|
+  // must be in range [1, 23]. The results are stored in |out_data|, one 32-bit
+  // value per component.
+  static void EncodeExponentialFilter(const float *values, int64_t count,
+                                      int num_components, int bits,
+                                      uint32_t *out_data);
+
+  // Decodes |num_values| values of the "EXPONENTIAL" filter from |data|.
+  static void DecodeExponentialFilter(const uint32_t *data, int64_t num_values,
+                                      float *out_values);
+
+  // Returns the name of |filter| used by the glTF extension.
+  static const char *FilterName(Filter filter);
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_MESHOPT_CODEC_H_
@@ -0,0 +1,137 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/meshopt_codec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/mesh/mesh.h"
+
+namespace {
+
+// Returns true when the triangles of |a| and |b| are equal up to a rotation
+// of their vertices. The index codec may rotate triangles.
+bool TrianglesEqual(const std::vector<uint32_t> &a,
+                    const std::vector<uint32_t> &b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); i += 3) {
+    bool found = false;
+    for (int r = 0; r < 3; ++r) {
+      found |= a[i] == b[i + r] && a[i + 1] == b[i + (r + 1) % 3] &&
+               a[i + 2] == b[i + (r + 2) % 3];
+    }
+    if (!found) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST(MeshoptCodecTest, EncodesAndDecodesMeshIndices) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  std::vector<uint32_t> indices;
+  for (draco::FaceIndex i(0); i < mesh->num_faces(); ++i) {
+    for (int c = 0; c < 3; ++c) {
+      indices.push_back(mesh->face(i)[c].value());
+    }
+  }
+  // The triangle 0, 1, 2 at the end resets the numbering of new vertices.
+  indices.insert(indices.end(), {0, 1, 2});
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(draco::MeshoptCodec::EncodeIndexBuffer(
+      indices.data(), indices.size(), &buffer));
+  ASSERT_LT(buffer.size(), indices.size() * sizeof(uint32_t) / 2);
+
+  std::vector<uint32_t> decoded;
+  DRACO_ASSERT_OK(draco::MeshoptCodec::DecodeIndexBuffer(
+      reinterpret_cast<const uint8_t *>(buffer.data()), buffer.size(),
+      indices.size(), &decoded));
+  ASSERT_TRUE(TrianglesEqual(indices, decoded));
+
+  // Truncated data is rejected.
+  ASSERT_FALSE(draco::MeshoptCodec::DecodeIndexBuffer(
+                   reinterpret_cast<const uint8_t *>(buffer.data()),
+                   buffer.size() - 20, indices.size(), &decoded)
+                   .ok());
+  // The index count must be a multiple of 3.
+  ASSERT_FALSE(
+      draco::MeshoptCodec::EncodeIndexBuffer(indices.data(), 4, &buffer).ok());
+}
+
+TEST(MeshoptCodecTest, EncodesAndDecodesVertices) {
+  for (const int byte_stride : {4, 12, 16, 64, 256}) {
+    // Smooth values in the first half of each vertex, noise in the rest.
+    const int count = 1000;
+    std::vector<uint8_t> data(count * byte_stride);
+    uint32_t seed = 1;
+    for (int i = 0; i < count; ++i) {
+      for (int k = 0; k < byte_stride; ++k) {
+        seed = seed * 1103515245 + 12345;
+        data[i * byte_stride + k] =
+            k < byte_stride / 2 ? static_cast<uint8_t>(i / 3)
+                                : static_cast<uint8_t>(seed >> 16);
+      }
+    }
+    draco::EncoderBuffer buffer;
+    DRACO_ASSERT_OK(draco::MeshoptCodec::EncodeVertexBuffer(
+        data.data(), count, byte_stride, &buffer));
+    ASSERT_LT(buffer.size(), data.size());
+    std::vector<uint8_t> decoded;
+    DRACO_ASSERT_OK(draco::MeshoptCodec::DecodeVertexBuffer(
+        reinterpret_cast<const uint8_t *>(buffer.data()), buffer.size(), count,
+        byte_stride, &decoded));
+    ASSERT_EQ(decoded, data);
+  }
+
+  // Strides must be multiples of 4.
+  draco::EncoderBuffer buffer;
+  const uint8_t data[6] = {};
+  ASSERT_FALSE(
+      draco::MeshoptCodec::EncodeVertexBuffer(data, 1, 6, &buffer).ok());
+}
+
+TEST(MeshoptCodecTest, ExponentialFilter) {
+  const std::vector<float> values = {1.5f, -0.25f, 100.f, 0.f,    0.f,
+                                     0.f,  3.14159f, 2.71828f, -1e-3f};
+  const int bits = 12;
+  std::vector<uint32_t> encoded(values.size());
+  draco::MeshoptCodec::EncodeExponentialFilter(values.data(), 3, 3, bits,
+                                               encoded.data());
+  std::vector<float> decoded(values.size());
+  draco::MeshoptCodec::DecodeExponentialFilter(encoded.data(), encoded.size(),
+                                               decoded.data());
+  for (int i = 0; i < values.size(); ++i) {
+    // The error is bounded by the precision of the largest component.
+    const float *const v = &values[i / 3 * 3];
+    const float max_component =
+        std::max({std::fabs(v[0]), std::fabs(v[1]), std::fabs(v[2])});
+    ASSERT_LE(std::fabs(decoded[i] - values[i]),
+              std::ldexp(max_component, 1 - bits));
+  }
+  // Values with few significant bits are exact.
+  ASSERT_EQ(decoded[0], 1.5f);
+  ASSERT_EQ(decoded[1], -0.25f);
+  ASSERT_EQ(decoded[3], 0.f);
+}
+
+}  // namespace
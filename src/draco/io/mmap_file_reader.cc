@@ -0,0 +1,93 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/mmap_file_reader.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DRACO_MMAP_SUPPORTED
+#endif
+
+namespace draco {
+
+MmapFileReader::~MmapFileReader() {
+#ifdef DRACO_MMAP_SUPPORTED
+  munmap(const_cast<char *>(data_), size_);
+#endif
+}
+
+std::unique_ptr<FileReaderInterface> MmapFileReader::Open(
+    const std::string &file_name) {
+#ifdef DRACO_MMAP_SUPPORTED
+  if (file_name.empty()) {
+    return nullptr;
+  }
+  const int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode) ||
+      file_stat.st_size <= 0) {
+    // Empty files cannot be mapped.
+    close(fd);
+    return nullptr;
+  }
+  const size_t size = static_cast<size_t>(file_stat.st_size);
+  void *const data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping stays valid after the file is closed.
+  close(fd);
+  if (data == MAP_FAILED) {
+    return nullptr;
+  }
+  return std::unique_ptr<FileReaderInterface>(
+      new MmapFileReader(static_cast<const char *>(data), size));
+#else
+  return nullptr;
+#endif
+}
+
+bool MmapFileReader::ReadFileToBuffer(std::vector<char> *buffer) {
+  if (buffer == nullptr) {
+    return false;
+  }
+  buffer->assign(data_, data_ + size_);
+  return true;
+}
+
+bool MmapFileReader::ReadFileToBuffer(std::vector<uint8_t> *buffer) {
+  if (buffer == nullptr) {
+    return false;
+  }
+  buffer->assign(data_, data_ + size_);
+  return true;
+}
+
+bool MmapFileReader::ReadRange(size_t offset, size_t size,
+                               std::vector<char> *buffer) {
+  if (buffer == nullptr || offset > size_ || size > size_ - offset) {
+    return false;
+  }
+  buffer->assign(data_ + offset, data_ + offset + size);
+  return true;
+}
+
+}  // namespace draco
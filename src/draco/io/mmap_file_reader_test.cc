@@ -0,0 +1,95 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/mmap_file_reader.h"
+
+#include <cstring>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/io/file_reader_factory.h"
+#include "draco/io/file_reader_test_common.h"
+#include "draco/io/file_utils.h"
+
+namespace draco {
+namespace {
+
+#if defined(__unix__) || defined(__APPLE__)
+
+TEST(MmapFileReaderTest, FailOpen) {
+  EXPECT_EQ(MmapFileReader::Open(""), nullptr);
+  EXPECT_EQ(MmapFileReader::Open("mmap reader fake file"), nullptr);
+}
+
+TEST(MmapFileReaderTest, GetFileData) {
+  auto reader = MmapFileReader::Open(GetTestFileFullPath("car.drc"));
+  ASSERT_NE(reader, nullptr);
+  ASSERT_EQ(reader->GetFileSize(), kFileSizeCarDrc);
+  ASSERT_NE(reader->GetFileData(), nullptr);
+
+  // The mapped contents match the contents read into a buffer.
+  std::vector<char> buffer;
+  ASSERT_TRUE(reader->ReadFileToBuffer(&buffer));
+  ASSERT_EQ(buffer.size(), kFileSizeCarDrc);
+  EXPECT_EQ(memcmp(buffer.data(), reader->GetFileData(), buffer.size()), 0);
+
+  std::vector<uint8_t> uint8_buffer;
+  ASSERT_TRUE(reader->ReadFileToBuffer(&uint8_buffer));
+  EXPECT_EQ(uint8_buffer.size(), kFileSizeCarDrc);
+}
+
+TEST(MmapFileReaderTest, ReadRange) {
+  auto reader = MmapFileReader::Open(GetTestFileFullPath("car.drc"));
+  ASSERT_NE(reader, nullptr);
+  std::vector<char> buffer;
+  ASSERT_TRUE(reader->ReadRange(100, 1000, &buffer));
+  ASSERT_EQ(buffer.size(), 1000);
+  EXPECT_EQ(memcmp(buffer.data(), reader->GetFileData() + 100, 1000), 0);
+  EXPECT_FALSE(reader->ReadRange(kFileSizeCarDrc - 10, 11, &buffer));
+  EXPECT_FALSE(reader->ReadRange(100, 10, nullptr));
+}
+
+TEST(MmapFileReaderTest, FailRead) {
+  auto reader = MmapFileReader::Open(GetTestFileFullPath("cube_pc.drc"));
+  ASSERT_NE(reader, nullptr);
+  std::vector<char> *buffer = nullptr;
+  EXPECT_FALSE(reader->ReadFileToBuffer(buffer));
+}
+
+TEST(MmapFileReaderTest, PreferredByFactory) {
+  // The factory tries the memory mapped reader before the stdio reader.
+  auto reader = FileReaderFactory::OpenReader(GetTestFileFullPath("car.drc"));
+  ASSERT_NE(reader, nullptr);
+  EXPECT_NE(reader->GetFileData(), nullptr);
+}
+
+#endif  // defined(__unix__) || defined(__APPLE__)
+
+TEST(MmapFileReaderTest, FileContents) {
+  // Tests that FileContents provides the file contents regardless of the
+  // reader selected by the factory.
+  FileContents contents;
+  ASSERT_TRUE(contents.Open(GetTestFileFullPath("cube_pc.drc")));
+  ASSERT_EQ(contents.size(), kFileSizeCubePcDrc);
+  std::vector<char> buffer;
+  ASSERT_TRUE(ReadFileToBuffer(GetTestFileFullPath("cube_pc.drc"), &buffer));
+  EXPECT_EQ(memcmp(buffer.data(), contents.data(), buffer.size()), 0);
+  EXPECT_FALSE(contents.Open("mmap reader fake file"));
+  EXPECT_EQ(contents.data(), nullptr);
+  EXPECT_EQ(contents.size(), 0);
+}
+
+}  // namespace
+}  // namespace draco
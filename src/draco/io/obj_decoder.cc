@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <cstring>
 #include <utility>
 
 #include "draco/io/file_utils.h"
@@ -45,6 +46,7 @@ ObjDecoder::ObjDecoder()
       preserve_polygons_(false),
       has_polygons_(false),
       mesh_files_(nullptr),
+      thread_pool_(nullptr),
       out_mesh_(nullptr),
       out_point_cloud_(nullptr) {}
 
@@ -94,12 +96,12 @@ Status ObjDecoder::DecodeInternal() {
   ResetCounters();
   material_name_to_id_.clear();
   last_sub_obj_id_ = 0;
-  // Parse all lines.
+  std::vector<ParseChunk> chunks;
   Status status(Status::OK);
-  while (ParseDefinition(&status) && status.ok()) {
-  }
-  if (!status.ok()) {
-    return status;
+  if (thread_pool_ == nullptr || !CountDefinitionsInParallel(&chunks)) {
+    chunks.clear();
+    // Parse all lines.
+    DRACO_RETURN_IF_ERROR(ParseAllDefinitions());
   }
 
   if (mesh_files_ && !input_file_name_.empty()) {
@@ -249,13 +251,14 @@ Status ObjDecoder::DecodeInternal() {
 
   // Perform a second iteration of parsing and fill all the data.
   counting_mode_ = false;
-  ResetCounters();
-  // Start parsing from the beginning of the buffer again.
-  buffer()->StartDecodingFrom(0);
-  while (ParseDefinition(&status) && status.ok()) {
-  }
-  if (!status.ok()) {
-    return status;
+  if (chunks.empty() || !ParseDataInParallel(chunks)) {
+    if (!chunks.empty()) {
+      ClearParsedData();
+    }
+    ResetCounters();
+    // Start parsing from the beginning of the buffer again.
+    buffer()->StartDecodingFrom(0);
+    DRACO_RETURN_IF_ERROR(ParseAllDefinitions());
   }
   if (out_mesh_) {
     // Add faces with identity mapping between vertex and corner indices.
@@ -271,11 +274,11 @@ Status ObjDecoder::DecodeInternal() {
 
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
   if (deduplicate_input_values_) {
-    out_point_cloud_->DeduplicateAttributeValues();
+    out_point_cloud_->DeduplicateAttributeValues(thread_pool_);
   }
 #endif
 #ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
-  out_point_cloud_->DeduplicatePointIds();
+  out_point_cloud_->DeduplicatePointIds(thread_pool_);
 #endif
   return status;
 }
@@ -289,6 +292,166 @@ void ObjDecoder::ResetCounters() {
   last_sub_obj_id_ = 0;
 }
 
+ObjDecoder::DefinitionCounts ObjDecoder::GetCounters() const {
+  DefinitionCounts counts;
+  counts.num_obj_faces = num_obj_faces_;
+  counts.num_positions = num_positions_;
+  counts.num_tex_coords = num_tex_coords_;
+  counts.num_normals = num_normals_;
+  return counts;
+}
+
+void ObjDecoder::SetCounters(const DefinitionCounts &counts) {
+  num_obj_faces_ = counts.num_obj_faces;
+  num_positions_ = counts.num_positions;
+  num_tex_coords_ = counts.num_tex_coords;
+  num_normals_ = counts.num_normals;
+}
+
+Status ObjDecoder::ParseAllDefinitions() {
+  Status status(Status::OK);
+  while (ParseDefinition(&status) && status.ok()) {
+  }
+  return status;
+}
+
+bool ObjDecoder::CountDefinitionsInParallel(std::vector<ParseChunk> *chunks) {
+  // Minimum size of a chunk in bytes. Smaller inputs are parsed serially.
+  constexpr int64_t kMinChunkSize = 1 << 20;
+  const char *const data = buffer()->data_head();
+  const int64_t size = buffer()->remaining_size();
+  const int64_t num_threads = std::max(thread_pool_->num_threads(), 1);
+  const int64_t chunk_size = std::max(kMinChunkSize, size / (4 * num_threads));
+
+  // Split the input into chunks that end right after a line break. The serial
+  // parser always starts a new definition at such positions.
+  int64_t begin = 0;
+  while (begin < size) {
+    int64_t end = begin + chunk_size;
+    if (end >= size) {
+      end = size;
+    } else {
+      const void *const line_end = memchr(data + end, '\n', size - end);
+      end = line_end == nullptr
+                ? size
+                : static_cast<const char *>(line_end) - data + 1;
+    }
+    ParseChunk chunk;
+    chunk.begin = begin;
+    chunk.end = end;
+    chunks->push_back(chunk);
+    begin = end;
+  }
+  if (chunks->size() < 2) {
+    return false;
+  }
+
+  // Count the definitions. The material library, materials and named objects
+  // are tracked in the order of their appearance so inputs that contain them
+  // are counted serially.
+  std::vector<uint8_t> is_chunk_valid(chunks->size(), 0);
+  std::vector<uint8_t> chunk_has_polygons(chunks->size(), 0);
+  ParallelFor(thread_pool_, static_cast<int>(chunks->size()), [&](int i) {
+    ObjDecoder worker = CreateChunkWorker((*chunks)[i]);
+    worker.counting_mode_ = true;
+    worker.ResetCounters();
+    const Status status = worker.ParseAllDefinitions();
+    (*chunks)[i].count = worker.GetCounters();
+    chunk_has_polygons[i] = worker.has_polygons_;
+    is_chunk_valid[i] = status.ok() && worker.material_file_name_.empty() &&
+                        worker.material_name_to_id_.empty() &&
+                        worker.obj_name_to_id_.empty() &&
+                        worker.num_materials_ == num_materials_;
+  });
+  if (std::find(is_chunk_valid.begin(), is_chunk_valid.end(), 0) !=
+      is_chunk_valid.end()) {
+    return false;
+  }
+
+  ResetCounters();
+  for (size_t i = 0; i < chunks->size(); ++i) {
+    ParseChunk &chunk = (*chunks)[i];
+    chunk.start = GetCounters();
+    num_obj_faces_ += chunk.count.num_obj_faces;
+    num_positions_ += chunk.count.num_positions;
+    num_tex_coords_ += chunk.count.num_tex_coords;
+    num_normals_ += chunk.count.num_normals;
+    if (chunk_has_polygons[i]) {
+      has_polygons_ = true;
+    }
+  }
+  return true;
+}
+
+bool ObjDecoder::ParseDataInParallel(const std::vector<ParseChunk> &chunks) {
+  std::vector<uint8_t> is_chunk_valid(chunks.size(), 0);
+  ParallelFor(thread_pool_, static_cast<int>(chunks.size()), [&](int i) {
+    const ParseChunk &chunk = chunks[i];
+    ObjDecoder worker = CreateChunkWorker(chunk);
+    worker.counting_mode_ = false;
+    worker.SetCounters(chunk.start);
+    const Status status = worker.ParseAllDefinitions();
+    // Each chunk starts with the counters computed by the first pass. The
+    // result equals the serial result only when all definitions counted in
+    // the first pass were parsed.
+    const DefinitionCounts counts = worker.GetCounters();
+    is_chunk_valid[i] =
+        status.ok() &&
+        counts.num_obj_faces ==
+            chunk.start.num_obj_faces + chunk.count.num_obj_faces &&
+        counts.num_positions ==
+            chunk.start.num_positions + chunk.count.num_positions &&
+        counts.num_tex_coords ==
+            chunk.start.num_tex_coords + chunk.count.num_tex_coords &&
+        counts.num_normals ==
+            chunk.start.num_normals + chunk.count.num_normals;
+  });
+  if (std::find(is_chunk_valid.begin(), is_chunk_valid.end(), 0) !=
+      is_chunk_valid.end()) {
+    return false;
+  }
+  SetCounters(chunks.back().start);
+  num_obj_faces_ += chunks.back().count.num_obj_faces;
+  num_positions_ += chunks.back().count.num_positions;
+  num_tex_coords_ += chunks.back().count.num_tex_coords;
+  num_normals_ += chunks.back().count.num_normals;
+  return true;
+}
+
+ObjDecoder ObjDecoder::CreateChunkWorker(const ParseChunk &chunk) const {
+  ObjDecoder worker(*this);
+  // Files referenced by the input are collected by this decoder.
+  worker.mesh_files_ = nullptr;
+  worker.thread_pool_ = nullptr;
+  const char *const data = buffer_.data_head() - buffer_.decoded_size();
+  worker.buffer_.Init(data + chunk.begin, chunk.end - chunk.begin);
+  return worker;
+}
+
+void ObjDecoder::ClearParsedData() {
+  for (const int att_id : {pos_att_id_, tex_att_id_, norm_att_id_}) {
+    if (att_id < 0) {
+      continue;
+    }
+    DataBuffer *const att_buffer =
+        out_point_cloud_->attribute(att_id)->buffer();
+    memset(att_buffer->data(), 0, att_buffer->data_size());
+  }
+  for (const int att_id :
+       {pos_att_id_, tex_att_id_, norm_att_id_, added_edge_att_id_}) {
+    if (att_id < 0) {
+      continue;
+    }
+    PointAttribute *const att = out_point_cloud_->attribute(att_id);
+    if (att->is_mapping_identity()) {
+      continue;
+    }
+    for (PointIndex i(0); i < out_point_cloud_->num_points(); ++i) {
+      att->SetPointMapEntry(i, kInvalidAttributeValueIndex);
+    }
+  }
+}
+
 bool ObjDecoder::ParseDefinition(Status *status) {
   char c;
   parser::SkipWhitespace(buffer());
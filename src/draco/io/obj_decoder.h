@@ -17,9 +17,11 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "draco/core/decoder_buffer.h"
 #include "draco/core/status.h"
+#include "draco/core/thread_pool.h"
 #include "draco/draco_features.h"
 #include "draco/mesh/mesh.h"
 
@@ -56,15 +58,60 @@ class ObjDecoder {
   void set_use_metadata(bool flag) { use_metadata_ = flag; }
   // Enables preservation of polygons.
   void set_preserve_polygons(bool flag) { preserve_polygons_ = flag; }
+  // Sets a thread pool used for parsing of the input. The input is split into
+  // chunks of whole lines that are parsed concurrently. Inputs with materials
+  // or named objects are always parsed on the calling thread. The decoded
+  // geometry is the same as without the thread pool.
+  void set_thread_pool(ThreadPool *pool) { thread_pool_ = pool; }
 
  protected:
   Status DecodeInternal();
   DecoderBuffer *buffer() { return &buffer_; }
 
  private:
+  // Numbers of parsed definitions of each type.
+  struct DefinitionCounts {
+    int num_obj_faces;
+    int num_positions;
+    int num_tex_coords;
+    int num_normals;
+  };
+
+  // Range of input lines parsed by a single worker in the parallel mode.
+  struct ParseChunk {
+    int64_t begin;
+    int64_t end;
+    // Counts of definitions preceding the chunk and of definitions within the
+    // chunk.
+    DefinitionCounts start;
+    DefinitionCounts count;
+  };
+
   // Resets internal counters for attributes and faces.
   void ResetCounters();
 
+  DefinitionCounts GetCounters() const;
+  void SetCounters(const DefinitionCounts &counts);
+
+  // Parses all definitions until the end of the input or until an error.
+  Status ParseAllDefinitions();
+
+  // Splits the input into |chunks| and counts the definitions in each chunk in
+  // parallel. Returns false when the input cannot be parsed in parallel.
+  bool CountDefinitionsInParallel(std::vector<ParseChunk> *chunks);
+
+  // Parses all data of |chunks| in parallel. Returns false when the result may
+  // differ from the result of the serial parsing, in which case the data must
+  // be cleared with ClearParsedData() and parsed again serially.
+  bool ParseDataInParallel(const std::vector<ParseChunk> &chunks);
+
+  // Returns a copy of this decoder that parses the input range of |chunk|.
+  ObjDecoder CreateChunkWorker(const ParseChunk &chunk) const;
+
+  // Restores the attribute data of |out_point_cloud_| written by the second
+  // pass of the parsing to its initial state.
+  void ClearParsedData();
+
   // Parses the next mesh property definition (position, tex coord, normal, or
   // face). If the parsed data is unrecognized, it will be skipped.
   // Returns false when the end of file was reached.
@@ -134,6 +181,8 @@ class ObjDecoder {
 
   std::vector<std::string> *mesh_files_;
 
+  ThreadPool *thread_pool_;
+
   DecoderBuffer buffer_;
 
   // Data structure that stores the decoded data. |out_point_cloud_| must be
@@ -14,10 +14,13 @@
 //
 #include "draco/io/obj_decoder.h"
 
+#include <cstring>
 #include <sstream>
+#include <string>
 
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -77,6 +80,79 @@ class ObjDecoderTest : public ::testing::Test {
     ASSERT_NE(pc, nullptr) << "Failed to load test model " << file_name;
     ASSERT_GT(pc->num_points(), 0);
   }
+
+  // Decodes |data| with and without a thread pool and verifies that both
+  // decoded meshes are identical.
+  void TestParallelDecoding(const std::string &data, bool preserve_polygons) {
+    std::unique_ptr<Mesh> meshes[2];
+    ThreadPool pool(4);
+    for (int i = 0; i < 2; ++i) {
+      ObjDecoder decoder;
+      decoder.set_preserve_polygons(preserve_polygons);
+      if (i == 1) {
+        decoder.set_thread_pool(&pool);
+      }
+      DecoderBuffer buffer;
+      buffer.Init(data.data(), data.size());
+      meshes[i].reset(new Mesh());
+      DRACO_ASSERT_OK(decoder.DecodeFromBuffer(&buffer, meshes[i].get()));
+    }
+    const Mesh &mesh = *meshes[0];
+    const Mesh &parallel_mesh = *meshes[1];
+    ASSERT_GT(mesh.num_faces(), 0);
+    ASSERT_EQ(mesh.num_faces(), parallel_mesh.num_faces());
+    ASSERT_EQ(mesh.num_points(), parallel_mesh.num_points());
+    ASSERT_EQ(mesh.num_attributes(), parallel_mesh.num_attributes());
+    for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+      ASSERT_EQ(mesh.face(fi), parallel_mesh.face(fi));
+    }
+    for (int a = 0; a < mesh.num_attributes(); ++a) {
+      const PointAttribute *const att = mesh.attribute(a);
+      const PointAttribute *const parallel_att = parallel_mesh.attribute(a);
+      ASSERT_EQ(att->attribute_type(), parallel_att->attribute_type());
+      ASSERT_EQ(att->size(), parallel_att->size());
+      ASSERT_EQ(memcmp(att->buffer()->data(), parallel_att->buffer()->data(),
+                       att->buffer()->data_size()),
+                0);
+      for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+        ASSERT_EQ(att->mapped_index(pi), parallel_att->mapped_index(pi));
+      }
+    }
+  }
+
+  // Generates a large obj file with triangles and quads that refer to the
+  // vertices with both positive and negative indices.
+  static std::string GenerateLargeObj(const std::string &line_end) {
+    const int kGridSize = 300;
+    std::ostringstream obj;
+    obj << "# Generated grid" << line_end;
+    for (int y = 0; y < kGridSize; ++y) {
+      for (int x = 0; x < kGridSize; ++x) {
+        obj << "v " << x * 0.37 << " " << -y * 1.25e-3 << " " << x % 7 << "e-2"
+            << line_end;
+        obj << "vt " << x / 300.0 << " " << y / 300.0 << line_end;
+        obj << "vn 0 " << (x % 2 ? "-1.0" : "1") << " 0" << line_end;
+      }
+    }
+    for (int y = 0; y + 1 < kGridSize; ++y) {
+      for (int x = 0; x + 1 < kGridSize; ++x) {
+        const int v = y * kGridSize + x + 1;
+        if (x % 3 == 0) {
+          obj << "f " << v << "/" << v << "/" << v << " " << v + 1 << "/"
+              << v + 1 << "/" << v + 1 << " " << v + kGridSize + 1 << "/"
+              << v + kGridSize + 1 << "/" << v + kGridSize + 1 << " "
+              << v + kGridSize << "/" << v + kGridSize << "/" << v + kGridSize
+              << line_end;
+        } else {
+          obj << "f " << v << "//" << v << " " << v + 1 << "//" << v + 1
+              << " " << v + kGridSize << "//" << v + kGridSize << line_end;
+          // Negative indices are relative to the last parsed vertex.
+          obj << "f -1/-1/-1 -2/-2/-2 -3/-3/-3" << line_end;
+        }
+      }
+    }
+    return obj.str();
+  }
 };
 
 TEST_F(ObjDecoderTest, ExtraVertexOBJ) {
@@ -281,6 +357,18 @@ TEST_F(ObjDecoderTest, WrongAttributeMapping) {
   ASSERT_EQ(mesh->attribute(0)->size(), 3);
 }
 
+TEST_F(ObjDecoderTest, TestParallelDecoding) {
+  // Tests that decoding on a thread pool produces the same mesh as the serial
+  // decoding.
+  const std::string obj = GenerateLargeObj("\n");
+  ASSERT_GT(obj.size(), 4 << 20);
+  TestParallelDecoding(obj, false);
+  TestParallelDecoding(obj, true);
+  TestParallelDecoding(GenerateLargeObj("\r\n"), false);
+  // Materials are always parsed serially.
+  TestParallelDecoding("usemtl Red\n" + obj, false);
+}
+
 TEST_F(ObjDecoderTest, TestObjDecodingAll) {
   // test if we can read all obj that are currently in test folder.
   test_decoding("bunny_norm.obj");
@@ -14,6 +14,10 @@
 //
 #include "draco/io/obj_encoder.h"
 
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 
 #include "draco/attributes/geometry_attribute.h"
@@ -24,6 +28,96 @@
 
 namespace draco {
 
+namespace {
+
+// Appends the decimal representation of |val| to |out|.
+void AppendInt(int32_t val, std::string *out) {
+  char digits[12];
+  int num_digits = 0;
+  uint32_t abs_val = static_cast<uint32_t>(val);
+  if (val < 0) {
+    out->push_back('-');
+    abs_val = 0u - abs_val;
+  }
+  do {
+    digits[num_digits++] = static_cast<char>('0' + abs_val % 10);
+    abs_val /= 10;
+  } while (abs_val > 0);
+  while (num_digits > 0) {
+    out->push_back(digits[--num_digits]);
+  }
+}
+
+// Appends |val| to |out| in the same format as printf("%F"), i.e. with six
+// fractional digits rounded to nearest with ties to even. Finite values with
+// a magnitude below 2^43 are converted exactly with integer arithmetic, the
+// remaining values fall back to snprintf().
+void AppendFloat(float val, std::string *out) {
+  uint32_t bits;
+  memcpy(&bits, &val, sizeof(bits));
+  const int biased_exponent = static_cast<int>((bits >> 23) & 0xff);
+  // |val| is equal to mantissa * 2^exponent.
+  uint64_t mantissa = bits & 0x7fffff;
+  int exponent = -149;
+  if (biased_exponent > 0) {
+    mantissa |= 0x800000;
+    exponent = biased_exponent - 150;
+  }
+  if (biased_exponent == 0xff || exponent > 19) {
+    // Use %F instead of %f to make the floating point non-locale aware.
+    char num_buffer[64];
+    snprintf(num_buffer, sizeof(num_buffer), "%F", val);
+    out->append(num_buffer);
+    return;
+  }
+  // Compute round(|val| * 10^6). The product of the mantissa and 10^6 fits in
+  // 44 bits so that it can be shifted by up to 19 bits without overflow.
+  uint64_t scaled = mantissa * 1000000;
+  if (exponent >= 0) {
+    scaled <<= exponent;
+  } else if (exponent < -63) {
+    scaled = 0;
+  } else {
+    const int shift = -exponent;
+    const uint64_t remainder = scaled & ((uint64_t(1) << shift) - 1);
+    const uint64_t half = uint64_t(1) << (shift - 1);
+    scaled >>= shift;
+    if (remainder > half || (remainder == half && (scaled & 1))) {
+      ++scaled;
+    }
+  }
+  if (bits >> 31) {
+    out->push_back('-');
+  }
+  uint64_t integer_part = scaled / 1000000;
+  uint32_t fraction = static_cast<uint32_t>(scaled % 1000000);
+  char digits[32];
+  int num_digits = 0;
+  for (int i = 0; i < 6; ++i) {
+    digits[num_digits++] = static_cast<char>('0' + fraction % 10);
+    fraction /= 10;
+  }
+  digits[num_digits++] = '.';
+  do {
+    digits[num_digits++] = static_cast<char>('0' + integer_part % 10);
+    integer_part /= 10;
+  } while (integer_part > 0);
+  while (num_digits > 0) {
+    out->push_back(digits[--num_digits]);
+  }
+}
+
+void AppendFloatList(const float *vals, int num_vals, std::string *out) {
+  for (int i = 0; i < num_vals; ++i) {
+    if (i > 0) {
+      out->push_back(' ');
+    }
+    AppendFloat(vals[i], out);
+  }
+}
+
+}  // namespace
+
 ObjEncoder::ObjEncoder()
     : pos_att_(nullptr),
       tex_coord_att_(nullptr),
@@ -32,10 +126,12 @@ ObjEncoder::ObjEncoder()
       sub_obj_att_(nullptr),
       added_edges_att_(nullptr),
       out_buffer_(nullptr),
+      out_file_(nullptr),
       in_point_cloud_(nullptr),
       in_mesh_(nullptr),
       current_sub_obj_id_(-1),
-      current_material_id_(-1) {}
+      current_material_id_(-1),
+      thread_pool_(nullptr) {}
 
 bool ObjEncoder::EncodeToFile(const PointCloud &pc,
                               const std::string &file_name) {
@@ -45,14 +141,7 @@ bool ObjEncoder::EncodeToFile(const PointCloud &pc,
     return false;  // File could not be opened.
   }
   file_name_ = file_name;
-  // Encode the mesh into a buffer.
-  EncoderBuffer buffer;
-  if (!EncodeToBuffer(pc, &buffer)) {
-    return false;
-  }
-  // Write the buffer into the file.
-  file->Write(buffer.data(), buffer.size());
-  return true;
+  return EncodeToFile(pc, file.get());
 }
 
 bool ObjEncoder::EncodeToFile(const Mesh &mesh, const std::string &file_name) {
@@ -60,6 +149,23 @@ bool ObjEncoder::EncodeToFile(const Mesh &mesh, const std::string &file_name) {
   return EncodeToFile(static_cast<const PointCloud &>(mesh), file_name);
 }
 
+bool ObjEncoder::EncodeToFile(const PointCloud &pc, FileWriterInterface *file) {
+  // The buffer holds only the output that was not written to |file| yet.
+  EncoderBuffer buffer;
+  in_point_cloud_ = &pc;
+  out_buffer_ = &buffer;
+  out_file_ = file;
+  if (!EncodeInternal() || !FlushOutput(true)) {
+    return ExitAndCleanup(false);
+  }
+  return ExitAndCleanup(true);
+}
+
+bool ObjEncoder::EncodeToFile(const Mesh &mesh, FileWriterInterface *file) {
+  in_mesh_ = &mesh;
+  return EncodeToFile(static_cast<const PointCloud &>(mesh), file);
+}
+
 bool ObjEncoder::EncodeToBuffer(const PointCloud &pc,
                                 EncoderBuffer *out_buffer) {
   in_point_cloud_ = &pc;
@@ -112,6 +218,7 @@ bool ObjEncoder::ExitAndCleanup(bool return_value) {
   in_mesh_ = nullptr;
   in_point_cloud_ = nullptr;
   out_buffer_ = nullptr;
+  out_file_ = nullptr;
   pos_att_ = nullptr;
   tex_coord_att_ = nullptr;
   normal_att_ = nullptr;
@@ -124,6 +231,26 @@ bool ObjEncoder::ExitAndCleanup(bool return_value) {
   return return_value;
 }
 
+bool ObjEncoder::WriteOutput(const char *data, size_t size) {
+  buffer()->Encode(data, size);
+  return FlushOutput(false);
+}
+
+bool ObjEncoder::FlushOutput(bool force) {
+  // Size of the blocks written to the output file.
+  constexpr size_t kOutputBlockSize = 1 << 22;
+  if (out_file_ == nullptr ||
+      (!force && buffer()->size() < kOutputBlockSize)) {
+    return true;
+  }
+  if (buffer()->size() > 0 &&
+      !out_file_->Write(buffer()->data(), buffer()->size())) {
+    return false;
+  }
+  buffer()->Clear();
+  return true;
+}
+
 bool ObjEncoder::GetAddedEdges() {
   const GeometryMetadata *mesh_metadata = in_mesh_->GetMetadata();
   if (!mesh_metadata) {
@@ -191,9 +318,11 @@ bool ObjEncoder::EncodeMaterialFileName() {
   }
   if (!material_metadata->GetEntryString("file_name", &material_file_name))
     return false;
-  buffer()->Encode("mtllib ", 7);
-  buffer()->Encode(material_file_name.c_str(), material_file_name.size());
-  buffer()->Encode("\n", 1);
+  if (!WriteOutput("mtllib ", 7) ||
+      !WriteOutput(material_file_name.c_str(), material_file_name.size()) ||
+      !WriteOutput("\n", 1)) {
+    return false;
+  }
   material_id_to_name_.clear();
   for (const auto &entry : material_metadata->entries()) {
     // Material id must be int.
@@ -218,14 +347,8 @@ bool ObjEncoder::EncodePositions() {
   if (att == nullptr || att->size() == 0) {
     return false;  // Position attribute must be valid.
   }
-  std::array<float, 3> value;
-  for (AttributeValueIndex i(0); i < static_cast<uint32_t>(att->size()); ++i) {
-    if (!att->ConvertValue<float, 3>(i, &value[0])) {
-      return false;
-    }
-    buffer()->Encode("v ", 2);
-    EncodeFloatList(&value[0], 3);
-    buffer()->Encode("\n", 1);
+  if (!EncodeFloatAttribute<3>(*att, "v ")) {
+    return false;
   }
   pos_att_ = att;
   return true;
@@ -237,14 +360,8 @@ bool ObjEncoder::EncodeTextureCoordinates() {
   if (att == nullptr || att->size() == 0) {
     return true;  // It's OK if we don't have texture coordinates.
   }
-  std::array<float, 2> value;
-  for (AttributeValueIndex i(0); i < static_cast<uint32_t>(att->size()); ++i) {
-    if (!att->ConvertValue<float, 2>(i, &value[0])) {
-      return false;
-    }
-    buffer()->Encode("vt ", 3);
-    EncodeFloatList(&value[0], 2);
-    buffer()->Encode("\n", 1);
+  if (!EncodeFloatAttribute<2>(*att, "vt ")) {
+    return false;
   }
   tex_coord_att_ = att;
   return true;
@@ -256,87 +373,164 @@ bool ObjEncoder::EncodeNormals() {
   if (att == nullptr || att->size() == 0) {
     return true;  // It's OK if we don't have normals.
   }
-  std::array<float, 3> value;
-  for (AttributeValueIndex i(0); i < static_cast<uint32_t>(att->size()); ++i) {
-    if (!att->ConvertValue<float, 3>(i, &value[0])) {
-      return false;
-    }
-    buffer()->Encode("vn ", 3);
-    EncodeFloatList(&value[0], 3);
-    buffer()->Encode("\n", 1);
+  if (!EncodeFloatAttribute<3>(*att, "vn ")) {
+    return false;
   }
   normal_att_ = att;
   return true;
 }
 
-bool ObjEncoder::EncodeFaces() {
-  if (added_edges_att_ != nullptr) {
-    return EncodePolygonalFaces();
-  }
-  for (FaceIndex i(0); i < in_mesh_->num_faces(); ++i) {
-    EncodeFaceAttributes(i);
-    buffer()->Encode('f');
-    for (int j = 0; j < 3; ++j) {
-      if (!EncodeFaceCorner(i, j)) {
+template <int num_components_t>
+bool ObjEncoder::EncodeFloatAttribute(const PointAttribute &att,
+                                      const char *prefix) {
+  return EncodeLines(static_cast<int>(att.size()), true,
+                     [&](int i, std::string *out) {
+                       std::array<float, num_components_t> value;
+                       if (!att.ConvertValue<float, num_components_t>(
+                               AttributeValueIndex(i), &value[0])) {
+                         return false;
+                       }
+                       out->append(prefix);
+                       AppendFloatList(&value[0], num_components_t, out);
+                       out->push_back('\n');
+                       return true;
+                     });
+}
+
+bool ObjEncoder::EncodeLines(
+    int num_lines, bool allow_parallel,
+    const std::function<bool(int, std::string *)> &format_line) {
+  // Number of lines formatted into a single string before it is appended to
+  // the output buffer.
+  constexpr int kLinesPerChunk = 1 << 14;
+  const int num_chunks = (num_lines + kLinesPerChunk - 1) / kLinesPerChunk;
+  if (!allow_parallel || thread_pool_ == nullptr || num_chunks < 2) {
+    std::string text;
+    for (int i = 0; i < num_lines; ++i) {
+      if (!format_line(i, &text)) {
+        return false;
+      }
+      if (text.size() >= 64 * kLinesPerChunk) {
+        if (!WriteOutput(text.data(), text.size())) {
+          return false;
+        }
+        text.clear();
+      }
+    }
+    return WriteOutput(text.data(), text.size());
+  }
+  // Format groups of chunks concurrently. Each group is appended to the
+  // output as soon as it is done to limit the amount of intermediate text.
+  const int group_size = 4 * thread_pool_->num_threads();
+  std::vector<std::string> chunk_text(group_size);
+  std::vector<uint8_t> is_chunk_valid(group_size);
+  for (int first_chunk = 0; first_chunk < num_chunks;
+       first_chunk += group_size) {
+    const int num_group_chunks = std::min(group_size, num_chunks - first_chunk);
+    ParallelFor(thread_pool_, num_group_chunks, [&](int c) {
+      const int begin = (first_chunk + c) * kLinesPerChunk;
+      const int end = std::min(num_lines, begin + kLinesPerChunk);
+      std::string *const text = &chunk_text[c];
+      text->clear();
+      is_chunk_valid[c] = 0;
+      for (int i = begin; i < end; ++i) {
+        if (!format_line(i, text)) {
+          return;
+        }
+      }
+      is_chunk_valid[c] = 1;
+    });
+    for (int c = 0; c < num_group_chunks; ++c) {
+      if (!is_chunk_valid[c]) {
+        return false;
+      }
+      if (!WriteOutput(chunk_text[c].data(), chunk_text[c].size())) {
         return false;
       }
     }
-    buffer()->Encode("\n", 1);
   }
   return true;
 }
 
+bool ObjEncoder::EncodeFaces() {
+  if (added_edges_att_ != nullptr) {
+    return EncodePolygonalFaces();
+  }
+  // Sub-object and material lines are emitted only when they change between
+  // consecutive faces so they must be formatted in order.
+  const bool allow_parallel =
+      sub_obj_att_ == nullptr && material_att_ == nullptr;
+  return EncodeLines(in_mesh_->num_faces(), allow_parallel,
+                     [this](int i, std::string *out) {
+                       const FaceIndex fi(i);
+                       if (!EncodeFaceAttributes(fi, out)) {
+                         return false;
+                       }
+                       out->push_back('f');
+                       for (int j = 0; j < 3; ++j) {
+                         if (!EncodeFaceCorner(fi, j, out)) {
+                           return false;
+                         }
+                       }
+                       out->push_back('\n');
+                       return true;
+                     });
+}
+
 bool ObjEncoder::EncodePolygonalFaces() {
   // TODO(vytyaz): This could be a much smaller set of visited face indices.
   std::vector<bool> triangle_visited(in_mesh_->num_faces(), false);
   PolygonEdges polygon_edges;
   std::unique_ptr<CornerTable> corner_table =
       CreateCornerTableFromPositionAttribute(in_mesh_);
-  for (FaceIndex fi(0); fi < in_mesh_->num_faces(); ++fi) {
-    EncodeFaceAttributes(fi);
-    // Reconstruct polygon from the added edges attribute if available.
-    polygon_edges.clear();
-    FindOriginalFaceEdges(fi, *corner_table, &triangle_visited, &polygon_edges);
-
-    // Polygon edges could be empty if this triangle has been visited as part
-    // of a polygon discovery that started from an earler face.
-    if (polygon_edges.empty()) {
-      continue;
-    }
-
-    // Traverse a polygon by following its edges. The starting point is not
-    // guaranteed to be the same as in the original polygon. It is
-    // deterministic, however, and defined by std::map behavior.
-    const AttributeValueIndex first_position_index =
-        polygon_edges.begin()->first;
-    AttributeValueIndex position_index = first_position_index;
-    buffer()->Encode('f');
-    do {
-      // Get the next polygon point index by following polygon edge.
-      const PointIndex pi = polygon_edges[position_index];
-      EncodeFaceCorner(pi);
-      position_index = pos_att_->mapped_index(pi).value();
-    } while (position_index != first_position_index);
-    buffer()->Encode("\n", 1);
-  }
-  return true;
+  return EncodeLines(
+      in_mesh_->num_faces(), false, [&](int i, std::string *out) {
+        const FaceIndex fi(i);
+        EncodeFaceAttributes(fi, out);
+        // Reconstruct polygon from the added edges attribute if available.
+        polygon_edges.clear();
+        FindOriginalFaceEdges(fi, *corner_table, &triangle_visited,
+                              &polygon_edges);
+
+        // Polygon edges could be empty if this triangle has been visited as
+        // part of a polygon discovery that started from an earler face.
+        if (polygon_edges.empty()) {
+          return true;
+        }
+
+        // Traverse a polygon by following its edges. The starting point is
+        // not guaranteed to be the same as in the original polygon. It is
+        // deterministic, however, and defined by std::map behavior.
+        const AttributeValueIndex first_position_index =
+            polygon_edges.begin()->first;
+        AttributeValueIndex position_index = first_position_index;
+        out->push_back('f');
+        do {
+          // Get the next polygon point index by following polygon edge.
+          const PointIndex pi = polygon_edges[position_index];
+          EncodeFaceCorner(pi, out);
+          position_index = pos_att_->mapped_index(pi).value();
+        } while (position_index != first_position_index);
+        out->push_back('\n');
+        return true;
+      });
 }
 
-bool ObjEncoder::EncodeFaceAttributes(FaceIndex face_id) {
+bool ObjEncoder::EncodeFaceAttributes(FaceIndex face_id, std::string *out) {
   if (sub_obj_att_) {
-    if (!EncodeSubObject(face_id)) {
+    if (!EncodeSubObject(face_id, out)) {
       return false;
     }
   }
   if (material_att_) {
-    if (!EncodeMaterial(face_id)) {
+    if (!EncodeMaterial(face_id, out)) {
       return false;
     }
   }
   return true;
 }
 
-bool ObjEncoder::EncodeMaterial(FaceIndex face_id) {
+bool ObjEncoder::EncodeMaterial(FaceIndex face_id, std::string *out) {
   int material_id = 0;
   // Pick the first corner, all corners of a face should have same id.
   const PointIndex vert_index = in_mesh_->face(face_id)[0];
@@ -347,20 +541,20 @@ bool ObjEncoder::EncodeMaterial(FaceIndex face_id) {
 
   if (material_id != current_material_id_) {
     // Update material information.
-    buffer()->Encode("usemtl ", 7);
+    out->append("usemtl ");
     const auto mat_ptr = material_id_to_name_.find(material_id);
     // If the material id is not found.
     if (mat_ptr == material_id_to_name_.end()) {
       return false;
     }
-    buffer()->Encode(mat_ptr->second.c_str(), mat_ptr->second.size());
-    buffer()->Encode("\n", 1);
+    out->append(mat_ptr->second);
+    out->push_back('\n');
     current_material_id_ = material_id;
   }
   return true;
 }
 
-bool ObjEncoder::EncodeSubObject(FaceIndex face_id) {
+bool ObjEncoder::EncodeSubObject(FaceIndex face_id, std::string *out) {
   int sub_obj_id = 0;
   // Pick the first corner, all corners of a face should have same id.
   const PointIndex vert_index = in_mesh_->face(face_id)[0];
@@ -369,63 +563,44 @@ bool ObjEncoder::EncodeSubObject(FaceIndex face_id) {
     return false;
   }
   if (sub_obj_id != current_sub_obj_id_) {
-    buffer()->Encode("o ", 2);
+    out->append("o ");
     const auto sub_obj_ptr = sub_obj_id_to_name_.find(sub_obj_id);
     if (sub_obj_ptr == sub_obj_id_to_name_.end()) {
       return false;
     }
-    buffer()->Encode(sub_obj_ptr->second.c_str(), sub_obj_ptr->second.size());
-    buffer()->Encode("\n", 1);
+    out->append(sub_obj_ptr->second);
+    out->push_back('\n');
     current_sub_obj_id_ = sub_obj_id;
   }
   return true;
 }
 
-bool ObjEncoder::EncodeFaceCorner(FaceIndex face_id, int local_corner_id) {
+bool ObjEncoder::EncodeFaceCorner(FaceIndex face_id, int local_corner_id,
+                                  std::string *out) {
   const PointIndex vert_index = in_mesh_->face(face_id)[local_corner_id];
-  return EncodeFaceCorner(vert_index);
+  return EncodeFaceCorner(vert_index, out);
 }
 
-bool ObjEncoder::EncodeFaceCorner(PointIndex vert_index) {
-  buffer()->Encode(' ');
+bool ObjEncoder::EncodeFaceCorner(PointIndex vert_index, std::string *out) {
+  out->push_back(' ');
   // Note that in the OBJ format, all indices are encoded starting from index 1.
   // Encode position index.
-  EncodeInt(pos_att_->mapped_index(vert_index).value() + 1);
+  AppendInt(pos_att_->mapped_index(vert_index).value() + 1, out);
   if (tex_coord_att_ || normal_att_) {
     // Encoding format is pos_index/tex_coord_index/normal_index.
     // If tex_coords are not present, we must encode pos_index//normal_index.
-    buffer()->Encode('/');
+    out->push_back('/');
     if (tex_coord_att_) {
-      EncodeInt(tex_coord_att_->mapped_index(vert_index).value() + 1);
+      AppendInt(tex_coord_att_->mapped_index(vert_index).value() + 1, out);
     }
     if (normal_att_) {
-      buffer()->Encode('/');
-      EncodeInt(normal_att_->mapped_index(vert_index).value() + 1);
+      out->push_back('/');
+      AppendInt(normal_att_->mapped_index(vert_index).value() + 1, out);
     }
   }
   return true;
 }
 
-void ObjEncoder::EncodeFloat(float val) {
-  // Use %F instead of %f to make the floating point non-locale aware.
-  snprintf(num_buffer_, sizeof(num_buffer_), "%F", val);
-  buffer()->Encode(num_buffer_, strlen(num_buffer_));
-}
-
-void ObjEncoder::EncodeFloatList(float *vals, int num_vals) {
-  for (int i = 0; i < num_vals; ++i) {
-    if (i > 0) {
-      buffer()->Encode(' ');
-    }
-    EncodeFloat(vals[i]);
-  }
-}
-
-void ObjEncoder::EncodeInt(int32_t val) {
-  snprintf(num_buffer_, sizeof(num_buffer_), "%d", val);
-  buffer()->Encode(num_buffer_, strlen(num_buffer_));
-}
-
 bool ObjEncoder::IsNewEdge(const CornerTable &ct, CornerIndex ci) const {
   const PointIndex pi = in_mesh_->CornerToPointId(ci);
   if (added_edges_att_ != nullptr) {
@@ -15,9 +15,13 @@
 #ifndef DRACO_IO_OBJ_ENCODER_H_
 #define DRACO_IO_OBJ_ENCODER_H_
 
+#include <functional>
+#include <string>
 #include <unordered_map>
 
 #include "draco/core/encoder_buffer.h"
+#include "draco/core/thread_pool.h"
+#include "draco/io/file_writer_interface.h"
 #include "draco/mesh/corner_table.h"
 #include "draco/mesh/mesh.h"
 
@@ -35,16 +39,37 @@ class ObjEncoder {
   bool EncodeToFile(const PointCloud &pc, const std::string &file_name);
   bool EncodeToFile(const Mesh &mesh, const std::string &file_name);
 
+  // Encodes the mesh or the point cloud and writes it to |file|. The output is
+  // written in blocks of a bounded size as it is formatted, so the whole text
+  // is never held in memory. Returns false when either the encoding or
+  // writing to |file| failed.
+  bool EncodeToFile(const PointCloud &pc, FileWriterInterface *file);
+  bool EncodeToFile(const Mesh &mesh, FileWriterInterface *file);
+
   // Encodes the mesh or the point cloud into a buffer.
   bool EncodeToBuffer(const PointCloud &pc, EncoderBuffer *out_buffer);
   bool EncodeToBuffer(const Mesh &mesh, EncoderBuffer *out_buffer);
 
+  // Sets a thread pool used for formatting of the output. Vertex data and
+  // faces are formatted in concurrent chunks that are joined in order. Faces
+  // of meshes with materials or named objects are always formatted on the
+  // calling thread. The output is the same as without the thread pool.
+  void set_thread_pool(ThreadPool *pool) { thread_pool_ = pool; }
+
  protected:
   bool EncodeInternal();
   EncoderBuffer *buffer() const { return out_buffer_; }
   bool ExitAndCleanup(bool return_value);
 
  private:
+  // Appends |size| bytes of |data| to the output buffer. When encoding to a
+  // file, the buffer is written to the file once it grows over a fixed block
+  // size. Returns false when writing to the file failed.
+  bool WriteOutput(const char *data, size_t size);
+  // Writes the content of the output buffer to the output file, if any. Only
+  // buffers larger than the block size are written unless |force| is true.
+  bool FlushOutput(bool force);
+
   typedef AttributeValueIndex PositionIndex;
   typedef std::map<PositionIndex, PointIndex> PolygonEdges;
   bool GetAddedEdges();
@@ -55,15 +80,24 @@ class ObjEncoder {
   bool EncodeNormals();
   bool EncodeFaces();
   bool EncodePolygonalFaces();
-  bool EncodeFaceAttributes(FaceIndex face_id);
-  bool EncodeSubObject(FaceIndex face_id);
-  bool EncodeMaterial(FaceIndex face_id);
-  bool EncodeFaceCorner(FaceIndex face_id, int local_corner_id);
-  bool EncodeFaceCorner(PointIndex vert_index);
-
-  void EncodeFloat(float val);
-  void EncodeFloatList(float *vals, int num_vals);
-  void EncodeInt(int32_t val);
+  bool EncodeFaceAttributes(FaceIndex face_id, std::string *out);
+  bool EncodeSubObject(FaceIndex face_id, std::string *out);
+  bool EncodeMaterial(FaceIndex face_id, std::string *out);
+  bool EncodeFaceCorner(FaceIndex face_id, int local_corner_id,
+                        std::string *out);
+  bool EncodeFaceCorner(PointIndex vert_index, std::string *out);
+
+  // Encodes all values of |att| as lines starting with |prefix|.
+  template <int num_components_t>
+  bool EncodeFloatAttribute(const PointAttribute &att, const char *prefix);
+
+  // Formats |num_lines| lines and appends them to the output buffer in order.
+  // |format_line| appends line |i| to the given string and returns false on
+  // error. When |allow_parallel| is true and a thread pool is set, the lines
+  // are formatted in concurrent chunks, so |format_line| must not depend on
+  // the previously formatted lines.
+  bool EncodeLines(int num_lines, bool allow_parallel,
+                   const std::function<bool(int, std::string *)> &format_line);
   bool IsNewEdge(const CornerTable &ct, CornerIndex ci) const;
   void FindOriginalFaceEdges(FaceIndex face_index,
                              const CornerTable &corner_table,
@@ -81,10 +115,9 @@ class ObjEncoder {
   // Stores per-corner triangulation information for polygon reconstruction.
   const PointAttribute *added_edges_att_;
 
-  // Buffer used for encoding float/int numbers.
-  char num_buffer_[20];
-
   EncoderBuffer *out_buffer_;
+  // Output file of EncodeToFile() or nullptr when encoding into a buffer.
+  FileWriterInterface *out_file_;
 
   const PointCloud *in_point_cloud_;
   const Mesh *in_mesh_;
@@ -100,6 +133,8 @@ class ObjEncoder {
   int current_material_id_;
 
   std::string file_name_;
+
+  ThreadPool *thread_pool_;
 };
 
 }  // namespace draco
@@ -14,18 +14,47 @@
 //
 #include "draco/io/obj_encoder.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
 #include <sstream>
+#include <string>
 
 #include "draco/attributes/geometry_attribute.h"
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
 #include "draco/io/file_reader_factory.h"
 #include "draco/io/file_reader_interface.h"
 #include "draco/io/file_utils.h"
+#include "draco/io/file_writer_interface.h"
 #include "draco/io/obj_decoder.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
+#include "draco/point_cloud/point_cloud_builder.h"
 
 namespace draco {
 
+// File writer that stores all written data.
+class StringFileWriter : public FileWriterInterface {
+ public:
+  bool Write(const char *buffer, size_t size) override {
+    data_.append(buffer, size);
+    max_write_size_ = std::max(max_write_size_, size);
+    ++num_writes_;
+    return true;
+  }
+  const std::string &data() const { return data_; }
+  size_t max_write_size() const { return max_write_size_; }
+  int num_writes() const { return num_writes_; }
+
+ private:
+  std::string data_;
+  size_t max_write_size_ = 0;
+  int num_writes_ = 0;
+};
+
 class ObjEncoderTest : public ::testing::Test {
  protected:
   void CompareMeshes(const Mesh *mesh0, const Mesh *mesh1) {
@@ -141,4 +170,149 @@ TEST_F(ObjEncoderTest, TestObjOctagonPreserved) {
   ASSERT_EQ(data_encoded, data_golden);
 }
 
+TEST_F(ObjEncoderTest, TestFloatFormatting) {
+  // Tests that all values are written with the same text as printf("%F").
+  std::vector<float> values = {0.f,
+                               -0.f,
+                               1.f,
+                               -1.5f,
+                               0.0000005f,
+                               -0.0000005f,
+                               0.0000015f,
+                               0.1f,
+                               123456.789f,
+                               1e12f,
+                               -3e38f,
+                               std::numeric_limits<float>::min(),
+                               std::numeric_limits<float>::denorm_min(),
+                               std::numeric_limits<float>::max(),
+                               std::numeric_limits<float>::infinity(),
+                               -std::numeric_limits<float>::infinity(),
+                               std::numeric_limits<float>::quiet_NaN()};
+  std::mt19937 generator(7);
+  std::uniform_int_distribution<uint32_t> bits_distribution;
+  std::uniform_real_distribution<float> value_distribution(-1000.f, 1000.f);
+  for (int i = 0; i < 30000; ++i) {
+    uint32_t bits = bits_distribution(generator);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    values.push_back(value);
+    values.push_back(value_distribution(generator));
+  }
+  while (values.size() % 3 != 0) {
+    values.push_back(0.25f);
+  }
+  const int num_points = static_cast<int>(values.size() / 3);
+  PointCloudBuilder builder;
+  builder.Start(num_points);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  builder.SetAttributeValuesForAllPoints(pos_att_id, values.data(), 0);
+  std::unique_ptr<PointCloud> pc = builder.Finalize(false);
+  ASSERT_NE(pc, nullptr);
+
+  std::string expected;
+  char num_buffer[256];
+  for (int i = 0; i < num_points; ++i) {
+    snprintf(num_buffer, sizeof(num_buffer), "v %F %F %F\n", values[3 * i],
+             values[3 * i + 1], values[3 * i + 2]);
+    expected += num_buffer;
+  }
+  ThreadPool pool(4);
+  for (ThreadPool *const thread_pool : {static_cast<ThreadPool *>(nullptr),
+                                        &pool}) {
+    ObjEncoder encoder;
+    encoder.set_thread_pool(thread_pool);
+    EncoderBuffer buffer;
+    ASSERT_TRUE(encoder.EncodeToBuffer(*pc, &buffer));
+    ASSERT_EQ(std::string(buffer.data(), buffer.size()), expected);
+  }
+}
+
+TEST_F(ObjEncoderTest, TestParallelEncoding) {
+  // Tests that a mesh is encoded to the same text with and without a thread
+  // pool.
+  const int kGridSize = 150;
+  TriangleSoupMeshBuilder builder;
+  builder.Start(2 * kGridSize * kGridSize);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  const int tex_att_id =
+      builder.AddAttribute(GeometryAttribute::TEX_COORD, 2, DT_FLOAT32);
+  const int normal_att_id =
+      builder.AddAttribute(GeometryAttribute::NORMAL, 3, DT_FLOAT32);
+  const Vector3f normal(0.f, 0.f, 1.f);
+  // Each grid cell is split into two triangles.
+  const int kFaceCorners[2][3] = {{0, 1, 2}, {2, 1, 3}};
+  FaceIndex fi(0);
+  for (int y = 0; y < kGridSize; ++y) {
+    for (int x = 0; x < kGridSize; ++x) {
+      const Vector3f p[4] = {Vector3f(x, y, 0.1f * x), Vector3f(x + 1, y, 0.f),
+                             Vector3f(x, y + 1, 0.f),
+                             Vector3f(x + 1, y + 1, 0.3f * y)};
+      Vector2f t[4];
+      for (int i = 0; i < 4; ++i) {
+        t[i] = Vector2f(p[i][0] / kGridSize, p[i][1] / kGridSize);
+      }
+      for (const auto &corners : kFaceCorners) {
+        builder.SetAttributeValuesForFace(pos_att_id, fi, &p[corners[0]],
+                                          &p[corners[1]], &p[corners[2]]);
+        builder.SetAttributeValuesForFace(tex_att_id, fi, &t[corners[0]],
+                                          &t[corners[1]], &t[corners[2]]);
+        builder.SetAttributeValuesForFace(normal_att_id, fi, &normal, &normal,
+                                          &normal);
+        ++fi;
+      }
+    }
+  }
+  std::unique_ptr<Mesh> mesh = builder.Finalize();
+  ASSERT_NE(mesh, nullptr);
+
+  EncoderBuffer expected;
+  ObjEncoder encoder;
+  ASSERT_TRUE(encoder.EncodeToBuffer(*mesh, &expected));
+  ThreadPool pool(4);
+  encoder.set_thread_pool(&pool);
+  EncoderBuffer buffer;
+  ASSERT_TRUE(encoder.EncodeToBuffer(*mesh, &buffer));
+  ASSERT_EQ(std::string(buffer.data(), buffer.size()),
+            std::string(expected.data(), expected.size()));
+
+  DecoderBuffer decoder_buffer;
+  decoder_buffer.Init(buffer.data(), buffer.size());
+  Mesh decoded_mesh;
+  ObjDecoder decoder;
+  DRACO_ASSERT_OK(decoder.DecodeFromBuffer(&decoder_buffer, &decoded_mesh));
+  ASSERT_EQ(decoded_mesh.num_faces(), mesh->num_faces());
+}
+
+TEST_F(ObjEncoderTest, TestStreamingEncoding) {
+  // Tests that a large point cloud is written to a file in bounded blocks and
+  // that the written data matches the data encoded into a buffer.
+  constexpr int kNumPoints = 1000000;
+  PointCloudBuilder builder;
+  builder.Start(kNumPoints);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  for (PointIndex i(0); i < kNumPoints; ++i) {
+    const Vector3f pos(0.5f * i.value(), i.value() % 1000, 0.25f);
+    builder.SetAttributeValueForPoint(pos_att_id, i, &pos);
+  }
+  std::unique_ptr<PointCloud> pc = builder.Finalize(false);
+  ASSERT_NE(pc, nullptr);
+
+  ObjEncoder encoder;
+  EncoderBuffer expected;
+  ASSERT_TRUE(encoder.EncodeToBuffer(*pc, &expected));
+  ThreadPool pool(4);
+  for (const bool use_thread_pool : {false, true}) {
+    encoder.set_thread_pool(use_thread_pool ? &pool : nullptr);
+    StringFileWriter file;
+    ASSERT_TRUE(encoder.EncodeToFile(*pc, &file));
+    ASSERT_EQ(file.data(), std::string(expected.data(), expected.size()));
+    ASSERT_GT(file.num_writes(), 1);
+    ASSERT_LT(file.max_write_size(), expected.size() / 2);
+  }
+}
+
 }  // namespace draco
@@ -0,0 +1,415 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/out_of_core_point_cloud_encoder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include "draco/compression/expert_encode.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/varint_encoding.h"
+#include "draco/io/file_reader_factory.h"
+#include "draco/io/file_writer_factory.h"
+
+namespace draco {
+
+namespace {
+
+// Size of the pieces in which the encoded chunks are copied into the output
+// file.
+constexpr size_t kCopyBlockSize = 1 << 24;
+
+// Returns the size of a single value of |att|.
+int GetValueSize(const GeometryAttribute &att) {
+  return DataTypeLength(att.data_type()) * att.num_components();
+}
+
+// Consecutive points of a chunk stored in the spill file.
+struct ChunkRange {
+  int64_t offset;
+  int64_t num_points;
+};
+
+}  // namespace
+
+OutOfCorePointCloudEncoder::OutOfCorePointCloudEncoder()
+    : max_chunk_points_(1 << 20),
+      max_buffered_bytes_(int64_t{1} << 28),
+      tile_size_(0.f),
+      grid_size_{0, 0, 0},
+      spill_size_(0),
+      buffered_bytes_(0),
+      point_size_(0),
+      num_points_(0),
+      num_encoded_chunks_(0) {}
+
+OutOfCorePointCloudEncoder::~OutOfCorePointCloudEncoder() { Clear(); }
+
+void OutOfCorePointCloudEncoder::Clear() {
+  spill_writer_.reset();
+  if (!spill_file_name_.empty()) {
+    std::remove(spill_file_name_.c_str());
+    std::remove(chunks_file_name_.c_str());
+  }
+  spill_file_name_.clear();
+  chunks_file_name_.clear();
+  spill_size_ = 0;
+  buffered_bytes_ = 0;
+  layout_.reset();
+  point_size_ = 0;
+  num_points_ = 0;
+  tiles_.clear();
+}
+
+Status OutOfCorePointCloudEncoder::Init(const BoundingBox &bounds,
+                                        float tile_size,
+                                        const std::string &temp_file_prefix) {
+  Clear();
+  num_encoded_chunks_ = 0;
+  if (!bounds.IsValid()) {
+    return Status(Status::DRACO_ERROR, "Invalid bounds.");
+  }
+  if (!(tile_size > 0.f)) {
+    return Status(Status::DRACO_ERROR, "Invalid tile size.");
+  }
+  const Vector3f size = bounds.Size();
+  for (int i = 0; i < 3; ++i) {
+    const double num_tiles = std::ceil(static_cast<double>(size[i]) /
+                                       static_cast<double>(tile_size));
+    if (num_tiles > (1 << 20)) {
+      return Status(Status::DRACO_ERROR, "Too many tiles.");
+    }
+    grid_size_[i] = std::max<int64_t>(1, static_cast<int64_t>(num_tiles));
+  }
+  bounds_ = bounds;
+  tile_size_ = tile_size;
+  spill_file_name_ = temp_file_prefix + ".points";
+  chunks_file_name_ = temp_file_prefix + ".chunks";
+  spill_writer_ = FileWriterFactory::OpenWriter(spill_file_name_);
+  if (spill_writer_ == nullptr) {
+    spill_file_name_.clear();
+    return Status(Status::IO_ERROR, "Unable to create a temporary file.");
+  }
+  return OkStatus();
+}
+
+int64_t OutOfCorePointCloudEncoder::GetTileId(const float *position) const {
+  int64_t tile_id = 0;
+  for (int i = 2; i >= 0; --i) {
+    const float offset = (position[i] - bounds_.GetMinPoint()[i]) / tile_size_;
+    int64_t coord = 0;
+    // Also NaNs are added to the first tile.
+    if (offset > 0.f) {
+      coord = std::min(grid_size_[i] - 1,
+                       static_cast<int64_t>(std::min(offset, 1e9f)));
+    }
+    tile_id = tile_id * grid_size_[i] + coord;
+  }
+  return tile_id;
+}
+
+Status OutOfCorePointCloudEncoder::AddPoints(const PointCloud &points) {
+  if (spill_writer_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "Encoder is not initialized.");
+  }
+  const int pos_att_id =
+      points.GetNamedAttributeId(GeometryAttribute::POSITION);
+  if (pos_att_id < 0 ||
+      points.attribute(pos_att_id)->num_components() != 3) {
+    return Status(Status::DRACO_ERROR, "Missing position attribute.");
+  }
+  if (layout_ == nullptr) {
+    layout_.reset(new PointCloud());
+    for (int i = 0; i < points.num_attributes(); ++i) {
+      const PointAttribute *const att = points.attribute(i);
+      GeometryAttribute ga;
+      ga.Init(att->attribute_type(), nullptr, att->num_components(),
+              att->data_type(), att->normalized(), GetValueSize(*att), 0);
+      const int att_id = layout_->AddAttribute(ga, true, 0);
+      layout_->attribute(att_id)->set_unique_id(att->unique_id());
+      point_size_ += GetValueSize(*att);
+    }
+  } else {
+    if (points.num_attributes() != layout_->num_attributes()) {
+      return Status(Status::DRACO_ERROR, "Points have different attributes.");
+    }
+    for (int i = 0; i < points.num_attributes(); ++i) {
+      const PointAttribute *const att = points.attribute(i);
+      const PointAttribute *const layout_att = layout_->attribute(i);
+      if (att->attribute_type() != layout_att->attribute_type() ||
+          att->num_components() != layout_att->num_components() ||
+          att->data_type() != layout_att->data_type()) {
+        return Status(Status::DRACO_ERROR,
+                      "Points have different attributes.");
+      }
+    }
+  }
+
+  const PointAttribute *const pos_att = points.attribute(pos_att_id);
+  std::vector<char> point(point_size_);
+  for (PointIndex pi(0); pi < points.num_points(); ++pi) {
+    float position[3];
+    if (!pos_att->ConvertValue<float>(pos_att->mapped_index(pi), 3,
+                                      position)) {
+      return Status(Status::DRACO_ERROR, "Invalid position value.");
+    }
+    int offset = 0;
+    for (int i = 0; i < points.num_attributes(); ++i) {
+      const PointAttribute *const att = points.attribute(i);
+      const int value_size = GetValueSize(*att);
+      memcpy(point.data() + offset, att->GetAddress(att->mapped_index(pi)),
+             value_size);
+      offset += value_size;
+    }
+    std::vector<char> &buffer = tiles_[GetTileId(position)].buffered_points;
+    buffer.insert(buffer.end(), point.begin(), point.end());
+    buffered_bytes_ += point_size_;
+    if (buffered_bytes_ > max_buffered_bytes_) {
+      DRACO_RETURN_IF_ERROR(SpillTiles());
+    }
+  }
+  num_points_ += points.num_points();
+  return OkStatus();
+}
+
+Status OutOfCorePointCloudEncoder::SpillTiles() {
+  for (auto &it : tiles_) {
+    Tile &tile = it.second;
+    if (tile.buffered_points.empty()) {
+      continue;
+    }
+    const int64_t size = static_cast<int64_t>(tile.buffered_points.size());
+    if (!spill_writer_->Write(tile.buffered_points.data(), size)) {
+      return Status(Status::IO_ERROR, "Unable to write a temporary file.");
+    }
+    tile.runs.push_back({spill_size_, size / point_size_});
+    spill_size_ += size;
+    // Release the memory of the buffer.
+    std::vector<char>().swap(tile.buffered_points);
+  }
+  buffered_bytes_ = 0;
+  return OkStatus();
+}
+
+Status OutOfCorePointCloudEncoder::EncodeToFile(const Encoder &encoder,
+                                                const std::string &file_name) {
+  if (layout_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "No points were added.");
+  }
+  return EncodeToFile(encoder.CreateExpertEncoderOptions(*layout_), file_name);
+}
+
+Status OutOfCorePointCloudEncoder::EncodeToFile(
+    const EncoderOptions &options, const std::string &file_name) {
+  num_encoded_chunks_ = 0;
+  if (layout_ == nullptr || num_points_ == 0) {
+    return Status(Status::DRACO_ERROR, "No points were added.");
+  }
+  if (max_chunk_points_ < 1) {
+    return Status(Status::DRACO_ERROR, "Invalid maximum chunk size.");
+  }
+  if (spill_writer_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "Points were already encoded.");
+  }
+  DRACO_RETURN_IF_ERROR(SpillTiles());
+  spill_writer_.reset();
+
+  // Split the tiles into chunks of consecutive points of the spill file.
+  std::vector<std::vector<ChunkRange>> chunks;
+  for (const auto &it : tiles_) {
+    int64_t num_chunk_points = max_chunk_points_;
+    for (const Run &run : it.second.runs) {
+      int64_t offset = run.offset;
+      int64_t num_points = run.num_points;
+      while (num_points > 0) {
+        if (num_chunk_points == max_chunk_points_) {
+          chunks.emplace_back();
+          num_chunk_points = 0;
+        }
+        const int64_t num_range_points =
+            std::min(num_points, max_chunk_points_ - num_chunk_points);
+        chunks.back().push_back({offset, num_range_points});
+        offset += num_range_points * point_size_;
+        num_points -= num_range_points;
+        num_chunk_points += num_range_points;
+      }
+    }
+  }
+
+  // Quantize positions of all chunks in the same grid so that the chunks
+  // match seamlessly.
+  EncoderOptions chunk_options = options;
+  const int pos_att_id =
+      layout_->GetNamedAttributeId(GeometryAttribute::POSITION);
+  const int pos_quantization_bits =
+      options.GetAttributeInt(pos_att_id, "quantization_bits", -1);
+  float bounds_margin = 0.f;
+  if (pos_quantization_bits > 0) {
+    if (!options.IsAttributeOptionSet(pos_att_id, "quantization_origin")) {
+      const Vector3f size = bounds_.Size();
+      const float range = std::max(std::max(size[0], size[1]), size[2]);
+      chunk_options.SetAttributeVector(pos_att_id, "quantization_origin", 3,
+                                       bounds_.GetMinPoint().data());
+      chunk_options.SetAttributeFloat(pos_att_id, "quantization_range",
+                                      range > 0.f ? range : 1.f);
+    }
+    // Chunk bounds are enlarged by one quantization step so that they contain
+    // all decoded positions.
+    if (chunk_options.IsAttributeOptionSet(pos_att_id, "quantization_range")) {
+      bounds_margin = chunk_options.GetAttributeFloat(
+                          pos_att_id, "quantization_range", 0.f) /
+                      ((1u << pos_quantization_bits) - 1);
+    }
+  }
+
+  std::unique_ptr<FileReaderInterface> spill_reader =
+      FileReaderFactory::OpenReader(spill_file_name_);
+  std::unique_ptr<FileWriterInterface> chunks_writer =
+      FileWriterFactory::OpenWriter(chunks_file_name_);
+  if (spill_reader == nullptr || chunks_writer == nullptr) {
+    return Status(Status::IO_ERROR, "Unable to open a temporary file.");
+  }
+
+  // The chunks are read serially and encoded in batches of one chunk per
+  // thread. The encoded chunks are stored in a temporary file because the
+  // header with their sizes precedes them in the output.
+  ThreadPool *const pool = options.thread_pool();
+  const int batch_size = pool ? pool->num_threads() + 1 : 1;
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<uint64_t> chunk_sizes(num_chunks);
+  std::vector<BoundingBox> chunk_bounds(num_chunks);
+  std::vector<char> range_data;
+  for (int batch_start = 0; batch_start < num_chunks;
+       batch_start += batch_size) {
+    const int num_batch_chunks =
+        std::min(batch_size, num_chunks - batch_start);
+    std::vector<std::unique_ptr<PointCloud>> batch_chunks(num_batch_chunks);
+    for (int c = 0; c < num_batch_chunks; ++c) {
+      const std::vector<ChunkRange> &ranges = chunks[batch_start + c];
+      int64_t num_points = 0;
+      for (const ChunkRange &range : ranges) {
+        num_points += range.num_points;
+      }
+      std::unique_ptr<PointCloud> pc(new PointCloud());
+      pc->set_num_points(static_cast<uint32_t>(num_points));
+      for (int i = 0; i < layout_->num_attributes(); ++i) {
+        const int att_id = pc->AddAttribute(*layout_->attribute(i), true,
+                                            static_cast<uint32_t>(num_points));
+        pc->attribute(att_id)->set_unique_id(
+            layout_->attribute(i)->unique_id());
+      }
+      AttributeValueIndex avi(0);
+      for (const ChunkRange &range : ranges) {
+        if (!spill_reader->ReadRange(range.offset,
+                                     range.num_points * point_size_,
+                                     &range_data)) {
+          return Status(Status::IO_ERROR, "Unable to read a temporary file.");
+        }
+        const char *point = range_data.data();
+        for (int64_t p = 0; p < range.num_points; ++p, ++avi) {
+          for (int i = 0; i < pc->num_attributes(); ++i) {
+            PointAttribute *const att = pc->attribute(i);
+            const int value_size = GetValueSize(*att);
+            memcpy(att->GetAddress(avi), point, value_size);
+            point += value_size;
+          }
+        }
+      }
+      batch_chunks[c] = std::move(pc);
+    }
+
+    std::vector<EncoderBuffer> chunk_buffers(num_batch_chunks);
+    std::vector<Status> chunk_statuses(num_batch_chunks);
+    ParallelFor(pool, num_batch_chunks, [&](int c) {
+      const PointCloud &pc = *batch_chunks[c];
+      const PointAttribute *const pos_att = pc.attribute(pos_att_id);
+      BoundingBox bounds;
+      for (AttributeValueIndex avi(0); avi < pos_att->size(); ++avi) {
+        Vector3f position;
+        pos_att->ConvertValue<float>(avi, 3, &position[0]);
+        bounds.Update(position);
+      }
+      const Vector3f margin(bounds_margin, bounds_margin, bounds_margin);
+      chunk_bounds[batch_start + c] = BoundingBox(
+          bounds.GetMinPoint() - margin, bounds.GetMaxPoint() + margin);
+      ExpertEncoder chunk_encoder(pc);
+      chunk_encoder.Reset(chunk_options);
+      chunk_statuses[c] = chunk_encoder.EncodeToBuffer(&chunk_buffers[c]);
+    });
+    for (int c = 0; c < num_batch_chunks; ++c) {
+      DRACO_RETURN_IF_ERROR(chunk_statuses[c]);
+      if (!chunks_writer->Write(chunk_buffers[c].data(),
+                                chunk_buffers[c].size())) {
+        return Status(Status::IO_ERROR, "Unable to write a temporary file.");
+      }
+      chunk_sizes[batch_start + c] = chunk_buffers[c].size();
+    }
+  }
+  chunks_writer.reset();
+  spill_reader.reset();
+
+  // Write the container header followed by the data of all chunks.
+  EncoderBuffer header;
+  header.Encode("DRCHK", 5);
+  const uint8_t version_major = 1;
+  const uint8_t version_minor = 1;
+  header.Encode(version_major);
+  header.Encode(version_minor);
+  EncodeVarint(static_cast<uint32_t>(num_chunks), &header);
+  uint64_t chunks_size = 0;
+  for (int i = 0; i < num_chunks; ++i) {
+    EncodeVarint(chunk_sizes[i], &header);
+    chunks_size += chunk_sizes[i];
+  }
+  for (int i = 0; i < num_chunks; ++i) {
+    header.Encode(chunk_bounds[i].GetMinPoint().data(), 3 * sizeof(float));
+    header.Encode(chunk_bounds[i].GetMaxPoint().data(), 3 * sizeof(float));
+  }
+  std::unique_ptr<FileWriterInterface> out_writer =
+      FileWriterFactory::OpenWriter(file_name);
+  if (out_writer == nullptr) {
+    return Status(Status::IO_ERROR, "Unable to create the output file.");
+  }
+  if (!out_writer->Write(header.data(), header.size())) {
+    return Status(Status::IO_ERROR, "Unable to write the output file.");
+  }
+  std::unique_ptr<FileReaderInterface> chunks_reader =
+      FileReaderFactory::OpenReader(chunks_file_name_);
+  if (chunks_reader == nullptr) {
+    return Status(Status::IO_ERROR, "Unable to open a temporary file.");
+  }
+  std::vector<char> block;
+  for (uint64_t offset = 0; offset < chunks_size; offset += kCopyBlockSize) {
+    const size_t size =
+        static_cast<size_t>(std::min<uint64_t>(kCopyBlockSize,
+                                               chunks_size - offset));
+    if (!chunks_reader->ReadRange(static_cast<size_t>(offset), size,
+                                  &block) ||
+        !out_writer->Write(block.data(), size)) {
+      return Status(Status::IO_ERROR, "Unable to write the output file.");
+    }
+  }
+  chunks_reader.reset();
+  std::remove(spill_file_name_.c_str());
+  std::remove(chunks_file_name_.c_str());
+  num_encoded_chunks_ = num_chunks;
+  return OkStatus();
+}
+
+}  // namespace draco
@@ -0,0 +1,150 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_IO_OUT_OF_CORE_POINT_CLOUD_ENCODER_H_
+#define DRACO_IO_OUT_OF_CORE_POINT_CLOUD_ENCODER_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "draco/compression/config/encoder_options.h"
+#include "draco/compression/encode.h"
+#include "draco/core/bounding_box.h"
+#include "draco/core/status.h"
+#include "draco/io/file_writer_interface.h"
+#include "draco/point_cloud/point_cloud.h"
+
+namespace draco {
+
+// Encoder of point clouds that do not fit into memory. Points are added in
+// batches and bucketed into a regular grid of cubic tiles. The points of each
+// tile are buffered in memory and spilled into a temporary file whenever the
+// buffers exceed max_buffered_bytes(), which makes the bucketing an external
+// sort of the points by their tile. When all points are added, the tiles are
+// read back one by one, split into chunks of at most max_chunk_points()
+// points, encoded in parallel on the thread pool of the encoder options and
+// written into the chunked container of ChunkedMeshEncoder, whose header
+// stores the bounds of each chunk as a spatial index. The chunks can be
+// decoded with ChunkedMeshDecoder::DecodePointCloudChunk().
+//
+// Example:
+//
+//   OutOfCorePointCloudEncoder encoder;
+//   DRACO_RETURN_IF_ERROR(encoder.Init(bounds, 100.f, "/tmp/tiles"));
+//   while (...) {
+//     DRACO_RETURN_IF_ERROR(encoder.AddPoints(*ReadNextBatch()));
+//   }
+//   DRACO_RETURN_IF_ERROR(encoder.EncodeToFile(options, "out.drc"));
+//
+// At most max_buffered_bytes() of buffered points plus the points of the
+// chunks encoded in parallel are held in memory at any time.
+//
+// When positions are quantized, all chunks are quantized in the grid of the
+// bounds passed to Init(), unless "quantization_origin" is set explicitly.
+class OutOfCorePointCloudEncoder {
+ public:
+  OutOfCorePointCloudEncoder();
+  // Removes all temporary files.
+  ~OutOfCorePointCloudEncoder();
+
+  // Sets the maximum number of points that are stored in a single chunk.
+  void set_max_chunk_points(int num_points) { max_chunk_points_ = num_points; }
+  int max_chunk_points() const { return max_chunk_points_; }
+
+  // Sets the maximum size of the points buffered in memory before they are
+  // spilled into the temporary file.
+  void set_max_buffered_bytes(int64_t num_bytes) {
+    max_buffered_bytes_ = num_bytes;
+  }
+  int64_t max_buffered_bytes() const { return max_buffered_bytes_; }
+
+  // Starts a new encoding of points within |bounds| that are bucketed into
+  // tiles with edge length |tile_size|. Temporary files are created with
+  // names starting with |temp_file_prefix|. Any previous encoding is
+  // discarded.
+  Status Init(const BoundingBox &bounds, float tile_size,
+              const std::string &temp_file_prefix);
+
+  // Adds all points of |points|. All batches must have the same attributes
+  // as the first one, including a position attribute. Points outside of the
+  // bounds are added to the closest tile.
+  Status AddPoints(const PointCloud &points);
+
+  // Encodes all added points into the container file |file_name| using the
+  // options of |encoder| for each chunk.
+  Status EncodeToFile(const Encoder &encoder, const std::string &file_name);
+
+  // Same as above but with |options| for each chunk. Attribute options are
+  // specified for attribute ids of the added batches as in ExpertEncoder.
+  Status EncodeToFile(const EncoderOptions &options,
+                      const std::string &file_name);
+
+  // Returns the number of points added since the last call to Init().
+  int64_t num_points() const { return num_points_; }
+
+  // Returns the number of tiles containing at least one point.
+  int num_tiles() const { return static_cast<int>(tiles_.size()); }
+
+  // Returns the number of chunks created by the last successful encoding.
+  int num_encoded_chunks() const { return num_encoded_chunks_; }
+
+ private:
+  // Consecutive points of a tile stored in the spill file.
+  struct Run {
+    int64_t offset;
+    int64_t num_points;
+  };
+  struct Tile {
+    // Points that were not spilled yet.
+    std::vector<char> buffered_points;
+    std::vector<Run> runs;
+  };
+
+  // Writes all buffered points into the spill file.
+  Status SpillTiles();
+
+  // Removes the temporary files and releases all buffered points.
+  void Clear();
+
+  // Returns the id of the tile containing |position|.
+  int64_t GetTileId(const float *position) const;
+
+  int max_chunk_points_;
+  int64_t max_buffered_bytes_;
+
+  BoundingBox bounds_;
+  float tile_size_;
+  int64_t grid_size_[3];
+  std::string spill_file_name_;
+  std::string chunks_file_name_;
+  std::unique_ptr<FileWriterInterface> spill_writer_;
+  int64_t spill_size_;
+  int64_t buffered_bytes_;
+
+  // Attributes of the added points without any values.
+  std::unique_ptr<PointCloud> layout_;
+  // Size of a point stored in the tiles. The values of all attributes are
+  // stored one after another.
+  int point_size_;
+  int64_t num_points_;
+  std::map<int64_t, Tile> tiles_;
+  int num_encoded_chunks_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_IO_OUT_OF_CORE_POINT_CLOUD_ENCODER_H_
@@ -0,0 +1,155 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/out_of_core_point_cloud_encoder.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "draco/compression/chunked_mesh_decoder.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/io/file_utils.h"
+#include "draco/point_cloud/point_cloud_builder.h"
+
+namespace draco {
+
+class OutOfCorePointCloudEncoderTest : public ::testing::Test {
+ protected:
+  // Creates a batch of |num_points| random points in a cube of size 100 with
+  // random colors that are also appended to |colors|.
+  std::unique_ptr<PointCloud> CreateBatch(
+      int num_points, std::vector<std::array<uint8_t, 3>> *colors) {
+    std::uniform_real_distribution<float> coord_distribution(0.f, 100.f);
+    std::uniform_int_distribution<int> color_distribution(0, 255);
+    PointCloudBuilder builder;
+    builder.Start(num_points);
+    const int pos_att_id =
+        builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+    const int color_att_id =
+        builder.AddAttribute(GeometryAttribute::COLOR, 3, DT_UINT8);
+    for (PointIndex pi(0); pi < num_points; ++pi) {
+      const Vector3f position(coord_distribution(generator_),
+                              coord_distribution(generator_),
+                              coord_distribution(generator_));
+      std::array<uint8_t, 3> color;
+      for (int c = 0; c < 3; ++c) {
+        color[c] = color_distribution(generator_);
+      }
+      builder.SetAttributeValueForPoint(pos_att_id, pi, &position[0]);
+      builder.SetAttributeValueForPoint(color_att_id, pi, color.data());
+      colors->push_back(color);
+    }
+    return builder.Finalize(false);
+  }
+
+  std::mt19937 generator_;
+};
+
+// Tests that points added in batches are encoded into chunks of the tiles and
+// that all points can be decoded from the chunks.
+TEST_F(OutOfCorePointCloudEncoderTest, TestEncodeTiles) {
+  OutOfCorePointCloudEncoder encoder;
+  encoder.set_max_chunk_points(1500);
+  // Spill the points many times.
+  encoder.set_max_buffered_bytes(10000);
+  const BoundingBox bounds(Vector3f(0.f, 0.f, 0.f),
+                           Vector3f(100.f, 100.f, 100.f));
+  DRACO_ASSERT_OK(encoder.Init(
+      bounds, 50.f, GetTestTempFileFullPath("out_of_core_encoder_test")));
+  std::vector<std::array<uint8_t, 3>> colors;
+  for (int i = 0; i < 20; ++i) {
+    DRACO_ASSERT_OK(encoder.AddPoints(*CreateBatch(1000, &colors)));
+  }
+  ASSERT_EQ(encoder.num_points(), 20000);
+  ASSERT_EQ(encoder.num_tiles(), 8);
+
+  ThreadPool pool(3);
+  Encoder options_encoder;
+  options_encoder.SetAttributeQuantization(GeometryAttribute::POSITION, 14);
+  options_encoder.options().SetThreadPool(&pool);
+  const std::string file_name =
+      GetTestTempFileFullPath("out_of_core_encoder_test.drc");
+  DRACO_ASSERT_OK(encoder.EncodeToFile(options_encoder, file_name));
+  ASSERT_GE(encoder.num_encoded_chunks(), 8 * 2);
+
+  std::vector<char> data;
+  ASSERT_TRUE(ReadFileToBuffer(file_name, &data));
+  DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  ChunkedMeshDecoder decoder;
+  DRACO_ASSERT_OK(decoder.DecodeHeader(&buffer));
+  ASSERT_EQ(decoder.num_chunks(), encoder.num_encoded_chunks());
+  ASSERT_TRUE(decoder.has_chunk_bounds());
+
+  const float quantization_step = 100.f / ((1 << 14) - 1);
+  std::vector<std::array<uint8_t, 3>> decoded_colors;
+  for (int i = 0; i < decoder.num_chunks(); ++i) {
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<PointCloud> pc,
+                           decoder.DecodePointCloudChunk(i));
+    ASSERT_GT(pc->num_points(), 0);
+    ASSERT_LE(pc->num_points(), 1500);
+    const BoundingBox &chunk_bounds = decoder.chunk_bounds(i);
+    // All points of a chunk are within a single tile.
+    const Vector3f size = chunk_bounds.Size();
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_LE(size[c], 50.f + 4.f * quantization_step);
+    }
+    const PointAttribute *const pos_att =
+        pc->GetNamedAttribute(GeometryAttribute::POSITION);
+    const PointAttribute *const color_att =
+        pc->GetNamedAttribute(GeometryAttribute::COLOR);
+    ASSERT_NE(color_att, nullptr);
+    for (PointIndex pi(0); pi < pc->num_points(); ++pi) {
+      Vector3f position;
+      pos_att->GetMappedValue(pi, &position[0]);
+      for (int c = 0; c < 3; ++c) {
+        ASSERT_GE(position[c], chunk_bounds.GetMinPoint()[c]);
+        ASSERT_LE(position[c], chunk_bounds.GetMaxPoint()[c]);
+      }
+      std::array<uint8_t, 3> color;
+      color_att->GetMappedValue(pi, color.data());
+      decoded_colors.push_back(color);
+    }
+  }
+  // Colors are lossless so all of them must be decoded.
+  std::sort(colors.begin(), colors.end());
+  std::sort(decoded_colors.begin(), decoded_colors.end());
+  ASSERT_EQ(colors, decoded_colors);
+}
+
+// Tests that batches with different attributes are rejected.
+TEST_F(OutOfCorePointCloudEncoderTest, TestInvalidInput) {
+  OutOfCorePointCloudEncoder encoder;
+  std::vector<std::array<uint8_t, 3>> colors;
+  ASSERT_FALSE(encoder.AddPoints(*CreateBatch(10, &colors)).ok());
+  const BoundingBox bounds(Vector3f(0.f, 0.f, 0.f),
+                           Vector3f(100.f, 100.f, 100.f));
+  const std::string prefix =
+      GetTestTempFileFullPath("out_of_core_encoder_invalid_test");
+  ASSERT_FALSE(encoder.Init(bounds, 0.f, prefix).ok());
+  DRACO_ASSERT_OK(encoder.Init(bounds, 10.f, prefix));
+  DRACO_ASSERT_OK(encoder.AddPoints(*CreateBatch(10, &colors)));
+
+  PointCloudBuilder builder;
+  builder.Start(1);
+  builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  ASSERT_FALSE(encoder.AddPoints(*builder.Finalize(false)).ok());
+}
+
+}  // namespace draco
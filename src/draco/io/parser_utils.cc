@@ -17,40 +17,41 @@
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <cstring>
 #include <iterator>
 #include <limits>
+#include <string>
 
 namespace draco {
 namespace parser {
 
+// All parsing functions below operate directly on the data of the decoder
+// buffer and advance the buffer only once, which is considerably faster than
+// peeking the characters one by one.
+
 void SkipCharacters(DecoderBuffer *buffer, const char *skip_chars) {
   if (skip_chars == nullptr) {
     return;
   }
-  const int num_skip_chars = static_cast<int>(strlen(skip_chars));
-  char c;
-  while (buffer->Peek(&c)) {
-    // Check all characters in the pattern.
-    bool skip = false;
-    for (int i = 0; i < num_skip_chars; ++i) {
-      if (c == skip_chars[i]) {
-        skip = true;
-        break;
-      }
-    }
-    if (!skip) {
-      return;
-    }
-    buffer->Advance(1);
+  const char *const head = buffer->data_head();
+  const char *const end = head + buffer->remaining_size();
+  const char *pos = head;
+  // Check all characters in the pattern.
+  while (pos < end && *pos != '\0' && strchr(skip_chars, *pos) != nullptr) {
+    ++pos;
   }
+  buffer->Advance(pos - head);
 }
 
 void SkipWhitespace(DecoderBuffer *buffer) {
-  bool end_reached = false;
-  while (PeekWhitespace(buffer, &end_reached) && !end_reached) {
+  const char *const head = buffer->data_head();
+  const char *const end = head + buffer->remaining_size();
+  const char *pos = head;
+  while (pos < end && isspace(static_cast<uint8_t>(*pos))) {
     // Skip the whitespace character
-    buffer->Advance(1);
+    ++pos;
   }
+  buffer->Advance(pos - head);
 }
 
 bool PeekWhitespace(DecoderBuffer *buffer, bool *end_reached) {
@@ -67,15 +68,42 @@ bool PeekWhitespace(DecoderBuffer *buffer, bool *end_reached) {
 
 void SkipLine(DecoderBuffer *buffer) { ParseLine(buffer, nullptr); }
 
+namespace {
+
+// Parses an unsigned integer from characters in range [|*pos|, |end|) and
+// moves |*pos| past the parsed digits.
+bool ParseUnsignedIntFromRange(const char **pos, const char *end,
+                               uint32_t *value) {
+  // Parse the number until we run out of digits.
+  const char *p = *pos;
+  uint32_t v = 0;
+  while (p < end && *p >= '0' && *p <= '9') {
+    v *= 10;
+    v += (*p - '0');
+    ++p;
+  }
+  if (p == *pos) {
+    return false;
+  }
+  *pos = p;
+  *value = v;
+  return true;
+}
+
+}  // namespace
+
 bool ParseFloat(DecoderBuffer *buffer, float *value) {
+  const char *const head = buffer->data_head();
+  const char *const end = head + buffer->remaining_size();
+  const char *pos = head;
+
   // Read optional sign.
-  char ch;
-  if (!buffer->Peek(&ch)) {
+  if (pos == end) {
     return false;
   }
-  int sign = GetSignValue(ch);
+  int sign = GetSignValue(*pos);
   if (sign != 0) {
-    buffer->Advance(1);
+    ++pos;
   } else {
     sign = 1;
   }
@@ -83,25 +111,26 @@ bool ParseFloat(DecoderBuffer *buffer, float *value) {
   // Parse integer component.
   bool have_digits = false;
   double v = 0.0;
-  while (buffer->Peek(&ch) && ch >= '0' && ch <= '9') {
+  while (pos < end && *pos >= '0' && *pos <= '9') {
     v *= 10.0;
-    v += (ch - '0');
-    buffer->Advance(1);
+    v += (*pos - '0');
+    ++pos;
     have_digits = true;
   }
-  if (ch == '.') {
+  if (pos < end && *pos == '.') {
     // Parse fractional component.
-    buffer->Advance(1);
+    ++pos;
     double fraction = 1.0;
-    while (buffer->Peek(&ch) && ch >= '0' && ch <= '9') {
+    while (pos < end && *pos >= '0' && *pos <= '9') {
       fraction *= 0.1;
-      v += (ch - '0') * fraction;
-      buffer->Advance(1);
+      v += (*pos - '0') * fraction;
+      ++pos;
       have_digits = true;
     }
   }
 
   if (!have_digits) {
+    buffer->Advance(pos - head);
     // Check for special constants (inf, nan, ...).
     std::string text;
     if (!ParseString(buffer, &text)) {
@@ -117,18 +146,28 @@ bool ParseFloat(DecoderBuffer *buffer, float *value) {
     }
   } else {
     // Handle exponent if present.
-    if (ch == 'e' || ch == 'E') {
-      buffer->Advance(1);  // Skip 'e' marker.
+    if (pos < end && (*pos == 'e' || *pos == 'E')) {
+      ++pos;  // Skip 'e' marker.
 
       // Parse integer exponent.
-      int32_t exponent = 0;
-      if (!ParseSignedInt(buffer, &exponent)) {
+      int exponent_sign = 0;
+      if (pos < end) {
+        exponent_sign = GetSignValue(*pos);
+        if (exponent_sign != 0) {
+          ++pos;
+        }
+      }
+      uint32_t exponent = 0;
+      if (!ParseUnsignedIntFromRange(&pos, end, &exponent)) {
+        buffer->Advance(pos - head);
         return false;
       }
 
       // Apply exponent scaling to value.
-      v *= pow(static_cast<double>(10.0), exponent);
+      v *= pow(static_cast<double>(10.0),
+               static_cast<int32_t>(exponent_sign < 0 ? -exponent : exponent));
     }
+    buffer->Advance(pos - head);
   }
 
   *value = (sign < 0) ? static_cast<float>(-v) : static_cast<float>(v);
@@ -138,18 +177,22 @@ bool ParseFloat(DecoderBuffer *buffer, float *value) {
 bool ParseSignedInt(DecoderBuffer *buffer, int32_t *value) {
   // Parse any explicit sign and set the appropriate largest magnitude
   // value that can be represented without overflow.
-  char ch;
-  if (!buffer->Peek(&ch)) {
+  const char *const head = buffer->data_head();
+  const char *const end = head + buffer->remaining_size();
+  const char *pos = head;
+  if (pos == end) {
     return false;
   }
-  const int sign = GetSignValue(ch);
+  const int sign = GetSignValue(*pos);
   if (sign != 0) {
-    buffer->Advance(1);
+    ++pos;
   }
 
   // Attempt to parse integer body.
   uint32_t v;
-  if (!ParseUnsignedInt(buffer, &v)) {
+  const bool parsed = ParseUnsignedIntFromRange(&pos, end, &v);
+  buffer->Advance(pos - head);
+  if (!parsed) {
     return false;
   }
   *value = (sign < 0) ? -v : v;
@@ -157,20 +200,13 @@ bool ParseSignedInt(DecoderBuffer *buffer, int32_t *value) {
 }
 
 bool ParseUnsignedInt(DecoderBuffer *buffer, uint32_t *value) {
-  // Parse the number until we run out of digits.
-  uint32_t v = 0;
-  char ch;
-  bool have_digits = false;
-  while (buffer->Peek(&ch) && ch >= '0' && ch <= '9') {
-    v *= 10;
-    v += (ch - '0');
-    buffer->Advance(1);
-    have_digits = true;
-  }
-  if (!have_digits) {
+  const char *const head = buffer->data_head();
+  const char *pos = head;
+  if (!ParseUnsignedIntFromRange(&pos, head + buffer->remaining_size(),
+                                 value)) {
     return false;
   }
-  *value = v;
+  buffer->Advance(pos - head);
   return true;
 }
 
@@ -202,44 +238,26 @@ void ParseLine(DecoderBuffer *buffer, std::string *out_string) {
   if (out_string) {
     out_string->clear();
   }
-  char c;
-  int num_delims = 0;
-  char last_delim;
-  while (buffer->Peek(&c)) {
-    // Check if |c| is a delimiter symbol. We want to identify all possible
-    // delimiters that can occur on different platforms (i.e. we want to detect
-    // '\r\n', '\r', '\n').
-    const bool is_delim = (c == '\r' || c == '\n');
-
-    if (is_delim) {
-      if (num_delims == 0) {
-        last_delim = c;
-      } else if (num_delims == 1) {
-        // We already parsed either '\r' or '\n'. Ensure the new delim symbol is
-        // '\n' and different from the previous symbol.
-        if (c == last_delim || c != '\n') {
-          return;  // Same delimiter symbol already processed.
-        }
-      } else {
-        // Too many delimiter symbols.
-        return;
-      }
-      num_delims++;
-    }
-
-    if (!is_delim && num_delims > 0) {
-      // We reached a non-delimiter symbol after a delimiter was already found.
-      // Stop the parsing.
-      return;
-    }
-
-    buffer->Advance(1);
-
-    // We put the non-delimiter symbol into the output string.
-    if (!is_delim && out_string) {
-      out_string->push_back(c);
+  const char *const head = buffer->data_head();
+  const char *const end = head + buffer->remaining_size();
+  const char *pos = head;
+  // Find the end of the line content.
+  while (pos < end && *pos != '\r' && *pos != '\n') {
+    ++pos;
+  }
+  if (out_string) {
+    out_string->assign(head, pos);
+  }
+  // Skip the line delimiter. We want to identify all possible delimiters that
+  // can occur on different platforms (i.e. we want to detect '\r\n', '\r',
+  // '\n').
+  if (pos < end) {
+    const char delim = *pos++;
+    if (delim == '\r' && pos < end && *pos == '\n') {
+      ++pos;
     }
   }
+  buffer->Advance(pos - head);
 }
 
 DecoderBuffer ParseLineIntoDecoderBuffer(DecoderBuffer *buffer) {
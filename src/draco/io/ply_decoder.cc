@@ -14,6 +14,9 @@
 //
 #include "draco/io/ply_decoder.h"
 
+#include <cstring>
+#include <string>
+
 #include "draco/core/macros.h"
 #include "draco/core/status.h"
 #include "draco/io/file_utils.h"
@@ -140,6 +143,29 @@ template <typename DataTypeT>
 bool PlyDecoder::ReadPropertiesToAttribute(
     const std::vector<const PlyProperty *> &properties,
     PointAttribute *attribute, int num_vertices) {
+  bool same_data_types = true;
+  for (const PlyProperty *const property : properties) {
+    if (property->data_type() != attribute->data_type()) {
+      same_data_types = false;
+    }
+  }
+  if (same_data_types) {
+    // No conversion is needed so the property arrays are interleaved into the
+    // attribute buffer directly.
+    const int value_size = DataTypeLength(attribute->data_type());
+    for (int prop = 0; prop < static_cast<int>(properties.size()); ++prop) {
+      const uint8_t *src = static_cast<const uint8_t *>(
+          properties[prop]->GetDataEntryAddress(0));
+      uint8_t *dst =
+          attribute->GetAddress(AttributeValueIndex(0)) + prop * value_size;
+      for (int i = 0; i < num_vertices; ++i) {
+        memcpy(dst, src, value_size);
+        src += value_size;
+        dst += attribute->byte_stride();
+      }
+    }
+    return true;
+  }
   std::vector<std::unique_ptr<PlyPropertyReader<DataTypeT>>> readers;
   readers.reserve(properties.size());
   for (int prop = 0; prop < properties.size(); ++prop) {
@@ -214,21 +240,16 @@ Status PlyDecoder::DecodeVertexData(const PlyElement *vertex_element) {
     if (n_x_prop->data_type() == DT_FLOAT32 &&
         n_y_prop->data_type() == DT_FLOAT32 &&
         n_z_prop->data_type() == DT_FLOAT32) {
-      PlyPropertyReader<float> x_reader(n_x_prop);
-      PlyPropertyReader<float> y_reader(n_y_prop);
-      PlyPropertyReader<float> z_reader(n_z_prop);
       GeometryAttribute va;
       va.Init(GeometryAttribute::NORMAL, nullptr, 3, DT_FLOAT32, false,
               sizeof(float) * 3, 0);
       const int att_id = out_point_cloud_->AddAttribute(va, true, num_vertices);
-      for (PointIndex::ValueType i = 0; i < num_vertices; ++i) {
-        std::array<float, 3> val;
-        val[0] = x_reader.ReadValue(i);
-        val[1] = y_reader.ReadValue(i);
-        val[2] = z_reader.ReadValue(i);
-        out_point_cloud_->attribute(att_id)->SetAttributeValue(
-            AttributeValueIndex(i), &val[0]);
-      }
+      std::vector<const PlyProperty *> properties;
+      properties.push_back(n_x_prop);
+      properties.push_back(n_y_prop);
+      properties.push_back(n_z_prop);
+      ReadPropertiesToAttribute<float>(
+          properties, out_point_cloud_->attribute(att_id), num_vertices);
     }
   }
 
@@ -252,51 +273,22 @@ Status PlyDecoder::DecodeVertexData(const PlyElement *vertex_element) {
   }
 
   if (num_colors) {
-    std::vector<std::unique_ptr<PlyPropertyReader<uint8_t>>> color_readers;
-    const PlyProperty *p;
-    if (r_prop) {
-      p = r_prop;
-      // TODO(ostava): For now ensure the data type of all components is uint8.
-      DRACO_DCHECK_EQ(true, p->data_type() == DT_UINT8);
-      if (p->data_type() != DT_UINT8) {
-        return Status(Status::INVALID_PARAMETER,
-                      "Type of 'red' property must be uint8");
-      }
-      color_readers.push_back(std::unique_ptr<PlyPropertyReader<uint8_t>>(
-          new PlyPropertyReader<uint8_t>(p)));
-    }
-    if (g_prop) {
-      p = g_prop;
-      // TODO(ostava): For now ensure the data type of all components is uint8.
-      DRACO_DCHECK_EQ(true, p->data_type() == DT_UINT8);
-      if (p->data_type() != DT_UINT8) {
-        return Status(Status::INVALID_PARAMETER,
-                      "Type of 'green' property must be uint8");
-      }
-      color_readers.push_back(std::unique_ptr<PlyPropertyReader<uint8_t>>(
-          new PlyPropertyReader<uint8_t>(p)));
-    }
-    if (b_prop) {
-      p = b_prop;
-      // TODO(ostava): For now ensure the data type of all components is uint8.
-      DRACO_DCHECK_EQ(true, p->data_type() == DT_UINT8);
-      if (p->data_type() != DT_UINT8) {
-        return Status(Status::INVALID_PARAMETER,
-                      "Type of 'blue' property must be uint8");
+    std::vector<const PlyProperty *> color_properties;
+    const PlyProperty *const props[] = {r_prop, g_prop, b_prop, a_prop};
+    const char *const names[] = {"red", "green", "blue", "alpha"};
+    for (int i = 0; i < 4; ++i) {
+      const PlyProperty *const p = props[i];
+      if (p == nullptr) {
+        continue;
       }
-      color_readers.push_back(std::unique_ptr<PlyPropertyReader<uint8_t>>(
-          new PlyPropertyReader<uint8_t>(p)));
-    }
-    if (a_prop) {
-      p = a_prop;
       // TODO(ostava): For now ensure the data type of all components is uint8.
       DRACO_DCHECK_EQ(true, p->data_type() == DT_UINT8);
       if (p->data_type() != DT_UINT8) {
         return Status(Status::INVALID_PARAMETER,
-                      "Type of 'alpha' property must be uint8");
+                      std::string("Type of '") + names[i] +
+                          "' property must be uint8");
       }
-      color_readers.push_back(std::unique_ptr<PlyPropertyReader<uint8_t>>(
-          new PlyPropertyReader<uint8_t>(p)));
+      color_properties.push_back(p);
     }
 
     GeometryAttribute va;
@@ -304,14 +296,8 @@ Status PlyDecoder::DecodeVertexData(const PlyElement *vertex_element) {
             sizeof(uint8_t) * num_colors, 0);
     const int32_t att_id =
         out_point_cloud_->AddAttribute(va, true, num_vertices);
-    for (PointIndex::ValueType i = 0; i < num_vertices; ++i) {
-      std::array<uint8_t, 4> val;
-      for (int j = 0; j < num_colors; j++) {
-        val[j] = color_readers[j]->ReadValue(i);
-      }
-      out_point_cloud_->attribute(att_id)->SetAttributeValue(
-          AttributeValueIndex(i), &val[0]);
-    }
+    ReadPropertiesToAttribute<uint8_t>(
+        color_properties, out_point_cloud_->attribute(att_id), num_vertices);
   }
 
   return OkStatus();
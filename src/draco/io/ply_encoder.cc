@@ -14,8 +14,11 @@
 //
 #include "draco/io/ply_encoder.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #include "draco/io/file_writer_factory.h"
 #include "draco/io/file_writer_interface.h"
@@ -23,7 +26,11 @@
 namespace draco {
 
 PlyEncoder::PlyEncoder()
-    : out_buffer_(nullptr), in_point_cloud_(nullptr), in_mesh_(nullptr) {}
+    : out_buffer_(nullptr),
+      out_file_(nullptr),
+      in_point_cloud_(nullptr),
+      in_mesh_(nullptr),
+      thread_pool_(nullptr) {}
 
 bool PlyEncoder::EncodeToFile(const PointCloud &pc,
                               const std::string &file_name) {
@@ -32,14 +39,7 @@ bool PlyEncoder::EncodeToFile(const PointCloud &pc,
   if (!file) {
     return false;  // File couldn't be opened.
   }
-  // Encode the mesh into a buffer.
-  EncoderBuffer buffer;
-  if (!EncodeToBuffer(pc, &buffer)) {
-    return false;
-  }
-  // Write the buffer into the file.
-  file->Write(buffer.data(), buffer.size());
-  return true;
+  return EncodeToFile(pc, file.get());
 }
 
 bool PlyEncoder::EncodeToFile(const Mesh &mesh, const std::string &file_name) {
@@ -47,6 +47,23 @@ bool PlyEncoder::EncodeToFile(const Mesh &mesh, const std::string &file_name) {
   return EncodeToFile(static_cast<const PointCloud &>(mesh), file_name);
 }
 
+bool PlyEncoder::EncodeToFile(const PointCloud &pc, FileWriterInterface *file) {
+  // The buffer holds only the output that was not written to |file| yet.
+  EncoderBuffer buffer;
+  in_point_cloud_ = &pc;
+  out_buffer_ = &buffer;
+  out_file_ = file;
+  if (!EncodeInternal() || !FlushOutput()) {
+    return ExitAndCleanup(false);
+  }
+  return ExitAndCleanup(true);
+}
+
+bool PlyEncoder::EncodeToFile(const Mesh &mesh, FileWriterInterface *file) {
+  in_mesh_ = &mesh;
+  return EncodeToFile(static_cast<const PointCloud &>(mesh), file);
+}
+
 bool PlyEncoder::EncodeToBuffer(const PointCloud &pc,
                                 EncoderBuffer *out_buffer) {
   in_point_cloud_ = &pc;
@@ -142,52 +159,127 @@ bool PlyEncoder::EncodeInternal() {
   const std::string header_str = out.str();
   buffer()->Encode(header_str.data(), header_str.length());
 
-  // Store point attributes.
+  // Store point attributes. All rows are written directly into the output
+  // buffer or into blocks of the output file.
+  std::vector<const PointAttribute *> vertex_atts;
+  vertex_atts.push_back(in_point_cloud_->attribute(pos_att_id));
+  if (normal_att_id >= 0) {
+    vertex_atts.push_back(in_point_cloud_->attribute(normal_att_id));
+  }
+  if (color_att_id >= 0) {
+    vertex_atts.push_back(in_point_cloud_->attribute(color_att_id));
+  }
+  size_t vertex_size = 0;
+  for (const PointAttribute *att : vertex_atts) {
+    vertex_size += att->byte_stride();
+  }
   const int num_points = in_point_cloud_->num_points();
-  for (PointIndex v(0); v < num_points; ++v) {
-    const auto *const pos_att = in_point_cloud_->attribute(pos_att_id);
-    buffer()->Encode(pos_att->GetAddress(pos_att->mapped_index(v)),
-                     pos_att->byte_stride());
-    if (normal_att_id >= 0) {
-      const auto *const normal_att = in_point_cloud_->attribute(normal_att_id);
-      buffer()->Encode(normal_att->GetAddress(normal_att->mapped_index(v)),
-                       normal_att->byte_stride());
-    }
-    if (color_att_id >= 0) {
-      const auto *const color_att = in_point_cloud_->attribute(color_att_id);
-      buffer()->Encode(color_att->GetAddress(color_att->mapped_index(v)),
-                       color_att->byte_stride());
+  const auto write_vertices = [&](int begin, int end, char *dst) {
+    for (PointIndex v(begin); v < end; ++v) {
+      for (const PointAttribute *att : vertex_atts) {
+        memcpy(dst, att->GetAddress(att->mapped_index(v)), att->byte_stride());
+        dst += att->byte_stride();
+      }
     }
+    return true;
+  };
+  if (!WriteRows(num_points, vertex_size, write_vertices)) {
+    return false;
   }
 
   if (in_mesh_) {
-    // Write face data.
-    for (FaceIndex i(0); i < in_mesh_->num_faces(); ++i) {
-      // Write the number of face indices (always 3).
-      buffer()->Encode(static_cast<uint8_t>(3));
-
-      const auto &f = in_mesh_->face(i);
-      for (int c = 0; c < 3; ++c) {
-        if (f[c] >= num_points) {
-          // Invalid point stored on the |in_mesh_| face.
-          return false;
-        }
-        buffer()->Encode(f[c]);
-      }
-
-      if (tex_coord_att_id >= 0) {
-        // Two coordinates for every corner -> 6.
-        buffer()->Encode(static_cast<uint8_t>(6));
-
-        const auto *const tex_att =
-            in_point_cloud_->attribute(tex_coord_att_id);
+    // Write face data. Each face consists of the number of face indices
+    // (always 3), the indices and optionally the number of texture
+    // coordinates (always 6) followed by the coordinates of all corners.
+    const PointAttribute *const tex_att =
+        tex_coord_att_id >= 0 ? in_point_cloud_->attribute(tex_coord_att_id)
+                              : nullptr;
+    const size_t tex_size = tex_att ? tex_att->byte_stride() : 0;
+    const size_t face_size =
+        1 + 3 * sizeof(PointIndex) + (tex_att ? 1 + 3 * tex_size : 0);
+    const int num_faces = in_mesh_->num_faces();
+    const auto write_faces = [&](int begin, int end, char *dst) {
+      for (FaceIndex i(begin); i < end; ++i) {
+        const auto &f = in_mesh_->face(i);
+        *dst++ = 3;
         for (int c = 0; c < 3; ++c) {
-          buffer()->Encode(tex_att->GetAddress(tex_att->mapped_index(f[c])),
-                           tex_att->byte_stride());
+          if (f[c] >= num_points) {
+            // Invalid point stored on the |in_mesh_| face.
+            return false;
+          }
+          memcpy(dst, &f[c], sizeof(PointIndex));
+          dst += sizeof(PointIndex);
+        }
+        if (tex_att) {
+          *dst++ = 6;
+          for (int c = 0; c < 3; ++c) {
+            memcpy(dst, tex_att->GetAddress(tex_att->mapped_index(f[c])),
+                   tex_size);
+            dst += tex_size;
+          }
         }
       }
+      return true;
+    };
+    if (!WriteRows(num_faces, face_size, write_faces)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PlyEncoder::WriteRows(
+    int num_rows, size_t row_size,
+    const std::function<bool(int, int, char *)> &write_rows) {
+  // Minimum number of rows written by a single task.
+  constexpr int kMinRowsPerChunk = 1 << 14;
+  // Size of the blocks written to the output file.
+  constexpr size_t kOutputBlockSize = 1 << 22;
+  int rows_per_block = num_rows;
+  if (out_file_ != nullptr) {
+    rows_per_block = static_cast<int>(std::min<size_t>(
+        num_rows, std::max<size_t>(kOutputBlockSize / row_size, 1)));
+  }
+  EncoderBuffer *const out_data = buffer();
+  for (int first_row = 0; first_row < num_rows; first_row += rows_per_block) {
+    const int num_block_rows = std::min(rows_per_block, num_rows - first_row);
+    const size_t offset = out_data->size();
+    if (!out_data->Resize(offset + row_size * num_block_rows)) {
+      return false;
+    }
+    char *const block_data = out_data->data() + offset;
+    int num_chunks = 1;
+    if (thread_pool_ != nullptr) {
+      num_chunks = std::min(4 * thread_pool_->num_threads(),
+                            num_block_rows / kMinRowsPerChunk);
+      num_chunks = std::max(num_chunks, 1);
     }
+    std::vector<uint8_t> is_chunk_valid(num_chunks, 0);
+    ParallelFor(thread_pool_, num_chunks, [&](int c) {
+      const int begin =
+          static_cast<int>(int64_t{num_block_rows} * c / num_chunks);
+      const int end =
+          static_cast<int>(int64_t{num_block_rows} * (c + 1) / num_chunks);
+      is_chunk_valid[c] = write_rows(first_row + begin, first_row + end,
+                                     block_data + row_size * begin);
+    });
+    if (std::find(is_chunk_valid.begin(), is_chunk_valid.end(), 0) !=
+            is_chunk_valid.end() ||
+        !FlushOutput()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PlyEncoder::FlushOutput() {
+  if (out_file_ == nullptr || buffer()->size() == 0) {
+    return true;
+  }
+  if (!out_file_->Write(buffer()->data(), buffer()->size())) {
+    return false;
   }
+  buffer()->Clear();
   return true;
 }
 
@@ -195,6 +287,7 @@ bool PlyEncoder::ExitAndCleanup(bool return_value) {
   in_mesh_ = nullptr;
   in_point_cloud_ = nullptr;
   out_buffer_ = nullptr;
+  out_file_ = nullptr;
   return return_value;
 }
 
@@ -15,7 +15,11 @@
 #ifndef DRACO_IO_PLY_ENCODER_H_
 #define DRACO_IO_PLY_ENCODER_H_
 
+#include <functional>
+
 #include "draco/core/encoder_buffer.h"
+#include "draco/core/thread_pool.h"
+#include "draco/io/file_writer_interface.h"
 #include "draco/mesh/mesh.h"
 
 namespace draco {
@@ -31,10 +35,21 @@ class PlyEncoder {
   bool EncodeToFile(const PointCloud &pc, const std::string &file_name);
   bool EncodeToFile(const Mesh &mesh, const std::string &file_name);
 
+  // Encodes the mesh or the point cloud and writes it to |file|. The vertex
+  // and face data is written in blocks of a bounded size, so the whole output
+  // is never held in memory. Returns false when either the encoding or writing
+  // to |file| failed.
+  bool EncodeToFile(const PointCloud &pc, FileWriterInterface *file);
+  bool EncodeToFile(const Mesh &mesh, FileWriterInterface *file);
+
   // Encodes the mesh or the point cloud into a buffer.
   bool EncodeToBuffer(const PointCloud &pc, EncoderBuffer *out_buffer);
   bool EncodeToBuffer(const Mesh &mesh, EncoderBuffer *out_buffer);
 
+  // Sets a thread pool used for writing of the vertex and face data in
+  // concurrent chunks. The output is the same as without the thread pool.
+  void set_thread_pool(ThreadPool *pool) { thread_pool_ = pool; }
+
  protected:
   bool EncodeInternal();
   EncoderBuffer *buffer() const { return out_buffer_; }
@@ -43,10 +58,25 @@ class PlyEncoder {
  private:
   const char *GetAttributeDataType(int attribute);
 
+  // Appends |num_rows| rows of |row_size| bytes to the output. |write_rows| is
+  // called for consecutive ranges of [0, |num_rows|), possibly concurrently,
+  // and it writes the rows of the range to the given destination. When
+  // encoding to a file, the rows are written to the file in blocks. Returns
+  // false if any call of |write_rows| or writing to the file failed.
+  bool WriteRows(int num_rows, size_t row_size,
+                 const std::function<bool(int, int, char *)> &write_rows);
+
+  // Writes the content of the output buffer to the output file, if any.
+  bool FlushOutput();
+
   EncoderBuffer *out_buffer_;
+  // Output file of EncodeToFile() or nullptr when encoding into a buffer.
+  FileWriterInterface *out_file_;
 
   const PointCloud *in_point_cloud_;
   const Mesh *in_mesh_;
+
+  ThreadPool *thread_pool_;
 };
 
 }  // namespace draco
@@ -0,0 +1,179 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/ply_encoder.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/io/file_writer_interface.h"
+#include "draco/io/ply_decoder.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
+#include "draco/point_cloud/point_cloud_builder.h"
+
+namespace draco {
+
+// File writer that stores all written data.
+class StringFileWriter : public FileWriterInterface {
+ public:
+  bool Write(const char *buffer, size_t size) override {
+    data_.append(buffer, size);
+    max_write_size_ = std::max(max_write_size_, size);
+    ++num_writes_;
+    return true;
+  }
+  const std::string &data() const { return data_; }
+  size_t max_write_size() const { return max_write_size_; }
+  int num_writes() const { return num_writes_; }
+
+ private:
+  std::string data_;
+  size_t max_write_size_ = 0;
+  int num_writes_ = 0;
+};
+
+TEST(PlyEncoderTest, TestParallelEncoding) {
+  // Tests that a mesh is encoded to the same data with and without a thread
+  // pool.
+  const int kGridSize = 150;
+  TriangleSoupMeshBuilder builder;
+  builder.Start(2 * kGridSize * kGridSize);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  const int normal_att_id =
+      builder.AddAttribute(GeometryAttribute::NORMAL, 3, DT_FLOAT32);
+  const int color_att_id =
+      builder.AddAttribute(GeometryAttribute::COLOR, 4, DT_UINT8);
+  const int tex_att_id =
+      builder.AddAttribute(GeometryAttribute::TEX_COORD, 2, DT_FLOAT32);
+  const Vector3f normal(0.f, 0.f, 1.f);
+  // Each grid cell is split into two triangles.
+  const int kFaceCorners[2][3] = {{0, 1, 2}, {2, 1, 3}};
+  FaceIndex fi(0);
+  for (int y = 0; y < kGridSize; ++y) {
+    for (int x = 0; x < kGridSize; ++x) {
+      const Vector3f p[4] = {Vector3f(x, y, 0.f), Vector3f(x + 1, y, 0.f),
+                             Vector3f(x, y + 1, 0.f),
+                             Vector3f(x + 1, y + 1, 0.f)};
+      Vector2f t[4];
+      VectorD<uint8_t, 4> c[4];
+      for (int i = 0; i < 4; ++i) {
+        t[i] = Vector2f(p[i][0] / kGridSize, p[i][1] / kGridSize);
+        c[i] = VectorD<uint8_t, 4>(x, y, i, 255);
+      }
+      for (const auto &corners : kFaceCorners) {
+        builder.SetAttributeValuesForFace(pos_att_id, fi, &p[corners[0]],
+                                          &p[corners[1]], &p[corners[2]]);
+        builder.SetAttributeValuesForFace(normal_att_id, fi, &normal, &normal,
+                                          &normal);
+        builder.SetAttributeValuesForFace(color_att_id, fi, &c[corners[0]],
+                                          &c[corners[1]], &c[corners[2]]);
+        builder.SetAttributeValuesForFace(tex_att_id, fi, &t[corners[0]],
+                                          &t[corners[1]], &t[corners[2]]);
+        ++fi;
+      }
+    }
+  }
+  std::unique_ptr<Mesh> mesh = builder.Finalize();
+  ASSERT_NE(mesh, nullptr);
+
+  EncoderBuffer expected;
+  PlyEncoder encoder;
+  ASSERT_TRUE(encoder.EncodeToBuffer(*mesh, &expected));
+  ThreadPool pool(4);
+  encoder.set_thread_pool(&pool);
+  EncoderBuffer buffer;
+  ASSERT_TRUE(encoder.EncodeToBuffer(*mesh, &buffer));
+  ASSERT_EQ(std::string(buffer.data(), buffer.size()),
+            std::string(expected.data(), expected.size()));
+
+  // Check that the encoded mesh can be decoded.
+  DecoderBuffer decoder_buffer;
+  decoder_buffer.Init(buffer.data(), buffer.size());
+  Mesh decoded_mesh;
+  PlyDecoder decoder;
+  DRACO_ASSERT_OK(decoder.DecodeFromBuffer(&decoder_buffer, &decoded_mesh));
+  ASSERT_EQ(decoded_mesh.num_faces(), mesh->num_faces());
+  ASSERT_EQ(decoded_mesh.num_points(), mesh->num_points());
+  const PointAttribute *const pos_att = mesh->attribute(pos_att_id);
+  const PointAttribute *const decoded_pos_att =
+      decoded_mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+  ASSERT_NE(decoded_pos_att, nullptr);
+  for (FaceIndex i(0); i < mesh->num_faces(); ++i) {
+    for (int c = 0; c < 3; ++c) {
+      Vector3f value, decoded_value;
+      pos_att->GetMappedValue(mesh->face(i)[c], &value[0]);
+      decoded_pos_att->GetMappedValue(decoded_mesh.face(i)[c],
+                                      &decoded_value[0]);
+      ASSERT_EQ(value, decoded_value);
+    }
+  }
+}
+
+TEST(PlyEncoderTest, TestStreamingEncoding) {
+  // Tests that a large point cloud is written to a file in bounded blocks and
+  // that the written data matches the data encoded into a buffer.
+  constexpr int kNumPoints = 1000000;
+  PointCloudBuilder builder;
+  builder.Start(kNumPoints);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  for (PointIndex i(0); i < kNumPoints; ++i) {
+    const Vector3f pos(0.5f * i.value(), i.value() % 1000, 0.25f);
+    builder.SetAttributeValueForPoint(pos_att_id, i, &pos);
+  }
+  std::unique_ptr<PointCloud> pc = builder.Finalize(false);
+  ASSERT_NE(pc, nullptr);
+
+  PlyEncoder encoder;
+  EncoderBuffer expected;
+  ASSERT_TRUE(encoder.EncodeToBuffer(*pc, &expected));
+  ThreadPool pool(4);
+  for (const bool use_thread_pool : {false, true}) {
+    encoder.set_thread_pool(use_thread_pool ? &pool : nullptr);
+    StringFileWriter file;
+    ASSERT_TRUE(encoder.EncodeToFile(*pc, &file));
+    ASSERT_EQ(file.data(), std::string(expected.data(), expected.size()));
+    ASSERT_GT(file.num_writes(), 1);
+    ASSERT_LT(file.max_write_size(), expected.size() / 2);
+  }
+}
+
+TEST(PlyEncoderTest, TestExternalStorage) {
+  // Tests that the rows are written into external memory of the output
+  // buffer and that insufficient memory is reported as an error.
+  const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  PlyEncoder encoder;
+  EncoderBuffer expected;
+  ASSERT_TRUE(encoder.EncodeToBuffer(*mesh, &expected));
+
+  std::vector<char> memory(expected.size());
+  EncoderBuffer buffer;
+  buffer.SetExternalStorage(memory.data(), memory.size());
+  ASSERT_TRUE(encoder.EncodeToBuffer(*mesh, &buffer));
+  ASSERT_EQ(std::string(memory.data(), memory.size()),
+            std::string(expected.data(), expected.size()));
+
+  std::vector<char> small_memory(expected.size() - 1);
+  buffer.SetExternalStorage(small_memory.data(), small_memory.size());
+  ASSERT_FALSE(encoder.EncodeToBuffer(*mesh, &buffer));
+}
+
+}  // namespace draco
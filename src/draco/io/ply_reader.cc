@@ -15,7 +15,9 @@
 #include "draco/io/ply_reader.h"
 
 #include <array>
+#include <cstring>
 #include <regex>
+#include <utility>
 
 #include "draco/core/status.h"
 #include "draco/io/parser_utils.h"
@@ -23,6 +25,40 @@
 
 namespace draco {
 
+namespace {
+
+// Reverses the byte order of |num_values| values of |value_size| bytes stored
+// at |data|. The loops are simple enough to be vectorized by the compiler.
+void SwapByteOrder(uint8_t *data, size_t num_values, int value_size) {
+  switch (value_size) {
+    case 2:
+      for (size_t i = 0; i < num_values; ++i, data += 2) {
+        std::swap(data[0], data[1]);
+      }
+      break;
+    case 4:
+      for (size_t i = 0; i < num_values; ++i, data += 4) {
+        uint32_t value;
+        memcpy(&value, data, 4);
+        value = (value >> 24) | ((value >> 8) & 0xff00) |
+                ((value << 8) & 0xff0000) | (value << 24);
+        memcpy(data, &value, 4);
+      }
+      break;
+    case 8:
+      for (size_t i = 0; i < num_values; ++i, data += 8) {
+        for (int b = 0; b < 4; ++b) {
+          std::swap(data[b], data[7 - b]);
+        }
+      }
+      break;
+    default:
+      break;  // Single byte values do not need to be swapped.
+  }
+}
+
+}  // namespace
+
 PlyProperty::PlyProperty(const std::string &name, DataType data_type,
                          DataType list_type)
     : name_(name), data_type_(data_type), list_data_type_(list_type) {
@@ -56,13 +92,10 @@ Status PlyReader::Read(DecoderBuffer *buffer) {
   if (version != "1.0") {
     return Status(Status::UNSUPPORTED_VERSION, "Unsupported PLY version");
   }
-  if (format == "binary_big_endian") {
-    return Status(Status::UNSUPPORTED_VERSION,
-                  "Unsupported format. Currently we support only ascii and"
-                  " binary_little_endian format.");
-  }
   if (format == "ascii") {
     format_ = kAscii;
+  } else if (format == "binary_big_endian") {
+    format_ = kBigEndian;
   } else {
     format_ = kLittleEndian;
   }
@@ -172,7 +205,7 @@ StatusOr<bool> PlyReader::ParseProperty(DecoderBuffer *buffer) {
 
 bool PlyReader::ParsePropertiesData(DecoderBuffer *buffer) {
   for (int i = 0; i < static_cast<int>(elements_.size()); ++i) {
-    if (format_ == kLittleEndian) {
+    if (format_ == kLittleEndian || format_ == kBigEndian) {
       if (!ParseElementData(buffer, i)) {
         return false;
       }
@@ -187,32 +220,101 @@ bool PlyReader::ParsePropertiesData(DecoderBuffer *buffer) {
 
 bool PlyReader::ParseElementData(DecoderBuffer *buffer, int element_index) {
   PlyElement &element = elements_[element_index];
+  bool has_lists = false;
+  for (int i = 0; i < element.num_properties(); ++i) {
+    if (element.property(i).is_list()) {
+      has_lists = true;
+    }
+  }
+  if (!has_lists) {
+    return ParseFixedSizeElementData(buffer, element_index);
+  }
   for (int entry = 0; entry < element.num_entries(); ++entry) {
     for (int i = 0; i < element.num_properties(); ++i) {
       PlyProperty &prop = element.property(i);
+      int64_t num_entries = 1;
       if (prop.is_list()) {
         // Parse the number of entries for the list element.
-        int64_t num_entries = 0;
-        buffer->Decode(&num_entries, prop.list_data_type_num_bytes());
+        uint8_t num_entries_data[sizeof(int64_t)];
+        if (!buffer->Decode(num_entries_data,
+                            prop.list_data_type_num_bytes())) {
+          return false;
+        }
+        if (format_ == kBigEndian) {
+          SwapByteOrder(num_entries_data, 1, prop.list_data_type_num_bytes());
+        }
+        num_entries = 0;
+        memcpy(&num_entries, num_entries_data,
+               prop.list_data_type_num_bytes());
+        if (num_entries < 0) {
+          return false;
+        }
         // Store offset to the main data entry.
         prop.list_data_.push_back(prop.data_.size() /
                                   prop.data_type_num_bytes_);
         // Store the number of entries.
         prop.list_data_.push_back(num_entries);
-        // Read and store the actual property data
-        const int64_t num_bytes_to_read =
-            prop.data_type_num_bytes() * num_entries;
-        prop.data_.insert(prop.data_.end(), buffer->data_head(),
-                          buffer->data_head() + num_bytes_to_read);
-        buffer->Advance(num_bytes_to_read);
-      } else {
-        // Non-list property
-        prop.data_.insert(prop.data_.end(), buffer->data_head(),
-                          buffer->data_head() + prop.data_type_num_bytes());
-        buffer->Advance(prop.data_type_num_bytes());
       }
+      // Read and store the actual property data.
+      const int64_t num_bytes_to_read =
+          prop.data_type_num_bytes() * num_entries;
+      if (buffer->remaining_size() < num_bytes_to_read) {
+        return false;
+      }
+      const size_t size = prop.data_.size();
+      prop.data_.resize(size + num_bytes_to_read);
+      memcpy(prop.data_.data() + size, buffer->data_head(), num_bytes_to_read);
+      buffer->Advance(num_bytes_to_read);
+    }
+  }
+  if (format_ == kBigEndian) {
+    for (int i = 0; i < element.num_properties(); ++i) {
+      PlyProperty &prop = element.property(i);
+      SwapByteOrder(prop.data_.data(),
+                    prop.data_.size() / prop.data_type_num_bytes(),
+                    prop.data_type_num_bytes());
+    }
+  }
+  return true;
+}
+
+bool PlyReader::ParseFixedSizeElementData(DecoderBuffer *buffer,
+                                          int element_index) {
+  PlyElement &element = elements_[element_index];
+  const int64_t num_entries = element.num_entries();
+  if (num_entries <= 0) {
+    return true;  // Nothing to parse.
+  }
+  int64_t entry_size = 0;
+  for (int i = 0; i < element.num_properties(); ++i) {
+    entry_size += element.property(i).data_type_num_bytes();
+  }
+  if (buffer->remaining_size() < num_entries * entry_size) {
+    return false;
+  }
+  const uint8_t *const data =
+      reinterpret_cast<const uint8_t *>(buffer->data_head());
+  int64_t offset = 0;
+  for (int i = 0; i < element.num_properties(); ++i) {
+    PlyProperty &prop = element.property(i);
+    const int value_size = prop.data_type_num_bytes();
+    prop.data_.resize(num_entries * value_size);
+    uint8_t *const out = prop.data_.data();
+    if (value_size == entry_size) {
+      memcpy(out, data, num_entries * value_size);
+    } else {
+      const uint8_t *src = data + offset;
+      for (int64_t entry = 0; entry < num_entries; ++entry) {
+        memcpy(out + entry * value_size, src, value_size);
+        src += entry_size;
+      }
+    }
+    if (format_ == kBigEndian) {
+      SwapByteOrder(out, num_entries, value_size);
     }
+    offset += value_size;
   }
+  buffer->Advance(num_entries * entry_size);
   return true;
 }
 
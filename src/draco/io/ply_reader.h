@@ -14,14 +14,16 @@
 //
 // File contains helper classes used for parsing of PLY files. The classes are
 // used by the PlyDecoder (ply_decoder.h) to read a point cloud or mesh from a
-// source PLY file.
-// TODO(ostava): Currently, we support only binary PLYs encoded in the little
-// endian format ("format binary_little_endian 1.0").
+// source PLY file. Supported are the "ascii", "binary_little_endian" and
+// "binary_big_endian" formats. Data of each property is stored in a separate
+// array in the native byte order.
 
 #ifndef DRACO_IO_PLY_READER_H_
 #define DRACO_IO_PLY_READER_H_
 
+#include <cstring>
 #include <map>
+#include <string>
 #include <vector>
 
 #include "draco/core/decoder_buffer.h"
@@ -53,8 +55,9 @@ class PlyProperty {
     return data_.data() + entry_id * data_type_num_bytes_;
   }
   void push_back_value(const void *data) {
-    data_.insert(data_.end(), static_cast<const uint8_t *>(data),
-                 static_cast<const uint8_t *>(data) + data_type_num_bytes_);
+    const size_t size = data_.size();
+    data_.resize(size + data_type_num_bytes_);
+    memcpy(data_.data() + size, data, data_type_num_bytes_);
   }
 
   const std::string &name() const { return name_; }
@@ -131,7 +134,7 @@ class PlyReader {
   }
 
  private:
-  enum Format { kLittleEndian = 0, kAscii };
+  enum Format { kLittleEndian = 0, kAscii, kBigEndian };
 
   Status ParseHeader(DecoderBuffer *buffer);
   StatusOr<bool> ParseEndHeader(DecoderBuffer *buffer);
@@ -139,6 +142,9 @@ class PlyReader {
   StatusOr<bool> ParseProperty(DecoderBuffer *buffer);
   bool ParsePropertiesData(DecoderBuffer *buffer);
   bool ParseElementData(DecoderBuffer *buffer, int element_index);
+  // Parses binary data of an element without list properties. All entries of
+  // such element have the same size so each property is copied in bulk.
+  bool ParseFixedSizeElementData(DecoderBuffer *buffer, int element_index);
   bool ParseElementDataAscii(DecoderBuffer *buffer, int element_index);
 
   // Splits |line| by whitespace characters.
@@ -14,6 +14,10 @@
 //
 #include "draco/io/ply_reader.h"
 
+#include <algorithm>
+#include <cstring>
+#include <string>
+
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
 #include "draco/io/file_utils.h"
@@ -140,4 +144,100 @@ TEST_F(PlyReaderTest, TestReaderMoreDataTypes) {
   }
 }
 
+namespace {
+
+// Appends |value| to |data| in little or big endian byte order.
+template <typename T>
+void AppendValue(T value, bool big_endian, std::string *data) {
+  char bytes[sizeof(T)];
+  memcpy(bytes, &value, sizeof(T));
+  if (big_endian) {
+    std::reverse(bytes, bytes + sizeof(T));
+  }
+  data->append(bytes, sizeof(T));
+}
+
+// Returns a binary ply file with three vertices and two faces.
+std::string CreateBinaryPly(bool big_endian) {
+  const char *const format =
+      big_endian ? "binary_big_endian" : "binary_little_endian";
+  std::string data = std::string("ply\nformat ") + format +
+                     " 1.0\n"
+                     "element vertex 3\n"
+                     "property float x\n"
+                     "property double y\n"
+                     "property uchar red\n"
+                     "property short s\n"
+                     "element face 2\n"
+                     "property list ushort int vertex_indices\n"
+                     "end_header\n";
+  for (int i = 0; i < 3; ++i) {
+    AppendValue<float>(1.5f * i, big_endian, &data);
+    AppendValue<double>(-0.25 * i, big_endian, &data);
+    AppendValue<uint8_t>(10 + i, big_endian, &data);
+    AppendValue<int16_t>(-1000 * i, big_endian, &data);
+  }
+  AppendValue<uint16_t>(3, big_endian, &data);
+  for (int i = 0; i < 3; ++i) {
+    AppendValue<int32_t>(i, big_endian, &data);
+  }
+  AppendValue<uint16_t>(4, big_endian, &data);
+  for (int i = 0; i < 4; ++i) {
+    AppendValue<int32_t>(70000 * i, big_endian, &data);
+  }
+  return data;
+}
+
+}  // namespace
+
+TEST_F(PlyReaderTest, TestReaderBigEndian) {
+  // Tests that big endian files are decoded to the same values as the
+  // equivalent little endian files.
+  PlyReader readers[2];
+  const std::string data[2] = {CreateBinaryPly(false), CreateBinaryPly(true)};
+  for (int i = 0; i < 2; ++i) {
+    DecoderBuffer buf;
+    buf.Init(data[i].data(), data[i].size());
+    DRACO_ASSERT_OK(readers[i].Read(&buf));
+    ASSERT_EQ(readers[i].num_elements(), 2);
+  }
+  const PlyElement &vertices = *readers[1].GetElementByName("vertex");
+  ASSERT_EQ(vertices.num_entries(), 3);
+  PlyPropertyReader<float> x_reader(vertices.GetPropertyByName("x"));
+  PlyPropertyReader<double> y_reader(vertices.GetPropertyByName("y"));
+  PlyPropertyReader<int> red_reader(vertices.GetPropertyByName("red"));
+  PlyPropertyReader<int> s_reader(vertices.GetPropertyByName("s"));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(x_reader.ReadValue(i), 1.5f * i);
+    ASSERT_EQ(y_reader.ReadValue(i), -0.25 * i);
+    ASSERT_EQ(red_reader.ReadValue(i), 10 + i);
+    ASSERT_EQ(s_reader.ReadValue(i), -1000 * i);
+  }
+  for (int i = 0; i < 2; ++i) {
+    const PlyProperty &indices =
+        readers[i].GetElementByName("face")->property(0);
+    ASSERT_EQ(indices.GetListEntryNumValues(0), 3);
+    ASSERT_EQ(indices.GetListEntryNumValues(1), 4);
+    ASSERT_EQ(indices.GetListEntryOffset(1), 3);
+    PlyPropertyReader<int> index_reader(&indices);
+    for (int v = 0; v < 3; ++v) {
+      ASSERT_EQ(index_reader.ReadValue(v), v);
+    }
+    for (int v = 0; v < 4; ++v) {
+      ASSERT_EQ(index_reader.ReadValue(3 + v), 70000 * v);
+    }
+  }
+}
+
+TEST_F(PlyReaderTest, TestReaderTruncatedData) {
+  // Tests that binary files with missing data are rejected.
+  const std::string data = CreateBinaryPly(false);
+  for (const size_t size : {data.size() - 1, data.size() - 20}) {
+    DecoderBuffer buf;
+    buf.Init(data.data(), size);
+    PlyReader reader;
+    ASSERT_FALSE(reader.Read(&buf).ok());
+  }
+}
+
 }  // namespace draco
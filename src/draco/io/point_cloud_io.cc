@@ -14,13 +14,95 @@
 //
 #include "draco/io/point_cloud_io.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_set>
+
+#include "draco/io/file_reader_factory.h"
 #include "draco/io/file_utils.h"
+#include "draco/io/las_decoder.h"
 #include "draco/io/obj_decoder.h"
 #include "draco/io/parser_utils.h"
 #include "draco/io/ply_decoder.h"
 
 namespace draco {
 
+namespace {
+
+// Returns the points of |pc| within |region| that are kept when at most one
+// point is selected in each cell of a grid with cells of size |cell_size|.
+// All points within |region| are returned when |cell_size| is not positive.
+std::vector<PointIndex> SelectRegionPoints(const PointCloud &pc,
+                                           const BoundingBox &region,
+                                           float cell_size) {
+  std::vector<PointIndex> points;
+  const PointAttribute *const pos_att =
+      pc.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (pos_att == nullptr) {
+    return points;
+  }
+  std::unordered_set<uint64_t> used_cells;
+  for (PointIndex pi(0); pi < pc.num_points(); ++pi) {
+    Vector3f position;
+    if (!pos_att->ConvertValue<float>(pos_att->mapped_index(pi), 3,
+                                      &position[0])) {
+      continue;
+    }
+    bool is_inside = true;
+    for (int c = 0; c < 3; ++c) {
+      is_inside &= position[c] >= region.GetMinPoint()[c] &&
+                   position[c] <= region.GetMaxPoint()[c];
+    }
+    if (!is_inside) {
+      continue;
+    }
+    if (cell_size > 0.f) {
+      // Cells are indexed relative to the region with 21 bits per axis. Cells
+      // of very large regions may alias, which only removes more points.
+      uint64_t cell = 0;
+      for (int c = 0; c < 3; ++c) {
+        const float offset =
+            (position[c] - region.GetMinPoint()[c]) / cell_size;
+        const uint64_t coord =
+            static_cast<uint64_t>(std::min(offset, 2097151.f));
+        cell = (cell << 21) | coord;
+      }
+      if (!used_cells.insert(cell).second) {
+        continue;
+      }
+    }
+    points.push_back(pi);
+  }
+  return points;
+}
+
+// Returns a point cloud with points |points| of |pc|.
+std::unique_ptr<PointCloud> CreateSubPointCloud(
+    const PointCloud &pc, const std::vector<PointIndex> &points) {
+  std::unique_ptr<PointCloud> sub_pc(new PointCloud());
+  const uint32_t num_points = static_cast<uint32_t>(points.size());
+  sub_pc->set_num_points(num_points);
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    const PointAttribute *const att = pc.attribute(i);
+    GeometryAttribute ga;
+    const int value_size =
+        DataTypeLength(att->data_type()) * att->num_components();
+    ga.Init(att->attribute_type(), nullptr, att->num_components(),
+            att->data_type(), att->normalized(), value_size, 0);
+    PointAttribute *const sub_att =
+        sub_pc->attribute(sub_pc->AddAttribute(ga, true, num_points));
+    sub_att->set_unique_id(att->unique_id());
+    for (uint32_t p = 0; p < num_points; ++p) {
+      memcpy(sub_att->GetAddress(AttributeValueIndex(p)),
+             att->GetAddress(att->mapped_index(points[p])), value_size);
+    }
+  }
+  return sub_pc;
+}
+
+}  // namespace
+
 StatusOr<std::unique_ptr<PointCloud>> ReadPointCloudFromFile(
     const std::string &file_name) {
   std::unique_ptr<PointCloud> pc(new PointCloud());
@@ -43,16 +125,84 @@ StatusOr<std::unique_ptr<PointCloud>> ReadPointCloudFromFile(
     DRACO_RETURN_IF_ERROR(ply_decoder.DecodeFromFile(file_name, pc.get()));
     return std::move(pc);
   }
+  if (extension == ".las") {
+    // ASPRS LAS LiDAR file format.
+    LasDecoder las_decoder;
+    DRACO_RETURN_IF_ERROR(las_decoder.DecodeFromFile(file_name, pc.get()));
+    return std::move(pc);
+  }
 
-  std::vector<char> buffer;
-  if (!ReadFileToBuffer(file_name, &buffer)) {
+  FileContents file_contents;
+  if (!file_contents.Open(file_name)) {
     return Status(Status::DRACO_ERROR, "Unable to read input file.");
   }
   DecoderBuffer decoder_buffer;
-  decoder_buffer.Init(buffer.data(), buffer.size());
+  decoder_buffer.Init(file_contents.data(), file_contents.size());
   Decoder decoder;
   auto status_or = decoder.DecodePointCloudFromBuffer(&decoder_buffer);
   return std::move(status_or).value();
 }
 
+Status ReadChunkedContainerIndex(FileReaderInterface *reader,
+                                 ChunkedMeshDecoder *decoder) {
+  const size_t file_size = reader->GetFileSize();
+  // The size of the header is not known in advance, so the start of the file
+  // is read with increasing size until the header can be parsed.
+  std::vector<char> header_data;
+  size_t header_read_size = std::min<size_t>(4096, file_size);
+  while (true) {
+    if (!reader->ReadRange(0, header_read_size, &header_data)) {
+      return Status(Status::IO_ERROR, "Unable to read input file.");
+    }
+    DecoderBuffer header_buffer;
+    header_buffer.Init(header_data.data(), header_data.size());
+    const Status status = decoder->DecodeIndex(&header_buffer);
+    if (status.ok()) {
+      return OkStatus();
+    }
+    if (header_read_size == file_size) {
+      return status;
+    }
+    header_read_size = std::min(2 * header_read_size, file_size);
+  }
+}
+
+Status ReadChunkedPointCloudRegionFromFile(
+    const std::string &file_name, const BoundingBox &region,
+    float min_point_spacing,
+    std::vector<std::unique_ptr<PointCloud>> *out_chunks) {
+  std::unique_ptr<FileReaderInterface> reader =
+      FileReaderFactory::OpenReader(file_name);
+  if (reader == nullptr) {
+    return Status(Status::DRACO_ERROR, "Unable to open input file.");
+  }
+  ChunkedMeshDecoder decoder;
+  DRACO_RETURN_IF_ERROR(ReadChunkedContainerIndex(reader.get(), &decoder));
+
+  std::vector<char> chunk_data;
+  for (const int chunk_id : decoder.FindChunksInRegion(region)) {
+    if (!reader->ReadRange(static_cast<size_t>(decoder.chunk_offset(chunk_id)),
+                           static_cast<size_t>(decoder.chunk_size(chunk_id)),
+                           &chunk_data)) {
+      return Status(Status::IO_ERROR, "Chunk data is truncated.");
+    }
+    DecoderBuffer chunk_buffer;
+    chunk_buffer.Init(chunk_data.data(), chunk_data.size());
+    DRACO_ASSIGN_OR_RETURN(
+        std::unique_ptr<PointCloud> chunk,
+        decoder.DecodePointCloudChunkFromBuffer(&chunk_buffer));
+    const std::vector<PointIndex> points =
+        SelectRegionPoints(*chunk, region, min_point_spacing);
+    if (points.empty()) {
+      continue;
+    }
+    if (points.size() == chunk->num_points()) {
+      out_chunks->push_back(std::move(chunk));
+    } else {
+      out_chunks->push_back(CreateSubPointCloud(*chunk, points));
+    }
+  }
+  return OkStatus();
+}
+
 }  // namespace draco
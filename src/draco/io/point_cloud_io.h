@@ -15,9 +15,16 @@
 #ifndef DRACO_IO_POINT_CLOUD_IO_H_
 #define DRACO_IO_POINT_CLOUD_IO_H_
 
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "draco/compression/chunked_mesh_decoder.h"
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/decode.h"
 #include "draco/compression/expert_encode.h"
+#include "draco/core/bounding_box.h"
+#include "draco/io/file_reader_interface.h"
 
 namespace draco {
 
@@ -84,6 +91,28 @@ InStreamT &ReadPointCloudFromStream(std::unique_ptr<PointCloud> *point_cloud,
 StatusOr<std::unique_ptr<PointCloud>> ReadPointCloudFromFile(
     const std::string &file_name);
 
+// Decodes the header of a chunked container (see ChunkedMeshEncoder and
+// OutOfCorePointCloudEncoder) read from |reader| into |decoder|. Only the
+// start of the file containing the header is read, using
+// FileReaderInterface::ReadRange().
+Status ReadChunkedContainerIndex(FileReaderInterface *reader,
+                                 ChunkedMeshDecoder *decoder);
+
+// Reads points within |region| from a chunked point cloud container (see
+// OutOfCorePointCloudEncoder). Only the container header and the data of the
+// chunks whose bounds intersect |region| are read, using
+// FileReaderInterface::ReadRange(). Points of the decoded chunks outside of
+// |region| are removed. When |min_point_spacing| is positive, the points are
+// thinned so that each chunk keeps at most one point in each cell of a grid
+// with cells of size |min_point_spacing|, which limits the density of the
+// returned points, e.g. for distant parts of a view. The remaining points of
+// each chunk are appended to |out_chunks| as a separate point cloud. Chunks
+// without any remaining points are skipped.
+Status ReadChunkedPointCloudRegionFromFile(
+    const std::string &file_name, const BoundingBox &region,
+    float min_point_spacing,
+    std::vector<std::unique_ptr<PointCloud>> *out_chunks);
+
 }  // namespace draco
 
 #endif  // DRACO_IO_POINT_CLOUD_IO_H_
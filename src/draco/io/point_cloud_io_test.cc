@@ -19,6 +19,8 @@
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
 #include "draco/io/obj_decoder.h"
+#include "draco/io/out_of_core_point_cloud_encoder.h"
+#include "draco/point_cloud/point_cloud_builder.h"
 
 namespace draco {
 
@@ -95,6 +97,69 @@ TEST_F(IoPointCloudIoTest, ObjFileInput) {
   EXPECT_EQ(pc->num_points(), 97) << "Obj point cloud not loaded properly.";
 }
 
+TEST_F(IoPointCloudIoTest, ReadChunkedPointCloudRegion) {
+  // Tests that points within a region are read from a tiled point cloud and
+  // that they can be thinned.
+  PointCloudBuilder builder;
+  builder.Start(40 * 40 * 2);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  PointIndex pi(0);
+  for (int x = 0; x < 40; ++x) {
+    for (int y = 0; y < 40; ++y) {
+      for (int z = 0; z < 2; ++z) {
+        const Vector3f position(x, y, 0.1f * z);
+        builder.SetAttributeValueForPoint(pos_att_id, pi++, &position[0]);
+      }
+    }
+  }
+  const std::unique_ptr<PointCloud> pc = builder.Finalize(false);
+  OutOfCorePointCloudEncoder tiled_encoder;
+  DRACO_ASSERT_OK(tiled_encoder.Init(
+      BoundingBox(Vector3f(0.f, 0.f, 0.f), Vector3f(39.f, 39.f, 0.1f)), 10.f,
+      GetTestTempFileFullPath("point_cloud_io_region_test")));
+  DRACO_ASSERT_OK(tiled_encoder.AddPoints(*pc));
+  Encoder encoder;
+  encoder.SetAttributeQuantization(GeometryAttribute::POSITION, 16);
+  const std::string file_name =
+      GetTestTempFileFullPath("point_cloud_io_region_test.drc");
+  DRACO_ASSERT_OK(tiled_encoder.EncodeToFile(encoder, file_name));
+  ASSERT_EQ(tiled_encoder.num_encoded_chunks(), 16);
+
+  const BoundingBox region(Vector3f(4.5f, 4.5f, -1.f),
+                           Vector3f(15.5f, 15.5f, 1.f));
+  std::vector<std::unique_ptr<PointCloud>> chunks;
+  DRACO_ASSERT_OK(
+      ReadChunkedPointCloudRegionFromFile(file_name, region, 0.f, &chunks));
+  ASSERT_EQ(chunks.size(), 4);
+  int num_points = 0;
+  for (const auto &chunk : chunks) {
+    const PointAttribute *const pos_att =
+        chunk->GetNamedAttribute(GeometryAttribute::POSITION);
+    for (PointIndex i(0); i < chunk->num_points(); ++i) {
+      Vector3f position;
+      pos_att->GetMappedValue(i, &position[0]);
+      for (int c = 0; c < 3; ++c) {
+        ASSERT_GE(position[c], region.GetMinPoint()[c]);
+        ASSERT_LE(position[c], region.GetMaxPoint()[c]);
+      }
+    }
+    num_points += chunk->num_points();
+  }
+  ASSERT_EQ(num_points, 11 * 11 * 2);
+
+  // Thin the points to at most one point in each cell of size 2.
+  chunks.clear();
+  DRACO_ASSERT_OK(
+      ReadChunkedPointCloudRegionFromFile(file_name, region, 2.f, &chunks));
+  num_points = 0;
+  for (const auto &chunk : chunks) {
+    num_points += chunk->num_points();
+  }
+  ASSERT_GE(num_points, 6 * 6);
+  ASSERT_LE(num_points, 7 * 7);
+}
+
 // Test if we handle wrong input for all file extensions.
 TEST_F(IoPointCloudIoTest, WrongFileObj) {
   const std::unique_ptr<PointCloud> pc =
@@ -11,8 +11,6 @@
 #include <io.h>
 #endif
 
-#include "draco/io/file_reader_factory.h"
-
 namespace draco {
 
 #define FILEREADER_LOG_ERROR(error_string)                             \
@@ -21,9 +19,6 @@ namespace draco {
             error_string);                                             \
   } while (false)
 
-bool StdioFileReader::registered_in_factory_ =
-    FileReaderFactory::RegisterReader(StdioFileReader::Open);
-
 StdioFileReader::~StdioFileReader() { fclose(file_); }
 
 std::unique_ptr<FileReaderInterface> StdioFileReader::Open(
@@ -81,6 +76,37 @@ bool StdioFileReader::ReadFileToBuffer(std::vector<uint8_t> *buffer) {
   return fread(buffer->data(), 1, file_size, file_) == file_size;
 }
 
+bool StdioFileReader::ReadRange(size_t offset, size_t size,
+                                std::vector<char> *buffer) {
+  if (buffer == nullptr) {
+    return false;
+  }
+  const size_t file_size = GetFileSize();
+  if (offset > file_size || size > file_size - offset) {
+    return false;
+  }
+  buffer->resize(size);
+  if (size == 0) {
+    return true;
+  }
+
+#if _FILE_OFFSET_BITS == 64
+  const int seek_result = fseeko(file_, static_cast<off_t>(offset), SEEK_SET);
+#elif defined _WIN64
+  const int seek_result =
+      _fseeki64(file_, static_cast<int64_t>(offset), SEEK_SET);
+#else
+  const int seek_result = fseek(file_, static_cast<long>(offset), SEEK_SET);
+#endif
+  if (seek_result != 0) {
+    FILEREADER_LOG_ERROR("Seek to range failed");
+    return false;
+  }
+  const bool read_ok = fread(buffer->data(), 1, size, file_) == size;
+  rewind(file_);
+  return read_ok;
+}
+
 size_t StdioFileReader::GetFileSize() {
   if (fseek(file_, SEEK_SET, SEEK_END) != 0) {
     FILEREADER_LOG_ERROR("Seek to EoF failed");
@@ -33,6 +33,10 @@ class StdioFileReader : public FileReaderInterface {
   bool ReadFileToBuffer(std::vector<char> *buffer) override;
   bool ReadFileToBuffer(std::vector<uint8_t> *buffer) override;
 
+  // Reads |size| bytes starting at byte |offset| into |buffer|.
+  bool ReadRange(size_t offset, size_t size,
+                 std::vector<char> *buffer) override;
+
   // Returns the size of the file.
   size_t GetFileSize() override;
 
@@ -40,7 +44,6 @@ class StdioFileReader : public FileReaderInterface {
   StdioFileReader(FILE *file) : file_(file) {}
 
   FILE *file_ = nullptr;
-  static bool registered_in_factory_;
 };
 
 }  // namespace draco
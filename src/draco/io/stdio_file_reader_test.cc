@@ -1,5 +1,8 @@
 #include "draco/io/stdio_file_reader.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
 #include "draco/io/file_reader_test_common.h"
@@ -38,6 +41,25 @@ TEST(StdioFileReaderTest, ReadFile) {
   EXPECT_EQ(buffer.size(), kFileSizeCubePcDrc);
 }
 
+TEST(StdioFileReaderTest, ReadRange) {
+  auto reader = StdioFileReader::Open(GetTestFileFullPath("car.drc"));
+  ASSERT_NE(reader, nullptr);
+  std::vector<char> file_data;
+  ASSERT_TRUE(reader->ReadFileToBuffer(&file_data));
+  std::vector<char> buffer;
+  ASSERT_TRUE(reader->ReadRange(100, 1000, &buffer));
+  ASSERT_EQ(buffer.size(), 1000);
+  EXPECT_TRUE(
+      std::equal(buffer.begin(), buffer.end(), file_data.begin() + 100));
+  // The range must be within the file.
+  EXPECT_TRUE(reader->ReadRange(kFileSizeCarDrc, 0, &buffer));
+  EXPECT_FALSE(reader->ReadRange(kFileSizeCarDrc - 10, 11, &buffer));
+  EXPECT_FALSE(reader->ReadRange(kFileSizeCarDrc + 1, 0, &buffer));
+  // Whole file reads still work after a ranged read.
+  ASSERT_TRUE(reader->ReadFileToBuffer(&buffer));
+  EXPECT_EQ(buffer, file_data);
+}
+
 TEST(StdioFileReaderTest, GetFileSize) {
   auto reader = StdioFileReader::Open(GetTestFileFullPath("car.drc"));
   ASSERT_EQ(reader->GetFileSize(), kFileSizeCarDrc);
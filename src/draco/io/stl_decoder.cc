@@ -14,8 +14,10 @@
 //
 #include "draco/io/stl_decoder.h"
 
+#include <array>
 #include <string>
 
+#include "draco/core/deduplication_utils.h"
 #include "draco/core/macros.h"
 #include "draco/core/status.h"
 #include "draco/core/status_or.h"
@@ -43,8 +45,65 @@ StatusOr<std::unique_ptr<Mesh>> StlDecoder::DecodeFromBuffer(
   }
   buffer->Advance(80);
   uint32_t face_count;
-  buffer->Decode(&face_count, 4);
+  if (!buffer->Decode(&face_count, 4)) {
+    return Status(Status::IO_ERROR, "Failed to read the STL header.");
+  }
+  // Each face consists of a normal, three positions and a two byte attribute.
+  constexpr int64_t kFaceSize = 12 * sizeof(float) + sizeof(uint16_t);
+  if (buffer->remaining_size() / kFaceSize < face_count) {
+    return Status(Status::IO_ERROR, "Unexpected end of the STL data.");
+  }
 
+#if defined(DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED) && \
+    defined(DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED)
+  // Positions and normals are welded while the faces are read. The resulting
+  // mesh is the same as the deduplicated triangle soup, with attribute values
+  // and points ordered by their first occurrence.
+  typedef std::array<float, 3> Value;
+  // A closed triangle mesh has about half as many vertices as faces.
+  UniqueValueTable<Value> positions(face_count / 2);
+  UniqueValueTable<Value> normals;
+  // Each point is a unique combination of position and normal ids.
+  UniqueValueTable<std::array<uint32_t, 2>> points(face_count / 2);
+
+  std::unique_ptr<Mesh> mesh(new Mesh());
+  mesh->SetNumFaces(face_count);
+  for (uint32_t i = 0; i < face_count; i++) {
+    Value data[4];
+    buffer->Decode(data, sizeof(data));
+    buffer->Advance(sizeof(uint16_t));
+    const uint32_t normal_id = normals.FindOrInsert(data[0]);
+    Mesh::Face face;
+    for (int c = 0; c < 3; ++c) {
+      const uint32_t position_id = positions.FindOrInsert(data[c + 1]);
+      face[c] = points.FindOrInsert({{position_id, normal_id}});
+    }
+    mesh->SetFace(FaceIndex(i), face);
+  }
+
+  mesh->set_num_points(points.size());
+  GeometryAttribute va;
+  va.Init(GeometryAttribute::POSITION, nullptr, 3, DT_FLOAT32, false,
+          sizeof(Value), 0);
+  const int pos_att_id = mesh->AddAttribute(va, false, positions.size());
+  va.Init(GeometryAttribute::NORMAL, nullptr, 3, DT_FLOAT32, false,
+          sizeof(Value), 0);
+  const int norm_att_id = mesh->AddAttribute(va, false, normals.size());
+  PointAttribute *const pos_att = mesh->attribute(pos_att_id);
+  PointAttribute *const norm_att = mesh->attribute(norm_att_id);
+  pos_att->buffer()->Update(positions.values().data(),
+                            positions.size() * sizeof(Value));
+  norm_att->buffer()->Update(normals.values().data(),
+                             normals.size() * sizeof(Value));
+  for (PointIndex pi(0); pi < points.size(); ++pi) {
+    const std::array<uint32_t, 2> &point = points.values()[pi.value()];
+    pos_att->SetPointMapEntry(pi, AttributeValueIndex(point[0]));
+    norm_att->SetPointMapEntry(pi, AttributeValueIndex(point[1]));
+  }
+  mesh->SetAttributeElementType(pos_att_id, MESH_CORNER_ATTRIBUTE);
+  mesh->SetAttributeElementType(norm_att_id, MESH_FACE_ATTRIBUTE);
+  return std::move(mesh);
+#else
   TriangleSoupMeshBuilder builder;
   builder.Start(face_count);
 
@@ -72,6 +131,7 @@ StatusOr<std::unique_ptr<Mesh>> StlDecoder::DecodeFromBuffer(
 
   std::unique_ptr<Mesh> mesh = builder.Finalize();
   return mesh;
+#endif
 }
 
 }  // namespace draco
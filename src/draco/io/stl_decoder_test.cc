@@ -14,10 +14,14 @@
 //
 #include "draco/io/stl_decoder.h"
 
+#include <cstring>
 #include <string>
+#include <vector>
 
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/io/file_utils.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
 
 namespace draco {
 
@@ -40,6 +44,68 @@ class StlDecoderTest : public ::testing::Test {
   }
 };
 
+TEST_F(StlDecoderTest, TestWeldingMatchesTriangleSoup) {
+  // Tests that vertices welded during decoding produce the same mesh as the
+  // deduplicated triangle soup.
+  std::vector<char> data;
+  ASSERT_TRUE(ReadFileToBuffer(GetTestFileFullPath("STL/bunny.stl"), &data));
+  uint32_t face_count;
+  memcpy(&face_count, data.data() + 80, sizeof(face_count));
+  TriangleSoupMeshBuilder builder;
+  builder.Start(face_count);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  const int norm_att_id =
+      builder.AddAttribute(GeometryAttribute::NORMAL, 3, DT_FLOAT32);
+  for (uint32_t i = 0; i < face_count; ++i) {
+    float values[12];
+    memcpy(values, data.data() + 84 + 50 * i, sizeof(values));
+    builder.SetPerFaceAttributeValueForFace(norm_att_id, FaceIndex(i), values);
+    builder.SetAttributeValuesForFace(pos_att_id, FaceIndex(i), values + 3,
+                                      values + 6, values + 9);
+  }
+  const std::unique_ptr<Mesh> expected = builder.Finalize();
+  ASSERT_NE(expected, nullptr);
+
+  DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  StlDecoder decoder;
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<Mesh> mesh,
+                         decoder.DecodeFromBuffer(&buffer));
+  ASSERT_EQ(mesh->num_faces(), expected->num_faces());
+  ASSERT_EQ(mesh->num_points(), expected->num_points());
+  ASSERT_EQ(mesh->num_attributes(), expected->num_attributes());
+  for (FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+    ASSERT_EQ(mesh->face(fi), expected->face(fi));
+  }
+  for (int a = 0; a < mesh->num_attributes(); ++a) {
+    const PointAttribute *const att = mesh->attribute(a);
+    const PointAttribute *const expected_att = expected->attribute(a);
+    ASSERT_EQ(att->attribute_type(), expected_att->attribute_type());
+    ASSERT_EQ(att->size(), expected_att->size());
+    ASSERT_EQ(mesh->GetAttributeElementType(a),
+              expected->GetAttributeElementType(a));
+    ASSERT_EQ(memcmp(att->GetAddress(AttributeValueIndex(0)),
+                     expected_att->GetAddress(AttributeValueIndex(0)),
+                     att->size() * att->byte_stride()),
+              0);
+    for (PointIndex pi(0); pi < mesh->num_points(); ++pi) {
+      ASSERT_EQ(att->mapped_index(pi), expected_att->mapped_index(pi));
+    }
+  }
+}
+
+TEST_F(StlDecoderTest, TestTruncatedStl) {
+  // Tests that files with fewer faces than declared in the header are
+  // rejected.
+  std::vector<char> data;
+  ASSERT_TRUE(ReadFileToBuffer(GetTestFileFullPath("STL/bunny.stl"), &data));
+  DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size() - 1);
+  StlDecoder decoder;
+  ASSERT_FALSE(decoder.DecodeFromBuffer(&buffer).ok());
+}
+
 TEST_F(StlDecoderTest, TestStlDecoding) {
   test_decoding("STL/bunny.stl");
   test_decoding("STL/test_sphere.stl");
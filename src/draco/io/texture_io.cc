@@ -18,6 +18,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <unordered_set>
+#include <utility>
 
 #include "draco/io/file_utils.h"
 #include "draco/texture/texture_utils.h"
@@ -36,6 +38,23 @@ StatusOr<std::unique_ptr<Texture>> CreateDracoTextureInternal(
   return std::move(draco_texture);
 }
 
+Status TranscodeTextureToKtx2(const Ktx2TextureEncoderInterface &encoder,
+                              TextureMap::Type type, Texture *texture) {
+  std::vector<uint8_t> image_data;
+  DRACO_RETURN_IF_ERROR(WriteTextureToBuffer(*texture, &image_data));
+  std::vector<uint8_t> ktx2_data;
+  DRACO_RETURN_IF_ERROR(
+      encoder.EncodeToKtx2(*texture, image_data, type, &ktx2_data));
+  if (ImageFormatFromBuffer(ktx2_data.data(), ktx2_data.size()) !=
+      ImageFormat::BASIS) {
+    return Status(Status::DRACO_ERROR, "Texture encoder did not output KTX2.");
+  }
+  SourceImage &source_image = texture->source_image();
+  source_image.MutableEncodedData() = std::move(ktx2_data);
+  source_image.set_mime_type(TextureUtils::GetMimeType(ImageFormat::BASIS));
+  return OkStatus();
+}
+
 }  // namespace
 
 ImageFormat ImageFormatFromBuffer(const uint8_t *buffer, size_t buffer_size) {
@@ -163,6 +182,80 @@ Status WriteTextureToBuffer(const Texture &texture,
   return OkStatus();
 }
 
+Status ProcessTexturesInOrder(
+    const std::vector<const Texture *> &textures, ThreadPool *thread_pool,
+    const std::function<Status(int, const std::vector<uint8_t> &)>
+        &process_texture) {
+  // Textures are gathered in batches of two per thread, which keeps all threads
+  // busy for textures of different sizes while bounding the memory use.
+  const int batch_size =
+      thread_pool == nullptr ? 1 : 2 * (thread_pool->num_threads() + 1);
+  const int num_textures = static_cast<int>(textures.size());
+  std::vector<std::vector<uint8_t>> buffers(batch_size);
+  std::vector<Status> statuses(batch_size);
+  for (int start = 0; start < num_textures; start += batch_size) {
+    const int count = std::min(batch_size, num_textures - start);
+    ParallelFor(thread_pool, count, [&](int i) {
+      statuses[i] = WriteTextureToBuffer(*textures[start + i], &buffers[i]);
+    });
+    for (int i = 0; i < count; ++i) {
+      DRACO_RETURN_IF_ERROR(statuses[i]);
+      DRACO_RETURN_IF_ERROR(process_texture(start + i, buffers[i]));
+      // Release the memory before the next batch is gathered.
+      std::vector<uint8_t>().swap(buffers[i]);
+    }
+  }
+  return OkStatus();
+}
+
+Status WriteTexturesToFiles(const std::vector<const Texture *> &textures,
+                            const std::vector<std::string> &file_names,
+                            ThreadPool *thread_pool) {
+  if (textures.size() != file_names.size()) {
+    return Status(Status::DRACO_ERROR, "Invalid number of texture files.");
+  }
+  std::vector<Status> statuses(textures.size());
+  ParallelFor(thread_pool, static_cast<int>(textures.size()), [&](int i) {
+    statuses[i] = WriteTextureToFile(file_names[i], *textures[i]);
+  });
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status);
+  }
+  return OkStatus();
+}
+
+Status TranscodeTexturesToKtx2(const Ktx2TextureEncoderInterface &encoder,
+                               ThreadPool *thread_pool,
+                               MaterialLibrary *material_library) {
+  // Gather the textures that are not in KTX2 format yet together with the
+  // type of their first texture map.
+  std::vector<Texture *> textures;
+  std::vector<TextureMap::Type> types;
+  std::unordered_set<const Texture *> visited_textures;
+  for (int i = 0; i < material_library->NumMaterials(); ++i) {
+    Material *const material = material_library->MutableMaterial(i);
+    for (int j = 0; j < material->NumTextureMaps(); ++j) {
+      TextureMap *const texture_map = material->GetTextureMapByIndex(j);
+      Texture *const texture = texture_map->texture();
+      if (texture == nullptr || !visited_textures.insert(texture).second ||
+          TextureUtils::GetSourceFormat(*texture) == ImageFormat::BASIS) {
+        continue;
+      }
+      textures.push_back(texture);
+      types.push_back(texture_map->type());
+    }
+  }
+
+  std::vector<Status> statuses(textures.size());
+  ParallelFor(thread_pool, static_cast<int>(textures.size()), [&](int i) {
+    statuses[i] = TranscodeTextureToKtx2(encoder, types[i], textures[i]);
+  });
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status);
+  }
+  return OkStatus();
+}
+
 }  // namespace draco
 
 #endif  // DRACO_TRANSCODER_SUPPORTED
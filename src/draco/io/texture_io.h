@@ -18,13 +18,17 @@
 #include "draco/draco_features.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "draco/core/draco_types.h"
 #include "draco/core/status_or.h"
+#include "draco/core/thread_pool.h"
+#include "draco/material/material_library.h"
 #include "draco/texture/texture.h"
+#include "draco/texture/texture_map.h"
 
 namespace draco {
 
@@ -52,6 +56,57 @@ Status WriteTextureToFile(const std::string &file_name, const Texture &texture);
 Status WriteTextureToBuffer(const Texture &texture,
                             std::vector<uint8_t> *buffer);
 
+// Gets the encoded data of all |textures| like WriteTextureToBuffer() and
+// passes the data of each texture to |process_texture| together with its index
+// in |textures|. The data is gathered on the optional |thread_pool|, while
+// |process_texture| is called on the calling thread in the order of
+// |textures|. The data of only a few textures per thread is held in memory at
+// any time, so textures stored in files are streamed instead of being loaded
+// all at once. Returns the first error of either step.
+Status ProcessTexturesInOrder(
+    const std::vector<const Texture *> &textures, ThreadPool *thread_pool,
+    const std::function<Status(int, const std::vector<uint8_t> &)>
+        &process_texture);
+
+// Writes each of the |textures| into the file with the same index in
+// |file_names| like WriteTextureToFile(). The textures are written
+// concurrently on the optional |thread_pool| and each thread holds the data of
+// one texture at a time.
+Status WriteTexturesToFiles(const std::vector<const Texture *> &textures,
+                            const std::vector<std::string> &file_names,
+                            ThreadPool *thread_pool);
+
+// Interface of encoders that transcode the encoded images of textures, e.g.,
+// PNG or JPEG, into KTX2 with Basis Universal supercompression. Such textures
+// are uploaded to the GPU compressed instead of being decoded to RGBA at load
+// time. Draco does not contain any image codecs, so the encoder is provided by
+// the application, e.g., on top of the Basis Universal encoder library.
+class Ktx2TextureEncoderInterface {
+ public:
+  virtual ~Ktx2TextureEncoderInterface() = default;
+
+  // Transcodes the encoded |image_data| of |texture| into KTX2 and stores the
+  // result in |ktx2_data|. |type| is the type of the first texture map that
+  // uses |texture|, which can be used to choose the codec and the color space,
+  // e.g., UASTC in linear space for normal maps and ETC1S in sRGB space for
+  // colors. The method is called concurrently for different textures.
+  virtual Status EncodeToKtx2(const Texture &texture,
+                              const std::vector<uint8_t> &image_data,
+                              TextureMap::Type type,
+                              std::vector<uint8_t> *ktx2_data) const = 0;
+};
+
+// Transcodes all textures used by the materials of |material_library| into
+// KTX2 with |encoder|, skipping textures that already are in KTX2 format. The
+// textures are transcoded concurrently on the optional |thread_pool|. The
+// encoded data and the mime type of each texture are replaced, so glTF
+// encoders reference the textures with the KHR_texture_basisu extension.
+// Returns the first error of |encoder|, in which case some of the textures may
+// already be transcoded.
+Status TranscodeTexturesToKtx2(const Ktx2TextureEncoderInterface &encoder,
+                               ThreadPool *thread_pool,
+                               MaterialLibrary *material_library);
+
 // Returns the image format of an encoded texture stored in |buffer|.
 // ImageFormat::NONE is returned for unknown image formats.
 ImageFormat ImageFormatFromBuffer(const uint8_t *buffer, size_t buffer_size);
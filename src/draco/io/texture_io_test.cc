@@ -15,6 +15,7 @@
 #include "draco/io/texture_io.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -24,9 +25,63 @@
 
 #include "draco/core/draco_test_utils.h"
 #include "draco/io/file_utils.h"
+#include "draco/material/material_library.h"
+#include "draco/texture/texture_utils.h"
 
 namespace {
 
+draco::Texture *AddTexture(const std::string &name,
+                           draco::MaterialLibrary *library) {
+  std::unique_ptr<draco::Texture> texture =
+      draco::ReadTextureFromFile(draco::GetTestFileFullPath(name)).value();
+  draco::Texture *const texture_ptr = texture.get();
+  library->MutableTextureLibrary().PushTexture(std::move(texture));
+  return texture_ptr;
+}
+
+// Encoder that stores the KTX2 identifier followed by the source image data
+// and fails for textures of |failing_type|.
+class FakeKtx2TextureEncoder : public draco::Ktx2TextureEncoderInterface {
+ public:
+  explicit FakeKtx2TextureEncoder(draco::TextureMap::Type failing_type)
+      : failing_type_(failing_type), num_calls_(0) {}
+
+  draco::Status EncodeToKtx2(const draco::Texture &texture,
+                             const std::vector<uint8_t> &image_data,
+                             draco::TextureMap::Type type,
+                             std::vector<uint8_t> *ktx2_data) const override {
+    ++num_calls_;
+    if (type == failing_type_) {
+      return draco::Status(draco::Status::DRACO_ERROR, "Unsupported type.");
+    }
+    *ktx2_data = {0xab, 0x4b, 0x54, 0x58, 0x20, 0x32,
+                  0x30, 0xbb, 0x0d, 0x0a, 0x1a, 0x0a};
+    ktx2_data->insert(ktx2_data->end(), image_data.begin(), image_data.end());
+    return draco::OkStatus();
+  }
+
+  int num_calls() const { return num_calls_; }
+
+ private:
+  const draco::TextureMap::Type failing_type_;
+  mutable std::atomic<int> num_calls_;
+};
+
+// Creates a |library| with |num_materials| materials that share a color
+// texture and each have their own normal texture.
+void CreateTexturedMaterials(int num_materials,
+                             draco::MaterialLibrary *library) {
+  draco::Texture *const color_texture = AddTexture("test.png", library);
+  for (int i = 0; i < num_materials; ++i) {
+    draco::Material *const material = library->MutableMaterial(i);
+    DRACO_ASSERT_OK(
+        material->SetTextureMap(color_texture, draco::TextureMap::COLOR, 0));
+    DRACO_ASSERT_OK(
+        material->SetTextureMap(AddTexture("this_is_png.jpg", library),
+                                draco::TextureMap::NORMAL_TANGENT_SPACE, 0));
+  }
+}
+
 // Tests loading of textures from a buffer.
 TEST(TextureIoTest, TestLoadFromBuffer) {
   const std::string file_name = draco::GetTestFileFullPath("test.png");
@@ -74,6 +129,94 @@ TEST(TextureIoTest, TestTrailingJpegBytes) {
   ASSERT_NE(texture, nullptr);
 }
 
+// Tests that textures are processed in order and written concurrently.
+TEST(TextureIoTest, TestTexturePipeline) {
+  const std::vector<std::string> input_names = {"test.png", "this_is_png.jpg",
+                                                "trailing_zero.jpg"};
+  std::vector<std::unique_ptr<draco::Texture>> owned_textures;
+  std::vector<const draco::Texture *> textures;
+  std::vector<std::string> output_names;
+  for (int i = 0; i < 10; ++i) {
+    const std::string &name = input_names[i % input_names.size()];
+    DRACO_ASSIGN_OR_ASSERT(
+        std::unique_ptr<draco::Texture> texture,
+        draco::ReadTextureFromFile(draco::GetTestFileFullPath(name)));
+    if (i % 2 == 1) {
+      // Keep only the file name so that the data is loaded on demand.
+      draco::SourceImage source_image;
+      source_image.set_filename(draco::GetTestFileFullPath(name));
+      texture->set_source_image(source_image);
+    }
+    textures.push_back(texture.get());
+    owned_textures.push_back(std::move(texture));
+    output_names.push_back(draco::GetTestTempFileFullPath(
+        "pipeline" + std::to_string(i) + ".png"));
+  }
+
+  draco::ThreadPool pool(2);
+  std::vector<int> order;
+  DRACO_ASSERT_OK(draco::ProcessTexturesInOrder(
+      textures, &pool,
+      [&](int i, const std::vector<uint8_t> &data) -> draco::Status {
+        std::vector<uint8_t> expected;
+        EXPECT_TRUE(draco::ReadFileToBuffer(
+            draco::GetTestFileFullPath(input_names[i % input_names.size()]),
+            &expected));
+        EXPECT_EQ(data, expected);
+        order.push_back(i);
+        return draco::OkStatus();
+      }));
+  ASSERT_EQ(order.size(), textures.size());
+  for (int i = 0; i < order.size(); ++i) {
+    ASSERT_EQ(order[i], i);
+  }
+
+  DRACO_ASSERT_OK(draco::WriteTexturesToFiles(textures, output_names, &pool));
+  for (int i = 0; i < output_names.size(); ++i) {
+    std::vector<uint8_t> expected, written;
+    ASSERT_TRUE(draco::ReadFileToBuffer(
+        draco::GetTestFileFullPath(input_names[i % input_names.size()]),
+        &expected));
+    ASSERT_TRUE(draco::ReadFileToBuffer(output_names[i], &written));
+    ASSERT_EQ(written, expected);
+  }
+}
+
+
+// Tests that material textures are transcoded to KTX2 in parallel.
+TEST(TextureIoTest, TestTranscodeTexturesToKtx2) {
+  draco::MaterialLibrary library;
+  CreateTexturedMaterials(8, &library);
+  const FakeKtx2TextureEncoder encoder(draco::TextureMap::GENERIC);
+  draco::ThreadPool pool(2);
+  DRACO_ASSERT_OK(draco::TranscodeTexturesToKtx2(encoder, &pool, &library));
+
+  // The shared color texture is transcoded only once.
+  ASSERT_EQ(encoder.num_calls(), 9);
+  const draco::TextureLibrary &textures = library.GetTextureLibrary();
+  for (int i = 0; i < textures.NumTextures(); ++i) {
+    const draco::Texture &texture = *textures.GetTexture(i);
+    ASSERT_EQ(draco::TextureUtils::GetTargetMimeType(texture), "image/ktx2");
+    ASSERT_EQ(draco::TextureUtils::GetTargetExtension(texture), "ktx2");
+    const std::vector<uint8_t> &data = texture.source_image().encoded_data();
+    ASSERT_EQ(draco::ImageFormatFromBuffer(data.data(), data.size()),
+              draco::ImageFormat::BASIS);
+  }
+
+  // Textures that already are in KTX2 format are not transcoded again.
+  DRACO_ASSERT_OK(draco::TranscodeTexturesToKtx2(encoder, &pool, &library));
+  ASSERT_EQ(encoder.num_calls(), 9);
+}
+
+// Tests that errors of the KTX2 encoder are returned.
+TEST(TextureIoTest, TestTranscodeTexturesToKtx2Error) {
+  draco::MaterialLibrary library;
+  CreateTexturedMaterials(2, &library);
+  const FakeKtx2TextureEncoder encoder(draco::TextureMap::NORMAL_TANGENT_SPACE);
+  ASSERT_FALSE(
+      draco::TranscodeTexturesToKtx2(encoder, nullptr, &library).ok());
+}
+
 }  // namespace
 
 #endif  // DRACO_TRANSCODER_SUPPORTED
@@ -222,7 +222,7 @@ void TinyGltfUtils::SetDataImpl(float value, int index,
 // Actual definitions needed by the tinygltf library using our configuration.
 #define STB_IMAGE_IMPLEMENTATION
 #define STB_IMAGE_WRITE_IMPLEMENTATION
-#define TINYGLTF_ENABLE_DRACO
+// Draco compressed primitives are decoded by GltfDecoder.
 #define TINYGLTF_IMPLEMENTATION
 
 #include "tiny_gltf.h"
@@ -18,6 +18,8 @@
 #include "draco/draco_features.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <cstring>
+
 #include "Eigen/Geometry"
 #include "draco/animation/animation.h"
 #include "draco/core/status.h"
@@ -80,6 +82,42 @@ class TinyGltfUtils {
     return CopyDataAsFloatImpl<T>(model, accessor);
   }
 
+  // Copies |count| values with |num_components| components of
+  // |component_size| bytes each from |data| to |output| as components of type
+  // |ComponentT|. Consecutive source values are |byte_stride| bytes apart.
+  // Smaller source components are zero-extended. Data with matching component
+  // size is copied with memcpy, using a single call when it is tightly packed.
+  // Returns false if the source components are larger than |ComponentT|.
+  template <typename ComponentT>
+  static bool CopyComponents(const unsigned char *data, int byte_stride,
+                             int component_size, int num_components,
+                             size_t count, ComponentT *output) {
+    if (static_cast<size_t>(component_size) > sizeof(ComponentT)) {
+      return false;
+    }
+    if (component_size == sizeof(ComponentT)) {
+      const size_t value_size = num_components * sizeof(ComponentT);
+      if (static_cast<size_t>(byte_stride) == value_size) {
+        memcpy(output, data, count * value_size);
+        return true;
+      }
+      for (size_t i = 0; i < count; ++i) {
+        memcpy(output + i * num_components, data, value_size);
+        data += byte_stride;
+      }
+      return true;
+    }
+    for (size_t i = 0; i < count; ++i) {
+      for (int c = 0; c < num_components; ++c) {
+        ComponentT value = 0;
+        memcpy(&value, data + (c * component_size), component_size);
+        *output++ = value;
+      }
+      data += byte_stride;
+    }
+    return true;
+  }
+
  private:
   template <typename T>
   static StatusOr<std::vector<T>> CopyDataAsFloatImpl(
@@ -111,6 +149,14 @@ class TinyGltfUtils {
     output.resize(accessor.count);
 
     const int num_components = GetNumComponentsForType(accessor.type);
+    if (sizeof(T) == num_components * sizeof(float)) {
+      // |T| stores its components contiguously so the values can be copied
+      // directly into |output|.
+      CopyComponents<float>(data_start, byte_stride, component_size,
+                            num_components, accessor.count,
+                            reinterpret_cast<float *>(output.data()));
+      return output;
+    }
     const unsigned char *data = data_start;
     for (int i = 0; i < accessor.count; ++i) {
       T values;
@@ -31,3 +31,50 @@ Module['Decoder'].prototype.GetEncodedGeometryType = function(array) {
       return Module.INVALID_GEOMETRY_TYPE;
   }
 };
+
+// Decodes |array| with a single allocation on the emscripten heap and returns
+// an object with typed array views of the decoded data: |indices| holds the
+// triangle indices of meshes (null for point clouds) and |attributes| holds
+// one entry with |type|, |uniqueId|, |numComponents| and |values| for each
+// decoded attribute. |attributeTypes| optionally lists the attribute types to
+// decode, e.g. [Module.POSITION, Module.NORMAL]. The views stay valid until
+// |buffers| of the result is destroyed with Module.destroy(). Returns null on
+// failure.
+Module['Decoder'].prototype.DecodeArrayToTypedArrays = function(
+    array, attributeTypes) {
+  var buffers = new Module.DecodedFlatBuffers();
+  if (attributeTypes) {
+    for (var i = 0; i < attributeTypes.length; ++i) {
+      buffers.RequestAttribute(attributeTypes[i]);
+    }
+  }
+  var status = this.DecodeArrayToFlatBuffers(array, array.byteLength, buffers);
+  if (!status.ok()) {
+    Module.destroy(buffers);
+    return null;
+  }
+  var heap = typeof wasmMemory !== 'undefined' ? wasmMemory.buffer
+                                                : HEAP8.buffer;
+  var ptr = buffers.data();
+  var result = {
+    buffers: buffers,
+    numPoints: buffers.num_points(),
+    indices: buffers.num_faces() > 0
+        ? new Uint32Array(heap, ptr + buffers.indices_offset(),
+                          3 * buffers.num_faces())
+        : null,
+    attributes: []
+  };
+  for (var i = 0; i < buffers.num_attributes(); ++i) {
+    var TypedArray = getTypedArrayConstructor(buffers.GetAttributeDataType(i));
+    result.attributes.push({
+      type: buffers.GetAttributeType(i),
+      uniqueId: buffers.GetAttributeUniqueId(i),
+      numComponents: buffers.GetAttributeNumComponents(i),
+      values: new TypedArray(heap, ptr + buffers.GetAttributeOffset(i),
+                             buffers.GetAttributeSize(i) /
+                                 TypedArray.BYTES_PER_ELEMENT)
+    });
+  }
+  return result;
+};
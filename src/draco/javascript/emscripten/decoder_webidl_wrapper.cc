@@ -88,6 +88,32 @@ const char *MetadataQuerier::GetEntryName(const Metadata &metadata,
   return entry_names_[entry_id].c_str();
 }
 
+DecodedFlatBuffers::DecodedFlatBuffers()
+    : data_size_(0), num_points_(0), num_faces_(0) {}
+
+void DecodedFlatBuffers::RequestAttribute(
+    draco_GeometryAttribute_Type type) {
+  requested_types_.push_back(type);
+}
+
+void DecodedFlatBuffers::Allocate(long num_points, long num_faces) {
+  // Offsets are aligned so that views of any data type can be created.
+  const auto align = [](size_t offset) -> size_t {
+    return (offset + 7) & ~static_cast<size_t>(7);
+  };
+  num_points_ = num_points;
+  num_faces_ = num_faces;
+  size_t size = align(indices_size());
+  for (AttributeEntry &entry : attributes_) {
+    entry.offset = static_cast<long>(size);
+    entry.size = num_points * entry.num_components *
+                 draco::DataTypeLength(entry.data_type);
+    size = align(size + entry.size);
+  }
+  data_size_ = size;
+  data_.reset(size > 0 ? new uint8_t[size] : nullptr);
+}
+
 Decoder::Decoder() {}
 
 draco_EncodedGeometryType Decoder::GetEncodedGeometryType_Deprecated(
@@ -122,6 +148,77 @@ const draco::Status *Decoder::DecodeArrayToMesh(const char *data,
   return DecodeBufferToMesh(&buffer, out_mesh);
 }
 
+const Status *Decoder::DecodeArrayToFlatBuffers(
+    const char *data, size_t data_size, DecodedFlatBuffers *out_buffers) {
+  DecoderBuffer buffer;
+  buffer.Init(data, data_size);
+  const draco::StatusOr<draco::EncodedGeometryType> type_or =
+      draco::Decoder::GetEncodedGeometryType(&buffer);
+  if (!type_or.ok()) {
+    last_status_ = type_or.status();
+    return &last_status_;
+  }
+  draco::StatusOr<std::unique_ptr<PointCloud>> pc_or =
+      decoder_.DecodePointCloudFromBuffer(&buffer);
+  if (!pc_or.ok()) {
+    last_status_ = pc_or.status();
+    return &last_status_;
+  }
+  const std::unique_ptr<PointCloud> pc = std::move(pc_or).value();
+  // The decoder returns a mesh for encoded meshes.
+  const Mesh *const mesh = type_or.value() == draco::TRIANGULAR_MESH
+                               ? static_cast<const Mesh *>(pc.get())
+                               : nullptr;
+
+  // Collect the attributes that should be stored.
+  std::vector<const PointAttribute *> attributes;
+  if (out_buffers->requested_types_.empty()) {
+    for (int i = 0; i < pc->num_attributes(); ++i) {
+      attributes.push_back(pc->attribute(i));
+    }
+  } else {
+    for (const draco_GeometryAttribute_Type type :
+         out_buffers->requested_types_) {
+      const PointAttribute *const pa = pc->GetNamedAttribute(type);
+      if (pa != nullptr) {
+        attributes.push_back(pa);
+      }
+    }
+  }
+  out_buffers->attributes_.clear();
+  for (const PointAttribute *const pa : attributes) {
+    DecodedFlatBuffers::AttributeEntry entry;
+    entry.type = pa->attribute_type();
+    entry.data_type = pa->data_type();
+    entry.num_components = pa->num_components();
+    entry.unique_id = pa->unique_id();
+    entry.offset = 0;
+    entry.size = 0;
+    out_buffers->attributes_.push_back(entry);
+  }
+  out_buffers->Allocate(pc->num_points(),
+                        mesh != nullptr ? mesh->num_faces() : 0);
+
+  uint8_t *const out_data = static_cast<uint8_t *>(out_buffers->data());
+  if (mesh != nullptr) {
+    GetTrianglesUInt32Array(*mesh, out_buffers->indices_size(),
+                            out_data + out_buffers->indices_offset());
+  }
+  for (int i = 0; i < static_cast<int>(attributes.size()); ++i) {
+    const DecodedFlatBuffers::AttributeEntry &entry =
+        out_buffers->attributes_[i];
+    if (!GetAttributeDataArrayForAllPoints(*pc, *attributes[i],
+                                           entry.data_type, entry.size,
+                                           out_data + entry.offset)) {
+      last_status_ = Status(Status::DRACO_ERROR,
+                            "Unsupported attribute data type.");
+      return &last_status_;
+    }
+  }
+  last_status_ = draco::OkStatus();
+  return &last_status_;
+}
+
 long Decoder::GetAttributeId(const PointCloud &pc,
                              draco_GeometryAttribute_Type type) const {
   return pc.GetNamedAttributeId(type);
@@ -221,19 +318,12 @@ bool Decoder::GetAttributeFloatForAllPoints(const PointCloud &pc,
   const int components = pa.num_components();
   const int num_points = pc.num_points();
   const int num_entries = num_points * components;
-  std::vector<float> values(components, -2.f);
-  int entry_id = 0;
-
-  out_values->Resize(num_entries);
-  for (draco::PointIndex i(0); i < num_points; ++i) {
-    const draco::AttributeValueIndex val_index = pa.mapped_index(i);
-    if (!pa.ConvertValue<float>(val_index, &values[0])) {
-      return false;
-    }
-    for (int j = 0; j < components; ++j) {
-      out_values->SetValue(entry_id++, values[j]);
-    }
+  std::vector<float> values(num_entries);
+  if (!pa.ConvertAllValues<float>(num_points, components, values.data(),
+                                  sizeof(float) * components)) {
+    return false;
   }
+  out_values->MoveData(std::move(values));
   return true;
 }
 
@@ -247,25 +337,9 @@ bool Decoder::GetAttributeFloatArrayForAllPoints(const PointCloud &pc,
   if (data_size != out_size) {
     return false;
   }
-  const bool requested_type_is_float = pa.data_type() == draco::DT_FLOAT32;
-  std::vector<float> values(components, -2.f);
-  int entry_id = 0;
-  float *const floats = reinterpret_cast<float *>(out_values);
-
-  for (draco::PointIndex i(0); i < num_points; ++i) {
-    const draco::AttributeValueIndex val_index = pa.mapped_index(i);
-    if (requested_type_is_float) {
-      pa.GetValue(val_index, &values[0]);
-    } else {
-      if (!pa.ConvertValue<float>(val_index, &values[0])) {
-        return false;
-      }
-    }
-    for (int j = 0; j < components; ++j) {
-      floats[entry_id++] = values[j];
-    }
-  }
-  return true;
+  return pa.ConvertAllValues<float>(num_points, components,
+                                   reinterpret_cast<float *>(out_values),
+                                   sizeof(float) * components);
 }
 
 bool Decoder::GetAttributeInt8ForAllPoints(const PointCloud &pc,
@@ -359,3 +433,81 @@ const Metadata *Decoder::GetAttributeMetadata(const PointCloud &pc,
                                               long att_id) const {
   return pc.GetAttributeMetadataByAttributeId(att_id);
 }
+
+ParallelDecoder::ParallelDecoder(long num_threads)
+    : pool_(static_cast<int>(num_threads)) {}
+
+long ParallelDecoder::AddArray(const char *data, size_t data_size) {
+  arrays_.emplace_back(data, data + data_size);
+  return NumGeometries() - 1;
+}
+
+long ParallelDecoder::DecodeAll() {
+  const int num_arrays = static_cast<int>(arrays_.size());
+  statuses_.assign(num_arrays, draco::OkStatus());
+  geometry_types_.assign(num_arrays, draco::INVALID_GEOMETRY_TYPE);
+  geometries_.clear();
+  geometries_.resize(num_arrays);
+  pool_.ParallelFor(num_arrays, [this](int i) {
+    DecoderBuffer buffer;
+    buffer.Init(arrays_[i].data(), arrays_[i].size());
+    const draco::StatusOr<draco_EncodedGeometryType> type_or =
+        draco::Decoder::GetEncodedGeometryType(&buffer);
+    if (!type_or.ok()) {
+      statuses_[i] = type_or.status();
+      return;
+    }
+    // Each geometry uses its own decoder so that they can run concurrently.
+    draco::Decoder decoder;
+    *decoder.options() = options_;
+    draco::StatusOr<std::unique_ptr<PointCloud>> geometry_or =
+        decoder.DecodePointCloudFromBuffer(&buffer);
+    if (!geometry_or.ok()) {
+      statuses_[i] = geometry_or.status();
+      return;
+    }
+    geometry_types_[i] = type_or.value();
+    geometries_[i] = std::move(geometry_or).value();
+  });
+  long num_decoded = 0;
+  for (const Status &status : statuses_) {
+    if (status.ok()) {
+      ++num_decoded;
+    }
+  }
+  return num_decoded;
+}
+
+const Status *ParallelDecoder::GetStatus(long index) const {
+  if (!IsDecoded(index)) {
+    return nullptr;
+  }
+  return &statuses_[index];
+}
+
+const PointCloud *ParallelDecoder::GetPointCloud(long index) const {
+  if (!IsDecoded(index)) {
+    return nullptr;
+  }
+  return geometries_[index].get();
+}
+
+const Mesh *ParallelDecoder::GetMesh(long index) const {
+  const PointCloud *const pc = GetPointCloud(index);
+  if (pc == nullptr || geometry_types_[index] != draco::TRIANGULAR_MESH) {
+    return nullptr;
+  }
+  return static_cast<const Mesh *>(pc);
+}
+
+void ParallelDecoder::SkipAttributeTransform(
+    draco_GeometryAttribute_Type att_type) {
+  options_.SetAttributeBool(att_type, "skip_attribute_transform", true);
+}
+
+void ParallelDecoder::Clear() {
+  arrays_.clear();
+  statuses_.clear();
+  geometry_types_.clear();
+  geometries_.clear();
+}
@@ -15,6 +15,7 @@
 #ifndef DRACO_JAVASCRIPT_EMSCRIPTEN_DECODER_WEBIDL_WRAPPER_H_
 #define DRACO_JAVASCRIPT_EMSCRIPTEN_DECODER_WEBIDL_WRAPPER_H_
 
+#include <memory>
 #include <vector>
 
 #include "draco/attributes/attribute_transform_type.h"
@@ -22,6 +23,7 @@
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/decode.h"
 #include "draco/core/decoder_buffer.h"
+#include "draco/core/thread_pool.h"
 #include "draco/mesh/mesh.h"
 
 typedef draco::AttributeTransformType draco_AttributeTransformType;
@@ -94,6 +96,72 @@ class MetadataQuerier {
   std::string last_string_returned_;
 };
 
+// Decoded geometry stored in a single block of memory on the emscripten heap.
+// The block contains the triangle indices of meshes as uint32 values followed
+// by the values of the decoded attributes for all points, so javascript can
+// create typed array views of all data without any further copies. All
+// offsets and sizes are in bytes and the offsets are aligned to eight bytes.
+class DecodedFlatBuffers {
+ public:
+  DecodedFlatBuffers();
+
+  // Requests the first attribute of |type| to be stored in the block. When no
+  // attribute is requested, all attributes are stored.
+  void RequestAttribute(draco_GeometryAttribute_Type type);
+
+  // Returns the address of the block, or nullptr if nothing was decoded.
+  void *data() const { return data_.get(); }
+  long data_size() const { return static_cast<long>(data_size_); }
+
+  long num_points() const { return num_points_; }
+  // Returns the number of faces, or 0 for point clouds.
+  long num_faces() const { return num_faces_; }
+  long indices_offset() const { return 0; }
+  long indices_size() const { return 3 * num_faces_ * sizeof(uint32_t); }
+
+  // Returns the number of attributes stored in the block.
+  long num_attributes() const { return static_cast<long>(attributes_.size()); }
+  draco_GeometryAttribute_Type GetAttributeType(long index) const {
+    return attributes_[index].type;
+  }
+  draco_DataType GetAttributeDataType(long index) const {
+    return attributes_[index].data_type;
+  }
+  long GetAttributeNumComponents(long index) const {
+    return attributes_[index].num_components;
+  }
+  long GetAttributeUniqueId(long index) const {
+    return attributes_[index].unique_id;
+  }
+  long GetAttributeOffset(long index) const {
+    return attributes_[index].offset;
+  }
+  long GetAttributeSize(long index) const { return attributes_[index].size; }
+
+ private:
+  friend class Decoder;
+
+  struct AttributeEntry {
+    draco_GeometryAttribute_Type type;
+    draco_DataType data_type;
+    long num_components;
+    long unique_id;
+    long offset;
+    long size;
+  };
+
+  // Allocates the block for |num_points|, |num_faces| and all |attributes_|
+  // and computes their offsets.
+  void Allocate(long num_points, long num_faces);
+
+  std::vector<draco_GeometryAttribute_Type> requested_types_;
+  std::vector<AttributeEntry> attributes_;
+  std::unique_ptr<uint8_t[]> data_;
+  size_t data_size_;
+  long num_points_;
+  long num_faces_;
+};
+
 // Class used by emscripten WebIDL Binder [1] to wrap calls to decode Draco
 // data.
 // [1]http://kripken.github.io/emscripten-site/docs/porting/connecting_cpp_and_javascript/WebIDL-Binder.html
@@ -126,6 +194,12 @@ class Decoder {
   const draco::Status *DecodeArrayToMesh(const char *data, size_t data_size,
                                          draco::Mesh *out_mesh);
 
+  // Decodes a point cloud or a mesh from the provided array and stores its
+  // indices and attributes in |out_buffers| (see DecodedFlatBuffers). Each
+  // attribute is stored with its decoded data type.
+  const draco::Status *DecodeArrayToFlatBuffers(
+      const char *data, size_t data_size, DecodedFlatBuffers *out_buffers);
+
   // Returns an attribute id for the first attribute of a given type.
   long GetAttributeId(const draco::PointCloud &pc,
                       draco_GeometryAttribute_Type type) const;
@@ -265,20 +339,12 @@ class Decoder {
       return true;
     }
 
-    // Copy values one by one.
-    std::vector<ValueTypeT> values(components);
-    int entry_id = 0;
-
-    out_values->Resize(num_entries);
-    for (draco::PointIndex i(0); i < num_points; ++i) {
-      const draco::AttributeValueIndex val_index = pa.mapped_index(i);
-      if (!pa.ConvertValue<ValueTypeT>(val_index, &values[0])) {
-        return false;
-      }
-      for (int j = 0; j < components; ++j) {
-        out_values->SetValue(entry_id++, values[j]);
-      }
+    std::vector<ValueTypeT> values(num_entries);
+    if (!pa.ConvertAllValues<ValueTypeT>(num_points, components, values.data(),
+                                         sizeof(ValueTypeT) * components)) {
+      return false;
     }
+    out_values->MoveData(std::move(values));
     return true;
   }
 
@@ -302,29 +368,67 @@ class Decoder {
       return true;
     }
 
-    // Copy values one by one.
-    std::vector<T> values(components);
-    int entry_id = 0;
-
-    T *const typed_output = reinterpret_cast<T *>(out_values);
-    for (draco::PointIndex i(0); i < num_points; ++i) {
-      const draco::AttributeValueIndex val_index = pa.mapped_index(i);
-      if (requested_type_matches) {
-        pa.GetValue(val_index, values.data());
-      } else {
-        if (!pa.ConvertValue<T>(val_index, values.data())) {
-          return false;
-        }
-      }
-      for (int j = 0; j < components; ++j) {
-        typed_output[entry_id++] = values[j];
-      }
-    }
-    return true;
+    return pa.ConvertAllValues<T>(num_points, components,
+                                  reinterpret_cast<T *>(out_values),
+                                  sizeof(T) * components);
   }
 
   draco::Decoder decoder_;
   draco::Status last_status_;
 };
 
+// Class used by emscripten WebIDL Binder to decode multiple Draco geometries
+// concurrently. In builds with DRACO_WASM_THREADS, the geometries are decoded
+// on a pool of |num_threads| pthreads and the emscripten heap is backed by a
+// SharedArrayBuffer, so attribute data written to the heap with
+// Decoder::GetAttributeDataArrayForAllPoints() can be viewed by typed arrays
+// and shared with other workers without any copy. In other builds, all
+// geometries are decoded serially on the calling thread.
+//
+// DecodeAll() blocks until all geometries are decoded. The main browser thread
+// can only busy-wait for the pthreads, so it should be called from a worker.
+class ParallelDecoder {
+ public:
+  explicit ParallelDecoder(long num_threads);
+
+  // Copies |data| to the list of arrays to decode and returns its index.
+  long AddArray(const char *data, size_t data_size);
+
+  // Decodes all added arrays. Returns the number of successfully decoded
+  // geometries.
+  long DecodeAll();
+
+  // Returns the number of added arrays.
+  long NumGeometries() const { return static_cast<long>(arrays_.size()); }
+
+  // Returns the decoding status of the array at |index|.
+  const draco::Status *GetStatus(long index) const;
+
+  // Returns the geometry decoded from the array at |index| or nullptr if the
+  // decoding failed. GetMesh() also returns nullptr for point clouds. The
+  // geometry is owned by the decoder and valid until Clear() is called.
+  const draco::PointCloud *GetPointCloud(long index) const;
+  const draco::Mesh *GetMesh(long index) const;
+
+  // Tells the decoder to skip an attribute transform (e.g. dequantization) for
+  // an attribute of a given type.
+  void SkipAttributeTransform(draco_GeometryAttribute_Type att_type);
+
+  // Releases all added arrays and decoded geometries.
+  void Clear();
+
+ private:
+  // Returns true when the array at |index| was processed by DecodeAll().
+  bool IsDecoded(long index) const {
+    return index >= 0 && index < static_cast<long>(statuses_.size());
+  }
+
+  draco::ThreadPool pool_;
+  draco::DecoderOptions options_;
+  std::vector<std::vector<char>> arrays_;
+  std::vector<draco::Status> statuses_;
+  std::vector<draco_EncodedGeometryType> geometry_types_;
+  std::vector<std::unique_ptr<draco::PointCloud>> geometries_;
+};
+
 #endif  // DRACO_JAVASCRIPT_EMSCRIPTEN_DECODER_WEBIDL_WRAPPER_H_
@@ -0,0 +1,141 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Standalone loader that selects between the SIMD and the scalar builds of the
+// WebAssembly decoder. WebAssembly modules cannot detect SIMD support at
+// runtime, a module built with DRACO_WASM_SIMD fails to compile on engines
+// without SIMD, so the selection has to happen before the module is loaded.
+//
+// Example:
+//
+//   DracoDecoderLoader.load('path/to/decoders/').then(function(module) {
+//     var decoder = new module.Decoder();
+//     ...
+//   });
+//
+// The directory must contain draco_decoder.js/.wasm and, optionally,
+// draco_decoder_simd.js/.wasm.
+var DracoDecoderLoader = (function() {
+  var simdSupported = null;
+
+  // Minimal module with a function that uses v128 and i8x16.popcnt.
+  var kSimdTestModule = new Uint8Array([
+    0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 10,
+    1, 8, 0, 65, 0, 253, 15, 253, 98, 11
+  ]);
+
+  // Returns true when the engine supports 128-bit WebAssembly SIMD.
+  function isWasmSimdSupported() {
+    if (simdSupported === null) {
+      try {
+        simdSupported = typeof WebAssembly === 'object' &&
+            WebAssembly.validate(kSimdTestModule);
+      } catch (e) {
+        simdSupported = false;
+      }
+    }
+    return simdSupported;
+  }
+
+  // Returns the base name of the decoder build that should be used.
+  // |useSimd| can be set to false to force the scalar build.
+  function getDecoderName(useSimd) {
+    return useSimd !== false && isWasmSimdSupported() ? 'draco_decoder_simd' :
+                                                         'draco_decoder';
+  }
+
+  // Loads the script at |url| and resolves when it has been executed.
+  function loadScript(url) {
+    return new Promise(function(resolve, reject) {
+      if (typeof importScripts === 'function') {
+        // Web worker.
+        importScripts(url);
+        resolve();
+        return;
+      }
+      var script = document.createElement('script');
+      script.src = url;
+      script.onload = function() {
+        resolve();
+      };
+      script.onerror = function() {
+        reject(new Error('Failed to load ' + url));
+      };
+      document.head.appendChild(script);
+    });
+  }
+
+  // Starts downloading and compiling the WebAssembly module at |url|. Returns
+  // null when streaming compilation is not available.
+  function compileStreaming(url) {
+    if (typeof WebAssembly !== 'object' ||
+        typeof WebAssembly.compileStreaming !== 'function' ||
+        typeof fetch !== 'function') {
+      return null;
+    }
+    return WebAssembly.compileStreaming(fetch(url));
+  }
+
+  // Loads the best decoder build from |basePath| and resolves with the
+  // initialized decoder module. |moduleOptions| are passed to the module
+  // factory. When the SIMD build cannot be loaded, the scalar build is used.
+  // The .wasm file is compiled while it is downloaded, in parallel with the
+  // loading of the glue script. This requires the server to send the file
+  // with the application/wasm MIME type.
+  function load(basePath, moduleOptions, useSimd) {
+    var name = getDecoderName(useSimd);
+    var options = {};
+    for (var key in moduleOptions) {
+      options[key] = moduleOptions[key];
+    }
+    var compiled = options.instantiateWasm || options.wasmBinary ?
+        null :
+        compileStreaming(basePath + name + '.wasm');
+    return Promise.all([loadScript(basePath + name + '.js'), compiled])
+        .then(function(results) {
+          var wasmModule = results[1];
+          options.locateFile = function(file) {
+            return basePath + file;
+          };
+          if (wasmModule) {
+            options.instantiateWasm = function(imports, receiveInstance) {
+              WebAssembly.instantiate(wasmModule, imports)
+                  .then(function(instance) {
+                    receiveInstance(instance, wasmModule);
+                  });
+              // An empty object tells the module that the instantiation is
+              // asynchronous.
+              return {};
+            };
+          }
+          return DracoDecoderModule(options);
+        })
+        .catch(function(error) {
+          if (name === 'draco_decoder') {
+            throw error;
+          }
+          return load(basePath, moduleOptions, false);
+        });
+  }
+
+  return {
+    isWasmSimdSupported: isWasmSimdSupported,
+    getDecoderName: getDecoderName,
+    load: load
+  };
+})();
+
+if (typeof module === 'object' && module.exports) {
+  module.exports = DracoDecoderLoader;
+}
@@ -0,0 +1,105 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Returns the draco data type of the values stored in |array|, or
+// Module.DT_INVALID when the typed array type is not supported.
+function getDracoDataType(array) {
+  if (array instanceof Int8Array)
+    return Module.DT_INT8;
+  if (array instanceof Uint8Array || array instanceof Uint8ClampedArray)
+    return Module.DT_UINT8;
+  if (array instanceof Int16Array)
+    return Module.DT_INT16;
+  if (array instanceof Uint16Array)
+    return Module.DT_UINT16;
+  if (array instanceof Int32Array)
+    return Module.DT_INT32;
+  if (array instanceof Uint32Array)
+    return Module.DT_UINT32;
+  if (array instanceof Float32Array)
+    return Module.DT_FLOAT32;
+  return Module.DT_INVALID;
+}
+
+// Returns a view of the bytes of |array| so that it can be copied into the
+// emscripten heap regardless of its element type.
+function getBytes(array) {
+  return new Uint8Array(array.buffer, array.byteOffset, array.byteLength);
+}
+
+// Encodes a mesh, or a point cloud when |indices| is null, in a single call.
+// |attributes| is an array of objects with |type| (e.g. Module.POSITION),
+// |numComponents|, |values| (a typed array with the values of all points) and
+// an optional |normalized| flag. |indices| holds three point indices per
+// triangle in any integer typed array. Each input array is copied into the
+// emscripten heap exactly once, and the encoded data is returned as an
+// Int8Array that owns its ArrayBuffer, so it can be transferred to another
+// thread with postMessage(result, [result.buffer]). Attribute values are
+// deduplicated before encoding unless |deduplicateValues| is false. Returns
+// null on failure.
+Module['Encoder'].prototype.EncodeTypedArraysToDracoBuffer = function(
+    attributes, indices, deduplicateValues) {
+  if (!attributes || attributes.length === 0)
+    return null;
+  var numPoints =
+      attributes[0].values.length / attributes[0].numComponents;
+  var numFaces = indices ? indices.length / 3 : 0;
+  if (numPoints !== Math.floor(numPoints) ||
+      numFaces !== Math.floor(numFaces))
+    return null;
+  var buffers = new Module.EncoderFlatBuffers(numPoints, numFaces);
+  var attIds = [];
+  for (var i = 0; i < attributes.length; ++i) {
+    var attribute = attributes[i];
+    var attId = -1;
+    if (attribute.values.length === numPoints * attribute.numComponents) {
+      attId = buffers.AddAttribute(attribute.type,
+                                   getDracoDataType(attribute.values),
+                                   attribute.numComponents,
+                                   !!attribute.normalized);
+    }
+    if (attId < 0) {
+      Module.destroy(buffers);
+      return null;
+    }
+    attIds.push(attId);
+  }
+  // All memory is allocated at this point, so the heap can not be resized
+  // while the input arrays are copied.
+  var heap = new Uint8Array(typeof wasmMemory !== 'undefined'
+                                ? wasmMemory.buffer : HEAP8.buffer);
+  for (var i = 0; i < attributes.length; ++i) {
+    heap.set(getBytes(attributes[i].values),
+             buffers.GetAttributeData(attIds[i]));
+  }
+  if (numFaces > 0) {
+    if (indices instanceof Uint32Array || indices instanceof Int32Array) {
+      heap.set(getBytes(indices), buffers.indices_data());
+    } else {
+      new Uint32Array(heap.buffer, buffers.indices_data(), indices.length)
+          .set(indices);
+    }
+  }
+  var size = this.EncodeFlatBuffersToDracoBuffer(
+      buffers, deduplicateValues !== false);
+  var result = null;
+  if (size > 0) {
+    // Encoding may have resized the heap, so the buffer is queried again.
+    var encodedHeap = typeof wasmMemory !== 'undefined' ? wasmMemory.buffer
+                                                         : HEAP8.buffer;
+    result = new Int8Array(encodedHeap, buffers.encoded_data(), size).slice();
+  }
+  Module.destroy(buffers);
+  return result;
+};
@@ -14,6 +14,8 @@
 //
 #include "draco/javascript/emscripten/encoder_webidl_wrapper.h"
 
+#include <limits>
+
 #include "draco/compression/encode.h"
 #include "draco/mesh/mesh.h"
 
@@ -229,6 +231,51 @@ bool MeshBuilder::AddMetadataToMesh(Mesh *mesh, const Metadata *metadata) {
   return AddMetadata(mesh, metadata);
 }
 
+EncoderFlatBuffers::EncoderFlatBuffers(long num_points, long num_faces) {
+  if (num_points < 0 || num_faces < 0) {
+    return;
+  }
+  if (num_faces > 0) {
+    std::unique_ptr<Mesh> mesh(new Mesh());
+    mesh->SetNumFaces(num_faces);
+    geometry_ = std::move(mesh);
+    indices_.resize(3 * num_faces);
+  } else {
+    geometry_.reset(new PointCloud());
+  }
+  geometry_->set_num_points(num_points);
+}
+
+long EncoderFlatBuffers::AddAttribute(draco_GeometryAttribute_Type type,
+                                      draco_DataType data_type,
+                                      long num_components, bool normalized) {
+  if (!geometry_ || num_components < 1 ||
+      num_components > std::numeric_limits<int8_t>::max() ||
+      draco::DataTypeLength(data_type) == 0) {
+    return -1;
+  }
+  std::unique_ptr<draco::PointAttribute> att(new draco::PointAttribute());
+  att->Init(type, num_components, data_type, normalized,
+            geometry_->num_points());
+  return geometry_->AddAttribute(std::move(att));
+}
+
+void *EncoderFlatBuffers::GetAttributeData(long att_id) {
+  if (!geometry_ || att_id < 0 || att_id >= geometry_->num_attributes()) {
+    return nullptr;
+  }
+  draco::PointAttribute *const att = geometry_->attribute(att_id);
+  return att->GetAddress(draco::AttributeValueIndex(0));
+}
+
+long EncoderFlatBuffers::GetAttributeDataSize(long att_id) const {
+  if (!geometry_ || att_id < 0 || att_id >= geometry_->num_attributes()) {
+    return 0;
+  }
+  const draco::PointAttribute *const att = geometry_->attribute(att_id);
+  return static_cast<long>(att->size() * att->byte_stride());
+}
+
 Encoder::Encoder() {}
 
 void Encoder::SetEncodingMethod(long method) {
@@ -298,6 +345,50 @@ int Encoder::EncodePointCloudToDracoBuffer(draco::PointCloud *pc,
   return buffer.size();
 }
 
+int Encoder::EncodeFlatBuffersToDracoBuffer(EncoderFlatBuffers *buffers,
+                                            bool deduplicate_values) {
+  if (!buffers || !buffers->geometry_) {
+    return 0;
+  }
+  // The geometry is released after encoding, successful or not.
+  const std::unique_ptr<PointCloud> pc = std::move(buffers->geometry_);
+  const std::vector<uint32_t> indices = std::move(buffers->indices_);
+  buffers->indices_.clear();
+  buffers->encoded_.Clear();
+  if (pc->GetNamedAttributeId(draco::GeometryAttribute::POSITION) == -1) {
+    return 0;
+  }
+  Mesh *const mesh = indices.empty() ? nullptr : static_cast<Mesh *>(pc.get());
+  if (mesh) {
+    const uint32_t num_points = pc->num_points();
+    for (draco::FaceIndex f(0); f < mesh->num_faces(); ++f) {
+      Mesh::Face face;
+      for (int c = 0; c < 3; ++c) {
+        const uint32_t index = indices[3 * f.value() + c];
+        if (index >= num_points) {
+          return 0;
+        }
+        face[c] = index;
+      }
+      mesh->SetFace(f, face);
+    }
+  }
+  if (deduplicate_values) {
+    if (!pc->DeduplicateAttributeValues()) {
+      return 0;
+    }
+    pc->DeduplicatePointIds();
+  }
+  const draco::Status status =
+      mesh ? encoder_.EncodeMeshToBuffer(*mesh, &buffers->encoded_)
+           : encoder_.EncodePointCloudToBuffer(*pc, &buffers->encoded_);
+  if (!status.ok()) {
+    buffers->encoded_.Clear();
+    return 0;
+  }
+  return buffers->encoded_.size();
+}
+
 int Encoder::GetNumberOfEncodedPoints() {
   return encoder_.num_encoded_points();
 }
@@ -15,6 +15,7 @@
 #ifndef DRACO_JAVASCRIPT_EMSCRIPTEN_ENCODER_WEBIDL_WRAPPER_H_
 #define DRACO_JAVASCRIPT_EMSCRIPTEN_ENCODER_WEBIDL_WRAPPER_H_
 
+#include <memory>
 #include <vector>
 
 #include "draco/attributes/point_attribute.h"
@@ -22,12 +23,14 @@
 #include "draco/compression/config/encoder_options.h"
 #include "draco/compression/encode.h"
 #include "draco/compression/expert_encode.h"
+#include "draco/core/encoder_buffer.h"
 #include "draco/mesh/mesh.h"
 
 typedef draco::GeometryAttribute draco_GeometryAttribute;
 typedef draco::GeometryAttribute::Type draco_GeometryAttribute_Type;
 typedef draco::EncodedGeometryType draco_EncodedGeometryType;
 typedef draco::MeshEncoderMethod draco_MeshEncoderMethod;
+typedef draco::DataType draco_DataType;
 
 class DracoInt8Array {
  public:
@@ -136,6 +139,47 @@ class MeshBuilder : public PointCloudBuilder {
   bool AddMetadataToMesh(draco::Mesh *mesh, const draco::Metadata *metadata);
 };
 
+// Geometry to be encoded by Encoder::EncodeFlatBuffersToDracoBuffer(). The
+// attribute values and triangle indices are written by javascript directly
+// into memory owned by this object on the emscripten heap, so each input typed
+// array is copied only once. The encoded data is also kept by this object and
+// can be viewed from javascript without going through a DracoInt8Array.
+class EncoderFlatBuffers {
+ public:
+  // Creates a mesh with |num_faces| faces, or a point cloud when |num_faces| is
+  // 0, with |num_points| points.
+  EncoderFlatBuffers(long num_points, long num_faces);
+
+  // Adds an attribute with values for all points and returns its id, or -1 on
+  // failure. The values must be written to GetAttributeData(id).
+  long AddAttribute(draco_GeometryAttribute_Type type, draco_DataType data_type,
+                    long num_components, bool normalized);
+  // Returns the address of the values of attribute |att_id|.
+  void *GetAttributeData(long att_id);
+  long GetAttributeDataSize(long att_id) const;
+
+  // Returns the address of the 3 * num_faces uint32 triangle indices.
+  void *indices_data() { return indices_.data(); }
+  long indices_size() const {
+    return static_cast<long>(indices_.size() * sizeof(uint32_t));
+  }
+
+  long num_points() const { return geometry_->num_points(); }
+  long num_faces() const { return static_cast<long>(indices_.size() / 3); }
+
+  // Returns the address of the encoded data, valid until the next encoding or
+  // until this object is destroyed.
+  void *encoded_data() { return const_cast<char *>(encoded_.data()); }
+  long encoded_size() const { return static_cast<long>(encoded_.size()); }
+
+ private:
+  friend class Encoder;
+
+  std::unique_ptr<draco::PointCloud> geometry_;
+  std::vector<uint32_t> indices_;
+  draco::EncoderBuffer encoded_;
+};
+
 class Encoder {
  public:
   Encoder();
@@ -155,6 +199,12 @@ class Encoder {
   int EncodePointCloudToDracoBuffer(draco::PointCloud *pc,
                                     bool deduplicate_values,
                                     DracoInt8Array *buffer);
+
+  // Encodes the geometry of |buffers| and stores the encoded data in
+  // |buffers|. The input geometry is released afterwards. Returns the size of
+  // the encoded data, or 0 on failure.
+  int EncodeFlatBuffersToDracoBuffer(EncoderFlatBuffers *buffers,
+                                     bool deduplicate_values);
   int GetNumberOfEncodedPoints();
   int GetNumberOfEncodedFaces();
 
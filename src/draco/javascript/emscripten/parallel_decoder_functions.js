@@ -0,0 +1,75 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Decodes all |arrays| concurrently. Each element of |arrays| should be a
+// javascript Int8Array containing the encoded data. Returns the number of
+// successfully decoded geometries. The results can be accessed with
+// GetStatus(), GetPointCloud() and GetMesh() using the index of the array.
+Module['ParallelDecoder'].prototype.DecodeArrays = function(arrays) {
+  this.Clear();
+  for (var i = 0; i < arrays.length; ++i) {
+    this.AddArray(arrays[i], arrays[i].byteLength);
+  }
+  return this.DecodeAll();
+};
+
+// Returns the typed array constructor for values of |dataType| or null if the
+// type is not supported.
+function getTypedArrayConstructor(dataType) {
+  switch (dataType) {
+    case Module.DT_INT8:
+      return Int8Array;
+    case Module.DT_UINT8:
+      return Uint8Array;
+    case Module.DT_INT16:
+      return Int16Array;
+    case Module.DT_UINT16:
+      return Uint16Array;
+    case Module.DT_INT32:
+      return Int32Array;
+    case Module.DT_UINT32:
+      return Uint32Array;
+    case Module.DT_FLOAT32:
+      return Float32Array;
+    default:
+      return null;
+  }
+}
+
+// Returns |dataType| values of |attribute| for all points of |pc| in a typed
+// array that views the emscripten heap, so the values are written only once.
+// In builds with DRACO_WASM_THREADS the heap is a SharedArrayBuffer and the
+// returned array can be posted to other workers without a copy. The memory
+// must be released with Module._free(array.byteOffset). Returns null on
+// failure.
+Module['Decoder'].prototype.GetAttributeHeapArrayForAllPoints = function(
+    pc, attribute, dataType) {
+  var TypedArray = getTypedArrayConstructor(dataType);
+  if (TypedArray === null) {
+    return null;
+  }
+  var numValues = pc.num_points() * attribute.num_components();
+  var byteLength = numValues * TypedArray.BYTES_PER_ELEMENT;
+  var ptr = Module._malloc(byteLength);
+  if (!this.GetAttributeDataArrayForAllPoints(pc, attribute, dataType,
+                                              byteLength, ptr)) {
+    Module._free(ptr);
+    return null;
+  }
+  // The heap may have grown during the decoding, so the current buffer of the
+  // memory is used instead of a possibly outdated heap view.
+  var heap = typeof wasmMemory !== 'undefined' ? wasmMemory.buffer
+                                                : HEAP8.buffer;
+  return new TypedArray(heap, ptr, numValues);
+};
@@ -15,6 +15,11 @@
 #include "draco/material/material_library.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <unordered_map>
+#include <vector>
+
+#include "draco/core/hash_utils.h"
+
 namespace draco {
 
 void MaterialLibrary::Copy(const MaterialLibrary &src) {
@@ -79,6 +84,84 @@ void MaterialLibrary::RemoveUnusedTextures() {
   }
 }
 
+namespace {
+
+// Returns true when |a| and |b| describe the same image. See
+// MaterialLibrary::DeduplicateTextures() for details.
+bool AreSourceImagesEqual(const SourceImage &a, const SourceImage &b) {
+  if (a.mime_type() != b.mime_type()) {
+    return false;
+  }
+  if (!a.encoded_data().empty() || !b.encoded_data().empty()) {
+    return a.encoded_data() == b.encoded_data();
+  }
+  return a.filename() == b.filename();
+}
+
+}  // namespace
+
+int MaterialLibrary::DeduplicateTextures() {
+  const int num_textures = static_cast<int>(texture_library_.NumTextures());
+
+  // Textures are bucketed by the hash of their images and compared in full
+  // only within a bucket. |unique_index| maps every texture to the first
+  // texture with the same image.
+  std::unordered_map<uint64_t, std::vector<int>> buckets;
+  std::vector<int> unique_index(num_textures);
+  int num_duplicates = 0;
+  for (int i = 0; i < num_textures; ++i) {
+    unique_index[i] = i;
+    const SourceImage &image = texture_library_.GetTexture(i)->source_image();
+    const std::vector<uint8_t> &data = image.encoded_data();
+    if (data.empty() && image.filename().empty()) {
+      continue;
+    }
+    const uint64_t hash = HashMix(
+        data.empty()
+            ? HashBytes(image.filename().data(), image.filename().size(), 1)
+            : HashLargeBytes(data.data(), data.size()),
+        HashBytes(image.mime_type().data(), image.mime_type().size()));
+    std::vector<int> &bucket = buckets[hash];
+    for (const int j : bucket) {
+      if (AreSourceImagesEqual(
+              image, texture_library_.GetTexture(j)->source_image())) {
+        unique_index[i] = j;
+        ++num_duplicates;
+        break;
+      }
+    }
+    if (unique_index[i] == i) {
+      bucket.push_back(i);
+    }
+  }
+  if (num_duplicates == 0) {
+    return 0;
+  }
+
+  // Redirect texture maps to the unique textures.
+  const std::unordered_map<const Texture *, int> texture_to_index =
+      texture_library_.ComputeTextureToIndexMap();
+  for (int mi = 0; mi < materials_.size(); ++mi) {
+    for (int ti = 0; ti < materials_[mi]->NumTextureMaps(); ++ti) {
+      TextureMap *const texture_map = materials_[mi]->GetTextureMapByIndex(ti);
+      const auto it = texture_to_index.find(texture_map->texture());
+      if (it != texture_to_index.end() &&
+          unique_index[it->second] != it->second) {
+        texture_map->SetTexture(
+            texture_library_.GetTexture(unique_index[it->second]));
+      }
+    }
+  }
+
+  // Remove the duplicates from the back to keep the remaining indices valid.
+  for (int i = num_textures - 1; i >= 0; --i) {
+    if (unique_index[i] != i) {
+      texture_library_.RemoveTexture(i);
+    }
+  }
+  return num_duplicates;
+}
+
 std::map<TextureMap *, int>
 MaterialLibrary::ComputeTextureMapToTextureIndexMapping(
     const TextureLibrary &library) const {
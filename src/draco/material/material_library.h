@@ -71,6 +71,14 @@ class MaterialLibrary {
   // texture library.
   void RemoveUnusedTextures();
 
+  // Merges textures with identical source images, i.e. images with the same
+  // mime type and either the same encoded data or, when the data is not
+  // loaded, the same source file. Texture maps of the merged textures are
+  // updated to refer to the first texture with the same image and the other
+  // textures are removed from the texture library. Textures without any image
+  // data are never merged. Returns the number of removed textures.
+  int DeduplicateTextures();
+
   // Returns a map between each TextureMap object and associated texture index
   // in the texture |library|.
   std::map<TextureMap *, int> ComputeTextureMapToTextureIndexMapping(
@@ -127,6 +127,40 @@ TEST(MaterialLibraryTest, RemoveUnusedTextures) {
   ASSERT_EQ(library.GetTextureLibrary().NumTextures(), 0);
 }
 
+TEST(MaterialLibraryTest, DeduplicateTextures) {
+  // Test verifies that textures with identical images are merged and that the
+  // texture maps are updated accordingly.
+  draco::MaterialLibrary library;
+  const std::vector<std::vector<uint8_t>> images = {
+      {1, 2, 3}, {1, 2, 3}, {4, 5, 6}, {}, {1, 2, 3}};
+  for (int i = 0; i < images.size(); ++i) {
+    std::unique_ptr<draco::Texture> texture(new draco::Texture());
+    texture->source_image().MutableEncodedData() = images[i];
+    texture->source_image().set_mime_type("image/png");
+    library.MutableMaterial(i)->SetTextureMap(std::move(texture),
+                                              draco::TextureMap::COLOR, 0);
+  }
+  // Same data but another mime type.
+  library.MutableTextureLibrary()
+      .GetTexture(4)
+      ->source_image()
+      .set_mime_type("image/jpeg");
+  const draco::Texture *const texture_0 =
+      library.GetTextureLibrary().GetTexture(0);
+
+  ASSERT_EQ(library.DeduplicateTextures(), 1);
+  ASSERT_EQ(library.GetTextureLibrary().NumTextures(), 4);
+  ASSERT_EQ(library.GetMaterial(0)->GetTextureMapByIndex(0)->texture(),
+            texture_0);
+  ASSERT_EQ(library.GetMaterial(1)->GetTextureMapByIndex(0)->texture(),
+            texture_0);
+  for (int i = 2; i < images.size(); ++i) {
+    ASSERT_NE(library.GetMaterial(i)->GetTextureMapByIndex(0)->texture(),
+              texture_0);
+  }
+  ASSERT_EQ(library.DeduplicateTextures(), 0);
+}
+
 TEST(MaterialLibraryTest, RemoveMaterial) {
   // Tests that we can safely remove materials from the material library.
   draco::MaterialLibrary library;
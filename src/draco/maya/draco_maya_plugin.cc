@@ -12,95 +12,120 @@
 //
 #include "draco/maya/draco_maya_plugin.h"
 
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+
 #ifdef DRACO_MAYA_PLUGIN
 
+#include "draco/mesh/indexed_mesh_builder.h"
+
 namespace draco {
 namespace maya {
 
-static void decode_faces(std::unique_ptr<draco::Mesh> &drc_mesh,
-                         Drc2PyMesh *out_mesh) {
-  int num_faces = drc_mesh->num_faces();
-  out_mesh->faces = new int[num_faces * 3];
-  out_mesh->faces_num = num_faces;
-  for (int i = 0; i < num_faces; i++) {
-    const draco::Mesh::Face &face = drc_mesh->face(draco::FaceIndex(i));
-    out_mesh->faces[i * 3 + 0] = face[0].value();
-    out_mesh->faces[i * 3 + 1] = face[1].value();
-    out_mesh->faces[i * 3 + 2] = face[2].value();
-  }
+// Copies the point indices of all faces of |drc_mesh| to |out_faces|.
+static void copy_faces(const draco::Mesh &drc_mesh, int *out_faces) {
+  static_assert(sizeof(draco::Mesh::Face) == 3 * sizeof(int),
+                "Unexpected face layout.");
+  if (drc_mesh.num_faces() == 0) return;
+  memcpy(out_faces, drc_mesh.face(draco::FaceIndex(0)).data(),
+         sizeof(draco::Mesh::Face) * drc_mesh.num_faces());
 }
-static void decode_vertices(std::unique_ptr<draco::Mesh> &drc_mesh,
-                            Drc2PyMesh *out_mesh) {
-  const auto pos_att =
-      drc_mesh->GetNamedAttribute(draco::GeometryAttribute::POSITION);
-  if (pos_att == nullptr) {
-    out_mesh->vertices = new float[0];
-    out_mesh->vertices_num = 0;
-    return;
-  }
 
-  int num_vertices = drc_mesh->num_points();
-  out_mesh->vertices = new float[num_vertices * 3];
-  out_mesh->vertices_num = num_vertices;
-  for (int i = 0; i < num_vertices; i++) {
-    draco::PointIndex pi(i);
-    const draco::AttributeValueIndex val_index = pos_att->mapped_index(pi);
-    float out_vertex[3];
-    bool is_ok = pos_att->ConvertValue<float, 3>(val_index, out_vertex);
-    if (!is_ok) return;
-    out_mesh->vertices[i * 3 + 0] = out_vertex[0];
-    out_mesh->vertices[i * 3 + 1] = out_vertex[1];
-    out_mesh->vertices[i * 3 + 2] = out_vertex[2];
+// Copies |num_components_t| float values of |att| for each of the
+// |num_points| points to |out_values|. Values of float attributes with
+// identity mapping are copied at once, other attributes are converted value
+// by value. Returns false when the values cannot be converted.
+template <int num_components_t>
+static bool copy_attribute_values(const draco::PointAttribute &att,
+                                  int num_points, float *out_values) {
+  if (att.is_mapping_identity() && att.data_type() == draco::DT_FLOAT32 &&
+      att.num_components() == num_components_t &&
+      att.byte_stride() == sizeof(float) * num_components_t &&
+      att.size() >= num_points) {
+    if (num_points > 0) {
+      memcpy(out_values, att.GetAddress(draco::AttributeValueIndex(0)),
+             sizeof(float) * num_components_t * num_points);
+    }
+    return true;
   }
+  for (int i = 0; i < num_points; i++) {
+    const draco::AttributeValueIndex val_index =
+        att.mapped_index(draco::PointIndex(i));
+    if (!att.ConvertValue<float, num_components_t>(
+            val_index, out_values + i * num_components_t)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Sets the number of faces, vertices, normals and uvs of |drc_mesh| in
+// |out_mesh| without touching its buffers.
+static void set_mesh_sizes(const draco::Mesh &drc_mesh, Drc2PyMesh *out_mesh) {
+  out_mesh->faces_num = drc_mesh.num_faces();
+  const int num_points = drc_mesh.num_points();
+  out_mesh->vertices_num =
+      drc_mesh.GetNamedAttribute(draco::GeometryAttribute::POSITION)
+          ? num_points
+          : 0;
+  out_mesh->normals_num =
+      drc_mesh.GetNamedAttribute(draco::GeometryAttribute::NORMAL)
+          ? num_points
+          : 0;
+  const auto uv_att =
+      drc_mesh.GetNamedAttribute(draco::GeometryAttribute::TEX_COORD);
+  out_mesh->uvs_num = uv_att ? num_points : 0;
+  out_mesh->uvs_real_num = uv_att ? uv_att->size() : 0;
 }
-static void decode_normals(std::unique_ptr<draco::Mesh> &drc_mesh,
-                           Drc2PyMesh *out_mesh) {
+
+// Copies the faces and attribute values of |drc_mesh| to the buffers of
+// |out_mesh| that must be sized according to set_mesh_sizes(). Buffers that
+// are nullptr are skipped.
+static void copy_mesh(const draco::Mesh &drc_mesh, Drc2PyMesh *out_mesh) {
+  if (out_mesh->faces) {
+    copy_faces(drc_mesh, out_mesh->faces);
+  }
+  const auto pos_att =
+      drc_mesh.GetNamedAttribute(draco::GeometryAttribute::POSITION);
+  if (pos_att && out_mesh->vertices) {
+    copy_attribute_values<3>(*pos_att, out_mesh->vertices_num,
+                             out_mesh->vertices);
+  }
   const auto normal_att =
-      drc_mesh->GetNamedAttribute(draco::GeometryAttribute::NORMAL);
-  if (normal_att == nullptr) {
-    out_mesh->normals = new float[0];
-    out_mesh->normals_num = 0;
-    return;
+      drc_mesh.GetNamedAttribute(draco::GeometryAttribute::NORMAL);
+  if (normal_att && out_mesh->normals) {
+    copy_attribute_values<3>(*normal_att, out_mesh->normals_num,
+                             out_mesh->normals);
   }
-  int num_normals = drc_mesh->num_points();
-  out_mesh->normals = new float[num_normals * 3];
-  out_mesh->normals_num = num_normals;
-
-  for (int i = 0; i < num_normals; i++) {
-    draco::PointIndex pi(i);
-    const draco::AttributeValueIndex val_index = normal_att->mapped_index(pi);
-    float out_normal[3];
-    bool is_ok = normal_att->ConvertValue<float, 3>(val_index, out_normal);
-    if (!is_ok) return;
-    out_mesh->normals[i * 3 + 0] = out_normal[0];
-    out_mesh->normals[i * 3 + 1] = out_normal[1];
-    out_mesh->normals[i * 3 + 2] = out_normal[2];
+  const auto uv_att =
+      drc_mesh.GetNamedAttribute(draco::GeometryAttribute::TEX_COORD);
+  if (uv_att && out_mesh->uvs) {
+    copy_attribute_values<2>(*uv_att, out_mesh->uvs_num, out_mesh->uvs);
   }
 }
-static void decode_uvs(std::unique_ptr<draco::Mesh> &drc_mesh,
-                       Drc2PyMesh *out_mesh) {
-  const auto uv_att =
-      drc_mesh->GetNamedAttribute(draco::GeometryAttribute::TEX_COORD);
-  if (uv_att == nullptr) {
-    out_mesh->uvs = new float[0];
-    out_mesh->uvs_num = 0;
-    out_mesh->uvs_real_num = 0;
-    return;
+
+static DecodeResult decode_mesh(char *data, unsigned int length,
+                                std::unique_ptr<draco::Mesh> *out_mesh) {
+  draco::DecoderBuffer buffer;
+  buffer.Init(data, length);
+  auto type_statusor = draco::Decoder::GetEncodedGeometryType(&buffer);
+  if (!type_statusor.ok()) {
+    return DecodeResult::KO_GEOMETRY_TYPE_INVALID;
+  }
+  const draco::EncodedGeometryType geom_type = type_statusor.value();
+  if (geom_type != draco::TRIANGULAR_MESH) {
+    return DecodeResult::KO_TRIANGULAR_MESH_NOT_FOUND;
   }
-  int num_uvs = drc_mesh->num_points();
-  out_mesh->uvs = new float[num_uvs * 2];
-  out_mesh->uvs_num = num_uvs;
-  out_mesh->uvs_real_num = uv_att->size();
 
-  for (int i = 0; i < num_uvs; i++) {
-    draco::PointIndex pi(i);
-    const draco::AttributeValueIndex val_index = uv_att->mapped_index(pi);
-    float out_uv[2];
-    bool is_ok = uv_att->ConvertValue<float, 2>(val_index, out_uv);
-    if (!is_ok) return;
-    out_mesh->uvs[i * 2 + 0] = out_uv[0];
-    out_mesh->uvs[i * 2 + 1] = out_uv[1];
+  draco::Decoder decoder;
+  auto statusor = decoder.DecodeMeshFromBuffer(&buffer);
+  if (!statusor.ok()) {
+    return DecodeResult::KO_MESH_DECODING;
   }
+  *out_mesh = std::move(statusor).value();
+  return DecodeResult::OK;
 }
 
 void drc2py_free(Drc2PyMesh **mesh_ptr) {
@@ -132,103 +157,123 @@ void drc2py_free(Drc2PyMesh **mesh_ptr) {
 
 DecodeResult drc2py_decode(char *data, unsigned int length,
                            Drc2PyMesh **res_mesh) {
-  draco::DecoderBuffer buffer;
-  buffer.Init(data, length);
-  auto type_statusor = draco::Decoder::GetEncodedGeometryType(&buffer);
-  if (!type_statusor.ok()) {
-    return DecodeResult::KO_GEOMETRY_TYPE_INVALID;
-  }
-  const draco::EncodedGeometryType geom_type = type_statusor.value();
-  if (geom_type != draco::TRIANGULAR_MESH) {
-    return DecodeResult::KO_TRIANGULAR_MESH_NOT_FOUND;
+  std::unique_ptr<draco::Mesh> drc_mesh;
+  const DecodeResult result = decode_mesh(data, length, &drc_mesh);
+  if (result != DecodeResult::OK) {
+    return result;
   }
 
-  draco::Decoder decoder;
-  auto statusor = decoder.DecodeMeshFromBuffer(&buffer);
-  if (!statusor.ok()) {
-    return DecodeResult::KO_MESH_DECODING;
+  *res_mesh = new Drc2PyMesh();
+  set_mesh_sizes(*drc_mesh, *res_mesh);
+  (*res_mesh)->faces = new int[(*res_mesh)->faces_num * 3];
+  (*res_mesh)->vertices = new float[(*res_mesh)->vertices_num * 3];
+  (*res_mesh)->normals = new float[(*res_mesh)->normals_num * 3];
+  (*res_mesh)->uvs = new float[(*res_mesh)->uvs_num * 2];
+  copy_mesh(*drc_mesh, *res_mesh);
+  return DecodeResult::OK;
+}
+
+DecodeResult drc2py_decode_mesh(char *data, unsigned int length,
+                                Drc2PyDecodedMesh **res_decoded_mesh,
+                                Drc2PyMesh *res_sizes) {
+  std::unique_ptr<draco::Mesh> drc_mesh;
+  const DecodeResult result = decode_mesh(data, length, &drc_mesh);
+  if (result != DecodeResult::OK) {
+    return result;
   }
-  std::unique_ptr<draco::Mesh> drc_mesh = std::move(statusor).value();
+  set_mesh_sizes(*drc_mesh, res_sizes);
+  *res_decoded_mesh = new Drc2PyDecodedMesh();
+  (*res_decoded_mesh)->mesh = std::move(drc_mesh);
+  return DecodeResult::OK;
+}
 
-  *res_mesh = new Drc2PyMesh();
-  decode_faces(drc_mesh, *res_mesh);
-  decode_vertices(drc_mesh, *res_mesh);
-  decode_normals(drc_mesh, *res_mesh);
-  decode_uvs(drc_mesh, *res_mesh);
+DecodeResult drc2py_copy_mesh(const Drc2PyDecodedMesh *decoded_mesh,
+                              Drc2PyMesh *out_mesh) {
+  if (!decoded_mesh || !out_mesh) {
+    return DecodeResult::KO_WRONG_INPUT;
+  }
+  Drc2PyMesh sizes;
+  set_mesh_sizes(*decoded_mesh->mesh, &sizes);
+  if (out_mesh->faces_num != sizes.faces_num ||
+      out_mesh->vertices_num != sizes.vertices_num ||
+      out_mesh->normals_num != sizes.normals_num ||
+      out_mesh->uvs_num != sizes.uvs_num) {
+    return DecodeResult::KO_WRONG_INPUT;
+  }
+  copy_mesh(*decoded_mesh->mesh, out_mesh);
   return DecodeResult::OK;
 }
 
-// As encode references see https://github.com/google/draco/issues/116
-EncodeResult drc2py_encode(Drc2PyMesh *in_mesh, char *file_path) {
-  if (in_mesh->faces_num == 0) return EncodeResult::KO_WRONG_INPUT;
-  if (in_mesh->vertices_num == 0) return EncodeResult::KO_WRONG_INPUT;
+void drc2py_free_decoded_mesh(Drc2PyDecodedMesh **decoded_mesh_ptr) {
+  delete *decoded_mesh_ptr;
+  *decoded_mesh_ptr = nullptr;
+}
+
+// Builds a mesh from the buffers of |in_mesh|. Attribute values are copied
+// in bulk for all points at once.
+static EncodeResult build_mesh(const Drc2PyMesh &in_mesh,
+                               std::unique_ptr<draco::Mesh> *out_mesh) {
+  if (in_mesh.faces_num <= 0 || !in_mesh.faces) {
+    return EncodeResult::KO_WRONG_INPUT;
+  }
+  if (in_mesh.vertices_num <= 0 || !in_mesh.vertices) {
+    return EncodeResult::KO_WRONG_INPUT;
+  }
+  // Normals and uvs are optional but there must be one value per vertex.
+  const int num_points = in_mesh.vertices_num;
+  const bool has_normals = in_mesh.normals_num > 0;
+  const bool has_uvs = in_mesh.uvs_num > 0;
+  if ((has_normals && (in_mesh.normals_num < num_points || !in_mesh.normals)) ||
+      (has_uvs && (in_mesh.uvs_num < num_points || !in_mesh.uvs))) {
+    return EncodeResult::KO_WRONG_INPUT;
+  }
   // TODO: Add check to protect against quad faces. At the moment only
   // Triangular faces are supported
 
-  std::unique_ptr<draco::Mesh> drc_mesh(new draco::Mesh());
-
-  // Marshall Faces
-  int num_faces = in_mesh->faces_num;
-  drc_mesh->SetNumFaces(num_faces);
-  for (int i = 0; i < num_faces; ++i) {
+  draco::IndexedMeshBuilder builder;
+  builder.Start(in_mesh.faces_num, num_points);
+  for (int i = 0; i < in_mesh.faces_num; ++i) {
     Mesh::Face face;
-    face[0] = in_mesh->faces[i * 3 + 0];
-    face[1] = in_mesh->faces[i * 3 + 1];
-    face[2] = in_mesh->faces[i * 3 + 2];
-    drc_mesh->SetFace(FaceIndex(i), face);
+    face[0] = in_mesh.faces[i * 3 + 0];
+    face[1] = in_mesh.faces[i * 3 + 1];
+    face[2] = in_mesh.faces[i * 3 + 2];
+    builder.SetFace(FaceIndex(i), face);
   }
-
-  // Marshall Vertices
-  int num_points = in_mesh->vertices_num;
-  drc_mesh->set_num_points(num_points);
-  GeometryAttribute va;
-  va.Init(GeometryAttribute::POSITION, nullptr, 3, DT_FLOAT32, false,
-          sizeof(float) * 3, 0);
-  int pos_att_id = drc_mesh->AddAttribute(va, true, num_points);
-  float point[3];
-  for (int i = 0; i < num_points; ++i) {
-    point[0] = in_mesh->vertices[i * 3 + 0];
-    point[1] = in_mesh->vertices[i * 3 + 1];
-    point[2] = in_mesh->vertices[i * 3 + 2];
-    drc_mesh->attribute(pos_att_id)
-        ->SetAttributeValue(AttributeValueIndex(i), point);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  builder.SetAttributeValuesForAllPoints(pos_att_id, in_mesh.vertices, 0);
+  if (has_normals) {
+    const int norm_att_id =
+        builder.AddAttribute(GeometryAttribute::NORMAL, 3, DT_FLOAT32);
+    builder.SetAttributeValuesForAllPoints(norm_att_id, in_mesh.normals, 0);
   }
-
-  // Marshall Normals
-  int num_normals = in_mesh->normals_num;
-  int norm_att_id;
-  if (num_normals > 0) {
-    GeometryAttribute va;
-    va.Init(GeometryAttribute::NORMAL, nullptr, 3, DT_FLOAT32, false,
-            sizeof(float) * 3, 0);
-    norm_att_id = drc_mesh->AddAttribute(va, true, num_normals);
-
-    float norm[3];
-    for (int i = 0; i < num_normals; ++i) {
-      norm[0] = in_mesh->normals[i * 3 + 0];
-      norm[1] = in_mesh->normals[i * 3 + 1];
-      norm[2] = in_mesh->normals[i * 3 + 2];
-      drc_mesh->attribute(norm_att_id)
-          ->SetAttributeValue(AttributeValueIndex(i), norm);
-    }
+  if (has_uvs) {
+    const int uv_att_id =
+        builder.AddAttribute(GeometryAttribute::TEX_COORD, 2, DT_FLOAT32);
+    builder.SetAttributeValuesForAllPoints(uv_att_id, in_mesh.uvs, 0);
   }
+  // Points are deduplicated by encode_mesh() so that it can run on another
+  // thread.
+  *out_mesh = builder.Finalize(false);
+  if (*out_mesh == nullptr) {
+    // A face references an invalid vertex.
+    return EncodeResult::KO_WRONG_INPUT;
+  }
+  return EncodeResult::OK;
+}
 
-  // Marshall Uvs
-  int num_uvs = in_mesh->uvs_num;
-  int uv_att_id;
-  if (num_uvs > 0) {
-    GeometryAttribute va;
-    va.Init(GeometryAttribute::TEX_COORD, nullptr, 2, DT_FLOAT32, false,
-            sizeof(float) * 2, 0);
-    uv_att_id = drc_mesh->AddAttribute(va, true, num_uvs);
-    float uv[3];
-    for (int i = 0; i < num_uvs; ++i) {
-      uv[0] = in_mesh->uvs[i * 2 + 0];
-      uv[1] = in_mesh->uvs[i * 2 + 1];
-      drc_mesh->attribute(uv_att_id)->SetAttributeValue(AttributeValueIndex(i),
-                                                        uv);
+// Deduplicates |drc_mesh|, encodes it and writes it to |file_path|. Progress
+// is reported to |progress_callback| when it is not nullptr.
+static EncodeResult encode_mesh(draco::Mesh *drc_mesh,
+                                const std::string &file_path,
+                                Drc2PyProgressCallback progress_callback,
+                                void *user_data) {
+  const auto report_progress = [&](float progress) {
+    if (progress_callback) {
+      progress_callback(progress, user_data);
     }
-  }
+  };
+  report_progress(0.f);
 
 // Deduplicate Attributes and Points
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
@@ -237,6 +282,7 @@ EncodeResult drc2py_encode(Drc2PyMesh *in_mesh, char *file_path) {
 #ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
   drc_mesh->DeduplicatePointIds();
 #endif
+  report_progress(0.2f);
 
   // Encode Mesh
   draco::Encoder encoder;  // Use default encode settings (See draco_encoder.cc
@@ -247,17 +293,80 @@ EncodeResult drc2py_encode(Drc2PyMesh *in_mesh, char *file_path) {
     // Use status.error_msg() to check the error
     return EncodeResult::KO_MESH_ENCODING;
   }
+  report_progress(0.9f);
 
   // Save to file
-  std::string file = file_path;
-  std::ofstream out_file(file, std::ios::binary);
+  std::ofstream out_file(file_path, std::ios::binary);
   if (!out_file) {
     return EncodeResult::KO_FILE_CREATION;
   }
   out_file.write(buffer.data(), buffer.size());
+  report_progress(1.f);
+  return EncodeResult::OK;
+}
+
+// As encode references see https://github.com/google/draco/issues/116
+EncodeResult drc2py_encode(Drc2PyMesh *in_mesh, char *file_path) {
+  if (!in_mesh || !file_path) return EncodeResult::KO_WRONG_INPUT;
+  std::unique_ptr<draco::Mesh> drc_mesh;
+  const EncodeResult result = build_mesh(*in_mesh, &drc_mesh);
+  if (result != EncodeResult::OK) {
+    return result;
+  }
+  return encode_mesh(drc_mesh.get(), file_path, nullptr, nullptr);
+}
+
+struct Drc2PyEncodeTask {
+  std::unique_ptr<draco::Mesh> mesh;
+  std::thread thread;
+  std::atomic<bool> done{false};
+  EncodeResult result = EncodeResult::OK;
+};
+
+EncodeResult drc2py_encode_async(Drc2PyMesh *in_mesh, char *file_path,
+                                 Drc2PyProgressCallback progress_callback,
+                                 void *user_data,
+                                 Drc2PyEncodeTask **res_task) {
+  if (!in_mesh || !file_path || !res_task) {
+    return EncodeResult::KO_WRONG_INPUT;
+  }
+  std::unique_ptr<Drc2PyEncodeTask> task(new Drc2PyEncodeTask());
+  const EncodeResult result = build_mesh(*in_mesh, &task->mesh);
+  if (result != EncodeResult::OK) {
+    return result;
+  }
+  Drc2PyEncodeTask *const task_ptr = task.get();
+  task->thread = std::thread([task_ptr, progress_callback, user_data,
+                              path = std::string(file_path)]() {
+    task_ptr->result = encode_mesh(task_ptr->mesh.get(), path,
+                                   progress_callback, user_data);
+    // The encoded mesh is not needed anymore.
+    task_ptr->mesh.reset();
+    task_ptr->done.store(true, std::memory_order_release);
+  });
+  *res_task = task.release();
   return EncodeResult::OK;
 }
 
+int drc2py_encode_task_done(const Drc2PyEncodeTask *task) {
+  return task && task->done.load(std::memory_order_acquire) ? 1 : 0;
+}
+
+EncodeResult drc2py_encode_task_wait(Drc2PyEncodeTask *task) {
+  if (!task) return EncodeResult::KO_WRONG_INPUT;
+  if (task->thread.joinable()) {
+    task->thread.join();
+  }
+  return task->result;
+}
+
+void drc2py_free_encode_task(Drc2PyEncodeTask **task_ptr) {
+  if (!*task_ptr) return;
+  drc2py_encode_task_wait(*task_ptr);
+  delete *task_ptr;
+  *task_ptr = nullptr;
+}
+
 }  // namespace maya
 
 }  // namespace draco
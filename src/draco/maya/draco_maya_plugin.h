@@ -14,6 +14,7 @@
 #define DRACO_MAYA_DRACO_MAYA_PLUGIN_H_
 
 #include <fstream>
+#include <memory>
 
 #include "draco/compression/decode.h"
 #include "draco/compression/encode.h"
@@ -41,7 +42,8 @@ enum class DecodeResult {
   OK = 0,
   KO_GEOMETRY_TYPE_INVALID = -1,
   KO_TRIANGULAR_MESH_NOT_FOUND = -2,
-  KO_MESH_DECODING = -3
+  KO_MESH_DECODING = -3,
+  KO_WRONG_INPUT = -4
 };
 
 extern "C" {
@@ -67,10 +69,55 @@ struct EXPORT_API Drc2PyMesh {
   float *uvs;
 };
 
+// Mesh decoded by drc2py_decode_mesh() that is copied to caller-supplied
+// buffers with drc2py_copy_mesh().
+struct EXPORT_API Drc2PyDecodedMesh {
+  std::unique_ptr<draco::Mesh> mesh;
+};
+
 EXPORT_API DecodeResult drc2py_decode(char *data, unsigned int length,
                                       Drc2PyMesh **res_mesh);
 EXPORT_API void drc2py_free(Drc2PyMesh **res_mesh);
+
+// Decodes a mesh without copying its data, which avoids the allocations of
+// drc2py_decode() for large meshes. The number of faces, vertices, normals and
+// uvs is returned in |res_sizes|, its buffers are left untouched. The decoded
+// mesh must be released with drc2py_free_decoded_mesh().
+EXPORT_API DecodeResult drc2py_decode_mesh(char *data, unsigned int length,
+                                           Drc2PyDecodedMesh **res_decoded_mesh,
+                                           Drc2PyMesh *res_sizes);
+// Copies the decoded mesh to the buffers of |out_mesh| that are owned by the
+// caller. The sizes of |out_mesh| must match the sizes returned by
+// drc2py_decode_mesh(). Buffers that are nullptr are skipped.
+EXPORT_API DecodeResult drc2py_copy_mesh(const Drc2PyDecodedMesh *decoded_mesh,
+                                         Drc2PyMesh *out_mesh);
+EXPORT_API void drc2py_free_decoded_mesh(Drc2PyDecodedMesh **decoded_mesh);
 EXPORT_API EncodeResult drc2py_encode(Drc2PyMesh *in_mesh, char *file_path);
+
+// Called by the encoding thread of drc2py_encode_async() with the fraction of
+// the work done so far in |progress| (0 to 1) and the |user_data| passed to
+// drc2py_encode_async().
+typedef void (*Drc2PyProgressCallback)(float progress, void *user_data);
+
+// Encoding started by drc2py_encode_async().
+struct Drc2PyEncodeTask;
+
+// Same as drc2py_encode() but the mesh is deduplicated, encoded and written to
+// |file_path| on a background thread so that the caller is not blocked. The
+// buffers of |in_mesh| are copied before the function returns and they can be
+// released right away. |progress_callback| can be nullptr. On success, the
+// started task is returned in |res_task| and it must be released with
+// drc2py_free_encode_task().
+EXPORT_API EncodeResult drc2py_encode_async(
+    Drc2PyMesh *in_mesh, char *file_path,
+    Drc2PyProgressCallback progress_callback, void *user_data,
+    Drc2PyEncodeTask **res_task);
+// Returns 1 when the encoding of |task| has finished and 0 otherwise.
+EXPORT_API int drc2py_encode_task_done(const Drc2PyEncodeTask *task);
+// Waits until the encoding of |task| has finished and returns its result.
+EXPORT_API EncodeResult drc2py_encode_task_wait(Drc2PyEncodeTask *task);
+// Waits for the encoding to finish and releases the task.
+EXPORT_API void drc2py_free_encode_task(Drc2PyEncodeTask **task);
 }  // extern "C"
 
 }  // namespace maya
@@ -14,8 +14,10 @@
 //
 #include "draco/mesh/corner_table.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "draco/attributes/geometry_indices.h"
 #include "draco/mesh/corner_table_iterators.h"
@@ -26,20 +28,32 @@ CornerTable::CornerTable()
     : num_original_vertices_(0),
       num_degenerated_faces_(0),
       num_isolated_vertices_(0),
-      valence_cache_(*this) {}
+      valence_cache_(*this),
+      vertex_ring_cache_(*this) {}
 
 std::unique_ptr<CornerTable> CornerTable::Create(
     const IndexTypeVector<FaceIndex, FaceType> &faces) {
+  return Create(faces, nullptr);
+}
+
+std::unique_ptr<CornerTable> CornerTable::Create(
+    const IndexTypeVector<FaceIndex, FaceType> &faces, ThreadPool *pool) {
   std::unique_ptr<CornerTable> ct(new CornerTable());
-  if (!ct->Init(faces)) {
+  if (!ct->Init(faces, pool)) {
     return nullptr;
   }
   return ct;
 }
 
 bool CornerTable::Init(const IndexTypeVector<FaceIndex, FaceType> &faces) {
+  return Init(faces, nullptr);
+}
+
+bool CornerTable::Init(const IndexTypeVector<FaceIndex, FaceType> &faces,
+                       ThreadPool *pool) {
   valence_cache_.ClearValenceCache();
   valence_cache_.ClearValenceCacheInaccurate();
+  vertex_ring_cache_.ClearVertexRingCache();
   corner_to_vertex_map_.resize(faces.size() * 3);
   for (FaceIndex fi(0); fi < static_cast<uint32_t>(faces.size()); ++fi) {
     for (int i = 0; i < 3; ++i) {
@@ -47,7 +61,11 @@ bool CornerTable::Init(const IndexTypeVector<FaceIndex, FaceType> &faces) {
     }
   }
   int num_vertices = -1;
-  if (!ComputeOppositeCorners(&num_vertices)) {
+  if (pool != nullptr && pool->num_threads() > 0) {
+    if (!ComputeOppositeCornersParallel(pool, &num_vertices)) {
+      return false;
+    }
+  } else if (!ComputeOppositeCorners(&num_vertices)) {
     return false;
   }
   if (!BreakNonManifoldEdges()) {
@@ -74,9 +92,15 @@ bool CornerTable::Reset(int num_faces, int num_vertices) {
   }
   corner_to_vertex_map_.assign(num_faces_unsigned * 3, kInvalidVertexIndex);
   opposite_corners_.assign(num_faces_unsigned * 3, kInvalidCornerIndex);
+  vertex_corners_.clear();
   vertex_corners_.reserve(num_vertices);
+  non_manifold_vertex_parents_.clear();
+  num_original_vertices_ = 0;
+  num_degenerated_faces_ = 0;
+  num_isolated_vertices_ = 0;
   valence_cache_.ClearValenceCache();
   valence_cache_.ClearValenceCacheInaccurate();
+  vertex_ring_cache_.ClearVertexRingCache();
   return true;
 }
 
@@ -209,6 +233,185 @@ bool CornerTable::ComputeOppositeCorners(int *num_vertices) {
   return true;
 }
 
+bool CornerTable::ComputeOppositeCornersParallel(ThreadPool *pool,
+                                                 int *num_vertices) {
+  DRACO_DCHECK(GetValenceCache().IsCacheEmpty());
+  if (num_vertices == nullptr) {
+    return false;
+  }
+  const int num_faces = this->num_faces();
+  opposite_corners_.resize(num_corners(), kInvalidCornerIndex);
+
+  // Two half-edges can be opposite only when they connect the same pair of
+  // vertices. Instead of storing the half-edges on their source vertices as in
+  // ComputeOppositeCorners(), each half-edge is stored on the vertex with the
+  // lower index. Vertices are then split into ranges that are processed
+  // independently. Half-edges of each range are visited in the order of their
+  // corners, which reproduces the matching of the sequential version.
+  const int num_tasks = 4 * (pool->num_threads() + 1);
+  const int faces_per_task = (num_faces + num_tasks - 1) / num_tasks;
+  const auto is_degenerated = [this](FaceIndex f) {
+    const CornerIndex c = FirstCorner(f);
+    const VertexIndex v0 = Vertex(c);
+    const VertexIndex v1 = Vertex(c + 1);
+    const VertexIndex v2 = Vertex(c + 2);
+    return v0 == v1 || v0 == v2 || v1 == v2;
+  };
+
+  // Find the number of vertices and count the degenerated faces.
+  std::vector<int> task_num_vertices(num_tasks, 0);
+  std::vector<int> task_num_degenerated_faces(num_tasks, 0);
+  ParallelFor(pool, num_tasks, [&](int task) {
+    const int begin = std::min(num_faces, task * faces_per_task);
+    const int end = std::min(num_faces, begin + faces_per_task);
+    for (CornerIndex c(3 * begin); c < 3 * end; ++c) {
+      task_num_vertices[task] = std::max(
+          task_num_vertices[task], static_cast<int>(Vertex(c).value() + 1));
+    }
+    for (int fi = begin; fi < end; ++fi) {
+      if (is_degenerated(FaceIndex(fi))) {
+        ++task_num_degenerated_faces[task];
+      }
+    }
+  });
+  *num_vertices = 0;
+  for (int task = 0; task < num_tasks; ++task) {
+    num_degenerated_faces_ += task_num_degenerated_faces[task];
+    *num_vertices = std::max(*num_vertices, task_num_vertices[task]);
+  }
+  const int num_ranges = num_tasks;
+  const int vertices_per_range =
+      std::max(1, (*num_vertices + num_ranges - 1) / num_ranges);
+  const auto get_range = [this, vertices_per_range](CornerIndex c) {
+    const VertexIndex v0 = Vertex(Next(c));
+    const VertexIndex v1 = Vertex(Previous(c));
+    return static_cast<int>(std::min(v0, v1).value()) / vertices_per_range;
+  };
+
+  // Count the half-edges of each task that belong to each vertex range and
+  // convert the counts to offsets. Half-edges of each range are stored
+  // consecutively, ordered by task so that they remain sorted by corner.
+  std::vector<int> range_offsets(num_tasks * num_ranges, 0);
+  ParallelFor(pool, num_tasks, [&](int task) {
+    const int begin = std::min(num_faces, task * faces_per_task);
+    const int end = std::min(num_faces, begin + faces_per_task);
+    int *const counts = &range_offsets[task * num_ranges];
+    for (int fi = begin; fi < end; ++fi) {
+      if (is_degenerated(FaceIndex(fi))) {
+        continue;
+      }
+      for (int i = 0; i < 3; ++i) {
+        ++counts[get_range(CornerIndex(3 * fi + i))];
+      }
+    }
+  });
+  std::vector<int> range_begin(num_ranges + 1, 0);
+  int offset = 0;
+  for (int range = 0; range < num_ranges; ++range) {
+    range_begin[range] = offset;
+    for (int task = 0; task < num_tasks; ++task) {
+      const int count = range_offsets[task * num_ranges + range];
+      range_offsets[task * num_ranges + range] = offset;
+      offset += count;
+    }
+  }
+  range_begin[num_ranges] = offset;
+  std::vector<CornerIndex> half_edges(offset);
+  ParallelFor(pool, num_tasks, [&](int task) {
+    const int begin = std::min(num_faces, task * faces_per_task);
+    const int end = std::min(num_faces, begin + faces_per_task);
+    int *const offsets = &range_offsets[task * num_ranges];
+    for (int fi = begin; fi < end; ++fi) {
+      if (is_degenerated(FaceIndex(fi))) {
+        continue;
+      }
+      for (int i = 0; i < 3; ++i) {
+        const CornerIndex c(3 * fi + i);
+        half_edges[offsets[get_range(c)]++] = c;
+      }
+    }
+  });
+
+  // Storage for the unmatched half-edges of each vertex, see
+  // ComputeOppositeCorners(). Each vertex range uses the same part of the
+  // storage as its half-edges, so the ranges can be processed concurrently.
+  struct VertexEdgePair {
+    VertexEdgePair()
+        : other_vert(kInvalidVertexIndex),
+          source_vert(kInvalidVertexIndex),
+          edge_corner(kInvalidCornerIndex) {}
+    VertexIndex other_vert;
+    VertexIndex source_vert;
+    CornerIndex edge_corner;
+  };
+  std::vector<VertexEdgePair> vertex_edges(offset);
+  std::vector<int> num_corners_on_vertices(*num_vertices, 0);
+  std::vector<int> vertex_offset(*num_vertices, 0);
+  ParallelFor(pool, num_ranges, [&](int range) {
+    const int first_vert = std::min(*num_vertices, range * vertices_per_range);
+    const int last_vert =
+        std::min(*num_vertices, first_vert + vertices_per_range);
+    for (int i = range_begin[range]; i < range_begin[range + 1]; ++i) {
+      const CornerIndex c = half_edges[i];
+      ++num_corners_on_vertices[std::min(Vertex(Next(c)), Vertex(Previous(c)))
+                                    .value()];
+    }
+    int vert_offset = range_begin[range];
+    for (int v = first_vert; v < last_vert; ++v) {
+      vertex_offset[v] = vert_offset;
+      vert_offset += num_corners_on_vertices[v];
+    }
+
+    for (int i = range_begin[range]; i < range_begin[range + 1]; ++i) {
+      const CornerIndex c = half_edges[i];
+      const VertexIndex tip_v = Vertex(c);
+      const VertexIndex source_v = Vertex(Next(c));
+      const VertexIndex sink_v = Vertex(Previous(c));
+      const VertexIndex min_v = std::min(source_v, sink_v);
+      const VertexIndex max_v = std::max(source_v, sink_v);
+
+      CornerIndex opposite_c(kInvalidCornerIndex);
+      const int num_corners_on_vert = num_corners_on_vertices[min_v.value()];
+      int edge_offset = vertex_offset[min_v.value()];
+      int j = 0;
+      for (; j < num_corners_on_vert; ++j, ++edge_offset) {
+        const VertexEdgePair &pair = vertex_edges[edge_offset];
+        if (pair.other_vert == kInvalidVertexIndex) {
+          break;  // No matching half-edge found.
+        }
+        if (pair.other_vert != max_v || pair.source_vert != sink_v) {
+          continue;  // Different edge or a half-edge in the same direction.
+        }
+        if (tip_v == Vertex(pair.edge_corner)) {
+          continue;  // Don't connect mirrored faces.
+        }
+        opposite_c = pair.edge_corner;
+        // Remove the half-edge while preserving the order of the remaining
+        // ones.
+        for (++j; j < num_corners_on_vert; ++j, ++edge_offset) {
+          vertex_edges[edge_offset] = vertex_edges[edge_offset + 1];
+          if (vertex_edges[edge_offset].other_vert == kInvalidVertexIndex) {
+            break;
+          }
+        }
+        vertex_edges[edge_offset].other_vert = kInvalidVertexIndex;
+        break;
+      }
+      if (opposite_c == kInvalidCornerIndex) {
+        // No opposite corner found. |edge_offset| points to the first unused
+        // slot.
+        vertex_edges[edge_offset].other_vert = max_v;
+        vertex_edges[edge_offset].source_vert = source_v;
+        vertex_edges[edge_offset].edge_corner = c;
+      } else {
+        opposite_corners_[c] = opposite_c;
+        opposite_corners_[opposite_c] = c;
+      }
+    }
+  });
+  return true;
+}
+
 bool CornerTable::BreakNonManifoldEdges() {
   // This function detects and breaks non-manifold edges that are caused by
   // folds in 1-ring neighborhood around a vertex. Non-manifold edges can occur
@@ -398,6 +601,13 @@ bool CornerTable::ComputeVertexCorners(int num_vertices) {
   return true;
 }
 
+size_t CornerTable::memory_usage() const {
+  return corner_to_vertex_map_.capacity() * sizeof(VertexIndex) +
+         opposite_corners_.capacity() * sizeof(CornerIndex) +
+         vertex_corners_.capacity() * sizeof(CornerIndex) +
+         non_manifold_vertex_parents_.capacity() * sizeof(VertexIndex);
+}
+
 bool CornerTable::IsDegenerated(FaceIndex face) const {
   if (face == kInvalidFaceIndex) {
     return true;
@@ -21,8 +21,10 @@
 #include "draco/attributes/geometry_indices.h"
 #include "draco/core/draco_index_type_vector.h"
 #include "draco/core/macros.h"
+#include "draco/core/thread_pool.h"
 #include "draco/draco_features.h"
 #include "draco/mesh/valence_cache.h"
+#include "draco/mesh/vertex_ring_cache.h"
 
 namespace draco {
 
@@ -58,11 +60,19 @@ class CornerTable {
   CornerTable();
   static std::unique_ptr<CornerTable> Create(
       const IndexTypeVector<FaceIndex, FaceType> &faces);
+  // Same as above but the opposite corners are computed in parallel using
+  // |pool|. The resulting corner table is identical to the one created
+  // without the pool. |pool| can be nullptr.
+  static std::unique_ptr<CornerTable> Create(
+      const IndexTypeVector<FaceIndex, FaceType> &faces, ThreadPool *pool);
 
   // Initializes the CornerTable from provides set of indexed faces.
   // The input faces can represent a non-manifold topology, in which case the
   // non-manifold edges and vertices are going to be split.
   bool Init(const IndexTypeVector<FaceIndex, FaceType> &faces);
+  // Same as above but uses |pool| to parallelize the computation.
+  bool Init(const IndexTypeVector<FaceIndex, FaceType> &faces,
+            ThreadPool *pool);
 
   // Resets the corner table to the given number of invalid faces.
   bool Reset(int num_faces);
@@ -241,6 +251,10 @@ class CornerTable {
 
   bool IsDegenerated(FaceIndex face) const;
 
+  // Returns the number of bytes allocated by the connectivity maps of the
+  // table. Memory of the valence and vertex ring caches is not included.
+  size_t memory_usage() const;
+
   // Methods that modify an existing corner table.
   // Sets the opposite corner mapping between two corners. Caller must ensure
   // that the indices are valid.
@@ -360,11 +374,24 @@ class CornerTable {
     return valence_cache_;
   }
 
+  // Allows access to an internal object for caching the corners around all
+  // vertices. Same as with the valence cache, the cache must be discarded when
+  // the table is modified.
+  const draco::VertexRingCache<CornerTable> &GetVertexRingCache() const {
+    return vertex_ring_cache_;
+  }
+
  private:
   // Computes opposite corners mapping from the data stored in
   // |corner_to_vertex_map_|.
   bool ComputeOppositeCorners(int *num_vertices);
 
+  // Same as ComputeOppositeCorners() but the work is distributed over |pool|.
+  // Half-edges are partitioned by the lower index of their two vertices so
+  // that each partition can be matched independently. The result is the same
+  // as the result of the sequential version.
+  bool ComputeOppositeCornersParallel(ThreadPool *pool, int *num_vertices);
+
   // Finds and breaks non-manifold edges in the 1-ring neighborhood around
   // vertices (vertices themselves will be split in the ComputeVertexCorners()
   // function if necessary).
@@ -386,6 +413,7 @@ class CornerTable {
   IndexTypeVector<VertexIndex, VertexIndex> non_manifold_vertex_parents_;
 
   draco::ValenceCache<CornerTable> valence_cache_;
+  draco::VertexRingCache<CornerTable> vertex_ring_cache_;
 };
 
 // A special case to denote an invalid corner table triangle.
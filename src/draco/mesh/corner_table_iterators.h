@@ -304,6 +304,59 @@ class VertexCornersIterator {
   bool left_traversal_;
 };
 
+// Maximum number of corners passed at once to the visitors of
+// VisitVertexCornerBatches() and VisitVertexCornerBatchesSwingRight().
+constexpr int kMaxVertexCornersBatchSize = 32;
+
+// Gathers the corners attached to the vertex of |start| into a small fixed
+// buffer in one pass over the ring and calls |visit(corners, num_corners)| for
+// each batch of at most kMaxVertexCornersBatchSize corners, i.e., once for
+// all but very high valence vertices. The corners are passed in the same order
+// in which VertexCornersIterator visits them. Unlike with the iterator, the
+// visitor can look up the data of all corners of a batch before processing
+// any of them, so that the lookups of different corners overlap instead of
+// waiting for each other. The rings cached by the vertex ring cache of the
+// table are used when available.
+template <class CornerTableT, class BatchVisitorT>
+void VisitVertexCornerBatches(const CornerTableT *table, CornerIndex start,
+                              BatchVisitorT visit) {
+  CornerIndex batch[kMaxVertexCornersBatchSize];
+  int batch_size = 0;
+  table->GetVertexRingCache().VisitCorners(start, [&](CornerIndex c) {
+    batch[batch_size++] = c;
+    if (batch_size == kMaxVertexCornersBatchSize) {
+      visit(static_cast<const CornerIndex *>(batch), batch_size);
+      batch_size = 0;
+    }
+    return true;
+  });
+  if (batch_size > 0) {
+    visit(static_cast<const CornerIndex *>(batch), batch_size);
+  }
+}
+
+// Same as VisitVertexCornerBatches() but only the corners visited by swinging
+// right from |start| are gathered, see
+// VertexRingCache::VisitCornersSwingRight().
+template <class CornerTableT, class BatchVisitorT>
+void VisitVertexCornerBatchesSwingRight(const CornerTableT *table,
+                                        CornerIndex start,
+                                        BatchVisitorT visit) {
+  CornerIndex batch[kMaxVertexCornersBatchSize];
+  int batch_size = 0;
+  table->GetVertexRingCache().VisitCornersSwingRight(start, [&](CornerIndex c) {
+    batch[batch_size++] = c;
+    if (batch_size == kMaxVertexCornersBatchSize) {
+      visit(static_cast<const CornerIndex *>(batch), batch_size);
+      batch_size = 0;
+    }
+    return true;
+  });
+  if (batch_size > 0) {
+    visit(static_cast<const CornerIndex *>(batch), batch_size);
+  }
+}
+
 }  // namespace draco
 
 #endif  // DRACO_MESH_CORNER_TABLE_ITERATORS_H_
@@ -1,8 +1,13 @@
 #include "draco/mesh/corner_table.h"
 
+#include <algorithm>
 #include <memory>
+#include <random>
+#include <string>
+#include <vector>
 
 #include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
 #include "draco/io/obj_decoder.h"
 #include "draco/mesh/mesh_connected_components.h"
 #include "draco/mesh/mesh_misc_functions.h"
@@ -98,6 +103,138 @@ TEST_F(CornerTableTest, TestNonManifoldEdges) {
   ASSERT_EQ(connected_components.NumConnectedComponents(), 2);
 }
 
+// Returns the sorted elements of all components of |components| retrieved with
+// |num_elements| and |get_element|.
+template <class NumElementsT, class GetElementT>
+std::vector<std::vector<int>> GetSortedComponentElements(
+    const MeshConnectedComponents &components, NumElementsT num_elements,
+    GetElementT get_element) {
+  std::vector<std::vector<int>> elements(components.NumConnectedComponents());
+  for (int i = 0; i < components.NumConnectedComponents(); ++i) {
+    for (int j = 0; j < (components.*num_elements)(i); ++j) {
+      elements[i].push_back((components.*get_element)(i, j));
+    }
+    std::sort(elements[i].begin(), elements[i].end());
+  }
+  return elements;
+}
+
+// Verifies that the parallel union-find search of connected components finds
+// the same components as the traversal of the mesh.
+void TestParallelConnectedComponents(const std::string &file_name) {
+  std::unique_ptr<Mesh> mesh = draco::ReadMeshFromTestFile(file_name);
+  ASSERT_NE(mesh, nullptr);
+  std::unique_ptr<CornerTable> ct =
+      draco::CreateCornerTableFromPositionAttribute(mesh.get());
+  ASSERT_NE(ct, nullptr);
+
+  MeshConnectedComponents expected;
+  expected.FindConnectedComponents(ct.get());
+  for (const bool use_pool : {false, true}) {
+    ThreadPool pool(3);
+    MeshConnectedComponents components;
+    components.FindConnectedComponents(ct.get(), use_pool ? &pool : nullptr);
+    ASSERT_EQ(components.NumConnectedComponents(),
+              expected.NumConnectedComponents());
+    for (VertexIndex vi(0); vi < ct->num_vertices(); ++vi) {
+      ASSERT_EQ(components.GetConnectedComponentIdAtVertex(vi.value()),
+                expected.GetConnectedComponentIdAtVertex(vi.value()));
+    }
+    for (FaceIndex fi(0); fi < ct->num_faces(); ++fi) {
+      ASSERT_EQ(components.GetConnectedComponentIdAtFace(fi.value()),
+                expected.GetConnectedComponentIdAtFace(fi.value()));
+    }
+    ASSERT_EQ(GetSortedComponentElements(
+                  components,
+                  &MeshConnectedComponents::NumConnectedComponentVertices,
+                  &MeshConnectedComponents::GetConnectedComponentVertex),
+              GetSortedComponentElements(
+                  expected,
+                  &MeshConnectedComponents::NumConnectedComponentVertices,
+                  &MeshConnectedComponents::GetConnectedComponentVertex));
+    ASSERT_EQ(GetSortedComponentElements(
+                  components,
+                  &MeshConnectedComponents::NumConnectedComponentFaces,
+                  &MeshConnectedComponents::GetConnectedComponentFace),
+              GetSortedComponentElements(
+                  expected,
+                  &MeshConnectedComponents::NumConnectedComponentFaces,
+                  &MeshConnectedComponents::GetConnectedComponentFace));
+    ASSERT_EQ(
+        GetSortedComponentElements(
+            components,
+            &MeshConnectedComponents::NumConnectedComponentBoundaryEdges,
+            &MeshConnectedComponents::GetConnectedComponentBoundaryEdge),
+        GetSortedComponentElements(
+            expected,
+            &MeshConnectedComponents::NumConnectedComponentBoundaryEdges,
+            &MeshConnectedComponents::GetConnectedComponentBoundaryEdge));
+  }
+}
+
+TEST_F(CornerTableTest, TestParallelConnectedComponents) {
+  TestParallelConnectedComponents("cube_att.obj");
+  TestParallelConnectedComponents("non_manifold_wrap.obj");
+  TestParallelConnectedComponents("degenerate_mesh.obj");
+  TestParallelConnectedComponents("bunny_norm.obj");
+}
+
+// Verifies that corner tables built with and without a thread pool from
+// |faces| are identical.
+void TestParallelInit(
+    const IndexTypeVector<FaceIndex, CornerTable::FaceType> &faces) {
+  ThreadPool pool(3);
+  std::unique_ptr<CornerTable> expected = CornerTable::Create(faces);
+  std::unique_ptr<CornerTable> ct = CornerTable::Create(faces, &pool);
+  ASSERT_NE(expected, nullptr);
+  ASSERT_NE(ct, nullptr);
+  ASSERT_EQ(ct->num_corners(), expected->num_corners());
+  ASSERT_EQ(ct->num_vertices(), expected->num_vertices());
+  ASSERT_EQ(ct->NumOriginalVertices(), expected->NumOriginalVertices());
+  ASSERT_EQ(ct->NumDegeneratedFaces(), expected->NumDegeneratedFaces());
+  ASSERT_EQ(ct->NumIsolatedVertices(), expected->NumIsolatedVertices());
+  for (CornerIndex ci(0); ci < ct->num_corners(); ++ci) {
+    ASSERT_EQ(ct->Vertex(ci), expected->Vertex(ci));
+    ASSERT_EQ(ct->Opposite(ci), expected->Opposite(ci));
+  }
+  for (VertexIndex vi(0); vi < ct->num_vertices(); ++vi) {
+    ASSERT_EQ(ct->LeftMostCorner(vi), expected->LeftMostCorner(vi));
+    ASSERT_EQ(ct->VertexParent(vi), expected->VertexParent(vi));
+  }
+}
+
+TEST_F(CornerTableTest, TestParallelInit) {
+  for (const std::string file_name :
+       {"cube_att.obj", "non_manifold_wrap.obj", "degenerate_mesh.obj",
+        "bunny_norm.obj"}) {
+    std::unique_ptr<Mesh> mesh = DecodeObj(file_name);
+    ASSERT_NE(mesh, nullptr) << "Failed to load test model " << file_name;
+    IndexTypeVector<FaceIndex, CornerTable::FaceType> faces(mesh->num_faces());
+    for (FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+      const PointAttribute *const pos =
+          mesh->GetNamedAttribute(GeometryAttribute::POSITION);
+      for (int c = 0; c < 3; ++c) {
+        faces[fi][c] = pos->mapped_index(mesh->face(fi)[c]).value();
+      }
+    }
+    TestParallelInit(faces);
+  }
+}
+
+TEST_F(CornerTableTest, TestParallelInitRandomFaces) {
+  // Random faces over a small number of vertices contain many non-manifold
+  // edges, mirrored and degenerate faces.
+  std::mt19937 generator(17);
+  std::uniform_int_distribution<uint32_t> vertex(0, 15);
+  IndexTypeVector<FaceIndex, CornerTable::FaceType> faces(2000);
+  for (FaceIndex fi(0); fi < faces.size(); ++fi) {
+    for (int c = 0; c < 3; ++c) {
+      faces[fi][c] = VertexIndex(vertex(generator));
+    }
+  }
+  TestParallelInit(faces);
+}
+
 TEST_F(CornerTableTest, TestNewFace) {
   // Tests that we can add a new face to the corner table.
   const std::string file_name = "cube_att.obj";
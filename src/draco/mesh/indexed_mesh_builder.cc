@@ -0,0 +1,133 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/indexed_mesh_builder.h"
+
+#include <string>
+#include <vector>
+
+#include "draco/mesh/mesh_cleanup.h"
+
+namespace draco {
+
+void IndexedMeshBuilder::Start(int num_faces,
+                               PointIndex::ValueType num_points) {
+  mesh_ = std::unique_ptr<Mesh>(new Mesh());
+  mesh_->SetNumFaces(num_faces);
+  mesh_->set_num_points(num_points);
+}
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+void IndexedMeshBuilder::SetName(const std::string &name) {
+  mesh_->SetName(name);
+}
+#endif  // DRACO_TRANSCODER_SUPPORTED
+
+int IndexedMeshBuilder::AddAttribute(GeometryAttribute::Type attribute_type,
+                                     int8_t num_components,
+                                     DataType data_type) {
+  return AddAttribute(attribute_type, num_components, data_type, false);
+}
+
+int IndexedMeshBuilder::AddAttribute(GeometryAttribute::Type attribute_type,
+                                     int8_t num_components, DataType data_type,
+                                     bool normalized) {
+  GeometryAttribute ga;
+  ga.Init(attribute_type, nullptr, num_components, data_type, normalized,
+          DataTypeLength(data_type) * num_components, 0);
+  return mesh_->AddAttribute(ga, true, mesh_->num_points());
+}
+
+void IndexedMeshBuilder::SetAttributeValueForPoint(
+    int att_id, PointIndex point_index, const void *attribute_value) {
+  PointAttribute *const att = mesh_->attribute(att_id);
+  att->SetAttributeValue(att->mapped_index(point_index), attribute_value);
+}
+
+void IndexedMeshBuilder::SetAttributeValuesForAllPoints(
+    int att_id, const void *attribute_values, int stride) {
+  PointAttribute *const att = mesh_->attribute(att_id);
+  const int data_stride =
+      DataTypeLength(att->data_type()) * att->num_components();
+  if (stride == 0) {
+    stride = data_stride;
+  }
+  if (stride == data_stride) {
+    // Fast copy path.
+    att->buffer()->Write(0, attribute_values,
+                         mesh_->num_points() * data_stride);
+  } else {
+    // Copy attribute entries one by one.
+    for (PointIndex i(0); i < mesh_->num_points(); ++i) {
+      att->SetAttributeValue(
+          att->mapped_index(i),
+          static_cast<const uint8_t *>(attribute_values) + stride * i.value());
+    }
+  }
+}
+
+void IndexedMeshBuilder::SetFace(FaceIndex face_id, const Mesh::Face &face) {
+  mesh_->SetFace(face_id, face);
+}
+
+void IndexedMeshBuilder::SetAttributeUniqueId(int att_id, uint32_t unique_id) {
+  mesh_->attribute(att_id)->set_unique_id(unique_id);
+}
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+void IndexedMeshBuilder::SetAttributeName(int att_id,
+                                          const std::string &name) {
+  mesh_->attribute(att_id)->set_name(name);
+}
+#endif  // DRACO_TRANSCODER_SUPPORTED
+
+std::unique_ptr<Mesh> IndexedMeshBuilder::Finalize(bool deduplicate_points) {
+  // Check that all faces reference valid points and find unused points.
+  std::vector<bool> is_point_used(mesh_->num_points(), false);
+  PointIndex::ValueType num_used_points = 0;
+  for (FaceIndex fi(0); fi < mesh_->num_faces(); ++fi) {
+    const Mesh::Face &face = mesh_->face(fi);
+    for (int c = 0; c < 3; ++c) {
+      if (face[c] >= mesh_->num_points()) {
+        return nullptr;
+      }
+      if (!is_point_used[face[c].value()]) {
+        is_point_used[face[c].value()] = true;
+        ++num_used_points;
+      }
+    }
+  }
+  if (num_used_points < mesh_->num_points() &&
+      mesh_->GetNamedAttribute(GeometryAttribute::POSITION) != nullptr) {
+    MeshCleanupOptions options;
+    options.remove_degenerated_faces = false;
+    options.remove_duplicate_faces = false;
+    if (!MeshCleanup::Cleanup(mesh_.get(), options).ok()) {
+      return nullptr;
+    }
+  }
+  if (deduplicate_points) {
+#ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
+    if (!mesh_->DeduplicateAttributeValues()) {
+      return nullptr;
+    }
+#endif
+#ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
+    mesh_->DeduplicatePointIds();
+#endif
+  }
+  return std::move(mesh_);
+}
+
+}  // namespace draco
@@ -0,0 +1,105 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_MESH_INDEXED_MESH_BUILDER_H_
+#define DRACO_MESH_INDEXED_MESH_BUILDER_H_
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "draco/draco_features.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Class for building meshes from indexed geometry, i.e., from attribute values
+// specified for each point and faces that reference the points. Unlike
+// TriangleSoupMeshBuilder, points shared by multiple faces are stored only
+// once so the connectivity does not need to be restored by deduplication.
+// Usage:
+//   IndexedMeshBuilder builder;
+//   builder.Start(num_faces, num_points);
+//   const int pos_att_id =
+//       builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+//   builder.SetAttributeValuesForAllPoints(pos_att_id, positions, 0);
+//   for (FaceIndex i(0); i < num_faces; ++i) {
+//     builder.SetFace(i, faces[i.value()]);
+//   }
+//   std::unique_ptr<Mesh> mesh = builder.Finalize(true);
+class IndexedMeshBuilder {
+ public:
+  // Index type of the inserted element.
+  typedef PointIndex ElementIndex;
+
+  // Starts mesh building for a given number of faces and points.
+  void Start(int num_faces, PointIndex::ValueType num_points);
+
+  // Returns the number of points passed to Start().
+  PointIndex::ValueType num_points() const { return mesh_->num_points(); }
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+  // Sets mesh name.
+  void SetName(const std::string &name);
+#endif  // DRACO_TRANSCODER_SUPPORTED
+
+  // Adds an empty attribute to the mesh. Returns the new attribute's id.
+  int AddAttribute(GeometryAttribute::Type attribute_type,
+                   int8_t num_components, DataType data_type);
+  int AddAttribute(GeometryAttribute::Type attribute_type,
+                   int8_t num_components, DataType data_type, bool normalized);
+
+  // Sets attribute value for a specific point. |attribute_value| must contain
+  // data in the format specified by the AddAttribute method.
+  void SetAttributeValueForPoint(int att_id, PointIndex point_index,
+                                 const void *attribute_value);
+
+  // Sets attribute values for all points. |stride| is the byte offset between
+  // two consecutive values in |attribute_values|. If |stride| is set to 0, the
+  // stride is computed from the format of the attribute.
+  void SetAttributeValuesForAllPoints(int att_id, const void *attribute_values,
+                                      int stride);
+
+  // Sets points of a given face.
+  void SetFace(FaceIndex face_id, const Mesh::Face &face);
+
+  // Sets the unique ID for an attribute created with AddAttribute().
+  void SetAttributeUniqueId(int att_id, uint32_t unique_id);
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+  // Sets attribute name.
+  void SetAttributeName(int att_id, const std::string &name);
+#endif  // DRACO_TRANSCODER_SUPPORTED
+
+  // Add metadata for an attribute.
+  void AddAttributeMetadata(int32_t att_id,
+                            std::unique_ptr<AttributeMetadata> metadata) {
+    mesh_->AddAttributeMetadata(att_id, std::move(metadata));
+  }
+
+  // Finalizes the mesh or returns nullptr on error, e.g., when a face
+  // references an invalid point. Points that are not referenced by any face
+  // are removed. If |deduplicate_points| is true, duplicate attribute values
+  // and points mapped to the same attribute values are also deduplicated.
+  // Once this function is called, the builder becomes invalid and cannot be
+  // used until the method Start() is called again.
+  std::unique_ptr<Mesh> Finalize(bool deduplicate_points);
+
+ private:
+  std::unique_ptr<Mesh> mesh_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_MESH_INDEXED_MESH_BUILDER_H_
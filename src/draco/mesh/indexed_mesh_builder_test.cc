@@ -0,0 +1,99 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/indexed_mesh_builder.h"
+
+#include <memory>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/vector_d.h"
+
+namespace draco {
+
+class IndexedMeshBuilderTest : public ::testing::Test {
+ protected:
+  // Starts building a quad made of two faces that share two points. Point 4
+  // is not used by any face.
+  int StartQuad(IndexedMeshBuilder *builder) {
+    builder->Start(2, 5);
+    const int pos_att_id =
+        builder->AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+    const std::vector<Vector3f> positions = {
+        Vector3f(0.f, 0.f, 0.f), Vector3f(1.f, 0.f, 0.f),
+        Vector3f(0.f, 1.f, 0.f), Vector3f(1.f, 1.f, 0.f),
+        Vector3f(2.f, 2.f, 2.f)};
+    builder->SetAttributeValuesForAllPoints(pos_att_id, positions.data(), 0);
+    builder->SetFace(FaceIndex(0),
+                     {{PointIndex(0), PointIndex(1), PointIndex(2)}});
+    builder->SetFace(FaceIndex(1),
+                     {{PointIndex(2), PointIndex(1), PointIndex(3)}});
+    return pos_att_id;
+  }
+};
+
+TEST_F(IndexedMeshBuilderTest, QuadTest) {
+  // Tests that shared points are preserved and unused points are removed.
+  IndexedMeshBuilder builder;
+  const int pos_att_id = StartQuad(&builder);
+  ASSERT_EQ(builder.num_points(), 5);
+  std::unique_ptr<Mesh> mesh = builder.Finalize(false);
+  ASSERT_NE(mesh, nullptr);
+  ASSERT_EQ(mesh->num_faces(), 2);
+  ASSERT_EQ(mesh->num_points(), 4);
+  const PointAttribute *const pos_att = mesh->attribute(pos_att_id);
+  ASSERT_EQ(pos_att->size(), 4);
+  ASSERT_EQ(mesh->face(FaceIndex(0))[1], mesh->face(FaceIndex(1))[1]);
+  ASSERT_EQ(mesh->face(FaceIndex(0))[2], mesh->face(FaceIndex(1))[0]);
+  Vector3f pos;
+  pos_att->GetMappedValue(mesh->face(FaceIndex(1))[2], &pos[0]);
+  ASSERT_EQ(pos, Vector3f(1.f, 1.f, 0.f));
+}
+
+TEST_F(IndexedMeshBuilderTest, DeduplicationTest) {
+  // Tests that points with equal values are merged when requested.
+  IndexedMeshBuilder builder;
+  builder.Start(2, 6);
+  const int pos_att_id =
+      builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  const std::vector<Vector3f> positions = {
+      Vector3f(0.f, 0.f, 0.f), Vector3f(1.f, 0.f, 0.f),
+      Vector3f(0.f, 1.f, 0.f), Vector3f(0.f, 1.f, 0.f),
+      Vector3f(1.f, 0.f, 0.f), Vector3f(1.f, 1.f, 0.f)};
+  for (PointIndex i(0); i < 6; ++i) {
+    builder.SetAttributeValueForPoint(pos_att_id, i,
+                                      positions[i.value()].data());
+  }
+  builder.SetFace(FaceIndex(0),
+                  {{PointIndex(0), PointIndex(1), PointIndex(2)}});
+  builder.SetFace(FaceIndex(1),
+                  {{PointIndex(3), PointIndex(4), PointIndex(5)}});
+  std::unique_ptr<Mesh> mesh = builder.Finalize(true);
+  ASSERT_NE(mesh, nullptr);
+  ASSERT_EQ(mesh->num_faces(), 2);
+  ASSERT_EQ(mesh->num_points(), 4);
+  ASSERT_EQ(mesh->attribute(pos_att_id)->size(), 4);
+}
+
+TEST_F(IndexedMeshBuilderTest, InvalidFaceTest) {
+  // Tests that faces referencing invalid points are rejected.
+  IndexedMeshBuilder builder;
+  StartQuad(&builder);
+  builder.SetFace(FaceIndex(1),
+                  {{PointIndex(2), PointIndex(1), PointIndex(5)}});
+  ASSERT_EQ(builder.Finalize(false), nullptr);
+}
+
+}  // namespace draco
@@ -28,10 +28,48 @@ using conditional_t = typename std::conditional<B, T, F>::type;
 
 Mesh::Mesh() {}
 
+bool Mesh::ReleaseFacesToCompactIndices(std::vector<uint16_t> *out_indices) {
+  if (num_points() > (1 << 16)) {
+    return false;
+  }
+  out_indices->resize(3 * static_cast<size_t>(num_faces()));
+  uint16_t *out = out_indices->data();
+  for (FaceIndex fi(0); fi < num_faces(); ++fi) {
+    const Face &f = faces_[fi];
+    for (int c = 0; c < 3; ++c) {
+      *out++ = static_cast<uint16_t>(f[c].value());
+    }
+  }
+  // Swap with an empty vector to free the memory of the faces.
+  IndexTypeVector<FaceIndex, Face>().swap(faces_);
+  return true;
+}
+
+MemoryFootprint Mesh::MemoryUsage() const {
+  MemoryFootprint usage = PointCloud::MemoryUsage();
+  usage.faces = faces_.capacity() * sizeof(Face);
+#ifdef DRACO_TRANSCODER_SUPPORTED
+  usage.textures =
+      material_library_.GetTextureLibrary().ComputeMemoryUsage() +
+      non_material_texture_library_.ComputeMemoryUsage();
+#endif
+  return usage;
+}
+
+void Mesh::ShrinkToFit() {
+  PointCloud::ShrinkToFit();
+  faces_.shrink_to_fit();
+#ifdef DRACO_TRANSCODER_SUPPORTED
+  material_library_.MutableTextureLibrary().ShrinkToFit();
+  non_material_texture_library_.ShrinkToFit();
+#endif
+}
+
 #ifdef DRACO_TRANSCODER_SUPPORTED
 void Mesh::Copy(const Mesh &src) {
   PointCloud::Copy(src);
   name_ = src.name_;
+  draco_payload_ = src.draco_payload_;
   faces_ = src.faces_;
   attribute_data_ = src.attribute_data_;
   material_library_.Copy(src.material_library_);
@@ -15,8 +15,11 @@
 #ifndef DRACO_MESH_MESH_H_
 #define DRACO_MESH_MESH_H_
 
+#include <map>
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "draco/attributes/geometry_indices.h"
 #include "draco/core/hash_utils.h"
@@ -72,6 +75,13 @@ class Mesh : public PointCloud {
   // existing ones if necessary.
   void SetNumFaces(size_t num_faces) { faces_.resize(num_faces, Face()); }
 
+  // Same as SetNumFaces() but the new faces are left uninitialized. Use only
+  // when all the new faces are set with SetFace() before they are accessed,
+  // e.g. by connectivity decoders.
+  void SetNumFacesUninitialized(size_t num_faces) {
+    faces_.resize_uninitialized(num_faces);
+  }
+
   FaceIndex::ValueType num_faces() const {
     return static_cast<uint32_t>(faces_.size());
   }
@@ -81,6 +91,17 @@ class Mesh : public PointCloud {
     return faces_[face_id];
   }
 
+  // Stores the point indices of all faces into |out_indices| as 16-bit values
+  // (three per face) and releases the faces of the mesh, halving the memory
+  // used by the connectivity of small meshes. Returns false and keeps the faces
+  // untouched when the mesh has more than 2^16 points.
+  bool ReleaseFacesToCompactIndices(std::vector<uint16_t> *out_indices);
+
+  // Same as PointCloud::MemoryUsage() but also includes the faces and the
+  // textures of the mesh.
+  MemoryFootprint MemoryUsage() const override;
+  void ShrinkToFit() override;
+
   void SetAttribute(int att_id, std::unique_ptr<PointAttribute> pa) override {
     PointCloud::SetAttribute(att_id, std::move(pa));
     if (static_cast<int>(attribute_data_.size()) <= att_id) {
@@ -157,6 +178,33 @@ class Mesh : public PointCloud {
   };
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+  // Draco compressed data that a mesh was decoded from, e.g. the payload of a
+  // glTF primitive compressed with KHR_draco_mesh_compression. The glTF
+  // encoder can write the data again instead of compressing the mesh.
+  struct DracoPayload {
+    // Encoded data, shared by all meshes decoded from the same payload.
+    std::shared_ptr<const std::vector<char>> data;
+    int64_t num_encoded_points = 0;
+    int64_t num_encoded_faces = 0;
+    // Unique ids of the encoded attributes by glTF attribute name.
+    std::map<std::string, int> attribute_ids;
+    // Number of quantization bits of the encoded values of each attribute of
+    // the mesh, or 0 when the values are not quantized.
+    std::vector<int> quantization_bits;
+    // Quantization range of the encoded positions.
+    float position_range = 0.f;
+    // Key of the mesh content at the time it was decoded, see
+    // DracoMeshCache::ComputeKey(). The payload must not be used when the key
+    // of the current mesh content is different.
+    std::string mesh_key;
+  };
+
+  void SetDracoPayload(std::unique_ptr<DracoPayload> payload) {
+    draco_payload_ = std::move(payload);
+  }
+  // Returns the payload the mesh was decoded from or nullptr.
+  const DracoPayload *GetDracoPayload() const { return draco_payload_.get(); }
+
   void SetName(const std::string &name) { name_ = name; }
   const std::string &GetName() const { return name_; }
   const MaterialLibrary &GetMaterialLibrary() const {
@@ -319,6 +367,9 @@ class Mesh : public PointCloud {
   // Mesh name.
   std::string name_;
 
+  // Draco compressed data the mesh was decoded from. Shared by mesh copies.
+  std::shared_ptr<const DracoPayload> draco_payload_;
+
   // Materials applied to to this mesh.
   MaterialLibrary material_library_;
 
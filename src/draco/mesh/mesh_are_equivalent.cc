@@ -16,11 +16,20 @@
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 
+#include "draco/core/hash_utils.h"
 #include "draco/texture/texture_utils.h"
 
 namespace draco {
 
+namespace {
+
+// Number of faces processed by a single task of the parallel loops.
+constexpr int kChunkSize = 1 << 14;
+
+}  // namespace
+
 void MeshAreEquivalent::PrintPosition(const Mesh &mesh, FaceIndex f,
                                       int32_t c) {
   fprintf(stderr, "Printing position for (%i,%i)\n", f.value(), c);
@@ -111,6 +120,13 @@ bool MeshAreEquivalent::operator()(const Mesh &mesh0, const Mesh &mesh1) {
     return false;
   }
 
+  // Meshes with different canonical hashes can't be equivalent. This avoids
+  // the expensive sorting of faces below for most of the different meshes.
+  if (ComputeCanonicalHash(mesh0, pool_) !=
+      ComputeCanonicalHash(mesh1, pool_)) {
+    return false;
+  }
+
   // The following function inits mesh info, i.e., computes the order of
   // faces with respect to the lex order. This way one can then compare the
   // the two meshes face by face. It also determines the first corner of each
@@ -232,6 +248,56 @@ bool MeshAreEquivalent::operator()(const Mesh &mesh0, const Mesh &mesh1) {
   return true;
 }
 
+uint64_t MeshAreEquivalent::ComputeCanonicalHash(const Mesh &mesh,
+                                                 ThreadPool *pool) {
+  // The same attributes as in operator() are hashed.
+  std::vector<const PointAttribute *> attributes;
+  for (int att_id = 0; att_id < GeometryAttribute::NAMED_ATTRIBUTES_COUNT;
+       ++att_id) {
+    const PointAttribute *const att =
+        mesh.GetNamedAttribute(GeometryAttribute::Type(att_id));
+    if (att != nullptr) {
+      attributes.push_back(att);
+    }
+  }
+  const int num_faces = mesh.num_faces();
+  const int num_chunks = (num_faces + kChunkSize - 1) / kChunkSize;
+  std::vector<uint64_t> chunk_hashes(num_chunks, 0);
+  ParallelFor(pool, num_chunks, [&](int k) {
+    uint64_t chunk_hash = 0;
+    const int end = std::min(num_faces, (k + 1) * kChunkSize);
+    for (FaceIndex f(k * kChunkSize); f < end; ++f) {
+      const Mesh::Face &face = mesh.face(f);
+      uint64_t corner_hashes[3];
+      for (int c = 0; c < 3; ++c) {
+        uint64_t hash = 0;
+        for (const PointAttribute *const att : attributes) {
+          hash = HashBytes(att->GetAddressOfMappedIndex(face[c]),
+                           att->byte_stride(), hash);
+        }
+        corner_hashes[c] = hash;
+      }
+      // The hash of the face is the smallest hash over all rotations of its
+      // corners, which keeps the orientation of the face.
+      uint64_t face_hash = UINT64_MAX;
+      for (int c = 0; c < 3; ++c) {
+        face_hash = std::min(
+            face_hash, HashMix(HashMix(corner_hashes[c],
+                                       corner_hashes[(c + 1) % 3]),
+                               corner_hashes[(c + 2) % 3]));
+      }
+      // Sum of the face hashes does not depend on the order of faces.
+      chunk_hash += face_hash;
+    }
+    chunk_hashes[k] = chunk_hash;
+  });
+  uint64_t faces_hash = 0;
+  for (const uint64_t chunk_hash : chunk_hashes) {
+    faces_hash += chunk_hash;
+  }
+  return HashMix(HashMix(num_faces, attributes.size()), faces_hash);
+}
+
 bool MeshAreEquivalent::FaceIndexLess::operator()(FaceIndex f0,
                                                   FaceIndex f1) const {
   if (f0 == f1) {
@@ -15,6 +15,10 @@
 #ifndef DRACO_MESH_MESH_ARE_EQUIVALENT_H_
 #define DRACO_MESH_MESH_ARE_EQUIVALENT_H_
 
+#include <cstdint>
+#include <vector>
+
+#include "draco/core/thread_pool.h"
 #include "draco/core/vector_d.h"
 #include "draco/mesh/mesh.h"
 
@@ -26,10 +30,23 @@ namespace draco {
 // vertices.
 class MeshAreEquivalent {
  public:
+  MeshAreEquivalent() : MeshAreEquivalent(nullptr) {}
+
+  // Creates the functor that computes the canonical hashes of the compared
+  // meshes in parallel on |pool| (can be nullptr).
+  explicit MeshAreEquivalent(ThreadPool *pool) : pool_(pool) {}
+
   // Returns true if both meshes are equivalent up to permutation of
   // the internal order of vertices. This includes all attributes.
   bool operator()(const Mesh &mesh0, const Mesh &mesh1);
 
+  // Returns a hash of the |mesh| that does not depend on the order of faces,
+  // on the order of points, and on the rotation of corners within faces. The
+  // hash covers the values of the first attribute of each named type. Meshes
+  // that are equivalent according to operator() always have the same hash.
+  // The hash is computed in parallel on |pool| (can be nullptr).
+  static uint64_t ComputeCanonicalHash(const Mesh &mesh, ThreadPool *pool);
+
  private:
   // Internal type to keep overview.
   struct MeshInfo {
@@ -64,6 +81,7 @@ class MeshAreEquivalent {
 
   std::vector<MeshInfo> mesh_infos_;
   int32_t num_faces_;
+  ThreadPool *pool_;
 };
 
 }  // namespace draco
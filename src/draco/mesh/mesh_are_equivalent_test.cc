@@ -19,6 +19,7 @@
 
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
 #include "draco/io/mesh_io.h"
 #include "draco/io/obj_decoder.h"
 #include "draco/mesh/mesh.h"
@@ -104,6 +105,36 @@ TEST_F(MeshAreEquivalentTest, TestOnBigMesh) {
   ASSERT_TRUE(equiv(*mesh0, *mesh1));
 }
 
+TEST_F(MeshAreEquivalentTest, TestCanonicalHash) {
+  const std::unique_ptr<Mesh> mesh_0(ReadMeshFromTestFile("one_face_123.obj"));
+  const std::unique_ptr<Mesh> mesh_1(ReadMeshFromTestFile("one_face_312.obj"));
+  const std::unique_ptr<Mesh> mesh_2(ReadMeshFromTestFile("one_face_321.obj"));
+  ASSERT_NE(mesh_0, nullptr);
+  ASSERT_NE(mesh_1, nullptr);
+  ASSERT_NE(mesh_2, nullptr);
+  // Rotated face has the same hash, inverted face has a different one.
+  ASSERT_EQ(MeshAreEquivalent::ComputeCanonicalHash(*mesh_0, nullptr),
+            MeshAreEquivalent::ComputeCanonicalHash(*mesh_1, nullptr));
+  ASSERT_NE(MeshAreEquivalent::ComputeCanonicalHash(*mesh_0, nullptr),
+            MeshAreEquivalent::ComputeCanonicalHash(*mesh_2, nullptr));
+
+  // Mesh with reordered faces and points has the same hash with and without
+  // a thread pool.
+  const std::unique_ptr<Mesh> mesh(ReadMeshFromTestFile("test_nm.obj"));
+  ASSERT_NE(mesh, nullptr);
+  std::unique_ptr<Mesh> encoded_mesh;
+  std::stringstream ss;
+  WriteMeshIntoStream(mesh.get(), ss, MESH_EDGEBREAKER_ENCODING);
+  ReadMeshFromStream(&encoded_mesh, ss);
+  ASSERT_TRUE(ss.good()) << "Mesh IO failed.";
+  ThreadPool pool(3);
+  const uint64_t hash = MeshAreEquivalent::ComputeCanonicalHash(*mesh, &pool);
+  ASSERT_EQ(hash, MeshAreEquivalent::ComputeCanonicalHash(*mesh, nullptr));
+  ASSERT_EQ(hash,
+            MeshAreEquivalent::ComputeCanonicalHash(*encoded_mesh, &pool));
+  ASSERT_TRUE(MeshAreEquivalent(&pool)(*mesh, *encoded_mesh));
+}
+
 #ifdef DRACO_TRANSCODER_SUPPORTED
 
 TEST_F(MeshAreEquivalentTest, TestMeshFeatures) {
@@ -20,7 +20,10 @@
 namespace draco {
 
 MeshAttributeCornerTable::MeshAttributeCornerTable()
-    : no_interior_seams_(true), corner_table_(nullptr), valence_cache_(*this) {}
+    : no_interior_seams_(true),
+      corner_table_(nullptr),
+      valence_cache_(*this),
+      vertex_ring_cache_(*this) {}
 
 bool MeshAttributeCornerTable::InitEmpty(const CornerTable *table) {
   if (table == nullptr) {
@@ -28,6 +31,7 @@ bool MeshAttributeCornerTable::InitEmpty(const CornerTable *table) {
   }
   valence_cache_.ClearValenceCache();
   valence_cache_.ClearValenceCacheInaccurate();
+  vertex_ring_cache_.ClearVertexRingCache();
   is_edge_on_seam_.assign(table->num_corners(), false);
   is_vertex_on_seam_.assign(table->num_vertices(), false);
   corner_to_vertex_map_.assign(table->num_corners(), kInvalidVertexIndex);
@@ -46,6 +50,7 @@ bool MeshAttributeCornerTable::InitFromAttribute(const Mesh *mesh,
   }
   valence_cache_.ClearValenceCache();
   valence_cache_.ClearValenceCacheInaccurate();
+  vertex_ring_cache_.ClearVertexRingCache();
 
   // Find all necessary data for encoding attributes. For now we check which of
   // the mesh vertices is part of an attribute seam, because seams require
@@ -58,13 +63,7 @@ bool MeshAttributeCornerTable::InitFromAttribute(const Mesh *mesh,
     const CornerIndex opp_corner = corner_table_->Opposite(c);
     if (opp_corner == kInvalidCornerIndex) {
       // Boundary. Mark it as seam edge.
-      is_edge_on_seam_[c.value()] = true;
-      // Mark seam vertices.
-      VertexIndex v;
-      v = corner_table_->Vertex(corner_table_->Next(c));
-      is_vertex_on_seam_[v.value()] = true;
-      v = corner_table_->Vertex(corner_table_->Previous(c));
-      is_vertex_on_seam_[v.value()] = true;
+      MarkSeamEdge(c);
       continue;
     }
     if (opp_corner < c) {
@@ -82,21 +81,8 @@ bool MeshAttributeCornerTable::InitFromAttribute(const Mesh *mesh,
           mesh->CornerToPointId(act_sibling_c.value());
       if (att->mapped_index(point_id) != att->mapped_index(sibling_point_id)) {
         no_interior_seams_ = false;
-        is_edge_on_seam_[c.value()] = true;
-        is_edge_on_seam_[opp_corner.value()] = true;
-        // Mark seam vertices.
-        is_vertex_on_seam_[corner_table_
-                               ->Vertex(corner_table_->Next(CornerIndex(c)))
-                               .value()] = true;
-        is_vertex_on_seam_[corner_table_
-                               ->Vertex(corner_table_->Previous(CornerIndex(c)))
-                               .value()] = true;
-        is_vertex_on_seam_
-            [corner_table_->Vertex(corner_table_->Next(opp_corner)).value()] =
-                true;
-        is_vertex_on_seam_[corner_table_
-                               ->Vertex(corner_table_->Previous(opp_corner))
-                               .value()] = true;
+        MarkSeamEdge(c);
+        MarkSeamEdge(opp_corner);
         break;
       }
     }
@@ -107,25 +93,30 @@ bool MeshAttributeCornerTable::InitFromAttribute(const Mesh *mesh,
 
 void MeshAttributeCornerTable::AddSeamEdge(CornerIndex c) {
   DRACO_DCHECK(GetValenceCache().IsCacheEmpty());
-  is_edge_on_seam_[c.value()] = true;
-  // Mark seam vertices.
-  is_vertex_on_seam_[corner_table_->Vertex(corner_table_->Next(c)).value()] =
-      true;
-  is_vertex_on_seam_[corner_table_->Vertex(corner_table_->Previous(c))
-                         .value()] = true;
-
+  MarkSeamEdge(c);
   const CornerIndex opp_corner = corner_table_->Opposite(c);
   if (opp_corner != kInvalidCornerIndex) {
     no_interior_seams_ = false;
-    is_edge_on_seam_[opp_corner.value()] = true;
-    is_vertex_on_seam_[corner_table_->Vertex(corner_table_->Next(opp_corner))
-                           .value()] = true;
-    is_vertex_on_seam_
-        [corner_table_->Vertex(corner_table_->Previous(opp_corner)).value()] =
-            true;
+    MarkSeamEdge(opp_corner);
   }
 }
 
+void MeshAttributeCornerTable::MarkSeamEdge(CornerIndex c) {
+  is_edge_on_seam_.Set(c.value());
+  // Mark seam vertices.
+  is_vertex_on_seam_.Set(corner_table_->Vertex(corner_table_->Next(c)).value());
+  is_vertex_on_seam_.Set(
+      corner_table_->Vertex(corner_table_->Previous(c)).value());
+}
+
+size_t MeshAttributeCornerTable::memory_usage() const {
+  return is_edge_on_seam_.memory_usage() + is_vertex_on_seam_.memory_usage() +
+         corner_to_vertex_map_.capacity() * sizeof(VertexIndex) +
+         vertex_to_left_most_corner_map_.capacity() * sizeof(CornerIndex) +
+         vertex_to_attribute_entry_id_map_.capacity() *
+             sizeof(AttributeValueIndex);
+}
+
 bool MeshAttributeCornerTable::RecomputeVertices(const Mesh *mesh,
                                                  const PointAttribute *att) {
   DRACO_DCHECK(GetValenceCache().IsCacheEmpty());
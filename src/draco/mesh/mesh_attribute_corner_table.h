@@ -15,10 +15,12 @@
 #ifndef DRACO_MESH_MESH_ATTRIBUTE_CORNER_TABLE_H_
 #define DRACO_MESH_MESH_ATTRIBUTE_CORNER_TABLE_H_
 
+#include "draco/core/bit_vector.h"
 #include "draco/core/macros.h"
 #include "draco/mesh/corner_table.h"
 #include "draco/mesh/mesh.h"
 #include "draco/mesh/valence_cache.h"
+#include "draco/mesh/vertex_ring_cache.h"
 
 namespace draco {
 
@@ -139,6 +141,10 @@ class MeshAttributeCornerTable {
   bool no_interior_seams() const { return no_interior_seams_; }
   const CornerTable *corner_table() const { return corner_table_; }
 
+  // Returns the number of bytes allocated by the attribute connectivity,
+  // excluding the valence and vertex ring caches.
+  size_t memory_usage() const;
+
   // TODO(draco-eng): extract valence functions into a reusable class/object
   // also from 'corner_table.*'
 
@@ -170,12 +176,21 @@ class MeshAttributeCornerTable {
     return valence_cache_;
   }
 
+  // Allows access to an internal object for caching the corners around all
+  // vertices. See CornerTable::GetVertexRingCache().
+  const VertexRingCache<MeshAttributeCornerTable> &GetVertexRingCache() const {
+    return vertex_ring_cache_;
+  }
+
  private:
+  // Marks the edge opposite to |c| and its two vertices as a seam.
+  void MarkSeamEdge(CornerIndex c);
+
   template <bool init_vertex_to_attribute_entry_map>
   bool RecomputeVerticesInternal(const Mesh *mesh, const PointAttribute *att);
 
-  std::vector<bool> is_edge_on_seam_;
-  std::vector<bool> is_vertex_on_seam_;
+  BitVector is_edge_on_seam_;
+  BitVector is_vertex_on_seam_;
 
   // If this is set to true, it means that there are no attribute seams between
   // two faces. This can be used to speed up some algorithms.
@@ -196,6 +211,7 @@ class MeshAttributeCornerTable {
   std::vector<AttributeValueIndex> vertex_to_attribute_entry_id_map_;
   const CornerTable *corner_table_;
   ValenceCache<MeshAttributeCornerTable> valence_cache_;
+  VertexRingCache<MeshAttributeCornerTable> vertex_ring_cache_;
 };
 
 }  // namespace draco
@@ -0,0 +1,520 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_bvh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace draco {
+
+namespace {
+
+// Axis aligned box used during the build.
+struct Aabb {
+  Aabb() {
+    for (int i = 0; i < 3; ++i) {
+      min[i] = std::numeric_limits<float>::max();
+      max[i] = -std::numeric_limits<float>::max();
+    }
+  }
+  void Grow(const float *point) {
+    for (int i = 0; i < 3; ++i) {
+      min[i] = std::min(min[i], point[i]);
+      max[i] = std::max(max[i], point[i]);
+    }
+  }
+  void Grow(const Aabb &other) {
+    Grow(other.min);
+    Grow(other.max);
+  }
+  // Returns half of the surface area, which is sufficient to compare costs.
+  float HalfArea() const {
+    if (min[0] > max[0]) {
+      return 0.f;
+    }
+    const float dx = max[0] - min[0];
+    const float dy = max[1] - min[1];
+    const float dz = max[2] - min[2];
+    return dx * dy + dy * dz + dz * dx;
+  }
+  float min[3];
+  float max[3];
+};
+
+// Number of faces processed by a single task when the face bounds are
+// computed in parallel.
+constexpr int kFaceChunkSize = 1 << 14;
+
+// Ranges with fewer faces are not split further by the serial part of the
+// build and are built as a single subtree.
+constexpr uint32_t kMinParallelRangeSize = 1 << 12;
+
+// Returns the entry distance of the ray into the box given by |node|, or
+// infinity when the ray misses the box within [t_min, t_max].
+float IntersectNode(const MeshBvh::Node &node, const Vector3f &origin,
+                    const Vector3f &inv_direction, float t_min, float t_max) {
+  for (int i = 0; i < 3; ++i) {
+    float t0 = (node.bounds_min[i] - origin[i]) * inv_direction[i];
+    float t1 = (node.bounds_max[i] - origin[i]) * inv_direction[i];
+    if (t0 > t1) {
+      std::swap(t0, t1);
+    }
+    // Comparisons are ordered so that NaNs caused by rays parallel to a slab
+    // do not reject the box.
+    t_min = t0 > t_min ? t0 : t_min;
+    t_max = t1 < t_max ? t1 : t_max;
+    if (t_min > t_max) {
+      return std::numeric_limits<float>::infinity();
+    }
+  }
+  return t_min;
+}
+
+}  // namespace
+
+// Builds the hierarchy over the faces described by their bounds and
+// centroids. The upper levels are built serially and the remaining subtrees
+// in parallel, which produces the same hierarchy as a fully serial build.
+class MeshBvh::Builder {
+ public:
+  Builder(const MeshBvhOptions &options, std::vector<Aabb> face_bounds,
+          std::vector<Vector3f> centroids)
+      : options_(options),
+        face_bounds_(std::move(face_bounds)),
+        centroids_(std::move(centroids)) {
+    face_ids_.resize(face_bounds_.size());
+    for (uint32_t i = 0; i < face_ids_.size(); ++i) {
+      face_ids_[i] = i;
+    }
+  }
+
+  // Builds the hierarchy into |nodes|. The leaves reference the faces in the
+  // order of face_ids().
+  void Build(std::vector<Node> *nodes) {
+    int max_top_depth = 0;
+    if (options_.thread_pool != nullptr) {
+      // Create a few times more subtrees than threads to balance the load.
+      const int num_tasks = 4 * (options_.thread_pool->num_threads() + 1);
+      while ((1 << max_top_depth) < num_tasks) {
+        ++max_top_depth;
+      }
+    }
+    std::vector<TopNode> top_nodes;
+    BuildTopNode(0, static_cast<uint32_t>(face_ids_.size()), max_top_depth,
+                 &top_nodes);
+    std::vector<int> task_nodes;
+    for (int i = 0; i < static_cast<int>(top_nodes.size()); ++i) {
+      if (top_nodes[i].left < 0) {
+        task_nodes.push_back(i);
+      }
+    }
+    std::vector<std::vector<Node>> subtrees(task_nodes.size());
+    ParallelFor(options_.thread_pool, static_cast<int>(task_nodes.size()),
+                [&](int i) {
+                  const TopNode &top_node = top_nodes[task_nodes[i]];
+                  BuildSubtree(top_node.begin, top_node.end, &subtrees[i]);
+                });
+    for (int i = 0; i < static_cast<int>(task_nodes.size()); ++i) {
+      top_nodes[task_nodes[i]].subtree = &subtrees[i];
+    }
+    nodes->clear();
+    EmitTopNode(top_nodes, 0, nodes);
+  }
+
+  const std::vector<uint32_t> &face_ids() const { return face_ids_; }
+
+ private:
+  // Node of the serially built upper part of the hierarchy.
+  struct TopNode {
+    uint32_t begin;
+    uint32_t end;
+    // Children of inner nodes, or -1 for subtrees built by a single task.
+    int left;
+    int right;
+    const std::vector<Node> *subtree;
+  };
+
+  int BuildTopNode(uint32_t begin, uint32_t end, int depth,
+                   std::vector<TopNode> *top_nodes) {
+    const int index = static_cast<int>(top_nodes->size());
+    top_nodes->push_back({begin, end, -1, -1, nullptr});
+    uint32_t mid;
+    if (depth == 0 || end - begin < kMinParallelRangeSize ||
+        !Split(begin, end, &mid)) {
+      return index;
+    }
+    const int left = BuildTopNode(begin, mid, depth - 1, top_nodes);
+    const int right = BuildTopNode(mid, end, depth - 1, top_nodes);
+    (*top_nodes)[index].left = left;
+    (*top_nodes)[index].right = right;
+    return index;
+  }
+
+  // Appends the nodes of the top node |index| to |nodes| in depth-first
+  // order.
+  void EmitTopNode(const std::vector<TopNode> &top_nodes, int index,
+                   std::vector<Node> *nodes) {
+    const TopNode &top_node = top_nodes[index];
+    if (top_node.left < 0) {
+      const uint32_t base = static_cast<uint32_t>(nodes->size());
+      for (Node node : *top_node.subtree) {
+        if (node.count == 0) {
+          node.offset += base;
+        }
+        nodes->push_back(node);
+      }
+      return;
+    }
+    const size_t node_index = nodes->size();
+    nodes->push_back(CreateNode(top_node.begin, top_node.end));
+    EmitTopNode(top_nodes, top_node.left, nodes);
+    (*nodes)[node_index].offset = static_cast<uint32_t>(nodes->size());
+    EmitTopNode(top_nodes, top_node.right, nodes);
+  }
+
+  // Builds the subtree of faces in range [|begin|, |end|) of |face_ids_|. The
+  // offsets of inner nodes are relative to the start of |nodes|.
+  void BuildSubtree(uint32_t begin, uint32_t end, std::vector<Node> *nodes) {
+    struct Entry {
+      uint32_t begin;
+      uint32_t end;
+      // Index of the parent node when the entry is a second child.
+      int64_t parent;
+    };
+    std::vector<Entry> stack;
+    stack.push_back({begin, end, -1});
+    while (!stack.empty()) {
+      const Entry entry = stack.back();
+      stack.pop_back();
+      const uint32_t index = static_cast<uint32_t>(nodes->size());
+      if (entry.parent >= 0) {
+        (*nodes)[entry.parent].offset = index;
+      }
+      nodes->push_back(CreateNode(entry.begin, entry.end));
+      uint32_t mid;
+      if (!Split(entry.begin, entry.end, &mid)) {
+        Node &leaf = nodes->back();
+        leaf.offset = entry.begin;
+        leaf.count = entry.end - entry.begin;
+        continue;
+      }
+      // The first child is processed first so that it follows its parent.
+      stack.push_back({mid, entry.end, index});
+      stack.push_back({entry.begin, mid, -1});
+    }
+  }
+
+  // Returns an inner node with the bounds of faces in [|begin|, |end|).
+  Node CreateNode(uint32_t begin, uint32_t end) const {
+    Aabb bounds;
+    for (uint32_t i = begin; i < end; ++i) {
+      bounds.Grow(face_bounds_[face_ids_[i]]);
+    }
+    Node node;
+    for (int i = 0; i < 3; ++i) {
+      node.bounds_min[i] = bounds.min[i];
+      node.bounds_max[i] = bounds.max[i];
+    }
+    node.offset = 0;
+    node.count = 0;
+    return node;
+  }
+
+  // Splits faces in range [|begin|, |end|) into two non-empty parts at |mid|
+  // using the binned surface area heuristic. Returns false without modifying
+  // the range when it should become a leaf.
+  bool Split(uint32_t begin, uint32_t end, uint32_t *mid) {
+    const uint32_t count = end - begin;
+    if (count <= static_cast<uint32_t>(options_.max_leaf_size)) {
+      return false;
+    }
+    Aabb centroid_bounds;
+    for (uint32_t i = begin; i < end; ++i) {
+      centroid_bounds.Grow(&centroids_[face_ids_[i]][0]);
+    }
+    const int num_bins = options_.num_bins;
+    std::vector<Aabb> bin_bounds(num_bins);
+    std::vector<uint32_t> bin_counts(num_bins);
+    std::vector<float> right_costs(num_bins);
+    float best_cost = std::numeric_limits<float>::max();
+    int best_axis = -1;
+    int best_bin = 0;
+    for (int axis = 0; axis < 3; ++axis) {
+      const float axis_min = centroid_bounds.min[axis];
+      const float extent = centroid_bounds.max[axis] - axis_min;
+      if (!(extent > 0.f)) {
+        continue;
+      }
+      const float scale = num_bins / extent;
+      std::fill(bin_bounds.begin(), bin_bounds.end(), Aabb());
+      std::fill(bin_counts.begin(), bin_counts.end(), 0);
+      for (uint32_t i = begin; i < end; ++i) {
+        const uint32_t face = face_ids_[i];
+        const int bin = GetBin(centroids_[face][axis], axis_min, scale);
+        bin_bounds[bin].Grow(face_bounds_[face]);
+        ++bin_counts[bin];
+      }
+      // Cost of the faces right of each split plane, then sweep from the left.
+      Aabb right_bounds;
+      uint32_t right_count = 0;
+      for (int b = num_bins - 1; b > 0; --b) {
+        right_bounds.Grow(bin_bounds[b]);
+        right_count += bin_counts[b];
+        right_costs[b] = right_count == 0
+                             ? std::numeric_limits<float>::max()
+                             : right_count * right_bounds.HalfArea();
+      }
+      Aabb left_bounds;
+      uint32_t left_count = 0;
+      for (int b = 0; b < num_bins - 1; ++b) {
+        left_bounds.Grow(bin_bounds[b]);
+        left_count += bin_counts[b];
+        if (left_count == 0 || left_count == count) {
+          continue;
+        }
+        const float cost =
+            left_count * left_bounds.HalfArea() + right_costs[b + 1];
+        if (cost < best_cost) {
+          best_cost = cost;
+          best_axis = axis;
+          best_bin = b;
+        }
+      }
+    }
+    if (best_axis < 0) {
+      // All centroids are at the same location, split the faces in halves.
+      *mid = begin + count / 2;
+      return true;
+    }
+    const float axis_min = centroid_bounds.min[best_axis];
+    const float scale =
+        num_bins / (centroid_bounds.max[best_axis] - axis_min);
+    const auto split_it = std::partition(
+        face_ids_.begin() + begin, face_ids_.begin() + end,
+        [&](uint32_t face) {
+          return GetBin(centroids_[face][best_axis], axis_min, scale) <=
+                 best_bin;
+        });
+    *mid = static_cast<uint32_t>(split_it - face_ids_.begin());
+    return true;
+  }
+
+  int GetBin(float value, float axis_min, float scale) const {
+    const int bin = static_cast<int>((value - axis_min) * scale);
+    return std::min(std::max(bin, 0), options_.num_bins - 1);
+  }
+
+  const MeshBvhOptions &options_;
+  const std::vector<Aabb> face_bounds_;
+  const std::vector<Vector3f> centroids_;
+  std::vector<uint32_t> face_ids_;
+};
+
+Status MeshBvh::Build(const Mesh &mesh, const MeshBvhOptions &options) {
+  if (options.max_leaf_size < 1 || options.num_bins < 2) {
+    return Status(Status::DRACO_ERROR, "Invalid BVH options.");
+  }
+  const PointAttribute *const pos_att =
+      mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (pos_att == nullptr) {
+    return Status(Status::DRACO_ERROR, "Mesh has no position attribute.");
+  }
+  nodes_.clear();
+  faces_.clear();
+  triangles_.clear();
+  const uint32_t num_faces = mesh.num_faces();
+  if (num_faces == 0) {
+    return OkStatus();
+  }
+
+  // Convert all position values at once, the faces then only gather them.
+  std::vector<Vector3f> positions(pos_att->size());
+  if (!pos_att->ConvertValues(AttributeValueIndex(0), pos_att->size(), 3,
+                              &positions[0][0], sizeof(Vector3f))) {
+    return Status(Status::DRACO_ERROR, "Failed to read positions.");
+  }
+
+  // Gather the triangles and compute their bounds and centroids.
+  std::vector<Vector3f> triangles(3 * num_faces);
+  std::vector<Aabb> face_bounds(num_faces);
+  std::vector<Vector3f> centroids(num_faces);
+  const int num_chunks =
+      static_cast<int>((num_faces + kFaceChunkSize - 1) / kFaceChunkSize);
+  ParallelFor(options.thread_pool, num_chunks, [&](int chunk) {
+    const uint32_t chunk_begin = chunk * kFaceChunkSize;
+    const uint32_t chunk_end =
+        std::min<uint32_t>(chunk_begin + kFaceChunkSize, num_faces);
+    for (uint32_t f = chunk_begin; f < chunk_end; ++f) {
+      const Mesh::Face &face = mesh.face(FaceIndex(f));
+      Aabb &bounds = face_bounds[f];
+      for (int c = 0; c < 3; ++c) {
+        const Vector3f &position =
+            positions[pos_att->mapped_index(face[c]).value()];
+        std::copy(&position[0], &position[0] + 3, &triangles[3 * f + c][0]);
+        bounds.Grow(&position[0]);
+      }
+      for (int i = 0; i < 3; ++i) {
+        centroids[f][i] = 0.5f * (bounds.min[i] + bounds.max[i]);
+      }
+    }
+  });
+
+  Builder builder(options, std::move(face_bounds), std::move(centroids));
+  builder.Build(&nodes_);
+
+  // Store the triangles in the order of the leaves.
+  const std::vector<uint32_t> &face_ids = builder.face_ids();
+  faces_.resize(num_faces);
+  triangles_.clear();
+  triangles_.reserve(3 * num_faces);
+  for (uint32_t i = 0; i < num_faces; ++i) {
+    const uint32_t f = face_ids[i];
+    faces_[i] = FaceIndex(f);
+    for (int c = 0; c < 3; ++c) {
+      triangles_.push_back(triangles[3 * f + c]);
+    }
+  }
+  return OkStatus();
+}
+
+bool MeshBvh::IntersectRay(const Vector3f &origin, const Vector3f &direction,
+                           float t_min, float t_max, RayHit *hit) const {
+  if (nodes_.empty()) {
+    return false;
+  }
+  const Vector3f inv_direction(1.f / direction[0], 1.f / direction[1],
+                               1.f / direction[2]);
+  bool found = false;
+  std::vector<uint32_t> stack;
+  stack.reserve(64);
+  if (IntersectNode(nodes_[0], origin, inv_direction, t_min, t_max) <=
+      t_max) {
+    stack.push_back(0);
+  }
+  while (!stack.empty()) {
+    const Node &node = nodes_[stack.back()];
+    stack.pop_back();
+    if (node.count > 0) {
+      for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+        // Moller-Trumbore ray-triangle intersection.
+        const Vector3f &v0 = triangles_[3 * i];
+        const Vector3f edge1 = triangles_[3 * i + 1] - v0;
+        const Vector3f edge2 = triangles_[3 * i + 2] - v0;
+        const Vector3f p = CrossProduct(direction, edge2);
+        const float det = edge1.Dot(p);
+        if (det == 0.f) {
+          continue;
+        }
+        const float inv_det = 1.f / det;
+        const Vector3f s = origin - v0;
+        const float u = s.Dot(p) * inv_det;
+        if (u < 0.f || u > 1.f) {
+          continue;
+        }
+        const Vector3f q = CrossProduct(s, edge1);
+        const float v = direction.Dot(q) * inv_det;
+        if (v < 0.f || u + v > 1.f) {
+          continue;
+        }
+        const float t = edge2.Dot(q) * inv_det;
+        if (t < t_min || t > t_max) {
+          continue;
+        }
+        // Closer hits shrink the search interval.
+        t_max = t;
+        hit->face = faces_[i];
+        hit->distance = t;
+        hit->u = u;
+        hit->v = v;
+        found = true;
+      }
+      continue;
+    }
+    // Visit the closer child first.
+    uint32_t first = static_cast<uint32_t>(&node - &nodes_[0]) + 1;
+    uint32_t second = node.offset;
+    float first_t =
+        IntersectNode(nodes_[first], origin, inv_direction, t_min, t_max);
+    float second_t =
+        IntersectNode(nodes_[second], origin, inv_direction, t_min, t_max);
+    if (second_t < first_t) {
+      std::swap(first, second);
+      std::swap(first_t, second_t);
+    }
+    if (second_t <= t_max) {
+      stack.push_back(second);
+    }
+    if (first_t <= t_max) {
+      stack.push_back(first);
+    }
+  }
+  return found;
+}
+
+void MeshBvh::QueryBox(const BoundingBox &box,
+                       std::vector<FaceIndex> *out_faces) const {
+  if (nodes_.empty()) {
+    return;
+  }
+  const Vector3f &box_min = box.GetMinPoint();
+  const Vector3f &box_max = box.GetMaxPoint();
+  std::vector<uint32_t> stack;
+  stack.reserve(64);
+  stack.push_back(0);
+  while (!stack.empty()) {
+    const uint32_t index = stack.back();
+    stack.pop_back();
+    const Node &node = nodes_[index];
+    const BoundingBox node_box(
+        Vector3f(node.bounds_min[0], node.bounds_min[1], node.bounds_min[2]),
+        Vector3f(node.bounds_max[0], node.bounds_max[1], node.bounds_max[2]));
+    if (!node_box.Intersects(box)) {
+      continue;
+    }
+    if (node.count == 0) {
+      stack.push_back(node.offset);
+      stack.push_back(index + 1);
+      continue;
+    }
+    for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+      bool overlaps = true;
+      for (int axis = 0; axis < 3 && overlaps; ++axis) {
+        const float a = triangles_[3 * i][axis];
+        const float b = triangles_[3 * i + 1][axis];
+        const float c = triangles_[3 * i + 2][axis];
+        overlaps = std::max(a, std::max(b, c)) >= box_min[axis] &&
+                   std::min(a, std::min(b, c)) <= box_max[axis];
+      }
+      if (overlaps) {
+        out_faces->push_back(faces_[i]);
+      }
+    }
+  }
+}
+
+BoundingBox MeshBvh::GetBounds() const {
+  if (nodes_.empty()) {
+    return BoundingBox();
+  }
+  const Node &root = nodes_[0];
+  return BoundingBox(
+      Vector3f(root.bounds_min[0], root.bounds_min[1], root.bounds_min[2]),
+      Vector3f(root.bounds_max[0], root.bounds_max[1], root.bounds_max[2]));
+}
+
+}  // namespace draco
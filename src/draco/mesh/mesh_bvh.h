@@ -0,0 +1,111 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_MESH_MESH_BVH_H_
+#define DRACO_MESH_MESH_BVH_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "draco/attributes/geometry_indices.h"
+#include "draco/core/bounding_box.h"
+#include "draco/core/status.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/vector_d.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+struct MeshBvhOptions {
+  // Nodes with at most this number of faces are not split further.
+  int max_leaf_size = 4;
+  // Number of bins per axis used to evaluate the surface area heuristic.
+  int num_bins = 16;
+  // Optional thread pool used to build independent subtrees in parallel. The
+  // resulting hierarchy does not depend on the number of threads.
+  ThreadPool *thread_pool = nullptr;
+};
+
+// Bounding volume hierarchy over the faces of a draco::Mesh for ray casting
+// and spatial queries, e.g. for collision detection or picking. The hierarchy
+// is built top-down with a binned surface area heuristic. The triangles are
+// read directly from the faces and the position attribute of the mesh and are
+// copied in the order of the leaves, so the mesh is not needed for queries.
+//
+// Example:
+//
+//   MeshBvh bvh;
+//   DRACO_RETURN_IF_ERROR(bvh.Build(*mesh, MeshBvhOptions()));
+//   MeshBvh::RayHit hit;
+//   if (bvh.IntersectRay(origin, direction, 0.f, max_distance, &hit)) {
+//     ...  // Use hit.face and hit.distance.
+//   }
+class MeshBvh {
+ public:
+  // Node of the hierarchy. Nodes are stored in depth-first order, so the
+  // first child of an inner node directly follows the node.
+  struct Node {
+    float bounds_min[3];
+    float bounds_max[3];
+    // For leaves, the index of the first triangle of the leaf. For inner
+    // nodes, the index of the second child node.
+    uint32_t offset;
+    // Number of triangles of a leaf, or 0 for inner nodes.
+    uint32_t count;
+  };
+
+  struct RayHit {
+    FaceIndex face;
+    // Distance along the ray direction and the barycentric coordinates of the
+    // second and the third corner of the face at the hit point.
+    float distance;
+    float u;
+    float v;
+  };
+
+  MeshBvh() {}
+
+  // Builds the hierarchy over all faces of |mesh|. Any previous content is
+  // replaced.
+  Status Build(const Mesh &mesh, const MeshBvhOptions &options);
+
+  // Finds the closest intersection of the ray |origin| + t * |direction| for
+  // t in range [|t_min|, |t_max|] with the faces of the mesh. Both sides of
+  // the faces are hit. Returns false when there is no intersection.
+  bool IntersectRay(const Vector3f &origin, const Vector3f &direction,
+                    float t_min, float t_max, RayHit *hit) const;
+
+  // Appends all faces whose bounding box intersects |box| to |out_faces|.
+  void QueryBox(const BoundingBox &box,
+                std::vector<FaceIndex> *out_faces) const;
+
+  // Returns the bounding box of all faces.
+  BoundingBox GetBounds() const;
+
+  const std::vector<Node> &nodes() const { return nodes_; }
+  int num_faces() const { return static_cast<int>(faces_.size()); }
+
+ private:
+  // Top-down builder, see mesh_bvh.cc.
+  class Builder;
+
+  std::vector<Node> nodes_;
+  // Original face and vertex positions of each triangle in leaf order.
+  std::vector<FaceIndex> faces_;
+  std::vector<Vector3f> triangles_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_MESH_MESH_BVH_H_
@@ -0,0 +1,203 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_bvh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/vector_d.h"
+
+namespace draco {
+
+class MeshBvhTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mesh_ = ReadMeshFromTestFile("bun_zipper.ply");
+    ASSERT_NE(mesh_, nullptr);
+    pos_att_ = mesh_->GetNamedAttribute(GeometryAttribute::POSITION);
+  }
+
+  Vector3f GetPosition(FaceIndex f, int c) const {
+    Vector3f position;
+    pos_att_->GetMappedValue(mesh_->face(f)[c], &position[0]);
+    return position;
+  }
+
+  // Returns the distance of the closest face hit by the ray, or infinity,
+  // by testing all faces of the mesh.
+  float IntersectAllFaces(const Vector3f &origin,
+                          const Vector3f &direction) const {
+    float closest = std::numeric_limits<float>::infinity();
+    for (FaceIndex f(0); f < mesh_->num_faces(); ++f) {
+      const Vector3f v0 = GetPosition(f, 0);
+      const Vector3f edge1 = GetPosition(f, 1) - v0;
+      const Vector3f edge2 = GetPosition(f, 2) - v0;
+      const Vector3f p = CrossProduct(direction, edge2);
+      const float det = edge1.Dot(p);
+      if (det == 0.f) {
+        continue;
+      }
+      const Vector3f s = origin - v0;
+      const float u = s.Dot(p) / det;
+      const Vector3f q = CrossProduct(s, edge1);
+      const float v = direction.Dot(q) / det;
+      const float t = edge2.Dot(q) / det;
+      if (u >= 0.f && v >= 0.f && u + v <= 1.f && t >= 0.f && t < closest) {
+        closest = t;
+      }
+    }
+    return closest;
+  }
+
+  std::unique_ptr<Mesh> mesh_;
+  const PointAttribute *pos_att_ = nullptr;
+};
+
+// Tests that the hierarchy covers all faces with leaves of the requested size
+// and bounds that contain their children.
+TEST_F(MeshBvhTest, TestStructure) {
+  MeshBvhOptions options;
+  options.max_leaf_size = 2;
+  MeshBvh bvh;
+  DRACO_ASSERT_OK(bvh.Build(*mesh_, options));
+  ASSERT_EQ(bvh.num_faces(), mesh_->num_faces());
+  const std::vector<MeshBvh::Node> &nodes = bvh.nodes();
+  std::vector<bool> is_face_covered(mesh_->num_faces(), false);
+  uint32_t num_leaf_faces = 0;
+  for (uint32_t i = 0; i < nodes.size(); ++i) {
+    const MeshBvh::Node &node = nodes[i];
+    if (node.count > 0) {
+      ASSERT_LE(node.count, options.max_leaf_size);
+      ASSERT_EQ(node.offset, num_leaf_faces);
+      num_leaf_faces += node.count;
+      continue;
+    }
+    ASSERT_GT(node.offset, i + 1);
+    ASSERT_LT(node.offset, nodes.size());
+    for (const uint32_t child : {i + 1, node.offset}) {
+      for (int j = 0; j < 3; ++j) {
+        ASSERT_LE(node.bounds_min[j], nodes[child].bounds_min[j]);
+        ASSERT_GE(node.bounds_max[j], nodes[child].bounds_max[j]);
+      }
+    }
+  }
+  ASSERT_EQ(num_leaf_faces, mesh_->num_faces());
+
+  // All faces are returned by a query of the whole bounds.
+  std::vector<FaceIndex> faces;
+  bvh.QueryBox(bvh.GetBounds(), &faces);
+  ASSERT_EQ(faces.size(), mesh_->num_faces());
+  for (const FaceIndex f : faces) {
+    ASSERT_FALSE(is_face_covered[f.value()]);
+    is_face_covered[f.value()] = true;
+  }
+}
+
+// Tests that ray queries return the same closest hits as a test of all faces.
+TEST_F(MeshBvhTest, TestIntersectRay) {
+  MeshBvh bvh;
+  DRACO_ASSERT_OK(bvh.Build(*mesh_, MeshBvhOptions()));
+  const BoundingBox bounds = bvh.GetBounds();
+  const Vector3f center =
+      (bounds.GetMinPoint() + bounds.GetMaxPoint()) * 0.5f;
+  const float radius = std::sqrt(bounds.Size().SquaredNorm());
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+  int num_hits = 0;
+  for (int i = 0; i < 200; ++i) {
+    Vector3f origin_dir(distribution(generator), distribution(generator),
+                        distribution(generator));
+    origin_dir.Normalize();
+    const Vector3f origin = center + origin_dir * radius;
+    const Vector3f target(
+        center[0] + 0.2f * radius * distribution(generator),
+        center[1] + 0.2f * radius * distribution(generator),
+        center[2] + 0.2f * radius * distribution(generator));
+    Vector3f direction = target - origin;
+    direction.Normalize();
+    const float expected = IntersectAllFaces(origin, direction);
+    MeshBvh::RayHit hit;
+    const bool found = bvh.IntersectRay(
+        origin, direction, 0.f, std::numeric_limits<float>::max(), &hit);
+    ASSERT_EQ(found, expected != std::numeric_limits<float>::infinity());
+    if (found) {
+      ++num_hits;
+      ASSERT_NEAR(hit.distance, expected, 1e-6f * radius);
+      const Vector3f point = origin + direction * hit.distance;
+      const Vector3f expected_point =
+          GetPosition(hit.face, 0) * (1.f - hit.u - hit.v) +
+          GetPosition(hit.face, 1) * hit.u + GetPosition(hit.face, 2) * hit.v;
+      const float error = std::sqrt((point - expected_point).SquaredNorm());
+      ASSERT_LE(error, 1e-5f * radius);
+    }
+  }
+  ASSERT_GT(num_hits, 0);
+
+  // Hits beyond the maximum distance are ignored.
+  MeshBvh::RayHit hit;
+  ASSERT_FALSE(bvh.IntersectRay(center + Vector3f(0.f, 0.f, radius),
+                                Vector3f(0.f, 0.f, -1.f), 0.f, 0.1f * radius,
+                                &hit));
+}
+
+// Tests that box queries return the faces whose bounds intersect the box.
+TEST_F(MeshBvhTest, TestQueryBox) {
+  MeshBvh bvh;
+  DRACO_ASSERT_OK(bvh.Build(*mesh_, MeshBvhOptions()));
+  const BoundingBox bounds = bvh.GetBounds();
+  const Vector3f size = bounds.Size();
+  const BoundingBox box(bounds.GetMinPoint() + size * 0.3f,
+                        bounds.GetMinPoint() + size * 0.6f);
+  std::vector<FaceIndex> faces;
+  bvh.QueryBox(box, &faces);
+  std::vector<FaceIndex> expected_faces;
+  for (FaceIndex f(0); f < mesh_->num_faces(); ++f) {
+    BoundingBox face_box;
+    for (int c = 0; c < 3; ++c) {
+      face_box.Update(GetPosition(f, c));
+    }
+    if (face_box.Intersects(box)) {
+      expected_faces.push_back(f);
+    }
+  }
+  ASSERT_GT(expected_faces.size(), 0);
+  std::sort(faces.begin(), faces.end());
+  ASSERT_EQ(faces, expected_faces);
+}
+
+// Tests that the hierarchy does not depend on the number of threads.
+TEST_F(MeshBvhTest, TestParallelBuild) {
+  MeshBvh bvh;
+  DRACO_ASSERT_OK(bvh.Build(*mesh_, MeshBvhOptions()));
+  ThreadPool thread_pool(3);
+  MeshBvhOptions options;
+  options.thread_pool = &thread_pool;
+  MeshBvh parallel_bvh;
+  DRACO_ASSERT_OK(parallel_bvh.Build(*mesh_, options));
+  ASSERT_EQ(parallel_bvh.nodes().size(), bvh.nodes().size());
+  ASSERT_EQ(memcmp(parallel_bvh.nodes().data(), bvh.nodes().data(),
+                   bvh.nodes().size() * sizeof(MeshBvh::Node)),
+            0);
+}
+
+}  // namespace draco
@@ -14,7 +14,7 @@
 //
 #include "draco/mesh/mesh_cleanup.h"
 
-#include <array>
+#include <algorithm>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -24,7 +24,22 @@
 
 namespace draco {
 
+namespace {
+
+// Number of faces processed by a single task of the parallel loops.
+constexpr int kChunkSize = 1 << 14;
+
+// Number of independent hash sets the duplicate faces are searched in.
+constexpr int kNumDuplicateFaceShards = 64;
+
+}  // namespace
+
 Status MeshCleanup::Cleanup(Mesh *mesh, const MeshCleanupOptions &options) {
+  return Cleanup(mesh, options, nullptr);
+}
+
+Status MeshCleanup::Cleanup(Mesh *mesh, const MeshCleanupOptions &options,
+                            ThreadPool *pool) {
   if (!options.remove_degenerated_faces && !options.remove_unused_attributes &&
       !options.remove_duplicate_faces && !options.make_geometry_manifold) {
     return OkStatus();  // Nothing to cleanup.
@@ -35,77 +50,126 @@ Status MeshCleanup::Cleanup(Mesh *mesh, const MeshCleanupOptions &options) {
     return Status(Status::DRACO_ERROR, "Missing position attribute.");
   }
 
-  if (options.remove_degenerated_faces) {
-    RemoveDegeneratedFaces(mesh);
-  }
-
-  if (options.remove_duplicate_faces) {
-    RemoveDuplicateFaces(mesh);
+  if (options.remove_degenerated_faces || options.remove_duplicate_faces) {
+    RemoveDegeneratedAndDuplicateFaces(mesh, options, pool);
   }
 
   if (options.remove_unused_attributes) {
-    RemoveUnusedAttributes(mesh);
+    RemoveUnusedAttributes(mesh, pool);
   }
 
   return OkStatus();
 }
 
-void MeshCleanup::RemoveDegeneratedFaces(Mesh *mesh) {
+void MeshCleanup::RemoveDegeneratedAndDuplicateFaces(
+    Mesh *mesh, const MeshCleanupOptions &options, ThreadPool *pool) {
   const PointAttribute *const pos_att =
       mesh->GetNamedAttribute(GeometryAttribute::POSITION);
-  FaceIndex::ValueType num_degenerated_faces = 0;
-  // Array for storing position indices on a face.
-  std::array<AttributeValueIndex, 3> pos_indices;
-  for (FaceIndex f(0); f < mesh->num_faces(); ++f) {
-    const Mesh::Face &face = mesh->face(f);
-    for (int p = 0; p < 3; ++p) {
-      pos_indices[p] = pos_att->mapped_index(face[p]);
-    }
-    if (pos_indices[0] == pos_indices[1] || pos_indices[0] == pos_indices[2] ||
-        pos_indices[1] == pos_indices[2]) {
-      ++num_degenerated_faces;
-    } else if (num_degenerated_faces > 0) {
-      // Copy the face to its new location.
-      mesh->SetFace(f - num_degenerated_faces, face);
-    }
-  }
-  if (num_degenerated_faces > 0) {
-    mesh->SetNumFaces(mesh->num_faces() - num_degenerated_faces);
+  const int num_faces = mesh->num_faces();
+  const int num_chunks = (num_faces + kChunkSize - 1) / kChunkSize;
+  std::vector<uint8_t> is_face_removed(num_faces, 0);
+  // Faces with their point ids shifted until the smallest one is the first
+  // one. Two faces are duplicate when they have the same shifted point ids.
+  std::vector<Mesh::Face> face_keys;
+  std::vector<uint64_t> face_hashes;
+  if (options.remove_duplicate_faces) {
+    face_keys.resize(num_faces);
+    face_hashes.resize(num_faces);
   }
-}
-
-void MeshCleanup::RemoveDuplicateFaces(Mesh *mesh) {
-  std::unordered_set<Mesh::Face, HashArray<Mesh::Face>> is_face_used;
-
-  uint32_t num_duplicate_faces = 0;
-  for (FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
-    auto face = mesh->face(fi);
+  ParallelFor(pool, num_chunks, [&](int k) {
+    const int end = std::min(num_faces, (k + 1) * kChunkSize);
+    for (int f = k * kChunkSize; f < end; ++f) {
+      Mesh::Face face = mesh->face(FaceIndex(f));
+      if (options.remove_degenerated_faces) {
+        const AttributeValueIndex p0 = pos_att->mapped_index(face[0]);
+        const AttributeValueIndex p1 = pos_att->mapped_index(face[1]);
+        const AttributeValueIndex p2 = pos_att->mapped_index(face[2]);
+        if (p0 == p1 || p0 == p2 || p1 == p2) {
+          is_face_removed[f] = 1;
+          continue;
+        }
+      }
+      if (options.remove_duplicate_faces) {
+        while (face[0] > face[1] || face[0] > face[2]) {
+          std::swap(face[0], face[1]);
+          std::swap(face[1], face[2]);
+        }
+        face_keys[f] = face;
+        face_hashes[f] = HashMix(HashMix(face[0].value(), face[1].value()),
+                                 face[2].value());
+      }
+    }
+  });
 
-    // Shift the face indices until the smallest index is the first one.
-    while (face[0] > face[1] || face[0] > face[2]) {
-      // Shift to the left.
-      std::swap(face[0], face[1]);
-      std::swap(face[1], face[2]);
+  if (options.remove_duplicate_faces) {
+    // Distribute the remaining faces into shards by their hashes. Faces of
+    // each shard are stored in their original order, so the first one of any
+    // set of duplicate faces is always kept.
+    std::vector<int> offsets(num_chunks * kNumDuplicateFaceShards, 0);
+    ParallelFor(pool, num_chunks, [&](int k) {
+      int *const histogram = &offsets[k * kNumDuplicateFaceShards];
+      const int end = std::min(num_faces, (k + 1) * kChunkSize);
+      for (int f = k * kChunkSize; f < end; ++f) {
+        if (!is_face_removed[f]) {
+          ++histogram[face_hashes[f] % kNumDuplicateFaceShards];
+        }
+      }
+    });
+    std::vector<int> shard_offsets(kNumDuplicateFaceShards + 1, 0);
+    for (int s = 0; s < kNumDuplicateFaceShards; ++s) {
+      int offset = shard_offsets[s];
+      for (int k = 0; k < num_chunks; ++k) {
+        const int count = offsets[k * kNumDuplicateFaceShards + s];
+        offsets[k * kNumDuplicateFaceShards + s] = offset;
+        offset += count;
+      }
+      shard_offsets[s + 1] = offset;
     }
-    // Check if have encountered the same face before.
-    if (is_face_used.find(face) != is_face_used.end()) {
-      // Duplicate face. Ignore it.
-      num_duplicate_faces++;
-    } else {
-      // Insert new face to the set.
-      is_face_used.insert(face);
-      if (num_duplicate_faces > 0) {
-        // Copy the face to its new location.
-        mesh->SetFace(fi - num_duplicate_faces, face);
+    std::vector<int> shard_faces(shard_offsets.back());
+    ParallelFor(pool, num_chunks, [&](int k) {
+      int *const chunk_offsets = &offsets[k * kNumDuplicateFaceShards];
+      const int end = std::min(num_faces, (k + 1) * kChunkSize);
+      for (int f = k * kChunkSize; f < end; ++f) {
+        if (!is_face_removed[f]) {
+          shard_faces[chunk_offsets[face_hashes[f] %
+                                    kNumDuplicateFaceShards]++] = f;
+        }
+      }
+    });
+    const auto face_hash = [&](int f) {
+      return static_cast<size_t>(face_hashes[f]);
+    };
+    const auto face_equal = [&](int f0, int f1) {
+      return face_keys[f0] == face_keys[f1];
+    };
+    ParallelFor(pool, kNumDuplicateFaceShards, [&](int s) {
+      std::unordered_set<int, decltype(face_hash), decltype(face_equal)>
+          used_faces(shard_offsets[s + 1] - shard_offsets[s], face_hash,
+                     face_equal);
+      for (int i = shard_offsets[s]; i < shard_offsets[s + 1]; ++i) {
+        if (!used_faces.insert(shard_faces[i]).second) {
+          is_face_removed[shard_faces[i]] = 1;
+        }
       }
+    });
+  }
+
+  // Compact the remaining faces.
+  FaceIndex::ValueType num_removed_faces = 0;
+  for (FaceIndex f(0); f < num_faces; ++f) {
+    if (is_face_removed[f.value()]) {
+      ++num_removed_faces;
+    } else if (num_removed_faces > 0) {
+      // Copy the face to its new location.
+      mesh->SetFace(f - num_removed_faces, mesh->face(f));
     }
   }
-  if (num_duplicate_faces > 0) {
-    mesh->SetNumFaces(mesh->num_faces() - num_duplicate_faces);
+  if (num_removed_faces > 0) {
+    mesh->SetNumFaces(num_faces - num_removed_faces);
   }
 }
 
-void MeshCleanup::RemoveUnusedAttributes(Mesh *mesh) {
+void MeshCleanup::RemoveUnusedAttributes(Mesh *mesh, ThreadPool *pool) {
   // Array that is going to store whether a corresponding point is used.
   std::vector<bool> is_point_used;
   PointIndex::ValueType num_new_points = 0;
@@ -136,13 +200,17 @@ void MeshCleanup::RemoveUnusedAttributes(Mesh *mesh) {
       }
     }
     // Go over faces and update their points.
-    for (FaceIndex f(0); f < mesh->num_faces(); ++f) {
-      Mesh::Face face = mesh->face(f);
-      for (int p = 0; p < 3; ++p) {
-        face[p] = point_map[face[p]];
+    const int num_faces = mesh->num_faces();
+    ParallelFor(pool, (num_faces + kChunkSize - 1) / kChunkSize, [&](int k) {
+      const int end = std::min(num_faces, (k + 1) * kChunkSize);
+      for (FaceIndex f(k * kChunkSize); f < end; ++f) {
+        Mesh::Face face = mesh->face(f);
+        for (int p = 0; p < 3; ++p) {
+          face[p] = point_map[face[p]];
+        }
+        mesh->SetFace(f, face);
       }
-      mesh->SetFace(f, face);
-    }
+    });
     // Set the new number of points.
     mesh->set_num_points(num_new_points);
     points_changed = true;
@@ -154,14 +222,14 @@ void MeshCleanup::RemoveUnusedAttributes(Mesh *mesh) {
     }
   }
 
-  // Update index mapping for attributes.
-  IndexTypeVector<AttributeValueIndex, uint8_t> is_att_index_used;
-  IndexTypeVector<AttributeValueIndex, AttributeValueIndex> att_index_map;
-  for (int a = 0; a < mesh->num_attributes(); ++a) {
+  // Update index mapping for attributes. The attributes are independent of
+  // each other and they are processed in parallel.
+  ParallelFor(pool, mesh->num_attributes(), [&](int a) {
     PointAttribute *const att = mesh->attribute(a);
     // First detect which attribute entries are used (included in a point).
-    is_att_index_used.assign(att->size(), 0);
-    att_index_map.clear();
+    IndexTypeVector<AttributeValueIndex, uint8_t> is_att_index_used(
+        att->size(), 0);
+    IndexTypeVector<AttributeValueIndex, AttributeValueIndex> att_index_map;
     AttributeValueIndex::ValueType num_used_entries = 0;
     for (PointIndex i(0); i < num_original_points; ++i) {
       if (point_map[i] != kInvalidPointIndex) {
@@ -238,7 +306,7 @@ void MeshCleanup::RemoveUnusedAttributes(Mesh *mesh) {
         att->SetExplicitMapping(mesh->num_points());
       }
     }
-  }
+  });
 }
 
 Status MeshCleanup::MakeGeometryManifold(Mesh *mesh) {
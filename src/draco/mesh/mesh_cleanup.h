@@ -16,6 +16,7 @@
 #define DRACO_MESH_MESH_CLEANUP_H_
 
 #include "draco/core/status.h"
+#include "draco/core/thread_pool.h"
 #include "draco/draco_features.h"
 #include "draco/mesh/mesh.h"
 
@@ -49,10 +50,17 @@ class MeshCleanup {
   // Performs in-place cleanup of the input mesh according to the input options.
   static Status Cleanup(Mesh *mesh, const MeshCleanupOptions &options);
 
+  // Same as above but the work is processed in parallel on |pool| (can be
+  // nullptr). The result is the same as without the |pool|.
+  static Status Cleanup(Mesh *mesh, const MeshCleanupOptions &options,
+                        ThreadPool *pool);
+
  private:
-  static void RemoveDegeneratedFaces(Mesh *mesh);
-  static void RemoveDuplicateFaces(Mesh *mesh);
-  static void RemoveUnusedAttributes(Mesh *mesh);
+  // Removes degenerated and duplicate faces in a single sweep over the faces
+  // according to |options|.
+  static void RemoveDegeneratedAndDuplicateFaces(
+      Mesh *mesh, const MeshCleanupOptions &options, ThreadPool *pool);
+  static void RemoveUnusedAttributes(Mesh *mesh, ThreadPool *pool);
   static Status MakeGeometryManifold(Mesh *mesh);
 };
 
@@ -14,8 +14,12 @@
 //
 #include "draco/mesh/mesh_cleanup.h"
 
+#include <memory>
+#include <string>
+
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
 #include "draco/core/vector_d.h"
 #include "draco/mesh/triangle_soup_mesh_builder.h"
 
@@ -207,4 +211,50 @@ TEST_F(MeshCleanupTest, TestDuplicateFaces) {
   ASSERT_EQ(mesh->num_faces(), 3);
 }
 
+// Returns a mesh loaded from |file_name| with added rotated duplicates of some
+// faces and added degenerated faces.
+std::unique_ptr<Mesh> ReadMeshWithDuplicateFaces(const std::string &file_name) {
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile(file_name);
+  if (mesh == nullptr) {
+    return nullptr;
+  }
+  const int num_faces = mesh->num_faces();
+  for (FaceIndex f(0); f < num_faces; f += 3) {
+    const Mesh::Face face = mesh->face(f);
+    mesh->AddFace({face[1], face[2], face[0]});
+    mesh->AddFace({face[0], face[0], face[1]});
+  }
+  return mesh;
+}
+
+TEST_F(MeshCleanupTest, TestParallelCleanup) {
+  // This test verifies that the cleanup produces the same mesh with and
+  // without a thread pool.
+  std::unique_ptr<Mesh> expected_mesh =
+      ReadMeshWithDuplicateFaces("bunny_norm.obj");
+  ASSERT_NE(expected_mesh, nullptr);
+  std::unique_ptr<Mesh> mesh = ReadMeshWithDuplicateFaces("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  const int num_faces = ReadMeshFromTestFile("bunny_norm.obj")->num_faces();
+  const MeshCleanupOptions cleanup_options;
+  DRACO_ASSERT_OK(MeshCleanup::Cleanup(expected_mesh.get(), cleanup_options));
+  ASSERT_EQ(expected_mesh->num_faces(), num_faces);
+
+  ThreadPool pool(3);
+  DRACO_ASSERT_OK(MeshCleanup::Cleanup(mesh.get(), cleanup_options, &pool));
+  ASSERT_EQ(mesh->num_faces(), expected_mesh->num_faces());
+  ASSERT_EQ(mesh->num_points(), expected_mesh->num_points());
+  for (FaceIndex f(0); f < mesh->num_faces(); ++f) {
+    ASSERT_EQ(mesh->face(f), expected_mesh->face(f));
+  }
+  for (int a = 0; a < mesh->num_attributes(); ++a) {
+    const PointAttribute *const att = mesh->attribute(a);
+    const PointAttribute *const expected_att = expected_mesh->attribute(a);
+    ASSERT_EQ(att->size(), expected_att->size());
+    for (PointIndex p(0); p < mesh->num_points(); ++p) {
+      ASSERT_EQ(att->mapped_index(p), expected_att->mapped_index(p));
+    }
+  }
+}
+
 }  // namespace draco
@@ -15,8 +15,11 @@
 #ifndef DRACO_MESH_MESH_CONNECTED_COMPONENTS_H_
 #define DRACO_MESH_MESH_CONNECTED_COMPONENTS_H_
 
+#include <algorithm>
+#include <atomic>
 #include <vector>
 
+#include "draco/core/thread_pool.h"
 #include "draco/mesh/corner_table.h"
 
 namespace draco {
@@ -32,16 +35,19 @@ class MeshConnectedComponents {
   // method should be called before this one.
   template <class CornerTableT = CornerTable>
   void FindConnectedComponents(const CornerTableT *corner_table);
-  int NumConnectedComponents() const { return components_.size(); }
 
-  struct ConnectedComponent {
-    std::vector<int> vertices;
-    std::vector<int> faces;
-    std::vector<int> boundary_edges;
-  };
+  // Same as above but the components are found with a lock-free union-find
+  // over the opposite corners that is processed in parallel on |pool| (can be
+  // nullptr). The components are ordered in the same way as above, but the
+  // vertices, faces and boundary edges of each component are sorted by their
+  // ids instead of being stored in the traversal order. The result does not
+  // depend on the number of threads.
+  template <class CornerTableT = CornerTable>
+  void FindConnectedComponents(const CornerTableT *corner_table,
+                               ThreadPool *pool);
 
-  const ConnectedComponent &GetConnectedComponent(int index) const {
-    return components_[index];
+  int NumConnectedComponents() const {
+    return static_cast<int>(face_offsets_.size()) - 1;
   }
 
   // Returns the id of an component attached to a given vertex. Returns -1 when
@@ -52,12 +58,12 @@ class MeshConnectedComponents {
 
   // Returns the number of vertices that belong to the input component.
   int NumConnectedComponentVertices(int component_id) const {
-    return components_[component_id].vertices.size();
+    return vertex_offsets_[component_id + 1] - vertex_offsets_[component_id];
   }
 
   // Returns the i-th vertex of the input component.
   int GetConnectedComponentVertex(int component_id, int i) const {
-    return components_[component_id].vertices[i];
+    return vertices_[vertex_offsets_[component_id] + i];
   }
 
   // Returns the id of an component attached to a given face. Returns -1 when
@@ -68,35 +74,62 @@ class MeshConnectedComponents {
 
   // Returns the number of faces that belong to the input component.
   int NumConnectedComponentFaces(int component_id) const {
-    return components_[component_id].faces.size();
+    return face_offsets_[component_id + 1] - face_offsets_[component_id];
   }
 
   // Returns the i-th face of the input component.
   int GetConnectedComponentFace(int component_id, int i) const {
-    return components_[component_id].faces[i];
+    return faces_[face_offsets_[component_id] + i];
   }
 
   // Returns the number of boundary edges that belong to the input component.
   int NumConnectedComponentBoundaryEdges(int component_id) const {
-    return components_[component_id].boundary_edges.size();
+    return boundary_edge_offsets_[component_id + 1] -
+           boundary_edge_offsets_[component_id];
   }
 
   // Returns the i-th boundary edge of the input component.
   int GetConnectedComponentBoundaryEdge(int component_id, int i) const {
-    return components_[component_id].boundary_edges[i];
+    return boundary_edges_[boundary_edge_offsets_[component_id] + i];
   }
 
  private:
+  // Number of faces processed by a single task of the parallel loops.
+  static constexpr int kChunkSize = 1 << 14;
+
+  // Returns the root of the set containing |face_id| and shortens the path to
+  // the root on the way. Every face is linked to a face with a lower id.
+  static int FindRoot(std::vector<std::atomic<int>> *parents, int face_id);
+
+  // Stores |elements| of all components in the compressed sparse row format
+  // using |element_to_component_map|. Elements of each component are sorted.
+  static void BuildComponentElements(
+      int num_components, const std::vector<int> &element_to_component_map,
+      std::vector<int> *offsets, std::vector<int> *elements);
+
   std::vector<int> vertex_to_component_map_;
   std::vector<int> face_to_component_map_;
   std::vector<int> boundary_corner_to_component_map_;
-  std::vector<ConnectedComponent> components_;
+
+  // Vertices, faces and boundary edges of all components. Elements of the
+  // component i are stored in the range [offsets[i], offsets[i + 1]).
+  std::vector<int> vertices_;
+  std::vector<int> vertex_offsets_ = {0};
+  std::vector<int> faces_;
+  std::vector<int> face_offsets_ = {0};
+  std::vector<int> boundary_edges_;
+  std::vector<int> boundary_edge_offsets_ = {0};
 };
 
 template <class CornerTableT>
 void MeshConnectedComponents::FindConnectedComponents(
     const CornerTableT *corner_table) {
-  components_.clear();
+  vertices_.clear();
+  vertex_offsets_.assign(1, 0);
+  faces_.clear();
+  face_offsets_.assign(1, 0);
+  boundary_edges_.clear();
+  boundary_edge_offsets_.assign(1, 0);
   vertex_to_component_map_.assign(corner_table->num_vertices(), -1);
   face_to_component_map_.assign(corner_table->num_faces(), -1);
   boundary_corner_to_component_map_.assign(corner_table->num_corners(), -1);
@@ -112,15 +145,14 @@ void MeshConnectedComponents::FindConnectedComponents(
     if (corner_table->IsDegenerated(FaceIndex(face_id))) {
       continue;
     }
-    const int component_id = components_.size();
-    components_.push_back(ConnectedComponent());
+    const int component_id = NumConnectedComponents();
     face_stack.push_back(face_id);
     is_face_visited[face_id] = true;
     while (!face_stack.empty()) {
       const int act_face_id = face_stack.back();
       if (face_to_component_map_[act_face_id] == -1) {
         face_to_component_map_[act_face_id] = component_id;
-        components_[component_id].faces.push_back(act_face_id);
+        faces_.push_back(act_face_id);
       }
       face_stack.pop_back();
       // Gather all neighboring faces.
@@ -131,7 +163,7 @@ void MeshConnectedComponents::FindConnectedComponents(
         const int vertex_id = corner_table->Vertex(corners[c]).value();
         if (vertex_to_component_map_[vertex_id] == -1) {
           vertex_to_component_map_[vertex_id] = component_id;
-          components_[component_id].vertices.push_back(vertex_id);
+          vertices_.push_back(vertex_id);
         }
         // Traverse component to neighboring faces (add the faces to the stack).
         const CornerIndex opp_corner = corner_table->Opposite(corners[c]);
@@ -139,8 +171,7 @@ void MeshConnectedComponents::FindConnectedComponents(
           if (boundary_corner_to_component_map_[corners[c].value()] == -1) {
             boundary_corner_to_component_map_[corners[c].value()] =
                 component_id;
-            components_[component_id].boundary_edges.push_back(
-                corners[c].value());
+            boundary_edges_.push_back(corners[c].value());
           }
           continue;  // Invalid corner (mesh boundary).
         }
@@ -153,6 +184,184 @@ void MeshConnectedComponents::FindConnectedComponents(
         face_stack.push_back(opp_face_id);
       }
     }
+    // All elements of the component were appended.
+    vertex_offsets_.push_back(static_cast<int>(vertices_.size()));
+    face_offsets_.push_back(static_cast<int>(faces_.size()));
+    boundary_edge_offsets_.push_back(static_cast<int>(boundary_edges_.size()));
+  }
+}
+
+template <class CornerTableT>
+void MeshConnectedComponents::FindConnectedComponents(
+    const CornerTableT *corner_table, ThreadPool *pool) {
+  const int num_faces = corner_table->num_faces();
+  const int num_chunks = (num_faces + kChunkSize - 1) / kChunkSize;
+  std::vector<uint8_t> is_degenerated(num_faces);
+  std::vector<std::atomic<int>> parents(num_faces);
+  ParallelFor(pool, num_chunks, [&](int k) {
+    const int end = std::min(num_faces, (k + 1) * kChunkSize);
+    for (int f = k * kChunkSize; f < end; ++f) {
+      is_degenerated[f] = corner_table->IsDegenerated(FaceIndex(f));
+      parents[f].store(f, std::memory_order_relaxed);
+    }
+  });
+
+  // Merge the sets of all pairs of faces connected by opposite corners. The
+  // root of the set with the higher id is always linked to the other root, so
+  // each set ends up rooted at its face with the lowest id.
+  ParallelFor(pool, num_chunks, [&](int k) {
+    const int end = std::min(num_faces, (k + 1) * kChunkSize);
+    for (int f = k * kChunkSize; f < end; ++f) {
+      if (is_degenerated[f]) {
+        continue;
+      }
+      for (int c = 0; c < 3; ++c) {
+        const CornerIndex opp_corner =
+            corner_table->Opposite(CornerIndex(3 * f + c));
+        if (opp_corner == kInvalidCornerIndex) {
+          continue;
+        }
+        const int opp_face_id = corner_table->Face(opp_corner).value();
+        if (opp_face_id <= f || is_degenerated[opp_face_id]) {
+          continue;  // Each pair of faces is processed only once.
+        }
+        int root = FindRoot(&parents, f);
+        int opp_root = FindRoot(&parents, opp_face_id);
+        while (root != opp_root) {
+          if (root < opp_root) {
+            std::swap(root, opp_root);
+          }
+          int expected = root;
+          if (parents[root].compare_exchange_strong(expected, opp_root,
+                                                    std::memory_order_relaxed)) {
+            break;
+          }
+          // Another thread linked |root| in the meantime.
+          root = FindRoot(&parents, root);
+          opp_root = FindRoot(&parents, opp_root);
+        }
+      }
+    }
+  });
+
+  // Components are numbered in the order of their roots, i.e. in the order
+  // of their first faces, which is the same as in the traversal above.
+  std::vector<int> chunk_num_roots(num_chunks + 1, 0);
+  ParallelFor(pool, num_chunks, [&](int k) {
+    const int end = std::min(num_faces, (k + 1) * kChunkSize);
+    for (int f = k * kChunkSize; f < end; ++f) {
+      if (!is_degenerated[f] &&
+          parents[f].load(std::memory_order_relaxed) == f) {
+        ++chunk_num_roots[k + 1];
+      }
+    }
+  });
+  for (int k = 0; k < num_chunks; ++k) {
+    chunk_num_roots[k + 1] += chunk_num_roots[k];
+  }
+  face_to_component_map_.assign(num_faces, -1);
+  ParallelFor(pool, num_chunks, [&](int k) {
+    int component_id = chunk_num_roots[k];
+    const int end = std::min(num_faces, (k + 1) * kChunkSize);
+    for (int f = k * kChunkSize; f < end; ++f) {
+      if (!is_degenerated[f] &&
+          parents[f].load(std::memory_order_relaxed) == f) {
+        face_to_component_map_[f] = component_id++;
+      }
+    }
+  });
+  // Roots have lower ids than all other faces of their sets, so all roots are
+  // numbered before their faces are assigned here.
+  ParallelFor(pool, num_chunks, [&](int k) {
+    const int end = std::min(num_faces, (k + 1) * kChunkSize);
+    for (int f = k * kChunkSize; f < end; ++f) {
+      if (!is_degenerated[f]) {
+        face_to_component_map_[f] =
+            face_to_component_map_[FindRoot(&parents, f)];
+      }
+    }
+  });
+
+  // Vertices are assigned to the first component that uses them and
+  // boundary edges to the component of their face.
+  std::vector<std::atomic<int>> vertex_components(corner_table->num_vertices());
+  for (auto &component : vertex_components) {
+    component.store(-1, std::memory_order_relaxed);
+  }
+  boundary_corner_to_component_map_.assign(corner_table->num_corners(), -1);
+  ParallelFor(pool, num_chunks, [&](int k) {
+    const int end = std::min(num_faces, (k + 1) * kChunkSize);
+    for (int f = k * kChunkSize; f < end; ++f) {
+      const int component_id = face_to_component_map_[f];
+      if (component_id == -1) {
+        continue;
+      }
+      for (int c = 3 * f; c < 3 * f + 3; ++c) {
+        const CornerIndex corner(c);
+        if (corner_table->Opposite(corner) == kInvalidCornerIndex) {
+          boundary_corner_to_component_map_[c] = component_id;
+        }
+        std::atomic<int> &vertex_component =
+            vertex_components[corner_table->Vertex(corner).value()];
+        int current = vertex_component.load(std::memory_order_relaxed);
+        while ((current == -1 || current > component_id) &&
+               !vertex_component.compare_exchange_weak(
+                   current, component_id, std::memory_order_relaxed)) {
+        }
+      }
+    }
+  });
+  vertex_to_component_map_.resize(vertex_components.size());
+  for (size_t i = 0; i < vertex_components.size(); ++i) {
+    vertex_to_component_map_[i] =
+        vertex_components[i].load(std::memory_order_relaxed);
+  }
+
+  const int num_components = chunk_num_roots[num_chunks];
+  BuildComponentElements(num_components, vertex_to_component_map_,
+                         &vertex_offsets_, &vertices_);
+  BuildComponentElements(num_components, face_to_component_map_,
+                         &face_offsets_, &faces_);
+  BuildComponentElements(num_components, boundary_corner_to_component_map_,
+                         &boundary_edge_offsets_, &boundary_edges_);
+}
+
+inline int MeshConnectedComponents::FindRoot(
+    std::vector<std::atomic<int>> *parents, int face_id) {
+  while (true) {
+    int parent = (*parents)[face_id].load(std::memory_order_relaxed);
+    if (parent == face_id) {
+      return face_id;
+    }
+    const int grandparent = (*parents)[parent].load(std::memory_order_relaxed);
+    if (grandparent != parent) {
+      // Path halving. Failures are harmless because links only decrease.
+      (*parents)[face_id].compare_exchange_weak(parent, grandparent,
+                                                std::memory_order_relaxed);
+    }
+    face_id = grandparent;
+  }
+}
+
+inline void MeshConnectedComponents::BuildComponentElements(
+    int num_components, const std::vector<int> &element_to_component_map,
+    std::vector<int> *offsets, std::vector<int> *elements) {
+  offsets->assign(num_components + 1, 0);
+  for (const int component_id : element_to_component_map) {
+    if (component_id != -1) {
+      ++(*offsets)[component_id + 1];
+    }
+  }
+  for (int i = 0; i < num_components; ++i) {
+    (*offsets)[i + 1] += (*offsets)[i];
+  }
+  elements->resize(offsets->back());
+  std::vector<int> next_element(offsets->begin(), offsets->end() - 1);
+  for (int i = 0; i < static_cast<int>(element_to_component_map.size()); ++i) {
+    const int component_id = element_to_component_map[i];
+    if (component_id != -1) {
+      (*elements)[next_element[component_id]++] = i;
+    }
   }
 }
 
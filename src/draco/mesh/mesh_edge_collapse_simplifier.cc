@@ -0,0 +1,439 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_edge_collapse_simplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "draco/core/vector_d.h"
+#include "draco/mesh/corner_table.h"
+#include "draco/mesh/corner_table_iterators.h"
+#include "draco/mesh/mesh_cleanup.h"
+#include "draco/mesh/mesh_misc_functions.h"
+
+namespace draco {
+
+namespace {
+
+typedef VectorD<double, 3> Vector3d;
+
+// Quadric error of a vertex stored as the upper triangle of a symmetric 4x4
+// matrix.
+class Quadric {
+ public:
+  Quadric() : q_() {}
+
+  // Adds the squared distance to the plane with unit |normal| and offset |d|
+  // weighted by |weight|.
+  void AddPlane(const Vector3d &normal, double d, double weight) {
+    const double p[4] = {normal[0], normal[1], normal[2], d};
+    int k = 0;
+    for (int i = 0; i < 4; ++i) {
+      for (int j = i; j < 4; ++j) {
+        q_[k++] += weight * p[i] * p[j];
+      }
+    }
+  }
+
+  Quadric &operator+=(const Quadric &other) {
+    for (int i = 0; i < 10; ++i) {
+      q_[i] += other.q_[i];
+    }
+    return *this;
+  }
+
+  // Returns the error of position |v|.
+  double Evaluate(const Vector3d &v) const {
+    const double p[4] = {v[0], v[1], v[2], 1.0};
+    double error = 0.0;
+    int k = 0;
+    for (int i = 0; i < 4; ++i) {
+      for (int j = i; j < 4; ++j) {
+        error += (i == j ? 1.0 : 2.0) * q_[k++] * p[i] * p[j];
+      }
+    }
+    return error;
+  }
+
+ private:
+  double q_[10];
+};
+
+// Collapse of vertex |from| onto vertex |to|.
+struct EdgeCollapse {
+  double cost;
+  VertexIndex from;
+  VertexIndex to;
+  // Versions of the vertices at the time the collapse was evaluated.
+  uint32_t from_version;
+  uint32_t to_version;
+
+  bool operator>(const EdgeCollapse &other) const {
+    if (cost != other.cost) {
+      return cost > other.cost;
+    }
+    return std::make_pair(from, to) > std::make_pair(other.from, other.to);
+  }
+};
+
+class EdgeCollapser {
+ public:
+  explicit EdgeCollapser(const Mesh &mesh) : mesh_(mesh), num_faces_(0) {}
+
+  Status Init();
+
+  // Collapses edges until the mesh has at most |target_num_faces| faces.
+  void Collapse(int target_num_faces);
+
+  // Returns a copy of the source mesh with the remaining faces.
+  StatusOr<std::unique_ptr<Mesh>> BuildMesh() const;
+
+ private:
+  // Adds all collapses of vertex |v| onto its neighbors and of its neighbors
+  // onto |v| to the queue.
+  void AddVertexCollapses(VertexIndex v);
+  void AddCollapse(VertexIndex from, VertexIndex to);
+
+  // Collapses the edge if the collapse keeps the mesh valid. Returns false
+  // when the collapse was rejected.
+  bool TryCollapse(VertexIndex from, VertexIndex to);
+
+  // Returns the sorted neighbors of vertex |v|.
+  void GetNeighbors(VertexIndex v, std::vector<VertexIndex> *neighbors) const;
+
+  // Updates the left most corner of vertex |v| after the removal of faces,
+  // using any of the |candidates| corners that are on faces adjacent to |v|.
+  void UpdateVertexCorner(VertexIndex v,
+                          const std::vector<CornerIndex> &candidates);
+
+  const Mesh &mesh_;
+  std::unique_ptr<CornerTable> corner_table_;
+  // Point of each corner.
+  IndexTypeVector<CornerIndex, PointIndex> corner_points_;
+  IndexTypeVector<VertexIndex, Vector3d> positions_;
+  IndexTypeVector<VertexIndex, Quadric> quadrics_;
+  IndexTypeVector<VertexIndex, uint32_t> versions_;
+  // Vertices that must not be removed.
+  IndexTypeVector<VertexIndex, bool> is_locked_;
+  std::priority_queue<EdgeCollapse, std::vector<EdgeCollapse>,
+                      std::greater<EdgeCollapse>>
+      queue_;
+  int num_faces_;
+
+  // Temporary storage.
+  std::vector<CornerIndex> from_corners_;
+  std::vector<VertexIndex> from_neighbors_;
+  std::vector<VertexIndex> to_neighbors_;
+  std::vector<VertexIndex> shared_neighbors_;
+};
+
+Status EdgeCollapser::Init() {
+  const PointAttribute *const pos_att =
+      mesh_.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (pos_att == nullptr) {
+    return Status(Status::DRACO_ERROR, "Mesh has no position attribute.");
+  }
+  corner_table_ = CreateCornerTableFromPositionAttribute(&mesh_);
+  if (corner_table_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "Failed to create corner table.");
+  }
+  const int num_vertices = corner_table_->num_vertices();
+  corner_points_.resize(corner_table_->num_corners());
+  positions_.resize(num_vertices);
+  quadrics_.resize(num_vertices);
+  versions_.resize(num_vertices, 0);
+  is_locked_.resize(num_vertices, false);
+
+  // Vertices that were split from non-manifold vertices share their position
+  // with the original vertex and both are locked.
+  for (VertexIndex v(corner_table_->NumOriginalVertices()); v < num_vertices;
+       ++v) {
+    is_locked_[v] = true;
+    is_locked_[corner_table_->VertexParent(v)] = true;
+  }
+
+  IndexTypeVector<VertexIndex, PointIndex> vertex_points(num_vertices,
+                                                         kInvalidPointIndex);
+  Vector3d pos[3];
+  for (FaceIndex f(0); f < mesh_.num_faces(); ++f) {
+    if (corner_table_->IsDegenerated(f)) {
+      continue;
+    }
+    ++num_faces_;
+    const CornerIndex first_corner = corner_table_->FirstCorner(f);
+    for (int c = 0; c < 3; ++c) {
+      const PointIndex pi = mesh_.face(f)[c];
+      const VertexIndex v = corner_table_->Vertex(first_corner + c);
+      corner_points_[first_corner + c] = pi;
+      pos_att->ConvertValue<double, 3>(pos_att->mapped_index(pi), &pos[c][0]);
+      positions_[v] = pos[c];
+      // Vertices whose corners map to different points are on a seam.
+      if (vertex_points[v] == kInvalidPointIndex) {
+        vertex_points[v] = pi;
+      } else if (vertex_points[v] != pi) {
+        is_locked_[v] = true;
+      }
+    }
+
+    // Accumulate the area weighted plane of the face to its vertices.
+    Vector3d normal = CrossProduct(pos[1] - pos[0], pos[2] - pos[0]);
+    const double length = std::sqrt(normal.SquaredNorm());
+    if (length == 0.0) {
+      continue;
+    }
+    normal = normal / length;
+    const double d = -normal.Dot(pos[0]);
+    for (int c = 0; c < 3; ++c) {
+      quadrics_[corner_table_->Vertex(first_corner + c)].AddPlane(
+          normal, d, 0.5 * length);
+    }
+  }
+
+  for (VertexIndex v(0); v < num_vertices; ++v) {
+    if (corner_table_->IsVertexIsolated(v)) {
+      is_locked_[v] = true;
+    } else if (corner_table_->IsOnBoundary(v)) {
+      is_locked_[v] = true;
+    }
+  }
+  for (VertexIndex v(0); v < num_vertices; ++v) {
+    if (is_locked_[v]) {
+      continue;
+    }
+    GetNeighbors(v, &to_neighbors_);
+    for (const VertexIndex &n : to_neighbors_) {
+      AddCollapse(v, n);
+    }
+  }
+  return OkStatus();
+}
+
+void EdgeCollapser::Collapse(int target_num_faces) {
+  while (num_faces_ > target_num_faces && !queue_.empty()) {
+    const EdgeCollapse collapse = queue_.top();
+    queue_.pop();
+    if (collapse.from_version != versions_[collapse.from] ||
+        collapse.to_version != versions_[collapse.to]) {
+      continue;  // Outdated collapse.
+    }
+    if (!TryCollapse(collapse.from, collapse.to)) {
+      continue;
+    }
+    num_faces_ -= 2;
+    quadrics_[collapse.to] += quadrics_[collapse.from];
+    ++versions_[collapse.from];
+    ++versions_[collapse.to];
+    AddVertexCollapses(collapse.to);
+  }
+}
+
+void EdgeCollapser::AddVertexCollapses(VertexIndex v) {
+  GetNeighbors(v, &to_neighbors_);
+  for (const VertexIndex &n : to_neighbors_) {
+    AddCollapse(v, n);
+    AddCollapse(n, v);
+  }
+}
+
+void EdgeCollapser::AddCollapse(VertexIndex from, VertexIndex to) {
+  if (is_locked_[from]) {
+    return;
+  }
+  Quadric quadric = quadrics_[from];
+  quadric += quadrics_[to];
+  queue_.push({quadric.Evaluate(positions_[to]), from, to, versions_[from],
+               versions_[to]});
+}
+
+void EdgeCollapser::GetNeighbors(VertexIndex v,
+                                 std::vector<VertexIndex> *neighbors) const {
+  neighbors->clear();
+  for (VertexCornersIterator<CornerTable> it(corner_table_.get(), v);
+       !it.End(); it.Next()) {
+    const CornerIndex c = it.Corner();
+    neighbors->push_back(corner_table_->Vertex(corner_table_->Next(c)));
+    neighbors->push_back(corner_table_->Vertex(corner_table_->Previous(c)));
+  }
+  std::sort(neighbors->begin(), neighbors->end());
+  neighbors->erase(std::unique(neighbors->begin(), neighbors->end()),
+                   neighbors->end());
+}
+
+bool EdgeCollapser::TryCollapse(VertexIndex from, VertexIndex to) {
+  const CornerTable &ct = *corner_table_;
+
+  // Find the corners of |from| on the two faces adjacent to the edge. Face 0
+  // contains the edge as from -> to, face 1 as to -> from.
+  CornerIndex c0 = kInvalidCornerIndex;
+  CornerIndex c1 = kInvalidCornerIndex;
+  from_corners_.clear();
+  for (VertexCornersIterator<CornerTable> it(&ct, from); !it.End();
+       it.Next()) {
+    const CornerIndex c = it.Corner();
+    from_corners_.push_back(c);
+    if (ct.Vertex(ct.Next(c)) == to) {
+      c0 = c;
+    } else if (ct.Vertex(ct.Previous(c)) == to) {
+      c1 = c;
+    }
+  }
+  if (c0 == kInvalidCornerIndex || c1 == kInvalidCornerIndex) {
+    return false;
+  }
+  const VertexIndex a = ct.Vertex(ct.Previous(c0));
+  const VertexIndex b = ct.Vertex(ct.Next(c1));
+  if (a == b) {
+    return false;
+  }
+
+  // Link condition: the only vertices connected to both ends of the edge must
+  // be the opposite vertices of the two adjacent faces. Collapses of edges of
+  // a tetrahedron are also rejected.
+  GetNeighbors(from, &from_neighbors_);
+  GetNeighbors(to, &to_neighbors_);
+  shared_neighbors_.clear();
+  std::set_intersection(from_neighbors_.begin(), from_neighbors_.end(),
+                        to_neighbors_.begin(), to_neighbors_.end(),
+                        std::back_inserter(shared_neighbors_));
+  if (shared_neighbors_.size() != 2 ||
+      from_neighbors_.size() + to_neighbors_.size() - 2 <= 4) {
+    return false;
+  }
+
+  // The corners of |to| on the adjacent faces must map to the same point,
+  // which then replaces the point of |from|.
+  const PointIndex to_point = corner_points_[ct.Next(c0)];
+  if (corner_points_[ct.Previous(c1)] != to_point) {
+    return false;
+  }
+
+  // Reject collapses that flip or degenerate any of the remaining faces.
+  const FaceIndex f0 = ct.Face(c0);
+  const FaceIndex f1 = ct.Face(c1);
+  for (const CornerIndex &c : from_corners_) {
+    const FaceIndex f = ct.Face(c);
+    if (f == f0 || f == f1) {
+      continue;
+    }
+    const Vector3d &p1 = positions_[ct.Vertex(ct.Next(c))];
+    const Vector3d &p2 = positions_[ct.Vertex(ct.Previous(c))];
+    const Vector3d old_normal =
+        CrossProduct(p1 - positions_[from], p2 - positions_[from]);
+    const Vector3d new_normal =
+        CrossProduct(p1 - positions_[to], p2 - positions_[to]);
+    if (new_normal.Dot(old_normal) <= 0.0) {
+      return false;
+    }
+  }
+
+  // Connect the faces on the outer sides of the two removed faces.
+  const CornerIndex x0 = ct.Opposite(c0);
+  const CornerIndex y0 = ct.Opposite(ct.Next(c0));
+  const CornerIndex x1 = ct.Opposite(c1);
+  const CornerIndex y1 = ct.Opposite(ct.Previous(c1));
+  corner_table_->SetOppositeCorners(x0, y0);
+  corner_table_->SetOppositeCorners(x1, y1);
+  for (const CornerIndex &c : from_corners_) {
+    corner_table_->MapCornerToVertex(c, to);
+    corner_points_[c] = to_point;
+  }
+  corner_table_->MakeFaceInvalid(f0);
+  corner_table_->MakeFaceInvalid(f1);
+  corner_table_->MakeVertexIsolated(from);
+  const std::vector<CornerIndex> candidates = {x0, y0, x1, y1};
+  UpdateVertexCorner(to, candidates);
+  UpdateVertexCorner(a, candidates);
+  UpdateVertexCorner(b, candidates);
+  return true;
+}
+
+void EdgeCollapser::UpdateVertexCorner(
+    VertexIndex v, const std::vector<CornerIndex> &candidates) {
+  const CornerTable &ct = *corner_table_;
+  for (const CornerIndex &candidate : candidates) {
+    if (candidate == kInvalidCornerIndex) {
+      continue;
+    }
+    for (const CornerIndex &c :
+         {candidate, ct.Next(candidate), ct.Previous(candidate)}) {
+      if (ct.Vertex(c) == v) {
+        corner_table_->SetLeftMostCorner(v, c);
+        corner_table_->UpdateVertexToCornerMap(v);
+        return;
+      }
+    }
+  }
+  // All faces of the vertex were removed.
+  corner_table_->MakeVertexIsolated(v);
+}
+
+StatusOr<std::unique_ptr<Mesh>> EdgeCollapser::BuildMesh() const {
+  std::unique_ptr<Mesh> out_mesh(new Mesh());
+#ifdef DRACO_TRANSCODER_SUPPORTED
+  out_mesh->Copy(mesh_);
+#else
+  out_mesh->set_num_points(mesh_.num_points());
+  for (int i = 0; i < mesh_.num_attributes(); ++i) {
+    std::unique_ptr<PointAttribute> att(new PointAttribute());
+    att->CopyFrom(*mesh_.attribute(i));
+    const int att_id = out_mesh->AddAttribute(std::move(att));
+    out_mesh->attribute(att_id)->set_unique_id(mesh_.attribute(i)->unique_id());
+  }
+#endif
+  FaceIndex num_out_faces(0);
+  for (FaceIndex f(0); f < mesh_.num_faces(); ++f) {
+    const CornerIndex first_corner = corner_table_->FirstCorner(f);
+    if (corner_table_->Vertex(first_corner) == kInvalidVertexIndex) {
+      continue;  // Removed face.
+    }
+    Mesh::Face face;
+    for (int c = 0; c < 3; ++c) {
+      face[c] = corner_points_[first_corner + c];
+    }
+    if (corner_table_->IsDegenerated(f)) {
+      // Degenerate source faces are kept as they were.
+      face = mesh_.face(f);
+    }
+    out_mesh->SetFace(num_out_faces++, face);
+  }
+  out_mesh->SetNumFaces(num_out_faces.value());
+
+  // Remove points that are not used by any face.
+  MeshCleanupOptions cleanup_options;
+  cleanup_options.remove_degenerated_faces = false;
+  cleanup_options.remove_duplicate_faces = false;
+  DRACO_RETURN_IF_ERROR(MeshCleanup::Cleanup(out_mesh.get(), cleanup_options));
+  return std::move(out_mesh);
+}
+
+}  // namespace
+
+StatusOr<std::unique_ptr<Mesh>> MeshEdgeCollapseSimplifier::Simplify(
+    const Mesh &mesh, int target_num_faces) {
+  if (target_num_faces < 0) {
+    return Status(Status::DRACO_ERROR, "Invalid target number of faces.");
+  }
+  EdgeCollapser collapser(mesh);
+  DRACO_RETURN_IF_ERROR(collapser.Init());
+  collapser.Collapse(target_num_faces);
+  return collapser.BuildMesh();
+}
+
+}  // namespace draco
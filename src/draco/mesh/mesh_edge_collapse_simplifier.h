@@ -0,0 +1,49 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_MESH_MESH_EDGE_COLLAPSE_SIMPLIFIER_H_
+#define DRACO_MESH_MESH_EDGE_COLLAPSE_SIMPLIFIER_H_
+
+#include <memory>
+
+#include "draco/core/status_or.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Simplifies meshes by collapsing edges in the order given by the quadric
+// error metric of Garland and Heckbert. Every collapse moves one vertex onto
+// the other vertex of the edge (half-edge collapse), so the simplified mesh
+// uses a subset of the points of the source mesh and no attribute values are
+// interpolated.
+//
+// Vertices on attribute seams, i.e. vertices whose corners map to more than
+// one point, vertices on mesh boundaries and non-manifold vertices are never
+// removed, which keeps seams and boundaries intact. Collapses that would make
+// the connectivity non-manifold or flip faces are skipped. As a result, the
+// target face count may not be reached for meshes with many seams.
+class MeshEdgeCollapseSimplifier {
+ public:
+  // Simplifies |mesh| until it has at most |target_num_faces| faces or until
+  // no more edges can be collapsed. The returned mesh has the remaining faces
+  // and the attributes of |mesh| without unused points. All attributes keep
+  // the unique ids of the source attributes. When the transcoder is enabled,
+  // materials, metadata and mesh features are copied as well.
+  static StatusOr<std::unique_ptr<Mesh>> Simplify(const Mesh &mesh,
+                                                  int target_num_faces);
+};
+
+}  // namespace draco
+
+#endif  // DRACO_MESH_MESH_EDGE_COLLAPSE_SIMPLIFIER_H_
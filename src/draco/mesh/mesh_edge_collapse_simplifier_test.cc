@@ -0,0 +1,80 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_edge_collapse_simplifier.h"
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/mesh/corner_table.h"
+#include "draco/mesh/mesh_misc_functions.h"
+
+namespace {
+
+class MeshEdgeCollapseSimplifierTest : public ::testing::Test {};
+
+TEST_F(MeshEdgeCollapseSimplifierTest, TestSimplify) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  const int target_num_faces = mesh->num_faces() / 4;
+  DRACO_ASSIGN_OR_ASSERT(
+      const std::unique_ptr<draco::Mesh> simplified,
+      draco::MeshEdgeCollapseSimplifier::Simplify(*mesh, target_num_faces));
+  ASSERT_NE(simplified, nullptr);
+  ASSERT_LE(simplified->num_faces(), target_num_faces);
+  ASSERT_GT(simplified->num_faces(), target_num_faces - 2);
+  ASSERT_LT(simplified->num_points(), mesh->num_points() / 3);
+  ASSERT_EQ(simplified->num_attributes(), mesh->num_attributes());
+
+  // Vertices are only moved onto other source vertices, so the bounds can't
+  // grow.
+  const draco::BoundingBox bounds = mesh->ComputeBoundingBox();
+  const draco::BoundingBox simplified_bounds =
+      simplified->ComputeBoundingBox();
+  for (int c = 0; c < 3; ++c) {
+    ASSERT_GE(simplified_bounds.GetMinPoint()[c], bounds.GetMinPoint()[c]);
+    ASSERT_LE(simplified_bounds.GetMaxPoint()[c], bounds.GetMaxPoint()[c]);
+  }
+
+  // The simplified mesh must stay manifold and free of degenerate faces.
+  const std::unique_ptr<draco::CornerTable> corner_table =
+      draco::CreateCornerTableFromPositionAttribute(simplified.get());
+  ASSERT_NE(corner_table, nullptr);
+  ASSERT_EQ(corner_table->NumNewVertices(), 0);
+  ASSERT_EQ(corner_table->NumDegeneratedFaces(), 0);
+}
+
+TEST_F(MeshEdgeCollapseSimplifierTest, TestSeamsArePreserved) {
+  // All vertices of the cube are on normal seams, so nothing can be
+  // collapsed.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  DRACO_ASSIGN_OR_ASSERT(
+      const std::unique_ptr<draco::Mesh> simplified,
+      draco::MeshEdgeCollapseSimplifier::Simplify(*mesh, 0));
+  ASSERT_EQ(simplified->num_faces(), mesh->num_faces());
+  ASSERT_EQ(simplified->num_points(), mesh->num_points());
+}
+
+TEST_F(MeshEdgeCollapseSimplifierTest, TestInvalidInput) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  ASSERT_FALSE(draco::MeshEdgeCollapseSimplifier::Simplify(*mesh, -1).ok());
+  draco::Mesh empty_mesh;
+  ASSERT_FALSE(draco::MeshEdgeCollapseSimplifier::Simplify(empty_mesh, 0).ok());
+}
+
+}  // namespace
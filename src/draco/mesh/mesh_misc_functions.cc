@@ -14,15 +14,29 @@
 //
 #include "draco/mesh/mesh_misc_functions.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace draco {
 
 std::unique_ptr<CornerTable> CreateCornerTableFromPositionAttribute(
     const Mesh *mesh) {
-  return CreateCornerTableFromAttribute(mesh, GeometryAttribute::POSITION);
+  return CreateCornerTableFromPositionAttribute(mesh, nullptr);
+}
+
+std::unique_ptr<CornerTable> CreateCornerTableFromPositionAttribute(
+    const Mesh *mesh, ThreadPool *pool) {
+  return CreateCornerTableFromAttribute(mesh, GeometryAttribute::POSITION,
+                                        pool);
 }
 
 std::unique_ptr<CornerTable> CreateCornerTableFromAttribute(
     const Mesh *mesh, GeometryAttribute::Type type) {
+  return CreateCornerTableFromAttribute(mesh, type, nullptr);
+}
+
+std::unique_ptr<CornerTable> CreateCornerTableFromAttribute(
+    const Mesh *mesh, GeometryAttribute::Type type, ThreadPool *pool) {
   typedef CornerTable::FaceType FaceType;
 
   const PointAttribute *const att = mesh->GetNamedAttribute(type);
@@ -40,11 +54,16 @@ std::unique_ptr<CornerTable> CreateCornerTableFromAttribute(
     faces[FaceIndex(i)] = new_face;
   }
   // Build the corner table.
-  return CornerTable::Create(faces);
+  return CornerTable::Create(faces, pool);
 }
 
 std::unique_ptr<CornerTable> CreateCornerTableFromAllAttributes(
     const Mesh *mesh) {
+  return CreateCornerTableFromAllAttributes(mesh, nullptr);
+}
+
+std::unique_ptr<CornerTable> CreateCornerTableFromAllAttributes(
+    const Mesh *mesh, ThreadPool *pool) {
   typedef CornerTable::FaceType FaceType;
   IndexTypeVector<FaceIndex, FaceType> faces(mesh->num_faces());
   FaceType new_face;
@@ -58,6 +77,65 @@ std::unique_ptr<CornerTable> CreateCornerTableFromAllAttributes(
     faces[i] = new_face;
   }
   // Build the corner table.
-  return CornerTable::Create(faces);
+  return CornerTable::Create(faces, pool);
+}
+
+std::unique_ptr<Mesh> CreateSubmesh(const Mesh &mesh,
+                                    const std::vector<FaceIndex> &faces) {
+  std::vector<PointIndex> points;
+  points.reserve(3 * faces.size());
+  for (const FaceIndex fi : faces) {
+    for (int c = 0; c < 3; ++c) {
+      points.push_back(mesh.face(fi)[c]);
+    }
+  }
+  std::sort(points.begin(), points.end());
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+
+  std::unique_ptr<Mesh> submesh(new Mesh());
+  submesh->set_num_points(static_cast<uint32_t>(points.size()));
+  submesh->SetNumFaces(faces.size());
+  for (size_t f = 0; f < faces.size(); ++f) {
+    Mesh::Face face;
+    for (int c = 0; c < 3; ++c) {
+      face[c] = PointIndex(static_cast<uint32_t>(
+          std::lower_bound(points.begin(), points.end(),
+                           mesh.face(faces[f])[c]) -
+          points.begin()));
+    }
+    submesh->SetFace(FaceIndex(static_cast<uint32_t>(f)), face);
+  }
+
+  std::vector<AttributeValueIndex> point_values(points.size());
+  std::vector<AttributeValueIndex> values;
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    const PointAttribute *const src_att = mesh.attribute(i);
+    for (size_t p = 0; p < points.size(); ++p) {
+      point_values[p] = src_att->mapped_index(points[p]);
+    }
+    values = point_values;
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+
+    std::unique_ptr<PointAttribute> att(
+        new PointAttribute(static_cast<const GeometryAttribute &>(*src_att)));
+    att->Reset(values.size());
+    for (size_t v = 0; v < values.size(); ++v) {
+      att->SetAttributeValue(AttributeValueIndex(static_cast<uint32_t>(v)),
+                             src_att->GetAddress(values[v]));
+    }
+    att->SetExplicitMapping(points.size());
+    for (size_t p = 0; p < points.size(); ++p) {
+      att->SetPointMapEntry(
+          PointIndex(static_cast<uint32_t>(p)),
+          AttributeValueIndex(static_cast<uint32_t>(
+              std::lower_bound(values.begin(), values.end(), point_values[p]) -
+              values.begin())));
+    }
+    const int att_id = submesh->AddAttribute(std::move(att));
+    submesh->attribute(att_id)->set_unique_id(src_att->unique_id());
+  }
+  return submesh;
 }
+
 }  // namespace draco
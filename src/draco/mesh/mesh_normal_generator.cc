@@ -0,0 +1,250 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_normal_generator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "draco/core/vector_d.h"
+#include "draco/mesh/mesh_misc_functions.h"
+
+namespace draco {
+
+namespace {
+
+// Number of faces or vertices processed by a single parallel task.
+constexpr int kChunkSize = 1 << 14;
+
+// Runs |func| for all indices in [0, |num_elements|) in chunks on |pool|.
+template <class FunctionT>
+void ParallelForChunks(ThreadPool *pool, int num_elements,
+                       const FunctionT &func) {
+  const int num_chunks = (num_elements + kChunkSize - 1) / kChunkSize;
+  ParallelFor(pool, num_chunks, [&](int chunk) {
+    const int begin = chunk * kChunkSize;
+    const int end = std::min(begin + kChunkSize, num_elements);
+    for (int i = begin; i < end; ++i) {
+      func(i);
+    }
+  });
+}
+
+// Stores the corners of the 1-ring of |v| into |corners| ordered by swinging
+// right from the left-most corner. Returns true when the 1-ring is closed.
+bool GetOrderedVertexCorners(const CornerTable &corner_table, VertexIndex v,
+                             std::vector<CornerIndex> *corners) {
+  corners->clear();
+  const CornerIndex first_corner = corner_table.LeftMostCorner(v);
+  if (first_corner == kInvalidCornerIndex) {
+    return false;
+  }
+  CornerIndex c = first_corner;
+  do {
+    corners->push_back(c);
+    c = corner_table.SwingRight(c);
+  } while (c != kInvalidCornerIndex && c != first_corner);
+  return c == first_corner;
+}
+
+}  // namespace
+
+Status MeshNormalGenerator::GenerateNormals(Mesh *mesh, float crease_angle,
+                                            ThreadPool *pool) {
+  const PointAttribute *const pos_att =
+      mesh->GetNamedAttribute(GeometryAttribute::POSITION);
+  if (pos_att == nullptr || pos_att->num_components() != 3) {
+    return Status(Status::DRACO_ERROR, "Normals require 3D positions.");
+  }
+  const int num_faces = mesh->num_faces();
+  if (num_faces == 0) {
+    return Status(Status::DRACO_ERROR, "Mesh has no faces.");
+  }
+  std::unique_ptr<CornerTable> corner_table =
+      CreateCornerTableFromPositionAttribute(mesh);
+  if (corner_table == nullptr) {
+    return Status(Status::DRACO_ERROR, "Failed to create the corner table.");
+  }
+
+  // Area weighted face normals.
+  std::vector<Vector3f> face_normals(num_faces);
+  ParallelForChunks(pool, num_faces, [&](int f) {
+    const Mesh::Face &face = mesh->face(FaceIndex(f));
+    Vector3f positions[3];
+    for (int c = 0; c < 3; ++c) {
+      pos_att->GetMappedValue(face[c], &positions[c][0]);
+    }
+    face_normals[f] =
+        CrossProduct(positions[1] - positions[0], positions[2] - positions[0]);
+  });
+  const float cos_crease_angle = std::cos(crease_angle);
+  const auto is_crease = [&](CornerIndex c0, CornerIndex c1) {
+    const Vector3f &n0 = face_normals[corner_table->Face(c0).value()];
+    const Vector3f &n1 = face_normals[corner_table->Face(c1).value()];
+    return n0.Dot(n1) <
+           cos_crease_angle * std::sqrt(n0.SquaredNorm() * n1.SquaredNorm());
+  };
+
+  // Split the 1-ring of each vertex into smooth fans. |corner_fans| stores the
+  // fan of each corner within the 1-ring of its vertex.
+  const int num_vertices = corner_table->num_vertices();
+  std::vector<int> vertex_fan_offsets(num_vertices + 1, 0);
+  std::vector<int> corner_fans(corner_table->num_corners(), 0);
+  const int num_chunks = (num_vertices + kChunkSize - 1) / kChunkSize;
+  ParallelFor(pool, num_chunks, [&](int chunk) {
+    const int begin = chunk * kChunkSize;
+    const int end = std::min(begin + kChunkSize, num_vertices);
+    std::vector<CornerIndex> corners;
+    for (int v = begin; v < end; ++v) {
+      const bool is_closed =
+          GetOrderedVertexCorners(*corner_table, VertexIndex(v), &corners);
+      int fan = 0;
+      for (int i = 0; i < static_cast<int>(corners.size()); ++i) {
+        if (i > 0 && is_crease(corners[i - 1], corners[i])) {
+          ++fan;
+        }
+        corner_fans[corners[i].value()] = fan;
+      }
+      if (is_closed && fan > 0 && !is_crease(corners.back(), corners[0])) {
+        // The last fan continues into the first one.
+        for (int i = static_cast<int>(corners.size()) - 1;
+             i >= 0 && corner_fans[corners[i].value()] == fan; --i) {
+          corner_fans[corners[i].value()] = 0;
+        }
+        --fan;
+      }
+      vertex_fan_offsets[v + 1] = corners.empty() ? 0 : fan + 1;
+    }
+  });
+  for (int v = 0; v < num_vertices; ++v) {
+    vertex_fan_offsets[v + 1] += vertex_fan_offsets[v];
+  }
+  const int num_fans = vertex_fan_offsets[num_vertices];
+  const auto get_corner_fan = [&](CornerIndex c) {
+    return vertex_fan_offsets[corner_table->Vertex(c).value()] +
+           corner_fans[c.value()];
+  };
+
+  // Sum the face normals of each fan.
+  std::vector<Vector3f> fan_normals(num_fans, Vector3f(0.f, 0.f, 0.f));
+  ParallelFor(pool, num_chunks, [&](int chunk) {
+    const int begin = chunk * kChunkSize;
+    const int end = std::min(begin + kChunkSize, num_vertices);
+    std::vector<CornerIndex> corners;
+    for (int v = begin; v < end; ++v) {
+      GetOrderedVertexCorners(*corner_table, VertexIndex(v), &corners);
+      for (const CornerIndex &c : corners) {
+        fan_normals[get_corner_fan(c)] +=
+            face_normals[corner_table->Face(c).value()];
+      }
+    }
+  });
+  ParallelForChunks(pool, num_fans, [&](int fan) {
+    Vector3f &n = fan_normals[fan];
+    const float length = std::sqrt(n.SquaredNorm());
+    n = length > 0.f ? n / length : Vector3f(0.f, 0.f, 1.f);
+  });
+
+  // Assign fans to points. Points used by more than one fan are split and the
+  // new points share all other attribute values with the original point.
+  const int num_original_points = mesh->num_points();
+  std::vector<int> point_fans(num_original_points, -1);
+  std::vector<std::pair<PointIndex, int>> split_points;
+  // Lists of the split points of each original point.
+  std::vector<int> first_split_points(num_original_points, -1);
+  std::vector<int> next_split_points;
+  for (FaceIndex f(0); f < num_faces; ++f) {
+    Mesh::Face face = mesh->face(f);
+    bool is_face_changed = false;
+    for (int i = 0; i < 3; ++i) {
+      const int fan = get_corner_fan(corner_table->FirstCorner(f) + i);
+      const PointIndex pi = face[i];
+      if (point_fans[pi.value()] < 0) {
+        point_fans[pi.value()] = fan;
+      }
+      if (point_fans[pi.value()] == fan) {
+        continue;
+      }
+      // Reuse a point that was already split for the same fan.
+      int split = first_split_points[pi.value()];
+      while (split >= 0 && split_points[split].second != fan) {
+        split = next_split_points[split];
+      }
+      if (split < 0) {
+        split = static_cast<int>(split_points.size());
+        split_points.push_back(std::make_pair(pi, fan));
+        next_split_points.push_back(first_split_points[pi.value()]);
+        first_split_points[pi.value()] = split;
+      }
+      face[i] = PointIndex(num_original_points + split);
+      is_face_changed = true;
+    }
+    if (is_face_changed) {
+      mesh->SetFace(f, face);
+    }
+  }
+  const int num_split_points = static_cast<int>(split_points.size());
+  if (num_split_points > 0) {
+    const int num_points = num_original_points + num_split_points;
+    for (int i = 0; i < mesh->num_attributes(); ++i) {
+      PointAttribute *const att = mesh->attribute(i);
+      const bool was_identity = att->is_mapping_identity();
+      att->SetExplicitMapping(num_points);
+      if (was_identity) {
+        for (PointIndex pi(0); pi < num_original_points; ++pi) {
+          att->SetPointMapEntry(pi, AttributeValueIndex(pi.value()));
+        }
+      }
+      for (int j = 0; j < num_split_points; ++j) {
+        att->SetPointMapEntry(PointIndex(num_original_points + j),
+                              att->mapped_index(split_points[j].first));
+      }
+    }
+    mesh->set_num_points(num_points);
+  }
+
+  // Store one normal per fan.
+  GeometryAttribute ga;
+  ga.Init(GeometryAttribute::NORMAL, nullptr, 3, DT_FLOAT32, false,
+          3 * sizeof(float), 0);
+  std::unique_ptr<PointAttribute> normal_att(new PointAttribute(ga));
+  normal_att->Reset(num_fans);
+  for (int fan = 0; fan < num_fans; ++fan) {
+    normal_att->SetAttributeValue(AttributeValueIndex(fan),
+                                  &fan_normals[fan][0]);
+  }
+  normal_att->SetExplicitMapping(mesh->num_points());
+  for (PointIndex pi(0); pi < num_original_points; ++pi) {
+    // Points not used by any face get the first normal.
+    const int fan = point_fans[pi.value()];
+    normal_att->SetPointMapEntry(pi, AttributeValueIndex(fan < 0 ? 0 : fan));
+  }
+  for (int j = 0; j < num_split_points; ++j) {
+    normal_att->SetPointMapEntry(PointIndex(num_original_points + j),
+                                 AttributeValueIndex(split_points[j].second));
+  }
+
+  for (int att_id = mesh->GetNamedAttributeId(GeometryAttribute::NORMAL);
+       att_id >= 0;
+       att_id = mesh->GetNamedAttributeId(GeometryAttribute::NORMAL)) {
+    mesh->DeleteAttribute(att_id);
+  }
+  mesh->AddAttribute(std::move(normal_att));
+  return OkStatus();
+}
+
+}  // namespace draco
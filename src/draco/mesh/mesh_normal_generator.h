@@ -0,0 +1,50 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_MESH_MESH_NORMAL_GENERATOR_H_
+#define DRACO_MESH_MESH_NORMAL_GENERATOR_H_
+
+#include "draco/core/status.h"
+#include "draco/core/thread_pool.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Generates smooth per-vertex normals of a mesh from its positions, so that
+// normals of smooth surfaces (e.g. CAD or scanned models) do not need to be
+// stored in the encoded data.
+//
+// Normals are computed on a corner table created from the position attribute,
+// i.e., texture or other attribute seams do not split the normals. Around each
+// vertex, the faces are grouped into smooth fans separated by crease edges.
+// An edge is a crease when the angle between the normals of its two faces is
+// larger than the crease angle. The normal of a fan is the sum of the face
+// normals weighted by the face areas. Points shared by corners of different
+// fans are split into multiple points.
+class MeshNormalGenerator {
+ public:
+  // Adds a NORMAL attribute with three float components to |mesh|, or
+  // replaces the existing one. |crease_angle| is in radians, zero results in
+  // flat shading and pi in fully smooth shading. Per-face and per-vertex
+  // computations run on |pool| when it is not nullptr.
+  static Status GenerateNormals(Mesh *mesh, float crease_angle,
+                                ThreadPool *pool);
+  static Status GenerateNormals(Mesh *mesh, float crease_angle) {
+    return GenerateNormals(mesh, crease_angle, nullptr);
+  }
+};
+
+}  // namespace draco
+
+#endif  // DRACO_MESH_MESH_NORMAL_GENERATOR_H_
@@ -0,0 +1,142 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_normal_generator.h"
+
+#include <cmath>
+#include <memory>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/vector_d.h"
+
+namespace draco {
+
+class MeshNormalGeneratorTest : public ::testing::Test {
+ protected:
+  // Returns the unit normal of face |f| computed from the positions of |mesh|.
+  Vector3f GetFaceNormal(const Mesh &mesh, FaceIndex f) {
+    const PointAttribute *const pos_att =
+        mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+    Vector3f p[3];
+    for (int c = 0; c < 3; ++c) {
+      pos_att->GetMappedValue(mesh.face(f)[c], &p[c][0]);
+    }
+    const Vector3f n = CrossProduct(p[1] - p[0], p[2] - p[0]);
+    return n / std::sqrt(n.SquaredNorm());
+  }
+};
+
+TEST_F(MeshNormalGeneratorTest, TestFlatCube) {
+  // With a crease angle smaller than 90 degrees, all edges of a cube are
+  // creases and every corner gets the normal of its face.
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  DRACO_ASSERT_OK(MeshNormalGenerator::GenerateNormals(mesh.get(), 0.5f));
+  ASSERT_EQ(mesh->NumNamedAttributes(GeometryAttribute::NORMAL), 1);
+  const PointAttribute *const normal_att =
+      mesh->GetNamedAttribute(GeometryAttribute::NORMAL);
+  ASSERT_EQ(normal_att->size(), 24);
+  for (FaceIndex f(0); f < mesh->num_faces(); ++f) {
+    const Vector3f face_normal = GetFaceNormal(*mesh, f);
+    for (int c = 0; c < 3; ++c) {
+      Vector3f n;
+      normal_att->GetMappedValue(mesh->face(f)[c], &n[0]);
+      ASSERT_NEAR(n.Dot(face_normal), 1.f, 1e-6f);
+    }
+  }
+}
+
+TEST_F(MeshNormalGeneratorTest, TestSmoothCube) {
+  // Without creases, the normals of the cube corners point away from the
+  // center of the cube. They are not exactly diagonal, because each corner is
+  // shared by one or two triangles of the adjacent sides. Texture seams of the
+  // cube do not split the normals.
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  const int num_points = mesh->num_points();
+  DRACO_ASSERT_OK(MeshNormalGenerator::GenerateNormals(mesh.get(), M_PI));
+  ASSERT_EQ(mesh->num_points(), num_points);
+  const PointAttribute *const pos_att =
+      mesh->GetNamedAttribute(GeometryAttribute::POSITION);
+  const PointAttribute *const normal_att =
+      mesh->GetNamedAttribute(GeometryAttribute::NORMAL);
+  ASSERT_EQ(normal_att->size(), 8);
+  for (PointIndex pi(0); pi < mesh->num_points(); ++pi) {
+    Vector3f pos, n;
+    pos_att->GetMappedValue(pi, &pos[0]);
+    normal_att->GetMappedValue(pi, &n[0]);
+    Vector3f dir = pos - Vector3f(0.5f, 0.5f, 0.5f);
+    dir = dir / std::sqrt(dir.SquaredNorm());
+    ASSERT_NEAR(n.SquaredNorm(), 1.f, 1e-5f);
+    ASSERT_GT(n.Dot(dir), 0.9f);
+  }
+}
+
+TEST_F(MeshNormalGeneratorTest, TestPointSplitting) {
+  // Points shared by faces meeting at a crease must be split so that each
+  // face gets its own normal.
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  mesh->DeleteAttribute(mesh->GetNamedAttributeId(GeometryAttribute::NORMAL));
+  mesh->DeleteAttribute(
+      mesh->GetNamedAttributeId(GeometryAttribute::TEX_COORD));
+#ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
+  mesh->DeduplicatePointIds();
+  ASSERT_EQ(mesh->num_points(), 8);
+#endif
+  DRACO_ASSERT_OK(MeshNormalGenerator::GenerateNormals(mesh.get(), 0.5f));
+  ASSERT_EQ(mesh->num_points(), 24);
+  const PointAttribute *const pos_att =
+      mesh->GetNamedAttribute(GeometryAttribute::POSITION);
+  const PointAttribute *const normal_att =
+      mesh->GetNamedAttribute(GeometryAttribute::NORMAL);
+  for (FaceIndex f(0); f < mesh->num_faces(); ++f) {
+    const Vector3f face_normal = GetFaceNormal(*mesh, f);
+    for (int c = 0; c < 3; ++c) {
+      const PointIndex pi = mesh->face(f)[c];
+      ASSERT_NE(pos_att->mapped_index(pi), kInvalidAttributeValueIndex);
+      Vector3f n;
+      normal_att->GetMappedValue(pi, &n[0]);
+      ASSERT_NEAR(n.Dot(face_normal), 1.f, 1e-6f);
+    }
+  }
+}
+
+TEST_F(MeshNormalGeneratorTest, TestParallelGeneration) {
+  // Normals computed on a thread pool must match the serial result.
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("test_nm.obj");
+  ASSERT_NE(mesh, nullptr);
+  std::unique_ptr<Mesh> parallel_mesh = ReadMeshFromTestFile("test_nm.obj");
+  ASSERT_NE(parallel_mesh, nullptr);
+  DRACO_ASSERT_OK(MeshNormalGenerator::GenerateNormals(mesh.get(), 0.7f));
+  ThreadPool pool(4);
+  DRACO_ASSERT_OK(MeshNormalGenerator::GenerateNormals(parallel_mesh.get(),
+                                                       0.7f, &pool));
+  ASSERT_EQ(mesh->num_points(), parallel_mesh->num_points());
+  const PointAttribute *const att =
+      mesh->GetNamedAttribute(GeometryAttribute::NORMAL);
+  const PointAttribute *const parallel_att =
+      parallel_mesh->GetNamedAttribute(GeometryAttribute::NORMAL);
+  for (PointIndex pi(0); pi < mesh->num_points(); ++pi) {
+    Vector3f n, parallel_n;
+    att->GetMappedValue(pi, &n[0]);
+    parallel_att->GetMappedValue(pi, &parallel_n[0]);
+    ASSERT_EQ(n, parallel_n);
+    ASSERT_NEAR(n.SquaredNorm(), 1.f, 1e-5f);
+  }
+}
+
+}  // namespace draco
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "draco/attributes/geometry_attribute.h"
+#include "draco/core/thread_pool.h"
 #include "draco/mesh/mesh_utils.h"
 #include "draco/mesh/triangle_soup_mesh_builder.h"
 #include "draco/point_cloud/point_cloud_builder.h"
@@ -64,6 +65,31 @@ void AddElementToBuilder(
 void AddElementToBuilder(
     int b_index, PointIndex source_i, PointIndex target_i, const Mesh &mesh,
     MeshSplitterInternal<PointCloudBuilder>::WorkData *work_data);
+
+// Adds all elements of the source |mesh| to the builders of the sub-meshes
+// given by |element_sub_mesh_ids|. The elements are first grouped by their
+// sub-meshes and then all sub-meshes are filled concurrently.
+template <typename IndexT, typename WorkDataT>
+void AddElementsToBuilders(const std::vector<int> &element_sub_mesh_ids,
+                           const Mesh &mesh, WorkDataT *work_data) {
+  const int num_out_meshes = work_data->builders.size();
+  std::vector<int> offsets(num_out_meshes + 1, 0);
+  for (int mi = 0; mi < num_out_meshes; ++mi) {
+    offsets[mi + 1] = offsets[mi] + work_data->num_sub_mesh_elements[mi];
+  }
+  std::vector<IndexT> sorted_elements(offsets.back());
+  std::vector<int> next_element(offsets.begin(), offsets.end() - 1);
+  for (int i = 0; i < static_cast<int>(element_sub_mesh_ids.size()); ++i) {
+    sorted_elements[next_element[element_sub_mesh_ids[i]]++] = IndexT(i);
+  }
+  ParallelFor(work_data->thread_pool, num_out_meshes, [&](int mi) {
+    for (int i = offsets[mi]; i < offsets[mi + 1]; ++i) {
+      AddElementToBuilder(mi, sorted_elements[i], IndexT(i - offsets[mi]),
+                          mesh, work_data);
+    }
+  });
+}
+
 }  // namespace
 
 MeshSplitter::MeshSplitter()
@@ -71,7 +97,8 @@ MeshSplitter::MeshSplitter()
       remove_unused_material_indices_(true),
       preserve_mesh_features_(false),
       preserve_structural_metadata_(false),
-      deduplicate_vertices_(true) {}
+      deduplicate_vertices_(true),
+      thread_pool_(nullptr) {}
 
 StatusOr<MeshSplitter::MeshVector> MeshSplitter::SplitMesh(
     const Mesh &mesh, uint32_t split_attribute_id) {
@@ -106,6 +133,7 @@ StatusOr<MeshSplitter::MeshVector> MeshSplitter::SplitMeshInternal(
   work_data.num_sub_mesh_elements.resize(num_out_meshes, 0);
   work_data.split_by_materials =
       (split_attribute->attribute_type() == GeometryAttribute::MATERIAL);
+  work_data.thread_pool = thread_pool_;
 
   DRACO_RETURN_IF_ERROR(splitter_internal.InitializeWorkDataNumElements(
       mesh, split_attribute_id, &work_data));
@@ -125,10 +153,6 @@ StatusOr<MeshSplitter::MeshVector> MeshSplitter::SplitMeshInternal(
     const int num_elements = work_data.num_sub_mesh_elements[mi];
     splitter_internal.InitializeBuilder(mi, num_elements, mesh, ignored_att_id,
                                         &work_data);
-
-    // Reset the element counter for the sub-mesh. It will be used to keep track
-    // of number of elements added to the sub-mesh.
-    work_data.num_sub_mesh_elements[mi] = 0;
   }
 
   splitter_internal.AddElementsToBuilder(mesh, split_attribute, &work_data);
@@ -201,12 +225,12 @@ void MeshSplitterInternal<TriangleSoupMeshBuilder>::AddElementsToBuilder(
     WorkData *work_data) const {
   // Go over all faces of the input mesh and add them to the appropriate
   // sub-mesh.
+  std::vector<int> face_sub_mesh_ids(mesh.num_faces());
   for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
-    const auto face = mesh.face(fi);
-    const int sub_mesh_id = split_attribute->mapped_index(face[0]).value();
-    const FaceIndex target_fi(work_data->num_sub_mesh_elements[sub_mesh_id]++);
-    AddElementToBuilder(sub_mesh_id, fi, target_fi, mesh, work_data);
+    face_sub_mesh_ids[fi.value()] =
+        split_attribute->mapped_index(mesh.face(fi)[0]).value();
   }
+  AddElementsToBuilders<FaceIndex>(face_sub_mesh_ids, mesh, work_data);
 }
 
 template <>
@@ -215,11 +239,11 @@ void MeshSplitterInternal<PointCloudBuilder>::AddElementsToBuilder(
     WorkData *work_data) const {
   // Go over all points of the input mesh and add them to the appropriate
   // sub-mesh.
+  std::vector<int> point_sub_mesh_ids(mesh.num_points());
   for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
-    const int sub_mesh_id = split_attribute->mapped_index(pi).value();
-    const PointIndex target_pi(work_data->num_sub_mesh_elements[sub_mesh_id]++);
-    AddElementToBuilder(sub_mesh_id, pi, target_pi, mesh, work_data);
+    point_sub_mesh_ids[pi.value()] = split_attribute->mapped_index(pi).value();
   }
+  AddElementsToBuilders<PointIndex>(point_sub_mesh_ids, mesh, work_data);
 }
 
 namespace {
@@ -265,15 +289,12 @@ MeshSplitterInternal<TriangleSoupMeshBuilder>::BuildMeshes(
     const Mesh &mesh, WorkData *work_data, bool deduplicate_vertices) const {
   const int num_out_meshes = work_data->builders.size();
   MeshSplitter::MeshVector out_meshes(num_out_meshes);
-  for (int mi = 0; mi < num_out_meshes; ++mi) {
+  ParallelFor(work_data->thread_pool, num_out_meshes, [&](int mi) {
     if (work_data->num_sub_mesh_elements[mi] == 0) {
-      continue;
+      return;
     }
     out_meshes[mi] = work_data->builders[mi].Finalize();
-    if (out_meshes[mi] == nullptr) {
-      continue;
-    }
-  }
+  });
   return out_meshes;
 }
 
@@ -283,22 +304,22 @@ MeshSplitterInternal<PointCloudBuilder>::BuildMeshes(
     const Mesh &mesh, WorkData *work_data, bool deduplicate_vertices) const {
   const int num_out_meshes = work_data->builders.size();
   MeshSplitter::MeshVector out_meshes(num_out_meshes);
-  for (int mi = 0; mi < num_out_meshes; ++mi) {
+  ParallelFor(work_data->thread_pool, num_out_meshes, [&](int mi) {
     if (work_data->num_sub_mesh_elements[mi] == 0) {
-      continue;
+      return;
     }
     // For point clouds, we first build a point cloud and copy it over into
     // a draco::Mesh.
     std::unique_ptr<PointCloud> pc =
         work_data->builders[mi].Finalize(deduplicate_vertices);
     if (pc == nullptr) {
-      continue;
+      return;
     }
     std::unique_ptr<Mesh> mesh(new Mesh());
     PointCloud *mesh_pc = mesh.get();
     mesh_pc->Copy(*pc);
     out_meshes[mi] = std::move(mesh);
-  }
+  });
   return out_meshes;
 }
 
@@ -316,238 +337,245 @@ StatusOr<MeshSplitter::MeshVector> MeshSplitter::FinalizeMeshes(
         mesh.GetNonMaterialTextureLibrary().ComputeTextureToIndexMap();
   }
 
-  for (int mi = 0; mi < num_out_meshes; ++mi) {
-    if (out_meshes[mi] == nullptr) {
-      continue;
+  // The sub-meshes are independent of each other and they are finalized in
+  // parallel.
+  std::vector<Status> statuses(num_out_meshes);
+  ParallelFor(thread_pool_, num_out_meshes, [&](int mi) {
+    if (out_meshes[mi] != nullptr) {
+      statuses[mi] =
+          FinalizeMesh(mesh, work_data, mi, features_texture_to_index_map,
+                       out_meshes[mi].get());
     }
-    out_meshes[mi]->SetName(mesh.GetName());
-    if (preserve_materials_) {
-      if (work_data.split_by_materials) {
-        // When splitting by material, only copy the material in use.
-        if (out_meshes[mi]->num_points() != 0 &&
-            mesh.GetMaterialLibrary().NumMaterials() != 0) {
-          uint64_t material_index = 0;
-          out_meshes[mi]
-              ->GetNamedAttribute(GeometryAttribute::MATERIAL)
-              ->GetMappedValue(PointIndex(0), &material_index);
-
-          // Populate empty materials and textures. Unused materials and
-          // textures will be cleared later.
-          out_meshes[mi]->GetMaterialLibrary().MutableMaterial(
-              mesh.GetMaterialLibrary().NumMaterials() - 1);
-          for (int i = 0;
-               i < mesh.GetMaterialLibrary().GetTextureLibrary().NumTextures();
-               ++i) {
-            out_meshes[mi]
-                ->GetMaterialLibrary()
-                .MutableTextureLibrary()
-                .PushTexture(std::make_unique<Texture>());
-          }
+  });
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status);
+  }
+  return std::move(out_meshes);
+}
 
-          // Copy the material that we're actually going to use.
-          out_meshes[mi]
-              ->GetMaterialLibrary()
-              .MutableMaterial(material_index)
-              ->Copy(*mesh.GetMaterialLibrary().GetMaterial(material_index));
-          std::unordered_map<const Texture *, int> texture_to_index =
+Status MeshSplitter::FinalizeMesh(
+    const Mesh &mesh, const WorkData &work_data, int mi,
+    const std::unordered_map<const Texture *, int>
+        &features_texture_to_index_map,
+    Mesh *out_mesh) const {
+  out_mesh->SetName(mesh.GetName());
+  if (preserve_materials_) {
+    if (work_data.split_by_materials) {
+      // When splitting by material, only copy the material in use.
+      if (out_mesh->num_points() != 0 &&
+          mesh.GetMaterialLibrary().NumMaterials() != 0) {
+        uint64_t material_index = 0;
+        out_mesh->GetNamedAttribute(GeometryAttribute::MATERIAL)
+            ->GetMappedValue(PointIndex(0), &material_index);
+
+        // Populate empty materials and textures. Unused materials and
+        // textures will be cleared later.
+        out_mesh->GetMaterialLibrary().MutableMaterial(
+            mesh.GetMaterialLibrary().NumMaterials() - 1);
+        for (int i = 0;
+             i < mesh.GetMaterialLibrary().GetTextureLibrary().NumTextures();
+             ++i) {
+          out_mesh->GetMaterialLibrary().MutableTextureLibrary().PushTexture(
+              std::make_unique<Texture>());
+        }
+
+        // Copy the material that we're actually going to use.
+        out_mesh->GetMaterialLibrary()
+            .MutableMaterial(material_index)
+            ->Copy(*mesh.GetMaterialLibrary().GetMaterial(material_index));
+        std::unordered_map<const Texture *, int> texture_to_index =
+            mesh.GetMaterialLibrary()
+                .GetTextureLibrary()
+                .ComputeTextureToIndexMap();
+        for (int tmi = 0; tmi < mesh.GetMaterialLibrary()
+                                    .GetMaterial(material_index)
+                                    ->NumTextureMaps();
+             ++tmi) {
+          const TextureMap *const source_texture_map =
               mesh.GetMaterialLibrary()
-                  .GetTextureLibrary()
-                  .ComputeTextureToIndexMap();
-          for (int tmi = 0; tmi < mesh.GetMaterialLibrary()
-                                      .GetMaterial(material_index)
-                                      ->NumTextureMaps();
-               ++tmi) {
-            const TextureMap *const source_texture_map =
-                mesh.GetMaterialLibrary()
-                    .GetMaterial(material_index)
-                    ->GetTextureMapByIndex(tmi);
-
-            // Get the texture map index
-            const int texture_index =
-                texture_to_index[source_texture_map->texture()];
-
-            // Use the index to assign texture to the corresponding texture map
-            // on the split mesh.
-            TextureMap *new_texture_map = out_meshes[mi]
-                                              ->GetMaterialLibrary()
-                                              .MutableMaterial(material_index)
-                                              ->GetTextureMapByIndex(tmi);
-            new_texture_map->SetTexture(out_meshes[mi]
-                                            ->GetMaterialLibrary()
-                                            .MutableTextureLibrary()
-                                            .GetTexture(texture_index));
-            new_texture_map->texture()->Copy(*source_texture_map->texture());
-          }
+                  .GetMaterial(material_index)
+                  ->GetTextureMapByIndex(tmi);
+
+          // Get the texture map index
+          const int texture_index =
+              texture_to_index[source_texture_map->texture()];
+
+          // Use the index to assign texture to the corresponding texture map
+          // on the split mesh.
+          TextureMap *new_texture_map = out_mesh->GetMaterialLibrary()
+                                            .MutableMaterial(material_index)
+                                            ->GetTextureMapByIndex(tmi);
+          new_texture_map->SetTexture(
+              out_mesh->GetMaterialLibrary().MutableTextureLibrary().GetTexture(
+                  texture_index));
+          new_texture_map->texture()->Copy(*source_texture_map->texture());
         }
-      } else {
-        out_meshes[mi]->GetMaterialLibrary().Copy(mesh.GetMaterialLibrary());
       }
+    } else {
+      out_mesh->GetMaterialLibrary().Copy(mesh.GetMaterialLibrary());
     }
+  }
 
-    // Copy metadata of the original mesh to the output meshes.
-    if (mesh.GetMetadata() != nullptr) {
-      const GeometryMetadata &metadata = *mesh.GetMetadata();
-      out_meshes[mi]->AddMetadata(
-          std::unique_ptr<GeometryMetadata>(new GeometryMetadata(metadata)));
-    }
+  // Copy metadata of the original mesh to the output meshes.
+  if (mesh.GetMetadata() != nullptr) {
+    const GeometryMetadata &metadata = *mesh.GetMetadata();
+    out_mesh->AddMetadata(
+        std::unique_ptr<GeometryMetadata>(new GeometryMetadata(metadata)));
+  }
 
-    // Copy over attribute unique ids.
-    for (int att_id = 0; att_id < mesh.num_attributes(); ++att_id) {
-      const int mapped_att_id = att_id_map_[att_id];
-      if (mapped_att_id == -1) {
-        continue;
-      }
-      const PointAttribute *const src_att = mesh.attribute(att_id);
-      PointAttribute *const dst_att = out_meshes[mi]->attribute(mapped_att_id);
-      dst_att->set_unique_id(src_att->unique_id());
+  // Copy over attribute unique ids.
+  for (int att_id = 0; att_id < mesh.num_attributes(); ++att_id) {
+    const int mapped_att_id = att_id_map_[att_id];
+    if (mapped_att_id == -1) {
+      continue;
     }
+    const PointAttribute *const src_att = mesh.attribute(att_id);
+    PointAttribute *const dst_att = out_mesh->attribute(mapped_att_id);
+    dst_att->set_unique_id(src_att->unique_id());
+  }
 
-    // Copy compression settings of the original mesh to the output meshes.
-    out_meshes[mi]->SetCompressionEnabled(mesh.IsCompressionEnabled());
-    out_meshes[mi]->SetCompressionOptions(mesh.GetCompressionOptions());
-
-    if (preserve_mesh_features_) {
-      // Copy mesh features from the source |mesh| to the |out_meshes[mi]|.
-      for (MeshFeaturesIndex mfi(0); mfi < mesh.NumMeshFeatures(); ++mfi) {
-        if (work_data.split_by_materials) {
-          // Copy over only those mesh features that were masked to the material
-          // corresponding to |mi|.
-          bool is_used = false;
-          if (mesh.NumMeshFeaturesMaterialMasks(mfi) == 0) {
-            is_used = true;
-          } else {
-            for (int mask_index = 0;
-                 mask_index < mesh.NumMeshFeaturesMaterialMasks(mfi);
-                 ++mask_index) {
-              if (mesh.GetMeshFeaturesMaterialMask(mfi, mask_index) == mi) {
-                is_used = true;
-                break;
-              }
-            }
-          }
-          if (!is_used) {
-            // Ignore this mesh features.
-            continue;
-          }
-        }
-        // Create a copy of source mesh features.
-        std::unique_ptr<MeshFeatures> mf(new MeshFeatures());
-        mf->Copy(mesh.GetMeshFeatures(mfi));
-
-        // Update mesh features attribute index if used.
-        if (mf->GetAttributeIndex() != -1) {
-          const int new_mf_attribute_index =
-              att_id_map_[mf->GetAttributeIndex()];
-          mf->SetAttributeIndex(new_mf_attribute_index);
-        }
+  // Copy compression settings of the original mesh to the output meshes.
+  out_mesh->SetCompressionEnabled(mesh.IsCompressionEnabled());
+  out_mesh->SetCompressionOptions(mesh.GetCompressionOptions());
 
-        const MeshFeaturesIndex new_mfi =
-            out_meshes[mi]->AddMeshFeatures(std::move(mf));
-        if (work_data.split_by_materials && !preserve_materials_) {
-          // If the input |mesh| was split by materials and we didn't preserve
-          // the materials, all mesh features must be masked to material 0.
-          out_meshes[mi]->AddMeshFeaturesMaterialMask(new_mfi, 0);
+  if (preserve_mesh_features_) {
+    // Copy mesh features from the source |mesh| to the |out_mesh|.
+    for (MeshFeaturesIndex mfi(0); mfi < mesh.NumMeshFeatures(); ++mfi) {
+      if (work_data.split_by_materials) {
+        // Copy over only those mesh features that were masked to the material
+        // corresponding to |mi|.
+        bool is_used = false;
+        if (mesh.NumMeshFeaturesMaterialMasks(mfi) == 0) {
+          is_used = true;
         } else {
-          // Otherwise mesh features use same masking as the source mesh because
-          // the material attribute is still present in the split meshes.
-          // Note that this masking can be later changed in
-          // RemoveUnusedMaterials() call below.
           for (int mask_index = 0;
                mask_index < mesh.NumMeshFeaturesMaterialMasks(mfi);
                ++mask_index) {
-            out_meshes[mi]->AddMeshFeaturesMaterialMask(
-                new_mfi, mesh.GetMeshFeaturesMaterialMask(mfi, mask_index));
+            if (mesh.GetMeshFeaturesMaterialMask(mfi, mask_index) == mi) {
+              is_used = true;
+              break;
+            }
           }
         }
+        if (!is_used) {
+          // Ignore this mesh features.
+          continue;
+        }
+      }
+      // Create a copy of source mesh features.
+      std::unique_ptr<MeshFeatures> mf(new MeshFeatures());
+      mf->Copy(mesh.GetMeshFeatures(mfi));
+
+      // Update mesh features attribute index if used.
+      if (mf->GetAttributeIndex() != -1) {
+        const int new_mf_attribute_index = att_id_map_[mf->GetAttributeIndex()];
+        mf->SetAttributeIndex(new_mf_attribute_index);
       }
 
-      // Copy over all features textures to the split mesh.
-      out_meshes[mi]->GetNonMaterialTextureLibrary().Copy(
-          mesh.GetNonMaterialTextureLibrary());
-
-      // Update mesh features texture pointers to the new library.
-      for (MeshFeaturesIndex mfi(0); mfi < out_meshes[mi]->NumMeshFeatures();
-           ++mfi) {
-        Mesh::UpdateMeshFeaturesTexturePointer(
-            features_texture_to_index_map,
-            &out_meshes[mi]->GetNonMaterialTextureLibrary(),
-            &out_meshes[mi]->GetMeshFeatures(mfi));
+      const MeshFeaturesIndex new_mfi =
+          out_mesh->AddMeshFeatures(std::move(mf));
+      if (work_data.split_by_materials && !preserve_materials_) {
+        // If the input |mesh| was split by materials and we didn't preserve
+        // the materials, all mesh features must be masked to material 0.
+        out_mesh->AddMeshFeaturesMaterialMask(new_mfi, 0);
+      } else {
+        // Otherwise mesh features use same masking as the source mesh because
+        // the material attribute is still present in the split meshes.
+        // Note that this masking can be later changed in
+        // RemoveUnusedMaterials() call below.
+        for (int mask_index = 0;
+             mask_index < mesh.NumMeshFeaturesMaterialMasks(mfi);
+             ++mask_index) {
+          out_mesh->AddMeshFeaturesMaterialMask(
+              new_mfi, mesh.GetMeshFeaturesMaterialMask(mfi, mask_index));
+        }
       }
+    }
 
-      // This will remove any mesh features that may not be be actually used
-      // by this |out_meshes[mi]| (e.g. because corresponding material indices
-      // were not present in this split mesh). This also removes any unused
-      // features textures from the non-material texture library.
-      DRACO_RETURN_IF_ERROR(
-          MeshUtils::RemoveUnusedMeshFeatures(out_meshes[mi].get()));
+    // Copy over all features textures to the split mesh.
+    out_mesh->GetNonMaterialTextureLibrary().Copy(
+        mesh.GetNonMaterialTextureLibrary());
+
+    // Update mesh features texture pointers to the new library.
+    for (MeshFeaturesIndex mfi(0); mfi < out_mesh->NumMeshFeatures(); ++mfi) {
+      Mesh::UpdateMeshFeaturesTexturePointer(
+          features_texture_to_index_map,
+          &out_mesh->GetNonMaterialTextureLibrary(),
+          &out_mesh->GetMeshFeatures(mfi));
     }
 
-    if (preserve_structural_metadata_) {
-      // Copy proeprty attributes indices from the source |mesh| to the
-      // |out_meshes[mi]|.
-      for (int i = 0; i < mesh.NumPropertyAttributesIndices(); ++i) {
-        if (work_data.split_by_materials) {
-          // Copy over only those property attribute indices that were masked to
-          // the material corresponding to |mi|.
-          bool is_used = false;
-          if (mesh.NumPropertyAttributesIndexMaterialMasks(i) == 0) {
-            is_used = true;
-          } else {
-            for (int mask_index = 0;
-                 mask_index < mesh.NumPropertyAttributesIndexMaterialMasks(i);
-                 ++mask_index) {
-              if (mesh.GetPropertyAttributesIndexMaterialMask(i, mask_index) ==
-                  mi) {
-                is_used = true;
-                break;
-              }
-            }
-          }
-          if (!is_used) {
-            // Ignore this property attributes index.
-            continue;
-          }
-        }
-        // Create a copy of source property attributes index.
-        const int new_i = out_meshes[mi]->AddPropertyAttributesIndex(
-            mesh.GetPropertyAttributesIndex(i));
-        if (work_data.split_by_materials && !preserve_materials_) {
-          // If the input |mesh| was split by materials and we didn't preserve
-          // the materials, all property attributes indices must be masked to
-          // material 0.
-          out_meshes[mi]->AddPropertyAttributesIndexMaterialMask(new_i, 0);
+    // This will remove any mesh features that may not be be actually used
+    // by this |out_mesh| (e.g. because corresponding material indices
+    // were not present in this split mesh). This also removes any unused
+    // features textures from the non-material texture library.
+    DRACO_RETURN_IF_ERROR(MeshUtils::RemoveUnusedMeshFeatures(out_mesh));
+  }
+
+  if (preserve_structural_metadata_) {
+    // Copy proeprty attributes indices from the source |mesh| to the
+    // |out_mesh|.
+    for (int i = 0; i < mesh.NumPropertyAttributesIndices(); ++i) {
+      if (work_data.split_by_materials) {
+        // Copy over only those property attribute indices that were masked to
+        // the material corresponding to |mi|.
+        bool is_used = false;
+        if (mesh.NumPropertyAttributesIndexMaterialMasks(i) == 0) {
+          is_used = true;
         } else {
-          // Otherwise property attributes index uses same masking as the source
-          // mesh because the material attribute is still present in the split
-          // meshes. Note that this masking can be later changed in
-          // RemoveUnusedMaterials() call below.
           for (int mask_index = 0;
                mask_index < mesh.NumPropertyAttributesIndexMaterialMasks(i);
                ++mask_index) {
-            out_meshes[mi]->AddPropertyAttributesIndexMaterialMask(
-                new_i,
-                mesh.GetPropertyAttributesIndexMaterialMask(i, mask_index));
+            if (mesh.GetPropertyAttributesIndexMaterialMask(i, mask_index) ==
+                mi) {
+              is_used = true;
+              break;
+            }
           }
         }
+        if (!is_used) {
+          // Ignore this property attributes index.
+          continue;
+        }
+      }
+      // Create a copy of source property attributes index.
+      const int new_i = out_mesh->AddPropertyAttributesIndex(
+          mesh.GetPropertyAttributesIndex(i));
+      if (work_data.split_by_materials && !preserve_materials_) {
+        // If the input |mesh| was split by materials and we didn't preserve
+        // the materials, all property attributes indices must be masked to
+        // material 0.
+        out_mesh->AddPropertyAttributesIndexMaterialMask(new_i, 0);
+      } else {
+        // Otherwise property attributes index uses same masking as the source
+        // mesh because the material attribute is still present in the split
+        // meshes. Note that this masking can be later changed in
+        // RemoveUnusedMaterials() call below.
+        for (int mask_index = 0;
+             mask_index < mesh.NumPropertyAttributesIndexMaterialMasks(i);
+             ++mask_index) {
+          out_mesh->AddPropertyAttributesIndexMaterialMask(
+              new_i,
+              mesh.GetPropertyAttributesIndexMaterialMask(i, mask_index));
+        }
       }
-
-      // This will remove any property attributes indices that may not be be
-      // actually used by this |out_meshes[mi]| (e.g. because corresponding
-      // material indices were not present in this split mesh).
-      DRACO_RETURN_IF_ERROR(MeshUtils::RemoveUnusedPropertyAttributesIndices(
-          out_meshes[mi].get()));
     }
 
-    // Remove unused materials after we remove mesh features because some of
-    // the mesh features may have referenced old material indices.
-    if (preserve_materials_) {
-      out_meshes[mi]->RemoveUnusedMaterials(remove_unused_material_indices_);
-    }
+    // This will remove any property attributes indices that may not be be
+    // actually used by this |out_mesh| (e.g. because corresponding
+    // material indices were not present in this split mesh).
+    DRACO_RETURN_IF_ERROR(
+        MeshUtils::RemoveUnusedPropertyAttributesIndices(out_mesh));
+  }
 
-    // Copy structural metadata from input mesh to each of the output meshes.
-    out_meshes[mi]->GetStructuralMetadata().Copy(mesh.GetStructuralMetadata());
+  // Remove unused materials after we remove mesh features because some of
+  // the mesh features may have referenced old material indices.
+  if (preserve_materials_) {
+    out_mesh->RemoveUnusedMaterials(remove_unused_material_indices_);
   }
-  return std::move(out_meshes);
+
+  // Copy structural metadata from input mesh to each of the output meshes.
+  out_mesh->GetStructuralMetadata().Copy(mesh.GetStructuralMetadata());
+  return OkStatus();
 }
 
 StatusOr<MeshSplitter::MeshVector> MeshSplitter::SplitMeshToComponents(
@@ -560,6 +588,7 @@ StatusOr<MeshSplitter::MeshVector> MeshSplitter::SplitMeshToComponents(
   work_data.num_sub_mesh_elements.resize(num_out_meshes, 0);
   att_id_map_.resize(mesh.num_attributes(), -1);
   work_data.att_id_map = &att_id_map_;
+  work_data.thread_pool = thread_pool_;
   for (int mi = 0; mi < num_out_meshes; ++mi) {
     const int num_faces = connected_components.NumConnectedComponentFaces(mi);
     work_data.num_sub_mesh_elements[mi] = num_faces;
@@ -568,15 +597,15 @@ StatusOr<MeshSplitter::MeshVector> MeshSplitter::SplitMeshToComponents(
 
   // Go over all faces of the input mesh and add them to the appropriate
   // sub-mesh.
-  for (int mi = 0; mi < num_out_meshes; ++mi) {
+  ParallelFor(thread_pool_, num_out_meshes, [&](int mi) {
     for (int cfi = 0; cfi < connected_components.NumConnectedComponentFaces(mi);
          ++cfi) {
       const FaceIndex fi(
-          connected_components.GetConnectedComponent(mi).faces[cfi]);
+          connected_components.GetConnectedComponentFace(mi, cfi));
       const FaceIndex target_fi(cfi);
       AddElementToBuilder(mi, fi, target_fi, mesh, &work_data);
     }
-  }
+  });
   DRACO_ASSIGN_OR_RETURN(
       auto out_meshes,
       splitter_internal.BuildMeshes(mesh, &work_data, deduplicate_vertices_));
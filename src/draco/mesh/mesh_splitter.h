@@ -16,12 +16,14 @@
 #define DRACO_MESH_MESH_SPLITTER_H_
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "draco/draco_features.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
 #include "draco/core/status_or.h"
+#include "draco/core/thread_pool.h"
 #include "draco/mesh/mesh.h"
 #include "draco/mesh/mesh_connected_components.h"
 #include "draco/mesh/triangle_soup_mesh_builder.h"
@@ -82,6 +84,12 @@ class MeshSplitter {
   // clouds.
   void SetDeduplicateVertices(bool flag) { deduplicate_vertices_ = flag; }
 
+  // Sets an optional thread pool that is used to fill, deduplicate and
+  // finalize the sub-meshes concurrently. The pool is not owned and must
+  // outlive the splitting. The output does not depend on the pool.
+  // Default = nullptr.
+  void SetThreadPool(ThreadPool *pool) { thread_pool_ = pool; }
+
   // Splits the input |mesh| according to attribute values stored in the
   // specified attribute. If the |mesh| contains faces, the attribute values
   // need to be defined per-face, that is, all points attached to a single face
@@ -107,6 +115,7 @@ class MeshSplitter {
   struct WorkData {
     std::vector<int> num_sub_mesh_elements;
     bool split_by_materials = false;
+    ThreadPool *thread_pool = nullptr;
   };
 
   template <typename BuilderT>
@@ -117,11 +126,19 @@ class MeshSplitter {
                                       const WorkData &work_data,
                                       MeshVector out_meshes) const;
 
+  // Copies materials, metadata and other properties of the source |mesh| to
+  // the sub-mesh |mi|.
+  Status FinalizeMesh(const Mesh &mesh, const WorkData &work_data, int mi,
+                      const std::unordered_map<const Texture *, int>
+                          &features_texture_to_index_map,
+                      Mesh *out_mesh) const;
+
   bool preserve_materials_;
   bool remove_unused_material_indices_;
   bool preserve_mesh_features_;
   bool preserve_structural_metadata_;
   bool deduplicate_vertices_;
+  ThreadPool *thread_pool_;
 
   // Map between attribute ids of the input and output meshes.
   std::vector<int> att_id_map_;
@@ -14,12 +14,180 @@
 //
 #include "draco/mesh/mesh_stripifier.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "draco/core/bit_utils.h"
+
 namespace draco {
 
+namespace {
+// Partitions with fewer faces would mostly add strip breaks.
+constexpr int kMinFacesPerPartition = 4096;
+// Number of bits per coordinate of the grid used for the spatial partitions.
+constexpr int kPartitionGridBits = 5;
+}  // namespace
+
+bool MeshStripifier::GenerateStrips(const Mesh &mesh) {
+  mesh_ = &mesh;
+  num_strips_ = 0;
+  if (external_corner_table_ != nullptr &&
+      external_corner_table_->num_faces() ==
+          static_cast<int>(mesh.num_faces())) {
+    corner_table_ = external_corner_table_;
+  } else {
+    owned_corner_table_ =
+        CreateCornerTableFromPositionAttribute(mesh_, thread_pool_);
+    if (owned_corner_table_ == nullptr) {
+      return false;
+    }
+    corner_table_ = owned_corner_table_.get();
+  }
+
+  // Mark all faces as unvisited.
+  is_face_visited_.assign(mesh.num_faces(), false);
+
+  const int num_partitions = std::max(
+      1, std::min(num_partitions_, static_cast<int>(mesh.num_faces() /
+                                                    kMinFacesPerPartition)));
+  PartitionFaces(num_partitions);
+  ParallelFor(thread_pool_, num_partitions,
+              [this](int p) { GeneratePartitionStrips(p); });
+  return true;
+}
+
+void MeshStripifier::PartitionFaces(int num_partitions) {
+  partitions_.resize(num_partitions);
+  for (Partition &partition : partitions_) {
+    partition.faces.clear();
+    partition.indices.clear();
+    partition.strip_ends.clear();
+  }
+  face_partitions_.clear();
+  if (num_partitions == 1) {
+    return;
+  }
+  const int num_faces = mesh_->num_faces();
+  face_partitions_.resize(num_faces);
+
+  // Quantize the face centers to a coarse grid over the bounds of the
+  // positions and split the grid cells traversed in the Morton order into
+  // runs with similar numbers of faces.
+  const PointAttribute *const pos_att =
+      mesh_->GetNamedAttribute(GeometryAttribute::POSITION);
+  std::vector<float> positions;
+  if (pos_att != nullptr && pos_att->num_components() == 3) {
+    positions.resize(pos_att->size() * 3);
+    for (AttributeValueIndex i(0); i < pos_att->size(); ++i) {
+      float *const value = &positions[i.value() * 3];
+      if (!pos_att->ConvertValue<float>(i, 3, value)) {
+        positions.clear();
+        break;
+      }
+      for (int c = 0; c < 3; ++c) {
+        if (!std::isfinite(value[c])) {
+          value[c] = 0.f;
+        }
+      }
+    }
+  }
+  if (positions.empty()) {
+    // Without positions, the faces are split into ranges of face indices.
+    for (FaceIndex f(0); f < num_faces; ++f) {
+      const int p = static_cast<int>(static_cast<int64_t>(f.value()) *
+                                     num_partitions / num_faces);
+      face_partitions_[f] = p;
+      partitions_[p].faces.push_back(f);
+    }
+    return;
+  }
+  float min_values[3] = {std::numeric_limits<float>::max(),
+                         std::numeric_limits<float>::max(),
+                         std::numeric_limits<float>::max()};
+  float max_values[3] = {std::numeric_limits<float>::lowest(),
+                         std::numeric_limits<float>::lowest(),
+                         std::numeric_limits<float>::lowest()};
+  for (size_t i = 0; i < positions.size(); i += 3) {
+    for (int c = 0; c < 3; ++c) {
+      min_values[c] = std::min(min_values[c], positions[i + c]);
+      max_values[c] = std::max(max_values[c], positions[i + c]);
+    }
+  }
+  // The sum of the three corner positions is quantized so that the centers do
+  // not need to be divided.
+  const float max_coordinate =
+      static_cast<float>((1 << kPartitionGridBits) - 1);
+  float scales[3];
+  for (int c = 0; c < 3; ++c) {
+    const float range = max_values[c] - min_values[c];
+    scales[c] = range > 0 ? max_coordinate / (3.f * range) : 0.f;
+  }
+  std::vector<uint32_t> face_cells(num_faces);
+  std::vector<int> cell_counts(1 << (3 * kPartitionGridBits), 0);
+  for (FaceIndex f(0); f < num_faces; ++f) {
+    const Mesh::Face &face = mesh_->face(f);
+    float sum[3] = {0.f, 0.f, 0.f};
+    for (int k = 0; k < 3; ++k) {
+      const float *const value =
+          &positions[pos_att->mapped_index(face[k]).value() * 3];
+      for (int c = 0; c < 3; ++c) {
+        sum[c] += value[c] - min_values[c];
+      }
+    }
+    uint32_t cell = 0;
+    for (int c = 0; c < 3; ++c) {
+      cell |= static_cast<uint32_t>(SpreadBitsBy3(static_cast<uint32_t>(
+                  std::min(sum[c] * scales[c], max_coordinate))))
+              << c;
+    }
+    face_cells[f.value()] = cell;
+    ++cell_counts[cell];
+  }
+  // Assign each cell to the partition of its first face in the Morton order.
+  int num_preceding_faces = 0;
+  for (int &count : cell_counts) {
+    const int num_cell_faces = count;
+    count = static_cast<int>(static_cast<int64_t>(num_preceding_faces) *
+                             num_partitions / num_faces);
+    num_preceding_faces += num_cell_faces;
+  }
+  for (FaceIndex f(0); f < num_faces; ++f) {
+    const int p = cell_counts[face_cells[f.value()]];
+    face_partitions_[f] = p;
+    partitions_[p].faces.push_back(f);
+  }
+}
+
+void MeshStripifier::GeneratePartitionStrips(int partition_id) {
+  Partition &partition = partitions_[partition_id];
+  StripCandidates candidates;
+  const auto process_face = [&](FaceIndex fi) {
+    if (is_face_visited_[fi]) {
+      return;
+    }
+    const int longest_strip_id =
+        FindLongestStripFromFace(fi, partition_id, &candidates);
+    StoreStrip(longest_strip_id, candidates, &partition);
+  };
+  // Go over all faces and generate strips from the first unvisited one.
+  if (face_partitions_.empty()) {
+    for (FaceIndex fi(0); fi < mesh_->num_faces(); ++fi) {
+      process_face(fi);
+    }
+  } else {
+    for (const FaceIndex fi : partition.faces) {
+      process_face(fi);
+    }
+  }
+}
+
 void MeshStripifier::GenerateStripsFromCorner(int local_strip_id,
-                                              CornerIndex ci) {
+                                              CornerIndex ci, int partition_id,
+                                              StripCandidates *candidates) {
+  std::vector<FaceIndex> &strip_faces = candidates->faces[local_strip_id];
   // Clear the storage for strip faces.
-  strip_faces_[local_strip_id].clear();
+  strip_faces.clear();
   // Start corner of the strip (where the strip starts).
   CornerIndex start_ci = ci;
   FaceIndex fi = corner_table_->Face(ci);
@@ -54,9 +222,9 @@ void MeshStripifier::GenerateStripsFromCorner(int local_strip_id,
       fi = corner_table_->Face(ci);
     }
     int num_added_faces = 0;
-    while (!is_face_visited_[fi]) {
+    while (IsFaceAvailable(fi, partition_id)) {
       is_face_visited_[fi] = true;
-      strip_faces_[local_strip_id].push_back(fi);
+      strip_faces.push_back(fi);
       ++num_added_faces;
       if (num_added_faces > 1) {
         // Move to the correct source corner to traverse to the next face.
@@ -86,16 +254,16 @@ void MeshStripifier::GenerateStripsFromCorner(int local_strip_id,
       // If we processed the backward strip and we add an odd number of faces to
       // the strip, we need to remove the last one as it cannot be used to start
       // the strip (the strip would start in a wrong direction from that face).
-      is_face_visited_[strip_faces_[local_strip_id].back()] = false;
-      strip_faces_[local_strip_id].pop_back();
+      is_face_visited_[strip_faces.back()] = false;
+      strip_faces.pop_back();
     }
   }
-  strip_start_corners_[local_strip_id] = start_ci;
+  candidates->start_corners[local_strip_id] = start_ci;
 
   // Reset all visited flags for all faces (we need to process other strips from
   // the given face before we choose the final strip that we are going to use).
-  for (int i = 0; i < strip_faces_[local_strip_id].size(); ++i) {
-    is_face_visited_[strip_faces_[local_strip_id][i]] = false;
+  for (const FaceIndex fi : strip_faces) {
+    is_face_visited_[fi] = false;
   }
 }
 
@@ -15,6 +15,10 @@
 #ifndef DRACO_MESH_MESH_STRIPIFIER_H_
 #define DRACO_MESH_MESH_STRIPIFIER_H_
 
+#include <memory>
+#include <vector>
+
+#include "draco/core/thread_pool.h"
 #include "draco/mesh/mesh_misc_functions.h"
 
 namespace draco {
@@ -34,9 +38,36 @@ class MeshStripifier {
  public:
   MeshStripifier()
       : mesh_(nullptr),
-        num_strips_(0),
-        num_encoded_faces_(0),
-        last_encoded_point_(kInvalidPointIndex) {}
+        external_corner_table_(nullptr),
+        corner_table_(nullptr),
+        thread_pool_(nullptr),
+        num_partitions_(1),
+        num_strips_(0) {}
+
+  // Sets an optional corner table of the stripified mesh, e.g. the one created
+  // by the mesh decoder (see BatchDecoder::GetLastMeshCornerTable()). The
+  // table is used instead of building a new one from the position attribute.
+  // It is ignored when its number of faces does not match the mesh. Strips
+  // cross only edges whose points match on both sides so any such table
+  // results in valid strips. The table is not owned and must outlive the
+  // strip generation. Default = nullptr.
+  void SetCornerTable(const CornerTable *corner_table) {
+    external_corner_table_ = corner_table;
+  }
+
+  // Sets an optional thread pool that is used to build the corner table and
+  // to generate strips of the spatial partitions concurrently. The pool is not
+  // owned and must outlive the strip generation. The output does not depend
+  // on the pool. Default = nullptr.
+  void SetThreadPool(ThreadPool *pool) { thread_pool_ = pool; }
+
+  // Sets the number of spatial partitions of the mesh faces. Strips of each
+  // partition are generated independently and stitched together in the
+  // output. More partitions allow more parallelism at the cost of slightly
+  // more strips, as strips never cross partition boundaries. Default = 1.
+  void SetNumPartitions(int num_partitions) {
+    num_partitions_ = num_partitions;
+  }
 
   // Generate triangle strips for a given mesh and output them to the output
   // iterator |out_it|. In most cases |out_it| stores the values in a buffer
@@ -67,23 +98,49 @@ class MeshStripifier {
   int num_strips() const { return num_strips_; }
 
  private:
-  bool Prepare(const Mesh &mesh) {
-    mesh_ = &mesh;
-    num_strips_ = 0;
-    num_encoded_faces_ = 0;
-    corner_table_ = CreateCornerTableFromPositionAttribute(mesh_);
-    if (corner_table_ == nullptr) {
-      return false;
-    }
-
-    // Mark all faces as unvisited.
-    is_face_visited_.assign(mesh.num_faces(), false);
-    return true;
+  // Strips that can cover a given face, one for each of three possible
+  // directions.
+  struct StripCandidates {
+    // Faces of the strip in each direction.
+    std::vector<FaceIndex> faces[3];
+    // Start corner of the strip in each direction.
+    CornerIndex start_corners[3];
+  };
+
+  // Strips generated from the faces of one spatial partition.
+  struct Partition {
+    // Faces of the partition in the order of their indices. Not used when
+    // there is only one partition.
+    std::vector<FaceIndex> faces;
+    // Point indices of all strips of the partition.
+    std::vector<PointIndex::ValueType> indices;
+    // End offset of each strip in |indices|.
+    std::vector<uint32_t> strip_ends;
+  };
+
+  // Sets up the corner table and the partitions and generates the strips of
+  // all partitions.
+  bool GenerateStrips(const Mesh &mesh);
+
+  // Assigns mesh faces to |num_partitions| spatial partitions.
+  void PartitionFaces(int num_partitions);
+
+  // Generates all strips of the partition |partition_id|.
+  void GeneratePartitionStrips(int partition_id);
+
+  // Returns true when face |fi| belongs to the partition |partition_id| and
+  // it is not covered by any strip yet.
+  bool IsFaceAvailable(FaceIndex fi, int partition_id) const {
+    // The partition is checked first so that faces of other partitions are
+    // never accessed.
+    return (face_partitions_.empty() || face_partitions_[fi] == partition_id) &&
+           !is_face_visited_[fi];
   }
 
   // Returns local id of the longest strip that can be created from the given
   // face |fi|.
-  int FindLongestStripFromFace(FaceIndex fi) {
+  int FindLongestStripFromFace(FaceIndex fi, int partition_id,
+                               StripCandidates *candidates) {
     // There are three possible strip directions that can contain the provided
     // input face. We try all of them and select the direction that result in
     // the longest strip.
@@ -91,38 +148,36 @@ class MeshStripifier {
     int longest_strip_id = -1;
     int longest_strip_length = 0;
     for (int i = 0; i < 3; ++i) {
-      GenerateStripsFromCorner(i, first_ci + i);
-      if (strip_faces_[i].size() > longest_strip_length) {
-        longest_strip_length = static_cast<int>(strip_faces_[i].size());
+      GenerateStripsFromCorner(i, first_ci + i, partition_id, candidates);
+      if (static_cast<int>(candidates->faces[i].size()) >
+          longest_strip_length) {
+        longest_strip_length = static_cast<int>(candidates->faces[i].size());
         longest_strip_id = i;
       }
     }
     return longest_strip_id;
   }
 
-  // Generates strip from the data stored in |strip_faces_| and
-  // |strip_start_start_corners_| and stores it to |out_it|.
-  template <typename OutputIteratorT>
-  void StoreStrip(int local_strip_id, OutputIteratorT out_it) {
-    ++num_strips_;
-
-    const int num_strip_faces = strip_faces_[local_strip_id].size();
-    CornerIndex ci = strip_start_corners_[local_strip_id];
+  // Generates strip from the data stored in |candidates| and stores it to
+  // |partition|.
+  void StoreStrip(int local_strip_id, const StripCandidates &candidates,
+                  Partition *partition) {
+    const int num_strip_faces = candidates.faces[local_strip_id].size();
+    std::vector<PointIndex::ValueType> &indices = partition->indices;
+    CornerIndex ci = candidates.start_corners[local_strip_id];
     for (int i = 0; i < num_strip_faces; ++i) {
       const FaceIndex fi = corner_table_->Face(ci);
       is_face_visited_[fi] = true;
-      ++num_encoded_faces_;
 
       if (i == 0) {
         // Add the start face (three indices).
-        *out_it++ = CornerToPointIndex(ci).value();
-        *out_it++ = CornerToPointIndex(corner_table_->Next(ci)).value();
-        last_encoded_point_ = CornerToPointIndex(corner_table_->Previous(ci));
-        *out_it++ = last_encoded_point_.value();
+        indices.push_back(CornerToPointIndex(ci).value());
+        indices.push_back(CornerToPointIndex(corner_table_->Next(ci)).value());
+        indices.push_back(
+            CornerToPointIndex(corner_table_->Previous(ci)).value());
       } else {
         // Store the point on the newly reached corner.
-        last_encoded_point_ = CornerToPointIndex(ci);
-        *out_it++ = last_encoded_point_.value();
+        indices.push_back(CornerToPointIndex(ci).value());
 
         // Go to the correct source corner to proceed to the next face.
         if (i & 1) {
@@ -133,6 +188,7 @@ class MeshStripifier {
       }
       ci = corner_table_->Opposite(ci);
     }
+    partition->strip_ends.push_back(static_cast<uint32_t>(indices.size()));
   }
 
   PointIndex CornerToPointIndex(CornerIndex ci) const {
@@ -159,46 +215,49 @@ class MeshStripifier {
     return oci;
   }
 
-  void GenerateStripsFromCorner(int local_strip_id, CornerIndex ci);
+  void GenerateStripsFromCorner(int local_strip_id, CornerIndex ci,
+                                int partition_id, StripCandidates *candidates);
 
   const Mesh *mesh_;
-  std::unique_ptr<CornerTable> corner_table_;
-
-  // Store strip faces for each of three possible directions from a given face.
-  std::vector<FaceIndex> strip_faces_[3];
-  // Start corner for each direction of the strip containing the processed face.
-  CornerIndex strip_start_corners_[3];
-  IndexTypeVector<FaceIndex, bool> is_face_visited_;
+  const CornerTable *external_corner_table_;
+  // Corner table used by the strip generation, either the external one or
+  // |owned_corner_table_|.
+  const CornerTable *corner_table_;
+  std::unique_ptr<CornerTable> owned_corner_table_;
+  ThreadPool *thread_pool_;
+  int num_partitions_;
+
+  std::vector<Partition> partitions_;
+  // Partition of each face. Empty when there is only one partition.
+  IndexTypeVector<FaceIndex, int> face_partitions_;
+  // Stored as bytes so that partitions can mark their faces concurrently.
+  IndexTypeVector<FaceIndex, uint8_t> is_face_visited_;
   // The number of strips generated by this method.
   int num_strips_;
-  // The number of encoded triangles.
-  int num_encoded_faces_;
-  // Last encoded point.
-  PointIndex last_encoded_point_;
 };
 
 template <typename OutputIteratorT, typename IndexTypeT>
 bool MeshStripifier::GenerateTriangleStripsWithPrimitiveRestart(
     const Mesh &mesh, IndexTypeT primitive_restart_index,
     OutputIteratorT out_it) {
-  if (!Prepare(mesh)) {
+  if (!GenerateStrips(mesh)) {
     return false;
   }
 
-  // Go over all faces and generate strips from the first unvisited one.
-  for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
-    if (is_face_visited_[fi]) {
-      continue;
-    }
-
-    const int longest_strip_id = FindLongestStripFromFace(fi);
-
-    // Separate triangle strips with the primitive restart index.
-    if (num_strips_ > 0) {
-      *out_it++ = primitive_restart_index;
+  // Stitch the strips of all partitions together.
+  for (const Partition &partition : partitions_) {
+    uint32_t strip_begin = 0;
+    for (const uint32_t strip_end : partition.strip_ends) {
+      // Separate triangle strips with the primitive restart index.
+      if (num_strips_ > 0) {
+        *out_it++ = primitive_restart_index;
+      }
+      for (uint32_t i = strip_begin; i < strip_end; ++i) {
+        *out_it++ = partition.indices[i];
+      }
+      ++num_strips_;
+      strip_begin = strip_end;
     }
-
-    StoreStrip(longest_strip_id, out_it);
   }
 
   return true;
@@ -207,47 +266,52 @@ bool MeshStripifier::GenerateTriangleStripsWithPrimitiveRestart(
 template <typename OutputIteratorT>
 bool MeshStripifier::GenerateTriangleStripsWithDegenerateTriangles(
     const Mesh &mesh, OutputIteratorT out_it) {
-  if (!Prepare(mesh)) {
+  if (!GenerateStrips(mesh)) {
     return false;
   }
 
-  // Go over all faces and generate strips from the first unvisited one.
-  for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
-    if (is_face_visited_[fi]) {
-      continue;
-    }
-
-    const int longest_strip_id = FindLongestStripFromFace(fi);
-
-    // Separate triangle strips by degenerate triangles. There will be either
-    // three or four degenerate triangles inserted based on the number of
-    // triangles that are already encoded in the output strip (three degenerate
-    // triangles for even number of existing triangles, four degenerate
-    // triangles for odd number of triangles).
-    if (num_strips_ > 0) {
-      // Duplicate last encoded index (first degenerate face).
-      *out_it++ = last_encoded_point_.value();
-
-      // Connect it to the start point of the new triangle strip (second
-      // degenerate face).
-      const CornerIndex new_start_corner =
-          strip_start_corners_[longest_strip_id];
-      const PointIndex new_start_point = CornerToPointIndex(new_start_corner);
-      *out_it++ = new_start_point.value();
-      num_encoded_faces_ += 2;
-      // If we have previously encoded number of faces we need to duplicate the
-      // point one more time to preserve the correct orientation of the next
-      // strip.
-      if (num_encoded_faces_ & 1) {
-        *out_it++ = new_start_point.value();
-        num_encoded_faces_ += 1;
+  // The number of encoded triangles.
+  int num_encoded_faces = 0;
+  // Last encoded point.
+  PointIndex::ValueType last_encoded_point = 0;
+
+  // Stitch the strips of all partitions together.
+  for (const Partition &partition : partitions_) {
+    uint32_t strip_begin = 0;
+    for (const uint32_t strip_end : partition.strip_ends) {
+      // Separate triangle strips by degenerate triangles. There will be either
+      // three or four degenerate triangles inserted based on the number of
+      // triangles that are already encoded in the output strip (three
+      // degenerate triangles for even number of existing triangles, four
+      // degenerate triangles for odd number of triangles).
+      if (num_strips_ > 0) {
+        // Duplicate last encoded index (first degenerate face).
+        *out_it++ = last_encoded_point;
+
+        // Connect it to the start point of the new triangle strip (second
+        // degenerate face).
+        const PointIndex::ValueType new_start_point =
+            partition.indices[strip_begin];
+        *out_it++ = new_start_point;
+        num_encoded_faces += 2;
+        // If we have previously encoded number of faces we need to duplicate
+        // the point one more time to preserve the correct orientation of the
+        // next strip.
+        if (num_encoded_faces & 1) {
+          *out_it++ = new_start_point;
+          num_encoded_faces += 1;
+        }
+        // The last degenerate face will be added implicitly below as the first
+        // point index of the strip is going to be encoded there again.
+      }
+      for (uint32_t i = strip_begin; i < strip_end; ++i) {
+        *out_it++ = partition.indices[i];
       }
-      // The last degenerate face will be added implicitly in the StoreStrip()
-      // function below as the first point index is going to be encoded there
-      // again.
+      num_encoded_faces += strip_end - strip_begin - 2;
+      last_encoded_point = partition.indices[strip_end - 1];
+      ++num_strips_;
+      strip_begin = strip_end;
     }
-
-    StoreStrip(longest_strip_id, out_it);
   }
 
   return true;
@@ -0,0 +1,153 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_stripifier.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+
+namespace {
+
+using Triangle = std::array<uint32_t, 3>;
+
+// Returns |t| rotated so that its smallest index comes first.
+Triangle Normalize(Triangle t) {
+  std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+  return t;
+}
+
+// Returns the sorted non-degenerate triangles of the faces of |mesh|.
+std::vector<Triangle> MeshTriangles(const draco::Mesh &mesh) {
+  std::vector<Triangle> triangles;
+  for (draco::FaceIndex f(0); f < mesh.num_faces(); ++f) {
+    const draco::Mesh::Face &face = mesh.face(f);
+    triangles.push_back(
+        Normalize({face[0].value(), face[1].value(), face[2].value()}));
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+// Returns the sorted non-degenerate triangles of a strip with primitive
+// restart indices equal to |restart_index|.
+std::vector<Triangle> StripTriangles(const std::vector<uint32_t> &strip,
+                                     uint32_t restart_index) {
+  std::vector<Triangle> triangles;
+  size_t strip_begin = 0;
+  for (size_t i = 0; i <= strip.size(); ++i) {
+    if (i < strip.size() && strip[i] != restart_index) {
+      continue;
+    }
+    for (size_t j = strip_begin; j + 2 < i; ++j) {
+      Triangle t = {strip[j], strip[j + 1], strip[j + 2]};
+      if (t[0] == t[1] || t[1] == t[2] || t[0] == t[2]) {
+        continue;
+      }
+      if ((j - strip_begin) & 1) {
+        // Every other triangle of a strip has a flipped winding.
+        std::swap(t[0], t[1]);
+      }
+      triangles.push_back(Normalize(t));
+    }
+    strip_begin = i + 1;
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+TEST(MeshStripifierTest, StripsCoverAllFaces) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  const std::vector<Triangle> mesh_triangles = MeshTriangles(*mesh);
+  const uint32_t restart_index = std::numeric_limits<uint32_t>::max();
+
+  std::vector<uint32_t> serial_strip;
+  for (const int num_partitions : {1, 4}) {
+    draco::MeshStripifier stripifier;
+    stripifier.SetNumPartitions(num_partitions);
+    std::vector<uint32_t> strip;
+    ASSERT_TRUE(stripifier.GenerateTriangleStripsWithPrimitiveRestart(
+        *mesh, restart_index, std::back_inserter(strip)));
+    ASSERT_EQ(StripTriangles(strip, restart_index), mesh_triangles);
+    ASSERT_EQ(std::count(strip.begin(), strip.end(), restart_index) + 1,
+              stripifier.num_strips());
+
+    // The output does not depend on the thread pool.
+    draco::ThreadPool pool(4);
+    stripifier.SetThreadPool(&pool);
+    std::vector<uint32_t> parallel_strip;
+    ASSERT_TRUE(stripifier.GenerateTriangleStripsWithPrimitiveRestart(
+        *mesh, restart_index, std::back_inserter(parallel_strip)));
+    ASSERT_EQ(parallel_strip, strip);
+
+    std::vector<uint32_t> degenerate_strip;
+    ASSERT_TRUE(stripifier.GenerateTriangleStripsWithDegenerateTriangles(
+        *mesh, std::back_inserter(degenerate_strip)));
+    ASSERT_EQ(StripTriangles(degenerate_strip, restart_index), mesh_triangles);
+    if (num_partitions == 1) {
+      serial_strip = strip;
+    } else {
+      // Partitions add only a few strip breaks.
+      ASSERT_LT(strip.size(), serial_strip.size() * 11 / 10);
+    }
+  }
+}
+
+TEST(MeshStripifierTest, ReusesDecodedCornerTable) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  encoder.SetEncodingMethod(draco::MESH_EDGEBREAKER_ENCODING);
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &buffer));
+
+  draco::BatchDecoder decoder;
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::Mesh> decoded_mesh,
+                         decoder.DecodeMeshFromBuffer(&in_buffer));
+  const draco::CornerTable *const corner_table =
+      decoder.GetLastMeshCornerTable();
+  ASSERT_NE(corner_table, nullptr);
+  ASSERT_EQ(corner_table->num_faces(), decoded_mesh->num_faces());
+
+  const uint32_t restart_index = std::numeric_limits<uint32_t>::max();
+  draco::MeshStripifier stripifier;
+  std::vector<uint32_t> strip;
+  ASSERT_TRUE(stripifier.GenerateTriangleStripsWithPrimitiveRestart(
+      *decoded_mesh, restart_index, std::back_inserter(strip)));
+  stripifier.SetCornerTable(corner_table);
+  std::vector<uint32_t> reused_strip;
+  ASSERT_TRUE(stripifier.GenerateTriangleStripsWithPrimitiveRestart(
+      *decoded_mesh, restart_index, std::back_inserter(reused_strip)));
+  ASSERT_EQ(StripTriangles(reused_strip, restart_index),
+            MeshTriangles(*decoded_mesh));
+  ASSERT_EQ(StripTriangles(reused_strip, restart_index),
+            StripTriangles(strip, restart_index));
+}
+
+}  // namespace
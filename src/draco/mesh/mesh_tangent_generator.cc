@@ -0,0 +1,259 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_tangent_generator.h"
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "draco/core/vector_d.h"
+#include "draco/mesh/mesh_attribute_corner_table.h"
+#include "draco/mesh/mesh_misc_functions.h"
+#include "draco/metadata/geometry_metadata.h"
+
+namespace draco {
+
+namespace {
+
+// Number of faces processed by a single parallel task.
+constexpr int kFaceChunkSize = 1 << 14;
+
+// Returns the component of |v| perpendicular to the unit vector |n|.
+Vector3f ProjectToPlane(const Vector3f &v, const Vector3f &n) {
+  return v - n * n.Dot(v);
+}
+
+// Returns the root of the set containing |i|, compressing the path.
+int FindRoot(std::vector<int> *parents, int i) {
+  while ((*parents)[i] != i) {
+    (*parents)[i] = (*parents)[(*parents)[i]];
+    i = (*parents)[i];
+  }
+  return i;
+}
+
+void Unite(std::vector<int> *parents, int a, int b) {
+  a = FindRoot(parents, a);
+  b = FindRoot(parents, b);
+  if (a != b) {
+    (*parents)[std::max(a, b)] = std::min(a, b);
+  }
+}
+
+}  // namespace
+
+Status MeshTangentGenerator::GenerateTangents(Mesh *mesh, ThreadPool *pool) {
+  const PointAttribute *const pos_att =
+      mesh->GetNamedAttribute(GeometryAttribute::POSITION);
+  const PointAttribute *const normal_att =
+      mesh->GetNamedAttribute(GeometryAttribute::NORMAL);
+  const PointAttribute *const tex_att =
+      mesh->GetNamedAttribute(GeometryAttribute::TEX_COORD);
+  if (pos_att == nullptr || normal_att == nullptr || tex_att == nullptr) {
+    return Status(Status::DRACO_ERROR,
+                  "Tangents require positions, normals and texture "
+                  "coordinates.");
+  }
+  if (pos_att->num_components() != 3 || normal_att->num_components() != 3 ||
+      tex_att->num_components() != 2) {
+    return Status(Status::DRACO_ERROR, "Unsupported attribute format.");
+  }
+  const int num_faces = mesh->num_faces();
+  if (num_faces == 0) {
+    return Status(Status::DRACO_ERROR, "Mesh has no faces.");
+  }
+  const int num_corners = 3 * num_faces;
+  std::unique_ptr<CornerTable> corner_table =
+      CreateCornerTableFromPositionAttribute(mesh);
+  if (corner_table == nullptr) {
+    return Status(Status::DRACO_ERROR, "Failed to create the corner table.");
+  }
+  // The seams of normals and texture coordinates are detected in parallel.
+  MeshAttributeCornerTable att_tables[2];
+  const PointAttribute *const table_atts[2] = {normal_att, tex_att};
+  uint8_t is_table_valid[2] = {0, 0};
+  ParallelFor(pool, 2, [&](int i) {
+    is_table_valid[i] = att_tables[i].InitFromAttribute(
+        mesh, corner_table.get(), table_atts[i]);
+  });
+  if (!is_table_valid[0] || !is_table_valid[1]) {
+    return Status(Status::DRACO_ERROR, "Failed to create the corner table.");
+  }
+  const MeshAttributeCornerTable &normal_table = att_tables[0];
+  const MeshAttributeCornerTable &tex_table = att_tables[1];
+
+  // Compute the angle weighted tangents of all corners and the orientation of
+  // the texture mapping of all faces.
+  std::vector<Vector3f> corner_tangents(num_corners);
+  std::vector<Vector3f> corner_normals(num_corners);
+  std::vector<float> corner_weights(num_corners);
+  std::vector<uint8_t> is_face_orientation_preserving(num_faces);
+  const int num_chunks = (num_faces + kFaceChunkSize - 1) / kFaceChunkSize;
+  ParallelFor(pool, num_chunks, [&](int chunk) {
+    const int begin = chunk * kFaceChunkSize;
+    const int end = std::min(begin + kFaceChunkSize, num_faces);
+    for (int f = begin; f < end; ++f) {
+      const Mesh::Face &face = mesh->face(FaceIndex(f));
+      Vector3f positions[3];
+      Vector2f tex_coords[3];
+      for (int c = 0; c < 3; ++c) {
+        pos_att->GetMappedValue(face[c], &positions[c][0]);
+        tex_att->GetMappedValue(face[c], &tex_coords[c][0]);
+        Vector3f &normal = corner_normals[3 * f + c];
+        normal_att->GetMappedValue(face[c], &normal[0]);
+        const float length = std::sqrt(normal.SquaredNorm());
+        if (length > 0.f) {
+          normal = normal / length;
+        }
+      }
+      const Vector3f d1 = positions[1] - positions[0];
+      const Vector3f d2 = positions[2] - positions[0];
+      const Vector2f t21 = tex_coords[1] - tex_coords[0];
+      const Vector2f t31 = tex_coords[2] - tex_coords[0];
+      const float signed_tex_area = t21[0] * t31[1] - t21[1] * t31[0];
+      is_face_orientation_preserving[f] = signed_tex_area > 0.f;
+      Vector3f face_tangent = d1 * t31[1] - d2 * t21[1];
+      if (signed_tex_area < 0.f) {
+        face_tangent = -face_tangent;
+      }
+      for (int c = 0; c < 3; ++c) {
+        const int corner = 3 * f + c;
+        const Vector3f &n = corner_normals[corner];
+        Vector3f tangent = ProjectToPlane(face_tangent, n);
+        const float tangent_length = std::sqrt(tangent.SquaredNorm());
+        Vector3f e1 = ProjectToPlane(positions[(c + 1) % 3] - positions[c], n);
+        Vector3f e2 = ProjectToPlane(positions[(c + 2) % 3] - positions[c], n);
+        const float e1_length = std::sqrt(e1.SquaredNorm());
+        const float e2_length = std::sqrt(e2.SquaredNorm());
+        if (signed_tex_area == 0.f || tangent_length <= 0.f ||
+            e1_length <= 0.f || e2_length <= 0.f) {
+          // Degenerate corners do not contribute to the tangent.
+          corner_tangents[corner] = Vector3f(0.f, 0.f, 0.f);
+          corner_weights[corner] = 0.f;
+          continue;
+        }
+        const float cos_angle = std::max(
+            -1.f, std::min(1.f, e1.Dot(e2) / (e1_length * e2_length)));
+        corner_tangents[corner] = tangent / tangent_length;
+        corner_weights[corner] = std::acos(cos_angle);
+      }
+    }
+  });
+
+  // Group corners sharing a tangent. Neighboring corners around a vertex are
+  // grouped when no attribute seam or orientation change separates them.
+  std::vector<int> parents(num_corners);
+  std::iota(parents.begin(), parents.end(), 0);
+  for (CornerIndex c(0); c < num_corners; ++c) {
+    const CornerIndex next = normal_table.SwingRight(c);
+    if (next == kInvalidCornerIndex || tex_table.SwingRight(c) != next) {
+      continue;
+    }
+    if (is_face_orientation_preserving[c.value() / 3] !=
+        is_face_orientation_preserving[next.value() / 3]) {
+      continue;
+    }
+    Unite(&parents, c.value(), next.value());
+  }
+  // All corners of a point get the same tangent.
+  std::vector<int> point_to_corner(mesh->num_points(), -1);
+  for (int corner = 0; corner < num_corners; ++corner) {
+    const PointIndex pi = mesh->face(FaceIndex(corner / 3))[corner % 3];
+    if (point_to_corner[pi.value()] < 0) {
+      point_to_corner[pi.value()] = corner;
+    } else {
+      Unite(&parents, point_to_corner[pi.value()], corner);
+    }
+  }
+
+  // Sum the tangents of each group. Orientation of a group is given by the
+  // majority of its corner weights.
+  std::vector<int> group_ids(num_corners, -1);
+  std::vector<Vector3f> group_tangents;
+  std::vector<float> group_orientations;
+  std::vector<int> group_corners;
+  for (int corner = 0; corner < num_corners; ++corner) {
+    const int root = FindRoot(&parents, corner);
+    if (group_ids[root] < 0) {
+      group_ids[root] = static_cast<int>(group_tangents.size());
+      group_tangents.push_back(Vector3f(0.f, 0.f, 0.f));
+      group_orientations.push_back(0.f);
+      group_corners.push_back(corner);
+    }
+    const int group = group_ids[root];
+    group_ids[corner] = group;
+    const float weight = corner_weights[corner];
+    group_tangents[group] += corner_tangents[corner] * weight;
+    group_orientations[group] +=
+        is_face_orientation_preserving[corner / 3] ? weight : -weight;
+  }
+
+  // Store one tangent per group.
+  const int num_groups = static_cast<int>(group_tangents.size());
+  GeometryAttribute ga;
+  ga.Init(GeometryAttribute::TANGENT, nullptr, 4, DT_FLOAT32, false,
+          4 * sizeof(float), 0);
+  std::unique_ptr<PointAttribute> tangent_att(new PointAttribute(ga));
+  tangent_att->Reset(num_groups);
+  ParallelFor(pool, (num_groups + kFaceChunkSize - 1) / kFaceChunkSize,
+              [&](int chunk) {
+                const int begin = chunk * kFaceChunkSize;
+                const int end = std::min(begin + kFaceChunkSize, num_groups);
+                for (int g = begin; g < end; ++g) {
+                  const Vector3f &n = corner_normals[group_corners[g]];
+                  Vector3f t = ProjectToPlane(group_tangents[g], n);
+                  float length = std::sqrt(t.SquaredNorm());
+                  if (length <= 0.f) {
+                    // Use any direction perpendicular to the normal.
+                    t = std::abs(n[0]) < 0.9f
+                            ? CrossProduct(n, Vector3f(1.f, 0.f, 0.f))
+                            : CrossProduct(n, Vector3f(0.f, 1.f, 0.f));
+                    length = std::sqrt(t.SquaredNorm());
+                  }
+                  if (length > 0.f) {
+                    t = t / length;
+                  }
+                  const float value[4] = {
+                      t[0], t[1], t[2],
+                      group_orientations[g] >= 0.f ? 1.f : -1.f};
+                  tangent_att->SetAttributeValue(AttributeValueIndex(g), value);
+                }
+              });
+  tangent_att->SetExplicitMapping(mesh->num_points());
+  for (PointIndex pi(0); pi < mesh->num_points(); ++pi) {
+    const int corner = point_to_corner[pi.value()];
+    // Points not used by any face get the first tangent.
+    tangent_att->SetPointMapEntry(
+        pi, AttributeValueIndex(corner < 0 ? 0 : group_ids[corner]));
+  }
+
+  const int old_att_id = mesh->GetNamedAttributeId(GeometryAttribute::TANGENT);
+  if (old_att_id >= 0) {
+    mesh->DeleteAttribute(old_att_id);
+  }
+  const int att_id = mesh->AddAttribute(std::move(tangent_att));
+  std::unique_ptr<AttributeMetadata> metadata(new AttributeMetadata());
+  metadata->AddEntryInt("auto_generated", 1);
+  mesh->AddAttributeMetadata(att_id, std::move(metadata));
+  return OkStatus();
+}
+
+}  // namespace draco
+
+#endif  // DRACO_TRANSCODER_SUPPORTED
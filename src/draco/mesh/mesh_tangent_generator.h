@@ -0,0 +1,58 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_MESH_MESH_TANGENT_GENERATOR_H_
+#define DRACO_MESH_MESH_TANGENT_GENERATOR_H_
+
+#include "draco/draco_features.h"
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include "draco/core/status.h"
+#include "draco/core/thread_pool.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Generates per-vertex tangents of a mesh following the MikkTSpace algorithm
+// used by glTF, so that tangents can be removed before compression and
+// regenerated after decoding. The mesh must have positions, normals and
+// texture coordinates (the first TEX_COORD attribute is used).
+//
+// Corners sharing a position are grouped like in MikkTSpace: neighboring
+// corners form a group when their normals and texture coordinates are not
+// separated by a seam (see MeshAttributeCornerTable) and when the texture
+// mapping of their faces has the same orientation. The tangent of a group is
+// the sum of the face tangents projected into the tangent plane of the normal
+// and weighted by the corner angles. The fourth component stores the sign of
+// the bitangent, i.e., bitangent = cross(normal, tangent.xyz) * tangent.w.
+//
+// Unlike MikkTSpace, the generator does not split points. All corners of a
+// point are placed in the same group, which differs from MikkTSpace only for
+// points shared by faces with opposite texture orientations.
+class MeshTangentGenerator {
+ public:
+  // Adds a TANGENT attribute with four float components to |mesh|, or
+  // replaces the existing one. The attribute is marked with the
+  // "auto_generated" metadata entry (see MeshUtils::HasAutoGeneratedTangents).
+  // Per-face computations run on |pool| when it is not nullptr.
+  static Status GenerateTangents(Mesh *mesh, ThreadPool *pool);
+  static Status GenerateTangents(Mesh *mesh) {
+    return GenerateTangents(mesh, nullptr);
+  }
+};
+
+}  // namespace draco
+
+#endif  // DRACO_TRANSCODER_SUPPORTED
+#endif  // DRACO_MESH_MESH_TANGENT_GENERATOR_H_
@@ -0,0 +1,151 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_tangent_generator.h"
+
+#include <cmath>
+#include <memory>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/vector_d.h"
+#include "draco/mesh/mesh_utils.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
+
+namespace draco {
+
+class MeshTangentGeneratorTest : public ::testing::Test {
+ protected:
+  // Creates a planar quad with normals pointing along +z. The texture
+  // coordinates are equal to the xy coordinates of the vertices, optionally
+  // with the u coordinate flipped.
+  std::unique_ptr<Mesh> CreateQuad(bool flip_u) {
+    TriangleSoupMeshBuilder mb;
+    mb.Start(2);
+    const int pos_att_id =
+        mb.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+    const int normal_att_id =
+        mb.AddAttribute(GeometryAttribute::NORMAL, 3, DT_FLOAT32);
+    const int tex_att_id =
+        mb.AddAttribute(GeometryAttribute::TEX_COORD, 2, DT_FLOAT32);
+    const Vector3f p[4] = {Vector3f(0.f, 0.f, 0.f), Vector3f(1.f, 0.f, 0.f),
+                           Vector3f(1.f, 1.f, 0.f), Vector3f(0.f, 1.f, 0.f)};
+    const float u_scale = flip_u ? -1.f : 1.f;
+    Vector2f t[4];
+    for (int i = 0; i < 4; ++i) {
+      t[i] = Vector2f(u_scale * p[i][0], p[i][1]);
+    }
+    const Vector3f n(0.f, 0.f, 1.f);
+    mb.SetAttributeValuesForFace(pos_att_id, FaceIndex(0), p[0].data(),
+                                 p[1].data(), p[2].data());
+    mb.SetAttributeValuesForFace(pos_att_id, FaceIndex(1), p[0].data(),
+                                 p[2].data(), p[3].data());
+    mb.SetAttributeValuesForFace(tex_att_id, FaceIndex(0), t[0].data(),
+                                 t[1].data(), t[2].data());
+    mb.SetAttributeValuesForFace(tex_att_id, FaceIndex(1), t[0].data(),
+                                 t[2].data(), t[3].data());
+    for (FaceIndex f(0); f < 2; ++f) {
+      mb.SetAttributeValuesForFace(normal_att_id, f, n.data(), n.data(),
+                                   n.data());
+    }
+    return mb.Finalize();
+  }
+
+  // Verifies that all tangents of |mesh| are unit vectors perpendicular to
+  // the normals with a valid bitangent sign.
+  void VerifyTangents(const Mesh &mesh) {
+    const PointAttribute *const normal_att =
+        mesh.GetNamedAttribute(GeometryAttribute::NORMAL);
+    const PointAttribute *const tangent_att =
+        mesh.GetNamedAttribute(GeometryAttribute::TANGENT);
+    ASSERT_NE(tangent_att, nullptr);
+    ASSERT_EQ(tangent_att->num_components(), 4);
+    for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+      Vector3f n;
+      Vector4f t;
+      normal_att->GetMappedValue(pi, &n[0]);
+      tangent_att->GetMappedValue(pi, &t[0]);
+      const Vector3f t3(t[0], t[1], t[2]);
+      ASSERT_NEAR(t3.SquaredNorm(), 1.f, 1e-5f);
+      ASSERT_NEAR(t3.Dot(n) / std::sqrt(n.SquaredNorm()), 0.f, 1e-5f);
+      ASSERT_EQ(std::abs(t[3]), 1.f);
+    }
+  }
+};
+
+TEST_F(MeshTangentGeneratorTest, TestPlanarQuad) {
+  for (const bool flip_u : {false, true}) {
+    std::unique_ptr<Mesh> mesh = CreateQuad(flip_u);
+    ASSERT_NE(mesh, nullptr);
+    DRACO_ASSERT_OK(MeshTangentGenerator::GenerateTangents(mesh.get()));
+    ASSERT_TRUE(MeshUtils::HasAutoGeneratedTangents(*mesh));
+    VerifyTangents(*mesh);
+    // Tangents follow the u direction and the bitangents the v direction.
+    const PointAttribute *const tangent_att =
+        mesh->GetNamedAttribute(GeometryAttribute::TANGENT);
+    const float sign = flip_u ? -1.f : 1.f;
+    for (PointIndex pi(0); pi < mesh->num_points(); ++pi) {
+      Vector4f t;
+      tangent_att->GetMappedValue(pi, &t[0]);
+      ASSERT_NEAR(t[0], sign, 1e-5f);
+      ASSERT_NEAR(t[1], 0.f, 1e-5f);
+      ASSERT_NEAR(t[2], 0.f, 1e-5f);
+      ASSERT_EQ(t[3], sign);
+    }
+  }
+}
+
+TEST_F(MeshTangentGeneratorTest, TestReplacesExistingTangents) {
+  std::unique_ptr<Mesh> mesh = CreateQuad(false);
+  ASSERT_NE(mesh, nullptr);
+  DRACO_ASSERT_OK(MeshTangentGenerator::GenerateTangents(mesh.get()));
+  DRACO_ASSERT_OK(MeshTangentGenerator::GenerateTangents(mesh.get()));
+  ASSERT_EQ(mesh->NumNamedAttributes(GeometryAttribute::TANGENT), 1);
+  ASSERT_TRUE(MeshUtils::HasAutoGeneratedTangents(*mesh));
+}
+
+TEST_F(MeshTangentGeneratorTest, TestMissingTextureCoordinates) {
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  mesh->DeleteAttribute(
+      mesh->GetNamedAttributeId(GeometryAttribute::TEX_COORD));
+  ASSERT_FALSE(MeshTangentGenerator::GenerateTangents(mesh.get()).ok());
+}
+
+TEST_F(MeshTangentGeneratorTest, TestParallelGeneration) {
+  // Tangents computed on a thread pool must match the serial result.
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  std::unique_ptr<Mesh> parallel_mesh = ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(parallel_mesh, nullptr);
+  DRACO_ASSERT_OK(MeshTangentGenerator::GenerateTangents(mesh.get()));
+  ThreadPool pool(4);
+  DRACO_ASSERT_OK(
+      MeshTangentGenerator::GenerateTangents(parallel_mesh.get(), &pool));
+  VerifyTangents(*mesh);
+  const PointAttribute *const att =
+      mesh->GetNamedAttribute(GeometryAttribute::TANGENT);
+  const PointAttribute *const parallel_att =
+      parallel_mesh->GetNamedAttribute(GeometryAttribute::TANGENT);
+  ASSERT_EQ(att->size(), parallel_att->size());
+  for (PointIndex pi(0); pi < mesh->num_points(); ++pi) {
+    Vector4f t, parallel_t;
+    att->GetMappedValue(pi, &t[0]);
+    parallel_att->GetMappedValue(pi, &parallel_t[0]);
+    ASSERT_EQ(t, parallel_t);
+  }
+}
+
+}  // namespace draco
@@ -745,4 +745,33 @@ TEST(MeshTest, TestMeshBoundingBox) {
   EXPECT_EQ(min_pt[2], bounding_box.GetMinPoint()[2]);
 }
 
+// Tests reporting of the memory footprint and releasing of unused capacity.
+TEST(MeshTest, TestMemoryUsage) {
+  std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  const draco::MemoryFootprint usage = mesh->MemoryUsage();
+  const int64_t face_bytes = mesh->num_faces() * sizeof(draco::Mesh::Face);
+  ASSERT_GE(usage.faces, face_bytes);
+  int64_t attribute_bytes = 0;
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    attribute_bytes += mesh->attribute(i)->buffer()->data_size();
+  }
+  ASSERT_GE(usage.attribute_values, attribute_bytes);
+  ASSERT_EQ(usage.total(), usage.attribute_values +
+                               usage.attribute_index_maps + usage.faces +
+                               usage.metadata + usage.textures);
+
+  // Add unused capacity to the faces and check that it gets released.
+  const int num_faces = mesh->num_faces();
+  mesh->AddFace(draco::Mesh::Face());
+  mesh->SetNumFaces(num_faces);
+  ASSERT_GT(mesh->MemoryUsage().faces, face_bytes);
+  mesh->ShrinkToFit();
+  const draco::MemoryFootprint shrunk_usage = mesh->MemoryUsage();
+  ASSERT_EQ(shrunk_usage.faces, face_bytes);
+  ASSERT_EQ(shrunk_usage.attribute_values, attribute_bytes);
+  ASSERT_LE(shrunk_usage.total(), usage.total());
+}
+
 }  // namespace
@@ -14,6 +14,10 @@
 //
 #include "draco/mesh/mesh_utils.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -24,18 +28,155 @@
 
 namespace draco {
 
+namespace {
+
+// Number of attribute values that are transformed together. The values of a
+// batch are split into separate arrays of x, y and z coordinates so that the
+// transformation loops can be vectorized by the compiler.
+constexpr int kTransformBatchSize = 256;
+
+// Number of attribute values transformed by a single task of a thread pool.
+constexpr int64_t kTransformChunkSize = 16 * 1024;
+
+// Calls |func| for ranges [begin, end) that cover all |num_values| values.
+// The ranges are processed in parallel on |pool| when it is not null.
+template <typename FuncT>
+void ForEachTransformChunk(int64_t num_values, ThreadPool *pool,
+                           const FuncT &func) {
+  const int64_t num_chunks =
+      (num_values + kTransformChunkSize - 1) / kTransformChunkSize;
+  ParallelFor(pool, static_cast<int>(num_chunks), [&](int chunk) {
+    const int64_t begin = chunk * kTransformChunkSize;
+    func(begin, std::min(begin + kTransformChunkSize, num_values));
+  });
+}
+
+// Loads the first three float components of |num_values| values stored with
+// |byte_stride| at |data| into |x|, |y| and |z|.
+void LoadBatch(const uint8_t *data, int64_t byte_stride, int num_values,
+               double *x, double *y, double *z) {
+  for (int i = 0; i < num_values; ++i) {
+    float value[3];
+    memcpy(value, data + i * byte_stride, sizeof(value));
+    x[i] = value[0];
+    y[i] = value[1];
+    z[i] = value[2];
+  }
+}
+
+// Stores |x|, |y| and |z| as the first three float components of |num_values|
+// values with |byte_stride| at |data|. Other components are not modified.
+void StoreBatch(const double *x, const double *y, const double *z,
+                int num_values, int64_t byte_stride, uint8_t *data) {
+  for (int i = 0; i < num_values; ++i) {
+    const float value[3] = {static_cast<float>(x[i]), static_cast<float>(y[i]),
+                            static_cast<float>(z[i])};
+    memcpy(data + i * byte_stride, value, sizeof(value));
+  }
+}
+
+// Transforms float positions in range [begin, end) of the values stored
+// with |byte_stride| at |data| by the affine part of |transform|.
+void TransformFloatPositions(const Eigen::Matrix4d &transform, int64_t begin,
+                             int64_t end, int64_t byte_stride, uint8_t *data) {
+  double m[3][4];
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 4; ++c) {
+      m[r][c] = transform(r, c);
+    }
+  }
+  double x[kTransformBatchSize], y[kTransformBatchSize], z[kTransformBatchSize];
+  double tx[kTransformBatchSize], ty[kTransformBatchSize],
+      tz[kTransformBatchSize];
+  for (int64_t i = begin; i < end; i += kTransformBatchSize) {
+    const int n =
+        static_cast<int>(std::min<int64_t>(kTransformBatchSize, end - i));
+    uint8_t *const batch_data = data + i * byte_stride;
+    LoadBatch(batch_data, byte_stride, n, x, y, z);
+    for (int j = 0; j < n; ++j) {
+      tx[j] = m[0][0] * x[j] + m[0][1] * y[j] + m[0][2] * z[j] + m[0][3];
+      ty[j] = m[1][0] * x[j] + m[1][1] * y[j] + m[1][2] * z[j] + m[1][3];
+      tz[j] = m[2][0] * x[j] + m[2][1] * y[j] + m[2][2] * z[j] + m[2][3];
+    }
+    StoreBatch(tx, ty, tz, n, byte_stride, batch_data);
+  }
+}
+
+// Transforms the first three components of float values in range
+// [begin, end) of the values stored with |byte_stride| at |data| by
+// |transform| and normalizes the result. Any fourth component is left
+// unchanged.
+void TransformFloatNormalizedValues(const Eigen::Matrix3d &transform,
+                                    int64_t begin, int64_t end,
+                                    int64_t byte_stride, uint8_t *data) {
+  double m[3][3];
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      m[r][c] = transform(r, c);
+    }
+  }
+  double x[kTransformBatchSize], y[kTransformBatchSize], z[kTransformBatchSize];
+  double tx[kTransformBatchSize], ty[kTransformBatchSize],
+      tz[kTransformBatchSize];
+  for (int64_t i = begin; i < end; i += kTransformBatchSize) {
+    const int n =
+        static_cast<int>(std::min<int64_t>(kTransformBatchSize, end - i));
+    uint8_t *const batch_data = data + i * byte_stride;
+    LoadBatch(batch_data, byte_stride, n, x, y, z);
+    for (int j = 0; j < n; ++j) {
+      tx[j] = m[0][0] * x[j] + m[0][1] * y[j] + m[0][2] * z[j];
+      ty[j] = m[1][0] * x[j] + m[1][1] * y[j] + m[1][2] * z[j];
+      tz[j] = m[2][0] * x[j] + m[2][1] * y[j] + m[2][2] * z[j];
+    }
+    for (int j = 0; j < n; ++j) {
+      // Zero vectors are left unchanged like in Eigen::Vector3d::normalized().
+      const double squared_norm =
+          tx[j] * tx[j] + ty[j] * ty[j] + tz[j] * tz[j];
+      const double norm = squared_norm > 0 ? std::sqrt(squared_norm) : 1.0;
+      tx[j] /= norm;
+      ty[j] /= norm;
+      tz[j] /= norm;
+    }
+    StoreBatch(tx, ty, tz, n, byte_stride, batch_data);
+  }
+}
+
+// Returns true when the transformation kernels above can be used for |att|.
+bool CanUseFloatTransform(const PointAttribute &att) {
+  return att.data_type() == DT_FLOAT32 && att.num_components() >= 3 &&
+         att.size() > 0;
+}
+
+}  // namespace
+
 void MeshUtils::TransformMesh(const Eigen::Matrix4d &transform, Mesh *mesh) {
+  TransformMesh(transform, nullptr, mesh);
+}
+
+void MeshUtils::TransformMesh(const Eigen::Matrix4d &transform,
+                              ThreadPool *pool, Mesh *mesh) {
   // Transform positions.
   PointAttribute *pos_att =
       mesh->attribute(mesh->GetNamedAttributeId(GeometryAttribute::POSITION));
-  for (AttributeValueIndex avi(0); avi < pos_att->size(); ++avi) {
-    Vector3f pos_val;
-    pos_att->GetValue(avi, &pos_val[0]);
-    Eigen::Vector4d transformed_val(pos_val[0], pos_val[1], pos_val[2], 1);
-    transformed_val = transform * transformed_val;
-    pos_val =
-        Vector3f(transformed_val[0], transformed_val[1], transformed_val[2]);
-    pos_att->SetAttributeValue(avi, &pos_val[0]);
+  if (CanUseFloatTransform(*pos_att)) {
+    // The address is obtained before the parallel loop, because mutable
+    // accessors of the attribute buffer are not thread-safe.
+    uint8_t *const data = pos_att->GetAddress(AttributeValueIndex(0));
+    const int64_t byte_stride = pos_att->byte_stride();
+    ForEachTransformChunk(
+        pos_att->size(), pool, [&](int64_t begin, int64_t end) {
+          TransformFloatPositions(transform, begin, end, byte_stride, data);
+        });
+  } else {
+    for (AttributeValueIndex avi(0); avi < pos_att->size(); ++avi) {
+      Vector3f pos_val;
+      pos_att->GetValue(avi, &pos_val[0]);
+      Eigen::Vector4d transformed_val(pos_val[0], pos_val[1], pos_val[2], 1);
+      transformed_val = transform * transformed_val;
+      pos_val =
+          Vector3f(transformed_val[0], transformed_val[1], transformed_val[2]);
+      pos_att->SetAttributeValue(avi, &pos_val[0]);
+    }
   }
 
   // Transform normals and tangents.
@@ -57,10 +198,10 @@ void MeshUtils::TransformMesh(const Eigen::Matrix4d &transform, Mesh *mesh) {
     it_transform = it_transform.inverse().transpose();
 
     if (normal_att) {
-      TransformNormalizedAttribute(it_transform, normal_att);
+      TransformNormalizedAttribute(it_transform, pool, normal_att);
     }
     if (tangent_att) {
-      TransformNormalizedAttribute(it_transform, tangent_att);
+      TransformNormalizedAttribute(it_transform, pool, tangent_att);
     }
   }
 }
@@ -185,6 +326,199 @@ std::unordered_set<int> FindUsedMaterials(const Mesh &mesh) {
   return used_materials;
 }
 
+StatusOr<std::unique_ptr<Mesh>> MeshUtils::MergeMeshes(
+    const std::vector<const Mesh *> &meshes,
+    const std::vector<Eigen::Matrix4d> &transforms, ThreadPool *pool) {
+  const int num_meshes = static_cast<int>(meshes.size());
+  if (!transforms.empty() && transforms.size() != meshes.size()) {
+    return Status(Status::DRACO_ERROR,
+                  "Number of transforms does not match the number of meshes.");
+  }
+
+  // Offsets of the points and faces of each mesh in the merged mesh.
+  std::vector<uint32_t> point_offsets(num_meshes + 1, 0);
+  std::vector<uint32_t> face_offsets(num_meshes + 1, 0);
+  for (int m = 0; m < num_meshes; ++m) {
+    if (meshes[m] == nullptr) {
+      return Status(Status::DRACO_ERROR, "Null mesh cannot be merged.");
+    }
+    const uint64_t num_points =
+        uint64_t{point_offsets[m]} + meshes[m]->num_points();
+    const uint64_t num_faces =
+        uint64_t{face_offsets[m]} + meshes[m]->num_faces();
+    if (num_points > std::numeric_limits<int32_t>::max() ||
+        num_faces > std::numeric_limits<int32_t>::max()) {
+      return Status(Status::DRACO_ERROR, "Merged mesh is too large.");
+    }
+    point_offsets[m + 1] = static_cast<uint32_t>(num_points);
+    face_offsets[m + 1] = static_cast<uint32_t>(num_faces);
+  }
+
+  // Unify the attribute layout. Each attribute of the merged mesh stores the
+  // matching attribute of every source mesh (or nullptr) and the offsets of
+  // their values in the merged attribute.
+  struct MergedAttribute {
+    GeometryAttribute::Type type;
+    int index_of_type;
+    std::vector<const PointAttribute *> src_atts;
+    std::vector<uint32_t> value_offsets;
+    bool identity_mapping;
+    // First matching source attribute that defines the merged attribute.
+    const PointAttribute *first_src_att;
+    PointAttribute *att;
+  };
+  std::vector<MergedAttribute> merged_atts;
+  for (int m = 0; m < num_meshes; ++m) {
+    const Mesh &mesh = *meshes[m];
+    std::vector<int> num_atts_of_type(GeometryAttribute::NAMED_ATTRIBUTES_COUNT,
+                                      0);
+    for (int i = 0; i < mesh.num_attributes(); ++i) {
+      const PointAttribute *const src_att = mesh.attribute(i);
+      const GeometryAttribute::Type type = src_att->attribute_type();
+      const int index_of_type = num_atts_of_type[type]++;
+      auto it = std::find_if(merged_atts.begin(), merged_atts.end(),
+                             [&](const MergedAttribute &merged_att) {
+                               return merged_att.type == type &&
+                                      merged_att.index_of_type == index_of_type;
+                             });
+      if (it == merged_atts.end()) {
+        merged_atts.push_back({type, index_of_type,
+                               std::vector<const PointAttribute *>(num_meshes),
+                               std::vector<uint32_t>(num_meshes + 1), true,
+                               src_att, nullptr});
+        it = merged_atts.end() - 1;
+      }
+      const PointAttribute *const first_att = it->first_src_att;
+      if (first_att->data_type() != src_att->data_type() ||
+          first_att->num_components() != src_att->num_components() ||
+          first_att->normalized() != src_att->normalized() ||
+          first_att->byte_stride() != src_att->byte_stride()) {
+        return Status(Status::DRACO_ERROR,
+                      "Merged meshes have incompatible attributes.");
+      }
+      it->src_atts[m] = src_att;
+    }
+  }
+  for (MergedAttribute &merged_att : merged_atts) {
+    for (int m = 0; m < num_meshes; ++m) {
+      const PointAttribute *const src_att = merged_att.src_atts[m];
+      // Points of meshes without the attribute share a single zero value.
+      const uint64_t num_values =
+          uint64_t{merged_att.value_offsets[m]} +
+          (src_att != nullptr ? src_att->size() : 1);
+      if (num_values > std::numeric_limits<int32_t>::max()) {
+        return Status(Status::DRACO_ERROR, "Merged mesh is too large.");
+      }
+      merged_att.value_offsets[m + 1] = static_cast<uint32_t>(num_values);
+      if (src_att == nullptr || !src_att->is_mapping_identity() ||
+          src_att->size() != meshes[m]->num_points()) {
+        merged_att.identity_mapping = false;
+      }
+    }
+  }
+
+  // Transformed attributes must be supported by the float transform kernels.
+  if (!transforms.empty()) {
+    for (const MergedAttribute &merged_att : merged_atts) {
+      if (merged_att.index_of_type != 0 ||
+          (merged_att.type != GeometryAttribute::POSITION &&
+           merged_att.type != GeometryAttribute::NORMAL &&
+           merged_att.type != GeometryAttribute::TANGENT)) {
+        continue;
+      }
+      for (const PointAttribute *src_att : merged_att.src_atts) {
+        if (src_att != nullptr && (src_att->data_type() != DT_FLOAT32 ||
+                                   src_att->num_components() < 3)) {
+          return Status(Status::DRACO_ERROR,
+                        "Transformed attributes must have float values.");
+        }
+      }
+    }
+  }
+
+  // Allocate the merged mesh.
+  std::unique_ptr<Mesh> merged_mesh(new Mesh());
+  merged_mesh->set_num_points(point_offsets[num_meshes]);
+  merged_mesh->SetNumFacesUninitialized(face_offsets[num_meshes]);
+  // Addresses of the merged values are obtained before the parallel loop,
+  // because mutable accessors of the attribute buffers are not thread-safe.
+  std::vector<uint8_t *> merged_att_data(merged_atts.size(), nullptr);
+  for (int a = 0; a < merged_atts.size(); ++a) {
+    MergedAttribute &merged_att = merged_atts[a];
+    const PointAttribute *const first_att = merged_att.first_src_att;
+    std::unique_ptr<PointAttribute> att(new PointAttribute());
+    att->Init(first_att->attribute_type(), first_att->num_components(),
+              first_att->data_type(), first_att->normalized(),
+              merged_att.value_offsets[num_meshes]);
+    att->set_name(first_att->name());
+    if (!merged_att.identity_mapping) {
+      att->SetExplicitMapping(point_offsets[num_meshes]);
+    }
+    merged_att.att = att.get();
+    merged_att_data[a] = att->GetAddress(AttributeValueIndex(0));
+    merged_mesh->AddAttribute(std::move(att));
+  }
+
+  // Copy the values, point mappings and faces of each mesh.
+  Mesh *const dst_mesh = merged_mesh.get();
+  ParallelFor(pool, num_meshes, [&](int m) {
+    const Mesh &mesh = *meshes[m];
+    const uint32_t point_offset = point_offsets[m];
+    for (int a = 0; a < merged_atts.size(); ++a) {
+      const MergedAttribute &merged_att = merged_atts[a];
+      const PointAttribute *const src_att = merged_att.src_atts[m];
+      const uint32_t value_offset = merged_att.value_offsets[m];
+      const int64_t byte_stride = merged_att.att->byte_stride();
+      uint8_t *const dst_data = merged_att_data[a] + value_offset * byte_stride;
+      if (src_att == nullptr) {
+        memset(dst_data, 0, byte_stride);
+        for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+          merged_att.att->SetPointMapEntry(
+              PointIndex(point_offset + pi.value()),
+              AttributeValueIndex(value_offset));
+        }
+        continue;
+      }
+      if (src_att->size() > 0) {
+        memcpy(dst_data, src_att->GetAddress(AttributeValueIndex(0)),
+               src_att->size() * byte_stride);
+      }
+      if (!merged_att.identity_mapping) {
+        for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+          merged_att.att->SetPointMapEntry(
+              PointIndex(point_offset + pi.value()),
+              AttributeValueIndex(value_offset +
+                                  src_att->mapped_index(pi).value()));
+        }
+      }
+      if (transforms.empty() || merged_att.index_of_type != 0) {
+        continue;
+      }
+      const Eigen::Matrix4d &transform = transforms[m];
+      if (merged_att.type == GeometryAttribute::POSITION) {
+        TransformFloatPositions(transform, 0, src_att->size(), byte_stride,
+                                dst_data);
+      } else if (merged_att.type == GeometryAttribute::NORMAL ||
+                 merged_att.type == GeometryAttribute::TANGENT) {
+        // Use inverse-transpose matrix to transform normals and tangents.
+        const Eigen::Matrix3d it_transform =
+            transform.block<3, 3>(0, 0).inverse().transpose();
+        TransformFloatNormalizedValues(it_transform, 0, src_att->size(),
+                                       byte_stride, dst_data);
+      }
+    }
+    const uint32_t face_offset = face_offsets[m];
+    for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+      const Mesh::Face &face = mesh.face(fi);
+      dst_mesh->SetFace(FaceIndex(face_offset + fi.value()),
+                        {PointIndex(point_offset + face[0].value()),
+                         PointIndex(point_offset + face[1].value()),
+                         PointIndex(point_offset + face[2].value())});
+    }
+  });
+  return std::move(merged_mesh);
+}
+
 Status MeshUtils::RemoveUnusedMeshFeatures(Mesh *mesh) {
   // Unused mesh features are features that are not used by any face / vertex
   // of the |mesh|. Currently, each mesh feature can be "masked" for specific
@@ -415,7 +749,16 @@ StatusOr<int> MeshUtils::FindLowestTextureQuantization(
 }
 
 void MeshUtils::TransformNormalizedAttribute(const Eigen::Matrix3d &transform,
+                                             ThreadPool *pool,
                                              PointAttribute *att) {
+  if (CanUseFloatTransform(*att)) {
+    uint8_t *const data = att->GetAddress(AttributeValueIndex(0));
+    const int64_t byte_stride = att->byte_stride();
+    ForEachTransformChunk(att->size(), pool, [&](int64_t begin, int64_t end) {
+      TransformFloatNormalizedValues(transform, begin, end, byte_stride, data);
+    });
+    return;
+  }
   for (AttributeValueIndex avi(0); avi < att->size(); ++avi) {
     // Store up to 4 component values.
     Vector4f val(0, 0, 0, 1);
@@ -18,8 +18,12 @@
 #include "draco/draco_features.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <memory>
+#include <vector>
+
 #include "Eigen/Geometry"
 #include "draco/core/status_or.h"
+#include "draco/core/thread_pool.h"
 #include "draco/mesh/mesh.h"
 
 namespace draco {
@@ -33,10 +37,35 @@ class MeshUtils {
   // in-place.
   static void TransformMesh(const Eigen::Matrix4d &transform, Mesh *mesh);
 
+  // Same as above but large attributes are transformed in parallel on |pool|.
+  // |pool| can be null.
+  static void TransformMesh(const Eigen::Matrix4d &transform, ThreadPool *pool,
+                            Mesh *mesh);
+
   // Merges metadata from |src_mesh| to |dst_mesh|. Any metadata with the same
   // names are left unchanged.
   static void MergeMetadata(const Mesh &src_mesh, Mesh *dst_mesh);
 
+  // Merges |meshes| into a single mesh, e.g. to draw meshes that share a
+  // material in a single draw call. Points and faces of the meshes are
+  // concatenated in order. When |transforms| is not empty, it must contain one
+  // matrix per mesh that is applied to the positions, normals and tangents of
+  // the mesh like in TransformMesh(). The transformed attributes must store
+  // float values with at least three components.
+  //
+  // Attributes are matched by their type and their order among attributes of
+  // the same type, e.g. the second TEX_COORD attribute of every mesh becomes
+  // one attribute of the merged mesh. Matched attributes must have the same
+  // data type and number of components. Points of meshes that do not have an
+  // attribute are mapped to a zero value. Duplicate values are not removed and
+  // materials, metadata and mesh features of |meshes| are not copied.
+  //
+  // The values and faces of the meshes are copied in parallel on |pool|, which
+  // can be null.
+  static StatusOr<std::unique_ptr<Mesh>> MergeMeshes(
+      const std::vector<const Mesh *> &meshes,
+      const std::vector<Eigen::Matrix4d> &transforms, ThreadPool *pool);
+
   // Removes unused MeshFeatures from |mesh|. If the |mesh| contains any mesh
   // feature textures, the textures must be owned by the |mesh| otherwise an
   // error is returned.
@@ -68,11 +97,13 @@ class MeshUtils {
       int tex_target_quantization_bits);
 
   // Helper function that checks whether a mesh has auto-generated tangents.
-  // See go/tangents_and_draco_simplifier.
+  // See go/tangents_and_draco_simplifier. Such tangents can be generated by
+  // MeshTangentGenerator.
   static bool HasAutoGeneratedTangents(const Mesh &mesh);
 
  private:
   static void TransformNormalizedAttribute(const Eigen::Matrix3d &transform,
+                                           ThreadPool *pool,
                                            PointAttribute *att);
 
   template <typename att_components_t>
@@ -17,6 +17,8 @@
 #ifdef DRACO_TRANSCODER_SUPPORTED
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
 
 namespace {
 
@@ -427,6 +429,76 @@ TEST(MeshUtilsTest, RemoveUnusedPropertyAttributesIndices) {
   ASSERT_EQ(mesh->GetPropertyAttributesIndexMaterialMask(0, 0), 0);
 }
 
+TEST(MeshUtilsTest, MergeMeshes) {
+  auto mesh = draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+
+  // Mesh with positions only.
+  draco::TriangleSoupMeshBuilder builder;
+  builder.Start(1);
+  const int pos_att_id = builder.AddAttribute(
+      draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32);
+  builder.SetAttributeValuesForFace(
+      pos_att_id, draco::FaceIndex(0), draco::Vector3f(0.f, 0.f, 0.f).data(),
+      draco::Vector3f(1.f, 0.f, 0.f).data(),
+      draco::Vector3f(0.f, 1.f, 0.f).data());
+  std::unique_ptr<draco::Mesh> triangle = builder.Finalize();
+  ASSERT_NE(triangle, nullptr);
+
+  const std::vector<const draco::Mesh *> meshes = {mesh.get(), triangle.get(),
+                                                   mesh.get()};
+  std::vector<Eigen::Matrix4d> transforms(3, Eigen::Matrix4d::Identity());
+  transforms[2](0, 3) = 10.0;
+  draco::ThreadPool pool(2);
+  DRACO_ASSIGN_OR_ASSERT(
+      std::unique_ptr<draco::Mesh> merged,
+      draco::MeshUtils::MergeMeshes(meshes, transforms, &pool));
+  ASSERT_EQ(merged->num_faces(), 2 * mesh->num_faces() + 1);
+  ASSERT_EQ(merged->num_points(), 2 * mesh->num_points() + 3);
+  ASSERT_EQ(merged->num_attributes(), mesh->num_attributes());
+
+  // Compare the values of all attributes on the corners of the merged faces.
+  const draco::FaceIndex::ValueType num_cube_faces = mesh->num_faces();
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    const draco::PointAttribute *const att = mesh->attribute(i);
+    const draco::PointAttribute *const merged_att =
+        merged->GetNamedAttribute(att->attribute_type());
+    ASSERT_NE(merged_att, nullptr);
+    for (draco::FaceIndex fi(0); fi < num_cube_faces; ++fi) {
+      for (int c = 0; c < 3; ++c) {
+        draco::Vector3f value(0.f, 0.f, 0.f), first_value(0.f, 0.f, 0.f),
+            second_value(0.f, 0.f, 0.f);
+        att->GetMappedValue(mesh->face(fi)[c], &value[0]);
+        merged_att->GetMappedValue(merged->face(fi)[c], &first_value[0]);
+        merged_att->GetMappedValue(
+            merged->face(draco::FaceIndex(num_cube_faces + 1 + fi.value()))[c],
+            &second_value[0]);
+        ASSERT_EQ(value, first_value);
+        if (att->attribute_type() == draco::GeometryAttribute::POSITION) {
+          value[0] += 10.f;
+        }
+        ASSERT_EQ(value, second_value);
+      }
+    }
+  }
+
+  // Points of the triangle have zero normals.
+  const draco::PointAttribute *const normal_att =
+      merged->GetNamedAttribute(draco::GeometryAttribute::NORMAL);
+  ASSERT_NE(normal_att, nullptr);
+  for (int c = 0; c < 3; ++c) {
+    draco::Vector3f normal;
+    normal_att->GetMappedValue(
+        merged->face(draco::FaceIndex(num_cube_faces))[c], &normal[0]);
+    ASSERT_EQ(normal, draco::Vector3f(0.f, 0.f, 0.f));
+  }
+
+  // The number of transforms must match the number of meshes.
+  transforms.pop_back();
+  ASSERT_FALSE(
+      draco::MeshUtils::MergeMeshes(meshes, transforms, nullptr).ok());
+}
+
 }  // namespace
 
 #endif  // DRACO_TRANSCODER_SUPPORTED
@@ -0,0 +1,223 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_vertex_cache_optimizer.h"
+
+#include <memory>
+#include <vector>
+
+#include "draco/attributes/point_attribute.h"
+
+namespace draco {
+
+void MeshVertexCacheOptimizer::Optimize(Mesh *mesh, int cache_size) {
+  if (mesh->num_faces() == 0) {
+    return;
+  }
+  const std::vector<FaceIndex> face_order = ComputeFaceOrder(*mesh, cache_size);
+  IndexTypeVector<FaceIndex, Mesh::Face> faces(mesh->num_faces());
+  for (FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+    faces[fi] = mesh->face(face_order[fi.value()]);
+  }
+  for (FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+    mesh->SetFace(fi, faces[fi]);
+  }
+  ReorderPoints(mesh);
+}
+
+std::vector<FaceIndex> MeshVertexCacheOptimizer::ComputeFaceOrder(
+    const Mesh &mesh, int cache_size) {
+  const uint32_t num_points = mesh.num_points();
+  const uint32_t num_faces = mesh.num_faces();
+
+  // Build the point to face adjacency in a compressed sparse row format. The
+  // number of adjacent faces of each point is also the initial number of its
+  // "live" faces that have not been emitted yet.
+  std::vector<int32_t> num_live_faces(num_points, 0);
+  for (FaceIndex fi(0); fi < num_faces; ++fi) {
+    const Mesh::Face &face = mesh.face(fi);
+    for (int c = 0; c < 3; ++c) {
+      ++num_live_faces[face[c].value()];
+    }
+  }
+  std::vector<uint32_t> adjacency_offsets(num_points + 1, 0);
+  for (uint32_t p = 0; p < num_points; ++p) {
+    adjacency_offsets[p + 1] = adjacency_offsets[p] + num_live_faces[p];
+  }
+  std::vector<FaceIndex> adjacent_faces(adjacency_offsets[num_points]);
+  {
+    std::vector<uint32_t> next_slot(adjacency_offsets.begin(),
+                                    adjacency_offsets.end() - 1);
+    for (FaceIndex fi(0); fi < num_faces; ++fi) {
+      const Mesh::Face &face = mesh.face(fi);
+      for (int c = 0; c < 3; ++c) {
+        adjacent_faces[next_slot[face[c].value()]++] = fi;
+      }
+    }
+  }
+
+  // Time stamps of the points when they entered the simulated cache.
+  std::vector<int32_t> cache_time_stamps(num_points, 0);
+  std::vector<bool> is_face_emitted(num_faces, false);
+  // Points of recently emitted faces. Used to find a new fanning point when
+  // the algorithm reaches a dead end.
+  std::vector<uint32_t> dead_end_stack;
+  std::vector<uint32_t> candidates;
+  std::vector<FaceIndex> face_order;
+  face_order.reserve(num_faces);
+
+  int32_t time_stamp = cache_size + 1;
+  // Next point to check when the dead end stack is exhausted.
+  uint32_t cursor = 0;
+  int64_t fanning_point = 0;
+  while (fanning_point >= 0) {
+    // Emit all remaining faces adjacent to the fanning point.
+    candidates.clear();
+    for (uint32_t i = adjacency_offsets[fanning_point];
+         i < adjacency_offsets[fanning_point + 1]; ++i) {
+      const FaceIndex fi = adjacent_faces[i];
+      if (is_face_emitted[fi.value()]) {
+        continue;
+      }
+      is_face_emitted[fi.value()] = true;
+      face_order.push_back(fi);
+      const Mesh::Face &face = mesh.face(fi);
+      for (int c = 0; c < 3; ++c) {
+        const uint32_t p = face[c].value();
+        dead_end_stack.push_back(p);
+        candidates.push_back(p);
+        --num_live_faces[p];
+        if (time_stamp - cache_time_stamps[p] > cache_size) {
+          // The point was not in the cache.
+          cache_time_stamps[p] = time_stamp++;
+        }
+      }
+    }
+
+    // Select the next fanning point among the candidates. Points that will
+    // still be in the cache after all their live faces are emitted are
+    // preferred, the oldest of them first.
+    fanning_point = -1;
+    int32_t best_priority = -1;
+    for (const uint32_t p : candidates) {
+      if (num_live_faces[p] == 0) {
+        continue;
+      }
+      int32_t priority = 0;
+      if (time_stamp - cache_time_stamps[p] + 2 * num_live_faces[p] <=
+          cache_size) {
+        priority = time_stamp - cache_time_stamps[p];
+      }
+      if (priority > best_priority) {
+        best_priority = priority;
+        fanning_point = p;
+      }
+    }
+    if (fanning_point >= 0) {
+      continue;
+    }
+    // Dead end. Continue from the most recently used point with live faces or
+    // from the next point in the input order.
+    while (!dead_end_stack.empty()) {
+      const uint32_t p = dead_end_stack.back();
+      dead_end_stack.pop_back();
+      if (num_live_faces[p] > 0) {
+        fanning_point = p;
+        break;
+      }
+    }
+    while (fanning_point < 0 && cursor < num_points) {
+      if (num_live_faces[cursor] > 0) {
+        fanning_point = cursor;
+      }
+      ++cursor;
+    }
+  }
+  return face_order;
+}
+
+void MeshVertexCacheOptimizer::ReorderPoints(Mesh *mesh) {
+  const uint32_t num_points = mesh->num_points();
+  IndexTypeVector<PointIndex, PointIndex> old_to_new_point_map(
+      num_points, kInvalidPointIndex);
+  std::vector<PointIndex> new_to_old_point_map;
+  new_to_old_point_map.reserve(num_points);
+  for (FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+    Mesh::Face face = mesh->face(fi);
+    for (int c = 0; c < 3; ++c) {
+      if (old_to_new_point_map[face[c]] == kInvalidPointIndex) {
+        old_to_new_point_map[face[c]] =
+            PointIndex(static_cast<uint32_t>(new_to_old_point_map.size()));
+        new_to_old_point_map.push_back(face[c]);
+      }
+      face[c] = old_to_new_point_map[face[c]];
+    }
+    mesh->SetFace(fi, face);
+  }
+  // Points that are not used by any face are kept at the end.
+  for (PointIndex pi(0); pi < num_points; ++pi) {
+    if (old_to_new_point_map[pi] == kInvalidPointIndex) {
+      old_to_new_point_map[pi] =
+          PointIndex(static_cast<uint32_t>(new_to_old_point_map.size()));
+      new_to_old_point_map.push_back(pi);
+    }
+  }
+
+  for (int ai = 0; ai < mesh->num_attributes(); ++ai) {
+    PointAttribute *const att = mesh->attribute(ai);
+    if (att->is_mapping_identity()) {
+      // Attribute values need to be reordered to match the new point indices.
+      PointAttribute old_att;
+      old_att.CopyFrom(*att);
+      for (PointIndex pi(0); pi < num_points; ++pi) {
+        const PointIndex old_pi = new_to_old_point_map[pi.value()];
+        att->SetAttributeValue(
+            AttributeValueIndex(pi.value()),
+            old_att.GetAddress(AttributeValueIndex(old_pi.value())));
+      }
+    } else {
+      IndexTypeVector<PointIndex, AttributeValueIndex> old_indices(num_points);
+      for (PointIndex pi(0); pi < num_points; ++pi) {
+        old_indices[pi] = att->mapped_index(pi);
+      }
+      for (PointIndex pi(0); pi < num_points; ++pi) {
+        att->SetPointMapEntry(pi,
+                              old_indices[new_to_old_point_map[pi.value()]]);
+      }
+    }
+  }
+}
+
+float MeshVertexCacheOptimizer::ComputeAverageCacheMissRatio(const Mesh &mesh,
+                                                             int cache_size) {
+  if (mesh.num_faces() == 0) {
+    return 0.f;
+  }
+  // A point is in the FIFO cache when fewer than |cache_size| misses happened
+  // since it was inserted.
+  std::vector<int64_t> insertion_times(mesh.num_points(), -cache_size - 1);
+  int64_t num_misses = 0;
+  for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+    const Mesh::Face &face = mesh.face(fi);
+    for (int c = 0; c < 3; ++c) {
+      const uint32_t p = face[c].value();
+      if (num_misses - insertion_times[p] >= cache_size) {
+        insertion_times[p] = num_misses++;
+      }
+    }
+  }
+  return static_cast<float>(num_misses) / mesh.num_faces();
+}
+
+}  // namespace draco
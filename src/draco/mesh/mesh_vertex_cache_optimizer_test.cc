@@ -0,0 +1,112 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_vertex_cache_optimizer.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/mesh/mesh_are_equivalent.h"
+
+namespace draco {
+
+class MeshVertexCacheOptimizerTest : public ::testing::Test {
+ protected:
+  // Randomly shuffles faces of |mesh| to simulate an input with poor locality.
+  static void ShuffleFaces(Mesh *mesh) {
+    std::vector<Mesh::Face> faces;
+    for (FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+      faces.push_back(mesh->face(fi));
+    }
+    std::mt19937 rng(1234);
+    std::shuffle(faces.begin(), faces.end(), rng);
+    for (FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+      mesh->SetFace(fi, faces[fi.value()]);
+    }
+  }
+
+  void TestOptimizeFile(const std::string &file_name) {
+    const std::unique_ptr<Mesh> mesh(ReadMeshFromTestFile(file_name));
+    ASSERT_NE(mesh, nullptr) << "Failed to load test model " << file_name;
+    ShuffleFaces(mesh.get());
+    const std::unique_ptr<Mesh> optimized_mesh_ptr(
+        ReadMeshFromTestFile(file_name));
+    ASSERT_NE(optimized_mesh_ptr, nullptr);
+    ShuffleFaces(optimized_mesh_ptr.get());
+    Mesh &optimized_mesh = *optimized_mesh_ptr;
+
+    constexpr int kCacheSize = MeshVertexCacheOptimizer::kDefaultCacheSize;
+    const float acmr_before =
+        MeshVertexCacheOptimizer::ComputeAverageCacheMissRatio(*mesh,
+                                                               kCacheSize);
+    MeshVertexCacheOptimizer::Optimize(&optimized_mesh);
+    const float acmr_after =
+        MeshVertexCacheOptimizer::ComputeAverageCacheMissRatio(optimized_mesh,
+                                                               kCacheSize);
+    ASSERT_LT(acmr_after, acmr_before) << file_name;
+
+    // The optimized mesh must represent the same geometry.
+    ASSERT_EQ(optimized_mesh.num_faces(), mesh->num_faces());
+    ASSERT_EQ(optimized_mesh.num_points(), mesh->num_points());
+    MeshAreEquivalent equiv;
+    ASSERT_TRUE(equiv(*mesh, optimized_mesh)) << file_name;
+
+    // Points must be numbered in the order of their first use.
+    PointIndex::ValueType next_point = 0;
+    for (FaceIndex fi(0); fi < optimized_mesh.num_faces(); ++fi) {
+      for (int c = 0; c < 3; ++c) {
+        const PointIndex pi = optimized_mesh.face(fi)[c];
+        ASSERT_LE(pi.value(), next_point);
+        if (pi.value() == next_point) {
+          ++next_point;
+        }
+      }
+    }
+  }
+};
+
+TEST_F(MeshVertexCacheOptimizerTest, TestOptimizeMeshes) {
+  // Mesh with positions only (identity mapped attribute).
+  TestOptimizeFile("bun_zipper.ply");
+  // Meshes with explicitly mapped attributes.
+  TestOptimizeFile("bunny_norm.obj");
+  TestOptimizeFile("cube_att.obj");
+}
+
+TEST_F(MeshVertexCacheOptimizerTest, TestCacheMissRatio) {
+  // Faces of a large mesh with random order should miss the cache almost
+  // always, while the optimized order should be close to one miss per two
+  // faces.
+  const std::unique_ptr<Mesh> mesh(ReadMeshFromTestFile("bun_zipper.ply"));
+  ASSERT_NE(mesh, nullptr);
+  ShuffleFaces(mesh.get());
+  ASSERT_GT(MeshVertexCacheOptimizer::ComputeAverageCacheMissRatio(*mesh, 16),
+            2.5f);
+  MeshVertexCacheOptimizer::Optimize(mesh.get(), 16);
+  ASSERT_LT(MeshVertexCacheOptimizer::ComputeAverageCacheMissRatio(*mesh, 16),
+            0.8f);
+}
+
+TEST_F(MeshVertexCacheOptimizerTest, TestEmptyMesh) {
+  Mesh mesh;
+  MeshVertexCacheOptimizer::Optimize(&mesh);
+  ASSERT_EQ(mesh.num_faces(), 0);
+  ASSERT_EQ(MeshVertexCacheOptimizer::ComputeAverageCacheMissRatio(mesh, 16),
+            0.f);
+}
+
+}  // namespace draco
@@ -0,0 +1,163 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_vertex_clustering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "draco/core/bounding_box.h"
+#include "draco/core/vector_d.h"
+
+namespace draco {
+
+StatusOr<std::unique_ptr<Mesh>> MeshVertexClustering::Simplify(
+    const Mesh &mesh, int grid_size) {
+  // Cell indices along each axis are stored in 21 bits of the cell key.
+  if (grid_size < 1 || grid_size > (1 << 20)) {
+    return Status(Status::DRACO_ERROR, "Invalid grid size.");
+  }
+  const PointAttribute *const pos_att =
+      mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (pos_att == nullptr) {
+    return Status(Status::DRACO_ERROR, "Mesh has no position attribute.");
+  }
+
+  BoundingBox bounds;
+  Vector3f pos;
+  for (AttributeValueIndex i(0); i < static_cast<uint32_t>(pos_att->size());
+       ++i) {
+    pos_att->ConvertValue<float, 3>(i, &pos[0]);
+    bounds.Update(pos);
+  }
+  const Vector3f size = bounds.Size();
+  const float max_size = std::max(size[0], std::max(size[1], size[2]));
+  const float inv_cell_size = max_size > 0.f ? grid_size / max_size : 0.f;
+
+  const uint32_t kNoCluster = std::numeric_limits<uint32_t>::max();
+  // Assign a cluster to every point used by a face. Clusters are numbered in
+  // the order in which they are first referenced.
+  std::unordered_map<uint64_t, uint32_t> cell_to_cluster;
+  IndexTypeVector<PointIndex, uint32_t> point_to_cluster(mesh.num_points(),
+                                                         kNoCluster);
+  std::vector<PointIndex> cluster_points;
+  std::vector<uint32_t> cluster_sizes;
+  for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+    for (int c = 0; c < 3; ++c) {
+      const PointIndex pi = mesh.face(fi)[c];
+      if (point_to_cluster[pi] != kNoCluster) {
+        continue;
+      }
+      pos_att->ConvertValue<float, 3>(pos_att->mapped_index(pi), &pos[0]);
+      uint64_t key = 0;
+      for (int i = 0; i < 3; ++i) {
+        const int cell = std::min(
+            grid_size - 1,
+            static_cast<int>((pos[i] - bounds.GetMinPoint()[i]) *
+                             inv_cell_size));
+        key = (key << 21) | static_cast<uint64_t>(cell);
+      }
+      const auto it = cell_to_cluster
+                          .insert(std::make_pair(
+                              key, static_cast<uint32_t>(cluster_points.size())))
+                          .first;
+      if (it->second == cluster_points.size()) {
+        cluster_points.push_back(pi);
+        cluster_sizes.push_back(0);
+      }
+      point_to_cluster[pi] = it->second;
+      ++cluster_sizes[it->second];
+    }
+  }
+  const uint32_t num_clusters = static_cast<uint32_t>(cluster_points.size());
+
+  std::unique_ptr<Mesh> out_mesh(new Mesh());
+  out_mesh->set_num_points(num_clusters);
+  for (int a = 0; a < mesh.num_attributes(); ++a) {
+    const PointAttribute *const src_att = mesh.attribute(a);
+    std::unique_ptr<PointAttribute> att(
+        new PointAttribute(static_cast<const GeometryAttribute &>(*src_att)));
+    att->Reset(num_clusters);
+    att->SetIdentityMapping();
+    for (uint32_t i = 0; i < num_clusters; ++i) {
+      att->SetAttributeValue(AttributeValueIndex(i),
+                             src_att->GetAddress(
+                                 src_att->mapped_index(cluster_points[i])));
+    }
+    if (src_att->data_type() == DT_FLOAT32) {
+      // Average the values of all points in each cluster.
+      const int num_components = src_att->num_components();
+      std::vector<float> sums(num_clusters * num_components, 0.f);
+      std::vector<float> value(num_components);
+      for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+        const uint32_t cluster = point_to_cluster[pi];
+        if (cluster == kNoCluster) {
+          continue;
+        }
+        src_att->GetValue(src_att->mapped_index(pi), value.data());
+        for (int c = 0; c < num_components; ++c) {
+          sums[cluster * num_components + c] += value[c];
+        }
+      }
+      for (uint32_t i = 0; i < num_clusters; ++i) {
+        float *const sum = &sums[i * num_components];
+        float norm = 0.f;
+        for (int c = 0; c < num_components; ++c) {
+          sum[c] /= cluster_sizes[i];
+          norm += sum[c] * sum[c];
+        }
+        if (src_att->attribute_type() == GeometryAttribute::NORMAL &&
+            norm > 0.f) {
+          norm = std::sqrt(norm);
+          for (int c = 0; c < num_components; ++c) {
+            sum[c] /= norm;
+          }
+        }
+        att->SetAttributeValue(AttributeValueIndex(i), sum);
+      }
+    }
+    const int att_id = out_mesh->AddAttribute(std::move(att));
+    out_mesh->attribute(att_id)->set_unique_id(src_att->unique_id());
+  }
+
+  // Map faces to the clusters and remove degenerate and duplicate faces.
+  std::vector<Mesh::Face> faces;
+  faces.reserve(mesh.num_faces());
+  for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+    Mesh::Face face;
+    for (int c = 0; c < 3; ++c) {
+      face[c] = PointIndex(point_to_cluster[mesh.face(fi)[c]]);
+    }
+    if (face[0] == face[1] || face[0] == face[2] || face[1] == face[2]) {
+      continue;
+    }
+    // Rotate the face so that it starts with its smallest index.
+    const int first = static_cast<int>(
+        std::min_element(face.begin(), face.end()) - face.begin());
+    std::rotate(face.begin(), face.begin() + first, face.end());
+    faces.push_back(face);
+  }
+  std::sort(faces.begin(), faces.end());
+  faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
+  for (const Mesh::Face &face : faces) {
+    out_mesh->AddFace(face);
+  }
+  return std::move(out_mesh);
+}
+
+}  // namespace draco
@@ -0,0 +1,47 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_MESH_MESH_VERTEX_CLUSTERING_H_
+#define DRACO_MESH_MESH_VERTEX_CLUSTERING_H_
+
+#include <memory>
+
+#include "draco/core/status_or.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Simplifies meshes by merging all vertices whose positions fall into the
+// same cell of a uniform grid. Each cell with at least one vertex is
+// replaced by a single point. Float attribute values of the merged points are
+// averaged (normals are re-normalized), values of other attributes are taken
+// from the first merged point. Faces that become degenerate are removed, as
+// are duplicate faces.
+//
+// The simplification is fast but does not preserve topology, so it is mostly
+// useful for generating coarse approximations of a mesh, e.g. for level of
+// detail rendering.
+class MeshVertexClustering {
+ public:
+  // Clusters vertices of |mesh| on a grid with |grid_size| cells along the
+  // longest axis of the mesh bounding box. All attributes of the returned
+  // mesh keep the unique ids of the source attributes. Geometry metadata is
+  // not copied.
+  static StatusOr<std::unique_ptr<Mesh>> Simplify(const Mesh &mesh,
+                                                  int grid_size);
+};
+
+}  // namespace draco
+
+#endif  // DRACO_MESH_MESH_VERTEX_CLUSTERING_H_
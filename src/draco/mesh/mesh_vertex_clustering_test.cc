@@ -0,0 +1,89 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/mesh_vertex_clustering.h"
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace {
+
+class MeshVertexClusteringTest : public ::testing::Test {};
+
+TEST_F(MeshVertexClusteringTest, TestSimplify) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("bunny_norm.obj");
+  ASSERT_NE(mesh, nullptr);
+  const draco::BoundingBox bounds = mesh->ComputeBoundingBox();
+  std::unique_ptr<draco::Mesh> coarse =
+      draco::MeshVertexClustering::Simplify(*mesh, 16).value();
+  ASSERT_NE(coarse, nullptr);
+  ASSERT_GT(coarse->num_faces(), 0);
+  ASSERT_LT(coarse->num_faces(), mesh->num_faces() / 4);
+  ASSERT_LT(coarse->num_points(), mesh->num_points() / 4);
+  ASSERT_EQ(coarse->num_attributes(), mesh->num_attributes());
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    ASSERT_EQ(coarse->attribute(i)->unique_id(),
+              mesh->attribute(i)->unique_id());
+  }
+
+  // Averaged positions must stay within the source bounds and faces must not
+  // be degenerate.
+  const draco::BoundingBox coarse_bounds = coarse->ComputeBoundingBox();
+  for (int c = 0; c < 3; ++c) {
+    ASSERT_GE(coarse_bounds.GetMinPoint()[c], bounds.GetMinPoint()[c]);
+    ASSERT_LE(coarse_bounds.GetMaxPoint()[c], bounds.GetMaxPoint()[c]);
+  }
+  for (draco::FaceIndex fi(0); fi < coarse->num_faces(); ++fi) {
+    const draco::Mesh::Face &face = coarse->face(fi);
+    ASSERT_NE(face[0], face[1]);
+    ASSERT_NE(face[0], face[2]);
+    ASSERT_NE(face[1], face[2]);
+  }
+
+  // Normals are re-normalized.
+  const draco::PointAttribute *const normal_att =
+      coarse->GetNamedAttribute(draco::GeometryAttribute::NORMAL);
+  ASSERT_NE(normal_att, nullptr);
+  for (draco::AttributeValueIndex i(0); i < normal_att->size(); ++i) {
+    draco::Vector3f normal;
+    normal_att->GetValue(i, &normal[0]);
+    if (normal.SquaredNorm() > 0.f) {
+      ASSERT_NEAR(normal.SquaredNorm(), 1.f, 1e-5f);
+    }
+  }
+}
+
+TEST_F(MeshVertexClusteringTest, TestFineGrid) {
+  // Tests that a fine grid only merges points with the same position.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  std::unique_ptr<draco::Mesh> simplified =
+      draco::MeshVertexClustering::Simplify(*mesh, 1 << 20).value();
+  ASSERT_NE(simplified, nullptr);
+  ASSERT_EQ(simplified->num_faces(), mesh->num_faces());
+  ASSERT_EQ(simplified->num_points(), 8);
+}
+
+TEST_F(MeshVertexClusteringTest, TestInvalidInput) {
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  ASSERT_FALSE(draco::MeshVertexClustering::Simplify(*mesh, 0).ok());
+  draco::Mesh empty_mesh;
+  ASSERT_FALSE(draco::MeshVertexClustering::Simplify(empty_mesh, 16).ok());
+}
+
+}  // namespace
@@ -0,0 +1,239 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/meshlet_builder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include "draco/core/vector_d.h"
+#include "draco/mesh/mesh_misc_functions.h"
+
+namespace draco {
+
+MeshletBuilder::MeshletBuilder()
+    : pos_att_(nullptr), current_meshlet_id_(0), current_meshlet_() {}
+
+Status MeshletBuilder::Build(const Mesh &mesh,
+                             const MeshletBuilderOptions &options,
+                             Meshlets *out_meshlets) {
+  const std::unique_ptr<CornerTable> corner_table =
+      CreateCornerTableFromPositionAttribute(&mesh);
+  if (corner_table == nullptr) {
+    return Status(Status::DRACO_ERROR, "Failed to create corner table.");
+  }
+  return Build(mesh, *corner_table, options, out_meshlets);
+}
+
+Status MeshletBuilder::Build(const Mesh &mesh, const CornerTable &corner_table,
+                             const MeshletBuilderOptions &options,
+                             Meshlets *out_meshlets) {
+  if (options.max_vertices < 3 || options.max_vertices > 256 ||
+      options.max_triangles < 1) {
+    return Status(Status::DRACO_ERROR, "Invalid meshlet size limits.");
+  }
+  if (corner_table.num_faces() != static_cast<int>(mesh.num_faces())) {
+    return Status(Status::DRACO_ERROR,
+                  "Corner table does not match the mesh.");
+  }
+  pos_att_ = mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (pos_att_ == nullptr) {
+    return Status(Status::DRACO_ERROR, "Mesh has no position attribute.");
+  }
+  out_meshlets->meshlets.clear();
+  out_meshlets->bounds.clear();
+  out_meshlets->vertices.clear();
+  out_meshlets->triangles.clear();
+  is_face_assigned_.assign(mesh.num_faces(), false);
+  point_meshlet_ids_.assign(mesh.num_points(), -1);
+  point_local_indices_.assign(mesh.num_points(), 0);
+  for (int b = 0; b < 4; ++b) {
+    candidates_[b].clear();
+    candidate_heads_[b] = 0;
+  }
+  current_meshlet_id_ = 0;
+  current_meshlet_ = Meshlet();
+
+  // Next face in the input order used to seed meshlets when there are no
+  // adjacent candidates.
+  FaceIndex next_seed_face(0);
+  while (true) {
+    FaceIndex fi = kInvalidFaceIndex;
+    for (int b = 0; b < 4 && fi == kInvalidFaceIndex; ++b) {
+      while (candidate_heads_[b] < candidates_[b].size()) {
+        const FaceIndex candidate = candidates_[b][candidate_heads_[b]++];
+        if (is_face_assigned_[candidate.value()]) {
+          continue;
+        }
+        const int num_new_vertices = ComputeNumNewVertices(mesh, candidate);
+        if (current_meshlet_.vertex_count + num_new_vertices >
+            static_cast<uint32_t>(options.max_vertices)) {
+          // The face does not fit into this meshlet anymore.
+          continue;
+        }
+        fi = candidate;
+        break;
+      }
+    }
+    if (fi == kInvalidFaceIndex) {
+      while (next_seed_face < mesh.num_faces() &&
+             is_face_assigned_[next_seed_face.value()]) {
+        ++next_seed_face;
+      }
+      if (next_seed_face == mesh.num_faces()) {
+        break;
+      }
+      fi = next_seed_face;
+      if (current_meshlet_.vertex_count + ComputeNumNewVertices(mesh, fi) >
+          static_cast<uint32_t>(options.max_vertices)) {
+        FinishMeshlet(out_meshlets);
+      }
+    }
+    AddFace(mesh, corner_table, fi, out_meshlets);
+    if (current_meshlet_.triangle_count ==
+        static_cast<uint32_t>(options.max_triangles)) {
+      FinishMeshlet(out_meshlets);
+    }
+  }
+  FinishMeshlet(out_meshlets);
+  return OkStatus();
+}
+
+int MeshletBuilder::ComputeNumNewVertices(const Mesh &mesh,
+                                          FaceIndex fi) const {
+  const Mesh::Face &face = mesh.face(fi);
+  int num_new_vertices = 0;
+  for (int c = 0; c < 3; ++c) {
+    const uint32_t p = face[c].value();
+    if (point_meshlet_ids_[p] == current_meshlet_id_) {
+      continue;
+    }
+    // Degenerate faces can reference the same new point multiple times.
+    if ((c > 0 && face[0] == face[c]) || (c > 1 && face[1] == face[c])) {
+      continue;
+    }
+    ++num_new_vertices;
+  }
+  return num_new_vertices;
+}
+
+void MeshletBuilder::AddFace(const Mesh &mesh, const CornerTable &corner_table,
+                             FaceIndex fi, Meshlets *out_meshlets) {
+  is_face_assigned_[fi.value()] = true;
+  const Mesh::Face &face = mesh.face(fi);
+  for (int c = 0; c < 3; ++c) {
+    const uint32_t p = face[c].value();
+    if (point_meshlet_ids_[p] != current_meshlet_id_) {
+      point_meshlet_ids_[p] = current_meshlet_id_;
+      point_local_indices_[p] =
+          static_cast<uint8_t>(current_meshlet_.vertex_count++);
+      out_meshlets->vertices.push_back(p);
+    }
+    out_meshlets->triangles.push_back(point_local_indices_[p]);
+  }
+  ++current_meshlet_.triangle_count;
+
+  // Faces across the edges of |fi| are the candidates for the next face.
+  const CornerIndex first_corner = corner_table.FirstCorner(fi);
+  for (int c = 0; c < 3; ++c) {
+    const CornerIndex opp_corner = corner_table.Opposite(first_corner + c);
+    if (opp_corner == kInvalidCornerIndex) {
+      continue;
+    }
+    const FaceIndex opp_face = corner_table.Face(opp_corner);
+    if (is_face_assigned_[opp_face.value()]) {
+      continue;
+    }
+    candidates_[ComputeNumNewVertices(mesh, opp_face)].push_back(opp_face);
+  }
+}
+
+void MeshletBuilder::FinishMeshlet(Meshlets *out_meshlets) {
+  for (int b = 0; b < 4; ++b) {
+    candidates_[b].clear();
+    candidate_heads_[b] = 0;
+  }
+  if (current_meshlet_.triangle_count == 0) {
+    return;
+  }
+  const uint32_t *const vertices =
+      out_meshlets->vertices.data() + current_meshlet_.vertex_offset;
+  const uint8_t *const triangles =
+      out_meshlets->triangles.data() + current_meshlet_.triangle_offset;
+  std::vector<Vector3f> positions(current_meshlet_.vertex_count);
+  for (uint32_t i = 0; i < current_meshlet_.vertex_count; ++i) {
+    pos_att_->ConvertValue<float, 3>(
+        pos_att_->mapped_index(PointIndex(vertices[i])), &positions[i][0]);
+  }
+
+  MeshletBounds bounds;
+  // Bounding sphere centered at the center of the bounding box.
+  Vector3f min_pos = positions[0];
+  Vector3f max_pos = positions[0];
+  for (const Vector3f &pos : positions) {
+    for (int j = 0; j < 3; ++j) {
+      min_pos[j] = std::min(min_pos[j], pos[j]);
+      max_pos[j] = std::max(max_pos[j], pos[j]);
+    }
+  }
+  const Vector3f center = (min_pos + max_pos) / 2.f;
+  float max_dist_sq = 0.f;
+  for (const Vector3f &pos : positions) {
+    max_dist_sq = std::max(max_dist_sq, (pos - center).SquaredNorm());
+  }
+  for (int j = 0; j < 3; ++j) {
+    bounds.center[j] = center[j];
+  }
+  bounds.radius = std::sqrt(max_dist_sq);
+
+  // Normal cone around the average face normal. Degenerate faces are ignored.
+  std::vector<Vector3f> normals;
+  normals.reserve(current_meshlet_.triangle_count);
+  Vector3f axis(0.f, 0.f, 0.f);
+  for (uint32_t t = 0; t < current_meshlet_.triangle_count; ++t) {
+    const Vector3f &p0 = positions[triangles[3 * t]];
+    const Vector3f &p1 = positions[triangles[3 * t + 1]];
+    const Vector3f &p2 = positions[triangles[3 * t + 2]];
+    const Vector3f normal = CrossProduct(p1 - p0, p2 - p0);
+    const float norm = std::sqrt(normal.SquaredNorm());
+    if (norm == 0.f) {
+      continue;
+    }
+    normals.push_back(normal / norm);
+    axis += normals.back();
+  }
+  const float axis_norm = std::sqrt(axis.SquaredNorm());
+  const Vector3f cone_axis = axis_norm > 0.f ? axis / axis_norm : axis;
+  float cone_cutoff = normals.empty() || axis_norm == 0.f ? -1.f : 1.f;
+  for (const Vector3f &normal : normals) {
+    cone_cutoff = std::min(cone_cutoff, cone_axis.Dot(normal));
+  }
+  for (int j = 0; j < 3; ++j) {
+    bounds.cone_axis[j] = cone_axis[j];
+  }
+  bounds.cone_cutoff = cone_cutoff;
+
+  out_meshlets->meshlets.push_back(current_meshlet_);
+  out_meshlets->bounds.push_back(bounds);
+  ++current_meshlet_id_;
+  current_meshlet_.vertex_offset =
+      static_cast<uint32_t>(out_meshlets->vertices.size());
+  current_meshlet_.triangle_offset =
+      static_cast<uint32_t>(out_meshlets->triangles.size());
+  current_meshlet_.vertex_count = 0;
+  current_meshlet_.triangle_count = 0;
+}
+
+}  // namespace draco
@@ -0,0 +1,118 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_MESH_MESHLET_BUILDER_H_
+#define DRACO_MESH_MESHLET_BUILDER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "draco/core/status.h"
+#include "draco/mesh/corner_table.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Description of a single meshlet within the flat arrays of Meshlets.
+struct Meshlet {
+  // Offset of the first entry of the meshlet in Meshlets::vertices.
+  uint32_t vertex_offset;
+  // Offset of the first local index of the meshlet in Meshlets::triangles.
+  uint32_t triangle_offset;
+  uint32_t vertex_count;
+  uint32_t triangle_count;
+};
+
+// Culling data of a single meshlet.
+struct MeshletBounds {
+  // Bounding sphere of all vertices of the meshlet.
+  float center[3];
+  float radius;
+  // Normalized average normal of all faces of the meshlet and the cosine of
+  // the half-angle of the cone around it that contains all face normals. The
+  // cutoff is negative when the normals span more than a hemisphere and the
+  // meshlet cannot be back-face culled.
+  float cone_axis[3];
+  float cone_cutoff;
+};
+
+// Meshlets stored in flat arrays that can be uploaded directly to the GPU.
+struct Meshlets {
+  std::vector<Meshlet> meshlets;
+  std::vector<MeshletBounds> bounds;
+  // Point indices of the mesh referenced by all meshlets.
+  std::vector<uint32_t> vertices;
+  // Three indices into the meshlet's vertices for each triangle.
+  std::vector<uint8_t> triangles;
+};
+
+struct MeshletBuilderOptions {
+  // Maximum number of vertices of a meshlet. Must be between 3 and 256.
+  int max_vertices = 64;
+  // Maximum number of triangles of a meshlet.
+  int max_triangles = 124;
+};
+
+// Class that splits a draco::Mesh into meshlets (small clusters of triangles)
+// as used by mesh shading pipelines. Meshlets are grown greedily over the
+// connectivity of the mesh, always adding the adjacent face that requires the
+// fewest new vertices, which keeps the clusters compact and maximizes vertex
+// reuse within each meshlet. Faces keep the winding of the input mesh.
+class MeshletBuilder {
+ public:
+  MeshletBuilder();
+
+  // Builds meshlets for |mesh| using a corner table created from its position
+  // attribute.
+  Status Build(const Mesh &mesh, const MeshletBuilderOptions &options,
+               Meshlets *out_meshlets);
+
+  // Same as above but uses an existing |corner_table| whose faces correspond
+  // to the faces of |mesh|, such as the corner table of a mesh decoder.
+  Status Build(const Mesh &mesh, const CornerTable &corner_table,
+               const MeshletBuilderOptions &options, Meshlets *out_meshlets);
+
+ private:
+  // Returns the number of vertices of |fi| that are not in the current
+  // meshlet yet.
+  int ComputeNumNewVertices(const Mesh &mesh, FaceIndex fi) const;
+
+  // Adds face |fi| to the current meshlet and its unassigned neighbors to the
+  // candidates.
+  void AddFace(const Mesh &mesh, const CornerTable &corner_table, FaceIndex fi,
+               Meshlets *out_meshlets);
+
+  // Finishes the current meshlet and computes its bounds.
+  void FinishMeshlet(Meshlets *out_meshlets);
+
+  const PointAttribute *pos_att_;
+  std::vector<bool> is_face_assigned_;
+  // Number of finished meshlets, used as the id of the current meshlet.
+  int32_t current_meshlet_id_;
+  // Id of the meshlet that last used each point and the index of the point in
+  // that meshlet.
+  std::vector<int32_t> point_meshlet_ids_;
+  std::vector<uint8_t> point_local_indices_;
+  // Candidate faces bucketed by the number of new vertices they required when
+  // they were added. The number can only decrease while the meshlet grows.
+  // Each bucket is processed in the first-in first-out order, which grows the
+  // meshlet evenly in all directions and keeps its boundary short.
+  std::vector<FaceIndex> candidates_[4];
+  size_t candidate_heads_[4];
+  Meshlet current_meshlet_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_MESH_MESHLET_BUILDER_H_
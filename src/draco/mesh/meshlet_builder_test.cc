@@ -0,0 +1,147 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/meshlet_builder.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/vector_d.h"
+#include "draco/mesh/mesh_misc_functions.h"
+
+namespace draco {
+
+class MeshletBuilderTest : public ::testing::Test {
+ protected:
+  // Verifies that |meshlets| cover all faces of |mesh| exactly once, respect
+  // the limits in |options| and have valid bounds.
+  void VerifyMeshlets(const Mesh &mesh, const MeshletBuilderOptions &options,
+                      const Meshlets &meshlets) {
+    ASSERT_EQ(meshlets.meshlets.size(), meshlets.bounds.size());
+    const PointAttribute *const pos_att =
+        mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+    std::vector<std::array<uint32_t, 3>> faces;
+    uint32_t num_vertices = 0;
+    uint32_t num_triangle_indices = 0;
+    for (size_t m = 0; m < meshlets.meshlets.size(); ++m) {
+      const Meshlet &meshlet = meshlets.meshlets[m];
+      const MeshletBounds &bounds = meshlets.bounds[m];
+      ASSERT_EQ(meshlet.vertex_offset, num_vertices);
+      ASSERT_EQ(meshlet.triangle_offset, num_triangle_indices);
+      ASSERT_GT(meshlet.triangle_count, 0);
+      ASSERT_LE(meshlet.vertex_count, options.max_vertices);
+      ASSERT_LE(meshlet.triangle_count, options.max_triangles);
+      num_vertices += meshlet.vertex_count;
+      num_triangle_indices += 3 * meshlet.triangle_count;
+      const Vector3f center(bounds.center[0], bounds.center[1],
+                            bounds.center[2]);
+      const Vector3f axis(bounds.cone_axis[0], bounds.cone_axis[1],
+                          bounds.cone_axis[2]);
+      for (uint32_t t = 0; t < meshlet.triangle_count; ++t) {
+        std::array<uint32_t, 3> face;
+        Vector3f pos[3];
+        for (int c = 0; c < 3; ++c) {
+          const uint8_t local_index =
+              meshlets.triangles[meshlet.triangle_offset + 3 * t + c];
+          ASSERT_LT(local_index, meshlet.vertex_count);
+          face[c] = meshlets.vertices[meshlet.vertex_offset + local_index];
+          pos_att->ConvertValue<float, 3>(
+              pos_att->mapped_index(PointIndex(face[c])), &pos[c][0]);
+          ASSERT_LE((pos[c] - center).SquaredNorm(),
+                    bounds.radius * bounds.radius * 1.0001f + 1e-12f);
+        }
+        Vector3f normal = CrossProduct(pos[1] - pos[0], pos[2] - pos[0]);
+        if (normal.SquaredNorm() > 0.f) {
+          normal.Normalize();
+          ASSERT_GE(axis.Dot(normal), bounds.cone_cutoff - 1e-4f);
+        }
+        faces.push_back(face);
+      }
+    }
+    ASSERT_EQ(num_vertices, meshlets.vertices.size());
+    ASSERT_EQ(num_triangle_indices, meshlets.triangles.size());
+
+    // Each face of the mesh must be present exactly once with its original
+    // winding.
+    std::vector<std::array<uint32_t, 3>> mesh_faces;
+    for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+      const Mesh::Face &face = mesh.face(fi);
+      mesh_faces.push_back({{face[0].value(), face[1].value(),
+                             face[2].value()}});
+    }
+    std::sort(faces.begin(), faces.end());
+    std::sort(mesh_faces.begin(), mesh_faces.end());
+    ASSERT_EQ(faces, mesh_faces);
+  }
+};
+
+TEST_F(MeshletBuilderTest, TestBuildMeshlets) {
+  for (const std::string file_name :
+       {"bun_zipper.ply", "bunny_norm.obj", "cube_att.obj",
+        "multiple_isolated_triangles.obj", "non_manifold_wrap.obj"}) {
+    const std::unique_ptr<Mesh> mesh(ReadMeshFromTestFile(file_name));
+    ASSERT_NE(mesh, nullptr) << "Failed to load test model " << file_name;
+    MeshletBuilderOptions options;
+    Meshlets meshlets;
+    MeshletBuilder builder;
+    DRACO_ASSERT_OK(builder.Build(*mesh, options, &meshlets));
+    VerifyMeshlets(*mesh, options, meshlets);
+  }
+}
+
+TEST_F(MeshletBuilderTest, TestMeshletOccupancy) {
+  // Tests that meshlets of a large connected mesh are well filled.
+  const std::unique_ptr<Mesh> mesh(ReadMeshFromTestFile("bun_zipper.ply"));
+  ASSERT_NE(mesh, nullptr);
+  MeshletBuilderOptions options;
+  Meshlets meshlets;
+  MeshletBuilder builder;
+  DRACO_ASSERT_OK(builder.Build(*mesh, options, &meshlets));
+  const float average_triangles =
+      static_cast<float>(mesh->num_faces()) / meshlets.meshlets.size();
+  ASSERT_GT(average_triangles, 85.f);
+}
+
+TEST_F(MeshletBuilderTest, TestCustomLimitsAndCornerTable) {
+  const std::unique_ptr<Mesh> mesh(ReadMeshFromTestFile("bunny_norm.obj"));
+  ASSERT_NE(mesh, nullptr);
+  const std::unique_ptr<CornerTable> corner_table =
+      CreateCornerTableFromAllAttributes(mesh.get());
+  ASSERT_NE(corner_table, nullptr);
+  MeshletBuilderOptions options;
+  options.max_vertices = 32;
+  options.max_triangles = 40;
+  Meshlets meshlets;
+  MeshletBuilder builder;
+  DRACO_ASSERT_OK(builder.Build(*mesh, *corner_table, options, &meshlets));
+  VerifyMeshlets(*mesh, options, meshlets);
+}
+
+TEST_F(MeshletBuilderTest, TestInvalidOptions) {
+  const std::unique_ptr<Mesh> mesh(ReadMeshFromTestFile("cube_att.obj"));
+  ASSERT_NE(mesh, nullptr);
+  MeshletBuilderOptions options;
+  options.max_vertices = 257;
+  Meshlets meshlets;
+  MeshletBuilder builder;
+  ASSERT_FALSE(builder.Build(*mesh, options, &meshlets).ok());
+  options.max_vertices = 64;
+  options.max_triangles = 0;
+  ASSERT_FALSE(builder.Build(*mesh, options, &meshlets).ok());
+}
+
+}  // namespace draco
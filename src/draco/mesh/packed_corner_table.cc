@@ -0,0 +1,33 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/packed_corner_table.h"
+
+namespace draco {
+
+bool PackedCornerTable::Init(const CornerTable &corner_table) {
+  corners_.resize(corner_table.num_corners());
+  for (CornerIndex ci(0); ci < corner_table.num_corners(); ++ci) {
+    CornerData &data = corners_[ci.value()];
+    data.vertex = corner_table.Vertex(ci).value();
+    data.opposite = corner_table.Opposite(ci).value();
+  }
+  vertex_corners_.resize(corner_table.num_vertices());
+  for (VertexIndex vi(0); vi < corner_table.num_vertices(); ++vi) {
+    vertex_corners_[vi] = corner_table.LeftMostCorner(vi);
+  }
+  return true;
+}
+
+}  // namespace draco
@@ -0,0 +1,140 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_MESH_PACKED_CORNER_TABLE_H_
+#define DRACO_MESH_PACKED_CORNER_TABLE_H_
+
+#include <vector>
+
+#include "draco/attributes/geometry_indices.h"
+#include "draco/core/draco_index_type_vector.h"
+#include "draco/core/macros.h"
+#include "draco/mesh/corner_table.h"
+
+namespace draco {
+
+// Read-only copy of a CornerTable optimized for traversals. The vertex and the
+// opposite corner of each corner are stored next to each other so that
+// visiting a corner touches a single cache line instead of two separate
+// arrays. The class implements the subset of the CornerTable interface that
+// is used by mesh traversers (see compression/mesh/traverser/) and it can be
+// passed to them in place of the CornerTable.
+//
+// The table must be re-initialized whenever the source CornerTable changes.
+class PackedCornerTable {
+ public:
+  PackedCornerTable() {}
+
+  // Initializes the packed table from |corner_table|.
+  bool Init(const CornerTable &corner_table);
+
+  inline int num_vertices() const {
+    return static_cast<int>(vertex_corners_.size());
+  }
+  inline int num_corners() const { return static_cast<int>(corners_.size()); }
+  inline int num_faces() const {
+    return static_cast<int>(corners_.size() / 3);
+  }
+
+  inline CornerIndex Opposite(CornerIndex corner) const {
+    if (corner == kInvalidCornerIndex) {
+      return corner;
+    }
+    return CornerIndex(corners_[corner.value()].opposite);
+  }
+  inline CornerIndex Next(CornerIndex corner) const {
+    if (corner == kInvalidCornerIndex) {
+      return corner;
+    }
+    return LocalIndex(++corner) ? corner : corner - 3;
+  }
+  inline CornerIndex Previous(CornerIndex corner) const {
+    if (corner == kInvalidCornerIndex) {
+      return corner;
+    }
+    return LocalIndex(corner) ? corner - 1 : corner + 2;
+  }
+  inline VertexIndex Vertex(CornerIndex corner) const {
+    if (corner == kInvalidCornerIndex) {
+      return kInvalidVertexIndex;
+    }
+    return ConfidentVertex(corner);
+  }
+  inline VertexIndex ConfidentVertex(CornerIndex corner) const {
+    DRACO_DCHECK_GE(corner.value(), 0);
+    DRACO_DCHECK_LT(corner.value(), num_corners());
+    return VertexIndex(corners_[corner.value()].vertex);
+  }
+  inline FaceIndex Face(CornerIndex corner) const {
+    if (corner == kInvalidCornerIndex) {
+      return kInvalidFaceIndex;
+    }
+    return FaceIndex(corner.value() / 3);
+  }
+  inline CornerIndex FirstCorner(FaceIndex face) const {
+    if (face == kInvalidFaceIndex) {
+      return kInvalidCornerIndex;
+    }
+    return CornerIndex(face.value() * 3);
+  }
+  inline int LocalIndex(CornerIndex corner) const { return corner.value() % 3; }
+
+  // See CornerTable::LeftMostCorner().
+  inline CornerIndex LeftMostCorner(VertexIndex v) const {
+    return vertex_corners_[v];
+  }
+
+  // Returns true if the specified vertex is on a boundary.
+  inline bool IsOnBoundary(VertexIndex vert) const {
+    const CornerIndex corner = LeftMostCorner(vert);
+    return SwingLeft(corner) == kInvalidCornerIndex;
+  }
+
+  // See CornerTable::SwingRight() and CornerTable::SwingLeft().
+  inline CornerIndex SwingRight(CornerIndex corner) const {
+    return Previous(Opposite(Previous(corner)));
+  }
+  inline CornerIndex SwingLeft(CornerIndex corner) const {
+    return Next(Opposite(Next(corner)));
+  }
+
+  // See CornerTable::GetLeftCorner() and CornerTable::GetRightCorner().
+  inline CornerIndex GetLeftCorner(CornerIndex corner_id) const {
+    if (corner_id == kInvalidCornerIndex) {
+      return kInvalidCornerIndex;
+    }
+    return Opposite(Previous(corner_id));
+  }
+  inline CornerIndex GetRightCorner(CornerIndex corner_id) const {
+    if (corner_id == kInvalidCornerIndex) {
+      return kInvalidCornerIndex;
+    }
+    return Opposite(Next(corner_id));
+  }
+
+ private:
+  // Vertex and opposite corner of a single corner. Invalid entries are stored
+  // as the values of kInvalidVertexIndex and kInvalidCornerIndex.
+  struct CornerData {
+    uint32_t vertex;
+    uint32_t opposite;
+  };
+
+  std::vector<CornerData> corners_;
+  IndexTypeVector<VertexIndex, CornerIndex> vertex_corners_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_MESH_PACKED_CORNER_TABLE_H_
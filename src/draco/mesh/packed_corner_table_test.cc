@@ -0,0 +1,114 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/packed_corner_table.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "draco/compression/decode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/io/file_utils.h"
+#include "draco/mesh/mesh_misc_functions.h"
+
+namespace {
+
+class PackedCornerTableTest : public ::testing::Test {
+ protected:
+  // Verifies that the packed table built from |file_name| returns the same
+  // connectivity as the source CornerTable.
+  void TestConnectivity(const std::string &file_name) {
+    const std::unique_ptr<draco::Mesh> mesh =
+        draco::ReadMeshFromTestFile(file_name);
+    ASSERT_NE(mesh, nullptr);
+    const std::unique_ptr<draco::CornerTable> table =
+        draco::CreateCornerTableFromPositionAttribute(mesh.get());
+    ASSERT_NE(table, nullptr);
+    draco::PackedCornerTable packed;
+    ASSERT_TRUE(packed.Init(*table));
+    ASSERT_EQ(packed.num_vertices(), table->num_vertices());
+    ASSERT_EQ(packed.num_corners(), table->num_corners());
+    ASSERT_EQ(packed.num_faces(), table->num_faces());
+    for (draco::CornerIndex ci(0); ci < table->num_corners(); ++ci) {
+      ASSERT_EQ(packed.Vertex(ci), table->Vertex(ci));
+      ASSERT_EQ(packed.Opposite(ci), table->Opposite(ci));
+      ASSERT_EQ(packed.Next(ci), table->Next(ci));
+      ASSERT_EQ(packed.Previous(ci), table->Previous(ci));
+      ASSERT_EQ(packed.SwingLeft(ci), table->SwingLeft(ci));
+      ASSERT_EQ(packed.SwingRight(ci), table->SwingRight(ci));
+      ASSERT_EQ(packed.GetLeftCorner(ci), table->GetLeftCorner(ci));
+      ASSERT_EQ(packed.GetRightCorner(ci), table->GetRightCorner(ci));
+    }
+    for (draco::VertexIndex vi(0); vi < table->num_vertices(); ++vi) {
+      ASSERT_EQ(packed.LeftMostCorner(vi), table->LeftMostCorner(vi));
+      ASSERT_EQ(packed.IsOnBoundary(vi), table->IsOnBoundary(vi));
+    }
+    ASSERT_EQ(packed.Opposite(draco::kInvalidCornerIndex),
+              draco::kInvalidCornerIndex);
+    ASSERT_EQ(packed.Vertex(draco::kInvalidCornerIndex),
+              draco::kInvalidVertexIndex);
+  }
+
+  // Verifies that decoding |file_name| with the packed corner table produces
+  // the same geometry as the default decoder.
+  void TestDecode(const std::string &file_name) {
+    std::vector<char> data;
+    ASSERT_TRUE(
+        draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name), &data));
+    draco::DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    draco::Decoder decoder;
+    const std::unique_ptr<draco::Mesh> expected =
+        decoder.DecodeMeshFromBuffer(&buffer).value();
+    ASSERT_NE(expected, nullptr);
+
+    buffer.Init(data.data(), data.size());
+    draco::Decoder packed_decoder;
+    packed_decoder.options()->SetGlobalBool("use_packed_corner_table", true);
+    const std::unique_ptr<draco::Mesh> mesh =
+        packed_decoder.DecodeMeshFromBuffer(&buffer).value();
+    ASSERT_NE(mesh, nullptr);
+    ASSERT_EQ(mesh->num_faces(), expected->num_faces());
+    ASSERT_EQ(mesh->num_points(), expected->num_points());
+    for (draco::FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+      ASSERT_EQ(mesh->face(fi), expected->face(fi));
+    }
+    ASSERT_EQ(mesh->num_attributes(), expected->num_attributes());
+    for (int i = 0; i < mesh->num_attributes(); ++i) {
+      const draco::DataBuffer *const att_buffer = mesh->attribute(i)->buffer();
+      const draco::DataBuffer *const expected_buffer =
+          expected->attribute(i)->buffer();
+      ASSERT_EQ(att_buffer->data_size(), expected_buffer->data_size());
+      ASSERT_EQ(memcmp(att_buffer->data(), expected_buffer->data(),
+                       att_buffer->data_size()),
+                0);
+    }
+  }
+};
+
+TEST_F(PackedCornerTableTest, TestConnectivity) {
+  TestConnectivity("cube_att.obj");
+  TestConnectivity("bunny_norm.obj");
+}
+
+TEST_F(PackedCornerTableTest, TestDecode) {
+  // Uses both depth-first and prediction degree attribute traversals.
+  TestDecode("car.drc");
+  TestDecode("cube_att.obj.edgebreaker.cl10.2.2.drc");
+  TestDecode("test_nm.obj.edgebreaker.cl10.2.2.drc");
+}
+
+}  // namespace
@@ -14,6 +14,7 @@
 //
 #include "draco/mesh/triangle_soup_mesh_builder.h"
 
+#include <cstring>
 #include <string>
 
 namespace draco {
@@ -61,6 +62,39 @@ void TriangleSoupMeshBuilder::SetAttributeValuesForFace(
   attribute_element_types_[att_id] = MESH_CORNER_ATTRIBUTE;
 }
 
+void TriangleSoupMeshBuilder::SetAttributeValuesForFaces(
+    int att_id, FaceIndex first_face, FaceIndex::ValueType num_faces,
+    const void *corner_values, int stride) {
+  PointAttribute *const att = mesh_->attribute(att_id);
+  const int data_stride =
+      DataTypeLength(att->data_type()) * att->num_components();
+  if (stride == 0) {
+    stride = data_stride;
+  }
+  const size_t num_corners = 3 * static_cast<size_t>(num_faces);
+  uint8_t *const dst =
+      att->buffer()->data() + 3 * first_face.value() * data_stride;
+  const uint8_t *const src = static_cast<const uint8_t *>(corner_values);
+  if (stride == data_stride) {
+    memcpy(dst, src, num_corners * data_stride);
+  } else {
+    for (size_t i = 0; i < num_corners; ++i) {
+      memcpy(dst + i * data_stride, src + i * stride, data_stride);
+    }
+  }
+  for (FaceIndex fi = first_face; fi < first_face + num_faces; ++fi) {
+    const PointIndex start_index(3 * fi.value());
+    mesh_->SetFace(fi, {{start_index, start_index + 1, start_index + 2}});
+  }
+  attribute_element_types_[att_id] = MESH_CORNER_ATTRIBUTE;
+}
+
+void TriangleSoupMeshBuilder::SetAttributeValuesForAllFaces(
+    int att_id, const void *corner_values, int stride) {
+  SetAttributeValuesForFaces(att_id, FaceIndex(0), mesh_->num_faces(),
+                             corner_values, stride);
+}
+
 void TriangleSoupMeshBuilder::SetPerFaceAttributeValueForFace(
     int att_id, FaceIndex face_id, const void *value) {
   const int start_index = 3 * face_id.value();
@@ -78,15 +112,19 @@ void TriangleSoupMeshBuilder::SetPerFaceAttributeValueForFace(
 }
 
 std::unique_ptr<Mesh> TriangleSoupMeshBuilder::Finalize() {
+  return Finalize(nullptr);
+}
+
+std::unique_ptr<Mesh> TriangleSoupMeshBuilder::Finalize(ThreadPool *pool) {
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
   // First deduplicate attribute values.
-  if (!mesh_->DeduplicateAttributeValues()) {
+  if (!mesh_->DeduplicateAttributeValues(pool)) {
     return nullptr;
   }
 #endif
 #ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
   // Also deduplicate vertex indices.
-  mesh_->DeduplicatePointIds();
+  mesh_->DeduplicatePointIds(pool);
 #endif
   for (size_t i = 0; i < attribute_element_types_.size(); ++i) {
     if (attribute_element_types_[i] >= 0) {
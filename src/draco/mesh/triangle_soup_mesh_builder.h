@@ -58,6 +58,20 @@ class TriangleSoupMeshBuilder {
                                  const void *corner_value_1,
                                  const void *corner_value_2);
 
+  // Sets values for a given attribute on all corners of |num_faces|
+  // consecutive faces starting at |first_face|. |corner_values| must contain
+  // three values for each face and |stride| defines the byte offset between
+  // two consecutive values (if |stride| is 0, the values are tightly packed).
+  // The values are written directly into the attribute buffer, which makes
+  // this much faster than setting the values of the faces one by one.
+  void SetAttributeValuesForFaces(int att_id, FaceIndex first_face,
+                                  FaceIndex::ValueType num_faces,
+                                  const void *corner_values, int stride);
+
+  // Same as above for all faces of the mesh.
+  void SetAttributeValuesForAllFaces(int att_id, const void *corner_values,
+                                     int stride);
+
 #ifdef DRACO_TRANSCODER_SUPPORTED
   // Converts input values of type T into internal representation used by
   // |att_id|. Each input value needs to have |input_num_components| entries.
@@ -99,6 +113,10 @@ class TriangleSoupMeshBuilder {
   // used until the method Start() is called again.
   std::unique_ptr<Mesh> Finalize();
 
+  // Same as above but the deduplication runs in parallel on |pool| (can be
+  // nullptr). The result is the same as when no |pool| is used.
+  std::unique_ptr<Mesh> Finalize(ThreadPool *pool);
+
  private:
   std::vector<int8_t> attribute_element_types_;
 
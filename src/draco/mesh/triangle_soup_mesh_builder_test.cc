@@ -110,6 +110,46 @@ TEST_F(TriangleSoupMeshBuilderTest, CubeTest) {
   EXPECT_EQ(mesh->num_faces(), 12) << "Unexpected number of faces.";
 }
 
+TEST_F(TriangleSoupMeshBuilderTest, BulkCubeTest) {
+  // This tests verifies that the mesh builder constructs the same cube when
+  // the corner values of all faces are set at once.
+  // clang-format off
+  const std::vector<float> positions = {
+      0.f, 0.f, 0.f,  1.f, 0.f, 0.f,  0.f, 1.f, 0.f,
+      0.f, 1.f, 0.f,  1.f, 0.f, 0.f,  1.f, 1.f, 0.f,
+      0.f, 1.f, 1.f,  1.f, 0.f, 1.f,  0.f, 0.f, 1.f,
+      1.f, 1.f, 1.f,  1.f, 0.f, 1.f,  0.f, 1.f, 1.f,
+      0.f, 1.f, 0.f,  1.f, 1.f, 0.f,  0.f, 1.f, 1.f,
+      0.f, 1.f, 1.f,  1.f, 1.f, 0.f,  1.f, 1.f, 1.f,
+      0.f, 0.f, 1.f,  1.f, 0.f, 0.f,  0.f, 0.f, 0.f,
+      1.f, 0.f, 1.f,  1.f, 0.f, 0.f,  0.f, 0.f, 1.f,
+      1.f, 0.f, 0.f,  1.f, 0.f, 1.f,  1.f, 1.f, 0.f,
+      1.f, 1.f, 0.f,  1.f, 0.f, 1.f,  1.f, 1.f, 1.f,
+      0.f, 1.f, 0.f,  0.f, 0.f, 1.f,  0.f, 0.f, 0.f,
+      0.f, 1.f, 1.f,  0.f, 0.f, 1.f,  0.f, 1.f, 0.f};
+  // clang-format on
+  TriangleSoupMeshBuilder mb;
+  mb.Start(12);
+  const int pos_att_id =
+      mb.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  mb.SetAttributeValuesForAllFaces(pos_att_id, positions.data(), 0);
+  ThreadPool pool(2);
+  std::unique_ptr<Mesh> mesh = mb.Finalize(&pool);
+  ASSERT_NE(mesh, nullptr) << "Failed to build the cube mesh.";
+  EXPECT_EQ(mesh->num_points(), 8) << "Unexpected number of vertices.";
+  EXPECT_EQ(mesh->num_faces(), 12) << "Unexpected number of faces.";
+  const PointAttribute *const pos_att = mesh->attribute(pos_att_id);
+  for (FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+    for (int c = 0; c < 3; ++c) {
+      Vector3f pos;
+      pos_att->GetMappedValue(mesh->face(fi)[c], &pos[0]);
+      for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(pos[i], positions[9 * fi.value() + 3 * c + i]);
+      }
+    }
+  }
+}
+
 TEST_F(TriangleSoupMeshBuilderTest, TestPerFaceAttribs) {
   // This tests, verifies that the mesh builder constructs a valid cube with
   // per face Boolean attributes.
@@ -0,0 +1,268 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_MESH_VERTEX_RING_CACHE_H_
+#define DRACO_MESH_VERTEX_RING_CACHE_H_
+
+#include <vector>
+
+#include "draco/attributes/geometry_indices.h"
+#include "draco/core/draco_index_type_vector.h"
+#include "draco/core/macros.h"
+
+namespace draco {
+
+// VertexRingCache stores the corners attached to each vertex of some kind of
+// CornerTable 'type' of class in a compact CSR-style layout. Algorithms that
+// repeatedly visit the one-ring of vertices (such as mesh prediction schemes)
+// can then read the corners of a ring from contiguous memory instead of
+// swinging around the vertex with the corner table.
+//
+// The corners of each ring are stored in the order in which they are visited
+// by swinging right from the left most corner of the vertex. The cache should
+// be cleared or rebuilt when the underlying mesh changes.
+template <class CornerTableT>
+class VertexRingCache {
+  const CornerTableT &table_;
+
+ public:
+  explicit VertexRingCache(const CornerTableT &table) : table_(table) {}
+
+  // Collects the rings of all vertices. Does nothing if the rings are already
+  // cached. The cache stays empty when the connectivity of the table is
+  // invalid.
+  void CacheVertexRings() const {
+    if (!IsCacheEmpty()) {
+      return;
+    }
+    const int num_vertices = table_.num_vertices();
+    ring_offsets_.reserve(num_vertices + 1);
+    ring_corners_.reserve(table_.num_corners());
+    is_ring_closed_.assign(num_vertices, false);
+    corner_ring_positions_.assign(table_.num_corners(), -1);
+    ring_offsets_.push_back(0);
+    // Limits the total number of corners visited while looking for left most
+    // corners, in case the table does not provide them.
+    int num_left_swings = table_.num_corners();
+    for (VertexIndex v(0); v < num_vertices; ++v) {
+      if (!CacheVertexRing(v, &num_left_swings)) {
+        ClearVertexRingCache();
+        return;
+      }
+      ring_offsets_.push_back(static_cast<uint32_t>(ring_corners_.size()));
+    }
+  }
+
+  // Clears the cache and deallocates the memory.
+  void ClearVertexRingCache() const {
+    std::vector<uint32_t>().swap(ring_offsets_);
+    std::vector<CornerIndex>().swap(ring_corners_);
+    std::vector<bool>().swap(is_ring_closed_);
+    IndexTypeVector<CornerIndex, int32_t>().swap(corner_ring_positions_);
+  }
+
+  bool IsCacheEmpty() const { return ring_offsets_.empty(); }
+
+  // Returns the number of corners in the ring of vertex |v|.
+  inline int RingSize(VertexIndex v) const {
+    DRACO_DCHECK_LT(v.value() + 1, ring_offsets_.size());
+    return ring_offsets_[v.value() + 1] - ring_offsets_[v.value()];
+  }
+
+  // Returns the first corner of the ring of vertex |v|.
+  inline const CornerIndex *RingCorners(VertexIndex v) const {
+    DRACO_DCHECK_LT(v.value() + 1, ring_offsets_.size());
+    return ring_corners_.data() + ring_offsets_[v.value()];
+  }
+
+  // Returns true when the ring of vertex |v| is not interrupted by a boundary
+  // (or an attribute seam), i.e., when swinging around the vertex returns back
+  // to the starting corner.
+  inline bool IsRingClosed(VertexIndex v) const {
+    return is_ring_closed_[v.value()];
+  }
+
+  // Returns the position of corner |c| in the ring of its vertex or -1 if the
+  // corner is not part of any cached ring.
+  inline int RingPosition(CornerIndex c) const {
+    DRACO_DCHECK_EQ(corner_ring_positions_.size(), table_.num_corners());
+    return corner_ring_positions_[c];
+  }
+
+  // Calls |visit(corner)| for all corners attached to the vertex of |start|
+  // in the same order as VertexCornersIterator, i.e., by swinging left from
+  // |start| and, if a boundary is reached, by swinging right from |start|.
+  // The traversal stops when |visit| returns false. Cached rings are used when
+  // available, otherwise the corners are visited using the corner table.
+  template <class VisitorT>
+  void VisitCorners(CornerIndex start, VisitorT visit) const {
+    const int pos = IsCacheEmpty() ? -1 : RingPosition(start);
+    if (pos < 0) {
+      CornerIndex c = start;
+      bool left_traversal = true;
+      while (c != kInvalidCornerIndex) {
+        if (!visit(c)) {
+          return;
+        }
+        if (left_traversal) {
+          c = table_.SwingLeft(c);
+          if (c == kInvalidCornerIndex) {
+            // Open boundary reached.
+            c = table_.SwingRight(start);
+            left_traversal = false;
+          } else if (c == start) {
+            return;
+          }
+        } else {
+          c = table_.SwingRight(c);
+          if (c == start) {
+            // Can happen only for invalid connectivity.
+            return;
+          }
+        }
+      }
+      return;
+    }
+    const VertexIndex v = table_.Vertex(start);
+    const CornerIndex *const ring = RingCorners(v);
+    const int ring_size = RingSize(v);
+    if (IsRingClosed(v)) {
+      for (int i = 0; i < ring_size; ++i) {
+        const int k = pos >= i ? pos - i : pos - i + ring_size;
+        if (!visit(ring[k])) {
+          return;
+        }
+      }
+      return;
+    }
+    for (int k = pos; k >= 0; --k) {
+      if (!visit(ring[k])) {
+        return;
+      }
+    }
+    for (int k = pos + 1; k < ring_size; ++k) {
+      if (!visit(ring[k])) {
+        return;
+      }
+    }
+  }
+
+  // Calls |visit(corner)| for the corners visited when swinging right from
+  // |start| until a boundary is reached or until all corners attached to the
+  // vertex were visited. The traversal stops when |visit| returns false.
+  template <class VisitorT>
+  void VisitCornersSwingRight(CornerIndex start, VisitorT visit) const {
+    const int pos = IsCacheEmpty() ? -1 : RingPosition(start);
+    if (pos < 0) {
+      CornerIndex c = start;
+      do {
+        if (!visit(c)) {
+          return;
+        }
+        c = table_.SwingRight(c);
+      } while (c != kInvalidCornerIndex && c != start);
+      return;
+    }
+    const VertexIndex v = table_.Vertex(start);
+    const CornerIndex *const ring = RingCorners(v);
+    const int ring_size = RingSize(v);
+    const int num_visited = IsRingClosed(v) ? ring_size : ring_size - pos;
+    for (int i = 0; i < num_visited; ++i) {
+      const int k = pos + i < ring_size ? pos + i : pos + i - ring_size;
+      if (!visit(ring[k])) {
+        return;
+      }
+    }
+  }
+
+ private:
+  // Appends the ring of vertex |v| to |ring_corners_|. Returns false when the
+  // connectivity of the table is invalid.
+  bool CacheVertexRing(VertexIndex v, int *num_left_swings) const {
+    const CornerIndex start_corner = table_.LeftMostCorner(v);
+    if (start_corner == kInvalidCornerIndex) {
+      // Isolated vertex.
+      return true;
+    }
+    const size_t ring_begin = ring_corners_.size();
+    CornerIndex end_corner;
+    if (!CollectRing(start_corner, &end_corner)) {
+      return false;
+    }
+    if (end_corner == start_corner) {
+      is_ring_closed_[v.value()] = true;
+      return true;
+    }
+    if (table_.SwingLeft(start_corner) == kInvalidCornerIndex) {
+      // Open ring starting at a boundary.
+      return true;
+    }
+    // Do not rely on the left most corner being on a boundary. Swing left
+    // until the boundary is reached and collect the ring again from there.
+    for (size_t i = ring_begin; i < ring_corners_.size(); ++i) {
+      corner_ring_positions_[ring_corners_[i]] = -1;
+    }
+    ring_corners_.resize(ring_begin);
+    CornerIndex first_corner = start_corner;
+    while (true) {
+      if (--(*num_left_swings) < 0) {
+        return false;
+      }
+      const CornerIndex c = table_.SwingLeft(first_corner);
+      if (c == kInvalidCornerIndex) {
+        break;
+      }
+      if (c == start_corner) {
+        // Swinging left and right is not consistent.
+        return false;
+      }
+      first_corner = c;
+    }
+    return CollectRing(first_corner, &end_corner) &&
+           end_corner == kInvalidCornerIndex;
+  }
+
+  // Appends the corners visited by swinging right from |first_corner| to
+  // |ring_corners_| and stores the corner at which the traversal stopped in
+  // |end_corner|, i.e., |first_corner| for closed rings and kInvalidCornerIndex
+  // for open rings. Returns false when a corner would be cached twice, which
+  // happens only for invalid connectivity.
+  bool CollectRing(CornerIndex first_corner, CornerIndex *end_corner) const {
+    const size_t ring_begin = ring_corners_.size();
+    CornerIndex c = first_corner;
+    do {
+      if (corner_ring_positions_[c] != -1) {
+        return false;
+      }
+      corner_ring_positions_[c] =
+          static_cast<int32_t>(ring_corners_.size() - ring_begin);
+      ring_corners_.push_back(c);
+      c = table_.SwingRight(c);
+    } while (c != kInvalidCornerIndex && c != first_corner);
+    *end_corner = c;
+    return true;
+  }
+
+  // Offsets of the rings of all vertices in |ring_corners_|. The ring of vertex
+  // v is stored at [ring_offsets_[v], ring_offsets_[v + 1]).
+  mutable std::vector<uint32_t> ring_offsets_;
+  mutable std::vector<CornerIndex> ring_corners_;
+  mutable std::vector<bool> is_ring_closed_;
+  // Position of each corner in the ring of its vertex.
+  mutable IndexTypeVector<CornerIndex, int32_t> corner_ring_positions_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_MESH_VERTEX_RING_CACHE_H_
@@ -0,0 +1,195 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/mesh/vertex_ring_cache.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/mesh/corner_table_iterators.h"
+#include "draco/mesh/mesh_attribute_corner_table.h"
+#include "draco/mesh/mesh_misc_functions.h"
+
+namespace {
+
+class VertexRingCacheTest : public ::testing::Test {
+ protected:
+  // Verifies that the corners visited through the ring cache of |table| are
+  // the same and in the same order as the corners visited by swinging around
+  // the vertices with the table, both with and without the cached rings.
+  template <class CornerTableT>
+  void TestTraversalOrder(const CornerTableT &table) {
+    const draco::VertexRingCache<CornerTableT> &cache =
+        table.GetVertexRingCache();
+    ASSERT_TRUE(cache.IsCacheEmpty());
+    for (int pass = 0; pass < 2; ++pass) {
+      for (draco::CornerIndex ci(0); ci < table.num_corners(); ++ci) {
+        std::vector<draco::CornerIndex> expected;
+        draco::VertexCornersIterator<CornerTableT> it(&table, ci);
+        for (; !it.End(); it.Next()) {
+          expected.push_back(it.Corner());
+        }
+        std::vector<draco::CornerIndex> visited;
+        cache.VisitCorners(ci, [&](draco::CornerIndex c) {
+          visited.push_back(c);
+          return true;
+        });
+        ASSERT_EQ(visited, expected);
+
+        expected.clear();
+        draco::CornerIndex c = ci;
+        do {
+          expected.push_back(c);
+          c = table.SwingRight(c);
+        } while (c != draco::kInvalidCornerIndex && c != ci);
+        visited.clear();
+        cache.VisitCornersSwingRight(ci, [&](draco::CornerIndex c) {
+          visited.push_back(c);
+          return true;
+        });
+        ASSERT_EQ(visited, expected);
+
+        // The batch variants gather the same corners.
+        expected = visited;
+        visited.clear();
+        draco::VisitVertexCornerBatchesSwingRight(
+            &table, ci, [&](const draco::CornerIndex *corners, int num) {
+              ASSERT_LE(num, draco::kMaxVertexCornersBatchSize);
+              visited.insert(visited.end(), corners, corners + num);
+            });
+        ASSERT_EQ(visited, expected);
+        visited.clear();
+        cache.VisitCorners(ci, [&](draco::CornerIndex c) {
+          visited.push_back(c);
+          return true;
+        });
+        expected = visited;
+        visited.clear();
+        draco::VisitVertexCornerBatches(
+            &table, ci, [&](const draco::CornerIndex *corners, int num) {
+              ASSERT_LE(num, draco::kMaxVertexCornersBatchSize);
+              visited.insert(visited.end(), corners, corners + num);
+            });
+        ASSERT_EQ(visited, expected);
+
+        // Test early termination.
+        int num_visited = 0;
+        cache.VisitCorners(ci, [&](draco::CornerIndex) {
+          ++num_visited;
+          return false;
+        });
+        ASSERT_EQ(num_visited, 1);
+      }
+      cache.CacheVertexRings();
+      ASSERT_FALSE(cache.IsCacheEmpty());
+    }
+    for (draco::VertexIndex vi(0); vi < table.num_vertices(); ++vi) {
+      const int ring_size = cache.RingSize(vi);
+      for (int i = 0; i < ring_size; ++i) {
+        const draco::CornerIndex c = cache.RingCorners(vi)[i];
+        ASSERT_EQ(table.Vertex(c), vi);
+        ASSERT_EQ(cache.RingPosition(c), i);
+      }
+      ASSERT_EQ(cache.IsRingClosed(vi), !table.IsOnBoundary(vi));
+    }
+    cache.ClearVertexRingCache();
+    ASSERT_TRUE(cache.IsCacheEmpty());
+  }
+
+  // Verifies that encoding and decoding |file_name| with the ring cache
+  // produces the same data as without it.
+  void TestEncodeDecode(const std::string &file_name,
+                        draco::PredictionSchemeMethod position_method) {
+    const std::unique_ptr<draco::Mesh> mesh =
+        draco::ReadMeshFromTestFile(file_name);
+    ASSERT_NE(mesh, nullptr);
+    draco::Encoder encoder;
+    encoder.SetSpeedOptions(0, 0);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 12);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 8);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 10);
+    DRACO_ASSERT_OK(encoder.SetAttributePredictionScheme(
+        draco::GeometryAttribute::POSITION, position_method));
+    draco::EncoderBuffer expected_buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &expected_buffer));
+
+    encoder.options().SetGlobalBool("use_vertex_ring_cache", true);
+    draco::EncoderBuffer buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &buffer));
+    ASSERT_EQ(buffer.size(), expected_buffer.size());
+    ASSERT_EQ(memcmp(buffer.data(), expected_buffer.data(), buffer.size()), 0);
+
+    draco::DecoderBuffer decoder_buffer;
+    decoder_buffer.Init(buffer.data(), buffer.size());
+    draco::Decoder decoder;
+    const std::unique_ptr<draco::Mesh> expected =
+        decoder.DecodeMeshFromBuffer(&decoder_buffer).value();
+    ASSERT_NE(expected, nullptr);
+    decoder_buffer.Init(buffer.data(), buffer.size());
+    draco::Decoder ring_decoder;
+    ring_decoder.options()->SetGlobalBool("use_vertex_ring_cache", true);
+    const std::unique_ptr<draco::Mesh> decoded =
+        ring_decoder.DecodeMeshFromBuffer(&decoder_buffer).value();
+    ASSERT_NE(decoded, nullptr);
+    ASSERT_EQ(decoded->num_attributes(), expected->num_attributes());
+    for (int i = 0; i < decoded->num_attributes(); ++i) {
+      const draco::DataBuffer *const att_buffer =
+          decoded->attribute(i)->buffer();
+      const draco::DataBuffer *const expected_att_buffer =
+          expected->attribute(i)->buffer();
+      ASSERT_EQ(att_buffer->data_size(), expected_att_buffer->data_size());
+      ASSERT_EQ(memcmp(att_buffer->data(), expected_att_buffer->data(),
+                       att_buffer->data_size()),
+                0);
+    }
+  }
+};
+
+TEST_F(VertexRingCacheTest, TestTraversalOrder) {
+  for (const std::string file_name :
+       {"cube_att.obj", "bunny_norm.obj", "test_nm.obj"}) {
+    const std::unique_ptr<draco::Mesh> mesh =
+        draco::ReadMeshFromTestFile(file_name);
+    ASSERT_NE(mesh, nullptr);
+    const std::unique_ptr<draco::CornerTable> table =
+        draco::CreateCornerTableFromPositionAttribute(mesh.get());
+    ASSERT_NE(table, nullptr);
+    TestTraversalOrder(*table);
+
+    // Attribute corner tables stop the traversal on attribute seams.
+    const draco::PointAttribute *const att =
+        mesh->GetNamedAttribute(draco::GeometryAttribute::NORMAL);
+    if (att != nullptr) {
+      draco::MeshAttributeCornerTable att_table;
+      ASSERT_TRUE(att_table.InitFromAttribute(mesh.get(), table.get(), att));
+      TestTraversalOrder(att_table);
+    }
+  }
+}
+
+TEST_F(VertexRingCacheTest, TestEncodeDecode) {
+  // Normals are predicted with the geometric normal prediction.
+  TestEncodeDecode("bunny_norm.obj", draco::MESH_PREDICTION_PARALLELOGRAM);
+  TestEncodeDecode("bunny_norm.obj",
+                   draco::MESH_PREDICTION_CONSTRAINED_MULTI_PARALLELOGRAM);
+  TestEncodeDecode("cube_att.obj",
+                   draco::MESH_PREDICTION_CONSTRAINED_MULTI_PARALLELOGRAM);
+}
+
+}  // namespace
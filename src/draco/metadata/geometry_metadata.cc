@@ -54,4 +54,14 @@ bool GeometryMetadata::AddAttributeMetadata(
   att_metadatas_.push_back(std::move(att_metadata));
   return true;
 }
+
+size_t GeometryMetadata::ComputeMemoryUsage() const {
+  size_t num_bytes = Metadata::ComputeMemoryUsage() +
+                     att_metadatas_.capacity() *
+                         sizeof(std::unique_ptr<AttributeMetadata>);
+  for (const auto &att_metadata : att_metadatas_) {
+    num_bytes += sizeof(AttributeMetadata) + att_metadata->ComputeMemoryUsage();
+  }
+  return num_bytes;
+}
 }  // namespace draco
@@ -116,6 +116,10 @@ class GeometryMetadata : public Metadata {
     return att_metadatas_;
   }
 
+  // Same as Metadata::ComputeMemoryUsage() but includes the metadata of all
+  // attributes.
+  size_t ComputeMemoryUsage() const;
+
  private:
   std::vector<std::unique_ptr<AttributeMetadata>> att_metadatas_;
 
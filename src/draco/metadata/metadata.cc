@@ -14,8 +14,12 @@
 //
 #include "draco/metadata/metadata.h"
 
+#include <algorithm>
 #include <utility>
 
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/varint_decoding.h"
+
 namespace draco {
 
 EntryValue::EntryValue(const EntryValue &value) {
@@ -39,7 +43,14 @@ bool EntryValue::GetValue(std::string *value) const {
 }
 
 Metadata::Metadata(const Metadata &metadata) {
-  entries_.insert(metadata.entries_.begin(), metadata.entries_.end());
+  if (metadata.flat_entries_ != nullptr) {
+    // Share the flat entries instead of copying them. |entries_| of
+    // |metadata| is empty until the flat entries are copied into it.
+    SetFlatEntries(metadata.flat_entries_, metadata.flat_entries_begin_,
+                   metadata.flat_entries_end_);
+  } else {
+    entries_.insert(metadata.entries().begin(), metadata.entries().end());
+  }
   for (const auto &sub_metadata_entry : metadata.sub_metadatas_) {
     std::unique_ptr<Metadata> sub_metadata =
         std::unique_ptr<Metadata>(new Metadata(*sub_metadata_entry.second));
@@ -131,10 +142,126 @@ Metadata *Metadata::sub_metadata(const std::string &name) {
 }
 
 void Metadata::RemoveEntry(const std::string &name) {
+  if (encoded_entries_ != nullptr) {
+    DecodeEncodedEntries();
+  }
+  if (flat_entries_ != nullptr) {
+    CopyFlatEntries();
+  }
   // Actually just remove "name", no need to check if it exists.
   auto entry_ptr = entries_.find(name);
   if (entry_ptr != entries_.end()) {
     entries_.erase(entry_ptr);
   }
 }
+
+size_t Metadata::ComputeMemoryUsage() const {
+  // Approximate size of a node of std::map.
+  constexpr size_t kNodeOverhead = 4 * sizeof(void *);
+  size_t num_bytes = 0;
+  for (const auto &entry : entries_) {
+    num_bytes += kNodeOverhead + sizeof(entry) + entry.first.capacity() +
+                 entry.second.data().capacity();
+  }
+  for (const auto &sub_metadata : sub_metadatas_) {
+    num_bytes += kNodeOverhead + sizeof(sub_metadata) +
+                 sub_metadata.first.capacity() + sizeof(Metadata) +
+                 sub_metadata.second->ComputeMemoryUsage();
+  }
+  if (encoded_entries_ != nullptr) {
+    num_bytes += encoded_entries_->capacity() / encoded_entries_.use_count();
+  }
+  if (flat_entries_ != nullptr) {
+    // Each metadata is charged for its own entries and values and for a share
+    // of the names.
+    size_t names_bytes = 0;
+    for (const std::string &name : flat_entries_->names) {
+      names_bytes += sizeof(name) + name.capacity();
+    }
+    num_bytes += names_bytes / flat_entries_.use_count();
+    for (uint32_t i = flat_entries_begin_; i < flat_entries_end_; ++i) {
+      num_bytes += sizeof(FlatMetadataEntries::Entry) +
+                   flat_entries_->entries[i].data_size;
+    }
+  }
+  return num_bytes;
+}
+
+void Metadata::SetEncodedEntries(
+    std::shared_ptr<const std::vector<uint8_t>> data, size_t offset,
+    uint32_t num_entries) {
+  encoded_entries_ = std::move(data);
+  encoded_entries_offset_ = offset;
+  num_encoded_entries_ = num_entries;
+}
+
+void Metadata::DecodeEncodedEntries() const {
+  DecoderBuffer buffer;
+  buffer.Init(
+      reinterpret_cast<const char *>(encoded_entries_->data()) +
+          encoded_entries_offset_,
+      encoded_entries_->size() - encoded_entries_offset_);
+  // The entries were validated by MetadataDecoder so that decoding can only
+  // fail on corrupted memory. Entries decoded up to that point are kept.
+  for (uint32_t i = 0; i < num_encoded_entries_; ++i) {
+    uint8_t name_len = 0;
+    if (!buffer.Decode(&name_len) || name_len > buffer.remaining_size()) {
+      break;
+    }
+    const std::string name(buffer.data_head(), name_len);
+    buffer.Advance(name_len);
+    uint32_t data_size = 0;
+    if (!DecodeVarint(&data_size, &buffer) ||
+        data_size > buffer.remaining_size()) {
+      break;
+    }
+    const uint8_t *const data =
+        reinterpret_cast<const uint8_t *>(buffer.data_head());
+    // Entries decoded later replace the earlier ones like in AddEntry().
+    entries_.erase(name);
+    entries_.insert(std::make_pair(
+        name, EntryValue(std::vector<uint8_t>(data, data + data_size))));
+    buffer.Advance(data_size);
+  }
+  encoded_entries_ = nullptr;
+}
+
+void Metadata::SetFlatEntries(
+    std::shared_ptr<const FlatMetadataEntries> entries, uint32_t begin,
+    uint32_t end) {
+  flat_entries_ = std::move(entries);
+  flat_entries_begin_ = begin;
+  flat_entries_end_ = end;
+}
+
+const FlatMetadataEntries::Entry *Metadata::FindFlatEntry(
+    const std::string &name) const {
+  // MetadataDecoder makes sure that the entries are sorted by name.
+  const FlatMetadataEntries::Entry *const begin =
+      flat_entries_->entries.data() + flat_entries_begin_;
+  const FlatMetadataEntries::Entry *const end =
+      flat_entries_->entries.data() + flat_entries_end_;
+  const std::vector<std::string> &names = flat_entries_->names;
+  const FlatMetadataEntries::Entry *const itr = std::lower_bound(
+      begin, end, name,
+      [&names](const FlatMetadataEntries::Entry &entry,
+               const std::string &value) {
+        return names[entry.name_index] < value;
+      });
+  if (itr == end || names[itr->name_index] != name) {
+    return nullptr;
+  }
+  return itr;
+}
+
+void Metadata::CopyFlatEntries() const {
+  for (uint32_t i = flat_entries_begin_; i < flat_entries_end_; ++i) {
+    const FlatMetadataEntries::Entry &entry = flat_entries_->entries[i];
+    const uint8_t *const data = &flat_entries_->data[entry.data_offset];
+    entries_.insert(std::make_pair(
+        flat_entries_->names[entry.name_index],
+        EntryValue(std::vector<uint8_t>(data, data + entry.data_size))));
+  }
+  flat_entries_ = nullptr;
+}
 }  // namespace draco
@@ -90,6 +90,22 @@ struct EntryValueHasher {
   }
 };
 
+// Entries of all metadata decoded by MetadataDecoder from data with interned
+// names. Each metadata refers to a range of |entries| that is sorted by name,
+// so the entries can be looked up without building a map for every metadata.
+struct FlatMetadataEntries {
+  struct Entry {
+    // Index of the entry name in |names|.
+    uint32_t name_index;
+    // Location of the entry value in |data|.
+    size_t data_offset;
+    uint32_t data_size;
+  };
+  std::vector<std::string> names;
+  std::vector<Entry> entries;
+  std::vector<uint8_t> data;
+};
+
 // Class for holding generic metadata. It has a list of entries which consist of
 // an entry name and an entry value. Each Metadata could also have nested
 // metadata.
@@ -151,17 +167,42 @@ class Metadata {
 
   void RemoveEntry(const std::string &name);
 
-  int num_entries() const { return static_cast<int>(entries_.size()); }
-  const std::map<std::string, EntryValue> &entries() const { return entries_; }
+  int num_entries() const {
+    if (flat_entries_ != nullptr) {
+      return static_cast<int>(flat_entries_end_ - flat_entries_begin_);
+    }
+    return static_cast<int>(entries().size());
+  }
+  const std::map<std::string, EntryValue> &entries() const {
+    if (encoded_entries_ != nullptr) {
+      DecodeEncodedEntries();
+    }
+    if (flat_entries_ != nullptr) {
+      CopyFlatEntries();
+    }
+    return entries_;
+  }
   const std::map<std::string, std::unique_ptr<Metadata>> &sub_metadatas()
       const {
     return sub_metadatas_;
   }
 
+  // Returns the approximate number of bytes allocated by the entries of this
+  // metadata and of all its sub-metadata. Entries that are not decoded yet
+  // are charged a share of the encoded data, which is shared by all lazily
+  // decoded metadata of a geometry.
+  size_t ComputeMemoryUsage() const;
+
  private:
   // Make this function private to avoid adding undefined data types.
   template <typename DataTypeT>
   void AddEntry(const std::string &entry_name, const DataTypeT &entry_value) {
+    if (encoded_entries_ != nullptr) {
+      DecodeEncodedEntries();
+    }
+    if (flat_entries_ != nullptr) {
+      CopyFlatEntries();
+    }
     const auto itr = entries_.find(entry_name);
     if (itr != entries_.end()) {
       entries_.erase(itr);
@@ -172,26 +213,72 @@ class Metadata {
   // Make this function private to avoid adding undefined data types.
   template <typename DataTypeT>
   bool GetEntry(const std::string &entry_name, DataTypeT *entry_value) const {
-    const auto itr = entries_.find(entry_name);
+    if (flat_entries_ != nullptr) {
+      const FlatMetadataEntries::Entry *const entry =
+          FindFlatEntry(entry_name);
+      if (entry == nullptr) {
+        return false;
+      }
+      const uint8_t *const data = &flat_entries_->data[entry->data_offset];
+      return EntryValue(std::vector<uint8_t>(data, data + entry->data_size))
+          .GetValue(entry_value);
+    }
+    const auto itr = entries().find(entry_name);
     if (itr == entries_.end()) {
       return false;
     }
     return itr->second.GetValue(entry_value);
   }
 
-  std::map<std::string, EntryValue> entries_;
+  // Sets |num_entries| entries encoded at |offset| of |data| that are decoded
+  // on the first access of the entries of this metadata.
+  void SetEncodedEntries(std::shared_ptr<const std::vector<uint8_t>> data,
+                         size_t offset, uint32_t num_entries);
+
+  // Decodes the entries set by SetEncodedEntries() into |entries_|. This
+  // modifies the otherwise const metadata, so the first access of lazily
+  // decoded entries is not thread-safe.
+  void DecodeEncodedEntries() const;
+
+  // Uses entries in the range [|begin|, |end|) of |entries| as the entries of
+  // this metadata.
+  void SetFlatEntries(std::shared_ptr<const FlatMetadataEntries> entries,
+                      uint32_t begin, uint32_t end);
+
+  // Returns the flat entry with |name| or nullptr when there is no such entry.
+  const FlatMetadataEntries::Entry *FindFlatEntry(
+      const std::string &name) const;
+
+  // Copies the entries set by SetFlatEntries() into |entries_|. Like
+  // DecodeEncodedEntries(), the first call is not thread-safe.
+  void CopyFlatEntries() const;
+
+  mutable std::map<std::string, EntryValue> entries_;
   std::map<std::string, std::unique_ptr<Metadata>> sub_metadatas_;
 
+  // Entries encoded by MetadataEncoder that have not been decoded yet. The
+  // data is shared by all lazily decoded metadata of a geometry.
+  mutable std::shared_ptr<const std::vector<uint8_t>> encoded_entries_;
+  mutable size_t encoded_entries_offset_ = 0;
+  mutable uint32_t num_encoded_entries_ = 0;
+
+  // Entries decoded from data with interned names that are not copied to
+  // |entries_| yet. The table is shared by all metadata of a geometry.
+  mutable std::shared_ptr<const FlatMetadataEntries> flat_entries_;
+  mutable uint32_t flat_entries_begin_ = 0;
+  mutable uint32_t flat_entries_end_ = 0;
+
   friend struct MetadataHasher;
+  friend class MetadataDecoder;
 };
 
 // Functor for computing a hash from data stored within a metadata class.
 struct MetadataHasher {
   size_t operator()(const Metadata &metadata) const {
     size_t hash =
-        HashCombine(metadata.entries_.size(), metadata.sub_metadatas_.size());
+        HashCombine(metadata.entries().size(), metadata.sub_metadatas_.size());
     EntryValueHasher entry_value_hasher;
-    for (const auto &entry : metadata.entries_) {
+    for (const auto &entry : metadata.entries()) {
       hash = HashCombine(entry.first, hash);
       hash = HashCombine(entry_value_hasher(entry.second), hash);
     }
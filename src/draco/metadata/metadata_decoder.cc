@@ -14,13 +14,17 @@
 //
 #include "draco/metadata/metadata_decoder.h"
 
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "draco/core/varint_decoding.h"
 
 namespace draco {
 
-MetadataDecoder::MetadataDecoder() : buffer_(nullptr) {}
+MetadataDecoder::MetadataDecoder()
+    : buffer_(nullptr), decode_entries_lazily_(false), intern_names_(false) {}
 
 bool MetadataDecoder::DecodeMetadata(DecoderBuffer *in_buffer,
                                      Metadata *metadata) {
@@ -28,7 +32,17 @@ bool MetadataDecoder::DecodeMetadata(DecoderBuffer *in_buffer,
     return false;
   }
   buffer_ = in_buffer;
-  return DecodeMetadata(metadata);
+  lazy_entries_.clear();
+  const char *const data_start = buffer_->data_head();
+  if (!DecodeNames()) {
+    return false;
+  }
+  if (!DecodeMetadata(metadata)) {
+    return false;
+  }
+  SetLazyEntries(data_start);
+  SetFlatEntries();
+  return true;
 }
 
 bool MetadataDecoder::DecodeGeometryMetadata(DecoderBuffer *in_buffer,
@@ -37,6 +51,11 @@ bool MetadataDecoder::DecodeGeometryMetadata(DecoderBuffer *in_buffer,
     return false;
   }
   buffer_ = in_buffer;
+  lazy_entries_.clear();
+  const char *const data_start = buffer_->data_head();
+  if (!DecodeNames()) {
+    return false;
+  }
   uint32_t num_att_metadata = 0;
   if (!DecodeVarint(&num_att_metadata, buffer_)) {
     return false;
@@ -55,7 +74,29 @@ bool MetadataDecoder::DecodeGeometryMetadata(DecoderBuffer *in_buffer,
     }
     metadata->AddAttributeMetadata(std::move(att_metadata));
   }
-  return DecodeMetadata(static_cast<Metadata *>(metadata));
+  if (!DecodeMetadata(static_cast<Metadata *>(metadata))) {
+    return false;
+  }
+  SetLazyEntries(data_start);
+  SetFlatEntries();
+  return true;
+}
+
+void MetadataDecoder::SetLazyEntries(const char *data_start) {
+  if (lazy_entries_.empty()) {
+    return;
+  }
+  // Keep a copy of the decoded metadata because |buffer_| data may not outlive
+  // the metadata.
+  const uint8_t *const data = reinterpret_cast<const uint8_t *>(data_start);
+  const size_t data_size = buffer_->data_head() - data_start;
+  const std::shared_ptr<const std::vector<uint8_t>> encoded_data(
+      new std::vector<uint8_t>(data, data + data_size));
+  for (const LazyEntries &entries : lazy_entries_) {
+    entries.metadata->SetEncodedEntries(
+        encoded_data, entries.data - data_start, entries.num_entries);
+  }
+  lazy_entries_.clear();
 }
 
 bool MetadataDecoder::DecodeMetadata(Metadata *metadata) {
@@ -98,10 +139,23 @@ bool MetadataDecoder::DecodeMetadata(Metadata *metadata) {
     if (!DecodeVarint(&num_entries, buffer_)) {
       return false;
     }
-    for (uint32_t i = 0; i < num_entries; ++i) {
-      if (!DecodeEntry(metadata)) {
+    if (intern_names_) {
+      if (!DecodeFlatEntries(metadata, num_entries)) {
         return false;
       }
+    } else if (decode_entries_lazily_ && num_entries > 0) {
+      lazy_entries_.push_back({metadata, buffer_->data_head(), num_entries});
+      for (uint32_t i = 0; i < num_entries; ++i) {
+        if (!SkipEntry()) {
+          return false;
+        }
+      }
+    } else {
+      for (uint32_t i = 0; i < num_entries; ++i) {
+        if (!DecodeEntry(metadata)) {
+          return false;
+        }
+      }
     }
     uint32_t num_sub_metadata = 0;
     if (!DecodeVarint(&num_sub_metadata, buffer_)) {
@@ -142,7 +196,114 @@ bool MetadataDecoder::DecodeEntry(Metadata *metadata) {
   return true;
 }
 
+bool MetadataDecoder::SkipEntry() {
+  uint8_t name_len = 0;
+  if (!buffer_->Decode(&name_len) || name_len > buffer_->remaining_size()) {
+    return false;
+  }
+  buffer_->Advance(name_len);
+  uint32_t data_size = 0;
+  if (!DecodeVarint(&data_size, buffer_)) {
+    return false;
+  }
+  if (data_size == 0 || data_size > buffer_->remaining_size()) {
+    return false;
+  }
+  buffer_->Advance(data_size);
+  return true;
+}
+
+bool MetadataDecoder::DecodeNames() {
+  flat_entries_ = nullptr;
+  flat_entries_ranges_.clear();
+  if (!intern_names_) {
+    return true;
+  }
+  flat_entries_ = std::make_shared<FlatMetadataEntries>();
+  uint32_t num_names = 0;
+  if (!DecodeVarint(&num_names, buffer_)) {
+    return false;
+  }
+  if (num_names > buffer_->remaining_size()) {
+    // Each name is encoded in at least one byte.
+    return false;
+  }
+  std::vector<std::string> &names = flat_entries_->names;
+  names.resize(num_names);
+  for (uint32_t i = 0; i < num_names; ++i) {
+    uint8_t name_len = 0;
+    if (!buffer_->Decode(&name_len) || name_len > buffer_->remaining_size()) {
+      return false;
+    }
+    names[i].assign(buffer_->data_head(), name_len);
+    buffer_->Advance(name_len);
+  }
+  return true;
+}
+
+bool MetadataDecoder::DecodeFlatEntries(Metadata *metadata,
+                                        uint32_t num_entries) {
+  if (num_entries == 0) {
+    return true;
+  }
+  if (num_entries > buffer_->remaining_size()) {
+    return false;
+  }
+  const std::vector<std::string> &names = flat_entries_->names;
+  std::vector<FlatMetadataEntries::Entry> &entries = flat_entries_->entries;
+  std::vector<uint8_t> &data = flat_entries_->data;
+  const uint32_t begin = static_cast<uint32_t>(entries.size());
+  for (uint32_t i = 0; i < num_entries; ++i) {
+    FlatMetadataEntries::Entry entry;
+    if (!DecodeVarint(&entry.name_index, buffer_) ||
+        entry.name_index >= names.size()) {
+      return false;
+    }
+    // The entries must be sorted by name so that they can be looked up with
+    // a binary search. This also rejects duplicate names.
+    if (i > 0 &&
+        !(names[entries.back().name_index] < names[entry.name_index])) {
+      return false;
+    }
+    if (!DecodeVarint(&entry.data_size, buffer_)) {
+      return false;
+    }
+    if (entry.data_size == 0 || entry.data_size > buffer_->remaining_size()) {
+      return false;
+    }
+    entry.data_offset = data.size();
+    const uint8_t *const entry_data =
+        reinterpret_cast<const uint8_t *>(buffer_->data_head());
+    data.insert(data.end(), entry_data, entry_data + entry.data_size);
+    buffer_->Advance(entry.data_size);
+    entries.push_back(entry);
+  }
+  flat_entries_ranges_.push_back(
+      {metadata, begin, static_cast<uint32_t>(entries.size())});
+  return true;
+}
+
+void MetadataDecoder::SetFlatEntries() {
+  if (flat_entries_ == nullptr) {
+    return;
+  }
+  for (const FlatEntriesRange &range : flat_entries_ranges_) {
+    range.metadata->SetFlatEntries(flat_entries_, range.begin, range.end);
+  }
+  flat_entries_ranges_.clear();
+  flat_entries_ = nullptr;
+}
+
 bool MetadataDecoder::DecodeName(std::string *name) {
+  if (intern_names_) {
+    uint32_t name_index = 0;
+    if (!DecodeVarint(&name_index, buffer_) ||
+        name_index >= flat_entries_->names.size()) {
+      return false;
+    }
+    *name = flat_entries_->names[name_index];
+    return true;
+  }
   uint8_t name_len = 0;
   if (!buffer_->Decode(&name_len)) {
     return false;
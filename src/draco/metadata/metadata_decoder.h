@@ -15,6 +15,11 @@
 #ifndef DRACO_METADATA_METADATA_DECODER_H_
 #define DRACO_METADATA_METADATA_DECODER_H_
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "draco/core/decoder_buffer.h"
 #include "draco/metadata/geometry_metadata.h"
 #include "draco/metadata/metadata.h"
@@ -29,13 +34,59 @@ class MetadataDecoder {
   bool DecodeGeometryMetadata(DecoderBuffer *in_buffer,
                               GeometryMetadata *metadata);
 
+  // When set, the entries of all decoded metadata are only validated and
+  // their encoded data is kept until the entries are accessed for the first
+  // time, e.g., through Metadata::GetEntryInt(). Sub-metadata are always
+  // decoded. Lazy decoding is disabled by default.
+  void set_decode_entries_lazily(bool flag) { decode_entries_lazily_ = flag; }
+
+  // Must be set for data encoded with MetadataEncoder::set_intern_names().
+  // The entries of such data are stored in a single table shared by all
+  // decoded metadata (see FlatMetadataEntries) and maps of entries are only
+  // created when Metadata::entries() is called. Lazy decoding has no effect
+  // on such data. Default: false.
+  void set_intern_names(bool flag) { intern_names_ = flag; }
+
  private:
+  // Metadata with entries encoded at |data| that are decoded lazily.
+  struct LazyEntries {
+    Metadata *metadata;
+    const char *data;
+    uint32_t num_entries;
+  };
+
+  // Range of entries of |metadata| in |flat_entries_|.
+  struct FlatEntriesRange {
+    Metadata *metadata;
+    uint32_t begin;
+    uint32_t end;
+  };
+
+  // Shares the decoded data starting at |data_start| with all metadata in
+  // |lazy_entries_|.
+  void SetLazyEntries(const char *data_start);
+
+  // Decodes the table of interned names and prepares |flat_entries_|.
+  bool DecodeNames();
+
+  // Decodes |num_entries| entries of |metadata| into |flat_entries_|.
+  bool DecodeFlatEntries(Metadata *metadata, uint32_t num_entries);
+
+  // Shares |flat_entries_| with all metadata in |flat_entries_ranges_|.
+  void SetFlatEntries();
+
   bool DecodeMetadata(Metadata *metadata);
   bool DecodeEntries(Metadata *metadata);
   bool DecodeEntry(Metadata *metadata);
+  bool SkipEntry();
   bool DecodeName(std::string *name);
 
   DecoderBuffer *buffer_;
+  bool decode_entries_lazily_;
+  std::vector<LazyEntries> lazy_entries_;
+  bool intern_names_;
+  std::shared_ptr<FlatMetadataEntries> flat_entries_;
+  std::vector<FlatEntriesRange> flat_entries_ranges_;
 };
 }  // namespace draco
 
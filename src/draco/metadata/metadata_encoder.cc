@@ -20,12 +20,25 @@ namespace draco {
 
 bool MetadataEncoder::EncodeMetadata(EncoderBuffer *out_buffer,
                                      const Metadata *metadata) {
+  names_.clear();
+  name_indices_.clear();
+  if (intern_names_) {
+    CollectNames(*metadata);
+    if (!EncodeNames(out_buffer)) {
+      return false;
+    }
+  }
+  return EncodeMetadataInternal(out_buffer, metadata);
+}
+
+bool MetadataEncoder::EncodeMetadataInternal(EncoderBuffer *out_buffer,
+                                             const Metadata *metadata) {
   const std::map<std::string, EntryValue> &entries = metadata->entries();
   // Encode number of entries.
   EncodeVarint(static_cast<uint32_t>(metadata->num_entries()), out_buffer);
   // Encode all entries.
   for (const auto &entry : entries) {
-    if (!EncodeString(out_buffer, entry.first)) {
+    if (!EncodeName(out_buffer, entry.first)) {
       return false;
     }
     const std::vector<uint8_t> &entry_value = entry.second.data();
@@ -39,10 +52,10 @@ bool MetadataEncoder::EncodeMetadata(EncoderBuffer *out_buffer,
   EncodeVarint(static_cast<uint32_t>(sub_metadatas.size()), out_buffer);
   // Encode each sub-metadata
   for (auto &&sub_metadata_entry : sub_metadatas) {
-    if (!EncodeString(out_buffer, sub_metadata_entry.first)) {
+    if (!EncodeName(out_buffer, sub_metadata_entry.first)) {
       return false;
     }
-    EncodeMetadata(out_buffer, sub_metadata_entry.second.get());
+    EncodeMetadataInternal(out_buffer, sub_metadata_entry.second.get());
   }
 
   return true;
@@ -55,7 +68,7 @@ bool MetadataEncoder::EncodeAttributeMetadata(
   }
   // Encode attribute id.
   EncodeVarint(metadata->att_unique_id(), out_buffer);
-  EncodeMetadata(out_buffer, static_cast<const Metadata *>(metadata));
+  EncodeMetadataInternal(out_buffer, static_cast<const Metadata *>(metadata));
   return true;
 }
 
@@ -67,6 +80,17 @@ bool MetadataEncoder::EncodeGeometryMetadata(EncoderBuffer *out_buffer,
   // Encode number of attribute metadata.
   const std::vector<std::unique_ptr<AttributeMetadata>> &att_metadatas =
       metadata->attribute_metadatas();
+  names_.clear();
+  name_indices_.clear();
+  if (intern_names_) {
+    for (auto &&att_metadata : att_metadatas) {
+      CollectNames(*att_metadata);
+    }
+    CollectNames(*metadata);
+    if (!EncodeNames(out_buffer)) {
+      return false;
+    }
+  }
   // TODO(draco-eng): Limit the number of attributes.
   EncodeVarint(static_cast<uint32_t>(att_metadatas.size()), out_buffer);
   // Encode each attribute metadata
@@ -74,8 +98,47 @@ bool MetadataEncoder::EncodeGeometryMetadata(EncoderBuffer *out_buffer,
     EncodeAttributeMetadata(out_buffer, att_metadata.get());
   }
   // Encode normal metadata part.
-  EncodeMetadata(out_buffer, static_cast<const Metadata *>(metadata));
+  EncodeMetadataInternal(out_buffer, static_cast<const Metadata *>(metadata));
+
+  return true;
+}
+
+bool MetadataEncoder::EncodeName(EncoderBuffer *out_buffer,
+                                 const std::string &name) {
+  if (!intern_names_) {
+    return EncodeString(out_buffer, name);
+  }
+  const auto itr = name_indices_.find(name);
+  if (itr == name_indices_.end()) {
+    return false;
+  }
+  EncodeVarint(itr->second, out_buffer);
+  return true;
+}
 
+void MetadataEncoder::CollectNames(const Metadata &metadata) {
+  const auto add_name = [this](const std::string &name) {
+    if (name_indices_.emplace(name, static_cast<uint32_t>(names_.size()))
+            .second) {
+      names_.push_back(name);
+    }
+  };
+  for (const auto &entry : metadata.entries()) {
+    add_name(entry.first);
+  }
+  for (const auto &sub_metadata_entry : metadata.sub_metadatas()) {
+    add_name(sub_metadata_entry.first);
+    CollectNames(*sub_metadata_entry.second);
+  }
+}
+
+bool MetadataEncoder::EncodeNames(EncoderBuffer *out_buffer) {
+  EncodeVarint(static_cast<uint32_t>(names_.size()), out_buffer);
+  for (const std::string &name : names_) {
+    if (!EncodeString(out_buffer, name)) {
+      return false;
+    }
+  }
   return true;
 }
 
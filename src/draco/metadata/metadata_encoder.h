@@ -15,6 +15,10 @@
 #ifndef DRACO_METADATA_METADATA_ENCODER_H_
 #define DRACO_METADATA_METADATA_ENCODER_H_
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "draco/core/encoder_buffer.h"
 #include "draco/metadata/geometry_metadata.h"
 #include "draco/metadata/metadata.h"
@@ -25,16 +29,38 @@ namespace draco {
 // a metadata of a geometry, e.g. a point cloud.
 class MetadataEncoder {
  public:
-  MetadataEncoder() {}
+  MetadataEncoder() : intern_names_(false) {}
 
   bool EncodeGeometryMetadata(EncoderBuffer *out_buffer,
                               const GeometryMetadata *metadata);
   bool EncodeMetadata(EncoderBuffer *out_buffer, const Metadata *metadata);
 
+  // When set, all entry and sub-metadata names are encoded once in a table of
+  // strings at the start of the data and they are referenced by their index
+  // in the table. This makes the data smaller when many metadata share the
+  // same names, e.g., attribute metadata of a point cloud. The data must be
+  // decoded with MetadataDecoder::set_intern_names(true). Default: false.
+  void set_intern_names(bool flag) { intern_names_ = flag; }
+
  private:
+  bool EncodeMetadataInternal(EncoderBuffer *out_buffer,
+                              const Metadata *metadata);
   bool EncodeAttributeMetadata(EncoderBuffer *out_buffer,
                                const AttributeMetadata *metadata);
   bool EncodeString(EncoderBuffer *out_buffer, const std::string &str);
+
+  // Encodes |name| either as a string or as an index to the table of names.
+  bool EncodeName(EncoderBuffer *out_buffer, const std::string &name);
+
+  // Adds names of all entries and sub-metadata of |metadata| to |names_|.
+  void CollectNames(const Metadata &metadata);
+
+  // Encodes |names_| collected by CollectNames().
+  bool EncodeNames(EncoderBuffer *out_buffer);
+
+  bool intern_names_;
+  std::vector<std::string> names_;
+  std::unordered_map<std::string, uint32_t> name_indices_;
 };
 }  // namespace draco
 
@@ -14,11 +14,17 @@
 //
 #include "draco/metadata/metadata_encoder.h"
 
+#include <string>
+
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
 #include "draco/core/decoder_buffer.h"
 #include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
 #include "draco/core/encoder_buffer.h"
 #include "draco/metadata/metadata.h"
 #include "draco/metadata/metadata_decoder.h"
+#include "draco/point_cloud/point_cloud_builder.h"
 
 namespace {
 
@@ -164,4 +170,174 @@ TEST_F(MetadataEncoderTest, TestEncodingGeometryMetadata) {
 
   TestEncodingGeometryMetadata();
 }
+
+TEST_F(MetadataEncoderTest, TestLazyDecodingGeometryMetadata) {
+  std::unique_ptr<draco::AttributeMetadata> att_metadata =
+      std::unique_ptr<draco::AttributeMetadata>(new draco::AttributeMetadata);
+  att_metadata->AddEntryInt("int", 100);
+  att_metadata->AddEntryString("name", "pos");
+  ASSERT_TRUE(geometry_metadata.AddAttributeMetadata(std::move(att_metadata)));
+  geometry_metadata.AddEntryDouble("double", 1.234);
+  std::unique_ptr<draco::Metadata> sub_metadata =
+      std::unique_ptr<draco::Metadata>(new draco::Metadata());
+  sub_metadata->AddEntryIntArray("int_array", {1, 2, 3});
+  geometry_metadata.AddSubMetadata("sub0", std::move(sub_metadata));
+  ASSERT_TRUE(
+      encoder.EncodeGeometryMetadata(&encoder_buffer, &geometry_metadata));
+
+  decoder.set_decode_entries_lazily(true);
+  draco::GeometryMetadata decoded_metadata;
+  decoder_buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+  ASSERT_TRUE(
+      decoder.DecodeGeometryMetadata(&decoder_buffer, &decoded_metadata));
+  ASSERT_EQ(decoder_buffer.remaining_size(), 0);
+
+  // Lazily decoded entries must not depend on the source data.
+  encoder_buffer.Clear();
+  const draco::AttributeMetadata *const decoded_att_metadata =
+      decoded_metadata.GetAttributeMetadataByUniqueId(0);
+  ASSERT_NE(decoded_att_metadata, nullptr);
+  int32_t int_value = 0;
+  ASSERT_TRUE(decoded_att_metadata->GetEntryInt("int", &int_value));
+  ASSERT_EQ(int_value, 100);
+  CheckGeometryMetadatasAreEqual(geometry_metadata, decoded_metadata);
+
+  // Entries added to lazily decoded metadata replace the decoded ones.
+  draco::Metadata *const decoded_sub_metadata =
+      decoded_metadata.sub_metadata("sub0");
+  ASSERT_NE(decoded_sub_metadata, nullptr);
+  decoded_sub_metadata->AddEntryInt("int_array", 7);
+  ASSERT_EQ(decoded_sub_metadata->num_entries(), 1);
+  ASSERT_TRUE(decoded_sub_metadata->GetEntryInt("int_array", &int_value));
+  ASSERT_EQ(int_value, 7);
+}
+
+TEST_F(MetadataEncoderTest, TestLazyDecodingTruncatedMetadata) {
+  metadata.AddEntryString("string", "test string entry");
+  ASSERT_TRUE(encoder.EncodeMetadata(&encoder_buffer, &metadata));
+
+  // Entries are validated even when they are decoded lazily.
+  decoder.set_decode_entries_lazily(true);
+  draco::Metadata decoded_metadata;
+  decoder_buffer.Init(encoder_buffer.data(), encoder_buffer.size() - 4);
+  ASSERT_FALSE(decoder.DecodeMetadata(&decoder_buffer, &decoded_metadata));
+}
+
+TEST_F(MetadataEncoderTest, TestInternedNames) {
+  // Attribute metadata with the same entry names.
+  for (int i = 0; i < 20; ++i) {
+    std::unique_ptr<draco::AttributeMetadata> att_metadata(
+        new draco::AttributeMetadata);
+    att_metadata->set_att_unique_id(i);
+    att_metadata->AddEntryInt("scan_channel_index", i);
+    att_metadata->AddEntryString("scan_channel_name", "channel");
+    att_metadata->AddEntryDouble("scan_channel_scale", 0.5 * i);
+    ASSERT_TRUE(
+        geometry_metadata.AddAttributeMetadata(std::move(att_metadata)));
+  }
+  geometry_metadata.AddEntryInt("scan_channel_index", -1);
+  std::unique_ptr<draco::Metadata> sub_metadata(new draco::Metadata());
+  sub_metadata->AddEntryIntArray("scan_channel_name", {1, 2, 3});
+  geometry_metadata.AddSubMetadata("scan_channel_scale",
+                                   std::move(sub_metadata));
+  ASSERT_TRUE(
+      encoder.EncodeGeometryMetadata(&encoder_buffer, &geometry_metadata));
+  const size_t size = encoder_buffer.size();
+
+  encoder_buffer.Clear();
+  encoder.set_intern_names(true);
+  ASSERT_TRUE(
+      encoder.EncodeGeometryMetadata(&encoder_buffer, &geometry_metadata));
+  ASSERT_LT(encoder_buffer.size(), size / 2);
+
+  decoder.set_intern_names(true);
+  draco::GeometryMetadata decoded_metadata;
+  decoder_buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+  ASSERT_TRUE(
+      decoder.DecodeGeometryMetadata(&decoder_buffer, &decoded_metadata));
+  ASSERT_EQ(decoder_buffer.remaining_size(), 0);
+  encoder_buffer.Clear();
+
+  // Entries are looked up in the flat table.
+  const draco::AttributeMetadata *const decoded_att_metadata =
+      decoded_metadata.GetAttributeMetadataByUniqueId(7);
+  ASSERT_NE(decoded_att_metadata, nullptr);
+  ASSERT_EQ(decoded_att_metadata->num_entries(), 3);
+  int32_t int_value = 0;
+  ASSERT_TRUE(
+      decoded_att_metadata->GetEntryInt("scan_channel_index", &int_value));
+  ASSERT_EQ(int_value, 7);
+  double double_value = 0.0;
+  ASSERT_TRUE(decoded_att_metadata->GetEntryDouble("scan_channel_scale",
+                                                    &double_value));
+  ASSERT_EQ(double_value, 3.5);
+  ASSERT_FALSE(decoded_att_metadata->GetEntryInt("missing", &int_value));
+
+  // Copies share the flat entries.
+  const draco::GeometryMetadata copied_metadata(decoded_metadata);
+  CheckGeometryMetadatasAreEqual(geometry_metadata, copied_metadata);
+  CheckGeometryMetadatasAreEqual(geometry_metadata, decoded_metadata);
+
+  // Entries can be modified after decoding.
+  draco::AttributeMetadata *const att_metadata =
+      decoded_metadata.attribute_metadata(0);
+  att_metadata->AddEntryInt("scan_channel_index", 42);
+  ASSERT_EQ(att_metadata->num_entries(), 3);
+  ASSERT_TRUE(att_metadata->GetEntryInt("scan_channel_index", &int_value));
+  ASSERT_EQ(int_value, 42);
+}
+
+TEST_F(MetadataEncoderTest, TestInternedNamesInvalidData) {
+  metadata.AddEntryInt("a", 1);
+  metadata.AddEntryInt("b", 2);
+  encoder.set_intern_names(true);
+  ASSERT_TRUE(encoder.EncodeMetadata(&encoder_buffer, &metadata));
+  // 2 names, "a", "b", 2 entries, (0, 4, value), (1, 4, value), 0.
+  std::string data(encoder_buffer.data(), encoder_buffer.size());
+  ASSERT_EQ(data.size(), 19);
+  decoder.set_intern_names(true);
+
+  // Unsorted entries are rejected.
+  std::string unsorted_data = data;
+  unsorted_data[6] = 1;
+  unsorted_data[12] = 0;
+  draco::Metadata decoded_metadata;
+  decoder_buffer.Init(unsorted_data.data(), unsorted_data.size());
+  ASSERT_FALSE(decoder.DecodeMetadata(&decoder_buffer, &decoded_metadata));
+
+  // Invalid name indices are rejected.
+  std::string invalid_data = data;
+  invalid_data[12] = 2;
+  draco::Metadata decoded_metadata1;
+  decoder_buffer.Init(invalid_data.data(), invalid_data.size());
+  ASSERT_FALSE(decoder.DecodeMetadata(&decoder_buffer, &decoded_metadata1));
+}
+
+TEST_F(MetadataEncoderTest, TestInternedNamesInGeometry) {
+  // Tests that the header flag selects the metadata encoding.
+  draco::PointCloudBuilder builder;
+  builder.Start(2);
+  const int att_id = builder.AddAttribute(draco::GeometryAttribute::POSITION,
+                                          3, draco::DT_FLOAT32);
+  const float positions[6] = {0.f, 0.f, 0.f, 1.f, 1.f, 1.f};
+  builder.SetAttributeValuesForAllPoints(att_id, positions, 0);
+  std::unique_ptr<draco::PointCloud> pc = builder.Finalize(false);
+  ASSERT_NE(pc, nullptr);
+  std::unique_ptr<draco::GeometryMetadata> pc_metadata(
+      new draco::GeometryMetadata());
+  pc_metadata->AddEntryString("name", "scan");
+  pc->AddMetadata(std::move(pc_metadata));
+
+  draco::Encoder encoder;
+  encoder.SetInternMetadataNames(true);
+  DRACO_ASSERT_OK(encoder.EncodePointCloudToBuffer(*pc, &encoder_buffer));
+  decoder_buffer.Init(encoder_buffer.data(), encoder_buffer.size());
+  draco::Decoder decoder;
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::PointCloud> decoded_pc,
+                         decoder.DecodePointCloudFromBuffer(&decoder_buffer));
+  ASSERT_NE(decoded_pc->GetMetadata(), nullptr);
+  std::string name;
+  ASSERT_TRUE(decoded_pc->GetMetadata()->GetEntryString("name", &name));
+  ASSERT_EQ(name, "scan");
+}
 }  // namespace
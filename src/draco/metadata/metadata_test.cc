@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "draco/core/draco_test_base.h"
 #include "draco/metadata/geometry_metadata.h"
@@ -158,4 +159,23 @@ TEST_F(MetadataTest, TestGeometryMetadata) {
       nullptr);
 }
 
+TEST_F(MetadataTest, TestMemoryUsage) {
+  const size_t empty_usage = geometry_metadata.ComputeMemoryUsage();
+  geometry_metadata.AddEntryInt("int", 100);
+  const size_t entry_usage = geometry_metadata.ComputeMemoryUsage();
+  ASSERT_GT(entry_usage, empty_usage);
+
+  // Larger entries and attribute metadata must increase the reported usage.
+  geometry_metadata.AddEntryIntArray("array", std::vector<int32_t>(100, 1));
+  const size_t array_usage = geometry_metadata.ComputeMemoryUsage();
+  ASSERT_GE(array_usage, entry_usage + 100 * sizeof(int32_t));
+
+  std::unique_ptr<draco::AttributeMetadata> att_metadata(
+      new draco::AttributeMetadata());
+  att_metadata->AddEntryString("name", "pos");
+  const size_t att_usage = att_metadata->ComputeMemoryUsage();
+  ASSERT_TRUE(geometry_metadata.AddAttributeMetadata(std::move(att_metadata)));
+  ASSERT_GE(geometry_metadata.ComputeMemoryUsage(), array_usage + att_usage);
+}
+
 }  // namespace
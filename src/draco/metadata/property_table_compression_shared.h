@@ -0,0 +1,36 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_METADATA_PROPERTY_TABLE_COMPRESSION_SHARED_H_
+#define DRACO_METADATA_PROPERTY_TABLE_COMPRESSION_SHARED_H_
+
+#include <cstdint>
+
+namespace draco {
+
+// Methods used for coding the data of property table columns.
+enum PropertyTableColumnCoding : uint8_t {
+  // Raw bytes of the column.
+  PROPERTY_TABLE_COLUMN_RAW = 0,
+  // Integer components coded as entropy coded symbols. Components can be
+  // delta coded against the same component of the previous element.
+  PROPERTY_TABLE_COLUMN_INTEGER = 1,
+  // Strings coded as entropy coded indices into a dictionary of the unique
+  // strings of the column. The string offsets are implied by the dictionary.
+  PROPERTY_TABLE_COLUMN_STRING_DICTIONARY = 2,
+};
+
+}  // namespace draco
+
+#endif  // DRACO_METADATA_PROPERTY_TABLE_COMPRESSION_SHARED_H_
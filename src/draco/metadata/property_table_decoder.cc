@@ -0,0 +1,269 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/metadata/property_table_decoder.h"
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/core/bit_utils.h"
+#include "draco/core/varint_decoding.h"
+#include "draco/metadata/property_table_compression_shared.h"
+
+namespace draco {
+
+namespace {
+
+bool DecodeString(DecoderBuffer *in_buffer, std::string *out_str) {
+  uint32_t size;
+  if (!DecodeVarint(&size, in_buffer) ||
+      size > in_buffer->remaining_size()) {
+    return false;
+  }
+  out_str->resize(size);
+  return size == 0 || in_buffer->Decode(&(*out_str)[0], size);
+}
+
+// Returns the number of bytes of the offsets |type| or zero for invalid types.
+int GetOffsetSize(const std::string &type) {
+  if (type == "UINT8") {
+    return 1;
+  } else if (type == "UINT16") {
+    return 2;
+  } else if (type == "UINT32") {
+    return 4;
+  } else if (type == "UINT64") {
+    return 8;
+  }
+  return 0;
+}
+
+// Stores |ints| into |offsets| using the byte width of |offsets->type|.
+Status SetOffsets(const std::vector<uint64_t> &ints,
+                  PropertyTable::Property::Offsets *offsets) {
+  const int offset_size = GetOffsetSize(offsets->type);
+  if (offset_size == 0) {
+    return ints.empty() ? OkStatus()
+                        : Status(Status::DRACO_ERROR, "Invalid offsets type.");
+  }
+  offsets->data.data.resize(ints.size() * offset_size);
+  for (int i = 0; i < ints.size(); ++i) {
+    // This assumes execution on a little endian platform.
+    memcpy(&offsets->data.data[i * offset_size], &ints[i], offset_size);
+  }
+  return OkStatus();
+}
+
+Status DecodeOffsets(DecoderBuffer *in_buffer,
+                     PropertyTable::Property::Offsets *offsets) {
+  uint32_t target;
+  uint64_t num_offsets;
+  if (!DecodeString(in_buffer, &offsets->type) ||
+      !DecodeVarint(&target, in_buffer) ||
+      !DecodeVarint(&num_offsets, in_buffer)) {
+    return Status(Status::DRACO_ERROR, "Failed to decode property offsets.");
+  }
+  offsets->data.target = target;
+  if (num_offsets == 0) {
+    return OkStatus();
+  }
+  // Each length takes at least one bit of the entropy coded data.
+  if (num_offsets - 1 > 8 * in_buffer->remaining_size()) {
+    return Status(Status::DRACO_ERROR, "Invalid number of property offsets.");
+  }
+  std::vector<uint64_t> ints(num_offsets);
+  if (!DecodeVarint(&ints[0], in_buffer)) {
+    return Status(Status::DRACO_ERROR, "Failed to decode property offsets.");
+  }
+  std::vector<uint32_t> lengths(num_offsets - 1);
+  if (!lengths.empty() &&
+      !DecodeSymbols(static_cast<uint32_t>(lengths.size()), 1, in_buffer,
+                     lengths.data())) {
+    return Status(Status::DRACO_ERROR, "Failed to decode property offsets.");
+  }
+  for (int i = 0; i < lengths.size(); ++i) {
+    ints[i + 1] = ints[i] + lengths[i];
+  }
+  return SetOffsets(ints, offsets);
+}
+
+Status DecodeIntegerColumn(DecoderBuffer *in_buffer,
+                           std::vector<uint8_t> *data) {
+  uint8_t component_size;
+  uint8_t is_signed;
+  uint8_t use_delta;
+  uint32_t stride;
+  uint32_t num_values;
+  if (!in_buffer->Decode(&component_size) || !in_buffer->Decode(&is_signed) ||
+      !in_buffer->Decode(&use_delta) || !DecodeVarint(&stride, in_buffer) ||
+      !DecodeVarint(&num_values, in_buffer)) {
+    return Status(Status::DRACO_ERROR, "Failed to decode property column.");
+  }
+  if ((component_size != 1 && component_size != 2 && component_size != 4) ||
+      stride == 0 || num_values > 8 * in_buffer->remaining_size()) {
+    return Status(Status::DRACO_ERROR, "Invalid property column.");
+  }
+  std::vector<uint32_t> symbols(num_values);
+  if (num_values > 0 &&
+      !DecodeSymbols(num_values, 1, in_buffer, symbols.data())) {
+    return Status(Status::DRACO_ERROR, "Failed to decode property column.");
+  }
+  data->resize(static_cast<size_t>(num_values) * component_size);
+  std::vector<int64_t> values(num_values);
+  for (int i = 0; i < num_values; ++i) {
+    if (is_signed || use_delta) {
+      values[i] = ConvertSymbolToSignedInt(symbols[i]);
+    } else {
+      values[i] = symbols[i];
+    }
+    if (use_delta && i >= stride) {
+      values[i] += values[i - stride];
+    }
+    // This assumes execution on a little endian platform.
+    const uint32_t value = static_cast<uint32_t>(values[i]);
+    memcpy(&(*data)[i * component_size], &value, component_size);
+  }
+  return OkStatus();
+}
+
+// Decodes the dictionary coded strings into |property| data and restores the
+// string offsets from the string lengths.
+Status DecodeStringDictionaryColumn(DecoderBuffer *in_buffer,
+                                    PropertyTable::Property *property) {
+  uint32_t num_unique_strings;
+  if (!DecodeVarint(&num_unique_strings, in_buffer) ||
+      num_unique_strings > in_buffer->remaining_size()) {
+    return Status(Status::DRACO_ERROR, "Failed to decode property strings.");
+  }
+  std::vector<std::string> dictionary(num_unique_strings);
+  for (std::string &str : dictionary) {
+    if (!DecodeString(in_buffer, &str)) {
+      return Status(Status::DRACO_ERROR, "Failed to decode property strings.");
+    }
+  }
+  uint32_t num_strings;
+  if (!DecodeVarint(&num_strings, in_buffer) ||
+      num_strings > 8 * in_buffer->remaining_size()) {
+    return Status(Status::DRACO_ERROR, "Failed to decode property strings.");
+  }
+  std::vector<uint32_t> indices(num_strings);
+  if (num_strings > 0 &&
+      !DecodeSymbols(num_strings, 1, in_buffer, indices.data())) {
+    return Status(Status::DRACO_ERROR, "Failed to decode property strings.");
+  }
+  std::vector<uint8_t> &data = property->GetData().data;
+  std::vector<uint64_t> offsets(1, 0);
+  offsets.reserve(num_strings + 1);
+  for (const uint32_t index : indices) {
+    if (index >= dictionary.size()) {
+      return Status(Status::DRACO_ERROR, "Invalid property string index.");
+    }
+    data.insert(data.end(), dictionary[index].begin(), dictionary[index].end());
+    offsets.push_back(data.size());
+  }
+  PropertyTable::Property::Offsets &string_offsets =
+      property->GetStringOffsets();
+  uint32_t target;
+  if (!DecodeString(in_buffer, &string_offsets.type) ||
+      !DecodeVarint(&target, in_buffer)) {
+    return Status(Status::DRACO_ERROR, "Failed to decode property strings.");
+  }
+  string_offsets.data.target = target;
+  return SetOffsets(offsets, &string_offsets);
+}
+
+}  // namespace
+
+Status PropertyTableDecoder::DecodePropertyTable(DecoderBuffer *in_buffer,
+                                                 PropertyTable *table) {
+  // Columns are entropy coded with the current version of symbol coding.
+  in_buffer->set_bitstream_version(kDracoMeshBitstreamVersion);
+  std::string name;
+  std::string class_name;
+  uint32_t count;
+  uint32_t num_properties;
+  if (!DecodeString(in_buffer, &name) ||
+      !DecodeString(in_buffer, &class_name) ||
+      !DecodeVarint(&count, in_buffer) ||
+      !DecodeVarint(&num_properties, in_buffer)) {
+    return Status(Status::DRACO_ERROR, "Failed to decode property table.");
+  }
+  if (count > std::numeric_limits<int>::max() ||
+      num_properties > in_buffer->remaining_size()) {
+    return Status(Status::DRACO_ERROR, "Invalid property table.");
+  }
+  table->SetName(name);
+  table->SetClass(class_name);
+  table->SetCount(count);
+  for (uint32_t i = 0; i < num_properties; ++i) {
+    std::unique_ptr<PropertyTable::Property> property(
+        new PropertyTable::Property());
+    DRACO_RETURN_IF_ERROR(DecodeProperty(in_buffer, property.get()));
+    table->AddProperty(std::move(property));
+  }
+  return OkStatus();
+}
+
+Status PropertyTableDecoder::DecodeProperty(
+    DecoderBuffer *in_buffer, PropertyTable::Property *property) {
+  std::string name;
+  uint32_t target;
+  uint8_t coding;
+  if (!DecodeString(in_buffer, &name) || !DecodeVarint(&target, in_buffer) ||
+      !in_buffer->Decode(&coding)) {
+    return Status(Status::DRACO_ERROR, "Failed to decode property.");
+  }
+  property->SetName(name);
+  property->GetData().target = target;
+  std::vector<uint8_t> &data = property->GetData().data;
+  switch (coding) {
+    case PROPERTY_TABLE_COLUMN_RAW: {
+      uint64_t size;
+      if (!DecodeVarint(&size, in_buffer) ||
+          size > in_buffer->remaining_size()) {
+        return Status(Status::DRACO_ERROR, "Failed to decode property.");
+      }
+      data.resize(size);
+      if (size > 0 && !in_buffer->Decode(data.data(), size)) {
+        return Status(Status::DRACO_ERROR, "Failed to decode property.");
+      }
+      DRACO_RETURN_IF_ERROR(
+          DecodeOffsets(in_buffer, &property->GetStringOffsets()));
+      break;
+    }
+    case PROPERTY_TABLE_COLUMN_INTEGER:
+      DRACO_RETURN_IF_ERROR(DecodeIntegerColumn(in_buffer, &data));
+      DRACO_RETURN_IF_ERROR(
+          DecodeOffsets(in_buffer, &property->GetStringOffsets()));
+      break;
+    case PROPERTY_TABLE_COLUMN_STRING_DICTIONARY:
+      DRACO_RETURN_IF_ERROR(DecodeStringDictionaryColumn(in_buffer, property));
+      break;
+    default:
+      return Status(Status::DRACO_ERROR, "Unknown property column coding.");
+  }
+  return DecodeOffsets(in_buffer, &property->GetArrayOffsets());
+}
+
+}  // namespace draco
+
+#endif  // DRACO_TRANSCODER_SUPPORTED
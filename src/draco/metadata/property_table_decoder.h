@@ -0,0 +1,42 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_METADATA_PROPERTY_TABLE_DECODER_H_
+#define DRACO_METADATA_PROPERTY_TABLE_DECODER_H_
+
+#include "draco/draco_features.h"
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/metadata/property_table.h"
+
+namespace draco {
+
+// Class for decoding property tables compressed by PropertyTableEncoder.
+class PropertyTableDecoder {
+ public:
+  PropertyTableDecoder() {}
+
+  Status DecodePropertyTable(DecoderBuffer *in_buffer, PropertyTable *table);
+
+ private:
+  Status DecodeProperty(DecoderBuffer *in_buffer,
+                        PropertyTable::Property *property);
+};
+
+}  // namespace draco
+
+#endif  // DRACO_TRANSCODER_SUPPORTED
+#endif  // DRACO_METADATA_PROPERTY_TABLE_DECODER_H_
@@ -0,0 +1,358 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/metadata/property_table_encoder.h"
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "draco/compression/entropy/symbol_encoding.h"
+#include "draco/core/bit_utils.h"
+#include "draco/core/varint_encoding.h"
+#include "draco/metadata/property_table_compression_shared.h"
+
+namespace draco {
+
+namespace {
+
+typedef StructuralMetadataSchema::Object SchemaObject;
+
+// Format of the elements of a property table column.
+struct ColumnFormat {
+  bool is_string = false;
+  // Size of the integer components in bytes or zero for other columns.
+  int component_size = 0;
+  bool is_signed = false;
+  // Number of components of each column element.
+  int num_components = 1;
+};
+
+// Returns the number of components of the schema property |type|.
+int GetNumComponents(const std::string &type) {
+  if (type == "VEC2") {
+    return 2;
+  } else if (type == "VEC3") {
+    return 3;
+  } else if (type == "VEC4" || type == "MAT2") {
+    return 4;
+  } else if (type == "MAT3") {
+    return 9;
+  } else if (type == "MAT4") {
+    return 16;
+  }
+  return 1;
+}
+
+// Sets the integer component format of |format| from the schema
+// |component_type|. Only integers of up to 32 bits are entropy coded.
+void SetIntegerFormat(const std::string &component_type,
+                      ColumnFormat *format) {
+  if (component_type == "INT8" || component_type == "UINT8") {
+    format->component_size = 1;
+  } else if (component_type == "INT16" || component_type == "UINT16") {
+    format->component_size = 2;
+  } else if (component_type == "INT32" || component_type == "UINT32") {
+    format->component_size = 4;
+  }
+  format->is_signed = component_type[0] == 'I';
+}
+
+// Returns the child of |object| at the |path| of child names or nullptr.
+const SchemaObject *GetSchemaObject(const SchemaObject &object,
+                                    const std::vector<std::string> &path) {
+  const SchemaObject *child = &object;
+  for (const std::string &name : path) {
+    child = child->GetObjectByName(name);
+    if (child == nullptr) {
+      return nullptr;
+    }
+  }
+  return child;
+}
+
+// Returns the format of the property |property_name| of the schema class
+// |class_name|. Unknown properties are coded as raw bytes.
+ColumnFormat GetColumnFormat(const StructuralMetadataSchema &schema,
+                             const std::string &class_name,
+                             const std::string &property_name) {
+  ColumnFormat format;
+  const SchemaObject *const property = GetSchemaObject(
+      schema.json, {"classes", class_name, "properties", property_name});
+  if (property == nullptr) {
+    return format;
+  }
+  const SchemaObject *const type = property->GetObjectByName("type");
+  if (type == nullptr) {
+    return format;
+  }
+  if (type->GetString() == "STRING") {
+    format.is_string = true;
+  } else if (type->GetString() == "ENUM") {
+    // Enum values are stored as integers of the enum value type.
+    std::string value_type = "UINT16";
+    const SchemaObject *const enum_type = property->GetObjectByName("enumType");
+    if (enum_type != nullptr) {
+      const SchemaObject *const enum_value_type = GetSchemaObject(
+          schema.json, {"enums", enum_type->GetString(), "valueType"});
+      if (enum_value_type != nullptr) {
+        value_type = enum_value_type->GetString();
+      }
+    }
+    SetIntegerFormat(value_type, &format);
+  } else {
+    const SchemaObject *const component_type =
+        property->GetObjectByName("componentType");
+    if (component_type != nullptr) {
+      format.num_components = GetNumComponents(type->GetString());
+      SetIntegerFormat(component_type->GetString(), &format);
+    }
+  }
+  // Elements of fixed-length arrays contain all array entries.
+  const SchemaObject *const array = property->GetObjectByName("array");
+  const SchemaObject *const count = property->GetObjectByName("count");
+  if (array != nullptr && array->GetBoolean() && count != nullptr &&
+      count->GetInteger() > 0) {
+    format.num_components *= count->GetInteger();
+  }
+  return format;
+}
+
+void EncodeString(const std::string &str, EncoderBuffer *out_buffer) {
+  EncodeVarint(static_cast<uint32_t>(str.size()), out_buffer);
+  out_buffer->Encode(str.data(), str.size());
+}
+
+// Encodes |data| as raw bytes.
+void EncodeRawColumn(const std::vector<uint8_t> &data,
+                     EncoderBuffer *out_buffer) {
+  out_buffer->Encode(static_cast<uint8_t>(PROPERTY_TABLE_COLUMN_RAW));
+  EncodeVarint(static_cast<uint64_t>(data.size()), out_buffer);
+  out_buffer->Encode(data.data(), data.size());
+}
+
+// Encodes the integer components of |data| as entropy coded symbols, with or
+// without the delta coding depending on what produces smaller output. Returns
+// false when the components cannot be coded as symbols.
+bool EncodeIntegerColumn(const std::vector<uint8_t> &data,
+                         const ColumnFormat &format,
+                         EncoderBuffer *out_buffer) {
+  const int component_size = format.component_size;
+  if (data.size() % component_size != 0 ||
+      data.size() / component_size > std::numeric_limits<int>::max()) {
+    return false;
+  }
+  const int num_values = static_cast<int>(data.size() / component_size);
+  std::vector<int64_t> values(num_values);
+  for (int i = 0; i < num_values; ++i) {
+    // This assumes execution on a little endian platform.
+    uint32_t value = 0;
+    memcpy(&value, &data[i * component_size], component_size);
+    if (format.is_signed && component_size < 4) {
+      // Extend the sign of the value.
+      const int shift = 32 - 8 * component_size;
+      values[i] = static_cast<int32_t>(value << shift) >> shift;
+    } else if (format.is_signed) {
+      values[i] = static_cast<int32_t>(value);
+    } else {
+      values[i] = value;
+    }
+  }
+
+  EncoderBuffer buffers[2];
+  bool is_valid[2] = {false, false};
+  std::vector<uint32_t> symbols(num_values);
+  for (int use_delta = 0; use_delta < 2; ++use_delta) {
+    bool fits = true;
+    for (int i = 0; i < num_values && fits; ++i) {
+      int64_t value = values[i];
+      if (use_delta && i >= format.num_components) {
+        value -= values[i - format.num_components];
+      }
+      const uint64_t symbol =
+          (format.is_signed || use_delta)
+              ? ConvertSignedIntToSymbol(value)
+              : static_cast<uint64_t>(value);
+      fits = symbol <= std::numeric_limits<uint32_t>::max();
+      symbols[i] = static_cast<uint32_t>(symbol);
+    }
+    if (!fits) {
+      continue;
+    }
+    EncoderBuffer &buffer = buffers[use_delta];
+    buffer.Encode(static_cast<uint8_t>(PROPERTY_TABLE_COLUMN_INTEGER));
+    buffer.Encode(static_cast<uint8_t>(component_size));
+    buffer.Encode(static_cast<uint8_t>(format.is_signed));
+    buffer.Encode(static_cast<uint8_t>(use_delta));
+    EncodeVarint(static_cast<uint32_t>(format.num_components), &buffer);
+    EncodeVarint(static_cast<uint32_t>(num_values), &buffer);
+    is_valid[use_delta] =
+        num_values == 0 ||
+        EncodeSymbols(symbols.data(), num_values, 1, nullptr, &buffer);
+  }
+  if (!is_valid[0] && !is_valid[1]) {
+    return false;
+  }
+  const EncoderBuffer &best =
+      !is_valid[0] || (is_valid[1] && buffers[1].size() < buffers[0].size())
+          ? buffers[1]
+          : buffers[0];
+  out_buffer->Encode(best.data(), best.size());
+  return true;
+}
+
+// Encodes |offsets| as the lengths between consecutive offsets.
+Status EncodeOffsets(const PropertyTable::Property::Offsets &offsets,
+                     EncoderBuffer *out_buffer) {
+  EncodeString(offsets.type, out_buffer);
+  EncodeVarint(static_cast<uint32_t>(offsets.data.target), out_buffer);
+  DRACO_ASSIGN_OR_RETURN(const std::vector<uint64_t> ints,
+                         offsets.ParseToInts());
+  if (ints.empty() ? !offsets.data.data.empty()
+                   : offsets.data.data.size() % ints.size() != 0) {
+    // Trailing bytes of the offsets data cannot be restored.
+    return Status(Status::DRACO_ERROR, "Invalid property offsets.");
+  }
+  EncodeVarint(static_cast<uint64_t>(ints.size()), out_buffer);
+  if (ints.empty()) {
+    return OkStatus();
+  }
+  EncodeVarint(ints[0], out_buffer);
+  std::vector<uint32_t> lengths(ints.size() - 1);
+  for (int i = 0; i < lengths.size(); ++i) {
+    if (ints[i + 1] < ints[i] ||
+        ints[i + 1] - ints[i] > std::numeric_limits<uint32_t>::max()) {
+      return Status(Status::DRACO_ERROR, "Unsupported property offsets.");
+    }
+    lengths[i] = static_cast<uint32_t>(ints[i + 1] - ints[i]);
+  }
+  if (!lengths.empty() &&
+      !EncodeSymbols(lengths.data(), static_cast<int>(lengths.size()), 1,
+                     nullptr, out_buffer)) {
+    return Status(Status::DRACO_ERROR, "Failed to encode property offsets.");
+  }
+  return OkStatus();
+}
+
+// Encodes the strings of |property| as indices into a dictionary of unique
+// strings. Returns false when the strings cannot be dictionary coded.
+bool EncodeStringDictionaryColumn(const PropertyTable::Property &property,
+                                  EncoderBuffer *out_buffer) {
+  const std::vector<uint8_t> &data = property.GetData().data;
+  const PropertyTable::Property::Offsets &string_offsets =
+      property.GetStringOffsets();
+  StatusOr<std::vector<uint64_t>> offsets_or = string_offsets.ParseToInts();
+  if (!offsets_or.ok() || offsets_or.value().empty()) {
+    return false;
+  }
+  const std::vector<uint64_t> &offsets = offsets_or.value();
+  if (offsets.size() - 1 > std::numeric_limits<int>::max()) {
+    return false;
+  }
+  std::unordered_map<std::string, uint32_t> string_to_index;
+  std::vector<const std::string *> dictionary;
+  std::vector<uint32_t> indices(offsets.size() - 1);
+  for (int i = 0; i < indices.size(); ++i) {
+    if (offsets[i] > offsets[i + 1] || offsets[i + 1] > data.size()) {
+      return false;
+    }
+    const std::string str(data.begin() + offsets[i],
+                          data.begin() + offsets[i + 1]);
+    const auto it =
+        string_to_index.insert({str, static_cast<uint32_t>(dictionary.size())});
+    if (it.second) {
+      dictionary.push_back(&it.first->first);
+    }
+    indices[i] = it.first->second;
+  }
+  if (offsets[0] != 0 || offsets.back() != data.size()) {
+    // Data outside of the strings cannot be restored.
+    return false;
+  }
+
+  EncoderBuffer buffer;
+  buffer.Encode(
+      static_cast<uint8_t>(PROPERTY_TABLE_COLUMN_STRING_DICTIONARY));
+  EncodeVarint(static_cast<uint32_t>(dictionary.size()), &buffer);
+  for (const std::string *const str : dictionary) {
+    EncodeString(*str, &buffer);
+  }
+  EncodeVarint(static_cast<uint32_t>(indices.size()), &buffer);
+  if (!indices.empty() &&
+      !EncodeSymbols(indices.data(), static_cast<int>(indices.size()), 1,
+                     nullptr, &buffer)) {
+    return false;
+  }
+  // Only the format of the string offsets is needed.
+  EncodeString(string_offsets.type, &buffer);
+  EncodeVarint(static_cast<uint32_t>(string_offsets.data.target), &buffer);
+  out_buffer->Encode(buffer.data(), buffer.size());
+  return true;
+}
+
+}  // namespace
+
+Status PropertyTableEncoder::EncodePropertyTable(
+    const PropertyTable &table, const StructuralMetadataSchema &schema,
+    EncoderBuffer *out_buffer) {
+  if (table.GetCount() < 0) {
+    return Status(Status::DRACO_ERROR, "Invalid property table count.");
+  }
+  EncodeString(table.GetName(), out_buffer);
+  EncodeString(table.GetClass(), out_buffer);
+  EncodeVarint(static_cast<uint32_t>(table.GetCount()), out_buffer);
+  EncodeVarint(static_cast<uint32_t>(table.NumProperties()), out_buffer);
+  for (int i = 0; i < table.NumProperties(); ++i) {
+    DRACO_RETURN_IF_ERROR(EncodeProperty(table.GetProperty(i), schema,
+                                         table.GetClass(), out_buffer));
+  }
+  return OkStatus();
+}
+
+Status PropertyTableEncoder::EncodeProperty(
+    const PropertyTable::Property &property,
+    const StructuralMetadataSchema &schema, const std::string &class_name,
+    EncoderBuffer *out_buffer) {
+  EncodeString(property.GetName(), out_buffer);
+  EncodeVarint(static_cast<uint32_t>(property.GetData().target), out_buffer);
+
+  // Select the smallest coding of the column data together with the string
+  // offsets that are implied by the dictionary coding.
+  const ColumnFormat format =
+      GetColumnFormat(schema, class_name, property.GetName());
+  EncoderBuffer column_buffer;
+  if (format.component_size == 0 ||
+      !EncodeIntegerColumn(property.GetData().data, format, &column_buffer)) {
+    EncodeRawColumn(property.GetData().data, &column_buffer);
+  }
+  DRACO_RETURN_IF_ERROR(
+      EncodeOffsets(property.GetStringOffsets(), &column_buffer));
+  EncoderBuffer dictionary_buffer;
+  if (format.is_string &&
+      EncodeStringDictionaryColumn(property, &dictionary_buffer) &&
+      dictionary_buffer.size() < column_buffer.size()) {
+    out_buffer->Encode(dictionary_buffer.data(), dictionary_buffer.size());
+  } else {
+    out_buffer->Encode(column_buffer.data(), column_buffer.size());
+  }
+  return EncodeOffsets(property.GetArrayOffsets(), out_buffer);
+}
+
+}  // namespace draco
+
+#endif  // DRACO_TRANSCODER_SUPPORTED
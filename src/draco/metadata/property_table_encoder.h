@@ -0,0 +1,60 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_METADATA_PROPERTY_TABLE_ENCODER_H_
+#define DRACO_METADATA_PROPERTY_TABLE_ENCODER_H_
+
+#include "draco/draco_features.h"
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include <string>
+
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/metadata/property_table.h"
+#include "draco/metadata/structural_metadata_schema.h"
+
+namespace draco {
+
+// Class for compressing property tables of the EXT_structural_metadata glTF
+// extension. Each property (column) is coded based on its type in the
+// |schema|:
+//
+//   - Integer components of up to 32 bits are entropy coded, which packs them
+//     into the bits they need. Components are delta coded against the previous
+//     element when this makes the column smaller.
+//   - Strings are dictionary coded when the column contains repeated strings.
+//   - Array and string offsets are coded as entropy coded lengths.
+//   - All other columns are stored as raw bytes.
+//
+// The compressed table can be decoded with PropertyTableDecoder.
+class PropertyTableEncoder {
+ public:
+  PropertyTableEncoder() {}
+
+  Status EncodePropertyTable(const PropertyTable &table,
+                             const StructuralMetadataSchema &schema,
+                             EncoderBuffer *out_buffer);
+
+ private:
+  Status EncodeProperty(const PropertyTable::Property &property,
+                        const StructuralMetadataSchema &schema,
+                        const std::string &class_name,
+                        EncoderBuffer *out_buffer);
+};
+
+}  // namespace draco
+
+#endif  // DRACO_TRANSCODER_SUPPORTED
+#endif  // DRACO_METADATA_PROPERTY_TABLE_ENCODER_H_
@@ -0,0 +1,174 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/metadata/property_table_encoder.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "draco/core/draco_test_utils.h"
+#include "draco/metadata/property_table_decoder.h"
+
+namespace {
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+
+typedef draco::StructuralMetadataSchema::Object Object;
+
+// Adds a schema property |name| of |type| and |component_type| to |properties|.
+Object &AddSchemaProperty(const std::string &name, const std::string &type,
+                          const std::string &component_type,
+                          Object *properties) {
+  properties->SetObjects().emplace_back(name);
+  Object &property = properties->SetObjects().back();
+  property.SetObjects().emplace_back("type", type);
+  if (!component_type.empty()) {
+    property.SetObjects().emplace_back("componentType", component_type);
+  }
+  return property;
+}
+
+// Creates a schema of the "building" class with a UINT16 "height", a string
+// "name", and a variable-length INT8 array "tags".
+draco::StructuralMetadataSchema CreateSchema() {
+  draco::StructuralMetadataSchema schema;
+  schema.json.SetObjects().emplace_back("classes");
+  Object &classes = schema.json.SetObjects().back();
+  classes.SetObjects().emplace_back("building");
+  Object &building = classes.SetObjects().back();
+  building.SetObjects().emplace_back("properties");
+  Object &properties = building.SetObjects().back();
+  AddSchemaProperty("height", "SCALAR", "UINT16", &properties);
+  AddSchemaProperty("name", "STRING", "", &properties);
+  Object &tags = AddSchemaProperty("tags", "SCALAR", "INT8", &properties);
+  tags.SetObjects().emplace_back("array", true);
+  return schema;
+}
+
+// Creates a property table with |count| rows matching CreateSchema().
+std::unique_ptr<draco::PropertyTable> CreateTable(int count) {
+  std::unique_ptr<draco::PropertyTable> table(new draco::PropertyTable());
+  table->SetName("City");
+  table->SetClass("building");
+  table->SetCount(count);
+
+  std::unique_ptr<draco::PropertyTable::Property> height(
+      new draco::PropertyTable::Property());
+  height->SetName("height");
+  height->GetData().target = 34962;
+  for (int i = 0; i < count; ++i) {
+    const uint16_t value = 1000 + 3 * i;
+    height->GetData().data.push_back(value & 0xff);
+    height->GetData().data.push_back(value >> 8);
+  }
+  table->AddProperty(std::move(height));
+
+  const std::string names[] = {"House", "Tower", "Barn"};
+  std::unique_ptr<draco::PropertyTable::Property> name(
+      new draco::PropertyTable::Property());
+  name->SetName("name");
+  std::vector<uint64_t> string_offsets(1, 0);
+  for (int i = 0; i < count; ++i) {
+    const std::string &str = names[i % 3];
+    name->GetData().data.insert(name->GetData().data.end(), str.begin(),
+                                str.end());
+    string_offsets.push_back(name->GetData().data.size());
+  }
+  name->GetStringOffsets() =
+      draco::PropertyTable::Property::Offsets::MakeFromInts(string_offsets);
+  table->AddProperty(std::move(name));
+
+  std::unique_ptr<draco::PropertyTable::Property> tags(
+      new draco::PropertyTable::Property());
+  tags->SetName("tags");
+  std::vector<uint64_t> array_offsets(1, 0);
+  for (int i = 0; i < count; ++i) {
+    for (int j = 0; j < i % 4; ++j) {
+      tags->GetData().data.push_back(static_cast<uint8_t>(j - 2));
+    }
+    array_offsets.push_back(tags->GetData().data.size());
+  }
+  tags->GetArrayOffsets() =
+      draco::PropertyTable::Property::Offsets::MakeFromInts(array_offsets);
+  table->AddProperty(std::move(tags));
+  return table;
+}
+
+// Returns the total size of all property data and offsets of |table|.
+size_t GetRawSize(const draco::PropertyTable &table) {
+  size_t size = 0;
+  for (int i = 0; i < table.NumProperties(); ++i) {
+    const draco::PropertyTable::Property &property = table.GetProperty(i);
+    size += property.GetData().data.size() +
+            property.GetArrayOffsets().data.data.size() +
+            property.GetStringOffsets().data.data.size();
+  }
+  return size;
+}
+
+TEST(PropertyTableEncoderTest, TestEncodeDecode) {
+  // Test that all property table columns are restored by the decoder and that
+  // the encoded table is smaller than the raw column data.
+  const std::unique_ptr<draco::PropertyTable> table = CreateTable(1000);
+  draco::PropertyTableEncoder encoder;
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodePropertyTable(*table, CreateSchema(), &buffer));
+  ASSERT_LT(buffer.size(), GetRawSize(*table) / 4);
+
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  draco::PropertyTableDecoder decoder;
+  draco::PropertyTable decoded_table;
+  DRACO_ASSERT_OK(decoder.DecodePropertyTable(&in_buffer, &decoded_table));
+  ASSERT_TRUE(decoded_table == *table);
+}
+
+TEST(PropertyTableEncoderTest, TestEncodeDecodeWithoutSchema) {
+  // Test that property tables are restored when the columns are not described
+  // by the schema and their data is stored raw.
+  const std::unique_ptr<draco::PropertyTable> table = CreateTable(10);
+  draco::PropertyTableEncoder encoder;
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodePropertyTable(
+      *table, draco::StructuralMetadataSchema(), &buffer));
+
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  draco::PropertyTableDecoder decoder;
+  draco::PropertyTable decoded_table;
+  DRACO_ASSERT_OK(decoder.DecodePropertyTable(&in_buffer, &decoded_table));
+  ASSERT_TRUE(decoded_table == *table);
+}
+
+TEST(PropertyTableEncoderTest, TestDecodeTruncatedData) {
+  // Test that the decoder fails on truncated input.
+  const std::unique_ptr<draco::PropertyTable> table = CreateTable(100);
+  draco::PropertyTableEncoder encoder;
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodePropertyTable(*table, CreateSchema(), &buffer));
+
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size() / 2);
+  draco::PropertyTableDecoder decoder;
+  draco::PropertyTable decoded_table;
+  ASSERT_FALSE(decoder.DecodePropertyTable(&in_buffer, &decoded_table).ok());
+}
+
+#endif  // DRACO_TRANSCODER_SUPPORTED
+
+}  // namespace
@@ -15,8 +15,10 @@
 #include "draco/point_cloud/point_cloud.h"
 
 #include <algorithm>
-#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#include "draco/core/deduplication_utils.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
 #include "draco/attributes/point_attribute.h"
@@ -213,22 +215,70 @@ void PointCloud::DeleteAttribute(int att_id) {
   }
 }
 
+std::unique_ptr<PointAttribute> PointCloud::ReleaseAttribute(int att_id) {
+  if (att_id < 0 || att_id >= num_attributes()) {
+    return nullptr;
+  }
+  // The attribute is replaced by a placeholder with the same type and unique
+  // id that is then deleted, so that derived classes can update their data.
+  std::unique_ptr<PointAttribute> att = std::move(attributes_[att_id]);
+  attributes_[att_id].reset(
+      new PointAttribute(static_cast<const GeometryAttribute &>(*att)));
+  DeleteAttribute(att_id);
+  return att;
+}
+
 #ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
-void PointCloud::DeduplicatePointIds() {
+namespace {
+
+// Returns for each attribute of |pc| the id of the first attribute that shares
+// the same point mapping with it (see PointAttribute::ShareMappingFrom()), or
+// its own id when the mapping is not shared with any previous attribute.
+std::vector<int32_t> FindMappingOwners(const PointCloud &pc) {
+  std::vector<int32_t> owners(pc.num_attributes());
+  for (int32_t i = 0; i < pc.num_attributes(); ++i) {
+    owners[i] = i;
+    for (int32_t j = 0; j < i; ++j) {
+      if (pc.attribute(i)->SharesMappingWith(*pc.attribute(j))) {
+        owners[i] = owners[j];
+        break;
+      }
+    }
+  }
+  return owners;
+}
+
+}  // namespace
+
+void PointCloud::DeduplicatePointIds() { DeduplicatePointIds(nullptr); }
+
+void PointCloud::DeduplicatePointIds(ThreadPool *pool) {
+  // Attributes sharing their mapping with a previous attribute map the points
+  // the same way and they are skipped.
+  const std::vector<int32_t> owners = FindMappingOwners(*this);
+  std::vector<int32_t> att_ids;
+  for (int32_t i = 0; i < num_attributes(); ++i) {
+    if (owners[i] == i) {
+      att_ids.push_back(i);
+    }
+  }
   // Hashing function for a single vertex.
-  auto point_hash = [this](PointIndex p) {
-    PointIndex::ValueType hash = 0;
-    for (int32_t i = 0; i < this->num_attributes(); ++i) {
-      const AttributeValueIndex att_id = attribute(i)->mapped_index(p);
-      hash = static_cast<uint32_t>(HashCombine(att_id.value(), hash));
+  auto point_hash = [this, &att_ids](uint32_t p) {
+    uint64_t hash = 0;
+    for (const int32_t i : att_ids) {
+      const AttributeValueIndex att_id =
+          attribute(i)->mapped_index(PointIndex(p));
+      hash = HashMix(hash, att_id.value());
     }
     return hash;
   };
   // Comparison function between two vertices.
-  auto point_compare = [this](PointIndex p0, PointIndex p1) {
-    for (int32_t i = 0; i < this->num_attributes(); ++i) {
-      const AttributeValueIndex att_id0 = attribute(i)->mapped_index(p0);
-      const AttributeValueIndex att_id1 = attribute(i)->mapped_index(p1);
+  auto point_compare = [this, &att_ids](uint32_t p0, uint32_t p1) {
+    for (const int32_t i : att_ids) {
+      const AttributeValueIndex att_id0 =
+          attribute(i)->mapped_index(PointIndex(p0));
+      const AttributeValueIndex att_id1 =
+          attribute(i)->mapped_index(PointIndex(p1));
       if (att_id0 != att_id1) {
         return false;
       }
@@ -236,19 +286,19 @@ void PointCloud::DeduplicatePointIds() {
     return true;
   };
 
-  std::unordered_map<PointIndex, PointIndex, decltype(point_hash),
-                     decltype(point_compare)>
-      unique_point_map(num_points_, point_hash, point_compare);
+  // Index of the first point equal to each point.
+  std::vector<uint32_t> first_occurrence;
+  FindFirstOccurrences(num_points_, point_hash, point_compare, pool,
+                       &first_occurrence);
   int32_t num_unique_points = 0;
   IndexTypeVector<PointIndex, PointIndex> index_map(num_points_);
   std::vector<PointIndex> unique_points;
-  // Go through all vertices and find their duplicates.
+  // Go through all vertices and map their duplicates.
   for (PointIndex i(0); i < num_points_; ++i) {
-    const auto it = unique_point_map.find(i);
-    if (it != unique_point_map.end()) {
-      index_map[i] = it->second;
+    const uint32_t first = first_occurrence[i.value()];
+    if (first != i.value()) {
+      index_map[i] = index_map[PointIndex(first)];
     } else {
-      unique_point_map.insert(std::make_pair(i, PointIndex(num_unique_points)));
       index_map[i] = num_unique_points++;
       unique_points.push_back(i);
     }
@@ -264,34 +314,55 @@ void PointCloud::DeduplicatePointIds() {
 void PointCloud::ApplyPointIdDeduplication(
     const IndexTypeVector<PointIndex, PointIndex> &id_map,
     const std::vector<PointIndex> &unique_point_ids) {
+  // Shared mappings are released from all but one attribute so that they are
+  // updated in place only once and shared again afterwards.
+  const std::vector<int32_t> owners = FindMappingOwners(*this);
+  std::vector<int32_t> att_ids;
+  for (int32_t a = 0; a < num_attributes(); ++a) {
+    if (owners[a] == a) {
+      att_ids.push_back(a);
+    } else {
+      attribute(a)->SetIdentityMapping();
+    }
+  }
   int32_t num_unique_points = 0;
   for (PointIndex i : unique_point_ids) {
     const PointIndex new_point_id = id_map[i];
     if (new_point_id >= num_unique_points) {
       // New unique vertex reached. Copy attribute indices to the proper
       // position.
-      for (int32_t a = 0; a < num_attributes(); ++a) {
+      for (const int32_t a : att_ids) {
         attribute(a)->SetPointMapEntry(new_point_id,
                                        attribute(a)->mapped_index(i));
       }
       num_unique_points = new_point_id.value() + 1;
     }
   }
-  for (int32_t a = 0; a < num_attributes(); ++a) {
+  for (const int32_t a : att_ids) {
     attribute(a)->SetExplicitMapping(num_unique_points);
   }
+  for (int32_t a = 0; a < num_attributes(); ++a) {
+    if (owners[a] != a) {
+      attribute(a)->ShareMappingFrom(*attribute(owners[a]));
+    }
+  }
 }
 #endif
 
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
 bool PointCloud::DeduplicateAttributeValues() {
+  return DeduplicateAttributeValues(nullptr);
+}
+
+bool PointCloud::DeduplicateAttributeValues(ThreadPool *pool) {
   // Go over all attributes and create mapping between duplicate entries.
   if (num_points() == 0) {
     return true;  // Nothing to deduplicate.
   }
   // Deduplicate all attributes.
   for (int32_t att_id = 0; att_id < num_attributes(); ++att_id) {
-    if (!attribute(att_id)->DeduplicateValues(*attribute(att_id))) {
+    if (!attribute(att_id)->DeduplicateValues(
+            *attribute(att_id), AttributeValueIndex(0), pool)) {
       return false;
     }
   }
@@ -299,14 +370,52 @@ bool PointCloud::DeduplicateAttributeValues() {
 }
 #endif
 
+MemoryFootprint PointCloud::MemoryUsage() const {
+  MemoryFootprint usage;
+  for (const auto &att : attributes_) {
+    if (att != nullptr) {
+      usage += att->MemoryUsage();
+    }
+  }
+  if (metadata_ != nullptr) {
+    usage.metadata = metadata_->ComputeMemoryUsage();
+  }
+  return usage;
+}
+
+void PointCloud::ShrinkToFit() {
+  for (const auto &att : attributes_) {
+    if (att != nullptr) {
+      att->ShrinkToFit();
+    }
+  }
+}
+
 // TODO(b/199760503): Consider to cache the BBox.
 BoundingBox PointCloud::ComputeBoundingBox() const {
+  return ComputeBoundingBox(nullptr);
+}
+
+BoundingBox PointCloud::ComputeBoundingBox(ThreadPool *pool) const {
   BoundingBox bounding_box;
   auto pc_att = GetNamedAttribute(GeometryAttribute::POSITION);
   if (pc_att == nullptr) {
     // Return default invalid bounding box.
     return bounding_box;
   }
+  if (pc_att->data_type() == DT_FLOAT32 && pc_att->num_components() == 3) {
+    std::vector<float> min_values;
+    std::vector<float> max_values;
+    if (pc_att->ComputeValueRange(pool, &min_values, &max_values)) {
+      if (pc_att->size() == 0) {
+        return bounding_box;
+      }
+      return BoundingBox(
+          Vector3f(min_values[0], min_values[1], min_values[2]),
+          Vector3f(max_values[0], max_values[1], max_values[2]));
+    }
+    // Positions with NaN values are handled by the loop below.
+  }
 
   // TODO(b/199760503): Make the BoundingBox a template type, it may not be easy
   // because PointCloud is not a template.
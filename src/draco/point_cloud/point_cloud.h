@@ -17,6 +17,7 @@
 
 #include "draco/attributes/point_attribute.h"
 #include "draco/core/bounding_box.h"
+#include "draco/core/memory_footprint.h"
 #include "draco/core/vector_d.h"
 #include "draco/draco_features.h"
 #include "draco/metadata/geometry_metadata.h"
@@ -122,21 +123,38 @@ class PointCloud {
   // attribute ids of all subsequent attributes.
   virtual void DeleteAttribute(int att_id);
 
+  // Removes an attribute like DeleteAttribute() but returns it instead of
+  // destroying it. Returns nullptr when the attribute does not exist.
+  std::unique_ptr<PointAttribute> ReleaseAttribute(int att_id);
+
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
   // Deduplicates all attribute values (all attribute entries with the same
   // value are merged into a single entry).
   virtual bool DeduplicateAttributeValues();
+
+  // Same as above but the attribute values are deduplicated in parallel using
+  // |pool|. The result is the same as when no |pool| is used.
+  bool DeduplicateAttributeValues(ThreadPool *pool);
 #endif
 
 #ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
   // Removes duplicate point ids (two point ids are duplicate when all of their
   // attributes are mapped to the same entry ids).
   virtual void DeduplicatePointIds();
+
+  // Same as above but duplicate points are searched for in parallel using
+  // |pool|. The result is the same as when no |pool| is used.
+  void DeduplicatePointIds(ThreadPool *pool);
 #endif
 
   // Get bounding box.
   BoundingBox ComputeBoundingBox() const;
 
+  // Same as above but the bounding box is computed in parallel using |pool|.
+  // The range of the position values is cached on the attribute until it is
+  // modified.
+  BoundingBox ComputeBoundingBox(ThreadPool *pool) const;
+
   // Add metadata.
   void AddMetadata(std::unique_ptr<GeometryMetadata> metadata) {
     metadata_ = std::move(metadata);
@@ -199,6 +217,14 @@ class PointCloud {
   // cloud.
   void set_num_points(PointIndex::ValueType num) { num_points_ = num; }
 
+  // Returns the number of bytes allocated by the attributes and the metadata
+  // of the geometry, see MemoryFootprint.
+  virtual MemoryFootprint MemoryUsage() const;
+
+  // Releases unused capacity of the attributes and of other geometry data,
+  // see PointAttribute::ShrinkToFit().
+  virtual void ShrinkToFit();
+
 #ifdef DRACO_TRANSCODER_SUPPORTED
   // Enables or disables Draco geometry compression for this mesh.
   void SetCompressionEnabled(bool enabled) { compression_enabled_ = enabled; }
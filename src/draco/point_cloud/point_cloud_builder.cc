@@ -14,6 +14,7 @@
 //
 #include "draco/point_cloud/point_cloud_builder.h"
 
+#include <cstring>
 #include <string>
 #include <utility>
 
@@ -49,34 +50,50 @@ void PointCloudBuilder::SetAttributeValueForPoint(int att_id,
 
 void PointCloudBuilder::SetAttributeValuesForAllPoints(
     int att_id, const void *attribute_values, int stride) {
+  SetAttributeValuesForPoints(att_id, PointIndex(0),
+                              point_cloud_->num_points(), attribute_values,
+                              stride);
+}
+
+void PointCloudBuilder::SetAttributeValuesForPoints(
+    int att_id, PointIndex first_point, PointIndex::ValueType num_points,
+    const void *attribute_values, int stride) {
   PointAttribute *const att = point_cloud_->attribute(att_id);
   const int data_stride =
       DataTypeLength(att->data_type()) * att->num_components();
   if (stride == 0) {
     stride = data_stride;
   }
+  // All attributes of the builder use identity mapping, so the values of
+  // consecutive points are stored next to each other.
+  uint8_t *const dst =
+      att->buffer()->data() + first_point.value() * data_stride;
+  const uint8_t *const src = static_cast<const uint8_t *>(attribute_values);
   if (stride == data_stride) {
     // Fast copy path.
-    att->buffer()->Write(0, attribute_values,
-                         point_cloud_->num_points() * data_stride);
+    memcpy(dst, src, static_cast<size_t>(num_points) * data_stride);
   } else {
     // Copy attribute entries one by one.
-    for (PointIndex i(0); i < point_cloud_->num_points(); ++i) {
-      att->SetAttributeValue(
-          att->mapped_index(i),
-          static_cast<const uint8_t *>(attribute_values) + stride * i.value());
+    for (PointIndex::ValueType i = 0; i < num_points; ++i) {
+      memcpy(dst + static_cast<size_t>(i) * data_stride,
+             src + static_cast<size_t>(i) * stride, data_stride);
     }
   }
 }
 
 std::unique_ptr<PointCloud> PointCloudBuilder::Finalize(
     bool deduplicate_points) {
+  return Finalize(deduplicate_points, nullptr);
+}
+
+std::unique_ptr<PointCloud> PointCloudBuilder::Finalize(
+    bool deduplicate_points, ThreadPool *pool) {
   if (deduplicate_points) {
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
-    point_cloud_->DeduplicateAttributeValues();
+    point_cloud_->DeduplicateAttributeValues(pool);
 #endif
 #ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
-    point_cloud_->DeduplicatePointIds();
+    point_cloud_->DeduplicatePointIds(pool);
 #endif
   }
   return std::move(point_cloud_);
@@ -67,6 +67,14 @@ class PointCloudBuilder {
   void SetAttributeValuesForAllPoints(int att_id, const void *attribute_values,
                                       int stride);
 
+  // Same as above but only |num_points| values of consecutive points starting
+  // at |first_point| are set. The values are written directly into the
+  // attribute buffer, which makes this much faster than setting the values of
+  // the points one by one, e.g. when the input data is read in chunks.
+  void SetAttributeValuesForPoints(int att_id, PointIndex first_point,
+                                   PointIndex::ValueType num_points,
+                                   const void *attribute_values, int stride);
+
   // Sets the unique ID for an attribute created with AddAttribute().
   void SetAttributeUniqueId(int att_id, uint32_t unique_id);
 
@@ -86,6 +94,11 @@ class PointCloudBuilder {
   // used until the method Start() is called again.
   std::unique_ptr<PointCloud> Finalize(bool deduplicate_points);
 
+  // Same as above but the deduplication runs in parallel on |pool| (can be
+  // nullptr). The result is the same as when no |pool| is used.
+  std::unique_ptr<PointCloud> Finalize(bool deduplicate_points,
+                                       ThreadPool *pool);
+
   // Add metadata for an attribute.
   void AddAttributeMetadata(int32_t att_id,
                             std::unique_ptr<AttributeMetadata> metadata) {
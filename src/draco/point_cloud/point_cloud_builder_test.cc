@@ -118,6 +118,41 @@ TEST_F(PointCloudBuilderTest, BatchTest) {
   }
 }
 
+TEST_F(PointCloudBuilderTest, BatchRangeTest) {
+  // This test verifies that PointCloudBuilder can construct point cloud using
+  // SetAttributeValuesForPoints API with strided input and that the parallel
+  // deduplication gives the same result as the serial one.
+  std::unique_ptr<PointCloud> res[2];
+  ThreadPool pool(2);
+  for (int r = 0; r < 2; ++r) {
+    PointCloudBuilder builder;
+    builder.Start(10);
+    const int pos_att_id =
+        builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+    // Interleave the positions with padding.
+    std::vector<float> interleaved(4 * 10);
+    for (int i = 0; i < 10; ++i) {
+      for (int c = 0; c < 3; ++c) {
+        interleaved[4 * i + c] = pos_data_[3 * i + c];
+      }
+    }
+    builder.SetAttributeValuesForPoints(pos_att_id, PointIndex(0), 6,
+                                        interleaved.data(), 4 * sizeof(float));
+    builder.SetAttributeValuesForPoints(pos_att_id, PointIndex(6), 4,
+                                        pos_data_.data() + 3 * 6, 0);
+    res[r] = builder.Finalize(false, r == 0 ? nullptr : &pool);
+    ASSERT_TRUE(res[r] != nullptr);
+    ASSERT_EQ(res[r]->num_points(), 10);
+    for (PointIndex i(0); i < 10; ++i) {
+      float pos_val[3];
+      res[r]->attribute(pos_att_id)->GetMappedValue(i, pos_val);
+      for (int c = 0; c < 3; ++c) {
+        ASSERT_EQ(pos_val[c], pos_data_[3 * i.value() + c]);
+      }
+    }
+  }
+}
+
 TEST_F(PointCloudBuilderTest, MultiUse) {
   // This test verifies that PointCloudBuilder can be used multiple times
   PointCloudBuilder builder;
@@ -14,11 +14,13 @@
 //
 #include "draco/point_cloud/point_cloud.h"
 
+#include <cstring>
 #include <string>
 #include <utility>
 
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/core/thread_pool.h"
 #include "draco/metadata/geometry_metadata.h"
 
 namespace {
@@ -248,4 +250,89 @@ TEST_F(PointCloudTest, TestPointCloudWithMetadata) {
   ASSERT_NE(pc.GetAttributeMetadataByAttributeId(0), nullptr);
 }
 
+#if defined(DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED) && \
+    defined(DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED)
+TEST_F(PointCloudTest, TestDeduplicationOnThreadPool) {
+  // Tests that deduplication on a thread pool produces the same point cloud
+  // as the single-threaded deduplication.
+  const int num_points = 200000;
+  draco::PointCloud pcs[2];
+  for (draco::PointCloud &pc : pcs) {
+    pc.set_num_points(num_points);
+    draco::GeometryAttribute pos_att;
+    pos_att.Init(draco::GeometryAttribute::POSITION, nullptr, 3,
+                 draco::DT_FLOAT32, false, sizeof(float) * 3, 0);
+    draco::GeometryAttribute gen_att;
+    gen_att.Init(draco::GeometryAttribute::GENERIC, nullptr, 1,
+                 draco::DT_UINT16, false, sizeof(uint16_t), 0);
+    const int pos_id = pc.AddAttribute(pos_att, true, num_points);
+    const int gen_id = pc.AddAttribute(gen_att, true, num_points);
+    for (draco::AttributeValueIndex i(0); i < num_points; ++i) {
+      const float pos[3] = {static_cast<float>(i.value() % 1000), 1.f,
+                            static_cast<float>(i.value() % 50)};
+      const uint16_t gen = i.value() % 3;
+      pc.attribute(pos_id)->SetAttributeValue(i, pos);
+      pc.attribute(gen_id)->SetAttributeValue(i, &gen);
+    }
+  }
+  draco::ThreadPool pool(4);
+  ASSERT_TRUE(pcs[0].DeduplicateAttributeValues());
+  pcs[0].DeduplicatePointIds();
+  ASSERT_TRUE(pcs[1].DeduplicateAttributeValues(&pool));
+  pcs[1].DeduplicatePointIds(&pool);
+
+  ASSERT_LT(pcs[0].num_points(), num_points);
+  ASSERT_EQ(pcs[0].num_points(), pcs[1].num_points());
+  for (int a = 0; a < pcs[0].num_attributes(); ++a) {
+    const draco::PointAttribute *const att0 = pcs[0].attribute(a);
+    const draco::PointAttribute *const att1 = pcs[1].attribute(a);
+    ASSERT_EQ(att0->size(), att1->size());
+    ASSERT_EQ(memcmp(att0->buffer()->data(), att1->buffer()->data(),
+                     att0->size() * att0->byte_stride()),
+              0);
+    for (draco::PointIndex pi(0); pi < pcs[0].num_points(); ++pi) {
+      ASSERT_EQ(att0->mapped_index(pi), att1->mapped_index(pi));
+    }
+  }
+}
+
+TEST_F(PointCloudTest, TestDeduplicationWithSharedMapping) {
+  // Tests that attributes sharing their point mapping still share it after the
+  // duplicate points are removed.
+  const int num_points = 6;
+  draco::PointCloud pc;
+  pc.set_num_points(num_points);
+  int att_ids[3];
+  for (int a = 0; a < 3; ++a) {
+    draco::GeometryAttribute att;
+    att.Init(draco::GeometryAttribute::GENERIC, nullptr, 1, draco::DT_UINT8,
+             false, sizeof(uint8_t), 0);
+    att_ids[a] = pc.AddAttribute(att, false, 3);
+  }
+  // Points 3, 4 and 5 duplicate points 0, 1 and 2 in all attributes except
+  // point 5 whose value of the last attribute differs.
+  for (draco::PointIndex pi(0); pi < num_points; ++pi) {
+    pc.attribute(att_ids[0])
+        ->SetPointMapEntry(pi, draco::AttributeValueIndex(pi.value() % 3));
+    pc.attribute(att_ids[2])
+        ->SetPointMapEntry(pi, draco::AttributeValueIndex(
+                                   pi.value() == 5 ? 0 : pi.value() % 3));
+  }
+  pc.attribute(att_ids[1])->ShareMappingFrom(*pc.attribute(att_ids[0]));
+
+  pc.DeduplicatePointIds();
+  ASSERT_EQ(pc.num_points(), 4);
+  ASSERT_TRUE(
+      pc.attribute(att_ids[1])->SharesMappingWith(*pc.attribute(att_ids[0])));
+  for (draco::PointIndex pi(0); pi < pc.num_points(); ++pi) {
+    ASSERT_EQ(pc.attribute(att_ids[1])->mapped_index(pi),
+              pc.attribute(att_ids[0])->mapped_index(pi));
+  }
+  ASSERT_EQ(pc.attribute(att_ids[0])->mapped_index(draco::PointIndex(3)),
+            draco::AttributeValueIndex(2));
+  ASSERT_EQ(pc.attribute(att_ids[2])->mapped_index(draco::PointIndex(3)),
+            draco::AttributeValueIndex(0));
+}
+#endif
+
 }  // namespace
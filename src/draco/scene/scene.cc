@@ -18,6 +18,9 @@
 #include <utility>
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <atomic>
+#include <vector>
+
 #include "draco/core/macros.h"
 #include "draco/scene/scene_indices.h"
 
@@ -26,11 +29,17 @@ namespace draco {
 Scene::Scene() { metadata_.reset(new Metadata()); }
 
 void Scene::Copy(const Scene &s) {
+  // The copied hierarchy has the same transforms.
+  std::atomic_store(&node_transforms_, std::atomic_load(&s.node_transforms_));
   meshes_.resize(s.meshes_.size());
   for (MeshIndex i(0); i < meshes_.size(); ++i) {
     meshes_[i] = std::unique_ptr<Mesh>(new Mesh());
     meshes_[i]->Copy(*s.meshes_[i]);
   }
+  mesh_revisions_.resize(meshes_.size());
+  for (MeshIndex i(0); i < meshes_.size(); ++i) {
+    mesh_revisions_[i] = NewRevision();
+  }
 
   mesh_groups_.resize(s.mesh_groups_.size());
   for (MeshGroupIndex i(0); i < mesh_groups_.size(); ++i) {
@@ -98,14 +107,98 @@ void Scene::Copy(const Scene &s) {
   metadata_.reset(new Metadata(*s.metadata_));
 }
 
+std::shared_ptr<const SceneNodeTransforms> Scene::GetNodeTransforms() const {
+  std::shared_ptr<const SceneNodeTransforms> cached =
+      std::atomic_load(&node_transforms_);
+  if (cached != nullptr) {
+    return cached;
+  }
+  std::shared_ptr<SceneNodeTransforms> transforms(new SceneNodeTransforms());
+
+  // Traverse the hierarchy from each root node.
+  std::vector<std::pair<SceneNodeIndex, Eigen::Matrix4d>,
+              Eigen::aligned_allocator<
+                  std::pair<SceneNodeIndex, Eigen::Matrix4d>>>
+      stack;
+  for (const SceneNodeIndex &root_index : root_node_indices_) {
+    stack.push_back({root_index, Eigen::Matrix4d::Identity()});
+    while (!stack.empty()) {
+      const SceneNodeIndex node_index = stack.back().first;
+      const SceneNode &node = *nodes_[node_index];
+      const Eigen::Matrix4d transform =
+          stack.back().second *
+          node.GetTrsMatrix().ComputeTransformationMatrix();
+      stack.pop_back();
+      transforms->visited_nodes.push_back(node_index);
+      transforms->visit_transforms.push_back(transform);
+      for (int i = 0; i < node.NumChildren(); ++i) {
+        stack.push_back({node.Child(i), transform});
+      }
+    }
+  }
+
+  // Compute the global transform of each node only once, walking up the
+  // chain of single parents until a node with a known transform is found.
+  transforms->global_transforms.resize(nodes_.size());
+  std::vector<bool> is_computed(nodes_.size(), false);
+  std::vector<SceneNodeIndex> chain;
+  for (SceneNodeIndex i(0); i < nodes_.size(); ++i) {
+    SceneNodeIndex index = i;
+    while (index != kInvalidSceneNodeIndex && !is_computed[index.value()]) {
+      chain.push_back(index);
+      const SceneNode &node = *nodes_[index];
+      index = node.NumParents() == 1 ? node.Parent(0) : kInvalidSceneNodeIndex;
+    }
+    Eigen::Matrix4d transform =
+        index == kInvalidSceneNodeIndex
+            ? Eigen::Matrix4d::Identity()
+            : transforms->global_transforms[index.value()];
+    while (!chain.empty()) {
+      const SceneNodeIndex node_index = chain.back();
+      chain.pop_back();
+      transform =
+          transform *
+          nodes_[node_index]->GetTrsMatrix().ComputeTransformationMatrix();
+      transforms->global_transforms[node_index.value()] = transform;
+      is_computed[node_index.value()] = true;
+    }
+  }
+
+  cached = transforms;
+  std::atomic_store(&node_transforms_, cached);
+  return cached;
+}
+
+MemoryFootprint Scene::MemoryUsage() const {
+  MemoryFootprint usage;
+  for (MeshIndex i(0); i < meshes_.size(); ++i) {
+    usage += meshes_[i]->MemoryUsage();
+  }
+  usage.textures +=
+      material_library_.GetTextureLibrary().ComputeMemoryUsage() +
+      non_material_texture_library_.ComputeMemoryUsage();
+  usage.metadata += metadata_->ComputeMemoryUsage();
+  return usage;
+}
+
+void Scene::ShrinkToFit() {
+  for (MeshIndex i(0); i < meshes_.size(); ++i) {
+    meshes_[i]->ShrinkToFit();
+  }
+  material_library_.MutableTextureLibrary().ShrinkToFit();
+  non_material_texture_library_.ShrinkToFit();
+}
+
 Status Scene::RemoveMesh(MeshIndex index) {
   // Remove base mesh at |index| from |meshes_| and corresponding material index
   // from |mesh_material_indices_|.
   const int new_num_meshes = meshes_.size() - 1;
   for (MeshIndex i(index); i < new_num_meshes; i++) {
     meshes_[i] = std::move(meshes_[i + 1]);
+    mesh_revisions_[i] = mesh_revisions_[i + 1];
   }
   meshes_.resize(new_num_meshes);
+  mesh_revisions_.resize(new_num_meshes);
 
   // Remove references to removed base mesh and corresponding materials from
   // mesh groups, and update references to remaining base meshes in mesh groups.
@@ -175,6 +268,11 @@ Status Scene::RemoveMaterial(int index) {
   return OkStatus();
 }
 
+uint64_t Scene::NewRevision() {
+  static std::atomic<uint64_t> last_revision(0);
+  return ++last_revision;
+}
+
 }  // namespace draco
 
 #endif  // DRACO_TRANSCODER_SUPPORTED
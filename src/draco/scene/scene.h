@@ -19,6 +19,7 @@
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
 #include <memory>
+#include <vector>
 
 #include "draco/animation/animation.h"
 #include "draco/animation/skin.h"
@@ -33,6 +34,24 @@
 
 namespace draco {
 
+// Flattened node hierarchy of a scene with precomputed transforms. See
+// Scene::GetNodeTransforms().
+struct SceneNodeTransforms {
+  // Nodes in the order of depth-first traversals from each of the root nodes,
+  // in which the children of a node are visited in reverse order. Nodes that
+  // can be reached over several paths are visited once per path.
+  std::vector<SceneNodeIndex> visited_nodes;
+  // Transforms from the local space of |visited_nodes| to the space of the
+  // root node of each traversal.
+  std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d>>
+      visit_transforms;
+  // Transforms from the local space of each node to the scene space computed
+  // by following the parents of nodes with exactly one parent, see
+  // SceneUtils::ComputeGlobalNodeTransform().
+  std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d>>
+      global_transforms;
+};
+
 // Class used to hold all of the geometry to create a scene. A scene is
 // comprised of one or more meshes, one or more scene nodes, one or more
 // mesh groups, and a material library. The meshes are defined in their
@@ -53,6 +72,7 @@ class Scene {
       return kInvalidMeshIndex;
     }
     meshes_.push_back(std::move(mesh));
+    mesh_revisions_.push_back(NewRevision());
     return MeshIndex(meshes_.size() - 1);
   }
 
@@ -65,10 +85,28 @@ class Scene {
   int NumMeshes() const { return meshes_.size(); }
 
   // Returns a mesh in the scene before instancing is applied. The mesh
-  // coordinates are local to the mesh.
-  Mesh &GetMesh(MeshIndex index) { return *meshes_[index]; }
+  // coordinates are local to the mesh. The non-const accessor marks the mesh
+  // as modified, see GetMeshRevision().
+  Mesh &GetMesh(MeshIndex index) {
+    MarkMeshModified(index);
+    return *meshes_[index];
+  }
   const Mesh &GetMesh(MeshIndex index) const { return *meshes_[index]; }
 
+  // Returns the revision of the mesh at |index|. Revisions are unique within
+  // the process and a new one is assigned whenever the mesh is added, copied,
+  // accessed over the non-const GetMesh(), or marked as modified, so an
+  // unchanged revision means that the mesh was not modified. Used, e.g., by
+  // GltfEncoder to reuse the compressed data of unchanged meshes. Meshes
+  // modified over references that were obtained before the last call must be
+  // marked with MarkMeshModified().
+  uint64_t GetMeshRevision(MeshIndex index) const {
+    return mesh_revisions_[index];
+  }
+  void MarkMeshModified(MeshIndex index) {
+    mesh_revisions_[index] = NewRevision();
+  }
+
   // Creates a mesh group and returns the index to the mesh group.
   MeshGroupIndex AddMeshGroup() {
     std::unique_ptr<MeshGroup> mesh(new MeshGroup());
@@ -99,6 +137,7 @@ class Scene {
 
   // Creates a scene node and returns the index to the node.
   SceneNodeIndex AddNode() {
+    InvalidateNodeTransforms();
     std::unique_ptr<SceneNode> node(new SceneNode());
     nodes_.push_back(std::move(node));
     return SceneNodeIndex(nodes_.size() - 1);
@@ -108,7 +147,10 @@ class Scene {
   int NumNodes() const { return nodes_.size(); }
 
   // Returns a node in the scene.
-  SceneNode *GetNode(SceneNodeIndex index) { return nodes_[index].get(); }
+  SceneNode *GetNode(SceneNodeIndex index) {
+    InvalidateNodeTransforms();
+    return nodes_[index].get();
+  }
   const SceneNode *GetNode(SceneNodeIndex index) const {
     return nodes_[index].get();
   }
@@ -116,6 +158,7 @@ class Scene {
   // Either allocates new nodes or removes existing nodes that are beyond
   // |num_nodes|.
   void ResizeNodes(int num_nodes) {
+    InvalidateNodeTransforms();
     const size_t old_num_nodes = nodes_.size();
     nodes_.resize(num_nodes);
     for (SceneNodeIndex i(old_num_nodes); i < num_nodes; ++i) {
@@ -130,12 +173,31 @@ class Scene {
     return root_node_indices_;
   }
   void AddRootNodeIndex(SceneNodeIndex index) {
+    InvalidateNodeTransforms();
     root_node_indices_.push_back(index);
   }
   void SetRootNodeIndex(int i, SceneNodeIndex index) {
+    InvalidateNodeTransforms();
     root_node_indices_[i] = index;
   }
-  void RemoveAllRootNodeIndices() { root_node_indices_.clear(); }
+  void RemoveAllRootNodeIndices() {
+    InvalidateNodeTransforms();
+    root_node_indices_.clear();
+  }
+
+  // Returns the flattened node hierarchy of the scene. It is computed on the
+  // first call and cached until the hierarchy may change, i.e. until any of
+  // the non-const accessors of nodes or root nodes is used. Modifications of
+  // nodes over pointers that were obtained before the last call must be
+  // followed by InvalidateNodeTransforms(). The function can be called
+  // concurrently.
+  std::shared_ptr<const SceneNodeTransforms> GetNodeTransforms() const;
+
+  // Discards the cached node hierarchy.
+  void InvalidateNodeTransforms() {
+    std::atomic_store(&node_transforms_,
+                      std::shared_ptr<const SceneNodeTransforms>());
+  }
 
   const MaterialLibrary &GetMaterialLibrary() const {
     return material_library_;
@@ -225,8 +287,20 @@ class Scene {
   const Metadata &GetMetadata() const { return *metadata_; }
   Metadata &GetMetadata() { return *metadata_; }
 
+  // Returns the number of bytes allocated by all base meshes, the textures
+  // and the metadata of the scene, see MemoryFootprint. Animations, skins and
+  // other scene objects are not included.
+  MemoryFootprint MemoryUsage() const;
+
+  // Releases unused capacity of all base meshes and textures of the scene.
+  void ShrinkToFit();
+
  private:
+  // Returns a new mesh revision.
+  static uint64_t NewRevision();
+
   IndexTypeVector<MeshIndex, std::unique_ptr<Mesh>> meshes_;
+  IndexTypeVector<MeshIndex, uint64_t> mesh_revisions_;
   IndexTypeVector<MeshGroupIndex, std::unique_ptr<MeshGroup>> mesh_groups_;
   IndexTypeVector<SceneNodeIndex, std::unique_ptr<SceneNode>> nodes_;
   std::vector<SceneNodeIndex> root_node_indices_;
@@ -258,6 +332,9 @@ class Scene {
   // General metadata associated with the scene (not related to the
   // EXT_structural_metadata extension).
   std::unique_ptr<Metadata> metadata_;
+
+  // Cached result of GetNodeTransforms(), accessed atomically.
+  mutable std::shared_ptr<const SceneNodeTransforms> node_transforms_;
 };
 
 }  // namespace draco
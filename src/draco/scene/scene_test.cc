@@ -313,6 +313,40 @@ TEST(SceneTest, TestCopyWithMetadata) {
   ASSERT_EQ(int_val, 101);
 }
 
+TEST(SceneTest, TestMeshRevisions) {
+  // Tests that mesh revisions change when meshes may have been modified.
+  draco::Scene scene;
+  const draco::MeshIndex index_0 =
+      scene.AddMesh(std::unique_ptr<draco::Mesh>(new draco::Mesh()));
+  const draco::MeshIndex index_1 =
+      scene.AddMesh(std::unique_ptr<draco::Mesh>(new draco::Mesh()));
+  const uint64_t revision_0 = scene.GetMeshRevision(index_0);
+  const uint64_t revision_1 = scene.GetMeshRevision(index_1);
+  ASSERT_NE(revision_0, revision_1);
+
+  // Const access keeps the revision.
+  const draco::Scene &const_scene = scene;
+  const_scene.GetMesh(index_0);
+  ASSERT_EQ(scene.GetMeshRevision(index_0), revision_0);
+
+  // Non-const access and marking the mesh change the revision.
+  scene.GetMesh(index_0);
+  const uint64_t new_revision_0 = scene.GetMeshRevision(index_0);
+  ASSERT_NE(new_revision_0, revision_0);
+  scene.MarkMeshModified(index_0);
+  ASSERT_NE(scene.GetMeshRevision(index_0), new_revision_0);
+  ASSERT_EQ(scene.GetMeshRevision(index_1), revision_1);
+
+  // Revisions move with the meshes when a mesh is removed.
+  DRACO_ASSERT_OK(scene.RemoveMesh(index_0));
+  ASSERT_EQ(scene.GetMeshRevision(draco::MeshIndex(0)), revision_1);
+
+  // Copied meshes get new revisions.
+  draco::Scene copy;
+  copy.Copy(scene);
+  ASSERT_NE(copy.GetMeshRevision(draco::MeshIndex(0)), revision_1);
+}
+
 #endif  // DRACO_TRANSCODER_SUPPORTED
 
 }  // namespace
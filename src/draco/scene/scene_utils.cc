@@ -16,16 +16,19 @@
 #include "draco/scene/scene_utils.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <map>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "draco/core/draco_index_type_vector.h"
 #include "draco/core/hash_utils.h"
 #include "draco/core/vector_d.h"
+#include "draco/mesh/mesh_are_equivalent.h"
 #include "draco/mesh/mesh_splitter.h"
 #include "draco/mesh/mesh_utils.h"
 #include "draco/scene/scene_indices.h"
@@ -35,14 +38,24 @@ namespace draco {
 
 IndexTypeVector<MeshInstanceIndex, SceneUtils::MeshInstance>
 SceneUtils::ComputeAllInstances(const Scene &scene) {
+  // The traversal of the scene hierarchy is cached by the scene.
+  const std::shared_ptr<const SceneNodeTransforms> transforms =
+      scene.GetNodeTransforms();
   IndexTypeVector<MeshInstanceIndex, MeshInstance> instances;
-  for (int i = 0; i < scene.NumRootNodes(); ++i) {
-    const auto node_instances =
-        ComputeAllInstancesFromNode(scene, scene.GetRootNodeIndex(i));
-    const size_t old_size = instances.size();
-    instances.resize(instances.size() + node_instances.size());
-    for (MeshInstanceIndex mii(0); mii < node_instances.size(); ++mii) {
-      instances[mii + old_size] = node_instances[mii];
+  for (int vi = 0; vi < transforms->visited_nodes.size(); ++vi) {
+    const SceneNodeIndex node_index = transforms->visited_nodes[vi];
+    const MeshGroupIndex mesh_group_index =
+        scene.GetNode(node_index)->GetMeshGroupIndex();
+    if (mesh_group_index == kInvalidMeshGroupIndex) {
+      continue;
+    }
+    const MeshGroup &mesh_group = *scene.GetMeshGroup(mesh_group_index);
+    for (int i = 0; i < mesh_group.NumMeshInstances(); i++) {
+      const MeshIndex mesh_index = mesh_group.GetMeshInstance(i).mesh_index;
+      if (mesh_index != kInvalidMeshIndex) {
+        instances.push_back(
+            {mesh_index, node_index, i, transforms->visit_transforms[vi]});
+      }
     }
   }
   return instances;
@@ -94,6 +107,12 @@ SceneUtils::ComputeAllInstancesFromNode(const Scene &scene,
 
 Eigen::Matrix4d SceneUtils::ComputeGlobalNodeTransform(const Scene &scene,
                                                        SceneNodeIndex index) {
+  const std::shared_ptr<const SceneNodeTransforms> transforms =
+      scene.GetNodeTransforms();
+  if (index != kInvalidSceneNodeIndex &&
+      index.value() < transforms->global_transforms.size()) {
+    return transforms->global_transforms[index.value()];
+  }
   Eigen::Matrix4d transform = Eigen::Matrix4d::Identity();
   while (index != kInvalidSceneNodeIndex) {
     const SceneNode *const node = scene.GetNode(index);
@@ -199,6 +218,21 @@ BoundingBox SceneUtils::ComputeBoundingBox(const Scene &scene) {
   return scene_bbox;
 }
 
+BoundingBox SceneUtils::ComputeBoundingBox(const Scene &scene,
+                                           ThreadPool *pool) {
+  const auto instances = ComputeAllInstances(scene);
+  std::vector<BoundingBox> instance_bboxes(instances.size());
+  ParallelFor(pool, instances.size(), [&](int i) {
+    instance_bboxes[i] =
+        ComputeMeshInstanceBoundingBox(scene, instances[MeshInstanceIndex(i)]);
+  });
+  BoundingBox scene_bbox;
+  for (const BoundingBox &mesh_bbox : instance_bboxes) {
+    scene_bbox.Update(mesh_bbox);
+  }
+  return scene_bbox;
+}
+
 BoundingBox SceneUtils::ComputeMeshInstanceBoundingBox(
     const Scene &scene, const MeshInstance &instance) {
   const Mesh &mesh = scene.GetMesh(instance.mesh_index);
@@ -455,9 +489,14 @@ void SceneUtils::PrintInfo(const Scene &input, const Scene &simplified,
 
 StatusOr<std::unique_ptr<Mesh>> SceneUtils::InstantiateMesh(
     const Scene &scene, const MeshInstance &instance) {
+  return InstantiateMesh(scene, instance, nullptr);
+}
+
+StatusOr<std::unique_ptr<Mesh>> SceneUtils::InstantiateMesh(
+    const Scene &scene, const MeshInstance &instance, ThreadPool *pool) {
   // Check if the |scene| has base mesh corresponding to mesh |instance|.
   if (scene.NumMeshes() <= instance.mesh_index.value()) {
-    Status(Status::DRACO_ERROR, "Scene has no corresponding base mesh.");
+    return Status(Status::DRACO_ERROR, "Scene has no corresponding base mesh.");
   }
 
   // Check that mesh has valid positions.
@@ -478,11 +517,37 @@ StatusOr<std::unique_ptr<Mesh>> SceneUtils::InstantiateMesh(
 
   // Apply transformation to mesh unless transformation is identity.
   if (instance.transform != Eigen::Matrix4d::Identity()) {
-    MeshUtils::TransformMesh(instance.transform, mesh.get());
+    MeshUtils::TransformMesh(instance.transform, pool, mesh.get());
   }
   return mesh;
 }
 
+StatusOr<IndexTypeVector<MeshInstanceIndex, std::unique_ptr<Mesh>>>
+SceneUtils::InstantiateMeshes(
+    const Scene &scene,
+    const IndexTypeVector<MeshInstanceIndex, MeshInstance> &instances,
+    ThreadPool *pool) {
+  IndexTypeVector<MeshInstanceIndex, std::unique_ptr<Mesh>> meshes(
+      instances.size());
+  std::vector<Status> statuses(instances.size());
+  // The base meshes are only read, so all instances can be created at the
+  // same time. The pool is also passed down so that large meshes are split
+  // further when there are only a few instances.
+  ParallelFor(pool, instances.size(), [&](int i) {
+    const MeshInstanceIndex mii(i);
+    auto mesh_or = InstantiateMesh(scene, instances[mii], pool);
+    if (!mesh_or.ok()) {
+      statuses[i] = mesh_or.status();
+      return;
+    }
+    meshes[mii] = std::move(mesh_or).value();
+  });
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status);
+  }
+  return std::move(meshes);
+}
+
 namespace {
 
 // Helper class for deleting unused nodes from the scene.
@@ -503,6 +568,23 @@ class SceneUnusedNodeRemover {
     RemoveUnusedNodesFromScene(scene);
   }
 
+  // Removes nodes marked in |is_node_removed| from the |scene|. The removed
+  // nodes must not be referenced by other scene elements.
+  void RemoveNodes(const std::vector<bool> &is_node_removed, Scene *scene) {
+    node_map_.resize(scene->NumNodes(), kInvalidSceneNodeIndex);
+    int num_valid_nodes = 0;
+    for (SceneNodeIndex sni(0); sni < scene->NumNodes(); ++sni) {
+      if (!is_node_removed[sni.value()]) {
+        node_map_[sni] = SceneNodeIndex(num_valid_nodes++);
+      }
+    }
+    if (num_valid_nodes == scene->NumNodes()) {
+      return;  // No nodes are removed.
+    }
+    UpdateNodeIndices(scene);
+    RemoveUnusedNodesFromScene(scene);
+  }
+
  private:
   // Returns the number of unused nodes.
   int FindUnusedNodes(const Scene &scene) {
@@ -663,9 +745,10 @@ void SceneUtils::Cleanup(Scene *scene) { Cleanup(scene, CleanupOptions()); }
 void SceneUtils::Cleanup(Scene *scene, const CleanupOptions &options) {
   // Remove invalid mesh indices from mesh groups.
   if (options.remove_invalid_mesh_instances) {
-    for (MeshGroupIndex i(0); i < scene->NumMeshGroups(); i++) {
-      scene->GetMeshGroup(i)->RemoveMeshInstances(kInvalidMeshIndex);
-    }
+    ParallelFor(options.thread_pool, scene->NumMeshGroups(), [&](int i) {
+      scene->GetMeshGroup(MeshGroupIndex(i))
+          ->RemoveMeshInstances(kInvalidMeshIndex);
+    });
   }
 
   // Find references to mesh groups.
@@ -770,10 +853,13 @@ void SceneUtils::Cleanup(Scene *scene, const CleanupOptions &options) {
   // referenced by any materials and decrement texture coordinate indices in
   // texture maps of the mesh materials accordingly.
   if (options.remove_unused_tex_coords) {
+    // Do not remove unreferenced texture coordinates when the mesh materials
+    // are used by any other meshes to avoid corrupting those other meshes.
+    // TODO(vytyaz): Consider removing this limitation.
+    // Thanks to this limitation, the remaining meshes and their materials are
+    // not shared and they can be processed in parallel.
+    std::vector<MeshIndex> meshes_to_clean;
     for (MeshIndex mi(0); mi < scene->NumMeshes(); ++mi) {
-      // Do not remove unreferenced texture coordinates when the mesh materials
-      // are used by any other meshes to avoid corrupting those other meshes.
-      // TODO(vytyaz): Consider removing this limitation.
       bool remove_tex_coord = true;
       for (const int material_index : mesh_materials[mi]) {
         if (material_meshes[material_index].size() != 1) {
@@ -782,10 +868,13 @@ void SceneUtils::Cleanup(Scene *scene, const CleanupOptions &options) {
           break;
         }
       }
-      if (!remove_tex_coord) {
-        continue;
+      if (remove_tex_coord) {
+        meshes_to_clean.push_back(mi);
       }
+    }
 
+    ParallelFor(options.thread_pool, meshes_to_clean.size(), [&](int m) {
+      const MeshIndex mi = meshes_to_clean[m];
       // Remove unreferenced texture coordinate sets from this mesh.
       Mesh &mesh = scene->GetMesh(mi);
       const int tex_coord_count =
@@ -811,7 +900,7 @@ void SceneUtils::Cleanup(Scene *scene, const CleanupOptions &options) {
           }
         }
       }
-    }
+    });
   }
 
   if (options.remove_unused_materials) {
@@ -824,6 +913,11 @@ void SceneUtils::Cleanup(Scene *scene, const CleanupOptions &options) {
     }
   }
 
+  if (options.deduplicate_textures) {
+    // Merge textures that are loaded from identical images.
+    material_library.DeduplicateTextures();
+  }
+
   if (options.remove_unused_nodes) {
     SceneUnusedNodeRemover node_remover;
     node_remover.RemoveUnusedNodes(scene);
@@ -945,6 +1039,204 @@ void SceneUtils::DeduplicateMeshGroups(Scene *scene) {
   Cleanup(scene);
 }
 
+void SceneUtils::DeduplicateMeshes(Scene *scene) {
+  if (scene->NumMeshes() <= 1) {
+    return;
+  }
+
+  // Meshes are grouped by their canonical hash and only meshes within the
+  // same group are compared with each other. Unlike MeshHasher, the canonical
+  // hash does not depend on the order of faces and points, so equivalent
+  // meshes always end up in the same group.
+  std::unordered_map<uint64_t, std::vector<MeshIndex>> unique_meshes;
+  IndexTypeVector<MeshIndex, MeshIndex> parent_mesh(scene->NumMeshes(),
+                                                    kInvalidMeshIndex);
+  bool has_duplicates = false;
+  for (MeshIndex mi(0); mi < scene->NumMeshes(); ++mi) {
+    const Mesh &mesh = scene->GetMesh(mi);
+    if (mesh.num_faces() == 0) {
+      // MeshAreEquivalent() does not compare meshes without faces.
+      continue;
+    }
+    std::vector<MeshIndex> &candidates =
+        unique_meshes[MeshAreEquivalent::ComputeCanonicalHash(mesh, nullptr)];
+    for (const MeshIndex candidate : candidates) {
+      if (MeshAreEquivalent()(scene->GetMesh(candidate), mesh)) {
+        parent_mesh[mi] = candidate;
+        has_duplicates = true;
+        break;
+      }
+    }
+    if (parent_mesh[mi] == kInvalidMeshIndex) {
+      candidates.push_back(mi);
+    }
+  }
+  if (!has_duplicates) {
+    return;
+  }
+
+  // Go over all mesh instances and update base meshes if needed.
+  for (MeshGroupIndex mgi(0); mgi < scene->NumMeshGroups(); ++mgi) {
+    MeshGroup *const mesh_group = scene->GetMeshGroup(mgi);
+    for (int i = 0; i < mesh_group->NumMeshInstances(); ++i) {
+      MeshGroup::MeshInstance instance = mesh_group->GetMeshInstance(i);
+      if (instance.mesh_index == kInvalidMeshIndex ||
+          parent_mesh[instance.mesh_index] == kInvalidMeshIndex) {
+        continue;  // Nothing to update.
+      }
+      instance.mesh_index = parent_mesh[instance.mesh_index];
+      mesh_group->SetMeshInstance(i, instance);
+    }
+  }
+
+  // Remove the duplicate meshes and merge mesh groups that reference the same
+  // meshes now.
+  Cleanup(scene);
+  DeduplicateMeshGroups(scene);
+}
+
+StatusOr<int> SceneUtils::ConvertNodesToInstanceArrays(
+    Scene *scene, int min_num_instances) {
+  const Scene &const_scene = *scene;
+
+  // Nodes targeted by animations and skins are preserved.
+  std::vector<bool> is_node_referenced(scene->NumNodes(), false);
+  for (AnimationIndex i(0); i < scene->NumAnimations(); i++) {
+    const Animation &animation = *scene->GetAnimation(i);
+    for (int j = 0; j < animation.NumChannels(); j++) {
+      is_node_referenced[animation.GetChannel(j)->target_index] = true;
+    }
+  }
+  for (SkinIndex i(0); i < scene->NumSkins(); i++) {
+    const Skin &skin = *scene->GetSkin(i);
+    for (int j = 0; j < skin.NumJoints(); j++) {
+      is_node_referenced[skin.GetJoint(j).value()] = true;
+    }
+    if (skin.GetJointRoot() != kInvalidSceneNodeIndex) {
+      is_node_referenced[skin.GetJointRoot().value()] = true;
+    }
+  }
+  std::vector<int> num_root_references(scene->NumNodes(), 0);
+  for (int i = 0; i < scene->NumRootNodes(); ++i) {
+    num_root_references[scene->GetRootNodeIndex(i).value()]++;
+  }
+
+  // Group the nodes that can be folded by their parent node and mesh group.
+  // Root nodes are grouped under an invalid parent node.
+  std::map<std::pair<SceneNodeIndex, MeshGroupIndex>,
+           std::vector<SceneNodeIndex>>
+      node_groups;
+  for (SceneNodeIndex sni(0); sni < scene->NumNodes(); ++sni) {
+    const SceneNode &node = *const_scene.GetNode(sni);
+    if (node.GetMeshGroupIndex() == kInvalidMeshGroupIndex ||
+        node.NumChildren() != 0 || node.GetTrsMatrix().MatrixSet() ||
+        node.GetSkinIndex() != kInvalidSkinIndex ||
+        node.GetLightIndex() != kInvalidLightIndex ||
+        node.GetInstanceArrayIndex() != kInvalidInstanceArrayIndex ||
+        is_node_referenced[sni.value()]) {
+      continue;
+    }
+    SceneNodeIndex parent_index;
+    if (node.NumParents() == 1 && num_root_references[sni.value()] == 0) {
+      parent_index = node.Parent(0);
+    } else if (node.NumParents() == 0 &&
+               num_root_references[sni.value()] == 1) {
+      parent_index = kInvalidSceneNodeIndex;
+    } else {
+      continue;  // Node is instanced in multiple places of the scene graph.
+    }
+    node_groups[{parent_index, node.GetMeshGroupIndex()}].push_back(sni);
+  }
+
+  std::vector<bool> is_node_removed(scene->NumNodes(), false);
+  int num_removed_nodes = 0;
+  for (const auto &node_group : node_groups) {
+    const std::vector<SceneNodeIndex> &group_nodes = node_group.second;
+    if (group_nodes.size() < 2 || group_nodes.size() < min_num_instances) {
+      continue;
+    }
+
+    // All instances of an instance array must have the same TRS vectors set,
+    // so the vectors that are missing at some of the nodes are set to their
+    // default values.
+    bool is_t_set = false;
+    bool is_r_set = false;
+    bool is_s_set = false;
+    for (const SceneNodeIndex sni : group_nodes) {
+      const TrsMatrix &trs = const_scene.GetNode(sni)->GetTrsMatrix();
+      is_t_set |= trs.TranslationSet();
+      is_r_set |= trs.RotationSet();
+      is_s_set |= trs.ScaleSet();
+    }
+    const InstanceArrayIndex array_index = scene->AddInstanceArray();
+    InstanceArray *const array = scene->GetInstanceArray(array_index);
+    for (const SceneNodeIndex sni : group_nodes) {
+      const TrsMatrix &trs = const_scene.GetNode(sni)->GetTrsMatrix();
+      InstanceArray::Instance instance;
+      if (is_t_set) {
+        instance.trs.SetTranslation(Eigen::Vector3d::Zero());
+        if (trs.TranslationSet()) {
+          DRACO_ASSIGN_OR_RETURN(const Eigen::Vector3d translation,
+                                 trs.Translation());
+          instance.trs.SetTranslation(translation);
+        }
+      }
+      if (is_r_set) {
+        instance.trs.SetRotation(Eigen::Quaterniond::Identity());
+        if (trs.RotationSet()) {
+          DRACO_ASSIGN_OR_RETURN(const Eigen::Quaterniond rotation,
+                                 trs.Rotation());
+          instance.trs.SetRotation(rotation);
+        }
+      }
+      if (is_s_set) {
+        instance.trs.SetScale(Eigen::Vector3d::Ones());
+        if (trs.ScaleSet()) {
+          DRACO_ASSIGN_OR_RETURN(const Eigen::Vector3d scale, trs.Scale());
+          instance.trs.SetScale(scale);
+        }
+      }
+      DRACO_RETURN_IF_ERROR(array->AddInstance(instance));
+    }
+
+    // The first node of the group instances the mesh group with the instance
+    // array and the remaining nodes are removed.
+    SceneNode *const instancing_node = scene->GetNode(group_nodes[0]);
+    instancing_node->SetTrsMatrix(TrsMatrix());
+    instancing_node->SetInstanceArrayIndex(array_index);
+    for (int i = 1; i < group_nodes.size(); ++i) {
+      is_node_removed[group_nodes[i].value()] = true;
+      ++num_removed_nodes;
+    }
+  }
+  if (num_removed_nodes == 0) {
+    return 0;
+  }
+
+  // Detach the removed nodes from the scene graph and delete them.
+  std::vector<SceneNodeIndex> indices;
+  for (SceneNodeIndex sni(0); sni < scene->NumNodes(); ++sni) {
+    SceneNode *const node = scene->GetNode(sni);
+    indices = node->Children();
+    node->RemoveAllChildren();
+    for (const SceneNodeIndex child_index : indices) {
+      if (!is_node_removed[child_index.value()]) {
+        node->AddChildIndex(child_index);
+      }
+    }
+  }
+  indices = scene->GetRootNodeIndices();
+  scene->RemoveAllRootNodeIndices();
+  for (const SceneNodeIndex root_index : indices) {
+    if (!is_node_removed[root_index.value()]) {
+      scene->AddRootNodeIndex(root_index);
+    }
+  }
+  SceneUnusedNodeRemover node_remover;
+  node_remover.RemoveNodes(is_node_removed, scene);
+  return num_removed_nodes;
+}
+
 void SceneUtils::SetDracoCompressionOptions(
     const DracoCompressionOptions *options, Scene *scene) {
   for (MeshIndex i(0); i < scene->NumMeshes(); ++i) {
@@ -19,6 +19,7 @@
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
 #include "draco/attributes/geometry_attribute.h"
+#include "draco/core/thread_pool.h"
 #include "draco/scene/scene.h"
 
 namespace draco {
@@ -91,6 +92,10 @@ class SceneUtils {
   // Returns the bounding box of the scene.
   static BoundingBox ComputeBoundingBox(const Scene &scene);
 
+  // Same as above but the bounding boxes of mesh instances are computed in
+  // parallel on |pool|. |pool| can be null.
+  static BoundingBox ComputeBoundingBox(const Scene &scene, ThreadPool *pool);
+
   // Returns the bounding box of a mesh instance.
   static BoundingBox ComputeMeshInstanceBoundingBox(
       const Scene &scene, const MeshInstance &instance);
@@ -119,10 +124,24 @@ class SceneUtils {
   static StatusOr<std::unique_ptr<Mesh>> InstantiateMesh(
       const Scene &scene, const MeshInstance &instance);
 
+  // Same as above but large meshes are transformed in parallel on |pool|.
+  // |pool| can be null.
+  static StatusOr<std::unique_ptr<Mesh>> InstantiateMesh(
+      const Scene &scene, const MeshInstance &instance, ThreadPool *pool);
+
+  // Creates meshes for all |instances| in |scene| like InstantiateMesh(). The
+  // instances are processed in parallel on |pool|. |pool| can be null. Error
+  // is returned if any of the meshes cannot be created.
+  static StatusOr<IndexTypeVector<MeshInstanceIndex, std::unique_ptr<Mesh>>>
+  InstantiateMeshes(const Scene &scene,
+                    const IndexTypeVector<MeshInstanceIndex, MeshInstance>
+                        &instances,
+                    ThreadPool *pool);
+
   // Cleans up a |scene| by removing unused base meshes, unused and empty mesh
-  // groups, unused materials, unused texture coordinates and unused scene
-  // nodes. The actual behavior of the cleanup operation can be controller via
-  // the user provided |options|.
+  // groups, unused materials, unused texture coordinates, unused scene nodes
+  // and duplicate material textures. The actual behavior of the cleanup
+  // operation can be controller via the user provided |options|.
   struct CleanupOptions {
     bool remove_invalid_mesh_instances = true;
     bool remove_unused_mesh_groups = true;
@@ -130,6 +149,11 @@ class SceneUtils {
     bool remove_unused_nodes = false;
     bool remove_unused_tex_coords = false;
     bool remove_unused_materials = true;
+    bool deduplicate_textures = true;
+    // Pool used to clean up independent meshes and mesh groups in parallel.
+    // Steps that span multiple meshes are always done on the calling thread.
+    // Can be null.
+    ThreadPool *thread_pool = nullptr;
   };
   static void Cleanup(Scene *scene);
   static void Cleanup(Scene *scene, const CleanupOptions &options);
@@ -142,6 +166,22 @@ class SceneUtils {
   // exactly the same meshes and materials.
   static void DeduplicateMeshGroups(Scene *scene);
 
+  // Replaces references to base meshes that have the same geometry as another
+  // base mesh with references to that mesh, so that repeated geometry becomes
+  // instances of a single mesh. Duplicates are found by hashing the mesh data
+  // and verified with MeshAreEquivalent. Meshes that became unused are removed
+  // and mesh groups that became duplicate are merged.
+  static void DeduplicateMeshes(Scene *scene);
+
+  // Folds scene nodes that instance the same mesh group under the same parent
+  // node into a single node with an instance array (EXT_mesh_gpu_instancing),
+  // when there are at least |min_num_instances| such nodes. Only leaf nodes
+  // without a transformation matrix, skin, light and instance array that are
+  // not targeted by animations or skins are folded. Returns the number of
+  // removed nodes.
+  static StatusOr<int> ConvertNodesToInstanceArrays(Scene *scene,
+                                                    int min_num_instances);
+
   // Enables geometry compression and sets compression |options| to all meshes
   // in the |scene|. If |options| is nullptr then geometry compression is
   // disabled for all meshes in the |scene|.
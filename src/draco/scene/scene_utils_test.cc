@@ -284,6 +284,55 @@ TEST(SceneUtilsTest, TestComputeMeshInstanceBoundingBox) {
   ASSERT_EQ(scene_bbox.GetMaxPoint(), mesh_bbox.GetMaxPoint());
 }
 
+TEST(SceneUtilsTest, TestComputeBoundingBoxWithThreadPool) {
+  auto scene =
+      draco::ReadSceneFromTestFile("CesiumMilkTruck/glTF/CesiumMilkTruck.gltf");
+  ASSERT_NE(scene, nullptr);
+  const draco::BoundingBox bbox = draco::SceneUtils::ComputeBoundingBox(*scene);
+  draco::ThreadPool pool(3);
+  const draco::BoundingBox pool_bbox =
+      draco::SceneUtils::ComputeBoundingBox(*scene, &pool);
+  ASSERT_EQ(bbox.GetMinPoint(), pool_bbox.GetMinPoint());
+  ASSERT_EQ(bbox.GetMaxPoint(), pool_bbox.GetMaxPoint());
+  const draco::BoundingBox serial_bbox =
+      draco::SceneUtils::ComputeBoundingBox(*scene, nullptr);
+  ASSERT_EQ(bbox.GetMinPoint(), serial_bbox.GetMinPoint());
+  ASSERT_EQ(bbox.GetMaxPoint(), serial_bbox.GetMaxPoint());
+}
+
+TEST(SceneUtilsTest, TestComputeAllInstancesAfterNodeEdit) {
+  // Tests that the node transforms cached by the scene are updated when the
+  // scene nodes are edited.
+  auto scene =
+      draco::ReadSceneFromTestFile("CesiumMilkTruck/glTF/CesiumMilkTruck.gltf");
+  ASSERT_NE(scene, nullptr);
+  const auto transforms = scene->GetNodeTransforms();
+  ASSERT_EQ(scene->GetNodeTransforms(), transforms);
+  const auto instances = draco::SceneUtils::ComputeAllInstances(*scene);
+  ASSERT_EQ(scene->GetNodeTransforms(), transforms);
+
+  // Move the root node.
+  const draco::SceneNodeIndex root_index = scene->GetRootNodeIndex(0);
+  draco::TrsMatrix trs;
+  trs.SetTranslation(Eigen::Vector3d(1.0, 2.0, 3.0));
+  scene->GetNode(root_index)->SetTrsMatrix(trs);
+  ASSERT_NE(scene->GetNodeTransforms(), transforms);
+
+  const auto moved_instances = draco::SceneUtils::ComputeAllInstances(*scene);
+  const auto node_instances =
+      draco::SceneUtils::ComputeAllInstancesFromNode(*scene, root_index);
+  ASSERT_EQ(moved_instances.size(), instances.size());
+  ASSERT_EQ(node_instances.size(), instances.size());
+  for (MeshInstanceIndex i(0); i < instances.size(); ++i) {
+    ASSERT_EQ(moved_instances[i].scene_node_index,
+              instances[i].scene_node_index);
+    ASSERT_NE(moved_instances[i].transform, instances[i].transform);
+    ASSERT_EQ(moved_instances[i].transform, node_instances[i].transform);
+  }
+  ASSERT_EQ(draco::SceneUtils::ComputeGlobalNodeTransform(*scene, root_index),
+            trs.ComputeTransformationMatrix());
+}
+
 TEST(SceneUtilsTest, TestMeshToSceneZeroMaterials) {
   const std::string filename = "cube_att.obj";
   std::unique_ptr<draco::Mesh> mesh = draco::ReadMeshFromTestFile(filename);
@@ -529,6 +578,39 @@ TEST(SceneUtilsTest, TestInstantiateMesh) {
   EXPECT_NEAR(instanced_bbox.GetMaxPoint()[2], +1.05800, tolerance);
 }
 
+TEST(SceneUtilsTest, TestInstantiateMeshesWithThreadPool) {
+  auto scene =
+      draco::ReadSceneFromTestFile("CesiumMilkTruck/glTF/CesiumMilkTruck.gltf");
+  ASSERT_NE(scene, nullptr);
+  const auto instances = draco::SceneUtils::ComputeAllInstances(*scene);
+  ASSERT_EQ(instances.size(), 5);
+
+  // Meshes instantiated in parallel must be the same as meshes instantiated
+  // one by one.
+  draco::ThreadPool pool(3);
+  DRACO_ASSIGN_OR_ASSERT(
+      auto meshes,
+      draco::SceneUtils::InstantiateMeshes(*scene, instances, &pool));
+  ASSERT_EQ(meshes.size(), instances.size());
+  for (MeshInstanceIndex i(0); i < instances.size(); ++i) {
+    DRACO_ASSIGN_OR_ASSERT(
+        auto mesh, draco::SceneUtils::InstantiateMesh(*scene, instances[i]));
+    ASSERT_NE(meshes[i], nullptr);
+    const draco::PointAttribute *const pos_att =
+        mesh->GetNamedAttribute(draco::GeometryAttribute::POSITION);
+    const draco::PointAttribute *const parallel_pos_att =
+        meshes[i]->GetNamedAttribute(draco::GeometryAttribute::POSITION);
+    ASSERT_EQ(pos_att->size(), parallel_pos_att->size());
+    for (draco::AttributeValueIndex avi(0); avi < pos_att->size(); ++avi) {
+      std::array<float, 3> value;
+      std::array<float, 3> parallel_value;
+      pos_att->GetValue(avi, &value);
+      parallel_pos_att->GetValue(avi, &parallel_value);
+      ASSERT_EQ(value, parallel_value);
+    }
+  }
+}
+
 TEST(SceneUtilsTest, TestCleanupEmptyMeshGroup) {
   auto scene =
       draco::ReadSceneFromTestFile("CesiumMilkTruck/glTF/CesiumMilkTruck.gltf");
@@ -677,6 +759,105 @@ TEST(SceneUtilsTest, TestDeduplicateMeshGroups) {
   ASSERT_EQ(draco::SceneUtils::ComputeAllInstances(*scene).size(), 7);
 }
 
+TEST(SceneUtilsTest, TestDeduplicateMeshes) {
+  // Input scene has four mesh groups that all reference the same mesh. Each
+  // mesh group is changed to reference its own copy of the mesh and the
+  // deduplication should revert the change.
+  auto scene =
+      draco::ReadSceneFromTestFile("DuplicateMeshes/duplicate_meshes.gltf");
+  ASSERT_NE(scene, nullptr);
+  ASSERT_EQ(scene->NumMeshes(), 1);
+  ASSERT_EQ(scene->NumMeshGroups(), 4);
+  for (draco::MeshGroupIndex mgi(1); mgi < scene->NumMeshGroups(); ++mgi) {
+    draco::MeshGroup *const mesh_group = scene->GetMeshGroup(mgi);
+    for (int i = 0; i < mesh_group->NumMeshInstances(); ++i) {
+      std::unique_ptr<draco::Mesh> mesh(new draco::Mesh());
+      mesh->Copy(scene->GetMesh(MeshIndex(0)));
+      draco::MeshGroup::MeshInstance instance = mesh_group->GetMeshInstance(i);
+      instance.mesh_index = scene->AddMesh(std::move(mesh));
+      mesh_group->SetMeshInstance(i, instance);
+    }
+  }
+  ASSERT_GT(scene->NumMeshes(), 1);
+
+  // Add a mesh with different geometry that must be preserved.
+  std::unique_ptr<draco::Mesh> cube =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(cube, nullptr);
+  const draco::MeshIndex cube_mesh_index = scene->AddMesh(std::move(cube));
+  const draco::MeshGroupIndex cube_group_index = scene->AddMeshGroup();
+  scene->GetMeshGroup(cube_group_index)
+      ->AddMeshInstance({cube_mesh_index, 0, {}});
+  const draco::SceneNodeIndex cube_node_index = scene->AddNode();
+  scene->GetNode(cube_node_index)->SetMeshGroupIndex(cube_group_index);
+  scene->AddRootNodeIndex(cube_node_index);
+  ASSERT_EQ(draco::SceneUtils::ComputeAllInstances(*scene).size(), 8);
+
+  draco::SceneUtils::DeduplicateMeshes(scene.get());
+
+  // Check deduplicated scene.
+  ASSERT_EQ(scene->NumMeshes(), 2);
+  ASSERT_EQ(scene->NumMeshGroups(), 3);
+  ASSERT_EQ(draco::SceneUtils::ComputeAllInstances(*scene).size(), 8);
+}
+
+TEST(SceneUtilsTest, TestConvertNodesToInstanceArrays) {
+  std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("cube_att.obj");
+  ASSERT_NE(mesh, nullptr);
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::Scene> scene,
+                         draco::SceneUtils::MeshToScene(std::move(mesh)));
+  ASSERT_EQ(scene->NumNodes(), 1);
+  ASSERT_EQ(scene->NumRootNodes(), 1);
+  const draco::MeshGroupIndex mesh_group_index =
+      scene->GetNode(scene->GetRootNodeIndex(0))->GetMeshGroupIndex();
+
+  // Add more root nodes that instance the same mesh group at other places.
+  for (int i = 1; i < 4; ++i) {
+    const draco::SceneNodeIndex node_index = scene->AddNode();
+    draco::TrsMatrix trs;
+    trs.SetTranslation(Eigen::Vector3d(i, 0.0, 0.0));
+    scene->GetNode(node_index)->SetTrsMatrix(trs);
+    scene->GetNode(node_index)->SetMeshGroupIndex(mesh_group_index);
+    scene->AddRootNodeIndex(node_index);
+  }
+  ASSERT_EQ(draco::SceneUtils::ComputeAllInstances(*scene).size(), 4);
+
+  // Nothing should be folded when there are not enough instances.
+  DRACO_ASSIGN_OR_ASSERT(
+      int num_removed_nodes,
+      draco::SceneUtils::ConvertNodesToInstanceArrays(scene.get(), 5));
+  ASSERT_EQ(num_removed_nodes, 0);
+  ASSERT_EQ(scene->NumNodes(), 4);
+  ASSERT_EQ(scene->NumInstanceArrays(), 0);
+
+  DRACO_ASSIGN_OR_ASSERT(
+      num_removed_nodes,
+      draco::SceneUtils::ConvertNodesToInstanceArrays(scene.get(), 4));
+  ASSERT_EQ(num_removed_nodes, 3);
+  ASSERT_EQ(scene->NumNodes(), 1);
+  ASSERT_EQ(scene->NumRootNodes(), 1);
+  ASSERT_EQ(scene->NumInstanceArrays(), 1);
+  const draco::SceneNode &node = *scene->GetNode(scene->GetRootNodeIndex(0));
+  ASSERT_EQ(node.GetMeshGroupIndex(), mesh_group_index);
+  ASSERT_EQ(node.GetInstanceArrayIndex(), draco::InstanceArrayIndex(0));
+  ASSERT_FALSE(node.GetTrsMatrix().TransformSet());
+
+  // Check that the instances have the transforms of the removed nodes.
+  const draco::InstanceArray &array =
+      *scene->GetInstanceArray(draco::InstanceArrayIndex(0));
+  ASSERT_EQ(array.NumInstances(), 4);
+  for (int i = 0; i < 4; ++i) {
+    const draco::TrsMatrix &trs = array.GetInstance(i).trs;
+    ASSERT_TRUE(trs.TranslationSet());
+    ASSERT_FALSE(trs.RotationSet());
+    ASSERT_FALSE(trs.ScaleSet());
+    DRACO_ASSIGN_OR_ASSERT(const Eigen::Vector3d translation,
+                           trs.Translation());
+    ASSERT_EQ(translation, Eigen::Vector3d(i, 0.0, 0.0));
+  }
+}
+
 TEST(SceneUtilsTest, TestCleanupUnusedTexCoordsNoTextures) {
   // The glTF file has two tex coords that are unused because the materials do
   // not reference any textures.
@@ -757,6 +938,36 @@ TEST(SceneUtilsTest, TestCleanupUnusedTexCoords1NoReferences) {
   ASSERT_EQ(ml.GetMaterial(0)->GetTextureMapByIndex(0)->tex_coord_index(), 0);
 }
 
+TEST(SceneUtilsTest, TestCleanupWithThreadPool) {
+  auto scene = draco::ReadSceneFromTestFile(
+      "UnusedTexCoords/TexCoord0ValidTexCoord1Invalid.gltf");
+  ASSERT_NE(scene, nullptr);
+  typedef draco::GeometryAttribute Att;
+  draco::Mesh &mesh = scene->GetMesh(draco::MeshIndex(0));
+  ASSERT_EQ(mesh.NumNamedAttributes(Att::TEX_COORD), 2);
+
+  // Invalidate a mesh instance so that mesh groups are cleaned up as well.
+  draco::MeshGroup &mesh_group = *scene->GetMeshGroup(draco::MeshGroupIndex(0));
+  const int num_mesh_instances = mesh_group.NumMeshInstances();
+  mesh_group.AddMeshInstance({draco::kInvalidMeshIndex, 0});
+
+  // The result of a parallel cleanup is the same as of the serial one.
+  draco::ThreadPool pool(3);
+  draco::SceneUtils::CleanupOptions options;
+  options.remove_unused_tex_coords = true;
+  options.thread_pool = &pool;
+  draco::SceneUtils::Cleanup(scene.get(), options);
+
+  ASSERT_EQ(scene->NumMeshGroups(), 1);
+  ASSERT_EQ(scene->GetMeshGroup(draco::MeshGroupIndex(0))->NumMeshInstances(),
+            num_mesh_instances);
+  ASSERT_EQ(mesh.NumNamedAttributes(Att::TEX_COORD), 1);
+  ASSERT_EQ(mesh.GetNamedAttribute(Att::TEX_COORD, 0)->size(), 14);
+  const auto &ml = scene->GetMaterialLibrary();
+  ASSERT_EQ(ml.NumMaterials(), 1);
+  ASSERT_EQ(ml.GetMaterial(0)->GetTextureMapByIndex(0)->tex_coord_index(), 0);
+}
+
 TEST(SceneUtilsTest, TestComputeGlobalNodeTransform) {
   // Tests that we can compute global transformation of scene nodes.
 
@@ -18,6 +18,8 @@
 #include "draco/draco_features.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -29,15 +31,38 @@ namespace draco {
 // Texture class storing the source image data.
 class Texture {
  public:
-  void Copy(const Texture &other) { source_image_.Copy(other.source_image_); }
+  Texture() : revision_(NewRevision()) {}
 
-  void set_source_image(const SourceImage &image) { source_image_.Copy(image); }
+  void Copy(const Texture &other) {
+    source_image_.Copy(other.source_image_);
+    revision_ = NewRevision();
+  }
+
+  void set_source_image(const SourceImage &image) {
+    source_image_.Copy(image);
+    revision_ = NewRevision();
+  }
   const SourceImage &source_image() const { return source_image_; }
-  SourceImage &source_image() { return source_image_; }
+  SourceImage &source_image() {
+    revision_ = NewRevision();
+    return source_image_;
+  }
+
+  // Returns the revision of the texture. Like Scene::GetMeshRevision(), a new
+  // revision that is unique within the process is assigned whenever the
+  // texture may be modified, i.e. when the non-const accessors are used.
+  uint64_t revision() const { return revision_; }
 
  private:
+  static uint64_t NewRevision() {
+    static std::atomic<uint64_t> last_revision(0);
+    return ++last_revision;
+  }
+
   // If set this is the image that this texture is based from.
   SourceImage source_image_;
+
+  uint64_t revision_;
 };
 
 }  // namespace draco
@@ -56,6 +56,20 @@ std::unique_ptr<Texture> TextureLibrary::RemoveTexture(int index) {
   return ret;
 }
 
+size_t TextureLibrary::ComputeMemoryUsage() const {
+  size_t num_bytes = 0;
+  for (const auto &texture : textures_) {
+    num_bytes += texture->source_image().encoded_data().capacity();
+  }
+  return num_bytes;
+}
+
+void TextureLibrary::ShrinkToFit() {
+  for (const auto &texture : textures_) {
+    texture->source_image().MutableEncodedData().shrink_to_fit();
+  }
+}
+
 }  // namespace draco
 
 #endif  // DRACO_TRANSCODER_SUPPORTED
@@ -57,6 +57,13 @@ class TextureLibrary {
   // automatically deleted.
   std::unique_ptr<Texture> RemoveTexture(int index);
 
+  // Returns the number of bytes allocated by the encoded images of all
+  // textures.
+  size_t ComputeMemoryUsage() const;
+
+  // Releases unused capacity of the encoded images of all textures.
+  void ShrinkToFit();
+
  private:
   std::vector<std::unique_ptr<Texture>> textures_;
 };
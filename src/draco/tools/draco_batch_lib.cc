@@ -0,0 +1,103 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/tools/draco_batch_lib.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#include "draco/core/cycle_timer.h"
+#include "draco/core/thread_pool.h"
+#include "draco/io/file_utils.h"
+
+namespace draco {
+
+bool ReadBatchManifest(const std::string &manifest_file,
+                       const std::string &default_output_suffix,
+                       std::vector<BatchJob> *out_jobs) {
+  std::string contents;
+  if (!ReadFileToString(manifest_file, &contents)) {
+    return false;
+  }
+  std::istringstream lines(contents);
+  std::string line;
+  while (std::getline(lines, line)) {
+    std::istringstream fields(line);
+    BatchJob job;
+    if (!(fields >> job.input) || job.input[0] == '#') {
+      continue;
+    }
+    if (!(fields >> job.output)) {
+      job.output = job.input + default_output_suffix;
+    }
+    out_jobs->push_back(job);
+  }
+  return true;
+}
+
+int RunBatchJobs(const std::vector<BatchJob> &jobs, int num_workers,
+                 const std::function<bool(const BatchJob &)> &process_job) {
+  std::unique_ptr<ThreadPool> pool;
+  if (num_workers > 1) {
+    // The calling thread participates in the work.
+    pool.reset(new ThreadPool(num_workers - 1));
+  }
+  std::mutex mutex;
+  int num_failed = 0;
+  int64_t total_input_size = 0;
+  int64_t total_output_size = 0;
+  CycleTimer total_timer;
+  total_timer.Start();
+  ParallelFor(pool.get(), static_cast<int>(jobs.size()), [&](int i) {
+    const BatchJob &job = jobs[i];
+    CycleTimer timer;
+    timer.Start();
+    const bool ok = process_job(job);
+    timer.Stop();
+    const int64_t input_size = static_cast<int64_t>(GetFileSize(job.input));
+    const int64_t output_size =
+        ok ? static_cast<int64_t>(GetFileSize(job.output)) : 0;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (ok) {
+      total_input_size += input_size;
+      total_output_size += output_size;
+      printf("%s -> %s: %" PRId64 " ms, %" PRId64 " -> %" PRId64 " bytes\n",
+             job.input.c_str(), job.output.c_str(), timer.GetInMs(),
+             input_size, output_size);
+    } else {
+      ++num_failed;
+      printf("%s: FAILED (%" PRId64 " ms)\n", job.input.c_str(),
+             timer.GetInMs());
+    }
+    fflush(stdout);
+  });
+  total_timer.Stop();
+
+  const int64_t total_ms = total_timer.GetInMs();
+  const double total_s = std::max<int64_t>(total_ms, 1) / 1000.0;
+  const int num_succeeded = static_cast<int>(jobs.size()) - num_failed;
+  printf("\nProcessed %zu files (%d failed) in %" PRId64
+         " ms using %d workers.\n",
+         jobs.size(), num_failed, total_ms, std::max(num_workers, 1));
+  printf("Throughput: %.1f files/s, %.2f MB/s input, %.2f MB/s output.\n",
+         num_succeeded / total_s, total_input_size / total_s / (1 << 20),
+         total_output_size / total_s / (1 << 20));
+  return num_failed;
+}
+
+}  // namespace draco
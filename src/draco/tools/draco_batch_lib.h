@@ -0,0 +1,50 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_TOOLS_DRACO_BATCH_LIB_H_
+#define DRACO_TOOLS_DRACO_BATCH_LIB_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace draco {
+
+// Input and output file of a single file processed in batch mode of the
+// command line tools.
+struct BatchJob {
+  std::string input;
+  std::string output;
+};
+
+// Reads batch jobs from |manifest_file|. Each line of the manifest contains an
+// input file name optionally followed by whitespace and an output file name.
+// When the output file name is missing, |default_output_suffix| is appended to
+// the input file name. Empty lines and lines starting with '#' are ignored.
+// File names cannot contain whitespace. Returns false when the manifest cannot
+// be read.
+bool ReadBatchManifest(const std::string &manifest_file,
+                       const std::string &default_output_suffix,
+                       std::vector<BatchJob> *out_jobs);
+
+// Calls |process_job| for all |jobs| using |num_workers| threads. The function
+// returns false when processing of a job fails. Timing and sizes of each file
+// are printed as soon as the file is processed, followed by an aggregate
+// throughput report at the end. Returns the number of failed jobs.
+int RunBatchJobs(const std::vector<BatchJob> &jobs, int num_workers,
+                 const std::function<bool(const BatchJob &)> &process_job);
+
+}  // namespace draco
+
+#endif  // DRACO_TOOLS_DRACO_BATCH_LIB_H_
@@ -0,0 +1,856 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Throughput benchmarks of the main encoding and decoding paths. All benchmarks
+// operate on the geometry stored in the testdata directory. The reported
+// bytes_per_second are computed from the size of the encoded data and the
+// faces_per_second (or points_per_second) from the size of the geometry.
+//
+// Example:
+//
+//   draco_benchmarks --benchmark_filter=Edgebreaker
+//
+// The vectorized kernels can be restricted to a lower instruction set with the
+// DRACO_SIMD_TARGET environment variable (see core/cpu_features.h), e.g.:
+//
+//   DRACO_SIMD_TARGET=scalar draco_benchmarks
+//
+// When the DRACO_BENCHMARK_MEMORY environment variable is set, all heap
+// allocations made through the global operator new are counted and the codec
+// benchmarks additionally report:
+//
+//   allocs_per_op   - Number of allocations per iteration.
+//   peak_heap_bytes - Peak number of live heap bytes above the level at the
+//                     start of the benchmark.
+//   peak_rss_bytes  - Peak resident set size of the process. On Linux the peak
+//                     is reset at the start of every benchmark, elsewhere it
+//                     is the peak over the lifetime of the process.
+//
+// Counting adds an atomic update to every allocation, so the timings of such
+// runs should not be compared with the timings of the default runs.
+//
+//   DRACO_BENCHMARK_MEMORY=1 draco_benchmarks --benchmark_filter=Decode
+//
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/mesh/traverser/depth_first_traverser.h"
+#include "draco/compression/mesh/traverser/max_prediction_degree_traverser.h"
+#include "draco/compression/decode.h"
+#include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/compression/entropy/symbol_encoding.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/cpu_features.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/core/quantization_utils.h"
+#include "draco/core/thread_pool.h"
+#include "draco/io/file_utils.h"
+#include "draco/mesh/corner_table.h"
+#include "draco/mesh/mesh.h"
+#include "draco/mesh/mesh_misc_functions.h"
+#include "draco/mesh/packed_corner_table.h"
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include "draco/io/gltf_encoder.h"
+#include "draco/io/scene_io.h"
+#endif
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace draco {
+namespace {
+
+// Returns true when the allocations should be counted. The value is decided
+// on the first allocation and never changes afterwards, so that every block
+// is released the same way it was allocated.
+bool IsAllocationCountingEnabled() {
+  static const bool enabled = std::getenv("DRACO_BENCHMARK_MEMORY") != nullptr;
+  return enabled;
+}
+
+// Statistics of the counted heap allocations.
+std::atomic<int64_t> num_allocations(0);
+std::atomic<int64_t> live_bytes(0);
+std::atomic<int64_t> peak_live_bytes(0);
+
+// Every counted block is prefixed with its size. The prefix keeps the
+// alignment guaranteed by malloc().
+constexpr size_t kAllocationHeaderSize = alignof(std::max_align_t);
+
+void *CountedAllocate(size_t size) {
+  if (!IsAllocationCountingEnabled()) {
+    return std::malloc(size == 0 ? 1 : size);
+  }
+  char *const block =
+      static_cast<char *>(std::malloc(size + kAllocationHeaderSize));
+  if (block == nullptr) {
+    return nullptr;
+  }
+  std::memcpy(block, &size, sizeof(size));
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  const int64_t live =
+      live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+  int64_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !peak_live_bytes.compare_exchange_weak(
+                            peak, live, std::memory_order_relaxed)) {
+  }
+  return block + kAllocationHeaderSize;
+}
+
+void CountedFree(void *ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (!IsAllocationCountingEnabled()) {
+    std::free(ptr);
+    return;
+  }
+  char *const block = static_cast<char *>(ptr) - kAllocationHeaderSize;
+  size_t size;
+  std::memcpy(&size, block, sizeof(size));
+  live_bytes.fetch_sub(size, std::memory_order_relaxed);
+  std::free(block);
+}
+
+// Returns the peak resident set size of the process in bytes or 0 when it is
+// not available on the platform.
+int64_t GetPeakRssBytes() {
+#if defined(__linux__)
+  // VmHWM is used instead of getrusage() because it can be reset.
+  FILE *const file = std::fopen("/proc/self/status", "r");
+  if (file != nullptr) {
+    char line[256];
+    long long peak_kb = -1;
+    while (std::fgets(line, sizeof(line), file) != nullptr) {
+      if (std::sscanf(line, "VmHWM: %lld kB", &peak_kb) == 1) {
+        break;
+      }
+    }
+    std::fclose(file);
+    if (peak_kb >= 0) {
+      return peak_kb * 1024;
+    }
+  }
+#endif
+#if defined(__linux__) || defined(__APPLE__)
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+    return usage.ru_maxrss;
+#else
+    return static_cast<int64_t>(usage.ru_maxrss) * 1024;
+#endif
+  }
+#endif
+  return 0;
+}
+
+// Resets the peak resident set size to the current one where supported.
+void ResetPeakRss() {
+#if defined(__linux__)
+  FILE *const file = std::fopen("/proc/self/clear_refs", "w");
+  if (file != nullptr) {
+    std::fputs("5", file);
+    std::fclose(file);
+  }
+#endif
+}
+
+// Measures the memory used by a benchmark when allocation counting is enabled.
+// The measurement starts on construction, which should happen right before
+// the benchmark loop.
+class MemoryCounters {
+ public:
+  MemoryCounters() : start_num_allocations_(0), start_live_bytes_(0) {
+    if (!IsAllocationCountingEnabled()) {
+      return;
+    }
+    ResetPeakRss();
+    start_num_allocations_ = num_allocations.load();
+    start_live_bytes_ = live_bytes.load();
+    peak_live_bytes.store(start_live_bytes_);
+  }
+
+  // Adds the memory counters described at the top of this file to |state|.
+  void Report(benchmark::State &state) const {
+    if (!IsAllocationCountingEnabled()) {
+      return;
+    }
+    state.counters["allocs_per_op"] =
+        benchmark::Counter(num_allocations.load() - start_num_allocations_,
+                           benchmark::Counter::kAvgIterations);
+    state.counters["peak_heap_bytes"] = benchmark::Counter(
+        peak_live_bytes.load() - start_live_bytes_,
+        benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    const int64_t peak_rss = GetPeakRssBytes();
+    if (peak_rss > 0) {
+      state.counters["peak_rss_bytes"] =
+          benchmark::Counter(peak_rss, benchmark::Counter::kDefaults,
+                             benchmark::Counter::kIs1024);
+    }
+  }
+
+ private:
+  int64_t start_num_allocations_;
+  int64_t start_live_bytes_;
+};
+
+// Returns the mesh loaded from the test file |file_name|. Loaded meshes are
+// cached so that the loading time is not repeated for every benchmark run.
+const Mesh *GetTestMesh(const std::string &file_name) {
+  static std::map<std::string, std::unique_ptr<Mesh>> *const meshes =
+      new std::map<std::string, std::unique_ptr<Mesh>>();
+  std::unique_ptr<Mesh> &mesh = (*meshes)[file_name];
+  if (mesh == nullptr) {
+    mesh = ReadMeshFromTestFile(file_name);
+  }
+  return mesh.get();
+}
+
+// Adds a texture coordinate attribute to |mesh| that is generated from a
+// spherical projection of the positions. None of the large test meshes contains
+// texture coordinates.
+void AddSphericalTexCoords(Mesh *mesh) {
+  const PointAttribute *const pos_att =
+      mesh->GetNamedAttribute(GeometryAttribute::POSITION);
+  GeometryAttribute va;
+  va.Init(GeometryAttribute::TEX_COORD, nullptr, 2, DT_FLOAT32, false,
+          sizeof(float) * 2, 0);
+  PointAttribute *const tex_att =
+      mesh->attribute(mesh->AddAttribute(va, true, mesh->num_points()));
+  for (PointIndex pi(0); pi < mesh->num_points(); ++pi) {
+    float pos[3];
+    pos_att->GetMappedValue(pi, pos);
+    const float uv[2] = {std::atan2(pos[1], pos[0]),
+                         std::atan2(pos[2], std::hypot(pos[0], pos[1]))};
+    tex_att->SetAttributeValue(AttributeValueIndex(pi.value()), uv);
+  }
+}
+
+// Sets the default quantization used by the draco_encoder tool for all
+// attributes of |pc|.
+void SetDefaultQuantization(const PointCloud &pc, ExpertEncoder *encoder) {
+  for (int i = 0; i < pc.num_attributes(); ++i) {
+    switch (pc.attribute(i)->attribute_type()) {
+      case GeometryAttribute::POSITION:
+        encoder->SetAttributeQuantization(i, 11);
+        break;
+      case GeometryAttribute::NORMAL:
+        encoder->SetAttributeQuantization(i, 8);
+        break;
+      case GeometryAttribute::TEX_COORD:
+        encoder->SetAttributeQuantization(i, 10);
+        break;
+      case GeometryAttribute::GENERIC:
+        encoder->SetAttributeQuantization(i, 8);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+// Encodes |mesh| with the edgebreaker method and default settings.
+bool EncodeEdgebreaker(const Mesh &mesh, EncoderBuffer *buffer) {
+  ExpertEncoder encoder(mesh);
+  SetDefaultQuantization(mesh, &encoder);
+  encoder.SetEncodingMethod(MESH_EDGEBREAKER_ENCODING);
+  return encoder.EncodeToBuffer(buffer).ok();
+}
+
+// Sets rate counters for the size of the processed data.
+void SetMeshCounters(benchmark::State &state, const Mesh &mesh,
+                     size_t encoded_size) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          encoded_size);
+  state.counters["faces_per_second"] = benchmark::Counter(
+      mesh.num_faces(), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_EdgebreakerEncode(benchmark::State &state,
+                          const std::string &file_name) {
+  const Mesh &mesh = *GetTestMesh(file_name);
+  size_t encoded_size = 0;
+  const MemoryCounters memory_counters;
+  for (auto _ : state) {
+    EncoderBuffer buffer;
+    if (!EncodeEdgebreaker(mesh, &buffer)) {
+      state.SkipWithError("Failed to encode the mesh.");
+      return;
+    }
+    encoded_size = buffer.size();
+  }
+  SetMeshCounters(state, mesh, encoded_size);
+  memory_counters.Report(state);
+}
+
+// Decodes the edgebreaker encoded test mesh |file_name|. When
+// |connectivity_only| is set, only the connectivity is decoded.
+void BM_EdgebreakerDecode(benchmark::State &state, const std::string &file_name,
+                          bool connectivity_only) {
+  const Mesh &mesh = *GetTestMesh(file_name);
+  EncoderBuffer encoded;
+  if (!EncodeEdgebreaker(mesh, &encoded)) {
+    state.SkipWithError("Failed to encode the mesh.");
+    return;
+  }
+  const MemoryCounters memory_counters;
+  for (auto _ : state) {
+    DecoderBuffer buffer;
+    buffer.Init(encoded.data(), encoded.size());
+    Decoder decoder;
+    decoder.options()->SetGlobalBool("decode_connectivity_only",
+                                     connectivity_only);
+    if (!decoder.DecodeMeshFromBuffer(&buffer).ok()) {
+      state.SkipWithError("Failed to decode the mesh.");
+      return;
+    }
+  }
+  SetMeshCounters(state, mesh, encoded.size());
+  memory_counters.Report(state);
+}
+
+// Traversal observer that only counts the visited vertices.
+class VertexCountingObserver {
+ public:
+  VertexCountingObserver() : num_visited_vertices_(0) {}
+  void OnNewFaceVisited(FaceIndex /* face */) {}
+  void OnNewVertexVisited(VertexIndex /* vertex */, CornerIndex /* corner */) {
+    ++num_visited_vertices_;
+  }
+  int num_visited_vertices() const { return num_visited_vertices_; }
+
+ private:
+  int num_visited_vertices_;
+};
+
+// Traverses all faces of |corner_table| with |TraverserT| and returns the
+// number of visited vertices.
+template <template <class, class> class TraverserT, class CornerTableT>
+int TraverseCornerTable(const CornerTableT *corner_table) {
+  TraverserT<CornerTableT, VertexCountingObserver> traverser;
+  traverser.Init(corner_table, VertexCountingObserver());
+  traverser.OnTraversalStart();
+  for (int f = 0; f < corner_table->num_faces(); ++f) {
+    traverser.TraverseFromCorner(CornerIndex(3 * f));
+  }
+  traverser.OnTraversalEnd();
+  return traverser.traversal_observer().num_visited_vertices();
+}
+
+template <class CornerTableT>
+int TraverseCornerTable(const CornerTableT *corner_table,
+                        MeshTraversalMethod method) {
+  if (method == MESH_TRAVERSAL_PREDICTION_DEGREE) {
+    return TraverseCornerTable<MaxPredictionDegreeTraverser>(corner_table);
+  }
+  return TraverseCornerTable<DepthFirstTraverser>(corner_table);
+}
+
+// Traverses the corner table of the test mesh |file_name| using either the
+// CornerTable or the PackedCornerTable layout.
+void BM_CornerTableTraversal(benchmark::State &state,
+                             const std::string &file_name,
+                             MeshTraversalMethod method, bool packed) {
+  const Mesh &mesh = *GetTestMesh(file_name);
+  const std::unique_ptr<CornerTable> corner_table =
+      CreateCornerTableFromPositionAttribute(&mesh);
+  PackedCornerTable packed_corner_table;
+  if (corner_table == nullptr || !packed_corner_table.Init(*corner_table)) {
+    state.SkipWithError("Failed to create the corner table.");
+    return;
+  }
+  for (auto _ : state) {
+    if (packed) {
+      benchmark::DoNotOptimize(
+          TraverseCornerTable(&packed_corner_table, method));
+    } else {
+      benchmark::DoNotOptimize(TraverseCornerTable(corner_table.get(), method));
+    }
+  }
+  state.counters["faces_per_second"] = benchmark::Counter(
+      mesh.num_faces(), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Builds the corner table of the test mesh |file_name| using a thread pool
+// with state.range(0) threads.
+void BM_CornerTableCreate(benchmark::State &state,
+                          const std::string &file_name) {
+  const Mesh &mesh = *GetTestMesh(file_name);
+  ThreadPool pool(static_cast<int>(state.range(0)));
+  const MemoryCounters memory_counters;
+  for (auto _ : state) {
+    if (CreateCornerTableFromPositionAttribute(&mesh, &pool) == nullptr) {
+      state.SkipWithError("Failed to create the corner table.");
+      return;
+    }
+  }
+  state.counters["faces_per_second"] = benchmark::Counter(
+      mesh.num_faces(), benchmark::Counter::kIsIterationInvariantRate);
+  memory_counters.Report(state);
+}
+
+// Returns the bunny test mesh with positions and the |att_type| attribute.
+// All other attributes are removed so that the results are not affected by
+// their encoding.
+std::unique_ptr<Mesh> LoadPredictionSchemeMesh(
+    GeometryAttribute::Type att_type) {
+  std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile("bunny_norm.obj");
+  AddSphericalTexCoords(mesh.get());
+  for (int i = mesh->num_attributes() - 1; i >= 0; --i) {
+    const GeometryAttribute::Type type = mesh->attribute(i)->attribute_type();
+    if (type != att_type && type != GeometryAttribute::POSITION) {
+      mesh->DeleteAttribute(i);
+    }
+  }
+  return mesh;
+}
+
+// Encodes |mesh| using |scheme| for the attribute |att_type|.
+bool EncodeWithPredictionScheme(const Mesh &mesh,
+                                GeometryAttribute::Type att_type,
+                                PredictionSchemeMethod scheme,
+                                EncoderBuffer *buffer) {
+  ExpertEncoder encoder(mesh);
+  SetDefaultQuantization(mesh, &encoder);
+  encoder.SetEncodingMethod(MESH_EDGEBREAKER_ENCODING);
+  const int att_id = mesh.GetNamedAttributeId(att_type);
+  if (!encoder.SetAttributePredictionScheme(att_id, scheme).ok()) {
+    return false;
+  }
+  return encoder.EncodeToBuffer(buffer).ok();
+}
+
+void BM_PredictionSchemeEncode(benchmark::State &state,
+                               GeometryAttribute::Type att_type,
+                               PredictionSchemeMethod scheme) {
+  const std::unique_ptr<Mesh> mesh = LoadPredictionSchemeMesh(att_type);
+  size_t encoded_size = 0;
+  const MemoryCounters memory_counters;
+  for (auto _ : state) {
+    EncoderBuffer buffer;
+    if (!EncodeWithPredictionScheme(*mesh, att_type, scheme, &buffer)) {
+      state.SkipWithError("Failed to encode the mesh.");
+      return;
+    }
+    encoded_size = buffer.size();
+  }
+  SetMeshCounters(state, *mesh, encoded_size);
+  memory_counters.Report(state);
+}
+
+void BM_PredictionSchemeDecode(benchmark::State &state,
+                               GeometryAttribute::Type att_type,
+                               PredictionSchemeMethod scheme) {
+  const std::unique_ptr<Mesh> mesh = LoadPredictionSchemeMesh(att_type);
+  EncoderBuffer encoded;
+  if (!EncodeWithPredictionScheme(*mesh, att_type, scheme, &encoded)) {
+    state.SkipWithError("Failed to encode the mesh.");
+    return;
+  }
+  const MemoryCounters memory_counters;
+  for (auto _ : state) {
+    DecoderBuffer buffer;
+    buffer.Init(encoded.data(), encoded.size());
+    Decoder decoder;
+    if (!decoder.DecodeMeshFromBuffer(&buffer).ok()) {
+      state.SkipWithError("Failed to decode the mesh.");
+      return;
+    }
+  }
+  SetMeshCounters(state, *mesh, encoded.size());
+  memory_counters.Report(state);
+}
+
+// Generates |state.range(0)| symbols with a geometric distribution, similar to
+// the distribution of prediction residuals.
+std::vector<uint32_t> GenerateSymbols(const benchmark::State &state) {
+  std::mt19937 generator(1);
+  std::geometric_distribution<uint32_t> distribution(0.05);
+  std::vector<uint32_t> symbols(state.range(0));
+  for (uint32_t &symbol : symbols) {
+    symbol = distribution(generator);
+  }
+  return symbols;
+}
+
+// Encodes |symbols| with the raw rANS coding. Interleaved streams are used
+// when |state.range(1)| is non-zero.
+bool EncodeRAnsSymbols(const benchmark::State &state,
+                       const std::vector<uint32_t> &symbols,
+                       EncoderBuffer *buffer) {
+  Options options;
+  SetSymbolEncodingMethod(&options, SYMBOL_CODING_RAW);
+  if (state.range(1) != 0) {
+    SetSymbolEncodingMethod(&options, SYMBOL_CODING_RAW_INTERLEAVED);
+  }
+  return EncodeSymbols(symbols.data(), static_cast<int>(symbols.size()), 1,
+                       &options, buffer);
+}
+
+void BM_RAnsEncode(benchmark::State &state) {
+  const std::vector<uint32_t> symbols = GenerateSymbols(state);
+  for (auto _ : state) {
+    EncoderBuffer buffer;
+    if (!EncodeRAnsSymbols(state, symbols, &buffer)) {
+      state.SkipWithError("Failed to encode the symbols.");
+      return;
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          symbols.size() * sizeof(uint32_t));
+}
+
+void BM_RAnsDecode(benchmark::State &state) {
+  const std::vector<uint32_t> symbols = GenerateSymbols(state);
+  EncoderBuffer encoded;
+  if (!EncodeRAnsSymbols(state, symbols, &encoded)) {
+    state.SkipWithError("Failed to encode the symbols.");
+    return;
+  }
+  std::vector<uint32_t> decoded(symbols.size());
+  for (auto _ : state) {
+    DecoderBuffer buffer;
+    buffer.Init(encoded.data(), encoded.size());
+    buffer.set_bitstream_version(kDracoMeshBitstreamVersion);
+    if (!DecodeSymbols(static_cast<uint32_t>(decoded.size()), 1, &buffer,
+                       decoded.data())) {
+      state.SkipWithError("Failed to decode the symbols.");
+      return;
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          symbols.size() * sizeof(uint32_t));
+}
+
+// Dequantizes three component values with the vectorized kernels of the SIMD
+// target given by state.range(0).
+void BM_Dequantize(benchmark::State &state) {
+  const SimdTarget target = static_cast<SimdTarget>(state.range(0));
+  const SimdTarget previous_target = GetSimdTarget();
+  if (!ForceSimdTarget(target)) {
+    state.SkipWithError("The SIMD target is not supported by the CPU.");
+    return;
+  }
+  constexpr int kNumComponents = 3;
+  constexpr int64_t kNumValues = 1 << 20;
+  std::vector<int32_t> in(kNumValues * kNumComponents);
+  std::mt19937 generator(0);
+  std::uniform_int_distribution<int32_t> distribution(0, (1 << 14) - 1);
+  for (int32_t &value : in) {
+    value = distribution(generator);
+  }
+  const float offsets[kNumComponents] = {-1.f, 0.f, 1.f};
+  std::vector<float> out(in.size());
+  Dequantizer dequantizer;
+  dequantizer.Init(2.f, (1 << 14) - 1);
+  for (auto _ : state) {
+    dequantizer.DequantizeValues(in.data(), kNumValues, kNumComponents,
+                                 offsets, out.data());
+    benchmark::DoNotOptimize(out.data());
+  }
+  ForceSimdTarget(previous_target);
+  state.SetLabel(SimdTargetName(target));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          in.size() * sizeof(int32_t));
+}
+
+// Encodes points of the test mesh |file_name| with the kd-tree method.
+bool EncodeKdTree(const std::string &file_name, EncoderBuffer *buffer) {
+  const PointCloud &pc = *GetTestMesh(file_name);
+  ExpertEncoder encoder(pc);
+  SetDefaultQuantization(pc, &encoder);
+  encoder.SetEncodingMethod(POINT_CLOUD_KD_TREE_ENCODING);
+  return encoder.EncodeToBuffer(buffer).ok();
+}
+
+void SetPointCloudCounters(benchmark::State &state, const PointCloud &pc,
+                           size_t encoded_size) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          encoded_size);
+  state.counters["points_per_second"] = benchmark::Counter(
+      pc.num_points(), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_KdTreeEncode(benchmark::State &state, const std::string &file_name) {
+  size_t encoded_size = 0;
+  const MemoryCounters memory_counters;
+  for (auto _ : state) {
+    EncoderBuffer buffer;
+    if (!EncodeKdTree(file_name, &buffer)) {
+      state.SkipWithError("Failed to encode the point cloud.");
+      return;
+    }
+    encoded_size = buffer.size();
+  }
+  SetPointCloudCounters(state, *GetTestMesh(file_name), encoded_size);
+  memory_counters.Report(state);
+}
+
+void BM_KdTreeDecode(benchmark::State &state, const std::string &file_name) {
+  EncoderBuffer encoded;
+  if (!EncodeKdTree(file_name, &encoded)) {
+    state.SkipWithError("Failed to encode the point cloud.");
+    return;
+  }
+  const MemoryCounters memory_counters;
+  for (auto _ : state) {
+    DecoderBuffer buffer;
+    buffer.Init(encoded.data(), encoded.size());
+    Decoder decoder;
+    if (!decoder.DecodePointCloudFromBuffer(&buffer).ok()) {
+      state.SkipWithError("Failed to decode the point cloud.");
+      return;
+    }
+  }
+  SetPointCloudCounters(state, *GetTestMesh(file_name), encoded.size());
+  memory_counters.Report(state);
+}
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+void BM_GltfLoad(benchmark::State &state, const std::string &file_name) {
+  const std::string path = GetTestFileFullPath(file_name);
+  const MemoryCounters memory_counters;
+  for (auto _ : state) {
+    if (!ReadSceneFromFile(path).ok()) {
+      state.SkipWithError("Failed to load the scene.");
+      return;
+    }
+  }
+  const size_t file_size = GetFileSize(path);
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          file_size);
+  memory_counters.Report(state);
+}
+
+void BM_GltfSave(benchmark::State &state, const std::string &file_name) {
+  const std::unique_ptr<Scene> scene =
+      ReadSceneFromFile(GetTestFileFullPath(file_name)).value();
+  size_t encoded_size = 0;
+  const MemoryCounters memory_counters;
+  for (auto _ : state) {
+    EncoderBuffer buffer;
+    GltfEncoder encoder;
+    if (!encoder.EncodeToBuffer(*scene, &buffer).ok()) {
+      state.SkipWithError("Failed to save the scene.");
+      return;
+    }
+    encoded_size = buffer.size();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          encoded_size);
+  memory_counters.Report(state);
+}
+
+// Encodes the skinned mesh |file_name| using |scheme| for its joint and weight
+// attributes. The encoded size is reported in the "encoded_bytes" counter.
+void BM_SkinPredictionSchemeEncode(benchmark::State &state,
+                                   const std::string &file_name,
+                                   PredictionSchemeMethod scheme) {
+  const Mesh &mesh = *GetTestMesh(file_name);
+  const int joints_att_id = mesh.GetNamedAttributeId(GeometryAttribute::JOINTS);
+  const int weights_att_id =
+      mesh.GetNamedAttributeId(GeometryAttribute::WEIGHTS);
+  if (joints_att_id < 0 || weights_att_id < 0) {
+    state.SkipWithError("The mesh is not skinned.");
+    return;
+  }
+  ExpertEncoder encoder(mesh);
+  SetDefaultQuantization(mesh, &encoder);
+  encoder.SetAttributeQuantization(weights_att_id, 8);
+  encoder.SetEncodingMethod(MESH_EDGEBREAKER_ENCODING);
+  if (!encoder.SetAttributePredictionScheme(joints_att_id, scheme).ok() ||
+      !encoder.SetAttributePredictionScheme(weights_att_id, scheme).ok()) {
+    state.SkipWithError("Failed to set the prediction scheme.");
+    return;
+  }
+  size_t encoded_size = 0;
+  const MemoryCounters memory_counters;
+  for (auto _ : state) {
+    EncoderBuffer buffer;
+    if (!encoder.EncodeToBuffer(&buffer).ok()) {
+      state.SkipWithError("Failed to encode the mesh.");
+      return;
+    }
+    encoded_size = buffer.size();
+  }
+  SetMeshCounters(state, mesh, encoded_size);
+  state.counters["encoded_bytes"] = encoded_size;
+  memory_counters.Report(state);
+}
+#endif  // DRACO_TRANSCODER_SUPPORTED
+
+BENCHMARK_CAPTURE(BM_EdgebreakerEncode, bunny, std::string("bunny_norm.obj"))
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_EdgebreakerEncode, zipper, std::string("bun_zipper.ply"))
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_EdgebreakerEncode, cube, std::string("cube_subd.obj"))
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_EdgebreakerDecode, bunny, std::string("bunny_norm.obj"),
+                  false)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_EdgebreakerDecode, zipper, std::string("bun_zipper.ply"),
+                  false)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_EdgebreakerDecode, cube, std::string("cube_subd.obj"),
+                  false)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_EdgebreakerDecode, bunny_connectivity_only,
+                  std::string("bunny_norm.obj"), true)
+    ->Unit(benchmark::kMillisecond);
+// Small meshes where the per-call overhead of the decoder dominates.
+BENCHMARK_CAPTURE(BM_EdgebreakerDecode, small_cube_att,
+                  std::string("cube_att.obj"), false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EdgebreakerDecode, small_test_nm,
+                  std::string("test_nm.obj"), false)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_CornerTableTraversal, depth_first,
+                  std::string("bun_zipper.ply"), MESH_TRAVERSAL_DEPTH_FIRST,
+                  false)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CornerTableTraversal, depth_first_packed,
+                  std::string("bun_zipper.ply"), MESH_TRAVERSAL_DEPTH_FIRST,
+                  true)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CornerTableTraversal, prediction_degree,
+                  std::string("bun_zipper.ply"),
+                  MESH_TRAVERSAL_PREDICTION_DEGREE, false)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CornerTableTraversal, prediction_degree_packed,
+                  std::string("bun_zipper.ply"),
+                  MESH_TRAVERSAL_PREDICTION_DEGREE, true)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_CornerTableCreate, zipper, std::string("bun_zipper.ply"))
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(3)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+#define DRACO_BENCHMARK_PREDICTION_SCHEME(att_type, scheme)              \
+  BENCHMARK_CAPTURE(BM_PredictionSchemeEncode, scheme,                   \
+                    GeometryAttribute::att_type, scheme)                 \
+      ->Unit(benchmark::kMillisecond);                                   \
+  BENCHMARK_CAPTURE(BM_PredictionSchemeDecode, scheme,                   \
+                    GeometryAttribute::att_type, scheme)                 \
+      ->Unit(benchmark::kMillisecond)
+
+DRACO_BENCHMARK_PREDICTION_SCHEME(POSITION, PREDICTION_DIFFERENCE);
+DRACO_BENCHMARK_PREDICTION_SCHEME(POSITION, MESH_PREDICTION_PARALLELOGRAM);
+DRACO_BENCHMARK_PREDICTION_SCHEME(
+    POSITION, MESH_PREDICTION_CONSTRAINED_MULTI_PARALLELOGRAM);
+DRACO_BENCHMARK_PREDICTION_SCHEME(TEX_COORD,
+                                  MESH_PREDICTION_TEX_COORDS_PORTABLE);
+DRACO_BENCHMARK_PREDICTION_SCHEME(NORMAL, MESH_PREDICTION_GEOMETRIC_NORMAL);
+
+// Arguments are the number of symbols and whether interleaved rANS streams are
+// used.
+BENCHMARK(BM_RAnsEncode)->ArgsProduct({{1 << 12, 1 << 20}, {0, 1}});
+BENCHMARK(BM_RAnsDecode)->ArgsProduct({{1 << 12, 1 << 20}, {0, 1}});
+
+BENCHMARK(BM_Dequantize)
+    ->Arg(SIMD_TARGET_SCALAR)
+    ->Arg(SIMD_TARGET_SSE4_1)
+    ->Arg(SIMD_TARGET_AVX2)
+    ->Arg(SIMD_TARGET_AVX512)
+    ->Arg(SIMD_TARGET_NEON);
+
+BENCHMARK_CAPTURE(BM_KdTreeEncode, zipper, std::string("bun_zipper.ply"))
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_KdTreeDecode, zipper, std::string("bun_zipper.ply"))
+    ->Unit(benchmark::kMillisecond);
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+BENCHMARK_CAPTURE(BM_GltfLoad, lantern,
+                  std::string("Lantern/glTF/Lantern.gltf"))
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_GltfLoad, cesium_man,
+                  std::string("CesiumMan/glTF/CesiumMan.gltf"))
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_GltfSave, lantern,
+                  std::string("Lantern/glTF/Lantern.gltf"))
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_GltfSave, cesium_man,
+                  std::string("CesiumMan/glTF/CesiumMan.gltf"))
+    ->Unit(benchmark::kMillisecond);
+
+#define DRACO_BENCHMARK_SKIN_PREDICTION_SCHEME(name, file_name, scheme) \
+  BENCHMARK_CAPTURE(BM_SkinPredictionSchemeEncode, name##_##scheme,     \
+                    std::string(file_name), scheme)                     \
+      ->Unit(benchmark::kMillisecond)
+
+DRACO_BENCHMARK_SKIN_PREDICTION_SCHEME(cesium_man,
+                                       "CesiumMan/glTF/CesiumMan.gltf",
+                                       PREDICTION_DIFFERENCE);
+DRACO_BENCHMARK_SKIN_PREDICTION_SCHEME(cesium_man,
+                                       "CesiumMan/glTF/CesiumMan.gltf",
+                                       MESH_PREDICTION_PARALLELOGRAM);
+DRACO_BENCHMARK_SKIN_PREDICTION_SCHEME(cesium_man,
+                                       "CesiumMan/glTF/CesiumMan.gltf",
+                                       MESH_PREDICTION_SKIN);
+DRACO_BENCHMARK_SKIN_PREDICTION_SCHEME(fox, "Fox/glTF/Fox.gltf",
+                                       PREDICTION_DIFFERENCE);
+DRACO_BENCHMARK_SKIN_PREDICTION_SCHEME(fox, "Fox/glTF/Fox.gltf",
+                                       MESH_PREDICTION_PARALLELOGRAM);
+DRACO_BENCHMARK_SKIN_PREDICTION_SCHEME(fox, "Fox/glTF/Fox.gltf",
+                                       MESH_PREDICTION_SKIN);
+#endif  // DRACO_TRANSCODER_SUPPORTED
+
+}  // namespace
+}  // namespace draco
+
+// Replacements of the global allocation functions used for counting the
+// allocations. The over-aligned variants are not replaced and never counted.
+void *operator new(size_t size) {
+  void *const ptr = draco::CountedAllocate(size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  return draco::CountedAllocate(size);
+}
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+  return draco::CountedAllocate(size);
+}
+void operator delete(void *ptr) noexcept { draco::CountedFree(ptr); }
+void operator delete[](void *ptr) noexcept { draco::CountedFree(ptr); }
+void operator delete(void *ptr, size_t) noexcept { draco::CountedFree(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { draco::CountedFree(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+  draco::CountedFree(ptr);
+}
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+  draco::CountedFree(ptr);
+}
+
+BENCHMARK_MAIN();
@@ -12,15 +12,21 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <algorithm>
 #include <cinttypes>
+#include <cstdlib>
+#include <string>
+#include <vector>
 
 #include "draco/compression/decode.h"
+#include "draco/core/coding_stats.h"
 #include "draco/core/cycle_timer.h"
 #include "draco/io/file_utils.h"
 #include "draco/io/obj_encoder.h"
 #include "draco/io/parser_utils.h"
 #include "draco/io/ply_encoder.h"
 #include "draco/io/stl_encoder.h"
+#include "draco/tools/draco_batch_lib.h"
 
 namespace {
 
@@ -29,16 +35,44 @@ struct Options {
 
   std::string input;
   std::string output;
+  bool print_stats;
+  bool perf_counters;
+  // Number of timed decoding runs in benchmark mode or 0 when disabled.
+  int benchmark_runs;
+  // Batch mode options.
+  std::string manifest;
+  int num_workers;
 };
 
-Options::Options() {}
+Options::Options()
+    : print_stats(false),
+      perf_counters(false),
+      benchmark_runs(0),
+      num_workers(1) {}
 
 void Usage() {
   printf("Usage: draco_decoder [options] -i input\n");
+  printf("       draco_decoder [options] --manifest file_list\n");
   printf("\n");
   printf("Main options:\n");
   printf("  -h | -?               show help.\n");
   printf("  -o <output>           output file name.\n");
+  printf(
+      "  --stats               print time and size of individual decoding "
+      "stages.\n");
+  printf(
+      "  --perf_counters       like --stats, also print cycles, IPC, cache and\n"
+      "                        branch misses of the stages (Linux only).\n");
+  printf(
+      "  --benchmark <runs>    decode the input the given number of times from\n"
+      "                        memory after a warmup run and print latency and\n"
+      "                        throughput statistics. No output is written.\n");
+  printf("\nBatch options:\n");
+  printf(
+      "  --manifest <file>     decode all files listed in the manifest, one "
+      "\"input [output]\"\n"
+      "                        per line. Output defaults to input.ply.\n");
+  printf("  -j <value>            number of parallel workers, default=1.\n");
 }
 
 int ReturnError(const draco::Status &status) {
@@ -46,34 +80,18 @@ int ReturnError(const draco::Status &status) {
   return -1;
 }
 
-}  // namespace
-
-int main(int argc, char **argv) {
-  Options options;
-  const int argc_check = argc - 1;
-
-  for (int i = 1; i < argc; ++i) {
-    if (!strcmp("-h", argv[i]) || !strcmp("-?", argv[i])) {
-      Usage();
-      return 0;
-    } else if (!strcmp("-i", argv[i]) && i < argc_check) {
-      options.input = argv[++i];
-    } else if (!strcmp("-o", argv[i]) && i < argc_check) {
-      options.output = argv[++i];
-    }
-  }
-  if (argc < 3 || options.input.empty()) {
-    Usage();
-    return -1;
-  }
-
-  std::vector<char> data;
-  if (!draco::ReadFileToBuffer(options.input, &data)) {
+// Decodes |input| and stores the decoded geometry into |output|. Progress is
+// printed only when |verbose| is set.
+int DecodeFile(const Options &options, const std::string &input,
+               const std::string &output, bool verbose) {
+  // The input file is mapped into memory when supported by the platform.
+  draco::FileContents data;
+  if (!data.Open(input)) {
     printf("Failed opening the input file.\n");
     return -1;
   }
 
-  if (data.empty()) {
+  if (data.size() == 0) {
     printf("Empty input file.\n");
     return -1;
   }
@@ -83,6 +101,9 @@ int main(int argc, char **argv) {
   buffer.Init(data.data(), data.size());
 
   draco::CycleTimer timer;
+  draco::CodingStats stats;
+  stats.SetHardwareCountersEnabled(options.perf_counters);
+  draco::CodingStats *const stats_ptr = options.print_stats ? &stats : nullptr;
   // Decode the input data into a geometry.
   std::unique_ptr<draco::PointCloud> pc;
   draco::Mesh *mesh = nullptr;
@@ -94,6 +115,7 @@ int main(int argc, char **argv) {
   if (geom_type == draco::TRIANGULAR_MESH) {
     timer.Start();
     draco::Decoder decoder;
+    decoder.options()->SetCodingStats(stats_ptr);
     auto statusor = decoder.DecodeMeshFromBuffer(&buffer);
     if (!statusor.ok()) {
       return ReturnError(statusor.status());
@@ -108,6 +130,7 @@ int main(int argc, char **argv) {
     // Failed to decode it as mesh, so let's try to decode it as a point cloud.
     timer.Start();
     draco::Decoder decoder;
+    decoder.options()->SetCodingStats(stats_ptr);
     auto statusor = decoder.DecodePointCloudFromBuffer(&buffer);
     if (!statusor.ok()) {
       return ReturnError(statusor.status());
@@ -121,26 +144,21 @@ int main(int argc, char **argv) {
     return -1;
   }
 
-  if (options.output.empty()) {
-    // Save the output model into a ply file.
-    options.output = options.input + ".ply";
-  }
-
   // Save the decoded geometry into a file.
   const std::string extension = draco::parser::ToLower(
-      options.output.size() >= 4
-          ? options.output.substr(options.output.size() - 4)
-          : options.output);
+      output.size() >= 4
+          ? output.substr(output.size() - 4)
+          : output);
 
   if (extension == ".obj") {
     draco::ObjEncoder obj_encoder;
     if (mesh) {
-      if (!obj_encoder.EncodeToFile(*mesh, options.output)) {
+      if (!obj_encoder.EncodeToFile(*mesh, output)) {
         printf("Failed to store the decoded mesh as OBJ.\n");
         return -1;
       }
     } else {
-      if (!obj_encoder.EncodeToFile(*pc, options.output)) {
+      if (!obj_encoder.EncodeToFile(*pc, output)) {
         printf("Failed to store the decoded point cloud as OBJ.\n");
         return -1;
       }
@@ -148,12 +166,12 @@ int main(int argc, char **argv) {
   } else if (extension == ".ply") {
     draco::PlyEncoder ply_encoder;
     if (mesh) {
-      if (!ply_encoder.EncodeToFile(*mesh, options.output)) {
+      if (!ply_encoder.EncodeToFile(*mesh, output)) {
         printf("Failed to store the decoded mesh as PLY.\n");
         return -1;
       }
     } else {
-      if (!ply_encoder.EncodeToFile(*pc, options.output)) {
+      if (!ply_encoder.EncodeToFile(*pc, output)) {
         printf("Failed to store the decoded point cloud as PLY.\n");
         return -1;
       }
@@ -161,7 +179,7 @@ int main(int argc, char **argv) {
   } else if (extension == ".stl") {
     draco::StlEncoder stl_encoder;
     if (mesh) {
-      draco::Status s = stl_encoder.EncodeToFile(*mesh, options.output);
+      draco::Status s = stl_encoder.EncodeToFile(*mesh, output);
       if (s.code() != draco::Status::OK) {
         printf("Failed to store the decoded mesh as STL.\n");
         return -1;
@@ -174,7 +192,127 @@ int main(int argc, char **argv) {
     printf("Invalid output file extension. Use .obj .ply or .stl.\n");
     return -1;
   }
-  printf("Decoded geometry saved to %s (%" PRId64 " ms to decode)\n",
-         options.output.c_str(), timer.GetInMs());
+  if (verbose) {
+    printf("Decoded geometry saved to %s (%" PRId64 " ms to decode)\n",
+           output.c_str(), timer.GetInMs());
+    if (options.print_stats) {
+      printf("\n%s", stats.ToString().c_str());
+    }
+  }
+  return 0;
+}
+
+// Decodes |input| |options.benchmark_runs| times from memory after a warmup
+// run and prints latency and throughput statistics of the runs. With --stats,
+// the stage timings are accumulated over all timed runs.
+int BenchmarkFile(const Options &options, const std::string &input) {
+  std::vector<char> data;
+  if (!draco::ReadFileToBuffer(input, &data) || data.empty()) {
+    printf("Failed opening the input file.\n");
+    return -1;
+  }
+  draco::CodingStats stats;
+  stats.SetHardwareCountersEnabled(options.perf_counters);
+  std::vector<int64_t> times_us;
+  int64_t num_faces = 0;
+  int64_t num_points = 0;
+  // Run -1 is the warmup run.
+  for (int run = -1; run < options.benchmark_runs; ++run) {
+    draco::DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    draco::Decoder decoder;
+    if (run >= 0 && options.print_stats) {
+      decoder.options()->SetCodingStats(&stats);
+    }
+    draco::CycleTimer timer;
+    timer.Start();
+    auto statusor = decoder.DecodePointCloudFromBuffer(&buffer);
+    timer.Stop();
+    if (!statusor.ok()) {
+      return ReturnError(statusor.status());
+    }
+    if (run >= 0) {
+      times_us.push_back(timer.GetInUs());
+    }
+    const draco::PointCloud *const pc = statusor.value().get();
+    num_points = pc->num_points();
+    const draco::Mesh *const mesh = dynamic_cast<const draco::Mesh *>(pc);
+    num_faces = mesh ? mesh->num_faces() : 0;
+  }
+
+  std::sort(times_us.begin(), times_us.end());
+  const size_t num_runs = times_us.size();
+  const int64_t median_us = times_us[num_runs / 2];
+  const size_t p99_index = std::min(num_runs - 1, num_runs * 99 / 100);
+  // Avoid division by zero for very small inputs.
+  const double median_s = std::max<int64_t>(median_us, 1) / 1e6;
+  printf("Benchmark of %s (%zu runs after a warmup run):\n", input.c_str(),
+         num_runs);
+  printf("  Latency: min %.3f ms, median %.3f ms, p99 %.3f ms\n",
+         times_us[0] / 1e3, median_us / 1e3, times_us[p99_index] / 1e3);
+  printf(
+      "  Throughput at median: %.2f MB/s compressed, %.2f M faces/s, "
+      "%.2f M points/s\n",
+      data.size() / median_s / (1 << 20), num_faces / median_s / 1e6,
+      num_points / median_s / 1e6);
+  if (options.print_stats) {
+    printf("\nStages accumulated over all timed runs:\n%s",
+           stats.ToString().c_str());
+  }
   return 0;
 }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  const int argc_check = argc - 1;
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp("-h", argv[i]) || !strcmp("-?", argv[i])) {
+      Usage();
+      return 0;
+    } else if (!strcmp("-i", argv[i]) && i < argc_check) {
+      options.input = argv[++i];
+    } else if (!strcmp("-o", argv[i]) && i < argc_check) {
+      options.output = argv[++i];
+    } else if (!strcmp("--stats", argv[i])) {
+      options.print_stats = true;
+    } else if (!strcmp("--perf_counters", argv[i])) {
+      options.print_stats = true;
+      options.perf_counters = true;
+    } else if (!strcmp("--benchmark", argv[i]) && i < argc_check) {
+      options.benchmark_runs = atoi(argv[++i]);
+    } else if (!strcmp("--manifest", argv[i]) && i < argc_check) {
+      options.manifest = argv[++i];
+    } else if (!strcmp("-j", argv[i]) && i < argc_check) {
+      options.num_workers = atoi(argv[++i]);
+    }
+  }
+  if (!options.manifest.empty()) {
+    std::vector<draco::BatchJob> jobs;
+    if (!draco::ReadBatchManifest(options.manifest, ".ply", &jobs)) {
+      printf("Failed reading the manifest file.\n");
+      return -1;
+    }
+    const int num_failed =
+        draco::RunBatchJobs(jobs, options.num_workers,
+                            [&options](const draco::BatchJob &job) {
+                              return DecodeFile(options, job.input, job.output,
+                                                false) == 0;
+                            });
+    return num_failed == 0 ? 0 : -1;
+  }
+  if (argc < 3 || options.input.empty()) {
+    Usage();
+    return -1;
+  }
+  if (options.benchmark_runs > 0) {
+    return BenchmarkFile(options, options.input);
+  }
+  if (options.output.empty()) {
+    // Save the output model into a ply file.
+    options.output = options.input + ".ply";
+  }
+  return DecodeFile(options, options.input, options.output, true);
+}
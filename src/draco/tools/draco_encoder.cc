@@ -14,14 +14,19 @@
 //
 #include <cinttypes>
 #include <cstdlib>
+#include <string>
+#include <vector>
 
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/encode.h"
+#include "draco/compression/encoder_auto_tune.h"
 #include "draco/compression/expert_encode.h"
+#include "draco/core/coding_stats.h"
 #include "draco/core/cycle_timer.h"
 #include "draco/io/file_utils.h"
 #include "draco/io/mesh_io.h"
 #include "draco/io/point_cloud_io.h"
+#include "draco/tools/draco_batch_lib.h"
 
 namespace {
 
@@ -36,11 +41,21 @@ struct Options {
   bool normals_deleted;
   int generic_quantization_bits;
   bool generic_deleted;
+  float max_pos_error;
+  float max_tex_coords_error;
+  int tex_coords_texture_size;
+  float max_normals_angle;
   int compression_level;
   bool preserve_polygons;
   bool use_metadata;
+  int auto_tune_ms;
+  int time_budget_ms;
+  bool print_stats;
   std::string input;
   std::string output;
+  // Batch mode options.
+  std::string manifest;
+  int num_workers;
 };
 
 Options::Options()
@@ -52,12 +67,21 @@ Options::Options()
       normals_deleted(false),
       generic_quantization_bits(8),
       generic_deleted(false),
+      max_pos_error(0.f),
+      max_tex_coords_error(0.f),
+      tex_coords_texture_size(1024),
+      max_normals_angle(0.f),
       compression_level(7),
       preserve_polygons(false),
-      use_metadata(false) {}
+      use_metadata(false),
+      auto_tune_ms(0),
+      time_budget_ms(0),
+      print_stats(false),
+      num_workers(1) {}
 
 void Usage() {
   printf("Usage: draco_encoder [options] -i input\n");
+  printf("       draco_encoder [options] --manifest file_list\n");
   printf("\n");
   printf("Main options:\n");
   printf("  -h | -?               show help.\n");
@@ -78,6 +102,19 @@ void Usage() {
   printf(
       "  -qg <value>           quantization bits for any generic attribute, "
       "default=8.\n");
+  printf(
+      "  -ep <value>           maximum error of quantized positions, selects "
+      "-qp.\n");
+  printf(
+      "  -et <value>           maximum error of quantized texture coordinates "
+      "in\n"
+      "                        texels, selects -qt.\n");
+  printf(
+      "  -ts <value>           texture size used by -et, default=1024.\n");
+  printf(
+      "  -en <value>           maximum angle of quantized normals in degrees, "
+      "selects\n"
+      "                        -qn.\n");
   printf(
       "  -cl <value>           compression level [0-10], most=10, least=0, "
       "default=7.\n");
@@ -91,6 +128,24 @@ void Usage() {
   // mesh and polygon reconstruction information is encoded into a new generic
   // attribute.
   printf("  -preserve_polygons    encode polygon info as an attribute.\n");
+  printf(
+      "  -auto_tune <ms>       select prediction schemes by trial encoding "
+      "within\n"
+      "                        the given time budget in milliseconds.\n");
+  printf(
+      "  -time_budget <ms>     lower the compression effort when needed to "
+      "encode\n"
+      "                        within the given time in milliseconds.\n");
+  printf(
+      "  --stats               print time and size of individual encoding "
+      "stages.\n");
+
+  printf("\nBatch options:\n");
+  printf(
+      "  --manifest <file>     encode all files listed in the manifest, one "
+      "\"input [output]\"\n"
+      "                        per line. Output defaults to input.drc.\n");
+  printf("  -j <value>            number of parallel workers, default=1.\n");
 
   printf(
       "\nUse negative quantization values to skip the specified attribute\n");
@@ -101,10 +156,18 @@ int StringToInt(const std::string &s) {
   return strtol(s.c_str(), &end, 10);  // NOLINT
 }
 
+float StringToFloat(const std::string &s) {
+  char *end;
+  return strtof(s.c_str(), &end);
+}
+
 void PrintOptions(const draco::PointCloud &pc, const Options &options) {
   printf("Encoder options:\n");
   printf("  Compression level = %d\n", options.compression_level);
-  if (options.pos_quantization_bits == 0) {
+  if (options.max_pos_error > 0.f) {
+    printf("  Positions: Quantization for max error = %g\n",
+           options.max_pos_error);
+  } else if (options.pos_quantization_bits == 0) {
     printf("  Positions: No quantization\n");
   } else {
     printf("  Positions: Quantization = %d bits\n",
@@ -112,7 +175,11 @@ void PrintOptions(const draco::PointCloud &pc, const Options &options) {
   }
 
   if (pc.GetNamedAttributeId(draco::GeometryAttribute::TEX_COORD) >= 0) {
-    if (options.tex_coords_quantization_bits == 0) {
+    if (options.max_tex_coords_error > 0.f) {
+      printf(
+          "  Texture coordinates: Quantization for max error = %g texels\n",
+          options.max_tex_coords_error);
+    } else if (options.tex_coords_quantization_bits == 0) {
       printf("  Texture coordinates: No quantization\n");
     } else {
       printf("  Texture coordinates: Quantization = %d bits\n",
@@ -123,7 +190,10 @@ void PrintOptions(const draco::PointCloud &pc, const Options &options) {
   }
 
   if (pc.GetNamedAttributeId(draco::GeometryAttribute::NORMAL) >= 0) {
-    if (options.normals_quantization_bits == 0) {
+    if (options.max_normals_angle > 0.f) {
+      printf("  Normals: Quantization for max angle = %g degrees\n",
+             options.max_normals_angle);
+    } else if (options.normals_quantization_bits == 0) {
       printf("  Normals: No quantization\n");
     } else {
       printf("  Normals: Quantization = %d bits\n",
@@ -147,7 +217,7 @@ void PrintOptions(const draco::PointCloud &pc, const Options &options) {
 }
 
 int EncodePointCloudToFile(const draco::PointCloud &pc, const std::string &file,
-                           draco::ExpertEncoder *encoder) {
+                           draco::ExpertEncoder *encoder, bool verbose) {
   draco::CycleTimer timer;
   // Encode the geometry.
   draco::EncoderBuffer buffer;
@@ -164,14 +234,16 @@ int EncodePointCloudToFile(const draco::PointCloud &pc, const std::string &file,
     printf("Failed to write the output file.\n");
     return -1;
   }
-  printf("Encoded point cloud saved to %s (%" PRId64 " ms to encode).\n",
-         file.c_str(), timer.GetInMs());
-  printf("\nEncoded size = %zu bytes\n\n", buffer.size());
+  if (verbose) {
+    printf("Encoded point cloud saved to %s (%" PRId64 " ms to encode).\n",
+           file.c_str(), timer.GetInMs());
+    printf("\nEncoded size = %zu bytes\n\n", buffer.size());
+  }
   return 0;
 }
 
 int EncodeMeshToFile(const draco::Mesh &mesh, const std::string &file,
-                     draco::ExpertEncoder *encoder) {
+                     draco::ExpertEncoder *encoder, bool verbose) {
   draco::CycleTimer timer;
   // Encode the geometry.
   draco::EncoderBuffer buffer;
@@ -188,92 +260,26 @@ int EncodeMeshToFile(const draco::Mesh &mesh, const std::string &file,
     printf("Failed to create the output file.\n");
     return -1;
   }
-  printf("Encoded mesh saved to %s (%" PRId64 " ms to encode).\n", file.c_str(),
-         timer.GetInMs());
-  printf("\nEncoded size = %zu bytes\n\n", buffer.size());
+  if (verbose) {
+    printf("Encoded mesh saved to %s (%" PRId64 " ms to encode).\n",
+           file.c_str(), timer.GetInMs());
+    printf("\nEncoded size = %zu bytes\n\n", buffer.size());
+  }
   return 0;
 }
 
-}  // anonymous namespace
-
-int main(int argc, char **argv) {
-  Options options;
-  const int argc_check = argc - 1;
-
-  for (int i = 1; i < argc; ++i) {
-    if (!strcmp("-h", argv[i]) || !strcmp("-?", argv[i])) {
-      Usage();
-      return 0;
-    } else if (!strcmp("-i", argv[i]) && i < argc_check) {
-      options.input = argv[++i];
-    } else if (!strcmp("-o", argv[i]) && i < argc_check) {
-      options.output = argv[++i];
-    } else if (!strcmp("-point_cloud", argv[i])) {
-      options.is_point_cloud = true;
-    } else if (!strcmp("-qp", argv[i]) && i < argc_check) {
-      options.pos_quantization_bits = StringToInt(argv[++i]);
-      if (options.pos_quantization_bits > 30) {
-        printf(
-            "Error: The maximum number of quantization bits for the position "
-            "attribute is 30.\n");
-        return -1;
-      }
-    } else if (!strcmp("-qt", argv[i]) && i < argc_check) {
-      options.tex_coords_quantization_bits = StringToInt(argv[++i]);
-      if (options.tex_coords_quantization_bits > 30) {
-        printf(
-            "Error: The maximum number of quantization bits for the texture "
-            "coordinate attribute is 30.\n");
-        return -1;
-      }
-    } else if (!strcmp("-qn", argv[i]) && i < argc_check) {
-      options.normals_quantization_bits = StringToInt(argv[++i]);
-      if (options.normals_quantization_bits > 30) {
-        printf(
-            "Error: The maximum number of quantization bits for the normal "
-            "attribute is 30.\n");
-        return -1;
-      }
-    } else if (!strcmp("-qg", argv[i]) && i < argc_check) {
-      options.generic_quantization_bits = StringToInt(argv[++i]);
-      if (options.generic_quantization_bits > 30) {
-        printf(
-            "Error: The maximum number of quantization bits for generic "
-            "attributes is 30.\n");
-        return -1;
-      }
-    } else if (!strcmp("-cl", argv[i]) && i < argc_check) {
-      options.compression_level = StringToInt(argv[++i]);
-    } else if (!strcmp("--skip", argv[i]) && i < argc_check) {
-      if (!strcmp("NORMAL", argv[i + 1])) {
-        options.normals_quantization_bits = -1;
-      } else if (!strcmp("TEX_COORD", argv[i + 1])) {
-        options.tex_coords_quantization_bits = -1;
-      } else if (!strcmp("GENERIC", argv[i + 1])) {
-        options.generic_quantization_bits = -1;
-      } else {
-        printf("Error: Invalid attribute name after --skip\n");
-        return -1;
-      }
-      ++i;
-    } else if (!strcmp("--metadata", argv[i])) {
-      options.use_metadata = true;
-    } else if (!strcmp("-preserve_polygons", argv[i])) {
-      options.preserve_polygons = true;
-    }
-  }
-  if (argc < 3 || options.input.empty()) {
-    Usage();
-    return -1;
-  }
-
+// Encodes |input| into |output|. |options| are passed by value because the
+// function records which attributes were skipped. Progress is printed only
+// when |verbose| is set.
+int EncodeFile(Options options, const std::string &input,
+               const std::string &output, bool verbose) {
   std::unique_ptr<draco::PointCloud> pc;
   draco::Mesh *mesh = nullptr;
   if (!options.is_point_cloud) {
     draco::Options load_options;
     load_options.SetBool("use_metadata", options.use_metadata);
     load_options.SetBool("preserve_polygons", options.preserve_polygons);
-    auto maybe_mesh = draco::ReadMeshFromFile(options.input, load_options);
+    auto maybe_mesh = draco::ReadMeshFromFile(input, load_options);
     if (!maybe_mesh.ok()) {
       printf("Failed loading the input mesh: %s.\n",
              maybe_mesh.status().error_msg());
@@ -282,7 +288,7 @@ int main(int argc, char **argv) {
     mesh = maybe_mesh.value().get();
     pc = std::move(maybe_mesh).value();
   } else {
-    auto maybe_pc = draco::ReadPointCloudFromFile(options.input);
+    auto maybe_pc = draco::ReadPointCloudFromFile(input);
     if (!maybe_pc.ok()) {
       printf("Failed loading the input point cloud: %s.\n",
              maybe_pc.status().error_msg());
@@ -356,15 +362,29 @@ int main(int argc, char **argv) {
     encoder.SetAttributeQuantization(draco::GeometryAttribute::GENERIC,
                                      options.generic_quantization_bits);
   }
+  // Error bounds override the quantization bits set above.
+  if (options.max_pos_error > 0.f) {
+    encoder.SetAttributeMaxQuantizationError(draco::GeometryAttribute::POSITION,
+                                             options.max_pos_error);
+  }
+  if (options.max_tex_coords_error > 0.f &&
+      options.tex_coords_quantization_bits > 0) {
+    encoder.SetAttributeMaxTexelQuantizationError(
+        draco::GeometryAttribute::TEX_COORD, options.max_tex_coords_error,
+        options.tex_coords_texture_size, options.tex_coords_texture_size);
+  }
+  if (options.max_normals_angle > 0.f &&
+      options.normals_quantization_bits > 0) {
+    encoder.SetAttributeMaxQuantizationError(
+        draco::GeometryAttribute::NORMAL,
+        options.max_normals_angle * static_cast<float>(M_PI) / 180.f);
+  }
   encoder.SetSpeedOptions(speed, speed);
 
-  if (options.output.empty()) {
-    // Create a default output file by attaching .drc to the input file name.
-    options.output = options.input + ".drc";
+  if (verbose) {
+    PrintOptions(*pc, options);
   }
 
-  PrintOptions(*pc, options);
-
   const bool input_is_mesh = mesh && mesh->num_faces() > 0;
 
   // Convert to ExpertEncoder that allows us to set per-attribute options.
@@ -386,15 +406,53 @@ int main(int argc, char **argv) {
         poly_att_id, draco::PredictionSchemeMethod::PREDICTION_NONE);
   }
 
+  if (options.auto_tune_ms > 0) {
+    draco::AutoTuneOptions auto_tune_options;
+    auto_tune_options.time_budget_ms = options.auto_tune_ms;
+    const draco::Status status =
+        input_is_mesh ? draco::AutoTunePredictionSchemes(
+                            *mesh, auto_tune_options, expert_encoder.get())
+                      : draco::AutoTunePredictionSchemes(
+                            *pc, auto_tune_options, expert_encoder.get());
+    if (!status.ok()) {
+      printf("Failed to tune the encoder options: %s\n", status.error_msg());
+      return -1;
+    }
+  }
+
+  if (options.time_budget_ms > 0) {
+    draco::TimeBudgetOptions time_budget_options;
+    time_budget_options.time_budget_ms = options.time_budget_ms;
+    const draco::Status status =
+        input_is_mesh ? draco::SelectEncoderOptionsForTimeBudget(
+                            *mesh, time_budget_options, expert_encoder.get())
+                      : draco::SelectEncoderOptionsForTimeBudget(
+                            *pc, time_budget_options, expert_encoder.get());
+    if (!status.ok()) {
+      printf("Failed to select the encoder options: %s\n",
+             status.error_msg());
+      return -1;
+    }
+  }
+
+  draco::CodingStats stats;
+  if (options.print_stats) {
+    expert_encoder->options().SetCodingStats(&stats);
+  }
+
   int ret = -1;
 
   if (input_is_mesh) {
-    ret = EncodeMeshToFile(*mesh, options.output, expert_encoder.get());
+    ret = EncodeMeshToFile(*mesh, output, expert_encoder.get(), verbose);
   } else {
-    ret = EncodePointCloudToFile(*pc, options.output, expert_encoder.get());
+    ret = EncodePointCloudToFile(*pc, output, expert_encoder.get(), verbose);
+  }
+
+  if (ret != -1 && verbose && options.print_stats) {
+    printf("%s\n", stats.ToString().c_str());
   }
 
-  if (ret != -1 && options.compression_level < 10) {
+  if (ret != -1 && verbose && options.compression_level < 10) {
     printf(
         "For better compression, increase the compression level up to '-cl 10' "
         ".\n\n");
@@ -402,3 +460,114 @@ int main(int argc, char **argv) {
 
   return ret;
 }
+
+}  // anonymous namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  const int argc_check = argc - 1;
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp("-h", argv[i]) || !strcmp("-?", argv[i])) {
+      Usage();
+      return 0;
+    } else if (!strcmp("-i", argv[i]) && i < argc_check) {
+      options.input = argv[++i];
+    } else if (!strcmp("-o", argv[i]) && i < argc_check) {
+      options.output = argv[++i];
+    } else if (!strcmp("-point_cloud", argv[i])) {
+      options.is_point_cloud = true;
+    } else if (!strcmp("-qp", argv[i]) && i < argc_check) {
+      options.pos_quantization_bits = StringToInt(argv[++i]);
+      if (options.pos_quantization_bits > 30) {
+        printf(
+            "Error: The maximum number of quantization bits for the position "
+            "attribute is 30.\n");
+        return -1;
+      }
+    } else if (!strcmp("-qt", argv[i]) && i < argc_check) {
+      options.tex_coords_quantization_bits = StringToInt(argv[++i]);
+      if (options.tex_coords_quantization_bits > 30) {
+        printf(
+            "Error: The maximum number of quantization bits for the texture "
+            "coordinate attribute is 30.\n");
+        return -1;
+      }
+    } else if (!strcmp("-qn", argv[i]) && i < argc_check) {
+      options.normals_quantization_bits = StringToInt(argv[++i]);
+      if (options.normals_quantization_bits > 30) {
+        printf(
+            "Error: The maximum number of quantization bits for the normal "
+            "attribute is 30.\n");
+        return -1;
+      }
+    } else if (!strcmp("-qg", argv[i]) && i < argc_check) {
+      options.generic_quantization_bits = StringToInt(argv[++i]);
+      if (options.generic_quantization_bits > 30) {
+        printf(
+            "Error: The maximum number of quantization bits for generic "
+            "attributes is 30.\n");
+        return -1;
+      }
+    } else if (!strcmp("-ep", argv[i]) && i < argc_check) {
+      options.max_pos_error = StringToFloat(argv[++i]);
+    } else if (!strcmp("-et", argv[i]) && i < argc_check) {
+      options.max_tex_coords_error = StringToFloat(argv[++i]);
+    } else if (!strcmp("-ts", argv[i]) && i < argc_check) {
+      options.tex_coords_texture_size = StringToInt(argv[++i]);
+    } else if (!strcmp("-en", argv[i]) && i < argc_check) {
+      options.max_normals_angle = StringToFloat(argv[++i]);
+    } else if (!strcmp("-cl", argv[i]) && i < argc_check) {
+      options.compression_level = StringToInt(argv[++i]);
+    } else if (!strcmp("--skip", argv[i]) && i < argc_check) {
+      if (!strcmp("NORMAL", argv[i + 1])) {
+        options.normals_quantization_bits = -1;
+      } else if (!strcmp("TEX_COORD", argv[i + 1])) {
+        options.tex_coords_quantization_bits = -1;
+      } else if (!strcmp("GENERIC", argv[i + 1])) {
+        options.generic_quantization_bits = -1;
+      } else {
+        printf("Error: Invalid attribute name after --skip\n");
+        return -1;
+      }
+      ++i;
+    } else if (!strcmp("--metadata", argv[i])) {
+      options.use_metadata = true;
+    } else if (!strcmp("-preserve_polygons", argv[i])) {
+      options.preserve_polygons = true;
+    } else if (!strcmp("-auto_tune", argv[i]) && i < argc_check) {
+      options.auto_tune_ms = StringToInt(argv[++i]);
+    } else if (!strcmp("-time_budget", argv[i]) && i < argc_check) {
+      options.time_budget_ms = StringToInt(argv[++i]);
+    } else if (!strcmp("--stats", argv[i])) {
+      options.print_stats = true;
+    } else if (!strcmp("--manifest", argv[i]) && i < argc_check) {
+      options.manifest = argv[++i];
+    } else if (!strcmp("-j", argv[i]) && i < argc_check) {
+      options.num_workers = StringToInt(argv[++i]);
+    }
+  }
+  if (!options.manifest.empty()) {
+    std::vector<draco::BatchJob> jobs;
+    if (!draco::ReadBatchManifest(options.manifest, ".drc", &jobs)) {
+      printf("Failed reading the manifest file.\n");
+      return -1;
+    }
+    const int num_failed =
+        draco::RunBatchJobs(jobs, options.num_workers,
+                            [&options](const draco::BatchJob &job) {
+                              return EncodeFile(options, job.input, job.output,
+                                                false) == 0;
+                            });
+    return num_failed == 0 ? 0 : -1;
+  }
+  if (argc < 3 || options.input.empty()) {
+    Usage();
+    return -1;
+  }
+  if (options.output.empty()) {
+    // Create a default output file by attaching .drc to the input file name.
+    options.output = options.input + ".drc";
+  }
+  return EncodeFile(options, options.input, options.output, true);
+}
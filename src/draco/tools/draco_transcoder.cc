@@ -14,9 +14,14 @@
 //
 #include <cinttypes>
 #include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "draco/core/cycle_timer.h"
 #include "draco/core/status.h"
+#include "draco/core/status_or.h"
 #include "draco/draco_features.h"
 #include "draco/texture/texture_utils.h"
 #include "draco/tools/draco_transcoder_lib.h"
@@ -31,6 +36,22 @@ void Usage() {
   printf("  -h | -?         show help.\n");
   printf("  -i <input>      input file name.\n");
   printf("  -o <output>     output file name.\n");
+  printf("  -batch <file>   manifest with one \"input output\" pair per ");
+  printf("line, replaces -i and -o.\n");
+  printf("  -threads <n>    number of threads used in batch mode, ");
+  printf("default=1.\n");
+  printf("  -cache <dir>    directory of a cache of encoded meshes that is ");
+  printf("reused across runs.\n");
+  printf("  -dedup_meshes   replace meshes with identical geometry by ");
+  printf("instances of one mesh.\n");
+  printf("  -reuse_draco    keep Draco compressed input primitives that ");
+  printf("satisfy the quantization options.\n");
+  printf("  -codec <name>   codec of the meshes: draco, meshopt or auto, ");
+  printf("default=draco.\n");
+  printf("  -meshopt_ratio <value>  largest meshopt to Draco size ratio ");
+  printf("accepted by -codec auto, default=1.5.\n");
+  printf("  -lods <ratios>  comma separated face ratios of levels of detail ");
+  printf("written next to the output, e.g. 0.5,0.25.\n");
   printf("  -qp <value>     quantization bits for the position attribute, ");
   printf("default=11.\n");
   printf("  -qt <value>     quantization bits for the texture coordinate ");
@@ -76,11 +97,68 @@ draco::Status TranscodeFile(
   return draco::OkStatus();
 }
 
+// Reads the input and output file names from the |manifest_filename|. Each
+// line contains an input and an output file name separated by whitespace.
+// Empty lines and lines starting with '#' are ignored.
+draco::Status ReadManifest(
+    const std::string &manifest_filename,
+    std::vector<draco::DracoTranscoder::FileOptions> *files) {
+  std::ifstream manifest(manifest_filename);
+  if (!manifest) {
+    return draco::Status(draco::Status::IO_ERROR,
+                         "Unable to open " + manifest_filename + ".");
+  }
+  std::string line;
+  while (std::getline(manifest, line)) {
+    std::istringstream line_stream(line);
+    draco::DracoTranscoder::FileOptions file_options;
+    if (!(line_stream >> file_options.input_filename) ||
+        file_options.input_filename[0] == '#') {
+      continue;
+    }
+    if (!(line_stream >> file_options.output_filename)) {
+      return draco::Status(draco::Status::DRACO_ERROR,
+                           "Missing output file name for " +
+                               file_options.input_filename + ".");
+    }
+    files->push_back(file_options);
+  }
+  return draco::OkStatus();
+}
+
+// Transcodes all files listed in |manifest_filename| on |num_threads|
+// threads. Returns the number of files that failed.
+draco::StatusOr<int> TranscodeManifest(
+    const std::string &manifest_filename, int num_threads,
+    const draco::DracoTranscodingOptions &transcode_options) {
+  std::vector<draco::DracoTranscoder::FileOptions> files;
+  DRACO_RETURN_IF_ERROR(ReadManifest(manifest_filename, &files));
+  draco::CycleTimer timer;
+  timer.Start();
+  std::vector<draco::Status> statuses;
+  DRACO_RETURN_IF_ERROR(draco::DracoTranscoder::TranscodeBatch(
+      transcode_options, files, num_threads, &statuses));
+  timer.Stop();
+  int num_failed = 0;
+  for (size_t i = 0; i < files.size(); ++i) {
+    if (!statuses[i].ok()) {
+      printf("Failed\t%s\t%s\n", files[i].input_filename.c_str(),
+             statuses[i].error_msg());
+      ++num_failed;
+    }
+  }
+  printf("TranscodeBatch\t%zu files\t%" PRId64 "\n", files.size(),
+         timer.GetInMs());
+  return num_failed;
+}
+
 }  // anonymous namespace
 
 int main(int argc, char **argv) {
   draco::DracoTranscoder::FileOptions file_options;
   draco::DracoTranscodingOptions transcode_options;
+  std::string manifest_filename;
+  int num_threads = 1;
   const int argc_check = argc - 1;
 
   for (int i = 1; i < argc; ++i) {
@@ -91,6 +169,36 @@ int main(int argc, char **argv) {
       file_options.input_filename = argv[++i];
     } else if (!strcmp("-o", argv[i]) && i < argc_check) {
       file_options.output_filename = argv[++i];
+    } else if (!strcmp("-batch", argv[i]) && i < argc_check) {
+      manifest_filename = argv[++i];
+    } else if (!strcmp("-threads", argv[i]) && i < argc_check) {
+      num_threads = StringToInt(argv[++i]);
+    } else if (!strcmp("-cache", argv[i]) && i < argc_check) {
+      transcode_options.cache_directory = argv[++i];
+    } else if (!strcmp("-codec", argv[i]) && i < argc_check) {
+      const std::string codec = argv[++i];
+      if (codec == "meshopt") {
+        transcode_options.compression_codec = draco::GltfEncoder::MESHOPT;
+      } else if (codec == "auto") {
+        transcode_options.compression_codec = draco::GltfEncoder::AUTO;
+      } else {
+        transcode_options.compression_codec = draco::GltfEncoder::DRACO;
+      }
+    } else if (!strcmp("-meshopt_ratio", argv[i]) && i < argc_check) {
+      transcode_options.meshopt_max_size_ratio =
+          strtof(argv[++i], nullptr);  // NOLINT
+    } else if (!strcmp("-lods", argv[i]) && i < argc_check) {
+      std::stringstream ratios(argv[++i]);
+      std::string ratio;
+      while (std::getline(ratios, ratio, ',')) {
+        transcode_options.lod_face_ratios.push_back(
+            strtof(ratio.c_str(), nullptr));  // NOLINT
+      }
+    } else if (MatchesBooleanOption("dedup_meshes", argv[i])) {
+      transcode_options.deduplicate_meshes = strncmp("-no", argv[i], 3) != 0;
+    } else if (MatchesBooleanOption("reuse_draco", argv[i])) {
+      transcode_options.reuse_draco_payloads =
+          strncmp("-no", argv[i], 3) != 0;
     } else if (!strcmp("-qp", argv[i]) && i < argc_check) {
       transcode_options.geometry.quantization_position.SetQuantizationBits(
           StringToInt(argv[++i]));
@@ -114,6 +222,16 @@ int main(int argc, char **argv) {
           StringToInt(argv[++i]);
     }
   }
+  if (!manifest_filename.empty()) {
+    const draco::StatusOr<int> num_failed_or =
+        TranscodeManifest(manifest_filename, num_threads, transcode_options);
+    if (!num_failed_or.ok()) {
+      printf("Failed\t%s\t%s\n", manifest_filename.c_str(),
+             num_failed_or.status().error_msg());
+      return -1;
+    }
+    return num_failed_or.value() == 0 ? 0 : -1;
+  }
   if (argc < 3 || file_options.input_filename.empty() ||
       file_options.output_filename.empty()) {
     Usage();
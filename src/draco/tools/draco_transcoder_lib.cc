@@ -15,9 +15,15 @@
 #include "draco/tools/draco_transcoder_lib.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "draco/core/status_or.h"
 #include "draco/io/file_utils.h"
+#include "draco/io/gltf_decoder.h"
 #include "draco/io/scene_io.h"
+#include "draco/mesh/mesh_edge_collapse_simplifier.h"
 #include "draco/scene/scene_utils.h"
 #include "draco/texture/texture_utils.h"
 
@@ -30,6 +36,10 @@ StatusOr<std::unique_ptr<DracoTranscoder>> DracoTranscoder::Create(
   DRACO_RETURN_IF_ERROR(options.geometry.Check());
   std::unique_ptr<DracoTranscoder> dt(new DracoTranscoder());
   dt->transcoding_options_ = options;
+  if (!options.cache_directory.empty()) {
+    dt->mesh_cache_.reset(new DracoMeshCache(options.cache_directory));
+    dt->gltf_encoder_.set_draco_mesh_cache(dt->mesh_cache_.get());
+  }
   return dt;
 }
 
@@ -44,6 +54,48 @@ Status DracoTranscoder::Transcode(const FileOptions &file_options) {
   DRACO_RETURN_IF_ERROR(ReadScene(file_options));
   DRACO_RETURN_IF_ERROR(CompressScene());
   DRACO_RETURN_IF_ERROR(WriteScene(file_options));
+  if (!transcoding_options_.lod_face_ratios.empty()) {
+    DRACO_RETURN_IF_ERROR(WriteLodScenes(file_options));
+  }
+  return OkStatus();
+}
+
+Status DracoTranscoder::TranscodeBatch(const DracoTranscodingOptions &options,
+                                       const std::vector<FileOptions> &files,
+                                       int num_threads,
+                                       std::vector<Status> *statuses) {
+  DRACO_RETURN_IF_ERROR(options.geometry.Check());
+  statuses->assign(files.size(), OkStatus());
+  // The calling thread takes part in the work.
+  std::unique_ptr<ThreadPool> pool;
+  if (num_threads > 1) {
+    pool.reset(new ThreadPool(num_threads - 1));
+  }
+
+  // Transcoders that are not used by any thread. A transcoder holds the scene
+  // being transcoded, so each file needs exclusive access to one.
+  std::vector<std::unique_ptr<DracoTranscoder>> idle_transcoders;
+  std::mutex mutex;
+  ParallelFor(pool.get(), static_cast<int>(files.size()), [&](int i) {
+    std::unique_ptr<DracoTranscoder> transcoder;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!idle_transcoders.empty()) {
+        transcoder = std::move(idle_transcoders.back());
+        idle_transcoders.pop_back();
+      }
+    }
+    if (transcoder == nullptr) {
+      transcoder.reset(new DracoTranscoder());
+      transcoder->transcoding_options_ = options;
+      transcoder->set_thread_pool(pool.get());
+    }
+    (*statuses)[i] = transcoder->Transcode(files[i]);
+    // Release the scene before the transcoder is reused.
+    transcoder->scene_.reset();
+    std::lock_guard<std::mutex> lock(mutex);
+    idle_transcoders.push_back(std::move(transcoder));
+  });
   return OkStatus();
 }
 
@@ -53,12 +105,24 @@ Status DracoTranscoder::ReadScene(const FileOptions &file_options) {
   } else if (file_options.output_filename.empty()) {
     return Status(Status::DRACO_ERROR, "Output filename is empty.");
   }
-  DRACO_ASSIGN_OR_RETURN(scene_,
-                         ReadSceneFromFile(file_options.input_filename));
+  if (transcoding_options_.reuse_draco_payloads) {
+    GltfDecoder decoder;
+    decoder.SetKeepDracoPayloads(true);
+    DRACO_ASSIGN_OR_RETURN(
+        scene_, decoder.DecodeFromFileToScene(file_options.input_filename));
+  } else {
+    DRACO_ASSIGN_OR_RETURN(scene_,
+                           ReadSceneFromFile(file_options.input_filename));
+  }
   return OkStatus();
 }
 
 Status DracoTranscoder::WriteScene(const FileOptions &file_options) {
+  gltf_encoder_.set_reuse_draco_payloads(
+      transcoding_options_.reuse_draco_payloads);
+  gltf_encoder_.set_compression_codec(transcoding_options_.compression_codec);
+  gltf_encoder_.set_meshopt_max_size_ratio(
+      transcoding_options_.meshopt_max_size_ratio);
   if (!file_options.output_bin_filename.empty() &&
       !file_options.output_resource_directory.empty()) {
     DRACO_RETURN_IF_ERROR(gltf_encoder_.EncodeFile<Scene>(
@@ -75,7 +139,64 @@ Status DracoTranscoder::WriteScene(const FileOptions &file_options) {
   return OkStatus();
 }
 
+Status DracoTranscoder::WriteLodScenes(const FileOptions &file_options) {
+  const std::vector<float> &ratios = transcoding_options_.lod_face_ratios;
+  std::vector<Status> statuses(ratios.size(), OkStatus());
+  ParallelFor(gltf_encoder_.thread_pool(), static_cast<int>(ratios.size()),
+              [&](int i) {
+                statuses[i] = WriteLodScene(file_options, i + 1, ratios[i]);
+              });
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status);
+  }
+  return OkStatus();
+}
+
+Status DracoTranscoder::WriteLodScene(const FileOptions &file_options,
+                                      int level, float face_ratio) const {
+  if (face_ratio <= 0.f || face_ratio > 1.f) {
+    return Status(Status::DRACO_ERROR, "Invalid level of detail face ratio.");
+  }
+  Scene lod_scene;
+  lod_scene.Copy(*scene_);
+  for (MeshIndex i(0); i < lod_scene.NumMeshes(); ++i) {
+    Mesh &mesh = lod_scene.GetMesh(i);
+    if (mesh.num_faces() == 0) {
+      continue;
+    }
+    const int target_num_faces =
+        static_cast<int>(mesh.num_faces() * static_cast<double>(face_ratio));
+    DRACO_ASSIGN_OR_RETURN(
+        const std::unique_ptr<Mesh> simplified,
+        MeshEdgeCollapseSimplifier::Simplify(mesh, target_num_faces));
+    mesh.Copy(*simplified);
+  }
+
+  // Insert the level suffix in front of the file extension.
+  const std::string &filename = file_options.output_filename;
+  const std::string base_filename = RemoveFileExtension(filename);
+  const std::string lod_filename = base_filename + "_lod" +
+                                   std::to_string(level) +
+                                   filename.substr(base_filename.size());
+  GltfEncoder encoder;
+  encoder.set_draco_mesh_cache(mesh_cache_.get());
+  encoder.set_compression_codec(transcoding_options_.compression_codec);
+  encoder.set_meshopt_max_size_ratio(
+      transcoding_options_.meshopt_max_size_ratio);
+  return encoder.EncodeFile<Scene>(lod_scene, lod_filename);
+}
+
 Status DracoTranscoder::CompressScene() {
+  if (transcoding_options_.deduplicate_meshes) {
+    SceneUtils::DeduplicateMeshes(scene_.get());
+  }
+
+  if (transcoding_options_.ktx2_texture_encoder != nullptr) {
+    DRACO_RETURN_IF_ERROR(TranscodeTexturesToKtx2(
+        *transcoding_options_.ktx2_texture_encoder, gltf_encoder_.thread_pool(),
+        &scene_->GetMaterialLibrary()));
+  }
+
   // Apply geometry compression settings to all scene meshes.
   SceneUtils::SetDracoCompressionOptions(&transcoding_options_.geometry,
                                          scene_.get());
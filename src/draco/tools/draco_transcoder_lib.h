@@ -19,11 +19,15 @@
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
 #include <string>
+#include <vector>
 
 #include "draco/compression/draco_compression_options.h"
 #include "draco/core/options.h"
+#include "draco/core/thread_pool.h"
+#include "draco/io/draco_mesh_cache.h"
 #include "draco/io/gltf_encoder.h"
 #include "draco/io/image_compression_options.h"
+#include "draco/io/texture_io.h"
 
 namespace draco {
 
@@ -33,6 +37,42 @@ struct DracoTranscodingOptions {
 
   // Options used when geometry compression optimization is disabled.
   DracoCompressionOptions geometry;
+
+  // Optional directory of a DracoMeshCache. When set, meshes that were already
+  // encoded with the same options, e.g. by an earlier run on a previous
+  // version of the input, are copied from the cache instead of being encoded.
+  std::string cache_directory;
+
+  // When set, base meshes with identical geometry are merged into a single
+  // mesh that is instanced by all mesh groups that referenced any of them.
+  bool deduplicate_meshes = false;
+
+  // When set, primitives of the input that are already compressed with
+  // KHR_draco_mesh_compression keep their compressed data if their geometry
+  // was not changed and the data is quantized at least as finely as
+  // requested by |geometry|. The data is then not encoded again.
+  bool reuse_draco_payloads = false;
+
+  // Codec of the compressed meshes. With GltfEncoder::AUTO, each primitive is
+  // written with EXT_meshopt_compression when its meshopt data is at most
+  // |meshopt_max_size_ratio| times the size of its Draco data, and with
+  // KHR_draco_mesh_compression otherwise.
+  GltfEncoder::CompressionCodec compression_codec = GltfEncoder::DRACO;
+  float meshopt_max_size_ratio = 1.5f;
+
+  // Levels of detail written next to the output file. For each ratio, the
+  // meshes of the scene are simplified to the ratio of their faces and the
+  // result is written to the output filename with a "_lod<n>" suffix, where
+  // <n> starts at 1. The levels are compressed in parallel on the thread pool
+  // of the transcoder.
+  std::vector<float> lod_face_ratios;
+
+  // Optional encoder that transcodes the textures of the materials into KTX2
+  // with Basis Universal supercompression. The textures are transcoded in
+  // parallel on the thread pool of the transcoder and the output references
+  // them with the KHR_texture_basisu extension. The encoder is not owned and
+  // must outlive the transcoder.
+  const Ktx2TextureEncoderInterface *ktx2_texture_encoder = nullptr;
 };
 
 // Class that supports input of glTF (and some simple USD) files, encodes
@@ -43,6 +83,8 @@ struct DracoTranscodingOptions {
 //    KHR_draco_mesh_compression. http://shortn/_L5tPQqdwWf
 //    KHR_materials_unlit. http://shortn/_3eaDLoIGam
 //    KHR_texture_transform. http://shortn/_PORWgVTEe8
+//  Output:
+//    EXT_meshopt_compression, see DracoTranscodingOptions::compression_codec.
 //
 // glTF unsupported features:
 //  Input and Output:
@@ -77,6 +119,22 @@ class DracoTranscoder {
   // transcoder once and call Transcode for multiple files.
   Status Transcode(const FileOptions &file_options);
 
+  // Transcodes all |files| with |options| on |num_threads| threads, including
+  // the calling thread. The files are distributed over the threads and the
+  // meshes of each file are compressed in parallel on the same threads. Each
+  // thread reuses one DracoTranscoder for all of its files. The result of each
+  // file is stored in |statuses|. Returns an error only when |options| are
+  // invalid.
+  static Status TranscodeBatch(const DracoTranscodingOptions &options,
+                               const std::vector<FileOptions> &files,
+                               int num_threads, std::vector<Status> *statuses);
+
+  // Sets an optional thread pool that is used to compress the meshes of a
+  // scene in parallel. The pool is not owned and must outlive the transcoder.
+  void set_thread_pool(ThreadPool *thread_pool) {
+    gltf_encoder_.set_thread_pool(thread_pool);
+  }
+
  private:
   // Read scene from file.
   Status ReadScene(const FileOptions &file_options);
@@ -87,9 +145,19 @@ class DracoTranscoder {
   // Apply compression settings to the scene.
   Status CompressScene();
 
+  // Writes all levels of detail of the compressed scene.
+  Status WriteLodScenes(const FileOptions &file_options);
+
+  // Writes level of detail |level| with |face_ratio| of the faces.
+  Status WriteLodScene(const FileOptions &file_options, int level,
+                       float face_ratio) const;
+
  private:
   GltfEncoder gltf_encoder_;
 
+  // Cache of encoded meshes, present when a cache directory is set.
+  std::unique_ptr<DracoMeshCache> mesh_cache_;
+
   // The scene being transcoded.
   std::unique_ptr<Scene> scene_;
 
@@ -16,9 +16,16 @@
 
 #include "draco/tools/draco_transcoder_lib.h"
 
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
 #include "draco/io/file_utils.h"
+#include "draco/io/scene_io.h"
+#include "draco/scene/scene_utils.h"
 
 // Tests encoding a .gltf file with default Draco compression.
 TEST(DracoTranscoderTest, DefaultDracoCompression) {
@@ -169,4 +176,117 @@ TEST(DracoTranscoderTest, TestPositionQuantization) {
   ASSERT_GT(first_glb_size, second_glb_size);
 }
 
+// Tests transcoding a batch of files on multiple threads.
+TEST(DracoTranscoderTest, TranscodeBatch) {
+  std::vector<draco::DracoTranscoder::FileOptions> files(3);
+  files[0].input_filename = draco::GetTestFileFullPath("sphere.gltf");
+  files[0].output_filename = draco::GetTestTempFileFullPath("batch0.gltf");
+  files[1].input_filename =
+      draco::GetTestFileFullPath("CesiumMan/glTF/CesiumMan.gltf");
+  files[1].output_filename = draco::GetTestTempFileFullPath("batch1.gltf");
+  files[2].input_filename = draco::GetTestFileFullPath("missing_file.gltf");
+  files[2].output_filename = draco::GetTestTempFileFullPath("batch2.gltf");
+
+  const draco::DracoTranscodingOptions options;
+  std::vector<draco::Status> statuses;
+  DRACO_ASSERT_OK(
+      draco::DracoTranscoder::TranscodeBatch(options, files, 2, &statuses));
+  ASSERT_EQ(statuses.size(), 3);
+  DRACO_ASSERT_OK(statuses[0]);
+  DRACO_ASSERT_OK(statuses[1]);
+  ASSERT_FALSE(statuses[2].ok());
+  ASSERT_GT(draco::GetFileSize(draco::GetTestTempFileFullPath("batch0.bin")),
+            0);
+  ASSERT_GT(draco::GetFileSize(draco::GetTestTempFileFullPath("batch1.bin")),
+            0);
+}
+
+TEST(DracoTranscoderTest, TranscodeWithMeshCache) {
+  draco::DracoTranscodingOptions options;
+  options.cache_directory = draco::GetTestTempFileFullPath("transcoder_cache");
+  draco::DracoTranscoder::FileOptions file_options;
+  file_options.input_filename = draco::GetTestFileFullPath("sphere.gltf");
+
+  // The first run fills the cache and the second run reads from it. Both runs
+  // must produce the same output.
+  std::vector<char> outputs[2];
+  for (int i = 0; i < 2; ++i) {
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::DracoTranscoder> dt,
+                           draco::DracoTranscoder::Create(options));
+    file_options.output_filename =
+        draco::GetTestTempFileFullPath("cached" + std::to_string(i) + ".glb");
+    DRACO_ASSERT_OK(dt->Transcode(file_options));
+    ASSERT_TRUE(
+        draco::ReadFileToBuffer(file_options.output_filename, &outputs[i]));
+  }
+  ASSERT_FALSE(outputs[0].empty());
+  ASSERT_EQ(outputs[0], outputs[1]);
+}
+
+TEST(DracoTranscoderTest, TranscodeWithLods) {
+  draco::DracoTranscodingOptions options;
+  options.lod_face_ratios = {0.5f, 0.25f};
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::DracoTranscoder> dt,
+                         draco::DracoTranscoder::Create(options));
+  draco::DracoTranscoder::FileOptions file_options;
+  file_options.input_filename = draco::GetTestFileFullPath("sphere.gltf");
+  file_options.output_filename = draco::GetTestTempFileFullPath("lods.glb");
+  DRACO_ASSERT_OK(dt->Transcode(file_options));
+
+  // Each level of detail must have fewer faces than the previous one.
+  int num_faces = std::numeric_limits<int>::max();
+  for (const std::string &suffix : {"", "_lod1", "_lod2"}) {
+    DRACO_ASSIGN_OR_ASSERT(
+        const std::unique_ptr<draco::Scene> scene,
+        draco::ReadSceneFromFile(
+            draco::GetTestTempFileFullPath("lods" + suffix + ".glb")));
+    const int level_num_faces =
+        draco::SceneUtils::NumFacesOnBaseMeshes(*scene);
+    ASSERT_LT(level_num_faces, num_faces);
+    num_faces = level_num_faces;
+  }
+}
+
+// Encoder that stores the KTX2 identifier followed by the source image data.
+class FakeKtx2TextureEncoder : public draco::Ktx2TextureEncoderInterface {
+ public:
+  draco::Status EncodeToKtx2(const draco::Texture &texture,
+                             const std::vector<uint8_t> &image_data,
+                             draco::TextureMap::Type type,
+                             std::vector<uint8_t> *ktx2_data) const override {
+    *ktx2_data = {0xab, 0x4b, 0x54, 0x58, 0x20, 0x32,
+                  0x30, 0xbb, 0x0d, 0x0a, 0x1a, 0x0a};
+    ktx2_data->insert(ktx2_data->end(), image_data.begin(), image_data.end());
+    return draco::OkStatus();
+  }
+};
+
+// Tests that textures are transcoded to KTX2 and referenced with the
+// KHR_texture_basisu extension.
+TEST(DracoTranscoderTest, TranscodeTexturesToKtx2) {
+  const FakeKtx2TextureEncoder encoder;
+  draco::DracoTranscodingOptions options;
+  options.ktx2_texture_encoder = &encoder;
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::DracoTranscoder> dt,
+                         draco::DracoTranscoder::Create(options));
+  draco::ThreadPool pool(2);
+  dt->set_thread_pool(&pool);
+
+  draco::DracoTranscoder::FileOptions file_options;
+  file_options.input_filename = draco::GetTestFileFullPath("sphere.gltf");
+  file_options.output_filename = draco::GetTestTempFileFullPath("ktx2.gltf");
+  DRACO_ASSERT_OK(dt->Transcode(file_options));
+
+  ASSERT_GT(draco::GetFileSize(
+                draco::GetTestTempFileFullPath("sphere_Texture0_Normal.ktx2")),
+            0);
+  std::vector<char> gltf_data;
+  ASSERT_TRUE(
+      draco::ReadFileToBuffer(file_options.output_filename, &gltf_data));
+  const std::string gltf(gltf_data.begin(), gltf_data.end());
+  ASSERT_NE(gltf.find("\"extensionsRequired\""), std::string::npos);
+  ASSERT_NE(gltf.find("KHR_texture_basisu"), std::string::npos);
+  ASSERT_NE(gltf.find("image/ktx2"), std::string::npos);
+}
+
 #endif  // DRACO_TRANSCODER_SUPPORTED
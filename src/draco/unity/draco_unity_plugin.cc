@@ -16,6 +16,13 @@
 
 #ifdef DRACO_UNITY_PLUGIN
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include "draco/core/thread_pool.h"
+
 namespace {
 // Returns a DracoAttribute from a PointAttribute.
 draco::DracoAttribute *CreateDracoAttribute(const draco::PointAttribute *attr) {
@@ -33,38 +40,139 @@ draco::DracoAttribute *CreateDracoAttribute(const draco::PointAttribute *attr) {
 template <typename T>
 T *CopyAttributeData(int num_points, const draco::PointAttribute *attr) {
   const int num_components = attr->num_components();
+  if (num_components < 1 || num_components > 4) {
+    return nullptr;
+  }
   T *const data = new T[num_points * num_components];
+  if (!attr->ConvertAllValues<T>(num_points, num_components, data,
+                                 sizeof(T) * num_components)) {
+    delete[] data;
+    return nullptr;
+  }
 
-  for (draco::PointIndex i(0); i < num_points; ++i) {
-    const draco::AttributeValueIndex val_index = attr->mapped_index(i);
-    bool got_data = false;
-    switch (num_components) {
-      case 1:
-        got_data = attr->ConvertValue<T, 1>(val_index,
-                                            data + i.value() * num_components);
-        break;
-      case 2:
-        got_data = attr->ConvertValue<T, 2>(val_index,
-                                            data + i.value() * num_components);
-        break;
-      case 3:
-        got_data = attr->ConvertValue<T, 3>(val_index,
-                                            data + i.value() * num_components);
-        break;
-      case 4:
-        got_data = attr->ConvertValue<T, 4>(val_index,
-                                            data + i.value() * num_components);
-        break;
-      default:
-        break;
-    }
-    if (!got_data) {
-      delete[] data;
-      return nullptr;
+  return data;
+}
+
+// Returns |value| converted to a half precision float, rounded to nearest
+// even.
+uint16_t FloatToHalf(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  const uint32_t abs_bits = bits & 0x7fffffff;
+  if (abs_bits >= 0x7f800000) {
+    // Infinity or NaN.
+    return sign | (abs_bits > 0x7f800000 ? 0x7e00 : 0x7c00);
+  }
+  if (abs_bits >= 0x477ff000) {
+    // Values that round above the largest half float.
+    return sign | 0x7c00;
+  }
+  if (abs_bits < 0x38800000) {
+    // Subnormal half floats are multiples of 2^-24.
+    return sign | static_cast<uint16_t>(
+                      std::nearbyint(std::fabs(value) * 16777216.f));
+  }
+  // Rebias the exponent and round the mantissa to 10 bits.
+  const uint32_t rounded = abs_bits + 0xfff + ((abs_bits >> 13) & 1);
+  return sign | static_cast<uint16_t>((rounded - 0x38000000) >> 13);
+}
+
+// Writes |num_components| |values| to |dst| as normalized integers of type T.
+template <typename T>
+void WriteNormalizedValues(const float *values, int num_components,
+                           uint8_t *dst) {
+  const float min_value = std::numeric_limits<T>::is_signed ? -1.f : 0.f;
+  const float scale = static_cast<float>(std::numeric_limits<T>::max());
+  T out[4];
+  for (int c = 0; c < num_components; ++c) {
+    const float v = std::min(std::max(values[c], min_value), 1.f);
+    out[c] = static_cast<T>(std::lround(v * scale));
+  }
+  memcpy(dst, out, sizeof(T) * num_components);
+}
+
+// Writes the value |avi| of |attr| to |dst| as |num_components| integers of
+// type T.
+template <typename T>
+bool WriteIntegerValues(const draco::PointAttribute *attr,
+                        draco::AttributeValueIndex avi, int num_components,
+                        uint8_t *dst) {
+  // Values are converted to a local buffer, because the stream layout does not
+  // guarantee the alignment of T.
+  T out[4];
+  if (!attr->ConvertValue<T>(avi, num_components, out)) {
+    return false;
+  }
+  memcpy(dst, out, sizeof(T) * num_components);
+  return true;
+}
+
+// Writes the value |avi| of |attr| to |dst| in the format of |desc|.
+bool WriteVertexValue(const draco::PointAttribute *attr,
+                      draco::AttributeValueIndex avi,
+                      const draco::DracoVertexAttributeDescriptor &desc,
+                      uint8_t *dst) {
+  const int num_components = desc.num_components;
+  switch (desc.format) {
+    case draco::VAF_UINT8:
+      return WriteIntegerValues<uint8_t>(attr, avi, num_components, dst);
+    case draco::VAF_SINT8:
+      return WriteIntegerValues<int8_t>(attr, avi, num_components, dst);
+    case draco::VAF_UINT16:
+      return WriteIntegerValues<uint16_t>(attr, avi, num_components, dst);
+    case draco::VAF_SINT16:
+      return WriteIntegerValues<int16_t>(attr, avi, num_components, dst);
+    case draco::VAF_UINT32:
+      return WriteIntegerValues<uint32_t>(attr, avi, num_components, dst);
+    case draco::VAF_SINT32:
+      return WriteIntegerValues<int32_t>(attr, avi, num_components, dst);
+    default:
+      break;
+  }
+  // All other formats are converted from floats.
+  float values[4];
+  if (!attr->ConvertValue<float>(avi, num_components, values)) {
+    return false;
+  }
+  switch (desc.format) {
+    case draco::VAF_FLOAT32:
+      memcpy(dst, values, sizeof(float) * num_components);
+      return true;
+    case draco::VAF_FLOAT16: {
+      uint16_t out[4];
+      for (int c = 0; c < num_components; ++c) {
+        out[c] = FloatToHalf(values[c]);
+      }
+      memcpy(dst, out, sizeof(uint16_t) * num_components);
+      return true;
     }
+    case draco::VAF_UNORM8:
+      WriteNormalizedValues<uint8_t>(values, num_components, dst);
+      return true;
+    case draco::VAF_SNORM8:
+      WriteNormalizedValues<int8_t>(values, num_components, dst);
+      return true;
+    case draco::VAF_UNORM16:
+      WriteNormalizedValues<uint16_t>(values, num_components, dst);
+      return true;
+    case draco::VAF_SNORM16:
+      WriteNormalizedValues<int16_t>(values, num_components, dst);
+      return true;
+    default:
+      return false;
   }
+}
 
-  return data;
+// Writes the indices of all faces of |mesh| to |indices| as type T.
+template <typename T>
+void CopyIndices(const draco::Mesh &mesh, T *indices) {
+  for (draco::FaceIndex face_id(0); face_id < mesh.num_faces(); ++face_id) {
+    const draco::Mesh::Face &face = mesh.face(face_id);
+    for (int c = 0; c < 3; ++c) {
+      indices[face_id.value() * 3 + c] = static_cast<T>(face[c].value());
+    }
+  }
 }
 
 // Returns the attribute data in |attr| as an array of void*.
@@ -186,6 +294,86 @@ int EXPORT_API DecodeDracoMesh(char *data, unsigned int length,
   return unity_mesh->num_faces;
 }
 
+int EXPORT_API DecodeDracoMeshes(char **data, const unsigned int *lengths,
+                                 int num_meshes, int num_threads,
+                                 DracoMesh **meshes) {
+  if (data == nullptr || lengths == nullptr || meshes == nullptr) {
+    return 0;
+  }
+  // The calling thread takes part in the decoding.
+  std::unique_ptr<ThreadPool> pool;
+  if (num_threads > 1) {
+    pool.reset(new ThreadPool(num_threads - 1));
+  }
+  ParallelFor(pool.get(), num_meshes, [&](int i) {
+    if (DecodeDracoMesh(data[i], lengths[i], &meshes[i]) < 0) {
+      ReleaseDracoMesh(&meshes[i]);
+    }
+  });
+  int num_decoded = 0;
+  for (int i = 0; i < num_meshes; ++i) {
+    if (meshes[i] != nullptr) {
+      ++num_decoded;
+    }
+  }
+  return num_decoded;
+}
+
+DataType EXPORT_API GetDracoMeshIndexType(const DracoMesh *mesh) {
+  const int kMaxUInt16Vertices = std::numeric_limits<uint16_t>::max() + 1;
+  return mesh != nullptr && mesh->num_vertices <= kMaxUInt16Vertices
+             ? DT_UINT16
+             : DT_UINT32;
+}
+
+bool EXPORT_API CopyDracoMeshToStreams(
+    const DracoMesh *mesh, DataType index_type, void *indices,
+    const DracoVertexAttributeDescriptor *descriptors, int num_descriptors) {
+  // Unity supports at most 16 vertex attributes.
+  constexpr int kMaxDescriptors = 16;
+  if (mesh == nullptr || num_descriptors < 0 ||
+      num_descriptors > kMaxDescriptors ||
+      (num_descriptors > 0 && descriptors == nullptr)) {
+    return false;
+  }
+  const Mesh *const m = static_cast<const Mesh *>(mesh->private_mesh);
+  if (indices != nullptr) {
+    if (index_type == DT_UINT32) {
+      CopyIndices(*m, static_cast<uint32_t *>(indices));
+    } else if (index_type == DT_UINT16 &&
+               GetDracoMeshIndexType(mesh) == DT_UINT16) {
+      CopyIndices(*m, static_cast<uint16_t *>(indices));
+    } else {
+      return false;
+    }
+  }
+
+  const PointAttribute *attributes[kMaxDescriptors];
+  uint8_t *streams[kMaxDescriptors];
+  for (int i = 0; i < num_descriptors; ++i) {
+    const DracoVertexAttributeDescriptor &desc = descriptors[i];
+    attributes[i] =
+        m->GetNamedAttribute(desc.attribute_type, desc.attribute_index);
+    if (attributes[i] == nullptr || desc.stream == nullptr ||
+        desc.num_components < 1 || desc.num_components > 4) {
+      return false;
+    }
+    streams[i] = static_cast<uint8_t *>(desc.stream) + desc.offset;
+  }
+  // Write all attributes of a vertex before moving to the next one, so that
+  // interleaved streams are filled sequentially.
+  for (PointIndex p(0); p < m->num_points(); ++p) {
+    for (int i = 0; i < num_descriptors; ++i) {
+      if (!WriteVertexValue(attributes[i], attributes[i]->mapped_index(p),
+                            descriptors[i], streams[i])) {
+        return false;
+      }
+      streams[i] += descriptors[i].stride;
+    }
+  }
+  return true;
+}
+
 bool EXPORT_API GetAttribute(const DracoMesh *mesh, int index,
                              DracoAttribute **attribute) {
   if (mesh == nullptr || attribute == nullptr || *attribute != nullptr) {
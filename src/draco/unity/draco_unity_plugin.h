@@ -111,6 +111,76 @@ bool EXPORT_API GetAttributeData(const DracoMesh *mesh,
                                  const DracoAttribute *attribute,
                                  DracoData **data);
 
+// Decodes |num_meshes| compressed Draco meshes stored in |data| and |lengths|
+// in parallel on |num_threads| threads, including the calling thread. On
+// input, all entries of |meshes| must be null. Meshes that fail to decode are
+// left null. Returns the number of decoded meshes. The returned meshes must be
+// released with ReleaseDracoMesh.
+int EXPORT_API DecodeDracoMeshes(char **data, const unsigned int *lengths,
+                                 int num_meshes, int num_threads,
+                                 DracoMesh **meshes);
+
+// Formats of vertex attribute components. The values match
+// UnityEngine.Rendering.VertexAttributeFormat.
+enum DracoVertexAttributeFormat {
+  VAF_FLOAT32 = 0,
+  VAF_FLOAT16,
+  VAF_UNORM8,
+  VAF_SNORM8,
+  VAF_UNORM16,
+  VAF_SNORM16,
+  VAF_UINT8,
+  VAF_SINT8,
+  VAF_UINT16,
+  VAF_SINT16,
+  VAF_UINT32,
+  VAF_SINT32,
+};
+
+// Struct describing where the values of a Draco attribute are written in a
+// vertex stream, matching UnityEngine.Rendering.VertexAttributeDescriptor.
+// Attributes sharing a stream are interleaved: the values of vertex i start at
+// |stream| + i * |stride| + |offset|.
+struct EXPORT_API DracoVertexAttributeDescriptor {
+  DracoVertexAttributeDescriptor()
+      : attribute_type(GeometryAttribute::INVALID),
+        attribute_index(0),
+        format(VAF_FLOAT32),
+        num_components(0),
+        stream(nullptr),
+        offset(0),
+        stride(0) {}
+
+  // Attribute of |attribute_type| at |attribute_index| as in
+  // GetAttributeByType.
+  GeometryAttribute::Type attribute_type;
+  int attribute_index;
+  // Format of the written values. Values are converted from the decoded data
+  // type and missing components are set to zero. Normalized formats map the
+  // range [0, 1], or [-1, 1] for signed formats, to the full integer range.
+  DracoVertexAttributeFormat format;
+  int num_components;
+  void *stream;
+  int offset;
+  int stride;
+};
+
+// Returns DT_UINT16 when all indices of |mesh| fit into 16 bits, otherwise
+// DT_UINT32.
+DataType EXPORT_API GetDracoMeshIndexType(const DracoMesh *mesh);
+
+// Writes the indices of |mesh| as |index_type|, DT_UINT16 or DT_UINT32, to
+// |indices| and the attributes described by |descriptors| to their streams,
+// e.g. the NativeArray buffers of a Unity Mesh.MeshData. All attributes are
+// converted and interleaved in a single pass over the vertices. All buffers
+// are provided by the caller and must be large enough for |mesh|. |indices|
+// can be null to skip the indices. The function does not allocate memory and
+// only reads |mesh|, so it can run in Unity jobs concurrently for different
+// meshes. Returns false when an attribute is missing or cannot be converted.
+bool EXPORT_API CopyDracoMeshToStreams(
+    const DracoMesh *mesh, DataType index_type, void *indices,
+    const DracoVertexAttributeDescriptor *descriptors, int num_descriptors);
+
 // DracoToUnityMesh is deprecated.
 struct EXPORT_API DracoToUnityMesh {
   DracoToUnityMesh()
@@ -14,6 +14,7 @@
 //
 #include "draco/unity/draco_unity_plugin.h"
 
+#include <cmath>
 #include <fstream>
 #include <memory>
 #include <sstream>
@@ -24,11 +25,11 @@
 
 namespace {
 
-draco::DracoMesh *DecodeToDracoMesh(const std::string &file_name) {
+std::vector<char> ReadTestFile(const std::string &file_name) {
   std::ifstream input_file(draco::GetTestFileFullPath(file_name),
                            std::ios::binary);
   if (!input_file) {
-    return nullptr;
+    return std::vector<char>();
   }
   // Read the file stream into a buffer.
   std::streampos file_size = 0;
@@ -37,6 +38,22 @@ draco::DracoMesh *DecodeToDracoMesh(const std::string &file_name) {
   input_file.seekg(0, std::ios::beg);
   std::vector<char> data(file_size);
   input_file.read(data.data(), file_size);
+  return data;
+}
+
+// Returns the value of the half precision float |half|.
+float HalfToFloat(uint16_t half) {
+  const int exponent = (half >> 10) & 0x1f;
+  const int mantissa = half & 0x3ff;
+  const float value =
+      exponent == 0 ? std::ldexp(static_cast<float>(mantissa), -24)
+                    : std::ldexp(static_cast<float>(mantissa + 1024),
+                                 exponent - 25);
+  return (half & 0x8000) ? -value : value;
+}
+
+draco::DracoMesh *DecodeToDracoMesh(const std::string &file_name) {
+  std::vector<char> data = ReadTestFile(file_name);
   if (data.empty()) {
     return nullptr;
   }
@@ -199,6 +216,89 @@ TEST(DracoUnityPluginTest, TestAttributeUniqueId) {
   draco::ReleaseDracoMesh(&draco_mesh);
 }
 
+TEST(DracoUnityPluginTest, TestDecodeBatchToStreams) {
+  // Decode the same mesh twice in parallel and write positions and normals to
+  // one interleaved stream.
+  std::vector<char> data = ReadTestFile("test_nm.obj.edgebreaker.cl4.2.2.drc");
+  ASSERT_FALSE(data.empty());
+  char *arrays[2] = {data.data(), data.data()};
+  const unsigned int lengths[2] = {static_cast<unsigned int>(data.size()),
+                                   static_cast<unsigned int>(data.size())};
+  draco::DracoMesh *meshes[2] = {nullptr, nullptr};
+  ASSERT_EQ(draco::DecodeDracoMeshes(arrays, lengths, 2, 2, meshes), 2);
+
+  // Reference values from the allocating API.
+  draco::DracoData *ref_indices = nullptr;
+  ASSERT_TRUE(draco::GetMeshIndices(meshes[0], &ref_indices));
+  draco::DracoAttribute *pos_attribute = nullptr;
+  ASSERT_TRUE(draco::GetAttributeByType(
+      meshes[0], draco::GeometryAttribute::POSITION, 0, &pos_attribute));
+  draco::DracoData *ref_positions = nullptr;
+  ASSERT_TRUE(
+      draco::GetAttributeData(meshes[0], pos_attribute, &ref_positions));
+
+  draco::DracoVertexAttributeDescriptor descriptors[2];
+  descriptors[0].attribute_type = draco::GeometryAttribute::POSITION;
+  descriptors[1].attribute_type = draco::GeometryAttribute::NORMAL;
+  std::vector<float> stream(meshes[1]->num_vertices * 6);
+  for (int i = 0; i < 2; ++i) {
+    descriptors[i].format = draco::VAF_FLOAT32;
+    descriptors[i].num_components = 3;
+    descriptors[i].stream = stream.data();
+    descriptors[i].offset = i * 3 * sizeof(float);
+    descriptors[i].stride = 6 * sizeof(float);
+  }
+  ASSERT_EQ(draco::GetDracoMeshIndexType(meshes[1]), draco::DT_UINT16);
+  std::vector<uint16_t> indices(meshes[1]->num_faces * 3);
+  ASSERT_TRUE(draco::CopyDracoMeshToStreams(meshes[1], draco::DT_UINT16,
+                                            indices.data(), descriptors, 2));
+
+  const int *const ref_index_values = static_cast<int *>(ref_indices->data);
+  for (int i = 0; i < meshes[1]->num_faces * 3; ++i) {
+    ASSERT_EQ(indices[i], ref_index_values[i]);
+  }
+  const float *const ref_position_values =
+      static_cast<float *>(ref_positions->data);
+  for (int i = 0; i < meshes[1]->num_vertices; ++i) {
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_EQ(stream[i * 6 + c], ref_position_values[i * 3 + c]);
+    }
+  }
+
+  // Write half float positions and signed normalized normals.
+  std::vector<uint16_t> half_stream(meshes[1]->num_vertices * 6);
+  descriptors[0].format = draco::VAF_FLOAT16;
+  descriptors[1].format = draco::VAF_SNORM16;
+  for (int i = 0; i < 2; ++i) {
+    descriptors[i].stream = half_stream.data();
+    descriptors[i].offset = i * 3 * sizeof(uint16_t);
+    descriptors[i].stride = 6 * sizeof(uint16_t);
+  }
+  ASSERT_TRUE(draco::CopyDracoMeshToStreams(meshes[1], draco::DT_UINT32,
+                                            nullptr, descriptors, 2));
+  for (int i = 0; i < meshes[1]->num_vertices; ++i) {
+    for (int c = 0; c < 3; ++c) {
+      const float ref = ref_position_values[i * 3 + c];
+      ASSERT_NEAR(HalfToFloat(half_stream[i * 6 + c]), ref,
+                  std::fabs(ref) / 1024.f);
+      const float normal = stream[i * 6 + 3 + c];
+      ASSERT_NEAR(static_cast<int16_t>(half_stream[i * 6 + 3 + c]) / 32767.f,
+                  normal, 1.f / 32767.f);
+    }
+  }
+
+  // Missing attributes are reported.
+  descriptors[1].attribute_type = draco::GeometryAttribute::COLOR;
+  ASSERT_FALSE(draco::CopyDracoMeshToStreams(meshes[1], draco::DT_UINT32,
+                                             nullptr, descriptors, 2));
+
+  draco::ReleaseDracoData(&ref_positions);
+  draco::ReleaseDracoAttribute(&pos_attribute);
+  draco::ReleaseDracoData(&ref_indices);
+  draco::ReleaseDracoMesh(&meshes[0]);
+  draco::ReleaseDracoMesh(&meshes[1]);
+}
+
 class DeprecatedDracoUnityPluginTest : public ::testing::Test {
  protected:
   DeprecatedDracoUnityPluginTest() : unity_mesh_(nullptr) {}